@@ -0,0 +1,317 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file stats_collector.cpp
+ *
+ * @brief UR collector library example which aggregates statistics of the
+ * traced calls, for use with the XPTI framework.
+ *
+ * Unlike the collector example, which formats and prints every call, this
+ * collector only counts the calls, errors and host latencies of each UR
+ * function, and prints them once tracing finishes. Each thread updates a
+ * fixed-size table of its own, keyed by function id, so the callback takes
+ * no lock and doesn't allocate, apart from registering the table on the
+ * first call of each thread, and its cost doesn't depend on the call rate.
+ * This makes it suitable to stay attached to production workloads, and a
+ * starting point for custom low-overhead collectors.
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "ur_api.h"
+#include "xpti/xpti_trace_framework.h"
+
+constexpr uint16_t TRACE_FN_BEGIN =
+    static_cast<uint16_t>(xpti::trace_point_type_t::function_with_args_begin);
+constexpr uint16_t TRACE_FN_END =
+    static_cast<uint16_t>(xpti::trace_point_type_t::function_with_args_end);
+constexpr std::string_view UR_STREAM_NAME = "ur.call";
+
+using clock_type = std::chrono::steady_clock;
+
+/**
+ * A counter which is only written by the thread which owns it, so it can be
+ * incremented without an atomic read-modify-write, and read by others.
+ */
+struct counter_t {
+    void add(uint64_t value) {
+        count.store(count.load(std::memory_order_relaxed) + value,
+                    std::memory_order_relaxed);
+    }
+    uint64_t get() const { return count.load(std::memory_order_relaxed); }
+
+    std::atomic<uint64_t> count{0};
+};
+
+/**
+ * @brief The statistics of the calls of a UR function.
+ *
+ * The latencies are counted in power of two buckets of nanoseconds, so the
+ * percentiles are within a factor of two.
+ */
+struct function_stats_t {
+    static constexpr size_t num_buckets = 40; // up to ~18 minutes
+
+    void add(uint64_t ns, bool error) {
+        size_t bucket = 0;
+        while (bucket + 1 < num_buckets && (ns >> (bucket + 1))) {
+            bucket++;
+        }
+        calls.add(1);
+        errors.add(error);
+        total_ns.add(ns);
+        buckets[bucket].add(1);
+    }
+
+    std::atomic<uint32_t> function_id{0}; // 0 is an empty slot
+    std::atomic<const char *> name{nullptr};
+    counter_t calls;
+    counter_t errors;
+    counter_t total_ns;
+    std::array<counter_t, num_buckets> buckets;
+};
+
+/**
+ * @brief An open-addressed table of the statistics of the UR functions,
+ * with linear probing.
+ *
+ * It has more than twice as many slots as there are UR functions, so the
+ * probes are short and it never fills up.
+ */
+class stats_table_t {
+  public:
+    static constexpr size_t num_slots = 512;
+
+    function_stats_t *find(uint32_t function_id, const char *name) {
+        size_t slot = (function_id * 2654435761u) & (num_slots - 1);
+        for (size_t probe = 0; probe < num_slots; ++probe) {
+            auto &stats = slots[(slot + probe) & (num_slots - 1)];
+            uint32_t id = stats.function_id.load(std::memory_order_acquire);
+            if (id == function_id) {
+                return &stats;
+            }
+            if (id == 0) {
+                // Only the owning thread inserts
+                stats.name.store(name, std::memory_order_relaxed);
+                stats.function_id.store(function_id,
+                                        std::memory_order_release);
+                return &stats;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Adds the statistics of another table to those of this table
+    void merge(const stats_table_t &other) {
+        for (auto &from : other.slots) {
+            uint32_t id = from.function_id.load(std::memory_order_acquire);
+            if (id == 0) {
+                continue;
+            }
+            auto *to = find(id, from.name.load(std::memory_order_relaxed));
+            if (to == nullptr) {
+                continue;
+            }
+            to->calls.add(from.calls.get());
+            to->errors.add(from.errors.get());
+            to->total_ns.add(from.total_ns.get());
+            for (size_t i = 0; i < function_stats_t::num_buckets; ++i) {
+                to->buckets[i].add(from.buckets[i].get());
+            }
+        }
+    }
+
+    const std::array<function_stats_t, num_slots> &get_slots() const {
+        return slots;
+    }
+
+  private:
+    std::array<function_stats_t, num_slots> slots;
+};
+
+/**
+ * The tables of the running threads, and the merged tables of the threads
+ * which exited.
+ */
+static std::mutex tables_mutex;
+static std::vector<stats_table_t *> tables;
+static stats_table_t exited_tables;
+
+/**
+ * @brief The table and the calls in progress of a thread.
+ *
+ * The table is registered by the first call of the thread, and merged into
+ * exited_tables when it exits.
+ */
+struct thread_state_t {
+    static constexpr size_t max_depth = 16;
+
+    thread_state_t() {
+        std::lock_guard<std::mutex> lock(tables_mutex);
+        tables.push_back(&table);
+    }
+    ~thread_state_t() {
+        std::lock_guard<std::mutex> lock(tables_mutex);
+        exited_tables.merge(table);
+        for (auto it = tables.begin(); it != tables.end(); ++it) {
+            if (*it == &table) {
+                tables.erase(it);
+                break;
+            }
+        }
+    }
+
+    stats_table_t table;
+    // The start of the calls in progress, UR calls made by the adapters or
+    // layers nest
+    std::array<std::pair<uint64_t, clock_type::time_point>, max_depth> calls;
+    size_t depth = 0;
+};
+
+static thread_state_t &get_thread_state() {
+    static thread_local thread_state_t state;
+    return state;
+}
+
+/**
+ * @brief Tracing callback invoked by the dispatcher on every event.
+ *
+ * On begin, it records the start time of the call, and on end it adds the
+ * latency and result of the call to the table of the thread.
+ */
+XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
+                                xpti::trace_event_data_t *, uint64_t instance,
+                                const void *user_data) {
+    auto now = clock_type::now();
+    auto *args = static_cast<const xpti::function_with_args_t *>(user_data);
+    auto &state = get_thread_state();
+
+    if (trace_type == TRACE_FN_BEGIN) {
+        // Calls nested deeper aren't timed
+        if (state.depth < thread_state_t::max_depth) {
+            state.calls[state.depth] = {instance, now};
+        }
+        state.depth++;
+    } else if (trace_type == TRACE_FN_END) {
+        if (state.depth == 0) {
+            return;
+        }
+        state.depth--;
+        if (state.depth >= thread_state_t::max_depth ||
+            state.calls[state.depth].first != instance) {
+            return;
+        }
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      now - state.calls[state.depth].second)
+                      .count();
+        auto *stats = state.table.find(args->function_id, args->function_name);
+        if (stats == nullptr) {
+            return;
+        }
+        auto result = static_cast<const ur_result_t *>(args->ret_data);
+        stats->add(static_cast<uint64_t>(ns), *result != UR_RESULT_SUCCESS);
+    }
+}
+
+/**
+ * @brief Returns the upper bound of the bucket of the given fraction of the
+ * calls, in nanoseconds.
+ */
+static uint64_t percentile(const function_stats_t &stats, double fraction) {
+    uint64_t rank = static_cast<uint64_t>(fraction * stats.calls.get());
+    uint64_t count = 0;
+    for (size_t i = 0; i < function_stats_t::num_buckets; ++i) {
+        count += stats.buckets[i].get();
+        if (count > rank) {
+            return (uint64_t(2) << i) - 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Subscriber initialization function called by the XPTI dispatcher.
+ *
+ * Registers the callback for the begin and end of every UR call.
+ */
+XPTI_CALLBACK_API void xptiTraceInit(unsigned int major_version,
+                                     unsigned int minor_version, const char *,
+                                     const char *stream_name) {
+    if (stream_name == nullptr ||
+        std::string_view(stream_name) != UR_STREAM_NAME) {
+        return;
+    }
+    if (UR_MAKE_VERSION(major_version, minor_version) !=
+        UR_API_VERSION_CURRENT) {
+        fprintf(stderr, "Invalid stream version: %u.%u. Expected %u.%u.\n",
+                major_version, minor_version,
+                UR_MAJOR_VERSION(UR_API_VERSION_CURRENT),
+                UR_MINOR_VERSION(UR_API_VERSION_CURRENT));
+        return;
+    }
+
+    uint8_t stream_id = xptiRegisterStream(stream_name);
+    xptiRegisterCallback(stream_id, TRACE_FN_BEGIN, trace_cb);
+    xptiRegisterCallback(stream_id, TRACE_FN_END, trace_cb);
+}
+
+/**
+ * @brief Subscriber finish function called by the XPTI dispatcher.
+ *
+ * Merges the tables of all the threads and prints the statistics of each
+ * function that was called.
+ */
+XPTI_CALLBACK_API void xptiTraceFinish(const char *stream_name) {
+    if (stream_name == nullptr ||
+        std::string_view(stream_name) != UR_STREAM_NAME) {
+        return;
+    }
+
+    // Too large for the stack
+    auto totals = std::make_unique<stats_table_t>();
+    {
+        std::lock_guard<std::mutex> lock(tables_mutex);
+        totals->merge(exited_tables);
+        for (auto *table : tables) {
+            totals->merge(*table);
+        }
+    }
+
+    std::vector<const function_stats_t *> called;
+    for (auto &stats : totals->get_slots()) {
+        if (stats.calls.get()) {
+            called.push_back(&stats);
+        }
+    }
+    std::sort(called.begin(), called.end(), [](auto *a, auto *b) {
+        return a->calls.get() > b->calls.get();
+    });
+
+    printf("%-40s %12s %10s %12s %12s %12s\n", "function", "calls", "errors",
+           "mean (ns)", "p50 (ns)", "p99 (ns)");
+    for (auto *called_stats : called) {
+        auto &stats = *called_stats;
+        uint64_t calls = stats.calls.get();
+        printf("%-40s %12llu %10llu %12llu %12llu %12llu\n",
+               stats.name.load(std::memory_order_relaxed),
+               static_cast<unsigned long long>(calls),
+               static_cast<unsigned long long>(stats.errors.get()),
+               static_cast<unsigned long long>(stats.total_ns.get() / calls),
+               static_cast<unsigned long long>(percentile(stats, 0.5)),
+               static_cast<unsigned long long>(percentile(stats, 0.99)));
+    }
+}
@@ -228,6 +228,26 @@ typedef enum ur_function_t {
     UR_FUNCTION_LOADER_CONFIG_SET_MOCKING_ENABLED = 229,                  ///< Enumerator for ::urLoaderConfigSetMockingEnabled
     UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP = 230,        ///< Enumerator for ::urBindlessImagesReleaseExternalMemoryExp
     UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP = 231,     ///< Enumerator for ::urBindlessImagesMapExternalLinearMemoryExp
+    UR_FUNCTION_USM_POOL_TRIM_EXP = 232,                                  ///< Enumerator for ::urUSMPoolTrimExp
+    UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP = 233,                       ///< Enumerator for ::urEnqueueUSMDeviceAllocExp
+    UR_FUNCTION_ENQUEUE_USM_FREE_EXP = 234,                               ///< Enumerator for ::urEnqueueUSMFreeExp
+    UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP = 235,             ///< Enumerator for ::urEnqueueMemBufferCopyRectBatchExp
+    UR_FUNCTION_USM_GROWABLE_ALLOC_EXP = 236,                             ///< Enumerator for ::urUSMGrowableAllocExp
+    UR_FUNCTION_USM_GROWABLE_RESIZE_EXP = 237,                            ///< Enumerator for ::urUSMGrowableResizeExp
+    UR_FUNCTION_USM_GROWABLE_FREE_EXP = 238,                              ///< Enumerator for ::urUSMGrowableFreeExp
+    UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP = 239,                    ///< Enumerator for ::urEnqueueKernelLaunchBatchExp
+    UR_FUNCTION_KERNEL_SET_ARGS_EXP = 240,                                ///< Enumerator for ::urKernelSetArgsExp
+    UR_FUNCTION_EVENT_WAIT_ANY_EXP = 241,                                 ///< Enumerator for ::urEventWaitAnyExp
+    UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP = 242,                     ///< Enumerator for ::urEventGetExecutionStatusExp
+    UR_FUNCTION_QUEUE_GROUP_CREATE_EXP = 243,                             ///< Enumerator for ::urQueueGroupCreateExp
+    UR_FUNCTION_QUEUE_GROUP_RETAIN_EXP = 244,                             ///< Enumerator for ::urQueueGroupRetainExp
+    UR_FUNCTION_QUEUE_GROUP_RELEASE_EXP = 245,                            ///< Enumerator for ::urQueueGroupReleaseExp
+    UR_FUNCTION_QUEUE_GROUP_GET_QUEUE_EXP = 246,                          ///< Enumerator for ::urQueueGroupGetQueueExp
+    UR_FUNCTION_QUEUE_GROUP_FINISH_EXP = 247,                             ///< Enumerator for ::urQueueGroupFinishExp
+    UR_FUNCTION_QUEUE_GROUP_BARRIER_EXP = 248,                            ///< Enumerator for ::urQueueGroupBarrierExp
+    UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP = 249,                ///< Enumerator for ::urQueueReserveTimestampMarkersExp
+    UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP = 250,                       ///< Enumerator for ::urEnqueueTimestampMarkerExp
+    UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP = 251,                   ///< Enumerator for ::urQueueReadTimestampMarkersExp
     /// @cond
     UR_FUNCTION_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -285,6 +305,7 @@ typedef enum ur_structure_type_t {
     UR_STRUCTURE_TYPE_EXP_SAMPLER_ADDR_MODES = 0x2005,                       ///< ::ur_exp_sampler_addr_modes_t
     UR_STRUCTURE_TYPE_EXP_SAMPLER_CUBEMAP_PROPERTIES = 0x2006,               ///< ::ur_exp_sampler_cubemap_properties_t
     UR_STRUCTURE_TYPE_EXP_IMAGE_COPY_REGION = 0x2007,                        ///< ::ur_exp_image_copy_region_t
+    UR_STRUCTURE_TYPE_EXP_USM_HOST_POOL_DESC = 0x4000,                       ///< ::ur_exp_usm_host_pool_desc_t
     UR_STRUCTURE_TYPE_EXP_ENQUEUE_NATIVE_COMMAND_PROPERTIES = 0x3000,        ///< ::ur_exp_enqueue_native_command_properties_t
     /// @cond
     UR_STRUCTURE_TYPE_FORCE_UINT32 = 0x7fffffff
@@ -3763,6 +3784,23 @@ typedef enum ur_usm_pool_info_t {
                                           ///< It is unsuitable for general use in applications. This feature is
                                           ///< provided for identifying memory leaks.
     UR_USM_POOL_INFO_CONTEXT = 1,         ///< [::ur_context_handle_t] USM memory pool context info
+    UR_USM_POOL_INFO_USED_SIZE = 2,       ///< [size_t] Number of bytes of the live allocations made from the pool.
+    UR_USM_POOL_INFO_CACHED_SIZE = 3,     ///< [size_t] Number of bytes the pool holds which aren't used by live
+                                          ///< allocations.
+                                          ///< This includes the memory of freed allocations kept in per-thread caches.
+    UR_USM_POOL_INFO_PEAK_USED_SIZE = 4,  ///< [size_t] Highest number of bytes used by live allocations at any time
+                                          ///< so far.
+    UR_USM_POOL_INFO_BUCKET_HITS = 5,     ///< [uint64_t[]] Number of allocations served from memory already held by
+                                          ///< the pool, per size bucket.
+                                          ///< Bucket N counts the allocations of up to 64 << N bytes which don't fit
+                                          ///< bucket N - 1, the last bucket counts all larger allocations.
+    UR_USM_POOL_INFO_BUCKET_MISSES = 6,   ///< [uint64_t[]] Number of allocations which required the pool to
+                                          ///< allocate memory from the device, per size bucket.
+                                          ///< The buckets are the same as for ::UR_USM_POOL_INFO_BUCKET_HITS.
+    UR_USM_POOL_INFO_FRAGMENTATION = 7,   ///< [double] Share of the memory held by the pool which isn't used by live
+                                          ///< allocations, between 0 and 1.
+                                          ///< This is ::UR_USM_POOL_INFO_CACHED_SIZE divided by the sum of
+                                          ///< ::UR_USM_POOL_INFO_USED_SIZE and ::UR_USM_POOL_INFO_CACHED_SIZE.
     /// @cond
     UR_USM_POOL_INFO_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -3780,7 +3818,7 @@ typedef enum ur_usm_pool_info_t {
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hPool`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_USM_POOL_INFO_CONTEXT < propName`
+///         + `::UR_USM_POOL_INFO_FRAGMENTATION < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -4168,6 +4206,8 @@ typedef struct ur_program_properties_t {
 ///     - The application may call this function from simultaneous threads.
 ///     - The adapter may (but is not required to) perform validation of the
 ///       provided module during this call.
+///     - The memory pointed to by `pIL` must remain valid until the program is
+///       released, the adapter may use it without copying it.
 ///
 /// @remarks
 ///   _Analogues_
@@ -4212,6 +4252,8 @@ urProgramCreateWithIL(
 ///       context.
 ///     - The adapter may (but is not required to) perform validation of the
 ///       provided module during this call.
+///     - The memory pointed to by `pBinary` must remain valid until the program
+///       is released, the adapter may use it without copying it.
 ///
 /// @remarks
 ///   _Analogues_
@@ -5367,21 +5409,39 @@ urKernelGetSuggestedLocalWorkSize(
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Query queue info
 typedef enum ur_queue_info_t {
-    UR_QUEUE_INFO_CONTEXT = 0,         ///< [::ur_context_handle_t] context associated with this queue.
-    UR_QUEUE_INFO_DEVICE = 1,          ///< [::ur_device_handle_t] device associated with this queue.
-    UR_QUEUE_INFO_DEVICE_DEFAULT = 2,  ///< [::ur_queue_handle_t] the current default queue of the underlying
-                                       ///< device.
-    UR_QUEUE_INFO_FLAGS = 3,           ///< [::ur_queue_flags_t] the properties associated with
-                                       ///< ::ur_queue_properties_t::flags.
-    UR_QUEUE_INFO_REFERENCE_COUNT = 4, ///< [uint32_t] Reference count of the queue object.
-                                       ///< The reference count returned should be considered immediately stale.
-                                       ///< It is unsuitable for general use in applications. This feature is
-                                       ///< provided for identifying memory leaks.
-    UR_QUEUE_INFO_SIZE = 5,            ///< [uint32_t] The size of the queue on the device. Only a valid query
-                                       ///< if the queue was created with the `ON_DEVICE` queue flag, otherwise
-                                       ///< `::urQueueGetInfo` will return `::UR_RESULT_ERROR_INVALID_QUEUE`.
-    UR_QUEUE_INFO_EMPTY = 6,           ///< [::ur_bool_t] return true if the queue was empty at the time of the
-                                       ///< query
+    UR_QUEUE_INFO_CONTEXT = 0,              ///< [::ur_context_handle_t] context associated with this queue.
+    UR_QUEUE_INFO_DEVICE = 1,               ///< [::ur_device_handle_t] device associated with this queue.
+    UR_QUEUE_INFO_DEVICE_DEFAULT = 2,       ///< [::ur_queue_handle_t] the current default queue of the underlying
+                                            ///< device.
+    UR_QUEUE_INFO_FLAGS = 3,                ///< [::ur_queue_flags_t] the properties associated with
+                                            ///< ::ur_queue_properties_t::flags.
+    UR_QUEUE_INFO_REFERENCE_COUNT = 4,      ///< [uint32_t] Reference count of the queue object.
+                                            ///< The reference count returned should be considered immediately stale.
+                                            ///< It is unsuitable for general use in applications. This feature is
+                                            ///< provided for identifying memory leaks.
+    UR_QUEUE_INFO_SIZE = 5,                 ///< [uint32_t] The size of the queue on the device. Only a valid query
+                                            ///< if the queue was created with the `ON_DEVICE` queue flag, otherwise
+                                            ///< `::urQueueGetInfo` will return `::UR_RESULT_ERROR_INVALID_QUEUE`.
+    UR_QUEUE_INFO_EMPTY = 6,                ///< [::ur_bool_t] return true if the queue was empty at the time of the
+                                            ///< query
+    UR_QUEUE_INFO_COMMAND_COUNTS = 7,       ///< [uint64_t[]] Number of commands submitted to the queue, per command
+                                            ///< class.
+                                            ///< Entry 0 counts kernel launches, entry 1 memory copies, reads and
+                                            ///< writes, entry 2 memory fills and entry 3 all other commands.
+    UR_QUEUE_INFO_BYTES_COPIED = 8,         ///< [uint64_t[]] Number of bytes copied by the commands submitted to the
+                                            ///< queue, per direction.
+                                            ///< Entry 0 counts host to device copies, entry 1 device to host copies,
+                                            ///< entry 2 device to device copies and entry 3 the copies the adapter
+                                            ///< can't attribute to a direction without querying the pointers.
+    UR_QUEUE_INFO_BATCH_COUNT = 9,          ///< [uint64_t] Number of batches of commands the queue submitted to the
+                                            ///< device.
+                                            ///< Adapters which submit every command on its own count it as a batch.
+    UR_QUEUE_INFO_AVERAGE_BATCH_SIZE = 10,  ///< [double] Average number of commands per batch submitted to the device,
+                                            ///< 0 if there was none.
+    UR_QUEUE_INFO_HOST_WAIT_TIME = 11,      ///< [uint64_t] Total time in nanoseconds host threads spent blocked on the
+                                            ///< queue or on its events.
+    UR_QUEUE_INFO_CREATED_EVENT_COUNT = 12, ///< [uint64_t] Number of events created for the commands of the queue,
+                                            ///< including internal events.
     /// @cond
     UR_QUEUE_INFO_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -5408,13 +5468,17 @@ typedef enum ur_queue_flag_t {
                                                              ///< ignore this flag.
     UR_QUEUE_FLAG_SYNC_WITH_DEFAULT_STREAM = UR_BIT(10),     ///< Synchronize with the default stream. Only meaningful for CUDA. Other
                                                              ///< platforms may ignore this flag.
+    UR_QUEUE_FLAG_LOAD_BALANCED = UR_BIT(11),                ///< Hint: submit each command to the compute engine of the queue with the
+                                                             ///< fewest outstanding commands, instead of using them in turn. Only
+                                                             ///< meaningful for out-of-order queues of devices with multiple compute
+                                                             ///< engines. Other platforms may ignore this flag.
     /// @cond
     UR_QUEUE_FLAG_FORCE_UINT32 = 0x7fffffff
     /// @endcond
 
 } ur_queue_flag_t;
 /// @brief Bit Mask for validating ur_queue_flags_t
-#define UR_QUEUE_FLAGS_MASK 0xfffff800
+#define UR_QUEUE_FLAGS_MASK 0xfffff000
 
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Query information about a command queue
@@ -5431,7 +5495,7 @@ typedef enum ur_queue_flag_t {
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hQueue`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_QUEUE_INFO_EMPTY < propName`
+///         + `::UR_QUEUE_INFO_CREATED_EVENT_COUNT < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -5725,36 +5789,39 @@ urQueueFlush(
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Command type
 typedef enum ur_command_t {
-    UR_COMMAND_KERNEL_LAUNCH = 0,                      ///< Event created by ::urEnqueueKernelLaunch
-    UR_COMMAND_EVENTS_WAIT = 1,                        ///< Event created by ::urEnqueueEventsWait
-    UR_COMMAND_EVENTS_WAIT_WITH_BARRIER = 2,           ///< Event created by ::urEnqueueEventsWaitWithBarrier
-    UR_COMMAND_MEM_BUFFER_READ = 3,                    ///< Event created by ::urEnqueueMemBufferRead
-    UR_COMMAND_MEM_BUFFER_WRITE = 4,                   ///< Event created by ::urEnqueueMemBufferWrite
-    UR_COMMAND_MEM_BUFFER_READ_RECT = 5,               ///< Event created by ::urEnqueueMemBufferReadRect
-    UR_COMMAND_MEM_BUFFER_WRITE_RECT = 6,              ///< Event created by ::urEnqueueMemBufferWriteRect
-    UR_COMMAND_MEM_BUFFER_COPY = 7,                    ///< Event created by ::urEnqueueMemBufferCopy
-    UR_COMMAND_MEM_BUFFER_COPY_RECT = 8,               ///< Event created by ::urEnqueueMemBufferCopyRect
-    UR_COMMAND_MEM_BUFFER_FILL = 9,                    ///< Event created by ::urEnqueueMemBufferFill
-    UR_COMMAND_MEM_IMAGE_READ = 10,                    ///< Event created by ::urEnqueueMemImageRead
-    UR_COMMAND_MEM_IMAGE_WRITE = 11,                   ///< Event created by ::urEnqueueMemImageWrite
-    UR_COMMAND_MEM_IMAGE_COPY = 12,                    ///< Event created by ::urEnqueueMemImageCopy
-    UR_COMMAND_MEM_BUFFER_MAP = 14,                    ///< Event created by ::urEnqueueMemBufferMap
-    UR_COMMAND_MEM_UNMAP = 16,                         ///< Event created by ::urEnqueueMemUnmap
-    UR_COMMAND_USM_FILL = 17,                          ///< Event created by ::urEnqueueUSMFill
-    UR_COMMAND_USM_MEMCPY = 18,                        ///< Event created by ::urEnqueueUSMMemcpy
-    UR_COMMAND_USM_PREFETCH = 19,                      ///< Event created by ::urEnqueueUSMPrefetch
-    UR_COMMAND_USM_ADVISE = 20,                        ///< Event created by ::urEnqueueUSMAdvise
-    UR_COMMAND_USM_FILL_2D = 21,                       ///< Event created by ::urEnqueueUSMFill2D
-    UR_COMMAND_USM_MEMCPY_2D = 22,                     ///< Event created by ::urEnqueueUSMMemcpy2D
-    UR_COMMAND_DEVICE_GLOBAL_VARIABLE_WRITE = 23,      ///< Event created by ::urEnqueueDeviceGlobalVariableWrite
-    UR_COMMAND_DEVICE_GLOBAL_VARIABLE_READ = 24,       ///< Event created by ::urEnqueueDeviceGlobalVariableRead
-    UR_COMMAND_READ_HOST_PIPE = 25,                    ///< Event created by ::urEnqueueReadHostPipe
-    UR_COMMAND_WRITE_HOST_PIPE = 26,                   ///< Event created by ::urEnqueueWriteHostPipe
-    UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP = 0x1000,    ///< Event created by ::urCommandBufferEnqueueExp
-    UR_COMMAND_EXTERNAL_SEMAPHORE_WAIT_EXP = 0x2000,   ///< Event created by ::urBindlessImagesWaitExternalSemaphoreExp
-    UR_COMMAND_EXTERNAL_SEMAPHORE_SIGNAL_EXP = 0x2001, ///< Event created by ::urBindlessImagesSignalExternalSemaphoreExp
-    UR_COMMAND_TIMESTAMP_RECORDING_EXP = 0x2002,       ///< Event created by ::urEnqueueTimestampRecordingExp
-    UR_COMMAND_ENQUEUE_NATIVE_EXP = 0x2004,            ///< Event created by ::urEnqueueNativeCommandExp
+    UR_COMMAND_KERNEL_LAUNCH = 0,                       ///< Event created by ::urEnqueueKernelLaunch
+    UR_COMMAND_EVENTS_WAIT = 1,                         ///< Event created by ::urEnqueueEventsWait
+    UR_COMMAND_EVENTS_WAIT_WITH_BARRIER = 2,            ///< Event created by ::urEnqueueEventsWaitWithBarrier
+    UR_COMMAND_MEM_BUFFER_READ = 3,                     ///< Event created by ::urEnqueueMemBufferRead
+    UR_COMMAND_MEM_BUFFER_WRITE = 4,                    ///< Event created by ::urEnqueueMemBufferWrite
+    UR_COMMAND_MEM_BUFFER_READ_RECT = 5,                ///< Event created by ::urEnqueueMemBufferReadRect
+    UR_COMMAND_MEM_BUFFER_WRITE_RECT = 6,               ///< Event created by ::urEnqueueMemBufferWriteRect
+    UR_COMMAND_MEM_BUFFER_COPY = 7,                     ///< Event created by ::urEnqueueMemBufferCopy
+    UR_COMMAND_MEM_BUFFER_COPY_RECT = 8,                ///< Event created by ::urEnqueueMemBufferCopyRect
+    UR_COMMAND_MEM_BUFFER_FILL = 9,                     ///< Event created by ::urEnqueueMemBufferFill
+    UR_COMMAND_MEM_IMAGE_READ = 10,                     ///< Event created by ::urEnqueueMemImageRead
+    UR_COMMAND_MEM_IMAGE_WRITE = 11,                    ///< Event created by ::urEnqueueMemImageWrite
+    UR_COMMAND_MEM_IMAGE_COPY = 12,                     ///< Event created by ::urEnqueueMemImageCopy
+    UR_COMMAND_MEM_BUFFER_MAP = 14,                     ///< Event created by ::urEnqueueMemBufferMap
+    UR_COMMAND_MEM_UNMAP = 16,                          ///< Event created by ::urEnqueueMemUnmap
+    UR_COMMAND_USM_FILL = 17,                           ///< Event created by ::urEnqueueUSMFill
+    UR_COMMAND_USM_MEMCPY = 18,                         ///< Event created by ::urEnqueueUSMMemcpy
+    UR_COMMAND_USM_PREFETCH = 19,                       ///< Event created by ::urEnqueueUSMPrefetch
+    UR_COMMAND_USM_ADVISE = 20,                         ///< Event created by ::urEnqueueUSMAdvise
+    UR_COMMAND_USM_FILL_2D = 21,                        ///< Event created by ::urEnqueueUSMFill2D
+    UR_COMMAND_USM_MEMCPY_2D = 22,                      ///< Event created by ::urEnqueueUSMMemcpy2D
+    UR_COMMAND_DEVICE_GLOBAL_VARIABLE_WRITE = 23,       ///< Event created by ::urEnqueueDeviceGlobalVariableWrite
+    UR_COMMAND_DEVICE_GLOBAL_VARIABLE_READ = 24,        ///< Event created by ::urEnqueueDeviceGlobalVariableRead
+    UR_COMMAND_READ_HOST_PIPE = 25,                     ///< Event created by ::urEnqueueReadHostPipe
+    UR_COMMAND_WRITE_HOST_PIPE = 26,                    ///< Event created by ::urEnqueueWriteHostPipe
+    UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP = 0x1000,     ///< Event created by ::urCommandBufferEnqueueExp
+    UR_COMMAND_EXTERNAL_SEMAPHORE_WAIT_EXP = 0x2000,    ///< Event created by ::urBindlessImagesWaitExternalSemaphoreExp
+    UR_COMMAND_EXTERNAL_SEMAPHORE_SIGNAL_EXP = 0x2001,  ///< Event created by ::urBindlessImagesSignalExternalSemaphoreExp
+    UR_COMMAND_TIMESTAMP_RECORDING_EXP = 0x2002,        ///< Event created by ::urEnqueueTimestampRecordingExp
+    UR_COMMAND_ENQUEUE_USM_DEVICE_ALLOC_EXP = 0x2005,   ///< Event created by ::urEnqueueUSMDeviceAllocExp
+    UR_COMMAND_ENQUEUE_USM_FREE_EXP = 0x2006,           ///< Event created by ::urEnqueueUSMFreeExp
+    UR_COMMAND_MEM_BUFFER_COPY_RECT_BATCH_EXP = 0x2007, ///< Event created by ::urEnqueueMemBufferCopyRectBatchExp
+    UR_COMMAND_ENQUEUE_NATIVE_EXP = 0x2004,             ///< Event created by ::urEnqueueNativeCommandExp
     /// @cond
     UR_COMMAND_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -9448,6 +9515,48 @@ urProgramLinkExp(
     ur_program_handle_t *phProgram         ///< [out] pointer to handle of program object created.
 );
 
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for placing the host memory of USM pools
+#if !defined(__GNUC__)
+#pragma region usm_host_pool_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief USM host pool flags
+typedef uint32_t ur_exp_usm_host_pool_flags_t;
+typedef enum ur_exp_usm_host_pool_flag_t {
+    UR_EXP_USM_HOST_POOL_FLAG_NUMA_LOCAL = UR_BIT(0), ///< Bind the host memory of the pool to the NUMA node closest to the devices
+                                                      ///< of the context
+    /// @cond
+    UR_EXP_USM_HOST_POOL_FLAG_FORCE_UINT32 = 0x7fffffff
+    /// @endcond
+
+} ur_exp_usm_host_pool_flag_t;
+/// @brief Bit Mask for validating ur_exp_usm_host_pool_flags_t
+#define UR_EXP_USM_HOST_POOL_FLAGS_MASK 0xfffffffe
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief USM host pool descriptor type
+///
+/// @details
+///     - Specify these properties in ::urUSMPoolCreate via ::ur_usm_pool_desc_t
+///       as part of a `pNext` chain.
+///     - The host memory of the pool is allocated from the operating system and
+///       registered with the driver instead of being allocated by the driver.
+///     - If the adapter can't provide pages of pageSize, or can't place the
+///       memory on a NUMA node, ::urUSMPoolCreate returns
+///       ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE.
+typedef struct ur_exp_usm_host_pool_desc_t {
+    ur_structure_type_t stype;          ///< [in] type of this structure, must be
+                                        ///< ::UR_STRUCTURE_TYPE_EXP_USM_HOST_POOL_DESC
+    const void *pNext;                  ///< [in][optional] pointer to extension-specific structure
+    size_t pageSize;                    ///< [in] size of the pages backing host allocations, e.g. 2MB or 1GB, 0 for
+                                        ///< the default page size
+    ur_exp_usm_host_pool_flags_t flags; ///< [in] USM host pool flags
+
+} ur_exp_usm_host_pool_desc_t;
+
 #if !defined(__GNUC__)
 #pragma endregion
 #endif
@@ -9518,16 +9627,53 @@ urUSMReleaseExp(
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Supported peer info
 typedef enum ur_exp_peer_info_t {
-    UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED = 0,  ///< [uint32_t] 1 if P2P access is supported otherwise P2P access is not
-                                                    ///< supported.
-    UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED = 1, ///< [uint32_t] 1 if atomic operations are supported over the P2P link,
-                                                    ///< otherwise such operations are not supported.
+    UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED = 0,         ///< [uint32_t] 1 if P2P access is supported otherwise P2P access is not
+                                                           ///< supported.
+    UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED = 1,        ///< [uint32_t] 1 if atomic operations are supported over the P2P link,
+                                                           ///< otherwise such operations are not supported.
+    UR_EXP_PEER_INFO_UR_PEER_LINK_TYPE = 2,                ///< [::ur_exp_peer_link_type_t] type of the P2P link between the devices.
+    UR_EXP_PEER_INFO_UR_PEER_BANDWIDTH = 3,                ///< [uint64_t] bandwidth of copies between the devices, in MB/s, or 0 if
+                                                           ///< the adapter doesn't know it.
+    UR_EXP_PEER_INFO_UR_PEER_HOP_COUNT = 4,                ///< [uint32_t] number of links between the devices, or 0 if there is no
+                                                           ///< P2P link between them.
+    UR_EXP_PEER_INFO_UR_PEER_COPY_ROUTE = 5,               ///< [::ur_exp_peer_copy_route_t] route of the best bandwidth for copies of
+                                                           ///< device memory between the devices.
+    UR_EXP_PEER_INFO_UR_PEER_COPY_INTERMEDIATE_DEVICE = 6, ///< [::ur_device_handle_t] device through which copies between the devices
+                                                           ///< are staged when the copy route is ::UR_EXP_PEER_COPY_ROUTE_DEVICE,
+                                                           ///< otherwise NULL.
     /// @cond
     UR_EXP_PEER_INFO_FORCE_UINT32 = 0x7fffffff
     /// @endcond
 
 } ur_exp_peer_info_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Type of the P2P link between two devices
+typedef enum ur_exp_peer_link_type_t {
+    UR_EXP_PEER_LINK_TYPE_NONE = 0,   ///< There is no P2P link, copies go through the host
+    UR_EXP_PEER_LINK_TYPE_PCIE = 1,   ///< The devices are linked through the PCIe hierarchy
+    UR_EXP_PEER_LINK_TYPE_FABRIC = 2, ///< The devices are linked by a device interconnect, e.g. NVLink, Xe Link
+                                      ///< or xGMI
+    UR_EXP_PEER_LINK_TYPE_OTHER = 3,  ///< The devices are linked by a link the driver doesn't report the type of
+    /// @cond
+    UR_EXP_PEER_LINK_TYPE_FORCE_UINT32 = 0x7fffffff
+    /// @endcond
+
+} ur_exp_peer_link_type_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Route of copies between two devices
+typedef enum ur_exp_peer_copy_route_t {
+    UR_EXP_PEER_COPY_ROUTE_DIRECT = 0, ///< Copies go over the P2P link between the devices
+    UR_EXP_PEER_COPY_ROUTE_DEVICE = 1, ///< Copies are staged through the memory of an intermediate device, linked
+                                       ///< to both devices
+    UR_EXP_PEER_COPY_ROUTE_HOST = 2,   ///< Copies are staged through host memory
+    /// @cond
+    UR_EXP_PEER_COPY_ROUTE_FORCE_UINT32 = 0x7fffffff
+    /// @endcond
+
+} ur_exp_peer_copy_route_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Enable access to peer device memory
 ///
@@ -9612,15 +9758,870 @@ urUsmP2PDisablePeerAccessExp(
 );
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Disable access to peer device memory
+/// @brief Disable access to peer device memory
+///
+/// @details
+///     - Queries the peer access capabilities from the command device to the
+///       peer device according to the query `propName`.
+///     - The link queries describe the topology between the devices, and the
+///       copy route queries give the path the adapter finds best for copies of
+///       device memory between them, so that callers can route their copies.
+///
+/// @remarks
+///   _Analogues_
+///     - **cuDeviceGetP2PAttribute**
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == commandDevice`
+///         + `NULL == peerDevice`
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + `::UR_EXP_PEER_INFO_UR_PEER_COPY_INTERMEDIATE_DEVICE < propName`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
+///         + If `propName` is not supported by the adapter.
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `propSize == 0 && pPropValue != NULL`
+///         + If `propSize` is less than the real number of bytes needed to return the info.
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `propSize != 0 && pPropValue == NULL`
+///         + `pPropValue == NULL && pPropSizeRet == NULL`
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+UR_APIEXPORT ur_result_t UR_APICALL
+urUsmP2PPeerAccessGetInfoExp(
+    ur_device_handle_t commandDevice, ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice,    ///< [in] handle of the peer device object
+    ur_exp_peer_info_t propName,      ///< [in] type of the info to retrieve
+    size_t propSize,                  ///< [in] the number of bytes pointed to by pPropValue.
+    void *pPropValue,                 ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                                      ///< the info.
+                                      ///< If propSize is not equal to or greater than the real number of bytes
+                                      ///< needed to return the info
+                                      ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+                                      ///< pPropValue is not used.
+    size_t *pPropSizeRet              ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for trimming USM pools
+#if !defined(__GNUC__)
+#pragma region usm_pool_trim_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Release the memory cached by USM pools back to the device
+///
+/// @details
+///     - Returns the free memory cached by hPool, or by every pool of hContext
+///       if hPool is NULL, to the driver.
+///     - Memory backing live allocations is never released.
+///     - Pools may keep up to minBytesToKeep bytes of cached memory each so
+///       that subsequent allocations don't have to go to the driver.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support trimming USM pools.
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t hPool,   ///< [in][optional] handle of the USM pool to trim, NULL trims every pool of hContext
+    size_t minBytesToKeep         ///< [in] number of cached bytes each pool may keep
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental API for enqueuing work through native APIs
+#if !defined(__GNUC__)
+#pragma region native_enqueue_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Native enqueue properties
+typedef uint32_t ur_exp_enqueue_native_command_flags_t;
+typedef enum ur_exp_enqueue_native_command_flag_t {
+    UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD = UR_BIT(0), ///< reserved for future use.
+    /// @cond
+    UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_FORCE_UINT32 = 0x7fffffff
+    /// @endcond
+
+} ur_exp_enqueue_native_command_flag_t;
+/// @brief Bit Mask for validating ur_exp_enqueue_native_command_flags_t
+#define UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAGS_MASK 0xfffffffe
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Native enqueue properties
+typedef struct ur_exp_enqueue_native_command_properties_t {
+    ur_structure_type_t stype;                   ///< [in] type of this structure, must be
+                                                 ///< ::UR_STRUCTURE_TYPE_EXP_ENQUEUE_NATIVE_COMMAND_PROPERTIES
+    void *pNext;                                 ///< [in,out][optional] pointer to extension-specific structure
+    ur_exp_enqueue_native_command_flags_t flags; ///< [in] native enqueue flags
+
+} ur_exp_enqueue_native_command_properties_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function enqueueing work through the native API to be executed
+///        immediately.
+typedef void (*ur_exp_enqueue_native_command_function_t)(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    void *pUserData           ///< [in][out] pointer to data to be passed to callback
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Immediately enqueue work through a native backend API
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pfnNativeEnqueue`
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + `NULL != pProperties && ::UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAGS_MASK & pProperties->flags`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueNativeCommandExp(
+    ur_queue_handle_t hQueue,                                      ///< [in] handle of the queue object
+    ur_exp_enqueue_native_command_function_t pfnNativeEnqueue,     ///< [in] function calling the native underlying API, to be executed
+                                                                   ///< immediately.
+    void *data,                                                    ///< [in][optional] data used by pfnNativeEnqueue
+    uint32_t numMemsInMemList,                                     ///< [in] size of the mem list
+    const ur_mem_handle_t *phMemList,                              ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
+                                                                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
+                                                                   ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
+                                                                   ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
+    const ur_exp_enqueue_native_command_properties_t *pProperties, ///< [in][optional] pointer to the native enqueue properties
+    uint32_t numEventsInWaitList,                                  ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList,                      ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                                                   ///< events that must be complete before the kernel execution.
+                                                                   ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *phEvent                                     ///< [out][optional] return an event object that identifies the work that has
+                                                                   ///< been enqueued in nativeEnqueueFunc.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for enqueuing USM allocations and frees
+#if !defined(__GNUC__)
+#pragma region enqueue_usm_alloc_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command to allocate USM device memory
+///
+/// @details
+///     - Allocates device memory for the device of hQueue, in the order of the
+///       commands of hQueue.
+///     - The memory may be used by the commands enqueued to hQueue after this
+///       one, and by commands which wait for phEvent.
+///     - The memory must be freed with ::urEnqueueUSMFreeExp.
+///     - Memory freed by earlier ::urEnqueueUSMFreeExp commands may be reused
+///       without synchronizing with the host.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == ppMem`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_USM_SIZE
+///         + `size == 0`
+///         + `size` is greater than ::UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE.
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter or the device doesn't support stream ordered allocations.
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue,                 ///< [in] handle of the queue object
+    size_t size,                              ///< [in] minimum size in bytes of the USM memory object to be allocated
+    uint32_t numEventsInWaitList,             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before the allocation.
+                                              ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+                                              ///< events.
+    void **ppMem,                             ///< [out] pointer to USM device memory object
+    ur_event_handle_t *phEvent                ///< [out][optional] return an event object that identifies this particular
+                                              ///< command instance.
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command to free USM memory allocated with
+///        ::urEnqueueUSMDeviceAllocExp
+///
+/// @details
+///     - Frees the memory once the commands enqueued to hQueue before this one,
+///       and the commands phEventWaitList refers to, are complete.
+///     - The memory may be reused by the allocations enqueued after this
+///       command without synchronizing with the host.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter or the device doesn't support stream ordered allocations.
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue,                 ///< [in] handle of the queue object
+    void *pMem,                               ///< [in] pointer to USM memory object allocated with
+                                              ///< ::urEnqueueUSMDeviceAllocExp
+    uint32_t numEventsInWaitList,             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before the free.
+                                              ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+                                              ///< events.
+    ur_event_handle_t *phEvent                ///< [out][optional] return an event object that identifies this particular
+                                              ///< command instance.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for batched rectangular buffer copies
+#if !defined(__GNUC__)
+#pragma region enqueue_buffer_copy_rect_batch_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command to copy many rectangular regions between two
+///        buffer objects
+///
+/// @details
+///     - Copies every region pRegions[i] from pSrcOrigins[i] in hBufferSrc to
+///       pDstOrigins[i] in hBufferDst, as a single command.
+///     - All the regions share the row and slice pitches of each buffer.
+///     - The regions of hBufferDst must not overlap each other, nor the
+///       regions of hBufferSrc if both are the same buffer.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hBufferSrc`
+///         + `NULL == hBufferDst`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pSrcOrigins`
+///         + `NULL == pDstOrigins`
+///         + `NULL == pRegions`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numRegions == 0`
+///         + If the width, height or depth of a region is 0.
+///         + If a pitch is smaller than a region allows, as for
+///           ::urEnqueueMemBufferCopyRect.
+///         + If a region results in an out-of-bounds access.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support batched rectangular copies.
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t hQueue,                 ///< [in] handle of the queue object
+    ur_mem_handle_t hBufferSrc,               ///< [in] handle of the source buffer object
+    ur_mem_handle_t hBufferDst,               ///< [in] handle of the dest buffer object
+    uint32_t numRegions,                      ///< [in] number of rectangular regions to copy
+    const ur_rect_offset_t *pSrcOrigins,      ///< [in][range(0, numRegions)] 3D offsets of the regions in the source
+                                              ///< buffer
+    const ur_rect_offset_t *pDstOrigins,      ///< [in][range(0, numRegions)] 3D offsets of the regions in the
+                                              ///< destination buffer
+    const ur_rect_region_t *pRegions,         ///< [in][range(0, numRegions)] 3D rectangular region descriptors: width,
+                                              ///< height, depth
+    size_t srcRowPitch,                       ///< [in] length of each row in bytes in the source buffer object
+    size_t srcSlicePitch,                     ///< [in] length of each 2D slice in bytes in the source buffer object
+    size_t dstRowPitch,                       ///< [in] length of each row in bytes in the destination buffer object
+    size_t dstSlicePitch,                     ///< [in] length of each 2D slice in bytes in the destination buffer object
+    uint32_t numEventsInWaitList,             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before this command can be executed.
+                                              ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+                                              ///< command does not wait on any event to complete.
+    ur_event_handle_t *phEvent                ///< [out][optional] return an event object that identifies this particular
+                                              ///< command instance.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for growable USM allocations
+#if !defined(__GNUC__)
+#pragma region usm_growable_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Allocate device memory which can grow without changing its address
+///
+/// @details
+///     - Reserves maxSize bytes of virtual address space in hContext, and
+///       backs the first size bytes of it with physical memory of hDevice.
+///     - The allocation is resized with ::urUSMGrowableResizeExp and freed
+///       with ::urUSMGrowableFreeExp, not with ::urUSMFree.
+///     - Implemented by the loader over the virtual memory APIs, it is
+///       supported by every adapter which supports them.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///         + `NULL == hDevice`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == ppMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_DEVICE
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `maxSize == 0`
+///         + `size > maxSize`
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support virtual memory.
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMGrowableAllocExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object the physical memory is allocated on
+    size_t maxSize,               ///< [in] size in bytes of the virtual address range to reserve, the
+                                  ///< allocation can grow up to it
+    size_t size,                  ///< [in] size in bytes of the allocation to back with physical memory
+    void **ppMem                  ///< [out] pointer to the start of the allocation
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Change the size of the memory backing a growable allocation
+///
+/// @details
+///     - Growing maps physical memory after the end of the allocation, the
+///       address and the contents of the allocation are kept.
+///     - Sizes are rounded up to the recommended granularity of the virtual
+///       memory, shrinking releases the physical memory mapped wholly past
+///       size.
+///     - The application must ensure no command accessing the resized range
+///       is in flight.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If pMem isn't a growable allocation of hContext.
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + If size is larger than the maxSize the allocation was made with.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMGrowableResizeExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem,                   ///< [in] pointer to the start of the allocation returned by
+                                  ///< ::urUSMGrowableAllocExp
+    size_t size                   ///< [in] new size in bytes of the allocation
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Free a growable allocation
+///
+/// @details
+///     - Unmaps and releases the physical memory of the allocation and frees
+///       its virtual address range.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If pMem isn't a growable allocation of hContext.
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMGrowableFreeExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem                    ///< [in] pointer to the start of the allocation returned by
+                                  ///< ::urUSMGrowableAllocExp
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for batched kernel launches
+#if !defined(__GNUC__)
+#pragma region enqueue_kernel_launch_batch_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Kernel launch descriptor for ::urEnqueueKernelLaunchBatchExp
+typedef struct ur_exp_kernel_launch_desc_t {
+    ur_kernel_handle_t hKernel;      ///< [in] handle of the kernel object
+    uint32_t workDim;                ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                                     ///< work-group work-items
+    const size_t *pGlobalWorkOffset; ///< [in][optional] pointer to an array of workDim unsigned values that
+                                     ///< specify the offset used to calculate the global ID of a work-item
+    const size_t *pGlobalWorkSize;   ///< [in] pointer to an array of workDim unsigned values that specify the
+                                     ///< number of global work-items in workDim that will execute the kernel
+                                     ///< function
+    const size_t *pLocalWorkSize;    ///< [in][optional] pointer to an array of workDim unsigned values that
+                                     ///< specify the number of local work-items forming a work-group that will
+                                     ///< execute the kernel function. If nullptr, the runtime implementation
+                                     ///< will choose the work-group size.
+
+} ur_exp_kernel_launch_desc_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue many kernel launches in a single call
+///
+/// @details
+///     - Enqueues the launch of every kernel of pLaunches, in order, as if
+///       each were enqueued with ::urEnqueueKernelLaunch.
+///     - Each launch uses the arguments set on its kernel when this function
+///       is called, a kernel may appear more than once.
+///     - Every launch waits on phEventWaitList, and phEvent completes once all
+///       the launches have.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + If the hKernel of a launch is NULL.
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pLaunches`
+///         + If the pGlobalWorkSize of a launch is NULL.
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numLaunches == 0`
+///     - ::UR_RESULT_ERROR_INVALID_WORK_DIMENSION
+///         + If the workDim of a launch is not between 1 and 3.
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGS
+///         + If a kernel has arguments which are not set.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue,                     ///< [in] handle of the queue object
+    uint32_t numLaunches,                         ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_desc_t *pLaunches, ///< [in][range(0, numLaunches)] pointer to a list of kernel launch
+                                                  ///< descriptors
+    uint32_t numEventsInWaitList,                 ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList,     ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                                  ///< events that must be complete before the kernels execute.
+                                                  ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+                                                  ///< event.
+    ur_event_handle_t *phEvent                    ///< [out][optional] return an event object that identifies the completion
+                                                  ///< of all the launches.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for setting many kernel arguments
+#if !defined(__GNUC__)
+#pragma region kernel_set_args_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief What kind of kernel argument
+typedef enum ur_exp_kernel_arg_type_t {
+    UR_EXP_KERNEL_ARG_TYPE_VALUE = 0,   ///< Argument is a value, set as with ::urKernelSetArgValue
+    UR_EXP_KERNEL_ARG_TYPE_POINTER = 1, ///< Argument is a USM pointer, set as with ::urKernelSetArgPointer
+    UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ = 2, ///< Argument is a memory object, set as with ::urKernelSetArgMemObj
+    UR_EXP_KERNEL_ARG_TYPE_LOCAL = 3,   ///< Argument is a local memory allocation, set as with
+                                        ///< ::urKernelSetArgLocal
+    UR_EXP_KERNEL_ARG_TYPE_SAMPLER = 4, ///< Argument is a sampler, set as with ::urKernelSetArgSampler
+    /// @cond
+    UR_EXP_KERNEL_ARG_TYPE_FORCE_UINT32 = 0x7fffffff
+    /// @endcond
+
+} ur_exp_kernel_arg_type_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Memory object kernel argument
+typedef struct ur_exp_kernel_arg_mem_obj_tuple_t {
+    ur_mem_handle_t hMem; ///< [in][optional] handle of the memory object, NULL sets the argument to
+                          ///< a null pointer
+    ur_mem_flags_t flags; ///< [in] memory access flag. Allowed values are: ::UR_MEM_FLAG_READ_WRITE,
+                          ///< ::UR_MEM_FLAG_WRITE_ONLY, ::UR_MEM_FLAG_READ_ONLY.
+
+} ur_exp_kernel_arg_mem_obj_tuple_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Kernel argument value
+typedef union ur_exp_kernel_arg_value_t {
+    const void *value;                             ///< [in] pointer to the argument value, of the size of the argument
+    const void *pointer;                           ///< [in] USM pointer passed as the argument
+    ur_exp_kernel_arg_mem_obj_tuple_t memObjTuple; ///< [in] memory object passed as the argument and its access flag
+    ur_sampler_handle_t sampler;                   ///< [in] handle of the sampler passed as the argument
+
+} ur_exp_kernel_arg_value_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Kernel argument for ::urKernelSetArgsExp
+typedef struct ur_exp_kernel_arg_properties_t {
+    ur_exp_kernel_arg_type_t type;   ///< [in] type of the argument
+    uint32_t index;                  ///< [in] index of the argument
+    size_t size;                     ///< [in] size in bytes of the argument value for
+                                     ///< ::UR_EXP_KERNEL_ARG_TYPE_VALUE, and of the local memory allocation for
+                                     ///< ::UR_EXP_KERNEL_ARG_TYPE_LOCAL, ignored otherwise
+    ur_exp_kernel_arg_value_t value; ///< [in][tagged_by(type)] value of the argument, unused for
+                                     ///< ::UR_EXP_KERNEL_ARG_TYPE_LOCAL
+
+} ur_exp_kernel_arg_properties_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Set many kernel arguments in a single call
+///
+/// @details
+///     - Sets every argument of pArgs, in order, as if each were set with the
+///       function for its type.
+///     - An argument which appears more than once takes the last of its
+///       values.
+///     - Stops at the first argument which cannot be set, the arguments
+///       before it are set.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hKernel`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pArgs`
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numArgs == 0`
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + If the type of an argument is not a ::ur_exp_kernel_arg_type_t.
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_SAMPLER
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel,                 ///< [in] handle of the kernel object
+    uint32_t numArgs,                           ///< [in] number of arguments
+    const ur_exp_kernel_arg_properties_t *pArgs ///< [in][range(0, numArgs)] pointer to a list of kernel arguments
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for waiting on and polling many events
+#if !defined(__GNUC__)
+#pragma region event_wait_any_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Wait for any of a list of events to finish
+///
+/// @details
+///     - Blocks until at least one of the events of phEventWaitList is
+///       complete, and returns the index of one which is.
+///     - Unlike ::urEventWait, it does not wait for the other events.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phEventWaitList`
+///         + `NULL == pEventIndex`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + `numEvents == 0`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventWaitAnyExp(
+    uint32_t numEvents,                       ///< [in] number of events in the event list
+    const ur_event_handle_t *phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+    uint32_t *pEventIndex                     ///< [out] index in phEventWaitList of an event which is complete
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Query the execution status of a list of events
+///
+/// @details
+///     - Returns for each event of phEvents the status ::urEventGetInfo
+///       returns for ::UR_EVENT_INFO_COMMAND_EXECUTION_STATUS, without
+///       blocking.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phEvents`
+///         + `NULL == pStatuses`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + `numEvents == 0`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventGetExecutionStatusExp(
+    uint32_t numEvents,                ///< [in] number of events in the event list
+    const ur_event_handle_t *phEvents, ///< [in][range(0, numEvents)] pointer to a list of events to query
+    ur_event_status_t *pStatuses       ///< [out][range(0, numEvents)] execution status of each of the events of
+                                       ///< phEvents
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for queue groups
+#if !defined(__GNUC__)
+#pragma region queue_group_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Handle of a queue group object
+typedef struct ur_exp_queue_group_handle_t_ *ur_exp_queue_group_handle_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Create a group of queues which the work of the application is
+///        balanced across
+///
+/// @details
+///     - The queues must belong to the same context, the group retains them
+///       until it is released.
+///     - Implemented by the loader over the queue APIs, it is supported by
+///       every adapter.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phQueues`
+///         + `NULL == phQueueGroup`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numQueues == 0`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + If any of the queues of phQueues is NULL.
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///         + If the queues don't all belong to the same context.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueGroupCreateExp(
+    uint32_t numQueues,                       ///< [in] number of queues of the group
+    const ur_queue_handle_t *phQueues,        ///< [in][range(0, numQueues)] pointer to the list of the queues of the
+                                              ///< group
+    ur_exp_queue_group_handle_t *phQueueGroup ///< [out] pointer to handle of queue group object created
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get a reference to a queue group object
+///
+/// @details
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueueGroup`
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueGroupRetainExp(
+    ur_exp_queue_group_handle_t hQueueGroup ///< [in][retain] handle of the queue group object to retain
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Release a queue group object
+///
+/// @details
+///     - Decrements the reference count of the group, releasing its queues
+///       and destroying it once it becomes zero.
+///     - The commands enqueued to the queues of the group are not waited for.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueueGroup`
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueGroupReleaseExp(
+    ur_exp_queue_group_handle_t hQueueGroup ///< [in][release] handle of the queue group object to release
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Select the least loaded queue of a group to enqueue the next
+///        command to
+///
+/// @details
+///     - The load of a queue is the number of commands submitted to it since
+///       it was last found empty, as counted by
+///       ::UR_QUEUE_INFO_COMMAND_COUNTS, or the number of times the group
+///       selected it if the adapter doesn't count them.
+///     - Ties are broken in round robin order, so that groups of idle queues
+///       are all used.
+///     - The queue returned is not retained, it is valid as long as the group
+///       is.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueueGroup`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phQueue`
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueGroupGetQueueExp(
+    ur_exp_queue_group_handle_t hQueueGroup, ///< [in] handle of the queue group object
+    ur_queue_handle_t *phQueue               ///< [out] pointer to the handle of the queue of the group the next command
+                                             ///< should be enqueued to
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Wait for the commands enqueued to all the queues of a group to
+///        complete
+///
+/// @details
+///     - Calls ::urQueueFinish on each queue of the group.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueueGroup`
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueGroupFinishExp(
+    ur_exp_queue_group_handle_t hQueueGroup ///< [in] handle of the queue group object
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a barrier across all the queues of a group
+///
+/// @details
+///     - The commands enqueued to any queue of the group after the barrier do
+///       not start before the commands enqueued to all of them before it, and
+///       the events of phEventWaitList, have completed.
+///     - Enqueues a barrier on each queue, then a barrier waiting for all of
+///       them on each queue, phEvent being the event of the one of the first
+///       queue.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueueGroup`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueGroupBarrierExp(
+    ur_exp_queue_group_handle_t hQueueGroup,  ///< [in] handle of the queue group object
+    uint32_t numEventsInWaitList,             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before the barrier.
+                                              ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+                                              ///< event.
+    ur_event_handle_t *phEvent                ///< [out][optional] return an event object that identifies the barrier
+                                              ///< across the queues of the group.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for timestamp markers
+#if !defined(__GNUC__)
+#pragma region timestamp_markers_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Reserve the ring of slots of the timestamp markers of a queue
 ///
 /// @details
-///     - Queries the peer access capabilities from the command device to the
-///       peer device according to the query `propName`.
-///
-/// @remarks
-///   _Analogues_
-///     - **cuDeviceGetP2PAttribute**
+///     - Allocates the device-writable ring of `capacity` slots the markers of
+///       ::urEnqueueTimestampMarkerExp write their timestamps to.
+///     - The ring is released along with the queue.
 ///
 /// @returns
 ///     - ::UR_RESULT_SUCCESS
@@ -9628,75 +10629,69 @@ urUsmP2PDisablePeerAccessExp(
 ///     - ::UR_RESULT_ERROR_DEVICE_LOST
 ///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
-///         + `NULL == commandDevice`
-///         + `NULL == peerDevice`
-///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED < propName`
-///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
-///         + If `propName` is not supported by the adapter.
+///         + `NULL == hQueue`
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
-///         + `propSize == 0 && pPropValue != NULL`
-///         + If `propSize` is less than the real number of bytes needed to return the info.
-///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///         + `propSize != 0 && pPropValue == NULL`
-///         + `pPropValue == NULL && pPropSizeRet == NULL`
-///     - ::UR_RESULT_SUCCESS
-///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///         + `capacity == 0`
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + If the ring of `hQueue` is already reserved.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter of `hQueue` does not support timestamp markers.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
 UR_APIEXPORT ur_result_t UR_APICALL
-urUsmP2PPeerAccessGetInfoExp(
-    ur_device_handle_t commandDevice, ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice,    ///< [in] handle of the peer device object
-    ur_exp_peer_info_t propName,      ///< [in] type of the info to retrieve
-    size_t propSize,                  ///< [in] the number of bytes pointed to by pPropValue.
-    void *pPropValue,                 ///< [out][optional][typename(propName, propSize)] array of bytes holding
-                                      ///< the info.
-                                      ///< If propSize is not equal to or greater than the real number of bytes
-                                      ///< needed to return the info
-                                      ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
-                                      ///< pPropValue is not used.
-    size_t *pPropSizeRet              ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+urQueueReserveTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t capacity         ///< [in] number of slots of the ring, the number of markers which can be
+                              ///< enqueued before the first one is overwritten
 );
 
-#if !defined(__GNUC__)
-#pragma endregion
-#endif
-// Intel 'oneAPI' Unified Runtime Experimental API for enqueuing work through native APIs
-#if !defined(__GNUC__)
-#pragma region native_enqueue_(experimental)
-#endif
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Native enqueue properties
-typedef uint32_t ur_exp_enqueue_native_command_flags_t;
-typedef enum ur_exp_enqueue_native_command_flag_t {
-    UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD = UR_BIT(0), ///< reserved for future use.
-    /// @cond
-    UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_FORCE_UINT32 = 0x7fffffff
-    /// @endcond
-
-} ur_exp_enqueue_native_command_flag_t;
-/// @brief Bit Mask for validating ur_exp_enqueue_native_command_flags_t
-#define UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAGS_MASK 0xfffffffe
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Native enqueue properties
-typedef struct ur_exp_enqueue_native_command_properties_t {
-    ur_structure_type_t stype;                   ///< [in] type of this structure, must be
-                                                 ///< ::UR_STRUCTURE_TYPE_EXP_ENQUEUE_NATIVE_COMMAND_PROPERTIES
-    void *pNext;                                 ///< [in,out][optional] pointer to extension-specific structure
-    ur_exp_enqueue_native_command_flags_t flags; ///< [in] native enqueue flags
-
-} ur_exp_enqueue_native_command_properties_t;
-
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Function enqueueing work through the native API to be executed
-///        immediately.
-typedef void (*ur_exp_enqueue_native_command_function_t)(
-    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
-    void *pUserData           ///< [in][out] pointer to data to be passed to callback
+/// @brief Enqueue a command writing the device timestamp to the next slot of
+///        the ring of the queue
+///
+/// @details
+///     - Unlike ::urEnqueueTimestampRecordingExp, no event is created for the
+///       marker, the timestamp being read back with
+///       ::urQueueReadTimestampMarkersExp.
+///     - Marker N of `hQueue`, numbered from 0, is written to slot N modulo
+///       the capacity of the ring.
+///     - The timestamp is in nanoseconds, in the time domain of the
+///       `UR_PROFILING_INFO_COMMAND_END` of ::urEnqueueTimestampRecordingExp.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + If the ring of `hQueue` is not reserved.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue,                 ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList,             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before the timestamp is written.
+                                              ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+                                              ///< events.
+    uint64_t *pMarker                         ///< [out][optional] number of the marker
 );
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Immediately enqueue work through a native backend API
+/// @brief Read back the timestamps of a range of markers of a queue
+///
+/// @details
+///     - Blocks until the markers [firstMarker, firstMarker + count) are
+///       written, and copies their timestamps to pTimestamps.
+///     - A marker can be read until capacity more markers are enqueued to
+///       `hQueue`.
 ///
 /// @returns
 ///     - ::UR_RESULT_SUCCESS
@@ -9706,28 +10701,22 @@ typedef void (*ur_exp_enqueue_native_command_function_t)(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hQueue`
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///         + `NULL == pfnNativeEnqueue`
-///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `NULL != pProperties && ::UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAGS_MASK & pProperties->flags`
-///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `NULL == pTimestamps`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `count == 0`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If markers of the range are not enqueued yet, or were overwritten
+///           by later markers.
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + If the ring of `hQueue` is not reserved.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
 UR_APIEXPORT ur_result_t UR_APICALL
-urEnqueueNativeCommandExp(
-    ur_queue_handle_t hQueue,                                      ///< [in] handle of the queue object
-    ur_exp_enqueue_native_command_function_t pfnNativeEnqueue,     ///< [in] function calling the native underlying API, to be executed
-                                                                   ///< immediately.
-    void *data,                                                    ///< [in][optional] data used by pfnNativeEnqueue
-    uint32_t numMemsInMemList,                                     ///< [in] size of the mem list
-    const ur_mem_handle_t *phMemList,                              ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
-                                                                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
-                                                                   ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
-                                                                   ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
-    const ur_exp_enqueue_native_command_properties_t *pProperties, ///< [in][optional] pointer to the native enqueue properties
-    uint32_t numEventsInWaitList,                                  ///< [in] size of the event wait list
-    const ur_event_handle_t *phEventWaitList,                      ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
-                                                                   ///< events that must be complete before the kernel execution.
-                                                                   ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
-    ur_event_handle_t *phEvent                                     ///< [out][optional] return an event object that identifies the work that has
-                                                                   ///< been enqueued in nativeEnqueueFunc.
+urQueueReadTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint64_t firstMarker,     ///< [in] number of the first marker to read
+    uint32_t count,           ///< [in] number of markers to read
+    uint64_t *pTimestamps     ///< [out][range(0, count)] timestamps in nanoseconds of the markers
 );
 
 #if !defined(__GNUC__)
@@ -10015,6 +11004,26 @@ typedef struct ur_event_set_callback_params_t {
     void **ppUserData;
 } ur_event_set_callback_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEventWaitAnyExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_event_wait_any_exp_params_t {
+    uint32_t *pnumEvents;
+    const ur_event_handle_t **pphEventWaitList;
+    uint32_t **ppEventIndex;
+} ur_event_wait_any_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEventGetExecutionStatusExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_event_get_execution_status_exp_params_t {
+    uint32_t *pnumEvents;
+    const ur_event_handle_t **pphEvents;
+    ur_event_status_t **ppStatuses;
+} ur_event_get_execution_status_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urProgramCreateWithIL
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -10389,6 +11398,16 @@ typedef struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t {
     uint32_t **ppGroupCountRet;
 } ur_kernel_suggest_max_cooperative_group_count_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urKernelSetArgsExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_kernel_set_args_exp_params_t {
+    ur_kernel_handle_t *phKernel;
+    uint32_t *pnumArgs;
+    const ur_exp_kernel_arg_properties_t **ppArgs;
+} ur_kernel_set_args_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urQueueGetInfo
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -10466,6 +11485,80 @@ typedef struct ur_queue_flush_params_t {
     ur_queue_handle_t *phQueue;
 } ur_queue_flush_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urQueueGroupCreateExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_queue_group_create_exp_params_t {
+    uint32_t *pnumQueues;
+    const ur_queue_handle_t **pphQueues;
+    ur_exp_queue_group_handle_t **pphQueueGroup;
+} ur_queue_group_create_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urQueueGroupRetainExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_queue_group_retain_exp_params_t {
+    ur_exp_queue_group_handle_t *phQueueGroup;
+} ur_queue_group_retain_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urQueueGroupReleaseExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_queue_group_release_exp_params_t {
+    ur_exp_queue_group_handle_t *phQueueGroup;
+} ur_queue_group_release_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urQueueGroupGetQueueExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_queue_group_get_queue_exp_params_t {
+    ur_exp_queue_group_handle_t *phQueueGroup;
+    ur_queue_handle_t **pphQueue;
+} ur_queue_group_get_queue_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urQueueGroupFinishExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_queue_group_finish_exp_params_t {
+    ur_exp_queue_group_handle_t *phQueueGroup;
+} ur_queue_group_finish_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urQueueGroupBarrierExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_queue_group_barrier_exp_params_t {
+    ur_exp_queue_group_handle_t *phQueueGroup;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    ur_event_handle_t **pphEvent;
+} ur_queue_group_barrier_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urQueueReserveTimestampMarkersExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_queue_reserve_timestamp_markers_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    uint32_t *pcapacity;
+} ur_queue_reserve_timestamp_markers_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urQueueReadTimestampMarkersExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_queue_read_timestamp_markers_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    uint64_t *pfirstMarker;
+    uint32_t *pcount;
+    uint64_t **ppTimestamps;
+} ur_queue_read_timestamp_markers_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urSamplerCreate
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -11175,6 +12268,76 @@ typedef struct ur_enqueue_native_command_exp_params_t {
     ur_event_handle_t **pphEvent;
 } ur_enqueue_native_command_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueUSMDeviceAllocExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_usm_device_alloc_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    size_t *psize;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    void ***pppMem;
+    ur_event_handle_t **pphEvent;
+} ur_enqueue_usm_device_alloc_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueUSMFreeExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_usm_free_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    void **ppMem;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    ur_event_handle_t **pphEvent;
+} ur_enqueue_usm_free_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueMemBufferCopyRectBatchExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_mem_buffer_copy_rect_batch_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    ur_mem_handle_t *phBufferSrc;
+    ur_mem_handle_t *phBufferDst;
+    uint32_t *pnumRegions;
+    const ur_rect_offset_t **ppSrcOrigins;
+    const ur_rect_offset_t **ppDstOrigins;
+    const ur_rect_region_t **ppRegions;
+    size_t *psrcRowPitch;
+    size_t *psrcSlicePitch;
+    size_t *pdstRowPitch;
+    size_t *pdstSlicePitch;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    ur_event_handle_t **pphEvent;
+} ur_enqueue_mem_buffer_copy_rect_batch_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueKernelLaunchBatchExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_kernel_launch_batch_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    uint32_t *pnumLaunches;
+    const ur_exp_kernel_launch_desc_t **ppLaunches;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    ur_event_handle_t **pphEvent;
+} ur_enqueue_kernel_launch_batch_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueTimestampMarkerExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_timestamp_marker_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    uint64_t **ppMarker;
+} ur_enqueue_timestamp_marker_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urBindlessImagesUnsampledImageHandleDestroyExp
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -11529,6 +12692,47 @@ typedef struct ur_usm_release_exp_params_t {
     void **ppMem;
 } ur_usm_release_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urUSMPoolTrimExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_usm_pool_trim_exp_params_t {
+    ur_context_handle_t *phContext;
+    ur_usm_pool_handle_t *phPool;
+    size_t *pminBytesToKeep;
+} ur_usm_pool_trim_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urUSMGrowableAllocExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_usm_growable_alloc_exp_params_t {
+    ur_context_handle_t *phContext;
+    ur_device_handle_t *phDevice;
+    size_t *pmaxSize;
+    size_t *psize;
+    void ***pppMem;
+} ur_usm_growable_alloc_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urUSMGrowableResizeExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_usm_growable_resize_exp_params_t {
+    ur_context_handle_t *phContext;
+    void **ppMem;
+    size_t *psize;
+} ur_usm_growable_resize_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urUSMGrowableFreeExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_usm_growable_free_exp_params_t {
+    ur_context_handle_t *phContext;
+    void **ppMem;
+} ur_usm_growable_free_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urCommandBufferCreateExp
 /// @details Each entry is a pointer to the parameter passed to the function;
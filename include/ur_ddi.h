@@ -271,6 +271,48 @@ typedef ur_result_t(UR_APICALL *ur_pfnGetEventProcAddrTable_t)(
     ur_api_version_t,
     ur_event_dditable_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEventWaitAnyExp
+typedef ur_result_t(UR_APICALL *ur_pfnEventWaitAnyExp_t)(
+    uint32_t,
+    const ur_event_handle_t *,
+    uint32_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEventGetExecutionStatusExp
+typedef ur_result_t(UR_APICALL *ur_pfnEventGetExecutionStatusExp_t)(
+    uint32_t,
+    const ur_event_handle_t *,
+    ur_event_status_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of EventExp functions pointers
+typedef struct ur_event_exp_dditable_t {
+    ur_pfnEventWaitAnyExp_t pfnWaitAnyExp;
+    ur_pfnEventGetExecutionStatusExp_t pfnGetExecutionStatusExp;
+} ur_event_exp_dditable_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EventExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetEventExpProcAddrTable(
+    ur_api_version_t version,          ///< [in] API version requested
+    ur_event_exp_dditable_t *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urGetEventExpProcAddrTable
+typedef ur_result_t(UR_APICALL *ur_pfnGetEventExpProcAddrTable_t)(
+    ur_api_version_t,
+    ur_event_exp_dditable_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function-pointer for urProgramCreateWithIL
 typedef ur_result_t(UR_APICALL *ur_pfnProgramCreateWithIL_t)(
@@ -654,10 +696,18 @@ typedef ur_result_t(UR_APICALL *ur_pfnKernelSuggestMaxCooperativeGroupCountExp_t
     size_t,
     uint32_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urKernelSetArgsExp
+typedef ur_result_t(UR_APICALL *ur_pfnKernelSetArgsExp_t)(
+    ur_kernel_handle_t,
+    uint32_t,
+    const ur_exp_kernel_arg_properties_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Table of KernelExp functions pointers
 typedef struct ur_kernel_exp_dditable_t {
     ur_pfnKernelSuggestMaxCooperativeGroupCountExp_t pfnSuggestMaxCooperativeGroupCountExp;
+    ur_pfnKernelSetArgsExp_t pfnSetArgsExp;
 } ur_kernel_exp_dditable_t;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -768,6 +818,48 @@ typedef ur_result_t(UR_APICALL *ur_pfnGetQueueProcAddrTable_t)(
     ur_api_version_t,
     ur_queue_dditable_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urQueueReserveTimestampMarkersExp
+typedef ur_result_t(UR_APICALL *ur_pfnQueueReserveTimestampMarkersExp_t)(
+    ur_queue_handle_t,
+    uint32_t);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urQueueReadTimestampMarkersExp
+typedef ur_result_t(UR_APICALL *ur_pfnQueueReadTimestampMarkersExp_t)(
+    ur_queue_handle_t,
+    uint64_t,
+    uint32_t,
+    uint64_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of QueueExp functions pointers
+typedef struct ur_queue_exp_dditable_t {
+    ur_pfnQueueReserveTimestampMarkersExp_t pfnReserveTimestampMarkersExp;
+    ur_pfnQueueReadTimestampMarkersExp_t pfnReadTimestampMarkersExp;
+} ur_queue_exp_dditable_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's QueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetQueueExpProcAddrTable(
+    ur_api_version_t version,          ///< [in] API version requested
+    ur_queue_exp_dditable_t *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urGetQueueExpProcAddrTable
+typedef ur_result_t(UR_APICALL *ur_pfnGetQueueExpProcAddrTable_t)(
+    ur_api_version_t,
+    ur_queue_exp_dditable_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function-pointer for urSamplerCreate
 typedef ur_result_t(UR_APICALL *ur_pfnSamplerCreate_t)(
@@ -1497,6 +1589,61 @@ typedef ur_result_t(UR_APICALL *ur_pfnEnqueueNativeCommandExp_t)(
     const ur_event_handle_t *,
     ur_event_handle_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueUSMDeviceAllocExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueUSMDeviceAllocExp_t)(
+    ur_queue_handle_t,
+    size_t,
+    uint32_t,
+    const ur_event_handle_t *,
+    void **,
+    ur_event_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueUSMFreeExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueUSMFreeExp_t)(
+    ur_queue_handle_t,
+    void *,
+    uint32_t,
+    const ur_event_handle_t *,
+    ur_event_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueMemBufferCopyRectBatchExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueMemBufferCopyRectBatchExp_t)(
+    ur_queue_handle_t,
+    ur_mem_handle_t,
+    ur_mem_handle_t,
+    uint32_t,
+    const ur_rect_offset_t *,
+    const ur_rect_offset_t *,
+    const ur_rect_region_t *,
+    size_t,
+    size_t,
+    size_t,
+    size_t,
+    uint32_t,
+    const ur_event_handle_t *,
+    ur_event_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueKernelLaunchBatchExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueKernelLaunchBatchExp_t)(
+    ur_queue_handle_t,
+    uint32_t,
+    const ur_exp_kernel_launch_desc_t *,
+    uint32_t,
+    const ur_event_handle_t *,
+    ur_event_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueTimestampMarkerExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueTimestampMarkerExp_t)(
+    ur_queue_handle_t,
+    uint32_t,
+    const ur_event_handle_t *,
+    uint64_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Table of EnqueueExp functions pointers
 typedef struct ur_enqueue_exp_dditable_t {
@@ -1504,6 +1651,11 @@ typedef struct ur_enqueue_exp_dditable_t {
     ur_pfnEnqueueCooperativeKernelLaunchExp_t pfnCooperativeKernelLaunchExp;
     ur_pfnEnqueueTimestampRecordingExp_t pfnTimestampRecordingExp;
     ur_pfnEnqueueNativeCommandExp_t pfnNativeCommandExp;
+    ur_pfnEnqueueUSMDeviceAllocExp_t pfnUSMDeviceAllocExp;
+    ur_pfnEnqueueUSMFreeExp_t pfnUSMFreeExp;
+    ur_pfnEnqueueMemBufferCopyRectBatchExp_t pfnMemBufferCopyRectBatchExp;
+    ur_pfnEnqueueKernelLaunchBatchExp_t pfnKernelLaunchBatchExp;
+    ur_pfnEnqueueTimestampMarkerExp_t pfnTimestampMarkerExp;
 } ur_enqueue_exp_dditable_t;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1870,12 +2022,20 @@ typedef ur_result_t(UR_APICALL *ur_pfnUSMReleaseExp_t)(
     ur_context_handle_t,
     void *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urUSMPoolTrimExp
+typedef ur_result_t(UR_APICALL *ur_pfnUSMPoolTrimExp_t)(
+    ur_context_handle_t,
+    ur_usm_pool_handle_t,
+    size_t);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Table of USMExp functions pointers
 typedef struct ur_usm_exp_dditable_t {
     ur_pfnUSMPitchedAllocExp_t pfnPitchedAllocExp;
     ur_pfnUSMImportExp_t pfnImportExp;
     ur_pfnUSMReleaseExp_t pfnReleaseExp;
+    ur_pfnUSMPoolTrimExp_t pfnPoolTrimExp;
 } ur_usm_exp_dditable_t;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2427,11 +2587,13 @@ typedef struct ur_dditable_t {
     ur_platform_dditable_t Platform;
     ur_context_dditable_t Context;
     ur_event_dditable_t Event;
+    ur_event_exp_dditable_t EventExp;
     ur_program_dditable_t Program;
     ur_program_exp_dditable_t ProgramExp;
     ur_kernel_dditable_t Kernel;
     ur_kernel_exp_dditable_t KernelExp;
     ur_queue_dditable_t Queue;
+    ur_queue_exp_dditable_t QueueExp;
     ur_sampler_dditable_t Sampler;
     ur_mem_dditable_t Mem;
     ur_physical_mem_dditable_t PhysicalMem;
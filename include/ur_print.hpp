@@ -56,6 +56,8 @@ template <>
 struct is_handle<ur_exp_command_buffer_handle_t> : std::true_type {};
 template <>
 struct is_handle<ur_exp_command_buffer_command_handle_t> : std::true_type {};
+template <>
+struct is_handle<ur_exp_queue_group_handle_t> : std::true_type {};
 template <typename T>
 inline constexpr bool is_handle_v = is_handle<T>::value;
 template <typename T>
@@ -210,12 +212,20 @@ inline ur_result_t printUnion(
     const union ur_exp_launch_property_value_t params,
     const enum ur_exp_launch_property_id_t tag);
 
+template <>
+inline ur_result_t printFlag<ur_exp_usm_host_pool_flag_t>(std::ostream &os, uint32_t flag);
+
 template <>
 inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_exp_peer_info_t value, size_t size);
 
 template <>
 inline ur_result_t printFlag<ur_exp_enqueue_native_command_flag_t>(std::ostream &os, uint32_t flag);
 
+inline ur_result_t printUnion(
+    std::ostream &os,
+    const union ur_exp_kernel_arg_value_t params,
+    const enum ur_exp_kernel_arg_type_t tag);
+
 } // namespace ur::details
 
 inline std::ostream &operator<<(std::ostream &os, enum ur_function_t value);
@@ -347,9 +357,17 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_command_buffer_update_kernel_launch_desc_t params);
 inline std::ostream &operator<<(std::ostream &os, enum ur_exp_launch_property_id_t value);
 inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_launch_property_t params);
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_usm_host_pool_flag_t value);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_usm_host_pool_desc_t params);
 inline std::ostream &operator<<(std::ostream &os, enum ur_exp_peer_info_t value);
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_peer_link_type_t value);
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_peer_copy_route_t value);
 inline std::ostream &operator<<(std::ostream &os, enum ur_exp_enqueue_native_command_flag_t value);
 inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_enqueue_native_command_properties_t params);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_kernel_launch_desc_t params);
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_kernel_arg_type_t value);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_kernel_arg_mem_obj_tuple_t params);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_kernel_arg_properties_t params);
 
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_function_t type
@@ -948,6 +966,66 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_function_t value) {
     case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP:
         os << "UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP";
         break;
+    case UR_FUNCTION_USM_POOL_TRIM_EXP:
+        os << "UR_FUNCTION_USM_POOL_TRIM_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP:
+        os << "UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_USM_FREE_EXP:
+        os << "UR_FUNCTION_ENQUEUE_USM_FREE_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP:
+        os << "UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP";
+        break;
+    case UR_FUNCTION_USM_GROWABLE_ALLOC_EXP:
+        os << "UR_FUNCTION_USM_GROWABLE_ALLOC_EXP";
+        break;
+    case UR_FUNCTION_USM_GROWABLE_RESIZE_EXP:
+        os << "UR_FUNCTION_USM_GROWABLE_RESIZE_EXP";
+        break;
+    case UR_FUNCTION_USM_GROWABLE_FREE_EXP:
+        os << "UR_FUNCTION_USM_GROWABLE_FREE_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP:
+        os << "UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP";
+        break;
+    case UR_FUNCTION_KERNEL_SET_ARGS_EXP:
+        os << "UR_FUNCTION_KERNEL_SET_ARGS_EXP";
+        break;
+    case UR_FUNCTION_EVENT_WAIT_ANY_EXP:
+        os << "UR_FUNCTION_EVENT_WAIT_ANY_EXP";
+        break;
+    case UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP:
+        os << "UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP";
+        break;
+    case UR_FUNCTION_QUEUE_GROUP_CREATE_EXP:
+        os << "UR_FUNCTION_QUEUE_GROUP_CREATE_EXP";
+        break;
+    case UR_FUNCTION_QUEUE_GROUP_RETAIN_EXP:
+        os << "UR_FUNCTION_QUEUE_GROUP_RETAIN_EXP";
+        break;
+    case UR_FUNCTION_QUEUE_GROUP_RELEASE_EXP:
+        os << "UR_FUNCTION_QUEUE_GROUP_RELEASE_EXP";
+        break;
+    case UR_FUNCTION_QUEUE_GROUP_GET_QUEUE_EXP:
+        os << "UR_FUNCTION_QUEUE_GROUP_GET_QUEUE_EXP";
+        break;
+    case UR_FUNCTION_QUEUE_GROUP_FINISH_EXP:
+        os << "UR_FUNCTION_QUEUE_GROUP_FINISH_EXP";
+        break;
+    case UR_FUNCTION_QUEUE_GROUP_BARRIER_EXP:
+        os << "UR_FUNCTION_QUEUE_GROUP_BARRIER_EXP";
+        break;
+    case UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP:
+        os << "UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP:
+        os << "UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP";
+        break;
+    case UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP:
+        os << "UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -1104,6 +1182,9 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_structure_type_t value
     case UR_STRUCTURE_TYPE_EXP_IMAGE_COPY_REGION:
         os << "UR_STRUCTURE_TYPE_EXP_IMAGE_COPY_REGION";
         break;
+    case UR_STRUCTURE_TYPE_EXP_USM_HOST_POOL_DESC:
+        os << "UR_STRUCTURE_TYPE_EXP_USM_HOST_POOL_DESC";
+        break;
     case UR_STRUCTURE_TYPE_EXP_ENQUEUE_NATIVE_COMMAND_PROPERTIES:
         os << "UR_STRUCTURE_TYPE_EXP_ENQUEUE_NATIVE_COMMAND_PROPERTIES";
         break;
@@ -1364,6 +1445,11 @@ inline ur_result_t printStruct(std::ostream &os, const void *ptr) {
         printPtr(os, pstruct);
     } break;
 
+    case UR_STRUCTURE_TYPE_EXP_USM_HOST_POOL_DESC: {
+        const ur_exp_usm_host_pool_desc_t *pstruct = (const ur_exp_usm_host_pool_desc_t *)ptr;
+        printPtr(os, pstruct);
+    } break;
+
     case UR_STRUCTURE_TYPE_EXP_ENQUEUE_NATIVE_COMMAND_PROPERTIES: {
         const ur_exp_enqueue_native_command_properties_t *pstruct = (const ur_exp_enqueue_native_command_properties_t *)ptr;
         printPtr(os, pstruct);
@@ -7052,6 +7138,24 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_usm_pool_info_t value)
     case UR_USM_POOL_INFO_CONTEXT:
         os << "UR_USM_POOL_INFO_CONTEXT";
         break;
+    case UR_USM_POOL_INFO_USED_SIZE:
+        os << "UR_USM_POOL_INFO_USED_SIZE";
+        break;
+    case UR_USM_POOL_INFO_CACHED_SIZE:
+        os << "UR_USM_POOL_INFO_CACHED_SIZE";
+        break;
+    case UR_USM_POOL_INFO_PEAK_USED_SIZE:
+        os << "UR_USM_POOL_INFO_PEAK_USED_SIZE";
+        break;
+    case UR_USM_POOL_INFO_BUCKET_HITS:
+        os << "UR_USM_POOL_INFO_BUCKET_HITS";
+        break;
+    case UR_USM_POOL_INFO_BUCKET_MISSES:
+        os << "UR_USM_POOL_INFO_BUCKET_MISSES";
+        break;
+    case UR_USM_POOL_INFO_FRAGMENTATION:
+        os << "UR_USM_POOL_INFO_FRAGMENTATION";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -7093,6 +7197,82 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_usm_pool_in
 
         os << ")";
     } break;
+    case UR_USM_POOL_INFO_USED_SIZE: {
+        const size_t *tptr = (const size_t *)ptr;
+        if (sizeof(size_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_USM_POOL_INFO_CACHED_SIZE: {
+        const size_t *tptr = (const size_t *)ptr;
+        if (sizeof(size_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_USM_POOL_INFO_PEAK_USED_SIZE: {
+        const size_t *tptr = (const size_t *)ptr;
+        if (sizeof(size_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_USM_POOL_INFO_BUCKET_HITS: {
+
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        os << "{";
+        size_t nelems = size / sizeof(uint64_t);
+        for (size_t i = 0; i < nelems; ++i) {
+            if (i != 0) {
+                os << ", ";
+            }
+
+            os << tptr[i];
+        }
+        os << "}";
+    } break;
+    case UR_USM_POOL_INFO_BUCKET_MISSES: {
+
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        os << "{";
+        size_t nelems = size / sizeof(uint64_t);
+        for (size_t i = 0; i < nelems; ++i) {
+            if (i != 0) {
+                os << ", ";
+            }
+
+            os << tptr[i];
+        }
+        os << "}";
+    } break;
+    case UR_USM_POOL_INFO_FRAGMENTATION: {
+        const double *tptr = (const double *)ptr;
+        if (sizeof(double) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(double) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
     default:
         os << "unknown enumerator";
         return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -8456,6 +8636,24 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_queue_info_t value) {
     case UR_QUEUE_INFO_EMPTY:
         os << "UR_QUEUE_INFO_EMPTY";
         break;
+    case UR_QUEUE_INFO_COMMAND_COUNTS:
+        os << "UR_QUEUE_INFO_COMMAND_COUNTS";
+        break;
+    case UR_QUEUE_INFO_BYTES_COPIED:
+        os << "UR_QUEUE_INFO_BYTES_COPIED";
+        break;
+    case UR_QUEUE_INFO_BATCH_COUNT:
+        os << "UR_QUEUE_INFO_BATCH_COUNT";
+        break;
+    case UR_QUEUE_INFO_AVERAGE_BATCH_SIZE:
+        os << "UR_QUEUE_INFO_AVERAGE_BATCH_SIZE";
+        break;
+    case UR_QUEUE_INFO_HOST_WAIT_TIME:
+        os << "UR_QUEUE_INFO_HOST_WAIT_TIME";
+        break;
+    case UR_QUEUE_INFO_CREATED_EVENT_COUNT:
+        os << "UR_QUEUE_INFO_CREATED_EVENT_COUNT";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -8560,6 +8758,82 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_queue_info_
 
         os << ")";
     } break;
+    case UR_QUEUE_INFO_COMMAND_COUNTS: {
+
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        os << "{";
+        size_t nelems = size / sizeof(uint64_t);
+        for (size_t i = 0; i < nelems; ++i) {
+            if (i != 0) {
+                os << ", ";
+            }
+
+            os << tptr[i];
+        }
+        os << "}";
+    } break;
+    case UR_QUEUE_INFO_BYTES_COPIED: {
+
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        os << "{";
+        size_t nelems = size / sizeof(uint64_t);
+        for (size_t i = 0; i < nelems; ++i) {
+            if (i != 0) {
+                os << ", ";
+            }
+
+            os << tptr[i];
+        }
+        os << "}";
+    } break;
+    case UR_QUEUE_INFO_BATCH_COUNT: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_QUEUE_INFO_AVERAGE_BATCH_SIZE: {
+        const double *tptr = (const double *)ptr;
+        if (sizeof(double) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(double) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_QUEUE_INFO_HOST_WAIT_TIME: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_QUEUE_INFO_CREATED_EVENT_COUNT: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
     default:
         os << "unknown enumerator";
         return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -8607,6 +8881,9 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_queue_flag_t value) {
     case UR_QUEUE_FLAG_SYNC_WITH_DEFAULT_STREAM:
         os << "UR_QUEUE_FLAG_SYNC_WITH_DEFAULT_STREAM";
         break;
+    case UR_QUEUE_FLAG_LOAD_BALANCED:
+        os << "UR_QUEUE_FLAG_LOAD_BALANCED";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -8731,6 +9008,16 @@ inline ur_result_t printFlag<ur_queue_flag_t>(std::ostream &os, uint32_t flag) {
         }
         os << UR_QUEUE_FLAG_SYNC_WITH_DEFAULT_STREAM;
     }
+
+    if ((val & UR_QUEUE_FLAG_LOAD_BALANCED) == (uint32_t)UR_QUEUE_FLAG_LOAD_BALANCED) {
+        val ^= (uint32_t)UR_QUEUE_FLAG_LOAD_BALANCED;
+        if (!first) {
+            os << " | ";
+        } else {
+            first = false;
+        }
+        os << UR_QUEUE_FLAG_LOAD_BALANCED;
+    }
     if (val != 0) {
         std::bitset<32> bits(val);
         if (!first) {
@@ -8938,6 +9225,15 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_command_t value) {
     case UR_COMMAND_TIMESTAMP_RECORDING_EXP:
         os << "UR_COMMAND_TIMESTAMP_RECORDING_EXP";
         break;
+    case UR_COMMAND_ENQUEUE_USM_DEVICE_ALLOC_EXP:
+        os << "UR_COMMAND_ENQUEUE_USM_DEVICE_ALLOC_EXP";
+        break;
+    case UR_COMMAND_ENQUEUE_USM_FREE_EXP:
+        os << "UR_COMMAND_ENQUEUE_USM_FREE_EXP";
+        break;
+    case UR_COMMAND_MEM_BUFFER_COPY_RECT_BATCH_EXP:
+        os << "UR_COMMAND_MEM_BUFFER_COPY_RECT_BATCH_EXP";
+        break;
     case UR_COMMAND_ENQUEUE_NATIVE_EXP:
         os << "UR_COMMAND_ENQUEUE_NATIVE_EXP";
         break;
@@ -10228,73 +10524,13 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_launch_pro
     return os;
 }
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_exp_peer_info_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, enum ur_exp_peer_info_t value) {
-    switch (value) {
-    case UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED:
-        os << "UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED";
-        break;
-    case UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED:
-        os << "UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED";
-        break;
-    default:
-        os << "unknown enumerator";
-        break;
-    }
-    return os;
-}
-namespace ur::details {
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print ur_exp_peer_info_t enum value
-template <>
-inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_exp_peer_info_t value, size_t size) {
-    if (ptr == NULL) {
-        return printPtr(os, ptr);
-    }
-
-    switch (value) {
-    case UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED: {
-        const uint32_t *tptr = (const uint32_t *)ptr;
-        if (sizeof(uint32_t) > size) {
-            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
-            return UR_RESULT_ERROR_INVALID_SIZE;
-        }
-        os << (const void *)(tptr) << " (";
-
-        os << *tptr;
-
-        os << ")";
-    } break;
-    case UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED: {
-        const uint32_t *tptr = (const uint32_t *)ptr;
-        if (sizeof(uint32_t) > size) {
-            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
-            return UR_RESULT_ERROR_INVALID_SIZE;
-        }
-        os << (const void *)(tptr) << " (";
-
-        os << *tptr;
-
-        os << ")";
-    } break;
-    default:
-        os << "unknown enumerator";
-        return UR_RESULT_ERROR_INVALID_ENUMERATION;
-    }
-    return UR_RESULT_SUCCESS;
-}
-} // namespace ur::details
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_exp_enqueue_native_command_flag_t type
+/// @brief Print operator for the ur_exp_usm_host_pool_flag_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, enum ur_exp_enqueue_native_command_flag_t value) {
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_usm_host_pool_flag_t value) {
     switch (value) {
-    case UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD:
-        os << "UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD";
+    case UR_EXP_USM_HOST_POOL_FLAG_NUMA_LOCAL:
+        os << "UR_EXP_USM_HOST_POOL_FLAG_NUMA_LOCAL";
         break;
     default:
         os << "unknown enumerator";
@@ -10305,20 +10541,20 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_exp_enqueue_native_com
 
 namespace ur::details {
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print ur_exp_enqueue_native_command_flag_t flag
+/// @brief Print ur_exp_usm_host_pool_flag_t flag
 template <>
-inline ur_result_t printFlag<ur_exp_enqueue_native_command_flag_t>(std::ostream &os, uint32_t flag) {
+inline ur_result_t printFlag<ur_exp_usm_host_pool_flag_t>(std::ostream &os, uint32_t flag) {
     uint32_t val = flag;
     bool first = true;
 
-    if ((val & UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD) == (uint32_t)UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD) {
-        val ^= (uint32_t)UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD;
+    if ((val & UR_EXP_USM_HOST_POOL_FLAG_NUMA_LOCAL) == (uint32_t)UR_EXP_USM_HOST_POOL_FLAG_NUMA_LOCAL) {
+        val ^= (uint32_t)UR_EXP_USM_HOST_POOL_FLAG_NUMA_LOCAL;
         if (!first) {
             os << " | ";
         } else {
             first = false;
         }
-        os << UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD;
+        os << UR_EXP_USM_HOST_POOL_FLAG_NUMA_LOCAL;
     }
     if (val != 0) {
         std::bitset<32> bits(val);
@@ -10333,11 +10569,11 @@ inline ur_result_t printFlag<ur_exp_enqueue_native_command_flag_t>(std::ostream
 }
 } // namespace ur::details
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_exp_enqueue_native_command_properties_t type
+/// @brief Print operator for the ur_exp_usm_host_pool_desc_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_enqueue_native_command_properties_t params) {
-    os << "(struct ur_exp_enqueue_native_command_properties_t){";
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_usm_host_pool_desc_t params) {
+    os << "(struct ur_exp_usm_host_pool_desc_t){";
 
     os << ".stype = ";
 
@@ -10350,7 +10586,264 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_enqueue_na
                              (params.pNext));
 
     os << ", ";
-    os << ".flags = ";
+    os << ".pageSize = ";
+
+    os << (params.pageSize);
+
+    os << ", ";
+    os << ".flags = ";
+
+    ur::details::printFlag<ur_exp_usm_host_pool_flag_t>(os,
+                                                        (params.flags));
+
+    os << "}";
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_peer_info_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_peer_info_t value) {
+    switch (value) {
+    case UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED:
+        os << "UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED";
+        break;
+    case UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED:
+        os << "UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED";
+        break;
+    case UR_EXP_PEER_INFO_UR_PEER_LINK_TYPE:
+        os << "UR_EXP_PEER_INFO_UR_PEER_LINK_TYPE";
+        break;
+    case UR_EXP_PEER_INFO_UR_PEER_BANDWIDTH:
+        os << "UR_EXP_PEER_INFO_UR_PEER_BANDWIDTH";
+        break;
+    case UR_EXP_PEER_INFO_UR_PEER_HOP_COUNT:
+        os << "UR_EXP_PEER_INFO_UR_PEER_HOP_COUNT";
+        break;
+    case UR_EXP_PEER_INFO_UR_PEER_COPY_ROUTE:
+        os << "UR_EXP_PEER_INFO_UR_PEER_COPY_ROUTE";
+        break;
+    case UR_EXP_PEER_INFO_UR_PEER_COPY_INTERMEDIATE_DEVICE:
+        os << "UR_EXP_PEER_INFO_UR_PEER_COPY_INTERMEDIATE_DEVICE";
+        break;
+    default:
+        os << "unknown enumerator";
+        break;
+    }
+    return os;
+}
+namespace ur::details {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print ur_exp_peer_info_t enum value
+template <>
+inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_exp_peer_info_t value, size_t size) {
+    if (ptr == NULL) {
+        return printPtr(os, ptr);
+    }
+
+    switch (value) {
+    case UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED: {
+        const uint32_t *tptr = (const uint32_t *)ptr;
+        if (sizeof(uint32_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED: {
+        const uint32_t *tptr = (const uint32_t *)ptr;
+        if (sizeof(uint32_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_EXP_PEER_INFO_UR_PEER_LINK_TYPE: {
+        const ur_exp_peer_link_type_t *tptr = (const ur_exp_peer_link_type_t *)ptr;
+        if (sizeof(ur_exp_peer_link_type_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_exp_peer_link_type_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_EXP_PEER_INFO_UR_PEER_BANDWIDTH: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_EXP_PEER_INFO_UR_PEER_HOP_COUNT: {
+        const uint32_t *tptr = (const uint32_t *)ptr;
+        if (sizeof(uint32_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_EXP_PEER_INFO_UR_PEER_COPY_ROUTE: {
+        const ur_exp_peer_copy_route_t *tptr = (const ur_exp_peer_copy_route_t *)ptr;
+        if (sizeof(ur_exp_peer_copy_route_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_exp_peer_copy_route_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        os << *tptr;
+
+        os << ")";
+    } break;
+    case UR_EXP_PEER_INFO_UR_PEER_COPY_INTERMEDIATE_DEVICE: {
+        const ur_device_handle_t *tptr = (const ur_device_handle_t *)ptr;
+        if (sizeof(ur_device_handle_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_handle_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        os << (const void *)(tptr) << " (";
+
+        ur::details::printPtr(os,
+                              *tptr);
+
+        os << ")";
+    } break;
+    default:
+        os << "unknown enumerator";
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    return UR_RESULT_SUCCESS;
+}
+} // namespace ur::details
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_peer_link_type_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_peer_link_type_t value) {
+    switch (value) {
+    case UR_EXP_PEER_LINK_TYPE_NONE:
+        os << "UR_EXP_PEER_LINK_TYPE_NONE";
+        break;
+    case UR_EXP_PEER_LINK_TYPE_PCIE:
+        os << "UR_EXP_PEER_LINK_TYPE_PCIE";
+        break;
+    case UR_EXP_PEER_LINK_TYPE_FABRIC:
+        os << "UR_EXP_PEER_LINK_TYPE_FABRIC";
+        break;
+    case UR_EXP_PEER_LINK_TYPE_OTHER:
+        os << "UR_EXP_PEER_LINK_TYPE_OTHER";
+        break;
+    default:
+        os << "unknown enumerator";
+        break;
+    }
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_peer_copy_route_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_peer_copy_route_t value) {
+    switch (value) {
+    case UR_EXP_PEER_COPY_ROUTE_DIRECT:
+        os << "UR_EXP_PEER_COPY_ROUTE_DIRECT";
+        break;
+    case UR_EXP_PEER_COPY_ROUTE_DEVICE:
+        os << "UR_EXP_PEER_COPY_ROUTE_DEVICE";
+        break;
+    case UR_EXP_PEER_COPY_ROUTE_HOST:
+        os << "UR_EXP_PEER_COPY_ROUTE_HOST";
+        break;
+    default:
+        os << "unknown enumerator";
+        break;
+    }
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_enqueue_native_command_flag_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_enqueue_native_command_flag_t value) {
+    switch (value) {
+    case UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD:
+        os << "UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD";
+        break;
+    default:
+        os << "unknown enumerator";
+        break;
+    }
+    return os;
+}
+
+namespace ur::details {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print ur_exp_enqueue_native_command_flag_t flag
+template <>
+inline ur_result_t printFlag<ur_exp_enqueue_native_command_flag_t>(std::ostream &os, uint32_t flag) {
+    uint32_t val = flag;
+    bool first = true;
+
+    if ((val & UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD) == (uint32_t)UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD) {
+        val ^= (uint32_t)UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD;
+        if (!first) {
+            os << " | ";
+        } else {
+            first = false;
+        }
+        os << UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAG_TBD;
+    }
+    if (val != 0) {
+        std::bitset<32> bits(val);
+        if (!first) {
+            os << " | ";
+        }
+        os << "unknown bit flags " << bits;
+    } else if (first) {
+        os << "0";
+    }
+    return UR_RESULT_SUCCESS;
+}
+} // namespace ur::details
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_enqueue_native_command_properties_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_enqueue_native_command_properties_t params) {
+    os << "(struct ur_exp_enqueue_native_command_properties_t){";
+
+    os << ".stype = ";
+
+    os << (params.stype);
+
+    os << ", ";
+    os << ".pNext = ";
+
+    ur::details::printStruct(os,
+                             (params.pNext));
+
+    os << ", ";
+    os << ".flags = ";
 
     ur::details::printFlag<ur_exp_enqueue_native_command_flag_t>(os,
                                                                  (params.flags));
@@ -10358,59 +10851,711 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_enqueue_na
     os << "}";
     return os;
 }
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_kernel_launch_desc_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_kernel_launch_desc_t params) {
+    os << "(struct ur_exp_kernel_launch_desc_t){";
+
+    os << ".hKernel = ";
+
+    ur::details::printPtr(os,
+                          (params.hKernel));
+
+    os << ", ";
+    os << ".workDim = ";
+
+    os << (params.workDim);
+
+    os << ", ";
+    os << ".pGlobalWorkOffset = {";
+    for (size_t i = 0; (params.pGlobalWorkOffset) != NULL && i < params.workDim; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        os << ((params.pGlobalWorkOffset))[i];
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".pGlobalWorkSize = {";
+    for (size_t i = 0; (params.pGlobalWorkSize) != NULL && i < params.workDim; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        os << ((params.pGlobalWorkSize))[i];
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".pLocalWorkSize = {";
+    for (size_t i = 0; (params.pLocalWorkSize) != NULL && i < params.workDim; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        os << ((params.pLocalWorkSize))[i];
+    }
+    os << "}";
+
+    os << "}";
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_kernel_arg_type_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_kernel_arg_type_t value) {
+    switch (value) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+        os << "UR_EXP_KERNEL_ARG_TYPE_VALUE";
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+        os << "UR_EXP_KERNEL_ARG_TYPE_POINTER";
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ:
+        os << "UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ";
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+        os << "UR_EXP_KERNEL_ARG_TYPE_LOCAL";
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+        os << "UR_EXP_KERNEL_ARG_TYPE_SAMPLER";
+        break;
+    default:
+        os << "unknown enumerator";
+        break;
+    }
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_kernel_arg_mem_obj_tuple_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_kernel_arg_mem_obj_tuple_t params) {
+    os << "(struct ur_exp_kernel_arg_mem_obj_tuple_t){";
+
+    os << ".hMem = ";
+
+    ur::details::printPtr(os,
+                          (params.hMem));
+
+    os << ", ";
+    os << ".flags = ";
+
+    ur::details::printFlag<ur_mem_flag_t>(os,
+                                          (params.flags));
+
+    os << "}";
+    return os;
+}
+namespace ur::details {
+
+///////////////////////////////////////////////////////////////////////////////
+// @brief Print ur_exp_kernel_arg_value_t union
+inline ur_result_t printUnion(
+    std::ostream &os,
+    const union ur_exp_kernel_arg_value_t params,
+    const enum ur_exp_kernel_arg_type_t tag) {
+    os << "(union ur_exp_kernel_arg_value_t){";
+
+    switch (tag) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+
+        os << ".value = ";
+
+        ur::details::printPtr(os,
+                              (params.value));
+
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+
+        os << ".pointer = ";
+
+        ur::details::printPtr(os,
+                              (params.pointer));
+
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ:
+
+        os << ".memObjTuple = ";
+
+        os << (params.memObjTuple);
+
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+
+        os << ".sampler = ";
+
+        ur::details::printPtr(os,
+                              (params.sampler));
+
+        break;
+    default:
+        os << "<unknown>";
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    os << "}";
+    return UR_RESULT_SUCCESS;
+}
+} // namespace ur::details
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_kernel_arg_properties_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_kernel_arg_properties_t params) {
+    os << "(struct ur_exp_kernel_arg_properties_t){";
+
+    os << ".type = ";
+
+    os << (params.type);
+
+    os << ", ";
+    os << ".index = ";
+
+    os << (params.index);
+
+    os << ", ";
+    os << ".size = ";
+
+    os << (params.size);
+
+    os << ", ";
+    os << ".value = ";
+    ur::details::printUnion(os, (params.value), params.type);
+
+    os << "}";
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_loader_config_create_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_create_params_t *params) {
+
+    os << ".phLoaderConfig = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphLoaderConfig));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_loader_config_retain_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_retain_params_t *params) {
+
+    os << ".hLoaderConfig = ";
+
+    ur::details::printPtr(os,
+                          *(params->phLoaderConfig));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_loader_config_release_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_release_params_t *params) {
+
+    os << ".hLoaderConfig = ";
+
+    ur::details::printPtr(os,
+                          *(params->phLoaderConfig));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_loader_config_get_info_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_get_info_params_t *params) {
+
+    os << ".hLoaderConfig = ";
+
+    ur::details::printPtr(os,
+                          *(params->phLoaderConfig));
+
+    os << ", ";
+    os << ".propName = ";
+
+    os << *(params->ppropName);
+
+    os << ", ";
+    os << ".propSize = ";
+
+    os << *(params->ppropSize);
+
+    os << ", ";
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+
+    os << ", ";
+    os << ".pPropSizeRet = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppPropSizeRet));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_loader_config_enable_layer_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_enable_layer_params_t *params) {
+
+    os << ".hLoaderConfig = ";
+
+    ur::details::printPtr(os,
+                          *(params->phLoaderConfig));
+
+    os << ", ";
+    os << ".pLayerName = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppLayerName));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_loader_config_set_code_location_callback_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_set_code_location_callback_params_t *params) {
+
+    os << ".hLoaderConfig = ";
+
+    ur::details::printPtr(os,
+                          *(params->phLoaderConfig));
+
+    os << ", ";
+    os << ".pfnCodeloc = ";
+
+    os << reinterpret_cast<void *>(
+        *(params->ppfnCodeloc));
+
+    os << ", ";
+    os << ".pUserData = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppUserData));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_loader_config_set_mocking_enabled_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_set_mocking_enabled_params_t *params) {
+
+    os << ".hLoaderConfig = ";
+
+    ur::details::printPtr(os,
+                          *(params->phLoaderConfig));
+
+    os << ", ";
+    os << ".enable = ";
+
+    os << *(params->penable);
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_platform_get_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_get_params_t *params) {
+
+    os << ".phAdapters = {";
+    for (size_t i = 0; *(params->pphAdapters) != NULL && i < *params->pNumAdapters; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphAdapters))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".NumAdapters = ";
+
+    os << *(params->pNumAdapters);
+
+    os << ", ";
+    os << ".NumEntries = ";
+
+    os << *(params->pNumEntries);
+
+    os << ", ";
+    os << ".phPlatforms = {";
+    for (size_t i = 0; *(params->pphPlatforms) != NULL && i < *params->pNumEntries; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphPlatforms))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".pNumPlatforms = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppNumPlatforms));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_platform_get_info_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_get_info_params_t *params) {
+
+    os << ".hPlatform = ";
+
+    ur::details::printPtr(os,
+                          *(params->phPlatform));
+
+    os << ", ";
+    os << ".propName = ";
+
+    os << *(params->ppropName);
+
+    os << ", ";
+    os << ".propSize = ";
+
+    os << *(params->ppropSize);
+
+    os << ", ";
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+
+    os << ", ";
+    os << ".pPropSizeRet = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppPropSizeRet));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_platform_get_native_handle_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_get_native_handle_params_t *params) {
+
+    os << ".hPlatform = ";
+
+    ur::details::printPtr(os,
+                          *(params->phPlatform));
+
+    os << ", ";
+    os << ".phNativePlatform = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphNativePlatform));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_platform_create_with_native_handle_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_create_with_native_handle_params_t *params) {
+
+    os << ".hNativePlatform = ";
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(
+                                  *(params->phNativePlatform)));
+
+    os << ", ";
+    os << ".hAdapter = ";
+
+    ur::details::printPtr(os,
+                          *(params->phAdapter));
+
+    os << ", ";
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
+
+    os << ", ";
+    os << ".phPlatform = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphPlatform));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_platform_get_api_version_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_get_api_version_params_t *params) {
+
+    os << ".hPlatform = ";
+
+    ur::details::printPtr(os,
+                          *(params->phPlatform));
+
+    os << ", ";
+    os << ".pVersion = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppVersion));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_platform_get_backend_option_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_get_backend_option_params_t *params) {
+
+    os << ".hPlatform = ";
+
+    ur::details::printPtr(os,
+                          *(params->phPlatform));
+
+    os << ", ";
+    os << ".pFrontendOption = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppFrontendOption));
+
+    os << ", ";
+    os << ".ppPlatformOption = ";
+
+    ur::details::printPtr(os,
+                          *(params->pppPlatformOption));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_context_create_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_create_params_t *params) {
+
+    os << ".DeviceCount = ";
+
+    os << *(params->pDeviceCount);
+
+    os << ", ";
+    os << ".phDevices = {";
+    for (size_t i = 0; *(params->pphDevices) != NULL && i < *params->pDeviceCount; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphDevices))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
+
+    os << ", ";
+    os << ".phContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphContext));
+
+    return os;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_loader_config_create_params_t type
+/// @brief Print operator for the ur_context_retain_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_create_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_retain_params_t *params) {
 
-    os << ".phLoaderConfig = ";
+    os << ".hContext = ";
 
     ur::details::printPtr(os,
-                          *(params->pphLoaderConfig));
+                          *(params->phContext));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_loader_config_retain_params_t type
+/// @brief Print operator for the ur_context_release_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_retain_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_release_params_t *params) {
 
-    os << ".hLoaderConfig = ";
+    os << ".hContext = ";
 
     ur::details::printPtr(os,
-                          *(params->phLoaderConfig));
+                          *(params->phContext));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_loader_config_release_params_t type
+/// @brief Print operator for the ur_context_get_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_release_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_get_info_params_t *params) {
 
-    os << ".hLoaderConfig = ";
+    os << ".hContext = ";
 
     ur::details::printPtr(os,
-                          *(params->phLoaderConfig));
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".propName = ";
+
+    os << *(params->ppropName);
+
+    os << ", ";
+    os << ".propSize = ";
+
+    os << *(params->ppropSize);
+
+    os << ", ";
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+
+    os << ", ";
+    os << ".pPropSizeRet = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppPropSizeRet));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_context_get_native_handle_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_get_native_handle_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".phNativeContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphNativeContext));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_context_create_with_native_handle_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_create_with_native_handle_params_t *params) {
+
+    os << ".hNativeContext = ";
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(
+                                  *(params->phNativeContext)));
+
+    os << ", ";
+    os << ".hAdapter = ";
+
+    ur::details::printPtr(os,
+                          *(params->phAdapter));
+
+    os << ", ";
+    os << ".numDevices = ";
+
+    os << *(params->pnumDevices);
+
+    os << ", ";
+    os << ".phDevices = {";
+    for (size_t i = 0; *(params->pphDevices) != NULL && i < *params->pnumDevices; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphDevices))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
+
+    os << ", ";
+    os << ".phContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphContext));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_context_set_extended_deleter_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_set_extended_deleter_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".pfnDeleter = ";
+
+    os << reinterpret_cast<void *>(
+        *(params->ppfnDeleter));
+
+    os << ", ";
+    os << ".pUserData = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppUserData));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_loader_config_get_info_params_t type
+/// @brief Print operator for the ur_event_get_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_get_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_get_info_params_t *params) {
 
-    os << ".hLoaderConfig = ";
+    os << ".hEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->phLoaderConfig));
+                          *(params->phEvent));
 
     os << ", ";
     os << ".propName = ";
@@ -10436,188 +11581,128 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_loader_config_enable_layer_params_t type
+/// @brief Print operator for the ur_event_get_profiling_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_enable_layer_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_get_profiling_info_params_t *params) {
 
-    os << ".hLoaderConfig = ";
+    os << ".hEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->phLoaderConfig));
+                          *(params->phEvent));
 
     os << ", ";
-    os << ".pLayerName = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppLayerName));
-
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_loader_config_set_code_location_callback_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_set_code_location_callback_params_t *params) {
-
-    os << ".hLoaderConfig = ";
+    os << ".propName = ";
 
-    ur::details::printPtr(os,
-                          *(params->phLoaderConfig));
+    os << *(params->ppropName);
 
     os << ", ";
-    os << ".pfnCodeloc = ";
+    os << ".propSize = ";
 
-    os << reinterpret_cast<void *>(
-        *(params->ppfnCodeloc));
+    os << *(params->ppropSize);
 
     os << ", ";
-    os << ".pUserData = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppUserData));
-
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_loader_config_set_mocking_enabled_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_config_set_mocking_enabled_params_t *params) {
-
-    os << ".hLoaderConfig = ";
-
-    ur::details::printPtr(os,
-                          *(params->phLoaderConfig));
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
 
     os << ", ";
-    os << ".enable = ";
+    os << ".pPropSizeRet = ";
 
-    os << *(params->penable);
+    ur::details::printPtr(os,
+                          *(params->ppPropSizeRet));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_platform_get_params_t type
+/// @brief Print operator for the ur_event_wait_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_get_params_t *params) {
-
-    os << ".phAdapters = {";
-    for (size_t i = 0; *(params->pphAdapters) != NULL && i < *params->pNumAdapters; ++i) {
-        if (i != 0) {
-            os << ", ";
-        }
-
-        ur::details::printPtr(os,
-                              (*(params->pphAdapters))[i]);
-    }
-    os << "}";
-
-    os << ", ";
-    os << ".NumAdapters = ";
-
-    os << *(params->pNumAdapters);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_wait_params_t *params) {
 
-    os << ", ";
-    os << ".NumEntries = ";
+    os << ".numEvents = ";
 
-    os << *(params->pNumEntries);
+    os << *(params->pnumEvents);
 
     os << ", ";
-    os << ".phPlatforms = {";
-    for (size_t i = 0; *(params->pphPlatforms) != NULL && i < *params->pNumEntries; ++i) {
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEvents; ++i) {
         if (i != 0) {
             os << ", ";
         }
 
         ur::details::printPtr(os,
-                              (*(params->pphPlatforms))[i]);
+                              (*(params->pphEventWaitList))[i]);
     }
     os << "}";
 
-    os << ", ";
-    os << ".pNumPlatforms = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppNumPlatforms));
-
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_platform_get_info_params_t type
+/// @brief Print operator for the ur_event_retain_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_get_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_retain_params_t *params) {
 
-    os << ".hPlatform = ";
+    os << ".hEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->phPlatform));
-
-    os << ", ";
-    os << ".propName = ";
-
-    os << *(params->ppropName);
-
-    os << ", ";
-    os << ".propSize = ";
+                          *(params->phEvent));
 
-    os << *(params->ppropSize);
+    return os;
+}
 
-    os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_event_release_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_release_params_t *params) {
 
-    os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".hEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+                          *(params->phEvent));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_platform_get_native_handle_params_t type
+/// @brief Print operator for the ur_event_get_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_get_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_get_native_handle_params_t *params) {
 
-    os << ".hPlatform = ";
+    os << ".hEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->phPlatform));
+                          *(params->phEvent));
 
     os << ", ";
-    os << ".phNativePlatform = ";
+    os << ".phNativeEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->pphNativePlatform));
+                          *(params->pphNativeEvent));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_platform_create_with_native_handle_params_t type
+/// @brief Print operator for the ur_event_create_with_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_create_with_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_create_with_native_handle_params_t *params) {
 
-    os << ".hNativePlatform = ";
+    os << ".hNativeEvent = ";
 
     ur::details::printPtr(os, reinterpret_cast<void *>(
-                                  *(params->phNativePlatform)));
+                                  *(params->phNativeEvent)));
 
     os << ", ";
-    os << ".hAdapter = ";
+    os << ".hContext = ";
 
     ur::details::printPtr(os,
-                          *(params->phAdapter));
+                          *(params->phContext));
 
     os << ", ";
     os << ".pProperties = ";
@@ -10626,164 +11711,197 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->ppProperties));
 
     os << ", ";
-    os << ".phPlatform = ";
+    os << ".phEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->pphPlatform));
+                          *(params->pphEvent));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_platform_get_api_version_params_t type
+/// @brief Print operator for the ur_event_set_callback_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_get_api_version_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_set_callback_params_t *params) {
 
-    os << ".hPlatform = ";
+    os << ".hEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->phPlatform));
+                          *(params->phEvent));
 
     os << ", ";
-    os << ".pVersion = ";
+    os << ".execStatus = ";
+
+    os << *(params->pexecStatus);
+
+    os << ", ";
+    os << ".pfnNotify = ";
+
+    os << reinterpret_cast<void *>(
+        *(params->ppfnNotify));
+
+    os << ", ";
+    os << ".pUserData = ";
 
     ur::details::printPtr(os,
-                          *(params->ppVersion));
+                          *(params->ppUserData));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_platform_get_backend_option_params_t type
+/// @brief Print operator for the ur_event_wait_any_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_platform_get_backend_option_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_wait_any_exp_params_t *params) {
 
-    os << ".hPlatform = ";
+    os << ".numEvents = ";
 
-    ur::details::printPtr(os,
-                          *(params->phPlatform));
+    os << *(params->pnumEvents);
 
     os << ", ";
-    os << ".pFrontendOption = ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEvents; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    ur::details::printPtr(os,
-                          *(params->ppFrontendOption));
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
 
     os << ", ";
-    os << ".ppPlatformOption = ";
+    os << ".pEventIndex = ";
 
     ur::details::printPtr(os,
-                          *(params->pppPlatformOption));
+                          *(params->ppEventIndex));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_context_create_params_t type
+/// @brief Print operator for the ur_event_get_execution_status_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_create_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_get_execution_status_exp_params_t *params) {
 
-    os << ".DeviceCount = ";
+    os << ".numEvents = ";
 
-    os << *(params->pDeviceCount);
+    os << *(params->pnumEvents);
 
     os << ", ";
-    os << ".phDevices = {";
-    for (size_t i = 0; *(params->pphDevices) != NULL && i < *params->pDeviceCount; ++i) {
+    os << ".phEvents = {";
+    for (size_t i = 0; *(params->pphEvents) != NULL && i < *params->pnumEvents; ++i) {
         if (i != 0) {
             os << ", ";
         }
 
         ur::details::printPtr(os,
-                              (*(params->pphDevices))[i]);
+                              (*(params->pphEvents))[i]);
     }
     os << "}";
 
     os << ", ";
-    os << ".pProperties = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
-
-    os << ", ";
-    os << ".phContext = ";
+    os << ".pStatuses = {";
+    for (size_t i = 0; *(params->ppStatuses) != NULL && i < *params->pnumEvents; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    ur::details::printPtr(os,
-                          *(params->pphContext));
+        os << (*(params->ppStatuses))[i];
+    }
+    os << "}";
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_context_retain_params_t type
+/// @brief Print operator for the ur_program_create_with_il_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_retain_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_create_with_il_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".pIL = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppIL));
+
+    os << ", ";
+    os << ".length = ";
+
+    os << *(params->plength);
+
+    os << ", ";
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
 
-    os << ".hContext = ";
+    os << ", ";
+    os << ".phProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->pphProgram));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_context_release_params_t type
+/// @brief Print operator for the ur_program_create_with_binary_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_release_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_create_with_binary_params_t *params) {
 
     os << ".hContext = ";
 
     ur::details::printPtr(os,
                           *(params->phContext));
 
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_context_get_info_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_get_info_params_t *params) {
-
-    os << ".hContext = ";
+    os << ", ";
+    os << ".hDevice = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->phDevice));
 
     os << ", ";
-    os << ".propName = ";
+    os << ".size = ";
 
-    os << *(params->ppropName);
+    os << *(params->psize);
 
     os << ", ";
-    os << ".propSize = ";
+    os << ".pBinary = ";
 
-    os << *(params->ppropSize);
+    ur::details::printPtr(os,
+                          *(params->ppBinary));
 
     os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
 
     os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".phProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+                          *(params->pphProgram));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_context_get_native_handle_params_t type
+/// @brief Print operator for the ur_program_build_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_get_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_build_params_t *params) {
 
     os << ".hContext = ";
 
@@ -10791,30 +11909,30 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phContext));
 
     os << ", ";
-    os << ".phNativeContext = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->pphNativeContext));
+                          *(params->phProgram));
+
+    os << ", ";
+    os << ".pOptions = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppOptions));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_context_create_with_native_handle_params_t type
+/// @brief Print operator for the ur_program_build_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_create_with_native_handle_params_t *params) {
-
-    os << ".hNativeContext = ";
-
-    ur::details::printPtr(os, reinterpret_cast<void *>(
-                                  *(params->phNativeContext)));
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_build_exp_params_t *params) {
 
-    os << ", ";
-    os << ".hAdapter = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->phAdapter));
+                          *(params->phProgram));
 
     os << ", ";
     os << ".numDevices = ";
@@ -10834,25 +11952,19 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << "}";
 
     os << ", ";
-    os << ".pProperties = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
-
-    os << ", ";
-    os << ".phContext = ";
+    os << ".pOptions = ";
 
     ur::details::printPtr(os,
-                          *(params->pphContext));
+                          *(params->ppOptions));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_context_set_extended_deleter_params_t type
+/// @brief Print operator for the ur_program_compile_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_context_set_extended_deleter_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_compile_params_t *params) {
 
     os << ".hContext = ";
 
@@ -10860,271 +11972,302 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phContext));
 
     os << ", ";
-    os << ".pfnDeleter = ";
+    os << ".hProgram = ";
 
-    os << reinterpret_cast<void *>(
-        *(params->ppfnDeleter));
+    ur::details::printPtr(os,
+                          *(params->phProgram));
 
     os << ", ";
-    os << ".pUserData = ";
+    os << ".pOptions = ";
 
     ur::details::printPtr(os,
-                          *(params->ppUserData));
+                          *(params->ppOptions));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_event_get_info_params_t type
+/// @brief Print operator for the ur_program_compile_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_get_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_compile_exp_params_t *params) {
 
-    os << ".hEvent = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->phEvent));
+                          *(params->phProgram));
 
     os << ", ";
-    os << ".propName = ";
+    os << ".numDevices = ";
 
-    os << *(params->ppropName);
+    os << *(params->pnumDevices);
 
     os << ", ";
-    os << ".propSize = ";
-
-    os << *(params->ppropSize);
+    os << ".phDevices = {";
+    for (size_t i = 0; *(params->pphDevices) != NULL && i < *params->pnumDevices; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+        ur::details::printPtr(os,
+                              (*(params->pphDevices))[i]);
+    }
+    os << "}";
 
     os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".pOptions = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+                          *(params->ppOptions));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_event_get_profiling_info_params_t type
+/// @brief Print operator for the ur_program_link_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_get_profiling_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_link_params_t *params) {
 
-    os << ".hEvent = ";
+    os << ".hContext = ";
 
     ur::details::printPtr(os,
-                          *(params->phEvent));
+                          *(params->phContext));
 
     os << ", ";
-    os << ".propName = ";
+    os << ".count = ";
 
-    os << *(params->ppropName);
+    os << *(params->pcount);
 
     os << ", ";
-    os << ".propSize = ";
+    os << ".phPrograms = {";
+    for (size_t i = 0; *(params->pphPrograms) != NULL && i < *params->pcount; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    os << *(params->ppropSize);
+        ur::details::printPtr(os,
+                              (*(params->pphPrograms))[i]);
+    }
+    os << "}";
 
     os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+    os << ".pOptions = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppOptions));
 
     os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".phProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+                          *(params->pphProgram));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_event_wait_params_t type
+/// @brief Print operator for the ur_program_link_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_wait_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_link_exp_params_t *params) {
 
-    os << ".numEvents = ";
+    os << ".hContext = ";
 
-    os << *(params->pnumEvents);
+    ur::details::printPtr(os,
+                          *(params->phContext));
 
     os << ", ";
-    os << ".phEventWaitList = {";
-    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEvents; ++i) {
+    os << ".numDevices = ";
+
+    os << *(params->pnumDevices);
+
+    os << ", ";
+    os << ".phDevices = {";
+    for (size_t i = 0; *(params->pphDevices) != NULL && i < *params->pnumDevices; ++i) {
         if (i != 0) {
             os << ", ";
         }
 
         ur::details::printPtr(os,
-                              (*(params->pphEventWaitList))[i]);
+                              (*(params->pphDevices))[i]);
     }
     os << "}";
 
-    return os;
-}
+    os << ", ";
+    os << ".count = ";
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_event_retain_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_retain_params_t *params) {
+    os << *(params->pcount);
 
-    os << ".hEvent = ";
+    os << ", ";
+    os << ".phPrograms = {";
+    for (size_t i = 0; *(params->pphPrograms) != NULL && i < *params->pcount; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphPrograms))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".pOptions = ";
 
     ur::details::printPtr(os,
-                          *(params->phEvent));
+                          *(params->ppOptions));
+
+    os << ", ";
+    os << ".phProgram = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphProgram));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_event_release_params_t type
+/// @brief Print operator for the ur_program_retain_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_release_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_retain_params_t *params) {
 
-    os << ".hEvent = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->phEvent));
+                          *(params->phProgram));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_event_get_native_handle_params_t type
+/// @brief Print operator for the ur_program_release_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_get_native_handle_params_t *params) {
-
-    os << ".hEvent = ";
-
-    ur::details::printPtr(os,
-                          *(params->phEvent));
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_release_params_t *params) {
 
-    os << ", ";
-    os << ".phNativeEvent = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->pphNativeEvent));
+                          *(params->phProgram));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_event_create_with_native_handle_params_t type
+/// @brief Print operator for the ur_program_get_function_pointer_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_create_with_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_get_function_pointer_params_t *params) {
 
-    os << ".hNativeEvent = ";
+    os << ".hDevice = ";
 
-    ur::details::printPtr(os, reinterpret_cast<void *>(
-                                  *(params->phNativeEvent)));
+    ur::details::printPtr(os,
+                          *(params->phDevice));
 
     os << ", ";
-    os << ".hContext = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->phProgram));
 
     os << ", ";
-    os << ".pProperties = ";
+    os << ".pFunctionName = ";
 
     ur::details::printPtr(os,
-                          *(params->ppProperties));
+                          *(params->ppFunctionName));
 
     os << ", ";
-    os << ".phEvent = ";
+    os << ".ppFunctionPointer = ";
 
     ur::details::printPtr(os,
-                          *(params->pphEvent));
+                          *(params->pppFunctionPointer));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_event_set_callback_params_t type
+/// @brief Print operator for the ur_program_get_global_variable_pointer_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_set_callback_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_get_global_variable_pointer_params_t *params) {
 
-    os << ".hEvent = ";
+    os << ".hDevice = ";
 
     ur::details::printPtr(os,
-                          *(params->phEvent));
+                          *(params->phDevice));
 
     os << ", ";
-    os << ".execStatus = ";
+    os << ".hProgram = ";
 
-    os << *(params->pexecStatus);
+    ur::details::printPtr(os,
+                          *(params->phProgram));
 
     os << ", ";
-    os << ".pfnNotify = ";
+    os << ".pGlobalVariableName = ";
 
-    os << reinterpret_cast<void *>(
-        *(params->ppfnNotify));
+    ur::details::printPtr(os,
+                          *(params->ppGlobalVariableName));
 
     os << ", ";
-    os << ".pUserData = ";
+    os << ".pGlobalVariableSizeRet = ";
 
     ur::details::printPtr(os,
-                          *(params->ppUserData));
+                          *(params->ppGlobalVariableSizeRet));
+
+    os << ", ";
+    os << ".ppGlobalVariablePointerRet = ";
+
+    ur::details::printPtr(os,
+                          *(params->pppGlobalVariablePointerRet));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_create_with_il_params_t type
+/// @brief Print operator for the ur_program_get_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_create_with_il_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_get_info_params_t *params) {
 
-    os << ".hContext = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->phProgram));
 
     os << ", ";
-    os << ".pIL = ";
+    os << ".propName = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppIL));
+    os << *(params->ppropName);
 
     os << ", ";
-    os << ".length = ";
+    os << ".propSize = ";
 
-    os << *(params->plength);
+    os << *(params->ppropSize);
 
     os << ", ";
-    os << ".pProperties = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
 
     os << ", ";
-    os << ".phProgram = ";
+    os << ".pPropSizeRet = ";
 
     ur::details::printPtr(os,
-                          *(params->pphProgram));
+                          *(params->ppPropSizeRet));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_create_with_binary_params_t type
+/// @brief Print operator for the ur_program_get_build_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_create_with_binary_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_get_build_info_params_t *params) {
 
-    os << ".hContext = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->phProgram));
 
     os << ", ";
     os << ".hDevice = ";
@@ -11133,298 +12276,314 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phDevice));
 
     os << ", ";
-    os << ".size = ";
+    os << ".propName = ";
 
-    os << *(params->psize);
+    os << *(params->ppropName);
 
     os << ", ";
-    os << ".pBinary = ";
+    os << ".propSize = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppBinary));
+    os << *(params->ppropSize);
 
     os << ", ";
-    os << ".pProperties = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
 
     os << ", ";
-    os << ".phProgram = ";
+    os << ".pPropSizeRet = ";
 
     ur::details::printPtr(os,
-                          *(params->pphProgram));
+                          *(params->ppPropSizeRet));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_build_params_t type
+/// @brief Print operator for the ur_program_set_specialization_constants_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_build_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_set_specialization_constants_params_t *params) {
 
-    os << ".hContext = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->phProgram));
+
+    os << ", ";
+    os << ".count = ";
+
+    os << *(params->pcount);
 
     os << ", ";
+    os << ".pSpecConstants = {";
+    for (size_t i = 0; *(params->ppSpecConstants) != NULL && i < *params->pcount; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        os << (*(params->ppSpecConstants))[i];
+    }
+    os << "}";
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_program_get_native_handle_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_get_native_handle_params_t *params) {
+
     os << ".hProgram = ";
 
     ur::details::printPtr(os,
                           *(params->phProgram));
 
     os << ", ";
-    os << ".pOptions = ";
+    os << ".phNativeProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->ppOptions));
+                          *(params->pphNativeProgram));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_build_exp_params_t type
+/// @brief Print operator for the ur_program_create_with_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_build_exp_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_create_with_native_handle_params_t *params) {
 
-    os << ".hProgram = ";
+    os << ".hNativeProgram = ";
 
-    ur::details::printPtr(os,
-                          *(params->phProgram));
+    ur::details::printPtr(os, reinterpret_cast<void *>(
+                                  *(params->phNativeProgram)));
 
     os << ", ";
-    os << ".numDevices = ";
+    os << ".hContext = ";
 
-    os << *(params->pnumDevices);
+    ur::details::printPtr(os,
+                          *(params->phContext));
 
     os << ", ";
-    os << ".phDevices = {";
-    for (size_t i = 0; *(params->pphDevices) != NULL && i < *params->pnumDevices; ++i) {
-        if (i != 0) {
-            os << ", ";
-        }
+    os << ".pProperties = ";
 
-        ur::details::printPtr(os,
-                              (*(params->pphDevices))[i]);
-    }
-    os << "}";
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
 
     os << ", ";
-    os << ".pOptions = ";
+    os << ".phProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->ppOptions));
+                          *(params->pphProgram));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_compile_params_t type
+/// @brief Print operator for the ur_kernel_create_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_compile_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_create_params_t *params) {
 
-    os << ".hContext = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->phProgram));
 
     os << ", ";
-    os << ".hProgram = ";
+    os << ".pKernelName = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->ppKernelName));
 
     os << ", ";
-    os << ".pOptions = ";
+    os << ".phKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->ppOptions));
+                          *(params->pphKernel));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_compile_exp_params_t type
+/// @brief Print operator for the ur_kernel_get_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_compile_exp_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_get_info_params_t *params) {
 
-    os << ".hProgram = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".numDevices = ";
+    os << ".propName = ";
 
-    os << *(params->pnumDevices);
+    os << *(params->ppropName);
 
     os << ", ";
-    os << ".phDevices = {";
-    for (size_t i = 0; *(params->pphDevices) != NULL && i < *params->pnumDevices; ++i) {
-        if (i != 0) {
-            os << ", ";
-        }
+    os << ".propSize = ";
 
-        ur::details::printPtr(os,
-                              (*(params->pphDevices))[i]);
-    }
-    os << "}";
+    os << *(params->ppropSize);
 
     os << ", ";
-    os << ".pOptions = ";
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+
+    os << ", ";
+    os << ".pPropSizeRet = ";
 
     ur::details::printPtr(os,
-                          *(params->ppOptions));
+                          *(params->ppPropSizeRet));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_link_params_t type
+/// @brief Print operator for the ur_kernel_get_group_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_link_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_get_group_info_params_t *params) {
 
-    os << ".hContext = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".count = ";
+    os << ".hDevice = ";
 
-    os << *(params->pcount);
+    ur::details::printPtr(os,
+                          *(params->phDevice));
 
     os << ", ";
-    os << ".phPrograms = {";
-    for (size_t i = 0; *(params->pphPrograms) != NULL && i < *params->pcount; ++i) {
-        if (i != 0) {
-            os << ", ";
-        }
+    os << ".propName = ";
 
-        ur::details::printPtr(os,
-                              (*(params->pphPrograms))[i]);
-    }
-    os << "}";
+    os << *(params->ppropName);
 
     os << ", ";
-    os << ".pOptions = ";
+    os << ".propSize = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppOptions));
+    os << *(params->ppropSize);
 
     os << ", ";
-    os << ".phProgram = ";
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+
+    os << ", ";
+    os << ".pPropSizeRet = ";
 
     ur::details::printPtr(os,
-                          *(params->pphProgram));
+                          *(params->ppPropSizeRet));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_link_exp_params_t type
+/// @brief Print operator for the ur_kernel_get_sub_group_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_link_exp_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_get_sub_group_info_params_t *params) {
 
-    os << ".hContext = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
-
-    os << ", ";
-    os << ".numDevices = ";
-
-    os << *(params->pnumDevices);
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".phDevices = {";
-    for (size_t i = 0; *(params->pphDevices) != NULL && i < *params->pnumDevices; ++i) {
-        if (i != 0) {
-            os << ", ";
-        }
+    os << ".hDevice = ";
 
-        ur::details::printPtr(os,
-                              (*(params->pphDevices))[i]);
-    }
-    os << "}";
+    ur::details::printPtr(os,
+                          *(params->phDevice));
 
     os << ", ";
-    os << ".count = ";
+    os << ".propName = ";
 
-    os << *(params->pcount);
+    os << *(params->ppropName);
 
     os << ", ";
-    os << ".phPrograms = {";
-    for (size_t i = 0; *(params->pphPrograms) != NULL && i < *params->pcount; ++i) {
-        if (i != 0) {
-            os << ", ";
-        }
+    os << ".propSize = ";
 
-        ur::details::printPtr(os,
-                              (*(params->pphPrograms))[i]);
-    }
-    os << "}";
+    os << *(params->ppropSize);
 
     os << ", ";
-    os << ".pOptions = ";
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+
+    os << ", ";
+    os << ".pPropSizeRet = ";
 
     ur::details::printPtr(os,
-                          *(params->ppOptions));
+                          *(params->ppPropSizeRet));
 
-    os << ", ";
-    os << ".phProgram = ";
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_kernel_retain_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_retain_params_t *params) {
+
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->pphProgram));
+                          *(params->phKernel));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_retain_params_t type
+/// @brief Print operator for the ur_kernel_release_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_retain_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_release_params_t *params) {
 
-    os << ".hProgram = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->phKernel));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_release_params_t type
+/// @brief Print operator for the ur_kernel_get_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_release_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_get_native_handle_params_t *params) {
 
-    os << ".hProgram = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->phKernel));
+
+    os << ", ";
+    os << ".phNativeKernel = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphNativeKernel));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_get_function_pointer_params_t type
+/// @brief Print operator for the ur_kernel_create_with_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_get_function_pointer_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_create_with_native_handle_params_t *params) {
 
-    os << ".hDevice = ";
+    os << ".hNativeKernel = ";
+
+    ur::details::printPtr(os, reinterpret_cast<void *>(
+                                  *(params->phNativeKernel)));
+
+    os << ", ";
+    os << ".hContext = ";
 
     ur::details::printPtr(os,
-                          *(params->phDevice));
+                          *(params->phContext));
 
     os << ", ";
     os << ".hProgram = ";
@@ -11433,198 +12592,240 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phProgram));
 
     os << ", ";
-    os << ".pFunctionName = ";
+    os << ".pProperties = ";
 
     ur::details::printPtr(os,
-                          *(params->ppFunctionName));
+                          *(params->ppProperties));
 
     os << ", ";
-    os << ".ppFunctionPointer = ";
+    os << ".phKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->pppFunctionPointer));
+                          *(params->pphKernel));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_get_global_variable_pointer_params_t type
+/// @brief Print operator for the ur_kernel_get_suggested_local_work_size_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_get_global_variable_pointer_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_get_suggested_local_work_size_params_t *params) {
 
-    os << ".hDevice = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phDevice));
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".hProgram = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->phQueue));
 
     os << ", ";
-    os << ".pGlobalVariableName = ";
+    os << ".numWorkDim = ";
+
+    os << *(params->pnumWorkDim);
+
+    os << ", ";
+    os << ".pGlobalWorkOffset = ";
 
     ur::details::printPtr(os,
-                          *(params->ppGlobalVariableName));
+                          *(params->ppGlobalWorkOffset));
 
     os << ", ";
-    os << ".pGlobalVariableSizeRet = ";
+    os << ".pGlobalWorkSize = ";
 
     ur::details::printPtr(os,
-                          *(params->ppGlobalVariableSizeRet));
+                          *(params->ppGlobalWorkSize));
 
     os << ", ";
-    os << ".ppGlobalVariablePointerRet = ";
+    os << ".pSuggestedLocalWorkSize = ";
 
     ur::details::printPtr(os,
-                          *(params->pppGlobalVariablePointerRet));
+                          *(params->ppSuggestedLocalWorkSize));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_get_info_params_t type
+/// @brief Print operator for the ur_kernel_set_arg_value_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_get_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_arg_value_params_t *params) {
 
-    os << ".hProgram = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".propName = ";
+    os << ".argIndex = ";
 
-    os << *(params->ppropName);
+    os << *(params->pargIndex);
 
     os << ", ";
-    os << ".propSize = ";
+    os << ".argSize = ";
 
-    os << *(params->ppropSize);
+    os << *(params->pargSize);
 
     os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
 
     os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".pArgValue = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+                          *(params->ppArgValue));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_get_build_info_params_t type
+/// @brief Print operator for the ur_kernel_set_arg_local_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_get_build_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_arg_local_params_t *params) {
 
-    os << ".hProgram = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".hDevice = ";
+    os << ".argIndex = ";
 
-    ur::details::printPtr(os,
-                          *(params->phDevice));
+    os << *(params->pargIndex);
 
     os << ", ";
-    os << ".propName = ";
+    os << ".argSize = ";
 
-    os << *(params->ppropName);
+    os << *(params->pargSize);
 
     os << ", ";
-    os << ".propSize = ";
+    os << ".pProperties = ";
 
-    os << *(params->ppropSize);
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_kernel_set_arg_pointer_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_arg_pointer_params_t *params) {
+
+    os << ".hKernel = ";
+
+    ur::details::printPtr(os,
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+    os << ".argIndex = ";
+
+    os << *(params->pargIndex);
 
     os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".pProperties = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+                          *(params->ppProperties));
+
+    os << ", ";
+    os << ".pArgValue = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppArgValue));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_set_specialization_constants_params_t type
+/// @brief Print operator for the ur_kernel_set_exec_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_set_specialization_constants_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_exec_info_params_t *params) {
 
-    os << ".hProgram = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".count = ";
+    os << ".propName = ";
 
-    os << *(params->pcount);
+    os << *(params->ppropName);
 
     os << ", ";
-    os << ".pSpecConstants = {";
-    for (size_t i = 0; *(params->ppSpecConstants) != NULL && i < *params->pcount; ++i) {
-        if (i != 0) {
-            os << ", ";
-        }
+    os << ".propSize = ";
 
-        os << (*(params->ppSpecConstants))[i];
-    }
-    os << "}";
+    os << *(params->ppropSize);
+
+    os << ", ";
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
+
+    os << ", ";
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_get_native_handle_params_t type
+/// @brief Print operator for the ur_kernel_set_arg_sampler_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_get_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_arg_sampler_params_t *params) {
 
-    os << ".hProgram = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".phNativeProgram = ";
+    os << ".argIndex = ";
+
+    os << *(params->pargIndex);
+
+    os << ", ";
+    os << ".pProperties = ";
 
     ur::details::printPtr(os,
-                          *(params->pphNativeProgram));
+                          *(params->ppProperties));
+
+    os << ", ";
+    os << ".hArgValue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phArgValue));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_create_with_native_handle_params_t type
+/// @brief Print operator for the ur_kernel_set_arg_mem_obj_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_create_with_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_arg_mem_obj_params_t *params) {
 
-    os << ".hNativeProgram = ";
+    os << ".hKernel = ";
 
-    ur::details::printPtr(os, reinterpret_cast<void *>(
-                                  *(params->phNativeProgram)));
+    ur::details::printPtr(os,
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".hContext = ";
+    os << ".argIndex = ";
 
-    ur::details::printPtr(os,
-                          *(params->phContext));
+    os << *(params->pargIndex);
 
     os << ", ";
     os << ".pProperties = ";
@@ -11633,45 +12834,44 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->ppProperties));
 
     os << ", ";
-    os << ".phProgram = ";
+    os << ".hArgValue = ";
 
     ur::details::printPtr(os,
-                          *(params->pphProgram));
+                          *(params->phArgValue));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_create_params_t type
+/// @brief Print operator for the ur_kernel_set_specialization_constants_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_create_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_specialization_constants_params_t *params) {
 
-    os << ".hProgram = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".pKernelName = ";
+    os << ".count = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppKernelName));
+    os << *(params->pcount);
 
     os << ", ";
-    os << ".phKernel = ";
+    os << ".pSpecConstants = ";
 
     ur::details::printPtr(os,
-                          *(params->pphKernel));
+                          *(params->ppSpecConstants));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_get_info_params_t type
+/// @brief Print operator for the ur_kernel_suggest_max_cooperative_group_count_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_get_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t *params) {
 
     os << ".hKernel = ";
 
@@ -11679,33 +12879,29 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phKernel));
 
     os << ", ";
-    os << ".propName = ";
+    os << ".localWorkSize = ";
 
-    os << *(params->ppropName);
+    os << *(params->plocalWorkSize);
 
     os << ", ";
-    os << ".propSize = ";
-
-    os << *(params->ppropSize);
+    os << ".dynamicSharedMemorySize = ";
 
-    os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+    os << *(params->pdynamicSharedMemorySize);
 
     os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".pGroupCountRet = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+                          *(params->ppGroupCountRet));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_get_group_info_params_t type
+/// @brief Print operator for the ur_kernel_set_args_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_get_group_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_args_exp_params_t *params) {
 
     os << ".hKernel = ";
 
@@ -11713,10 +12909,34 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phKernel));
 
     os << ", ";
-    os << ".hDevice = ";
+    os << ".numArgs = ";
+
+    os << *(params->pnumArgs);
+
+    os << ", ";
+    os << ".pArgs = {";
+    for (size_t i = 0; *(params->ppArgs) != NULL && i < *params->pnumArgs; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        os << (*(params->ppArgs))[i];
+    }
+    os << "}";
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_queue_get_info_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_get_info_params_t *params) {
+
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phDevice));
+                          *(params->phQueue));
 
     os << ", ";
     os << ".propName = ";
@@ -11742,15 +12962,15 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_get_sub_group_info_params_t type
+/// @brief Print operator for the ur_queue_create_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_get_sub_group_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_create_params_t *params) {
 
-    os << ".hKernel = ";
+    os << ".hContext = ";
 
     ur::details::printPtr(os,
-                          *(params->phKernel));
+                          *(params->phContext));
 
     os << ", ";
     os << ".hDevice = ";
@@ -11759,86 +12979,84 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phDevice));
 
     os << ", ";
-    os << ".propName = ";
-
-    os << *(params->ppropName);
-
-    os << ", ";
-    os << ".propSize = ";
-
-    os << *(params->ppropSize);
+    os << ".pProperties = ";
 
-    os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
 
     os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".phQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+                          *(params->pphQueue));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_retain_params_t type
+/// @brief Print operator for the ur_queue_retain_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_retain_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_retain_params_t *params) {
 
-    os << ".hKernel = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phKernel));
+                          *(params->phQueue));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_release_params_t type
+/// @brief Print operator for the ur_queue_release_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_release_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_release_params_t *params) {
 
-    os << ".hKernel = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phKernel));
+                          *(params->phQueue));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_get_native_handle_params_t type
+/// @brief Print operator for the ur_queue_get_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_get_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_get_native_handle_params_t *params) {
 
-    os << ".hKernel = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phKernel));
+                          *(params->phQueue));
 
     os << ", ";
-    os << ".phNativeKernel = ";
+    os << ".pDesc = ";
 
     ur::details::printPtr(os,
-                          *(params->pphNativeKernel));
+                          *(params->ppDesc));
+
+    os << ", ";
+    os << ".phNativeQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphNativeQueue));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_create_with_native_handle_params_t type
+/// @brief Print operator for the ur_queue_create_with_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_create_with_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_create_with_native_handle_params_t *params) {
 
-    os << ".hNativeKernel = ";
+    os << ".hNativeQueue = ";
 
     ur::details::printPtr(os, reinterpret_cast<void *>(
-                                  *(params->phNativeKernel)));
+                                  *(params->phNativeQueue)));
 
     os << ", ";
     os << ".hContext = ";
@@ -11847,10 +13065,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phContext));
 
     os << ", ";
-    os << ".hProgram = ";
+    os << ".hDevice = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->phDevice));
 
     os << ", ";
     os << ".pProperties = ";
@@ -11859,164 +13077,290 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->ppProperties));
 
     os << ", ";
-    os << ".phKernel = ";
+    os << ".phQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->pphKernel));
+                          *(params->pphQueue));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_get_suggested_local_work_size_params_t type
+/// @brief Print operator for the ur_queue_finish_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_get_suggested_local_work_size_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_finish_params_t *params) {
 
-    os << ".hKernel = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phKernel));
+                          *(params->phQueue));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_queue_flush_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_flush_params_t *params) {
 
-    os << ", ";
     os << ".hQueue = ";
 
     ur::details::printPtr(os,
                           *(params->phQueue));
 
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_queue_group_create_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_group_create_exp_params_t *params) {
+
+    os << ".numQueues = ";
+
+    os << *(params->pnumQueues);
+
     os << ", ";
-    os << ".numWorkDim = ";
+    os << ".phQueues = {";
+    for (size_t i = 0; *(params->pphQueues) != NULL && i < *params->pnumQueues; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    os << *(params->pnumWorkDim);
+        ur::details::printPtr(os,
+                              (*(params->pphQueues))[i]);
+    }
+    os << "}";
 
     os << ", ";
-    os << ".pGlobalWorkOffset = ";
+    os << ".phQueueGroup = ";
 
     ur::details::printPtr(os,
-                          *(params->ppGlobalWorkOffset));
+                          *(params->pphQueueGroup));
 
-    os << ", ";
-    os << ".pGlobalWorkSize = ";
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_queue_group_retain_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_group_retain_exp_params_t *params) {
+
+    os << ".hQueueGroup = ";
 
     ur::details::printPtr(os,
-                          *(params->ppGlobalWorkSize));
+                          *(params->phQueueGroup));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_queue_group_release_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_group_release_exp_params_t *params) {
+
+    os << ".hQueueGroup = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueueGroup));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_queue_group_finish_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_group_finish_exp_params_t *params) {
+
+    os << ".hQueueGroup = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueueGroup));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_queue_group_get_queue_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_group_get_queue_exp_params_t *params) {
+
+    os << ".hQueueGroup = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueueGroup));
 
     os << ", ";
-    os << ".pSuggestedLocalWorkSize = ";
+    os << ".phQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->ppSuggestedLocalWorkSize));
+                          *(params->pphQueue));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_set_arg_value_params_t type
+/// @brief Print operator for the ur_queue_group_barrier_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_arg_value_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_group_barrier_exp_params_t *params) {
 
-    os << ".hKernel = ";
+    os << ".hQueueGroup = ";
 
     ur::details::printPtr(os,
-                          *(params->phKernel));
+                          *(params->phQueueGroup));
 
     os << ", ";
-    os << ".argIndex = ";
+    os << ".numEventsInWaitList = ";
 
-    os << *(params->pargIndex);
+    os << *(params->pnumEventsInWaitList);
 
     os << ", ";
-    os << ".argSize = ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    os << *(params->pargSize);
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_queue_reserve_timestamp_markers_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_reserve_timestamp_markers_exp_params_t *params) {
 
-    os << ", ";
-    os << ".pProperties = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->ppProperties));
+                          *(params->phQueue));
 
     os << ", ";
-    os << ".pArgValue = ";
+    os << ".capacity = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppArgValue));
+    os << *(params->pcapacity);
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_set_arg_local_params_t type
+/// @brief Print operator for the ur_queue_read_timestamp_markers_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_arg_local_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_read_timestamp_markers_exp_params_t *params) {
 
-    os << ".hKernel = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phKernel));
+                          *(params->phQueue));
 
     os << ", ";
-    os << ".argIndex = ";
+    os << ".firstMarker = ";
 
-    os << *(params->pargIndex);
+    os << *(params->pfirstMarker);
 
     os << ", ";
-    os << ".argSize = ";
+    os << ".count = ";
 
-    os << *(params->pargSize);
+    os << *(params->pcount);
 
     os << ", ";
-    os << ".pProperties = ";
+    os << ".pTimestamps = {";
+    for (size_t i = 0; *(params->ppTimestamps) != NULL && i < *params->pcount; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
+        os << (*(params->ppTimestamps))[i];
+    }
+    os << "}";
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_set_arg_pointer_params_t type
+/// @brief Print operator for the ur_sampler_create_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_arg_pointer_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_create_params_t *params) {
 
-    os << ".hKernel = ";
+    os << ".hContext = ";
 
     ur::details::printPtr(os,
-                          *(params->phKernel));
+                          *(params->phContext));
 
     os << ", ";
-    os << ".argIndex = ";
+    os << ".pDesc = ";
 
-    os << *(params->pargIndex);
+    ur::details::printPtr(os,
+                          *(params->ppDesc));
 
     os << ", ";
-    os << ".pProperties = ";
+    os << ".phSampler = ";
 
     ur::details::printPtr(os,
-                          *(params->ppProperties));
+                          *(params->pphSampler));
 
-    os << ", ";
-    os << ".pArgValue = ";
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_sampler_retain_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_retain_params_t *params) {
+
+    os << ".hSampler = ";
 
     ur::details::printPtr(os,
-                          *(params->ppArgValue));
+                          *(params->phSampler));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_set_exec_info_params_t type
+/// @brief Print operator for the ur_sampler_release_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_exec_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_release_params_t *params) {
 
-    os << ".hKernel = ";
+    os << ".hSampler = ";
 
     ur::details::printPtr(os,
-                          *(params->phKernel));
+                          *(params->phSampler));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_sampler_get_info_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_get_info_params_t *params) {
+
+    os << ".hSampler = ";
+
+    ur::details::printPtr(os,
+                          *(params->phSampler));
 
     os << ", ";
     os << ".propName = ";
@@ -12028,65 +13372,55 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 
     os << *(params->ppropSize);
 
-    os << ", ";
-    os << ".pProperties = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
-
     os << ", ";
     os << ".pPropValue = ";
     ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
 
+    os << ", ";
+    os << ".pPropSizeRet = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppPropSizeRet));
+
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_set_arg_sampler_params_t type
+/// @brief Print operator for the ur_sampler_get_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_arg_sampler_params_t *params) {
-
-    os << ".hKernel = ";
-
-    ur::details::printPtr(os,
-                          *(params->phKernel));
-
-    os << ", ";
-    os << ".argIndex = ";
-
-    os << *(params->pargIndex);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_get_native_handle_params_t *params) {
 
-    os << ", ";
-    os << ".pProperties = ";
+    os << ".hSampler = ";
 
     ur::details::printPtr(os,
-                          *(params->ppProperties));
+                          *(params->phSampler));
 
     os << ", ";
-    os << ".hArgValue = ";
+    os << ".phNativeSampler = ";
 
     ur::details::printPtr(os,
-                          *(params->phArgValue));
+                          *(params->pphNativeSampler));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_set_arg_mem_obj_params_t type
+/// @brief Print operator for the ur_sampler_create_with_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_arg_mem_obj_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_create_with_native_handle_params_t *params) {
 
-    os << ".hKernel = ";
+    os << ".hNativeSampler = ";
 
-    ur::details::printPtr(os,
-                          *(params->phKernel));
+    ur::details::printPtr(os, reinterpret_cast<void *>(
+                                  *(params->phNativeSampler)));
 
     os << ", ";
-    os << ".argIndex = ";
+    os << ".hContext = ";
 
-    os << *(params->pargIndex);
+    ur::details::printPtr(os,
+                          *(params->phContext));
 
     os << ", ";
     os << ".pProperties = ";
@@ -12095,199 +13429,196 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->ppProperties));
 
     os << ", ";
-    os << ".hArgValue = ";
+    os << ".phSampler = ";
 
     ur::details::printPtr(os,
-                          *(params->phArgValue));
+                          *(params->pphSampler));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_set_specialization_constants_params_t type
+/// @brief Print operator for the ur_mem_image_create_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_specialization_constants_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_image_create_params_t *params) {
 
-    os << ".hKernel = ";
+    os << ".hContext = ";
 
     ur::details::printPtr(os,
-                          *(params->phKernel));
+                          *(params->phContext));
 
     os << ", ";
-    os << ".count = ";
+    os << ".flags = ";
 
-    os << *(params->pcount);
+    ur::details::printFlag<ur_mem_flag_t>(os,
+                                          *(params->pflags));
 
     os << ", ";
-    os << ".pSpecConstants = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppSpecConstants));
-
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_kernel_suggest_max_cooperative_group_count_exp_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t *params) {
-
-    os << ".hKernel = ";
+    os << ".pImageFormat = ";
 
     ur::details::printPtr(os,
-                          *(params->phKernel));
+                          *(params->ppImageFormat));
 
     os << ", ";
-    os << ".localWorkSize = ";
+    os << ".pImageDesc = ";
 
-    os << *(params->plocalWorkSize);
+    ur::details::printPtr(os,
+                          *(params->ppImageDesc));
 
     os << ", ";
-    os << ".dynamicSharedMemorySize = ";
+    os << ".pHost = ";
 
-    os << *(params->pdynamicSharedMemorySize);
+    ur::details::printPtr(os,
+                          *(params->ppHost));
 
     os << ", ";
-    os << ".pGroupCountRet = ";
+    os << ".phMem = ";
 
     ur::details::printPtr(os,
-                          *(params->ppGroupCountRet));
+                          *(params->pphMem));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_queue_get_info_params_t type
+/// @brief Print operator for the ur_mem_buffer_create_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_get_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_buffer_create_params_t *params) {
 
-    os << ".hQueue = ";
+    os << ".hContext = ";
 
     ur::details::printPtr(os,
-                          *(params->phQueue));
+                          *(params->phContext));
 
     os << ", ";
-    os << ".propName = ";
+    os << ".flags = ";
 
-    os << *(params->ppropName);
+    ur::details::printFlag<ur_mem_flag_t>(os,
+                                          *(params->pflags));
 
     os << ", ";
-    os << ".propSize = ";
+    os << ".size = ";
 
-    os << *(params->ppropSize);
+    os << *(params->psize);
 
     os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+    os << ".pProperties = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
 
     os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".phBuffer = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+                          *(params->pphBuffer));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_queue_create_params_t type
+/// @brief Print operator for the ur_mem_retain_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_create_params_t *params) {
-
-    os << ".hContext = ";
-
-    ur::details::printPtr(os,
-                          *(params->phContext));
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_retain_params_t *params) {
 
-    os << ", ";
-    os << ".hDevice = ";
+    os << ".hMem = ";
 
     ur::details::printPtr(os,
-                          *(params->phDevice));
+                          *(params->phMem));
 
-    os << ", ";
-    os << ".pProperties = ";
+    return os;
+}
 
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_mem_release_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_release_params_t *params) {
 
-    os << ", ";
-    os << ".phQueue = ";
+    os << ".hMem = ";
 
     ur::details::printPtr(os,
-                          *(params->pphQueue));
+                          *(params->phMem));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_queue_retain_params_t type
+/// @brief Print operator for the ur_mem_buffer_partition_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_retain_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_buffer_partition_params_t *params) {
 
-    os << ".hQueue = ";
+    os << ".hBuffer = ";
 
     ur::details::printPtr(os,
-                          *(params->phQueue));
+                          *(params->phBuffer));
+
+    os << ", ";
+    os << ".flags = ";
+
+    ur::details::printFlag<ur_mem_flag_t>(os,
+                                          *(params->pflags));
+
+    os << ", ";
+    os << ".bufferCreateType = ";
 
-    return os;
-}
+    os << *(params->pbufferCreateType);
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_queue_release_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_release_params_t *params) {
+    os << ", ";
+    os << ".pRegion = ";
 
-    os << ".hQueue = ";
+    ur::details::printPtr(os,
+                          *(params->ppRegion));
+
+    os << ", ";
+    os << ".phMem = ";
 
     ur::details::printPtr(os,
-                          *(params->phQueue));
+                          *(params->pphMem));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_queue_get_native_handle_params_t type
+/// @brief Print operator for the ur_mem_get_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_get_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_get_native_handle_params_t *params) {
 
-    os << ".hQueue = ";
+    os << ".hMem = ";
 
     ur::details::printPtr(os,
-                          *(params->phQueue));
+                          *(params->phMem));
 
     os << ", ";
-    os << ".pDesc = ";
+    os << ".hDevice = ";
 
     ur::details::printPtr(os,
-                          *(params->ppDesc));
+                          *(params->phDevice));
 
     os << ", ";
-    os << ".phNativeQueue = ";
+    os << ".phNativeMem = ";
 
     ur::details::printPtr(os,
-                          *(params->pphNativeQueue));
+                          *(params->pphNativeMem));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_queue_create_with_native_handle_params_t type
+/// @brief Print operator for the ur_mem_buffer_create_with_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_create_with_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_buffer_create_with_native_handle_params_t *params) {
 
-    os << ".hNativeQueue = ";
+    os << ".hNativeMem = ";
 
     ur::details::printPtr(os, reinterpret_cast<void *>(
-                                  *(params->phNativeQueue)));
+                                  *(params->phNativeMem)));
 
     os << ", ";
     os << ".hContext = ";
@@ -12295,12 +13626,6 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     ur::details::printPtr(os,
                           *(params->phContext));
 
-    os << ", ";
-    os << ".hDevice = ";
-
-    ur::details::printPtr(os,
-                          *(params->phDevice));
-
     os << ", ";
     os << ".pProperties = ";
 
@@ -12308,106 +13633,68 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->ppProperties));
 
     os << ", ";
-    os << ".phQueue = ";
-
-    ur::details::printPtr(os,
-                          *(params->pphQueue));
-
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_queue_finish_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_finish_params_t *params) {
-
-    os << ".hQueue = ";
+    os << ".phMem = ";
 
     ur::details::printPtr(os,
-                          *(params->phQueue));
+                          *(params->pphMem));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_queue_flush_params_t type
+/// @brief Print operator for the ur_mem_image_create_with_native_handle_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_flush_params_t *params) {
-
-    os << ".hQueue = ";
-
-    ur::details::printPtr(os,
-                          *(params->phQueue));
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_image_create_with_native_handle_params_t *params) {
 
-    return os;
-}
+    os << ".hNativeMem = ";
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_sampler_create_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_create_params_t *params) {
+    ur::details::printPtr(os, reinterpret_cast<void *>(
+                                  *(params->phNativeMem)));
 
+    os << ", ";
     os << ".hContext = ";
 
     ur::details::printPtr(os,
                           *(params->phContext));
 
     os << ", ";
-    os << ".pDesc = ";
+    os << ".pImageFormat = ";
 
     ur::details::printPtr(os,
-                          *(params->ppDesc));
+                          *(params->ppImageFormat));
 
     os << ", ";
-    os << ".phSampler = ";
+    os << ".pImageDesc = ";
 
     ur::details::printPtr(os,
-                          *(params->pphSampler));
-
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_sampler_retain_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_retain_params_t *params) {
+                          *(params->ppImageDesc));
 
-    os << ".hSampler = ";
+    os << ", ";
+    os << ".pProperties = ";
 
     ur::details::printPtr(os,
-                          *(params->phSampler));
-
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_sampler_release_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_release_params_t *params) {
+                          *(params->ppProperties));
 
-    os << ".hSampler = ";
+    os << ", ";
+    os << ".phMem = ";
 
     ur::details::printPtr(os,
-                          *(params->phSampler));
+                          *(params->pphMem));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_sampler_get_info_params_t type
+/// @brief Print operator for the ur_mem_get_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_get_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_get_info_params_t *params) {
 
-    os << ".hSampler = ";
+    os << ".hMemory = ";
 
     ur::details::printPtr(os,
-                          *(params->phSampler));
+                          *(params->phMemory));
 
     os << ", ";
     os << ".propName = ";
@@ -12433,62 +13720,44 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_sampler_get_native_handle_params_t type
+/// @brief Print operator for the ur_mem_image_get_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_get_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_image_get_info_params_t *params) {
 
-    os << ".hSampler = ";
+    os << ".hMemory = ";
 
     ur::details::printPtr(os,
-                          *(params->phSampler));
+                          *(params->phMemory));
 
     os << ", ";
-    os << ".phNativeSampler = ";
-
-    ur::details::printPtr(os,
-                          *(params->pphNativeSampler));
-
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_sampler_create_with_native_handle_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_sampler_create_with_native_handle_params_t *params) {
-
-    os << ".hNativeSampler = ";
+    os << ".propName = ";
 
-    ur::details::printPtr(os, reinterpret_cast<void *>(
-                                  *(params->phNativeSampler)));
+    os << *(params->ppropName);
 
     os << ", ";
-    os << ".hContext = ";
+    os << ".propSize = ";
 
-    ur::details::printPtr(os,
-                          *(params->phContext));
+    os << *(params->ppropSize);
 
     os << ", ";
-    os << ".pProperties = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
 
     os << ", ";
-    os << ".phSampler = ";
+    os << ".pPropSizeRet = ";
 
     ur::details::printPtr(os,
-                          *(params->pphSampler));
+                          *(params->ppPropSizeRet));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_mem_image_create_params_t type
+/// @brief Print operator for the ur_physical_mem_create_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_image_create_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_physical_mem_create_params_t *params) {
 
     os << ".hContext = ";
 
@@ -12496,533 +13765,508 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phContext));
 
     os << ", ";
-    os << ".flags = ";
+    os << ".hDevice = ";
 
-    ur::details::printFlag<ur_mem_flag_t>(os,
-                                          *(params->pflags));
+    ur::details::printPtr(os,
+                          *(params->phDevice));
 
     os << ", ";
-    os << ".pImageFormat = ";
+    os << ".size = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppImageFormat));
+    os << *(params->psize);
 
     os << ", ";
-    os << ".pImageDesc = ";
+    os << ".pProperties = ";
 
     ur::details::printPtr(os,
-                          *(params->ppImageDesc));
+                          *(params->ppProperties));
 
     os << ", ";
-    os << ".pHost = ";
+    os << ".phPhysicalMem = ";
 
     ur::details::printPtr(os,
-                          *(params->ppHost));
+                          *(params->pphPhysicalMem));
 
-    os << ", ";
-    os << ".phMem = ";
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_physical_mem_retain_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_physical_mem_retain_params_t *params) {
+
+    os << ".hPhysicalMem = ";
 
     ur::details::printPtr(os,
-                          *(params->pphMem));
+                          *(params->phPhysicalMem));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_mem_buffer_create_params_t type
+/// @brief Print operator for the ur_physical_mem_release_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_buffer_create_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_physical_mem_release_params_t *params) {
 
-    os << ".hContext = ";
+    os << ".hPhysicalMem = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->phPhysicalMem));
 
-    os << ", ";
-    os << ".flags = ";
+    return os;
+}
 
-    ur::details::printFlag<ur_mem_flag_t>(os,
-                                          *(params->pflags));
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_adapter_get_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_adapter_get_params_t *params) {
 
-    os << ", ";
-    os << ".size = ";
+    os << ".NumEntries = ";
 
-    os << *(params->psize);
+    os << *(params->pNumEntries);
 
     os << ", ";
-    os << ".pProperties = ";
+    os << ".phAdapters = {";
+    for (size_t i = 0; *(params->pphAdapters) != NULL && i < *params->pNumEntries; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
+        ur::details::printPtr(os,
+                              (*(params->pphAdapters))[i]);
+    }
+    os << "}";
 
     os << ", ";
-    os << ".phBuffer = ";
+    os << ".pNumAdapters = ";
 
     ur::details::printPtr(os,
-                          *(params->pphBuffer));
+                          *(params->ppNumAdapters));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_mem_retain_params_t type
+/// @brief Print operator for the ur_adapter_release_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_retain_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_adapter_release_params_t *params) {
 
-    os << ".hMem = ";
+    os << ".hAdapter = ";
 
     ur::details::printPtr(os,
-                          *(params->phMem));
+                          *(params->phAdapter));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_mem_release_params_t type
+/// @brief Print operator for the ur_adapter_retain_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_release_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_adapter_retain_params_t *params) {
 
-    os << ".hMem = ";
+    os << ".hAdapter = ";
 
     ur::details::printPtr(os,
-                          *(params->phMem));
+                          *(params->phAdapter));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_mem_buffer_partition_params_t type
+/// @brief Print operator for the ur_adapter_get_last_error_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_buffer_partition_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_adapter_get_last_error_params_t *params) {
 
-    os << ".hBuffer = ";
+    os << ".hAdapter = ";
 
     ur::details::printPtr(os,
-                          *(params->phBuffer));
-
-    os << ", ";
-    os << ".flags = ";
-
-    ur::details::printFlag<ur_mem_flag_t>(os,
-                                          *(params->pflags));
-
-    os << ", ";
-    os << ".bufferCreateType = ";
-
-    os << *(params->pbufferCreateType);
+                          *(params->phAdapter));
 
     os << ", ";
-    os << ".pRegion = ";
+    os << ".ppMessage = ";
 
     ur::details::printPtr(os,
-                          *(params->ppRegion));
+                          *(params->pppMessage));
 
     os << ", ";
-    os << ".phMem = ";
+    os << ".pError = ";
 
     ur::details::printPtr(os,
-                          *(params->pphMem));
+                          *(params->ppError));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_mem_get_native_handle_params_t type
+/// @brief Print operator for the ur_adapter_get_info_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_get_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_adapter_get_info_params_t *params) {
 
-    os << ".hMem = ";
+    os << ".hAdapter = ";
 
     ur::details::printPtr(os,
-                          *(params->phMem));
+                          *(params->phAdapter));
 
     os << ", ";
-    os << ".hDevice = ";
+    os << ".propName = ";
 
-    ur::details::printPtr(os,
-                          *(params->phDevice));
+    os << *(params->ppropName);
 
     os << ", ";
-    os << ".phNativeMem = ";
+    os << ".propSize = ";
+
+    os << *(params->ppropSize);
+
+    os << ", ";
+    os << ".pPropValue = ";
+    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+
+    os << ", ";
+    os << ".pPropSizeRet = ";
 
     ur::details::printPtr(os,
-                          *(params->pphNativeMem));
+                          *(params->ppPropSizeRet));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_mem_buffer_create_with_native_handle_params_t type
+/// @brief Print operator for the ur_enqueue_kernel_launch_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_buffer_create_with_native_handle_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_kernel_launch_params_t *params) {
 
-    os << ".hNativeMem = ";
+    os << ".hQueue = ";
 
-    ur::details::printPtr(os, reinterpret_cast<void *>(
-                                  *(params->phNativeMem)));
+    ur::details::printPtr(os,
+                          *(params->phQueue));
 
     os << ", ";
-    os << ".hContext = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".pProperties = ";
+    os << ".workDim = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
+    os << *(params->pworkDim);
 
     os << ", ";
-    os << ".phMem = ";
+    os << ".pGlobalWorkOffset = ";
 
     ur::details::printPtr(os,
-                          *(params->pphMem));
-
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_mem_image_create_with_native_handle_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_image_create_with_native_handle_params_t *params) {
-
-    os << ".hNativeMem = ";
-
-    ur::details::printPtr(os, reinterpret_cast<void *>(
-                                  *(params->phNativeMem)));
+                          *(params->ppGlobalWorkOffset));
 
     os << ", ";
-    os << ".hContext = ";
+    os << ".pGlobalWorkSize = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->ppGlobalWorkSize));
 
     os << ", ";
-    os << ".pImageFormat = ";
+    os << ".pLocalWorkSize = ";
 
     ur::details::printPtr(os,
-                          *(params->ppImageFormat));
+                          *(params->ppLocalWorkSize));
 
     os << ", ";
-    os << ".pImageDesc = ";
+    os << ".numEventsInWaitList = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppImageDesc));
+    os << *(params->pnumEventsInWaitList);
 
     os << ", ";
-    os << ".pProperties = ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
 
     os << ", ";
-    os << ".phMem = ";
+    os << ".phEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->pphMem));
+                          *(params->pphEvent));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_mem_get_info_params_t type
+/// @brief Print operator for the ur_enqueue_events_wait_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_get_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_events_wait_params_t *params) {
 
-    os << ".hMemory = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phMemory));
+                          *(params->phQueue));
 
     os << ", ";
-    os << ".propName = ";
+    os << ".numEventsInWaitList = ";
 
-    os << *(params->ppropName);
+    os << *(params->pnumEventsInWaitList);
 
     os << ", ";
-    os << ".propSize = ";
-
-    os << *(params->ppropSize);
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
 
     os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".phEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+                          *(params->pphEvent));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_mem_image_get_info_params_t type
+/// @brief Print operator for the ur_enqueue_events_wait_with_barrier_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_mem_image_get_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_events_wait_with_barrier_params_t *params) {
 
-    os << ".hMemory = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phMemory));
+                          *(params->phQueue));
 
     os << ", ";
-    os << ".propName = ";
+    os << ".numEventsInWaitList = ";
 
-    os << *(params->ppropName);
+    os << *(params->pnumEventsInWaitList);
 
     os << ", ";
-    os << ".propSize = ";
-
-    os << *(params->ppropSize);
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
 
     os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".phEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+                          *(params->pphEvent));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_physical_mem_create_params_t type
+/// @brief Print operator for the ur_enqueue_mem_buffer_read_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_physical_mem_create_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_read_params_t *params) {
 
-    os << ".hContext = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phContext));
+                          *(params->phQueue));
 
     os << ", ";
-    os << ".hDevice = ";
+    os << ".hBuffer = ";
 
     ur::details::printPtr(os,
-                          *(params->phDevice));
+                          *(params->phBuffer));
 
     os << ", ";
-    os << ".size = ";
+    os << ".blockingRead = ";
 
-    os << *(params->psize);
+    os << *(params->pblockingRead);
 
     os << ", ";
-    os << ".pProperties = ";
+    os << ".offset = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
+    os << *(params->poffset);
 
     os << ", ";
-    os << ".phPhysicalMem = ";
-
-    ur::details::printPtr(os,
-                          *(params->pphPhysicalMem));
-
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_physical_mem_retain_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_physical_mem_retain_params_t *params) {
-
-    os << ".hPhysicalMem = ";
-
-    ur::details::printPtr(os,
-                          *(params->phPhysicalMem));
-
-    return os;
-}
+    os << ".size = ";
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_physical_mem_release_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_physical_mem_release_params_t *params) {
+    os << *(params->psize);
 
-    os << ".hPhysicalMem = ";
+    os << ", ";
+    os << ".pDst = ";
 
     ur::details::printPtr(os,
-                          *(params->phPhysicalMem));
-
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_adapter_get_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_adapter_get_params_t *params) {
+                          *(params->ppDst));
 
-    os << ".NumEntries = ";
+    os << ", ";
+    os << ".numEventsInWaitList = ";
 
-    os << *(params->pNumEntries);
+    os << *(params->pnumEventsInWaitList);
 
     os << ", ";
-    os << ".phAdapters = {";
-    for (size_t i = 0; *(params->pphAdapters) != NULL && i < *params->pNumEntries; ++i) {
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
         if (i != 0) {
             os << ", ";
         }
 
         ur::details::printPtr(os,
-                              (*(params->pphAdapters))[i]);
+                              (*(params->pphEventWaitList))[i]);
     }
     os << "}";
 
     os << ", ";
-    os << ".pNumAdapters = ";
+    os << ".phEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->ppNumAdapters));
+                          *(params->pphEvent));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_adapter_release_params_t type
+/// @brief Print operator for the ur_enqueue_mem_buffer_write_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_adapter_release_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_write_params_t *params) {
 
-    os << ".hAdapter = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phAdapter));
+                          *(params->phQueue));
 
-    return os;
-}
+    os << ", ";
+    os << ".hBuffer = ";
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_adapter_retain_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_adapter_retain_params_t *params) {
+    ur::details::printPtr(os,
+                          *(params->phBuffer));
 
-    os << ".hAdapter = ";
+    os << ", ";
+    os << ".blockingWrite = ";
 
-    ur::details::printPtr(os,
-                          *(params->phAdapter));
+    os << *(params->pblockingWrite);
 
-    return os;
-}
+    os << ", ";
+    os << ".offset = ";
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_adapter_get_last_error_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_adapter_get_last_error_params_t *params) {
+    os << *(params->poffset);
 
-    os << ".hAdapter = ";
+    os << ", ";
+    os << ".size = ";
 
-    ur::details::printPtr(os,
-                          *(params->phAdapter));
+    os << *(params->psize);
 
     os << ", ";
-    os << ".ppMessage = ";
+    os << ".pSrc = ";
 
     ur::details::printPtr(os,
-                          *(params->pppMessage));
+                          *(params->ppSrc));
 
     os << ", ";
-    os << ".pError = ";
+    os << ".numEventsInWaitList = ";
+
+    os << *(params->pnumEventsInWaitList);
+
+    os << ", ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".phEvent = ";
 
     ur::details::printPtr(os,
-                          *(params->ppError));
+                          *(params->pphEvent));
 
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_adapter_get_info_params_t type
+/// @brief Print operator for the ur_enqueue_mem_buffer_read_rect_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_adapter_get_info_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_read_rect_params_t *params) {
 
-    os << ".hAdapter = ";
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->phAdapter));
+                          *(params->phQueue));
 
     os << ", ";
-    os << ".propName = ";
+    os << ".hBuffer = ";
 
-    os << *(params->ppropName);
+    ur::details::printPtr(os,
+                          *(params->phBuffer));
 
     os << ", ";
-    os << ".propSize = ";
-
-    os << *(params->ppropSize);
+    os << ".blockingRead = ";
 
-    os << ", ";
-    os << ".pPropValue = ";
-    ur::details::printTagged(os, *(params->ppPropValue), *(params->ppropName), *(params->ppropSize));
+    os << *(params->pblockingRead);
 
     os << ", ";
-    os << ".pPropSizeRet = ";
+    os << ".bufferOrigin = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppPropSizeRet));
+    os << *(params->pbufferOrigin);
 
-    return os;
-}
+    os << ", ";
+    os << ".hostOrigin = ";
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_kernel_launch_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_kernel_launch_params_t *params) {
+    os << *(params->phostOrigin);
 
-    os << ".hQueue = ";
+    os << ", ";
+    os << ".region = ";
 
-    ur::details::printPtr(os,
-                          *(params->phQueue));
+    os << *(params->pregion);
 
     os << ", ";
-    os << ".hKernel = ";
+    os << ".bufferRowPitch = ";
 
-    ur::details::printPtr(os,
-                          *(params->phKernel));
+    os << *(params->pbufferRowPitch);
 
     os << ", ";
-    os << ".workDim = ";
+    os << ".bufferSlicePitch = ";
 
-    os << *(params->pworkDim);
+    os << *(params->pbufferSlicePitch);
 
     os << ", ";
-    os << ".pGlobalWorkOffset = ";
+    os << ".hostRowPitch = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppGlobalWorkOffset));
+    os << *(params->phostRowPitch);
 
     os << ", ";
-    os << ".pGlobalWorkSize = ";
+    os << ".hostSlicePitch = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppGlobalWorkSize));
+    os << *(params->phostSlicePitch);
 
     os << ", ";
-    os << ".pLocalWorkSize = ";
+    os << ".pDst = ";
 
     ur::details::printPtr(os,
-                          *(params->ppLocalWorkSize));
+                          *(params->ppDst));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -13051,16 +14295,68 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_events_wait_params_t type
+/// @brief Print operator for the ur_enqueue_mem_buffer_write_rect_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_events_wait_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_write_rect_params_t *params) {
 
     os << ".hQueue = ";
 
     ur::details::printPtr(os,
                           *(params->phQueue));
 
+    os << ", ";
+    os << ".hBuffer = ";
+
+    ur::details::printPtr(os,
+                          *(params->phBuffer));
+
+    os << ", ";
+    os << ".blockingWrite = ";
+
+    os << *(params->pblockingWrite);
+
+    os << ", ";
+    os << ".bufferOrigin = ";
+
+    os << *(params->pbufferOrigin);
+
+    os << ", ";
+    os << ".hostOrigin = ";
+
+    os << *(params->phostOrigin);
+
+    os << ", ";
+    os << ".region = ";
+
+    os << *(params->pregion);
+
+    os << ", ";
+    os << ".bufferRowPitch = ";
+
+    os << *(params->pbufferRowPitch);
+
+    os << ", ";
+    os << ".bufferSlicePitch = ";
+
+    os << *(params->pbufferSlicePitch);
+
+    os << ", ";
+    os << ".hostRowPitch = ";
+
+    os << *(params->phostRowPitch);
+
+    os << ", ";
+    os << ".hostSlicePitch = ";
+
+    os << *(params->phostSlicePitch);
+
+    os << ", ";
+    os << ".pSrc = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppSrc));
+
     os << ", ";
     os << ".numEventsInWaitList = ";
 
@@ -13088,16 +14384,43 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_events_wait_with_barrier_params_t type
+/// @brief Print operator for the ur_enqueue_mem_buffer_copy_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_events_wait_with_barrier_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_copy_params_t *params) {
 
     os << ".hQueue = ";
 
     ur::details::printPtr(os,
                           *(params->phQueue));
 
+    os << ", ";
+    os << ".hBufferSrc = ";
+
+    ur::details::printPtr(os,
+                          *(params->phBufferSrc));
+
+    os << ", ";
+    os << ".hBufferDst = ";
+
+    ur::details::printPtr(os,
+                          *(params->phBufferDst));
+
+    os << ", ";
+    os << ".srcOffset = ";
+
+    os << *(params->psrcOffset);
+
+    os << ", ";
+    os << ".dstOffset = ";
+
+    os << *(params->pdstOffset);
+
+    os << ", ";
+    os << ".size = ";
+
+    os << *(params->psize);
+
     os << ", ";
     os << ".numEventsInWaitList = ";
 
@@ -13124,43 +14447,63 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_buffer_read_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_read_params_t *params) {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_enqueue_mem_buffer_copy_rect_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_copy_rect_params_t *params) {
+
+    os << ".hQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueue));
+
+    os << ", ";
+    os << ".hBufferSrc = ";
+
+    ur::details::printPtr(os,
+                          *(params->phBufferSrc));
+
+    os << ", ";
+    os << ".hBufferDst = ";
+
+    ur::details::printPtr(os,
+                          *(params->phBufferDst));
+
+    os << ", ";
+    os << ".srcOrigin = ";
+
+    os << *(params->psrcOrigin);
 
-    os << ".hQueue = ";
+    os << ", ";
+    os << ".dstOrigin = ";
 
-    ur::details::printPtr(os,
-                          *(params->phQueue));
+    os << *(params->pdstOrigin);
 
     os << ", ";
-    os << ".hBuffer = ";
+    os << ".region = ";
 
-    ur::details::printPtr(os,
-                          *(params->phBuffer));
+    os << *(params->pregion);
 
     os << ", ";
-    os << ".blockingRead = ";
+    os << ".srcRowPitch = ";
 
-    os << *(params->pblockingRead);
+    os << *(params->psrcRowPitch);
 
     os << ", ";
-    os << ".offset = ";
+    os << ".srcSlicePitch = ";
 
-    os << *(params->poffset);
+    os << *(params->psrcSlicePitch);
 
     os << ", ";
-    os << ".size = ";
+    os << ".dstRowPitch = ";
 
-    os << *(params->psize);
+    os << *(params->pdstRowPitch);
 
     os << ", ";
-    os << ".pDst = ";
+    os << ".dstSlicePitch = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppDst));
+    os << *(params->pdstSlicePitch);
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -13189,10 +14532,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_buffer_write_params_t type
+/// @brief Print operator for the ur_enqueue_mem_buffer_fill_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_write_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_fill_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13206,9 +14549,15 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phBuffer));
 
     os << ", ";
-    os << ".blockingWrite = ";
+    os << ".pPattern = ";
 
-    os << *(params->pblockingWrite);
+    ur::details::printPtr(os,
+                          *(params->ppPattern));
+
+    os << ", ";
+    os << ".patternSize = ";
+
+    os << *(params->ppatternSize);
 
     os << ", ";
     os << ".offset = ";
@@ -13220,12 +14569,6 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 
     os << *(params->psize);
 
-    os << ", ";
-    os << ".pSrc = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppSrc));
-
     os << ", ";
     os << ".numEventsInWaitList = ";
 
@@ -13253,10 +14596,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_buffer_read_rect_params_t type
+/// @brief Print operator for the ur_enqueue_mem_image_read_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_read_rect_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_image_read_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13264,10 +14607,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hBuffer = ";
+    os << ".hImage = ";
 
     ur::details::printPtr(os,
-                          *(params->phBuffer));
+                          *(params->phImage));
 
     os << ", ";
     os << ".blockingRead = ";
@@ -13275,14 +14618,9 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << *(params->pblockingRead);
 
     os << ", ";
-    os << ".bufferOrigin = ";
-
-    os << *(params->pbufferOrigin);
-
-    os << ", ";
-    os << ".hostOrigin = ";
+    os << ".origin = ";
 
-    os << *(params->phostOrigin);
+    os << *(params->porigin);
 
     os << ", ";
     os << ".region = ";
@@ -13290,24 +14628,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << *(params->pregion);
 
     os << ", ";
-    os << ".bufferRowPitch = ";
-
-    os << *(params->pbufferRowPitch);
-
-    os << ", ";
-    os << ".bufferSlicePitch = ";
-
-    os << *(params->pbufferSlicePitch);
-
-    os << ", ";
-    os << ".hostRowPitch = ";
+    os << ".rowPitch = ";
 
-    os << *(params->phostRowPitch);
+    os << *(params->prowPitch);
 
     os << ", ";
-    os << ".hostSlicePitch = ";
+    os << ".slicePitch = ";
 
-    os << *(params->phostSlicePitch);
+    os << *(params->pslicePitch);
 
     os << ", ";
     os << ".pDst = ";
@@ -13342,10 +14670,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_buffer_write_rect_params_t type
+/// @brief Print operator for the ur_enqueue_mem_image_write_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_write_rect_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_image_write_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13353,10 +14681,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hBuffer = ";
+    os << ".hImage = ";
 
     ur::details::printPtr(os,
-                          *(params->phBuffer));
+                          *(params->phImage));
 
     os << ", ";
     os << ".blockingWrite = ";
@@ -13364,14 +14692,9 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << *(params->pblockingWrite);
 
     os << ", ";
-    os << ".bufferOrigin = ";
-
-    os << *(params->pbufferOrigin);
-
-    os << ", ";
-    os << ".hostOrigin = ";
+    os << ".origin = ";
 
-    os << *(params->phostOrigin);
+    os << *(params->porigin);
 
     os << ", ";
     os << ".region = ";
@@ -13379,24 +14702,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << *(params->pregion);
 
     os << ", ";
-    os << ".bufferRowPitch = ";
-
-    os << *(params->pbufferRowPitch);
-
-    os << ", ";
-    os << ".bufferSlicePitch = ";
-
-    os << *(params->pbufferSlicePitch);
-
-    os << ", ";
-    os << ".hostRowPitch = ";
+    os << ".rowPitch = ";
 
-    os << *(params->phostRowPitch);
+    os << *(params->prowPitch);
 
     os << ", ";
-    os << ".hostSlicePitch = ";
+    os << ".slicePitch = ";
 
-    os << *(params->phostSlicePitch);
+    os << *(params->pslicePitch);
 
     os << ", ";
     os << ".pSrc = ";
@@ -13431,10 +14744,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_buffer_copy_params_t type
+/// @brief Print operator for the ur_enqueue_mem_image_copy_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_copy_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_image_copy_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13442,31 +14755,31 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hBufferSrc = ";
+    os << ".hImageSrc = ";
 
     ur::details::printPtr(os,
-                          *(params->phBufferSrc));
+                          *(params->phImageSrc));
 
     os << ", ";
-    os << ".hBufferDst = ";
+    os << ".hImageDst = ";
 
     ur::details::printPtr(os,
-                          *(params->phBufferDst));
+                          *(params->phImageDst));
 
     os << ", ";
-    os << ".srcOffset = ";
+    os << ".srcOrigin = ";
 
-    os << *(params->psrcOffset);
+    os << *(params->psrcOrigin);
 
     os << ", ";
-    os << ".dstOffset = ";
+    os << ".dstOrigin = ";
 
-    os << *(params->pdstOffset);
+    os << *(params->pdstOrigin);
 
     os << ", ";
-    os << ".size = ";
+    os << ".region = ";
 
-    os << *(params->psize);
+    os << *(params->pregion);
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -13495,10 +14808,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_buffer_copy_rect_params_t type
+/// @brief Print operator for the ur_enqueue_mem_buffer_map_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_copy_rect_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_map_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13506,51 +14819,31 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hBufferSrc = ";
-
-    ur::details::printPtr(os,
-                          *(params->phBufferSrc));
-
-    os << ", ";
-    os << ".hBufferDst = ";
+    os << ".hBuffer = ";
 
     ur::details::printPtr(os,
-                          *(params->phBufferDst));
-
-    os << ", ";
-    os << ".srcOrigin = ";
-
-    os << *(params->psrcOrigin);
-
-    os << ", ";
-    os << ".dstOrigin = ";
-
-    os << *(params->pdstOrigin);
-
-    os << ", ";
-    os << ".region = ";
-
-    os << *(params->pregion);
+                          *(params->phBuffer));
 
     os << ", ";
-    os << ".srcRowPitch = ";
+    os << ".blockingMap = ";
 
-    os << *(params->psrcRowPitch);
+    os << *(params->pblockingMap);
 
     os << ", ";
-    os << ".srcSlicePitch = ";
+    os << ".mapFlags = ";
 
-    os << *(params->psrcSlicePitch);
+    ur::details::printFlag<ur_map_flag_t>(os,
+                                          *(params->pmapFlags));
 
     os << ", ";
-    os << ".dstRowPitch = ";
+    os << ".offset = ";
 
-    os << *(params->pdstRowPitch);
+    os << *(params->poffset);
 
     os << ", ";
-    os << ".dstSlicePitch = ";
+    os << ".size = ";
 
-    os << *(params->pdstSlicePitch);
+    os << *(params->psize);
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -13575,14 +14868,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     ur::details::printPtr(os,
                           *(params->pphEvent));
 
+    os << ", ";
+    os << ".ppRetMap = ";
+
+    ur::details::printPtr(os,
+                          *(params->pppRetMap));
+
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_buffer_fill_params_t type
+/// @brief Print operator for the ur_enqueue_mem_unmap_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_fill_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_unmap_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13590,31 +14889,16 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hBuffer = ";
+    os << ".hMem = ";
 
     ur::details::printPtr(os,
-                          *(params->phBuffer));
+                          *(params->phMem));
 
     os << ", ";
-    os << ".pPattern = ";
+    os << ".pMappedPtr = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPattern));
-
-    os << ", ";
-    os << ".patternSize = ";
-
-    os << *(params->ppatternSize);
-
-    os << ", ";
-    os << ".offset = ";
-
-    os << *(params->poffset);
-
-    os << ", ";
-    os << ".size = ";
-
-    os << *(params->psize);
+                          *(params->ppMappedPtr));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -13643,10 +14927,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_image_read_params_t type
+/// @brief Print operator for the ur_enqueue_usm_fill_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_image_read_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_fill_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13654,41 +14938,26 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hImage = ";
+    os << ".pMem = ";
 
     ur::details::printPtr(os,
-                          *(params->phImage));
-
-    os << ", ";
-    os << ".blockingRead = ";
-
-    os << *(params->pblockingRead);
-
-    os << ", ";
-    os << ".origin = ";
-
-    os << *(params->porigin);
-
-    os << ", ";
-    os << ".region = ";
-
-    os << *(params->pregion);
+                          *(params->ppMem));
 
     os << ", ";
-    os << ".rowPitch = ";
+    os << ".patternSize = ";
 
-    os << *(params->prowPitch);
+    os << *(params->ppatternSize);
 
     os << ", ";
-    os << ".slicePitch = ";
+    os << ".pPattern = ";
 
-    os << *(params->pslicePitch);
+    ur::details::printPtr(os,
+                          *(params->ppPattern));
 
     os << ", ";
-    os << ".pDst = ";
+    os << ".size = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppDst));
+    os << *(params->psize);
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -13717,10 +14986,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_image_write_params_t type
+/// @brief Print operator for the ur_enqueue_usm_memcpy_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_image_write_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_memcpy_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13728,35 +14997,15 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hImage = ";
-
-    ur::details::printPtr(os,
-                          *(params->phImage));
-
-    os << ", ";
-    os << ".blockingWrite = ";
-
-    os << *(params->pblockingWrite);
-
-    os << ", ";
-    os << ".origin = ";
-
-    os << *(params->porigin);
-
-    os << ", ";
-    os << ".region = ";
-
-    os << *(params->pregion);
-
-    os << ", ";
-    os << ".rowPitch = ";
+    os << ".blocking = ";
 
-    os << *(params->prowPitch);
+    os << *(params->pblocking);
 
     os << ", ";
-    os << ".slicePitch = ";
+    os << ".pDst = ";
 
-    os << *(params->pslicePitch);
+    ur::details::printPtr(os,
+                          *(params->ppDst));
 
     os << ", ";
     os << ".pSrc = ";
@@ -13764,6 +15013,11 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     ur::details::printPtr(os,
                           *(params->ppSrc));
 
+    os << ", ";
+    os << ".size = ";
+
+    os << *(params->psize);
+
     os << ", ";
     os << ".numEventsInWaitList = ";
 
@@ -13791,10 +15045,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_image_copy_params_t type
+/// @brief Print operator for the ur_enqueue_usm_prefetch_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_image_copy_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_prefetch_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13802,31 +15056,21 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hImageSrc = ";
-
-    ur::details::printPtr(os,
-                          *(params->phImageSrc));
-
-    os << ", ";
-    os << ".hImageDst = ";
+    os << ".pMem = ";
 
     ur::details::printPtr(os,
-                          *(params->phImageDst));
-
-    os << ", ";
-    os << ".srcOrigin = ";
-
-    os << *(params->psrcOrigin);
+                          *(params->ppMem));
 
     os << ", ";
-    os << ".dstOrigin = ";
+    os << ".size = ";
 
-    os << *(params->pdstOrigin);
+    os << *(params->psize);
 
     os << ", ";
-    os << ".region = ";
+    os << ".flags = ";
 
-    os << *(params->pregion);
+    ur::details::printFlag<ur_usm_migration_flag_t>(os,
+                                                    *(params->pflags));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -13855,10 +15099,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_buffer_map_params_t type
+/// @brief Print operator for the ur_enqueue_usm_advise_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_map_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_advise_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13866,26 +15110,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hBuffer = ";
+    os << ".pMem = ";
 
     ur::details::printPtr(os,
-                          *(params->phBuffer));
-
-    os << ", ";
-    os << ".blockingMap = ";
-
-    os << *(params->pblockingMap);
-
-    os << ", ";
-    os << ".mapFlags = ";
-
-    ur::details::printFlag<ur_map_flag_t>(os,
-                                          *(params->pmapFlags));
-
-    os << ", ";
-    os << ".offset = ";
-
-    os << *(params->poffset);
+                          *(params->ppMem));
 
     os << ", ";
     os << ".size = ";
@@ -13893,21 +15121,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << *(params->psize);
 
     os << ", ";
-    os << ".numEventsInWaitList = ";
-
-    os << *(params->pnumEventsInWaitList);
-
-    os << ", ";
-    os << ".phEventWaitList = {";
-    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
-        if (i != 0) {
-            os << ", ";
-        }
+    os << ".advice = ";
 
-        ur::details::printPtr(os,
-                              (*(params->pphEventWaitList))[i]);
-    }
-    os << "}";
+    ur::details::printFlag<ur_usm_advice_flag_t>(os,
+                                                 *(params->padvice));
 
     os << ", ";
     os << ".phEvent = ";
@@ -13915,20 +15132,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     ur::details::printPtr(os,
                           *(params->pphEvent));
 
-    os << ", ";
-    os << ".ppRetMap = ";
-
-    ur::details::printPtr(os,
-                          *(params->pppRetMap));
-
     return os;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_mem_unmap_params_t type
+/// @brief Print operator for the ur_enqueue_usm_fill_2d_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_unmap_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_fill_2d_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13936,16 +15147,36 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hMem = ";
+    os << ".pMem = ";
 
     ur::details::printPtr(os,
-                          *(params->phMem));
+                          *(params->ppMem));
 
     os << ", ";
-    os << ".pMappedPtr = ";
+    os << ".pitch = ";
+
+    os << *(params->ppitch);
+
+    os << ", ";
+    os << ".patternSize = ";
+
+    os << *(params->ppatternSize);
+
+    os << ", ";
+    os << ".pPattern = ";
 
     ur::details::printPtr(os,
-                          *(params->ppMappedPtr));
+                          *(params->ppPattern));
+
+    os << ", ";
+    os << ".width = ";
+
+    os << *(params->pwidth);
+
+    os << ", ";
+    os << ".height = ";
+
+    os << *(params->pheight);
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -13974,10 +15205,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_usm_fill_params_t type
+/// @brief Print operator for the ur_enqueue_usm_memcpy_2d_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_fill_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_memcpy_2d_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -13985,26 +15216,41 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".pMem = ";
+    os << ".blocking = ";
+
+    os << *(params->pblocking);
+
+    os << ", ";
+    os << ".pDst = ";
 
     ur::details::printPtr(os,
-                          *(params->ppMem));
+                          *(params->ppDst));
 
     os << ", ";
-    os << ".patternSize = ";
+    os << ".dstPitch = ";
 
-    os << *(params->ppatternSize);
+    os << *(params->pdstPitch);
 
     os << ", ";
-    os << ".pPattern = ";
+    os << ".pSrc = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPattern));
+                          *(params->ppSrc));
 
     os << ", ";
-    os << ".size = ";
+    os << ".srcPitch = ";
 
-    os << *(params->psize);
+    os << *(params->psrcPitch);
+
+    os << ", ";
+    os << ".width = ";
+
+    os << *(params->pwidth);
+
+    os << ", ";
+    os << ".height = ";
+
+    os << *(params->pheight);
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -14033,10 +15279,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_usm_memcpy_params_t type
+/// @brief Print operator for the ur_enqueue_device_global_variable_write_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_memcpy_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_device_global_variable_write_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -14044,26 +15290,37 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".blocking = ";
+    os << ".hProgram = ";
 
-    os << *(params->pblocking);
+    ur::details::printPtr(os,
+                          *(params->phProgram));
 
     os << ", ";
-    os << ".pDst = ";
+    os << ".name = ";
 
     ur::details::printPtr(os,
-                          *(params->ppDst));
+                          *(params->pname));
 
     os << ", ";
-    os << ".pSrc = ";
+    os << ".blockingWrite = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppSrc));
+    os << *(params->pblockingWrite);
 
     os << ", ";
-    os << ".size = ";
+    os << ".count = ";
 
-    os << *(params->psize);
+    os << *(params->pcount);
+
+    os << ", ";
+    os << ".offset = ";
+
+    os << *(params->poffset);
+
+    os << ", ";
+    os << ".pSrc = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppSrc));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -14092,10 +15349,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_usm_prefetch_params_t type
+/// @brief Print operator for the ur_enqueue_device_global_variable_read_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_prefetch_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_device_global_variable_read_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -14103,21 +15360,37 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".pMem = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->ppMem));
+                          *(params->phProgram));
 
     os << ", ";
-    os << ".size = ";
+    os << ".name = ";
 
-    os << *(params->psize);
+    ur::details::printPtr(os,
+                          *(params->pname));
 
     os << ", ";
-    os << ".flags = ";
+    os << ".blockingRead = ";
 
-    ur::details::printFlag<ur_usm_migration_flag_t>(os,
-                                                    *(params->pflags));
+    os << *(params->pblockingRead);
+
+    os << ", ";
+    os << ".count = ";
+
+    os << *(params->pcount);
+
+    os << ", ";
+    os << ".offset = ";
+
+    os << *(params->poffset);
+
+    os << ", ";
+    os << ".pDst = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppDst));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -14146,10 +15419,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_usm_advise_params_t type
+/// @brief Print operator for the ur_enqueue_read_host_pipe_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_advise_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_read_host_pipe_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -14157,10 +15430,27 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".pMem = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->ppMem));
+                          *(params->phProgram));
+
+    os << ", ";
+    os << ".pipe_symbol = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppipe_symbol));
+
+    os << ", ";
+    os << ".blocking = ";
+
+    os << *(params->pblocking);
+
+    os << ", ";
+    os << ".pDst = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppDst));
 
     os << ", ";
     os << ".size = ";
@@ -14168,10 +15458,21 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << *(params->psize);
 
     os << ", ";
-    os << ".advice = ";
+    os << ".numEventsInWaitList = ";
 
-    ur::details::printFlag<ur_usm_advice_flag_t>(os,
-                                                 *(params->padvice));
+    os << *(params->pnumEventsInWaitList);
+
+    os << ", ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
 
     os << ", ";
     os << ".phEvent = ";
@@ -14183,10 +15484,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_usm_fill_2d_params_t type
+/// @brief Print operator for the ur_enqueue_write_host_pipe_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_fill_2d_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_write_host_pipe_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -14194,36 +15495,32 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".pMem = ";
+    os << ".hProgram = ";
 
     ur::details::printPtr(os,
-                          *(params->ppMem));
+                          *(params->phProgram));
 
     os << ", ";
-    os << ".pitch = ";
+    os << ".pipe_symbol = ";
 
-    os << *(params->ppitch);
+    ur::details::printPtr(os,
+                          *(params->ppipe_symbol));
 
     os << ", ";
-    os << ".patternSize = ";
+    os << ".blocking = ";
 
-    os << *(params->ppatternSize);
+    os << *(params->pblocking);
 
     os << ", ";
-    os << ".pPattern = ";
+    os << ".pSrc = ";
 
     ur::details::printPtr(os,
-                          *(params->ppPattern));
-
-    os << ", ";
-    os << ".width = ";
-
-    os << *(params->pwidth);
+                          *(params->ppSrc));
 
     os << ", ";
-    os << ".height = ";
+    os << ".size = ";
 
-    os << *(params->pheight);
+    os << *(params->psize);
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -14252,10 +15549,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_usm_memcpy_2d_params_t type
+/// @brief Print operator for the ur_enqueue_kernel_launch_custom_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_memcpy_2d_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_kernel_launch_custom_exp_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -14263,41 +15560,43 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".blocking = ";
-
-    os << *(params->pblocking);
-
-    os << ", ";
-    os << ".pDst = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->ppDst));
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".dstPitch = ";
+    os << ".workDim = ";
 
-    os << *(params->pdstPitch);
+    os << *(params->pworkDim);
 
     os << ", ";
-    os << ".pSrc = ";
+    os << ".pGlobalWorkSize = ";
 
     ur::details::printPtr(os,
-                          *(params->ppSrc));
+                          *(params->ppGlobalWorkSize));
 
     os << ", ";
-    os << ".srcPitch = ";
+    os << ".pLocalWorkSize = ";
 
-    os << *(params->psrcPitch);
+    ur::details::printPtr(os,
+                          *(params->ppLocalWorkSize));
 
     os << ", ";
-    os << ".width = ";
+    os << ".numPropsInLaunchPropList = ";
 
-    os << *(params->pwidth);
+    os << *(params->pnumPropsInLaunchPropList);
 
     os << ", ";
-    os << ".height = ";
+    os << ".launchPropList = {";
+    for (size_t i = 0; *(params->plaunchPropList) != NULL && i < *params->pnumPropsInLaunchPropList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    os << *(params->pheight);
+        os << (*(params->plaunchPropList))[i];
+    }
+    os << "}";
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -14326,10 +15625,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_device_global_variable_write_params_t type
+/// @brief Print operator for the ur_enqueue_cooperative_kernel_launch_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_device_global_variable_write_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_cooperative_kernel_launch_exp_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -14337,37 +15636,33 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hProgram = ";
-
-    ur::details::printPtr(os,
-                          *(params->phProgram));
-
-    os << ", ";
-    os << ".name = ";
+    os << ".hKernel = ";
 
     ur::details::printPtr(os,
-                          *(params->pname));
+                          *(params->phKernel));
 
     os << ", ";
-    os << ".blockingWrite = ";
+    os << ".workDim = ";
 
-    os << *(params->pblockingWrite);
+    os << *(params->pworkDim);
 
     os << ", ";
-    os << ".count = ";
+    os << ".pGlobalWorkOffset = ";
 
-    os << *(params->pcount);
+    ur::details::printPtr(os,
+                          *(params->ppGlobalWorkOffset));
 
     os << ", ";
-    os << ".offset = ";
+    os << ".pGlobalWorkSize = ";
 
-    os << *(params->poffset);
+    ur::details::printPtr(os,
+                          *(params->ppGlobalWorkSize));
 
     os << ", ";
-    os << ".pSrc = ";
+    os << ".pLocalWorkSize = ";
 
     ur::details::printPtr(os,
-                          *(params->ppSrc));
+                          *(params->ppLocalWorkSize));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -14396,10 +15691,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_device_global_variable_read_params_t type
+/// @brief Print operator for the ur_enqueue_timestamp_recording_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_device_global_variable_read_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_timestamp_recording_exp_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -14407,37 +15702,9 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hProgram = ";
-
-    ur::details::printPtr(os,
-                          *(params->phProgram));
-
-    os << ", ";
-    os << ".name = ";
-
-    ur::details::printPtr(os,
-                          *(params->pname));
-
-    os << ", ";
-    os << ".blockingRead = ";
-
-    os << *(params->pblockingRead);
-
-    os << ", ";
-    os << ".count = ";
-
-    os << *(params->pcount);
-
-    os << ", ";
-    os << ".offset = ";
-
-    os << *(params->poffset);
-
-    os << ", ";
-    os << ".pDst = ";
+    os << ".blocking = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppDst));
+    os << *(params->pblocking);
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -14466,10 +15733,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_read_host_pipe_params_t type
+/// @brief Print operator for the ur_enqueue_native_command_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_read_host_pipe_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_native_command_exp_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -14477,32 +15744,39 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hProgram = ";
+    os << ".pfnNativeEnqueue = ";
 
-    ur::details::printPtr(os,
-                          *(params->phProgram));
+    os << reinterpret_cast<void *>(
+        *(params->ppfnNativeEnqueue));
 
     os << ", ";
-    os << ".pipe_symbol = ";
+    os << ".data = ";
 
     ur::details::printPtr(os,
-                          *(params->ppipe_symbol));
+                          *(params->pdata));
 
     os << ", ";
-    os << ".blocking = ";
+    os << ".numMemsInMemList = ";
 
-    os << *(params->pblocking);
+    os << *(params->pnumMemsInMemList);
 
     os << ", ";
-    os << ".pDst = ";
+    os << ".phMemList = {";
+    for (size_t i = 0; *(params->pphMemList) != NULL && i < *params->pnumMemsInMemList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    ur::details::printPtr(os,
-                          *(params->ppDst));
+        ur::details::printPtr(os,
+                              (*(params->pphMemList))[i]);
+    }
+    os << "}";
 
     os << ", ";
-    os << ".size = ";
+    os << ".pProperties = ";
 
-    os << *(params->psize);
+    ur::details::printPtr(os,
+                          *(params->ppProperties));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -14531,10 +15805,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_write_host_pipe_params_t type
+/// @brief Print operator for the ur_enqueue_usm_device_alloc_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_write_host_pipe_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_device_alloc_exp_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -14542,32 +15816,58 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hProgram = ";
+    os << ".size = ";
 
-    ur::details::printPtr(os,
-                          *(params->phProgram));
+    os << *(params->psize);
 
     os << ", ";
-    os << ".pipe_symbol = ";
+    os << ".numEventsInWaitList = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppipe_symbol));
+    os << *(params->pnumEventsInWaitList);
 
     os << ", ";
-    os << ".blocking = ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    os << *(params->pblocking);
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
 
     os << ", ";
-    os << ".pSrc = ";
+    os << ".ppMem = ";
+
+    ur::details::printPtr(os,
+                          *(params->pppMem));
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_enqueue_usm_free_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_free_exp_params_t *params) {
+
+    os << ".hQueue = ";
 
     ur::details::printPtr(os,
-                          *(params->ppSrc));
+                          *(params->phQueue));
 
     os << ", ";
-    os << ".size = ";
+    os << ".pMem = ";
 
-    os << *(params->psize);
+    ur::details::printPtr(os,
+                          *(params->ppMem));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -14596,10 +15896,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_kernel_launch_custom_exp_params_t type
+/// @brief Print operator for the ur_enqueue_mem_buffer_copy_rect_batch_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_kernel_launch_custom_exp_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_mem_buffer_copy_rect_batch_exp_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -14607,109 +15907,74 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".hKernel = ";
-
-    ur::details::printPtr(os,
-                          *(params->phKernel));
-
-    os << ", ";
-    os << ".workDim = ";
-
-    os << *(params->pworkDim);
-
-    os << ", ";
-    os << ".pGlobalWorkSize = ";
+    os << ".hBufferSrc = ";
 
     ur::details::printPtr(os,
-                          *(params->ppGlobalWorkSize));
+                          *(params->phBufferSrc));
 
     os << ", ";
-    os << ".pLocalWorkSize = ";
+    os << ".hBufferDst = ";
 
     ur::details::printPtr(os,
-                          *(params->ppLocalWorkSize));
+                          *(params->phBufferDst));
 
     os << ", ";
-    os << ".numPropsInLaunchPropList = ";
+    os << ".numRegions = ";
 
-    os << *(params->pnumPropsInLaunchPropList);
+    os << *(params->pnumRegions);
 
     os << ", ";
-    os << ".launchPropList = {";
-    for (size_t i = 0; *(params->plaunchPropList) != NULL && i < *params->pnumPropsInLaunchPropList; ++i) {
+    os << ".pSrcOrigins = {";
+    for (size_t i = 0; *(params->ppSrcOrigins) != NULL && i < *params->pnumRegions; ++i) {
         if (i != 0) {
             os << ", ";
         }
 
-        os << (*(params->plaunchPropList))[i];
+        os << (*(params->ppSrcOrigins))[i];
     }
     os << "}";
 
     os << ", ";
-    os << ".numEventsInWaitList = ";
-
-    os << *(params->pnumEventsInWaitList);
-
-    os << ", ";
-    os << ".phEventWaitList = {";
-    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+    os << ".pDstOrigins = {";
+    for (size_t i = 0; *(params->ppDstOrigins) != NULL && i < *params->pnumRegions; ++i) {
         if (i != 0) {
             os << ", ";
         }
 
-        ur::details::printPtr(os,
-                              (*(params->pphEventWaitList))[i]);
+        os << (*(params->ppDstOrigins))[i];
     }
     os << "}";
 
     os << ", ";
-    os << ".phEvent = ";
-
-    ur::details::printPtr(os,
-                          *(params->pphEvent));
-
-    return os;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_cooperative_kernel_launch_exp_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_cooperative_kernel_launch_exp_params_t *params) {
-
-    os << ".hQueue = ";
-
-    ur::details::printPtr(os,
-                          *(params->phQueue));
-
-    os << ", ";
-    os << ".hKernel = ";
+    os << ".pRegions = {";
+    for (size_t i = 0; *(params->ppRegions) != NULL && i < *params->pnumRegions; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
 
-    ur::details::printPtr(os,
-                          *(params->phKernel));
+        os << (*(params->ppRegions))[i];
+    }
+    os << "}";
 
     os << ", ";
-    os << ".workDim = ";
+    os << ".srcRowPitch = ";
 
-    os << *(params->pworkDim);
+    os << *(params->psrcRowPitch);
 
     os << ", ";
-    os << ".pGlobalWorkOffset = ";
+    os << ".srcSlicePitch = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppGlobalWorkOffset));
+    os << *(params->psrcSlicePitch);
 
     os << ", ";
-    os << ".pGlobalWorkSize = ";
+    os << ".dstRowPitch = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppGlobalWorkSize));
+    os << *(params->pdstRowPitch);
 
     os << ", ";
-    os << ".pLocalWorkSize = ";
+    os << ".dstSlicePitch = ";
 
-    ur::details::printPtr(os,
-                          *(params->ppLocalWorkSize));
+    os << *(params->pdstSlicePitch);
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -14738,10 +16003,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_timestamp_recording_exp_params_t type
+/// @brief Print operator for the ur_enqueue_kernel_launch_batch_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_timestamp_recording_exp_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_kernel_launch_batch_exp_params_t *params) {
 
     os << ".hQueue = ";
 
@@ -14749,9 +16014,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
                           *(params->phQueue));
 
     os << ", ";
-    os << ".blocking = ";
+    os << ".numLaunches = ";
 
-    os << *(params->pblocking);
+    os << *(params->pnumLaunches);
+
+    os << ", ";
+    os << ".pLaunches = {";
+    for (size_t i = 0; *(params->ppLaunches) != NULL && i < *params->pnumLaunches; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        os << (*(params->ppLaunches))[i];
+    }
+    os << "}";
 
     os << ", ";
     os << ".numEventsInWaitList = ";
@@ -14780,51 +16056,16 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_enqueue_native_command_exp_params_t type
+/// @brief Print operator for the ur_enqueue_timestamp_marker_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_native_command_exp_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_timestamp_marker_exp_params_t *params) {
 
     os << ".hQueue = ";
 
     ur::details::printPtr(os,
                           *(params->phQueue));
 
-    os << ", ";
-    os << ".pfnNativeEnqueue = ";
-
-    os << reinterpret_cast<void *>(
-        *(params->ppfnNativeEnqueue));
-
-    os << ", ";
-    os << ".data = ";
-
-    ur::details::printPtr(os,
-                          *(params->pdata));
-
-    os << ", ";
-    os << ".numMemsInMemList = ";
-
-    os << *(params->pnumMemsInMemList);
-
-    os << ", ";
-    os << ".phMemList = {";
-    for (size_t i = 0; *(params->pphMemList) != NULL && i < *params->pnumMemsInMemList; ++i) {
-        if (i != 0) {
-            os << ", ";
-        }
-
-        ur::details::printPtr(os,
-                              (*(params->pphMemList))[i]);
-    }
-    os << "}";
-
-    os << ", ";
-    os << ".pProperties = ";
-
-    ur::details::printPtr(os,
-                          *(params->ppProperties));
-
     os << ", ";
     os << ".numEventsInWaitList = ";
 
@@ -14843,10 +16084,10 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << "}";
 
     os << ", ";
-    os << ".phEvent = ";
+    os << ".pMarker = ";
 
     ur::details::printPtr(os,
-                          *(params->pphEvent));
+                          *(params->ppMarker));
 
     return os;
 }
@@ -15944,6 +17185,112 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_usm_pool_trim_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_usm_pool_trim_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".hPool = ";
+
+    ur::details::printPtr(os,
+                          *(params->phPool));
+
+    os << ", ";
+    os << ".minBytesToKeep = ";
+
+    os << *(params->pminBytesToKeep);
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_usm_growable_alloc_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_usm_growable_alloc_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".hDevice = ";
+
+    ur::details::printPtr(os,
+                          *(params->phDevice));
+
+    os << ", ";
+    os << ".maxSize = ";
+
+    os << *(params->pmaxSize);
+
+    os << ", ";
+    os << ".size = ";
+
+    os << *(params->psize);
+
+    os << ", ";
+    os << ".ppMem = ";
+
+    ur::details::printPtr(os,
+                          *(params->pppMem));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_usm_growable_resize_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_usm_growable_resize_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".pMem = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppMem));
+
+    os << ", ";
+    os << ".size = ";
+
+    os << *(params->psize);
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_usm_growable_free_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_usm_growable_free_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".pMem = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppMem));
+
+    return os;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_command_buffer_create_exp_params_t type
 /// @returns
@@ -17689,6 +19036,12 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_EVENT_SET_CALLBACK: {
         os << (const struct ur_event_set_callback_params_t *)params;
     } break;
+    case UR_FUNCTION_EVENT_WAIT_ANY_EXP: {
+        os << (const struct ur_event_wait_any_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP: {
+        os << (const struct ur_event_get_execution_status_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_PROGRAM_CREATE_WITH_IL: {
         os << (const struct ur_program_create_with_il_params_t *)params;
     } break;
@@ -17791,6 +19144,9 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP: {
         os << (const struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_KERNEL_SET_ARGS_EXP: {
+        os << (const struct ur_kernel_set_args_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_QUEUE_GET_INFO: {
         os << (const struct ur_queue_get_info_params_t *)params;
     } break;
@@ -17815,6 +19171,30 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_QUEUE_FLUSH: {
         os << (const struct ur_queue_flush_params_t *)params;
     } break;
+    case UR_FUNCTION_QUEUE_GROUP_CREATE_EXP: {
+        os << (const struct ur_queue_group_create_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_RETAIN_EXP: {
+        os << (const struct ur_queue_group_retain_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_RELEASE_EXP: {
+        os << (const struct ur_queue_group_release_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_GET_QUEUE_EXP: {
+        os << (const struct ur_queue_group_get_queue_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_FINISH_EXP: {
+        os << (const struct ur_queue_group_finish_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_BARRIER_EXP: {
+        os << (const struct ur_queue_group_barrier_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP: {
+        os << (const struct ur_queue_reserve_timestamp_markers_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP: {
+        os << (const struct ur_queue_read_timestamp_markers_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_SAMPLER_CREATE: {
         os << (const struct ur_sampler_create_params_t *)params;
     } break;
@@ -17974,6 +19354,21 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP: {
         os << (const struct ur_enqueue_native_command_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP: {
+        os << (const struct ur_enqueue_usm_device_alloc_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_FREE_EXP: {
+        os << (const struct ur_enqueue_usm_free_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP: {
+        os << (const struct ur_enqueue_mem_buffer_copy_rect_batch_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP: {
+        os << (const struct ur_enqueue_kernel_launch_batch_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP: {
+        os << (const struct ur_enqueue_timestamp_marker_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP: {
         os << (const struct ur_bindless_images_unsampled_image_handle_destroy_exp_params_t *)params;
     } break;
@@ -18064,6 +19459,18 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_USM_RELEASE_EXP: {
         os << (const struct ur_usm_release_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_USM_POOL_TRIM_EXP: {
+        os << (const struct ur_usm_pool_trim_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_USM_GROWABLE_ALLOC_EXP: {
+        os << (const struct ur_usm_growable_alloc_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_USM_GROWABLE_RESIZE_EXP: {
+        os << (const struct ur_usm_growable_resize_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_USM_GROWABLE_FREE_EXP: {
+        os << (const struct ur_usm_growable_free_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP: {
         os << (const struct ur_command_buffer_create_exp_params_t *)params;
     } break;
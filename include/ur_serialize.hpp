@@ -0,0 +1,8434 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_serialize.hpp
+ * @version v0.11-r0
+ *
+ */
+#ifndef UR_SERIALIZE_HPP
+#define UR_SERIALIZE_HPP 1
+
+#include "ur_print.hpp"
+#include <cstring>
+#include <ostream>
+
+namespace ur::serialize {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urLoaderConfigCreate
+struct ur_loader_config_create_args_t {
+    ur_loader_config_handle_t *phLoaderConfig;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urLoaderConfigRetain
+struct ur_loader_config_retain_args_t {
+    ur_loader_config_handle_t hLoaderConfig;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urLoaderConfigRelease
+struct ur_loader_config_release_args_t {
+    ur_loader_config_handle_t hLoaderConfig;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urLoaderConfigGetInfo
+struct ur_loader_config_get_info_args_t {
+    ur_loader_config_handle_t hLoaderConfig;
+    ur_loader_config_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urLoaderConfigEnableLayer
+struct ur_loader_config_enable_layer_args_t {
+    ur_loader_config_handle_t hLoaderConfig;
+    const char *pLayerName;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urLoaderConfigSetCodeLocationCallback
+struct ur_loader_config_set_code_location_callback_args_t {
+    ur_loader_config_handle_t hLoaderConfig;
+    ur_code_location_callback_t pfnCodeloc;
+    void *pUserData;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urLoaderConfigSetMockingEnabled
+struct ur_loader_config_set_mocking_enabled_args_t {
+    ur_loader_config_handle_t hLoaderConfig;
+    ur_bool_t enable;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urPlatformGet
+struct ur_platform_get_args_t {
+    ur_adapter_handle_t *phAdapters;
+    uint32_t NumAdapters;
+    uint32_t NumEntries;
+    ur_platform_handle_t *phPlatforms;
+    uint32_t *pNumPlatforms;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urPlatformGetInfo
+struct ur_platform_get_info_args_t {
+    ur_platform_handle_t hPlatform;
+    ur_platform_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urPlatformGetNativeHandle
+struct ur_platform_get_native_handle_args_t {
+    ur_platform_handle_t hPlatform;
+    ur_native_handle_t *phNativePlatform;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urPlatformCreateWithNativeHandle
+struct ur_platform_create_with_native_handle_args_t {
+    ur_native_handle_t hNativePlatform;
+    ur_adapter_handle_t hAdapter;
+    const ur_platform_native_properties_t *pProperties;
+    ur_platform_handle_t *phPlatform;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urPlatformGetApiVersion
+struct ur_platform_get_api_version_args_t {
+    ur_platform_handle_t hPlatform;
+    ur_api_version_t *pVersion;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urPlatformGetBackendOption
+struct ur_platform_get_backend_option_args_t {
+    ur_platform_handle_t hPlatform;
+    const char *pFrontendOption;
+    const char **ppPlatformOption;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urContextCreate
+struct ur_context_create_args_t {
+    uint32_t DeviceCount;
+    const ur_device_handle_t *phDevices;
+    const ur_context_properties_t *pProperties;
+    ur_context_handle_t *phContext;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urContextRetain
+struct ur_context_retain_args_t {
+    ur_context_handle_t hContext;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urContextRelease
+struct ur_context_release_args_t {
+    ur_context_handle_t hContext;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urContextGetInfo
+struct ur_context_get_info_args_t {
+    ur_context_handle_t hContext;
+    ur_context_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urContextGetNativeHandle
+struct ur_context_get_native_handle_args_t {
+    ur_context_handle_t hContext;
+    ur_native_handle_t *phNativeContext;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urContextCreateWithNativeHandle
+struct ur_context_create_with_native_handle_args_t {
+    ur_native_handle_t hNativeContext;
+    ur_adapter_handle_t hAdapter;
+    uint32_t numDevices;
+    const ur_device_handle_t *phDevices;
+    const ur_context_native_properties_t *pProperties;
+    ur_context_handle_t *phContext;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urContextSetExtendedDeleter
+struct ur_context_set_extended_deleter_args_t {
+    ur_context_handle_t hContext;
+    ur_context_extended_deleter_t pfnDeleter;
+    void *pUserData;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEventGetInfo
+struct ur_event_get_info_args_t {
+    ur_event_handle_t hEvent;
+    ur_event_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEventGetProfilingInfo
+struct ur_event_get_profiling_info_args_t {
+    ur_event_handle_t hEvent;
+    ur_profiling_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEventWait
+struct ur_event_wait_args_t {
+    uint32_t numEvents;
+    const ur_event_handle_t *phEventWaitList;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEventRetain
+struct ur_event_retain_args_t {
+    ur_event_handle_t hEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEventRelease
+struct ur_event_release_args_t {
+    ur_event_handle_t hEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEventGetNativeHandle
+struct ur_event_get_native_handle_args_t {
+    ur_event_handle_t hEvent;
+    ur_native_handle_t *phNativeEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEventCreateWithNativeHandle
+struct ur_event_create_with_native_handle_args_t {
+    ur_native_handle_t hNativeEvent;
+    ur_context_handle_t hContext;
+    const ur_event_native_properties_t *pProperties;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEventSetCallback
+struct ur_event_set_callback_args_t {
+    ur_event_handle_t hEvent;
+    ur_execution_info_t execStatus;
+    ur_event_callback_t pfnNotify;
+    void *pUserData;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEventWaitAnyExp
+struct ur_event_wait_any_exp_args_t {
+    uint32_t numEvents;
+    const ur_event_handle_t *phEventWaitList;
+    uint32_t *pEventIndex;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEventGetExecutionStatusExp
+struct ur_event_get_execution_status_exp_args_t {
+    uint32_t numEvents;
+    const ur_event_handle_t *phEvents;
+    ur_event_status_t *pStatuses;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramCreateWithIL
+struct ur_program_create_with_il_args_t {
+    ur_context_handle_t hContext;
+    const void *pIL;
+    size_t length;
+    const ur_program_properties_t *pProperties;
+    ur_program_handle_t *phProgram;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramCreateWithBinary
+struct ur_program_create_with_binary_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    size_t size;
+    const uint8_t *pBinary;
+    const ur_program_properties_t *pProperties;
+    ur_program_handle_t *phProgram;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramBuild
+struct ur_program_build_args_t {
+    ur_context_handle_t hContext;
+    ur_program_handle_t hProgram;
+    const char *pOptions;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramBuildExp
+struct ur_program_build_exp_args_t {
+    ur_program_handle_t hProgram;
+    uint32_t numDevices;
+    ur_device_handle_t *phDevices;
+    const char *pOptions;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramCompile
+struct ur_program_compile_args_t {
+    ur_context_handle_t hContext;
+    ur_program_handle_t hProgram;
+    const char *pOptions;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramCompileExp
+struct ur_program_compile_exp_args_t {
+    ur_program_handle_t hProgram;
+    uint32_t numDevices;
+    ur_device_handle_t *phDevices;
+    const char *pOptions;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramLink
+struct ur_program_link_args_t {
+    ur_context_handle_t hContext;
+    uint32_t count;
+    const ur_program_handle_t *phPrograms;
+    const char *pOptions;
+    ur_program_handle_t *phProgram;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramLinkExp
+struct ur_program_link_exp_args_t {
+    ur_context_handle_t hContext;
+    uint32_t numDevices;
+    ur_device_handle_t *phDevices;
+    uint32_t count;
+    const ur_program_handle_t *phPrograms;
+    const char *pOptions;
+    ur_program_handle_t *phProgram;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramRetain
+struct ur_program_retain_args_t {
+    ur_program_handle_t hProgram;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramRelease
+struct ur_program_release_args_t {
+    ur_program_handle_t hProgram;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramGetFunctionPointer
+struct ur_program_get_function_pointer_args_t {
+    ur_device_handle_t hDevice;
+    ur_program_handle_t hProgram;
+    const char *pFunctionName;
+    void **ppFunctionPointer;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramGetGlobalVariablePointer
+struct ur_program_get_global_variable_pointer_args_t {
+    ur_device_handle_t hDevice;
+    ur_program_handle_t hProgram;
+    const char *pGlobalVariableName;
+    size_t *pGlobalVariableSizeRet;
+    void **ppGlobalVariablePointerRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramGetInfo
+struct ur_program_get_info_args_t {
+    ur_program_handle_t hProgram;
+    ur_program_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramGetBuildInfo
+struct ur_program_get_build_info_args_t {
+    ur_program_handle_t hProgram;
+    ur_device_handle_t hDevice;
+    ur_program_build_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramSetSpecializationConstants
+struct ur_program_set_specialization_constants_args_t {
+    ur_program_handle_t hProgram;
+    uint32_t count;
+    const ur_specialization_constant_info_t *pSpecConstants;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramGetNativeHandle
+struct ur_program_get_native_handle_args_t {
+    ur_program_handle_t hProgram;
+    ur_native_handle_t *phNativeProgram;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urProgramCreateWithNativeHandle
+struct ur_program_create_with_native_handle_args_t {
+    ur_native_handle_t hNativeProgram;
+    ur_context_handle_t hContext;
+    const ur_program_native_properties_t *pProperties;
+    ur_program_handle_t *phProgram;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelCreate
+struct ur_kernel_create_args_t {
+    ur_program_handle_t hProgram;
+    const char *pKernelName;
+    ur_kernel_handle_t *phKernel;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelGetInfo
+struct ur_kernel_get_info_args_t {
+    ur_kernel_handle_t hKernel;
+    ur_kernel_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelGetGroupInfo
+struct ur_kernel_get_group_info_args_t {
+    ur_kernel_handle_t hKernel;
+    ur_device_handle_t hDevice;
+    ur_kernel_group_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelGetSubGroupInfo
+struct ur_kernel_get_sub_group_info_args_t {
+    ur_kernel_handle_t hKernel;
+    ur_device_handle_t hDevice;
+    ur_kernel_sub_group_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelRetain
+struct ur_kernel_retain_args_t {
+    ur_kernel_handle_t hKernel;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelRelease
+struct ur_kernel_release_args_t {
+    ur_kernel_handle_t hKernel;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelGetNativeHandle
+struct ur_kernel_get_native_handle_args_t {
+    ur_kernel_handle_t hKernel;
+    ur_native_handle_t *phNativeKernel;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelCreateWithNativeHandle
+struct ur_kernel_create_with_native_handle_args_t {
+    ur_native_handle_t hNativeKernel;
+    ur_context_handle_t hContext;
+    ur_program_handle_t hProgram;
+    const ur_kernel_native_properties_t *pProperties;
+    ur_kernel_handle_t *phKernel;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelGetSuggestedLocalWorkSize
+struct ur_kernel_get_suggested_local_work_size_args_t {
+    ur_kernel_handle_t hKernel;
+    ur_queue_handle_t hQueue;
+    uint32_t numWorkDim;
+    const size_t *pGlobalWorkOffset;
+    const size_t *pGlobalWorkSize;
+    size_t *pSuggestedLocalWorkSize;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelSetArgValue
+struct ur_kernel_set_arg_value_args_t {
+    ur_kernel_handle_t hKernel;
+    uint32_t argIndex;
+    size_t argSize;
+    const ur_kernel_arg_value_properties_t *pProperties;
+    const void *pArgValue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelSetArgLocal
+struct ur_kernel_set_arg_local_args_t {
+    ur_kernel_handle_t hKernel;
+    uint32_t argIndex;
+    size_t argSize;
+    const ur_kernel_arg_local_properties_t *pProperties;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelSetArgPointer
+struct ur_kernel_set_arg_pointer_args_t {
+    ur_kernel_handle_t hKernel;
+    uint32_t argIndex;
+    const ur_kernel_arg_pointer_properties_t *pProperties;
+    const void *pArgValue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelSetExecInfo
+struct ur_kernel_set_exec_info_args_t {
+    ur_kernel_handle_t hKernel;
+    ur_kernel_exec_info_t propName;
+    size_t propSize;
+    const ur_kernel_exec_info_properties_t *pProperties;
+    const void *pPropValue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelSetArgSampler
+struct ur_kernel_set_arg_sampler_args_t {
+    ur_kernel_handle_t hKernel;
+    uint32_t argIndex;
+    const ur_kernel_arg_sampler_properties_t *pProperties;
+    ur_sampler_handle_t hArgValue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelSetArgMemObj
+struct ur_kernel_set_arg_mem_obj_args_t {
+    ur_kernel_handle_t hKernel;
+    uint32_t argIndex;
+    const ur_kernel_arg_mem_obj_properties_t *pProperties;
+    ur_mem_handle_t hArgValue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelSetSpecializationConstants
+struct ur_kernel_set_specialization_constants_args_t {
+    ur_kernel_handle_t hKernel;
+    uint32_t count;
+    const ur_specialization_constant_info_t *pSpecConstants;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelSuggestMaxCooperativeGroupCountExp
+struct ur_kernel_suggest_max_cooperative_group_count_exp_args_t {
+    ur_kernel_handle_t hKernel;
+    size_t localWorkSize;
+    size_t dynamicSharedMemorySize;
+    uint32_t *pGroupCountRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urKernelSetArgsExp
+struct ur_kernel_set_args_exp_args_t {
+    ur_kernel_handle_t hKernel;
+    uint32_t numArgs;
+    const ur_exp_kernel_arg_properties_t *pArgs;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueGetInfo
+struct ur_queue_get_info_args_t {
+    ur_queue_handle_t hQueue;
+    ur_queue_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueCreate
+struct ur_queue_create_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    const ur_queue_properties_t *pProperties;
+    ur_queue_handle_t *phQueue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueRetain
+struct ur_queue_retain_args_t {
+    ur_queue_handle_t hQueue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueRelease
+struct ur_queue_release_args_t {
+    ur_queue_handle_t hQueue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueGetNativeHandle
+struct ur_queue_get_native_handle_args_t {
+    ur_queue_handle_t hQueue;
+    ur_queue_native_desc_t *pDesc;
+    ur_native_handle_t *phNativeQueue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueCreateWithNativeHandle
+struct ur_queue_create_with_native_handle_args_t {
+    ur_native_handle_t hNativeQueue;
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    const ur_queue_native_properties_t *pProperties;
+    ur_queue_handle_t *phQueue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueFinish
+struct ur_queue_finish_args_t {
+    ur_queue_handle_t hQueue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueFlush
+struct ur_queue_flush_args_t {
+    ur_queue_handle_t hQueue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueGroupCreateExp
+struct ur_queue_group_create_exp_args_t {
+    uint32_t numQueues;
+    const ur_queue_handle_t *phQueues;
+    ur_exp_queue_group_handle_t *phQueueGroup;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueGroupRetainExp
+struct ur_queue_group_retain_exp_args_t {
+    ur_exp_queue_group_handle_t hQueueGroup;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueGroupReleaseExp
+struct ur_queue_group_release_exp_args_t {
+    ur_exp_queue_group_handle_t hQueueGroup;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueGroupGetQueueExp
+struct ur_queue_group_get_queue_exp_args_t {
+    ur_exp_queue_group_handle_t hQueueGroup;
+    ur_queue_handle_t *phQueue;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueGroupFinishExp
+struct ur_queue_group_finish_exp_args_t {
+    ur_exp_queue_group_handle_t hQueueGroup;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueGroupBarrierExp
+struct ur_queue_group_barrier_exp_args_t {
+    ur_exp_queue_group_handle_t hQueueGroup;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueReserveTimestampMarkersExp
+struct ur_queue_reserve_timestamp_markers_exp_args_t {
+    ur_queue_handle_t hQueue;
+    uint32_t capacity;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urQueueReadTimestampMarkersExp
+struct ur_queue_read_timestamp_markers_exp_args_t {
+    ur_queue_handle_t hQueue;
+    uint64_t firstMarker;
+    uint32_t count;
+    uint64_t *pTimestamps;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urSamplerCreate
+struct ur_sampler_create_args_t {
+    ur_context_handle_t hContext;
+    const ur_sampler_desc_t *pDesc;
+    ur_sampler_handle_t *phSampler;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urSamplerRetain
+struct ur_sampler_retain_args_t {
+    ur_sampler_handle_t hSampler;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urSamplerRelease
+struct ur_sampler_release_args_t {
+    ur_sampler_handle_t hSampler;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urSamplerGetInfo
+struct ur_sampler_get_info_args_t {
+    ur_sampler_handle_t hSampler;
+    ur_sampler_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urSamplerGetNativeHandle
+struct ur_sampler_get_native_handle_args_t {
+    ur_sampler_handle_t hSampler;
+    ur_native_handle_t *phNativeSampler;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urSamplerCreateWithNativeHandle
+struct ur_sampler_create_with_native_handle_args_t {
+    ur_native_handle_t hNativeSampler;
+    ur_context_handle_t hContext;
+    const ur_sampler_native_properties_t *pProperties;
+    ur_sampler_handle_t *phSampler;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urMemImageCreate
+struct ur_mem_image_create_args_t {
+    ur_context_handle_t hContext;
+    ur_mem_flags_t flags;
+    const ur_image_format_t *pImageFormat;
+    const ur_image_desc_t *pImageDesc;
+    void *pHost;
+    ur_mem_handle_t *phMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urMemBufferCreate
+struct ur_mem_buffer_create_args_t {
+    ur_context_handle_t hContext;
+    ur_mem_flags_t flags;
+    size_t size;
+    const ur_buffer_properties_t *pProperties;
+    ur_mem_handle_t *phBuffer;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urMemRetain
+struct ur_mem_retain_args_t {
+    ur_mem_handle_t hMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urMemRelease
+struct ur_mem_release_args_t {
+    ur_mem_handle_t hMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urMemBufferPartition
+struct ur_mem_buffer_partition_args_t {
+    ur_mem_handle_t hBuffer;
+    ur_mem_flags_t flags;
+    ur_buffer_create_type_t bufferCreateType;
+    const ur_buffer_region_t *pRegion;
+    ur_mem_handle_t *phMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urMemGetNativeHandle
+struct ur_mem_get_native_handle_args_t {
+    ur_mem_handle_t hMem;
+    ur_device_handle_t hDevice;
+    ur_native_handle_t *phNativeMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urMemBufferCreateWithNativeHandle
+struct ur_mem_buffer_create_with_native_handle_args_t {
+    ur_native_handle_t hNativeMem;
+    ur_context_handle_t hContext;
+    const ur_mem_native_properties_t *pProperties;
+    ur_mem_handle_t *phMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urMemImageCreateWithNativeHandle
+struct ur_mem_image_create_with_native_handle_args_t {
+    ur_native_handle_t hNativeMem;
+    ur_context_handle_t hContext;
+    const ur_image_format_t *pImageFormat;
+    const ur_image_desc_t *pImageDesc;
+    const ur_mem_native_properties_t *pProperties;
+    ur_mem_handle_t *phMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urMemGetInfo
+struct ur_mem_get_info_args_t {
+    ur_mem_handle_t hMemory;
+    ur_mem_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urMemImageGetInfo
+struct ur_mem_image_get_info_args_t {
+    ur_mem_handle_t hMemory;
+    ur_image_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urPhysicalMemCreate
+struct ur_physical_mem_create_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    size_t size;
+    const ur_physical_mem_properties_t *pProperties;
+    ur_physical_mem_handle_t *phPhysicalMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urPhysicalMemRetain
+struct ur_physical_mem_retain_args_t {
+    ur_physical_mem_handle_t hPhysicalMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urPhysicalMemRelease
+struct ur_physical_mem_release_args_t {
+    ur_physical_mem_handle_t hPhysicalMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urAdapterGet
+struct ur_adapter_get_args_t {
+    uint32_t NumEntries;
+    ur_adapter_handle_t *phAdapters;
+    uint32_t *pNumAdapters;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urAdapterRelease
+struct ur_adapter_release_args_t {
+    ur_adapter_handle_t hAdapter;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urAdapterRetain
+struct ur_adapter_retain_args_t {
+    ur_adapter_handle_t hAdapter;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urAdapterGetLastError
+struct ur_adapter_get_last_error_args_t {
+    ur_adapter_handle_t hAdapter;
+    const char **ppMessage;
+    int32_t *pError;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urAdapterGetInfo
+struct ur_adapter_get_info_args_t {
+    ur_adapter_handle_t hAdapter;
+    ur_adapter_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueKernelLaunch
+struct ur_enqueue_kernel_launch_args_t {
+    ur_queue_handle_t hQueue;
+    ur_kernel_handle_t hKernel;
+    uint32_t workDim;
+    const size_t *pGlobalWorkOffset;
+    const size_t *pGlobalWorkSize;
+    const size_t *pLocalWorkSize;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueEventsWait
+struct ur_enqueue_events_wait_args_t {
+    ur_queue_handle_t hQueue;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueEventsWaitWithBarrier
+struct ur_enqueue_events_wait_with_barrier_args_t {
+    ur_queue_handle_t hQueue;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemBufferRead
+struct ur_enqueue_mem_buffer_read_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hBuffer;
+    bool blockingRead;
+    size_t offset;
+    size_t size;
+    void *pDst;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemBufferWrite
+struct ur_enqueue_mem_buffer_write_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hBuffer;
+    bool blockingWrite;
+    size_t offset;
+    size_t size;
+    const void *pSrc;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemBufferReadRect
+struct ur_enqueue_mem_buffer_read_rect_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hBuffer;
+    bool blockingRead;
+    ur_rect_offset_t bufferOrigin;
+    ur_rect_offset_t hostOrigin;
+    ur_rect_region_t region;
+    size_t bufferRowPitch;
+    size_t bufferSlicePitch;
+    size_t hostRowPitch;
+    size_t hostSlicePitch;
+    void *pDst;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemBufferWriteRect
+struct ur_enqueue_mem_buffer_write_rect_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hBuffer;
+    bool blockingWrite;
+    ur_rect_offset_t bufferOrigin;
+    ur_rect_offset_t hostOrigin;
+    ur_rect_region_t region;
+    size_t bufferRowPitch;
+    size_t bufferSlicePitch;
+    size_t hostRowPitch;
+    size_t hostSlicePitch;
+    void *pSrc;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemBufferCopy
+struct ur_enqueue_mem_buffer_copy_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hBufferSrc;
+    ur_mem_handle_t hBufferDst;
+    size_t srcOffset;
+    size_t dstOffset;
+    size_t size;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemBufferCopyRect
+struct ur_enqueue_mem_buffer_copy_rect_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hBufferSrc;
+    ur_mem_handle_t hBufferDst;
+    ur_rect_offset_t srcOrigin;
+    ur_rect_offset_t dstOrigin;
+    ur_rect_region_t region;
+    size_t srcRowPitch;
+    size_t srcSlicePitch;
+    size_t dstRowPitch;
+    size_t dstSlicePitch;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemBufferFill
+struct ur_enqueue_mem_buffer_fill_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hBuffer;
+    const void *pPattern;
+    size_t patternSize;
+    size_t offset;
+    size_t size;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemImageRead
+struct ur_enqueue_mem_image_read_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hImage;
+    bool blockingRead;
+    ur_rect_offset_t origin;
+    ur_rect_region_t region;
+    size_t rowPitch;
+    size_t slicePitch;
+    void *pDst;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemImageWrite
+struct ur_enqueue_mem_image_write_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hImage;
+    bool blockingWrite;
+    ur_rect_offset_t origin;
+    ur_rect_region_t region;
+    size_t rowPitch;
+    size_t slicePitch;
+    void *pSrc;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemImageCopy
+struct ur_enqueue_mem_image_copy_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hImageSrc;
+    ur_mem_handle_t hImageDst;
+    ur_rect_offset_t srcOrigin;
+    ur_rect_offset_t dstOrigin;
+    ur_rect_region_t region;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemBufferMap
+struct ur_enqueue_mem_buffer_map_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hBuffer;
+    bool blockingMap;
+    ur_map_flags_t mapFlags;
+    size_t offset;
+    size_t size;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+    void **ppRetMap;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemUnmap
+struct ur_enqueue_mem_unmap_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hMem;
+    void *pMappedPtr;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueUSMFill
+struct ur_enqueue_usm_fill_args_t {
+    ur_queue_handle_t hQueue;
+    void *pMem;
+    size_t patternSize;
+    const void *pPattern;
+    size_t size;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueUSMMemcpy
+struct ur_enqueue_usm_memcpy_args_t {
+    ur_queue_handle_t hQueue;
+    bool blocking;
+    void *pDst;
+    const void *pSrc;
+    size_t size;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueUSMPrefetch
+struct ur_enqueue_usm_prefetch_args_t {
+    ur_queue_handle_t hQueue;
+    const void *pMem;
+    size_t size;
+    ur_usm_migration_flags_t flags;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueUSMAdvise
+struct ur_enqueue_usm_advise_args_t {
+    ur_queue_handle_t hQueue;
+    const void *pMem;
+    size_t size;
+    ur_usm_advice_flags_t advice;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueUSMFill2D
+struct ur_enqueue_usm_fill_2d_args_t {
+    ur_queue_handle_t hQueue;
+    void *pMem;
+    size_t pitch;
+    size_t patternSize;
+    const void *pPattern;
+    size_t width;
+    size_t height;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueUSMMemcpy2D
+struct ur_enqueue_usm_memcpy_2d_args_t {
+    ur_queue_handle_t hQueue;
+    bool blocking;
+    void *pDst;
+    size_t dstPitch;
+    const void *pSrc;
+    size_t srcPitch;
+    size_t width;
+    size_t height;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueDeviceGlobalVariableWrite
+struct ur_enqueue_device_global_variable_write_args_t {
+    ur_queue_handle_t hQueue;
+    ur_program_handle_t hProgram;
+    const char *name;
+    bool blockingWrite;
+    size_t count;
+    size_t offset;
+    const void *pSrc;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueDeviceGlobalVariableRead
+struct ur_enqueue_device_global_variable_read_args_t {
+    ur_queue_handle_t hQueue;
+    ur_program_handle_t hProgram;
+    const char *name;
+    bool blockingRead;
+    size_t count;
+    size_t offset;
+    void *pDst;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueReadHostPipe
+struct ur_enqueue_read_host_pipe_args_t {
+    ur_queue_handle_t hQueue;
+    ur_program_handle_t hProgram;
+    const char *pipe_symbol;
+    bool blocking;
+    void *pDst;
+    size_t size;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueWriteHostPipe
+struct ur_enqueue_write_host_pipe_args_t {
+    ur_queue_handle_t hQueue;
+    ur_program_handle_t hProgram;
+    const char *pipe_symbol;
+    bool blocking;
+    void *pSrc;
+    size_t size;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueKernelLaunchCustomExp
+struct ur_enqueue_kernel_launch_custom_exp_args_t {
+    ur_queue_handle_t hQueue;
+    ur_kernel_handle_t hKernel;
+    uint32_t workDim;
+    const size_t *pGlobalWorkSize;
+    const size_t *pLocalWorkSize;
+    uint32_t numPropsInLaunchPropList;
+    const ur_exp_launch_property_t *launchPropList;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueCooperativeKernelLaunchExp
+struct ur_enqueue_cooperative_kernel_launch_exp_args_t {
+    ur_queue_handle_t hQueue;
+    ur_kernel_handle_t hKernel;
+    uint32_t workDim;
+    const size_t *pGlobalWorkOffset;
+    const size_t *pGlobalWorkSize;
+    const size_t *pLocalWorkSize;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueMemBufferCopyRectBatchExp
+struct ur_enqueue_mem_buffer_copy_rect_batch_exp_args_t {
+    ur_queue_handle_t hQueue;
+    ur_mem_handle_t hBufferSrc;
+    ur_mem_handle_t hBufferDst;
+    uint32_t numRegions;
+    const ur_rect_offset_t *pSrcOrigins;
+    const ur_rect_offset_t *pDstOrigins;
+    const ur_rect_region_t *pRegions;
+    size_t srcRowPitch;
+    size_t srcSlicePitch;
+    size_t dstRowPitch;
+    size_t dstSlicePitch;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueKernelLaunchBatchExp
+struct ur_enqueue_kernel_launch_batch_exp_args_t {
+    ur_queue_handle_t hQueue;
+    uint32_t numLaunches;
+    const ur_exp_kernel_launch_desc_t *pLaunches;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueTimestampRecordingExp
+struct ur_enqueue_timestamp_recording_exp_args_t {
+    ur_queue_handle_t hQueue;
+    bool blocking;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueTimestampMarkerExp
+struct ur_enqueue_timestamp_marker_exp_args_t {
+    ur_queue_handle_t hQueue;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    uint64_t *pMarker;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueUSMDeviceAllocExp
+struct ur_enqueue_usm_device_alloc_exp_args_t {
+    ur_queue_handle_t hQueue;
+    size_t size;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    void **ppMem;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueUSMFreeExp
+struct ur_enqueue_usm_free_exp_args_t {
+    ur_queue_handle_t hQueue;
+    void *pMem;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urEnqueueNativeCommandExp
+struct ur_enqueue_native_command_exp_args_t {
+    ur_queue_handle_t hQueue;
+    ur_exp_enqueue_native_command_function_t pfnNativeEnqueue;
+    void *data;
+    uint32_t numMemsInMemList;
+    const ur_mem_handle_t *phMemList;
+    const ur_exp_enqueue_native_command_properties_t *pProperties;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesUnsampledImageHandleDestroyExp
+struct ur_bindless_images_unsampled_image_handle_destroy_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    ur_exp_image_native_handle_t hImage;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesSampledImageHandleDestroyExp
+struct ur_bindless_images_sampled_image_handle_destroy_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    ur_exp_image_native_handle_t hImage;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesImageAllocateExp
+struct ur_bindless_images_image_allocate_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    const ur_image_format_t *pImageFormat;
+    const ur_image_desc_t *pImageDesc;
+    ur_exp_image_mem_native_handle_t *phImageMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesImageFreeExp
+struct ur_bindless_images_image_free_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    ur_exp_image_mem_native_handle_t hImageMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesUnsampledImageCreateExp
+struct ur_bindless_images_unsampled_image_create_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    ur_exp_image_mem_native_handle_t hImageMem;
+    const ur_image_format_t *pImageFormat;
+    const ur_image_desc_t *pImageDesc;
+    ur_exp_image_native_handle_t *phImage;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesSampledImageCreateExp
+struct ur_bindless_images_sampled_image_create_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    ur_exp_image_mem_native_handle_t hImageMem;
+    const ur_image_format_t *pImageFormat;
+    const ur_image_desc_t *pImageDesc;
+    ur_sampler_handle_t hSampler;
+    ur_exp_image_native_handle_t *phImage;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesImageCopyExp
+struct ur_bindless_images_image_copy_exp_args_t {
+    ur_queue_handle_t hQueue;
+    const void *pSrc;
+    void *pDst;
+    const ur_image_desc_t *pSrcImageDesc;
+    const ur_image_desc_t *pDstImageDesc;
+    const ur_image_format_t *pSrcImageFormat;
+    const ur_image_format_t *pDstImageFormat;
+    ur_exp_image_copy_region_t *pCopyRegion;
+    ur_exp_image_copy_flags_t imageCopyFlags;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesImageGetInfoExp
+struct ur_bindless_images_image_get_info_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_exp_image_mem_native_handle_t hImageMem;
+    ur_image_info_t propName;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesMipmapGetLevelExp
+struct ur_bindless_images_mipmap_get_level_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    ur_exp_image_mem_native_handle_t hImageMem;
+    uint32_t mipmapLevel;
+    ur_exp_image_mem_native_handle_t *phImageMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesMipmapFreeExp
+struct ur_bindless_images_mipmap_free_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    ur_exp_image_mem_native_handle_t hMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesImportExternalMemoryExp
+struct ur_bindless_images_import_external_memory_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    size_t size;
+    ur_exp_external_mem_type_t memHandleType;
+    ur_exp_external_mem_desc_t *pExternalMemDesc;
+    ur_exp_external_mem_handle_t *phExternalMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesMapExternalArrayExp
+struct ur_bindless_images_map_external_array_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    const ur_image_format_t *pImageFormat;
+    const ur_image_desc_t *pImageDesc;
+    ur_exp_external_mem_handle_t hExternalMem;
+    ur_exp_image_mem_native_handle_t *phImageMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesMapExternalLinearMemoryExp
+struct ur_bindless_images_map_external_linear_memory_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    uint64_t offset;
+    uint64_t size;
+    ur_exp_external_mem_handle_t hExternalMem;
+    void **ppRetMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesReleaseExternalMemoryExp
+struct ur_bindless_images_release_external_memory_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    ur_exp_external_mem_handle_t hExternalMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesImportExternalSemaphoreExp
+struct ur_bindless_images_import_external_semaphore_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    ur_exp_external_semaphore_type_t semHandleType;
+    ur_exp_external_semaphore_desc_t *pExternalSemaphoreDesc;
+    ur_exp_external_semaphore_handle_t *phExternalSemaphore;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesReleaseExternalSemaphoreExp
+struct ur_bindless_images_release_external_semaphore_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    ur_exp_external_semaphore_handle_t hExternalSemaphore;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesWaitExternalSemaphoreExp
+struct ur_bindless_images_wait_external_semaphore_exp_args_t {
+    ur_queue_handle_t hQueue;
+    ur_exp_external_semaphore_handle_t hSemaphore;
+    bool hasWaitValue;
+    uint64_t waitValue;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urBindlessImagesSignalExternalSemaphoreExp
+struct ur_bindless_images_signal_external_semaphore_exp_args_t {
+    ur_queue_handle_t hQueue;
+    ur_exp_external_semaphore_handle_t hSemaphore;
+    bool hasSignalValue;
+    uint64_t signalValue;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMHostAlloc
+struct ur_usm_host_alloc_args_t {
+    ur_context_handle_t hContext;
+    const ur_usm_desc_t *pUSMDesc;
+    ur_usm_pool_handle_t pool;
+    size_t size;
+    void **ppMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMDeviceAlloc
+struct ur_usm_device_alloc_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    const ur_usm_desc_t *pUSMDesc;
+    ur_usm_pool_handle_t pool;
+    size_t size;
+    void **ppMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMSharedAlloc
+struct ur_usm_shared_alloc_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    const ur_usm_desc_t *pUSMDesc;
+    ur_usm_pool_handle_t pool;
+    size_t size;
+    void **ppMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMFree
+struct ur_usm_free_args_t {
+    ur_context_handle_t hContext;
+    void *pMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMGetMemAllocInfo
+struct ur_usm_get_mem_alloc_info_args_t {
+    ur_context_handle_t hContext;
+    const void *pMem;
+    ur_usm_alloc_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMPoolCreate
+struct ur_usm_pool_create_args_t {
+    ur_context_handle_t hContext;
+    ur_usm_pool_desc_t *pPoolDesc;
+    ur_usm_pool_handle_t *ppPool;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMPoolRetain
+struct ur_usm_pool_retain_args_t {
+    ur_usm_pool_handle_t pPool;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMPoolRelease
+struct ur_usm_pool_release_args_t {
+    ur_usm_pool_handle_t pPool;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMPoolGetInfo
+struct ur_usm_pool_get_info_args_t {
+    ur_usm_pool_handle_t hPool;
+    ur_usm_pool_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMPitchedAllocExp
+struct ur_usm_pitched_alloc_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    const ur_usm_desc_t *pUSMDesc;
+    ur_usm_pool_handle_t pool;
+    size_t widthInBytes;
+    size_t height;
+    size_t elementSizeBytes;
+    void **ppMem;
+    size_t *pResultPitch;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMGrowableAllocExp
+struct ur_usm_growable_alloc_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    size_t maxSize;
+    size_t size;
+    void **ppMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMGrowableResizeExp
+struct ur_usm_growable_resize_exp_args_t {
+    ur_context_handle_t hContext;
+    void *pMem;
+    size_t size;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMGrowableFreeExp
+struct ur_usm_growable_free_exp_args_t {
+    ur_context_handle_t hContext;
+    void *pMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMImportExp
+struct ur_usm_import_exp_args_t {
+    ur_context_handle_t hContext;
+    void *pMem;
+    size_t size;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMReleaseExp
+struct ur_usm_release_exp_args_t {
+    ur_context_handle_t hContext;
+    void *pMem;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUSMPoolTrimExp
+struct ur_usm_pool_trim_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_usm_pool_handle_t hPool;
+    size_t minBytesToKeep;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferCreateExp
+struct ur_command_buffer_create_exp_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    const ur_exp_command_buffer_desc_t *pCommandBufferDesc;
+    ur_exp_command_buffer_handle_t *phCommandBuffer;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferRetainExp
+struct ur_command_buffer_retain_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferReleaseExp
+struct ur_command_buffer_release_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferFinalizeExp
+struct ur_command_buffer_finalize_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendKernelLaunchExp
+struct ur_command_buffer_append_kernel_launch_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    ur_kernel_handle_t hKernel;
+    uint32_t workDim;
+    const size_t *pGlobalWorkOffset;
+    const size_t *pGlobalWorkSize;
+    const size_t *pLocalWorkSize;
+    uint32_t numKernelAlternatives;
+    ur_kernel_handle_t *phKernelAlternatives;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+    ur_exp_command_buffer_command_handle_t *phCommand;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendUSMMemcpyExp
+struct ur_command_buffer_append_usm_memcpy_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    void *pDst;
+    const void *pSrc;
+    size_t size;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendUSMFillExp
+struct ur_command_buffer_append_usm_fill_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    void *pMemory;
+    const void *pPattern;
+    size_t patternSize;
+    size_t size;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendMemBufferCopyExp
+struct ur_command_buffer_append_mem_buffer_copy_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    ur_mem_handle_t hSrcMem;
+    ur_mem_handle_t hDstMem;
+    size_t srcOffset;
+    size_t dstOffset;
+    size_t size;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendMemBufferWriteExp
+struct ur_command_buffer_append_mem_buffer_write_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    ur_mem_handle_t hBuffer;
+    size_t offset;
+    size_t size;
+    const void *pSrc;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendMemBufferReadExp
+struct ur_command_buffer_append_mem_buffer_read_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    ur_mem_handle_t hBuffer;
+    size_t offset;
+    size_t size;
+    void *pDst;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendMemBufferCopyRectExp
+struct ur_command_buffer_append_mem_buffer_copy_rect_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    ur_mem_handle_t hSrcMem;
+    ur_mem_handle_t hDstMem;
+    ur_rect_offset_t srcOrigin;
+    ur_rect_offset_t dstOrigin;
+    ur_rect_region_t region;
+    size_t srcRowPitch;
+    size_t srcSlicePitch;
+    size_t dstRowPitch;
+    size_t dstSlicePitch;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendMemBufferWriteRectExp
+struct ur_command_buffer_append_mem_buffer_write_rect_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    ur_mem_handle_t hBuffer;
+    ur_rect_offset_t bufferOffset;
+    ur_rect_offset_t hostOffset;
+    ur_rect_region_t region;
+    size_t bufferRowPitch;
+    size_t bufferSlicePitch;
+    size_t hostRowPitch;
+    size_t hostSlicePitch;
+    void *pSrc;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendMemBufferReadRectExp
+struct ur_command_buffer_append_mem_buffer_read_rect_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    ur_mem_handle_t hBuffer;
+    ur_rect_offset_t bufferOffset;
+    ur_rect_offset_t hostOffset;
+    ur_rect_region_t region;
+    size_t bufferRowPitch;
+    size_t bufferSlicePitch;
+    size_t hostRowPitch;
+    size_t hostSlicePitch;
+    void *pDst;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendMemBufferFillExp
+struct ur_command_buffer_append_mem_buffer_fill_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    ur_mem_handle_t hBuffer;
+    const void *pPattern;
+    size_t patternSize;
+    size_t offset;
+    size_t size;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendUSMPrefetchExp
+struct ur_command_buffer_append_usm_prefetch_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    const void *pMemory;
+    size_t size;
+    ur_usm_migration_flags_t flags;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferAppendUSMAdviseExp
+struct ur_command_buffer_append_usm_advise_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    const void *pMemory;
+    size_t size;
+    ur_usm_advice_flags_t advice;
+    uint32_t numSyncPointsInWaitList;
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList;
+    ur_exp_command_buffer_sync_point_t *pSyncPoint;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferEnqueueExp
+struct ur_command_buffer_enqueue_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    ur_queue_handle_t hQueue;
+    uint32_t numEventsInWaitList;
+    const ur_event_handle_t *phEventWaitList;
+    ur_event_handle_t *phEvent;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferRetainCommandExp
+struct ur_command_buffer_retain_command_exp_args_t {
+    ur_exp_command_buffer_command_handle_t hCommand;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferReleaseCommandExp
+struct ur_command_buffer_release_command_exp_args_t {
+    ur_exp_command_buffer_command_handle_t hCommand;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferUpdateKernelLaunchExp
+struct ur_command_buffer_update_kernel_launch_exp_args_t {
+    ur_exp_command_buffer_command_handle_t hCommand;
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *pUpdateKernelLaunch;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferGetInfoExp
+struct ur_command_buffer_get_info_exp_args_t {
+    ur_exp_command_buffer_handle_t hCommandBuffer;
+    ur_exp_command_buffer_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urCommandBufferCommandGetInfoExp
+struct ur_command_buffer_command_get_info_exp_args_t {
+    ur_exp_command_buffer_command_handle_t hCommand;
+    ur_exp_command_buffer_command_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUsmP2PEnablePeerAccessExp
+struct ur_usm_p2p_enable_peer_access_exp_args_t {
+    ur_device_handle_t commandDevice;
+    ur_device_handle_t peerDevice;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUsmP2PDisablePeerAccessExp
+struct ur_usm_p2p_disable_peer_access_exp_args_t {
+    ur_device_handle_t commandDevice;
+    ur_device_handle_t peerDevice;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urUsmP2PPeerAccessGetInfoExp
+struct ur_usm_p2p_peer_access_get_info_exp_args_t {
+    ur_device_handle_t commandDevice;
+    ur_device_handle_t peerDevice;
+    ur_exp_peer_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urLoaderInit
+struct ur_loader_init_args_t {
+    ur_device_init_flags_t device_flags;
+    ur_loader_config_handle_t hLoaderConfig;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urLoaderTearDown
+struct ur_loader_tear_down_args_t {
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urVirtualMemGranularityGetInfo
+struct ur_virtual_mem_granularity_get_info_args_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    ur_virtual_mem_granularity_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urVirtualMemReserve
+struct ur_virtual_mem_reserve_args_t {
+    ur_context_handle_t hContext;
+    const void *pStart;
+    size_t size;
+    void **ppStart;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urVirtualMemFree
+struct ur_virtual_mem_free_args_t {
+    ur_context_handle_t hContext;
+    const void *pStart;
+    size_t size;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urVirtualMemMap
+struct ur_virtual_mem_map_args_t {
+    ur_context_handle_t hContext;
+    const void *pStart;
+    size_t size;
+    ur_physical_mem_handle_t hPhysicalMem;
+    size_t offset;
+    ur_virtual_mem_access_flags_t flags;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urVirtualMemUnmap
+struct ur_virtual_mem_unmap_args_t {
+    ur_context_handle_t hContext;
+    const void *pStart;
+    size_t size;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urVirtualMemSetAccess
+struct ur_virtual_mem_set_access_args_t {
+    ur_context_handle_t hContext;
+    const void *pStart;
+    size_t size;
+    ur_virtual_mem_access_flags_t flags;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urVirtualMemGetInfo
+struct ur_virtual_mem_get_info_args_t {
+    ur_context_handle_t hContext;
+    const void *pStart;
+    size_t size;
+    ur_virtual_mem_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urDeviceGet
+struct ur_device_get_args_t {
+    ur_platform_handle_t hPlatform;
+    ur_device_type_t DeviceType;
+    uint32_t NumEntries;
+    ur_device_handle_t *phDevices;
+    uint32_t *pNumDevices;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urDeviceGetSelected
+struct ur_device_get_selected_args_t {
+    ur_platform_handle_t hPlatform;
+    ur_device_type_t DeviceType;
+    uint32_t NumEntries;
+    ur_device_handle_t *phDevices;
+    uint32_t *pNumDevices;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urDeviceGetInfo
+struct ur_device_get_info_args_t {
+    ur_device_handle_t hDevice;
+    ur_device_info_t propName;
+    size_t propSize;
+    void *pPropValue;
+    size_t *pPropSizeRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urDeviceRetain
+struct ur_device_retain_args_t {
+    ur_device_handle_t hDevice;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urDeviceRelease
+struct ur_device_release_args_t {
+    ur_device_handle_t hDevice;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urDevicePartition
+struct ur_device_partition_args_t {
+    ur_device_handle_t hDevice;
+    const ur_device_partition_properties_t *pProperties;
+    uint32_t NumDevices;
+    ur_device_handle_t *phSubDevices;
+    uint32_t *pNumDevicesRet;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urDeviceSelectBinary
+struct ur_device_select_binary_args_t {
+    ur_device_handle_t hDevice;
+    const ur_device_binary_t *pBinaries;
+    uint32_t NumBinaries;
+    uint32_t *pSelectedBinary;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urDeviceGetNativeHandle
+struct ur_device_get_native_handle_args_t {
+    ur_device_handle_t hDevice;
+    ur_native_handle_t *phNativeDevice;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urDeviceCreateWithNativeHandle
+struct ur_device_create_with_native_handle_args_t {
+    ur_native_handle_t hNativeDevice;
+    ur_adapter_handle_t hAdapter;
+    const ur_device_native_properties_t *pProperties;
+    ur_device_handle_t *phDevice;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of urDeviceGetGlobalTimestamps
+struct ur_device_get_global_timestamps_args_t {
+    ur_device_handle_t hDevice;
+    uint64_t *pDeviceTimestamp;
+    uint64_t *pHostTimestamp;
+};
+} // namespace ur::serialize
+
+namespace ur::extras {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get the size of the serialized parameters of a function
+/// @returns
+///     The size in bytes, or 0 if the function is unknown
+inline size_t UR_APICALL getSerializedFunctionParamsSize(ur_function_t function) {
+    switch (function) {
+    case UR_FUNCTION_LOADER_CONFIG_CREATE:
+        return sizeof(ur::serialize::ur_loader_config_create_args_t);
+    case UR_FUNCTION_LOADER_CONFIG_RETAIN:
+        return sizeof(ur::serialize::ur_loader_config_retain_args_t);
+    case UR_FUNCTION_LOADER_CONFIG_RELEASE:
+        return sizeof(ur::serialize::ur_loader_config_release_args_t);
+    case UR_FUNCTION_LOADER_CONFIG_GET_INFO:
+        return sizeof(ur::serialize::ur_loader_config_get_info_args_t);
+    case UR_FUNCTION_LOADER_CONFIG_ENABLE_LAYER:
+        return sizeof(ur::serialize::ur_loader_config_enable_layer_args_t);
+    case UR_FUNCTION_LOADER_CONFIG_SET_CODE_LOCATION_CALLBACK:
+        return sizeof(ur::serialize::ur_loader_config_set_code_location_callback_args_t);
+    case UR_FUNCTION_LOADER_CONFIG_SET_MOCKING_ENABLED:
+        return sizeof(ur::serialize::ur_loader_config_set_mocking_enabled_args_t);
+    case UR_FUNCTION_PLATFORM_GET:
+        return sizeof(ur::serialize::ur_platform_get_args_t);
+    case UR_FUNCTION_PLATFORM_GET_INFO:
+        return sizeof(ur::serialize::ur_platform_get_info_args_t);
+    case UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_platform_get_native_handle_args_t);
+    case UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_platform_create_with_native_handle_args_t);
+    case UR_FUNCTION_PLATFORM_GET_API_VERSION:
+        return sizeof(ur::serialize::ur_platform_get_api_version_args_t);
+    case UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION:
+        return sizeof(ur::serialize::ur_platform_get_backend_option_args_t);
+    case UR_FUNCTION_CONTEXT_CREATE:
+        return sizeof(ur::serialize::ur_context_create_args_t);
+    case UR_FUNCTION_CONTEXT_RETAIN:
+        return sizeof(ur::serialize::ur_context_retain_args_t);
+    case UR_FUNCTION_CONTEXT_RELEASE:
+        return sizeof(ur::serialize::ur_context_release_args_t);
+    case UR_FUNCTION_CONTEXT_GET_INFO:
+        return sizeof(ur::serialize::ur_context_get_info_args_t);
+    case UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_context_get_native_handle_args_t);
+    case UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_context_create_with_native_handle_args_t);
+    case UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER:
+        return sizeof(ur::serialize::ur_context_set_extended_deleter_args_t);
+    case UR_FUNCTION_EVENT_GET_INFO:
+        return sizeof(ur::serialize::ur_event_get_info_args_t);
+    case UR_FUNCTION_EVENT_GET_PROFILING_INFO:
+        return sizeof(ur::serialize::ur_event_get_profiling_info_args_t);
+    case UR_FUNCTION_EVENT_WAIT:
+        return sizeof(ur::serialize::ur_event_wait_args_t);
+    case UR_FUNCTION_EVENT_RETAIN:
+        return sizeof(ur::serialize::ur_event_retain_args_t);
+    case UR_FUNCTION_EVENT_RELEASE:
+        return sizeof(ur::serialize::ur_event_release_args_t);
+    case UR_FUNCTION_EVENT_GET_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_event_get_native_handle_args_t);
+    case UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_event_create_with_native_handle_args_t);
+    case UR_FUNCTION_EVENT_SET_CALLBACK:
+        return sizeof(ur::serialize::ur_event_set_callback_args_t);
+    case UR_FUNCTION_EVENT_WAIT_ANY_EXP:
+        return sizeof(ur::serialize::ur_event_wait_any_exp_args_t);
+    case UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP:
+        return sizeof(ur::serialize::ur_event_get_execution_status_exp_args_t);
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_IL:
+        return sizeof(ur::serialize::ur_program_create_with_il_args_t);
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY:
+        return sizeof(ur::serialize::ur_program_create_with_binary_args_t);
+    case UR_FUNCTION_PROGRAM_BUILD:
+        return sizeof(ur::serialize::ur_program_build_args_t);
+    case UR_FUNCTION_PROGRAM_BUILD_EXP:
+        return sizeof(ur::serialize::ur_program_build_exp_args_t);
+    case UR_FUNCTION_PROGRAM_COMPILE:
+        return sizeof(ur::serialize::ur_program_compile_args_t);
+    case UR_FUNCTION_PROGRAM_COMPILE_EXP:
+        return sizeof(ur::serialize::ur_program_compile_exp_args_t);
+    case UR_FUNCTION_PROGRAM_LINK:
+        return sizeof(ur::serialize::ur_program_link_args_t);
+    case UR_FUNCTION_PROGRAM_LINK_EXP:
+        return sizeof(ur::serialize::ur_program_link_exp_args_t);
+    case UR_FUNCTION_PROGRAM_RETAIN:
+        return sizeof(ur::serialize::ur_program_retain_args_t);
+    case UR_FUNCTION_PROGRAM_RELEASE:
+        return sizeof(ur::serialize::ur_program_release_args_t);
+    case UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER:
+        return sizeof(ur::serialize::ur_program_get_function_pointer_args_t);
+    case UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER:
+        return sizeof(ur::serialize::ur_program_get_global_variable_pointer_args_t);
+    case UR_FUNCTION_PROGRAM_GET_INFO:
+        return sizeof(ur::serialize::ur_program_get_info_args_t);
+    case UR_FUNCTION_PROGRAM_GET_BUILD_INFO:
+        return sizeof(ur::serialize::ur_program_get_build_info_args_t);
+    case UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS:
+        return sizeof(ur::serialize::ur_program_set_specialization_constants_args_t);
+    case UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_program_get_native_handle_args_t);
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_program_create_with_native_handle_args_t);
+    case UR_FUNCTION_KERNEL_CREATE:
+        return sizeof(ur::serialize::ur_kernel_create_args_t);
+    case UR_FUNCTION_KERNEL_GET_INFO:
+        return sizeof(ur::serialize::ur_kernel_get_info_args_t);
+    case UR_FUNCTION_KERNEL_GET_GROUP_INFO:
+        return sizeof(ur::serialize::ur_kernel_get_group_info_args_t);
+    case UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO:
+        return sizeof(ur::serialize::ur_kernel_get_sub_group_info_args_t);
+    case UR_FUNCTION_KERNEL_RETAIN:
+        return sizeof(ur::serialize::ur_kernel_retain_args_t);
+    case UR_FUNCTION_KERNEL_RELEASE:
+        return sizeof(ur::serialize::ur_kernel_release_args_t);
+    case UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_kernel_get_native_handle_args_t);
+    case UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_kernel_create_with_native_handle_args_t);
+    case UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE:
+        return sizeof(ur::serialize::ur_kernel_get_suggested_local_work_size_args_t);
+    case UR_FUNCTION_KERNEL_SET_ARG_VALUE:
+        return sizeof(ur::serialize::ur_kernel_set_arg_value_args_t);
+    case UR_FUNCTION_KERNEL_SET_ARG_LOCAL:
+        return sizeof(ur::serialize::ur_kernel_set_arg_local_args_t);
+    case UR_FUNCTION_KERNEL_SET_ARG_POINTER:
+        return sizeof(ur::serialize::ur_kernel_set_arg_pointer_args_t);
+    case UR_FUNCTION_KERNEL_SET_EXEC_INFO:
+        return sizeof(ur::serialize::ur_kernel_set_exec_info_args_t);
+    case UR_FUNCTION_KERNEL_SET_ARG_SAMPLER:
+        return sizeof(ur::serialize::ur_kernel_set_arg_sampler_args_t);
+    case UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ:
+        return sizeof(ur::serialize::ur_kernel_set_arg_mem_obj_args_t);
+    case UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS:
+        return sizeof(ur::serialize::ur_kernel_set_specialization_constants_args_t);
+    case UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP:
+        return sizeof(ur::serialize::ur_kernel_suggest_max_cooperative_group_count_exp_args_t);
+    case UR_FUNCTION_KERNEL_SET_ARGS_EXP:
+        return sizeof(ur::serialize::ur_kernel_set_args_exp_args_t);
+    case UR_FUNCTION_QUEUE_GET_INFO:
+        return sizeof(ur::serialize::ur_queue_get_info_args_t);
+    case UR_FUNCTION_QUEUE_CREATE:
+        return sizeof(ur::serialize::ur_queue_create_args_t);
+    case UR_FUNCTION_QUEUE_RETAIN:
+        return sizeof(ur::serialize::ur_queue_retain_args_t);
+    case UR_FUNCTION_QUEUE_RELEASE:
+        return sizeof(ur::serialize::ur_queue_release_args_t);
+    case UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_queue_get_native_handle_args_t);
+    case UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_queue_create_with_native_handle_args_t);
+    case UR_FUNCTION_QUEUE_FINISH:
+        return sizeof(ur::serialize::ur_queue_finish_args_t);
+    case UR_FUNCTION_QUEUE_FLUSH:
+        return sizeof(ur::serialize::ur_queue_flush_args_t);
+    case UR_FUNCTION_QUEUE_GROUP_CREATE_EXP:
+        return sizeof(ur::serialize::ur_queue_group_create_exp_args_t);
+    case UR_FUNCTION_QUEUE_GROUP_RETAIN_EXP:
+        return sizeof(ur::serialize::ur_queue_group_retain_exp_args_t);
+    case UR_FUNCTION_QUEUE_GROUP_RELEASE_EXP:
+        return sizeof(ur::serialize::ur_queue_group_release_exp_args_t);
+    case UR_FUNCTION_QUEUE_GROUP_GET_QUEUE_EXP:
+        return sizeof(ur::serialize::ur_queue_group_get_queue_exp_args_t);
+    case UR_FUNCTION_QUEUE_GROUP_FINISH_EXP:
+        return sizeof(ur::serialize::ur_queue_group_finish_exp_args_t);
+    case UR_FUNCTION_QUEUE_GROUP_BARRIER_EXP:
+        return sizeof(ur::serialize::ur_queue_group_barrier_exp_args_t);
+    case UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP:
+        return sizeof(ur::serialize::ur_queue_reserve_timestamp_markers_exp_args_t);
+    case UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP:
+        return sizeof(ur::serialize::ur_queue_read_timestamp_markers_exp_args_t);
+    case UR_FUNCTION_SAMPLER_CREATE:
+        return sizeof(ur::serialize::ur_sampler_create_args_t);
+    case UR_FUNCTION_SAMPLER_RETAIN:
+        return sizeof(ur::serialize::ur_sampler_retain_args_t);
+    case UR_FUNCTION_SAMPLER_RELEASE:
+        return sizeof(ur::serialize::ur_sampler_release_args_t);
+    case UR_FUNCTION_SAMPLER_GET_INFO:
+        return sizeof(ur::serialize::ur_sampler_get_info_args_t);
+    case UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_sampler_get_native_handle_args_t);
+    case UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_sampler_create_with_native_handle_args_t);
+    case UR_FUNCTION_MEM_IMAGE_CREATE:
+        return sizeof(ur::serialize::ur_mem_image_create_args_t);
+    case UR_FUNCTION_MEM_BUFFER_CREATE:
+        return sizeof(ur::serialize::ur_mem_buffer_create_args_t);
+    case UR_FUNCTION_MEM_RETAIN:
+        return sizeof(ur::serialize::ur_mem_retain_args_t);
+    case UR_FUNCTION_MEM_RELEASE:
+        return sizeof(ur::serialize::ur_mem_release_args_t);
+    case UR_FUNCTION_MEM_BUFFER_PARTITION:
+        return sizeof(ur::serialize::ur_mem_buffer_partition_args_t);
+    case UR_FUNCTION_MEM_GET_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_mem_get_native_handle_args_t);
+    case UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_mem_buffer_create_with_native_handle_args_t);
+    case UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_mem_image_create_with_native_handle_args_t);
+    case UR_FUNCTION_MEM_GET_INFO:
+        return sizeof(ur::serialize::ur_mem_get_info_args_t);
+    case UR_FUNCTION_MEM_IMAGE_GET_INFO:
+        return sizeof(ur::serialize::ur_mem_image_get_info_args_t);
+    case UR_FUNCTION_PHYSICAL_MEM_CREATE:
+        return sizeof(ur::serialize::ur_physical_mem_create_args_t);
+    case UR_FUNCTION_PHYSICAL_MEM_RETAIN:
+        return sizeof(ur::serialize::ur_physical_mem_retain_args_t);
+    case UR_FUNCTION_PHYSICAL_MEM_RELEASE:
+        return sizeof(ur::serialize::ur_physical_mem_release_args_t);
+    case UR_FUNCTION_ADAPTER_GET:
+        return sizeof(ur::serialize::ur_adapter_get_args_t);
+    case UR_FUNCTION_ADAPTER_RELEASE:
+        return sizeof(ur::serialize::ur_adapter_release_args_t);
+    case UR_FUNCTION_ADAPTER_RETAIN:
+        return sizeof(ur::serialize::ur_adapter_retain_args_t);
+    case UR_FUNCTION_ADAPTER_GET_LAST_ERROR:
+        return sizeof(ur::serialize::ur_adapter_get_last_error_args_t);
+    case UR_FUNCTION_ADAPTER_GET_INFO:
+        return sizeof(ur::serialize::ur_adapter_get_info_args_t);
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH:
+        return sizeof(ur::serialize::ur_enqueue_kernel_launch_args_t);
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT:
+        return sizeof(ur::serialize::ur_enqueue_events_wait_args_t);
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER:
+        return sizeof(ur::serialize::ur_enqueue_events_wait_with_barrier_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ:
+        return sizeof(ur::serialize::ur_enqueue_mem_buffer_read_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE:
+        return sizeof(ur::serialize::ur_enqueue_mem_buffer_write_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT:
+        return sizeof(ur::serialize::ur_enqueue_mem_buffer_read_rect_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT:
+        return sizeof(ur::serialize::ur_enqueue_mem_buffer_write_rect_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY:
+        return sizeof(ur::serialize::ur_enqueue_mem_buffer_copy_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT:
+        return sizeof(ur::serialize::ur_enqueue_mem_buffer_copy_rect_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL:
+        return sizeof(ur::serialize::ur_enqueue_mem_buffer_fill_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ:
+        return sizeof(ur::serialize::ur_enqueue_mem_image_read_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE:
+        return sizeof(ur::serialize::ur_enqueue_mem_image_write_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY:
+        return sizeof(ur::serialize::ur_enqueue_mem_image_copy_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP:
+        return sizeof(ur::serialize::ur_enqueue_mem_buffer_map_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_UNMAP:
+        return sizeof(ur::serialize::ur_enqueue_mem_unmap_args_t);
+    case UR_FUNCTION_ENQUEUE_USM_FILL:
+        return sizeof(ur::serialize::ur_enqueue_usm_fill_args_t);
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY:
+        return sizeof(ur::serialize::ur_enqueue_usm_memcpy_args_t);
+    case UR_FUNCTION_ENQUEUE_USM_PREFETCH:
+        return sizeof(ur::serialize::ur_enqueue_usm_prefetch_args_t);
+    case UR_FUNCTION_ENQUEUE_USM_ADVISE:
+        return sizeof(ur::serialize::ur_enqueue_usm_advise_args_t);
+    case UR_FUNCTION_ENQUEUE_USM_FILL_2D:
+        return sizeof(ur::serialize::ur_enqueue_usm_fill_2d_args_t);
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D:
+        return sizeof(ur::serialize::ur_enqueue_usm_memcpy_2d_args_t);
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE:
+        return sizeof(ur::serialize::ur_enqueue_device_global_variable_write_args_t);
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ:
+        return sizeof(ur::serialize::ur_enqueue_device_global_variable_read_args_t);
+    case UR_FUNCTION_ENQUEUE_READ_HOST_PIPE:
+        return sizeof(ur::serialize::ur_enqueue_read_host_pipe_args_t);
+    case UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE:
+        return sizeof(ur::serialize::ur_enqueue_write_host_pipe_args_t);
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP:
+        return sizeof(ur::serialize::ur_enqueue_kernel_launch_custom_exp_args_t);
+    case UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP:
+        return sizeof(ur::serialize::ur_enqueue_cooperative_kernel_launch_exp_args_t);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP:
+        return sizeof(ur::serialize::ur_enqueue_mem_buffer_copy_rect_batch_exp_args_t);
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP:
+        return sizeof(ur::serialize::ur_enqueue_kernel_launch_batch_exp_args_t);
+    case UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP:
+        return sizeof(ur::serialize::ur_enqueue_timestamp_recording_exp_args_t);
+    case UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP:
+        return sizeof(ur::serialize::ur_enqueue_timestamp_marker_exp_args_t);
+    case UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP:
+        return sizeof(ur::serialize::ur_enqueue_usm_device_alloc_exp_args_t);
+    case UR_FUNCTION_ENQUEUE_USM_FREE_EXP:
+        return sizeof(ur::serialize::ur_enqueue_usm_free_exp_args_t);
+    case UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP:
+        return sizeof(ur::serialize::ur_enqueue_native_command_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_unsampled_image_handle_destroy_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_sampled_image_handle_destroy_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_image_allocate_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_image_free_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_unsampled_image_create_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_sampled_image_create_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_image_copy_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_image_get_info_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_mipmap_get_level_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_mipmap_free_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_import_external_memory_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_map_external_array_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_map_external_linear_memory_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_release_external_memory_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_import_external_semaphore_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_release_external_semaphore_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_wait_external_semaphore_exp_args_t);
+    case UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP:
+        return sizeof(ur::serialize::ur_bindless_images_signal_external_semaphore_exp_args_t);
+    case UR_FUNCTION_USM_HOST_ALLOC:
+        return sizeof(ur::serialize::ur_usm_host_alloc_args_t);
+    case UR_FUNCTION_USM_DEVICE_ALLOC:
+        return sizeof(ur::serialize::ur_usm_device_alloc_args_t);
+    case UR_FUNCTION_USM_SHARED_ALLOC:
+        return sizeof(ur::serialize::ur_usm_shared_alloc_args_t);
+    case UR_FUNCTION_USM_FREE:
+        return sizeof(ur::serialize::ur_usm_free_args_t);
+    case UR_FUNCTION_USM_GET_MEM_ALLOC_INFO:
+        return sizeof(ur::serialize::ur_usm_get_mem_alloc_info_args_t);
+    case UR_FUNCTION_USM_POOL_CREATE:
+        return sizeof(ur::serialize::ur_usm_pool_create_args_t);
+    case UR_FUNCTION_USM_POOL_RETAIN:
+        return sizeof(ur::serialize::ur_usm_pool_retain_args_t);
+    case UR_FUNCTION_USM_POOL_RELEASE:
+        return sizeof(ur::serialize::ur_usm_pool_release_args_t);
+    case UR_FUNCTION_USM_POOL_GET_INFO:
+        return sizeof(ur::serialize::ur_usm_pool_get_info_args_t);
+    case UR_FUNCTION_USM_PITCHED_ALLOC_EXP:
+        return sizeof(ur::serialize::ur_usm_pitched_alloc_exp_args_t);
+    case UR_FUNCTION_USM_GROWABLE_ALLOC_EXP:
+        return sizeof(ur::serialize::ur_usm_growable_alloc_exp_args_t);
+    case UR_FUNCTION_USM_GROWABLE_RESIZE_EXP:
+        return sizeof(ur::serialize::ur_usm_growable_resize_exp_args_t);
+    case UR_FUNCTION_USM_GROWABLE_FREE_EXP:
+        return sizeof(ur::serialize::ur_usm_growable_free_exp_args_t);
+    case UR_FUNCTION_USM_IMPORT_EXP:
+        return sizeof(ur::serialize::ur_usm_import_exp_args_t);
+    case UR_FUNCTION_USM_RELEASE_EXP:
+        return sizeof(ur::serialize::ur_usm_release_exp_args_t);
+    case UR_FUNCTION_USM_POOL_TRIM_EXP:
+        return sizeof(ur::serialize::ur_usm_pool_trim_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_create_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_retain_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_release_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_finalize_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_kernel_launch_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_usm_memcpy_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_usm_fill_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_mem_buffer_copy_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_mem_buffer_write_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_mem_buffer_read_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_mem_buffer_copy_rect_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_mem_buffer_write_rect_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_mem_buffer_read_rect_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_mem_buffer_fill_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_usm_prefetch_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_append_usm_advise_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_enqueue_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_retain_command_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_release_command_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_update_kernel_launch_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_get_info_exp_args_t);
+    case UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP:
+        return sizeof(ur::serialize::ur_command_buffer_command_get_info_exp_args_t);
+    case UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP:
+        return sizeof(ur::serialize::ur_usm_p2p_enable_peer_access_exp_args_t);
+    case UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP:
+        return sizeof(ur::serialize::ur_usm_p2p_disable_peer_access_exp_args_t);
+    case UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP:
+        return sizeof(ur::serialize::ur_usm_p2p_peer_access_get_info_exp_args_t);
+    case UR_FUNCTION_LOADER_INIT:
+        return sizeof(ur::serialize::ur_loader_init_args_t);
+    case UR_FUNCTION_LOADER_TEAR_DOWN:
+        return sizeof(ur::serialize::ur_loader_tear_down_args_t);
+    case UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO:
+        return sizeof(ur::serialize::ur_virtual_mem_granularity_get_info_args_t);
+    case UR_FUNCTION_VIRTUAL_MEM_RESERVE:
+        return sizeof(ur::serialize::ur_virtual_mem_reserve_args_t);
+    case UR_FUNCTION_VIRTUAL_MEM_FREE:
+        return sizeof(ur::serialize::ur_virtual_mem_free_args_t);
+    case UR_FUNCTION_VIRTUAL_MEM_MAP:
+        return sizeof(ur::serialize::ur_virtual_mem_map_args_t);
+    case UR_FUNCTION_VIRTUAL_MEM_UNMAP:
+        return sizeof(ur::serialize::ur_virtual_mem_unmap_args_t);
+    case UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS:
+        return sizeof(ur::serialize::ur_virtual_mem_set_access_args_t);
+    case UR_FUNCTION_VIRTUAL_MEM_GET_INFO:
+        return sizeof(ur::serialize::ur_virtual_mem_get_info_args_t);
+    case UR_FUNCTION_DEVICE_GET:
+        return sizeof(ur::serialize::ur_device_get_args_t);
+    case UR_FUNCTION_DEVICE_GET_SELECTED:
+        return sizeof(ur::serialize::ur_device_get_selected_args_t);
+    case UR_FUNCTION_DEVICE_GET_INFO:
+        return sizeof(ur::serialize::ur_device_get_info_args_t);
+    case UR_FUNCTION_DEVICE_RETAIN:
+        return sizeof(ur::serialize::ur_device_retain_args_t);
+    case UR_FUNCTION_DEVICE_RELEASE:
+        return sizeof(ur::serialize::ur_device_release_args_t);
+    case UR_FUNCTION_DEVICE_PARTITION:
+        return sizeof(ur::serialize::ur_device_partition_args_t);
+    case UR_FUNCTION_DEVICE_SELECT_BINARY:
+        return sizeof(ur::serialize::ur_device_select_binary_args_t);
+    case UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_device_get_native_handle_args_t);
+    case UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE:
+        return sizeof(ur::serialize::ur_device_create_with_native_handle_args_t);
+    case UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS:
+        return sizeof(ur::serialize::ur_device_get_global_timestamps_args_t);
+    default:
+        return 0;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialize function parameters
+/// @details
+///     - Writes the values of the arguments that params points to into
+///       buffer, without allocating. Pointer arguments are written as
+///       addresses, the data they point to isn't.
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         - `NULL == params`
+///         - `NULL == buffer`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         - `size < getSerializedFunctionParamsSize(function)`
+inline ur_result_t UR_APICALL serializeFunctionParams(ur_function_t function, const void *params, void *buffer, size_t size) {
+    if (!params || !buffer) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    size_t required = getSerializedFunctionParamsSize(function);
+    if (required == 0) {
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    if (size < required) {
+        return UR_RESULT_ERROR_INVALID_SIZE;
+    }
+    switch (function) {
+    case UR_FUNCTION_LOADER_CONFIG_CREATE: {
+        [[maybe_unused]] auto p = (const struct ur_loader_config_create_params_t *)params;
+        ur::serialize::ur_loader_config_create_args_t args;
+        args.phLoaderConfig = *p->pphLoaderConfig;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_loader_config_retain_params_t *)params;
+        ur::serialize::ur_loader_config_retain_args_t args;
+        args.hLoaderConfig = *p->phLoaderConfig;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_loader_config_release_params_t *)params;
+        ur::serialize::ur_loader_config_release_args_t args;
+        args.hLoaderConfig = *p->phLoaderConfig;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_loader_config_get_info_params_t *)params;
+        ur::serialize::ur_loader_config_get_info_args_t args;
+        args.hLoaderConfig = *p->phLoaderConfig;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_ENABLE_LAYER: {
+        [[maybe_unused]] auto p = (const struct ur_loader_config_enable_layer_params_t *)params;
+        ur::serialize::ur_loader_config_enable_layer_args_t args;
+        args.hLoaderConfig = *p->phLoaderConfig;
+        args.pLayerName = *p->ppLayerName;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_SET_CODE_LOCATION_CALLBACK: {
+        [[maybe_unused]] auto p = (const struct ur_loader_config_set_code_location_callback_params_t *)params;
+        ur::serialize::ur_loader_config_set_code_location_callback_args_t args;
+        args.hLoaderConfig = *p->phLoaderConfig;
+        args.pfnCodeloc = *p->ppfnCodeloc;
+        args.pUserData = *p->ppUserData;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_SET_MOCKING_ENABLED: {
+        [[maybe_unused]] auto p = (const struct ur_loader_config_set_mocking_enabled_params_t *)params;
+        ur::serialize::ur_loader_config_set_mocking_enabled_args_t args;
+        args.hLoaderConfig = *p->phLoaderConfig;
+        args.enable = *p->penable;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PLATFORM_GET: {
+        [[maybe_unused]] auto p = (const struct ur_platform_get_params_t *)params;
+        ur::serialize::ur_platform_get_args_t args;
+        args.phAdapters = *p->pphAdapters;
+        args.NumAdapters = *p->pNumAdapters;
+        args.NumEntries = *p->pNumEntries;
+        args.phPlatforms = *p->pphPlatforms;
+        args.pNumPlatforms = *p->ppNumPlatforms;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_platform_get_info_params_t *)params;
+        ur::serialize::ur_platform_get_info_args_t args;
+        args.hPlatform = *p->phPlatform;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_platform_get_native_handle_params_t *)params;
+        ur::serialize::ur_platform_get_native_handle_args_t args;
+        args.hPlatform = *p->phPlatform;
+        args.phNativePlatform = *p->pphNativePlatform;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_platform_create_with_native_handle_params_t *)params;
+        ur::serialize::ur_platform_create_with_native_handle_args_t args;
+        args.hNativePlatform = *p->phNativePlatform;
+        args.hAdapter = *p->phAdapter;
+        args.pProperties = *p->ppProperties;
+        args.phPlatform = *p->pphPlatform;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_API_VERSION: {
+        [[maybe_unused]] auto p = (const struct ur_platform_get_api_version_params_t *)params;
+        ur::serialize::ur_platform_get_api_version_args_t args;
+        args.hPlatform = *p->phPlatform;
+        args.pVersion = *p->ppVersion;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION: {
+        [[maybe_unused]] auto p = (const struct ur_platform_get_backend_option_params_t *)params;
+        ur::serialize::ur_platform_get_backend_option_args_t args;
+        args.hPlatform = *p->phPlatform;
+        args.pFrontendOption = *p->ppFrontendOption;
+        args.ppPlatformOption = *p->pppPlatformOption;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_CONTEXT_CREATE: {
+        [[maybe_unused]] auto p = (const struct ur_context_create_params_t *)params;
+        ur::serialize::ur_context_create_args_t args;
+        args.DeviceCount = *p->pDeviceCount;
+        args.phDevices = *p->pphDevices;
+        args.pProperties = *p->ppProperties;
+        args.phContext = *p->pphContext;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_CONTEXT_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_context_retain_params_t *)params;
+        ur::serialize::ur_context_retain_args_t args;
+        args.hContext = *p->phContext;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_CONTEXT_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_context_release_params_t *)params;
+        ur::serialize::ur_context_release_args_t args;
+        args.hContext = *p->phContext;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_CONTEXT_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_context_get_info_params_t *)params;
+        ur::serialize::ur_context_get_info_args_t args;
+        args.hContext = *p->phContext;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_context_get_native_handle_params_t *)params;
+        ur::serialize::ur_context_get_native_handle_args_t args;
+        args.hContext = *p->phContext;
+        args.phNativeContext = *p->pphNativeContext;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_context_create_with_native_handle_params_t *)params;
+        ur::serialize::ur_context_create_with_native_handle_args_t args;
+        args.hNativeContext = *p->phNativeContext;
+        args.hAdapter = *p->phAdapter;
+        args.numDevices = *p->pnumDevices;
+        args.phDevices = *p->pphDevices;
+        args.pProperties = *p->ppProperties;
+        args.phContext = *p->pphContext;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER: {
+        [[maybe_unused]] auto p = (const struct ur_context_set_extended_deleter_params_t *)params;
+        ur::serialize::ur_context_set_extended_deleter_args_t args;
+        args.hContext = *p->phContext;
+        args.pfnDeleter = *p->ppfnDeleter;
+        args.pUserData = *p->ppUserData;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_EVENT_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_event_get_info_params_t *)params;
+        ur::serialize::ur_event_get_info_args_t args;
+        args.hEvent = *p->phEvent;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_EVENT_GET_PROFILING_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_event_get_profiling_info_params_t *)params;
+        ur::serialize::ur_event_get_profiling_info_args_t args;
+        args.hEvent = *p->phEvent;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_EVENT_WAIT: {
+        [[maybe_unused]] auto p = (const struct ur_event_wait_params_t *)params;
+        ur::serialize::ur_event_wait_args_t args;
+        args.numEvents = *p->pnumEvents;
+        args.phEventWaitList = *p->pphEventWaitList;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_EVENT_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_event_retain_params_t *)params;
+        ur::serialize::ur_event_retain_args_t args;
+        args.hEvent = *p->phEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_EVENT_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_event_release_params_t *)params;
+        ur::serialize::ur_event_release_args_t args;
+        args.hEvent = *p->phEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_EVENT_GET_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_event_get_native_handle_params_t *)params;
+        ur::serialize::ur_event_get_native_handle_args_t args;
+        args.hEvent = *p->phEvent;
+        args.phNativeEvent = *p->pphNativeEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_event_create_with_native_handle_params_t *)params;
+        ur::serialize::ur_event_create_with_native_handle_args_t args;
+        args.hNativeEvent = *p->phNativeEvent;
+        args.hContext = *p->phContext;
+        args.pProperties = *p->ppProperties;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_EVENT_SET_CALLBACK: {
+        [[maybe_unused]] auto p = (const struct ur_event_set_callback_params_t *)params;
+        ur::serialize::ur_event_set_callback_args_t args;
+        args.hEvent = *p->phEvent;
+        args.execStatus = *p->pexecStatus;
+        args.pfnNotify = *p->ppfnNotify;
+        args.pUserData = *p->ppUserData;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_EVENT_WAIT_ANY_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_event_wait_any_exp_params_t *)params;
+        ur::serialize::ur_event_wait_any_exp_args_t args;
+        args.numEvents = *p->pnumEvents;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.pEventIndex = *p->ppEventIndex;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_event_get_execution_status_exp_params_t *)params;
+        ur::serialize::ur_event_get_execution_status_exp_args_t args;
+        args.numEvents = *p->pnumEvents;
+        args.phEvents = *p->pphEvents;
+        args.pStatuses = *p->ppStatuses;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_IL: {
+        [[maybe_unused]] auto p = (const struct ur_program_create_with_il_params_t *)params;
+        ur::serialize::ur_program_create_with_il_args_t args;
+        args.hContext = *p->phContext;
+        args.pIL = *p->ppIL;
+        args.length = *p->plength;
+        args.pProperties = *p->ppProperties;
+        args.phProgram = *p->pphProgram;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY: {
+        [[maybe_unused]] auto p = (const struct ur_program_create_with_binary_params_t *)params;
+        ur::serialize::ur_program_create_with_binary_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.size = *p->psize;
+        args.pBinary = *p->ppBinary;
+        args.pProperties = *p->ppProperties;
+        args.phProgram = *p->pphProgram;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_BUILD: {
+        [[maybe_unused]] auto p = (const struct ur_program_build_params_t *)params;
+        ur::serialize::ur_program_build_args_t args;
+        args.hContext = *p->phContext;
+        args.hProgram = *p->phProgram;
+        args.pOptions = *p->ppOptions;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_BUILD_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_program_build_exp_params_t *)params;
+        ur::serialize::ur_program_build_exp_args_t args;
+        args.hProgram = *p->phProgram;
+        args.numDevices = *p->pnumDevices;
+        args.phDevices = *p->pphDevices;
+        args.pOptions = *p->ppOptions;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_COMPILE: {
+        [[maybe_unused]] auto p = (const struct ur_program_compile_params_t *)params;
+        ur::serialize::ur_program_compile_args_t args;
+        args.hContext = *p->phContext;
+        args.hProgram = *p->phProgram;
+        args.pOptions = *p->ppOptions;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_COMPILE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_program_compile_exp_params_t *)params;
+        ur::serialize::ur_program_compile_exp_args_t args;
+        args.hProgram = *p->phProgram;
+        args.numDevices = *p->pnumDevices;
+        args.phDevices = *p->pphDevices;
+        args.pOptions = *p->ppOptions;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_LINK: {
+        [[maybe_unused]] auto p = (const struct ur_program_link_params_t *)params;
+        ur::serialize::ur_program_link_args_t args;
+        args.hContext = *p->phContext;
+        args.count = *p->pcount;
+        args.phPrograms = *p->pphPrograms;
+        args.pOptions = *p->ppOptions;
+        args.phProgram = *p->pphProgram;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_LINK_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_program_link_exp_params_t *)params;
+        ur::serialize::ur_program_link_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.numDevices = *p->pnumDevices;
+        args.phDevices = *p->pphDevices;
+        args.count = *p->pcount;
+        args.phPrograms = *p->pphPrograms;
+        args.pOptions = *p->ppOptions;
+        args.phProgram = *p->pphProgram;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_program_retain_params_t *)params;
+        ur::serialize::ur_program_retain_args_t args;
+        args.hProgram = *p->phProgram;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_program_release_params_t *)params;
+        ur::serialize::ur_program_release_args_t args;
+        args.hProgram = *p->phProgram;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER: {
+        [[maybe_unused]] auto p = (const struct ur_program_get_function_pointer_params_t *)params;
+        ur::serialize::ur_program_get_function_pointer_args_t args;
+        args.hDevice = *p->phDevice;
+        args.hProgram = *p->phProgram;
+        args.pFunctionName = *p->ppFunctionName;
+        args.ppFunctionPointer = *p->pppFunctionPointer;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER: {
+        [[maybe_unused]] auto p = (const struct ur_program_get_global_variable_pointer_params_t *)params;
+        ur::serialize::ur_program_get_global_variable_pointer_args_t args;
+        args.hDevice = *p->phDevice;
+        args.hProgram = *p->phProgram;
+        args.pGlobalVariableName = *p->ppGlobalVariableName;
+        args.pGlobalVariableSizeRet = *p->ppGlobalVariableSizeRet;
+        args.ppGlobalVariablePointerRet = *p->pppGlobalVariablePointerRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_program_get_info_params_t *)params;
+        ur::serialize::ur_program_get_info_args_t args;
+        args.hProgram = *p->phProgram;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_BUILD_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_program_get_build_info_params_t *)params;
+        ur::serialize::ur_program_get_build_info_args_t args;
+        args.hProgram = *p->phProgram;
+        args.hDevice = *p->phDevice;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS: {
+        [[maybe_unused]] auto p = (const struct ur_program_set_specialization_constants_params_t *)params;
+        ur::serialize::ur_program_set_specialization_constants_args_t args;
+        args.hProgram = *p->phProgram;
+        args.count = *p->pcount;
+        args.pSpecConstants = *p->ppSpecConstants;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_program_get_native_handle_params_t *)params;
+        ur::serialize::ur_program_get_native_handle_args_t args;
+        args.hProgram = *p->phProgram;
+        args.phNativeProgram = *p->pphNativeProgram;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_program_create_with_native_handle_params_t *)params;
+        ur::serialize::ur_program_create_with_native_handle_args_t args;
+        args.hNativeProgram = *p->phNativeProgram;
+        args.hContext = *p->phContext;
+        args.pProperties = *p->ppProperties;
+        args.phProgram = *p->pphProgram;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_CREATE: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_create_params_t *)params;
+        ur::serialize::ur_kernel_create_args_t args;
+        args.hProgram = *p->phProgram;
+        args.pKernelName = *p->ppKernelName;
+        args.phKernel = *p->pphKernel;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_get_info_params_t *)params;
+        ur::serialize::ur_kernel_get_info_args_t args;
+        args.hKernel = *p->phKernel;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_GET_GROUP_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_get_group_info_params_t *)params;
+        ur::serialize::ur_kernel_get_group_info_args_t args;
+        args.hKernel = *p->phKernel;
+        args.hDevice = *p->phDevice;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_get_sub_group_info_params_t *)params;
+        ur::serialize::ur_kernel_get_sub_group_info_args_t args;
+        args.hKernel = *p->phKernel;
+        args.hDevice = *p->phDevice;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_retain_params_t *)params;
+        ur::serialize::ur_kernel_retain_args_t args;
+        args.hKernel = *p->phKernel;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_release_params_t *)params;
+        ur::serialize::ur_kernel_release_args_t args;
+        args.hKernel = *p->phKernel;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_get_native_handle_params_t *)params;
+        ur::serialize::ur_kernel_get_native_handle_args_t args;
+        args.hKernel = *p->phKernel;
+        args.phNativeKernel = *p->pphNativeKernel;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_create_with_native_handle_params_t *)params;
+        ur::serialize::ur_kernel_create_with_native_handle_args_t args;
+        args.hNativeKernel = *p->phNativeKernel;
+        args.hContext = *p->phContext;
+        args.hProgram = *p->phProgram;
+        args.pProperties = *p->ppProperties;
+        args.phKernel = *p->pphKernel;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_get_suggested_local_work_size_params_t *)params;
+        ur::serialize::ur_kernel_get_suggested_local_work_size_args_t args;
+        args.hKernel = *p->phKernel;
+        args.hQueue = *p->phQueue;
+        args.numWorkDim = *p->pnumWorkDim;
+        args.pGlobalWorkOffset = *p->ppGlobalWorkOffset;
+        args.pGlobalWorkSize = *p->ppGlobalWorkSize;
+        args.pSuggestedLocalWorkSize = *p->ppSuggestedLocalWorkSize;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_VALUE: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_set_arg_value_params_t *)params;
+        ur::serialize::ur_kernel_set_arg_value_args_t args;
+        args.hKernel = *p->phKernel;
+        args.argIndex = *p->pargIndex;
+        args.argSize = *p->pargSize;
+        args.pProperties = *p->ppProperties;
+        args.pArgValue = *p->ppArgValue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_LOCAL: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_set_arg_local_params_t *)params;
+        ur::serialize::ur_kernel_set_arg_local_args_t args;
+        args.hKernel = *p->phKernel;
+        args.argIndex = *p->pargIndex;
+        args.argSize = *p->pargSize;
+        args.pProperties = *p->ppProperties;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_POINTER: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_set_arg_pointer_params_t *)params;
+        ur::serialize::ur_kernel_set_arg_pointer_args_t args;
+        args.hKernel = *p->phKernel;
+        args.argIndex = *p->pargIndex;
+        args.pProperties = *p->ppProperties;
+        args.pArgValue = *p->ppArgValue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_EXEC_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_set_exec_info_params_t *)params;
+        ur::serialize::ur_kernel_set_exec_info_args_t args;
+        args.hKernel = *p->phKernel;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pProperties = *p->ppProperties;
+        args.pPropValue = *p->ppPropValue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_SAMPLER: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_set_arg_sampler_params_t *)params;
+        ur::serialize::ur_kernel_set_arg_sampler_args_t args;
+        args.hKernel = *p->phKernel;
+        args.argIndex = *p->pargIndex;
+        args.pProperties = *p->ppProperties;
+        args.hArgValue = *p->phArgValue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_set_arg_mem_obj_params_t *)params;
+        ur::serialize::ur_kernel_set_arg_mem_obj_args_t args;
+        args.hKernel = *p->phKernel;
+        args.argIndex = *p->pargIndex;
+        args.pProperties = *p->ppProperties;
+        args.hArgValue = *p->phArgValue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_set_specialization_constants_params_t *)params;
+        ur::serialize::ur_kernel_set_specialization_constants_args_t args;
+        args.hKernel = *p->phKernel;
+        args.count = *p->pcount;
+        args.pSpecConstants = *p->ppSpecConstants;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t *)params;
+        ur::serialize::ur_kernel_suggest_max_cooperative_group_count_exp_args_t args;
+        args.hKernel = *p->phKernel;
+        args.localWorkSize = *p->plocalWorkSize;
+        args.dynamicSharedMemorySize = *p->pdynamicSharedMemorySize;
+        args.pGroupCountRet = *p->ppGroupCountRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARGS_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_kernel_set_args_exp_params_t *)params;
+        ur::serialize::ur_kernel_set_args_exp_args_t args;
+        args.hKernel = *p->phKernel;
+        args.numArgs = *p->pnumArgs;
+        args.pArgs = *p->ppArgs;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_queue_get_info_params_t *)params;
+        ur::serialize::ur_queue_get_info_args_t args;
+        args.hQueue = *p->phQueue;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_CREATE: {
+        [[maybe_unused]] auto p = (const struct ur_queue_create_params_t *)params;
+        ur::serialize::ur_queue_create_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.pProperties = *p->ppProperties;
+        args.phQueue = *p->pphQueue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_queue_retain_params_t *)params;
+        ur::serialize::ur_queue_retain_args_t args;
+        args.hQueue = *p->phQueue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_queue_release_params_t *)params;
+        ur::serialize::ur_queue_release_args_t args;
+        args.hQueue = *p->phQueue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_queue_get_native_handle_params_t *)params;
+        ur::serialize::ur_queue_get_native_handle_args_t args;
+        args.hQueue = *p->phQueue;
+        args.pDesc = *p->ppDesc;
+        args.phNativeQueue = *p->pphNativeQueue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_queue_create_with_native_handle_params_t *)params;
+        ur::serialize::ur_queue_create_with_native_handle_args_t args;
+        args.hNativeQueue = *p->phNativeQueue;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.pProperties = *p->ppProperties;
+        args.phQueue = *p->pphQueue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_FINISH: {
+        [[maybe_unused]] auto p = (const struct ur_queue_finish_params_t *)params;
+        ur::serialize::ur_queue_finish_args_t args;
+        args.hQueue = *p->phQueue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_FLUSH: {
+        [[maybe_unused]] auto p = (const struct ur_queue_flush_params_t *)params;
+        ur::serialize::ur_queue_flush_args_t args;
+        args.hQueue = *p->phQueue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_CREATE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_queue_group_create_exp_params_t *)params;
+        ur::serialize::ur_queue_group_create_exp_args_t args;
+        args.numQueues = *p->pnumQueues;
+        args.phQueues = *p->pphQueues;
+        args.phQueueGroup = *p->pphQueueGroup;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_RETAIN_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_queue_group_retain_exp_params_t *)params;
+        ur::serialize::ur_queue_group_retain_exp_args_t args;
+        args.hQueueGroup = *p->phQueueGroup;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_RELEASE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_queue_group_release_exp_params_t *)params;
+        ur::serialize::ur_queue_group_release_exp_args_t args;
+        args.hQueueGroup = *p->phQueueGroup;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_GET_QUEUE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_queue_group_get_queue_exp_params_t *)params;
+        ur::serialize::ur_queue_group_get_queue_exp_args_t args;
+        args.hQueueGroup = *p->phQueueGroup;
+        args.phQueue = *p->pphQueue;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_FINISH_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_queue_group_finish_exp_params_t *)params;
+        ur::serialize::ur_queue_group_finish_exp_args_t args;
+        args.hQueueGroup = *p->phQueueGroup;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_BARRIER_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_queue_group_barrier_exp_params_t *)params;
+        ur::serialize::ur_queue_group_barrier_exp_args_t args;
+        args.hQueueGroup = *p->phQueueGroup;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_queue_reserve_timestamp_markers_exp_params_t *)params;
+        ur::serialize::ur_queue_reserve_timestamp_markers_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.capacity = *p->pcapacity;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_queue_read_timestamp_markers_exp_params_t *)params;
+        ur::serialize::ur_queue_read_timestamp_markers_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.firstMarker = *p->pfirstMarker;
+        args.count = *p->pcount;
+        args.pTimestamps = *p->ppTimestamps;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_SAMPLER_CREATE: {
+        [[maybe_unused]] auto p = (const struct ur_sampler_create_params_t *)params;
+        ur::serialize::ur_sampler_create_args_t args;
+        args.hContext = *p->phContext;
+        args.pDesc = *p->ppDesc;
+        args.phSampler = *p->pphSampler;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_SAMPLER_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_sampler_retain_params_t *)params;
+        ur::serialize::ur_sampler_retain_args_t args;
+        args.hSampler = *p->phSampler;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_SAMPLER_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_sampler_release_params_t *)params;
+        ur::serialize::ur_sampler_release_args_t args;
+        args.hSampler = *p->phSampler;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_SAMPLER_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_sampler_get_info_params_t *)params;
+        ur::serialize::ur_sampler_get_info_args_t args;
+        args.hSampler = *p->phSampler;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_sampler_get_native_handle_params_t *)params;
+        ur::serialize::ur_sampler_get_native_handle_args_t args;
+        args.hSampler = *p->phSampler;
+        args.phNativeSampler = *p->pphNativeSampler;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_sampler_create_with_native_handle_params_t *)params;
+        ur::serialize::ur_sampler_create_with_native_handle_args_t args;
+        args.hNativeSampler = *p->phNativeSampler;
+        args.hContext = *p->phContext;
+        args.pProperties = *p->ppProperties;
+        args.phSampler = *p->pphSampler;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_MEM_IMAGE_CREATE: {
+        [[maybe_unused]] auto p = (const struct ur_mem_image_create_params_t *)params;
+        ur::serialize::ur_mem_image_create_args_t args;
+        args.hContext = *p->phContext;
+        args.flags = *p->pflags;
+        args.pImageFormat = *p->ppImageFormat;
+        args.pImageDesc = *p->ppImageDesc;
+        args.pHost = *p->ppHost;
+        args.phMem = *p->pphMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_MEM_BUFFER_CREATE: {
+        [[maybe_unused]] auto p = (const struct ur_mem_buffer_create_params_t *)params;
+        ur::serialize::ur_mem_buffer_create_args_t args;
+        args.hContext = *p->phContext;
+        args.flags = *p->pflags;
+        args.size = *p->psize;
+        args.pProperties = *p->ppProperties;
+        args.phBuffer = *p->pphBuffer;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_MEM_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_mem_retain_params_t *)params;
+        ur::serialize::ur_mem_retain_args_t args;
+        args.hMem = *p->phMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_MEM_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_mem_release_params_t *)params;
+        ur::serialize::ur_mem_release_args_t args;
+        args.hMem = *p->phMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_MEM_BUFFER_PARTITION: {
+        [[maybe_unused]] auto p = (const struct ur_mem_buffer_partition_params_t *)params;
+        ur::serialize::ur_mem_buffer_partition_args_t args;
+        args.hBuffer = *p->phBuffer;
+        args.flags = *p->pflags;
+        args.bufferCreateType = *p->pbufferCreateType;
+        args.pRegion = *p->ppRegion;
+        args.phMem = *p->pphMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_MEM_GET_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_mem_get_native_handle_params_t *)params;
+        ur::serialize::ur_mem_get_native_handle_args_t args;
+        args.hMem = *p->phMem;
+        args.hDevice = *p->phDevice;
+        args.phNativeMem = *p->pphNativeMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_mem_buffer_create_with_native_handle_params_t *)params;
+        ur::serialize::ur_mem_buffer_create_with_native_handle_args_t args;
+        args.hNativeMem = *p->phNativeMem;
+        args.hContext = *p->phContext;
+        args.pProperties = *p->ppProperties;
+        args.phMem = *p->pphMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_mem_image_create_with_native_handle_params_t *)params;
+        ur::serialize::ur_mem_image_create_with_native_handle_args_t args;
+        args.hNativeMem = *p->phNativeMem;
+        args.hContext = *p->phContext;
+        args.pImageFormat = *p->ppImageFormat;
+        args.pImageDesc = *p->ppImageDesc;
+        args.pProperties = *p->ppProperties;
+        args.phMem = *p->pphMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_MEM_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_mem_get_info_params_t *)params;
+        ur::serialize::ur_mem_get_info_args_t args;
+        args.hMemory = *p->phMemory;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_MEM_IMAGE_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_mem_image_get_info_params_t *)params;
+        ur::serialize::ur_mem_image_get_info_args_t args;
+        args.hMemory = *p->phMemory;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PHYSICAL_MEM_CREATE: {
+        [[maybe_unused]] auto p = (const struct ur_physical_mem_create_params_t *)params;
+        ur::serialize::ur_physical_mem_create_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.size = *p->psize;
+        args.pProperties = *p->ppProperties;
+        args.phPhysicalMem = *p->pphPhysicalMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PHYSICAL_MEM_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_physical_mem_retain_params_t *)params;
+        ur::serialize::ur_physical_mem_retain_args_t args;
+        args.hPhysicalMem = *p->phPhysicalMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_PHYSICAL_MEM_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_physical_mem_release_params_t *)params;
+        ur::serialize::ur_physical_mem_release_args_t args;
+        args.hPhysicalMem = *p->phPhysicalMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ADAPTER_GET: {
+        [[maybe_unused]] auto p = (const struct ur_adapter_get_params_t *)params;
+        ur::serialize::ur_adapter_get_args_t args;
+        args.NumEntries = *p->pNumEntries;
+        args.phAdapters = *p->pphAdapters;
+        args.pNumAdapters = *p->ppNumAdapters;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ADAPTER_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_adapter_release_params_t *)params;
+        ur::serialize::ur_adapter_release_args_t args;
+        args.hAdapter = *p->phAdapter;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ADAPTER_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_adapter_retain_params_t *)params;
+        ur::serialize::ur_adapter_retain_args_t args;
+        args.hAdapter = *p->phAdapter;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ADAPTER_GET_LAST_ERROR: {
+        [[maybe_unused]] auto p = (const struct ur_adapter_get_last_error_params_t *)params;
+        ur::serialize::ur_adapter_get_last_error_args_t args;
+        args.hAdapter = *p->phAdapter;
+        args.ppMessage = *p->pppMessage;
+        args.pError = *p->ppError;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ADAPTER_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_adapter_get_info_params_t *)params;
+        ur::serialize::ur_adapter_get_info_args_t args;
+        args.hAdapter = *p->phAdapter;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_kernel_launch_params_t *)params;
+        ur::serialize::ur_enqueue_kernel_launch_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hKernel = *p->phKernel;
+        args.workDim = *p->pworkDim;
+        args.pGlobalWorkOffset = *p->ppGlobalWorkOffset;
+        args.pGlobalWorkSize = *p->ppGlobalWorkSize;
+        args.pLocalWorkSize = *p->ppLocalWorkSize;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_events_wait_params_t *)params;
+        ur::serialize::ur_enqueue_events_wait_args_t args;
+        args.hQueue = *p->phQueue;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_events_wait_with_barrier_params_t *)params;
+        ur::serialize::ur_enqueue_events_wait_with_barrier_args_t args;
+        args.hQueue = *p->phQueue;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_buffer_read_params_t *)params;
+        ur::serialize::ur_enqueue_mem_buffer_read_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hBuffer = *p->phBuffer;
+        args.blockingRead = *p->pblockingRead;
+        args.offset = *p->poffset;
+        args.size = *p->psize;
+        args.pDst = *p->ppDst;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_buffer_write_params_t *)params;
+        ur::serialize::ur_enqueue_mem_buffer_write_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hBuffer = *p->phBuffer;
+        args.blockingWrite = *p->pblockingWrite;
+        args.offset = *p->poffset;
+        args.size = *p->psize;
+        args.pSrc = *p->ppSrc;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_buffer_read_rect_params_t *)params;
+        ur::serialize::ur_enqueue_mem_buffer_read_rect_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hBuffer = *p->phBuffer;
+        args.blockingRead = *p->pblockingRead;
+        args.bufferOrigin = *p->pbufferOrigin;
+        args.hostOrigin = *p->phostOrigin;
+        args.region = *p->pregion;
+        args.bufferRowPitch = *p->pbufferRowPitch;
+        args.bufferSlicePitch = *p->pbufferSlicePitch;
+        args.hostRowPitch = *p->phostRowPitch;
+        args.hostSlicePitch = *p->phostSlicePitch;
+        args.pDst = *p->ppDst;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_buffer_write_rect_params_t *)params;
+        ur::serialize::ur_enqueue_mem_buffer_write_rect_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hBuffer = *p->phBuffer;
+        args.blockingWrite = *p->pblockingWrite;
+        args.bufferOrigin = *p->pbufferOrigin;
+        args.hostOrigin = *p->phostOrigin;
+        args.region = *p->pregion;
+        args.bufferRowPitch = *p->pbufferRowPitch;
+        args.bufferSlicePitch = *p->pbufferSlicePitch;
+        args.hostRowPitch = *p->phostRowPitch;
+        args.hostSlicePitch = *p->phostSlicePitch;
+        args.pSrc = *p->ppSrc;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_buffer_copy_params_t *)params;
+        ur::serialize::ur_enqueue_mem_buffer_copy_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hBufferSrc = *p->phBufferSrc;
+        args.hBufferDst = *p->phBufferDst;
+        args.srcOffset = *p->psrcOffset;
+        args.dstOffset = *p->pdstOffset;
+        args.size = *p->psize;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_buffer_copy_rect_params_t *)params;
+        ur::serialize::ur_enqueue_mem_buffer_copy_rect_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hBufferSrc = *p->phBufferSrc;
+        args.hBufferDst = *p->phBufferDst;
+        args.srcOrigin = *p->psrcOrigin;
+        args.dstOrigin = *p->pdstOrigin;
+        args.region = *p->pregion;
+        args.srcRowPitch = *p->psrcRowPitch;
+        args.srcSlicePitch = *p->psrcSlicePitch;
+        args.dstRowPitch = *p->pdstRowPitch;
+        args.dstSlicePitch = *p->pdstSlicePitch;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_buffer_fill_params_t *)params;
+        ur::serialize::ur_enqueue_mem_buffer_fill_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hBuffer = *p->phBuffer;
+        args.pPattern = *p->ppPattern;
+        args.patternSize = *p->ppatternSize;
+        args.offset = *p->poffset;
+        args.size = *p->psize;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_image_read_params_t *)params;
+        ur::serialize::ur_enqueue_mem_image_read_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hImage = *p->phImage;
+        args.blockingRead = *p->pblockingRead;
+        args.origin = *p->porigin;
+        args.region = *p->pregion;
+        args.rowPitch = *p->prowPitch;
+        args.slicePitch = *p->pslicePitch;
+        args.pDst = *p->ppDst;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_image_write_params_t *)params;
+        ur::serialize::ur_enqueue_mem_image_write_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hImage = *p->phImage;
+        args.blockingWrite = *p->pblockingWrite;
+        args.origin = *p->porigin;
+        args.region = *p->pregion;
+        args.rowPitch = *p->prowPitch;
+        args.slicePitch = *p->pslicePitch;
+        args.pSrc = *p->ppSrc;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_image_copy_params_t *)params;
+        ur::serialize::ur_enqueue_mem_image_copy_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hImageSrc = *p->phImageSrc;
+        args.hImageDst = *p->phImageDst;
+        args.srcOrigin = *p->psrcOrigin;
+        args.dstOrigin = *p->pdstOrigin;
+        args.region = *p->pregion;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_buffer_map_params_t *)params;
+        ur::serialize::ur_enqueue_mem_buffer_map_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hBuffer = *p->phBuffer;
+        args.blockingMap = *p->pblockingMap;
+        args.mapFlags = *p->pmapFlags;
+        args.offset = *p->poffset;
+        args.size = *p->psize;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        args.ppRetMap = *p->pppRetMap;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_UNMAP: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_unmap_params_t *)params;
+        ur::serialize::ur_enqueue_mem_unmap_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hMem = *p->phMem;
+        args.pMappedPtr = *p->ppMappedPtr;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_FILL: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_usm_fill_params_t *)params;
+        ur::serialize::ur_enqueue_usm_fill_args_t args;
+        args.hQueue = *p->phQueue;
+        args.pMem = *p->ppMem;
+        args.patternSize = *p->ppatternSize;
+        args.pPattern = *p->ppPattern;
+        args.size = *p->psize;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_usm_memcpy_params_t *)params;
+        ur::serialize::ur_enqueue_usm_memcpy_args_t args;
+        args.hQueue = *p->phQueue;
+        args.blocking = *p->pblocking;
+        args.pDst = *p->ppDst;
+        args.pSrc = *p->ppSrc;
+        args.size = *p->psize;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_PREFETCH: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_usm_prefetch_params_t *)params;
+        ur::serialize::ur_enqueue_usm_prefetch_args_t args;
+        args.hQueue = *p->phQueue;
+        args.pMem = *p->ppMem;
+        args.size = *p->psize;
+        args.flags = *p->pflags;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_ADVISE: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_usm_advise_params_t *)params;
+        ur::serialize::ur_enqueue_usm_advise_args_t args;
+        args.hQueue = *p->phQueue;
+        args.pMem = *p->ppMem;
+        args.size = *p->psize;
+        args.advice = *p->padvice;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_FILL_2D: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_usm_fill_2d_params_t *)params;
+        ur::serialize::ur_enqueue_usm_fill_2d_args_t args;
+        args.hQueue = *p->phQueue;
+        args.pMem = *p->ppMem;
+        args.pitch = *p->ppitch;
+        args.patternSize = *p->ppatternSize;
+        args.pPattern = *p->ppPattern;
+        args.width = *p->pwidth;
+        args.height = *p->pheight;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_usm_memcpy_2d_params_t *)params;
+        ur::serialize::ur_enqueue_usm_memcpy_2d_args_t args;
+        args.hQueue = *p->phQueue;
+        args.blocking = *p->pblocking;
+        args.pDst = *p->ppDst;
+        args.dstPitch = *p->pdstPitch;
+        args.pSrc = *p->ppSrc;
+        args.srcPitch = *p->psrcPitch;
+        args.width = *p->pwidth;
+        args.height = *p->pheight;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_device_global_variable_write_params_t *)params;
+        ur::serialize::ur_enqueue_device_global_variable_write_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hProgram = *p->phProgram;
+        args.name = *p->pname;
+        args.blockingWrite = *p->pblockingWrite;
+        args.count = *p->pcount;
+        args.offset = *p->poffset;
+        args.pSrc = *p->ppSrc;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_device_global_variable_read_params_t *)params;
+        ur::serialize::ur_enqueue_device_global_variable_read_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hProgram = *p->phProgram;
+        args.name = *p->pname;
+        args.blockingRead = *p->pblockingRead;
+        args.count = *p->pcount;
+        args.offset = *p->poffset;
+        args.pDst = *p->ppDst;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_READ_HOST_PIPE: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_read_host_pipe_params_t *)params;
+        ur::serialize::ur_enqueue_read_host_pipe_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hProgram = *p->phProgram;
+        args.pipe_symbol = *p->ppipe_symbol;
+        args.blocking = *p->pblocking;
+        args.pDst = *p->ppDst;
+        args.size = *p->psize;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_write_host_pipe_params_t *)params;
+        ur::serialize::ur_enqueue_write_host_pipe_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hProgram = *p->phProgram;
+        args.pipe_symbol = *p->ppipe_symbol;
+        args.blocking = *p->pblocking;
+        args.pSrc = *p->ppSrc;
+        args.size = *p->psize;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_kernel_launch_custom_exp_params_t *)params;
+        ur::serialize::ur_enqueue_kernel_launch_custom_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hKernel = *p->phKernel;
+        args.workDim = *p->pworkDim;
+        args.pGlobalWorkSize = *p->ppGlobalWorkSize;
+        args.pLocalWorkSize = *p->ppLocalWorkSize;
+        args.numPropsInLaunchPropList = *p->pnumPropsInLaunchPropList;
+        args.launchPropList = *p->plaunchPropList;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_cooperative_kernel_launch_exp_params_t *)params;
+        ur::serialize::ur_enqueue_cooperative_kernel_launch_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hKernel = *p->phKernel;
+        args.workDim = *p->pworkDim;
+        args.pGlobalWorkOffset = *p->ppGlobalWorkOffset;
+        args.pGlobalWorkSize = *p->ppGlobalWorkSize;
+        args.pLocalWorkSize = *p->ppLocalWorkSize;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_mem_buffer_copy_rect_batch_exp_params_t *)params;
+        ur::serialize::ur_enqueue_mem_buffer_copy_rect_batch_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hBufferSrc = *p->phBufferSrc;
+        args.hBufferDst = *p->phBufferDst;
+        args.numRegions = *p->pnumRegions;
+        args.pSrcOrigins = *p->ppSrcOrigins;
+        args.pDstOrigins = *p->ppDstOrigins;
+        args.pRegions = *p->ppRegions;
+        args.srcRowPitch = *p->psrcRowPitch;
+        args.srcSlicePitch = *p->psrcSlicePitch;
+        args.dstRowPitch = *p->pdstRowPitch;
+        args.dstSlicePitch = *p->pdstSlicePitch;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_kernel_launch_batch_exp_params_t *)params;
+        ur::serialize::ur_enqueue_kernel_launch_batch_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.numLaunches = *p->pnumLaunches;
+        args.pLaunches = *p->ppLaunches;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_timestamp_recording_exp_params_t *)params;
+        ur::serialize::ur_enqueue_timestamp_recording_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.blocking = *p->pblocking;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_timestamp_marker_exp_params_t *)params;
+        ur::serialize::ur_enqueue_timestamp_marker_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.pMarker = *p->ppMarker;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_usm_device_alloc_exp_params_t *)params;
+        ur::serialize::ur_enqueue_usm_device_alloc_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.size = *p->psize;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.ppMem = *p->pppMem;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_FREE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_usm_free_exp_params_t *)params;
+        ur::serialize::ur_enqueue_usm_free_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.pMem = *p->ppMem;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_enqueue_native_command_exp_params_t *)params;
+        ur::serialize::ur_enqueue_native_command_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.pfnNativeEnqueue = *p->ppfnNativeEnqueue;
+        args.data = *p->pdata;
+        args.numMemsInMemList = *p->pnumMemsInMemList;
+        args.phMemList = *p->pphMemList;
+        args.pProperties = *p->ppProperties;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_unsampled_image_handle_destroy_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_unsampled_image_handle_destroy_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.hImage = *p->phImage;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_sampled_image_handle_destroy_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_sampled_image_handle_destroy_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.hImage = *p->phImage;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_image_allocate_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_image_allocate_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.pImageFormat = *p->ppImageFormat;
+        args.pImageDesc = *p->ppImageDesc;
+        args.phImageMem = *p->pphImageMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_image_free_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_image_free_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.hImageMem = *p->phImageMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_unsampled_image_create_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_unsampled_image_create_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.hImageMem = *p->phImageMem;
+        args.pImageFormat = *p->ppImageFormat;
+        args.pImageDesc = *p->ppImageDesc;
+        args.phImage = *p->pphImage;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_sampled_image_create_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_sampled_image_create_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.hImageMem = *p->phImageMem;
+        args.pImageFormat = *p->ppImageFormat;
+        args.pImageDesc = *p->ppImageDesc;
+        args.hSampler = *p->phSampler;
+        args.phImage = *p->pphImage;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_image_copy_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_image_copy_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.pSrc = *p->ppSrc;
+        args.pDst = *p->ppDst;
+        args.pSrcImageDesc = *p->ppSrcImageDesc;
+        args.pDstImageDesc = *p->ppDstImageDesc;
+        args.pSrcImageFormat = *p->ppSrcImageFormat;
+        args.pDstImageFormat = *p->ppDstImageFormat;
+        args.pCopyRegion = *p->ppCopyRegion;
+        args.imageCopyFlags = *p->pimageCopyFlags;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_image_get_info_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_image_get_info_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hImageMem = *p->phImageMem;
+        args.propName = *p->ppropName;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_mipmap_get_level_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_mipmap_get_level_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.hImageMem = *p->phImageMem;
+        args.mipmapLevel = *p->pmipmapLevel;
+        args.phImageMem = *p->pphImageMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_mipmap_free_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_mipmap_free_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.hMem = *p->phMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_import_external_memory_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_import_external_memory_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.size = *p->psize;
+        args.memHandleType = *p->pmemHandleType;
+        args.pExternalMemDesc = *p->ppExternalMemDesc;
+        args.phExternalMem = *p->pphExternalMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_map_external_array_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_map_external_array_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.pImageFormat = *p->ppImageFormat;
+        args.pImageDesc = *p->ppImageDesc;
+        args.hExternalMem = *p->phExternalMem;
+        args.phImageMem = *p->pphImageMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_map_external_linear_memory_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_map_external_linear_memory_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.offset = *p->poffset;
+        args.size = *p->psize;
+        args.hExternalMem = *p->phExternalMem;
+        args.ppRetMem = *p->pppRetMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_release_external_memory_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_release_external_memory_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.hExternalMem = *p->phExternalMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_import_external_semaphore_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_import_external_semaphore_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.semHandleType = *p->psemHandleType;
+        args.pExternalSemaphoreDesc = *p->ppExternalSemaphoreDesc;
+        args.phExternalSemaphore = *p->pphExternalSemaphore;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_release_external_semaphore_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_release_external_semaphore_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.hExternalSemaphore = *p->phExternalSemaphore;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_wait_external_semaphore_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_wait_external_semaphore_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hSemaphore = *p->phSemaphore;
+        args.hasWaitValue = *p->phasWaitValue;
+        args.waitValue = *p->pwaitValue;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_bindless_images_signal_external_semaphore_exp_params_t *)params;
+        ur::serialize::ur_bindless_images_signal_external_semaphore_exp_args_t args;
+        args.hQueue = *p->phQueue;
+        args.hSemaphore = *p->phSemaphore;
+        args.hasSignalValue = *p->phasSignalValue;
+        args.signalValue = *p->psignalValue;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_HOST_ALLOC: {
+        [[maybe_unused]] auto p = (const struct ur_usm_host_alloc_params_t *)params;
+        ur::serialize::ur_usm_host_alloc_args_t args;
+        args.hContext = *p->phContext;
+        args.pUSMDesc = *p->ppUSMDesc;
+        args.pool = *p->ppool;
+        args.size = *p->psize;
+        args.ppMem = *p->pppMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_DEVICE_ALLOC: {
+        [[maybe_unused]] auto p = (const struct ur_usm_device_alloc_params_t *)params;
+        ur::serialize::ur_usm_device_alloc_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.pUSMDesc = *p->ppUSMDesc;
+        args.pool = *p->ppool;
+        args.size = *p->psize;
+        args.ppMem = *p->pppMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_SHARED_ALLOC: {
+        [[maybe_unused]] auto p = (const struct ur_usm_shared_alloc_params_t *)params;
+        ur::serialize::ur_usm_shared_alloc_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.pUSMDesc = *p->ppUSMDesc;
+        args.pool = *p->ppool;
+        args.size = *p->psize;
+        args.ppMem = *p->pppMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_FREE: {
+        [[maybe_unused]] auto p = (const struct ur_usm_free_params_t *)params;
+        ur::serialize::ur_usm_free_args_t args;
+        args.hContext = *p->phContext;
+        args.pMem = *p->ppMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_GET_MEM_ALLOC_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_usm_get_mem_alloc_info_params_t *)params;
+        ur::serialize::ur_usm_get_mem_alloc_info_args_t args;
+        args.hContext = *p->phContext;
+        args.pMem = *p->ppMem;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_POOL_CREATE: {
+        [[maybe_unused]] auto p = (const struct ur_usm_pool_create_params_t *)params;
+        ur::serialize::ur_usm_pool_create_args_t args;
+        args.hContext = *p->phContext;
+        args.pPoolDesc = *p->ppPoolDesc;
+        args.ppPool = *p->pppPool;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_POOL_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_usm_pool_retain_params_t *)params;
+        ur::serialize::ur_usm_pool_retain_args_t args;
+        args.pPool = *p->ppPool;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_POOL_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_usm_pool_release_params_t *)params;
+        ur::serialize::ur_usm_pool_release_args_t args;
+        args.pPool = *p->ppPool;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_POOL_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_usm_pool_get_info_params_t *)params;
+        ur::serialize::ur_usm_pool_get_info_args_t args;
+        args.hPool = *p->phPool;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_PITCHED_ALLOC_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_usm_pitched_alloc_exp_params_t *)params;
+        ur::serialize::ur_usm_pitched_alloc_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.pUSMDesc = *p->ppUSMDesc;
+        args.pool = *p->ppool;
+        args.widthInBytes = *p->pwidthInBytes;
+        args.height = *p->pheight;
+        args.elementSizeBytes = *p->pelementSizeBytes;
+        args.ppMem = *p->pppMem;
+        args.pResultPitch = *p->ppResultPitch;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_GROWABLE_ALLOC_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_usm_growable_alloc_exp_params_t *)params;
+        ur::serialize::ur_usm_growable_alloc_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.maxSize = *p->pmaxSize;
+        args.size = *p->psize;
+        args.ppMem = *p->pppMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_GROWABLE_RESIZE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_usm_growable_resize_exp_params_t *)params;
+        ur::serialize::ur_usm_growable_resize_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.pMem = *p->ppMem;
+        args.size = *p->psize;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_GROWABLE_FREE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_usm_growable_free_exp_params_t *)params;
+        ur::serialize::ur_usm_growable_free_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.pMem = *p->ppMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_IMPORT_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_usm_import_exp_params_t *)params;
+        ur::serialize::ur_usm_import_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.pMem = *p->ppMem;
+        args.size = *p->psize;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_RELEASE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_usm_release_exp_params_t *)params;
+        ur::serialize::ur_usm_release_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.pMem = *p->ppMem;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_POOL_TRIM_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_usm_pool_trim_exp_params_t *)params;
+        ur::serialize::ur_usm_pool_trim_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hPool = *p->phPool;
+        args.minBytesToKeep = *p->pminBytesToKeep;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_create_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_create_exp_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.pCommandBufferDesc = *p->ppCommandBufferDesc;
+        args.phCommandBuffer = *p->pphCommandBuffer;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_retain_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_retain_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_release_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_release_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_finalize_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_finalize_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_kernel_launch_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_kernel_launch_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.hKernel = *p->phKernel;
+        args.workDim = *p->pworkDim;
+        args.pGlobalWorkOffset = *p->ppGlobalWorkOffset;
+        args.pGlobalWorkSize = *p->ppGlobalWorkSize;
+        args.pLocalWorkSize = *p->ppLocalWorkSize;
+        args.numKernelAlternatives = *p->pnumKernelAlternatives;
+        args.phKernelAlternatives = *p->pphKernelAlternatives;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        args.phCommand = *p->pphCommand;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_usm_memcpy_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_usm_memcpy_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.pDst = *p->ppDst;
+        args.pSrc = *p->ppSrc;
+        args.size = *p->psize;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_usm_fill_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_usm_fill_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.pMemory = *p->ppMemory;
+        args.pPattern = *p->ppPattern;
+        args.patternSize = *p->ppatternSize;
+        args.size = *p->psize;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_mem_buffer_copy_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_mem_buffer_copy_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.hSrcMem = *p->phSrcMem;
+        args.hDstMem = *p->phDstMem;
+        args.srcOffset = *p->psrcOffset;
+        args.dstOffset = *p->pdstOffset;
+        args.size = *p->psize;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_mem_buffer_write_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_mem_buffer_write_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.hBuffer = *p->phBuffer;
+        args.offset = *p->poffset;
+        args.size = *p->psize;
+        args.pSrc = *p->ppSrc;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_mem_buffer_read_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_mem_buffer_read_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.hBuffer = *p->phBuffer;
+        args.offset = *p->poffset;
+        args.size = *p->psize;
+        args.pDst = *p->ppDst;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_mem_buffer_copy_rect_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_mem_buffer_copy_rect_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.hSrcMem = *p->phSrcMem;
+        args.hDstMem = *p->phDstMem;
+        args.srcOrigin = *p->psrcOrigin;
+        args.dstOrigin = *p->pdstOrigin;
+        args.region = *p->pregion;
+        args.srcRowPitch = *p->psrcRowPitch;
+        args.srcSlicePitch = *p->psrcSlicePitch;
+        args.dstRowPitch = *p->pdstRowPitch;
+        args.dstSlicePitch = *p->pdstSlicePitch;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_mem_buffer_write_rect_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_mem_buffer_write_rect_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.hBuffer = *p->phBuffer;
+        args.bufferOffset = *p->pbufferOffset;
+        args.hostOffset = *p->phostOffset;
+        args.region = *p->pregion;
+        args.bufferRowPitch = *p->pbufferRowPitch;
+        args.bufferSlicePitch = *p->pbufferSlicePitch;
+        args.hostRowPitch = *p->phostRowPitch;
+        args.hostSlicePitch = *p->phostSlicePitch;
+        args.pSrc = *p->ppSrc;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_mem_buffer_read_rect_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_mem_buffer_read_rect_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.hBuffer = *p->phBuffer;
+        args.bufferOffset = *p->pbufferOffset;
+        args.hostOffset = *p->phostOffset;
+        args.region = *p->pregion;
+        args.bufferRowPitch = *p->pbufferRowPitch;
+        args.bufferSlicePitch = *p->pbufferSlicePitch;
+        args.hostRowPitch = *p->phostRowPitch;
+        args.hostSlicePitch = *p->phostSlicePitch;
+        args.pDst = *p->ppDst;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_mem_buffer_fill_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_mem_buffer_fill_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.hBuffer = *p->phBuffer;
+        args.pPattern = *p->ppPattern;
+        args.patternSize = *p->ppatternSize;
+        args.offset = *p->poffset;
+        args.size = *p->psize;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_usm_prefetch_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_usm_prefetch_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.pMemory = *p->ppMemory;
+        args.size = *p->psize;
+        args.flags = *p->pflags;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_append_usm_advise_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_append_usm_advise_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.pMemory = *p->ppMemory;
+        args.size = *p->psize;
+        args.advice = *p->padvice;
+        args.numSyncPointsInWaitList = *p->pnumSyncPointsInWaitList;
+        args.pSyncPointWaitList = *p->ppSyncPointWaitList;
+        args.pSyncPoint = *p->ppSyncPoint;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_enqueue_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_enqueue_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.hQueue = *p->phQueue;
+        args.numEventsInWaitList = *p->pnumEventsInWaitList;
+        args.phEventWaitList = *p->pphEventWaitList;
+        args.phEvent = *p->pphEvent;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_retain_command_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_retain_command_exp_args_t args;
+        args.hCommand = *p->phCommand;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_release_command_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_release_command_exp_args_t args;
+        args.hCommand = *p->phCommand;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_update_kernel_launch_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_update_kernel_launch_exp_args_t args;
+        args.hCommand = *p->phCommand;
+        args.pUpdateKernelLaunch = *p->ppUpdateKernelLaunch;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_get_info_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_get_info_exp_args_t args;
+        args.hCommandBuffer = *p->phCommandBuffer;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_command_buffer_command_get_info_exp_params_t *)params;
+        ur::serialize::ur_command_buffer_command_get_info_exp_args_t args;
+        args.hCommand = *p->phCommand;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_usm_p2p_enable_peer_access_exp_params_t *)params;
+        ur::serialize::ur_usm_p2p_enable_peer_access_exp_args_t args;
+        args.commandDevice = *p->pcommandDevice;
+        args.peerDevice = *p->ppeerDevice;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_usm_p2p_disable_peer_access_exp_params_t *)params;
+        ur::serialize::ur_usm_p2p_disable_peer_access_exp_args_t args;
+        args.commandDevice = *p->pcommandDevice;
+        args.peerDevice = *p->ppeerDevice;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP: {
+        [[maybe_unused]] auto p = (const struct ur_usm_p2p_peer_access_get_info_exp_params_t *)params;
+        ur::serialize::ur_usm_p2p_peer_access_get_info_exp_args_t args;
+        args.commandDevice = *p->pcommandDevice;
+        args.peerDevice = *p->ppeerDevice;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_LOADER_INIT: {
+        [[maybe_unused]] auto p = (const struct ur_loader_init_params_t *)params;
+        ur::serialize::ur_loader_init_args_t args;
+        args.device_flags = *p->pdevice_flags;
+        args.hLoaderConfig = *p->phLoaderConfig;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_LOADER_TEAR_DOWN: {
+        [[maybe_unused]] auto p = (const struct ur_loader_tear_down_params_t *)params;
+        ur::serialize::ur_loader_tear_down_args_t args;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_virtual_mem_granularity_get_info_params_t *)params;
+        ur::serialize::ur_virtual_mem_granularity_get_info_args_t args;
+        args.hContext = *p->phContext;
+        args.hDevice = *p->phDevice;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_RESERVE: {
+        [[maybe_unused]] auto p = (const struct ur_virtual_mem_reserve_params_t *)params;
+        ur::serialize::ur_virtual_mem_reserve_args_t args;
+        args.hContext = *p->phContext;
+        args.pStart = *p->ppStart;
+        args.size = *p->psize;
+        args.ppStart = *p->pppStart;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_FREE: {
+        [[maybe_unused]] auto p = (const struct ur_virtual_mem_free_params_t *)params;
+        ur::serialize::ur_virtual_mem_free_args_t args;
+        args.hContext = *p->phContext;
+        args.pStart = *p->ppStart;
+        args.size = *p->psize;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_MAP: {
+        [[maybe_unused]] auto p = (const struct ur_virtual_mem_map_params_t *)params;
+        ur::serialize::ur_virtual_mem_map_args_t args;
+        args.hContext = *p->phContext;
+        args.pStart = *p->ppStart;
+        args.size = *p->psize;
+        args.hPhysicalMem = *p->phPhysicalMem;
+        args.offset = *p->poffset;
+        args.flags = *p->pflags;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_UNMAP: {
+        [[maybe_unused]] auto p = (const struct ur_virtual_mem_unmap_params_t *)params;
+        ur::serialize::ur_virtual_mem_unmap_args_t args;
+        args.hContext = *p->phContext;
+        args.pStart = *p->ppStart;
+        args.size = *p->psize;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS: {
+        [[maybe_unused]] auto p = (const struct ur_virtual_mem_set_access_params_t *)params;
+        ur::serialize::ur_virtual_mem_set_access_args_t args;
+        args.hContext = *p->phContext;
+        args.pStart = *p->ppStart;
+        args.size = *p->psize;
+        args.flags = *p->pflags;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_virtual_mem_get_info_params_t *)params;
+        ur::serialize::ur_virtual_mem_get_info_args_t args;
+        args.hContext = *p->phContext;
+        args.pStart = *p->ppStart;
+        args.size = *p->psize;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_DEVICE_GET: {
+        [[maybe_unused]] auto p = (const struct ur_device_get_params_t *)params;
+        ur::serialize::ur_device_get_args_t args;
+        args.hPlatform = *p->phPlatform;
+        args.DeviceType = *p->pDeviceType;
+        args.NumEntries = *p->pNumEntries;
+        args.phDevices = *p->pphDevices;
+        args.pNumDevices = *p->ppNumDevices;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_DEVICE_GET_SELECTED: {
+        [[maybe_unused]] auto p = (const struct ur_device_get_selected_params_t *)params;
+        ur::serialize::ur_device_get_selected_args_t args;
+        args.hPlatform = *p->phPlatform;
+        args.DeviceType = *p->pDeviceType;
+        args.NumEntries = *p->pNumEntries;
+        args.phDevices = *p->pphDevices;
+        args.pNumDevices = *p->ppNumDevices;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_DEVICE_GET_INFO: {
+        [[maybe_unused]] auto p = (const struct ur_device_get_info_params_t *)params;
+        ur::serialize::ur_device_get_info_args_t args;
+        args.hDevice = *p->phDevice;
+        args.propName = *p->ppropName;
+        args.propSize = *p->ppropSize;
+        args.pPropValue = *p->ppPropValue;
+        args.pPropSizeRet = *p->ppPropSizeRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_DEVICE_RETAIN: {
+        [[maybe_unused]] auto p = (const struct ur_device_retain_params_t *)params;
+        ur::serialize::ur_device_retain_args_t args;
+        args.hDevice = *p->phDevice;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_DEVICE_RELEASE: {
+        [[maybe_unused]] auto p = (const struct ur_device_release_params_t *)params;
+        ur::serialize::ur_device_release_args_t args;
+        args.hDevice = *p->phDevice;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_DEVICE_PARTITION: {
+        [[maybe_unused]] auto p = (const struct ur_device_partition_params_t *)params;
+        ur::serialize::ur_device_partition_args_t args;
+        args.hDevice = *p->phDevice;
+        args.pProperties = *p->ppProperties;
+        args.NumDevices = *p->pNumDevices;
+        args.phSubDevices = *p->pphSubDevices;
+        args.pNumDevicesRet = *p->ppNumDevicesRet;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_DEVICE_SELECT_BINARY: {
+        [[maybe_unused]] auto p = (const struct ur_device_select_binary_params_t *)params;
+        ur::serialize::ur_device_select_binary_args_t args;
+        args.hDevice = *p->phDevice;
+        args.pBinaries = *p->ppBinaries;
+        args.NumBinaries = *p->pNumBinaries;
+        args.pSelectedBinary = *p->ppSelectedBinary;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_device_get_native_handle_params_t *)params;
+        ur::serialize::ur_device_get_native_handle_args_t args;
+        args.hDevice = *p->phDevice;
+        args.phNativeDevice = *p->pphNativeDevice;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE: {
+        [[maybe_unused]] auto p = (const struct ur_device_create_with_native_handle_params_t *)params;
+        ur::serialize::ur_device_create_with_native_handle_args_t args;
+        args.hNativeDevice = *p->phNativeDevice;
+        args.hAdapter = *p->phAdapter;
+        args.pProperties = *p->ppProperties;
+        args.phDevice = *p->pphDevice;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    case UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS: {
+        [[maybe_unused]] auto p = (const struct ur_device_get_global_timestamps_params_t *)params;
+        ur::serialize::ur_device_get_global_timestamps_args_t args;
+        args.hDevice = *p->phDevice;
+        args.pDeviceTimestamp = *p->ppDeviceTimestamp;
+        args.pHostTimestamp = *p->ppHostTimestamp;
+        std::memcpy(buffer, &args, sizeof(args));
+    } break;
+    default:
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print serialized function parameters
+/// @details
+///     - Prints the arguments written by serializeFunctionParams in the
+///       format of printFunctionParams, e.g. in another process. Pointer
+///       arguments are printed as addresses, without the data they point to.
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         - `NULL == buffer`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         - `size < getSerializedFunctionParamsSize(function)`
+inline ur_result_t UR_APICALL printSerializedFunctionParams(std::ostream &os, ur_function_t function, const void *buffer, size_t size) {
+    if (!buffer) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    size_t required = getSerializedFunctionParamsSize(function);
+    if (required == 0) {
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    if (size < required) {
+        return UR_RESULT_ERROR_INVALID_SIZE;
+    }
+    switch (function) {
+    case UR_FUNCTION_LOADER_CONFIG_CREATE: {
+        ur::serialize::ur_loader_config_create_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".phLoaderConfig = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phLoaderConfig));
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_RETAIN: {
+        ur::serialize::ur_loader_config_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hLoaderConfig = ";
+        ur::details::printPtr(os, args.hLoaderConfig);
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_RELEASE: {
+        ur::serialize::ur_loader_config_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hLoaderConfig = ";
+        ur::details::printPtr(os, args.hLoaderConfig);
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_GET_INFO: {
+        ur::serialize::ur_loader_config_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hLoaderConfig = ";
+        ur::details::printPtr(os, args.hLoaderConfig);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_ENABLE_LAYER: {
+        ur::serialize::ur_loader_config_enable_layer_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hLoaderConfig = ";
+        ur::details::printPtr(os, args.hLoaderConfig);
+        os << ", ";
+        os << ".pLayerName = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pLayerName));
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_SET_CODE_LOCATION_CALLBACK: {
+        ur::serialize::ur_loader_config_set_code_location_callback_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hLoaderConfig = ";
+        ur::details::printPtr(os, args.hLoaderConfig);
+        os << ", ";
+        os << ".pfnCodeloc = ";
+        os << reinterpret_cast<void *>(args.pfnCodeloc);
+        os << ", ";
+        os << ".pUserData = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pUserData));
+    } break;
+    case UR_FUNCTION_LOADER_CONFIG_SET_MOCKING_ENABLED: {
+        ur::serialize::ur_loader_config_set_mocking_enabled_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hLoaderConfig = ";
+        ur::details::printPtr(os, args.hLoaderConfig);
+        os << ", ";
+        os << ".enable = ";
+        os << args.enable;
+    } break;
+    case UR_FUNCTION_PLATFORM_GET: {
+        ur::serialize::ur_platform_get_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".phAdapters = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phAdapters));
+        os << ", ";
+        os << ".NumAdapters = ";
+        os << args.NumAdapters;
+        os << ", ";
+        os << ".NumEntries = ";
+        os << args.NumEntries;
+        os << ", ";
+        os << ".phPlatforms = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phPlatforms));
+        os << ", ";
+        os << ".pNumPlatforms = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pNumPlatforms));
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_INFO: {
+        ur::serialize::ur_platform_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hPlatform = ";
+        ur::details::printPtr(os, args.hPlatform);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE: {
+        ur::serialize::ur_platform_get_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hPlatform = ";
+        ur::details::printPtr(os, args.hPlatform);
+        os << ", ";
+        os << ".phNativePlatform = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phNativePlatform));
+    } break;
+    case UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE: {
+        ur::serialize::ur_platform_create_with_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hNativePlatform = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hNativePlatform));
+        os << ", ";
+        os << ".hAdapter = ";
+        ur::details::printPtr(os, args.hAdapter);
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phPlatform = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phPlatform));
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_API_VERSION: {
+        ur::serialize::ur_platform_get_api_version_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hPlatform = ";
+        ur::details::printPtr(os, args.hPlatform);
+        os << ", ";
+        os << ".pVersion = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pVersion));
+    } break;
+    case UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION: {
+        ur::serialize::ur_platform_get_backend_option_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hPlatform = ";
+        ur::details::printPtr(os, args.hPlatform);
+        os << ", ";
+        os << ".pFrontendOption = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pFrontendOption));
+        os << ", ";
+        os << ".ppPlatformOption = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppPlatformOption));
+    } break;
+    case UR_FUNCTION_CONTEXT_CREATE: {
+        ur::serialize::ur_context_create_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".DeviceCount = ";
+        os << args.DeviceCount;
+        os << ", ";
+        os << ".phDevices = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phDevices));
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phContext = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phContext));
+    } break;
+    case UR_FUNCTION_CONTEXT_RETAIN: {
+        ur::serialize::ur_context_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+    } break;
+    case UR_FUNCTION_CONTEXT_RELEASE: {
+        ur::serialize::ur_context_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+    } break;
+    case UR_FUNCTION_CONTEXT_GET_INFO: {
+        ur::serialize::ur_context_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE: {
+        ur::serialize::ur_context_get_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".phNativeContext = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phNativeContext));
+    } break;
+    case UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE: {
+        ur::serialize::ur_context_create_with_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hNativeContext = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hNativeContext));
+        os << ", ";
+        os << ".hAdapter = ";
+        ur::details::printPtr(os, args.hAdapter);
+        os << ", ";
+        os << ".numDevices = ";
+        os << args.numDevices;
+        os << ", ";
+        os << ".phDevices = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phDevices));
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phContext = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phContext));
+    } break;
+    case UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER: {
+        ur::serialize::ur_context_set_extended_deleter_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pfnDeleter = ";
+        os << reinterpret_cast<void *>(args.pfnDeleter);
+        os << ", ";
+        os << ".pUserData = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pUserData));
+    } break;
+    case UR_FUNCTION_EVENT_GET_INFO: {
+        ur::serialize::ur_event_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hEvent = ";
+        ur::details::printPtr(os, args.hEvent);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_EVENT_GET_PROFILING_INFO: {
+        ur::serialize::ur_event_get_profiling_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hEvent = ";
+        ur::details::printPtr(os, args.hEvent);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_EVENT_WAIT: {
+        ur::serialize::ur_event_wait_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".numEvents = ";
+        os << args.numEvents;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+    } break;
+    case UR_FUNCTION_EVENT_RETAIN: {
+        ur::serialize::ur_event_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hEvent = ";
+        ur::details::printPtr(os, args.hEvent);
+    } break;
+    case UR_FUNCTION_EVENT_RELEASE: {
+        ur::serialize::ur_event_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hEvent = ";
+        ur::details::printPtr(os, args.hEvent);
+    } break;
+    case UR_FUNCTION_EVENT_GET_NATIVE_HANDLE: {
+        ur::serialize::ur_event_get_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hEvent = ";
+        ur::details::printPtr(os, args.hEvent);
+        os << ", ";
+        os << ".phNativeEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phNativeEvent));
+    } break;
+    case UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE: {
+        ur::serialize::ur_event_create_with_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hNativeEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hNativeEvent));
+        os << ", ";
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_EVENT_SET_CALLBACK: {
+        ur::serialize::ur_event_set_callback_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hEvent = ";
+        ur::details::printPtr(os, args.hEvent);
+        os << ", ";
+        os << ".execStatus = ";
+        os << args.execStatus;
+        os << ", ";
+        os << ".pfnNotify = ";
+        os << reinterpret_cast<void *>(args.pfnNotify);
+        os << ", ";
+        os << ".pUserData = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pUserData));
+    } break;
+    case UR_FUNCTION_EVENT_WAIT_ANY_EXP: {
+        ur::serialize::ur_event_wait_any_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".numEvents = ";
+        os << args.numEvents;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".pEventIndex = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pEventIndex));
+    } break;
+    case UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP: {
+        ur::serialize::ur_event_get_execution_status_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".numEvents = ";
+        os << args.numEvents;
+        os << ", ";
+        os << ".phEvents = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvents));
+        os << ", ";
+        os << ".pStatuses = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pStatuses));
+    } break;
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_IL: {
+        ur::serialize::ur_program_create_with_il_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pIL = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pIL));
+        os << ", ";
+        os << ".length = ";
+        os << args.length;
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phProgram = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phProgram));
+    } break;
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY: {
+        ur::serialize::ur_program_create_with_binary_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".pBinary = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pBinary));
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phProgram = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phProgram));
+    } break;
+    case UR_FUNCTION_PROGRAM_BUILD: {
+        ur::serialize::ur_program_build_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".pOptions = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pOptions));
+    } break;
+    case UR_FUNCTION_PROGRAM_BUILD_EXP: {
+        ur::serialize::ur_program_build_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".numDevices = ";
+        os << args.numDevices;
+        os << ", ";
+        os << ".phDevices = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phDevices));
+        os << ", ";
+        os << ".pOptions = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pOptions));
+    } break;
+    case UR_FUNCTION_PROGRAM_COMPILE: {
+        ur::serialize::ur_program_compile_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".pOptions = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pOptions));
+    } break;
+    case UR_FUNCTION_PROGRAM_COMPILE_EXP: {
+        ur::serialize::ur_program_compile_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".numDevices = ";
+        os << args.numDevices;
+        os << ", ";
+        os << ".phDevices = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phDevices));
+        os << ", ";
+        os << ".pOptions = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pOptions));
+    } break;
+    case UR_FUNCTION_PROGRAM_LINK: {
+        ur::serialize::ur_program_link_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".count = ";
+        os << args.count;
+        os << ", ";
+        os << ".phPrograms = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phPrograms));
+        os << ", ";
+        os << ".pOptions = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pOptions));
+        os << ", ";
+        os << ".phProgram = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phProgram));
+    } break;
+    case UR_FUNCTION_PROGRAM_LINK_EXP: {
+        ur::serialize::ur_program_link_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".numDevices = ";
+        os << args.numDevices;
+        os << ", ";
+        os << ".phDevices = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phDevices));
+        os << ", ";
+        os << ".count = ";
+        os << args.count;
+        os << ", ";
+        os << ".phPrograms = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phPrograms));
+        os << ", ";
+        os << ".pOptions = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pOptions));
+        os << ", ";
+        os << ".phProgram = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phProgram));
+    } break;
+    case UR_FUNCTION_PROGRAM_RETAIN: {
+        ur::serialize::ur_program_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+    } break;
+    case UR_FUNCTION_PROGRAM_RELEASE: {
+        ur::serialize::ur_program_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER: {
+        ur::serialize::ur_program_get_function_pointer_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".pFunctionName = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pFunctionName));
+        os << ", ";
+        os << ".ppFunctionPointer = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppFunctionPointer));
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER: {
+        ur::serialize::ur_program_get_global_variable_pointer_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".pGlobalVariableName = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGlobalVariableName));
+        os << ", ";
+        os << ".pGlobalVariableSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGlobalVariableSizeRet));
+        os << ", ";
+        os << ".ppGlobalVariablePointerRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppGlobalVariablePointerRet));
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_INFO: {
+        ur::serialize::ur_program_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_BUILD_INFO: {
+        ur::serialize::ur_program_get_build_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS: {
+        ur::serialize::ur_program_set_specialization_constants_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".count = ";
+        os << args.count;
+        os << ", ";
+        os << ".pSpecConstants = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSpecConstants));
+    } break;
+    case UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE: {
+        ur::serialize::ur_program_get_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".phNativeProgram = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phNativeProgram));
+    } break;
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE: {
+        ur::serialize::ur_program_create_with_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hNativeProgram = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hNativeProgram));
+        os << ", ";
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phProgram = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phProgram));
+    } break;
+    case UR_FUNCTION_KERNEL_CREATE: {
+        ur::serialize::ur_kernel_create_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".pKernelName = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pKernelName));
+        os << ", ";
+        os << ".phKernel = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phKernel));
+    } break;
+    case UR_FUNCTION_KERNEL_GET_INFO: {
+        ur::serialize::ur_kernel_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_KERNEL_GET_GROUP_INFO: {
+        ur::serialize::ur_kernel_get_group_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO: {
+        ur::serialize::ur_kernel_get_sub_group_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_KERNEL_RETAIN: {
+        ur::serialize::ur_kernel_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+    } break;
+    case UR_FUNCTION_KERNEL_RELEASE: {
+        ur::serialize::ur_kernel_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+    } break;
+    case UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE: {
+        ur::serialize::ur_kernel_get_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".phNativeKernel = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phNativeKernel));
+    } break;
+    case UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE: {
+        ur::serialize::ur_kernel_create_with_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hNativeKernel = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hNativeKernel));
+        os << ", ";
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phKernel = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phKernel));
+    } break;
+    case UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE: {
+        ur::serialize::ur_kernel_get_suggested_local_work_size_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".numWorkDim = ";
+        os << args.numWorkDim;
+        os << ", ";
+        os << ".pGlobalWorkOffset = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGlobalWorkOffset));
+        os << ", ";
+        os << ".pGlobalWorkSize = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGlobalWorkSize));
+        os << ", ";
+        os << ".pSuggestedLocalWorkSize = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSuggestedLocalWorkSize));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_VALUE: {
+        ur::serialize::ur_kernel_set_arg_value_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".argIndex = ";
+        os << args.argIndex;
+        os << ", ";
+        os << ".argSize = ";
+        os << args.argSize;
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".pArgValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pArgValue));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_LOCAL: {
+        ur::serialize::ur_kernel_set_arg_local_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".argIndex = ";
+        os << args.argIndex;
+        os << ", ";
+        os << ".argSize = ";
+        os << args.argSize;
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_POINTER: {
+        ur::serialize::ur_kernel_set_arg_pointer_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".argIndex = ";
+        os << args.argIndex;
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".pArgValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pArgValue));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_EXEC_INFO: {
+        ur::serialize::ur_kernel_set_exec_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_SAMPLER: {
+        ur::serialize::ur_kernel_set_arg_sampler_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".argIndex = ";
+        os << args.argIndex;
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".hArgValue = ";
+        ur::details::printPtr(os, args.hArgValue);
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ: {
+        ur::serialize::ur_kernel_set_arg_mem_obj_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".argIndex = ";
+        os << args.argIndex;
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".hArgValue = ";
+        ur::details::printPtr(os, args.hArgValue);
+    } break;
+    case UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS: {
+        ur::serialize::ur_kernel_set_specialization_constants_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".count = ";
+        os << args.count;
+        os << ", ";
+        os << ".pSpecConstants = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSpecConstants));
+    } break;
+    case UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP: {
+        ur::serialize::ur_kernel_suggest_max_cooperative_group_count_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".localWorkSize = ";
+        os << args.localWorkSize;
+        os << ", ";
+        os << ".dynamicSharedMemorySize = ";
+        os << args.dynamicSharedMemorySize;
+        os << ", ";
+        os << ".pGroupCountRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGroupCountRet));
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARGS_EXP: {
+        ur::serialize::ur_kernel_set_args_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".numArgs = ";
+        os << args.numArgs;
+        os << ", ";
+        os << ".pArgs = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pArgs));
+    } break;
+    case UR_FUNCTION_QUEUE_GET_INFO: {
+        ur::serialize::ur_queue_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_QUEUE_CREATE: {
+        ur::serialize::ur_queue_create_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phQueue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phQueue));
+    } break;
+    case UR_FUNCTION_QUEUE_RETAIN: {
+        ur::serialize::ur_queue_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+    } break;
+    case UR_FUNCTION_QUEUE_RELEASE: {
+        ur::serialize::ur_queue_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+    } break;
+    case UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE: {
+        ur::serialize::ur_queue_get_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".pDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDesc));
+        os << ", ";
+        os << ".phNativeQueue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phNativeQueue));
+    } break;
+    case UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE: {
+        ur::serialize::ur_queue_create_with_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hNativeQueue = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hNativeQueue));
+        os << ", ";
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phQueue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phQueue));
+    } break;
+    case UR_FUNCTION_QUEUE_FINISH: {
+        ur::serialize::ur_queue_finish_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+    } break;
+    case UR_FUNCTION_QUEUE_FLUSH: {
+        ur::serialize::ur_queue_flush_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_CREATE_EXP: {
+        ur::serialize::ur_queue_group_create_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".numQueues = ";
+        os << args.numQueues;
+        os << ", ";
+        os << ".phQueues = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phQueues));
+        os << ", ";
+        os << ".phQueueGroup = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phQueueGroup));
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_RETAIN_EXP: {
+        ur::serialize::ur_queue_group_retain_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueueGroup = ";
+        ur::details::printPtr(os, args.hQueueGroup);
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_RELEASE_EXP: {
+        ur::serialize::ur_queue_group_release_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueueGroup = ";
+        ur::details::printPtr(os, args.hQueueGroup);
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_GET_QUEUE_EXP: {
+        ur::serialize::ur_queue_group_get_queue_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueueGroup = ";
+        ur::details::printPtr(os, args.hQueueGroup);
+        os << ", ";
+        os << ".phQueue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phQueue));
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_FINISH_EXP: {
+        ur::serialize::ur_queue_group_finish_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueueGroup = ";
+        ur::details::printPtr(os, args.hQueueGroup);
+    } break;
+    case UR_FUNCTION_QUEUE_GROUP_BARRIER_EXP: {
+        ur::serialize::ur_queue_group_barrier_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueueGroup = ";
+        ur::details::printPtr(os, args.hQueueGroup);
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP: {
+        ur::serialize::ur_queue_reserve_timestamp_markers_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".capacity = ";
+        os << args.capacity;
+    } break;
+    case UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP: {
+        ur::serialize::ur_queue_read_timestamp_markers_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".firstMarker = ";
+        os << args.firstMarker;
+        os << ", ";
+        os << ".count = ";
+        os << args.count;
+        os << ", ";
+        os << ".pTimestamps = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pTimestamps));
+    } break;
+    case UR_FUNCTION_SAMPLER_CREATE: {
+        ur::serialize::ur_sampler_create_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDesc));
+        os << ", ";
+        os << ".phSampler = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phSampler));
+    } break;
+    case UR_FUNCTION_SAMPLER_RETAIN: {
+        ur::serialize::ur_sampler_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hSampler = ";
+        ur::details::printPtr(os, args.hSampler);
+    } break;
+    case UR_FUNCTION_SAMPLER_RELEASE: {
+        ur::serialize::ur_sampler_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hSampler = ";
+        ur::details::printPtr(os, args.hSampler);
+    } break;
+    case UR_FUNCTION_SAMPLER_GET_INFO: {
+        ur::serialize::ur_sampler_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hSampler = ";
+        ur::details::printPtr(os, args.hSampler);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE: {
+        ur::serialize::ur_sampler_get_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hSampler = ";
+        ur::details::printPtr(os, args.hSampler);
+        os << ", ";
+        os << ".phNativeSampler = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phNativeSampler));
+    } break;
+    case UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE: {
+        ur::serialize::ur_sampler_create_with_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hNativeSampler = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hNativeSampler));
+        os << ", ";
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phSampler = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phSampler));
+    } break;
+    case UR_FUNCTION_MEM_IMAGE_CREATE: {
+        ur::serialize::ur_mem_image_create_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".flags = ";
+        ur::details::printFlag<ur_mem_flag_t>(os, args.flags);
+        os << ", ";
+        os << ".pImageFormat = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageFormat));
+        os << ", ";
+        os << ".pImageDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageDesc));
+        os << ", ";
+        os << ".pHost = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pHost));
+        os << ", ";
+        os << ".phMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phMem));
+    } break;
+    case UR_FUNCTION_MEM_BUFFER_CREATE: {
+        ur::serialize::ur_mem_buffer_create_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".flags = ";
+        ur::details::printFlag<ur_mem_flag_t>(os, args.flags);
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phBuffer = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phBuffer));
+    } break;
+    case UR_FUNCTION_MEM_RETAIN: {
+        ur::serialize::ur_mem_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hMem = ";
+        ur::details::printPtr(os, args.hMem);
+    } break;
+    case UR_FUNCTION_MEM_RELEASE: {
+        ur::serialize::ur_mem_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hMem = ";
+        ur::details::printPtr(os, args.hMem);
+    } break;
+    case UR_FUNCTION_MEM_BUFFER_PARTITION: {
+        ur::serialize::ur_mem_buffer_partition_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".flags = ";
+        ur::details::printFlag<ur_mem_flag_t>(os, args.flags);
+        os << ", ";
+        os << ".bufferCreateType = ";
+        os << args.bufferCreateType;
+        os << ", ";
+        os << ".pRegion = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pRegion));
+        os << ", ";
+        os << ".phMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phMem));
+    } break;
+    case UR_FUNCTION_MEM_GET_NATIVE_HANDLE: {
+        ur::serialize::ur_mem_get_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hMem = ";
+        ur::details::printPtr(os, args.hMem);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".phNativeMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phNativeMem));
+    } break;
+    case UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE: {
+        ur::serialize::ur_mem_buffer_create_with_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hNativeMem = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hNativeMem));
+        os << ", ";
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phMem));
+    } break;
+    case UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE: {
+        ur::serialize::ur_mem_image_create_with_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hNativeMem = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hNativeMem));
+        os << ", ";
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pImageFormat = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageFormat));
+        os << ", ";
+        os << ".pImageDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageDesc));
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phMem));
+    } break;
+    case UR_FUNCTION_MEM_GET_INFO: {
+        ur::serialize::ur_mem_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hMemory = ";
+        ur::details::printPtr(os, args.hMemory);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_MEM_IMAGE_GET_INFO: {
+        ur::serialize::ur_mem_image_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hMemory = ";
+        ur::details::printPtr(os, args.hMemory);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_PHYSICAL_MEM_CREATE: {
+        ur::serialize::ur_physical_mem_create_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phPhysicalMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phPhysicalMem));
+    } break;
+    case UR_FUNCTION_PHYSICAL_MEM_RETAIN: {
+        ur::serialize::ur_physical_mem_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hPhysicalMem = ";
+        ur::details::printPtr(os, args.hPhysicalMem);
+    } break;
+    case UR_FUNCTION_PHYSICAL_MEM_RELEASE: {
+        ur::serialize::ur_physical_mem_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hPhysicalMem = ";
+        ur::details::printPtr(os, args.hPhysicalMem);
+    } break;
+    case UR_FUNCTION_ADAPTER_GET: {
+        ur::serialize::ur_adapter_get_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".NumEntries = ";
+        os << args.NumEntries;
+        os << ", ";
+        os << ".phAdapters = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phAdapters));
+        os << ", ";
+        os << ".pNumAdapters = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pNumAdapters));
+    } break;
+    case UR_FUNCTION_ADAPTER_RELEASE: {
+        ur::serialize::ur_adapter_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hAdapter = ";
+        ur::details::printPtr(os, args.hAdapter);
+    } break;
+    case UR_FUNCTION_ADAPTER_RETAIN: {
+        ur::serialize::ur_adapter_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hAdapter = ";
+        ur::details::printPtr(os, args.hAdapter);
+    } break;
+    case UR_FUNCTION_ADAPTER_GET_LAST_ERROR: {
+        ur::serialize::ur_adapter_get_last_error_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hAdapter = ";
+        ur::details::printPtr(os, args.hAdapter);
+        os << ", ";
+        os << ".ppMessage = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppMessage));
+        os << ", ";
+        os << ".pError = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pError));
+    } break;
+    case UR_FUNCTION_ADAPTER_GET_INFO: {
+        ur::serialize::ur_adapter_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hAdapter = ";
+        ur::details::printPtr(os, args.hAdapter);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH: {
+        ur::serialize::ur_enqueue_kernel_launch_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".workDim = ";
+        os << args.workDim;
+        os << ", ";
+        os << ".pGlobalWorkOffset = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGlobalWorkOffset));
+        os << ", ";
+        os << ".pGlobalWorkSize = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGlobalWorkSize));
+        os << ", ";
+        os << ".pLocalWorkSize = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pLocalWorkSize));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT: {
+        ur::serialize::ur_enqueue_events_wait_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER: {
+        ur::serialize::ur_enqueue_events_wait_with_barrier_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ: {
+        ur::serialize::ur_enqueue_mem_buffer_read_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".blockingRead = ";
+        os << args.blockingRead;
+        os << ", ";
+        os << ".offset = ";
+        os << args.offset;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".pDst = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDst));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE: {
+        ur::serialize::ur_enqueue_mem_buffer_write_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".blockingWrite = ";
+        os << args.blockingWrite;
+        os << ", ";
+        os << ".offset = ";
+        os << args.offset;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".pSrc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrc));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT: {
+        ur::serialize::ur_enqueue_mem_buffer_read_rect_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".blockingRead = ";
+        os << args.blockingRead;
+        os << ", ";
+        os << ".bufferOrigin = ";
+        os << args.bufferOrigin;
+        os << ", ";
+        os << ".hostOrigin = ";
+        os << args.hostOrigin;
+        os << ", ";
+        os << ".region = ";
+        os << args.region;
+        os << ", ";
+        os << ".bufferRowPitch = ";
+        os << args.bufferRowPitch;
+        os << ", ";
+        os << ".bufferSlicePitch = ";
+        os << args.bufferSlicePitch;
+        os << ", ";
+        os << ".hostRowPitch = ";
+        os << args.hostRowPitch;
+        os << ", ";
+        os << ".hostSlicePitch = ";
+        os << args.hostSlicePitch;
+        os << ", ";
+        os << ".pDst = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDst));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT: {
+        ur::serialize::ur_enqueue_mem_buffer_write_rect_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".blockingWrite = ";
+        os << args.blockingWrite;
+        os << ", ";
+        os << ".bufferOrigin = ";
+        os << args.bufferOrigin;
+        os << ", ";
+        os << ".hostOrigin = ";
+        os << args.hostOrigin;
+        os << ", ";
+        os << ".region = ";
+        os << args.region;
+        os << ", ";
+        os << ".bufferRowPitch = ";
+        os << args.bufferRowPitch;
+        os << ", ";
+        os << ".bufferSlicePitch = ";
+        os << args.bufferSlicePitch;
+        os << ", ";
+        os << ".hostRowPitch = ";
+        os << args.hostRowPitch;
+        os << ", ";
+        os << ".hostSlicePitch = ";
+        os << args.hostSlicePitch;
+        os << ", ";
+        os << ".pSrc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrc));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY: {
+        ur::serialize::ur_enqueue_mem_buffer_copy_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hBufferSrc = ";
+        ur::details::printPtr(os, args.hBufferSrc);
+        os << ", ";
+        os << ".hBufferDst = ";
+        ur::details::printPtr(os, args.hBufferDst);
+        os << ", ";
+        os << ".srcOffset = ";
+        os << args.srcOffset;
+        os << ", ";
+        os << ".dstOffset = ";
+        os << args.dstOffset;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT: {
+        ur::serialize::ur_enqueue_mem_buffer_copy_rect_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hBufferSrc = ";
+        ur::details::printPtr(os, args.hBufferSrc);
+        os << ", ";
+        os << ".hBufferDst = ";
+        ur::details::printPtr(os, args.hBufferDst);
+        os << ", ";
+        os << ".srcOrigin = ";
+        os << args.srcOrigin;
+        os << ", ";
+        os << ".dstOrigin = ";
+        os << args.dstOrigin;
+        os << ", ";
+        os << ".region = ";
+        os << args.region;
+        os << ", ";
+        os << ".srcRowPitch = ";
+        os << args.srcRowPitch;
+        os << ", ";
+        os << ".srcSlicePitch = ";
+        os << args.srcSlicePitch;
+        os << ", ";
+        os << ".dstRowPitch = ";
+        os << args.dstRowPitch;
+        os << ", ";
+        os << ".dstSlicePitch = ";
+        os << args.dstSlicePitch;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL: {
+        ur::serialize::ur_enqueue_mem_buffer_fill_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".pPattern = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPattern));
+        os << ", ";
+        os << ".patternSize = ";
+        os << args.patternSize;
+        os << ", ";
+        os << ".offset = ";
+        os << args.offset;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ: {
+        ur::serialize::ur_enqueue_mem_image_read_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hImage = ";
+        ur::details::printPtr(os, args.hImage);
+        os << ", ";
+        os << ".blockingRead = ";
+        os << args.blockingRead;
+        os << ", ";
+        os << ".origin = ";
+        os << args.origin;
+        os << ", ";
+        os << ".region = ";
+        os << args.region;
+        os << ", ";
+        os << ".rowPitch = ";
+        os << args.rowPitch;
+        os << ", ";
+        os << ".slicePitch = ";
+        os << args.slicePitch;
+        os << ", ";
+        os << ".pDst = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDst));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE: {
+        ur::serialize::ur_enqueue_mem_image_write_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hImage = ";
+        ur::details::printPtr(os, args.hImage);
+        os << ", ";
+        os << ".blockingWrite = ";
+        os << args.blockingWrite;
+        os << ", ";
+        os << ".origin = ";
+        os << args.origin;
+        os << ", ";
+        os << ".region = ";
+        os << args.region;
+        os << ", ";
+        os << ".rowPitch = ";
+        os << args.rowPitch;
+        os << ", ";
+        os << ".slicePitch = ";
+        os << args.slicePitch;
+        os << ", ";
+        os << ".pSrc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrc));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY: {
+        ur::serialize::ur_enqueue_mem_image_copy_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hImageSrc = ";
+        ur::details::printPtr(os, args.hImageSrc);
+        os << ", ";
+        os << ".hImageDst = ";
+        ur::details::printPtr(os, args.hImageDst);
+        os << ", ";
+        os << ".srcOrigin = ";
+        os << args.srcOrigin;
+        os << ", ";
+        os << ".dstOrigin = ";
+        os << args.dstOrigin;
+        os << ", ";
+        os << ".region = ";
+        os << args.region;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP: {
+        ur::serialize::ur_enqueue_mem_buffer_map_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".blockingMap = ";
+        os << args.blockingMap;
+        os << ", ";
+        os << ".mapFlags = ";
+        ur::details::printFlag<ur_map_flag_t>(os, args.mapFlags);
+        os << ", ";
+        os << ".offset = ";
+        os << args.offset;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+        os << ", ";
+        os << ".ppRetMap = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppRetMap));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_UNMAP: {
+        ur::serialize::ur_enqueue_mem_unmap_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hMem = ";
+        ur::details::printPtr(os, args.hMem);
+        os << ", ";
+        os << ".pMappedPtr = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMappedPtr));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_FILL: {
+        ur::serialize::ur_enqueue_usm_fill_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".pMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMem));
+        os << ", ";
+        os << ".patternSize = ";
+        os << args.patternSize;
+        os << ", ";
+        os << ".pPattern = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPattern));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY: {
+        ur::serialize::ur_enqueue_usm_memcpy_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".blocking = ";
+        os << args.blocking;
+        os << ", ";
+        os << ".pDst = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDst));
+        os << ", ";
+        os << ".pSrc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrc));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_PREFETCH: {
+        ur::serialize::ur_enqueue_usm_prefetch_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".pMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMem));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".flags = ";
+        ur::details::printFlag<ur_usm_migration_flag_t>(os, args.flags);
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_ADVISE: {
+        ur::serialize::ur_enqueue_usm_advise_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".pMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMem));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".advice = ";
+        ur::details::printFlag<ur_usm_advice_flag_t>(os, args.advice);
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_FILL_2D: {
+        ur::serialize::ur_enqueue_usm_fill_2d_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".pMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMem));
+        os << ", ";
+        os << ".pitch = ";
+        os << args.pitch;
+        os << ", ";
+        os << ".patternSize = ";
+        os << args.patternSize;
+        os << ", ";
+        os << ".pPattern = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPattern));
+        os << ", ";
+        os << ".width = ";
+        os << args.width;
+        os << ", ";
+        os << ".height = ";
+        os << args.height;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D: {
+        ur::serialize::ur_enqueue_usm_memcpy_2d_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".blocking = ";
+        os << args.blocking;
+        os << ", ";
+        os << ".pDst = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDst));
+        os << ", ";
+        os << ".dstPitch = ";
+        os << args.dstPitch;
+        os << ", ";
+        os << ".pSrc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrc));
+        os << ", ";
+        os << ".srcPitch = ";
+        os << args.srcPitch;
+        os << ", ";
+        os << ".width = ";
+        os << args.width;
+        os << ", ";
+        os << ".height = ";
+        os << args.height;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE: {
+        ur::serialize::ur_enqueue_device_global_variable_write_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".name = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.name));
+        os << ", ";
+        os << ".blockingWrite = ";
+        os << args.blockingWrite;
+        os << ", ";
+        os << ".count = ";
+        os << args.count;
+        os << ", ";
+        os << ".offset = ";
+        os << args.offset;
+        os << ", ";
+        os << ".pSrc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrc));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ: {
+        ur::serialize::ur_enqueue_device_global_variable_read_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".name = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.name));
+        os << ", ";
+        os << ".blockingRead = ";
+        os << args.blockingRead;
+        os << ", ";
+        os << ".count = ";
+        os << args.count;
+        os << ", ";
+        os << ".offset = ";
+        os << args.offset;
+        os << ", ";
+        os << ".pDst = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDst));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_READ_HOST_PIPE: {
+        ur::serialize::ur_enqueue_read_host_pipe_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".pipe_symbol = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pipe_symbol));
+        os << ", ";
+        os << ".blocking = ";
+        os << args.blocking;
+        os << ", ";
+        os << ".pDst = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDst));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE: {
+        ur::serialize::ur_enqueue_write_host_pipe_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hProgram = ";
+        ur::details::printPtr(os, args.hProgram);
+        os << ", ";
+        os << ".pipe_symbol = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pipe_symbol));
+        os << ", ";
+        os << ".blocking = ";
+        os << args.blocking;
+        os << ", ";
+        os << ".pSrc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrc));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP: {
+        ur::serialize::ur_enqueue_kernel_launch_custom_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".workDim = ";
+        os << args.workDim;
+        os << ", ";
+        os << ".pGlobalWorkSize = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGlobalWorkSize));
+        os << ", ";
+        os << ".pLocalWorkSize = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pLocalWorkSize));
+        os << ", ";
+        os << ".numPropsInLaunchPropList = ";
+        os << args.numPropsInLaunchPropList;
+        os << ", ";
+        os << ".launchPropList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.launchPropList));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP: {
+        ur::serialize::ur_enqueue_cooperative_kernel_launch_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".workDim = ";
+        os << args.workDim;
+        os << ", ";
+        os << ".pGlobalWorkOffset = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGlobalWorkOffset));
+        os << ", ";
+        os << ".pGlobalWorkSize = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGlobalWorkSize));
+        os << ", ";
+        os << ".pLocalWorkSize = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pLocalWorkSize));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP: {
+        ur::serialize::ur_enqueue_mem_buffer_copy_rect_batch_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hBufferSrc = ";
+        ur::details::printPtr(os, args.hBufferSrc);
+        os << ", ";
+        os << ".hBufferDst = ";
+        ur::details::printPtr(os, args.hBufferDst);
+        os << ", ";
+        os << ".numRegions = ";
+        os << args.numRegions;
+        os << ", ";
+        os << ".pSrcOrigins = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrcOrigins));
+        os << ", ";
+        os << ".pDstOrigins = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDstOrigins));
+        os << ", ";
+        os << ".pRegions = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pRegions));
+        os << ", ";
+        os << ".srcRowPitch = ";
+        os << args.srcRowPitch;
+        os << ", ";
+        os << ".srcSlicePitch = ";
+        os << args.srcSlicePitch;
+        os << ", ";
+        os << ".dstRowPitch = ";
+        os << args.dstRowPitch;
+        os << ", ";
+        os << ".dstSlicePitch = ";
+        os << args.dstSlicePitch;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP: {
+        ur::serialize::ur_enqueue_kernel_launch_batch_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".numLaunches = ";
+        os << args.numLaunches;
+        os << ", ";
+        os << ".pLaunches = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pLaunches));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP: {
+        ur::serialize::ur_enqueue_timestamp_recording_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".blocking = ";
+        os << args.blocking;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP: {
+        ur::serialize::ur_enqueue_timestamp_marker_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".pMarker = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMarker));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP: {
+        ur::serialize::ur_enqueue_usm_device_alloc_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".ppMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppMem));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_FREE_EXP: {
+        ur::serialize::ur_enqueue_usm_free_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".pMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMem));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP: {
+        ur::serialize::ur_enqueue_native_command_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".pfnNativeEnqueue = ";
+        os << reinterpret_cast<void *>(args.pfnNativeEnqueue);
+        os << ", ";
+        os << ".data = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.data));
+        os << ", ";
+        os << ".numMemsInMemList = ";
+        os << args.numMemsInMemList;
+        os << ", ";
+        os << ".phMemList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phMemList));
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP: {
+        ur::serialize::ur_bindless_images_unsampled_image_handle_destroy_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".hImage = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hImage));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP: {
+        ur::serialize::ur_bindless_images_sampled_image_handle_destroy_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".hImage = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hImage));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP: {
+        ur::serialize::ur_bindless_images_image_allocate_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".pImageFormat = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageFormat));
+        os << ", ";
+        os << ".pImageDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageDesc));
+        os << ", ";
+        os << ".phImageMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phImageMem));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP: {
+        ur::serialize::ur_bindless_images_image_free_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".hImageMem = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hImageMem));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP: {
+        ur::serialize::ur_bindless_images_unsampled_image_create_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".hImageMem = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hImageMem));
+        os << ", ";
+        os << ".pImageFormat = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageFormat));
+        os << ", ";
+        os << ".pImageDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageDesc));
+        os << ", ";
+        os << ".phImage = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phImage));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP: {
+        ur::serialize::ur_bindless_images_sampled_image_create_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".hImageMem = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hImageMem));
+        os << ", ";
+        os << ".pImageFormat = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageFormat));
+        os << ", ";
+        os << ".pImageDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageDesc));
+        os << ", ";
+        os << ".hSampler = ";
+        ur::details::printPtr(os, args.hSampler);
+        os << ", ";
+        os << ".phImage = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phImage));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP: {
+        ur::serialize::ur_bindless_images_image_copy_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".pSrc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrc));
+        os << ", ";
+        os << ".pDst = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDst));
+        os << ", ";
+        os << ".pSrcImageDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrcImageDesc));
+        os << ", ";
+        os << ".pDstImageDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDstImageDesc));
+        os << ", ";
+        os << ".pSrcImageFormat = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrcImageFormat));
+        os << ", ";
+        os << ".pDstImageFormat = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDstImageFormat));
+        os << ", ";
+        os << ".pCopyRegion = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pCopyRegion));
+        os << ", ";
+        os << ".imageCopyFlags = ";
+        ur::details::printFlag<ur_exp_image_copy_flag_t>(os, args.imageCopyFlags);
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP: {
+        ur::serialize::ur_bindless_images_image_get_info_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hImageMem = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hImageMem));
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP: {
+        ur::serialize::ur_bindless_images_mipmap_get_level_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".hImageMem = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hImageMem));
+        os << ", ";
+        os << ".mipmapLevel = ";
+        os << args.mipmapLevel;
+        os << ", ";
+        os << ".phImageMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phImageMem));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP: {
+        ur::serialize::ur_bindless_images_mipmap_free_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".hMem = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hMem));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP: {
+        ur::serialize::ur_bindless_images_import_external_memory_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".memHandleType = ";
+        os << args.memHandleType;
+        os << ", ";
+        os << ".pExternalMemDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pExternalMemDesc));
+        os << ", ";
+        os << ".phExternalMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phExternalMem));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP: {
+        ur::serialize::ur_bindless_images_map_external_array_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".pImageFormat = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageFormat));
+        os << ", ";
+        os << ".pImageDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pImageDesc));
+        os << ", ";
+        os << ".hExternalMem = ";
+        ur::details::printPtr(os, args.hExternalMem);
+        os << ", ";
+        os << ".phImageMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phImageMem));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP: {
+        ur::serialize::ur_bindless_images_map_external_linear_memory_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".offset = ";
+        os << args.offset;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".hExternalMem = ";
+        ur::details::printPtr(os, args.hExternalMem);
+        os << ", ";
+        os << ".ppRetMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppRetMem));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP: {
+        ur::serialize::ur_bindless_images_release_external_memory_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".hExternalMem = ";
+        ur::details::printPtr(os, args.hExternalMem);
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP: {
+        ur::serialize::ur_bindless_images_import_external_semaphore_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".semHandleType = ";
+        os << args.semHandleType;
+        os << ", ";
+        os << ".pExternalSemaphoreDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pExternalSemaphoreDesc));
+        os << ", ";
+        os << ".phExternalSemaphore = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phExternalSemaphore));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP: {
+        ur::serialize::ur_bindless_images_release_external_semaphore_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".hExternalSemaphore = ";
+        ur::details::printPtr(os, args.hExternalSemaphore);
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP: {
+        ur::serialize::ur_bindless_images_wait_external_semaphore_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hSemaphore = ";
+        ur::details::printPtr(os, args.hSemaphore);
+        os << ", ";
+        os << ".hasWaitValue = ";
+        os << args.hasWaitValue;
+        os << ", ";
+        os << ".waitValue = ";
+        os << args.waitValue;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP: {
+        ur::serialize::ur_bindless_images_signal_external_semaphore_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".hSemaphore = ";
+        ur::details::printPtr(os, args.hSemaphore);
+        os << ", ";
+        os << ".hasSignalValue = ";
+        os << args.hasSignalValue;
+        os << ", ";
+        os << ".signalValue = ";
+        os << args.signalValue;
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_USM_HOST_ALLOC: {
+        ur::serialize::ur_usm_host_alloc_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pUSMDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pUSMDesc));
+        os << ", ";
+        os << ".pool = ";
+        ur::details::printPtr(os, args.pool);
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".ppMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppMem));
+    } break;
+    case UR_FUNCTION_USM_DEVICE_ALLOC: {
+        ur::serialize::ur_usm_device_alloc_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".pUSMDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pUSMDesc));
+        os << ", ";
+        os << ".pool = ";
+        ur::details::printPtr(os, args.pool);
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".ppMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppMem));
+    } break;
+    case UR_FUNCTION_USM_SHARED_ALLOC: {
+        ur::serialize::ur_usm_shared_alloc_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".pUSMDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pUSMDesc));
+        os << ", ";
+        os << ".pool = ";
+        ur::details::printPtr(os, args.pool);
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".ppMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppMem));
+    } break;
+    case UR_FUNCTION_USM_FREE: {
+        ur::serialize::ur_usm_free_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMem));
+    } break;
+    case UR_FUNCTION_USM_GET_MEM_ALLOC_INFO: {
+        ur::serialize::ur_usm_get_mem_alloc_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMem));
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_USM_POOL_CREATE: {
+        ur::serialize::ur_usm_pool_create_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pPoolDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPoolDesc));
+        os << ", ";
+        os << ".ppPool = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppPool));
+    } break;
+    case UR_FUNCTION_USM_POOL_RETAIN: {
+        ur::serialize::ur_usm_pool_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".pPool = ";
+        ur::details::printPtr(os, args.pPool);
+    } break;
+    case UR_FUNCTION_USM_POOL_RELEASE: {
+        ur::serialize::ur_usm_pool_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".pPool = ";
+        ur::details::printPtr(os, args.pPool);
+    } break;
+    case UR_FUNCTION_USM_POOL_GET_INFO: {
+        ur::serialize::ur_usm_pool_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hPool = ";
+        ur::details::printPtr(os, args.hPool);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_USM_PITCHED_ALLOC_EXP: {
+        ur::serialize::ur_usm_pitched_alloc_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".pUSMDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pUSMDesc));
+        os << ", ";
+        os << ".pool = ";
+        ur::details::printPtr(os, args.pool);
+        os << ", ";
+        os << ".widthInBytes = ";
+        os << args.widthInBytes;
+        os << ", ";
+        os << ".height = ";
+        os << args.height;
+        os << ", ";
+        os << ".elementSizeBytes = ";
+        os << args.elementSizeBytes;
+        os << ", ";
+        os << ".ppMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppMem));
+        os << ", ";
+        os << ".pResultPitch = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pResultPitch));
+    } break;
+    case UR_FUNCTION_USM_GROWABLE_ALLOC_EXP: {
+        ur::serialize::ur_usm_growable_alloc_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".maxSize = ";
+        os << args.maxSize;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".ppMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppMem));
+    } break;
+    case UR_FUNCTION_USM_GROWABLE_RESIZE_EXP: {
+        ur::serialize::ur_usm_growable_resize_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMem));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+    } break;
+    case UR_FUNCTION_USM_GROWABLE_FREE_EXP: {
+        ur::serialize::ur_usm_growable_free_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMem));
+    } break;
+    case UR_FUNCTION_USM_IMPORT_EXP: {
+        ur::serialize::ur_usm_import_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMem));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+    } break;
+    case UR_FUNCTION_USM_RELEASE_EXP: {
+        ur::serialize::ur_usm_release_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pMem = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMem));
+    } break;
+    case UR_FUNCTION_USM_POOL_TRIM_EXP: {
+        ur::serialize::ur_usm_pool_trim_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hPool = ";
+        ur::details::printPtr(os, args.hPool);
+        os << ", ";
+        os << ".minBytesToKeep = ";
+        os << args.minBytesToKeep;
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP: {
+        ur::serialize::ur_command_buffer_create_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".pCommandBufferDesc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pCommandBufferDesc));
+        os << ", ";
+        os << ".phCommandBuffer = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phCommandBuffer));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP: {
+        ur::serialize::ur_command_buffer_retain_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP: {
+        ur::serialize::ur_command_buffer_release_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP: {
+        ur::serialize::ur_command_buffer_finalize_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP: {
+        ur::serialize::ur_command_buffer_append_kernel_launch_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".hKernel = ";
+        ur::details::printPtr(os, args.hKernel);
+        os << ", ";
+        os << ".workDim = ";
+        os << args.workDim;
+        os << ", ";
+        os << ".pGlobalWorkOffset = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGlobalWorkOffset));
+        os << ", ";
+        os << ".pGlobalWorkSize = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pGlobalWorkSize));
+        os << ", ";
+        os << ".pLocalWorkSize = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pLocalWorkSize));
+        os << ", ";
+        os << ".numKernelAlternatives = ";
+        os << args.numKernelAlternatives;
+        os << ", ";
+        os << ".phKernelAlternatives = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phKernelAlternatives));
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+        os << ", ";
+        os << ".phCommand = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phCommand));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP: {
+        ur::serialize::ur_command_buffer_append_usm_memcpy_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".pDst = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDst));
+        os << ", ";
+        os << ".pSrc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrc));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP: {
+        ur::serialize::ur_command_buffer_append_usm_fill_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".pMemory = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMemory));
+        os << ", ";
+        os << ".pPattern = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPattern));
+        os << ", ";
+        os << ".patternSize = ";
+        os << args.patternSize;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP: {
+        ur::serialize::ur_command_buffer_append_mem_buffer_copy_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".hSrcMem = ";
+        ur::details::printPtr(os, args.hSrcMem);
+        os << ", ";
+        os << ".hDstMem = ";
+        ur::details::printPtr(os, args.hDstMem);
+        os << ", ";
+        os << ".srcOffset = ";
+        os << args.srcOffset;
+        os << ", ";
+        os << ".dstOffset = ";
+        os << args.dstOffset;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP: {
+        ur::serialize::ur_command_buffer_append_mem_buffer_write_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".offset = ";
+        os << args.offset;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".pSrc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrc));
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP: {
+        ur::serialize::ur_command_buffer_append_mem_buffer_read_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".offset = ";
+        os << args.offset;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".pDst = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDst));
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP: {
+        ur::serialize::ur_command_buffer_append_mem_buffer_copy_rect_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".hSrcMem = ";
+        ur::details::printPtr(os, args.hSrcMem);
+        os << ", ";
+        os << ".hDstMem = ";
+        ur::details::printPtr(os, args.hDstMem);
+        os << ", ";
+        os << ".srcOrigin = ";
+        os << args.srcOrigin;
+        os << ", ";
+        os << ".dstOrigin = ";
+        os << args.dstOrigin;
+        os << ", ";
+        os << ".region = ";
+        os << args.region;
+        os << ", ";
+        os << ".srcRowPitch = ";
+        os << args.srcRowPitch;
+        os << ", ";
+        os << ".srcSlicePitch = ";
+        os << args.srcSlicePitch;
+        os << ", ";
+        os << ".dstRowPitch = ";
+        os << args.dstRowPitch;
+        os << ", ";
+        os << ".dstSlicePitch = ";
+        os << args.dstSlicePitch;
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP: {
+        ur::serialize::ur_command_buffer_append_mem_buffer_write_rect_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".bufferOffset = ";
+        os << args.bufferOffset;
+        os << ", ";
+        os << ".hostOffset = ";
+        os << args.hostOffset;
+        os << ", ";
+        os << ".region = ";
+        os << args.region;
+        os << ", ";
+        os << ".bufferRowPitch = ";
+        os << args.bufferRowPitch;
+        os << ", ";
+        os << ".bufferSlicePitch = ";
+        os << args.bufferSlicePitch;
+        os << ", ";
+        os << ".hostRowPitch = ";
+        os << args.hostRowPitch;
+        os << ", ";
+        os << ".hostSlicePitch = ";
+        os << args.hostSlicePitch;
+        os << ", ";
+        os << ".pSrc = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSrc));
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP: {
+        ur::serialize::ur_command_buffer_append_mem_buffer_read_rect_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".bufferOffset = ";
+        os << args.bufferOffset;
+        os << ", ";
+        os << ".hostOffset = ";
+        os << args.hostOffset;
+        os << ", ";
+        os << ".region = ";
+        os << args.region;
+        os << ", ";
+        os << ".bufferRowPitch = ";
+        os << args.bufferRowPitch;
+        os << ", ";
+        os << ".bufferSlicePitch = ";
+        os << args.bufferSlicePitch;
+        os << ", ";
+        os << ".hostRowPitch = ";
+        os << args.hostRowPitch;
+        os << ", ";
+        os << ".hostSlicePitch = ";
+        os << args.hostSlicePitch;
+        os << ", ";
+        os << ".pDst = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDst));
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP: {
+        ur::serialize::ur_command_buffer_append_mem_buffer_fill_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".hBuffer = ";
+        ur::details::printPtr(os, args.hBuffer);
+        os << ", ";
+        os << ".pPattern = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPattern));
+        os << ", ";
+        os << ".patternSize = ";
+        os << args.patternSize;
+        os << ", ";
+        os << ".offset = ";
+        os << args.offset;
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP: {
+        ur::serialize::ur_command_buffer_append_usm_prefetch_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".pMemory = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMemory));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".flags = ";
+        ur::details::printFlag<ur_usm_migration_flag_t>(os, args.flags);
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP: {
+        ur::serialize::ur_command_buffer_append_usm_advise_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".pMemory = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pMemory));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".advice = ";
+        ur::details::printFlag<ur_usm_advice_flag_t>(os, args.advice);
+        os << ", ";
+        os << ".numSyncPointsInWaitList = ";
+        os << args.numSyncPointsInWaitList;
+        os << ", ";
+        os << ".pSyncPointWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPointWaitList));
+        os << ", ";
+        os << ".pSyncPoint = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSyncPoint));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP: {
+        ur::serialize::ur_command_buffer_enqueue_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".hQueue = ";
+        ur::details::printPtr(os, args.hQueue);
+        os << ", ";
+        os << ".numEventsInWaitList = ";
+        os << args.numEventsInWaitList;
+        os << ", ";
+        os << ".phEventWaitList = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEventWaitList));
+        os << ", ";
+        os << ".phEvent = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phEvent));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP: {
+        ur::serialize::ur_command_buffer_retain_command_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommand = ";
+        ur::details::printPtr(os, args.hCommand);
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP: {
+        ur::serialize::ur_command_buffer_release_command_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommand = ";
+        ur::details::printPtr(os, args.hCommand);
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP: {
+        ur::serialize::ur_command_buffer_update_kernel_launch_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommand = ";
+        ur::details::printPtr(os, args.hCommand);
+        os << ", ";
+        os << ".pUpdateKernelLaunch = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pUpdateKernelLaunch));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP: {
+        ur::serialize::ur_command_buffer_get_info_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommandBuffer = ";
+        ur::details::printPtr(os, args.hCommandBuffer);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP: {
+        ur::serialize::ur_command_buffer_command_get_info_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hCommand = ";
+        ur::details::printPtr(os, args.hCommand);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP: {
+        ur::serialize::ur_usm_p2p_enable_peer_access_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".commandDevice = ";
+        ur::details::printPtr(os, args.commandDevice);
+        os << ", ";
+        os << ".peerDevice = ";
+        ur::details::printPtr(os, args.peerDevice);
+    } break;
+    case UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP: {
+        ur::serialize::ur_usm_p2p_disable_peer_access_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".commandDevice = ";
+        ur::details::printPtr(os, args.commandDevice);
+        os << ", ";
+        os << ".peerDevice = ";
+        ur::details::printPtr(os, args.peerDevice);
+    } break;
+    case UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP: {
+        ur::serialize::ur_usm_p2p_peer_access_get_info_exp_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".commandDevice = ";
+        ur::details::printPtr(os, args.commandDevice);
+        os << ", ";
+        os << ".peerDevice = ";
+        ur::details::printPtr(os, args.peerDevice);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_LOADER_INIT: {
+        ur::serialize::ur_loader_init_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".device_flags = ";
+        ur::details::printFlag<ur_device_init_flag_t>(os, args.device_flags);
+        os << ", ";
+        os << ".hLoaderConfig = ";
+        ur::details::printPtr(os, args.hLoaderConfig);
+    } break;
+    case UR_FUNCTION_LOADER_TEAR_DOWN: {
+        ur::serialize::ur_loader_tear_down_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO: {
+        ur::serialize::ur_virtual_mem_granularity_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_RESERVE: {
+        ur::serialize::ur_virtual_mem_reserve_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pStart = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pStart));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".ppStart = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.ppStart));
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_FREE: {
+        ur::serialize::ur_virtual_mem_free_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pStart = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pStart));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_MAP: {
+        ur::serialize::ur_virtual_mem_map_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pStart = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pStart));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".hPhysicalMem = ";
+        ur::details::printPtr(os, args.hPhysicalMem);
+        os << ", ";
+        os << ".offset = ";
+        os << args.offset;
+        os << ", ";
+        os << ".flags = ";
+        ur::details::printFlag<ur_virtual_mem_access_flag_t>(os, args.flags);
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_UNMAP: {
+        ur::serialize::ur_virtual_mem_unmap_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pStart = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pStart));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS: {
+        ur::serialize::ur_virtual_mem_set_access_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pStart = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pStart));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".flags = ";
+        ur::details::printFlag<ur_virtual_mem_access_flag_t>(os, args.flags);
+    } break;
+    case UR_FUNCTION_VIRTUAL_MEM_GET_INFO: {
+        ur::serialize::ur_virtual_mem_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hContext = ";
+        ur::details::printPtr(os, args.hContext);
+        os << ", ";
+        os << ".pStart = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pStart));
+        os << ", ";
+        os << ".size = ";
+        os << args.size;
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_DEVICE_GET: {
+        ur::serialize::ur_device_get_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hPlatform = ";
+        ur::details::printPtr(os, args.hPlatform);
+        os << ", ";
+        os << ".DeviceType = ";
+        os << args.DeviceType;
+        os << ", ";
+        os << ".NumEntries = ";
+        os << args.NumEntries;
+        os << ", ";
+        os << ".phDevices = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phDevices));
+        os << ", ";
+        os << ".pNumDevices = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pNumDevices));
+    } break;
+    case UR_FUNCTION_DEVICE_GET_SELECTED: {
+        ur::serialize::ur_device_get_selected_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hPlatform = ";
+        ur::details::printPtr(os, args.hPlatform);
+        os << ", ";
+        os << ".DeviceType = ";
+        os << args.DeviceType;
+        os << ", ";
+        os << ".NumEntries = ";
+        os << args.NumEntries;
+        os << ", ";
+        os << ".phDevices = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phDevices));
+        os << ", ";
+        os << ".pNumDevices = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pNumDevices));
+    } break;
+    case UR_FUNCTION_DEVICE_GET_INFO: {
+        ur::serialize::ur_device_get_info_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".propName = ";
+        os << args.propName;
+        os << ", ";
+        os << ".propSize = ";
+        os << args.propSize;
+        os << ", ";
+        os << ".pPropValue = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropValue));
+        os << ", ";
+        os << ".pPropSizeRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pPropSizeRet));
+    } break;
+    case UR_FUNCTION_DEVICE_RETAIN: {
+        ur::serialize::ur_device_retain_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+    } break;
+    case UR_FUNCTION_DEVICE_RELEASE: {
+        ur::serialize::ur_device_release_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+    } break;
+    case UR_FUNCTION_DEVICE_PARTITION: {
+        ur::serialize::ur_device_partition_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".NumDevices = ";
+        os << args.NumDevices;
+        os << ", ";
+        os << ".phSubDevices = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phSubDevices));
+        os << ", ";
+        os << ".pNumDevicesRet = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pNumDevicesRet));
+    } break;
+    case UR_FUNCTION_DEVICE_SELECT_BINARY: {
+        ur::serialize::ur_device_select_binary_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".pBinaries = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pBinaries));
+        os << ", ";
+        os << ".NumBinaries = ";
+        os << args.NumBinaries;
+        os << ", ";
+        os << ".pSelectedBinary = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pSelectedBinary));
+    } break;
+    case UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE: {
+        ur::serialize::ur_device_get_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".phNativeDevice = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phNativeDevice));
+    } break;
+    case UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE: {
+        ur::serialize::ur_device_create_with_native_handle_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hNativeDevice = ";
+        ur::details::printPtr(os, reinterpret_cast<void *>(args.hNativeDevice));
+        os << ", ";
+        os << ".hAdapter = ";
+        ur::details::printPtr(os, args.hAdapter);
+        os << ", ";
+        os << ".pProperties = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pProperties));
+        os << ", ";
+        os << ".phDevice = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.phDevice));
+    } break;
+    case UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS: {
+        ur::serialize::ur_device_get_global_timestamps_args_t args;
+        std::memcpy(&args, buffer, sizeof(args));
+        os << ".hDevice = ";
+        ur::details::printPtr(os, args.hDevice);
+        os << ", ";
+        os << ".pDeviceTimestamp = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pDeviceTimestamp));
+        os << ", ";
+        os << ".pHostTimestamp = ";
+        ur::details::printPtr(os, reinterpret_cast<const void *>(args.pHostTimestamp));
+    } break;
+    default:
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    return UR_RESULT_SUCCESS;
+}
+} // namespace ur::extras
+
+#endif /* UR_SERIALIZE_HPP */
@@ -216,6 +216,22 @@ class StreamMemory(ComputeBenchmark):
             "--contents=Zeros",
         ]
 
+class GraphApiSinKernelGraph(ComputeBenchmark):
+    def __init__(self, bench, withGraphs, numKernels):
+        self.withGraphs = withGraphs
+        self.numKernels = numKernels
+        super().__init__(bench, "graph_api_benchmark_sycl", "SinKernelGraph")
+
+    def name(self):
+        return f"graph_api_benchmark_sycl SinKernelGraph graphs:{self.withGraphs}, numKernels:{self.numKernels}"
+
+    def bin_args(self) -> list[str]:
+        return [
+            "--iterations=100",
+            f"--numKernels={self.numKernels}",
+            f"--withGraphs={self.withGraphs}",
+        ]
+
 class VectorSum(ComputeBenchmark):
     def __init__(self, bench):
         super().__init__(bench, "miscellaneous_benchmark_sycl", "VectorSum")
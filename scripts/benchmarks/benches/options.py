@@ -1,4 +1,4 @@
-from dataclasses import dataclass
+from dataclasses import dataclass, field
 
 @dataclass
 class Options:
@@ -8,6 +8,17 @@ class Options:
     timeout: float = 600
     iterations: int = 5
     verbose: bool = False
+    epsilon: float = 0.005
+    alpha: float = 0.05
+    confidence: float = 0.95
+    ur_microbench: str = ""
+    ur_microbench_program: str = ""
+    ur_microbench_kernel: str = ""
+    ur_usm_traces: list[str] = field(default_factory=list)
+    ur_usm_pool_config: str = ""
+    ur_sanitizer_program: str = ""
+    ur_sanitizer_kernel_args: int = 1
+    ur_traces: list[str] = field(default_factory=list)
 
 options = Options()
 
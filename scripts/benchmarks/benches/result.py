@@ -3,7 +3,7 @@
 # See LICENSE.TXT
 # SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
-from dataclasses import dataclass
+from dataclasses import dataclass, field
 from dataclasses_json import dataclass_json
 
 @dataclass_json
@@ -17,3 +17,5 @@ class Result:
     unit: str = ""
     name: str = ""
     lower_is_better: bool = True
+    # The values of all the iterations, of which value is the median
+    samples: list[float] = field(default_factory=list)
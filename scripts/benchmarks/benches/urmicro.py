@@ -0,0 +1,369 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import json
+import os
+from utils.utils import run
+from .base import Benchmark
+from .result import Result
+from .options import options
+
+# The layers measured one at a time, on top of the runs without any
+microbench_layers = [
+    "UR_LAYER_PARAMETER_VALIDATION",
+    "UR_LAYER_FULL_VALIDATION",
+    "UR_LAYER_TRACING",
+]
+
+class UrMicroBench:
+    def __init__(self, directory):
+        self.directory = directory
+        self.layers = None
+
+    def setup(self):
+        if self.layers is not None:
+            return
+
+        if not options.ur_microbench:
+            raise ValueError("no --ur-microbench binary given")
+        result = run([options.ur_microbench, "--list-layers"])
+        self.layers = result.stdout.decode().strip().split(';')
+
+class UrMicroBenchmark(Benchmark):
+    def __init__(self, bench, mock, layer=None):
+        self.bench = bench
+        self.mock = mock
+        self.layer = layer
+        super().__init__(bench.directory)
+
+    def name(self):
+        adapter = "mock" if self.mock else options.ur_adapter_name
+        layer = self.layer if self.layer else "no layers"
+        return f"ur_microbench {adapter} {layer}"
+
+    def unit(self):
+        return "ns"
+
+    def setup(self):
+        self.bench.setup()
+        if self.layer and self.layer not in self.bench.layers:
+            raise ValueError(f"{self.layer} is not available")
+
+    def bin_args(self) -> list[str]:
+        args = ["--iterations", "100000"]
+        if self.mock:
+            args.append("--mock")
+        elif options.ur_microbench_program:
+            args += ["--program", options.ur_microbench_program,
+                     "--kernel", options.ur_microbench_kernel]
+        if self.layer:
+            args += ["--layer", self.layer]
+        return args
+
+    def run(self, env_vars) -> list[Result]:
+        command = [options.ur_microbench] + self.bin_args()
+        result = self.run_bench(command, env_vars)
+        output = json.loads(result)
+        return [ Result(label=f"{self.name()} {res['label']}",
+                        value=res['value'], command=command, env=env_vars,
+                        stdout=result,
+                        lower_is_better=res['lower_is_better'])
+                 for res in output['results'] ]
+
+    def teardown(self):
+        return
+
+class UrSubmitScaling(Benchmark):
+    def __init__(self, bench, mock):
+        self.bench = bench
+        self.mock = mock
+        super().__init__(bench.directory)
+
+    def name(self):
+        adapter = "mock" if self.mock else options.ur_adapter_name
+        return f"ur_submit_scaling {adapter}"
+
+    def unit(self):
+        # The results have their own units, ops/s and ns
+        return ""
+
+    def setup(self):
+        self.bench.setup()
+        self.bin = os.path.join(os.path.dirname(options.ur_microbench),
+                                "ur_submit_scaling")
+
+    def bin_args(self) -> list[str]:
+        args = ["--threads", "1,2,4,8,16", "--ops", "10000"]
+        if self.mock:
+            args.append("--mock")
+        elif options.ur_microbench_program:
+            args += ["--program", options.ur_microbench_program,
+                     "--kernel", options.ur_microbench_kernel]
+        return args
+
+    def run(self, env_vars) -> list[Result]:
+        command = [self.bin] + self.bin_args()
+        result = self.run_bench(command, env_vars)
+        output = json.loads(result)
+        return [ Result(label=f"{self.name()} {res['label']}",
+                        value=res['value'], command=command, env=env_vars,
+                        stdout=result, unit=res['unit'],
+                        lower_is_better=res['lower_is_better'])
+                 for res in output['results'] ]
+
+    def teardown(self):
+        return
+
+# The allocators ur_usm_alloc_replay compares, the arguments and the
+# environment of each, the custom one only when a configuration is given
+def usm_allocators() -> dict[str, tuple[list[str], dict[str, str]]]:
+    allocators = {
+        "pooled": (["--pool"], {}),
+        "non-pooled": ([], {"UR_L0_DISABLE_USM_ALLOCATOR": "1"}),
+    }
+    if options.ur_usm_pool_config:
+        allocators["custom pool"] = (
+            ["--pool"], {"UR_L0_USM_ALLOCATOR": options.ur_usm_pool_config})
+    return allocators
+
+class UrUsmAllocReplay(Benchmark):
+    def __init__(self, bench, mock, trace, allocator):
+        self.bench = bench
+        self.mock = mock
+        self.trace = trace
+        self.allocator = allocator
+        super().__init__(bench.directory)
+
+    def name(self):
+        adapter = "mock" if self.mock else options.ur_adapter_name
+        trace = os.path.basename(self.trace)
+        return f"ur_usm_alloc_replay {adapter} {trace} {self.allocator}"
+
+    def unit(self):
+        # The results have their own units, ns, bytes and ratio
+        return ""
+
+    def setup(self):
+        self.bench.setup()
+        self.bin = os.path.join(os.path.dirname(options.ur_microbench),
+                                "ur_usm_alloc_replay")
+
+    def bin_args(self) -> list[str]:
+        args = ["--trace", self.trace, "--ops", "100000"]
+        args += usm_allocators()[self.allocator][0]
+        if self.mock:
+            args.append("--mock")
+        return args
+
+    def run(self, env_vars) -> list[Result]:
+        command = [self.bin] + self.bin_args()
+        env_vars = env_vars | usm_allocators()[self.allocator][1]
+        result = self.run_bench(command, env_vars)
+        output = json.loads(result)
+        return [ Result(label=f"{self.name()} {res['label']}",
+                        value=res['value'], command=command, env=env_vars,
+                        stdout=result, unit=res['unit'],
+                        lower_is_better=res['lower_is_better'])
+                 for res in output['results'] ]
+
+    def teardown(self):
+        return
+
+class UrCommandBufferBench(Benchmark):
+    def __init__(self, bench, mock):
+        self.bench = bench
+        self.mock = mock
+        super().__init__(bench.directory)
+
+    def name(self):
+        adapter = "mock" if self.mock else options.ur_adapter_name
+        return f"ur_command_buffer_bench {adapter}"
+
+    def unit(self):
+        # The results have their own units, ns and replays/s
+        return ""
+
+    def setup(self):
+        self.bench.setup()
+        self.bin = os.path.join(os.path.dirname(options.ur_microbench),
+                                "ur_command_buffer_bench")
+
+    def bin_args(self) -> list[str]:
+        args = ["--nodes", "1,16,256,1024", "--replays", "1000"]
+        if self.mock:
+            args.append("--mock")
+        elif options.ur_microbench_program:
+            args += ["--program", options.ur_microbench_program,
+                     "--kernel", options.ur_microbench_kernel]
+        return args
+
+    def run(self, env_vars) -> list[Result]:
+        command = [self.bin] + self.bin_args()
+        result = self.run_bench(command, env_vars)
+        output = json.loads(result)
+        return [ Result(label=f"{self.name()} {res['label']}",
+                        value=res['value'], command=command, env=env_vars,
+                        stdout=result, unit=res['unit'],
+                        lower_is_better=res['lower_is_better'])
+                 for res in output['results'] ]
+
+    def teardown(self):
+        return
+
+class UrStartupBench(Benchmark):
+    def __init__(self, bench, mock):
+        self.bench = bench
+        self.mock = mock
+        super().__init__(bench.directory)
+
+    def name(self):
+        adapter = "mock" if self.mock else options.ur_adapter_name
+        return f"ur_startup_bench {adapter}"
+
+    def unit(self):
+        return "us"
+
+    def setup(self):
+        self.bench.setup()
+        self.bin = os.path.join(os.path.dirname(options.ur_microbench),
+                                "ur_startup_bench")
+
+    def bin_args(self) -> list[str]:
+        args = ["--samples", "10"]
+        if self.mock:
+            args.append("--mock")
+        elif options.ur_microbench_program:
+            args += ["--program", options.ur_microbench_program,
+                     "--kernel", options.ur_microbench_kernel]
+        return args
+
+    def run(self, env_vars) -> list[Result]:
+        command = [self.bin] + self.bin_args()
+        result = self.run_bench(command, env_vars)
+        output = json.loads(result)
+        return [ Result(label=f"{self.name()} {res['label']}",
+                        value=res['value'], command=command, env=env_vars,
+                        stdout=result,
+                        lower_is_better=res['lower_is_better'])
+                 for res in output['results'] ]
+
+    def teardown(self):
+        return
+
+# The quarantine sizes, in MB, of the runs of ur_sanitizer_bench with the
+# sanitizer layer
+sanitizer_quarantine_sizes = [0, 16, 256]
+
+class UrSanitizerOverhead(Benchmark):
+    def __init__(self, bench):
+        self.bench = bench
+        super().__init__(bench.directory)
+
+    def name(self):
+        return f"ur_sanitizer_bench {options.ur_adapter_name}"
+
+    def unit(self):
+        return "ns"
+
+    def setup(self):
+        self.bench.setup()
+        if "UR_LAYER_ASAN" not in self.bench.layers:
+            raise ValueError("UR_LAYER_ASAN is not available")
+        self.bin = os.path.join(os.path.dirname(options.ur_microbench),
+                                "ur_sanitizer_bench")
+
+    def bin_args(self, asan: bool) -> list[str]:
+        args = ["--iterations", "10000"]
+        # The launches need both programs, the same kernel built with the
+        # device sanitizer and without
+        if options.ur_sanitizer_program and options.ur_microbench_program:
+            program = (options.ur_sanitizer_program if asan
+                       else options.ur_microbench_program)
+            args += ["--program", program,
+                     "--kernel", options.ur_microbench_kernel,
+                     "--kernel-args", str(options.ur_sanitizer_kernel_args)]
+        if asan:
+            args += ["--layer", "UR_LAYER_ASAN"]
+        return args
+
+    def run_config(self, env_vars, asan: bool):
+        command = [self.bin] + self.bin_args(asan)
+        result = self.run_bench(command, env_vars)
+        return command, result, json.loads(result)['results']
+
+    def run(self, env_vars) -> list[Result]:
+        results = []
+        command, stdout, baseline = self.run_config(env_vars, False)
+        results += [ Result(label=f"{self.name()} no layers {res['label']}",
+                            value=res['value'], command=command,
+                            env=env_vars, stdout=stdout,
+                            lower_is_better=res['lower_is_better'])
+                     for res in baseline ]
+        baseline_values = {res['label']: res['value'] for res in baseline}
+
+        for size in sanitizer_quarantine_sizes:
+            asan_env = env_vars | {
+                "UR_LAYER_ASAN_OPTIONS": f"quarantine_size_mb:{size}"}
+            command, stdout, asan = self.run_config(asan_env, True)
+            config = f"UR_LAYER_ASAN quarantine {size}MB"
+            for res in asan:
+                results.append(Result(
+                    label=f"{self.name()} {config} {res['label']}",
+                    value=res['value'], command=command, env=asan_env,
+                    stdout=stdout, lower_is_better=res['lower_is_better']))
+                if res['label'] in baseline_values:
+                    overhead = res['value'] - baseline_values[res['label']]
+                    results.append(Result(
+                        label=f"{self.name()} {config} overhead {res['label']}",
+                        value=overhead, command=command, env=asan_env,
+                        stdout=stdout, lower_is_better=True))
+        return results
+
+    def teardown(self):
+        return
+
+class UrTraceReplay(Benchmark):
+    def __init__(self, bench, mock, trace, timing):
+        self.bench = bench
+        self.mock = mock
+        self.trace = trace
+        self.timing = timing
+        super().__init__(bench.directory)
+
+    def name(self):
+        adapter = "mock" if self.mock else options.ur_adapter_name
+        trace = os.path.basename(self.trace)
+        return f"ur_trace_replay {adapter} {trace} {self.timing}"
+
+    def unit(self):
+        # The results have their own units, ns and ms
+        return ""
+
+    def setup(self):
+        self.bench.setup()
+        self.bin = os.path.join(os.path.dirname(options.ur_microbench),
+                                "ur_trace_replay")
+
+    def bin_args(self) -> list[str]:
+        args = ["--timing", self.timing]
+        if self.mock:
+            args.append("--mock")
+        elif options.ur_microbench_program:
+            args += ["--program", options.ur_microbench_program,
+                     "--kernel", options.ur_microbench_kernel]
+        return args + [self.trace]
+
+    def run(self, env_vars) -> list[Result]:
+        command = [self.bin] + self.bin_args()
+        result = self.run_bench(command, env_vars)
+        output = json.loads(result)
+        return [ Result(label=f"{self.name()} {res['label']}",
+                        value=res['value'], command=command, env=env_vars,
+                        stdout=result, unit=res['unit'],
+                        lower_is_better=res['lower_is_better'])
+                 for res in output['results'] ]
+
+    def teardown(self):
+        return
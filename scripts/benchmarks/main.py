@@ -15,20 +15,26 @@ from benches.quicksilver import QuickSilver
 from benches.SobelFilter import SobelFilter
 from benches.velocity import VelocityBench
 from benches.syclbench import *
+from benches.urmicro import UrMicroBench, UrMicroBenchmark, UrSubmitScaling, UrUsmAllocReplay, UrCommandBufferBench, UrStartupBench, UrSanitizerOverhead, UrTraceReplay, usm_allocators, microbench_layers
 from benches.options import options
 from output import generate_markdown
+from utils.stats import compare_results
 import argparse
+import collections
+import json
 import re
 
 # Update this if you are changing the layout of the results files
 INTERNAL_WORKDIR_VERSION = '1.6'
 
-def main(directory, additional_env_vars, save_name, compare_names, filter):
+def main(directory, additional_env_vars, save_name, compare_names, filter,
+         verdict_path, fail_on_regression):
     prepare_workdir(directory, INTERNAL_WORKDIR_VERSION)
 
     cb = ComputeBench(directory)
     sb = SyclBench(directory)
     vb = VelocityBench(directory)
+    ub = UrMicroBench(directory)
 
     benchmarks = [
         # *** Compute benchmarks
@@ -43,6 +49,8 @@ def main(directory, additional_env_vars, save_name, compare_names, filter):
         ExecImmediateCopyQueue(cb, 0, 1, 'Device', 'Device', 1024),
         ExecImmediateCopyQueue(cb, 1, 1, 'Device', 'Host', 1024),
         VectorSum(cb),
+        GraphApiSinKernelGraph(cb, 0, 5),
+        GraphApiSinKernelGraph(cb, 1, 5),
 
         # *** Velocity benchmarks
         Hashtable(vb),
@@ -92,6 +100,28 @@ def main(directory, additional_env_vars, save_name, compare_names, filter):
         Syrk(sb),
     ]
 
+    # *** UR microbenchmarks, of the loader and the layers against the mock
+    # adapter, and of the adapter
+    if options.ur_microbench:
+        for mock in [True, False]:
+            benchmarks.append(UrMicroBenchmark(ub, mock))
+            for layer in microbench_layers:
+                benchmarks.append(UrMicroBenchmark(ub, mock, layer))
+            benchmarks.append(UrSubmitScaling(ub, mock))
+            benchmarks.append(UrCommandBufferBench(ub, mock))
+            benchmarks.append(UrStartupBench(ub, mock))
+        # The mock adapter has no allocator, only its overhead is measured
+        for trace in ["ml", "graph", "random"] + options.ur_usm_traces:
+            benchmarks.append(UrUsmAllocReplay(ub, True, trace, "pooled"))
+            for allocator in usm_allocators():
+                benchmarks.append(UrUsmAllocReplay(ub, False, trace, allocator))
+        # The sanitizer layer needs a device
+        benchmarks.append(UrSanitizerOverhead(ub))
+        for trace in options.ur_traces:
+            for mock in [True, False]:
+                for timing in ["fast", "original"]:
+                    benchmarks.append(UrTraceReplay(ub, mock, trace, timing))
+
     if filter:
         benchmarks = [benchmark for benchmark in benchmarks if filter.search(benchmark.name())]
 
@@ -117,7 +147,7 @@ def main(directory, additional_env_vars, save_name, compare_names, filter):
                 bench_results = benchmark.run(merged_env_vars)
                 if bench_results is not None:
                     for bench_result in bench_results:
-                        print(f"complete ({bench_result.label}: {bench_result.value} {benchmark.unit()}).")
+                        print(f"complete ({bench_result.label}: {bench_result.value} {bench_result.unit or benchmark.unit()}).")
                         iteration_results.append(bench_result)
                 else:
                     print(f"did not finish.")
@@ -131,8 +161,11 @@ def main(directory, additional_env_vars, save_name, compare_names, filter):
                 median_index = len(label_results) // 2
                 median_result = label_results[median_index]
 
-                median_result.unit = benchmark.unit()
+                # Benchmarks with results of several units set them
+                if not median_result.unit:
+                    median_result.unit = benchmark.unit()
                 median_result.name = label
+                median_result.samples = [res.value for res in label_results]
 
                 results.append(median_result)
         except Exception as e:
@@ -157,13 +190,45 @@ def main(directory, additional_env_vars, save_name, compare_names, filter):
     if save_name:
         save_benchmark_results(directory, save_name, results)
 
-    markdown_content = generate_markdown(chart_data)
+    # The statistical comparison is against the first of the compared results
+    verdicts = None
+    baseline_name = next((name for name in compare_names if name in chart_data), None)
+    if baseline_name:
+        verdicts = compare_results(results, chart_data[baseline_name],
+                                   options.alpha, options.epsilon,
+                                   options.confidence)
+
+    markdown_content = generate_markdown(chart_data, baseline_name, verdicts)
 
     with open('benchmark_results.md', 'w') as file:
         file.write(markdown_content)
 
     print(f"Markdown with benchmark results has been written to {os.getcwd()}/benchmark_results.md")
 
+    if verdict_path:
+        save_verdicts(verdict_path, baseline_name, verdicts)
+
+    regressed = [v.name for v in verdicts or [] if v.verdict == "regressed"]
+    if regressed:
+        print(f"Regressed against {baseline_name}: {', '.join(regressed)}")
+        if fail_on_regression:
+            exit(1)
+
+def save_verdicts(path, baseline_name, verdicts):
+    counts = collections.Counter(v.verdict for v in verdicts or [])
+    content = {
+        "baseline": baseline_name,
+        "alpha": options.alpha,
+        "confidence": options.confidence,
+        "epsilon": options.epsilon,
+        "summary": {verdict: counts[verdict] for verdict in
+                    ["improved", "regressed", "no change", "inconclusive"]},
+        "benchmarks": [v.to_dict() for v in verdicts or []],
+    }
+    with open(path, 'w') as file:
+        json.dump(content, file, indent=4)
+    print(f"Verdicts against {baseline_name} have been written to {path}")
+
 def validate_and_parse_env_args(env_args):
     env_vars = {}
     for arg in env_args:
@@ -187,8 +252,20 @@ if __name__ == "__main__":
     parser.add_argument("--timeout", type=int, help='Timeout for individual benchmarks in seconds.', default=600)
     parser.add_argument("--filter", type=str, help='Regex pattern to filter benchmarks by name.', default=None)
     parser.add_argument("--epsilon", type=float, help='Threshold to consider change of performance significant', default=0.005)
+    parser.add_argument("--alpha", type=float, help='Significance level of the Mann-Whitney U test of the change of the samples against the baseline', default=0.05)
+    parser.add_argument("--confidence", type=float, help='Confidence level of the bootstrap intervals of the medians', default=0.95)
+    parser.add_argument("--verdict", type=str, help='Write the per benchmark verdicts against the baseline to this JSON file.', default=None)
+    parser.add_argument("--fail-on-regression", help='Exit with an error if any benchmark regressed against the baseline.', action="store_true")
     parser.add_argument("--verbose", help='Print output of all the commands.', action="store_true")
     parser.add_argument("--exit_on_failure", help='Exit on first failure.', action="store_true")
+    parser.add_argument("--ur-microbench", type=str, help='Path to the ur_microbench binary of the UR build, its benchmarks are skipped without it.', default="")
+    parser.add_argument("--ur-microbench-program", type=str, help='SPIR-V or binary of the program of the ur_microbench kernel benchmarks on the adapter.', default="")
+    parser.add_argument("--ur-microbench-kernel", type=str, help='Kernel of --ur-microbench-program, whose first argument is a pointer to global memory.', default="")
+    parser.add_argument("--ur-usm-trace", type=str, action="append", help='Trace file of USM allocations replayed by ur_usm_alloc_replay besides the generated traces, may be repeated.', default=[])
+    parser.add_argument("--ur-sanitizer-program", type=str, help='--ur-microbench-program built with the device sanitizer, for the ur_sanitizer_bench kernel benchmarks with UR_LAYER_ASAN.', default="")
+    parser.add_argument("--ur-sanitizer-kernel-args", type=int, help='Number of pointer arguments of --ur-microbench-kernel, measured by ur_sanitizer_bench.', default=1)
+    parser.add_argument("--ur-trace", type=str, action="append", help='Binary trace recorded with urtrace --binary-output, replayed by ur_trace_replay, may be repeated.', default=[])
+    parser.add_argument("--ur-usm-pool-config", type=str, help='UR_L0_USM_ALLOCATOR configuration of the pools compared by ur_usm_alloc_replay with the default pools and without pooling.', default="")
 
     args = parser.parse_args()
     additional_env_vars = validate_and_parse_env_args(args.env)
@@ -199,10 +276,22 @@ if __name__ == "__main__":
     options.iterations = args.iterations
     options.timeout = args.timeout
     options.epsilon = args.epsilon
+    options.alpha = args.alpha
+    options.confidence = args.confidence
     options.ur_dir = args.ur_dir
     options.ur_adapter_name = args.ur_adapter_name
     options.exit_on_failure = args.exit_on_failure
+    # The benchmarks run in their own working directory
+    options.ur_microbench = os.path.abspath(args.ur_microbench) if args.ur_microbench else ""
+    options.ur_microbench_program = args.ur_microbench_program
+    options.ur_microbench_kernel = args.ur_microbench_kernel
+    options.ur_usm_traces = [os.path.abspath(trace) for trace in args.ur_usm_trace]
+    options.ur_usm_pool_config = args.ur_usm_pool_config
+    options.ur_traces = [os.path.abspath(trace) for trace in args.ur_trace]
+    options.ur_sanitizer_program = args.ur_sanitizer_program
+    options.ur_sanitizer_kernel_args = args.ur_sanitizer_kernel_args
 
     benchmark_filter = re.compile(args.filter) if args.filter else None
 
-    main(args.benchmark_directory, additional_env_vars, args.save, args.compare, benchmark_filter)
+    main(args.benchmark_directory, additional_env_vars, args.save, args.compare, benchmark_filter,
+         args.verdict, args.fail_on_regression)
@@ -6,6 +6,7 @@
 import collections, re
 from benches.base import Result
 from benches.options import options
+from utils.stats import Verdict
 import math
 
 class OutputLine:
@@ -211,13 +212,36 @@ def generate_summary_table_and_chart(chart_data: dict[str, list[Result]]):
 
     return summary_line, summary_table
 
-def generate_markdown(chart_data: dict[str, list[Result]]):
+def generate_verdicts_table(baseline_name, verdicts: list[Verdict]):
+    if not verdicts:
+        return ""
+
+    table = f"""
+## Statistical comparison against {baseline_name}
+
+Medians with their {options.confidence*100:.0f}% confidence intervals. A benchmark changed when the Mann-Whitney U test gives p < {options.alpha} and the median moved by more than its noise threshold.
+
+| Benchmark | {baseline_name} | This PR | Change | p-value | Threshold | Verdict |
+|---|---|---|---|---|---|---|
+"""
+    order = {"regressed": 0, "improved": 1, "inconclusive": 2, "no change": 3}
+    for v in sorted(verdicts, key=lambda v: (order[v.verdict], v.change)):
+        table += (f"| {v.name} "
+                  f"| {v.baseline:.3f} [{v.baseline_ci[0]:.3f}, {v.baseline_ci[1]:.3f}] {v.unit} "
+                  f"| {v.current:.3f} [{v.current_ci[0]:.3f}, {v.current_ci[1]:.3f}] {v.unit} "
+                  f"| {v.change*100:.2f}% | {v.p_value:.3f} | {v.threshold*100:.2f}% "
+                  f"| {v.verdict} |\n")
+    return table
+
+def generate_markdown(chart_data: dict[str, list[Result]], baseline_name=None,
+                      verdicts: list[Verdict] = None):
     (summary_line, summary_table) = generate_summary_table_and_chart(chart_data)
 
     return f"""
 # Summary
 {summary_line}\n
 (<ins>result</ins> is better)\n
+{generate_verdicts_table(baseline_name, verdicts)}
 {summary_table}
 # Details
 {generate_markdown_details(chart_data["This PR"])}
@@ -0,0 +1,146 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import math
+import random
+import statistics
+from dataclasses import dataclass
+from dataclasses_json import dataclass_json
+from benches.result import Result
+
+# Resamples of the bootstrap confidence intervals, seeded so that the same
+# samples always give the same interval
+BOOTSTRAP_RESAMPLES = 2000
+BOOTSTRAP_SEED = 0
+
+def samples_of(result: Result) -> list[float]:
+    # Results saved before the samples were kept only have their median
+    return result.samples if result.samples else [result.value]
+
+def confidence_interval(samples: list[float], confidence: float) -> tuple[float, float]:
+    """Bootstrap confidence interval of the median of samples"""
+    if len(samples) < 2:
+        return (samples[0], samples[0])
+
+    rng = random.Random(BOOTSTRAP_SEED)
+    medians = sorted(
+        statistics.median(rng.choices(samples, k=len(samples)))
+        for _ in range(BOOTSTRAP_RESAMPLES))
+    tail = (1 - confidence) / 2
+    low = medians[int(tail * (len(medians) - 1))]
+    high = medians[int(math.ceil((1 - tail) * (len(medians) - 1)))]
+    return (low, high)
+
+def _exact_u_distribution(n1: int, n2: int) -> list[int]:
+    """Number of orderings of n1 and n2 distinct values for each U"""
+    # counts[j][u] for the first sample of size i, updated for each i
+    counts = [[1] + [0] * (n1 * n2) for _ in range(n2 + 1)]
+    for i in range(1, n1 + 1):
+        updated = [[0] * (n1 * n2 + 1) for _ in range(n2 + 1)]
+        updated[0][0] = 1
+        for j in range(1, n2 + 1):
+            for u in range(i * j + 1):
+                # The largest value is from the first sample, above all the
+                # j of the second, or from the second
+                above = counts[j][u - j] if u >= j else 0
+                updated[j][u] = above + updated[j - 1][u]
+        counts = updated
+    return counts[n2]
+
+def mann_whitney_u(a: list[float], b: list[float]) -> float:
+    """Two-sided p-value of the Mann-Whitney U test of a and b"""
+    n1, n2 = len(a), len(b)
+    u = sum(1.0 if x > y else 0.5 if x == y else 0.0 for x in a for y in b)
+
+    values = a + b
+    has_ties = len(set(values)) < len(values)
+    if not has_ties and n1 * n2 <= 400:
+        counts = _exact_u_distribution(n1, n2)
+        total = sum(counts)
+        below = sum(counts[:int(u) + 1]) / total
+        above = sum(counts[int(u):]) / total
+        return min(1.0, 2 * min(below, above))
+
+    # Normal approximation, with the tie and continuity corrections
+    n = n1 + n2
+    ties = sum(t ** 3 - t for t in
+               (values.count(v) for v in set(values)))
+    variance = n1 * n2 / 12 * ((n + 1) - ties / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+    z = (abs(u - n1 * n2 / 2) - 0.5) / math.sqrt(variance)
+    return min(1.0, math.erfc(max(z, 0) / math.sqrt(2)))
+
+@dataclass_json
+@dataclass
+class Verdict:
+    name: str
+    unit: str
+    baseline: float
+    baseline_ci: tuple[float, float]
+    current: float
+    current_ci: tuple[float, float]
+    # Relative change of the median, positive when the benchmark is better
+    change: float
+    p_value: float
+    threshold: float
+    # "improved", "regressed", "no change" or "inconclusive" when there are
+    # too few samples for the test
+    verdict: str
+
+def compare(current: Result, baseline: Result, alpha: float, epsilon: float,
+            confidence: float) -> Verdict:
+    """Compares the samples of a benchmark with those of its baseline.
+
+    The benchmark changed when the U test rejects that the samples come
+    from the same distribution with significance alpha, and the median moved
+    by more than the threshold of the benchmark. The threshold is the noise
+    of the benchmark, the relative widths of the confidence intervals of
+    both medians, and at least epsilon."""
+    current_samples = samples_of(current)
+    baseline_samples = samples_of(baseline)
+    current_median = statistics.median(current_samples)
+    baseline_median = statistics.median(baseline_samples)
+    current_ci = confidence_interval(current_samples, confidence)
+    baseline_ci = confidence_interval(baseline_samples, confidence)
+
+    def relative_width(ci, median):
+        return (ci[1] - ci[0]) / 2 / abs(median) if median else 0.0
+
+    threshold = max(epsilon, relative_width(current_ci, current_median) +
+                    relative_width(baseline_ci, baseline_median))
+
+    change = 0.0
+    if baseline_median:
+        better = current_median - baseline_median
+        if current.lower_is_better:
+            better = baseline_median - current_median
+        change = better / abs(baseline_median)
+
+    if len(current_samples) < 2 or len(baseline_samples) < 2:
+        p_value = 1.0
+        verdict = "inconclusive"
+    else:
+        p_value = mann_whitney_u(current_samples, baseline_samples)
+        if p_value >= alpha or abs(change) <= threshold:
+            verdict = "no change"
+        elif change > 0:
+            verdict = "improved"
+        else:
+            verdict = "regressed"
+
+    return Verdict(name=current.name, unit=current.unit,
+                   baseline=baseline_median, baseline_ci=baseline_ci,
+                   current=current_median, current_ci=current_ci,
+                   change=change, p_value=p_value, threshold=threshold,
+                   verdict=verdict)
+
+def compare_results(current: list[Result], baseline: list[Result],
+                    alpha: float, epsilon: float,
+                    confidence: float) -> list[Verdict]:
+    """Verdicts of the benchmarks of current which are in baseline"""
+    baseline_by_name = {res.name: res for res in baseline}
+    return [compare(res, baseline_by_name[res.name], alpha, epsilon, confidence)
+            for res in current if res.name in baseline_by_name]
@@ -136,6 +136,7 @@ def _generate_api_cpp(incpath, srcpath, namespace, tags, version, revision, spec
     loc += _mako_api_cpp(srcpath, namespace, tags, version, revision, specs, meta)
     loc += _mako_ddi_h(incpath, namespace, tags, version, revision, specs, meta)
     loc += _mako_print_hpp(incpath, namespace, tags, version, revision, specs, meta)
+    loc += _mako_serialize_hpp(incpath, namespace, tags, version, revision, specs, meta)
     loc += _mako_api_funcs(incpath, namespace, tags, version, revision, specs, meta)
 
     return loc
@@ -308,6 +309,28 @@ def _mako_tracing_layer_cpp(path, namespace, tags, version, specs, meta):
         specs=specs,
         meta=meta)
 
+"""
+    generates c/c++ files from the specification documents
+"""
+def _mako_fused_layer_cpp(path, namespace, tags, version, specs, meta, layers):
+    template = "fusedddi.cpp.mako"
+    fin = os.path.join(templates_dir, template)
+
+    name = "%s_fusedddi"%(namespace)
+    filename = "%s.cpp"%(name)
+    fout = os.path.join(path, filename)
+
+    print("Generating %s..."%fout)
+    return util.makoWrite(
+        fin, fout,
+        name=name,
+        ver=version,
+        namespace=namespace,
+        tags=tags,
+        specs=specs,
+        meta=meta,
+        layers=layers)
+
 """
     generates c/c++ files from the specification documents
 """
@@ -330,6 +353,28 @@ def _mako_print_hpp(path, namespace, tags, version, revision, specs, meta):
         specs=specs,
         meta=meta)
 
+"""
+    generates c/c++ files from the specification documents
+"""
+def _mako_serialize_hpp(path, namespace, tags, version, revision, specs, meta):
+    template = "serialize.hpp.mako"
+    fin = os.path.join(templates_dir, template)
+
+    name = "%s_serialize"%(namespace)
+    filename = "%s.hpp"%(name)
+    fout = os.path.join(path, filename)
+
+    print("Generating %s..."%fout)
+    return util.makoWrite(
+        fin, fout,
+        name=name,
+        ver=version,
+        rev=revision,
+        namespace=namespace,
+        tags=tags,
+        specs=specs,
+        meta=meta)
+
 """
 Entry-point:
     generates tools code
@@ -444,7 +489,8 @@ def generate_adapters(path, section, namespace, tags, version, specs, meta):
     )
 
     loc += _mako_interface_loader_api(dstpath, "level_zero", "cpp", namespace, tags, version, specs, meta)
-    loc += _mako_interface_loader_api(dstpath, "level_zero", "hpp", namespace, tags, version, specs, meta)
+    for adapter in ["level_zero", "cuda", "hip", "opencl", "native_cpu"]:
+        loc += _mako_interface_loader_api(dstpath, adapter, "hpp", namespace, tags, version, specs, meta)
 
     print("Generated %s lines of code.\n"%loc)
 
@@ -452,7 +498,7 @@ def generate_adapters(path, section, namespace, tags, version, specs, meta):
 Entry-point:
     generates layers for unified_runtime adapter
 """
-def generate_layers(path, section, namespace, tags, version, specs, meta):
+def generate_layers(path, section, namespace, tags, version, specs, meta, fused_layers=["tracing", "validation"]):
     print("GL section %s\n"%section)
     print("GL namespace %s\n"%namespace)
     layer_dstpath = os.path.join(path, "loader", "layers")
@@ -468,6 +514,11 @@ def generate_layers(path, section, namespace, tags, version, specs, meta):
     loc += _mako_tracing_layer_cpp(layer_dstpath, namespace, tags, version, specs, meta)
     print("TRACING Generated %s lines of code.\n"%loc)
 
+    if fused_layers:
+        loc = 0
+        loc += _mako_fused_layer_cpp(layer_dstpath, namespace, tags, version, specs, meta, fused_layers)
+        print("FUSED Generated %s lines of code.\n"%loc)
+
 """
 Entry-point:
     generates common utilities for unified_runtime
@@ -35,6 +35,7 @@ if __name__ == '__main__':
     parser.add_argument("--debug", action='store_true', help="dump intermediate data to disk.")
     parser.add_argument("--sections", type=list, default=None, help="Optional list of sections for which to generate source, default is all")
     parser.add_argument("--ver", type=str, default="1.0", help="specification version to generate.")
+    parser.add_argument("--fused-layers", type=str, default="tracing,validation", help="Comma-separated layers, outermost first, to generate a fused intercept function per API for, empty for none.")
     parser.add_argument('--api-json', nargs='?', type=argparse.FileType('r'), default=sys.stdin, help="JSON file containing the API specification, by default read from stdin")
     parser.add_argument("out_dir", type=str, help="Root of the loader repository.")
     args = parser.parse_args()
@@ -54,7 +55,7 @@ if __name__ == '__main__':
             if args.loader:
                 generate_code.generate_loader(srcpath, config['name'], config['namespace'], config['tags'], args.ver, specs, input['meta'])
             if args.layers:
-                generate_code.generate_layers(srcpath, config['name'], config['namespace'], config['tags'], args.ver, specs, input['meta'])
+                generate_code.generate_layers(srcpath, config['name'], config['namespace'], config['tags'], args.ver, specs, input['meta'], [layer for layer in args.fused_layers.split(',') if layer])
             if args.adapters:
                 generate_code.generate_adapters(srcpath, config['name'], config['namespace'], config['tags'], args.ver, specs, input['meta'])
             if args.common:
@@ -0,0 +1,287 @@
+<%!
+import re
+from templates import helper as th
+%><%
+    n=namespace
+    N=n.upper()
+
+    x=tags['$x']
+    X=x.upper()
+
+    handle_create_get_retain_release_funcs=th.get_handle_create_get_retain_release_functions(specs, n, tags)
+%>/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ${name}.cpp
+ *
+ */
+#include "${x}_fused_layer.hpp"
+%for layer in sorted(layers):
+%if layer == "tracing":
+#include "tracing/${x}_tracing_layer.hpp"
+%elif layer == "validation":
+#include "validation/${x}_leak_check.hpp"
+#include "validation/${x}_validation_layer.hpp"
+%endif
+%endfor
+
+#include <iostream>
+#include <type_traits>
+
+## Mako helper functions ######################################################
+## The intercept functions of the layers, as in valddi.cpp.mako and
+## trcddi.cpp.mako, except that unless the layer is the innermost of the fused
+## layers, it calls the intercept function of the next layer directly instead
+## of the function saved in its table.
+<%def name="next_call(obj, next_layer)">${th.make_pfn_name(n, tags, obj) if next_layer is None else next_layer + "::" + th.make_func_name(n, tags, obj)}</%def>
+
+<%def name="validation_intercept(obj, next_layer)">
+    <%
+        func_name=th.make_func_name(n, tags, obj)
+
+        param_checks=th.make_param_checks(n, tags, obj, meta=meta).items()
+        first_errors = [X + "_RESULT_ERROR_INVALID_NULL_POINTER", X + "_RESULT_ERROR_INVALID_NULL_HANDLE"]
+        handle_checks = [pair for pair in param_checks if pair[0] in first_errors]
+        other_checks = [pair for pair in param_checks if pair[0] not in first_errors]
+        has_event_wait_list = func_name in th.get_event_wait_list_functions(specs, n, tags)
+
+        tracked_params = list(filter(lambda p: any(th.subt(n, tags, p['type']) in [hf['handle'], hf['handle'] + "*"] for hf in handle_create_get_retain_release_funcs), obj['params']))
+    %>
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Validation layer part of ${func_name}
+    __${x}dlllocal ${x}_result_t ${X}_APICALL
+    ${func_name}(
+        %for line in th.make_param_lines(n, tags, obj):
+        ${line}
+        %endfor
+        )
+    {${th.get_initial_null_set(obj)}
+        %if next_layer is None:
+        auto ${th.make_pfn_name(n, tags, obj)} = getContext()->${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+
+        if( nullptr == ${th.make_pfn_name(n, tags, obj)} ) {
+            return ${X}_RESULT_ERROR_UNINITIALIZED;
+        }
+
+        %endif
+        %if handle_checks:
+        if( getContext()->enableHandleValidation )
+        {
+            %for key, values in handle_checks:
+            %for val in values:
+            if ( ${val} )
+                return ${key};
+
+            %endfor
+            %endfor
+        }
+
+        %endif
+        %if other_checks or has_event_wait_list:
+        if( getContext()->enableParameterValidation )
+        {
+            %for key, values in other_checks:
+            %for val in values:
+            %if 'boundsError' in val:
+            if ( getContext()->enableBoundsChecking ) {
+                if ( ${val} ) {
+                    return ${key};
+                }
+            }
+            %else:
+            if ( ${val} )
+                return ${key};
+            %endif
+
+            %endfor
+            %endfor
+            %if has_event_wait_list:
+            if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+                for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                    if (phEventWaitList[i] == NULL) {
+                        return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                    }
+                }
+            }
+            %endif
+
+        }
+        %endif
+
+            %for tp in tracked_params:
+            <%
+                tp_input_handle_funcs = next((hf for hf in handle_create_get_retain_release_funcs if th.subt(n, tags, tp['type']) == hf['handle'] and "[in]" in tp['desc']), {})
+                is_related_create_get_retain_release_func = any(func_name in funcs for funcs in tp_input_handle_funcs.values())
+            %>
+            %if tp_input_handle_funcs and not is_related_create_get_retain_release_func:
+            if (getContext()->enableLifetimeValidation && !getContext()->refCountContext->isReferenceValid(${tp['name']})) {
+                getContext()->refCountContext->logInvalidReference(${tp['name']});
+            }
+            %endif
+            %endfor
+
+        ${x}_result_t result = ${next_call(obj, next_layer)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+
+        %for tp in tracked_params:
+        <%
+            tp_handle_funcs = next((hf for hf in handle_create_get_retain_release_funcs if th.subt(n, tags, tp['type']) in [hf['handle'], hf['handle'] + "*"]), None)
+            is_handle_to_adapter = ("_adapter_handle_t" in tp['type'])
+        %>
+        %if func_name in tp_handle_funcs['create']:
+        if( getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS )
+        {
+            getContext()->refCountContext->createRefCount(*${tp['name']});
+        }
+        %elif func_name in tp_handle_funcs['get']:
+        if( getContext()->enableLeakChecking && ${tp['name']} && result == UR_RESULT_SUCCESS )
+        {
+            for (uint32_t i = ${th.param_traits.range_start(tp)}; i < ${th.param_traits.range_end(tp)}; i++) {
+                getContext()->refCountContext->createOrIncrementRefCount(${tp['name']}[i], ${str(is_handle_to_adapter).lower()});
+            }
+        }
+        %elif func_name in tp_handle_funcs['retain']:
+        if( getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS )
+        {
+            getContext()->refCountContext->incrementRefCount(${tp['name']}, ${str(is_handle_to_adapter).lower()});
+        }
+        %elif func_name in tp_handle_funcs['release']:
+        if( getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS )
+        {
+            getContext()->refCountContext->decrementRefCount(${tp['name']}, ${str(is_handle_to_adapter).lower()});
+        }
+        %endif
+        %endfor
+
+        return result;
+    }
+</%def>
+
+<%def name="tracing_intercept(obj, next_layer)">
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Tracing layer part of ${th.make_func_name(n, tags, obj)}
+    __${x}dlllocal ${x}_result_t ${X}_APICALL
+    ${th.make_func_name(n, tags, obj)}(
+        %for line in th.make_param_lines(n, tags, obj):
+        ${line}
+        %endfor
+        )
+    {${th.get_initial_null_set(obj)}
+        %if next_layer is None:
+        auto ${th.make_pfn_name(n, tags, obj)} = getContext()->${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+
+        if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
+            return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        %endif
+        if( !getContext()->isTraced(${th.make_func_etor(n, tags, obj)}) )
+            return ${next_call(obj, next_layer)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+
+        ${th.make_pfncb_param_type(n, tags, obj)} params = { &${",&".join(th.make_param_lines(n, tags, obj, format=["name"]))} };
+        uint64_t instance = getContext()->notify_begin(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))});
+
+        auto &logger = getContext()->logger;
+        logger.info("   ---> ${th.make_func_name(n, tags, obj)}\n");
+
+        ${x}_result_t result = ${next_call(obj, next_layer)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+
+        getContext()->notify_end(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params, &result, instance);
+
+        if (logger.getLevel() <= logger::Level::INFO) {
+            std::ostringstream args_str;
+            ur::extras::printFunctionParams(args_str, ${th.make_func_etor(n, tags, obj)}, &params);
+            logger.info("   <--- ${th.make_func_name(n, tags, obj)}({}) -> {};\n", args_str.str(), result);
+        }
+
+        return result;
+    }
+</%def>
+
+## The intercept functions of the layers, to find them in the tables
+%for layer in layers:
+    namespace ${x}_${layer}_layer
+    {
+    %for obj in th.get_adapter_functions(specs):
+    %if 'condition' in obj:
+    #if ${th.subt(n, tags, obj['condition'])}
+    %endif
+    __${x}dlllocal std::remove_pointer_t<${th.make_pfn_type(n, tags, obj)}> ${th.make_func_name(n, tags, obj)};
+    %if 'condition' in obj:
+    #endif // ${th.subt(n, tags, obj['condition'])}
+    %endif
+%endfor
+    } // namespace ${x}_${layer}_layer
+
+%endfor
+
+namespace ur_fused_layer
+{
+    namespace
+    {
+    ## The innermost layer first, so that each layer can call the next one
+    %for idx, layer in reversed(list(enumerate(layers))):
+    <%
+        next_layer = layers[idx + 1] if idx + 1 < len(layers) else None
+    %>
+    namespace ${layer}
+    {
+    %if layer == "validation":
+    using ${x}_validation_layer::bounds;
+    using ${x}_validation_layer::boundsImage;
+    %endif
+    using ${x}_${layer}_layer::getContext;
+
+    %for obj in th.get_adapter_functions(specs):
+    %if 'condition' in obj:
+    #if ${th.subt(n, tags, obj['condition'])}
+    %endif
+    %if layer == "validation":
+    ${validation_intercept(obj, next_layer)}
+    %elif layer == "tracing":
+    ${tracing_intercept(obj, next_layer)}
+    %endif
+    %if 'condition' in obj:
+    #endif // ${th.subt(n, tags, obj['condition'])}
+    %endif
+
+    %endfor
+    } // namespace ${layer}
+
+    %endfor
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Replaces the functions of the table which call the ${" and ".join(layers)}
+    ///        layers one after the other with the fused functions
+    void fuse(${x}_dditable_t *dditable) {
+        %for layer in layers[:-1]:
+        auto &${layer}Table = ${x}_${layer}_layer::getContext()->${n}DdiTable;
+        %endfor
+
+        %for tbl in th.get_pfntables(specs, meta, n, tags):
+        %for obj in tbl['functions']:
+        <%
+            pfn = th.make_pfn_name(n, tags, obj)
+            func = th.make_func_name(n, tags, obj)
+        %>
+        %if 'condition' in obj:
+    #if ${th.subt(n, tags, obj['condition'])}
+        %endif
+        if (dditable->${tbl['name']}.${pfn} == ${x}_${layers[0]}_layer::${func}
+            %for idx, layer in enumerate(layers[:-1]):
+            && ${layer}Table.${tbl['name']}.${pfn} == ${x}_${layers[idx + 1]}_layer::${func}
+            %endfor
+            ) {
+            dditable->${tbl['name']}.${pfn} = ${layers[0]}::${func};
+        }
+        %if 'condition' in obj:
+    #endif // ${th.subt(n, tags, obj['condition'])}
+        %endif
+        %endfor
+        %endfor
+    }
+} // namespace ur_fused_layer
@@ -20,6 +20,7 @@ from templates import helper as th
  */
 #include "${x}_lib_loader.hpp"
 #include "${x}_loader.hpp"
+#include "${x}_small_vector.hpp"
 
 namespace ur_loader
 {
@@ -43,29 +44,22 @@ namespace ur_loader
         [[maybe_unused]] auto context = getContext();
         %if re.match(r"\w+AdapterGet$", th.make_func_name(n, tags, obj)):
         
-        size_t adapterIndex = 0;
         if( nullptr != ${obj['params'][1]['name']} && ${obj['params'][0]['name']} !=0)
         {
-            for( auto& platform : context->platforms )
+            try
             {
-                if(platform.initStatus != ${X}_RESULT_SUCCESS)
-                    continue;
-                platform.dditable.${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( 1, &${obj['params'][1]['name']}[adapterIndex], nullptr );
-                try
+                std::vector<platform_t *> adapterPlatforms;
+                context->adapterGet( ${obj['params'][0]['name']}, ${obj['params'][1]['name']}, adapterPlatforms );
+                for( size_t i = 0; i < adapterPlatforms.size(); ++i )
                 {
-                    ${obj['params'][1]['name']}[adapterIndex] = reinterpret_cast<${n}_adapter_handle_t>(context->factories.${n}_adapter_factory.getInstance(
-                        ${obj['params'][1]['name']}[adapterIndex], &platform.dditable
+                    ${obj['params'][1]['name']}[i] = reinterpret_cast<${n}_adapter_handle_t>(context->factories.${n}_adapter_factory.getInstance(
+                        ${obj['params'][1]['name']}[i], &adapterPlatforms[i]->dditable
                     ));
                 }
-                catch( std::bad_alloc &)
-                {
-                    result = ${X}_RESULT_ERROR_OUT_OF_HOST_MEMORY;
-                    break;
-                }
-                adapterIndex++;
-                if (adapterIndex == NumEntries) {
-                    break;
-                }
+            }
+            catch( std::bad_alloc &)
+            {
+                result = ${X}_RESULT_ERROR_OUT_OF_HOST_MEMORY;
             }
         }
 
@@ -77,6 +71,17 @@ namespace ur_loader
         %elif re.match(r"\w+PlatformGet$", th.make_func_name(n, tags, obj)):
         uint32_t total_platform_handle_count = 0;
 
+        // query the platform count of every adapter up front, concurrently
+        std::vector<std::pair<${x}_result_t, uint32_t>> library_platform_counts;
+        try
+        {
+            library_platform_counts = context->platformGetCounts( ${obj['params'][0]['name']}, ${obj['params'][1]['name']} );
+        }
+        catch( std::bad_alloc& )
+        {
+            return ${X}_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        }
+
         for( uint32_t adapter_index = 0; adapter_index < ${obj['params'][1]['name']}; adapter_index++)
         {
             // extract adapter's function pointer table
@@ -88,7 +93,7 @@ namespace ur_loader
 
             uint32_t library_platform_handle_count = 0;
 
-            result = dditable->${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( &${obj['params'][0]['name']}[adapter_index], 1, 0, nullptr, &library_platform_handle_count );
+            std::tie( result, library_platform_handle_count ) = library_platform_counts[adapter_index];
             if( ${X}_RESULT_SUCCESS != result ) break;
 
             if( nullptr != ${obj['params'][3]['name']} && ${obj['params'][2]['name']} !=0)
@@ -137,7 +142,7 @@ namespace ur_loader
         <%
         add_local = True
         param_replacements[item['name']] = item['name'] + 'Local.data()'%>// convert loader handles to platform handles
-        auto ${item['name']}Local = std::vector<${item['type']}>(${item['range'][1]});
+        auto ${item['name']}Local = small_vector_t<${item['type']}>(${item['range'][1]});
         for( size_t i = ${item['range'][0]}; i < ${item['range'][1]}; ++i )
             ${item['name']}Local[ i ] = reinterpret_cast<${item['obj']}*>( ${item['name']}[ i ] )->handle;
         %else:
@@ -380,7 +385,7 @@ ${tbl['export']['name']}(
 
     if( ${X}_RESULT_SUCCESS == result )
     {
-        if( ur_loader::getContext()->platforms.size() != 1 || ur_loader::getContext()->forceIntercept )
+        if( ur_loader::getContext()->intercept_enabled )
         {
             // return pointers to loader's DDIs
             %for obj in tbl['functions']:
@@ -29,6 +29,10 @@ def define_dbg(obj, tags):
  *
  */
 #include "${x}_lib.hpp"
+#ifdef ${X}_STATIC_DISPATCH_LEVEL_ZERO
+// The entry points call the static adapter directly, see ${X}_STATIC_DISPATCH
+#include "adapters/level_zero/${x}_interface_loader.hpp"
+#endif
 
 extern "C" {
 
@@ -59,11 +63,16 @@ try {
 %if th.obj_traits.is_loader_only(obj):
     return ur_lib::${th.make_func_name(n, tags, obj)}(${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
 %else:
-    ${th.get_initial_null_set(obj)}auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::getContext()->${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+    ${th.get_initial_null_set(obj)}
+#ifdef ${X}_STATIC_DISPATCH_LEVEL_ZERO
+    return ${n}::level_zero::${th.make_func_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+#else
+    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::getContext()->${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
     if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
         return ${X}_RESULT_ERROR_UNINITIALIZED;
 
     return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+#endif
 %endif
 } catch(...) { return exceptionToResult(std::current_exception()); }
 %if 'condition' in obj:
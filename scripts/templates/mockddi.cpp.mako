@@ -43,6 +43,8 @@ namespace driver
 
         ${th.make_pfncb_param_type(n, tags, obj)} params = { &${",&".join(th.make_param_lines(n, tags, obj, format=["name"]))} };
 
+        d_context.simulator.call("${fname}");
+
         auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
                 mock::getCallbacks().get_before_callback("${fname}"));
         if(beforeCallback) {
@@ -139,6 +141,20 @@ namespace driver
             return result;
         }
 
+        <%
+            param_names = th.make_param_lines(n, tags, obj, format=["name"])
+            blocking = [name for name in param_names if re.match(r"blocking", name)]
+        %>
+        %if 'hQueue' in param_names and 'phEvent' in param_names:
+        d_context.simulator.enqueue("${fname}", hQueue,
+            %if 'phEventWaitList' in param_names:
+            numEventsInWaitList, phEventWaitList,
+            %else:
+            0, nullptr,
+            %endif
+            phEvent, ${blocking[0] if blocking else "false"});
+
+        %endif
         auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
                 mock::getCallbacks().get_after_callback("${fname}"));
         if(afterCallback) {
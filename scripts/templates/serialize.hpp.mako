@@ -0,0 +1,172 @@
+<%!
+import re
+from templates import helper as th
+%><%
+    n=namespace
+    N=n.upper()
+
+    x=tags['$x']
+    X=x.upper()
+%>/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ${name}.hpp
+ * @version v${ver}-r${rev}
+ *
+ */
+#ifndef ${X}_SERIALIZE_HPP
+#define ${X}_SERIALIZE_HPP 1
+
+#include "${x}_print.hpp"
+#include <cstring>
+#include <ostream>
+
+## Mako helper functions ######################################################
+<%def name="member(iname, itype)">
+    %if th.type_traits.is_flags(itype):
+        ${x}::details::printFlag<${th.type_traits.get_flag_type(itype)}>(os, args.${iname});
+    %elif th.type_traits.is_pointer(itype):
+        ${x}::details::printPtr(os, reinterpret_cast<const void *>(args.${iname}));
+    %elif th.type_traits.is_native_handle(itype):
+        ${x}::details::printPtr(os, reinterpret_cast<void *>(args.${iname}));
+    %elif th.type_traits.is_handle(itype):
+        ${x}::details::printPtr(os, args.${iname});
+    %elif iname.startswith("pfn"):
+        os << reinterpret_cast<void *>(args.${iname});
+    %else:
+        os << args.${iname};
+    %endif
+</%def>
+
+namespace ${x}::serialize {
+%for tbl in th.get_pfncbtables(specs, meta, n, tags):
+%for obj in tbl['functions']:
+<%
+    fname = th.make_func_name(n, tags, obj)
+    sname = re.sub(r"_params_t$", "_args_t", th.make_pfncb_param_type(n, tags, obj))
+%>
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialized arguments of ${fname}
+struct ${sname} {
+    %for item in obj['params']:
+    ${th._get_type_name(n, tags, obj, item)} ${th._get_param_name(n, tags, item)};
+    %endfor
+};
+%endfor
+%endfor
+} // namespace ${x}::serialize
+
+namespace ${x}::extras {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get the size of the serialized parameters of a function
+/// @returns
+///     The size in bytes, or 0 if the function is unknown
+inline size_t ${X}_APICALL getSerializedFunctionParamsSize(ur_function_t function) {
+    switch(function) {
+    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
+    %for obj in tbl['functions']:
+        case ${th.make_func_etor(n, tags, obj)}:
+            return sizeof(${x}::serialize::${re.sub(r"_params_t$", "_args_t", th.make_pfncb_param_type(n, tags, obj))});
+    %endfor
+    %endfor
+        default: return 0;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Serialize function parameters
+/// @details
+///     - Writes the values of the arguments that params points to into
+///       buffer, without allocating. Pointer arguments are written as
+///       addresses, the data they point to isn't.
+/// @returns
+///     - ::${X}_RESULT_SUCCESS
+///     - ::${X}_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::${X}_RESULT_ERROR_INVALID_NULL_POINTER
+///         - `NULL == params`
+///         - `NULL == buffer`
+///     - ::${X}_RESULT_ERROR_INVALID_SIZE
+///         - `size < getSerializedFunctionParamsSize(function)`
+inline ${x}_result_t ${X}_APICALL serializeFunctionParams(ur_function_t function, const void *params, void *buffer, size_t size) {
+    if (!params || !buffer) {
+        return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    size_t required = getSerializedFunctionParamsSize(function);
+    if (required == 0) {
+        return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    if (size < required) {
+        return ${X}_RESULT_ERROR_INVALID_SIZE;
+    }
+
+    switch(function) {
+    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
+    %for obj in tbl['functions']:
+        case ${th.make_func_etor(n, tags, obj)}: {
+            [[maybe_unused]] auto p = (const struct ${th.make_pfncb_param_type(n, tags, obj)} *)params;
+            ${x}::serialize::${re.sub(r"_params_t$", "_args_t", th.make_pfncb_param_type(n, tags, obj))} args;
+            %for item in obj['params']:
+            args.${th._get_param_name(n, tags, item)} = *p->p${th._get_param_name(n, tags, item)};
+            %endfor
+            std::memcpy(buffer, &args, sizeof(args));
+        } break;
+    %endfor
+    %endfor
+        default: return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    return ${X}_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print serialized function parameters
+/// @details
+///     - Prints the arguments written by serializeFunctionParams in the
+///       format of printFunctionParams, e.g. in another process. Pointer
+///       arguments are printed as addresses, without the data they point to.
+/// @returns
+///     - ::${X}_RESULT_SUCCESS
+///     - ::${X}_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::${X}_RESULT_ERROR_INVALID_NULL_POINTER
+///         - `NULL == buffer`
+///     - ::${X}_RESULT_ERROR_INVALID_SIZE
+///         - `size < getSerializedFunctionParamsSize(function)`
+inline ${x}_result_t ${X}_APICALL printSerializedFunctionParams(std::ostream &os, ur_function_t function, const void *buffer, size_t size) {
+    if (!buffer) {
+        return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    size_t required = getSerializedFunctionParamsSize(function);
+    if (required == 0) {
+        return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    if (size < required) {
+        return ${X}_RESULT_ERROR_INVALID_SIZE;
+    }
+
+    switch(function) {
+    %for tbl in th.get_pfncbtables(specs, meta, n, tags):
+    %for obj in tbl['functions']:
+        case ${th.make_func_etor(n, tags, obj)}: {
+            ${x}::serialize::${re.sub(r"_params_t$", "_args_t", th.make_pfncb_param_type(n, tags, obj))} args;
+            std::memcpy(&args, buffer, sizeof(args));
+            %for i, item in enumerate(obj['params']):
+            %if i != 0:
+            os << ", ";
+            %endif
+            os << ".${th._get_param_name(n, tags, item)} = ";
+            ${member(th._get_param_name(n, tags, item), th._get_type_name(n, tags, obj, item))}
+            %endfor
+        } break;
+    %endfor
+    %endfor
+        default: return ${X}_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    return ${X}_RESULT_SUCCESS;
+}
+} // namespace ${x}::extras
+
+#endif /* ${X}_SERIALIZE_HPP */
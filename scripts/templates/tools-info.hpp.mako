@@ -29,43 +29,39 @@ from templates import helper as th
 namespace urinfo {
 %for obj in th.extract_objs(specs, r"enum"):
 %if obj["name"] == '$x_loader_config_info_t':
-inline void printLoaderConfigInfos(${x}_loader_config_handle_t hLoaderConfig, std::string_view prefix = "  ") {
+inline void printLoaderConfigInfos(printer_t &printer, ${x}_loader_config_handle_t hLoaderConfig) {
 %for etor in obj['etors']:
 %if 'REFERENCE_COUNT' not in etor['name']:
-    std::cout << prefix;
-    printLoaderConfigInfo<${etor['desc'][1:etor['desc'].find(' ')-1].replace('$x', x)}>(hLoaderConfig, ${etor['name'].replace('$X', X)});
+    printLoaderConfigInfo<${etor['desc'][1:etor['desc'].find(' ')-1].replace('$x', x)}>(printer, hLoaderConfig, ${etor['name'].replace('$X', X)});
 %endif
 %endfor
 }
 %endif
 %if obj["name"] == '$x_adapter_info_t':
-inline void printAdapterInfos(${x}_adapter_handle_t hAdapter, std::string_view prefix = "  ") {
+inline void printAdapterInfos(printer_t &printer, ${x}_adapter_handle_t hAdapter) {
 %for etor in obj['etors']:
 %if 'REFERENCE_COUNT' not in etor['name']:
-    std::cout << prefix;
-    printAdapterInfo<${etor['desc'][1:etor['desc'].find(' ')-1].replace('$x', x)}>(hAdapter, ${etor['name'].replace('$X', X)});
+    printAdapterInfo<${etor['desc'][1:etor['desc'].find(' ')-1].replace('$x', x)}>(printer, hAdapter, ${etor['name'].replace('$X', X)});
 %endif
 %endfor
 }
 
 %endif
 %if obj["name"] == '$x_platform_info_t':
-inline void printPlatformInfos(${x}_platform_handle_t hPlatform, std::string_view prefix = "    ") {
+inline void printPlatformInfos(printer_t &printer, ${x}_platform_handle_t hPlatform) {
 %for etor in obj['etors']:
-    std::cout << prefix;
-    printPlatformInfo<${etor['desc'][1:etor['desc'].find(' ')-1].replace('$x', x)}>(hPlatform, ${etor['name'].replace('$X', X)});
+    printPlatformInfo<${etor['desc'][1:etor['desc'].find(' ')-1].replace('$x', x)}>(printer, hPlatform, ${etor['name'].replace('$X', X)});
 %endfor
 }
 
 %endif
 %if obj['name'] == '$x_device_info_t':
-inline void printDeviceInfos(${x}_device_handle_t hDevice, std::string_view prefix = "      ") {
+inline void printDeviceInfos(printer_t &printer, ${x}_device_handle_t hDevice) {
 %for etor in obj['etors']:
-    std::cout << prefix;
 %if etor['name'] == '$X_DEVICE_INFO_UUID':
-    printDeviceUUID(hDevice, ${etor['name'].replace('$X', X)});
+    printDeviceUUID(printer, hDevice, ${etor['name'].replace('$X', X)});
 %else:
-    printDeviceInfo<${etor['desc'][1:etor['desc'].find(' ')-1].replace('$x', x)}>(hDevice, ${etor['name'].replace('$X', X)});
+    printDeviceInfo<${etor['desc'][1:etor['desc'].find(' ')-1].replace('$x', x)}>(printer, hDevice, ${etor['name'].replace('$X', X)});
 %endif
 %endfor
 }
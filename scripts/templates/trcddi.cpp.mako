@@ -42,8 +42,11 @@ namespace ur_tracing_layer
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !getContext()->isTraced(${th.make_func_etor(n, tags, obj)}) )
+            return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+
         ${th.make_pfncb_param_type(n, tags, obj)} params = { &${",&".join(th.make_param_lines(n, tags, obj, format=["name"]))} };
-        uint64_t instance = getContext()->notify_begin(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params);
+        uint64_t instance = getContext()->notify_begin(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))});
 
         auto &logger = getContext()->logger;
         logger.info("   ---> ${th.make_func_name(n, tags, obj)}\n");
@@ -66,6 +69,23 @@ namespace ur_tracing_layer
 
     %endfor
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Ids and names of all functions intercepted by the tracing layer
+    std::vector<std::pair<uint32_t, const char *>> getTracedFunctions()
+    {
+        return {
+            %for obj in th.get_adapter_functions(specs):
+            %if 'condition' in obj:
+    #if ${th.subt(n, tags, obj['condition'])}
+            %endif
+            {${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}"},
+            %if 'condition' in obj:
+    #endif // ${th.subt(n, tags, obj['condition'])}
+            %endif
+            %endfor
+        };
+    }
+
     %for tbl in th.get_pfntables(specs, meta, n, tags):
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Exported function for filling application's ${tbl['name']} table
@@ -127,6 +147,8 @@ namespace ur_tracing_layer
 
         ur_tracing_layer::getContext()->codelocData = codelocData;
 
+        configure();
+
     %for tbl in th.get_pfntables(specs, meta, n, tags):
         if( ${X}_RESULT_SUCCESS == result )
         {
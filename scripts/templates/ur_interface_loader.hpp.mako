@@ -8,7 +8,9 @@ from templates import helper as th
     x=tags['$x']
     X=x.upper()
     Adapter=adapter.upper()
-%>//===--------- ${n}_interface_loader.hpp - Level Zero Adapter ------------===//
+    AdapterName={'level_zero': 'Level Zero', 'cuda': 'CUDA', 'hip': 'HIP',
+                 'opencl': 'OpenCL', 'native_cpu': 'Native CPU'}[adapter]
+%>//===--------- ${n}_interface_loader.hpp - ${AdapterName} Adapter ------------===//
 //
 // Copyright (C) 2024 Intel Corporation
 //
@@ -32,7 +34,7 @@ ${x}_result_t ${th.make_func_name(n, tags, obj)}(
 %endif
 %endfor
 %endfor
-#ifdef UR_STATIC_ADAPTER_LEVEL_ZERO
+#ifdef UR_STATIC_ADAPTER_${Adapter}
 ur_result_t urAdapterGetDdiTables(ur_dditable_t *ddi);
 #endif
 }
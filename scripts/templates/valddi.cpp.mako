@@ -31,7 +31,9 @@ namespace ur_validation_layer
 
         param_checks=th.make_param_checks(n, tags, obj, meta=meta).items()
         first_errors = [X + "_RESULT_ERROR_INVALID_NULL_POINTER", X + "_RESULT_ERROR_INVALID_NULL_HANDLE"]
-        sorted_param_checks = sorted(param_checks, key=lambda pair: False if pair[0] in first_errors else True)
+        handle_checks = [pair for pair in param_checks if pair[0] in first_errors]
+        other_checks = [pair for pair in param_checks if pair[0] not in first_errors]
+        has_event_wait_list = func_name in th.get_event_wait_list_functions(specs, n, tags)
 
         tracked_params = list(filter(lambda p: any(th.subt(n, tags, p['type']) in [hf['handle'], hf['handle'] + "*"] for hf in handle_create_get_retain_release_funcs), obj['params']))
     %>
@@ -53,9 +55,23 @@ namespace ur_validation_layer
             return ${X}_RESULT_ERROR_UNINITIALIZED;
         }
 
+        %if handle_checks:
+        if( getContext()->enableHandleValidation )
+        {
+            %for key, values in handle_checks:
+            %for val in values:
+            if ( ${val} )
+                return ${key};
+
+            %endfor
+            %endfor
+        }
+
+        %endif
+        %if other_checks or has_event_wait_list:
         if( getContext()->enableParameterValidation )
         {
-            %for key, values in sorted_param_checks:
+            %for key, values in other_checks:
             %for val in values:
             %if 'boundsError' in val:
             if ( getContext()->enableBoundsChecking ) {
@@ -70,7 +86,7 @@ namespace ur_validation_layer
 
             %endfor
             %endfor
-            %if func_name in th.get_event_wait_list_functions(specs, n, tags):
+            %if has_event_wait_list:
             if (phEventWaitList != NULL && numEventsInWaitList > 0) {
                 for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
                     if (phEventWaitList[i] == NULL) {
@@ -81,6 +97,7 @@ namespace ur_validation_layer
             %endif
 
         }
+        %endif
 
             %for tp in tracked_params:
             <%
@@ -185,6 +202,7 @@ namespace ur_validation_layer
         ${x}_result_t result = ${X}_RESULT_SUCCESS;
 
         if (enabledLayerNames.count(nameFullValidation)) {
+            enableHandleValidation = true;
             enableParameterValidation = true;
             enableBoundsChecking = true;
             enableLeakChecking = true;
@@ -193,7 +211,12 @@ namespace ur_validation_layer
             if (enabledLayerNames.count(nameBoundsChecking)) {
                 enableBoundsChecking = true;
             }
+            if (enabledLayerNames.count(nameHandleValidation)) {
+                enableHandleValidation = true;
+            }
             if (enabledLayerNames.count(nameParameterValidation)) {
+                // Null handle and pointer checks are part of parameter validation.
+                enableHandleValidation = true;
                 enableParameterValidation = true;
             }
             if (enabledLayerNames.count(nameLeakChecking)) {
@@ -206,10 +229,12 @@ namespace ur_validation_layer
             }
         }
 
-        if (!enableParameterValidation && !enableLeakChecking && !enableLifetimeValidation) {
+        if (!enableHandleValidation && !enableParameterValidation && !enableLeakChecking && !enableLifetimeValidation) {
             return result;
         }
 
+        configure();
+
         %for tbl in th.get_pfntables(specs, meta, n, tags):
         if ( ${X}_RESULT_SUCCESS == result )
         {
@@ -13,6 +13,7 @@
 #include "common.hpp"
 #include "logger/ur_logger.hpp"
 #include "tracing.hpp"
+#include "ur_interface_loader.hpp"
 
 struct ur_adapter_handle_t_ {
   std::atomic<uint32_t> RefCount = 0;
@@ -53,9 +54,10 @@ ur_adapter_handle_t_::ur_adapter_handle_t_()
 }
 ur_adapter_handle_t_ adapter{};
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urAdapterGet(uint32_t NumEntries, ur_adapter_handle_t *phAdapters,
-             uint32_t *pNumAdapters) {
+namespace ur::cuda {
+
+ur_result_t urAdapterGet(uint32_t NumEntries, ur_adapter_handle_t *phAdapters,
+                         uint32_t *pNumAdapters) {
   if (NumEntries > 0 && phAdapters) {
     std::lock_guard<std::mutex> Lock{adapter.Mutex};
     if (adapter.RefCount++ == 0) {
@@ -73,13 +75,13 @@ urAdapterGet(uint32_t NumEntries, ur_adapter_handle_t *phAdapters,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterRetain(ur_adapter_handle_t) {
+ur_result_t urAdapterRetain(ur_adapter_handle_t) {
   adapter.RefCount++;
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
+ur_result_t urAdapterRelease(ur_adapter_handle_t) {
   std::lock_guard<std::mutex> Lock{adapter.Mutex};
   if (--adapter.RefCount == 0) {
     disableCUDATracing(adapter.TracingCtx);
@@ -89,18 +91,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetLastError(
-    ur_adapter_handle_t, const char **ppMessage, int32_t *pError) {
+ur_result_t urAdapterGetLastError(ur_adapter_handle_t, const char **ppMessage,
+                                  int32_t *pError) {
   std::ignore = pError;
   *ppMessage = ErrorMessage;
   return ErrorMessageCode;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
-                                                     ur_adapter_info_t propName,
-                                                     size_t propSize,
-                                                     void *pPropValue,
-                                                     size_t *pPropSizeRet) {
+ur_result_t urAdapterGetInfo(ur_adapter_handle_t, ur_adapter_info_t propName,
+                             size_t propSize, void *pPropValue,
+                             size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   switch (propName) {
@@ -114,3 +114,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
 
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::cuda
@@ -16,6 +16,7 @@
 #include "kernel.hpp"
 #include "memory.hpp"
 #include "queue.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <cstring>
 
@@ -49,18 +50,18 @@ ur_exp_command_buffer_handle_t_::ur_exp_command_buffer_handle_t_(
     : Context(Context), Device(Device),
       IsUpdatable(IsUpdatable), CudaGraph{nullptr}, CudaGraphExec{nullptr},
       RefCountInternal{1}, RefCountExternal{1}, NextSyncPoint{0} {
-  urContextRetain(Context);
-  urDeviceRetain(Device);
+  ur::cuda::urContextRetain(Context);
+  ur::cuda::urDeviceRetain(Device);
 }
 
 /// The ur_exp_command_buffer_handle_t_ destructor releases
 /// all the memory objects allocated for command_buffer managment
 ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
   // Release the memory allocated to the Context stored in the command_buffer
-  UR_TRACE(urContextRelease(Context));
+  UR_TRACE(ur::cuda::urContextRelease(Context));
 
   // Release the device
-  UR_TRACE(urDeviceRelease(Device));
+  UR_TRACE(ur::cuda::urDeviceRelease(Device));
 
   // Release the memory allocated to the CudaGraph
   cuGraphDestroy(CudaGraph);
@@ -79,9 +80,10 @@ ur_exp_command_buffer_command_handle_t_::
         const size_t *LocalWorkSizePtr, uint32_t NumKernelAlternatives,
         ur_kernel_handle_t *KernelAlternatives)
     : CommandBuffer(CommandBuffer), Kernel(Kernel), ValidKernelHandles(),
-      Node(Node), Params(Params), WorkDim(WorkDim), RefCountInternal(1),
-      RefCountExternal(1) {
+      Node(Node), Params(Params), Args(Kernel->Args), WorkDim(WorkDim),
+      RefCountInternal(1), RefCountExternal(1) {
   CommandBuffer->incrementInternalReferenceCount();
+  this->Params.kernelParams = const_cast<void **>(Args.getIndices().data());
 
   const size_t CopySize = sizeof(size_t) * WorkDim;
   std::memcpy(GlobalWorkOffset, GlobalWorkOffsetPtr, CopySize);
@@ -281,10 +283,13 @@ static ur_result_t enqueueCommandBufferFillHelper(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
-    ur_context_handle_t hContext, ur_device_handle_t hDevice,
-    const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
-    ur_exp_command_buffer_handle_t *phCommandBuffer) {
+namespace ur::cuda {
+
+ur_result_t
+urCommandBufferCreateExp(ur_context_handle_t hContext,
+                         ur_device_handle_t hDevice,
+                         const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
+                         ur_exp_command_buffer_handle_t *phCommandBuffer) {
 
   const bool IsUpdatable =
       pCommandBufferDesc ? pCommandBufferDesc->isUpdatable : false;
@@ -307,14 +312,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urCommandBufferRetainExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   hCommandBuffer->incrementInternalReferenceCount();
   hCommandBuffer->incrementExternalReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   if (hCommandBuffer->decrementExternalReferenceCount() == 0) {
     // External ref count has reached zero, internal release of created
@@ -327,7 +332,7 @@ urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   return commandBufferReleaseInternal(hCommandBuffer);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   try {
     const unsigned long long flags = 0;
@@ -349,7 +354,7 @@ urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
+ur_result_t urCommandBufferAppendKernelLaunchExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_kernel_handle_t hKernel,
     uint32_t workDim, const size_t *pGlobalWorkOffset,
     const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
@@ -419,21 +424,22 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
                                         DepsList.data(), DepsList.size(),
                                         &NodeParams));
 
-    if (LocalSize != 0)
-      hKernel->clearLocalSize();
-
     // Get sync point and register the cuNode with it.
     auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
 
+    // The command copies the arguments, local sizes included, of hKernel
     auto NewCommand = new ur_exp_command_buffer_command_handle_t_{
         hCommandBuffer,      hKernel,        GraphNode,
         NodeParams,          workDim,        pGlobalWorkOffset,
         pGlobalWorkSize,     pLocalWorkSize, numKernelAlternatives,
         phKernelAlternatives};
 
+    if (LocalSize != 0)
+      hKernel->clearLocalSize();
+
     NewCommand->incrementInternalReferenceCount();
     hCommandBuffer->CommandHandles.push_back(NewCommand);
 
@@ -447,7 +453,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
+ur_result_t urCommandBufferAppendUSMMemcpyExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst, const void *pSrc,
     size_t size, uint32_t numSyncPointsInWaitList,
     const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
@@ -477,7 +483,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
+ur_result_t urCommandBufferAppendMemBufferCopyExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
     ur_mem_handle_t hDstMem, size_t srcOffset, size_t dstOffset, size_t size,
     uint32_t numSyncPointsInWaitList,
@@ -519,7 +525,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
+ur_result_t urCommandBufferAppendMemBufferCopyRectExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
     ur_mem_handle_t hDstMem, ur_rect_offset_t srcOrigin,
     ur_rect_offset_t dstOrigin, ur_rect_region_t region, size_t srcRowPitch,
@@ -558,8 +564,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
+ur_result_t urCommandBufferAppendMemBufferWriteExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
     size_t offset, size_t size, const void *pSrc,
     uint32_t numSyncPointsInWaitList,
@@ -593,8 +598,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
+ur_result_t urCommandBufferAppendMemBufferReadExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
     size_t offset, size_t size, void *pDst, uint32_t numSyncPointsInWaitList,
     const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
@@ -627,8 +631,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
+ur_result_t urCommandBufferAppendMemBufferWriteRectExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
     ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
     ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
@@ -666,8 +669,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
+ur_result_t urCommandBufferAppendMemBufferReadRectExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
     ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
     ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
@@ -705,7 +707,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
+ur_result_t urCommandBufferAppendUSMPrefetchExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, const void * /* Mem */,
     size_t /*Size*/, ur_usm_migration_flags_t /*Flags*/,
     uint32_t numSyncPointsInWaitList,
@@ -736,7 +738,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
+ur_result_t urCommandBufferAppendUSMAdviseExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, const void * /* Mem */,
     size_t /*Size*/, ur_usm_advice_flags_t /*Advice*/,
     uint32_t numSyncPointsInWaitList,
@@ -767,7 +769,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
+ur_result_t urCommandBufferAppendMemBufferFillExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
     const void *pPattern, size_t patternSize, size_t offset, size_t size,
     uint32_t numSyncPointsInWaitList,
@@ -792,7 +794,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
       size, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
+ur_result_t urCommandBufferAppendUSMFillExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, void *pPtr,
     const void *pPattern, size_t patternSize, size_t size,
     uint32_t numSyncPointsInWaitList,
@@ -810,10 +812,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
       numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
+ur_result_t urCommandBufferEnqueueExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
+  hQueue->Telemetry.commandSubmittedAsBatch(
+      UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP);
 
   try {
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
@@ -833,6 +837,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
       UR_CHECK_ERROR(RetImplEvent->start());
     }
 
+    // Set the parameters of the nodes updated since the last launch
+    for (auto Command : hCommandBuffer->PendingUpdates) {
+      UR_CHECK_ERROR(cuGraphExecKernelNodeSetParams(
+          hCommandBuffer->CudaGraphExec, Command->Node, &Command->Params));
+      Command->UpdatePending = false;
+    }
+    hCommandBuffer->PendingUpdates.clear();
+
     // Launch graph
     UR_CHECK_ERROR(cuGraphLaunch(hCommandBuffer->CudaGraphExec, CuStream));
 
@@ -847,18 +859,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
+ur_result_t urCommandBufferRetainCommandExp(
     ur_exp_command_buffer_command_handle_t hCommand) {
   hCommand->incrementExternalReferenceCount();
   hCommand->incrementInternalReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
+ur_result_t urCommandBufferReleaseCommandExp(
     ur_exp_command_buffer_command_handle_t hCommand) {
   hCommand->decrementExternalReferenceCount();
   return commandHandleReleaseInternal(hCommand);
 }
+} // namespace ur::cuda
 
 /**
  * Validates contents of the update command description.
@@ -892,18 +905,21 @@ validateCommandDesc(ur_exp_command_buffer_command_handle_t Command,
 }
 
 /**
- * Updates the arguments of CommandDesc->hNewKernel
+ * Updates the arguments of the command, only rewriting those in the update
+ * description.
  * @param[in] Device The device associated with the kernel being updated.
- * @param[in] UpdateCommandDesc The update command description that contains the
- * new kernel and its arguments.
+ * @param[in] Command The command whose arguments are updated.
+ * @param[in] UpdateCommandDesc The update command description that contains
+ * the new arguments.
  * @return UR_RESULT_SUCCESS or an error code on failure
  */
 ur_result_t
 updateKernelArguments(ur_device_handle_t Device,
+                      ur_exp_command_buffer_command_handle_t Command,
                       const ur_exp_command_buffer_update_kernel_launch_desc_t
                           *UpdateCommandDesc) {
 
-  ur_kernel_handle_t NewKernel = UpdateCommandDesc->hNewKernel;
+  auto &Args = Command->Args;
 
   // Update pointer arguments to the kernel
   uint32_t NumPointerArgs = UpdateCommandDesc->numNewPointerArgs;
@@ -916,7 +932,7 @@ updateKernelArguments(ur_device_handle_t Device,
 
     ur_result_t Result = UR_RESULT_SUCCESS;
     try {
-      NewKernel->setKernelArg(ArgIndex, sizeof(ArgValue), ArgValue);
+      Args.addArg(ArgIndex, sizeof(ArgValue), ArgValue);
     } catch (ur_result_t Err) {
       Result = Err;
       return Result;
@@ -935,10 +951,10 @@ updateKernelArguments(ur_device_handle_t Device,
     ur_result_t Result = UR_RESULT_SUCCESS;
     try {
       if (ArgValue == nullptr) {
-        NewKernel->setKernelArg(ArgIndex, 0, nullptr);
+        Args.addArg(ArgIndex, 0, nullptr);
       } else {
         CUdeviceptr CuPtr = std::get<BufferMem>(ArgValue->Mem).getPtr(Device);
-        NewKernel->setKernelArg(ArgIndex, sizeof(CUdeviceptr), (void *)&CuPtr);
+        Args.addArg(ArgIndex, sizeof(CUdeviceptr), (void *)&CuPtr);
       }
     } catch (ur_result_t Err) {
       Result = Err;
@@ -958,7 +974,7 @@ updateKernelArguments(ur_device_handle_t Device,
 
     ur_result_t Result = UR_RESULT_SUCCESS;
     try {
-      NewKernel->setKernelArg(ArgIndex, ArgSize, ArgValue);
+      Args.addArg(ArgIndex, ArgSize, ArgValue);
     } catch (ur_result_t Err) {
       Result = Err;
       return Result;
@@ -980,8 +996,10 @@ updateCommand(ur_exp_command_buffer_command_handle_t Command,
               const ur_exp_command_buffer_update_kernel_launch_desc_t
                   *UpdateCommandDesc) {
 
-  if (UpdateCommandDesc->hNewKernel) {
+  if (UpdateCommandDesc->hNewKernel &&
+      UpdateCommandDesc->hNewKernel != Command->Kernel) {
     Command->Kernel = UpdateCommandDesc->hNewKernel;
+    Command->Args = Command->Kernel->Args;
   }
 
   if (UpdateCommandDesc->newWorkDim) {
@@ -1006,7 +1024,9 @@ updateCommand(ur_exp_command_buffer_command_handle_t Command,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
+namespace ur::cuda {
+
+ur_result_t urCommandBufferUpdateKernelLaunchExp(
     ur_exp_command_buffer_command_handle_t hCommand,
     const ur_exp_command_buffer_update_kernel_launch_desc_t
         *pUpdateKernelLaunch) {
@@ -1014,9 +1034,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
   ur_exp_command_buffer_handle_t CommandBuffer = hCommand->CommandBuffer;
 
   UR_CHECK_ERROR(validateCommandDesc(hCommand, pUpdateKernelLaunch));
-  UR_CHECK_ERROR(
-      updateKernelArguments(CommandBuffer->Device, pUpdateKernelLaunch));
   UR_CHECK_ERROR(updateCommand(hCommand, pUpdateKernelLaunch));
+  UR_CHECK_ERROR(updateKernelArguments(CommandBuffer->Device, hCommand,
+                                       pUpdateKernelLaunch));
 
   // If no work-size is provided make sure we pass nullptr to setKernelParams so
   // it can guess the local work size.
@@ -1045,20 +1065,30 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
   Params.blockDimX = ThreadsPerBlock[0];
   Params.blockDimY = ThreadsPerBlock[1];
   Params.blockDimZ = ThreadsPerBlock[2];
-  Params.sharedMemBytes = hCommand->Kernel->getLocalSize();
+  Params.sharedMemBytes = hCommand->Args.getLocalSize();
   Params.kernelParams =
-      const_cast<void **>(hCommand->Kernel->getArgIndices().data());
-
-  CUgraphNode Node = hCommand->Node;
-  CUgraphExec CudaGraphExec = CommandBuffer->CudaGraphExec;
-  UR_CHECK_ERROR(cuGraphExecKernelNodeSetParams(CudaGraphExec, Node, &Params));
+      const_cast<void **>(hCommand->Args.getIndices().data());
+
+  // setKernelParams sets the implicit offset of the kernel
+  auto &KernelArgs = hCommand->Kernel->Args;
+  hCommand->Args.setImplicitOffset(sizeof(KernelArgs.ImplicitOffsetArgs),
+                                   KernelArgs.ImplicitOffsetArgs);
+
+  // The node is updated with the others at the next enqueue, the parameters
+  // of a node only being set once however many updates it had since the
+  // last launch
+  if (!hCommand->UpdatePending) {
+    hCommand->UpdatePending = true;
+    CommandBuffer->PendingUpdates.push_back(hCommand);
+  }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferGetInfoExp(
-    ur_exp_command_buffer_handle_t hCommandBuffer,
-    ur_exp_command_buffer_info_t propName, size_t propSize, void *pPropValue,
-    size_t *pPropSizeRet) {
+ur_result_t
+urCommandBufferGetInfoExp(ur_exp_command_buffer_handle_t hCommandBuffer,
+                          ur_exp_command_buffer_info_t propName,
+                          size_t propSize, void *pPropValue,
+                          size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   switch (propName) {
@@ -1071,7 +1101,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferGetInfoExp(
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
+ur_result_t urCommandBufferCommandGetInfoExp(
     ur_exp_command_buffer_command_handle_t hCommand,
     ur_exp_command_buffer_command_info_t propName, size_t propSize,
     void *pPropValue, size_t *pPropSizeRet) {
@@ -1086,3 +1116,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
 
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
+} // namespace ur::cuda
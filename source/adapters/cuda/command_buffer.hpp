@@ -13,6 +13,7 @@
 #include <ur_print.hpp>
 
 #include "context.hpp"
+#include "kernel.hpp"
 #include "logger/ur_logger.hpp"
 #include <cuda.h>
 #include <memory>
@@ -112,6 +113,14 @@ struct ur_exp_command_buffer_command_handle_t_ {
   CUgraphNode Node;
   CUDA_KERNEL_NODE_PARAMS Params;
 
+  // The arguments of the node, copied from Kernel on append or when the
+  // command switches to another kernel, so that an update only rewrites the
+  // arguments it changes. Params.kernelParams points into them.
+  ur_kernel_handle_t_::arguments Args;
+
+  // Whether the command is in CommandBuffer->PendingUpdates
+  bool UpdatePending = false;
+
   uint32_t WorkDim;
   size_t GlobalWorkOffset[3];
   size_t GlobalWorkSize[3];
@@ -192,4 +201,7 @@ struct ur_exp_command_buffer_handle_t_ {
 
   // Handles to individual commands in the command-buffer
   std::vector<ur_exp_command_buffer_command_handle_t> CommandHandles;
+  // Commands updated since the executable graph was last launched, whose
+  // node parameters are set in a single pass before the next launch
+  std::vector<ur_exp_command_buffer_command_handle_t> PendingUpdates;
 };
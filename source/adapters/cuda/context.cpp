@@ -9,10 +9,65 @@
 //===----------------------------------------------------------------------===//
 
 #include "context.hpp"
+#include "queue.hpp"
 #include "usm.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <cassert>
 
+size_t ur_context_handle_t_::physicalMemPoolSize() {
+  static const size_t Size =
+      getenv_to_unsigned("UR_CUDA_PHYSICAL_MEM_POOL_SIZE_MB").value_or(256) *
+      1024 * 1024;
+  return Size;
+}
+
+size_t ur_context_handle_t_::trimPhysicalMemPool(size_t BytesToKeep) {
+  auto Release = [](ur_device_handle_t hDevice,
+                    CUmemGenericAllocationHandle PhysicalMem) {
+    try {
+      ScopedContext Active(hDevice);
+      std::ignore = cuMemRelease(PhysicalMem);
+    } catch (...) {
+    }
+  };
+  return PhysicalMemPool.trim(BytesToKeep, Release);
+}
+
+size_t ur_context_handle_t_::hostRegisterCacheSize() {
+  static const size_t Size =
+      getenv_to_unsigned("UR_CUDA_HOST_REGISTER_CACHE_SIZE").value_or(0);
+  return Size;
+}
+
+static ur_result_t unregisterHost(void *HostPtr) {
+  return mapErrorUR(cuMemHostUnregister(HostPtr));
+}
+
+ur_result_t ur_context_handle_t_::registerHostPtr(void *HostPtr, size_t Size) {
+  ScopedContext Active(Devices[0]);
+  // Portable, so that it is pinned for the contexts of all the devices
+  auto Register = [](void *Ptr, size_t Bytes) {
+    return mapErrorUR(cuMemHostRegister(Ptr, Bytes,
+                                        CU_MEMHOSTREGISTER_PORTABLE |
+                                            CU_MEMHOSTREGISTER_DEVICEMAP));
+  };
+  return HostRegisterCache.acquire(HostPtr, Size, Register, unregisterHost);
+}
+
+ur_result_t ur_context_handle_t_::unregisterHostPtr(void *HostPtr) {
+  ScopedContext Active(Devices[0]);
+  return HostRegisterCache.release(HostPtr, unregisterHost);
+}
+
+void ur_context_handle_t_::clearHostRegisterCache() {
+  try {
+    ScopedContext Active(Devices[0]);
+    HostRegisterCache.clear(unregisterHost);
+  } catch (...) {
+  }
+}
+
 void ur_context_handle_t_::addPool(ur_usm_pool_handle_t Pool) {
   std::lock_guard<std::mutex> Lock(Mutex);
   PoolHandles.insert(Pool);
@@ -34,6 +89,185 @@ ur_context_handle_t_::getOwningURPool(umf_memory_pool_t *UMFPool) {
   return nullptr;
 }
 
+CUevent ur_context_handle_t_::getEvent(ur_device_handle_t hDevice,
+                                       bool Timing) {
+  {
+    std::lock_guard<std::mutex> Lock(EventPoolsMutex);
+    auto &Pool = EventPools[getDeviceIndex(hDevice)][Timing];
+    if (!Pool.empty()) {
+      CUevent Event = Pool.back();
+      Pool.pop_back();
+      return Event;
+    }
+  }
+  CUevent Event;
+  UR_CHECK_ERROR(cuEventCreate(&Event, Timing ? CU_EVENT_DEFAULT
+                                       : CU_EVENT_DISABLE_TIMING));
+  return Event;
+}
+
+void ur_context_handle_t_::recycleEvent(ur_device_handle_t hDevice,
+                                        bool Timing, CUevent Event) {
+  {
+    std::lock_guard<std::mutex> Lock(EventPoolsMutex);
+    auto &Pool = EventPools[getDeviceIndex(hDevice)][Timing];
+    if (Pool.size() < MaxPooledEvents) {
+      Pool.push_back(Event);
+      return;
+    }
+  }
+  UR_CHECK_ERROR(cuEventDestroy(Event));
+}
+
+void ur_context_handle_t_::destroyEvents() {
+  for (auto &Pools : EventPools) {
+    for (auto &Pool : Pools) {
+      for (CUevent Event : Pool) {
+        cuEventDestroy(Event);
+      }
+    }
+  }
+}
+
+void ur_context_handle_t_::addQueue(ur_queue_handle_t hQueue) {
+  std::lock_guard<std::mutex> Lock(QueuesMutex);
+  Queues.insert(hQueue);
+}
+
+void ur_context_handle_t_::removeQueue(ur_queue_handle_t hQueue) {
+  std::lock_guard<std::mutex> Lock(QueuesMutex);
+  Queues.erase(hQueue);
+}
+
+bool ur_context_handle_t_::isDeferredFreeEnabled() {
+  static const bool Enabled = getenv_tobool("UR_CUDA_USM_DEFERRED_FREE");
+  return Enabled;
+}
+
+ur_result_t ur_context_handle_t_::deferFree(void *Ptr) {
+  ur_result_t Result = reclaimDeferredFrees();
+
+  // The allocation isn't tracked per command, as kernels access memory
+  // indirectly, so the free waits for all the streams with pending commands
+  std::vector<deferred_free_marker_t> Markers;
+  try {
+    std::lock_guard<std::mutex> Lock(QueuesMutex);
+    for (ur_queue_handle_t Queue : Queues) {
+      ur_device_handle_t Device = Queue->getDevice();
+      ScopedContext Active(Device);
+      Queue->forEachStream([&](CUstream Stream) {
+        if (cuStreamQuery(Stream) == CUDA_SUCCESS) {
+          return;
+        }
+        CUevent Event = getEvent(Device, false);
+        Markers.push_back({Device, Event});
+        UR_CHECK_ERROR(cuEventRecord(Event, Stream));
+      });
+    }
+  } catch (ur_result_t Err) {
+    // Without all the markers the memory can only be freed once idle
+    for (deferred_free_marker_t &Marker : Markers) {
+      std::ignore = cuEventDestroy(Marker.Event);
+    }
+    Markers.clear();
+    std::lock_guard<std::mutex> Lock(QueuesMutex);
+    for (ur_queue_handle_t Queue : Queues) {
+      Queue->forEachStream(
+          [](CUstream Stream) { std::ignore = cuStreamSynchronize(Stream); });
+    }
+    if (Err != UR_RESULT_SUCCESS) {
+      Result = Err;
+    }
+  }
+
+  if (Markers.empty()) {
+    ur_result_t FreeResult = USMFreeNow(this, Ptr);
+    return FreeResult != UR_RESULT_SUCCESS ? FreeResult : Result;
+  }
+  DeferredFrees.defer(Ptr, std::move(Markers));
+  return Result;
+}
+
+ur_result_t
+ur_context_handle_t_::reclaimDeferredFrees(bool WaitForMarkers) {
+  auto IsDone = [WaitForMarkers](deferred_free_marker_t &Marker) {
+    if (WaitForMarkers) {
+      std::ignore = cuEventSynchronize(Marker.Event);
+      return true;
+    }
+    return cuEventQuery(Marker.Event) != CUDA_ERROR_NOT_READY;
+  };
+  auto Retire = [this](deferred_free_marker_t &Marker) {
+    try {
+      recycleEvent(Marker.Device, false, Marker.Event);
+    } catch (...) {
+    }
+  };
+  auto Free = [this](void *Ptr) { return USMFreeNow(this, Ptr); };
+  return DeferredFrees.reclaim(IsDone, Retire, Free);
+}
+
+bool ur_context_handle_t_::enablePeerAccess(ur_device_handle_t hDevice,
+                                            ur_device_handle_t hPeer) {
+  std::lock_guard<std::mutex> Lock(PeerAccessMutex);
+  std::optional<bool> &Access =
+      PeerAccess[getDeviceIndex(hDevice) * Devices.size() +
+                 getDeviceIndex(hPeer)];
+  if (!Access) {
+    int Supported = 0;
+    UR_CHECK_ERROR(ur::cuda::urUsmP2PPeerAccessGetInfoExp(
+        hDevice, hPeer, UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED,
+        sizeof(Supported), &Supported, nullptr));
+    if (Supported) {
+      // The access may have been enabled with urUsmP2PEnablePeerAccessExp
+      ScopedContext Active(hDevice);
+      CUresult Result = cuCtxEnablePeerAccess(hPeer->getNativeContext(), 0);
+      Supported = Result == CUDA_SUCCESS ||
+                  Result == CUDA_ERROR_PEER_ACCESS_ALREADY_ENABLED;
+    }
+    Access = Supported != 0;
+  }
+  return *Access;
+}
+
+#if CUDA_VERSION >= 11020
+CUmemoryPool
+ur_context_handle_t_::getAsyncMemPool(ur_device_handle_t hDevice) {
+  std::lock_guard<std::mutex> Lock(AsyncMemPoolsMutex);
+  CUmemoryPool &Pool = AsyncMemPools[getDeviceIndex(hDevice)];
+  if (Pool ||
+      !getAttribute(hDevice, CU_DEVICE_ATTRIBUTE_MEMORY_POOLS_SUPPORTED)) {
+    return Pool;
+  }
+
+  CUmemPoolProps Props{};
+  Props.allocType = CU_MEM_ALLOCATION_TYPE_PINNED;
+  Props.handleTypes = CU_MEM_HANDLE_TYPE_NONE;
+  Props.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+  Props.location.id = hDevice->get();
+  UR_CHECK_ERROR(cuMemPoolCreate(&Pool, &Props));
+
+  static const cuuint64_t ReleaseThreshold = [] {
+    const char *EnvVar = std::getenv("UR_CUDA_USM_ASYNC_RELEASE_THRESHOLD");
+    return EnvVar ? std::strtoull(EnvVar, nullptr, 10) : UINT64_MAX;
+  }();
+  cuuint64_t Threshold = ReleaseThreshold;
+  UR_CHECK_ERROR(cuMemPoolSetAttribute(
+      Pool, CU_MEMPOOL_ATTR_RELEASE_THRESHOLD, &Threshold));
+  return Pool;
+}
+
+void ur_context_handle_t_::destroyAsyncMemPools() {
+  for (CUmemoryPool Pool : AsyncMemPools) {
+    if (Pool) {
+      cuMemPoolDestroy(Pool);
+    }
+  }
+}
+#endif // CUDA_VERSION >= 11020
+
+namespace ur::cuda {
+
 /// Create a UR CUDA context.
 ///
 /// By default creates a scoped context and keeps the last active CUDA context
@@ -42,10 +276,10 @@ ur_context_handle_t_::getOwningURPool(umf_memory_pool_t *UMFPool) {
 /// PI_TRUE creates a primary CUDA context and activates it on the CUDA context
 /// stack.
 ///
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextCreate(uint32_t DeviceCount, const ur_device_handle_t *phDevices,
-                const ur_context_properties_t *pProperties,
-                ur_context_handle_t *phContext) {
+ur_result_t urContextCreate(uint32_t DeviceCount,
+                            const ur_device_handle_t *phDevices,
+                            const ur_context_properties_t *pProperties,
+                            ur_context_handle_t *phContext) {
   std::ignore = pProperties;
 
   std::unique_ptr<ur_context_handle_t_> ContextPtr{nullptr};
@@ -61,9 +295,9 @@ urContextCreate(uint32_t DeviceCount, const ur_device_handle_t *phDevices,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextGetInfo(
-    ur_context_handle_t hContext, ur_context_info_t ContextInfoType,
-    size_t propSize, void *pContextInfo, size_t *pPropSizeRet) {
+ur_result_t urContextGetInfo(ur_context_handle_t hContext,
+                             ur_context_info_t ContextInfoType, size_t propSize,
+                             void *pContextInfo, size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pContextInfo, pPropSizeRet);
 
   switch (static_cast<uint32_t>(ContextInfoType)) {
@@ -112,8 +346,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextGetInfo(
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextRelease(ur_context_handle_t hContext) {
+ur_result_t urContextRelease(ur_context_handle_t hContext) {
   if (hContext->decrementReferenceCount() > 0) {
     return UR_RESULT_SUCCESS;
   }
@@ -124,16 +357,15 @@ urContextRelease(ur_context_handle_t hContext) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextRetain(ur_context_handle_t hContext) {
+ur_result_t urContextRetain(ur_context_handle_t hContext) {
   assert(hContext->getReferenceCount() > 0);
 
   hContext->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextGetNativeHandle(
-    ur_context_handle_t hContext, ur_native_handle_t *phNativeContext) {
+ur_result_t urContextGetNativeHandle(ur_context_handle_t hContext,
+                                     ur_native_handle_t *phNativeContext) {
   // FIXME: this entry point has been deprecated in the SYCL RT and should be
   // changed to unsupoorted once deprecation period has elapsed.
   *phNativeContext = reinterpret_cast<ur_native_handle_t>(
@@ -141,7 +373,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextGetNativeHandle(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextCreateWithNativeHandle(
+ur_result_t urContextCreateWithNativeHandle(
     [[maybe_unused]] ur_native_handle_t hNativeContext,
     [[maybe_unused]] ur_adapter_handle_t hAdapter,
     [[maybe_unused]] uint32_t numDevices,
@@ -151,9 +383,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextCreateWithNativeHandle(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextSetExtendedDeleter(
-    ur_context_handle_t hContext, ur_context_extended_deleter_t pfnDeleter,
-    void *pUserData) {
+ur_result_t
+urContextSetExtendedDeleter(ur_context_handle_t hContext,
+                            ur_context_extended_deleter_t pfnDeleter,
+                            void *pUserData) {
   hContext->setExtendedDeleter(pfnDeleter, pUserData);
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::cuda
@@ -18,6 +18,7 @@
 #include "logger/ur_logger.hpp"
 #include "platform.hpp"
 #include "ur_util.hpp"
+#include "ur_interface_loader.hpp"
 
 int getAttribute(ur_device_handle_t device, CUdevice_attribute attribute) {
   int value;
@@ -38,11 +39,9 @@ uint64_t ur_device_handle_t_::getElapsedTime(CUevent ev) const {
   return static_cast<uint64_t>(Milliseconds * 1.0e6);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
-                                                    ur_device_info_t propName,
-                                                    size_t propSize,
-                                                    void *pPropValue,
-                                                    size_t *pPropSizeRet) try {
+static ur_result_t getDeviceInfo(ur_device_handle_t hDevice,
+                                 ur_device_info_t propName, size_t propSize,
+                                 void *pPropValue, size_t *pPropSizeRet) try {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   static constexpr uint32_t MaxWorkItemDimensions = 3u;
@@ -1112,32 +1111,41 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   return exceptionToResult(std::current_exception());
 }
 
+namespace ur::cuda {
+
+ur_result_t urDeviceGetInfo(ur_device_handle_t hDevice,
+                            ur_device_info_t propName, size_t propSize,
+                            void *pPropValue, size_t *pPropSizeRet) {
+  return hDevice->getInfoCache().get(
+      propName, propSize, pPropValue, pPropSizeRet,
+      [hDevice, propName](size_t Size, void *Value, size_t *SizeRet) {
+        return getDeviceInfo(hDevice, propName, Size, Value, SizeRet);
+      });
+}
+
 /// \return PI_SUCCESS if the function is executed successfully
 /// CUDA devices are always root devices so retain always returns success.
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceRetain(ur_device_handle_t hDevice) {
+ur_result_t urDeviceRetain(ur_device_handle_t hDevice) {
   std::ignore = hDevice;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urDevicePartition(ur_device_handle_t, const ur_device_partition_properties_t *,
-                  uint32_t, ur_device_handle_t *, uint32_t *) {
+ur_result_t urDevicePartition(ur_device_handle_t,
+                              const ur_device_partition_properties_t *,
+                              uint32_t, ur_device_handle_t *, uint32_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
 /// \return UR_RESULT_SUCCESS always since CUDA devices are always root
 /// devices.
-UR_APIEXPORT ur_result_t UR_APICALL
-urDeviceRelease(ur_device_handle_t hDevice) {
+ur_result_t urDeviceRelease(ur_device_handle_t hDevice) {
   std::ignore = hDevice;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGet(ur_platform_handle_t hPlatform,
-                                                ur_device_type_t DeviceType,
-                                                uint32_t NumEntries,
-                                                ur_device_handle_t *phDevices,
-                                                uint32_t *pNumDevices) {
+ur_result_t urDeviceGet(ur_platform_handle_t hPlatform,
+                        ur_device_type_t DeviceType, uint32_t NumEntries,
+                        ur_device_handle_t *phDevices, uint32_t *pNumDevices) {
   ur_result_t Result = UR_RESULT_SUCCESS;
   const bool AskingForAll = DeviceType == UR_DEVICE_TYPE_ALL;
   const bool AskingForDefault = DeviceType == UR_DEVICE_TYPE_DEFAULT;
@@ -1172,8 +1180,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGet(ur_platform_handle_t hPlatform,
 ///
 /// \return PI_SUCCESS
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetNativeHandle(
-    ur_device_handle_t hDevice, ur_native_handle_t *phNativeHandle) {
+ur_result_t urDeviceGetNativeHandle(ur_device_handle_t hDevice,
+                                    ur_native_handle_t *phNativeHandle) {
   *phNativeHandle = static_cast<ur_native_handle_t>(hDevice->get());
   return UR_RESULT_SUCCESS;
 }
@@ -1187,7 +1195,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetNativeHandle(
 ///
 /// \return TBD
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
+ur_result_t urDeviceCreateWithNativeHandle(
     ur_native_handle_t hNativeDevice,
     [[maybe_unused]] ur_adapter_handle_t hAdapter,
     [[maybe_unused]] const ur_device_native_properties_t *pProperties,
@@ -1202,14 +1210,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
   uint32_t NumPlatforms = 0;
   ur_adapter_handle_t AdapterHandle = &adapter;
   ur_result_t Result =
-      urPlatformGet(&AdapterHandle, 1, 0, nullptr, &NumPlatforms);
+      ur::cuda::urPlatformGet(&AdapterHandle, 1, 0, nullptr, &NumPlatforms);
   if (Result != UR_RESULT_SUCCESS)
     return Result;
 
   std::vector<ur_platform_handle_t> Platforms(NumPlatforms);
 
   Result =
-      urPlatformGet(&AdapterHandle, 1, NumPlatforms, Platforms.data(), nullptr);
+      ur::cuda::urPlatformGet(&AdapterHandle, 1, NumPlatforms, Platforms.data(),
+                              nullptr);
   if (Result != UR_RESULT_SUCCESS)
     return Result;
 
@@ -1227,10 +1236,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
   // existing device return error
   return UR_RESULT_ERROR_INVALID_OPERATION;
 }
+} // namespace ur::cuda
 
-ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(ur_device_handle_t hDevice,
-                                                   uint64_t *pDeviceTimestamp,
-                                                   uint64_t *pHostTimestamp) {
+static ur_result_t queryGlobalTimestamps(ur_device_handle_t hDevice,
+                                         uint64_t *pDeviceTimestamp,
+                                         uint64_t *pHostTimestamp) {
   CUevent Event;
   ScopedContext Active(hDevice);
 
@@ -1254,11 +1264,28 @@ ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(ur_device_handle_t hDevice,
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t UR_APICALL ur::cuda::urDeviceGetGlobalTimestamps(
+    ur_device_handle_t hDevice, uint64_t *pDeviceTimestamp,
+    uint64_t *pHostTimestamp) {
+  auto &Calibration = hDevice->getClockCalibration();
+  if (!Calibration.enabled()) {
+    return queryGlobalTimestamps(hDevice, pDeviceTimestamp, pHostTimestamp);
+  }
+  return Calibration.getTimestamps(
+      pDeviceTimestamp, pHostTimestamp,
+      [hDevice](ur::clock_calibration_t::sample_t &Sample) {
+        return queryGlobalTimestamps(hDevice, &Sample.device, &Sample.host);
+      });
+}
+
+namespace ur::cuda {
+
 /// \return If available, the first binary that is PTX
 ///
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceSelectBinary(
-    ur_device_handle_t hDevice, const ur_device_binary_t *pBinaries,
-    uint32_t NumBinaries, uint32_t *pSelectedBinary) {
+ur_result_t urDeviceSelectBinary(ur_device_handle_t hDevice,
+                                 const ur_device_binary_t *pBinaries,
+                                 uint32_t NumBinaries,
+                                 uint32_t *pSelectedBinary) {
   std::ignore = hDevice;
 
   // Look for an image for the NVPTX64 target, and return the first one that is
@@ -1274,3 +1301,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceSelectBinary(
   // No image can be loaded for the given device
   return UR_RESULT_ERROR_INVALID_BINARY;
 }
+} // namespace ur::cuda
@@ -10,8 +10,11 @@
 #pragma once
 
 #include <ur/ur.hpp>
+#include <ur_clock_calibration.hpp>
+#include <ur_device_profile.hpp>
 
 #include "common.hpp"
+#include "ur_interface_loader.hpp"
 
 struct ur_device_handle_t_ {
 private:
@@ -33,6 +36,10 @@ private:
   int MaxChosenLocalMem{0};
   bool MaxLocalMemSizeChosen{false};
   uint32_t NumComputeUnits{0};
+  bool CoherentWithHost{false};
+  UrDeviceInfoCache InfoCache;
+  ur::clock_calibration_t ClockCalibration;
+  std::optional<ur::device_profile_t> Profile;
 
 public:
   ur_device_handle_t_(native_type cuDevice, CUcontext cuContext, CUevent evBase,
@@ -47,18 +54,27 @@ public:
         &MaxCapacityLocalMem,
         CU_DEVICE_ATTRIBUTE_MAX_SHARED_MEMORY_PER_BLOCK_OPTIN, cuDevice));
 
-    UR_CHECK_ERROR(urDeviceGetInfo(this, UR_DEVICE_INFO_MAX_WORK_ITEM_SIZES,
-                                   sizeof(MaxWorkItemSizes), MaxWorkItemSizes,
-                                   nullptr));
+    UR_CHECK_ERROR(ur::cuda::urDeviceGetInfo(this,
+                                             UR_DEVICE_INFO_MAX_WORK_ITEM_SIZES,
+                                             sizeof(MaxWorkItemSizes),
+                                             MaxWorkItemSizes, nullptr));
 
-    UR_CHECK_ERROR(urDeviceGetInfo(this, UR_DEVICE_INFO_MAX_WORK_GROUP_SIZE,
-                                   sizeof(MaxWorkGroupSize), &MaxWorkGroupSize,
-                                   nullptr));
+    UR_CHECK_ERROR(ur::cuda::urDeviceGetInfo(this,
+                                             UR_DEVICE_INFO_MAX_WORK_GROUP_SIZE,
+                                             sizeof(MaxWorkGroupSize),
+                                             &MaxWorkGroupSize, nullptr));
 
     UR_CHECK_ERROR(cuDeviceGetAttribute(
         reinterpret_cast<int *>(&NumComputeUnits),
         CU_DEVICE_ATTRIBUTE_MULTIPROCESSOR_COUNT, cuDevice));
 
+    int UsesHostPageTables = 0;
+    UR_CHECK_ERROR(cuDeviceGetAttribute(
+        &UsesHostPageTables,
+        CU_DEVICE_ATTRIBUTE_PAGEABLE_MEMORY_ACCESS_USES_HOST_PAGE_TABLES,
+        cuDevice));
+    CoherentWithHost = UsesHostPageTables != 0;
+
     // Set local mem max size if env var is present
     static const char *LocalMemSizePtrUR =
         std::getenv("UR_CUDA_MAX_LOCAL_MEM_SIZE");
@@ -79,6 +95,9 @@ public:
     // CUDA doesn't really have this concept, and could allow almost 100% of
     // global memory in one allocation, but is dependent on device usage.
     UR_CHECK_ERROR(cuDeviceTotalMem(&MaxAllocSize, cuDevice));
+
+    Profile = ur::loadDeviceProfile(UR_ADAPTER_BACKEND_CUDA, this,
+                                    ur::cuda::urDeviceGetInfo);
   }
 
   ~ur_device_handle_t_() { cuDevicePrimaryCtxRelease(CuDevice); }
@@ -97,6 +116,12 @@ public:
 
   uint64_t getElapsedTime(CUevent) const;
 
+  // Answers urDeviceGetGlobalTimestamps without calling the driver, when
+  // enabled
+  ur::clock_calibration_t &getClockCalibration() noexcept {
+    return ClockCalibration;
+  }
+
   size_t getMaxWorkItemSizes(int index) const noexcept {
     return MaxWorkItemSizes[index];
   }
@@ -114,6 +139,19 @@ public:
   bool maxLocalMemSizeChosen() { return MaxLocalMemSizeChosen; };
 
   uint32_t getNumComputeUnits() const noexcept { return NumComputeUnits; };
+
+  // Whether the device accesses pageable host memory coherently, through the
+  // host page tables, as on Grace Hopper
+  bool isCoherentWithHost() const noexcept { return CoherentWithHost; };
+
+  // The profile measured by urinfo --characterize for this device and driver
+  // version, if UR_DEVICE_PROFILE_DIR has one
+  const std::optional<ur::device_profile_t> &getProfile() const noexcept {
+    return Profile;
+  }
+
+  // The results of urDeviceGetInfo, the free memory is queried every time
+  UrDeviceInfoCache &getInfoCache() noexcept { return InfoCache; };
 };
 
 int getAttribute(ur_device_handle_t Device, CUdevice_attribute Attribute);
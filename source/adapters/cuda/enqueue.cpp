@@ -13,11 +13,16 @@
 #include "context.hpp"
 #include "event.hpp"
 #include "kernel.hpp"
+#include "latency_tracker.hpp"
 #include "memory.hpp"
 #include "queue.hpp"
+#include "ur_interface_loader.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <cuda.h>
+#include <numeric>
 #include <ur/ur.hpp>
 
 ur_result_t enqueueEventsWait(ur_queue_handle_t CommandQueue, CUstream Stream,
@@ -31,7 +36,9 @@ ur_result_t enqueueEventsWait(ur_queue_handle_t CommandQueue, CUstream Stream,
     auto Result = forLatestEvents(
         EventWaitList, NumEventsInWaitList,
         [Stream](ur_event_handle_t Event) -> ur_result_t {
-          if (Event->getStream() == Stream) {
+          // The commands of the stream already run after the event, and a
+          // completed event has nothing left to wait for
+          if (Event->getStream() == Stream || Event->isCompleted()) {
             return UR_RESULT_SUCCESS;
           } else {
             UR_CHECK_ERROR(cuStreamWaitEvent(Stream, Event->get(), 0));
@@ -145,6 +152,13 @@ void guessLocalWorkSize(ur_device_handle_t Device, size_t *ThreadsPerBlock,
   assert(GlobalWorkSize != nullptr);
   assert(Kernel != nullptr);
 
+  // The guess only depends on the local memory and the global size
+  size_t LocalMemSize = Kernel->getLocalSize();
+  if (Kernel->LocalSizeCache.find(WorkDim, LocalMemSize, GlobalWorkSize,
+                                  ThreadsPerBlock)) {
+    return;
+  }
+
   // The below assumes a three dimensional range but this is not guaranteed by
   // UR.
   size_t GlobalSizeNormalized[3] = {1, 1, 1};
@@ -159,11 +173,13 @@ void guessLocalWorkSize(ur_device_handle_t Device, size_t *ThreadsPerBlock,
 
   int MinGrid, MaxBlockSize;
   UR_CHECK_ERROR(cuOccupancyMaxPotentialBlockSize(
-      &MinGrid, &MaxBlockSize, Kernel->get(), NULL, Kernel->getLocalSize(),
+      &MinGrid, &MaxBlockSize, Kernel->get(), NULL, LocalMemSize,
       MaxBlockDim[0]));
 
   roundToHighestFactorOfGlobalSizeIn3d(ThreadsPerBlock, GlobalSizeNormalized,
                                        MaxBlockDim, MaxBlockSize);
+  Kernel->LocalSizeCache.insert(WorkDim, LocalMemSize, GlobalWorkSize,
+                                ThreadsPerBlock);
 }
 
 // Helper to verify out-of-registers case (exceeded block max registers).
@@ -329,17 +345,32 @@ setKernelParams([[maybe_unused]] const ur_context_handle_t Context,
   return Result;
 }
 
+namespace ur::cuda {
+
 /// Enqueues a wait on the given CUstream for all specified events (See
 /// \ref enqueueEventWaitWithBarrier.) If the events list is empty, the enqueued
 /// wait will wait on all previous events in the queue.
 ///
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
+ur_result_t urEnqueueEventsWaitWithBarrier(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  hQueue->Telemetry.commandSubmittedAsBatch(
+      UR_COMMAND_EVENTS_WAIT_WITH_BARRIER);
   // This function makes one stream work on the previous work (or work
   // represented by input events) and then all future work waits on that stream.
   try {
     ScopedContext Active(hQueue->getDevice());
+    // The stream of an in-order queue already runs the commands after the
+    // previous ones, so without an event there is no marker to record, only
+    // the events of other streams to wait for
+    if (!phEvent && hQueue->isInOrder()) {
+      if (numEventsInWaitList == 0) {
+        return UR_RESULT_SUCCESS;
+      }
+      return enqueueEventsWait(hQueue, hQueue->getNextComputeStream(),
+                               numEventsInWaitList, phEventWaitList);
+    }
+
     uint32_t StreamToken;
     ur_stream_guard_ Guard;
     CUstream CuStream = hQueue->getNextComputeStream(
@@ -379,12 +410,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
       }
 
       UR_CHECK_ERROR(cuEventRecord(hQueue->BarrierEvent, CuStream));
-      for (unsigned int i = 0; i < hQueue->ComputeAppliedBarrier.size(); i++) {
-        hQueue->ComputeAppliedBarrier[i] = false;
-      }
-      for (unsigned int i = 0; i < hQueue->TransferAppliedBarrier.size(); i++) {
-        hQueue->TransferAppliedBarrier[i] = false;
-      }
+      // Published once recorded, so the streams selected from now on wait
+      // for this barrier
+      hQueue->BarrierEpoch.fetch_add(1, std::memory_order_release);
     }
 
     if (phEvent) {
@@ -407,18 +435,64 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
 /// TODO: Add support for multiple streams once the Event class is properly
 /// refactored.
 ///
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
-    ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  return urEnqueueEventsWaitWithBarrier(hQueue, numEventsInWaitList,
-                                        phEventWaitList, phEvent);
+ur_result_t urEnqueueEventsWait(ur_queue_handle_t hQueue,
+                                uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList,
+                                ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueEventsWait");
+  return ur::cuda::urEnqueueEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+}
+
+// Prefetches the shared USM allocations of the arguments of the kernel to
+// the device of the queue, with UR_USM_AUTO_PREFETCH. A prefetch is only a
+// hint, so its errors are ignored.
+static void prefetchKernelArgs(ur_queue_handle_t hQueue,
+                               ur_kernel_handle_t hKernel, CUstream Stream) {
+  CUdevice Device = hQueue->getDevice()->get();
+  hKernel->PrefetchArgs.forEachAllocation([&](const void *Ptr, size_t Size) {
+    std::ignore = cuMemPrefetchAsync((CUdeviceptr)Ptr, Size, Device, Stream);
+    return UR_RESULT_SUCCESS;
+  });
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
+// Copies the arguments of a kernel launch held back by the graph capture of
+// the queue, the offset arguments of the kernel being stored after the others
+static ur_deferred_launch_t_
+makeDeferredLaunch(ur_kernel_handle_t hKernel, CUfunction CuFunc,
+                   const size_t *BlocksPerGrid, const size_t *ThreadsPerBlock,
+                   uint32_t LocalSize) {
+  auto &Args = hKernel->Args;
+  ur_deferred_launch_t_ Launch;
+  Launch.Kernel = hKernel;
+  Launch.Function = CuFunc;
+  for (int i = 0; i < 3; i++) {
+    Launch.GridDim[i] = static_cast<unsigned int>(BlocksPerGrid[i]);
+    Launch.BlockDim[i] = static_cast<unsigned int>(ThreadsPerBlock[i]);
+  }
+  Launch.LocalSize = LocalSize;
+
+  size_t StorageSize = Args.StorageSize;
+  const char *ImplicitOffset =
+      reinterpret_cast<const char *>(Args.ImplicitOffsetArgs);
+  Launch.ArgData.assign(Args.Storage.data(), Args.Storage.data() + StorageSize);
+  Launch.ArgData.insert(Launch.ArgData.end(), ImplicitOffset,
+                        ImplicitOffset + sizeof(Args.ImplicitOffsetArgs));
+  for (void *Arg : hKernel->getArgIndices()) {
+    Launch.ArgOffsets.push_back(
+        Arg == ImplicitOffset
+            ? StorageSize
+            : static_cast<const char *>(Arg) - Args.Storage.data());
+  }
+  return Launch;
+}
+
+ur_result_t urEnqueueKernelLaunch(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueKernelLaunch");
   // Preconditions
   UR_ASSERT(hQueue->getDevice() == hKernel->getProgram()->getDevice(),
             UR_RESULT_ERROR_INVALID_KERNEL);
@@ -427,10 +501,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
 
   // Early exit for zero size kernel
   if (*pGlobalWorkSize == 0) {
-    return urEnqueueEventsWaitWithBarrier(hQueue, numEventsInWaitList,
-                                          phEventWaitList, phEvent);
+    return ur::cuda::urEnqueueEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                                    phEventWaitList, phEvent);
   }
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_KERNEL_LAUNCH);
+
   // Set the number of threads per block to the number of threads per warp
   // by default unless user has provided a better number
   size_t ThreadsPerBlock[3] = {32u, 1u, 1u};
@@ -448,6 +524,24 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
       Ret != UR_RESULT_SUCCESS)
     return Ret;
 
+  // Nothing can depend on a launch with no event, which has to be ordered
+  // only with the other commands of the queue, so the graph capture holds it
+  // back, unless its memory has to be migrated or prefetched
+  if (hQueue->GraphCapture && !phEvent && numEventsInWaitList == 0 &&
+      hQueue->getContext()->Devices.size() == 1 &&
+      hKernel->PrefetchArgs.empty() &&
+      hQueue->getThreadLocalStream() == CUstream{0}) {
+    try {
+      hQueue->deferKernelLaunch(makeDeferredLaunch(
+          hKernel, CuFunc, BlocksPerGrid, ThreadsPerBlock, LocalSize));
+    } catch (ur_result_t Err) {
+      return Err;
+    }
+    if (LocalSize != 0)
+      hKernel->clearLocalSize();
+    return UR_RESULT_SUCCESS;
+  }
+
   try {
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
@@ -472,6 +566,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
       }
     }
 
+    prefetchKernelArgs(hQueue, hKernel, CuStream);
+
     if (phEvent) {
       RetImplEvent =
           std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
@@ -498,7 +594,104 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
+ur_result_t urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue, uint32_t numLaunches,
+    const ur_exp_kernel_launch_desc_t *pLaunches, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  // Preconditions
+  for (uint32_t i = 0; i < numLaunches; i++) {
+    UR_ASSERT(pLaunches[i].hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+    UR_ASSERT(pLaunches[i].pGlobalWorkSize,
+              UR_RESULT_ERROR_INVALID_NULL_POINTER);
+    UR_ASSERT(hQueue->getDevice() ==
+                  pLaunches[i].hKernel->getProgram()->getDevice(),
+              UR_RESULT_ERROR_INVALID_KERNEL);
+    UR_ASSERT(pLaunches[i].workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+    UR_ASSERT(pLaunches[i].workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  }
+
+  hQueue->Telemetry.commandSubmitted(ur::queue_telemetry_t::kernel_launch,
+                                     numLaunches);
+  hQueue->Telemetry.batchSubmitted(numLaunches);
+
+  try {
+    std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+
+    // The launches share the stream, the wait on the event list and the event
+    ScopedContext Active(hQueue->getDevice());
+    uint32_t StreamToken;
+    ur_stream_guard_ Guard;
+    CUstream CuStream = hQueue->getNextComputeStream(
+        numEventsInWaitList, phEventWaitList, Guard, &StreamToken);
+
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, CuStream, numEventsInWaitList,
+                                     phEventWaitList));
+
+    if (phEvent) {
+      RetImplEvent =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_KERNEL_LAUNCH, hQueue, CuStream, StreamToken));
+      UR_CHECK_ERROR(RetImplEvent->start());
+    }
+
+    for (uint32_t i = 0; i < numLaunches; i++) {
+      const ur_exp_kernel_launch_desc_t &Launch = pLaunches[i];
+      ur_kernel_handle_t hKernel = Launch.hKernel;
+
+      // Skip zero size kernels, the stream already orders the launches
+      if (*Launch.pGlobalWorkSize == 0)
+        continue;
+
+      size_t ThreadsPerBlock[3] = {32u, 1u, 1u};
+      size_t BlocksPerGrid[3] = {1u, 1u, 1u};
+
+      uint32_t LocalSize = hKernel->getLocalSize();
+      CUfunction CuFunc = hKernel->get();
+
+      if (ur_result_t Ret = setKernelParams(
+              hQueue->getContext(), hQueue->Device, Launch.workDim,
+              Launch.pGlobalWorkOffset, Launch.pGlobalWorkSize,
+              Launch.pLocalWorkSize, hKernel, CuFunc, ThreadsPerBlock,
+              BlocksPerGrid);
+          Ret != UR_RESULT_SUCCESS)
+        return Ret;
+
+      // For memory migration across devices in the same context
+      if (hQueue->getContext()->Devices.size() > 1) {
+        for (auto &MemArg : hKernel->Args.MemObjArgs) {
+          enqueueMigrateMemoryToDeviceIfNeeded(
+              MemArg.Mem, hQueue->getDevice(), CuStream);
+          if (MemArg.AccessFlags &
+              (UR_MEM_FLAG_READ_WRITE | UR_MEM_FLAG_WRITE_ONLY)) {
+            MemArg.Mem->setLastQueueWritingToMemObj(hQueue);
+          }
+        }
+      }
+
+      prefetchKernelArgs(hQueue, hKernel, CuStream);
+
+      auto &ArgIndices = hKernel->getArgIndices();
+      UR_CHECK_ERROR(cuLaunchKernel(
+          CuFunc, BlocksPerGrid[0], BlocksPerGrid[1], BlocksPerGrid[2],
+          ThreadsPerBlock[0], ThreadsPerBlock[1], ThreadsPerBlock[2],
+          LocalSize, CuStream, const_cast<void **>(ArgIndices.data()),
+          nullptr));
+
+      if (LocalSize != 0)
+        hKernel->clearLocalSize();
+    }
+
+    if (phEvent) {
+      UR_CHECK_ERROR(RetImplEvent->record());
+      *phEvent = RetImplEvent.release();
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEnqueueCooperativeKernelLaunchExp(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
@@ -507,16 +700,20 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
     ur_exp_launch_property_t coop_prop;
     coop_prop.id = UR_EXP_LAUNCH_PROPERTY_ID_COOPERATIVE;
     coop_prop.value.cooperative = 1;
-    return urEnqueueKernelLaunchCustomExp(
-        hQueue, hKernel, workDim, pGlobalWorkSize, pLocalWorkSize, 1,
-        &coop_prop, numEventsInWaitList, phEventWaitList, phEvent);
+    return ur::cuda::urEnqueueKernelLaunchCustomExp(hQueue, hKernel, workDim,
+                                                    pGlobalWorkSize,
+                                                    pLocalWorkSize, 1,
+                                                    &coop_prop,
+                                                    numEventsInWaitList,
+                                                    phEventWaitList, phEvent);
   }
-  return urEnqueueKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
-                               pGlobalWorkSize, pLocalWorkSize,
-                               numEventsInWaitList, phEventWaitList, phEvent);
+  return ur::cuda::urEnqueueKernelLaunch(hQueue, hKernel, workDim,
+                                         pGlobalWorkOffset, pGlobalWorkSize,
+                                         pLocalWorkSize, numEventsInWaitList,
+                                         phEventWaitList, phEvent);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
+ur_result_t urEnqueueKernelLaunchCustomExp(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
     uint32_t numPropsInLaunchPropList,
@@ -525,9 +722,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
     ur_event_handle_t *phEvent) {
 
   if (numPropsInLaunchPropList == 0) {
-    urEnqueueKernelLaunch(hQueue, hKernel, workDim, nullptr, pGlobalWorkSize,
-                          pLocalWorkSize, numEventsInWaitList, phEventWaitList,
-                          phEvent);
+    ur::cuda::urEnqueueKernelLaunch(hQueue, hKernel, workDim, nullptr,
+                                    pGlobalWorkSize, pLocalWorkSize,
+                                    numEventsInWaitList, phEventWaitList,
+                                    phEvent);
   }
 #if CUDA_VERSION >= 11080
   // Preconditions
@@ -544,10 +742,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
 
   // Early exit for zero size kernel
   if (*pGlobalWorkSize == 0) {
-    return urEnqueueEventsWaitWithBarrier(hQueue, numEventsInWaitList,
-                                          phEventWaitList, phEvent);
+    return ur::cuda::urEnqueueEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                                    phEventWaitList, phEvent);
   }
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_KERNEL_LAUNCH);
+
   // Set the number of threads per block to the number of threads per warp
   // by default unless user has provided a better number
   size_t ThreadsPerBlock[3] = {32u, 1u, 1u};
@@ -639,6 +839,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
       }
     }
 
+    prefetchKernelArgs(hQueue, hKernel, CuStream);
+
     if (phEvent) {
       RetImplEvent =
           std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
@@ -683,6 +885,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
   return UR_RESULT_ERROR_ADAPTER_SPECIFIC;
 #endif // CUDA_VERSION >= 11080
 }
+} // namespace ur::cuda
 
 /// Set parameters for general 3D memory copy.
 /// If the source and/or destination is on the device, SrcPtr and/or DstPtr
@@ -758,7 +961,9 @@ static ur_result_t commonEnqueueMemBufferCopyRect(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
+namespace ur::cuda {
+
+ur_result_t urEnqueueMemBufferReadRect(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingRead,
     ur_rect_offset_t bufferOrigin, ur_rect_offset_t hostOrigin,
     ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
@@ -767,6 +972,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
     ur_event_handle_t *phEvent) {
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_READ_RECT);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_host,
+                                region.width * region.height * region.depth);
+
   try {
     // Note that this entry point may be called on a queue that may not be the
     // last queue to write to the MemBuffer, meaning we must perform the copy
@@ -801,6 +1010,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
     }
 
     if (blockingRead) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(cuStreamSynchronize(Stream));
     }
 
@@ -814,7 +1024,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
+ur_result_t urEnqueueMemBufferWriteRect(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     ur_rect_offset_t bufferOrigin, ur_rect_offset_t hostOrigin,
     ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
@@ -826,6 +1036,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_WRITE_RECT);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::host_to_device,
+                                region.width * region.height * region.depth);
+
   try {
     ScopedContext Active(hQueue->getDevice());
     CUstream cuStream = hQueue->getNextTransferStream();
@@ -849,6 +1063,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
     }
 
     if (blockingWrite) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(cuStreamSynchronize(cuStream));
     }
 
@@ -860,12 +1075,101 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
   }
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::cuda
+
+// The size from which copies and fills are split across transfer streams,
+// UR_CUDA_SPLIT_TRANSFER_SIZE bytes, 0 disables it. Otherwise derived from
+// the profile of Device, 64 MiB without one.
+static size_t getSplitTransferSize(ur_device_handle_t Device) {
+  static const char *EnvVar = std::getenv("UR_CUDA_SPLIT_TRANSFER_SIZE");
+  if (EnvVar) {
+    return std::strtoull(EnvVar, nullptr, 10);
+  }
+  if (auto &Profile = Device->getProfile();
+      Profile && Profile->splitTransferThreshold()) {
+    return Profile->splitTransferThreshold();
+  }
+  return size_t{64} * 1024 * 1024;
+}
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBufferSrc,
-    ur_mem_handle_t hBufferDst, size_t srcOffset, size_t dstOffset, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+// Enqueues a transfer of Size bytes by calling Enqueue(Stream, Offset,
+// PartSize) on parts of it, ordered on Stream. A large transfer is split
+// across up to four transfer streams of the queue, so that it can use
+// several copy engines: those streams start after what Stream waits for,
+// and Stream then waits for them, so an event recorded on Stream covers the
+// whole transfer. The parts are multiples of Granularity bytes.
+template <typename EnqueueT>
+static void enqueueSplitTransfer(ur_queue_handle_t hQueue, CUstream Stream,
+                                 size_t Size, size_t Granularity,
+                                 EnqueueT &&Enqueue) {
+  constexpr size_t MaxParts = 4;
+  // Keeps the parts of copies aligned to pages
+  constexpr size_t MinAlignment = 64 * 1024;
+
+  size_t SplitSize = getSplitTransferSize(hQueue->getDevice());
+  size_t Alignment = std::lcm(Granularity, MinAlignment);
+  size_t PartSize = Size;
+  if (SplitSize && Size >= SplitSize) {
+    PartSize = (Size + MaxParts - 1) / MaxParts;
+    PartSize = (PartSize + Alignment - 1) / Alignment * Alignment;
+  }
+  if (PartSize >= Size) {
+    Enqueue(Stream, 0, Size);
+    return;
+  }
+
+  // The streams of the parts, without Stream, which gets the last part, nor
+  // duplicates, queues may have fewer transfer streams than parts
+  std::vector<CUstream> Streams;
+  for (size_t i = 1; i < MaxParts; i++) {
+    CUstream PartStream = hQueue->getNextTransferStream();
+    if (PartStream != Stream &&
+        std::find(Streams.begin(), Streams.end(), PartStream) ==
+            Streams.end()) {
+      Streams.push_back(PartStream);
+    }
+  }
+  if (Streams.empty()) {
+    Enqueue(Stream, 0, Size);
+    return;
+  }
+  PartSize = (Size + Streams.size()) / (Streams.size() + 1);
+  PartSize = (PartSize + Alignment - 1) / Alignment * Alignment;
+
+  ur_context_handle_t hContext = hQueue->getContext();
+  ur_device_handle_t hDevice = hQueue->getDevice();
+  auto joinStreams = [&](CUstream From, CUstream To) {
+    CUevent Event = hContext->getEvent(hDevice, false);
+    UR_CHECK_ERROR(cuEventRecord(Event, From));
+    UR_CHECK_ERROR(cuStreamWaitEvent(To, Event, 0));
+    hContext->recycleEvent(hDevice, false, Event);
+  };
+
+  size_t Offset = 0;
+  for (CUstream PartStream : Streams) {
+    if (Offset >= Size) {
+      break;
+    }
+    joinStreams(Stream, PartStream);
+    Enqueue(PartStream, Offset, std::min(PartSize, Size - Offset));
+    joinStreams(PartStream, Stream);
+    Offset += PartSize;
+  }
+  if (Offset < Size) {
+    Enqueue(Stream, Offset, Size - Offset);
+  }
+}
+
+namespace ur::cuda {
+
+ur_result_t urEnqueueMemBufferCopy(ur_queue_handle_t hQueue,
+                                   ur_mem_handle_t hBufferSrc,
+                                   ur_mem_handle_t hBufferDst, size_t srcOffset,
+                                   size_t dstOffset, size_t size,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferCopy");
   UR_ASSERT(size + dstOffset <= std::get<BufferMem>(hBufferDst->Mem).getSize(),
             UR_RESULT_ERROR_INVALID_SIZE);
   UR_ASSERT(size + srcOffset <= std::get<BufferMem>(hBufferSrc->Mem).getSize(),
@@ -873,6 +1177,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
 
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_COPY);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_device, size);
+
   try {
     ScopedContext Active(hQueue->getDevice());
     ur_result_t Result = UR_RESULT_SUCCESS;
@@ -893,7 +1200,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     auto Dst = std::get<BufferMem>(hBufferDst->Mem)
                    .getPtrWithOffset(hQueue->getDevice(), dstOffset);
 
-    UR_CHECK_ERROR(cuMemcpyDtoDAsync(Dst, Src, size, Stream));
+    enqueueSplitTransfer(
+        hQueue, Stream, size, 1,
+        [&](CUstream PartStream, size_t Offset, size_t PartSize) {
+          UR_CHECK_ERROR(
+              cuMemcpyDtoDAsync(Dst + Offset, Src + Offset, PartSize,
+                                PartStream));
+        });
 
     if (phEvent) {
       UR_CHECK_ERROR(RetImplEvent->record());
@@ -908,7 +1221,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
+ur_result_t urEnqueueMemBufferCopyRect(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBufferSrc,
     ur_mem_handle_t hBufferDst, ur_rect_offset_t srcOrigin,
     ur_rect_offset_t dstOrigin, ur_rect_region_t region, size_t srcRowPitch,
@@ -922,6 +1235,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
       std::get<BufferMem>(hBufferDst->Mem).getPtr(hQueue->getDevice());
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_COPY_RECT);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_device,
+                                region.width * region.height * region.depth);
+
   try {
     ScopedContext Active(hQueue->getDevice());
     CUstream CuStream = hQueue->getNextTransferStream();
@@ -951,6 +1268,52 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
   return Result;
 }
 
+ur_result_t urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t hQueue, ur_mem_handle_t hBufferSrc,
+    ur_mem_handle_t hBufferDst, uint32_t numRegions,
+    const ur_rect_offset_t *pSrcOrigins, const ur_rect_offset_t *pDstOrigins,
+    const ur_rect_region_t *pRegions, size_t srcRowPitch, size_t srcSlicePitch,
+    size_t dstRowPitch, size_t dstSlicePitch, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  CUdeviceptr SrcPtr =
+      std::get<BufferMem>(hBufferSrc->Mem).getPtr(hQueue->getDevice());
+  CUdeviceptr DstPtr =
+      std::get<BufferMem>(hBufferDst->Mem).getPtr(hQueue->getDevice());
+  std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    CUstream CuStream = hQueue->getNextTransferStream();
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, CuStream, numEventsInWaitList,
+                                     phEventWaitList));
+
+    if (phEvent) {
+      RetImplEvent =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_MEM_BUFFER_COPY_RECT_BATCH_EXP, hQueue, CuStream));
+      UR_CHECK_ERROR(RetImplEvent->start());
+    }
+
+    // The regions share the stream, the wait and the event of the command,
+    // only the copies themselves are issued per region
+    for (uint32_t i = 0; i < numRegions; i++) {
+      UR_CHECK_ERROR(commonEnqueueMemBufferCopyRect(
+          CuStream, pRegions[i], &SrcPtr, CU_MEMORYTYPE_DEVICE, pSrcOrigins[i],
+          srcRowPitch, srcSlicePitch, &DstPtr, CU_MEMORYTYPE_DEVICE,
+          pDstOrigins[i], dstRowPitch, dstSlicePitch));
+    }
+
+    if (phEvent) {
+      UR_CHECK_ERROR(RetImplEvent->record());
+      *phEvent = RetImplEvent.release();
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  return UR_RESULT_SUCCESS;
+}
+} // namespace ur::cuda
+
 // CUDA has no memset functions that allow setting values more than 4 bytes. UR
 // API lets you pass an arbitrary "pattern" to the buffer fill, which can be
 // more than 4 bytes. We must break up the pattern into 1 byte values, and set
@@ -960,6 +1323,24 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
 ur_result_t commonMemSetLargePattern(CUstream Stream, uint32_t PatternSize,
                                      size_t Size, const void *pPattern,
                                      CUdeviceptr Ptr) {
+  // Patterns of whole 32-bit words are written once, a word at a time, and
+  // the filled part is then doubled with each device to device copy. That
+  // takes a logarithmic number of passes writing the memory once overall,
+  // rather than one strided pass per byte of the pattern.
+  if (PatternSize % sizeof(uint32_t) == 0) {
+    auto Words = static_cast<const uint32_t *>(pPattern);
+    for (uint32_t Word = 0; Word < PatternSize / sizeof(uint32_t); ++Word) {
+      UR_CHECK_ERROR(cuMemsetD32Async(Ptr + Word * sizeof(uint32_t),
+                                      Words[Word], 1, Stream));
+    }
+    for (size_t Filled = PatternSize; Filled < Size; Filled *= 2) {
+      UR_CHECK_ERROR(cuMemcpyDtoDAsync(Ptr + Filled, Ptr,
+                                       std::min(Filled, Size - Filled),
+                                       Stream));
+    }
+    return UR_RESULT_SUCCESS;
+  }
+
   // Calculate the number of patterns, stride, number of times the pattern
   // needs to be applied, and the number of times the first 32 bit pattern
   // needs to be applied.
@@ -985,16 +1366,23 @@ ur_result_t commonMemSetLargePattern(CUstream Stream, uint32_t PatternSize,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, const void *pPattern,
-    size_t patternSize, size_t offset, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+namespace ur::cuda {
+
+ur_result_t urEnqueueMemBufferFill(ur_queue_handle_t hQueue,
+                                   ur_mem_handle_t hBuffer,
+                                   const void *pPattern, size_t patternSize,
+                                   size_t offset, size_t size,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferFill");
   UR_ASSERT(size + offset <= std::get<BufferMem>(hBuffer->Mem).getSize(),
             UR_RESULT_ERROR_INVALID_SIZE);
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_FILL);
+
   try {
     ScopedContext Active(hQueue->getDevice());
 
@@ -1009,33 +1397,40 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
       UR_CHECK_ERROR(RetImplEvent->start());
     }
 
-    auto DstDevice = std::get<BufferMem>(hBuffer->Mem)
-                         .getPtrWithOffset(hQueue->getDevice(), offset);
-    auto N = size / patternSize;
+    auto BufferDevice = std::get<BufferMem>(hBuffer->Mem)
+                            .getPtrWithOffset(hQueue->getDevice(), offset);
 
-    // pattern size in bytes
-    switch (patternSize) {
-    case 1: {
-      auto Value = *static_cast<const uint8_t *>(pPattern);
-      UR_CHECK_ERROR(cuMemsetD8Async(DstDevice, Value, N, Stream));
-      break;
-    }
-    case 2: {
-      auto Value = *static_cast<const uint16_t *>(pPattern);
-      UR_CHECK_ERROR(cuMemsetD16Async(DstDevice, Value, N, Stream));
-      break;
-    }
-    case 4: {
-      auto Value = *static_cast<const uint32_t *>(pPattern);
-      UR_CHECK_ERROR(cuMemsetD32Async(DstDevice, Value, N, Stream));
-      break;
-    }
-    default: {
-      UR_CHECK_ERROR(commonMemSetLargePattern(Stream, patternSize, size,
-                                              pPattern, DstDevice));
-      break;
-    }
-    }
+    // The parts are whole patterns, so each part starts with a pattern
+    enqueueSplitTransfer(
+        hQueue, Stream, size, patternSize,
+        [&](CUstream PartStream, size_t PartOffset, size_t PartSize) {
+          auto DstDevice = BufferDevice + PartOffset;
+          auto N = PartSize / patternSize;
+
+          // pattern size in bytes
+          switch (patternSize) {
+          case 1: {
+            auto Value = *static_cast<const uint8_t *>(pPattern);
+            UR_CHECK_ERROR(cuMemsetD8Async(DstDevice, Value, N, PartStream));
+            break;
+          }
+          case 2: {
+            auto Value = *static_cast<const uint16_t *>(pPattern);
+            UR_CHECK_ERROR(cuMemsetD16Async(DstDevice, Value, N, PartStream));
+            break;
+          }
+          case 4: {
+            auto Value = *static_cast<const uint32_t *>(pPattern);
+            UR_CHECK_ERROR(cuMemsetD32Async(DstDevice, Value, N, PartStream));
+            break;
+          }
+          default: {
+            UR_CHECK_ERROR(commonMemSetLargePattern(
+                PartStream, patternSize, PartSize, pPattern, DstDevice));
+            break;
+          }
+          }
+        });
 
     if (phEvent) {
       UR_CHECK_ERROR(RetImplEvent->record());
@@ -1137,7 +1532,7 @@ static ur_result_t commonEnqueueMemImageNDCopy(
   return UR_RESULT_ERROR_INVALID_VALUE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
+ur_result_t urEnqueueMemImageRead(
     ur_queue_handle_t hQueue, ur_mem_handle_t hImage, bool blockingRead,
     ur_rect_offset_t origin, ur_rect_region_t region, size_t rowPitch,
     size_t slicePitch, void *pDst, uint32_t numEventsInWaitList,
@@ -1173,6 +1568,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
     size_t ByteOffsetX = origin.x * ElementByteSize * ArrayDesc.NumChannels;
     size_t BytesToCopy = ElementByteSize * ArrayDesc.NumChannels * region.width;
 
+    hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_IMAGE_READ);
+    hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_host,
+                                  BytesToCopy * region.height *
+                                      region.depth);
+
     ur_mem_type_t ImgType = std::get<SurfaceMem>(hImage->Mem).getType();
 
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
@@ -1201,6 +1601,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
     }
 
     if (blockingRead) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(cuStreamSynchronize(Stream));
     }
   } catch (ur_result_t Err) {
@@ -1212,7 +1613,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageWrite(
+ur_result_t urEnqueueMemImageWrite(
     ur_queue_handle_t hQueue, ur_mem_handle_t hImage, bool blockingWrite,
     ur_rect_offset_t origin, ur_rect_region_t region, size_t rowPitch,
     size_t slicePitch, void *pSrc, uint32_t numEventsInWaitList,
@@ -1246,6 +1647,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageWrite(
     size_t ByteOffsetX = origin.x * ElementByteSize * ArrayDesc.NumChannels;
     size_t BytesToCopy = ElementByteSize * ArrayDesc.NumChannels * region.width;
 
+    hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_IMAGE_WRITE);
+    hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::host_to_device,
+                                  BytesToCopy * region.height *
+                                      region.depth);
+
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
     if (phEvent) {
       RetImplEvent =
@@ -1285,12 +1691,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageWrite(
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageCopy(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hImageSrc,
-    ur_mem_handle_t hImageDst, ur_rect_offset_t srcOrigin,
-    ur_rect_offset_t dstOrigin, ur_rect_region_t region,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t
+urEnqueueMemImageCopy(ur_queue_handle_t hQueue, ur_mem_handle_t hImageSrc,
+                      ur_mem_handle_t hImageDst, ur_rect_offset_t srcOrigin,
+                      ur_rect_offset_t dstOrigin, ur_rect_region_t region,
+                      uint32_t numEventsInWaitList,
+                      const ur_event_handle_t *phEventWaitList,
+                      ur_event_handle_t *phEvent) {
   UR_ASSERT(hImageSrc->isImage(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   UR_ASSERT(hImageDst->isImage(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   UR_ASSERT(std::get<SurfaceMem>(hImageSrc->Mem).getType() ==
@@ -1329,6 +1736,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageCopy(
     size_t BytesToCopy =
         ElementByteSize * SrcArrayDesc.NumChannels * region.width;
 
+    hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_IMAGE_COPY);
+    hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_device,
+                                  BytesToCopy * region.height *
+                                      region.depth);
+
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
     if (phEvent) {
       RetImplEvent =
@@ -1369,11 +1781,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageCopy(
 /// If the buffer uses pinned host memory a pointer to that memory is returned
 /// and no read operation is done.
 ///
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingMap,
-    ur_map_flags_t mapFlags, size_t offset, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent, void **ppRetMap) {
+ur_result_t urEnqueueMemBufferMap(ur_queue_handle_t hQueue,
+                                  ur_mem_handle_t hBuffer, bool blockingMap,
+                                  ur_map_flags_t mapFlags, size_t offset,
+                                  size_t size, uint32_t numEventsInWaitList,
+                                  const ur_event_handle_t *phEventWaitList,
+                                  ur_event_handle_t *phEvent, void **ppRetMap) {
   UR_ASSERT(hBuffer->isBuffer(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   UR_ASSERT(offset + size <= std::get<BufferMem>(hBuffer->Mem).getSize(),
             UR_RESULT_ERROR_INVALID_SIZE);
@@ -1385,22 +1798,28 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
     return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
   }
 
-  const bool IsPinned =
-      BufferImpl.MemAllocMode == BufferMem::AllocMode::AllocHostPtr;
+  const bool IsPinned = BufferImpl.isHostBacked();
 
   ur_result_t Result = UR_RESULT_SUCCESS;
   if (!IsPinned &&
       ((mapFlags & UR_MAP_FLAG_READ) || (mapFlags & UR_MAP_FLAG_WRITE))) {
-    // Pinned host memory is already on host so it doesn't need to be read.
-    Result = urEnqueueMemBufferRead(hQueue, hBuffer, blockingMap, offset, size,
-                                    MapPtr, numEventsInWaitList,
-                                    phEventWaitList, phEvent);
+    // Pinned host memory, like the memory of coherent buffers, is already on
+    // host so it doesn't need to be read.
+    Result = ur::cuda::urEnqueueMemBufferRead(hQueue, hBuffer, blockingMap,
+                                              offset, size, MapPtr,
+                                              numEventsInWaitList,
+                                              phEventWaitList, phEvent);
   } else {
     ScopedContext Active(hQueue->getDevice());
 
     if (IsPinned) {
-      Result = urEnqueueEventsWait(hQueue, numEventsInWaitList, phEventWaitList,
-                                   nullptr);
+      Result = ur::cuda::urEnqueueEventsWait(hQueue, numEventsInWaitList,
+                                             phEventWaitList, nullptr);
+      // The host reads the memory itself, once the writes it waits for are
+      // done
+      if (Result == UR_RESULT_SUCCESS && blockingMap && numEventsInWaitList) {
+        Result = ur::cuda::urEventWait(numEventsInWaitList, phEventWaitList);
+      }
     }
 
     if (phEvent) {
@@ -1423,31 +1842,32 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
 /// Requires the mapped pointer to be already registered in the given memobj.
 /// If memobj uses pinned host memory, this will not do a write.
 ///
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hMem, void *pMappedPtr,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueMemUnmap(ur_queue_handle_t hQueue, ur_mem_handle_t hMem,
+                              void *pMappedPtr, uint32_t numEventsInWaitList,
+                              const ur_event_handle_t *phEventWaitList,
+                              ur_event_handle_t *phEvent) {
   UR_ASSERT(hMem->isBuffer(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   auto &BufferImpl = std::get<BufferMem>(hMem->Mem);
 
   auto *Map = BufferImpl.getMapDetails(pMappedPtr);
   UR_ASSERT(Map != nullptr, UR_RESULT_ERROR_INVALID_MEM_OBJECT);
 
-  const bool IsPinned =
-      BufferImpl.MemAllocMode == BufferMem::AllocMode::AllocHostPtr;
+  const bool IsPinned = BufferImpl.isHostBacked();
 
   ur_result_t Result = UR_RESULT_SUCCESS;
   if (!IsPinned && (Map->getMapFlags() & UR_MAP_FLAG_WRITE)) {
     // Pinned host memory is only on host so it doesn't need to be written to.
-    Result = urEnqueueMemBufferWrite(
-        hQueue, hMem, true, Map->getMapOffset(), Map->getMapSize(), pMappedPtr,
-        numEventsInWaitList, phEventWaitList, phEvent);
+    Result = ur::cuda::urEnqueueMemBufferWrite(hQueue, hMem, true,
+                                               Map->getMapOffset(),
+                                               Map->getMapSize(), pMappedPtr,
+                                               numEventsInWaitList,
+                                               phEventWaitList, phEvent);
   } else {
     ScopedContext Active(hQueue->getDevice());
 
     if (IsPinned) {
-      Result = urEnqueueEventsWait(hQueue, numEventsInWaitList, phEventWaitList,
-                                   nullptr);
+      Result = ur::cuda::urEnqueueEventsWait(hQueue, numEventsInWaitList,
+                                             phEventWaitList, nullptr);
     }
 
     if (phEvent) {
@@ -1466,13 +1886,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
-    ur_queue_handle_t hQueue, void *ptr, size_t patternSize,
-    const void *pPattern, size_t size, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMFill(ur_queue_handle_t hQueue, void *ptr,
+                             size_t patternSize, const void *pPattern,
+                             size_t size, uint32_t numEventsInWaitList,
+                             const ur_event_handle_t *phEventWaitList,
+                             ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueUSMFill");
   ur_result_t Result = UR_RESULT_SUCCESS;
   std::unique_ptr<ur_event_handle_t_> EventPtr{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_FILL);
+
   try {
     ScopedContext Active(hQueue->getDevice());
     uint32_t StreamToken;
@@ -1519,14 +1943,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
-    ur_queue_handle_t hQueue, bool blocking, void *pDst, const void *pSrc,
-    size_t size, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMMemcpy(ur_queue_handle_t hQueue, bool blocking,
+                               void *pDst, const void *pSrc, size_t size,
+                               uint32_t numEventsInWaitList,
+                               const ur_event_handle_t *phEventWaitList,
+                               ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueUSMMemcpy");
   ur_result_t Result = UR_RESULT_SUCCESS;
 
   std::unique_ptr<ur_event_handle_t_> EventPtr{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_MEMCPY);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::unknown_direction, size);
+
   try {
     ScopedContext Active(hQueue->getDevice());
     CUstream CuStream = hQueue->getNextTransferStream();
@@ -1538,12 +1967,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
               UR_COMMAND_USM_MEMCPY, hQueue, CuStream));
       UR_CHECK_ERROR(EventPtr->start());
     }
-    UR_CHECK_ERROR(
-        cuMemcpyAsync((CUdeviceptr)pDst, (CUdeviceptr)pSrc, size, CuStream));
+    enqueueSplitTransfer(
+        hQueue, CuStream, size, 1,
+        [&](CUstream PartStream, size_t Offset, size_t PartSize) {
+          enqueueCopy(hQueue, PartStream, static_cast<char *>(pDst) + Offset,
+                      static_cast<const char *>(pSrc) + Offset, PartSize);
+        });
     if (phEvent) {
       UR_CHECK_ERROR(EventPtr->record());
     }
     if (blocking) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(cuStreamSynchronize(CuStream));
     }
     if (phEvent) {
@@ -1555,10 +1989,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
-    ur_queue_handle_t hQueue, const void *pMem, size_t size,
-    ur_usm_migration_flags_t flags, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMPrefetch(ur_queue_handle_t hQueue, const void *pMem,
+                                 size_t size, ur_usm_migration_flags_t flags,
+                                 uint32_t numEventsInWaitList,
+                                 const ur_event_handle_t *phEventWaitList,
+                                 ur_event_handle_t *phEvent) {
   std::ignore = flags;
 
   size_t PointerRangeSize = 0;
@@ -1590,6 +2025,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
   ur_result_t Result = UR_RESULT_SUCCESS;
   std::unique_ptr<ur_event_handle_t_> EventPtr{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_PREFETCH);
+
   try {
     ScopedContext Active(hQueue->getDevice());
     CUstream CuStream = hQueue->getNextTransferStream();
@@ -1614,9 +2051,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
 }
 
 /// USM: memadvise API to govern behavior of automatic migration mechanisms
-UR_APIEXPORT ur_result_t UR_APICALL
-urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem, size_t size,
-                   ur_usm_advice_flags_t advice, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem,
+                               size_t size, ur_usm_advice_flags_t advice,
+                               ur_event_handle_t *phEvent) {
   size_t PointerRangeSize = 0;
   UR_CHECK_ERROR(cuPointerGetAttribute(
       &PointerRangeSize, CU_POINTER_ATTRIBUTE_RANGE_SIZE, (CUdeviceptr)pMem));
@@ -1697,19 +2134,24 @@ urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem, size_t size,
 
 // TODO: Implement this. Remember to return true for
 //       PI_EXT_ONEAPI_CONTEXT_INFO_USM_FILL2D_SUPPORT when it is implemented.
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
-    ur_queue_handle_t, void *, size_t, size_t, const void *, size_t, size_t,
-    uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
+ur_result_t urEnqueueUSMFill2D(ur_queue_handle_t, void *, size_t, size_t,
+                               const void *, size_t, size_t, uint32_t,
+                               const ur_event_handle_t *, ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
-    ur_queue_handle_t hQueue, bool blocking, void *pDst, size_t dstPitch,
-    const void *pSrc, size_t srcPitch, size_t width, size_t height,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMMemcpy2D(ur_queue_handle_t hQueue, bool blocking,
+                                 void *pDst, size_t dstPitch, const void *pSrc,
+                                 size_t srcPitch, size_t width, size_t height,
+                                 uint32_t numEventsInWaitList,
+                                 const ur_event_handle_t *phEventWaitList,
+                                 ur_event_handle_t *phEvent) {
   ur_result_t result = UR_RESULT_SUCCESS;
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_MEMCPY_2D);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::unknown_direction,
+                                width * height);
+
   try {
     ScopedContext active(hQueue->getDevice());
     CUstream cuStream = hQueue->getNextTransferStream();
@@ -1746,6 +2188,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
       *phEvent = RetImplEvent.release();
     }
     if (blocking) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(cuStreamSynchronize(cuStream));
     }
   } catch (ur_result_t err) {
@@ -1754,15 +2197,21 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
   return result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingRead,
-    size_t offset, size_t size, void *pDst, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueMemBufferRead(ur_queue_handle_t hQueue,
+                                   ur_mem_handle_t hBuffer, bool blockingRead,
+                                   size_t offset, size_t size, void *pDst,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferRead");
   UR_ASSERT(!hBuffer->isImage(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   UR_ASSERT(offset + size <= std::get<BufferMem>(hBuffer->Mem).Size,
             UR_RESULT_ERROR_INVALID_SIZE);
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_READ);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_host, size);
+
   try {
     // Note that this entry point may be called on a queue that may not be the
     // last queue to write to the MemBuffer, meaning we must perform the copy
@@ -1786,16 +2235,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
       UR_CHECK_ERROR(RetImplEvent->start());
     }
 
-    UR_CHECK_ERROR(cuMemcpyDtoHAsync(
-        pDst,
+    enqueueCopyDtoH(
+        hQueue, Stream, pDst,
         std::get<BufferMem>(hBuffer->Mem).getPtrWithOffset(Device, offset),
-        size, Stream));
+        size);
 
     if (phEvent) {
       UR_CHECK_ERROR(RetImplEvent->record());
     }
 
     if (blockingRead) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(cuStreamSynchronize(Stream));
     }
 
@@ -1809,10 +2259,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
+ur_result_t urEnqueueMemBufferWrite(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     size_t offset, size_t size, const void *pSrc, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferWrite");
   UR_ASSERT(!hBuffer->isImage(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   UR_ASSERT(offset + size <= std::get<BufferMem>(hBuffer->Mem).Size,
             UR_RESULT_ERROR_INVALID_SIZE);
@@ -1822,6 +2273,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_WRITE);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::host_to_device, size);
+
   try {
     ScopedContext Active(hQueue->getDevice());
     CUstream CuStream = hQueue->getNextTransferStream();
@@ -1836,13 +2290,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
       UR_CHECK_ERROR(RetImplEvent->start());
     }
 
-    UR_CHECK_ERROR(cuMemcpyHtoDAsync(DevPtr + offset, pSrc, size, CuStream));
+    enqueueCopyHtoD(hQueue, CuStream, DevPtr + offset, pSrc, size);
 
     if (phEvent) {
       UR_CHECK_ERROR(RetImplEvent->record());
     }
 
     if (blockingWrite) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(cuStreamSynchronize(CuStream));
     }
 
@@ -1855,7 +2310,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
+ur_result_t urEnqueueDeviceGlobalVariableWrite(
     ur_queue_handle_t hQueue, ur_program_handle_t hProgram, const char *name,
     bool blockingWrite, size_t count, size_t offset, const void *pSrc,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
@@ -1869,7 +2324,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     if (offset + count > DeviceGlobalSize)
       return UR_RESULT_ERROR_INVALID_VALUE;
 
-    return urEnqueueUSMMemcpy(
+    return ur::cuda::urEnqueueUSMMemcpy(
         hQueue, blockingWrite, reinterpret_cast<void *>(DeviceGlobal + offset),
         pSrc, count, numEventsInWaitList, phEventWaitList, phEvent);
   } catch (ur_result_t Err) {
@@ -1877,7 +2332,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
+ur_result_t urEnqueueDeviceGlobalVariableRead(
     ur_queue_handle_t hQueue, ur_program_handle_t hProgram, const char *name,
     bool blockingRead, size_t count, size_t offset, void *pDst,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
@@ -1891,7 +2346,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     if (offset + count > DeviceGlobalSize)
       return UR_RESULT_ERROR_INVALID_VALUE;
 
-    return urEnqueueUSMMemcpy(
+    return ur::cuda::urEnqueueUSMMemcpy(
         hQueue, blockingRead, pDst,
         reinterpret_cast<const void *>(DeviceGlobal + offset), count,
         numEventsInWaitList, phEventWaitList, phEvent);
@@ -1901,11 +2356,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
 }
 
 /// Host Pipes
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueReadHostPipe(
-    ur_queue_handle_t hQueue, ur_program_handle_t hProgram,
-    const char *pipe_symbol, bool blocking, void *pDst, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueReadHostPipe(ur_queue_handle_t hQueue,
+                                  ur_program_handle_t hProgram,
+                                  const char *pipe_symbol, bool blocking,
+                                  void *pDst, size_t size,
+                                  uint32_t numEventsInWaitList,
+                                  const ur_event_handle_t *phEventWaitList,
+                                  ur_event_handle_t *phEvent) {
   (void)hQueue;
   (void)hProgram;
   (void)pipe_symbol;
@@ -1919,11 +2376,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueReadHostPipe(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueWriteHostPipe(
-    ur_queue_handle_t hQueue, ur_program_handle_t hProgram,
-    const char *pipe_symbol, bool blocking, void *pSrc, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueWriteHostPipe(ur_queue_handle_t hQueue,
+                                   ur_program_handle_t hProgram,
+                                   const char *pipe_symbol, bool blocking,
+                                   void *pSrc, size_t size,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
   (void)hQueue;
   (void)hProgram;
   (void)pipe_symbol;
@@ -1937,12 +2396,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueWriteHostPipe(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
+ur_result_t urEnqueueTimestampRecordingExp(
     ur_queue_handle_t hQueue, bool blocking, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
 
   ur_result_t Result = UR_RESULT_SUCCESS;
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_TIMESTAMP_RECORDING_EXP);
   try {
     ScopedContext Active(hQueue->getDevice());
     CUstream CuStream = hQueue->getNextComputeStream();
@@ -1957,6 +2417,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     UR_CHECK_ERROR(RetImplEvent->record());
 
     if (blocking) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(cuStreamSynchronize(CuStream));
     }
 
@@ -1966,3 +2427,36 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
   }
   return Result;
 }
+
+ur_result_t urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, uint64_t *pMarker) {
+
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    std::lock_guard<std::mutex> Guard(hQueue->TimestampMarkersMutex);
+    auto &Markers = hQueue->TimestampMarkers;
+    if (!Markers) {
+      return UR_RESULT_ERROR_INVALID_OPERATION;
+    }
+    CUstream CuStream = hQueue->getNextComputeStream();
+
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, CuStream, numEventsInWaitList,
+                                     phEventWaitList));
+
+    // Read back relative to the base event of the device, as the end of the
+    // events of urEnqueueTimestampRecordingExp is
+    UR_CHECK_ERROR(cuEventRecord(
+        hQueue->TimestampMarkerEvents[Markers->slot(Markers->enqueued())],
+        CuStream));
+    uint64_t Marker = Markers->push();
+    if (pMarker) {
+      *pMarker = Marker;
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  }
+  return Result;
+}
+} // namespace ur::cuda
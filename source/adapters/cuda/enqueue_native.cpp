@@ -14,8 +14,11 @@
 #include "event.hpp"
 #include "memory.hpp"
 #include "queue.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+namespace ur::cuda {
+
+ur_result_t urEnqueueNativeCommandExp(
     ur_queue_handle_t hQueue,
     ur_exp_enqueue_native_command_function_t pfnNativeEnqueue, void *data,
     uint32_t NumMemsInMemList, const ur_mem_handle_t *phMemList,
@@ -58,3 +61,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueNativeCommandExp(
   }
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::cuda
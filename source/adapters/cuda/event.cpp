@@ -13,10 +13,13 @@
 #include "device.hpp"
 #include "queue.hpp"
 #include "ur_api.h"
+#include "ur_event_callbacks.hpp"
 #include "ur_util.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <cassert>
 #include <cuda.h>
+#include <thread>
 
 ur_event_handle_t_::ur_event_handle_t_(ur_command_t Type,
                                        ur_context_handle_t Context,
@@ -25,28 +28,29 @@ ur_event_handle_t_::ur_event_handle_t_(ur_command_t Type,
                                        native_type EvStart, CUstream Stream,
                                        uint32_t StreamToken)
     : CommandType{Type}, RefCount{1}, HasOwnership{true},
-      HasBeenWaitedOn{false}, IsRecorded{false}, IsStarted{false},
+      HasCompleted{false}, IsRecorded{false}, IsStarted{false},
       StreamToken{StreamToken}, EventID{0}, EvEnd{EvEnd}, EvStart{EvStart},
       EvQueued{EvQueued}, Queue{Queue}, Stream{Stream}, Context{Context} {
-  urQueueRetain(Queue);
-  urContextRetain(Context);
+  ur::cuda::urQueueRetain(Queue);
+  Queue->Telemetry.eventCreated();
+  ur::cuda::urContextRetain(Context);
 }
 
 ur_event_handle_t_::ur_event_handle_t_(ur_context_handle_t Context,
                                        CUevent EventNative)
     : CommandType{UR_COMMAND_EVENTS_WAIT}, RefCount{1}, HasOwnership{false},
-      HasBeenWaitedOn{false}, IsRecorded{false}, IsStarted{false},
+      HasCompleted{false}, IsRecorded{false}, IsStarted{false},
       IsInterop{true}, StreamToken{std::numeric_limits<uint32_t>::max()},
       EventID{0}, EvEnd{EventNative}, EvStart{nullptr}, EvQueued{nullptr},
       Queue{nullptr}, Stream{nullptr}, Context{Context} {
-  urContextRetain(Context);
+  ur::cuda::urContextRetain(Context);
 }
 
 ur_event_handle_t_::~ur_event_handle_t_() {
   if (Queue != nullptr) {
-    urQueueRelease(Queue);
+    ur::cuda::urQueueRelease(Queue);
   }
-  urContextRelease(Context);
+  ur::cuda::urContextRelease(Context);
 }
 
 ur_result_t ur_event_handle_t_::start() {
@@ -70,7 +74,7 @@ bool ur_event_handle_t_::isCompleted() const noexcept try {
   if (!IsRecorded) {
     return false;
   }
-  if (!HasBeenWaitedOn) {
+  if (!HasCompleted) {
     const CUresult Result = cuEventQuery(EvEnd);
     if (Result != CUDA_SUCCESS && Result != CUDA_ERROR_NOT_READY) {
       UR_CHECK_ERROR(Result);
@@ -79,6 +83,7 @@ bool ur_event_handle_t_::isCompleted() const noexcept try {
     if (Result == CUDA_ERROR_NOT_READY) {
       return false;
     }
+    HasCompleted = true;
   }
   return true;
 } catch (...) {
@@ -132,7 +137,7 @@ ur_result_t ur_event_handle_t_::wait() {
   ur_result_t Result = UR_RESULT_SUCCESS;
   try {
     UR_CHECK_ERROR(cuEventSynchronize(EvEnd));
-    HasBeenWaitedOn = true;
+    HasCompleted = true;
   } catch (ur_result_t error) {
     Result = error;
   }
@@ -146,21 +151,23 @@ ur_result_t ur_event_handle_t_::release() {
 
   assert(Queue != nullptr);
 
-  UR_CHECK_ERROR(cuEventDestroy(EvEnd));
+  const bool HasTimings =
+      Queue->URFlags & UR_QUEUE_FLAG_PROFILING_ENABLE || isTimestampEvent();
+  Context->recycleEvent(Queue->getDevice(), HasTimings, EvEnd);
 
-  if (Queue->URFlags & UR_QUEUE_FLAG_PROFILING_ENABLE || isTimestampEvent()) {
-    UR_CHECK_ERROR(cuEventDestroy(EvQueued));
-    UR_CHECK_ERROR(cuEventDestroy(EvStart));
+  if (HasTimings) {
+    Context->recycleEvent(Queue->getDevice(), true, EvQueued);
+    Context->recycleEvent(Queue->getDevice(), true, EvStart);
   }
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
-                                                   ur_event_info_t propName,
-                                                   size_t propValueSize,
-                                                   void *pPropValue,
-                                                   size_t *pPropValueSizeRet) {
+namespace ur::cuda {
+
+ur_result_t urEventGetInfo(ur_event_handle_t hEvent, ur_event_info_t propName,
+                           size_t propValueSize, void *pPropValue,
+                           size_t *pPropValueSizeRet) {
   UrReturnHelper ReturnValue(propValueSize, pPropValue, pPropValueSizeRet);
 
   switch (propName) {
@@ -193,9 +200,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
 
 /// Obtain profiling information from PI CUDA events
 /// \TODO Timings from CUDA are only elapsed time.
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
-    ur_event_handle_t hEvent, ur_profiling_info_t propName,
-    size_t propValueSize, void *pPropValue, size_t *pPropValueSizeRet) {
+ur_result_t urEventGetProfilingInfo(ur_event_handle_t hEvent,
+                                    ur_profiling_info_t propName,
+                                    size_t propValueSize, void *pPropValue,
+                                    size_t *pPropValueSizeRet) {
   UrReturnHelper ReturnValue(propValueSize, pPropValue, pPropValueSizeRet);
 
   ur_queue_handle_t Queue = hEvent->getQueue();
@@ -219,15 +227,31 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventSetCallback(ur_event_handle_t,
-                                                       ur_execution_info_t,
-                                                       ur_event_callback_t,
-                                                       void *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+// The callbacks of urEventSetCallback of all the events, see
+// ur_event_callbacks.hpp.
+static ur::event_callback_dispatcher_t &getEventCallbackDispatcher() {
+  static ur::event_callback_dispatcher_t Dispatcher{
+      ur::event_callback_dispatcher_t::statusQuery(ur::cuda::urEventGetInfo),
+      [](ur_event_handle_t hEvent) { ur::cuda::urEventRetain(hEvent); },
+      [](ur_event_handle_t hEvent) { ur::cuda::urEventRelease(hEvent); }};
+  return Dispatcher;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
+ur_result_t urEventSetCallback(ur_event_handle_t hEvent,
+                               ur_execution_info_t execStatus,
+                               ur_event_callback_t pfnNotify, void *pUserData) {
+  try {
+    getEventCallbackDispatcher().add(hEvent, execStatus, pfnNotify, pUserData);
+  } catch (const std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    return UR_RESULT_ERROR_UNKNOWN;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEventWait(uint32_t numEvents,
+                        const ur_event_handle_t *phEventWaitList) {
   try {
     // Interop events don't have an associated queue, so get device through
     // context
@@ -236,9 +260,20 @@ urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
     auto WaitFunc = [](ur_event_handle_t Event) -> ur_result_t {
       UR_ASSERT(Event, UR_RESULT_ERROR_INVALID_EVENT);
 
+      // Interop events have no queue to account the wait to
+      if (!Event->getQueue()) {
+        return Event->wait();
+      }
+      ur::queue_telemetry_t::wait_scope_t Wait(Event->getQueue()->Telemetry);
       return Event->wait();
     };
-    return forLatestEvents(phEventWaitList, numEvents, WaitFunc);
+    ur_result_t Result =
+        forLatestEvents(phEventWaitList, numEvents, WaitFunc);
+    if (Result == UR_RESULT_SUCCESS) {
+      // The callbacks of the events have run once they are waited for.
+      getEventCallbackDispatcher().flush(numEvents, phEventWaitList);
+    }
+    return Result;
   } catch (ur_result_t Err) {
     return Err;
   } catch (...) {
@@ -246,7 +281,38 @@ urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
+ur_result_t urEventWaitAnyExp(uint32_t numEvents,
+                              const ur_event_handle_t *phEventWaitList,
+                              uint32_t *pEventIndex) {
+  if (numEvents == 1) {
+    *pEventIndex = 0;
+    return ur::cuda::urEventWait(1, phEventWaitList);
+  }
+
+  // CUDA can only block on one event at a time, so poll them all with
+  // cuEventQuery, yielding the CPU between the rounds
+  for (;;) {
+    for (uint32_t i = 0; i < numEvents; ++i) {
+      if (phEventWaitList[i]->isCompleted()) {
+        *pEventIndex = i;
+        return UR_RESULT_SUCCESS;
+      }
+    }
+    std::this_thread::yield();
+  }
+}
+
+ur_result_t urEventGetExecutionStatusExp(uint32_t numEvents,
+                                         const ur_event_handle_t *phEvents,
+                                         ur_event_status_t *pStatuses) {
+  for (uint32_t i = 0; i < numEvents; ++i) {
+    pStatuses[i] =
+        static_cast<ur_event_status_t>(phEvents[i]->getExecutionStatus());
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEventRetain(ur_event_handle_t hEvent) {
   const auto RefCount = hEvent->incrementReferenceCount();
 
   detail::ur::assertion(RefCount != 0,
@@ -255,7 +321,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventRelease(ur_event_handle_t hEvent) {
+ur_result_t urEventRelease(ur_event_handle_t hEvent) {
   // double delete or someone is messing with the ref count.
   // either way, cannot safely proceed.
   detail::ur::assertion(hEvent->getReferenceCount() != 0,
@@ -276,16 +342,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventRelease(ur_event_handle_t hEvent) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetNativeHandle(
-    ur_event_handle_t hEvent, ur_native_handle_t *phNativeEvent) {
+ur_result_t urEventGetNativeHandle(ur_event_handle_t hEvent,
+                                   ur_native_handle_t *phNativeEvent) {
   *phNativeEvent = reinterpret_cast<ur_native_handle_t>(hEvent->get());
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventCreateWithNativeHandle(
-    ur_native_handle_t hNativeEvent, ur_context_handle_t hContext,
-    const ur_event_native_properties_t *pProperties,
-    ur_event_handle_t *phEvent) {
+ur_result_t
+urEventCreateWithNativeHandle(ur_native_handle_t hNativeEvent,
+                              ur_context_handle_t hContext,
+                              const ur_event_native_properties_t *pProperties,
+                              ur_event_handle_t *phEvent) {
   std::ignore = pProperties;
 
   std::unique_ptr<ur_event_handle_t_> EventPtr{nullptr};
@@ -304,3 +371,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventCreateWithNativeHandle(
 
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::cuda
@@ -13,6 +13,7 @@
 #include <ur/ur.hpp>
 
 #include "common.hpp"
+#include "context.hpp"
 #include "queue.hpp"
 
 /// UR Event mapping to CUevent
@@ -96,14 +97,14 @@ public:
       Queue->createHostSubmitTimeStream();
     }
     native_type EvEnd = nullptr, EvQueued = nullptr, EvStart = nullptr;
-    UR_CHECK_ERROR(cuEventCreate(
-        &EvEnd, RequiresTimings ? CU_EVENT_DEFAULT : CU_EVENT_DISABLE_TIMING));
+    ur_context_handle_t Context = Queue->getContext();
+    EvEnd = Context->getEvent(Queue->getDevice(), RequiresTimings);
 
     if (RequiresTimings) {
-      UR_CHECK_ERROR(cuEventCreate(&EvQueued, CU_EVENT_DEFAULT));
-      UR_CHECK_ERROR(cuEventCreate(&EvStart, CU_EVENT_DEFAULT));
+      EvQueued = Context->getEvent(Queue->getDevice(), true);
+      EvStart = Context->getEvent(Queue->getDevice(), true);
     }
-    return new ur_event_handle_t_(Type, Queue->getContext(), Queue, EvEnd,
+    return new ur_event_handle_t_(Type, Context, Queue, EvEnd,
                                   EvQueued, EvStart, Stream, StreamToken);
   }
 
@@ -134,9 +135,9 @@ private:
 
   bool HasOwnership; // Signifies if event owns the native type.
 
-  bool HasBeenWaitedOn; // Signifies whether the event has been waited
-                        // on through a call to wait(), which implies
-                        // that it has completed.
+  // Set once the event is known to have completed, by wait() or a query, so
+  // that later checks, such as the pruning of wait lists, make no query
+  mutable std::atomic_bool HasCompleted;
 
   bool IsRecorded; // Signifies wether a native CUDA event has been recorded
                    // yet.
@@ -14,43 +14,50 @@
 #include "queue.hpp"
 #include "sampler.hpp"
 #include "ur_api.h"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
-               ur_kernel_handle_t *phKernel) {
+void ur_kernel_handle_t_::setKernelPtrArg(int Index, const void *Ptr) {
+  // setKernelArg is expecting a pointer to our argument
+  setKernelArg(Index, sizeof(Ptr), &Ptr);
+  if (!Ptr || !ur::usmAutoPrefetchEnabled()) {
+    return;
+  }
+
+  // Pointers which aren't to USM, e.g. to host memory, fail the queries
+  ur_device_handle_t Device = Program->getDevice();
+  ScopedContext Active(Device);
+  unsigned int IsManaged = 0;
+  if (cuPointerGetAttribute(&IsManaged, CU_POINTER_ATTRIBUTE_IS_MANAGED,
+                            (CUdeviceptr)Ptr) != CUDA_SUCCESS ||
+      !IsManaged) {
+    return;
+  }
+  // As in urEnqueueUSMPrefetch, prefetching needs concurrent managed access
+  if (!getAttribute(Device, CU_DEVICE_ATTRIBUTE_CONCURRENT_MANAGED_ACCESS)) {
+    return;
+  }
+  CUdeviceptr Base = 0;
+  size_t Size = 0;
+  if (cuMemGetAddressRange(&Base, &Size, (CUdeviceptr)Ptr) == CUDA_SUCCESS) {
+    PrefetchArgs.set(Index, reinterpret_cast<const void *>(Base), Size);
+  }
+}
+
+namespace ur::cuda {
+
+ur_result_t urKernelCreate(ur_program_handle_t hProgram,
+                           const char *pKernelName,
+                           ur_kernel_handle_t *phKernel) {
   ur_result_t Result = UR_RESULT_SUCCESS;
   std::unique_ptr<ur_kernel_handle_t_> Kernel{nullptr};
 
   try {
     ScopedContext Active(hProgram->getDevice());
 
-    CUfunction CuFunc;
-    CUresult FunctionResult =
-        cuModuleGetFunction(&CuFunc, hProgram->get(), pKernelName);
-
-    // We can't add this as a generic mapping in UR_CHECK_ERROR since cuda's
-    // NOT_FOUND error applies to more than just functions.
-    if (FunctionResult == CUDA_ERROR_NOT_FOUND) {
-      throw UR_RESULT_ERROR_INVALID_KERNEL_NAME;
-    } else {
-      UR_CHECK_ERROR(FunctionResult);
-    }
-
-    std::string KernelNameWithOffset =
-        std::string(pKernelName) + "_with_offset";
-    CUfunction CuFuncWithOffsetParam;
-    CUresult OffsetRes = cuModuleGetFunction(
-        &CuFuncWithOffsetParam, hProgram->get(), KernelNameWithOffset.c_str());
-
-    // If there is no kernel with global offset parameter we mark it as missing
-    if (OffsetRes == CUDA_ERROR_NOT_FOUND) {
-      CuFuncWithOffsetParam = nullptr;
-    } else {
-      UR_CHECK_ERROR(OffsetRes);
-    }
-    Kernel = std::unique_ptr<ur_kernel_handle_t_>(
-        new ur_kernel_handle_t_{CuFunc, CuFuncWithOffsetParam, pKernelName,
-                                hProgram, hProgram->getContext()});
+    ur_program_handle_t_::KernelFunctions Functions;
+    UR_CHECK_ERROR(hProgram->getKernelFunctions(pKernelName, Functions));
+    Kernel = std::unique_ptr<ur_kernel_handle_t_>(new ur_kernel_handle_t_{
+        Functions, pKernelName, hProgram, hProgram->getContext()});
   } catch (ur_result_t Err) {
     Result = Err;
   } catch (...) {
@@ -61,10 +68,11 @@ urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelGetGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
-                     ur_kernel_group_info_t propName, size_t propSize,
-                     void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urKernelGetGroupInfo(ur_kernel_handle_t hKernel,
+                                 ur_device_handle_t hDevice,
+                                 ur_kernel_group_info_t propName,
+                                 size_t propSize, void *pPropValue,
+                                 size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   switch (propName) {
@@ -156,15 +164,14 @@ urKernelGetGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelRetain(ur_kernel_handle_t hKernel) {
+ur_result_t urKernelRetain(ur_kernel_handle_t hKernel) {
   UR_ASSERT(hKernel->getReferenceCount() > 0u, UR_RESULT_ERROR_INVALID_KERNEL);
 
   hKernel->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelRelease(ur_kernel_handle_t hKernel) {
+ur_result_t urKernelRelease(ur_kernel_handle_t hKernel) {
   // double delete or someone is messing with the ref count.
   // either way, cannot safely proceed.
   UR_ASSERT(hKernel->getReferenceCount() != 0, UR_RESULT_ERROR_INVALID_KERNEL);
@@ -181,15 +188,15 @@ urKernelRelease(ur_kernel_handle_t hKernel) {
 
 // TODO(ur): Not implemented on cuda atm. Also, need to add tests for this
 // feature.
-UR_APIEXPORT ur_result_t UR_APICALL urKernelGetNativeHandle(
-    ur_kernel_handle_t hKernel, ur_native_handle_t *phNativeKernel) {
+ur_result_t urKernelGetNativeHandle(ur_kernel_handle_t hKernel,
+                                    ur_native_handle_t *phNativeKernel) {
   (void)hKernel;
   (void)phNativeKernel;
 
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
+ur_result_t urKernelSuggestMaxCooperativeGroupCountExp(
     ur_kernel_handle_t hKernel, size_t localWorkSize,
     size_t dynamicSharedMemorySize, uint32_t *pGroupCountRet) {
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_KERNEL);
@@ -211,12 +218,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     // we will manually check if it is possible with the available HW resources.
     if (MaxNumActiveGroupsPerCU == 0) {
       size_t MaxWorkGroupSize{};
-      urKernelGetGroupInfo(
-          hKernel, Device, UR_KERNEL_GROUP_INFO_WORK_GROUP_SIZE,
-          sizeof(MaxWorkGroupSize), &MaxWorkGroupSize, nullptr);
+      ur::cuda::urKernelGetGroupInfo(hKernel, Device,
+                                     UR_KERNEL_GROUP_INFO_WORK_GROUP_SIZE,
+                                     sizeof(MaxWorkGroupSize),
+                                     &MaxWorkGroupSize, nullptr);
       size_t MaxLocalSizeBytes{};
-      urDeviceGetInfo(Device, UR_DEVICE_INFO_LOCAL_MEM_SIZE,
-                      sizeof(MaxLocalSizeBytes), &MaxLocalSizeBytes, nullptr);
+      ur::cuda::urDeviceGetInfo(Device, UR_DEVICE_INFO_LOCAL_MEM_SIZE,
+                                sizeof(MaxLocalSizeBytes), &MaxLocalSizeBytes,
+                                nullptr);
       if (localWorkSize > MaxWorkGroupSize ||
           dynamicSharedMemorySize > MaxLocalSizeBytes ||
           hasExceededMaxRegistersPerBlock(Device, hKernel, localWorkSize))
@@ -235,10 +244,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
-    ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
-    const ur_kernel_arg_value_properties_t *pProperties,
-    const void *pArgValue) {
+ur_result_t
+urKernelSetArgValue(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                    size_t argSize,
+                    const ur_kernel_arg_value_properties_t *pProperties,
+                    const void *pArgValue) {
   std::ignore = pProperties;
   UR_ASSERT(argSize, UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE);
 
@@ -251,9 +261,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgLocal(
-    ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
-    const ur_kernel_arg_local_properties_t *pProperties) {
+ur_result_t
+urKernelSetArgLocal(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                    size_t argSize,
+                    const ur_kernel_arg_local_properties_t *pProperties) {
   std::ignore = pProperties;
   UR_ASSERT(argSize, UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE);
 
@@ -266,11 +277,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgLocal(
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelGetInfo(ur_kernel_handle_t hKernel,
-                                                    ur_kernel_info_t propName,
-                                                    size_t propSize,
-                                                    void *pKernelInfo,
-                                                    size_t *pPropSizeRet) {
+ur_result_t urKernelGetInfo(ur_kernel_handle_t hKernel,
+                            ur_kernel_info_t propName, size_t propSize,
+                            void *pKernelInfo, size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pKernelInfo, pPropSizeRet);
 
   switch (propName) {
@@ -299,10 +308,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelGetInfo(ur_kernel_handle_t hKernel,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
-                        ur_kernel_sub_group_info_t propName, size_t propSize,
-                        void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel,
+                                    ur_device_handle_t hDevice,
+                                    ur_kernel_sub_group_info_t propName,
+                                    size_t propSize, void *pPropValue,
+                                    size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
   switch (propName) {
   case UR_KERNEL_SUB_GROUP_INFO_MAX_SUB_GROUP_SIZE: {
@@ -318,9 +328,9 @@ urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
     UR_CHECK_ERROR(cuFuncGetAttribute(
         &MaxThreads, CU_FUNC_ATTRIBUTE_MAX_THREADS_PER_BLOCK, hKernel->get()));
     int WarpSize = 0;
-    urKernelGetSubGroupInfo(hKernel, hDevice,
-                            UR_KERNEL_SUB_GROUP_INFO_MAX_SUB_GROUP_SIZE,
-                            sizeof(uint32_t), &WarpSize, nullptr);
+    ur::cuda::urKernelGetSubGroupInfo(
+        hKernel, hDevice, UR_KERNEL_SUB_GROUP_INFO_MAX_SUB_GROUP_SIZE,
+        sizeof(uint32_t), &WarpSize, nullptr);
     int MaxWarps = (MaxThreads + WarpSize - 1) / WarpSize;
     return ReturnValue(static_cast<uint32_t>(MaxWarps));
   }
@@ -343,17 +353,16 @@ urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urKernelSetArgPointer(ur_kernel_handle_t hKernel, uint32_t argIndex,
                       const ur_kernel_arg_pointer_properties_t *pProperties,
                       const void *pArgValue) {
   std::ignore = pProperties;
-  // setKernelArg is expecting a pointer to our argument
-  hKernel->setKernelArg(argIndex, sizeof(pArgValue), &pArgValue);
+  hKernel->setKernelPtrArg(argIndex, pArgValue);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
                      const ur_kernel_arg_mem_obj_properties_t *Properties,
                      ur_mem_handle_t hArgValue) {
@@ -397,11 +406,53 @@ urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
   return Result;
 }
 
+ur_result_t urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                               const ur_exp_kernel_arg_properties_t *pArgs) {
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  try {
+    for (uint32_t i = 0; i < numArgs && Result == UR_RESULT_SUCCESS; i++) {
+      const ur_exp_kernel_arg_properties_t &Arg = pArgs[i];
+      switch (Arg.type) {
+      case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+        UR_ASSERT(Arg.size, UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE);
+        hKernel->setKernelArg(Arg.index, Arg.size, Arg.value.value);
+        break;
+      case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+        hKernel->setKernelPtrArg(Arg.index, Arg.value.pointer);
+        break;
+      case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+        UR_ASSERT(Arg.size, UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE);
+        hKernel->setKernelLocalArg(Arg.index, Arg.size);
+        break;
+      case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ: {
+        ur_kernel_arg_mem_obj_properties_t Properties = {
+            UR_STRUCTURE_TYPE_KERNEL_ARG_MEM_OBJ_PROPERTIES, nullptr,
+            Arg.value.memObjTuple.flags};
+        Result = ur::cuda::urKernelSetArgMemObj(hKernel, Arg.index, &Properties,
+                                                Arg.value.memObjTuple.hMem);
+        break;
+      }
+      case UR_EXP_KERNEL_ARG_TYPE_SAMPLER: {
+        uint32_t SamplerProps = Arg.value.sampler->Props;
+        hKernel->setKernelArg(Arg.index, sizeof(uint32_t), &SamplerProps);
+        break;
+      }
+      default:
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+      }
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  }
+  return Result;
+}
+
 // A NOP for the CUDA backend
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetExecInfo(
-    ur_kernel_handle_t hKernel, ur_kernel_exec_info_t propName, size_t propSize,
-    const ur_kernel_exec_info_properties_t *pProperties,
-    const void *pPropValue) {
+ur_result_t
+urKernelSetExecInfo(ur_kernel_handle_t hKernel, ur_kernel_exec_info_t propName,
+                    size_t propSize,
+                    const ur_kernel_exec_info_properties_t *pProperties,
+                    const void *pPropValue) {
   std::ignore = hKernel;
   std::ignore = propSize;
   std::ignore = pPropValue;
@@ -417,11 +468,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetExecInfo(
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
-    ur_native_handle_t hNativeKernel, ur_context_handle_t hContext,
-    ur_program_handle_t hProgram,
-    const ur_kernel_native_properties_t *pProperties,
-    ur_kernel_handle_t *phKernel) {
+ur_result_t
+urKernelCreateWithNativeHandle(ur_native_handle_t hNativeKernel,
+                               ur_context_handle_t hContext,
+                               ur_program_handle_t hProgram,
+                               const ur_kernel_native_properties_t *pProperties,
+                               ur_kernel_handle_t *phKernel) {
   std::ignore = hNativeKernel;
   std::ignore = hContext;
   std::ignore = hProgram;
@@ -430,7 +482,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urKernelSetArgSampler(ur_kernel_handle_t hKernel, uint32_t argIndex,
                       const ur_kernel_arg_sampler_properties_t *pProperties,
                       ur_sampler_handle_t hArgValue) {
@@ -446,7 +498,7 @@ urKernelSetArgSampler(ur_kernel_handle_t hKernel, uint32_t argIndex,
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
+ur_result_t urKernelGetSuggestedLocalWorkSize(
     ur_kernel_handle_t hKernel, ur_queue_handle_t hQueue, uint32_t workDim,
     [[maybe_unused]] const size_t *pGlobalWorkOffset,
     const size_t *pGlobalWorkSize, size_t *pSuggestedLocalWorkSize) {
@@ -472,3 +524,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
             pSuggestedLocalWorkSize);
   return Result;
 }
+} // namespace ur::cuda
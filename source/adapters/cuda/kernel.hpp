@@ -15,9 +15,11 @@
 #include <array>
 #include <atomic>
 #include <cassert>
-#include <numeric>
 
 #include "program.hpp"
+#include "ur_local_size_cache.hpp"
+#include "ur_usm_prefetch_args.hpp"
+#include "ur_interface_loader.hpp"
 
 /// Implementation of a UR Kernel for CUDA
 ///
@@ -50,21 +52,35 @@ struct ur_kernel_handle_t_ {
   size_t MaxLinearThreadsPerBlock{0};
   int RegsPerThread{0};
 
+  // The local sizes guessed for the launches which don't give one
+  ur::local_size_cache_t LocalSizeCache;
+
   /// Structure that holds the arguments to the kernel.
   /// Note each argument size is known, since it comes
   /// from the kernel signature.
   /// This is not something can be queried from the CUDA API
-  /// so there is a hard-coded size (\ref MAX_PARAM_BYTES)
+  /// so there is a hard-coded size (\ref MaxParamBytes)
   /// and a storage.
+  /// The arguments are laid out when they are set, so a launch only passes
+  /// the pointers of Indices and the cached local memory size, without
+  /// building or allocating anything.
   struct arguments {
     static constexpr size_t MaxParamBytes = 4000u;
+    // Arguments are aligned to the largest power of two dividing their size,
+    // up to the alignment of the largest vector types
+    static constexpr size_t MaxParamAlignment = 16u;
     using args_t = std::array<char, MaxParamBytes>;
     using args_size_t = std::vector<size_t>;
     using args_index_t = std::vector<void *>;
-    args_t Storage;
+    alignas(MaxParamAlignment) args_t Storage;
     args_size_t ParamSizes;
+    args_size_t ParamOffsets;
     args_index_t Indices;
     args_size_t OffsetPerIndex;
+    // The end of the last argument in Storage
+    size_t StorageSize = 0;
+    // The sum of OffsetPerIndex
+    uint32_t TotalLocalSize = 0;
     // A struct to keep track of memargs so that we can do dependency analysis
     // at urEnqueueKernelLaunch
     struct mem_obj_arg {
@@ -81,6 +97,33 @@ struct ur_kernel_handle_t_ {
       Indices.emplace_back(&ImplicitOffsetArgs);
     }
 
+    // A copy has its own storage, which its indices point to
+    arguments(const arguments &Other) { *this = Other; }
+
+    arguments &operator=(const arguments &Other) {
+      if (this == &Other) {
+        return *this;
+      }
+      std::memcpy(Storage.data(), Other.Storage.data(), Other.StorageSize);
+      ParamSizes = Other.ParamSizes;
+      ParamOffsets = Other.ParamOffsets;
+      OffsetPerIndex = Other.OffsetPerIndex;
+      StorageSize = Other.StorageSize;
+      TotalLocalSize = Other.TotalLocalSize;
+      MemObjArgs = Other.MemObjArgs;
+      std::memcpy(ImplicitOffsetArgs, Other.ImplicitOffsetArgs,
+                  sizeof(ImplicitOffsetArgs));
+      Indices.resize(Other.Indices.size());
+      for (size_t i = 0; i < Indices.size(); i++) {
+        const char *Arg = static_cast<const char *>(Other.Indices[i]);
+        Indices[i] = Arg == reinterpret_cast<const char *>(
+                                Other.ImplicitOffsetArgs)
+                         ? static_cast<void *>(ImplicitOffsetArgs)
+                         : Storage.data() + (Arg - Other.Storage.data());
+      }
+      return *this;
+    }
+
     /// Add an argument to the kernel.
     /// If the argument existed before, it is replaced.
     /// Otherwise, it is added.
@@ -93,15 +136,18 @@ struct ur_kernel_handle_t_ {
         Indices.resize(Index + 2, Indices.back());
         // Ensure enough space for the new argument
         ParamSizes.resize(Index + 1);
+        ParamOffsets.resize(Index + 1, StorageSize);
         OffsetPerIndex.resize(Index + 1);
       }
-      ParamSizes[Index] = Size;
-      // calculate the insertion point on the array
-      size_t InsertPos = std::accumulate(std::begin(ParamSizes),
-                                         std::begin(ParamSizes) + Index, 0);
+      if (Size != ParamSizes[Index]) {
+        resizeArg(Index, Size);
+      }
       // Update the stored value for the argument
-      std::memcpy(&Storage[InsertPos], Arg, Size);
-      Indices[Index] = &Storage[InsertPos];
+      if (Size) {
+        std::memcpy(&Storage[ParamOffsets[Index]], Arg, Size);
+      }
+      TotalLocalSize = static_cast<uint32_t>(
+          TotalLocalSize - OffsetPerIndex[Index] + LocalSize);
       OffsetPerIndex[Index] = LocalSize;
     }
 
@@ -147,49 +193,93 @@ struct ur_kernel_handle_t_ {
 
     void clearLocalSize() {
       std::fill(std::begin(OffsetPerIndex), std::end(OffsetPerIndex), 0);
+      TotalLocalSize = 0;
     }
 
     const args_index_t &getIndices() const noexcept { return Indices; }
 
-    uint32_t getLocalSize() const {
-      return std::accumulate(std::begin(OffsetPerIndex),
-                             std::end(OffsetPerIndex), 0);
+    uint32_t getLocalSize() const noexcept { return TotalLocalSize; }
+
+  private:
+    static size_t getAlignment(size_t Size) {
+      return Size ? std::min(Size & (~Size + 1), MaxParamAlignment) : 1;
+    }
+
+    /// Changes the size of an argument and lays out the ones after it again,
+    /// keeping their values. Throws if the arguments don't fit in Storage.
+    void resizeArg(size_t Index, size_t Size) {
+      size_t Begin =
+          Index ? ParamOffsets[Index - 1] + ParamSizes[Index - 1] : 0;
+      size_t End = Begin;
+      for (size_t i = Index; i < ParamSizes.size(); i++) {
+        size_t ArgSize = i == Index ? Size : ParamSizes[i];
+        End = alignUp(End, getAlignment(ArgSize)) + ArgSize;
+      }
+      if (End > MaxParamBytes) {
+        throw UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
+      }
+
+      args_t Values;
+      if (Index + 1 < ParamSizes.size()) {
+        std::memcpy(Values.data(), Storage.data(), StorageSize);
+      }
+      ParamSizes[Index] = Size;
+      size_t Offset = Begin;
+      for (size_t i = Index; i < ParamSizes.size(); i++) {
+        Offset = alignUp(Offset, getAlignment(ParamSizes[i]));
+        if (i != Index && ParamSizes[i]) {
+          std::memcpy(&Storage[Offset], &Values[ParamOffsets[i]],
+                      ParamSizes[i]);
+        }
+        ParamOffsets[i] = Offset;
+        Indices[i] = &Storage[Offset];
+        Offset += ParamSizes[i];
+      }
+      StorageSize = Offset;
+    }
+
+    static size_t alignUp(size_t Offset, size_t Alignment) {
+      return (Offset + Alignment - 1) & ~(Alignment - 1);
     }
   } Args;
 
-  ur_kernel_handle_t_(CUfunction Func, CUfunction FuncWithOffsetParam,
+  // The shared USM allocations of the pointer arguments, prefetched to the
+  // device before the launches with UR_USM_AUTO_PREFETCH
+  ur::usm_prefetch_args_t PrefetchArgs;
+
+  ur_kernel_handle_t_(const ur_program_handle_t_::KernelFunctions &Functions,
                       const char *Name, ur_program_handle_t Program,
                       ur_context_handle_t Context)
-      : Function{Func}, FunctionWithOffsetParam{FuncWithOffsetParam},
-        Name{Name}, Context{Context}, Program{Program}, RefCount{1} {
-    urProgramRetain(Program);
-    urContextRetain(Context);
+      : Function{Functions.Function},
+        FunctionWithOffsetParam{Functions.FunctionWithOffsetParam},
+        Name{Name}, Context{Context}, Program{Program}, RefCount{1},
+        RegsPerThread{Functions.RegsPerThread} {
+    ur::cuda::urProgramRetain(Program);
+    ur::cuda::urContextRetain(Context);
     /// Note: this code assumes that there is only one device per context
-    ur_result_t RetError = urKernelGetGroupInfo(
+    ur_result_t RetError = ur::cuda::urKernelGetGroupInfo(
         this, Program->getDevice(),
         UR_KERNEL_GROUP_INFO_COMPILE_WORK_GROUP_SIZE,
         sizeof(ReqdThreadsPerBlock), ReqdThreadsPerBlock, nullptr);
     (void)RetError;
     assert(RetError == UR_RESULT_SUCCESS);
     /// Note: this code assumes that there is only one device per context
-    RetError = urKernelGetGroupInfo(
+    RetError = ur::cuda::urKernelGetGroupInfo(
         this, Program->getDevice(),
         UR_KERNEL_GROUP_INFO_COMPILE_MAX_WORK_GROUP_SIZE,
         sizeof(MaxThreadsPerBlock), MaxThreadsPerBlock, nullptr);
     assert(RetError == UR_RESULT_SUCCESS);
     /// Note: this code assumes that there is only one device per context
-    RetError = urKernelGetGroupInfo(
+    RetError = ur::cuda::urKernelGetGroupInfo(
         this, Program->getDevice(),
         UR_KERNEL_GROUP_INFO_COMPILE_MAX_LINEAR_WORK_GROUP_SIZE,
         sizeof(MaxLinearThreadsPerBlock), &MaxLinearThreadsPerBlock, nullptr);
     assert(RetError == UR_RESULT_SUCCESS);
-    UR_CHECK_ERROR(
-        cuFuncGetAttribute(&RegsPerThread, CU_FUNC_ATTRIBUTE_NUM_REGS, Func));
   }
 
   ~ur_kernel_handle_t_() {
-    urProgramRelease(Program);
-    urContextRelease(Context);
+    ur::cuda::urProgramRelease(Program);
+    ur::cuda::urContextRelease(Context);
   }
 
   uint32_t incrementReferenceCount() noexcept { return ++RefCount; }
@@ -224,10 +314,16 @@ struct ur_kernel_handle_t_ {
 
   void setKernelArg(int Index, size_t Size, const void *Arg) {
     Args.addArg(Index, Size, Arg);
+    PrefetchArgs.clear(Index);
   }
 
+  /// Sets a pointer argument, and keeps the shared USM allocation it points
+  /// into for prefetching with UR_USM_AUTO_PREFETCH
+  void setKernelPtrArg(int Index, const void *Ptr);
+
   void setKernelLocalArg(int Index, size_t Size) {
     Args.addLocalArg(Index, Size);
+    PrefetchArgs.clear(Index);
   }
 
   void setImplicitOffsetArg(size_t Size, std::uint32_t *ImplicitOffset) {
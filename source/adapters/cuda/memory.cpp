@@ -14,14 +14,38 @@
 #include "context.hpp"
 #include "enqueue.hpp"
 #include "memory.hpp"
+#include "ur_interface_loader.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+// Whether the buffers of the context live in host memory, which all its
+// devices access coherently
+bool useCoherentBuffers(ur_context_handle_t hContext) {
+  static const bool Enabled = [] {
+    const char *EnvVar = std::getenv("UR_CUDA_COHERENT_BUFFERS");
+    return !EnvVar || std::atoi(EnvVar) != 0;
+  }();
+  const auto &Devices = hContext->getDevices();
+  return Enabled && std::all_of(Devices.begin(), Devices.end(),
+                                [](ur_device_handle_t hDevice) {
+                                  return hDevice->isCoherentWithHost();
+                                });
+}
+} // namespace
+
+namespace ur::cuda {
 
 /// Creates a UR Memory object using a CUDA memory allocation.
 /// Can trigger a manual copy depending on the mode.
 /// \TODO Implement USE_HOST_PTR using cuHostRegister - See #9789
 ///
-UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
-    ur_context_handle_t hContext, ur_mem_flags_t flags, size_t size,
-    const ur_buffer_properties_t *pProperties, ur_mem_handle_t *phBuffer) {
+ur_result_t urMemBufferCreate(ur_context_handle_t hContext,
+                              ur_mem_flags_t flags, size_t size,
+                              const ur_buffer_properties_t *pProperties,
+                              ur_mem_handle_t *phBuffer) {
   // Validate flags
   if (flags &
       (UR_MEM_FLAG_USE_HOST_POINTER | UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER)) {
@@ -37,15 +61,29 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
   const bool PerformInitialCopy =
       (flags & UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER) ||
       ((flags & UR_MEM_FLAG_USE_HOST_POINTER) && !EnableUseHostPtr);
+  const bool Coherent = useCoherentBuffers(hContext);
   ur_mem_handle_t MemObj = nullptr;
 
   try {
     auto HostPtr = pProperties ? pProperties->pHost : nullptr;
     BufferMem::AllocMode AllocMode = BufferMem::AllocMode::Classic;
 
-    if ((flags & UR_MEM_FLAG_USE_HOST_POINTER) && EnableUseHostPtr) {
-      UR_CHECK_ERROR(
-          cuMemHostRegister(HostPtr, size, CU_MEMHOSTREGISTER_DEVICEMAP));
+    if (Coherent && (flags & UR_MEM_FLAG_USE_HOST_POINTER)) {
+      AllocMode = BufferMem::AllocMode::CoherentHostPtr;
+    } else if (Coherent) {
+      // Portable, so that it is pinned for the contexts of all the devices
+      ScopedContext Active(hContext->getDevices()[0]);
+      void *HostMem = nullptr;
+      UR_CHECK_ERROR(cuMemHostAlloc(&HostMem, size,
+                                    CU_MEMHOSTALLOC_PORTABLE |
+                                        CU_MEMHOSTALLOC_DEVICEMAP));
+      if (flags & UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER) {
+        std::memcpy(HostMem, HostPtr, size);
+      }
+      HostPtr = HostMem;
+      AllocMode = BufferMem::AllocMode::Coherent;
+    } else if ((flags & UR_MEM_FLAG_USE_HOST_POINTER) && EnableUseHostPtr) {
+      UR_CHECK_ERROR(hContext->registerHostPtr(HostPtr, size));
       AllocMode = BufferMem::AllocMode::UseHostPtr;
     } else if (flags & UR_MEM_FLAG_ALLOC_HOST_POINTER) {
       UR_CHECK_ERROR(cuMemAllocHost(&HostPtr, size));
@@ -59,7 +97,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
 
     // First allocation will be made at urMemBufferCreate if context only
     // has one device
-    if (PerformInitialCopy && HostPtr) {
+    if (PerformInitialCopy && HostPtr && !Coherent) {
       // Perform initial copy to every device in context
       for (auto &Device : hContext->getDevices()) {
         ScopedContext Active(Device);
@@ -82,7 +120,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urMemRetain(ur_mem_handle_t hMem) {
+ur_result_t urMemRetain(ur_mem_handle_t hMem) {
   UR_ASSERT(hMem->getReferenceCount() > 0, UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   hMem->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
@@ -91,7 +129,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemRetain(ur_mem_handle_t hMem) {
 /// Decreases the reference count of the Mem object.
 /// If this is zero, calls the relevant CUDA Free function
 /// \return UR_RESULT_SUCCESS unless deallocation error
-UR_APIEXPORT ur_result_t UR_APICALL urMemRelease(ur_mem_handle_t hMem) {
+ur_result_t urMemRelease(ur_mem_handle_t hMem) {
   ur_result_t Result = UR_RESULT_SUCCESS;
 
   try {
@@ -127,9 +165,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemRelease(ur_mem_handle_t hMem) {
 /// \param[out] phNativeMem Set to the native handle of the UR mem object.
 ///
 /// \return UR_RESULT_SUCCESS
-UR_APIEXPORT ur_result_t UR_APICALL
-urMemGetNativeHandle(ur_mem_handle_t hMem, ur_device_handle_t Device,
-                     ur_native_handle_t *phNativeMem) {
+ur_result_t urMemGetNativeHandle(ur_mem_handle_t hMem,
+                                 ur_device_handle_t Device,
+                                 ur_native_handle_t *phNativeMem) {
   UR_ASSERT(Device != nullptr, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   try {
     *phNativeMem = std::get<BufferMem>(hMem->Mem).getPtr(Device);
@@ -141,11 +179,9 @@ urMemGetNativeHandle(ur_mem_handle_t hMem, ur_device_handle_t Device,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urMemGetInfo(ur_mem_handle_t hMemory,
-                                                 ur_mem_info_t MemInfoType,
-                                                 size_t propSize,
-                                                 void *pMemInfo,
-                                                 size_t *pPropSizeRet) {
+ur_result_t urMemGetInfo(ur_mem_handle_t hMemory, ur_mem_info_t MemInfoType,
+                         size_t propSize, void *pMemInfo,
+                         size_t *pPropSizeRet) {
   UR_ASSERT(hMemory->isBuffer(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
 
   UrReturnHelper ReturnValue(propSize, pMemInfo, pPropSizeRet);
@@ -177,24 +213,27 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemGetInfo(ur_mem_handle_t hMemory,
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
-    ur_native_handle_t, ur_context_handle_t, const ur_mem_native_properties_t *,
-    ur_mem_handle_t *) {
+ur_result_t
+urMemBufferCreateWithNativeHandle(ur_native_handle_t, ur_context_handle_t,
+                                  const ur_mem_native_properties_t *,
+                                  ur_mem_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
-    ur_native_handle_t, ur_context_handle_t, const ur_image_format_t *,
-    const ur_image_desc_t *, const ur_mem_native_properties_t *,
-    ur_mem_handle_t *) {
+ur_result_t urMemImageCreateWithNativeHandle(ur_native_handle_t,
+                                             ur_context_handle_t,
+                                             const ur_image_format_t *,
+                                             const ur_image_desc_t *,
+                                             const ur_mem_native_properties_t *,
+                                             ur_mem_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
 /// \TODO Not implemented
-UR_APIEXPORT ur_result_t UR_APICALL urMemImageCreate(
-    ur_context_handle_t hContext, ur_mem_flags_t flags,
-    const ur_image_format_t *pImageFormat, const ur_image_desc_t *pImageDesc,
-    void *pHost, ur_mem_handle_t *phMem) {
+ur_result_t urMemImageCreate(ur_context_handle_t hContext, ur_mem_flags_t flags,
+                             const ur_image_format_t *pImageFormat,
+                             const ur_image_desc_t *pImageDesc, void *pHost,
+                             ur_mem_handle_t *phMem) {
   if (flags &
       (UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER | UR_MEM_FLAG_USE_HOST_POINTER)) {
     UR_ASSERT(pHost, UR_RESULT_ERROR_INVALID_HOST_PTR);
@@ -241,11 +280,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemImageCreate(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urMemImageGetInfo(ur_mem_handle_t hMemory,
-                                                      ur_image_info_t propName,
-                                                      size_t propSize,
-                                                      void *pPropValue,
-                                                      size_t *pPropSizeRet) {
+ur_result_t urMemImageGetInfo(ur_mem_handle_t hMemory, ur_image_info_t propName,
+                              size_t propSize, void *pPropValue,
+                              size_t *pPropSizeRet) {
   UR_ASSERT(hMemory->isImage(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
 
   auto Context = hMemory->getContext();
@@ -353,10 +390,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemImageGetInfo(ur_mem_handle_t hMemory,
 /// Implements a buffer partition in the CUDA backend.
 /// A buffer partition (or a sub-buffer, in OpenCL terms) is simply implemented
 /// as an offset over an existing CUDA allocation.
-UR_APIEXPORT ur_result_t UR_APICALL urMemBufferPartition(
-    ur_mem_handle_t hBuffer, ur_mem_flags_t flags,
-    ur_buffer_create_type_t bufferCreateType, const ur_buffer_region_t *pRegion,
-    ur_mem_handle_t *phMem) {
+ur_result_t urMemBufferPartition(ur_mem_handle_t hBuffer, ur_mem_flags_t flags,
+                                 ur_buffer_create_type_t bufferCreateType,
+                                 const ur_buffer_region_t *pRegion,
+                                 ur_mem_handle_t *phMem) {
   UR_ASSERT(hBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT((flags & UR_MEM_FLAGS_MASK) == 0,
             UR_RESULT_ERROR_INVALID_ENUMERATION);
@@ -412,6 +449,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferPartition(
   *phMem = RetMemObj.release();
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::cuda
 
 ur_result_t allocateMemObjOnDeviceIfNeeded(ur_mem_handle_t Mem,
                                            const ur_device_handle_t hDevice) {
@@ -432,9 +470,14 @@ ur_result_t allocateMemObjOnDeviceIfNeeded(ur_mem_handle_t Mem,
       // Host allocation has already been made
       UR_CHECK_ERROR(cuMemHostGetDevicePointer(&DevPtr, Buffer.HostPtr, 0));
     } else if (Buffer.MemAllocMode == BufferMem::AllocMode::UseHostPtr) {
-      UR_CHECK_ERROR(cuMemHostRegister(Buffer.HostPtr, Buffer.Size,
-                                       CU_MEMHOSTALLOC_DEVICEMAP));
+      // Registered for all the devices by urMemBufferCreate
+      UR_CHECK_ERROR(cuMemHostGetDevicePointer(&DevPtr, Buffer.HostPtr, 0));
+    } else if (Buffer.MemAllocMode == BufferMem::AllocMode::Coherent) {
       UR_CHECK_ERROR(cuMemHostGetDevicePointer(&DevPtr, Buffer.HostPtr, 0));
+    } else if (Buffer.MemAllocMode ==
+               BufferMem::AllocMode::CoherentHostPtr) {
+      // Pageable memory has the same address on the devices
+      DevPtr = reinterpret_cast<CUdeviceptr>(Buffer.HostPtr);
     } else {
       UR_CHECK_ERROR(cuMemAlloc(&DevPtr, Buffer.Size));
     }
@@ -491,9 +534,11 @@ ur_result_t enqueueMigrateBufferToDevice(ur_mem_handle_t Mem,
                                        Buffer.Size, Stream));
     }
   } else if (Mem->LastQueueWritingToMemObj->getDevice() != hDevice) {
-    UR_CHECK_ERROR(cuMemcpyDtoDAsync(
-        Buffer.getPtr(hDevice),
-        Buffer.getPtr(Mem->LastQueueWritingToMemObj->getDevice()), Buffer.Size,
+    ur_device_handle_t SrcDevice = Mem->LastQueueWritingToMemObj->getDevice();
+    Mem->getContext()->enablePeerAccess(hDevice, SrcDevice);
+    UR_CHECK_ERROR(cuMemcpyPeerAsync(
+        Buffer.getPtr(hDevice), hDevice->getNativeContext(),
+        Buffer.getPtr(SrcDevice), SrcDevice->getNativeContext(), Buffer.Size,
         Stream));
   }
   return UR_RESULT_SUCCESS;
@@ -548,27 +593,21 @@ ur_result_t enqueueMigrateImageToDevice(ur_mem_handle_t Mem,
       }
     }
   } else if (Mem->LastQueueWritingToMemObj->getDevice() != hDevice) {
-    if (Image.ImageDesc.type == UR_MEM_TYPE_IMAGE1D) {
-      // Blocking wait needed
-      UR_CHECK_ERROR(urQueueFinish(Mem->LastQueueWritingToMemObj));
-      // FIXME: 1D memcpy from DtoD going through the host.
-      UR_CHECK_ERROR(cuMemcpyAtoH(
-          Image.HostPtr,
-          Image.getArray(Mem->LastQueueWritingToMemObj->getDevice()),
-          0 /*srcOffset*/, ImageSizeBytes));
-      UR_CHECK_ERROR(
-          cuMemcpyHtoA(ImageArray, 0, Image.HostPtr, ImageSizeBytes));
-    } else if (Image.ImageDesc.type == UR_MEM_TYPE_IMAGE2D) {
-      CpyDesc2D.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_DEVICE;
-      CpyDesc2D.srcArray =
-          Image.getArray(Mem->LastQueueWritingToMemObj->getDevice());
-      UR_CHECK_ERROR(cuMemcpy2DAsync(&CpyDesc2D, Stream));
-    } else if (Image.ImageDesc.type == UR_MEM_TYPE_IMAGE3D) {
-      CpyDesc3D.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_DEVICE;
-      CpyDesc3D.srcArray =
-          Image.getArray(Mem->LastQueueWritingToMemObj->getDevice());
-      UR_CHECK_ERROR(cuMemcpy3DAsync(&CpyDesc3D, Stream));
-    }
+    // Arrays of any dimensionality can be copied between contexts as 3D
+    ur_device_handle_t SrcDevice = Mem->LastQueueWritingToMemObj->getDevice();
+    Mem->getContext()->enablePeerAccess(hDevice, SrcDevice);
+    CUDA_MEMCPY3D_PEER CpyDescPeer;
+    memset(&CpyDescPeer, 0, sizeof(CpyDescPeer));
+    CpyDescPeer.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+    CpyDescPeer.srcArray = Image.getArray(SrcDevice);
+    CpyDescPeer.srcContext = SrcDevice->getNativeContext();
+    CpyDescPeer.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+    CpyDescPeer.dstArray = ImageArray;
+    CpyDescPeer.dstContext = hDevice->getNativeContext();
+    CpyDescPeer.WidthInBytes = PixelSizeBytes * Image.ImageDesc.width;
+    CpyDescPeer.Height = Image.ImageDesc.height;
+    CpyDescPeer.Depth = Image.ImageDesc.depth;
+    UR_CHECK_ERROR(cuMemcpy3DPeerAsync(&CpyDescPeer, Stream));
   }
   return UR_RESULT_SUCCESS;
 }
@@ -586,6 +625,11 @@ ur_result_t enqueueMigrateMemoryToDeviceIfNeeded(
     return UR_RESULT_SUCCESS;
   }
 
+  // The devices all access the host memory of coherent buffers
+  if (Mem->isBuffer() && std::get<BufferMem>(Mem->Mem).isCoherent()) {
+    return UR_RESULT_SUCCESS;
+  }
+
   ScopedContext Active(hDevice);
   if (Mem->isBuffer()) {
     UR_CHECK_ERROR(enqueueMigrateBufferToDevice(Mem, hDevice, Stream));
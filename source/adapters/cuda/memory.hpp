@@ -18,6 +18,7 @@
 #include "common.hpp"
 #include "context.hpp"
 #include "queue.hpp"
+#include "ur_interface_loader.hpp"
 
 ur_result_t allocateMemObjOnDeviceIfNeeded(ur_mem_handle_t,
                                            const ur_device_handle_t);
@@ -60,12 +61,18 @@ struct BufferMem {
    * copy_in: The data for the device comes from the host but the host pointer
    * is not available later for re-use alloc_host_ptr: Uses pinned-memory
    * allocation
+   * coherent: On devices coherent with the host, a host allocation the
+   * devices access directly, without any device allocation nor migration
+   * coherent_host_ptr: On devices coherent with the host, the host pointer
+   * itself, which the devices access through the host page tables
    */
   enum class AllocMode {
     Classic,
     UseHostPtr,
     CopyIn,
     AllocHostPtr,
+    Coherent,
+    CoherentHostPtr,
   };
 
   using native_type = CUdeviceptr;
@@ -89,11 +96,14 @@ public:
 
   AllocMode MemAllocMode;
 
+  /// Context registering HostPtr in UseHostPtr mode
+  ur_context_handle_t Context;
+
   BufferMem(ur_context_handle_t Context, ur_mem_handle_t OuterMemStruct,
             AllocMode Mode, void *HostPtr, size_t Size)
       : Ptrs(Context->getDevices().size(), native_type{0}),
         OuterMemStruct{OuterMemStruct}, HostPtr{HostPtr}, Size{Size},
-        MemAllocMode{Mode} {};
+        MemAllocMode{Mode}, Context{Context} {};
 
   BufferMem(const BufferMem &Buffer) = default;
 
@@ -109,6 +119,17 @@ public:
 
   bool isSubBuffer() const noexcept { return Parent != nullptr; }
 
+  bool isCoherent() const noexcept {
+    return MemAllocMode == AllocMode::Coherent ||
+           MemAllocMode == AllocMode::CoherentHostPtr;
+  }
+
+  // Whether the devices access HostPtr itself, so that it is mapped without
+  // any copy
+  bool isHostBacked() const noexcept {
+    return MemAllocMode == AllocMode::AllocHostPtr || isCoherent();
+  }
+
   size_t getSize() const noexcept { return Size; }
 
   BufferMap *getMapDetails(void *Map) {
@@ -163,10 +184,14 @@ public:
       }
       break;
     case AllocMode::UseHostPtr:
-      UR_CHECK_ERROR(cuMemHostUnregister(HostPtr));
+      UR_CHECK_ERROR(Context->unregisterHostPtr(HostPtr));
       break;
     case AllocMode::AllocHostPtr:
+    case AllocMode::Coherent:
       UR_CHECK_ERROR(cuMemFreeHost(HostPtr));
+      break;
+    case AllocMode::CoherentHostPtr:
+      break;
     }
     return UR_RESULT_SUCCESS;
   }
@@ -310,6 +335,15 @@ public:
 /// is on a different device, marked by
 /// LastQueueWritingToMemObj->getDevice()
 ///
+/// Migrations copy straight from the allocation of that device, on the
+/// stream of the command needing the data, with the peer access between
+/// the devices enabled when they support it.
+///
+/// When all the devices of the context are coherent with the host, buffers
+/// live in host memory that the devices access directly, so they are never
+/// migrated and their maps are zero-copy. UR_CUDA_COHERENT_BUFFERS=0 keeps
+/// them in device memory instead.
+///
 struct ur_mem_handle_t_ {
   // Context where the memory object is accessible
   ur_context_handle_t Context;
@@ -348,7 +382,7 @@ struct ur_mem_handle_t_ {
       : Context{Ctxt}, RefCount{1}, MemFlags{MemFlags},
         HaveMigratedToDeviceSinceLastWrite(Context->Devices.size(), false),
         Mem{std::in_place_type<BufferMem>, Ctxt, this, Mode, HostPtr, Size} {
-    urContextRetain(Context);
+    ur::cuda::urContextRetain(Context);
   };
 
   // Subbuffer constructor
@@ -369,7 +403,7 @@ struct ur_mem_handle_t_ {
         DevPtr += SubBufferOffset;
       }
     }
-    urMemRetain(Parent);
+    ur::cuda::urMemRetain(Parent);
   };
 
   /// Constructs the UR mem handler for an Image object
@@ -384,16 +418,16 @@ struct ur_mem_handle_t_ {
             ImageFormat,
             ImageDesc,
             HostPtr} {
-    urContextRetain(Context);
+    ur::cuda::urContextRetain(Context);
   }
 
   ~ur_mem_handle_t_() {
     clear();
     if (isBuffer() && isSubBuffer()) {
-      urMemRelease(std::get<BufferMem>(Mem).Parent);
+      ur::cuda::urMemRelease(std::get<BufferMem>(Mem).Parent);
       return;
     }
-    urContextRelease(Context);
+    ur::cuda::urContextRelease(Context);
   }
 
   bool isBuffer() const noexcept {
@@ -428,9 +462,9 @@ struct ur_mem_handle_t_ {
   uint32_t getReferenceCount() const noexcept { return RefCount; }
 
   void setLastQueueWritingToMemObj(ur_queue_handle_t WritingQueue) {
-    urQueueRetain(WritingQueue);
+    ur::cuda::urQueueRetain(WritingQueue);
     if (LastQueueWritingToMemObj != nullptr) {
-      urQueueRelease(LastQueueWritingToMemObj);
+      ur::cuda::urQueueRelease(LastQueueWritingToMemObj);
     }
     LastQueueWritingToMemObj = WritingQueue;
     for (const auto &Device : Context->getDevices()) {
@@ -12,11 +12,14 @@
 #include "common.hpp"
 #include "context.hpp"
 #include "event.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <cassert>
 #include <cuda.h>
 
-UR_APIEXPORT ur_result_t UR_APICALL urPhysicalMemCreate(
+namespace ur::cuda {
+
+ur_result_t urPhysicalMemCreate(
     ur_context_handle_t hContext, ur_device_handle_t hDevice, size_t size,
     [[maybe_unused]] const ur_physical_mem_properties_t *pProperties,
     ur_physical_mem_handle_t *phPhysicalMem) {
@@ -26,15 +29,25 @@ UR_APIEXPORT ur_result_t UR_APICALL urPhysicalMemCreate(
   AllocProps.location.id = hDevice->getIndex();
 
   CUmemGenericAllocationHandle ResHandle;
-  switch (auto Result = cuMemCreate(&ResHandle, size, &AllocProps, 0)) {
-  case CUDA_ERROR_INVALID_VALUE:
-    return UR_RESULT_ERROR_INVALID_SIZE;
-  default:
-    UR_CHECK_ERROR(Result);
+  if (auto Pooled = hContext->getPhysicalMemPool().acquire(hDevice, size)) {
+    ResHandle = *Pooled;
+  } else {
+    auto Result = cuMemCreate(&ResHandle, size, &AllocProps, 0);
+    // Give the pooled memory of the other sizes back to the driver and retry
+    if (Result == CUDA_ERROR_OUT_OF_MEMORY &&
+        hContext->trimPhysicalMemPool(0) > 0) {
+      Result = cuMemCreate(&ResHandle, size, &AllocProps, 0);
+    }
+    switch (Result) {
+    case CUDA_ERROR_INVALID_VALUE:
+      return UR_RESULT_ERROR_INVALID_SIZE;
+    default:
+      UR_CHECK_ERROR(Result);
+    }
   }
   try {
     *phPhysicalMem =
-        new ur_physical_mem_handle_t_(ResHandle, hContext, hDevice);
+        new ur_physical_mem_handle_t_(ResHandle, hContext, hDevice, size);
   } catch (std::bad_alloc &) {
     return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
   } catch (...) {
@@ -43,20 +56,26 @@ UR_APIEXPORT ur_result_t UR_APICALL urPhysicalMemCreate(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urPhysicalMemRetain(ur_physical_mem_handle_t hPhysicalMem) {
+ur_result_t urPhysicalMemRetain(ur_physical_mem_handle_t hPhysicalMem) {
   hPhysicalMem->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urPhysicalMemRelease(ur_physical_mem_handle_t hPhysicalMem) {
+ur_result_t urPhysicalMemRelease(ur_physical_mem_handle_t hPhysicalMem) {
   if (hPhysicalMem->decrementReferenceCount() > 0)
     return UR_RESULT_SUCCESS;
 
   try {
     std::unique_ptr<ur_physical_mem_handle_t_> PhysicalMemGuard(hPhysicalMem);
 
+    // The mappings of sparse resources come and go, keep the memory for the
+    // next ones
+    if (hPhysicalMem->getContext()->getPhysicalMemPool().release(
+            hPhysicalMem->getDevice(), hPhysicalMem->getSize(),
+            hPhysicalMem->get())) {
+      return UR_RESULT_SUCCESS;
+    }
+
     ScopedContext Active(hPhysicalMem->getDevice());
     UR_CHECK_ERROR(cuMemRelease(hPhysicalMem->get()));
   } catch (ur_result_t err) {
@@ -66,3 +85,4 @@ urPhysicalMemRelease(ur_physical_mem_handle_t hPhysicalMem) {
   }
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::cuda
@@ -16,6 +16,7 @@
 #include "adapter.hpp"
 #include "device.hpp"
 #include "platform.hpp"
+#include "ur_interface_loader.hpp"
 
 /// UR queue mapping on physical memory allocations used in virtual memory
 /// management.
@@ -27,17 +28,19 @@ struct ur_physical_mem_handle_t_ {
   native_type PhysicalMem;
   ur_context_handle_t_ *Context;
   ur_device_handle_t Device;
+  size_t Size;
 
   ur_physical_mem_handle_t_(native_type PhysMem, ur_context_handle_t_ *Ctx,
-                            ur_device_handle_t Device)
-      : RefCount(1), PhysicalMem(PhysMem), Context(Ctx), Device(Device) {
-    urContextRetain(Context);
-    urDeviceRetain(Device);
+                            ur_device_handle_t Device, size_t Size)
+      : RefCount(1), PhysicalMem(PhysMem), Context(Ctx), Device(Device),
+        Size(Size) {
+    ur::cuda::urContextRetain(Context);
+    ur::cuda::urDeviceRetain(Device);
   }
 
   ~ur_physical_mem_handle_t_() {
-    urContextRelease(Context);
-    urDeviceRelease(Device);
+    ur::cuda::urContextRelease(Context);
+    ur::cuda::urDeviceRelease(Device);
   }
 
   native_type get() const noexcept { return PhysicalMem; }
@@ -46,6 +49,8 @@ struct ur_physical_mem_handle_t_ {
 
   ur_device_handle_t_ *getDevice() const noexcept { return Device; }
 
+  size_t getSize() const noexcept { return Size; }
+
   uint32_t incrementReferenceCount() noexcept { return ++RefCount; }
 
   uint32_t decrementReferenceCount() noexcept { return --RefCount; }
@@ -12,14 +12,17 @@
 #include "common.hpp"
 #include "context.hpp"
 #include "device.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <cassert>
 #include <cuda.h>
 #include <sstream>
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetInfo(
-    ur_platform_handle_t hPlatform, ur_platform_info_t PlatformInfoType,
-    size_t Size, void *pPlatformInfo, size_t *pSizeRet) {
+namespace ur::cuda {
+
+ur_result_t urPlatformGetInfo(ur_platform_handle_t hPlatform,
+                              ur_platform_info_t PlatformInfoType, size_t Size,
+                              void *pPlatformInfo, size_t *pSizeRet) {
 
   UR_ASSERT(hPlatform, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UrReturnHelper ReturnValue(Size, pPlatformInfo, pSizeRet);
@@ -52,9 +55,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetInfo(
 /// There is only one CUDA platform, and contains all devices on the system.
 /// Triggers the CUDA Driver initialization (cuInit) the first time, so this
 /// must be the first PI API called.
-UR_APIEXPORT ur_result_t UR_APICALL
-urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
-              ur_platform_handle_t *phPlatforms, uint32_t *pNumPlatforms) {
+ur_result_t urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
+                          ur_platform_handle_t *phPlatforms,
+                          uint32_t *pNumPlatforms) {
 
   try {
     static std::once_flag InitFlag;
@@ -130,23 +133,24 @@ urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetApiVersion(
-    ur_platform_handle_t hDriver, ur_api_version_t *pVersion) {
+ur_result_t urPlatformGetApiVersion(ur_platform_handle_t hDriver,
+                                    ur_api_version_t *pVersion) {
   std::ignore = hDriver;
   *pVersion = UR_API_VERSION_CURRENT;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetNativeHandle(
-    ur_platform_handle_t hPlatform, ur_native_handle_t *phNativePlatform) {
+ur_result_t urPlatformGetNativeHandle(ur_platform_handle_t hPlatform,
+                                      ur_native_handle_t *phNativePlatform) {
   std::ignore = hPlatform;
   std::ignore = phNativePlatform;
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
-    ur_native_handle_t, ur_adapter_handle_t,
-    const ur_platform_native_properties_t *, ur_platform_handle_t *) {
+ur_result_t
+urPlatformCreateWithNativeHandle(ur_native_handle_t, ur_adapter_handle_t,
+                                 const ur_platform_native_properties_t *,
+                                 ur_platform_handle_t *) {
   // There is no CUDA equivalent to ur_platform_handle_t
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
@@ -155,9 +159,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
 // Current support is only for optimization options.
 // Return empty string for cuda.
 // TODO: Determine correct string to be passed.
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetBackendOption(
-    ur_platform_handle_t hPlatform, const char *pFrontendOption,
-    const char **ppPlatformOption) {
+ur_result_t urPlatformGetBackendOption(ur_platform_handle_t hPlatform,
+                                       const char *pFrontendOption,
+                                       const char **ppPlatformOption) {
   std::ignore = hPlatform;
   using namespace std::literals;
   if (pFrontendOption == nullptr)
@@ -170,3 +174,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetBackendOption(
   }
   return UR_RESULT_ERROR_INVALID_VALUE;
 }
+} // namespace ur::cuda
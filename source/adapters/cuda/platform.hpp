@@ -10,8 +10,11 @@
 #pragma once
 
 #include <ur/ur.hpp>
+#include <ur_peer_topology.hpp>
 #include <vector>
 
 struct ur_platform_handle_t_ {
   std::vector<std::unique_ptr<ur_device_handle_t_>> Devices;
+  // The links between the devices, for the P2P link and copy route queries
+  ur::peer_topology_t PeerTopology;
 };
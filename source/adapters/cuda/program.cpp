@@ -9,7 +9,59 @@
 //===----------------------------------------------------------------------===//
 
 #include "program.hpp"
+#include "ur_binary_cache.hpp"
 #include "ur_util.hpp"
+#include "ur_interface_loader.hpp"
+
+#include <cstring>
+
+// The cubins JIT compiled from PTX, kept across processes in the program
+// cache, or in the directory UR_CUDA_CUBIN_CACHE_DIR if it is set.
+static const ur::binary_cache_t &getCubinCache() {
+  static const ur::binary_cache_t Cache(
+      "cuda", "UR_CUDA_CUBIN_CACHE_DIR",
+      {'U', 'R', 'C', 'U', 'B', 'I', 'N', '2'});
+  return Cache;
+}
+
+// Returns the key of the cubin compiled from the PTX of Inputs with
+// BuildOptions. Cubins are only valid for the architecture of the device and
+// the driver which compiled them.
+static std::string
+getCubinCacheKey(ur_device_handle_t hDevice,
+                 const std::vector<std::pair<const char *, size_t>> &Inputs,
+                 const std::string &BuildOptions) {
+  ur::binary_hash_t Hash;
+  for (auto &[Data, Size] : Inputs) {
+    Hash.addField(Data, Size);
+  }
+  Hash.addField(BuildOptions);
+
+  int Arch[2] = {
+      getAttribute(hDevice, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR),
+      getAttribute(hDevice, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR)};
+  Hash.addField(Arch, sizeof(Arch));
+  int DriverVersion = 0;
+  UR_CHECK_ERROR(cuDriverGetVersion(&DriverVersion));
+  Hash.addField(&DriverVersion, sizeof(DriverVersion));
+  return Hash.str();
+}
+
+// Whether Binary is PTX, which the driver JIT compiles, rather than a cubin,
+// which is an ELF file, or a fatbin
+static bool isPTX(const char *Binary, size_t Size) {
+  static constexpr char ElfMagic[] = {0x7f, 'E', 'L', 'F'};
+  static constexpr uint32_t FatbinMagic = 0xba55ed50;
+  if (Size >= sizeof(ElfMagic) &&
+      std::memcmp(Binary, ElfMagic, sizeof(ElfMagic)) == 0) {
+    return false;
+  }
+  uint32_t Magic = 0;
+  if (Size >= sizeof(Magic)) {
+    std::memcpy(&Magic, Binary, sizeof(Magic));
+  }
+  return Magic != FatbinMagic;
+}
 
 bool getMaxRegistersJitOptionValue(const std::string &BuildOptions,
                                    unsigned int &Value) {
@@ -136,9 +188,44 @@ ur_result_t ur_program_handle_t_::buildProgram(const char *BuildOptions) {
     }
   }
 
-  UR_CHECK_ERROR(cuModuleLoadDataEx(&Module, static_cast<const void *>(Binary),
-                                    Options.size(), Options.data(),
-                                    OptionVals.data()));
+  std::string CacheKey;
+  if (getCubinCache().enabled() && isPTX(Binary, BinarySizeInBytes)) {
+    CacheKey = getCubinCacheKey(Device, {{Binary, BinarySizeInBytes}},
+                                this->BuildOptions);
+    ur::cached_binary_t CuBin;
+    if (getCubinCache().load(CacheKey, CuBin)) {
+      UR_CHECK_ERROR(cuModuleLoadDataEx(&Module, CuBin.data(), Options.size(),
+                                        Options.data(), OptionVals.data()));
+      BuildStatus = UR_PROGRAM_BUILD_STATUS_SUCCESS;
+      return UR_RESULT_SUCCESS;
+    }
+  }
+
+  if (CacheKey.empty()) {
+    UR_CHECK_ERROR(cuModuleLoadDataEx(
+        &Module, static_cast<const void *>(Binary), Options.size(),
+        Options.data(), OptionVals.data()));
+  } else {
+    // Compiles through the linker, which returns the cubin to cache
+    CUlinkState State;
+    UR_CHECK_ERROR(cuLinkCreate(Options.size(), Options.data(),
+                                OptionVals.data(), &State));
+    try {
+      UR_CHECK_ERROR(cuLinkAddData(State, CU_JIT_INPUT_PTX,
+                                   const_cast<char *>(Binary),
+                                   BinarySizeInBytes, nullptr, 0, nullptr,
+                                   nullptr));
+      void *CuBin = nullptr;
+      size_t CuBinSize = 0;
+      UR_CHECK_ERROR(cuLinkComplete(State, &CuBin, &CuBinSize));
+      UR_CHECK_ERROR(cuModuleLoadData(&Module, CuBin));
+      getCubinCache().store(CacheKey, CuBin, CuBinSize);
+    } catch (...) {
+      cuLinkDestroy(State);
+      throw;
+    }
+    UR_CHECK_ERROR(cuLinkDestroy(State));
+  }
 
   BuildStatus = UR_PROGRAM_BUILD_STATUS_SUCCESS;
 
@@ -165,6 +252,42 @@ ur_result_t ur_program_handle_t_::getGlobalVariablePointer(
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t
+ur_program_handle_t_::getKernelFunctions(const char *Name,
+                                         KernelFunctions &Functions) {
+  std::lock_guard<std::mutex> Lock(KernelFunctionsMutex);
+  if (auto It = KernelFunctionsByName.find(Name);
+      It != KernelFunctionsByName.end()) {
+    Functions = It->second;
+    return UR_RESULT_SUCCESS;
+  }
+
+  CUresult FunctionResult =
+      cuModuleGetFunction(&Functions.Function, get(), Name);
+  // We can't add this as a generic mapping in UR_CHECK_ERROR since cuda's
+  // NOT_FOUND error applies to more than just functions.
+  if (FunctionResult == CUDA_ERROR_NOT_FOUND) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_NAME;
+  }
+  UR_CHECK_ERROR(FunctionResult);
+
+  std::string NameWithOffset = std::string(Name) + "_with_offset";
+  CUresult OffsetRes = cuModuleGetFunction(&Functions.FunctionWithOffsetParam,
+                                           get(), NameWithOffset.c_str());
+  // If there is no kernel with global offset parameter we mark it as missing
+  if (OffsetRes == CUDA_ERROR_NOT_FOUND) {
+    Functions.FunctionWithOffsetParam = nullptr;
+  } else {
+    UR_CHECK_ERROR(OffsetRes);
+  }
+
+  UR_CHECK_ERROR(cuFuncGetAttribute(&Functions.RegsPerThread,
+                                    CU_FUNC_ATTRIBUTE_NUM_REGS,
+                                    Functions.Function));
+  KernelFunctionsByName.emplace(Name, Functions);
+  return UR_RESULT_SUCCESS;
+}
+
 /// Finds kernel names by searching for entry points in the PTX source, as the
 /// CUDA driver API doesn't expose an operation for this.
 /// Note: This is currently only being used by the SYCL program class for the
@@ -221,45 +344,42 @@ ur_result_t createProgram(ur_context_handle_t hContext,
   return UR_RESULT_SUCCESS;
 }
 
+namespace ur::cuda {
+
 // A program is unique to a device so this entry point cannot be supported with
 // a multi device context
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramCreateWithIL(ur_context_handle_t, const void *, size_t,
-                      const ur_program_properties_t *, ur_program_handle_t *) {
+ur_result_t urProgramCreateWithIL(ur_context_handle_t, const void *, size_t,
+                                  const ur_program_properties_t *,
+                                  ur_program_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
 /// CUDA will handle the PTX/CUBIN binaries internally through a call to
 /// cuModuleLoadDataEx. So, urProgramCompile and urProgramBuild are equivalent
 /// in terms of CUDA adapter. \TODO Implement asynchronous compilation
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramCompile(ur_context_handle_t hContext, ur_program_handle_t hProgram,
-                 const char *pOptions) {
-  UR_CHECK_ERROR(urProgramBuild(hContext, hProgram, pOptions));
+ur_result_t urProgramCompile(ur_context_handle_t hContext,
+                             ur_program_handle_t hProgram,
+                             const char *pOptions) {
+  UR_CHECK_ERROR(ur::cuda::urProgramBuild(hContext, hProgram, pOptions));
   hProgram->BinaryType = UR_PROGRAM_BINARY_TYPE_COMPILED_OBJECT;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCompileExp(ur_program_handle_t,
-                                                        uint32_t,
-                                                        ur_device_handle_t *,
-                                                        const char *) {
+ur_result_t urProgramCompileExp(ur_program_handle_t, uint32_t,
+                                ur_device_handle_t *, const char *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramBuildExp(ur_program_handle_t,
-                                                      uint32_t,
-                                                      ur_device_handle_t *,
-                                                      const char *) {
+ur_result_t urProgramBuildExp(ur_program_handle_t, uint32_t,
+                              ur_device_handle_t *, const char *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
 /// Loads the images from a UR program into a CUmodule that can be
 /// used later on to extract functions (kernels).
 /// See \ref ur_program_handle_t for implementation details.
-UR_APIEXPORT ur_result_t UR_APICALL urProgramBuild(ur_context_handle_t hContext,
-                                                   ur_program_handle_t hProgram,
-                                                   const char *pOptions) {
+ur_result_t urProgramBuild(ur_context_handle_t hContext,
+                           ur_program_handle_t hProgram, const char *pOptions) {
   std::ignore = hContext;
 
   ur_result_t Result = UR_RESULT_SUCCESS;
@@ -276,9 +396,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramBuild(ur_context_handle_t hContext,
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramLinkExp(
-    ur_context_handle_t, uint32_t, ur_device_handle_t *, uint32_t,
-    const ur_program_handle_t *, const char *, ur_program_handle_t *phProgram) {
+ur_result_t urProgramLinkExp(ur_context_handle_t, uint32_t,
+                             ur_device_handle_t *, uint32_t,
+                             const ur_program_handle_t *, const char *,
+                             ur_program_handle_t *phProgram) {
   if (nullptr != phProgram) {
     *phProgram = nullptr;
   }
@@ -288,10 +409,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramLinkExp(
 /// Creates a new UR program object that is the outcome of linking all input
 /// programs.
 /// \TODO Implement linker options, requires mapping of OpenCL to CUDA
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramLink(ur_context_handle_t hContext, uint32_t count,
-              const ur_program_handle_t *phPrograms, const char *pOptions,
-              ur_program_handle_t *phProgram) {
+ur_result_t urProgramLink(ur_context_handle_t hContext, uint32_t count,
+                          const ur_program_handle_t *phPrograms,
+                          const char *pOptions,
+                          ur_program_handle_t *phProgram) {
   ur_result_t Result = UR_RESULT_SUCCESS;
   if (nullptr != phProgram) {
     *phProgram = nullptr;
@@ -305,34 +426,56 @@ urProgramLink(ur_context_handle_t hContext, uint32_t count,
   try {
     ScopedContext Active(phPrograms[0]->getDevice());
 
-    CUlinkState State;
     std::unique_ptr<ur_program_handle_t_> RetProgram{
         new ur_program_handle_t_{hContext, phPrograms[0]->getDevice()}};
 
-    UR_CHECK_ERROR(cuLinkCreate(0, nullptr, nullptr, &State));
-    try {
+    std::string CacheKey;
+    if (getCubinCache().enabled()) {
+      std::vector<std::pair<const char *, size_t>> Inputs;
       for (size_t i = 0; i < count; ++i) {
-        ur_program_handle_t Program = phPrograms[i];
-        UR_CHECK_ERROR(cuLinkAddData(
-            State, CU_JIT_INPUT_PTX, const_cast<char *>(Program->Binary),
-            Program->BinarySizeInBytes, nullptr, 0, nullptr, nullptr));
+        Inputs.emplace_back(phPrograms[i]->Binary,
+                            phPrograms[i]->BinarySizeInBytes);
       }
-      void *CuBin = nullptr;
-      size_t CuBinSize = 0;
-      UR_CHECK_ERROR(cuLinkComplete(State, &CuBin, &CuBinSize));
-
-      Result =
-          RetProgram->setBinary(static_cast<const char *>(CuBin), CuBinSize);
+      CacheKey = getCubinCacheKey(RetProgram->getDevice(), Inputs,
+                                  pOptions ? pOptions : "");
+    }
 
-      Result = RetProgram->buildProgram(pOptions);
-      RetProgram->BinaryType = UR_PROGRAM_BINARY_TYPE_EXECUTABLE;
-    } catch (...) {
-      // Upon error attempt cleanup
+    if (getCubinCache().load(CacheKey, RetProgram->CachedExecutable)) {
+      auto &CuBin = RetProgram->CachedExecutable;
+      UR_CHECK_ERROR(RetProgram->setBinary(
+          reinterpret_cast<const char *>(CuBin.data()), CuBin.size()));
+    } else {
+      CUlinkState State;
+      UR_CHECK_ERROR(cuLinkCreate(0, nullptr, nullptr, &State));
+      try {
+        for (size_t i = 0; i < count; ++i) {
+          ur_program_handle_t Program = phPrograms[i];
+          UR_CHECK_ERROR(cuLinkAddData(
+              State, CU_JIT_INPUT_PTX, const_cast<char *>(Program->Binary),
+              Program->BinarySizeInBytes, nullptr, 0, nullptr, nullptr));
+        }
+        void *CuBin = nullptr;
+        size_t CuBinSize = 0;
+        UR_CHECK_ERROR(cuLinkComplete(State, &CuBin, &CuBinSize));
+
+        // The cubin belongs to the linker, it's copied to outlive it
+        RetProgram->ExecutableCache.assign(static_cast<const char *>(CuBin),
+                                           CuBinSize);
+        getCubinCache().store(CacheKey, CuBin, CuBinSize);
+      } catch (...) {
+        // Upon error attempt cleanup
+        UR_CHECK_ERROR(cuLinkDestroy(State));
+        throw;
+      }
       UR_CHECK_ERROR(cuLinkDestroy(State));
-      throw;
+
+      auto &CuBin = RetProgram->ExecutableCache;
+      UR_CHECK_ERROR(RetProgram->setBinary(CuBin.data(), CuBin.size()));
     }
 
-    UR_CHECK_ERROR(cuLinkDestroy(State));
+    Result = RetProgram->buildProgram(pOptions);
+    RetProgram->BinaryType = UR_PROGRAM_BINARY_TYPE_EXECUTABLE;
+
     *phProgram = RetProgram.release();
 
   } catch (ur_result_t Err) {
@@ -352,16 +495,18 @@ urProgramLink(ur_context_handle_t hContext, uint32_t count,
 /// \param[out] program Set to the UR program object created from native handle.
 ///
 /// \return TBD
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
-    ur_native_handle_t, ur_context_handle_t,
-    const ur_program_native_properties_t *, ur_program_handle_t *) {
+ur_result_t
+urProgramCreateWithNativeHandle(ur_native_handle_t, ur_context_handle_t,
+                                const ur_program_native_properties_t *,
+                                ur_program_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramGetBuildInfo(ur_program_handle_t hProgram, ur_device_handle_t hDevice,
-                      ur_program_build_info_t propName, size_t propSize,
-                      void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urProgramGetBuildInfo(ur_program_handle_t hProgram,
+                                  ur_device_handle_t hDevice,
+                                  ur_program_build_info_t propName,
+                                  size_t propSize, void *pPropValue,
+                                  size_t *pPropSizeRet) {
   std::ignore = hDevice;
 
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
@@ -391,9 +536,9 @@ urProgramGetBuildInfo(ur_program_handle_t hProgram, ur_device_handle_t hDevice,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramGetInfo(ur_program_handle_t hProgram, ur_program_info_t propName,
-                 size_t propSize, void *pProgramInfo, size_t *pPropSizeRet) {
+ur_result_t urProgramGetInfo(ur_program_handle_t hProgram,
+                             ur_program_info_t propName, size_t propSize,
+                             void *pProgramInfo, size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pProgramInfo, pPropSizeRet);
 
   switch (propName) {
@@ -423,8 +568,7 @@ urProgramGetInfo(ur_program_handle_t hProgram, ur_program_info_t propName,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramRetain(ur_program_handle_t hProgram) {
+ur_result_t urProgramRetain(ur_program_handle_t hProgram) {
   UR_ASSERT(hProgram->getReferenceCount() > 0, UR_RESULT_ERROR_INVALID_PROGRAM);
   hProgram->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
@@ -433,8 +577,7 @@ urProgramRetain(ur_program_handle_t hProgram) {
 /// Decreases the reference count of a ur_program_handle_t object.
 /// When the reference count reaches 0, it unloads the module from
 /// the context.
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramRelease(ur_program_handle_t hProgram) {
+ur_result_t urProgramRelease(ur_program_handle_t hProgram) {
   // double delete or someone is messing with the ref count.
   // either way, cannot safely proceed.
   UR_ASSERT(hProgram->getReferenceCount() != 0,
@@ -476,13 +619,13 @@ urProgramRelease(ur_program_handle_t hProgram) {
 /// \param[out] nativeHandle Set to the native handle of the UR program object.
 ///
 /// \return ur_result_t
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetNativeHandle(
-    ur_program_handle_t hProgram, ur_native_handle_t *nativeHandle) {
+ur_result_t urProgramGetNativeHandle(ur_program_handle_t hProgram,
+                                     ur_native_handle_t *nativeHandle) {
   *nativeHandle = reinterpret_cast<ur_native_handle_t>(hProgram->get());
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
+ur_result_t urProgramCreateWithBinary(
     ur_context_handle_t hContext, ur_device_handle_t hDevice, size_t size,
     const uint8_t *pBinary, const ur_program_properties_t *pProperties,
     ur_program_handle_t *phProgram) {
@@ -496,14 +639,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
 
 // This entry point is only used for native specialization constants (SPIR-V),
 // and the CUDA plugin is AOT only so this entry point is not supported.
-UR_APIEXPORT ur_result_t UR_APICALL urProgramSetSpecializationConstants(
-    ur_program_handle_t, uint32_t, const ur_specialization_constant_info_t *) {
+ur_result_t
+urProgramSetSpecializationConstants(ur_program_handle_t, uint32_t,
+                                    const ur_specialization_constant_info_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
-    ur_device_handle_t hDevice, ur_program_handle_t hProgram,
-    const char *pFunctionName, void **ppFunctionPointer) {
+ur_result_t urProgramGetFunctionPointer(ur_device_handle_t hDevice,
+                                        ur_program_handle_t hProgram,
+                                        const char *pFunctionName,
+                                        void **ppFunctionPointer) {
   // Check if device passed is the same the device bound to the context
   UR_ASSERT(hDevice == hProgram->getDevice(), UR_RESULT_ERROR_INVALID_DEVICE);
 
@@ -522,7 +667,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
+ur_result_t urProgramGetGlobalVariablePointer(
     ur_device_handle_t, ur_program_handle_t hProgram,
     const char *pGlobalVariableName, size_t *pGlobalVariableSizeRet,
     void **ppGlobalVariablePointerRet) {
@@ -531,3 +676,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
       reinterpret_cast<CUdeviceptr *>(ppGlobalVariablePointerRet),
       pGlobalVariableSizeRet);
 }
+} // namespace ur::cuda
@@ -13,15 +13,22 @@
 #include <ur_api.h>
 
 #include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 #include "context.hpp"
+#include "ur_binary_cache.hpp"
+#include "ur_interface_loader.hpp"
 
 struct ur_program_handle_t_ {
   using native_type = CUmodule;
   native_type Module;
   const char *Binary;
   size_t BinarySizeInBytes;
+  // The cubin linked by urProgramLink, or mapped from the cubin cache, which
+  // Binary points to
+  std::string ExecutableCache;
+  ur::cached_binary_t CachedExecutable;
   std::atomic_uint32_t RefCount;
   ur_context_handle_t Context;
   ur_device_handle_t Device;
@@ -50,13 +57,13 @@ struct ur_program_handle_t_ {
       : Module{nullptr}, Binary{}, BinarySizeInBytes{0}, RefCount{1},
         Context{Context}, Device{Device}, KernelReqdWorkGroupSizeMD{},
         KernelMaxWorkGroupSizeMD{}, KernelMaxLinearWorkGroupSizeMD{} {
-    urContextRetain(Context);
-    urDeviceRetain(Device);
+    ur::cuda::urContextRetain(Context);
+    ur::cuda::urDeviceRetain(Device);
   }
 
   ~ur_program_handle_t_() {
-    urContextRelease(Context);
-    urDeviceRelease(Device);
+    ur::cuda::urContextRelease(Context);
+    ur::cuda::urDeviceRelease(Device);
   }
 
   ur_result_t setMetadata(const ur_program_metadata_t *Metadata, size_t Length);
@@ -78,4 +85,21 @@ struct ur_program_handle_t_ {
   ur_result_t getGlobalVariablePointer(const char *name,
                                        CUdeviceptr *DeviceGlobal,
                                        size_t *DeviceGlobalSize);
+
+  // The functions of a kernel of the module, with the attributes
+  // urKernelCreate reads
+  struct KernelFunctions {
+    CUfunction Function;
+    // nullptr if the kernel has no variant with a global offset parameter
+    CUfunction FunctionWithOffsetParam;
+    int RegsPerThread;
+  };
+
+  // The functions of the kernel Name, looked up in the module the first time
+  // only, as the kernels created again for a name share them
+  ur_result_t getKernelFunctions(const char *Name, KernelFunctions &Functions);
+
+private:
+  std::mutex KernelFunctionsMutex;
+  std::unordered_map<std::string, KernelFunctions> KernelFunctionsByName;
 };
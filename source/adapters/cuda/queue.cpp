@@ -12,31 +12,211 @@
 #include "common.hpp"
 #include "context.hpp"
 #include "event.hpp"
+#include "latency_tracker.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <cassert>
+#include <cstdlib>
 #include <cuda.h>
+#include <string>
+
+namespace {
+// The epoch is loaded before waiting, and bumped by the barrier once
+// BarrierEvent is recorded, so the wait is for the barrier of the epoch or a
+// later one. The stream waits again if a later barrier raced with the wait.
+void waitForBarrierIfNeeded(CUstream Stream, CUevent &BarrierEvent,
+                            const std::atomic_uint32_t &BarrierEpoch,
+                            std::atomic_uint32_t &StreamEpoch) {
+  uint32_t Epoch = BarrierEpoch.load(std::memory_order_acquire);
+  if (StreamEpoch.load(std::memory_order_relaxed) != Epoch) {
+    UR_CHECK_ERROR(cuStreamWaitEvent(Stream, BarrierEvent, 0));
+    StreamEpoch.store(Epoch, std::memory_order_relaxed);
+  }
+}
+} // namespace
 
 void ur_queue_handle_t_::computeStreamWaitForBarrierIfNeeded(CUstream Stream,
                                                              uint32_t StreamI) {
-  if (BarrierEvent && !ComputeAppliedBarrier[StreamI]) {
-    UR_CHECK_ERROR(cuStreamWaitEvent(Stream, BarrierEvent, 0));
-    ComputeAppliedBarrier[StreamI] = true;
-  }
+  waitForBarrierIfNeeded(Stream, BarrierEvent, BarrierEpoch,
+                         ComputeBarrierEpochs[StreamI]);
 }
 
 void ur_queue_handle_t_::transferStreamWaitForBarrierIfNeeded(
     CUstream Stream, uint32_t StreamI) {
-  if (BarrierEvent && !TransferAppliedBarrier[StreamI]) {
-    UR_CHECK_ERROR(cuStreamWaitEvent(Stream, BarrierEvent, 0));
-    TransferAppliedBarrier[StreamI] = true;
+  waitForBarrierIfNeeded(Stream, BarrierEvent, BarrierEpoch,
+                         TransferBarrierEpochs[StreamI]);
+}
+
+unsigned int ur_queue_handle_t_::getBulkQueueMaxStreams() {
+  static const unsigned int MaxStreams = static_cast<unsigned int>(
+      getenv_to_unsigned("UR_CUDA_BULK_QUEUE_MAX_STREAMS").value_or(0));
+  return MaxStreams;
+}
+
+bool ur_queue_handle_t_::isGraphCaptureEnabled() {
+  static const bool Enabled = [] {
+    const char *Env = std::getenv("UR_CUDA_GRAPH_CAPTURE");
+    return Env && std::string(Env) != "0";
+  }();
+  return Enabled;
+}
+
+void ur_queue_handle_t_::deferKernelLaunch(ur_deferred_launch_t_ &&Launch) {
+  std::lock_guard<std::mutex> Lock(DeferredLaunchesMutex);
+  UR_CHECK_ERROR(ur::cuda::urKernelRetain(Launch.Kernel));
+  DeferredLaunches.push_back(std::move(Launch));
+  if (DeferredLaunches.size() >= MaxDeferredLaunches) {
+    launchDeferred();
+  }
+}
+
+void ur_queue_handle_t_::flushDeferredLaunches() {
+  if (!GraphCapture) {
+    return;
+  }
+  std::lock_guard<std::mutex> Lock(DeferredLaunchesMutex);
+  launchDeferred();
+}
+
+static bool haveSameShape(const std::vector<ur_deferred_launch_t_> &A,
+                          const std::vector<ur_deferred_launch_t_> &B) {
+  return A.size() == B.size() &&
+         std::equal(A.begin(), A.end(), B.begin(),
+                    [](const ur_deferred_launch_t_ &L,
+                       const ur_deferred_launch_t_ &R) {
+                      return L.hasSameShape(R);
+                    });
+}
+
+static CUDA_KERNEL_NODE_PARAMS
+getNodeParams(const ur_deferred_launch_t_ &Launch, std::vector<void *> &Args) {
+  Args.resize(Launch.ArgOffsets.size());
+  for (size_t i = 0; i < Args.size(); i++) {
+    Args[i] = const_cast<char *>(Launch.ArgData.data()) + Launch.ArgOffsets[i];
+  }
+  CUDA_KERNEL_NODE_PARAMS NodeParams = {};
+  NodeParams.func = Launch.Function;
+  NodeParams.gridDimX = Launch.GridDim[0];
+  NodeParams.gridDimY = Launch.GridDim[1];
+  NodeParams.gridDimZ = Launch.GridDim[2];
+  NodeParams.blockDimX = Launch.BlockDim[0];
+  NodeParams.blockDimY = Launch.BlockDim[1];
+  NodeParams.blockDimZ = Launch.BlockDim[2];
+  NodeParams.sharedMemBytes = Launch.LocalSize;
+  NodeParams.kernelParams = Args.data();
+  return NodeParams;
+}
+
+// Called with DeferredLaunchesMutex locked
+void ur_queue_handle_t_::launchDeferred() {
+  if (DeferredLaunches.empty()) {
+    return;
+  }
+  std::vector<ur_deferred_launch_t_> Launches;
+  Launches.swap(DeferredLaunches);
+  auto ReleaseKernels = [&Launches]() {
+    for (auto &Launch : Launches) {
+      ur::cuda::urKernelRelease(Launch.Kernel);
+      Launch.Kernel = nullptr;
+    }
+  };
+
+  try {
+    ScopedContext Active(Device);
+    CUstream Stream = nextComputeStream();
+    std::vector<void *> Args;
+    if (LaunchGraphExec && haveSameShape(Launches, GraphLaunches)) {
+      for (size_t i = 0; i < Launches.size(); i++) {
+        CUDA_KERNEL_NODE_PARAMS NodeParams = getNodeParams(Launches[i], Args);
+        UR_CHECK_ERROR(cuGraphExecKernelNodeSetParams(
+            LaunchGraphExec, LaunchGraphNodes[i], &NodeParams));
+      }
+      UR_CHECK_ERROR(cuGraphLaunch(LaunchGraphExec, Stream));
+    } else if (Launches.size() >= MinGraphLaunches &&
+               haveSameShape(Launches, LastLaunches)) {
+      buildLaunchGraph(Launches);
+      UR_CHECK_ERROR(cuGraphLaunch(LaunchGraphExec, Stream));
+    } else {
+      for (auto &Launch : Launches) {
+        getNodeParams(Launch, Args);
+        UR_CHECK_ERROR(cuLaunchKernel(
+            Launch.Function, Launch.GridDim[0], Launch.GridDim[1],
+            Launch.GridDim[2], Launch.BlockDim[0], Launch.BlockDim[1],
+            Launch.BlockDim[2], Launch.LocalSize, Stream, Args.data(),
+            nullptr));
+      }
+    }
+  } catch (...) {
+    ReleaseKernels();
+    throw;
+  }
+  ReleaseKernels();
+  LastLaunches = std::move(Launches);
+}
+
+void ur_queue_handle_t_::buildLaunchGraph(
+    const std::vector<ur_deferred_launch_t_> &Launches) {
+  destroyLaunchGraph();
+  UR_CHECK_ERROR(cuGraphCreate(&LaunchGraph, 0));
+
+  // The nodes run one after the other, as the launches on the stream would
+  std::vector<void *> Args;
+  for (auto &Launch : Launches) {
+    CUDA_KERNEL_NODE_PARAMS NodeParams = getNodeParams(Launch, Args);
+    CUgraphNode Node;
+    UR_CHECK_ERROR(cuGraphAddKernelNode(
+        &Node, LaunchGraph,
+        LaunchGraphNodes.empty() ? nullptr : &LaunchGraphNodes.back(),
+        LaunchGraphNodes.empty() ? 0 : 1, &NodeParams));
+    LaunchGraphNodes.push_back(Node);
+  }
+
+  const unsigned long long Flags = 0;
+#if CUDA_VERSION >= 12000
+  UR_CHECK_ERROR(cuGraphInstantiate(&LaunchGraphExec, LaunchGraph, Flags));
+#elif CUDA_VERSION >= 11040
+  UR_CHECK_ERROR(
+      cuGraphInstantiateWithFlags(&LaunchGraphExec, LaunchGraph, Flags));
+#else
+  UR_CHECK_ERROR(
+      cuGraphInstantiate(&LaunchGraphExec, LaunchGraph, nullptr, nullptr, 0));
+#endif
+
+  // A kernel of the graph mustn't be destroyed, and its function reused by
+  // another kernel, while the graph may be replayed
+  GraphLaunches = Launches;
+  for (auto &Launch : GraphLaunches) {
+    UR_CHECK_ERROR(ur::cuda::urKernelRetain(Launch.Kernel));
   }
 }
 
+void ur_queue_handle_t_::destroyLaunchGraph() {
+  if (LaunchGraphExec) {
+    cuGraphExecDestroy(LaunchGraphExec);
+    LaunchGraphExec = nullptr;
+  }
+  if (LaunchGraph) {
+    cuGraphDestroy(LaunchGraph);
+    LaunchGraph = nullptr;
+  }
+  LaunchGraphNodes.clear();
+  for (auto &Launch : GraphLaunches) {
+    ur::cuda::urKernelRelease(Launch.Kernel);
+  }
+  GraphLaunches.clear();
+}
+
 CUstream ur_queue_handle_t_::getNextComputeStream(uint32_t *StreamToken) {
   if (getThreadLocalStream() != CUstream{0})
     return getThreadLocalStream();
+  flushDeferredLaunches();
+  return nextComputeStream(StreamToken);
+}
+
+CUstream ur_queue_handle_t_::nextComputeStream(uint32_t *StreamToken) {
   uint32_t StreamI;
   uint32_t Token;
+  int IdleProbes = 0;
   while (true) {
     if (NumComputeStreams < ComputeStreams.size()) {
       // the check above is for performance - so as not to lock mutex every time
@@ -56,9 +236,17 @@ CUstream ur_queue_handle_t_::getNextComputeStream(uint32_t *StreamToken) {
     // that is more likely to have completed all the enqueued work.
     if (DelayCompute[StreamI]) {
       DelayCompute[StreamI] = false;
-    } else {
-      break;
+      continue;
+    }
+    // Independent commands run concurrently only on different streams, so
+    // a new stream is taken over one which is still running, within a few
+    // probes.
+    if (IdleProbes++ < MaxIdleComputeStreamProbes &&
+        NumComputeStreams >= ComputeStreams.size() &&
+        cuStreamQuery(ComputeStreams[StreamI]) == CUDA_ERROR_NOT_READY) {
+      continue;
     }
+    break;
   }
   if (StreamToken) {
     *StreamToken = Token;
@@ -73,36 +261,47 @@ CUstream ur_queue_handle_t_::getNextComputeStream(
     ur_stream_guard_ &Guard, uint32_t *StreamToken) {
   if (getThreadLocalStream() != CUstream{0})
     return getThreadLocalStream();
+  flushDeferredLaunches();
+  // The most recent dependency is the most likely to complete last, the
+  // command would wait for it on any other stream. The tokens wrap around.
+  ur_event_handle_t Latest = nullptr;
   for (uint32_t i = 0; i < NumEventsInWaitList; i++) {
     uint32_t Token = EventWaitList[i]->getComputeStreamToken();
     if (reinterpret_cast<ur_queue_handle_t>(EventWaitList[i]->getQueue()) ==
             this &&
-        canReuseStream(Token)) {
-      std::unique_lock<std::mutex> ComputeSyncGuard(ComputeStreamSyncMutex);
-      // redo the check after lock to avoid data races on
-      // LastSyncComputeStreams
-      if (canReuseStream(Token)) {
-        uint32_t StreamI = Token % DelayCompute.size();
-        DelayCompute[StreamI] = true;
-        if (StreamToken) {
-          *StreamToken = Token;
-        }
-        Guard = ur_stream_guard_{std::move(ComputeSyncGuard)};
-        CUstream Result = EventWaitList[i]->getStream();
-        computeStreamWaitForBarrierIfNeeded(Result, StreamI);
-        return Result;
+        canReuseStream(Token) &&
+        (!Latest || Token - Latest->getComputeStreamToken() <
+                        std::numeric_limits<uint32_t>::max() / 2)) {
+      Latest = EventWaitList[i];
+    }
+  }
+  if (Latest) {
+    uint32_t Token = Latest->getComputeStreamToken();
+    std::unique_lock<std::mutex> ComputeSyncGuard(ComputeStreamSyncMutex);
+    // redo the check after lock to avoid data races on
+    // LastSyncComputeStreams
+    if (canReuseStream(Token)) {
+      uint32_t StreamI = Token % DelayCompute.size();
+      DelayCompute[StreamI] = true;
+      if (StreamToken) {
+        *StreamToken = Token;
       }
+      Guard = ur_stream_guard_{std::move(ComputeSyncGuard)};
+      CUstream Result = Latest->getStream();
+      computeStreamWaitForBarrierIfNeeded(Result, StreamI);
+      return Result;
     }
   }
   Guard = {};
-  return getNextComputeStream(StreamToken);
+  return nextComputeStream(StreamToken);
 }
 
 CUstream ur_queue_handle_t_::getNextTransferStream() {
   if (getThreadLocalStream() != CUstream{0})
     return getThreadLocalStream();
+  flushDeferredLaunches();
   if (TransferStreams.empty()) { // for example in in-order queue
-    return getNextComputeStream();
+    return nextComputeStream();
   }
   if (NumTransferStreams < TransferStreams.size()) {
     // the check above is for performance - so as not to lock mutex every time
@@ -121,13 +320,16 @@ CUstream ur_queue_handle_t_::getNextTransferStream() {
   return Result;
 }
 
+namespace ur::cuda {
+
 /// Creates a `ur_queue_handle_t` object on the CUDA backend.
 /// Valid properties
 /// * __SYCL_PI_CUDA_USE_DEFAULT_STREAM -> CU_STREAM_DEFAULT
 /// * __SYCL_PI_CUDA_SYNC_WITH_DEFAULT -> CU_STREAM_NON_BLOCKING
-UR_APIEXPORT ur_result_t UR_APICALL
-urQueueCreate(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-              const ur_queue_properties_t *pProps, ur_queue_handle_t *phQueue) {
+ur_result_t urQueueCreate(ur_context_handle_t hContext,
+                          ur_device_handle_t hDevice,
+                          const ur_queue_properties_t *pProps,
+                          ur_queue_handle_t *phQueue) {
   try {
     std::unique_ptr<ur_queue_handle_t_> Queue{nullptr};
 
@@ -162,15 +364,33 @@ urQueueCreate(ur_context_handle_t hContext, ur_device_handle_t hDevice,
       }
     }
 
-    std::vector<CUstream> ComputeCuStreams(
-        IsOutOfOrder ? ur_queue_handle_t_::DefaultNumComputeStreams : 1);
-    std::vector<CUstream> TransferCuStreams(
-        IsOutOfOrder ? ur_queue_handle_t_::DefaultNumTransferStreams : 0);
+    unsigned int NumComputeStreams =
+        IsOutOfOrder ? ur_queue_handle_t_::DefaultNumComputeStreams : 1;
+    unsigned int NumTransferStreams =
+        IsOutOfOrder ? ur_queue_handle_t_::DefaultNumTransferStreams : 0;
+    // In the QoS mode the bulk queues take few streams at a low priority,
+    // leaving the other hardware queues of the device to the latency critical
+    // ones
+    if (unsigned int MaxStreams = ur_queue_handle_t_::getBulkQueueMaxStreams();
+        MaxStreams && !(URFlags & UR_QUEUE_FLAG_PRIORITY_HIGH)) {
+      NumComputeStreams = std::min(NumComputeStreams, MaxStreams);
+      NumTransferStreams = std::min(NumTransferStreams, MaxStreams);
+      if (!(URFlags & UR_QUEUE_FLAG_PRIORITY_LOW)) {
+        ScopedContext Active(hDevice);
+        UR_CHECK_ERROR(cuCtxGetStreamPriorityRange(&Priority, nullptr));
+      }
+    }
+
+    std::vector<CUstream> ComputeCuStreams(NumComputeStreams);
+    std::vector<CUstream> TransferCuStreams(NumTransferStreams);
 
     Queue = std::unique_ptr<ur_queue_handle_t_>(new ur_queue_handle_t_{
         std::move(ComputeCuStreams), std::move(TransferCuStreams), hContext,
         hDevice, Flags, URFlags, Priority});
+    Queue->GraphCapture =
+        !IsOutOfOrder && ur_queue_handle_t_::isGraphCaptureEnabled();
 
+    hContext->addQueue(Queue.get());
     *phQueue = Queue.release();
 
     return UR_RESULT_SUCCESS;
@@ -183,20 +403,22 @@ urQueueCreate(ur_context_handle_t hContext, ur_device_handle_t hDevice,
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueRetain(ur_queue_handle_t hQueue) {
+ur_result_t urQueueRetain(ur_queue_handle_t hQueue) {
   assert(hQueue->getReferenceCount() > 0);
 
   hQueue->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueRelease(ur_queue_handle_t hQueue) {
+ur_result_t urQueueRelease(ur_queue_handle_t hQueue) {
   if (hQueue->decrementReferenceCount() > 0) {
     return UR_RESULT_SUCCESS;
   }
 
   try {
     std::unique_ptr<ur_queue_handle_t_> Queue(hQueue);
+    // Before its streams are destroyed, for the deferred frees
+    hQueue->getContext()->removeQueue(hQueue);
 
     if (!hQueue->backendHasOwnership())
       return UR_RESULT_SUCCESS;
@@ -221,11 +443,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueRelease(ur_queue_handle_t hQueue) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
+ur_result_t urQueueFinish(ur_queue_handle_t hQueue) {
+  TRACK_SCOPE_LATENCY("urQueueFinish");
   ur_result_t Result = UR_RESULT_SUCCESS;
 
   try {
     ScopedContext active(hQueue->getDevice());
+    ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
 
     hQueue->syncStreams</*ResetUsed=*/true>(
         [](CUstream s) { UR_CHECK_ERROR(cuStreamSynchronize(s)); });
@@ -244,15 +468,91 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
 
 // There is no CUDA counterpart for queue flushing and we don't run into the
 // same problem of having to flush cross-queue dependencies as some of the
-// other plugins, so it can be left as no-op.
-UR_APIEXPORT ur_result_t UR_APICALL urQueueFlush(ur_queue_handle_t hQueue) {
-  std::ignore = hQueue;
+// other plugins, so only the kernel launches held back by the graph capture
+// need to be launched.
+ur_result_t urQueueFlush(ur_queue_handle_t hQueue) {
+  try {
+    hQueue->flushDeferredLaunches();
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urQueueReserveTimestampMarkersExp(ur_queue_handle_t hQueue,
+                                              uint32_t capacity) {
+  UR_ASSERT(capacity > 0, UR_RESULT_ERROR_INVALID_SIZE);
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    std::lock_guard<std::mutex> Guard(hQueue->TimestampMarkersMutex);
+    if (hQueue->TimestampMarkers) {
+      return UR_RESULT_ERROR_INVALID_OPERATION;
+    }
+    // The events created before a failure are kept for the next attempt,
+    // and destroyed along with the queue
+    auto &Events = hQueue->TimestampMarkerEvents;
+    Events.reserve(capacity);
+    while (Events.size() < capacity) {
+      CUevent Event;
+      UR_CHECK_ERROR(cuEventCreate(&Event, CU_EVENT_DEFAULT));
+      Events.push_back(Event);
+    }
+    hQueue->TimestampMarkers.emplace(capacity);
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urQueueReadTimestampMarkersExp(ur_queue_handle_t hQueue,
+                                           uint64_t firstMarker, uint32_t count,
+                                           uint64_t *pTimestamps) {
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    std::unique_lock<std::mutex> Guard(hQueue->TimestampMarkersMutex);
+    auto &Markers = hQueue->TimestampMarkers;
+    if (!Markers) {
+      return UR_RESULT_ERROR_INVALID_OPERATION;
+    }
+    ur_result_t Result = Markers->checkRange(firstMarker, count);
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+    std::vector<CUevent> Events(count);
+    for (uint32_t i = 0; i < count; i++) {
+      Events[i] = hQueue->TimestampMarkerEvents[Markers->slot(firstMarker + i)];
+    }
+
+    // The events are waited for without the lock, the markers enqueued
+    // meanwhile may record them again, which the second check catches
+    Guard.unlock();
+    {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
+      for (CUevent Event : Events) {
+        UR_CHECK_ERROR(cuEventSynchronize(Event));
+      }
+    }
+    Guard.lock();
+    Result = Markers->checkRange(firstMarker, count);
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+      pTimestamps[i] = hQueue->getDevice()->getElapsedTime(Events[i]);
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urQueueGetNativeHandle(ur_queue_handle_t hQueue, ur_queue_native_desc_t *pDesc,
-                       ur_native_handle_t *phNativeQueue) {
+ur_result_t urQueueGetNativeHandle(ur_queue_handle_t hQueue,
+                                   ur_queue_native_desc_t *pDesc,
+                                   ur_native_handle_t *phNativeQueue) {
   std::ignore = pDesc;
 
   ScopedContext Active(hQueue->getDevice());
@@ -261,7 +561,7 @@ urQueueGetNativeHandle(ur_queue_handle_t hQueue, ur_queue_native_desc_t *pDesc,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
+ur_result_t urQueueCreateWithNativeHandle(
     ur_native_handle_t hNativeQueue, ur_context_handle_t hContext,
     ur_device_handle_t hDevice, const ur_queue_native_properties_t *pProperties,
     ur_queue_handle_t *phQueue) {
@@ -296,15 +596,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
                              /*priority*/ 0,
                              /*backend_owns*/ pProperties->isNativeHandleOwned};
   (*phQueue)->NumComputeStreams = 1;
+  hContext->addQueue(*phQueue);
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
-                                                   ur_queue_info_t propName,
-                                                   size_t propValueSize,
-                                                   void *pPropValue,
-                                                   size_t *pPropSizeRet) {
+ur_result_t urQueueGetInfo(ur_queue_handle_t hQueue, ur_queue_info_t propName,
+                           size_t propValueSize, void *pPropValue,
+                           size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propValueSize, pPropValue, pPropSizeRet);
 
   switch (propName) {
@@ -336,6 +635,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
       return UR_RESULT_ERROR_OUT_OF_RESOURCES;
     }
   }
+  case UR_QUEUE_INFO_COMMAND_COUNTS:
+  case UR_QUEUE_INFO_BYTES_COPIED:
+  case UR_QUEUE_INFO_BATCH_COUNT:
+  case UR_QUEUE_INFO_AVERAGE_BATCH_SIZE:
+  case UR_QUEUE_INFO_HOST_WAIT_TIME:
+  case UR_QUEUE_INFO_CREATED_EVENT_COUNT:
+    return hQueue->Telemetry.getInfo(propName, ReturnValue);
   case UR_QUEUE_INFO_DEVICE_DEFAULT:
   case UR_QUEUE_INFO_SIZE:
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
@@ -343,3 +649,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
     return UR_RESULT_ERROR_INVALID_ENUMERATION;
   }
 }
+} // namespace ur::cuda
@@ -10,15 +10,44 @@
 #pragma once
 
 #include "common.hpp"
+#include "ur_queue_telemetry.hpp"
+#include "ur_timestamp_markers.hpp"
+#include "ur_interface_loader.hpp"
 #include <ur/ur.hpp>
 
 #include <algorithm>
 #include <cuda.h>
 #include <mutex>
+#include <optional>
 #include <vector>
 
 using ur_stream_guard_ = std::unique_lock<std::mutex>;
 
+/// A kernel launch held back by the graph capture of a queue, with a copy
+/// of the arguments it was enqueued with, as the kernel arguments can be set
+/// again before it is launched.
+struct ur_deferred_launch_t_ {
+  ur_kernel_handle_t Kernel;
+  CUfunction Function;
+  unsigned int GridDim[3];
+  unsigned int BlockDim[3];
+  uint32_t LocalSize;
+  std::vector<char> ArgData;
+  // The offset in ArgData of each of the kernel parameters
+  std::vector<size_t> ArgOffsets;
+
+  // Whether the launches could be nodes of the same graph, differing only in
+  // the values of their arguments
+  bool hasSameShape(const ur_deferred_launch_t_ &Other) const {
+    return Function == Other.Function &&
+           std::equal(GridDim, GridDim + 3, Other.GridDim) &&
+           std::equal(BlockDim, BlockDim + 3, Other.BlockDim) &&
+           LocalSize == Other.LocalSize &&
+           ArgData.size() == Other.ArgData.size() &&
+           ArgOffsets == Other.ArgOffsets;
+  }
+};
+
 /// UR queue mapping on to CUstream objects.
 ///
 struct ur_queue_handle_t_ {
@@ -26,6 +55,13 @@ struct ur_queue_handle_t_ {
   using native_type = CUstream;
   static constexpr int DefaultNumComputeStreams = 128;
   static constexpr int DefaultNumTransferStreams = 64;
+  // The number of streams of each pool the queues without
+  // UR_QUEUE_FLAG_PRIORITY_HIGH create at most, 0 (the default) for no limit.
+  // Set with UR_CUDA_BULK_QUEUE_MAX_STREAMS. The streams of all the queues
+  // share the hardware queues of the device, so limiting the bulk queues
+  // keeps some for the latency critical ones. The bulk queues without a
+  // priority flag then get the low priority.
+  static unsigned int getBulkQueueMaxStreams();
 
   std::vector<native_type> ComputeStreams;
   std::vector<native_type> TransferStreams;
@@ -36,11 +72,16 @@ struct ur_queue_handle_t_ {
   // delay_compute_ keeps track of which streams have been recently reused and
   // their next use should be delayed. If a stream has been recently reused it
   // will be skipped the next time it would be selected round-robin style. When
-  // skipped, its delay flag is cleared.
-  std::vector<bool> DelayCompute;
-  // keep track of which streams have applied barrier
-  std::vector<bool> ComputeAppliedBarrier;
-  std::vector<bool> TransferAppliedBarrier;
+  // skipped, its delay flag is cleared. The flags are atomic as the streams
+  // are selected without locking.
+  std::vector<std::atomic_bool> DelayCompute;
+  // Every barrier bumps BarrierEpoch once BarrierEvent is recorded, and each
+  // stream keeps the epoch of the last barrier it waits for, so a barrier
+  // doesn't have to visit the streams and the ones which already wait for
+  // the last barrier are returned without a CUDA call
+  std::atomic_uint32_t BarrierEpoch{0};
+  std::vector<std::atomic_uint32_t> ComputeBarrierEpochs;
+  std::vector<std::atomic_uint32_t> TransferBarrierEpochs;
   ur_context_handle_t_ *Context;
   ur_device_handle_t_ *Device;
   CUevent BarrierEvent = nullptr;
@@ -64,6 +105,17 @@ struct ur_queue_handle_t_ {
   std::mutex TransferStreamMutex;
   std::mutex BarrierMutex;
   bool HasOwnership;
+  // Whether kernel launches are held back to be replayed as a graph once the
+  // same sequence is submitted again, see deferKernelLaunch
+  bool GraphCapture = false;
+  // The counters of the telemetry queries of urQueueGetInfo, every command
+  // is submitted to a stream on its own so each one counts as a batch
+  ur::queue_telemetry_t Telemetry;
+  // The ring of urQueueReserveTimestampMarkersExp, each marker recording the
+  // timing event of its slot
+  std::mutex TimestampMarkersMutex;
+  std::optional<ur::timestamp_markers_t> TimestampMarkers;
+  std::vector<CUevent> TimestampMarkerEvents;
 
   ur_queue_handle_t_(std::vector<CUstream> &&ComputeStreams,
                      std::vector<CUstream> &&TransferStreams,
@@ -72,31 +124,62 @@ struct ur_queue_handle_t_ {
                      bool BackendOwns = true)
       : ComputeStreams{std::move(ComputeStreams)}, TransferStreams{std::move(
                                                        TransferStreams)},
-        DelayCompute(this->ComputeStreams.size(), false),
-        ComputeAppliedBarrier(this->ComputeStreams.size()),
-        TransferAppliedBarrier(this->TransferStreams.size()), Context{Context},
+        DelayCompute(this->ComputeStreams.size()),
+        ComputeBarrierEpochs(this->ComputeStreams.size()),
+        TransferBarrierEpochs(this->TransferStreams.size()), Context{Context},
         Device{Device}, RefCount{1}, EventCount{0}, ComputeStreamIndex{0},
         TransferStreamIndex{0}, NumComputeStreams{0}, NumTransferStreams{0},
         LastSyncComputeStreams{0}, LastSyncTransferStreams{0}, Flags(Flags),
         URFlags(URFlags), Priority(Priority), HasOwnership{BackendOwns} {
-    urContextRetain(Context);
-    urDeviceRetain(Device);
+    ur::cuda::urContextRetain(Context);
+    ur::cuda::urDeviceRetain(Device);
   }
 
   ~ur_queue_handle_t_() {
-    urContextRelease(Context);
-    urDeviceRelease(Device);
+    destroyLaunchGraph();
+    for (CUevent Event : TimestampMarkerEvents) {
+      cuEventDestroy(Event);
+    }
+    ur::cuda::urContextRelease(Context);
+    ur::cuda::urDeviceRelease(Device);
   }
 
+  // Whether UR_CUDA_GRAPH_CAPTURE turns on the graph capture of the in-order
+  // queues
+  static bool isGraphCaptureEnabled();
+
+  // The number of launches the graph capture holds back at most, launching
+  // them as a sequence once reached
+  static constexpr size_t MaxDeferredLaunches = 64;
+  // The length of the shortest sequence worth capturing into a graph
+  static constexpr size_t MinGraphLaunches = 2;
+
+  // Holds back a kernel launch which has no dependencies and no event, for
+  // the graph capture. The held back launches are launched as a sequence
+  // before anything else is submitted to the queue or waits on it. If the
+  // sequence has the same shape as the previous one, it is captured into a
+  // graph, replayed, with the arguments updated, by the next sequences of
+  // the same shape.
+  void deferKernelLaunch(ur_deferred_launch_t_ &&Launch);
+  // Launches the launches held back, called by all the stream getters
+  void flushDeferredLaunches();
+
   void computeStreamWaitForBarrierIfNeeded(CUstream Strean, uint32_t StreamI);
   void transferStreamWaitForBarrierIfNeeded(CUstream Stream, uint32_t StreamI);
 
+  // The number of streams getNextComputeStream checks for pending work before
+  // settling for a busy one
+  static constexpr int MaxIdleComputeStreamProbes = 2;
+
   // get_next_compute/transfer_stream() functions return streams from
-  // appropriate pools in round-robin fashion
+  // appropriate pools in round-robin fashion, compute streams which are busy
+  // being skipped in favour of idle ones
   native_type getNextComputeStream(uint32_t *StreamToken = nullptr);
-  // this overload tries select a stream that was used by one of dependencies.
-  // If that is not possible returns a new stream. If a stream is reused it
-  // returns a lock that needs to remain locked as long as the stream is in use
+  // this overload tries select the stream of the most recent of the
+  // dependencies, so that its commands don't have to wait for it across
+  // streams. If that is not possible returns a new stream. If a stream is
+  // reused it returns a lock that needs to remain locked as long as the stream
+  // is in use
   native_type getNextComputeStream(uint32_t NumEventsInWaitList,
                                    const ur_event_handle_t *EventWaitList,
                                    ur_stream_guard_ &Guard,
@@ -155,6 +238,7 @@ struct ur_queue_handle_t_ {
   }
 
   template <typename T> bool allOf(T &&F) {
+    flushDeferredLaunches();
     {
       std::lock_guard<std::mutex> ComputeGuard(ComputeStreamMutex);
       unsigned int End = std::min(
@@ -175,6 +259,7 @@ struct ur_queue_handle_t_ {
   }
 
   template <typename T> void forEachStream(T &&F) {
+    flushDeferredLaunches();
     {
       std::lock_guard<std::mutex> compute_guard(ComputeStreamMutex);
       unsigned int End = std::min(
@@ -195,6 +280,7 @@ struct ur_queue_handle_t_ {
   }
 
   template <bool ResetUsed = false, typename T> void syncStreams(T &&F) {
+    flushDeferredLaunches();
     auto SyncCompute = [&F, &Streams = ComputeStreams, &Delay = DelayCompute](
                            unsigned int Start, unsigned int Stop) {
       for (unsigned int i = Start; i < Stop; i++) {
@@ -271,6 +357,28 @@ struct ur_queue_handle_t_ {
   uint32_t getNextEventID() noexcept { return ++EventCount; }
 
   bool backendHasOwnership() const noexcept { return HasOwnership; }
+
+  // Whether the commands run one after the other on a single stream, which
+  // orders them without any event
+  bool isInOrder() const noexcept {
+    return ComputeStreams.size() == 1 && TransferStreams.empty();
+  }
+
+private:
+  native_type nextComputeStream(uint32_t *StreamToken = nullptr);
+  void launchDeferred();
+  void buildLaunchGraph(const std::vector<ur_deferred_launch_t_> &Launches);
+  void destroyLaunchGraph();
+
+  std::mutex DeferredLaunchesMutex;
+  std::vector<ur_deferred_launch_t_> DeferredLaunches;
+  // The shape of the last sequence launched, its kernels aren't retained
+  std::vector<ur_deferred_launch_t_> LastLaunches;
+  // The sequence the graph was built from, retaining its kernels
+  std::vector<ur_deferred_launch_t_> GraphLaunches;
+  std::vector<CUgraphNode> LaunchGraphNodes;
+  CUgraph LaunchGraph = nullptr;
+  CUgraphExec LaunchGraphExec = nullptr;
 };
 
 // RAII object to make hQueue stream getter methods all return the same stream
@@ -10,10 +10,13 @@
 
 #include "sampler.hpp"
 #include "common.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urSamplerCreate(ur_context_handle_t hContext, const ur_sampler_desc_t *pDesc,
-                ur_sampler_handle_t *phSampler) {
+namespace ur::cuda {
+
+ur_result_t urSamplerCreate(ur_context_handle_t hContext,
+                            const ur_sampler_desc_t *pDesc,
+                            ur_sampler_handle_t *phSampler) {
   try {
     std::unique_ptr<ur_sampler_handle_t_> Sampler{
         new ur_sampler_handle_t_(hContext)};
@@ -66,9 +69,9 @@ urSamplerCreate(ur_context_handle_t hContext, const ur_sampler_desc_t *pDesc,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urSamplerGetInfo(ur_sampler_handle_t hSampler, ur_sampler_info_t propName,
-                 size_t propValueSize, void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urSamplerGetInfo(ur_sampler_handle_t hSampler,
+                             ur_sampler_info_t propName, size_t propValueSize,
+                             void *pPropValue, size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propValueSize, pPropValue, pPropSizeRet);
 
   switch (propName) {
@@ -93,14 +96,12 @@ urSamplerGetInfo(ur_sampler_handle_t hSampler, ur_sampler_info_t propName,
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urSamplerRetain(ur_sampler_handle_t hSampler) {
+ur_result_t urSamplerRetain(ur_sampler_handle_t hSampler) {
   hSampler->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urSamplerRelease(ur_sampler_handle_t hSampler) {
+ur_result_t urSamplerRelease(ur_sampler_handle_t hSampler) {
   // double delete or someone is messing with the ref count.
   // either way, cannot safely proceed.
   detail::ur::assertion(
@@ -115,13 +116,15 @@ urSamplerRelease(ur_sampler_handle_t hSampler) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urSamplerGetNativeHandle(ur_sampler_handle_t, ur_native_handle_t *) {
+ur_result_t urSamplerGetNativeHandle(ur_sampler_handle_t,
+                                     ur_native_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
-    ur_native_handle_t, ur_context_handle_t,
-    const ur_sampler_native_properties_t *, ur_sampler_handle_t *) {
+ur_result_t
+urSamplerCreateWithNativeHandle(ur_native_handle_t, ur_context_handle_t,
+                                const ur_sampler_native_properties_t *,
+                                ur_sampler_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+} // namespace ur::cuda
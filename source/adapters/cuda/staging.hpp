@@ -0,0 +1,69 @@
+//===--------- staging.hpp - CUDA Adapter ---------------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cuda.h>
+#include <ur_api.h>
+
+#include <mutex>
+#include <vector>
+
+/// A pool of pinned host chunks, through which the copies between pageable
+/// host memory and the device are staged. From pageable memory the driver
+/// copies synchronously, through its own staging buffers, while the copy of
+/// a chunk is asynchronous: the host side of a staged copy is done by host
+/// functions on the streams, so the enqueue returns right away and the copy
+/// of a chunk overlaps with the DMA of the other one.
+///
+/// The pool holds UR_CUDA_STAGING_POOL_SIZE bytes at most, 64 MiB by
+/// default, 0 disables the staging.
+struct ur_staging_pool_t_ {
+  static constexpr size_t ChunkSize = 4 * 1024 * 1024;
+  // Smaller copies don't gain much from overlapping their host copy
+  static constexpr size_t MinStagedSize = 1024 * 1024;
+
+  ur_staging_pool_t_();
+  ~ur_staging_pool_t_();
+
+  bool enabled() const noexcept { return MaxChunks != 0; }
+
+  // Takes a free chunk, allocating it if the pool has room, nullptr if the
+  // pool is exhausted
+  void *acquire();
+
+  // Gives a chunk back to the pool, called from host functions, so it must
+  // not call into CUDA
+  void release(void *Chunk);
+
+private:
+  const size_t MaxChunks;
+  std::mutex Mutex;
+  std::vector<void *> Chunks;
+  std::vector<void *> FreeChunks;
+  // The context current when the chunks were allocated
+  CUcontext Owner = nullptr;
+};
+
+// Copies Size bytes from host memory to the device, ordered on Stream,
+// staging pageable memory through the pinned chunks of the context when it
+// can and with a plain asynchronous copy otherwise
+void enqueueCopyHtoD(ur_queue_handle_t hQueue, CUstream Stream,
+                     CUdeviceptr Dst, const void *Src, size_t Size);
+
+// Copies Size bytes from the device to host memory, ordered on Stream, like
+// enqueueCopyHtoD
+void enqueueCopyDtoH(ur_queue_handle_t hQueue, CUstream Stream, void *Dst,
+                     CUdeviceptr Src, size_t Size);
+
+// Copies between any two USM or host pointers, ordered on Stream, through
+// enqueueCopyHtoD and enqueueCopyDtoH when one of them is pageable memory
+// and the other one device memory
+void enqueueCopy(ur_queue_handle_t hQueue, CUstream Stream, void *Dst,
+                 const void *Src, size_t Size);
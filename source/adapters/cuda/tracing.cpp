@@ -20,6 +20,7 @@
 
 #include "tracing.hpp"
 #include "ur_lib_loader.hpp"
+#include <cstdlib>
 #include <exception>
 #include <iostream>
 
@@ -42,6 +43,21 @@ using cuptiEnableCallback_fn =
     CUptiResult(CUPTIAPI *)(uint32_t enable, CUpti_SubscriberHandle subscriber,
                             CUpti_CallbackDomain domain, CUpti_CallbackId cbid);
 
+using cuptiActivityEnable_fn = CUptiResult(CUPTIAPI *)(CUpti_ActivityKind kind);
+
+using cuptiActivityDisable_fn =
+    CUptiResult(CUPTIAPI *)(CUpti_ActivityKind kind);
+
+using cuptiActivityRegisterCallbacks_fn = CUptiResult(CUPTIAPI *)(
+    CUpti_BuffersCallbackRequestFunc funcBufferRequested,
+    CUpti_BuffersCallbackCompleteFunc funcBufferCompleted);
+
+using cuptiActivityGetNextRecord_fn =
+    CUptiResult(CUPTIAPI *)(uint8_t *buffer, size_t validBufferSizeBytes,
+                            CUpti_Activity **record);
+
+using cuptiActivityFlushAll_fn = CUptiResult(CUPTIAPI *)(uint32_t flag);
+
 #define LOAD_CUPTI_SYM(p, lib, x)                                              \
   p.x = (cupti##x##_fn)ur_loader::LibLoader::getFunctionPtr(lib.get(),         \
                                                             "cupti" #x);
@@ -53,6 +69,11 @@ using cuptiSubscribe_fn = void *;
 using cuptiUnsubscribe_fn = void *;
 using cuptiEnableDomain_fn = void *;
 using cuptiEnableCallback_fn = void *;
+using cuptiActivityEnable_fn = void *;
+using cuptiActivityDisable_fn = void *;
+using cuptiActivityRegisterCallbacks_fn = void *;
+using cuptiActivityGetNextRecord_fn = void *;
+using cuptiActivityFlushAll_fn = void *;
 #endif // XPTI_ENABLE_INSTRUMENTATION
 
 struct cupti_table_t_ {
@@ -60,13 +81,29 @@ struct cupti_table_t_ {
   cuptiUnsubscribe_fn Unsubscribe = nullptr;
   cuptiEnableDomain_fn EnableDomain = nullptr;
   cuptiEnableCallback_fn EnableCallback = nullptr;
+  // The Activity API, for the activity mode
+  cuptiActivityEnable_fn ActivityEnable = nullptr;
+  cuptiActivityDisable_fn ActivityDisable = nullptr;
+  cuptiActivityRegisterCallbacks_fn ActivityRegisterCallbacks = nullptr;
+  cuptiActivityGetNextRecord_fn ActivityGetNextRecord = nullptr;
+  cuptiActivityFlushAll_fn ActivityFlushAll = nullptr;
 
   bool isInitialized() const;
+  bool isActivityInitialized() const;
 };
 
+/// In the activity mode, set with UR_CUDA_TRACING_ACTIVITY=1, the driver API
+/// calls aren't traced: CUPTI records the kernels, copies and fills run on
+/// the devices in buffers, and the records of a buffer are only notified to
+/// the subscribers of the activity stream, from a CUPTI thread, once it is
+/// full or flushed. Each record is notified as a task, its begin and end
+/// carrying the CUpti_Activity itself, with the device timestamps of the
+/// work, so the submitting threads don't pay for the tracing.
 struct cuda_tracing_context_t_ {
   tracing_event_t CallEvent = nullptr;
   tracing_event_t DebugEvent = nullptr;
+  tracing_event_t ActivityEvent = nullptr;
+  bool ActivityMode = false;
   subscriber_handle_t Subscriber = nullptr;
   ur_loader::LibLoader::Lib Library;
   cupti_table_t_ Cupti;
@@ -75,6 +112,16 @@ struct cuda_tracing_context_t_ {
 #ifdef XPTI_ENABLE_INSTRUMENTATION
 constexpr auto CUDA_CALL_STREAM_NAME = "sycl.experimental.cuda.call";
 constexpr auto CUDA_DEBUG_STREAM_NAME = "sycl.experimental.cuda.debug";
+constexpr auto CUDA_ACTIVITY_STREAM_NAME = "sycl.experimental.cuda.activity";
+
+// The activity kinds of the activity mode
+constexpr CUpti_ActivityKind ActivityKinds[] = {
+    CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL, CUPTI_ACTIVITY_KIND_MEMCPY,
+    CUPTI_ACTIVITY_KIND_MEMSET};
+constexpr size_t ActivityBufferSize = 1024 * 1024;
+
+// The buffer callbacks of CUPTI have no user data
+static cuda_tracing_context_t_ *ActivityContext = nullptr;
 
 thread_local uint64_t CallCorrelationID = 0;
 thread_local uint64_t DebugCorrelationID = 0;
@@ -117,6 +164,33 @@ static void cuptiCallback(void *UserData, CUpti_CallbackDomain,
                           nullptr, DebugCorrelationID, &Payload);
   }
 }
+
+static void CUPTIAPI activityBufferRequested(uint8_t **Buffer, size_t *Size,
+                                             size_t *MaxNumRecords) {
+  // malloc aligns enough for the records
+  *Buffer = static_cast<uint8_t *>(std::malloc(ActivityBufferSize));
+  *Size = *Buffer ? ActivityBufferSize : 0;
+  *MaxNumRecords = 0;
+}
+
+static void CUPTIAPI activityBufferCompleted(CUcontext, uint32_t,
+                                             uint8_t *Buffer, size_t,
+                                             size_t ValidSize) {
+  cuda_tracing_context_t_ *Ctx = ActivityContext;
+  if (Ctx && ValidSize && xptiTraceEnabled()) {
+    uint8_t ActivityStreamID = xptiRegisterStream(CUDA_ACTIVITY_STREAM_NAME);
+    CUpti_Activity *Record = nullptr;
+    while (Ctx->Cupti.ActivityGetNextRecord(Buffer, ValidSize, &Record) ==
+           CUPTI_SUCCESS) {
+      uint64_t ActivityID = xptiGetUniqueId();
+      xptiNotifySubscribers(ActivityStreamID, xpti::trace_task_begin,
+                            Ctx->ActivityEvent, nullptr, ActivityID, Record);
+      xptiNotifySubscribers(ActivityStreamID, xpti::trace_task_end,
+                            Ctx->ActivityEvent, nullptr, ActivityID, Record);
+    }
+  }
+  std::free(Buffer);
+}
 #endif
 
 cuda_tracing_context_t_ *createCUDATracingContext() {
@@ -142,6 +216,11 @@ bool cupti_table_t_::isInitialized() const {
   return Subscribe && Unsubscribe && EnableDomain && EnableCallback;
 }
 
+bool cupti_table_t_::isActivityInitialized() const {
+  return ActivityEnable && ActivityDisable && ActivityRegisterCallbacks &&
+         ActivityGetNextRecord && ActivityFlushAll;
+}
+
 bool loadCUDATracingLibrary(cuda_tracing_context_t_ *Ctx) {
 #if defined(XPTI_ENABLE_INSTRUMENTATION) && defined(CUPTI_LIB_PATH)
   if (!Ctx)
@@ -156,6 +235,11 @@ bool loadCUDATracingLibrary(cuda_tracing_context_t_ *Ctx) {
   LOAD_CUPTI_SYM(Table, Lib, Unsubscribe)
   LOAD_CUPTI_SYM(Table, Lib, EnableDomain)
   LOAD_CUPTI_SYM(Table, Lib, EnableCallback)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityEnable)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityDisable)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityRegisterCallbacks)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityGetNextRecord)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityFlushAll)
   if (!Table.isInitialized()) {
     return false;
   }
@@ -186,6 +270,27 @@ void enableCUDATracing(cuda_tracing_context_t_ *Ctx) {
   else if (!loadCUDATracingLibrary(Ctx))
     return;
 
+  if (const char *Activity = std::getenv("UR_CUDA_TRACING_ACTIVITY");
+      Activity && std::atoi(Activity) && Ctx->Cupti.isActivityInitialized()) {
+    xptiRegisterStream(CUDA_ACTIVITY_STREAM_NAME);
+    xptiInitialize(CUDA_ACTIVITY_STREAM_NAME, GMajVer, GMinVer, GVerStr);
+
+    uint64_t Dummy;
+    xpti::payload_t CUDAActivityPayload("CUDA Plugin Activity Layer");
+    Ctx->ActivityEvent =
+        xptiMakeEvent("CUDA Plugin Activity Layer", &CUDAActivityPayload,
+                      xpti::trace_algorithm_event, xpti_at::active, &Dummy);
+
+    ActivityContext = Ctx;
+    Ctx->ActivityMode = true;
+    Ctx->Cupti.ActivityRegisterCallbacks(activityBufferRequested,
+                                         activityBufferCompleted);
+    for (CUpti_ActivityKind Kind : ActivityKinds) {
+      Ctx->Cupti.ActivityEnable(Kind);
+    }
+    return;
+  }
+
   xptiRegisterStream(CUDA_CALL_STREAM_NAME);
   xptiInitialize(CUDA_CALL_STREAM_NAME, GMajVer, GMinVer, GVerStr);
   xptiRegisterStream(CUDA_DEBUG_STREAM_NAME);
@@ -218,6 +323,18 @@ void disableCUDATracing(cuda_tracing_context_t_ *Ctx) {
   if (!Ctx || !xptiTraceEnabled())
     return;
 
+  if (Ctx->ActivityMode) {
+    for (CUpti_ActivityKind Kind : ActivityKinds) {
+      Ctx->Cupti.ActivityDisable(Kind);
+    }
+    // Notifies the records still in the buffers
+    Ctx->Cupti.ActivityFlushAll(CUPTI_ACTIVITY_FLAG_FLUSH_FORCED);
+    ActivityContext = nullptr;
+    Ctx->ActivityMode = false;
+    xptiFinalize(CUDA_ACTIVITY_STREAM_NAME);
+    return;
+  }
+
   if (Ctx->Subscriber && Ctx->Cupti.isInitialized()) {
     Ctx->Cupti.Unsubscribe(Ctx->Subscriber);
     Ctx->Subscriber = nullptr;
@@ -11,6 +11,8 @@
 #include <ur_api.h>
 #include <ur_ddi.h>
 
+#include "ur_interface_loader.hpp"
+
 namespace {
 
 // TODO - this is a duplicate of what is in the L0 plugin
@@ -28,7 +30,9 @@ ur_result_t validateProcInputs(ur_api_version_t version, void *pDdiTable) {
 }
 } // namespace
 
-#if defined(__cplusplus)
+#ifdef UR_STATIC_ADAPTER_CUDA
+namespace ur::cuda {
+#elif defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -39,11 +43,11 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
     return result;
   }
   pDdiTable->pfnCreateWithNativeHandle = nullptr;
-  pDdiTable->pfnGet = urPlatformGet;
-  pDdiTable->pfnGetApiVersion = urPlatformGetApiVersion;
-  pDdiTable->pfnGetInfo = urPlatformGetInfo;
-  pDdiTable->pfnGetNativeHandle = urPlatformGetNativeHandle;
-  pDdiTable->pfnGetBackendOption = urPlatformGetBackendOption;
+  pDdiTable->pfnGet = ur::cuda::urPlatformGet;
+  pDdiTable->pfnGetApiVersion = ur::cuda::urPlatformGetApiVersion;
+  pDdiTable->pfnGetInfo = ur::cuda::urPlatformGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::cuda::urPlatformGetNativeHandle;
+  pDdiTable->pfnGetBackendOption = ur::cuda::urPlatformGetBackendOption;
   return UR_RESULT_SUCCESS;
 }
 
@@ -53,13 +57,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetContextProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urContextCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urContextCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urContextGetInfo;
-  pDdiTable->pfnGetNativeHandle = urContextGetNativeHandle;
-  pDdiTable->pfnRelease = urContextRelease;
-  pDdiTable->pfnRetain = urContextRetain;
-  pDdiTable->pfnSetExtendedDeleter = urContextSetExtendedDeleter;
+  pDdiTable->pfnCreate = ur::cuda::urContextCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::cuda::urContextCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::cuda::urContextGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::cuda::urContextGetNativeHandle;
+  pDdiTable->pfnRelease = ur::cuda::urContextRelease;
+  pDdiTable->pfnRetain = ur::cuda::urContextRetain;
+  pDdiTable->pfnSetExtendedDeleter = ur::cuda::urContextSetExtendedDeleter;
   return UR_RESULT_SUCCESS;
 }
 
@@ -69,14 +74,26 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreateWithNativeHandle = urEventCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urEventGetInfo;
-  pDdiTable->pfnGetNativeHandle = urEventGetNativeHandle;
-  pDdiTable->pfnGetProfilingInfo = urEventGetProfilingInfo;
-  pDdiTable->pfnRelease = urEventRelease;
-  pDdiTable->pfnRetain = urEventRetain;
-  pDdiTable->pfnSetCallback = urEventSetCallback;
-  pDdiTable->pfnWait = urEventWait;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::cuda::urEventCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::cuda::urEventGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::cuda::urEventGetNativeHandle;
+  pDdiTable->pfnGetProfilingInfo = ur::cuda::urEventGetProfilingInfo;
+  pDdiTable->pfnRelease = ur::cuda::urEventRelease;
+  pDdiTable->pfnRetain = ur::cuda::urEventRetain;
+  pDdiTable->pfnSetCallback = ur::cuda::urEventSetCallback;
+  pDdiTable->pfnWait = ur::cuda::urEventWait;
+  return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ur_event_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnWaitAnyExp = ur::cuda::urEventWaitAnyExp;
+  pDdiTable->pfnGetExecutionStatusExp = ur::cuda::urEventGetExecutionStatusExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -86,21 +103,23 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnBuild = urProgramBuild;
-  pDdiTable->pfnCompile = urProgramCompile;
-  pDdiTable->pfnCreateWithBinary = urProgramCreateWithBinary;
-  pDdiTable->pfnCreateWithIL = urProgramCreateWithIL;
-  pDdiTable->pfnCreateWithNativeHandle = urProgramCreateWithNativeHandle;
-  pDdiTable->pfnGetBuildInfo = urProgramGetBuildInfo;
-  pDdiTable->pfnGetFunctionPointer = urProgramGetFunctionPointer;
-  pDdiTable->pfnGetGlobalVariablePointer = urProgramGetGlobalVariablePointer;
-  pDdiTable->pfnGetInfo = urProgramGetInfo;
-  pDdiTable->pfnGetNativeHandle = urProgramGetNativeHandle;
-  pDdiTable->pfnLink = urProgramLink;
-  pDdiTable->pfnRelease = urProgramRelease;
-  pDdiTable->pfnRetain = urProgramRetain;
+  pDdiTable->pfnBuild = ur::cuda::urProgramBuild;
+  pDdiTable->pfnCompile = ur::cuda::urProgramCompile;
+  pDdiTable->pfnCreateWithBinary = ur::cuda::urProgramCreateWithBinary;
+  pDdiTable->pfnCreateWithIL = ur::cuda::urProgramCreateWithIL;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::cuda::urProgramCreateWithNativeHandle;
+  pDdiTable->pfnGetBuildInfo = ur::cuda::urProgramGetBuildInfo;
+  pDdiTable->pfnGetFunctionPointer = ur::cuda::urProgramGetFunctionPointer;
+  pDdiTable->pfnGetGlobalVariablePointer =
+      ur::cuda::urProgramGetGlobalVariablePointer;
+  pDdiTable->pfnGetInfo = ur::cuda::urProgramGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::cuda::urProgramGetNativeHandle;
+  pDdiTable->pfnLink = ur::cuda::urProgramLink;
+  pDdiTable->pfnRelease = ur::cuda::urProgramRelease;
+  pDdiTable->pfnRetain = ur::cuda::urProgramRetain;
   pDdiTable->pfnSetSpecializationConstants =
-      urProgramSetSpecializationConstants;
+      ur::cuda::urProgramSetSpecializationConstants;
   return UR_RESULT_SUCCESS;
 }
 
@@ -110,22 +129,24 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urKernelCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urKernelCreateWithNativeHandle;
-  pDdiTable->pfnGetGroupInfo = urKernelGetGroupInfo;
-  pDdiTable->pfnGetInfo = urKernelGetInfo;
-  pDdiTable->pfnGetNativeHandle = urKernelGetNativeHandle;
-  pDdiTable->pfnGetSubGroupInfo = urKernelGetSubGroupInfo;
-  pDdiTable->pfnRelease = urKernelRelease;
-  pDdiTable->pfnRetain = urKernelRetain;
-  pDdiTable->pfnSetArgLocal = urKernelSetArgLocal;
-  pDdiTable->pfnSetArgMemObj = urKernelSetArgMemObj;
-  pDdiTable->pfnSetArgPointer = urKernelSetArgPointer;
-  pDdiTable->pfnSetArgSampler = urKernelSetArgSampler;
-  pDdiTable->pfnSetArgValue = urKernelSetArgValue;
-  pDdiTable->pfnSetExecInfo = urKernelSetExecInfo;
+  pDdiTable->pfnCreate = ur::cuda::urKernelCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::cuda::urKernelCreateWithNativeHandle;
+  pDdiTable->pfnGetGroupInfo = ur::cuda::urKernelGetGroupInfo;
+  pDdiTable->pfnGetInfo = ur::cuda::urKernelGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::cuda::urKernelGetNativeHandle;
+  pDdiTable->pfnGetSubGroupInfo = ur::cuda::urKernelGetSubGroupInfo;
+  pDdiTable->pfnRelease = ur::cuda::urKernelRelease;
+  pDdiTable->pfnRetain = ur::cuda::urKernelRetain;
+  pDdiTable->pfnSetArgLocal = ur::cuda::urKernelSetArgLocal;
+  pDdiTable->pfnSetArgMemObj = ur::cuda::urKernelSetArgMemObj;
+  pDdiTable->pfnSetArgPointer = ur::cuda::urKernelSetArgPointer;
+  pDdiTable->pfnSetArgSampler = ur::cuda::urKernelSetArgSampler;
+  pDdiTable->pfnSetArgValue = ur::cuda::urKernelSetArgValue;
+  pDdiTable->pfnSetExecInfo = ur::cuda::urKernelSetExecInfo;
   pDdiTable->pfnSetSpecializationConstants = nullptr;
-  pDdiTable->pfnGetSuggestedLocalWorkSize = urKernelGetSuggestedLocalWorkSize;
+  pDdiTable->pfnGetSuggestedLocalWorkSize =
+      ur::cuda::urKernelGetSuggestedLocalWorkSize;
   return UR_RESULT_SUCCESS;
 }
 
@@ -135,12 +156,13 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetSamplerProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urSamplerCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urSamplerCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urSamplerGetInfo;
-  pDdiTable->pfnGetNativeHandle = urSamplerGetNativeHandle;
-  pDdiTable->pfnRelease = urSamplerRelease;
-  pDdiTable->pfnRetain = urSamplerRetain;
+  pDdiTable->pfnCreate = ur::cuda::urSamplerCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::cuda::urSamplerCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::cuda::urSamplerGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::cuda::urSamplerGetNativeHandle;
+  pDdiTable->pfnRelease = ur::cuda::urSamplerRelease;
+  pDdiTable->pfnRetain = ur::cuda::urSamplerRetain;
   return UR_RESULT_SUCCESS;
 }
 
@@ -150,17 +172,18 @@ urGetMemProcAddrTable(ur_api_version_t version, ur_mem_dditable_t *pDdiTable) {
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnBufferCreate = urMemBufferCreate;
-  pDdiTable->pfnBufferPartition = urMemBufferPartition;
+  pDdiTable->pfnBufferCreate = ur::cuda::urMemBufferCreate;
+  pDdiTable->pfnBufferPartition = ur::cuda::urMemBufferPartition;
   pDdiTable->pfnBufferCreateWithNativeHandle =
-      urMemBufferCreateWithNativeHandle;
-  pDdiTable->pfnImageCreateWithNativeHandle = urMemImageCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urMemGetInfo;
-  pDdiTable->pfnGetNativeHandle = urMemGetNativeHandle;
-  pDdiTable->pfnImageCreate = urMemImageCreate;
-  pDdiTable->pfnImageGetInfo = urMemImageGetInfo;
-  pDdiTable->pfnRelease = urMemRelease;
-  pDdiTable->pfnRetain = urMemRetain;
+      ur::cuda::urMemBufferCreateWithNativeHandle;
+  pDdiTable->pfnImageCreateWithNativeHandle =
+      ur::cuda::urMemImageCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::cuda::urMemGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::cuda::urMemGetNativeHandle;
+  pDdiTable->pfnImageCreate = ur::cuda::urMemImageCreate;
+  pDdiTable->pfnImageGetInfo = ur::cuda::urMemImageGetInfo;
+  pDdiTable->pfnRelease = ur::cuda::urMemRelease;
+  pDdiTable->pfnRetain = ur::cuda::urMemRetain;
   return UR_RESULT_SUCCESS;
 }
 
@@ -170,31 +193,34 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnDeviceGlobalVariableRead = urEnqueueDeviceGlobalVariableRead;
-  pDdiTable->pfnDeviceGlobalVariableWrite = urEnqueueDeviceGlobalVariableWrite;
-  pDdiTable->pfnEventsWait = urEnqueueEventsWait;
-  pDdiTable->pfnEventsWaitWithBarrier = urEnqueueEventsWaitWithBarrier;
-  pDdiTable->pfnKernelLaunch = urEnqueueKernelLaunch;
-  pDdiTable->pfnMemBufferCopy = urEnqueueMemBufferCopy;
-  pDdiTable->pfnMemBufferCopyRect = urEnqueueMemBufferCopyRect;
-  pDdiTable->pfnMemBufferFill = urEnqueueMemBufferFill;
-  pDdiTable->pfnMemBufferMap = urEnqueueMemBufferMap;
-  pDdiTable->pfnMemBufferRead = urEnqueueMemBufferRead;
-  pDdiTable->pfnMemBufferReadRect = urEnqueueMemBufferReadRect;
-  pDdiTable->pfnMemBufferWrite = urEnqueueMemBufferWrite;
-  pDdiTable->pfnMemBufferWriteRect = urEnqueueMemBufferWriteRect;
-  pDdiTable->pfnMemImageCopy = urEnqueueMemImageCopy;
-  pDdiTable->pfnMemImageRead = urEnqueueMemImageRead;
-  pDdiTable->pfnMemImageWrite = urEnqueueMemImageWrite;
-  pDdiTable->pfnMemUnmap = urEnqueueMemUnmap;
-  pDdiTable->pfnUSMFill2D = urEnqueueUSMFill2D;
-  pDdiTable->pfnUSMFill = urEnqueueUSMFill;
-  pDdiTable->pfnUSMAdvise = urEnqueueUSMAdvise;
-  pDdiTable->pfnUSMMemcpy2D = urEnqueueUSMMemcpy2D;
-  pDdiTable->pfnUSMMemcpy = urEnqueueUSMMemcpy;
-  pDdiTable->pfnUSMPrefetch = urEnqueueUSMPrefetch;
-  pDdiTable->pfnReadHostPipe = urEnqueueReadHostPipe;
-  pDdiTable->pfnWriteHostPipe = urEnqueueWriteHostPipe;
+  pDdiTable->pfnDeviceGlobalVariableRead =
+      ur::cuda::urEnqueueDeviceGlobalVariableRead;
+  pDdiTable->pfnDeviceGlobalVariableWrite =
+      ur::cuda::urEnqueueDeviceGlobalVariableWrite;
+  pDdiTable->pfnEventsWait = ur::cuda::urEnqueueEventsWait;
+  pDdiTable->pfnEventsWaitWithBarrier =
+      ur::cuda::urEnqueueEventsWaitWithBarrier;
+  pDdiTable->pfnKernelLaunch = ur::cuda::urEnqueueKernelLaunch;
+  pDdiTable->pfnMemBufferCopy = ur::cuda::urEnqueueMemBufferCopy;
+  pDdiTable->pfnMemBufferCopyRect = ur::cuda::urEnqueueMemBufferCopyRect;
+  pDdiTable->pfnMemBufferFill = ur::cuda::urEnqueueMemBufferFill;
+  pDdiTable->pfnMemBufferMap = ur::cuda::urEnqueueMemBufferMap;
+  pDdiTable->pfnMemBufferRead = ur::cuda::urEnqueueMemBufferRead;
+  pDdiTable->pfnMemBufferReadRect = ur::cuda::urEnqueueMemBufferReadRect;
+  pDdiTable->pfnMemBufferWrite = ur::cuda::urEnqueueMemBufferWrite;
+  pDdiTable->pfnMemBufferWriteRect = ur::cuda::urEnqueueMemBufferWriteRect;
+  pDdiTable->pfnMemImageCopy = ur::cuda::urEnqueueMemImageCopy;
+  pDdiTable->pfnMemImageRead = ur::cuda::urEnqueueMemImageRead;
+  pDdiTable->pfnMemImageWrite = ur::cuda::urEnqueueMemImageWrite;
+  pDdiTable->pfnMemUnmap = ur::cuda::urEnqueueMemUnmap;
+  pDdiTable->pfnUSMFill2D = ur::cuda::urEnqueueUSMFill2D;
+  pDdiTable->pfnUSMFill = ur::cuda::urEnqueueUSMFill;
+  pDdiTable->pfnUSMAdvise = ur::cuda::urEnqueueUSMAdvise;
+  pDdiTable->pfnUSMMemcpy2D = ur::cuda::urEnqueueUSMMemcpy2D;
+  pDdiTable->pfnUSMMemcpy = ur::cuda::urEnqueueUSMMemcpy;
+  pDdiTable->pfnUSMPrefetch = ur::cuda::urEnqueueUSMPrefetch;
+  pDdiTable->pfnReadHostPipe = ur::cuda::urEnqueueReadHostPipe;
+  pDdiTable->pfnWriteHostPipe = ur::cuda::urEnqueueWriteHostPipe;
   return UR_RESULT_SUCCESS;
 }
 
@@ -204,11 +230,11 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnAdapterGet = urAdapterGet;
-  pDdiTable->pfnAdapterRelease = urAdapterRelease;
-  pDdiTable->pfnAdapterRetain = urAdapterRetain;
-  pDdiTable->pfnAdapterGetLastError = urAdapterGetLastError;
-  pDdiTable->pfnAdapterGetInfo = urAdapterGetInfo;
+  pDdiTable->pfnAdapterGet = ur::cuda::urAdapterGet;
+  pDdiTable->pfnAdapterRelease = ur::cuda::urAdapterRelease;
+  pDdiTable->pfnAdapterRetain = ur::cuda::urAdapterRetain;
+  pDdiTable->pfnAdapterGetLastError = ur::cuda::urAdapterGetLastError;
+  pDdiTable->pfnAdapterGetInfo = ur::cuda::urAdapterGetInfo;
 
   return UR_RESULT_SUCCESS;
 }
@@ -219,14 +245,28 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urQueueCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urQueueCreateWithNativeHandle;
-  pDdiTable->pfnFinish = urQueueFinish;
-  pDdiTable->pfnFlush = urQueueFlush;
-  pDdiTable->pfnGetInfo = urQueueGetInfo;
-  pDdiTable->pfnGetNativeHandle = urQueueGetNativeHandle;
-  pDdiTable->pfnRelease = urQueueRelease;
-  pDdiTable->pfnRetain = urQueueRetain;
+  pDdiTable->pfnCreate = ur::cuda::urQueueCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::cuda::urQueueCreateWithNativeHandle;
+  pDdiTable->pfnFinish = ur::cuda::urQueueFinish;
+  pDdiTable->pfnFlush = ur::cuda::urQueueFlush;
+  pDdiTable->pfnGetInfo = ur::cuda::urQueueGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::cuda::urQueueGetNativeHandle;
+  pDdiTable->pfnRelease = ur::cuda::urQueueRelease;
+  pDdiTable->pfnRetain = ur::cuda::urQueueRetain;
+  return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ur_queue_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnReserveTimestampMarkersExp =
+      ur::cuda::urQueueReserveTimestampMarkersExp;
+  pDdiTable->pfnReadTimestampMarkersExp =
+      ur::cuda::urQueueReadTimestampMarkersExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -236,15 +276,15 @@ urGetUSMProcAddrTable(ur_api_version_t version, ur_usm_dditable_t *pDdiTable) {
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnDeviceAlloc = urUSMDeviceAlloc;
-  pDdiTable->pfnFree = urUSMFree;
-  pDdiTable->pfnGetMemAllocInfo = urUSMGetMemAllocInfo;
-  pDdiTable->pfnHostAlloc = urUSMHostAlloc;
-  pDdiTable->pfnPoolCreate = urUSMPoolCreate;
-  pDdiTable->pfnPoolRetain = urUSMPoolRetain;
-  pDdiTable->pfnPoolRelease = urUSMPoolRelease;
-  pDdiTable->pfnPoolGetInfo = urUSMPoolGetInfo;
-  pDdiTable->pfnSharedAlloc = urUSMSharedAlloc;
+  pDdiTable->pfnDeviceAlloc = ur::cuda::urUSMDeviceAlloc;
+  pDdiTable->pfnFree = ur::cuda::urUSMFree;
+  pDdiTable->pfnGetMemAllocInfo = ur::cuda::urUSMGetMemAllocInfo;
+  pDdiTable->pfnHostAlloc = ur::cuda::urUSMHostAlloc;
+  pDdiTable->pfnPoolCreate = ur::cuda::urUSMPoolCreate;
+  pDdiTable->pfnPoolRetain = ur::cuda::urUSMPoolRetain;
+  pDdiTable->pfnPoolRelease = ur::cuda::urUSMPoolRelease;
+  pDdiTable->pfnPoolGetInfo = ur::cuda::urUSMPoolGetInfo;
+  pDdiTable->pfnSharedAlloc = ur::cuda::urUSMSharedAlloc;
   return UR_RESULT_SUCCESS;
 }
 
@@ -254,15 +294,16 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetDeviceProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreateWithNativeHandle = urDeviceCreateWithNativeHandle;
-  pDdiTable->pfnGet = urDeviceGet;
-  pDdiTable->pfnGetGlobalTimestamps = urDeviceGetGlobalTimestamps;
-  pDdiTable->pfnGetInfo = urDeviceGetInfo;
-  pDdiTable->pfnGetNativeHandle = urDeviceGetNativeHandle;
-  pDdiTable->pfnPartition = urDevicePartition;
-  pDdiTable->pfnRelease = urDeviceRelease;
-  pDdiTable->pfnRetain = urDeviceRetain;
-  pDdiTable->pfnSelectBinary = urDeviceSelectBinary;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::cuda::urDeviceCreateWithNativeHandle;
+  pDdiTable->pfnGet = ur::cuda::urDeviceGet;
+  pDdiTable->pfnGetGlobalTimestamps = ur::cuda::urDeviceGetGlobalTimestamps;
+  pDdiTable->pfnGetInfo = ur::cuda::urDeviceGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::cuda::urDeviceGetNativeHandle;
+  pDdiTable->pfnPartition = ur::cuda::urDevicePartition;
+  pDdiTable->pfnRelease = ur::cuda::urDeviceRelease;
+  pDdiTable->pfnRetain = ur::cuda::urDeviceRetain;
+  pDdiTable->pfnSelectBinary = ur::cuda::urDeviceSelectBinary;
   return UR_RESULT_SUCCESS;
 }
 
@@ -275,32 +316,40 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
   if (UR_RESULT_SUCCESS != retVal) {
     return retVal;
   }
-  pDdiTable->pfnCreateExp = urCommandBufferCreateExp;
-  pDdiTable->pfnRetainExp = urCommandBufferRetainExp;
-  pDdiTable->pfnReleaseExp = urCommandBufferReleaseExp;
-  pDdiTable->pfnFinalizeExp = urCommandBufferFinalizeExp;
-  pDdiTable->pfnAppendKernelLaunchExp = urCommandBufferAppendKernelLaunchExp;
-  pDdiTable->pfnAppendUSMMemcpyExp = urCommandBufferAppendUSMMemcpyExp;
-  pDdiTable->pfnAppendUSMFillExp = urCommandBufferAppendUSMFillExp;
-  pDdiTable->pfnAppendMemBufferCopyExp = urCommandBufferAppendMemBufferCopyExp;
+  pDdiTable->pfnCreateExp = ur::cuda::urCommandBufferCreateExp;
+  pDdiTable->pfnRetainExp = ur::cuda::urCommandBufferRetainExp;
+  pDdiTable->pfnReleaseExp = ur::cuda::urCommandBufferReleaseExp;
+  pDdiTable->pfnFinalizeExp = ur::cuda::urCommandBufferFinalizeExp;
+  pDdiTable->pfnAppendKernelLaunchExp =
+      ur::cuda::urCommandBufferAppendKernelLaunchExp;
+  pDdiTable->pfnAppendUSMMemcpyExp =
+      ur::cuda::urCommandBufferAppendUSMMemcpyExp;
+  pDdiTable->pfnAppendUSMFillExp = ur::cuda::urCommandBufferAppendUSMFillExp;
+  pDdiTable->pfnAppendMemBufferCopyExp =
+      ur::cuda::urCommandBufferAppendMemBufferCopyExp;
   pDdiTable->pfnAppendMemBufferCopyRectExp =
-      urCommandBufferAppendMemBufferCopyRectExp;
-  pDdiTable->pfnAppendMemBufferReadExp = urCommandBufferAppendMemBufferReadExp;
+      ur::cuda::urCommandBufferAppendMemBufferCopyRectExp;
+  pDdiTable->pfnAppendMemBufferReadExp =
+      ur::cuda::urCommandBufferAppendMemBufferReadExp;
   pDdiTable->pfnAppendMemBufferReadRectExp =
-      urCommandBufferAppendMemBufferReadRectExp;
+      ur::cuda::urCommandBufferAppendMemBufferReadRectExp;
   pDdiTable->pfnAppendMemBufferWriteExp =
-      urCommandBufferAppendMemBufferWriteExp;
+      ur::cuda::urCommandBufferAppendMemBufferWriteExp;
   pDdiTable->pfnAppendMemBufferWriteRectExp =
-      urCommandBufferAppendMemBufferWriteRectExp;
-  pDdiTable->pfnAppendUSMPrefetchExp = urCommandBufferAppendUSMPrefetchExp;
-  pDdiTable->pfnAppendUSMAdviseExp = urCommandBufferAppendUSMAdviseExp;
-  pDdiTable->pfnAppendMemBufferFillExp = urCommandBufferAppendMemBufferFillExp;
-  pDdiTable->pfnEnqueueExp = urCommandBufferEnqueueExp;
-  pDdiTable->pfnUpdateKernelLaunchExp = urCommandBufferUpdateKernelLaunchExp;
-  pDdiTable->pfnGetInfoExp = urCommandBufferGetInfoExp;
-  pDdiTable->pfnCommandGetInfoExp = urCommandBufferCommandGetInfoExp;
-  pDdiTable->pfnReleaseCommandExp = urCommandBufferReleaseCommandExp;
-  pDdiTable->pfnRetainCommandExp = urCommandBufferRetainCommandExp;
+      ur::cuda::urCommandBufferAppendMemBufferWriteRectExp;
+  pDdiTable->pfnAppendUSMPrefetchExp =
+      ur::cuda::urCommandBufferAppendUSMPrefetchExp;
+  pDdiTable->pfnAppendUSMAdviseExp =
+      ur::cuda::urCommandBufferAppendUSMAdviseExp;
+  pDdiTable->pfnAppendMemBufferFillExp =
+      ur::cuda::urCommandBufferAppendMemBufferFillExp;
+  pDdiTable->pfnEnqueueExp = ur::cuda::urCommandBufferEnqueueExp;
+  pDdiTable->pfnUpdateKernelLaunchExp =
+      ur::cuda::urCommandBufferUpdateKernelLaunchExp;
+  pDdiTable->pfnGetInfoExp = ur::cuda::urCommandBufferGetInfoExp;
+  pDdiTable->pfnCommandGetInfoExp = ur::cuda::urCommandBufferCommandGetInfoExp;
+  pDdiTable->pfnReleaseCommandExp = ur::cuda::urCommandBufferReleaseCommandExp;
+  pDdiTable->pfnRetainCommandExp = ur::cuda::urCommandBufferRetainCommandExp;
 
   return retVal;
 }
@@ -311,9 +360,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUsmP2PExpProcAddrTable(
   if (UR_RESULT_SUCCESS != retVal) {
     return retVal;
   }
-  pDdiTable->pfnEnablePeerAccessExp = urUsmP2PEnablePeerAccessExp;
-  pDdiTable->pfnDisablePeerAccessExp = urUsmP2PDisablePeerAccessExp;
-  pDdiTable->pfnPeerAccessGetInfoExp = urUsmP2PPeerAccessGetInfoExp;
+  pDdiTable->pfnEnablePeerAccessExp = ur::cuda::urUsmP2PEnablePeerAccessExp;
+  pDdiTable->pfnDisablePeerAccessExp = ur::cuda::urUsmP2PDisablePeerAccessExp;
+  pDdiTable->pfnPeerAccessGetInfoExp = ur::cuda::urUsmP2PPeerAccessGetInfoExp;
 
   return retVal;
 }
@@ -325,33 +374,35 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
     return result;
   }
   pDdiTable->pfnUnsampledImageHandleDestroyExp =
-      urBindlessImagesUnsampledImageHandleDestroyExp;
+      ur::cuda::urBindlessImagesUnsampledImageHandleDestroyExp;
   pDdiTable->pfnSampledImageHandleDestroyExp =
-      urBindlessImagesSampledImageHandleDestroyExp;
-  pDdiTable->pfnImageAllocateExp = urBindlessImagesImageAllocateExp;
-  pDdiTable->pfnImageFreeExp = urBindlessImagesImageFreeExp;
+      ur::cuda::urBindlessImagesSampledImageHandleDestroyExp;
+  pDdiTable->pfnImageAllocateExp = ur::cuda::urBindlessImagesImageAllocateExp;
+  pDdiTable->pfnImageFreeExp = ur::cuda::urBindlessImagesImageFreeExp;
   pDdiTable->pfnUnsampledImageCreateExp =
-      urBindlessImagesUnsampledImageCreateExp;
-  pDdiTable->pfnSampledImageCreateExp = urBindlessImagesSampledImageCreateExp;
-  pDdiTable->pfnImageCopyExp = urBindlessImagesImageCopyExp;
-  pDdiTable->pfnImageGetInfoExp = urBindlessImagesImageGetInfoExp;
-  pDdiTable->pfnMipmapGetLevelExp = urBindlessImagesMipmapGetLevelExp;
-  pDdiTable->pfnMipmapFreeExp = urBindlessImagesMipmapFreeExp;
+      ur::cuda::urBindlessImagesUnsampledImageCreateExp;
+  pDdiTable->pfnSampledImageCreateExp =
+      ur::cuda::urBindlessImagesSampledImageCreateExp;
+  pDdiTable->pfnImageCopyExp = ur::cuda::urBindlessImagesImageCopyExp;
+  pDdiTable->pfnImageGetInfoExp = ur::cuda::urBindlessImagesImageGetInfoExp;
+  pDdiTable->pfnMipmapGetLevelExp = ur::cuda::urBindlessImagesMipmapGetLevelExp;
+  pDdiTable->pfnMipmapFreeExp = ur::cuda::urBindlessImagesMipmapFreeExp;
   pDdiTable->pfnImportExternalMemoryExp =
-      urBindlessImagesImportExternalMemoryExp;
-  pDdiTable->pfnMapExternalArrayExp = urBindlessImagesMapExternalArrayExp;
+      ur::cuda::urBindlessImagesImportExternalMemoryExp;
+  pDdiTable->pfnMapExternalArrayExp =
+      ur::cuda::urBindlessImagesMapExternalArrayExp;
   pDdiTable->pfnMapExternalLinearMemoryExp =
-      urBindlessImagesMapExternalLinearMemoryExp;
+      ur::cuda::urBindlessImagesMapExternalLinearMemoryExp;
   pDdiTable->pfnReleaseExternalMemoryExp =
-      urBindlessImagesReleaseExternalMemoryExp;
+      ur::cuda::urBindlessImagesReleaseExternalMemoryExp;
   pDdiTable->pfnImportExternalSemaphoreExp =
-      urBindlessImagesImportExternalSemaphoreExp;
+      ur::cuda::urBindlessImagesImportExternalSemaphoreExp;
   pDdiTable->pfnReleaseExternalSemaphoreExp =
-      urBindlessImagesReleaseExternalSemaphoreExp;
+      ur::cuda::urBindlessImagesReleaseExternalSemaphoreExp;
   pDdiTable->pfnWaitExternalSemaphoreExp =
-      urBindlessImagesWaitExternalSemaphoreExp;
+      ur::cuda::urBindlessImagesWaitExternalSemaphoreExp;
   pDdiTable->pfnSignalExternalSemaphoreExp =
-      urBindlessImagesSignalExternalSemaphoreExp;
+      ur::cuda::urBindlessImagesSignalExternalSemaphoreExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -361,7 +412,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnPitchedAllocExp = urUSMPitchedAllocExp;
+  pDdiTable->pfnPitchedAllocExp = ur::cuda::urUSMPitchedAllocExp;
+  pDdiTable->pfnPoolTrimExp = ur::cuda::urUSMPoolTrimExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -375,13 +427,13 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetVirtualMemProcAddrTable(
     return retVal;
   }
 
-  pDdiTable->pfnFree = urVirtualMemFree;
-  pDdiTable->pfnGetInfo = urVirtualMemGetInfo;
-  pDdiTable->pfnGranularityGetInfo = urVirtualMemGranularityGetInfo;
-  pDdiTable->pfnMap = urVirtualMemMap;
-  pDdiTable->pfnReserve = urVirtualMemReserve;
-  pDdiTable->pfnSetAccess = urVirtualMemSetAccess;
-  pDdiTable->pfnUnmap = urVirtualMemUnmap;
+  pDdiTable->pfnFree = ur::cuda::urVirtualMemFree;
+  pDdiTable->pfnGetInfo = ur::cuda::urVirtualMemGetInfo;
+  pDdiTable->pfnGranularityGetInfo = ur::cuda::urVirtualMemGranularityGetInfo;
+  pDdiTable->pfnMap = ur::cuda::urVirtualMemMap;
+  pDdiTable->pfnReserve = ur::cuda::urVirtualMemReserve;
+  pDdiTable->pfnSetAccess = ur::cuda::urVirtualMemSetAccess;
+  pDdiTable->pfnUnmap = ur::cuda::urVirtualMemUnmap;
 
   return retVal;
 }
@@ -396,9 +448,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPhysicalMemProcAddrTable(
     return retVal;
   }
 
-  pDdiTable->pfnCreate = urPhysicalMemCreate;
-  pDdiTable->pfnRelease = urPhysicalMemRelease;
-  pDdiTable->pfnRetain = urPhysicalMemRetain;
+  pDdiTable->pfnCreate = ur::cuda::urPhysicalMemCreate;
+  pDdiTable->pfnRelease = ur::cuda::urPhysicalMemRelease;
+  pDdiTable->pfnRetain = ur::cuda::urPhysicalMemRetain;
 
   return retVal;
 }
@@ -411,10 +463,18 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
   }
 
   pDdiTable->pfnCooperativeKernelLaunchExp =
-      urEnqueueCooperativeKernelLaunchExp;
-  pDdiTable->pfnTimestampRecordingExp = urEnqueueTimestampRecordingExp;
-  pDdiTable->pfnKernelLaunchCustomExp = urEnqueueKernelLaunchCustomExp;
-  pDdiTable->pfnNativeCommandExp = urEnqueueNativeCommandExp;
+      ur::cuda::urEnqueueCooperativeKernelLaunchExp;
+  pDdiTable->pfnTimestampRecordingExp =
+      ur::cuda::urEnqueueTimestampRecordingExp;
+  pDdiTable->pfnKernelLaunchCustomExp =
+      ur::cuda::urEnqueueKernelLaunchCustomExp;
+  pDdiTable->pfnNativeCommandExp = ur::cuda::urEnqueueNativeCommandExp;
+  pDdiTable->pfnUSMDeviceAllocExp = ur::cuda::urEnqueueUSMDeviceAllocExp;
+  pDdiTable->pfnUSMFreeExp = ur::cuda::urEnqueueUSMFreeExp;
+  pDdiTable->pfnMemBufferCopyRectBatchExp =
+      ur::cuda::urEnqueueMemBufferCopyRectBatchExp;
+  pDdiTable->pfnKernelLaunchBatchExp = ur::cuda::urEnqueueKernelLaunchBatchExp;
+  pDdiTable->pfnTimestampMarkerExp = ur::cuda::urEnqueueTimestampMarkerExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -427,7 +487,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
   }
 
   pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
-      urKernelSuggestMaxCooperativeGroupCountExp;
+      ur::cuda::urKernelSuggestMaxCooperativeGroupCountExp;
+  pDdiTable->pfnSetArgsExp = ur::cuda::urKernelSetArgsExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -439,13 +500,114 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
     return result;
   }
 
-  pDdiTable->pfnBuildExp = urProgramBuildExp;
-  pDdiTable->pfnCompileExp = urProgramCompileExp;
-  pDdiTable->pfnLinkExp = urProgramLinkExp;
+  pDdiTable->pfnBuildExp = ur::cuda::urProgramBuildExp;
+  pDdiTable->pfnCompileExp = ur::cuda::urProgramCompileExp;
+  pDdiTable->pfnLinkExp = ur::cuda::urProgramLinkExp;
 
   return UR_RESULT_SUCCESS;
 }
 
-#if defined(__cplusplus)
+#ifdef UR_STATIC_ADAPTER_CUDA
+} // namespace ur::cuda
+#elif defined(__cplusplus)
 } // extern "C"
 #endif
+
+#ifdef UR_STATIC_ADAPTER_CUDA
+namespace ur::cuda {
+ur_result_t urAdapterGetDdiTables(ur_dditable_t *ddi) {
+  if (ddi == nullptr) {
+    return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+  }
+
+  ur_result_t result;
+
+  result = ur::cuda::urGetPlatformProcAddrTable(UR_API_VERSION_CURRENT,
+                                                &ddi->Platform);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetContextProcAddrTable(UR_API_VERSION_CURRENT,
+                                               &ddi->Context);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::cuda::urGetEventProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Event);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetEventExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                &ddi->EventExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetProgramProcAddrTable(UR_API_VERSION_CURRENT,
+                                               &ddi->Program);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::cuda::urGetKernelProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Kernel);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetSamplerProcAddrTable(UR_API_VERSION_CURRENT,
+                                               &ddi->Sampler);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetEnqueueProcAddrTable(UR_API_VERSION_CURRENT,
+                                               &ddi->Enqueue);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::cuda::urGetGlobalProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Global);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::cuda::urGetQueueProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Queue);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetQueueExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                &ddi->QueueExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::cuda::urGetDeviceProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Device);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetCommandBufferExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                        &ddi->CommandBufferExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetUsmP2PExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                 &ddi->UsmP2PExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetBindlessImagesExpProcAddrTable(
+      UR_API_VERSION_CURRENT, &ddi->BindlessImagesExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::cuda::urGetUSMExpProcAddrTable(UR_API_VERSION_CURRENT, &ddi->USMExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetVirtualMemProcAddrTable(UR_API_VERSION_CURRENT,
+                                                  &ddi->VirtualMem);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetPhysicalMemProcAddrTable(UR_API_VERSION_CURRENT,
+                                                   &ddi->PhysicalMem);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetEnqueueExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                  &ddi->EnqueueExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetKernelExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                 &ddi->KernelExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::cuda::urGetProgramExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                  &ddi->ProgramExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+
+  return result;
+}
+} // namespace ur::cuda
+#endif
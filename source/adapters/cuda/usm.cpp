@@ -14,30 +14,39 @@
 #include "common.hpp"
 #include "context.hpp"
 #include "device.hpp"
+#include "enqueue.hpp"
 #include "event.hpp"
 #include "platform.hpp"
 #include "queue.hpp"
 #include "ur_util.hpp"
 #include "usm.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <cuda.h>
 
+namespace ur::cuda {
+
 /// USM: Implements USM Host allocations using CUDA Pinned Memory
 /// https://docs.nvidia.com/cuda/cuda-c-programming-guide/index.html#page-locked-host-memory
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
-               ur_usm_pool_handle_t hPool, size_t size, void **ppMem) {
+ur_result_t urUSMHostAlloc(ur_context_handle_t hContext,
+                           const ur_usm_desc_t *pUSMDesc,
+                           ur_usm_pool_handle_t hPool, size_t size,
+                           void **ppMem) {
   auto alignment = pUSMDesc ? pUSMDesc->align : 0u;
   UR_ASSERT(!pUSMDesc ||
                 (alignment == 0 || ((alignment & (alignment - 1)) == 0)),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  // The deferred frees which are done may make room for the allocation, the
+  // errors of freeing them are not those of the allocation
+  std::ignore = hContext->reclaimDeferredFrees();
+
   if (!hPool) {
     return USMHostAllocImpl(ppMem, hContext, /* flags */ 0, size, alignment);
   }
 
   auto UMFPool = hPool->HostMemPool.get();
-  *ppMem = umfPoolAlignedMalloc(UMFPool, size, alignment);
+  *ppMem = umf::cachedAlignedMalloc(UMFPool, size, alignment);
   if (*ppMem == nullptr) {
     auto umfErr = umfPoolGetLastAllocationError(UMFPool);
     return umf::umf2urResult(umfErr);
@@ -47,22 +56,27 @@ urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
 
 /// USM: Implements USM device allocations using a normal CUDA device pointer
 ///
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t hPool,
-                 size_t size, void **ppMem) {
+ur_result_t urUSMDeviceAlloc(ur_context_handle_t hContext,
+                             ur_device_handle_t hDevice,
+                             const ur_usm_desc_t *pUSMDesc,
+                             ur_usm_pool_handle_t hPool, size_t size,
+                             void **ppMem) {
   auto alignment = pUSMDesc ? pUSMDesc->align : 0u;
   UR_ASSERT(!pUSMDesc ||
                 (alignment == 0 || ((alignment & (alignment - 1)) == 0)),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  // The deferred frees which are done may make room for the allocation, the
+  // errors of freeing them are not those of the allocation
+  std::ignore = hContext->reclaimDeferredFrees();
+
   if (!hPool) {
     return USMDeviceAllocImpl(ppMem, hContext, hDevice, /* flags */ 0, size,
                               alignment);
   }
 
   auto UMFPool = hPool->DeviceMemPool.get();
-  *ppMem = umfPoolAlignedMalloc(UMFPool, size, alignment);
+  *ppMem = umf::cachedAlignedMalloc(UMFPool, size, alignment);
   if (*ppMem == nullptr) {
     auto umfErr = umfPoolGetLastAllocationError(UMFPool);
     return umf::umf2urResult(umfErr);
@@ -72,28 +86,34 @@ urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
 
 /// USM: Implements USM Shared allocations using CUDA Managed Memory
 ///
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t hPool,
-                 size_t size, void **ppMem) {
+ur_result_t urUSMSharedAlloc(ur_context_handle_t hContext,
+                             ur_device_handle_t hDevice,
+                             const ur_usm_desc_t *pUSMDesc,
+                             ur_usm_pool_handle_t hPool, size_t size,
+                             void **ppMem) {
   auto alignment = pUSMDesc ? pUSMDesc->align : 0u;
   UR_ASSERT(!pUSMDesc ||
                 (alignment == 0 || ((alignment & (alignment - 1)) == 0)),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  // The deferred frees which are done may make room for the allocation, the
+  // errors of freeing them are not those of the allocation
+  std::ignore = hContext->reclaimDeferredFrees();
+
   if (!hPool) {
     return USMSharedAllocImpl(ppMem, hContext, hDevice, /*host flags*/ 0,
                               /*device flags*/ 0, size, alignment);
   }
 
   auto UMFPool = hPool->SharedMemPool.get();
-  *ppMem = umfPoolAlignedMalloc(UMFPool, size, alignment);
+  *ppMem = umf::cachedAlignedMalloc(UMFPool, size, alignment);
   if (*ppMem == nullptr) {
     auto umfErr = umfPoolGetLastAllocationError(UMFPool);
     return umf::umf2urResult(umfErr);
   }
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::cuda
 
 ur_result_t USMFreeImpl(ur_context_handle_t, void *Pointer) {
   ur_result_t Result = UR_RESULT_SUCCESS;
@@ -121,14 +141,26 @@ ur_result_t USMFreeImpl(ur_context_handle_t, void *Pointer) {
   return Result;
 }
 
+ur_result_t USMFreeNow(ur_context_handle_t hContext, void *Pointer) {
+  if (auto Pool = umfPoolByPtr(Pointer))
+    return umf::umf2urResult(umf::cachedFree(Pool, Pointer));
+  return USMFreeImpl(hContext, Pointer);
+}
+
+namespace ur::cuda {
+
 /// USM: Frees the given USM pointer associated with the context.
 ///
-UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
-                                              void *pMem) {
-  if (auto Pool = umfPoolByPtr(pMem))
-    return umf::umf2urResult(umfPoolFree(Pool, pMem));
-  return USMFreeImpl(hContext, pMem);
+/// With UR_CUDA_USM_DEFERRED_FREE the memory is only freed once the commands
+/// pending on the queues of the context have completed, rather than the
+/// caller having to wait for them.
+ur_result_t urUSMFree(ur_context_handle_t hContext, void *pMem) {
+  if (ur_context_handle_t_::isDeferredFreeEnabled()) {
+    return hContext->deferFree(pMem);
+  }
+  return USMFreeNow(hContext, pMem);
 }
+} // namespace ur::cuda
 
 ur_result_t USMDeviceAllocImpl(void **ResultPtr, ur_context_handle_t,
                                ur_device_handle_t Device,
@@ -190,10 +222,12 @@ ur_result_t USMHostAllocImpl(void **ResultPtr, ur_context_handle_t,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
-                     ur_usm_alloc_info_t propName, size_t propValueSize,
-                     void *pPropValue, size_t *pPropValueSizeRet) {
+namespace ur::cuda {
+
+ur_result_t urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
+                                 ur_usm_alloc_info_t propName,
+                                 size_t propValueSize, void *pPropValue,
+                                 size_t *pPropValueSizeRet) {
   ur_result_t Result = UR_RESULT_SUCCESS;
 
   UrReturnHelper ReturnValue(propValueSize, pPropValue, pPropValueSizeRet);
@@ -261,7 +295,8 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
       // cuda backend has only one platform containing all devices
       ur_platform_handle_t platform;
       ur_adapter_handle_t AdapterHandle = &adapter;
-      Result = urPlatformGet(&AdapterHandle, 1, 1, &platform, nullptr);
+      Result = ur::cuda::urPlatformGet(&AdapterHandle, 1, 1, &platform,
+                                       nullptr);
 
       // get the device from the platform
       ur_device_handle_t Device = platform->Devices[DeviceIndex].get();
@@ -287,21 +322,130 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMImportExp(ur_context_handle_t Context,
-                                                   void *HostPtr, size_t Size) {
+ur_result_t urUSMImportExp(ur_context_handle_t Context, void *HostPtr,
+                           size_t Size) {
   UR_ASSERT(Context, UR_RESULT_ERROR_INVALID_CONTEXT);
   UR_ASSERT(!HostPtr, UR_RESULT_ERROR_INVALID_VALUE);
   UR_ASSERT(Size > 0, UR_RESULT_ERROR_INVALID_VALUE);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMReleaseExp(ur_context_handle_t Context,
-                                                    void *HostPtr) {
+ur_result_t urUSMReleaseExp(ur_context_handle_t Context, void *HostPtr) {
   UR_ASSERT(Context, UR_RESULT_ERROR_INVALID_CONTEXT);
   UR_ASSERT(!HostPtr, UR_RESULT_ERROR_INVALID_VALUE);
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t urUSMPoolTrimExp(ur_context_handle_t, ur_usm_pool_handle_t,
+                             size_t) {
+  // The UMF pools don't support being trimmed
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+} // namespace ur::cuda
+
+#if CUDA_VERSION >= 11020
+// Enqueues Enqueue(Stream) on a compute stream of hQueue, once the events of
+// the wait list are complete
+template <typename F>
+static ur_result_t enqueueStreamOrdered(
+    ur_queue_handle_t hQueue, ur_command_t Type, uint32_t NumEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    F &&Enqueue) {
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    uint32_t StreamToken;
+    ur_stream_guard_ Guard;
+    CUstream CuStream = hQueue->getNextComputeStream(
+        NumEventsInWaitList, phEventWaitList, Guard, &StreamToken);
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, CuStream, NumEventsInWaitList,
+                                     phEventWaitList));
+
+    std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+    if (phEvent) {
+      RetImplEvent =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              Type, hQueue, CuStream, StreamToken));
+      UR_CHECK_ERROR(RetImplEvent->start());
+    }
+
+    UR_CHECK_ERROR(Enqueue(CuStream));
+
+    if (phEvent) {
+      UR_CHECK_ERROR(RetImplEvent->record());
+      *phEvent = RetImplEvent.release();
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (CUresult CuErr) {
+    return mapErrorUR(CuErr);
+  }
+  return UR_RESULT_SUCCESS;
+}
+#endif // CUDA_VERSION >= 11020
+
+namespace ur::cuda {
+
+/// USM: Implements stream ordered allocations with cuMemAllocFromPoolAsync,
+/// the memory freed by cuMemFreeAsync is reused by the allocations enqueued
+/// after the free without synchronizing the streams.
+ur_result_t urEnqueueUSMDeviceAllocExp(ur_queue_handle_t hQueue, size_t size,
+                                       uint32_t numEventsInWaitList,
+                                       const ur_event_handle_t *phEventWaitList,
+                                       void **ppMem,
+                                       ur_event_handle_t *phEvent) {
+#if CUDA_VERSION >= 11020
+  ur_device_handle_t Device = hQueue->getDevice();
+  UR_ASSERT(size <= Device->getMaxAllocSize(),
+            UR_RESULT_ERROR_INVALID_USM_SIZE);
+
+  CUmemoryPool Pool;
+  try {
+    Pool = hQueue->getContext()->getAsyncMemPool(Device);
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  if (!Pool) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  return enqueueStreamOrdered(
+      hQueue, UR_COMMAND_ENQUEUE_USM_DEVICE_ALLOC_EXP, numEventsInWaitList,
+      phEventWaitList, phEvent, [&](CUstream CuStream) {
+        return cuMemAllocFromPoolAsync(reinterpret_cast<CUdeviceptr *>(ppMem),
+                                       size, Pool, CuStream);
+      });
+#else
+  std::ignore = hQueue;
+  std::ignore = size;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = ppMem;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
+}
+
+ur_result_t urEnqueueUSMFreeExp(ur_queue_handle_t hQueue, void *pMem,
+                                uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList,
+                                ur_event_handle_t *phEvent) {
+#if CUDA_VERSION >= 11020
+  return enqueueStreamOrdered(
+      hQueue, UR_COMMAND_ENQUEUE_USM_FREE_EXP, numEventsInWaitList,
+      phEventWaitList, phEvent, [&](CUstream CuStream) {
+        return cuMemFreeAsync(reinterpret_cast<CUdeviceptr>(pMem), CuStream);
+      });
+#else
+  std::ignore = hQueue;
+  std::ignore = pMem;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
+}
+} // namespace ur::cuda
+
 umf_result_t USMMemoryProvider::initialize(ur_context_handle_t Ctx,
                                            ur_device_handle_t Dev) {
   Context = Ctx;
@@ -364,9 +508,61 @@ ur_result_t USMDeviceMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
                             Alignment);
 }
 
+umf_result_t
+USMHostMemoryProvider::initialize(ur_context_handle_t Ctx,
+                                  ur_device_handle_t Dev,
+                                  const usm::host_memory_config_t &Memory) {
+  HostMemory = Memory;
+  return USMMemoryProvider::initialize(Ctx, Dev);
+}
+
 ur_result_t USMHostMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
                                                 uint32_t Alignment) {
-  return USMHostAllocImpl(ResultPtr, Context, /* flags */ 0, Size, Alignment);
+  if (HostMemory.isDefault())
+    return USMHostAllocImpl(ResultPtr, Context, /* flags */ 0, Size,
+                            Alignment);
+
+  size_t MappedSize = usm::hostMemoryRoundUp(Size, HostMemory);
+  UR_ASSERT(Alignment <= usm::hostMemoryPageSize(HostMemory),
+            UR_RESULT_ERROR_UNSUPPORTED_ALIGNMENT);
+  void *Ptr = usm::hostMemoryMap(MappedSize, HostMemory);
+  if (!Ptr)
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+
+  try {
+    UR_CHECK_ERROR(cuMemHostRegister(
+        Ptr, MappedSize,
+        CU_MEMHOSTREGISTER_PORTABLE | CU_MEMHOSTREGISTER_DEVICEMAP));
+  } catch (ur_result_t Err) {
+    usm::hostMemoryUnmap(Ptr, MappedSize);
+    return Err;
+  }
+
+  *ResultPtr = Ptr;
+  return UR_RESULT_SUCCESS;
+}
+
+umf_result_t USMHostMemoryProvider::free(void *Ptr, size_t Size) {
+  if (HostMemory.isDefault())
+    return USMMemoryProvider::free(Ptr, Size);
+
+  try {
+    UR_CHECK_ERROR(cuMemHostUnregister(Ptr));
+  } catch (ur_result_t Err) {
+    getLastStatusRef() = Err;
+    return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+  }
+  usm::hostMemoryUnmap(Ptr, usm::hostMemoryRoundUp(Size, HostMemory));
+  return UMF_RESULT_SUCCESS;
+}
+
+umf_result_t USMHostMemoryProvider::get_min_page_size(void *Ptr,
+                                                      size_t *PageSize) {
+  if (HostMemory.isDefault())
+    return USMMemoryProvider::get_min_page_size(Ptr, PageSize);
+
+  *PageSize = usm::hostMemoryPageSize(HostMemory);
+  return UMF_RESULT_SUCCESS;
 }
 
 ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
@@ -385,6 +581,17 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
       }
       break;
     }
+    case UR_STRUCTURE_TYPE_EXP_USM_HOST_POOL_DESC: {
+      const ur_exp_usm_host_pool_desc_t *HostPoolDesc =
+          reinterpret_cast<const ur_exp_usm_host_pool_desc_t *>(BaseDesc);
+      auto [Result, Memory] = usm::makeHostMemoryConfig(
+          *HostPoolDesc, Context->getDevices(), ur::cuda::urDeviceGetInfo);
+      if (Result != UR_RESULT_SUCCESS) {
+        throw UsmAllocationException(Result);
+      }
+      HostMemory = Memory;
+      break;
+    }
     default: {
       throw UsmAllocationException(UR_RESULT_ERROR_INVALID_ARGUMENT);
     }
@@ -392,33 +599,35 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
     pNext = BaseDesc->pNext;
   }
 
-  auto MemProvider =
-      umf::memoryProviderMakeUnique<USMHostMemoryProvider>(Context, nullptr)
-          .second;
+  auto MemProvider = umf::memoryProviderMakeUnique<USMHostMemoryProvider>(
+                         Context, nullptr, HostMemory)
+                         .second;
 
-  HostMemPool =
+  HostMemPool = umf::poolAddStats(
       umf::poolMakeUniqueFromOps(
           umfDisjointPoolOps(), std::move(MemProvider),
           &this->DisjointPoolConfigs.Configs[usm::DisjointPoolMemType::Host])
-          .second;
+          .second);
 
   for (const auto &Device : Context->getDevices()) {
     MemProvider =
         umf::memoryProviderMakeUnique<USMDeviceMemoryProvider>(Context, Device)
             .second;
-    DeviceMemPool = umf::poolMakeUniqueFromOps(
-                        umfDisjointPoolOps(), std::move(MemProvider),
-                        &this->DisjointPoolConfigs
-                             .Configs[usm::DisjointPoolMemType::Device])
-                        .second;
+    DeviceMemPool = umf::poolAddStats(
+        umf::poolMakeUniqueFromOps(
+            umfDisjointPoolOps(), std::move(MemProvider),
+            &this->DisjointPoolConfigs
+                 .Configs[usm::DisjointPoolMemType::Device])
+            .second);
     MemProvider =
         umf::memoryProviderMakeUnique<USMSharedMemoryProvider>(Context, Device)
             .second;
-    SharedMemPool = umf::poolMakeUniqueFromOps(
-                        umfDisjointPoolOps(), std::move(MemProvider),
-                        &this->DisjointPoolConfigs
-                             .Configs[usm::DisjointPoolMemType::Shared])
-                        .second;
+    SharedMemPool = umf::poolAddStats(
+        umf::poolMakeUniqueFromOps(
+            umfDisjointPoolOps(), std::move(MemProvider),
+            &this->DisjointPoolConfigs
+                 .Configs[usm::DisjointPoolMemType::Shared])
+            .second);
     Context->addPool(this);
   }
 }
@@ -428,7 +637,9 @@ bool ur_usm_pool_handle_t_::hasUMFPool(umf_memory_pool_t *umf_pool) {
          HostMemPool.get() == umf_pool;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolCreate(
+namespace ur::cuda {
+
+ur_result_t urUSMPoolCreate(
     ur_context_handle_t Context, ///< [in] handle of the context object
     ur_usm_pool_desc_t
         *PoolDesc, ///< [in] pointer to USM pool descriptor. Can be chained with
@@ -455,25 +666,27 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolCreate(
 #endif
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolRetain(
+ur_result_t urUSMPoolRetain(
     ur_usm_pool_handle_t Pool ///< [in] pointer to USM memory pool
 ) {
   Pool->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolRelease(
+ur_result_t urUSMPoolRelease(
     ur_usm_pool_handle_t Pool ///< [in] pointer to USM memory pool
 ) {
   if (Pool->decrementReferenceCount() > 0) {
     return UR_RESULT_SUCCESS;
   }
+  // The deferred frees may return memory to the pool
+  std::ignore = Pool->Context->reclaimDeferredFrees(/*WaitForMarkers=*/true);
   Pool->Context->removePool(Pool);
   delete Pool;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolGetInfo(
+ur_result_t urUSMPoolGetInfo(
     ur_usm_pool_handle_t hPool,  ///< [in] handle of the USM memory pool
     ur_usm_pool_info_t propName, ///< [in] name of the pool property to query
     size_t propSize, ///< [in] size in bytes of the pool property value provided
@@ -491,8 +704,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolGetInfo(
   case UR_USM_POOL_INFO_CONTEXT: {
     return ReturnValue(hPool->Context);
   }
+  case UR_USM_POOL_INFO_USED_SIZE:
+  case UR_USM_POOL_INFO_CACHED_SIZE:
+  case UR_USM_POOL_INFO_PEAK_USED_SIZE:
+  case UR_USM_POOL_INFO_BUCKET_HITS:
+  case UR_USM_POOL_INFO_BUCKET_MISSES:
+  case UR_USM_POOL_INFO_FRAGMENTATION: {
+    auto Stats = umf::poolStatsSnapshot(
+        hPool->HostMemPool, hPool->DeviceMemPool, hPool->SharedMemPool);
+    return umf::poolStatsInfo(Stats, propName, ReturnValue);
+  }
   default: {
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
   }
   }
 }
+} // namespace ur::cuda
@@ -11,6 +11,7 @@
 #include "common.hpp"
 
 #include <umf_helpers.hpp>
+#include <ur_host_memory.hpp>
 #include <umf_pools/disjoint_pool_config_parser.hpp>
 
 usm::DisjointPoolAllConfigs InitializeDisjointPoolConfig();
@@ -27,6 +28,9 @@ struct ur_usm_pool_handle_t_ {
   umf::pool_unique_handle_t SharedMemPool;
   umf::pool_unique_handle_t HostMemPool;
 
+  // Placement of the memory of HostMemPool, from ur_exp_usm_host_pool_desc_t
+  usm::host_memory_config_t HostMemory;
+
   ur_usm_pool_handle_t_(ur_context_handle_t Context,
                         ur_usm_pool_desc_t *PoolDesc);
 
@@ -50,13 +54,12 @@ public:
 
 // Implements memory allocation via driver API for USM allocator interface.
 class USMMemoryProvider {
-private:
+protected:
   ur_result_t &getLastStatusRef() {
     static thread_local ur_result_t LastStatus = UR_RESULT_SUCCESS;
     return LastStatus;
   }
 
-protected:
   ur_context_handle_t Context;
   ur_device_handle_t Device;
   size_t MinPageSize;
@@ -112,9 +115,16 @@ protected:
                            uint32_t Alignment) override;
 };
 
-// Allocation routines for host memory type
+// Allocation routines for host memory type. Memory with a non-default
+// placement is mapped from the OS and registered with the driver.
 class USMHostMemoryProvider final : public USMMemoryProvider {
+  usm::host_memory_config_t HostMemory;
+
 public:
+  umf_result_t initialize(ur_context_handle_t Ctx, ur_device_handle_t Dev,
+                          const usm::host_memory_config_t &Memory);
+  umf_result_t free(void *Ptr, size_t Size);
+  umf_result_t get_min_page_size(void *Ptr, size_t *PageSize);
   const char *get_name() override { return "USMSharedMemoryProvider"; }
 
 protected:
@@ -136,3 +146,7 @@ ur_result_t USMSharedAllocImpl(void **ResultPtr, ur_context_handle_t Context,
 ur_result_t USMHostAllocImpl(void **ResultPtr, ur_context_handle_t Context,
                              ur_usm_host_mem_flags_t Flags, size_t Size,
                              uint32_t Alignment);
+
+// Frees the USM memory Pointer to its pool, or to the driver if it wasn't
+// allocated from one, without waiting for the commands which may use it
+ur_result_t USMFreeNow(ur_context_handle_t Context, void *Pointer);
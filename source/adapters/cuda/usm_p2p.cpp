@@ -10,33 +10,114 @@
 
 #include "common.hpp"
 #include "context.hpp"
+#include "platform.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
-    ur_device_handle_t commandDevice, ur_device_handle_t peerDevice) {
+#include <algorithm>
+#include <chrono>
+
+namespace {
+// The size of the copies timed to find the bandwidth between two devices
+constexpr size_t BandwidthProbeSize = 16 * 1024 * 1024;
+constexpr int BandwidthProbeCount = 3;
+
+// Returns the bandwidth of the fastest of a few copies from Src to Dst, in
+// MB/s. The copies go through the host when peer access isn't enabled, so
+// does the bandwidth.
+uint64_t measureBandwidth(ur_device_handle_t Src, ur_device_handle_t Dst) {
+  CUdeviceptr SrcPtr = 0, DstPtr = 0;
+  std::chrono::steady_clock::duration Fastest =
+      std::chrono::steady_clock::duration::max();
+  try {
+    {
+      ScopedContext Active(Src);
+      UR_CHECK_ERROR(cuMemAlloc(&SrcPtr, BandwidthProbeSize));
+    }
+    {
+      ScopedContext Active(Dst);
+      UR_CHECK_ERROR(cuMemAlloc(&DstPtr, BandwidthProbeSize));
+    }
+    for (int I = 0; I < BandwidthProbeCount; I++) {
+      auto Start = std::chrono::steady_clock::now();
+      UR_CHECK_ERROR(cuMemcpyPeer(DstPtr, Dst->getNativeContext(), SrcPtr,
+                                  Src->getNativeContext(),
+                                  BandwidthProbeSize));
+      Fastest = std::min(Fastest, std::chrono::steady_clock::now() - Start);
+    }
+  } catch (ur_result_t) {
+    Fastest = std::chrono::steady_clock::duration::max();
+  }
+  if (SrcPtr) {
+    ScopedContext Active(Src);
+    cuMemFree(SrcPtr);
+  }
+  if (DstPtr) {
+    ScopedContext Active(Dst);
+    cuMemFree(DstPtr);
+  }
+
+  auto Ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(Fastest).count();
+  if (Fastest == std::chrono::steady_clock::duration::max() || Ns <= 0) {
+    return 0;
+  }
+  // bytes per ns are GB/s
+  return BandwidthProbeSize * 1000 / Ns;
+}
+
+// CUDA doesn't report the type of the P2P links, NVLink or PCIe, and their
+// bandwidth is measured
+ur_result_t queryPeerLink(ur_device_handle_t Src, ur_device_handle_t Dst,
+                          ur::peer_link_t &Link) {
+  try {
+    int Access = 0;
+    UR_CHECK_ERROR(cuDeviceGetP2PAttribute(
+        &Access, CU_DEVICE_P2P_ATTRIBUTE_ACCESS_SUPPORTED, Src->get(),
+        Dst->get()));
+    Link.type =
+        Access ? UR_EXP_PEER_LINK_TYPE_OTHER : UR_EXP_PEER_LINK_TYPE_NONE;
+    Link.hops = Access ? 1 : 0;
+    Link.bandwidth = measureBandwidth(Src, Dst);
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  return UR_RESULT_SUCCESS;
+}
+} // namespace
+
+namespace ur::cuda {
+
+ur_result_t urUsmP2PEnablePeerAccessExp(ur_device_handle_t commandDevice,
+                                        ur_device_handle_t peerDevice) {
   try {
     ScopedContext active(commandDevice);
     UR_CHECK_ERROR(cuCtxEnablePeerAccess(peerDevice->getNativeContext(), 0));
+    // The copies between the devices take another path
+    commandDevice->getPlatform()->PeerTopology.invalidate(commandDevice);
   } catch (ur_result_t err) {
     return err;
   }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
-    ur_device_handle_t commandDevice, ur_device_handle_t peerDevice) {
+ur_result_t urUsmP2PDisablePeerAccessExp(ur_device_handle_t commandDevice,
+                                         ur_device_handle_t peerDevice) {
   try {
     ScopedContext active(commandDevice);
     UR_CHECK_ERROR(cuCtxDisablePeerAccess(peerDevice->getNativeContext()));
+    // The copies between the devices take another path
+    commandDevice->getPlatform()->PeerTopology.invalidate(commandDevice);
   } catch (ur_result_t err) {
     return err;
   }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
-    ur_device_handle_t commandDevice, ur_device_handle_t peerDevice,
-    ur_exp_peer_info_t propName, size_t propSize, void *pPropValue,
-    size_t *pPropSizeRet) {
+ur_result_t urUsmP2PPeerAccessGetInfoExp(ur_device_handle_t commandDevice,
+                                         ur_device_handle_t peerDevice,
+                                         ur_exp_peer_info_t propName,
+                                         size_t propSize, void *pPropValue,
+                                         size_t *pPropSizeRet) {
 
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
@@ -54,7 +135,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
       break;
     }
     default: {
-      return UR_RESULT_ERROR_INVALID_ENUMERATION;
+      auto *Platform = commandDevice->getPlatform();
+      return Platform->PeerTopology.getInfo(propName, commandDevice,
+                                            peerDevice, Platform->Devices,
+                                            queryPeerLink, ReturnValue);
     }
     }
 
@@ -65,3 +149,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
   }
   return ReturnValue(value);
 }
+} // namespace ur::cuda
@@ -12,14 +12,18 @@
 #include "context.hpp"
 #include "event.hpp"
 #include "physical_mem.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <cassert>
 #include <cuda.h>
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
-    ur_context_handle_t, ur_device_handle_t hDevice,
-    ur_virtual_mem_granularity_info_t propName, size_t propSize,
-    void *pPropValue, size_t *pPropSizeRet) {
+namespace ur::cuda {
+
+ur_result_t
+urVirtualMemGranularityGetInfo(ur_context_handle_t, ur_device_handle_t hDevice,
+                               ur_virtual_mem_granularity_info_t propName,
+                               size_t propSize, void *pPropValue,
+                               size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   ScopedContext Active(hDevice);
@@ -47,9 +51,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urVirtualMemReserve(ur_context_handle_t hContext, const void *pStart,
-                    size_t size, void **ppStart) {
+ur_result_t urVirtualMemReserve(ur_context_handle_t hContext,
+                                const void *pStart, size_t size,
+                                void **ppStart) {
   // Reserve the virtual mem. Only need to do once for arbitrary context
   ScopedContext Active(hContext->getDevices()[0]);
   UR_CHECK_ERROR(cuMemAddressReserve((CUdeviceptr *)ppStart, size, 0,
@@ -57,16 +61,15 @@ urVirtualMemReserve(ur_context_handle_t hContext, const void *pStart,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemFree(ur_context_handle_t,
-                                                     const void *pStart,
-                                                     size_t size) {
+ur_result_t urVirtualMemFree(ur_context_handle_t, const void *pStart,
+                             size_t size) {
   UR_CHECK_ERROR(cuMemAddressFree((CUdeviceptr)pStart, size));
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urVirtualMemSetAccess(ur_context_handle_t hContext, const void *pStart,
-                      size_t size, ur_virtual_mem_access_flags_t flags) {
+ur_result_t urVirtualMemSetAccess(ur_context_handle_t hContext,
+                                  const void *pStart, size_t size,
+                                  ur_virtual_mem_access_flags_t flags) {
   // Set access for every device in the context
   for (auto &Device : hContext->getDevices()) {
     CUmemAccessDesc AccessDesc = {};
@@ -84,31 +87,33 @@ urVirtualMemSetAccess(ur_context_handle_t hContext, const void *pStart,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urVirtualMemMap(ur_context_handle_t hContext, const void *pStart, size_t size,
-                ur_physical_mem_handle_t hPhysicalMem, size_t offset,
-                ur_virtual_mem_access_flags_t flags) {
+ur_result_t urVirtualMemMap(ur_context_handle_t hContext, const void *pStart,
+                            size_t size, ur_physical_mem_handle_t hPhysicalMem,
+                            size_t offset,
+                            ur_virtual_mem_access_flags_t flags) {
   // Map the virtual mem. Only need to do once for arbitrary context
   ScopedContext Active(hContext->getDevices()[0]);
   UR_CHECK_ERROR(
       cuMemMap((CUdeviceptr)pStart, size, offset, hPhysicalMem->get(), 0));
   if (flags)
-    UR_CHECK_ERROR(urVirtualMemSetAccess(hContext, pStart, size, flags));
+    UR_CHECK_ERROR(ur::cuda::urVirtualMemSetAccess(hContext, pStart, size,
+                                                   flags));
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemUnmap(
-    ur_context_handle_t hContext, const void *pStart, size_t size) {
+ur_result_t urVirtualMemUnmap(ur_context_handle_t hContext, const void *pStart,
+                              size_t size) {
   // Unmap the virtual mem. Only need to do once for arbitrary context
   ScopedContext Active(hContext->getDevices()[0]);
   UR_CHECK_ERROR(cuMemUnmap((CUdeviceptr)pStart, size));
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGetInfo(
-    ur_context_handle_t hContext, const void *pStart,
-    [[maybe_unused]] size_t size, ur_virtual_mem_info_t propName,
-    size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urVirtualMemGetInfo(ur_context_handle_t hContext,
+                                const void *pStart,
+                                [[maybe_unused]] size_t size,
+                                ur_virtual_mem_info_t propName, size_t propSize,
+                                void *pPropValue, size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   // Set arbitrary context
@@ -135,3 +140,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGetInfo(
   }
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::cuda
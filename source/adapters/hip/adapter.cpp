@@ -11,6 +11,7 @@
 #include "adapter.hpp"
 #include "common.hpp"
 #include "logger/ur_logger.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <atomic>
 #include <ur_api.h>
@@ -53,8 +54,10 @@ ur_adapter_handle_t_::ur_adapter_handle_t_()
 
 ur_adapter_handle_t_ adapter{};
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterGet(
-    uint32_t, ur_adapter_handle_t *phAdapters, uint32_t *pNumAdapters) {
+namespace ur::hip {
+
+ur_result_t urAdapterGet(uint32_t, ur_adapter_handle_t *phAdapters,
+                         uint32_t *pNumAdapters) {
   if (phAdapters) {
     adapter.RefCount++;
     *phAdapters = &adapter;
@@ -66,29 +69,27 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGet(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
+ur_result_t urAdapterRelease(ur_adapter_handle_t) {
   // No state to clean up so we don't need to check for 0 references
   adapter.RefCount--;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterRetain(ur_adapter_handle_t) {
+ur_result_t urAdapterRetain(ur_adapter_handle_t) {
   adapter.RefCount++;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetLastError(
-    ur_adapter_handle_t, const char **ppMessage, int32_t *pError) {
+ur_result_t urAdapterGetLastError(ur_adapter_handle_t, const char **ppMessage,
+                                  int32_t *pError) {
   *ppMessage = ErrorMessage;
   *pError = ErrorMessageCode;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
-                                                     ur_adapter_info_t propName,
-                                                     size_t propSize,
-                                                     void *pPropValue,
-                                                     size_t *pPropSizeRet) {
+ur_result_t urAdapterGetInfo(ur_adapter_handle_t, ur_adapter_info_t propName,
+                             size_t propSize, void *pPropValue,
+                             size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   switch (propName) {
@@ -102,3 +103,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
 
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::hip
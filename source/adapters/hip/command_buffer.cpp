@@ -18,6 +18,7 @@
 #include "kernel.hpp"
 #include "memory.hpp"
 #include "queue.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <cstring>
 
@@ -51,18 +52,18 @@ ur_exp_command_buffer_handle_t_::ur_exp_command_buffer_handle_t_(
     : Context(hContext), Device(hDevice),
       IsUpdatable(IsUpdatable), HIPGraph{nullptr}, HIPGraphExec{nullptr},
       RefCountInternal{1}, RefCountExternal{1}, NextSyncPoint{0} {
-  urContextRetain(hContext);
-  urDeviceRetain(hDevice);
+  ur::hip::urContextRetain(hContext);
+  ur::hip::urDeviceRetain(hDevice);
 }
 
 /// The ur_exp_command_buffer_handle_t_ destructor releases
 /// all the memory objects allocated for command_buffer managment
 ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
   // Release the memory allocated to the Context stored in the command_buffer
-  UR_TRACE(urContextRelease(Context));
+  UR_TRACE(ur::hip::urContextRelease(Context));
 
   // Release the device
-  UR_TRACE(urDeviceRelease(Device));
+  UR_TRACE(ur::hip::urDeviceRelease(Device));
 
   // Release the memory allocated to the HIPGraph
   (void)hipGraphDestroy(HIPGraph);
@@ -73,6 +74,37 @@ ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
   }
 }
 
+void ur_exp_command_buffer_handle_t_::applyPendingUpdates() {
+  bool NeedsExecUpdate = false;
+  for (auto Command : PendingUpdates) {
+    UR_CHECK_ERROR(
+        hipGraphKernelNodeSetParams(Command->Node, &Command->Params));
+    // Some ROCm versions can't update a node in place, e.g. to switch its
+    // kernel, in which case the whole executable graph is updated below
+    NeedsExecUpdate = NeedsExecUpdate ||
+                      hipGraphExecKernelNodeSetParams(
+                          HIPGraphExec, Command->Node, &Command->Params) !=
+                          hipSuccess;
+    Command->UpdatePending = false;
+  }
+  PendingUpdates.clear();
+  if (!NeedsExecUpdate) {
+    return;
+  }
+
+  // The topology of the graph doesn't change once finalized, so updating the
+  // executable graph from it avoids instantiating it again, unless the update
+  // isn't supported either
+  hipGraphNode_t ErrorNode = nullptr;
+  hipGraphExecUpdateResult UpdateResult;
+  if (hipGraphExecUpdate(HIPGraphExec, HIPGraph, &ErrorNode, &UpdateResult) !=
+      hipSuccess) {
+    UR_CHECK_ERROR(hipGraphExecDestroy(HIPGraphExec));
+    HIPGraphExec = nullptr;
+    UR_CHECK_ERROR(hipGraphInstantiateWithFlags(&HIPGraphExec, HIPGraph, 0));
+  }
+}
+
 ur_exp_command_buffer_command_handle_t_::
     ur_exp_command_buffer_command_handle_t_(
         ur_exp_command_buffer_handle_t CommandBuffer, ur_kernel_handle_t Kernel,
@@ -81,8 +113,10 @@ ur_exp_command_buffer_command_handle_t_::
         const size_t *LocalWorkSizePtr, uint32_t NumKernelAlternatives,
         ur_kernel_handle_t *KernelAlternatives)
     : CommandBuffer(CommandBuffer), Kernel(Kernel), Node(Node), Params(Params),
-      WorkDim(WorkDim), RefCountInternal(1), RefCountExternal(1) {
+      Args(Kernel->Args), WorkDim(WorkDim), RefCountInternal(1),
+      RefCountExternal(1) {
   CommandBuffer->incrementInternalReferenceCount();
+  this->Params.kernelParams = const_cast<void **>(Args.getIndices().data());
 
   const size_t CopySize = sizeof(size_t) * WorkDim;
   std::memcpy(GlobalWorkOffset, GlobalWorkOffsetPtr, CopySize);
@@ -259,10 +293,13 @@ static ur_result_t enqueueCommandBufferFillHelper(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
-    ur_context_handle_t hContext, ur_device_handle_t hDevice,
-    const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
-    ur_exp_command_buffer_handle_t *phCommandBuffer) {
+namespace ur::hip {
+
+ur_result_t
+urCommandBufferCreateExp(ur_context_handle_t hContext,
+                         ur_device_handle_t hDevice,
+                         const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
+                         ur_exp_command_buffer_handle_t *phCommandBuffer) {
   const bool IsUpdatable =
       pCommandBufferDesc ? pCommandBufferDesc->isUpdatable : false;
 
@@ -284,14 +321,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urCommandBufferRetainExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   hCommandBuffer->incrementInternalReferenceCount();
   hCommandBuffer->incrementExternalReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   if (hCommandBuffer->decrementExternalReferenceCount() == 0) {
     // External ref count has reached zero, internal release of created
@@ -304,7 +341,7 @@ urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   return commandBufferReleaseInternal(hCommandBuffer);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   try {
     const unsigned long long flags = 0;
@@ -316,7 +353,7 @@ urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
+ur_result_t urCommandBufferAppendKernelLaunchExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_kernel_handle_t hKernel,
     uint32_t workDim, const size_t *pGlobalWorkOffset,
     const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
@@ -389,21 +426,22 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
                                          DepsList.data(), DepsList.size(),
                                          &NodeParams));
 
-    if (LocalSize != 0)
-      hKernel->clearLocalSize();
-
     // Get sync point and register the node with it.
     auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
 
+    // The command copies the arguments, local sizes included, of hKernel
     auto NewCommand = new ur_exp_command_buffer_command_handle_t_{
         hCommandBuffer,      hKernel,        GraphNode,
         NodeParams,          workDim,        pGlobalWorkOffset,
         pGlobalWorkSize,     pLocalWorkSize, numKernelAlternatives,
         phKernelAlternatives};
 
+    if (LocalSize != 0)
+      hKernel->clearLocalSize();
+
     NewCommand->incrementInternalReferenceCount();
     hCommandBuffer->CommandHandles.push_back(NewCommand);
 
@@ -417,7 +455,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
+ur_result_t urCommandBufferAppendUSMMemcpyExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst, const void *pSrc,
     size_t size, uint32_t numSyncPointsInWaitList,
     const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
@@ -447,7 +485,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
+ur_result_t urCommandBufferAppendMemBufferCopyExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
     ur_mem_handle_t hDstMem, size_t srcOffset, size_t dstOffset, size_t size,
     uint32_t numSyncPointsInWaitList,
@@ -487,7 +525,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
+ur_result_t urCommandBufferAppendMemBufferCopyRectExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
     ur_mem_handle_t hDstMem, ur_rect_offset_t srcOrigin,
     ur_rect_offset_t dstOrigin, ur_rect_region_t region, size_t srcRowPitch,
@@ -530,8 +568,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
+ur_result_t urCommandBufferAppendMemBufferWriteExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
     size_t offset, size_t size, const void *pSrc,
     uint32_t numSyncPointsInWaitList,
@@ -565,8 +602,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
+ur_result_t urCommandBufferAppendMemBufferReadExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
     size_t offset, size_t size, void *pDst, uint32_t numSyncPointsInWaitList,
     const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
@@ -599,8 +635,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
+ur_result_t urCommandBufferAppendMemBufferWriteRectExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
     ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
     ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
@@ -641,8 +676,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
+ur_result_t urCommandBufferAppendMemBufferReadRectExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
     ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
     ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
@@ -683,7 +717,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
+ur_result_t urCommandBufferAppendUSMPrefetchExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, const void * /* Mem */,
     size_t /*Size*/, ur_usm_migration_flags_t /*Flags*/,
     uint32_t numSyncPointsInWaitList,
@@ -716,7 +750,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
+ur_result_t urCommandBufferAppendUSMAdviseExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, const void * /* Mem */,
     size_t /*Size*/, ur_usm_advice_flags_t /*Advice*/,
     uint32_t numSyncPointsInWaitList,
@@ -749,7 +783,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
+ur_result_t urCommandBufferAppendMemBufferFillExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
     const void *pPattern, size_t patternSize, size_t offset, size_t size,
     uint32_t numSyncPointsInWaitList,
@@ -776,7 +810,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
       size, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
+ur_result_t urCommandBufferAppendUSMFillExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, void *pPtr,
     const void *pPattern, size_t patternSize, size_t size,
     uint32_t numSyncPointsInWaitList,
@@ -796,10 +830,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
       numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
+ur_result_t urCommandBufferEnqueueExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
+  hQueue->Telemetry.commandSubmittedAsBatch(
+      UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP);
+
   try {
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
     ScopedDevice Active(hQueue->getDevice());
@@ -818,6 +855,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
       UR_CHECK_ERROR(RetImplEvent->start());
     }
 
+    // Set the parameters of the nodes updated since the last launch
+    hCommandBuffer->applyPendingUpdates();
+
     // Launch graph
     UR_CHECK_ERROR(hipGraphLaunch(hCommandBuffer->HIPGraphExec, HIPStream));
 
@@ -832,18 +872,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
+ur_result_t urCommandBufferRetainCommandExp(
     ur_exp_command_buffer_command_handle_t hCommand) {
   hCommand->incrementExternalReferenceCount();
   hCommand->incrementInternalReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
+ur_result_t urCommandBufferReleaseCommandExp(
     ur_exp_command_buffer_command_handle_t hCommand) {
   hCommand->decrementExternalReferenceCount();
   return commandHandleReleaseInternal(hCommand);
 }
+} // namespace ur::hip
 
 /**
  * Validates contents of the update command description.
@@ -878,18 +919,21 @@ validateCommandDesc(ur_exp_command_buffer_command_handle_t Command,
 }
 
 /**
- * Updates the arguments of CommandDesc->hNewKernel
+ * Updates the arguments of the command, only rewriting those in the update
+ * description.
  * @param[in] Device The device associated with the kernel being updated.
+ * @param[in] Command The command whose arguments are updated.
  * @param[in] UpdateCommandDesc The update command description that contains
- * the new kernel and its arguments.
+ * the new arguments.
  * @return UR_RESULT_SUCCESS or an error code on failure
  */
 ur_result_t
 updateKernelArguments(ur_device_handle_t Device,
+                      ur_exp_command_buffer_command_handle_t Command,
                       const ur_exp_command_buffer_update_kernel_launch_desc_t
                           *UpdateCommandDesc) {
 
-  ur_kernel_handle_t NewKernel = UpdateCommandDesc->hNewKernel;
+  auto &Args = Command->Args;
 
   // Update pointer arguments to the kernel
   uint32_t NumPointerArgs = UpdateCommandDesc->numNewPointerArgs;
@@ -901,7 +945,7 @@ updateKernelArguments(ur_device_handle_t Device,
     const void *ArgValue = PointerArgDesc.pNewPointerArg;
 
     try {
-      NewKernel->setKernelArg(ArgIndex, sizeof(ArgValue), ArgValue);
+      Args.addArg(ArgIndex, sizeof(ArgValue), ArgValue);
     } catch (ur_result_t Err) {
       return Err;
     }
@@ -918,10 +962,10 @@ updateKernelArguments(ur_device_handle_t Device,
 
     try {
       if (ArgValue == nullptr) {
-        NewKernel->setKernelArg(ArgIndex, 0, nullptr);
+        Args.addArg(ArgIndex, 0, nullptr);
       } else {
         void *HIPPtr = std::get<BufferMem>(ArgValue->Mem).getVoid(Device);
-        NewKernel->setKernelArg(ArgIndex, sizeof(void *), (void *)&HIPPtr);
+        Args.addArg(ArgIndex, sizeof(void *), (void *)&HIPPtr);
       }
     } catch (ur_result_t Err) {
       return Err;
@@ -939,7 +983,7 @@ updateKernelArguments(ur_device_handle_t Device,
     const void *ArgValue = ValueArgDesc.pNewValueArg;
 
     try {
-      NewKernel->setKernelArg(ArgIndex, ArgSize, ArgValue);
+      Args.addArg(ArgIndex, ArgSize, ArgValue);
     } catch (ur_result_t Err) {
       return Err;
     }
@@ -960,8 +1004,10 @@ updateCommand(ur_exp_command_buffer_command_handle_t Command,
               const ur_exp_command_buffer_update_kernel_launch_desc_t
                   *UpdateCommandDesc) {
 
-  if (UpdateCommandDesc->hNewKernel) {
+  if (UpdateCommandDesc->hNewKernel &&
+      UpdateCommandDesc->hNewKernel != Command->Kernel) {
     Command->Kernel = UpdateCommandDesc->hNewKernel;
+    Command->Args = Command->Kernel->Args;
   }
 
   if (UpdateCommandDesc->hNewKernel) {
@@ -986,7 +1032,9 @@ updateCommand(ur_exp_command_buffer_command_handle_t Command,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
+namespace ur::hip {
+
+ur_result_t urCommandBufferUpdateKernelLaunchExp(
     ur_exp_command_buffer_command_handle_t hCommand,
     const ur_exp_command_buffer_update_kernel_launch_desc_t
         *pUpdateKernelLaunch) {
@@ -994,9 +1042,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
   ur_exp_command_buffer_handle_t CommandBuffer = hCommand->CommandBuffer;
 
   UR_CHECK_ERROR(validateCommandDesc(hCommand, pUpdateKernelLaunch));
-  UR_CHECK_ERROR(
-      updateKernelArguments(CommandBuffer->Device, pUpdateKernelLaunch));
   UR_CHECK_ERROR(updateCommand(hCommand, pUpdateKernelLaunch));
+  UR_CHECK_ERROR(updateKernelArguments(CommandBuffer->Device, hCommand,
+                                       pUpdateKernelLaunch));
 
   // If no worksize is provided make sure we pass nullptr to setKernelParams
   // so it can guess the local work size.
@@ -1022,20 +1070,30 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
   Params.blockDim.x = ThreadsPerBlock[0];
   Params.blockDim.y = ThreadsPerBlock[1];
   Params.blockDim.z = ThreadsPerBlock[2];
-  Params.sharedMemBytes = hCommand->Kernel->getLocalSize();
+  Params.sharedMemBytes = hCommand->Args.getLocalSize();
   Params.kernelParams =
-      const_cast<void **>(hCommand->Kernel->getArgIndices().data());
-
-  hipGraphNode_t Node = hCommand->Node;
-  hipGraphExec_t HipGraphExec = CommandBuffer->HIPGraphExec;
-  UR_CHECK_ERROR(hipGraphExecKernelNodeSetParams(HipGraphExec, Node, &Params));
+      const_cast<void **>(hCommand->Args.getIndices().data());
+
+  // setKernelParams sets the implicit offset of the kernel
+  auto &KernelArgs = hCommand->Kernel->Args;
+  hCommand->Args.setImplicitOffset(sizeof(KernelArgs.ImplicitOffsetArgs),
+                                   KernelArgs.ImplicitOffsetArgs);
+
+  // The node is updated with the others at the next enqueue, the parameters
+  // of a node only being set once however many updates it had since the
+  // last launch
+  if (!hCommand->UpdatePending) {
+    hCommand->UpdatePending = true;
+    CommandBuffer->PendingUpdates.push_back(hCommand);
+  }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferGetInfoExp(
-    ur_exp_command_buffer_handle_t hCommandBuffer,
-    ur_exp_command_buffer_info_t propName, size_t propSize, void *pPropValue,
-    size_t *pPropSizeRet) {
+ur_result_t
+urCommandBufferGetInfoExp(ur_exp_command_buffer_handle_t hCommandBuffer,
+                          ur_exp_command_buffer_info_t propName,
+                          size_t propSize, void *pPropValue,
+                          size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   switch (propName) {
@@ -1048,7 +1106,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferGetInfoExp(
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
+ur_result_t urCommandBufferCommandGetInfoExp(
     ur_exp_command_buffer_command_handle_t hCommand,
     ur_exp_command_buffer_command_info_t propName, size_t propSize,
     void *pPropValue, size_t *pPropSizeRet) {
@@ -1063,3 +1121,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
 
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
+} // namespace ur::hip
@@ -13,6 +13,7 @@
 #include <ur_print.hpp>
 
 #include "context.hpp"
+#include "kernel.hpp"
 #include <hip/hip_runtime.h>
 #include <memory>
 #include <unordered_set>
@@ -111,6 +112,14 @@ struct ur_exp_command_buffer_command_handle_t_ {
   hipGraphNode_t Node;
   hipKernelNodeParams Params;
 
+  // The arguments of the node, copied from Kernel on append or when the
+  // command switches to another kernel, so that an update only rewrites the
+  // arguments it changes. Params.kernelParams points into them.
+  ur_kernel_handle_t_::arguments Args;
+
+  // Whether the command is in CommandBuffer->PendingUpdates
+  bool UpdatePending = false;
+
   uint32_t WorkDim;
   size_t GlobalWorkOffset[3];
   size_t GlobalWorkSize[3];
@@ -146,6 +155,10 @@ struct ur_exp_command_buffer_handle_t_ {
     registerSyncPoint(SyncPoint, std::move(HIPNode));
     return SyncPoint;
   }
+
+  // Sets the parameters of the nodes in PendingUpdates in HIPGraphExec
+  void applyPendingUpdates();
+
   uint32_t incrementInternalReferenceCount() noexcept {
     return ++RefCountInternal;
   }
@@ -190,4 +203,9 @@ struct ur_exp_command_buffer_handle_t_ {
 
   // Handles to individual commands in the command-buffer
   std::vector<ur_exp_command_buffer_command_handle_t> CommandHandles;
+  // Commands updated since the executable graph was last launched, whose
+  // node parameters are set in a single pass before the next launch. The
+  // nodes of HIPGraph are kept in sync, so that HIPGraphExec can be updated
+  // from it as a whole.
+  std::vector<ur_exp_command_buffer_command_handle_t> PendingUpdates;
 };
@@ -19,6 +19,8 @@
 #include <hip/hip_runtime.h>
 #include <ur/ur.hpp>
 
+#include "ur_interface_loader.hpp"
+
 // Before ROCm 6, hipify doesn't support cuArrayGetDescriptor, on AMD the
 // hipArray can just be indexed, but on NVidia it is an opaque type and needs to
 // go through cuArrayGetDescriptor so implement a utility function to get the
@@ -140,31 +142,31 @@ private:
   T Captive;
 
   static ur_result_t callRelease(ur_device_handle_t Captive) {
-    return urDeviceRelease(Captive);
+    return ur::hip::urDeviceRelease(Captive);
   }
 
   static ur_result_t callRelease(ur_context_handle_t Captive) {
-    return urContextRelease(Captive);
+    return ur::hip::urContextRelease(Captive);
   }
 
   static ur_result_t callRelease(ur_mem_handle_t Captive) {
-    return urMemRelease(Captive);
+    return ur::hip::urMemRelease(Captive);
   }
 
   static ur_result_t callRelease(ur_program_handle_t Captive) {
-    return urProgramRelease(Captive);
+    return ur::hip::urProgramRelease(Captive);
   }
 
   static ur_result_t callRelease(ur_kernel_handle_t Captive) {
-    return urKernelRelease(Captive);
+    return ur::hip::urKernelRelease(Captive);
   }
 
   static ur_result_t callRelease(ur_queue_handle_t Captive) {
-    return urQueueRelease(Captive);
+    return ur::hip::urQueueRelease(Captive);
   }
 
   static ur_result_t callRelease(ur_event_handle_t Captive) {
-    return urEventRelease(Captive);
+    return ur::hip::urEventRelease(Captive);
   }
 
 public:
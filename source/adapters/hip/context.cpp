@@ -9,7 +9,9 @@
 //===----------------------------------------------------------------------===//
 
 #include "context.hpp"
+#include "queue.hpp"
 #include "usm.hpp"
+#include "ur_interface_loader.hpp"
 
 void ur_context_handle_t_::addPool(ur_usm_pool_handle_t Pool) {
   std::lock_guard<std::mutex> Lock(Mutex);
@@ -21,6 +23,39 @@ void ur_context_handle_t_::removePool(ur_usm_pool_handle_t Pool) {
   PoolHandles.erase(Pool);
 }
 
+size_t ur_context_handle_t_::hostRegisterCacheSize() {
+  static const size_t Size =
+      getenv_to_unsigned("UR_HIP_HOST_REGISTER_CACHE_SIZE").value_or(0);
+  return Size;
+}
+
+static ur_result_t unregisterHost(void *HostPtr) {
+  return mapErrorUR(hipHostUnregister(HostPtr));
+}
+
+ur_result_t ur_context_handle_t_::registerHostPtr(void *HostPtr, size_t Size) {
+  ScopedDevice Active(Devices[0]);
+  // Portable, so that it is pinned for all the devices
+  auto Register = [](void *Ptr, size_t Bytes) {
+    return mapErrorUR(hipHostRegister(
+        Ptr, Bytes, hipHostRegisterPortable | hipHostRegisterMapped));
+  };
+  return HostRegisterCache.acquire(HostPtr, Size, Register, unregisterHost);
+}
+
+ur_result_t ur_context_handle_t_::unregisterHostPtr(void *HostPtr) {
+  ScopedDevice Active(Devices[0]);
+  return HostRegisterCache.release(HostPtr, unregisterHost);
+}
+
+void ur_context_handle_t_::clearHostRegisterCache() {
+  try {
+    ScopedDevice Active(Devices[0]);
+    HostRegisterCache.clear(unregisterHost);
+  } catch (...) {
+  }
+}
+
 ur_usm_pool_handle_t
 ur_context_handle_t_::getOwningURPool(umf_memory_pool_t *UMFPool) {
   std::lock_guard<std::mutex> Lock(Mutex);
@@ -32,11 +67,169 @@ ur_context_handle_t_::getOwningURPool(umf_memory_pool_t *UMFPool) {
   return nullptr;
 }
 
+hipEvent_t ur_context_handle_t_::getEvent(ur_device_handle_t hDevice,
+                                          bool Timing) {
+  {
+    std::lock_guard<std::mutex> Lock(EventPoolsMutex);
+    auto &Pool = EventPools[getDeviceIndex(hDevice)][Timing];
+    if (!Pool.empty()) {
+      hipEvent_t Event = Pool.back();
+      Pool.pop_back();
+      return Event;
+    }
+  }
+  hipEvent_t Event;
+  UR_CHECK_ERROR(hipEventCreateWithFlags(&Event, Timing ? hipEventDefault
+                                                 : hipEventDisableTiming));
+  return Event;
+}
+
+void ur_context_handle_t_::recycleEvent(ur_device_handle_t hDevice,
+                                        bool Timing, hipEvent_t Event) {
+  {
+    std::lock_guard<std::mutex> Lock(EventPoolsMutex);
+    auto &Pool = EventPools[getDeviceIndex(hDevice)][Timing];
+    if (Pool.size() < MaxPooledEvents) {
+      Pool.push_back(Event);
+      return;
+    }
+  }
+  UR_CHECK_ERROR(hipEventDestroy(Event));
+}
+
+void ur_context_handle_t_::destroyEvents() {
+  for (auto &Pools : EventPools) {
+    for (auto &Pool : Pools) {
+      for (hipEvent_t Event : Pool) {
+        hipEventDestroy(Event);
+      }
+    }
+  }
+}
+
+void ur_context_handle_t_::addQueue(ur_queue_handle_t hQueue) {
+  std::lock_guard<std::mutex> Lock(QueuesMutex);
+  Queues.insert(hQueue);
+}
+
+void ur_context_handle_t_::removeQueue(ur_queue_handle_t hQueue) {
+  std::lock_guard<std::mutex> Lock(QueuesMutex);
+  Queues.erase(hQueue);
+}
+
+bool ur_context_handle_t_::isDeferredFreeEnabled() {
+  static const bool Enabled = getenv_tobool("UR_HIP_USM_DEFERRED_FREE");
+  return Enabled;
+}
+
+ur_result_t ur_context_handle_t_::deferFree(void *Ptr) {
+  ur_result_t Result = reclaimDeferredFrees();
+
+  // The allocation isn't tracked per command, as kernels access memory
+  // indirectly, so the free waits for all the streams with pending commands
+  std::vector<deferred_free_marker_t> Markers;
+  try {
+    std::lock_guard<std::mutex> Lock(QueuesMutex);
+    for (ur_queue_handle_t Queue : Queues) {
+      ur_device_handle_t Device = Queue->getDevice();
+      ScopedDevice Active(Device);
+      Queue->forEachStream([&](hipStream_t Stream) {
+        if (hipStreamQuery(Stream) == hipSuccess) {
+          return;
+        }
+        hipEvent_t Event = getEvent(Device, false);
+        Markers.push_back({Device, Event});
+        UR_CHECK_ERROR(hipEventRecord(Event, Stream));
+      });
+    }
+  } catch (ur_result_t Err) {
+    // Without all the markers the memory can only be freed once idle
+    for (deferred_free_marker_t &Marker : Markers) {
+      std::ignore = hipEventDestroy(Marker.Event);
+    }
+    Markers.clear();
+    std::lock_guard<std::mutex> Lock(QueuesMutex);
+    for (ur_queue_handle_t Queue : Queues) {
+      Queue->forEachStream([](hipStream_t Stream) {
+        std::ignore = hipStreamSynchronize(Stream);
+      });
+    }
+    if (Err != UR_RESULT_SUCCESS) {
+      Result = Err;
+    }
+  }
+
+  if (Markers.empty()) {
+    ur_result_t FreeResult = USMFreeNow(this, Ptr);
+    return FreeResult != UR_RESULT_SUCCESS ? FreeResult : Result;
+  }
+  DeferredFrees.defer(Ptr, std::move(Markers));
+  return Result;
+}
+
+ur_result_t
+ur_context_handle_t_::reclaimDeferredFrees(bool WaitForMarkers) {
+  auto IsDone = [WaitForMarkers](deferred_free_marker_t &Marker) {
+    if (WaitForMarkers) {
+      std::ignore = hipEventSynchronize(Marker.Event);
+      return true;
+    }
+    return hipEventQuery(Marker.Event) != hipErrorNotReady;
+  };
+  auto Retire = [this](deferred_free_marker_t &Marker) {
+    try {
+      recycleEvent(Marker.Device, false, Marker.Event);
+    } catch (...) {
+    }
+  };
+  auto Free = [this](void *Ptr) { return USMFreeNow(this, Ptr); };
+  return DeferredFrees.reclaim(IsDone, Retire, Free);
+}
+
+#if HIP_VERSION >= 50200000
+hipMemPool_t
+ur_context_handle_t_::getAsyncMemPool(ur_device_handle_t hDevice) {
+  std::lock_guard<std::mutex> Lock(AsyncMemPoolsMutex);
+  hipMemPool_t &Pool = AsyncMemPools[getDeviceIndex(hDevice)];
+  if (Pool ||
+      !getAttribute(hDevice, hipDeviceAttributeMemoryPoolsSupported)) {
+    return Pool;
+  }
+
+  hipMemPoolProps Props{};
+  Props.allocType = hipMemAllocationTypePinned;
+  Props.handleTypes = hipMemHandleTypeNone;
+  Props.location.type = hipMemLocationTypeDevice;
+  Props.location.id = hDevice->get();
+  UR_CHECK_ERROR(hipMemPoolCreate(&Pool, &Props));
+
+  static const uint64_t ReleaseThreshold = [] {
+    const char *EnvVar = std::getenv("UR_HIP_USM_ASYNC_RELEASE_THRESHOLD");
+    return EnvVar ? std::strtoull(EnvVar, nullptr, 10) : UINT64_MAX;
+  }();
+  uint64_t Threshold = ReleaseThreshold;
+  UR_CHECK_ERROR(hipMemPoolSetAttribute(
+      Pool, hipMemPoolAttrReleaseThreshold, &Threshold));
+  return Pool;
+}
+
+void ur_context_handle_t_::destroyAsyncMemPools() {
+  for (hipMemPool_t Pool : AsyncMemPools) {
+    if (Pool) {
+      hipMemPoolDestroy(Pool);
+    }
+  }
+}
+#endif // HIP_VERSION >= 50200000
+
+namespace ur::hip {
+
 /// Create a UR context.
 ///
-UR_APIEXPORT ur_result_t UR_APICALL urContextCreate(
-    uint32_t DeviceCount, const ur_device_handle_t *phDevices,
-    const ur_context_properties_t *, ur_context_handle_t *phContext) {
+ur_result_t urContextCreate(uint32_t DeviceCount,
+                            const ur_device_handle_t *phDevices,
+                            const ur_context_properties_t *,
+                            ur_context_handle_t *phContext) {
   ur_result_t RetErr = UR_RESULT_SUCCESS;
 
   std::unique_ptr<ur_context_handle_t_> ContextPtr{nullptr};
@@ -55,9 +248,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextCreate(
   return RetErr;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
-                 size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urContextGetInfo(ur_context_handle_t hContext,
+                             ur_context_info_t propName, size_t propSize,
+                             void *pPropValue, size_t *pPropSizeRet) {
 
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
@@ -91,8 +284,7 @@ urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextRelease(ur_context_handle_t hContext) {
+ur_result_t urContextRelease(ur_context_handle_t hContext) {
   if (hContext->decrementReferenceCount() == 0) {
     hContext->invokeExtendedDeleters();
     delete hContext;
@@ -100,8 +292,7 @@ urContextRelease(ur_context_handle_t hContext) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextRetain(ur_context_handle_t hContext) {
+ur_result_t urContextRetain(ur_context_handle_t hContext) {
   assert(hContext->getReferenceCount() > 0);
 
   hContext->incrementReferenceCount();
@@ -111,7 +302,7 @@ urContextRetain(ur_context_handle_t hContext) {
 // urContextGetNativeHandle should not be implemented in the HIP backend.
 // hipCtx_t is not natively supported by amd devices, and more importantly does
 // not map to ur_context_handle_t in any way.
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urContextGetNativeHandle([[maybe_unused]] ur_context_handle_t hContext,
                          [[maybe_unused]] ur_native_handle_t *phNativeContext) {
   std::ignore = hContext;
@@ -119,7 +310,7 @@ urContextGetNativeHandle([[maybe_unused]] ur_context_handle_t hContext,
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextCreateWithNativeHandle(
+ur_result_t urContextCreateWithNativeHandle(
     [[maybe_unused]] ur_native_handle_t hNativeContext,
     [[maybe_unused]] ur_adapter_handle_t hAdapter,
     [[maybe_unused]] uint32_t numDevices,
@@ -129,9 +320,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextCreateWithNativeHandle(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextSetExtendedDeleter(
-    ur_context_handle_t hContext, ur_context_extended_deleter_t pfnDeleter,
-    void *pUserData) {
+ur_result_t
+urContextSetExtendedDeleter(ur_context_handle_t hContext,
+                            ur_context_extended_deleter_t pfnDeleter,
+                            void *pUserData) {
   hContext->setExtendedDeleter(pfnDeleter, pUserData);
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::hip
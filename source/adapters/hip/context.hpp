@@ -9,11 +9,17 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <array>
 #include <set>
+#include <tuple>
 
 #include "common.hpp"
 #include "device.hpp"
 #include "platform.hpp"
+#include "staging.hpp"
+#include "ur_deferred_frees.hpp"
+#include "ur_host_register_cache.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <umf/memory_pool.h>
 
@@ -90,13 +96,24 @@ struct ur_context_handle_t_ {
   std::atomic_uint32_t RefCount;
 
   ur_context_handle_t_(const ur_device_handle_t *Devs, uint32_t NumDevices)
-      : Devices{Devs, Devs + NumDevices}, RefCount{1} {
+      : Devices{Devs, Devs + NumDevices}, RefCount{1},
+        EventPools(NumDevices), HostRegisterCache(hostRegisterCacheSize()) {
     for (auto &Dev : Devices) {
-      urDeviceRetain(Dev);
+      ur::hip::urDeviceRetain(Dev);
     }
+#if HIP_VERSION >= 50200000
+    AsyncMemPools.resize(NumDevices);
+#endif
   };
 
-  ~ur_context_handle_t_() {}
+  ~ur_context_handle_t_() {
+    std::ignore = reclaimDeferredFrees(/*WaitForMarkers=*/true);
+    clearHostRegisterCache();
+    destroyEvents();
+#if HIP_VERSION >= 50200000
+    destroyAsyncMemPools();
+#endif
+  }
 
   void invokeExtendedDeleters() {
     std::lock_guard<std::mutex> Guard(Mutex);
@@ -134,8 +151,81 @@ struct ur_context_handle_t_ {
 
   ur_usm_pool_handle_t getOwningURPool(umf_memory_pool_t *UMFPool);
 
+  // The number of released native events kept for each device and kind
+  static constexpr size_t MaxPooledEvents = 1024;
+
+  // A native event for a command on the device, with or without timing,
+  // recycled from a released UR event if there is one, so that the enqueues
+  // don't create and destroy one for each event they return. A new event
+  // belongs to the current native context.
+  hipEvent_t getEvent(ur_device_handle_t hDevice, bool Timing);
+
+  // Keeps an event which is no longer used for getEvent
+  void recycleEvent(ur_device_handle_t hDevice, bool Timing, hipEvent_t Event);
+
+  // The pinned chunks staging the copies from and to pageable memory
+  ur_staging_pool_t_ &getStagingPool() noexcept { return StagingPool; }
+
+  // Registers [HostPtr, HostPtr + Size) for the access of the devices of the
+  // context, sharing the registration of the range containing it with the
+  // other buffers wrapping it. Up to UR_HIP_HOST_REGISTER_CACHE_SIZE ranges
+  // (none by default) stay registered once released by unregisterHostPtr,
+  // for the next buffers wrapping them.
+  ur_result_t registerHostPtr(void *HostPtr, size_t Size);
+  ur_result_t unregisterHostPtr(void *HostPtr);
+
+  // The queues of the context, for the markers of the deferred frees
+  void addQueue(ur_queue_handle_t hQueue);
+  void removeQueue(ur_queue_handle_t hQueue);
+
+  // Whether UR_HIP_USM_DEFERRED_FREE makes urUSMFree defer the frees of the
+  // memory while the queues of the context have commands pending
+  static bool isDeferredFreeEnabled();
+
+  // Frees Ptr once the commands pending on the queues of the context when
+  // called have completed, right away if there are none, as any of them may
+  // use the memory
+  ur_result_t deferFree(void *Ptr);
+
+  // Frees the memory of the deferred frees whose commands have completed,
+  // called by the USM entry points. WaitForMarkers waits for the commands
+  // of all of them, before their pools are destroyed.
+  ur_result_t reclaimDeferredFrees(bool WaitForMarkers = false);
+
+#if HIP_VERSION >= 50200000
+  // The memory pool of the stream ordered allocations on the device, created
+  // on first use, nullptr if the device doesn't support memory pools. The
+  // pool keeps the memory freed to it for the next allocations, up to
+  // UR_HIP_USM_ASYNC_RELEASE_THRESHOLD bytes and all of it by default.
+  hipMemPool_t getAsyncMemPool(ur_device_handle_t hDevice);
+#endif
+
 private:
+  static size_t hostRegisterCacheSize();
+  void clearHostRegisterCache();
+  void destroyEvents();
+#if HIP_VERSION >= 50200000
+  void destroyAsyncMemPools();
+#endif
+
   std::mutex Mutex;
   std::vector<deleter_data> ExtendedDeleters;
   std::set<ur_usm_pool_handle_t> PoolHandles;
+  std::mutex EventPoolsMutex;
+  // For each device, the events without and with timing
+  std::vector<std::array<std::vector<hipEvent_t>, 2>> EventPools;
+  ur_staging_pool_t_ StagingPool;
+  ur::host_register_cache_t HostRegisterCache;
+  std::mutex QueuesMutex;
+  std::set<ur_queue_handle_t> Queues;
+  // An event recorded on a stream of a queue of the device
+  struct deferred_free_marker_t {
+    ur_device_handle_t Device;
+    hipEvent_t Event;
+  };
+  ur::deferred_frees_t<deferred_free_marker_t> DeferredFrees;
+#if HIP_VERSION >= 50200000
+  std::mutex AsyncMemPoolsMutex;
+  std::vector<hipMemPool_t> AsyncMemPools;
+#endif
 };
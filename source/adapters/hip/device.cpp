@@ -12,6 +12,7 @@
 #include "adapter.hpp"
 #include "context.hpp"
 #include "event.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <sstream>
 
@@ -33,11 +34,9 @@ uint64_t ur_device_handle_t_::getElapsedTime(hipEvent_t ev) const {
   return static_cast<uint64_t>(Milliseconds * 1.0e6);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
-                                                    ur_device_info_t propName,
-                                                    size_t propSize,
-                                                    void *pPropValue,
-                                                    size_t *pPropSizeRet) {
+static ur_result_t getDeviceInfo(ur_device_handle_t hDevice,
+                                 ur_device_info_t propName, size_t propSize,
+                                 void *pPropValue, size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   static constexpr uint32_t MaxWorkItemDimensions = 3u;
@@ -937,29 +936,39 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
+namespace ur::hip {
+
+ur_result_t urDeviceGetInfo(ur_device_handle_t hDevice,
+                            ur_device_info_t propName, size_t propSize,
+                            void *pPropValue, size_t *pPropSizeRet) {
+  return hDevice->getInfoCache().get(
+      propName, propSize, pPropValue, pPropSizeRet,
+      [hDevice, propName](size_t Size, void *Value, size_t *SizeRet) {
+        return getDeviceInfo(hDevice, propName, Size, Value, SizeRet);
+      });
+}
+
 /// \return UR_RESULT_SUCCESS if the function is executed successfully
 /// HIP devices are always root devices so retain always returns success.
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceRetain(ur_device_handle_t) {
+ur_result_t urDeviceRetain(ur_device_handle_t) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urDevicePartition(ur_device_handle_t, const ur_device_partition_properties_t *,
-                  uint32_t, ur_device_handle_t *, uint32_t *) {
+ur_result_t urDevicePartition(ur_device_handle_t,
+                              const ur_device_partition_properties_t *,
+                              uint32_t, ur_device_handle_t *, uint32_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
 /// \return UR_RESULT_SUCCESS always since HIP devices are always root
 /// devices.
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceRelease(ur_device_handle_t) {
+ur_result_t urDeviceRelease(ur_device_handle_t) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGet(ur_platform_handle_t hPlatform,
-                                                ur_device_type_t DeviceType,
-                                                uint32_t NumEntries,
-                                                ur_device_handle_t *phDevices,
-                                                uint32_t *pNumDevices) {
+ur_result_t urDeviceGet(ur_platform_handle_t hPlatform,
+                        ur_device_type_t DeviceType, uint32_t NumEntries,
+                        ur_device_handle_t *phDevices, uint32_t *pNumDevices) {
   ur_result_t Err = UR_RESULT_SUCCESS;
   const bool AskingForDefault = DeviceType == UR_DEVICE_TYPE_DEFAULT;
   const bool AskingForGPU = DeviceType == UR_DEVICE_TYPE_GPU;
@@ -995,13 +1004,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGet(ur_platform_handle_t hPlatform,
 /// \param[out] phNativeHandle Set to the native handle of the UR device object.
 ///
 /// \return UR_RESULT_SUCCESS
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetNativeHandle(
-    ur_device_handle_t hDevice, ur_native_handle_t *phNativeHandle) {
+ur_result_t urDeviceGetNativeHandle(ur_device_handle_t hDevice,
+                                    ur_native_handle_t *phNativeHandle) {
   *phNativeHandle = hDevice->get();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
+ur_result_t urDeviceCreateWithNativeHandle(
     ur_native_handle_t hNativeDevice,
     [[maybe_unused]] ur_adapter_handle_t hAdapter,
     [[maybe_unused]] const ur_device_native_properties_t *pProperties,
@@ -1019,7 +1028,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
   uint32_t NumPlatforms = 0;
   ur_adapter_handle_t AdapterHandle = &adapter;
   ur_result_t Result =
-      urPlatformGet(&AdapterHandle, 1, 0, nullptr, &NumPlatforms);
+      ur::hip::urPlatformGet(&AdapterHandle, 1, 0, nullptr, &NumPlatforms);
   if (Result != UR_RESULT_SUCCESS)
     return Result;
 
@@ -1029,7 +1038,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
 
   ur_platform_handle_t Platform = nullptr;
 
-  Result = urPlatformGet(&AdapterHandle, 1, NumPlatforms, &Platform, nullptr);
+  Result = ur::hip::urPlatformGet(&AdapterHandle, 1, NumPlatforms, &Platform,
+                                  nullptr);
   if (Result != UR_RESULT_SUCCESS)
     return Result;
 
@@ -1049,9 +1059,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
 
 /// \return UR_RESULT_SUCCESS If available, the first binary that is PTX
 ///
-UR_APIEXPORT ur_result_t UR_APICALL
-urDeviceSelectBinary(ur_device_handle_t, const ur_device_binary_t *pBinaries,
-                     uint32_t NumBinaries, uint32_t *pSelectedBinary) {
+ur_result_t urDeviceSelectBinary(ur_device_handle_t,
+                                 const ur_device_binary_t *pBinaries,
+                                 uint32_t NumBinaries,
+                                 uint32_t *pSelectedBinary) {
   // Ignore unused parameter
   UR_ASSERT(NumBinaries > 0, UR_RESULT_ERROR_INVALID_ARGUMENT);
 
@@ -1074,10 +1085,11 @@ urDeviceSelectBinary(ur_device_handle_t, const ur_device_binary_t *pBinaries,
   // No image can be loaded for the given device
   return UR_RESULT_ERROR_INVALID_BINARY;
 }
+} // namespace ur::hip
 
-ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(ur_device_handle_t hDevice,
-                                                   uint64_t *pDeviceTimestamp,
-                                                   uint64_t *pHostTimestamp) {
+static ur_result_t queryGlobalTimestamps(ur_device_handle_t hDevice,
+                                         uint64_t *pDeviceTimestamp,
+                                         uint64_t *pHostTimestamp) {
   if (!pDeviceTimestamp && !pHostTimestamp)
     return UR_RESULT_SUCCESS;
 
@@ -1098,3 +1110,17 @@ ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(ur_device_handle_t hDevice,
   }
   return UR_RESULT_SUCCESS;
 }
+
+ur_result_t UR_APICALL ur::hip::urDeviceGetGlobalTimestamps(
+    ur_device_handle_t hDevice, uint64_t *pDeviceTimestamp,
+    uint64_t *pHostTimestamp) {
+  auto &Calibration = hDevice->getClockCalibration();
+  if (!Calibration.enabled()) {
+    return queryGlobalTimestamps(hDevice, pDeviceTimestamp, pHostTimestamp);
+  }
+  return Calibration.getTimestamps(
+      pDeviceTimestamp, pHostTimestamp,
+      [hDevice](ur::clock_calibration_t::sample_t &Sample) {
+        return queryGlobalTimestamps(hDevice, &Sample.device, &Sample.host);
+      });
+}
@@ -12,6 +12,7 @@
 #include "common.hpp"
 
 #include <ur/ur.hpp>
+#include <ur_clock_calibration.hpp>
 
 /// UR device mapping to a hipDevice_t.
 /// Includes an observer pointer to the platform,
@@ -34,6 +35,8 @@ private:
   int DeviceMaxLocalMem{0};
   int ManagedMemSupport{0};
   int ConcurrentManagedAccess{0};
+  UrDeviceInfoCache InfoCache;
+  ur::clock_calibration_t ClockCalibration;
 
 public:
   ur_device_handle_t_(native_type HipDevice, hipEvent_t EvBase,
@@ -69,6 +72,12 @@ public:
 
   uint64_t getElapsedTime(hipEvent_t) const;
 
+  // Answers urDeviceGetGlobalTimestamps without calling the driver, when
+  // enabled
+  ur::clock_calibration_t &getClockCalibration() noexcept {
+    return ClockCalibration;
+  }
+
   // Returns the index of the device relative to the other devices in the same
   // platform
   uint32_t getIndex() const noexcept { return DeviceIndex; };
@@ -88,6 +97,9 @@ public:
   int getConcurrentManagedAccess() const noexcept {
     return ConcurrentManagedAccess;
   };
+
+  // The results of urDeviceGetInfo, the free memory is queried every time
+  UrDeviceInfoCache &getInfoCache() noexcept { return InfoCache; };
 };
 
 int getAttribute(ur_device_handle_t Device, hipDeviceAttribute_t Attribute);
@@ -13,9 +13,11 @@
 #include "context.hpp"
 #include "event.hpp"
 #include "kernel.hpp"
+#include "latency_tracker.hpp"
 #include "memory.hpp"
 #include "queue.hpp"
 #include "ur_api.h"
+#include "ur_interface_loader.hpp"
 
 #include <ur/ur.hpp>
 
@@ -32,7 +34,9 @@ ur_result_t enqueueEventsWait(ur_queue_handle_t Queue, hipStream_t Stream,
         EventWaitList, NumEventsInWaitList,
         [Stream, Queue](ur_event_handle_t Event) -> ur_result_t {
           ScopedDevice Active(Queue->getDevice());
-          if (Event->isCompleted() || Event->getStream() == Stream) {
+          // The commands of the stream already run after the event, and a
+          // completed event has nothing left to wait for
+          if (Event->getStream() == Stream || Event->isCompleted()) {
             return UR_RESULT_SUCCESS;
           } else {
             UR_CHECK_ERROR(hipStreamWaitEvent(Stream, Event->get(), 0));
@@ -52,9 +56,18 @@ ur_result_t enqueueEventsWait(ur_queue_handle_t Queue, hipStream_t Stream,
 // dimension.
 void guessLocalWorkSize(ur_device_handle_t Device, size_t *ThreadsPerBlock,
                         const size_t *GlobalWorkSize, const uint32_t WorkDim,
-                        const size_t MaxThreadsPerBlock[3]) {
+                        const size_t MaxThreadsPerBlock[3],
+                        ur_kernel_handle_t Kernel) {
   assert(ThreadsPerBlock != nullptr);
   assert(GlobalWorkSize != nullptr);
+  assert(Kernel != nullptr);
+
+  // The guess only depends on the local memory and the global size
+  size_t LocalMemSize = Kernel->getLocalSize();
+  if (Kernel->LocalSizeCache.find(WorkDim, LocalMemSize, GlobalWorkSize,
+                                  ThreadsPerBlock)) {
+    return;
+  }
 
   // FIXME: The below assumes a three dimensional range but this is not
   // guaranteed by UR.
@@ -68,8 +81,17 @@ void guessLocalWorkSize(ur_device_handle_t Device, size_t *ThreadsPerBlock,
   MaxBlockDim[1] = Device->getMaxBlockDimY();
   MaxBlockDim[2] = Device->getMaxBlockDimZ();
 
+  // The largest block size which still reaches the best occupancy of the
+  // kernel, with the local memory of the launch
+  int MinGrid, MaxBlockSize;
+  UR_CHECK_ERROR(hipModuleOccupancyMaxPotentialBlockSize(
+      &MinGrid, &MaxBlockSize, Kernel->get(), LocalMemSize,
+      static_cast<int>(MaxThreadsPerBlock[0])));
+
   roundToHighestFactorOfGlobalSizeIn3d(ThreadsPerBlock, GlobalSizeNormalized,
-                                       MaxBlockDim, MaxThreadsPerBlock[0]);
+                                       MaxBlockDim, MaxBlockSize);
+  Kernel->LocalSizeCache.insert(WorkDim, LocalMemSize, GlobalWorkSize,
+                                ThreadsPerBlock);
 }
 
 namespace {
@@ -146,10 +168,13 @@ ur_result_t setHipMemAdvise(const void *DevPtr, const size_t Size,
 
 } // namespace
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
+namespace ur::hip {
+
+ur_result_t urEnqueueMemBufferWrite(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     size_t offset, size_t size, const void *pSrc, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferWrite");
   UR_ASSERT(!(phEventWaitList == NULL && numEventsInWaitList > 0),
             UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
   UR_ASSERT(!(phEventWaitList != NULL && numEventsInWaitList == 0),
@@ -159,6 +184,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_WRITE);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::host_to_device, size);
+
   try {
     ScopedDevice Active(hQueue->getDevice());
     hipStream_t HIPStream = hQueue->getNextTransferStream();
@@ -172,16 +200,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
       UR_CHECK_ERROR(RetImplEvent->start());
     }
 
-    UR_CHECK_ERROR(
-        hipMemcpyHtoDAsync(std::get<BufferMem>(hBuffer->Mem)
-                               .getPtrWithOffset(hQueue->getDevice(), offset),
-                           const_cast<void *>(pSrc), size, HIPStream));
+    enqueueCopyHtoD(hQueue, HIPStream,
+                    std::get<BufferMem>(hBuffer->Mem)
+                        .getPtrWithOffset(hQueue->getDevice(), offset),
+                    pSrc, size);
 
     if (phEvent) {
       UR_CHECK_ERROR(RetImplEvent->record());
     }
 
     if (blockingWrite) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(hipStreamSynchronize(HIPStream));
     }
 
@@ -194,10 +223,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingRead,
-    size_t offset, size_t size, void *pDst, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueMemBufferRead(ur_queue_handle_t hQueue,
+                                   ur_mem_handle_t hBuffer, bool blockingRead,
+                                   size_t offset, size_t size, void *pDst,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferRead");
   UR_ASSERT(!(phEventWaitList == NULL && numEventsInWaitList > 0),
             UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
   UR_ASSERT(!(phEventWaitList != NULL && numEventsInWaitList == 0),
@@ -206,6 +238,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
 
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_READ);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_host, size);
+
   try {
     // Note that this entry point may be called on a queue that may not be the
     // last queue to write to the MemBuffer, meaning we must perform the copy
@@ -232,16 +267,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
 
     // Copying from the device with latest version of memory, not necessarily
     // the device associated with the Queue
-    UR_CHECK_ERROR(hipMemcpyDtoHAsync(
-        pDst,
+    enqueueCopyDtoH(
+        hQueue, HIPStream, pDst,
         std::get<BufferMem>(hBuffer->Mem).getPtrWithOffset(Device, offset),
-        size, HIPStream));
+        size);
 
     if (phEvent) {
       UR_CHECK_ERROR(RetImplEvent->record());
     }
 
     if (blockingRead) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(hipStreamSynchronize(HIPStream));
     }
 
@@ -255,11 +291,25 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
+// Prefetches the shared USM allocations of the arguments of the kernel to
+// the device of the queue, with UR_USM_AUTO_PREFETCH. A prefetch is only a
+// hint, so its errors are ignored.
+static void prefetchKernelArgs(ur_queue_handle_t hQueue,
+                               ur_kernel_handle_t hKernel,
+                               hipStream_t Stream) {
+  hipDevice_t Device = hQueue->getDevice()->get();
+  hKernel->PrefetchArgs.forEachAllocation([&](const void *Ptr, size_t Size) {
+    std::ignore = hipMemPrefetchAsync(Ptr, Size, Device, Stream);
+    return UR_RESULT_SUCCESS;
+  });
+}
+
+ur_result_t urEnqueueKernelLaunch(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueKernelLaunch");
   UR_ASSERT(hQueue->getContext() == hKernel->getContext(),
             UR_RESULT_ERROR_INVALID_QUEUE);
   UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
@@ -267,10 +317,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
 
   // Early exit for zero size range kernel
   if (*pGlobalWorkSize == 0) {
-    return urEnqueueEventsWaitWithBarrier(hQueue, numEventsInWaitList,
-                                          phEventWaitList, phEvent);
+    return ur::hip::urEnqueueEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                                   phEventWaitList, phEvent);
   }
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_KERNEL_LAUNCH);
+
   // Set the number of threads per block to the number of threads per warp
   // by default unless user has provided a better number
   size_t ThreadsPerBlock[3] = {32u, 1u, 1u};
@@ -308,7 +360,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
       }
     }
 
-    auto ArgIndices = hKernel->getArgIndices();
+    prefetchKernelArgs(hQueue, hKernel, HIPStream);
+
+    auto &ArgIndices = hKernel->getArgIndices();
 
     // If migration of mem across buffer is needed, an event must be associated
     // with this command, implicitly if phEvent is nullptr
@@ -322,7 +376,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     UR_CHECK_ERROR(hipModuleLaunchKernel(
         HIPFunc, BlocksPerGrid[0], BlocksPerGrid[1], BlocksPerGrid[2],
         ThreadsPerBlock[0], ThreadsPerBlock[1], ThreadsPerBlock[2],
-        hKernel->getLocalSize(), HIPStream, ArgIndices.data(), nullptr));
+        hKernel->getLocalSize(), HIPStream,
+        const_cast<void **>(ArgIndices.data()), nullptr));
 
     hKernel->clearLocalSize();
 
@@ -336,14 +391,105 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
+ur_result_t urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue, uint32_t numLaunches,
+    const ur_exp_kernel_launch_desc_t *pLaunches, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  for (uint32_t i = 0; i < numLaunches; i++) {
+    UR_ASSERT(pLaunches[i].hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+    UR_ASSERT(pLaunches[i].pGlobalWorkSize,
+              UR_RESULT_ERROR_INVALID_NULL_POINTER);
+    UR_ASSERT(hQueue->getContext() == pLaunches[i].hKernel->getContext(),
+              UR_RESULT_ERROR_INVALID_QUEUE);
+    UR_ASSERT(pLaunches[i].workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+    UR_ASSERT(pLaunches[i].workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  }
+
+  std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+
+  hQueue->Telemetry.commandSubmitted(ur::queue_telemetry_t::kernel_launch,
+                                     numLaunches);
+  hQueue->Telemetry.batchSubmitted(numLaunches);
+
+  try {
+    ur_device_handle_t Dev = hQueue->getDevice();
+    ScopedDevice Active(Dev);
+
+    // The launches share the stream, the wait on the event list and the event
+    uint32_t StreamToken;
+    ur_stream_guard Guard;
+    hipStream_t HIPStream = hQueue->getNextComputeStream(
+        numEventsInWaitList, phEventWaitList, Guard, &StreamToken);
+
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, HIPStream, numEventsInWaitList,
+                                     phEventWaitList));
+
+    if (phEvent) {
+      RetImplEvent =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_KERNEL_LAUNCH, hQueue, HIPStream, StreamToken));
+      UR_CHECK_ERROR(RetImplEvent->start());
+    }
+
+    for (uint32_t i = 0; i < numLaunches; i++) {
+      const ur_exp_kernel_launch_desc_t &Launch = pLaunches[i];
+      ur_kernel_handle_t hKernel = Launch.hKernel;
+
+      // Skip zero size range kernels, the stream already orders the launches
+      if (*Launch.pGlobalWorkSize == 0)
+        continue;
+
+      size_t ThreadsPerBlock[3] = {32u, 1u, 1u};
+      size_t BlocksPerGrid[3] = {1u, 1u, 1u};
+
+      hipFunction_t HIPFunc = hKernel->get();
+      UR_CHECK_ERROR(setKernelParams(
+          Dev, Launch.workDim, Launch.pGlobalWorkOffset, Launch.pGlobalWorkSize,
+          Launch.pLocalWorkSize, hKernel, HIPFunc, ThreadsPerBlock,
+          BlocksPerGrid));
+
+      // For memory migration across devices in the same context
+      if (hQueue->getContext()->Devices.size() > 1) {
+        for (auto &MemArg : hKernel->Args.MemObjArgs) {
+          enqueueMigrateMemoryToDeviceIfNeeded(MemArg.Mem, Dev, HIPStream);
+          if (MemArg.AccessFlags &
+              (UR_MEM_FLAG_READ_WRITE | UR_MEM_FLAG_WRITE_ONLY)) {
+            MemArg.Mem->setLastQueueWritingToMemObj(hQueue);
+          }
+        }
+      }
+
+      prefetchKernelArgs(hQueue, hKernel, HIPStream);
+
+      auto &ArgIndices = hKernel->getArgIndices();
+      UR_CHECK_ERROR(hipModuleLaunchKernel(
+          HIPFunc, BlocksPerGrid[0], BlocksPerGrid[1], BlocksPerGrid[2],
+          ThreadsPerBlock[0], ThreadsPerBlock[1], ThreadsPerBlock[2],
+          hKernel->getLocalSize(), HIPStream,
+          const_cast<void **>(ArgIndices.data()), nullptr));
+
+      hKernel->clearLocalSize();
+    }
+
+    if (phEvent) {
+      UR_CHECK_ERROR(RetImplEvent->record());
+      *phEvent = RetImplEvent.release();
+    }
+  } catch (ur_result_t err) {
+    return err;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEnqueueCooperativeKernelLaunchExp(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  return urEnqueueKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
-                               pGlobalWorkSize, pLocalWorkSize,
-                               numEventsInWaitList, phEventWaitList, phEvent);
+  return ur::hip::urEnqueueKernelLaunch(hQueue, hKernel, workDim,
+                                        pGlobalWorkOffset, pGlobalWorkSize,
+                                        pLocalWorkSize, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
 }
 
 /// Enqueues a wait on the given queue for all events.
@@ -353,11 +499,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
 /// every command is an implicit barrier and so urEnqueueEventWait has the
 /// same behavior as urEnqueueEventWaitWithBarrier. So urEnqueueEventWait can
 /// just call urEnqueueEventWaitWithBarrier.
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
-    ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  return urEnqueueEventsWaitWithBarrier(hQueue, numEventsInWaitList,
-                                        phEventWaitList, phEvent);
+ur_result_t urEnqueueEventsWait(ur_queue_handle_t hQueue,
+                                uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList,
+                                ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueEventsWait");
+  return ur::hip::urEnqueueEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
 }
 
 /// Enqueues a wait on the given queue for all specified events.
@@ -365,7 +513,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
 ///
 /// If the events list is empty, the enqueued wait will wait on all previous
 /// events in the queue.
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
+ur_result_t urEnqueueEventsWaitWithBarrier(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
   UR_ASSERT(!(phEventWaitList == NULL && numEventsInWaitList > 0),
@@ -373,8 +521,22 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
   UR_ASSERT(!(phEventWaitList != NULL && numEventsInWaitList == 0),
             UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST)
 
+  hQueue->Telemetry.commandSubmittedAsBatch(
+      UR_COMMAND_EVENTS_WAIT_WITH_BARRIER);
+
   try {
     ScopedDevice Active(hQueue->getDevice());
+    // The stream of an in-order queue already runs the commands after the
+    // previous ones, so without an event there is no marker to record, only
+    // the events of other streams to wait for
+    if (!phEvent && hQueue->isInOrder()) {
+      if (numEventsInWaitList == 0) {
+        return UR_RESULT_SUCCESS;
+      }
+      return enqueueEventsWait(hQueue, hQueue->getNextComputeStream(),
+                               numEventsInWaitList, phEventWaitList);
+    }
+
     uint32_t StreamToken;
     ur_stream_guard Guard;
     hipStream_t HIPStream = hQueue->getNextComputeStream(
@@ -413,12 +575,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
       }
 
       UR_CHECK_ERROR(hipEventRecord(hQueue->BarrierEvent, HIPStream));
-      for (unsigned int i = 0; i < hQueue->ComputeAppliedBarrier.size(); i++) {
-        hQueue->ComputeAppliedBarrier[i] = false;
-      }
-      for (unsigned int i = 0; i < hQueue->TransferAppliedBarrier.size(); i++) {
-        hQueue->TransferAppliedBarrier[i] = false;
-      }
+      // Published once recorded, so the streams selected from now on wait
+      // for this barrier
+      hQueue->BarrierEpoch.fetch_add(1, std::memory_order_release);
     }
 
     if (phEvent) {
@@ -489,7 +648,7 @@ static ur_result_t commonEnqueueMemBufferCopyRect(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
+ur_result_t urEnqueueMemBufferReadRect(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingRead,
     ur_rect_offset_t bufferOrigin, ur_rect_offset_t hostOrigin,
     ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
@@ -519,6 +678,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
 
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_READ_RECT);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_host,
+                                region.width * region.height * region.depth);
+
   try {
     // Note that this entry point may be called on a queue that may not be the
     // last queue to write to the MemBuffer, meaning we must perform the copy
@@ -553,6 +716,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
     }
 
     if (blockingRead) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(hipStreamSynchronize(HIPStream));
     }
 
@@ -566,7 +730,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
+ur_result_t urEnqueueMemBufferWriteRect(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     ur_rect_offset_t bufferOrigin, ur_rect_offset_t hostOrigin,
     ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
@@ -577,6 +741,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_WRITE_RECT);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::host_to_device,
+                                region.width * region.height * region.depth);
+
   try {
     ScopedDevice Active(hQueue->getDevice());
     hipStream_t HIPStream = hQueue->getNextTransferStream();
@@ -600,6 +768,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
     }
 
     if (blockingWrite) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(hipStreamSynchronize(HIPStream));
     }
 
@@ -612,11 +781,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBufferSrc,
-    ur_mem_handle_t hBufferDst, size_t srcOffset, size_t dstOffset, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueMemBufferCopy(ur_queue_handle_t hQueue,
+                                   ur_mem_handle_t hBufferSrc,
+                                   ur_mem_handle_t hBufferDst, size_t srcOffset,
+                                   size_t dstOffset, size_t size,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferCopy");
   UR_ASSERT(size + srcOffset <= std::get<BufferMem>(hBufferSrc->Mem).getSize(),
             UR_RESULT_ERROR_INVALID_SIZE);
   UR_ASSERT(size + dstOffset <= std::get<BufferMem>(hBufferDst->Mem).getSize(),
@@ -624,6 +796,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
 
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_COPY);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_device, size);
+
   try {
     ScopedDevice Active(hQueue->getDevice());
     auto Stream = hQueue->getNextTransferStream();
@@ -660,7 +835,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
+ur_result_t urEnqueueMemBufferCopyRect(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBufferSrc,
     ur_mem_handle_t hBufferDst, ur_rect_offset_t srcOrigin,
     ur_rect_offset_t dstOrigin, ur_rect_region_t region, size_t srcRowPitch,
@@ -673,6 +848,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
       std::get<BufferMem>(hBufferDst->Mem).getVoid(hQueue->getDevice());
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_COPY_RECT);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_device,
+                                region.width * region.height * region.depth);
+
   try {
     ScopedDevice Active(hQueue->getDevice());
     hipStream_t HIPStream = hQueue->getNextTransferStream();
@@ -702,6 +881,52 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t hQueue, ur_mem_handle_t hBufferSrc,
+    ur_mem_handle_t hBufferDst, uint32_t numRegions,
+    const ur_rect_offset_t *pSrcOrigins, const ur_rect_offset_t *pDstOrigins,
+    const ur_rect_region_t *pRegions, size_t srcRowPitch, size_t srcSlicePitch,
+    size_t dstRowPitch, size_t dstSlicePitch, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  void *SrcPtr =
+      std::get<BufferMem>(hBufferSrc->Mem).getVoid(hQueue->getDevice());
+  void *DstPtr =
+      std::get<BufferMem>(hBufferDst->Mem).getVoid(hQueue->getDevice());
+  std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+
+  try {
+    ScopedDevice Active(hQueue->getDevice());
+    hipStream_t HIPStream = hQueue->getNextTransferStream();
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, HIPStream, numEventsInWaitList,
+                                     phEventWaitList));
+
+    if (phEvent) {
+      RetImplEvent =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_MEM_BUFFER_COPY_RECT_BATCH_EXP, hQueue, HIPStream));
+      UR_CHECK_ERROR(RetImplEvent->start());
+    }
+
+    // The regions share the stream, the wait and the event of the command,
+    // only the copies themselves are issued per region
+    for (uint32_t i = 0; i < numRegions; i++) {
+      UR_CHECK_ERROR(commonEnqueueMemBufferCopyRect(
+          HIPStream, pRegions[i], &SrcPtr, hipMemoryTypeDevice, pSrcOrigins[i],
+          srcRowPitch, srcSlicePitch, &DstPtr, hipMemoryTypeDevice,
+          pDstOrigins[i], dstRowPitch, dstSlicePitch));
+    }
+
+    if (phEvent) {
+      UR_CHECK_ERROR(RetImplEvent->record());
+      *phEvent = RetImplEvent.release();
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  return UR_RESULT_SUCCESS;
+}
+} // namespace ur::hip
+
 static inline void memsetRemainPattern(hipStream_t Stream, uint32_t PatternSize,
                                        size_t Size, const void *pPattern,
                                        hipDeviceptr_t Ptr) {
@@ -776,17 +1001,24 @@ ur_result_t commonMemSetLargePattern(hipStream_t Stream, uint32_t PatternSize,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, const void *pPattern,
-    size_t patternSize, size_t offset, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+namespace ur::hip {
+
+ur_result_t urEnqueueMemBufferFill(ur_queue_handle_t hQueue,
+                                   ur_mem_handle_t hBuffer,
+                                   const void *pPattern, size_t patternSize,
+                                   size_t offset, size_t size,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferFill");
   UR_ASSERT(size + offset <= std::get<BufferMem>(hBuffer->Mem).getSize(),
             UR_RESULT_ERROR_INVALID_SIZE);
 
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_BUFFER_FILL);
+
   try {
     ScopedDevice Active(hQueue->getDevice());
 
@@ -918,11 +1150,13 @@ static ur_result_t commonEnqueueMemImageNDCopy(
   return UR_RESULT_ERROR_INVALID_VALUE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hImage, bool blockingRead,
-    ur_rect_offset_t origin, ur_rect_region_t region, size_t, size_t,
-    void *pDst, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueMemImageRead(ur_queue_handle_t hQueue,
+                                  ur_mem_handle_t hImage, bool blockingRead,
+                                  ur_rect_offset_t origin,
+                                  ur_rect_region_t region, size_t, size_t,
+                                  void *pDst, uint32_t numEventsInWaitList,
+                                  const ur_event_handle_t *phEventWaitList,
+                                  ur_event_handle_t *phEvent) {
   UR_ASSERT(hImage->isImage(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
 
   try {
@@ -959,6 +1193,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
     size_t AdjustedRegion[3] = {BytesToCopy, region.height, region.depth};
     size_t SrcOffset[3] = {ByteOffsetX, origin.y, origin.z};
 
+    hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_IMAGE_READ);
+    hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_host,
+                                  BytesToCopy * region.height *
+                                      region.depth);
+
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
     if (phEvent) {
       RetImplEvent =
@@ -977,6 +1216,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
     }
 
     if (blockingRead) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(hipStreamSynchronize(HIPStream));
     }
   } catch (ur_result_t Err) {
@@ -987,11 +1227,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageWrite(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hImage, bool,
-    ur_rect_offset_t origin, ur_rect_region_t region, size_t, size_t,
-    void *pSrc, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueMemImageWrite(ur_queue_handle_t hQueue,
+                                   ur_mem_handle_t hImage, bool,
+                                   ur_rect_offset_t origin,
+                                   ur_rect_region_t region, size_t, size_t,
+                                   void *pSrc, uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
   UR_ASSERT(hImage->isImage(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
 
   try {
@@ -1020,6 +1262,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageWrite(
     size_t AdjustedRegion[3] = {BytesToCopy, region.height, region.depth};
     size_t DstOffset[3] = {ByteOffsetX, origin.y, origin.z};
 
+    hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_IMAGE_WRITE);
+    hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::host_to_device,
+                                  BytesToCopy * region.height *
+                                      region.depth);
+
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
     if (phEvent) {
       RetImplEvent =
@@ -1045,12 +1292,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageWrite(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageCopy(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hImageSrc,
-    ur_mem_handle_t hImageDst, ur_rect_offset_t srcOrigin,
-    ur_rect_offset_t dstOrigin, ur_rect_region_t region,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t
+urEnqueueMemImageCopy(ur_queue_handle_t hQueue, ur_mem_handle_t hImageSrc,
+                      ur_mem_handle_t hImageDst, ur_rect_offset_t srcOrigin,
+                      ur_rect_offset_t dstOrigin, ur_rect_region_t region,
+                      uint32_t numEventsInWaitList,
+                      const ur_event_handle_t *phEventWaitList,
+                      ur_event_handle_t *phEvent) {
   UR_ASSERT(hImageSrc->isImage(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   UR_ASSERT(hImageDst->isImage(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   UR_ASSERT(std::get<SurfaceMem>(hImageSrc->Mem).getImageType() ==
@@ -1094,6 +1342,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageCopy(
     size_t SrcOffset[3] = {SrcByteOffsetX, srcOrigin.y, srcOrigin.z};
     size_t DstOffset[3] = {DstByteOffsetX, dstOrigin.y, dstOrigin.z};
 
+    hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_MEM_IMAGE_COPY);
+    hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_device,
+                                  BytesToCopy * region.height *
+                                      region.depth);
+
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
     if (phEvent) {
       RetImplEvent =
@@ -1124,11 +1377,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageCopy(
 /// If the buffer uses pinned host memory a pointer to that memory is returned
 /// and no read operation is done.
 ///
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingMap,
-    ur_map_flags_t mapFlags, size_t offset, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent, void **ppRetMap) {
+ur_result_t urEnqueueMemBufferMap(ur_queue_handle_t hQueue,
+                                  ur_mem_handle_t hBuffer, bool blockingMap,
+                                  ur_map_flags_t mapFlags, size_t offset,
+                                  size_t size, uint32_t numEventsInWaitList,
+                                  const ur_event_handle_t *phEventWaitList,
+                                  ur_event_handle_t *phEvent, void **ppRetMap) {
   UR_ASSERT(hBuffer->isBuffer(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   auto &BufferImpl = std::get<BufferMem>(hBuffer->Mem);
   UR_ASSERT(offset + size <= BufferImpl.getSize(),
@@ -1145,15 +1399,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
   try {
     if (!IsPinned && (mapFlags & (UR_MAP_FLAG_READ | UR_MAP_FLAG_WRITE))) {
       // Pinned host memory is already on host so it doesn't need to be read.
-      UR_CHECK_ERROR(urEnqueueMemBufferRead(
-          hQueue, hBuffer, blockingMap, offset, size, MapPtr,
-          numEventsInWaitList, phEventWaitList, phEvent));
+      UR_CHECK_ERROR(ur::hip::urEnqueueMemBufferRead(hQueue, hBuffer,
+                                                     blockingMap, offset, size,
+                                                     MapPtr,
+                                                     numEventsInWaitList,
+                                                     phEventWaitList, phEvent));
     } else {
       ScopedDevice Active(hQueue->getDevice());
 
       if (IsPinned) {
-        UR_CHECK_ERROR(urEnqueueEventsWait(hQueue, numEventsInWaitList,
-                                           phEventWaitList, nullptr));
+        UR_CHECK_ERROR(ur::hip::urEnqueueEventsWait(hQueue, numEventsInWaitList,
+                                                    phEventWaitList, nullptr));
       }
 
       if (phEvent) {
@@ -1176,10 +1432,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
 /// Requires the mapped pointer to be already registered in the given hMem.
 /// If hMem uses pinned host memory, this will not do a write.
 ///
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hMem, void *pMappedPtr,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueMemUnmap(ur_queue_handle_t hQueue, ur_mem_handle_t hMem,
+                              void *pMappedPtr, uint32_t numEventsInWaitList,
+                              const ur_event_handle_t *phEventWaitList,
+                              ur_event_handle_t *phEvent) {
   UR_ASSERT(hMem->isBuffer(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   auto &BufferImpl = std::get<BufferMem>(hMem->Mem);
 
@@ -1195,15 +1451,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
          (UR_MAP_FLAG_WRITE | UR_MAP_FLAG_WRITE_INVALIDATE_REGION))) {
       // Pinned host memory is only on host so it doesn't need to be written
       // to.
-      UR_CHECK_ERROR(urEnqueueMemBufferWrite(
-          hQueue, hMem, true, Map->getMapOffset(), Map->getMapSize(),
-          pMappedPtr, numEventsInWaitList, phEventWaitList, phEvent));
+      UR_CHECK_ERROR(ur::hip::urEnqueueMemBufferWrite(hQueue, hMem, true,
+                                                      Map->getMapOffset(),
+                                                      Map->getMapSize(),
+                                                      pMappedPtr,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList,
+                                                      phEvent));
     } else {
       ScopedDevice Active(hQueue->getDevice());
 
       if (IsPinned) {
-        UR_CHECK_ERROR(urEnqueueEventsWait(hQueue, numEventsInWaitList,
-                                           phEventWaitList, nullptr));
+        UR_CHECK_ERROR(ur::hip::urEnqueueEventsWait(hQueue, numEventsInWaitList,
+                                                    phEventWaitList, nullptr));
       }
 
       if (phEvent) {
@@ -1221,12 +1481,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
-    ur_queue_handle_t hQueue, void *ptr, size_t patternSize,
-    const void *pPattern, size_t size, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMFill(ur_queue_handle_t hQueue, void *ptr,
+                             size_t patternSize, const void *pPattern,
+                             size_t size, uint32_t numEventsInWaitList,
+                             const ur_event_handle_t *phEventWaitList,
+                             ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueUSMFill");
   std::unique_ptr<ur_event_handle_t_> EventPtr{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_FILL);
+
   try {
     ScopedDevice Active(hQueue->getDevice());
     uint32_t StreamToken;
@@ -1278,12 +1542,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
-    ur_queue_handle_t hQueue, bool blocking, void *pDst, const void *pSrc,
-    size_t size, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMMemcpy(ur_queue_handle_t hQueue, bool blocking,
+                               void *pDst, const void *pSrc, size_t size,
+                               uint32_t numEventsInWaitList,
+                               const ur_event_handle_t *phEventWaitList,
+                               ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueUSMMemcpy");
   std::unique_ptr<ur_event_handle_t_> EventPtr{nullptr};
 
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_MEMCPY);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::unknown_direction, size);
+
   try {
     ScopedDevice Active(hQueue->getDevice());
     hipStream_t HIPStream = hQueue->getNextTransferStream();
@@ -1295,12 +1564,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
               UR_COMMAND_USM_MEMCPY, hQueue, HIPStream));
       UR_CHECK_ERROR(EventPtr->start());
     }
-    UR_CHECK_ERROR(
-        hipMemcpyAsync(pDst, pSrc, size, hipMemcpyDefault, HIPStream));
+    enqueueCopy(hQueue, HIPStream, pDst, pSrc, size);
     if (phEvent) {
       UR_CHECK_ERROR(EventPtr->record());
     }
     if (blocking) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(hipStreamSynchronize(HIPStream));
     }
     if (phEvent) {
@@ -1312,10 +1581,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
-    ur_queue_handle_t hQueue, const void *pMem, size_t size,
-    ur_usm_migration_flags_t flags, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMPrefetch(ur_queue_handle_t hQueue, const void *pMem,
+                                 size_t size, ur_usm_migration_flags_t flags,
+                                 uint32_t numEventsInWaitList,
+                                 const ur_event_handle_t *phEventWaitList,
+                                 ur_event_handle_t *phEvent) {
   std::ignore = flags;
 
   void *HIPDevicePtr = const_cast<void *>(pMem);
@@ -1390,9 +1660,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
 }
 
 /// USM: memadvise API to govern behavior of automatic migration mechanisms
-UR_APIEXPORT ur_result_t UR_APICALL
-urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem, size_t size,
-                   ur_usm_advice_flags_t advice, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem,
+                               size_t size, ur_usm_advice_flags_t advice,
+                               ur_event_handle_t *phEvent) {
   UR_ASSERT(pMem && size > 0, UR_RESULT_ERROR_INVALID_VALUE);
   void *HIPDevicePtr = const_cast<void *>(pMem);
   ur_device_handle_t Device = hQueue->getDevice();
@@ -1518,9 +1788,9 @@ urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem, size_t size,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
-    ur_queue_handle_t, void *, size_t, size_t, const void *, size_t, size_t,
-    uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
+ur_result_t urEnqueueUSMFill2D(ur_queue_handle_t, void *, size_t, size_t,
+                               const void *, size_t, size_t, uint32_t,
+                               const ur_event_handle_t *, ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
@@ -1538,11 +1808,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
 /// \param numEventsInWaitList is the number of events to wait on
 /// \param phEventWaitList is an array of events to wait on
 /// \param phEvent is the event that represents this operation
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
-    ur_queue_handle_t hQueue, bool blocking, void *pDst, size_t dstPitch,
-    const void *pSrc, size_t srcPitch, size_t width, size_t height,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMMemcpy2D(ur_queue_handle_t hQueue, bool blocking,
+                                 void *pDst, size_t dstPitch, const void *pSrc,
+                                 size_t srcPitch, size_t width, size_t height,
+                                 uint32_t numEventsInWaitList,
+                                 const ur_event_handle_t *phEventWaitList,
+                                 ur_event_handle_t *phEvent) {
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_MEMCPY_2D);
+  hQueue->Telemetry.bytesCopied(ur::queue_telemetry_t::unknown_direction,
+                                width * height);
+
   try {
     ScopedDevice Active(hQueue->getDevice());
     hipStream_t HIPStream = hQueue->getNextTransferStream();
@@ -1648,6 +1923,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
       *phEvent = RetImplEvent.release();
     }
     if (blocking) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(hipStreamSynchronize(HIPStream));
     }
   } catch (ur_result_t Err) {
@@ -1684,15 +1960,16 @@ ur_result_t deviceGlobalCopyHelper(
       pSrc = reinterpret_cast<uint8_t *>(DeviceGlobal) + offset;
       pDst = ptr;
     }
-    return urEnqueueUSMMemcpy(hQueue, blocking, pDst, pSrc, count,
-                              numEventsInWaitList, phEventWaitList, phEvent);
+    return ur::hip::urEnqueueUSMMemcpy(hQueue, blocking, pDst, pSrc, count,
+                                       numEventsInWaitList, phEventWaitList,
+                                       phEvent);
   } catch (ur_result_t Err) {
     return Err;
   }
 }
 } // namespace
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
+ur_result_t urEnqueueDeviceGlobalVariableWrite(
     ur_queue_handle_t hQueue, ur_program_handle_t hProgram, const char *name,
     bool blockingWrite, size_t count, size_t offset, const void *pSrc,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
@@ -1703,7 +1980,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
                                 GlobalVariableCopy::Write);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
+ur_result_t urEnqueueDeviceGlobalVariableRead(
     ur_queue_handle_t hQueue, ur_program_handle_t hProgram, const char *name,
     bool blockingRead, size_t count, size_t offset, void *pDst,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
@@ -1713,17 +1990,20 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
       numEventsInWaitList, phEventWaitList, phEvent, GlobalVariableCopy::Read);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueReadHostPipe(
-    ur_queue_handle_t, ur_program_handle_t, const char *, bool, void *, size_t,
-    uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
+ur_result_t urEnqueueReadHostPipe(ur_queue_handle_t, ur_program_handle_t,
+                                  const char *, bool, void *, size_t, uint32_t,
+                                  const ur_event_handle_t *,
+                                  ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueWriteHostPipe(
-    ur_queue_handle_t, ur_program_handle_t, const char *, bool, void *, size_t,
-    uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
+ur_result_t urEnqueueWriteHostPipe(ur_queue_handle_t, ur_program_handle_t,
+                                   const char *, bool, void *, size_t, uint32_t,
+                                   const ur_event_handle_t *,
+                                   ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+} // namespace ur::hip
 
 // Helper to compute kernel parameters from workload
 // dimensions.
@@ -1780,7 +2060,7 @@ setKernelParams(const ur_device_handle_t Device, const uint32_t WorkDim,
         }
       } else {
         guessLocalWorkSize(Device, ThreadsPerBlock, GlobalWorkSize, WorkDim,
-                           MaxThreadsPerBlock);
+                           MaxThreadsPerBlock, Kernel);
       }
     }
 
@@ -1882,12 +2162,15 @@ void setCopyRectParams(ur_rect_region_t Region, const void *SrcPtr,
                                                        : hipMemcpyHostToHost));
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
+namespace ur::hip {
+
+ur_result_t urEnqueueTimestampRecordingExp(
     ur_queue_handle_t hQueue, bool blocking, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
 
   ur_result_t Result = UR_RESULT_SUCCESS;
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+  hQueue->Telemetry.commandSubmittedAsBatch(UR_COMMAND_TIMESTAMP_RECORDING_EXP);
   try {
     ScopedDevice Active(hQueue->getDevice());
 
@@ -1905,6 +2188,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     UR_CHECK_ERROR(RetImplEvent->record());
 
     if (blocking) {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
       UR_CHECK_ERROR(hipStreamSynchronize(HIPStream));
     }
 
@@ -1914,3 +2198,36 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
   }
   return Result;
 }
+
+ur_result_t urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, uint64_t *pMarker) {
+
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  try {
+    ScopedDevice Active(hQueue->getDevice());
+    std::lock_guard<std::mutex> Guard(hQueue->TimestampMarkersMutex);
+    auto &Markers = hQueue->TimestampMarkers;
+    if (!Markers) {
+      return UR_RESULT_ERROR_INVALID_OPERATION;
+    }
+    hipStream_t HIPStream = hQueue->getNextComputeStream();
+
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, HIPStream, numEventsInWaitList,
+                                     phEventWaitList));
+
+    // Read back relative to the base event of the device, as the end of the
+    // events of urEnqueueTimestampRecordingExp is
+    UR_CHECK_ERROR(hipEventRecord(
+        hQueue->TimestampMarkerEvents[Markers->slot(Markers->enqueued())],
+        HIPStream));
+    uint64_t Marker = Markers->push();
+    if (pMarker) {
+      *pMarker = Marker;
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  }
+  return Result;
+}
+} // namespace ur::hip
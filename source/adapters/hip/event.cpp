@@ -12,6 +12,10 @@
 #include "common.hpp"
 #include "context.hpp"
 #include "platform.hpp"
+#include "ur_event_callbacks.hpp"
+#include "ur_interface_loader.hpp"
+
+#include <thread>
 
 ur_event_handle_t_::ur_event_handle_t_(ur_command_t Type,
                                        ur_context_handle_t Context,
@@ -20,28 +24,29 @@ ur_event_handle_t_::ur_event_handle_t_(ur_command_t Type,
                                        hipEvent_t EvStart, hipStream_t Stream,
                                        uint32_t StreamToken)
     : CommandType{Type}, RefCount{1}, HasOwnership{true},
-      HasBeenWaitedOn{false}, IsRecorded{false}, IsStarted{false},
+      HasCompleted{false}, IsRecorded{false}, IsStarted{false},
       StreamToken{StreamToken}, EventId{0}, EvEnd{EvEnd}, EvStart{EvStart},
       EvQueued{EvQueued}, Queue{Queue}, Stream{Stream}, Context{Context} {
-  urQueueRetain(Queue);
-  urContextRetain(Context);
+  ur::hip::urQueueRetain(Queue);
+  Queue->Telemetry.eventCreated();
+  ur::hip::urContextRetain(Context);
 }
 
 ur_event_handle_t_::ur_event_handle_t_(ur_context_handle_t Context,
                                        hipEvent_t EventNative)
     : CommandType{UR_COMMAND_EVENTS_WAIT}, RefCount{1}, HasOwnership{false},
-      HasBeenWaitedOn{false}, IsRecorded{false}, IsStarted{false},
+      HasCompleted{false}, IsRecorded{false}, IsStarted{false},
       IsInterop{true}, StreamToken{std::numeric_limits<uint32_t>::max()},
       EventId{0}, EvEnd{EventNative}, EvStart{nullptr}, EvQueued{nullptr},
       Queue{nullptr}, Stream{nullptr}, Context{Context} {
-  urContextRetain(Context);
+  ur::hip::urContextRetain(Context);
 }
 
 ur_event_handle_t_::~ur_event_handle_t_() {
   if (Queue != nullptr) {
-    urQueueRelease(Queue);
+    ur::hip::urQueueRelease(Queue);
   }
-  urContextRelease(Context);
+  ur::hip::urContextRelease(Context);
 }
 
 ur_result_t ur_event_handle_t_::start() {
@@ -66,7 +71,7 @@ bool ur_event_handle_t_::isCompleted() const {
   if (!IsRecorded) {
     return false;
   }
-  if (!HasBeenWaitedOn) {
+  if (!HasCompleted) {
     const hipError_t Result = hipEventQuery(EvEnd);
     if (Result != hipSuccess && Result != hipErrorNotReady) {
       UR_CHECK_ERROR(Result);
@@ -75,6 +80,7 @@ bool ur_event_handle_t_::isCompleted() const {
     if (Result == hipErrorNotReady) {
       return false;
     }
+    HasCompleted = true;
   }
   return true;
 }
@@ -127,7 +133,7 @@ ur_result_t ur_event_handle_t_::wait() {
   ur_result_t Result = UR_RESULT_SUCCESS;
   try {
     UR_CHECK_ERROR(hipEventSynchronize(EvEnd));
-    HasBeenWaitedOn = true;
+    HasCompleted = true;
   } catch (ur_result_t Error) {
     Result = Error;
   }
@@ -140,18 +146,32 @@ ur_result_t ur_event_handle_t_::release() {
     return UR_RESULT_SUCCESS;
 
   assert(Queue != nullptr);
-  UR_CHECK_ERROR(hipEventDestroy(EvEnd));
+  const bool HasTimings =
+      Queue->URFlags & UR_QUEUE_FLAG_PROFILING_ENABLE || isTimestampEvent();
+  Context->recycleEvent(Queue->getDevice(), HasTimings, EvEnd);
 
-  if (Queue->URFlags & UR_QUEUE_FLAG_PROFILING_ENABLE || isTimestampEvent()) {
-    UR_CHECK_ERROR(hipEventDestroy(EvQueued));
-    UR_CHECK_ERROR(hipEventDestroy(EvStart));
+  if (HasTimings) {
+    Context->recycleEvent(Queue->getDevice(), true, EvQueued);
+    Context->recycleEvent(Queue->getDevice(), true, EvStart);
   }
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
+// The callbacks of urEventSetCallback of all the events, see
+// ur_event_callbacks.hpp.
+static ur::event_callback_dispatcher_t &getEventCallbackDispatcher() {
+  static ur::event_callback_dispatcher_t Dispatcher{
+      ur::event_callback_dispatcher_t::statusQuery(ur::hip::urEventGetInfo),
+      [](ur_event_handle_t hEvent) { ur::hip::urEventRetain(hEvent); },
+      [](ur_event_handle_t hEvent) { ur::hip::urEventRelease(hEvent); }};
+  return Dispatcher;
+}
+
+namespace ur::hip {
+
+ur_result_t urEventWait(uint32_t numEvents,
+                        const ur_event_handle_t *phEventWaitList) {
   UR_ASSERT(numEvents > 0, UR_RESULT_ERROR_INVALID_VALUE);
 
   try {
@@ -159,21 +179,75 @@ urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
     auto WaitFunc = [](ur_event_handle_t Event) -> ur_result_t {
       UR_ASSERT(Event, UR_RESULT_ERROR_INVALID_EVENT);
 
+      // Interop events have no queue to account the wait to
+      if (!Event->getQueue()) {
+        return Event->wait();
+      }
+      ur::queue_telemetry_t::wait_scope_t Wait(Event->getQueue()->Telemetry);
       return Event->wait();
     };
-    return forLatestEvents(phEventWaitList, numEvents, WaitFunc);
+    ur_result_t Result =
+        forLatestEvents(phEventWaitList, numEvents, WaitFunc);
+    if (Result == UR_RESULT_SUCCESS) {
+      // The callbacks of the events have run once they are waited for.
+      getEventCallbackDispatcher().flush(numEvents, phEventWaitList);
+    }
+    return Result;
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (...) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+}
+
+ur_result_t urEventWaitAnyExp(uint32_t numEvents,
+                              const ur_event_handle_t *phEventWaitList,
+                              uint32_t *pEventIndex) {
+  UR_ASSERT(numEvents > 0, UR_RESULT_ERROR_INVALID_VALUE);
+
+  if (numEvents == 1) {
+    *pEventIndex = 0;
+    return ur::hip::urEventWait(1, phEventWaitList);
+  }
+
+  try {
+    // HIP can only block on one event at a time, so poll them all with
+    // hipEventQuery, yielding the CPU between the rounds
+    for (;;) {
+      for (uint32_t i = 0; i < numEvents; ++i) {
+        if (phEventWaitList[i]->isCompleted()) {
+          *pEventIndex = i;
+          return UR_RESULT_SUCCESS;
+        }
+      }
+      std::this_thread::yield();
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (...) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+}
+
+ur_result_t urEventGetExecutionStatusExp(uint32_t numEvents,
+                                         const ur_event_handle_t *phEvents,
+                                         ur_event_status_t *pStatuses) {
+  try {
+    for (uint32_t i = 0; i < numEvents; ++i) {
+      pStatuses[i] =
+          static_cast<ur_event_status_t>(phEvents[i]->getExecutionStatus());
+    }
   } catch (ur_result_t Err) {
     return Err;
   } catch (...) {
     return UR_RESULT_ERROR_OUT_OF_RESOURCES;
   }
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
-                                                   ur_event_info_t propName,
-                                                   size_t propValueSize,
-                                                   void *pPropValue,
-                                                   size_t *pPropValueSizeRet) {
+ur_result_t urEventGetInfo(ur_event_handle_t hEvent, ur_event_info_t propName,
+                           size_t propValueSize, void *pPropValue,
+                           size_t *pPropValueSizeRet) {
   UR_ASSERT(!(pPropValue && propValueSize == 0), UR_RESULT_ERROR_INVALID_SIZE);
 
   UrReturnHelper ReturnValue(propValueSize, pPropValue, pPropValueSizeRet);
@@ -212,9 +286,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
 
 /// Obtain profiling information from UR HIP events
 /// Timings from HIP are only elapsed time.
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
-    ur_event_handle_t hEvent, ur_profiling_info_t propName,
-    size_t propValueSize, void *pPropValue, size_t *pPropValueSizeRet) {
+ur_result_t urEventGetProfilingInfo(ur_event_handle_t hEvent,
+                                    ur_profiling_info_t propName,
+                                    size_t propValueSize, void *pPropValue,
+                                    size_t *pPropValueSizeRet) {
 
   UR_ASSERT(!(pPropValue && propValueSize == 0), UR_RESULT_ERROR_INVALID_VALUE);
 
@@ -240,14 +315,20 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
   return {};
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventSetCallback(ur_event_handle_t,
-                                                       ur_execution_info_t,
-                                                       ur_event_callback_t,
-                                                       void *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ur_result_t urEventSetCallback(ur_event_handle_t hEvent,
+                               ur_execution_info_t execStatus,
+                               ur_event_callback_t pfnNotify, void *pUserData) {
+  try {
+    getEventCallbackDispatcher().add(hEvent, execStatus, pfnNotify, pUserData);
+  } catch (const std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    return UR_RESULT_ERROR_UNKNOWN;
+  }
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
+ur_result_t urEventRetain(ur_event_handle_t hEvent) {
   const auto RefCount = hEvent->incrementReferenceCount();
 
   detail::ur::assertion(RefCount != 0,
@@ -256,7 +337,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventRelease(ur_event_handle_t hEvent) {
+ur_result_t urEventRelease(ur_event_handle_t hEvent) {
   // double delete or someone is messing with the ref count.
   // either way, cannot safely proceed.
   detail::ur::assertion(hEvent->getReferenceCount() != 0,
@@ -284,8 +365,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventRelease(ur_event_handle_t hEvent) {
 ///
 /// \return UR_RESULT_SUCCESS on success. UR_RESULT_ERROR_INVALID_EVENT if given
 /// a user event.
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetNativeHandle(
-    ur_event_handle_t hEvent, ur_native_handle_t *phNativeEvent) {
+ur_result_t urEventGetNativeHandle(ur_event_handle_t hEvent,
+                                   ur_native_handle_t *phNativeEvent) {
   *phNativeEvent = reinterpret_cast<ur_native_handle_t>(hEvent->get());
   return UR_RESULT_SUCCESS;
 }
@@ -295,10 +376,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetNativeHandle(
 ///
 /// \param[in] hNativeEvent The native handle to create UR event object from.
 /// \param[out] phEvent Set to the UR event object created from native handle.
-UR_APIEXPORT ur_result_t UR_APICALL urEventCreateWithNativeHandle(
-    ur_native_handle_t hNativeEvent, ur_context_handle_t hContext,
-    const ur_event_native_properties_t *pProperties,
-    ur_event_handle_t *phEvent) {
+ur_result_t
+urEventCreateWithNativeHandle(ur_native_handle_t hNativeEvent,
+                              ur_context_handle_t hContext,
+                              const ur_event_native_properties_t *pProperties,
+                              ur_event_handle_t *phEvent) {
   std::ignore = pProperties;
 
   std::unique_ptr<ur_event_handle_t_> EventPtr{nullptr};
@@ -317,3 +399,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventCreateWithNativeHandle(
 
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::hip
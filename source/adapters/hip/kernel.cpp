@@ -12,38 +12,51 @@
 #include "enqueue.hpp"
 #include "memory.hpp"
 #include "sampler.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
-               ur_kernel_handle_t *phKernel) {
+void ur_kernel_handle_t_::setKernelPtrArg(int Index, const void *Ptr) {
+  // setKernelArg is expecting a pointer to our argument
+  setKernelArg(Index, sizeof(Ptr), &Ptr);
+  if (!Ptr || !ur::usmAutoPrefetchEnabled()) {
+    return;
+  }
+
+  // As in urEnqueueUSMPrefetch, prefetching needs managed memory support
+  ur_device_handle_t Device = Program->getDevice();
+  if (!Device->getManagedMemSupport()) {
+    return;
+  }
+  // Pointers which aren't to USM, e.g. to host memory, fail the queries
+  ScopedDevice Active(Device);
+  hipPointerAttribute_t Attribs;
+  if (hipPointerGetAttributes(&Attribs, Ptr) != hipSuccess ||
+      !Attribs.isManaged) {
+    return;
+  }
+  hipDeviceptr_t Base = nullptr;
+  size_t Size = 0;
+  if (hipMemGetAddressRange(&Base, &Size,
+                            const_cast<hipDeviceptr_t>(Ptr)) == hipSuccess) {
+    PrefetchArgs.set(Index, Base, Size);
+  }
+}
+
+namespace ur::hip {
+
+ur_result_t urKernelCreate(ur_program_handle_t hProgram,
+                           const char *pKernelName,
+                           ur_kernel_handle_t *phKernel) {
   ur_result_t Result = UR_RESULT_SUCCESS;
   std::unique_ptr<ur_kernel_handle_t_> RetKernel{nullptr};
 
   try {
     ScopedDevice Active(hProgram->getDevice());
 
-    hipFunction_t HIPFunc;
-    hipError_t KernelError =
-        hipModuleGetFunction(&HIPFunc, hProgram->get(), pKernelName);
-    if (KernelError == hipErrorNotFound) {
-      return UR_RESULT_ERROR_INVALID_KERNEL_NAME;
-    }
-    UR_CHECK_ERROR(KernelError);
-
-    std::string KernelNameWoffset = std::string(pKernelName) + "_with_offset";
-    hipFunction_t HIPFuncWithOffsetParam;
-    hipError_t OffsetRes = hipModuleGetFunction(
-        &HIPFuncWithOffsetParam, hProgram->get(), KernelNameWoffset.c_str());
-
-    // If there is no kernel with global offset parameter we mark it as missing
-    if (OffsetRes == hipErrorNotFound) {
-      HIPFuncWithOffsetParam = nullptr;
-    } else {
-      UR_CHECK_ERROR(OffsetRes);
-    }
-    RetKernel = std::unique_ptr<ur_kernel_handle_t_>(
-        new ur_kernel_handle_t_{HIPFunc, HIPFuncWithOffsetParam, pKernelName,
-                                hProgram, hProgram->getContext()});
+    ur_program_handle_t_::KernelFunctions Functions;
+    UR_CHECK_ERROR(hProgram->getKernelFunctions(pKernelName, Functions));
+    RetKernel = std::unique_ptr<ur_kernel_handle_t_>(new ur_kernel_handle_t_{
+        Functions.Function, Functions.FunctionWithOffsetParam, pKernelName,
+        hProgram, hProgram->getContext()});
   } catch (ur_result_t Err) {
     Result = Err;
   } catch (std::bad_alloc &) {
@@ -56,10 +69,11 @@ urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelGetGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
-                     ur_kernel_group_info_t propName, size_t propSize,
-                     void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urKernelGetGroupInfo(ur_kernel_handle_t hKernel,
+                                 ur_device_handle_t hDevice,
+                                 ur_kernel_group_info_t propName,
+                                 size_t propSize, void *pPropValue,
+                                 size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   switch (propName) {
@@ -138,15 +152,14 @@ urKernelGetGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelRetain(ur_kernel_handle_t hKernel) {
+ur_result_t urKernelRetain(ur_kernel_handle_t hKernel) {
   UR_ASSERT(hKernel->getReferenceCount() > 0u, UR_RESULT_ERROR_INVALID_KERNEL);
 
   hKernel->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelRelease(ur_kernel_handle_t hKernel) {
+ur_result_t urKernelRelease(ur_kernel_handle_t hKernel) {
   // double delete or someone is messing with the ref count.
   // either way, cannot safely proceed.
   UR_ASSERT(hKernel->getReferenceCount() != 0, UR_RESULT_ERROR_INVALID_KERNEL);
@@ -163,12 +176,11 @@ urKernelRelease(ur_kernel_handle_t hKernel) {
 
 // TODO(ur): Not implemented on hip atm. Also, need to add tests for this
 // feature.
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelGetNativeHandle(ur_kernel_handle_t, ur_native_handle_t *) {
+ur_result_t urKernelGetNativeHandle(ur_kernel_handle_t, ur_native_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
+ur_result_t urKernelSuggestMaxCooperativeGroupCountExp(
     ur_kernel_handle_t hKernel, size_t localWorkSize,
     size_t dynamicSharedMemorySize, uint32_t *pGroupCountRet) {
   std::ignore = hKernel;
@@ -178,9 +190,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
-    ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
-    const ur_kernel_arg_value_properties_t *, const void *pArgValue) {
+ur_result_t urKernelSetArgValue(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                                size_t argSize,
+                                const ur_kernel_arg_value_properties_t *,
+                                const void *pArgValue) {
   ur_result_t Result = UR_RESULT_SUCCESS;
   try {
     hKernel->setKernelArg(argIndex, argSize, pArgValue);
@@ -190,9 +203,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgLocal(
-    ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
-    const ur_kernel_arg_local_properties_t *pProperties) {
+ur_result_t
+urKernelSetArgLocal(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                    size_t argSize,
+                    const ur_kernel_arg_local_properties_t *pProperties) {
   std::ignore = pProperties;
   UR_ASSERT(argSize, UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE);
 
@@ -205,11 +219,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgLocal(
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelGetInfo(ur_kernel_handle_t hKernel,
-                                                    ur_kernel_info_t propName,
-                                                    size_t propSize,
-                                                    void *pKernelInfo,
-                                                    size_t *pPropSizeRet) {
+ur_result_t urKernelGetInfo(ur_kernel_handle_t hKernel,
+                            ur_kernel_info_t propName, size_t propSize,
+                            void *pKernelInfo, size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pKernelInfo, pPropSizeRet);
 
   switch (propName) {
@@ -232,10 +244,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelGetInfo(ur_kernel_handle_t hKernel,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
-                        ur_kernel_sub_group_info_t propName, size_t propSize,
-                        void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel,
+                                    ur_device_handle_t hDevice,
+                                    ur_kernel_sub_group_info_t propName,
+                                    size_t propSize, void *pPropValue,
+                                    size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
   switch (propName) {
   case UR_KERNEL_SUB_GROUP_INFO_MAX_SUB_GROUP_SIZE: {
@@ -251,9 +264,9 @@ urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
     UR_CHECK_ERROR(hipFuncGetAttribute(
         &MaxThreads, HIP_FUNC_ATTRIBUTE_MAX_THREADS_PER_BLOCK, hKernel->get()));
     int WarpSize = 0;
-    urKernelGetSubGroupInfo(hKernel, hDevice,
-                            UR_KERNEL_SUB_GROUP_INFO_MAX_SUB_GROUP_SIZE,
-                            sizeof(uint32_t), &WarpSize, nullptr);
+    ur::hip::urKernelGetSubGroupInfo(
+        hKernel, hDevice, UR_KERNEL_SUB_GROUP_INFO_MAX_SUB_GROUP_SIZE,
+        sizeof(uint32_t), &WarpSize, nullptr);
     int MaxWarps = (MaxThreads + WarpSize - 1) / WarpSize;
     return ReturnValue(static_cast<uint32_t>(MaxWarps));
   }
@@ -276,15 +289,14 @@ urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgPointer(
-    ur_kernel_handle_t hKernel, uint32_t argIndex,
-    const ur_kernel_arg_pointer_properties_t *, const void *pArgValue) {
-  // setKernelArg is expecting a pointer to our argument
-  hKernel->setKernelArg(argIndex, sizeof(pArgValue), &pArgValue);
+ur_result_t urKernelSetArgPointer(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                                  const ur_kernel_arg_pointer_properties_t *,
+                                  const void *pArgValue) {
+  hKernel->setKernelPtrArg(argIndex, pArgValue);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
                      const ur_kernel_arg_mem_obj_properties_t *Properties,
                      ur_mem_handle_t hArgValue) {
@@ -325,9 +337,9 @@ urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgSampler(
-    ur_kernel_handle_t hKernel, uint32_t argIndex,
-    const ur_kernel_arg_sampler_properties_t *, ur_sampler_handle_t hArgValue) {
+ur_result_t urKernelSetArgSampler(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                                  const ur_kernel_arg_sampler_properties_t *,
+                                  ur_sampler_handle_t hArgValue) {
   ur_result_t Result = UR_RESULT_SUCCESS;
   try {
     uint32_t SamplerProps = hArgValue->Props;
@@ -338,27 +350,68 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgSampler(
   return Result;
 }
 
+ur_result_t urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                               const ur_exp_kernel_arg_properties_t *pArgs) {
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  try {
+    for (uint32_t i = 0; i < numArgs && Result == UR_RESULT_SUCCESS; i++) {
+      const ur_exp_kernel_arg_properties_t &Arg = pArgs[i];
+      switch (Arg.type) {
+      case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+        hKernel->setKernelArg(Arg.index, Arg.size, Arg.value.value);
+        break;
+      case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+        hKernel->setKernelPtrArg(Arg.index, Arg.value.pointer);
+        break;
+      case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+        UR_ASSERT(Arg.size, UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE);
+        hKernel->setKernelLocalArg(Arg.index, Arg.size);
+        break;
+      case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ: {
+        ur_kernel_arg_mem_obj_properties_t Properties = {
+            UR_STRUCTURE_TYPE_KERNEL_ARG_MEM_OBJ_PROPERTIES, nullptr,
+            Arg.value.memObjTuple.flags};
+        Result = ur::hip::urKernelSetArgMemObj(hKernel, Arg.index, &Properties,
+                                               Arg.value.memObjTuple.hMem);
+        break;
+      }
+      case UR_EXP_KERNEL_ARG_TYPE_SAMPLER: {
+        uint32_t SamplerProps = Arg.value.sampler->Props;
+        hKernel->setKernelArg(Arg.index, sizeof(uint32_t), &SamplerProps);
+        break;
+      }
+      default:
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+      }
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  }
+  return Result;
+}
+
 // A NOP for the HIP backend
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelSetExecInfo(ur_kernel_handle_t, ur_kernel_exec_info_t, size_t,
-                    const ur_kernel_exec_info_properties_t *, const void *) {
+ur_result_t urKernelSetExecInfo(ur_kernel_handle_t, ur_kernel_exec_info_t,
+                                size_t,
+                                const ur_kernel_exec_info_properties_t *,
+                                const void *) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
+ur_result_t urKernelCreateWithNativeHandle(
     ur_native_handle_t, ur_context_handle_t, ur_program_handle_t,
     const ur_kernel_native_properties_t *, ur_kernel_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetSpecializationConstants(
+ur_result_t urKernelSetSpecializationConstants(
     [[maybe_unused]] ur_kernel_handle_t hKernel,
     [[maybe_unused]] uint32_t count,
     [[maybe_unused]] const ur_specialization_constant_info_t *pSpecConstants) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
+ur_result_t urKernelGetSuggestedLocalWorkSize(
     [[maybe_unused]] ur_kernel_handle_t hKernel, ur_queue_handle_t hQueue,
     uint32_t workDim, [[maybe_unused]] const size_t *pGlobalWorkOffset,
     const size_t *pGlobalWorkSize, size_t *pSuggestedLocalWorkSize) {
@@ -380,8 +433,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
   ScopedDevice Active(Device);
 
   guessLocalWorkSize(Device, ThreadsPerBlock, pGlobalWorkSize, workDim,
-                     MaxThreadsPerBlock);
+                     MaxThreadsPerBlock, hKernel);
   std::copy(ThreadsPerBlock, ThreadsPerBlock + workDim,
             pSuggestedLocalWorkSize);
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::hip
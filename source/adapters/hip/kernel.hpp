@@ -13,9 +13,11 @@
 
 #include <atomic>
 #include <cassert>
-#include <numeric>
 
 #include "program.hpp"
+#include "ur_local_size_cache.hpp"
+#include "ur_usm_prefetch_args.hpp"
+#include "ur_interface_loader.hpp"
 
 /// Implementation of a UR Kernel for HIP
 ///
@@ -45,21 +47,35 @@ struct ur_kernel_handle_t_ {
   static constexpr uint32_t ReqdThreadsPerBlockDimensions = 3u;
   size_t ReqdThreadsPerBlock[ReqdThreadsPerBlockDimensions];
 
+  // The local sizes guessed for the launches which don't give one
+  ur::local_size_cache_t LocalSizeCache;
+
   /// Structure that holds the arguments to the kernel.
   /// Note earch argument size is known, since it comes
   /// from the kernel signature.
   /// This is not something can be queried from the HIP API
   /// so there is a hard-coded size (\ref MAX_PARAM_BYTES)
   /// and a storage.
+  /// The arguments are laid out when they are set, so a launch only passes
+  /// the pointers of Indices and the cached local memory size, without
+  /// building or allocating anything.
   struct arguments {
     static constexpr size_t MAX_PARAM_BYTES = 4000u;
+    // Arguments are aligned to the largest power of two dividing their size,
+    // up to the alignment of the largest vector types
+    static constexpr size_t MaxParamAlignment = 16u;
     using args_t = std::array<char, MAX_PARAM_BYTES>;
     using args_size_t = std::vector<size_t>;
     using args_index_t = std::vector<void *>;
-    args_t Storage;
+    alignas(MaxParamAlignment) args_t Storage;
     args_size_t ParamSizes;
+    args_size_t ParamOffsets;
     args_index_t Indices;
     args_size_t OffsetPerIndex;
+    // The end of the last argument in Storage
+    size_t StorageSize = 0;
+    // The sum of OffsetPerIndex
+    uint32_t TotalLocalSize = 0;
     // A struct to keep track of memargs so that we can do dependency analysis
     // at urEnqueueKernelLaunch
     struct mem_obj_arg {
@@ -76,6 +92,33 @@ struct ur_kernel_handle_t_ {
       Indices.emplace_back(&ImplicitOffsetArgs);
     }
 
+    // A copy has its own storage, which its indices point to
+    arguments(const arguments &Other) { *this = Other; }
+
+    arguments &operator=(const arguments &Other) {
+      if (this == &Other) {
+        return *this;
+      }
+      std::memcpy(Storage.data(), Other.Storage.data(), Other.StorageSize);
+      ParamSizes = Other.ParamSizes;
+      ParamOffsets = Other.ParamOffsets;
+      OffsetPerIndex = Other.OffsetPerIndex;
+      StorageSize = Other.StorageSize;
+      TotalLocalSize = Other.TotalLocalSize;
+      MemObjArgs = Other.MemObjArgs;
+      std::memcpy(ImplicitOffsetArgs, Other.ImplicitOffsetArgs,
+                  sizeof(ImplicitOffsetArgs));
+      Indices.resize(Other.Indices.size());
+      for (size_t i = 0; i < Indices.size(); i++) {
+        const char *Arg = static_cast<const char *>(Other.Indices[i]);
+        Indices[i] = Arg == reinterpret_cast<const char *>(
+                                Other.ImplicitOffsetArgs)
+                         ? static_cast<void *>(ImplicitOffsetArgs)
+                         : Storage.data() + (Arg - Other.Storage.data());
+      }
+      return *this;
+    }
+
     /// Add an argument to the kernel.
     /// If the argument existed before, it is replaced.
     /// Otherwise, it is added.
@@ -88,15 +131,18 @@ struct ur_kernel_handle_t_ {
         Indices.resize(Index + 2, Indices.back());
         // Ensure enough space for the new argument
         ParamSizes.resize(Index + 1);
+        ParamOffsets.resize(Index + 1, StorageSize);
         OffsetPerIndex.resize(Index + 1);
       }
-      ParamSizes[Index] = Size;
-      // calculate the insertion point on the array
-      size_t InsertPos = std::accumulate(std::begin(ParamSizes),
-                                         std::begin(ParamSizes) + Index, 0);
+      if (Size != ParamSizes[Index]) {
+        resizeArg(Index, Size);
+      }
       // Update the stored value for the argument
-      std::memcpy(&Storage[InsertPos], Arg, Size);
-      Indices[Index] = &Storage[InsertPos];
+      if (Size) {
+        std::memcpy(&Storage[ParamOffsets[Index]], Arg, Size);
+      }
+      TotalLocalSize = static_cast<uint32_t>(
+          TotalLocalSize - OffsetPerIndex[Index] + LocalSize);
       OffsetPerIndex[Index] = LocalSize;
     }
 
@@ -142,28 +188,72 @@ struct ur_kernel_handle_t_ {
 
     void clearLocalSize() {
       std::fill(std::begin(OffsetPerIndex), std::end(OffsetPerIndex), 0);
+      TotalLocalSize = 0;
     }
 
     const args_index_t &getIndices() const noexcept { return Indices; }
 
-    uint32_t getLocalSize() const {
-      return std::accumulate(std::begin(OffsetPerIndex),
-                             std::end(OffsetPerIndex), 0);
+    uint32_t getLocalSize() const noexcept { return TotalLocalSize; }
+
+  private:
+    static size_t getAlignment(size_t Size) {
+      return Size ? std::min(Size & (~Size + 1), MaxParamAlignment) : 1;
+    }
+
+    /// Changes the size of an argument and lays out the ones after it again,
+    /// keeping their values. Throws if the arguments don't fit in Storage.
+    void resizeArg(size_t Index, size_t Size) {
+      size_t Begin =
+          Index ? ParamOffsets[Index - 1] + ParamSizes[Index - 1] : 0;
+      size_t End = Begin;
+      for (size_t i = Index; i < ParamSizes.size(); i++) {
+        size_t ArgSize = i == Index ? Size : ParamSizes[i];
+        End = alignUp(End, getAlignment(ArgSize)) + ArgSize;
+      }
+      if (End > MAX_PARAM_BYTES) {
+        throw UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
+      }
+
+      args_t Values;
+      if (Index + 1 < ParamSizes.size()) {
+        std::memcpy(Values.data(), Storage.data(), StorageSize);
+      }
+      ParamSizes[Index] = Size;
+      size_t Offset = Begin;
+      for (size_t i = Index; i < ParamSizes.size(); i++) {
+        Offset = alignUp(Offset, getAlignment(ParamSizes[i]));
+        if (i != Index && ParamSizes[i]) {
+          std::memcpy(&Storage[Offset], &Values[ParamOffsets[i]],
+                      ParamSizes[i]);
+        }
+        ParamOffsets[i] = Offset;
+        Indices[i] = &Storage[Offset];
+        Offset += ParamSizes[i];
+      }
+      StorageSize = Offset;
+    }
+
+    static size_t alignUp(size_t Offset, size_t Alignment) {
+      return (Offset + Alignment - 1) & ~(Alignment - 1);
     }
   } Args;
 
+  // The shared USM allocations of the pointer arguments, prefetched to the
+  // device before the launches with UR_USM_AUTO_PREFETCH
+  ur::usm_prefetch_args_t PrefetchArgs;
+
   ur_kernel_handle_t_(hipFunction_t Func, hipFunction_t FuncWithOffsetParam,
                       const char *Name, ur_program_handle_t Program,
                       ur_context_handle_t Ctxt)
       : Function{Func}, FunctionWithOffsetParam{FuncWithOffsetParam},
         Name{Name}, Context{Ctxt}, Program{Program}, RefCount{1} {
     assert(Program->getDevice());
-    UR_CHECK_ERROR(urKernelGetGroupInfo(
+    UR_CHECK_ERROR(ur::hip::urKernelGetGroupInfo(
         this, Program->getDevice(),
         UR_KERNEL_GROUP_INFO_COMPILE_WORK_GROUP_SIZE,
         sizeof(ReqdThreadsPerBlock), ReqdThreadsPerBlock, nullptr));
-    urProgramRetain(Program);
-    urContextRetain(Context);
+    ur::hip::urProgramRetain(Program);
+    ur::hip::urContextRetain(Context);
   }
 
   ur_kernel_handle_t_(hipFunction_t Func, const char *Name,
@@ -171,8 +261,8 @@ struct ur_kernel_handle_t_ {
       : ur_kernel_handle_t_{Func, nullptr, Name, Program, Ctxt} {}
 
   ~ur_kernel_handle_t_() {
-    urProgramRelease(Program);
-    urContextRelease(Context);
+    ur::hip::urProgramRelease(Program);
+    ur::hip::urContextRelease(Context);
   }
 
   ur_program_handle_t getProgram() const noexcept { return Program; }
@@ -205,10 +295,16 @@ struct ur_kernel_handle_t_ {
 
   void setKernelArg(int Index, size_t Size, const void *Arg) {
     Args.addArg(Index, Size, Arg);
+    PrefetchArgs.clear(Index);
   }
 
+  /// Sets a pointer argument, and keeps the shared USM allocation it points
+  /// into for prefetching with UR_USM_AUTO_PREFETCH
+  void setKernelPtrArg(int Index, const void *Ptr);
+
   void setKernelLocalArg(int Index, size_t Size) {
     Args.addLocalArg(Index, Size);
+    PrefetchArgs.clear(Index);
   }
 
   void setImplicitOffsetArg(size_t Size, std::uint32_t *ImplicitOffset) {
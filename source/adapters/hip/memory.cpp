@@ -11,6 +11,7 @@
 #include "memory.hpp"
 #include "context.hpp"
 #include "enqueue.hpp"
+#include "ur_interface_loader.hpp"
 #include <cassert>
 #include <ur_util.hpp>
 
@@ -55,10 +56,12 @@ checkSupportedImageChannelType(ur_image_channel_type_t ImageChannelType) {
   return UR_RESULT_SUCCESS;
 }
 
+namespace ur::hip {
+
 /// Decreases the reference count of the Mem object.
 /// If this is zero, calls the relevant HIP Free function
 /// \return UR_RESULT_SUCCESS unless deallocation error
-UR_APIEXPORT ur_result_t UR_APICALL urMemRelease(ur_mem_handle_t hMem) {
+ur_result_t urMemRelease(ur_mem_handle_t hMem) {
   ur_result_t Result = UR_RESULT_SUCCESS;
 
   try {
@@ -91,9 +94,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemRelease(ur_mem_handle_t hMem) {
 /// Creates a UR Memory object using a HIP memory allocation.
 /// Can trigger a manual copy depending on the mode.
 /// \TODO Implement USE_HOST_PTR using hipHostRegister - See #9789
-UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
-    ur_context_handle_t hContext, ur_mem_flags_t flags, size_t size,
-    const ur_buffer_properties_t *pProperties, ur_mem_handle_t *phBuffer) {
+ur_result_t urMemBufferCreate(ur_context_handle_t hContext,
+                              ur_mem_flags_t flags, size_t size,
+                              const ur_buffer_properties_t *pProperties,
+                              ur_mem_handle_t *phBuffer) {
   // Validate flags
   UR_ASSERT((flags & UR_MEM_FLAGS_MASK) == 0,
             UR_RESULT_ERROR_INVALID_ENUMERATION);
@@ -119,6 +123,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
     auto HostPtr = pProperties ? pProperties->pHost : nullptr;
     BufferMem::AllocMode AllocMode = BufferMem::AllocMode::Classic;
     if ((flags & UR_MEM_FLAG_USE_HOST_POINTER) && EnableUseHostPtr) {
+      UR_CHECK_ERROR(hContext->registerHostPtr(HostPtr, size));
       AllocMode = BufferMem::AllocMode::UseHostPtr;
     } else if (flags & UR_MEM_FLAG_ALLOC_HOST_POINTER) {
       UR_CHECK_ERROR(hipHostMalloc(&HostPtr, size));
@@ -164,10 +169,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
 /// Implements a buffer partition in the HIP backend.
 /// A buffer partition (or a sub-buffer, in OpenCL terms) is simply implemented
 /// as an offset over an existing HIP allocation.
-UR_APIEXPORT ur_result_t UR_APICALL urMemBufferPartition(
-    ur_mem_handle_t hBuffer, ur_mem_flags_t flags,
-    ur_buffer_create_type_t bufferCreateType, const ur_buffer_region_t *pRegion,
-    ur_mem_handle_t *phMem) {
+ur_result_t urMemBufferPartition(ur_mem_handle_t hBuffer, ur_mem_flags_t flags,
+                                 ur_buffer_create_type_t bufferCreateType,
+                                 const ur_buffer_region_t *pRegion,
+                                 ur_mem_handle_t *phMem) {
   UR_ASSERT((flags & UR_MEM_FLAGS_MASK) == 0,
             UR_RESULT_ERROR_INVALID_ENUMERATION);
   UR_ASSERT(hBuffer->isBuffer(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
@@ -226,11 +231,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferPartition(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urMemGetInfo(ur_mem_handle_t hMemory,
-                                                 ur_mem_info_t MemInfoType,
-                                                 size_t propSize,
-                                                 void *pMemInfo,
-                                                 size_t *pPropSizeRet) {
+ur_result_t urMemGetInfo(ur_mem_handle_t hMemory, ur_mem_info_t MemInfoType,
+                         size_t propSize, void *pMemInfo,
+                         size_t *pPropSizeRet) {
 
   UR_ASSERT(MemInfoType <= UR_MEM_INFO_CONTEXT,
             UR_RESULT_ERROR_INVALID_ENUMERATION);
@@ -298,9 +301,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemGetInfo(ur_mem_handle_t hMemory,
 /// \param[out] phNativeMem Set to the native handle of the UR mem object.
 ///
 /// \return UR_RESULT_SUCCESS
-UR_APIEXPORT ur_result_t UR_APICALL
-urMemGetNativeHandle(ur_mem_handle_t hMem, ur_device_handle_t Device,
-                     ur_native_handle_t *phNativeMem) {
+ur_result_t urMemGetNativeHandle(ur_mem_handle_t hMem,
+                                 ur_device_handle_t Device,
+                                 ur_native_handle_t *phNativeMem) {
   UR_ASSERT(Device != nullptr, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 #if defined(__HIP_PLATFORM_NVIDIA__)
   if (sizeof(BufferMem::native_type) > sizeof(ur_native_handle_t)) {
@@ -327,23 +330,26 @@ urMemGetNativeHandle(ur_mem_handle_t hMem, ur_device_handle_t Device,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
-    ur_native_handle_t, ur_context_handle_t, const ur_mem_native_properties_t *,
-    ur_mem_handle_t *) {
+ur_result_t
+urMemBufferCreateWithNativeHandle(ur_native_handle_t, ur_context_handle_t,
+                                  const ur_mem_native_properties_t *,
+                                  ur_mem_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
-    ur_native_handle_t, ur_context_handle_t, const ur_image_format_t *,
-    const ur_image_desc_t *, const ur_mem_native_properties_t *,
-    ur_mem_handle_t *) {
+ur_result_t urMemImageCreateWithNativeHandle(ur_native_handle_t,
+                                             ur_context_handle_t,
+                                             const ur_image_format_t *,
+                                             const ur_image_desc_t *,
+                                             const ur_mem_native_properties_t *,
+                                             ur_mem_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urMemImageCreate(
-    ur_context_handle_t hContext, ur_mem_flags_t flags,
-    const ur_image_format_t *pImageFormat, const ur_image_desc_t *pImageDesc,
-    void *pHost, ur_mem_handle_t *phMem) {
+ur_result_t urMemImageCreate(ur_context_handle_t hContext, ur_mem_flags_t flags,
+                             const ur_image_format_t *pImageFormat,
+                             const ur_image_desc_t *pImageDesc, void *pHost,
+                             ur_mem_handle_t *phMem) {
 
   // Need input memory object
   UR_ASSERT((flags & UR_MEM_FLAGS_MASK) == 0,
@@ -393,11 +399,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemImageCreate(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urMemImageGetInfo(ur_mem_handle_t hMemory,
-                                                      ur_image_info_t propName,
-                                                      size_t propSize,
-                                                      void *pPropValue,
-                                                      size_t *pPropSizeRet) {
+ur_result_t urMemImageGetInfo(ur_mem_handle_t hMemory, ur_image_info_t propName,
+                              size_t propSize, void *pPropValue,
+                              size_t *pPropSizeRet) {
   UR_ASSERT(hMemory->isImage(), UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   // FIXME: only getting infor for first image in ctx
   auto Device = hMemory->getContext()->getDevices()[0];
@@ -466,11 +470,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemImageGetInfo(ur_mem_handle_t hMemory,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urMemRetain(ur_mem_handle_t hMem) {
+ur_result_t urMemRetain(ur_mem_handle_t hMem) {
   UR_ASSERT(hMem->getReferenceCount() > 0, UR_RESULT_ERROR_INVALID_MEM_OBJECT);
   hMem->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::hip
 
 ur_result_t allocateMemObjOnDeviceIfNeeded(ur_mem_handle_t Mem,
                                            const ur_device_handle_t hDevice) {
@@ -491,8 +496,7 @@ ur_result_t allocateMemObjOnDeviceIfNeeded(ur_mem_handle_t Mem,
       // Host allocation has already been made
       UR_CHECK_ERROR(hipHostGetDevicePointer(&DevPtr, Buffer.HostPtr, 0));
     } else if (Buffer.MemAllocMode == BufferMem::AllocMode::UseHostPtr) {
-      UR_CHECK_ERROR(
-          hipHostRegister(Buffer.HostPtr, Buffer.Size, hipHostRegisterMapped));
+      // Registered for all the devices by urMemBufferCreate
       UR_CHECK_ERROR(hipHostGetDevicePointer(&DevPtr, Buffer.HostPtr, 0));
     } else {
       UR_CHECK_ERROR(hipMalloc(&DevPtr, Buffer.Size));
@@ -605,7 +609,7 @@ inline ur_result_t enqueueMigrateImageToDevice(ur_mem_handle_t Mem,
   } else if (Mem->LastQueueWritingToMemObj->getDevice() != hDevice) {
     if (Image.ImageDesc.type == UR_MEM_TYPE_IMAGE1D) {
       // Blocking wait needed
-      UR_CHECK_ERROR(urQueueFinish(Mem->LastQueueWritingToMemObj));
+      UR_CHECK_ERROR(ur::hip::urQueueFinish(Mem->LastQueueWritingToMemObj));
       // FIXME: 1D memcpy from DtoD going through the host.
       UR_CHECK_ERROR(hipMemcpyAtoH(
           Image.HostPtr,
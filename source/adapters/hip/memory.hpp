@@ -12,6 +12,7 @@
 #include "common.hpp"
 #include "context.hpp"
 #include "event.hpp"
+#include "ur_interface_loader.hpp"
 #include <cassert>
 #include <memory>
 #include <unordered_map>
@@ -76,6 +77,9 @@ struct BufferMem {
 
   AllocMode MemAllocMode;
 
+  /// Context registering HostPtr in UseHostPtr mode
+  ur_context_handle_t Context;
+
 private:
   // Vector of HIP pointers
   std::vector<native_type> Ptrs;
@@ -84,7 +88,7 @@ public:
   BufferMem(ur_context_handle_t Context, ur_mem_handle_t OuterMemStruct,
             AllocMode Mode, void *HostPtr, size_t Size)
       : OuterMemStruct{OuterMemStruct}, HostPtr{HostPtr}, Size{Size},
-        PtrToBufferMap{}, MemAllocMode{Mode},
+        PtrToBufferMap{}, MemAllocMode{Mode}, Context{Context},
         Ptrs(Context->Devices.size(), native_type{0}){};
 
   // This will allocate memory on device if there isn't already an active
@@ -159,7 +163,7 @@ public:
       }
       break;
     case AllocMode::UseHostPtr:
-      UR_CHECK_ERROR(hipHostUnregister(HostPtr));
+      UR_CHECK_ERROR(Context->unregisterHostPtr(HostPtr));
       break;
     case AllocMode::AllocHostPtr:
       UR_CHECK_ERROR(hipHostFree(HostPtr));
@@ -350,7 +354,7 @@ struct ur_mem_handle_t_ {
       : Context{Ctxt}, RefCount{1}, MemFlags{MemFlags},
         HaveMigratedToDeviceSinceLastWrite(Context->Devices.size(), false),
         Mem{std::in_place_type<BufferMem>, Ctxt, this, Mode, HostPtr, Size} {
-    urContextRetain(Context);
+    ur::hip::urContextRetain(Context);
   }
 
   // Subbuffer constructor
@@ -371,7 +375,7 @@ struct ur_mem_handle_t_ {
         DevPtr = static_cast<char *>(DevPtr) + SubBufferOffset;
       }
     }
-    urMemRetain(Parent);
+    ur::hip::urMemRetain(Parent);
   }
 
   /// Constructs the UR mem handler for an Image object
@@ -386,16 +390,16 @@ struct ur_mem_handle_t_ {
             ImageFormat,
             ImageDesc,
             HostPtr} {
-    urContextRetain(Context);
+    ur::hip::urContextRetain(Context);
   }
 
   ~ur_mem_handle_t_() noexcept(false) {
     clear();
     if (isBuffer() && isSubBuffer()) {
-      urMemRelease(std::get<BufferMem>(Mem).Parent);
+      ur::hip::urMemRelease(std::get<BufferMem>(Mem).Parent);
       return;
     }
-    urContextRelease(Context);
+    ur::hip::urContextRelease(Context);
   }
 
   bool isBuffer() const noexcept {
@@ -427,9 +431,9 @@ struct ur_mem_handle_t_ {
 
   void setLastQueueWritingToMemObj(ur_queue_handle_t WritingQueue) {
     if (LastQueueWritingToMemObj != nullptr) {
-      urQueueRelease(LastQueueWritingToMemObj);
+      ur::hip::urQueueRelease(LastQueueWritingToMemObj);
     }
-    urQueueRetain(WritingQueue);
+    ur::hip::urQueueRetain(WritingQueue);
     LastQueueWritingToMemObj = WritingQueue;
     for (const auto &Device : Context->getDevices()) {
       HaveMigratedToDeviceSinceLastWrite[Context->getDeviceIndex(Device)] =
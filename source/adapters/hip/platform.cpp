@@ -10,10 +10,13 @@
 
 #include "platform.hpp"
 #include "context.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urPlatformGetInfo(ur_platform_handle_t, ur_platform_info_t propName,
-                  size_t propSize, void *pPropValue, size_t *pSizeRet) {
+namespace ur::hip {
+
+ur_result_t urPlatformGetInfo(ur_platform_handle_t, ur_platform_info_t propName,
+                              size_t propSize, void *pPropValue,
+                              size_t *pSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pSizeRet);
 
   switch (propName) {
@@ -45,9 +48,9 @@ urPlatformGetInfo(ur_platform_handle_t, ur_platform_info_t propName,
 /// There is only one HIP platform, and contains all devices on the system.
 /// Triggers the HIP Driver initialization (hipInit) the first time, so this
 /// must be the first UR API called.
-UR_APIEXPORT ur_result_t UR_APICALL
-urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
-              ur_platform_handle_t *phPlatforms, uint32_t *pNumPlatforms) {
+ur_result_t urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
+                          ur_platform_handle_t *phPlatforms,
+                          uint32_t *pNumPlatforms) {
 
   try {
     static std::once_flag InitFlag;
@@ -119,22 +122,23 @@ urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urPlatformGetApiVersion(ur_platform_handle_t, ur_api_version_t *pVersion) {
+ur_result_t urPlatformGetApiVersion(ur_platform_handle_t,
+                                    ur_api_version_t *pVersion) {
   *pVersion = UR_API_VERSION_CURRENT;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetNativeHandle(
-    ur_platform_handle_t hPlatform, ur_native_handle_t *phNativePlatform) {
+ur_result_t urPlatformGetNativeHandle(ur_platform_handle_t hPlatform,
+                                      ur_native_handle_t *phNativePlatform) {
   std::ignore = hPlatform;
   std::ignore = phNativePlatform;
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
-    ur_native_handle_t, ur_adapter_handle_t,
-    const ur_platform_native_properties_t *, ur_platform_handle_t *) {
+ur_result_t
+urPlatformCreateWithNativeHandle(ur_native_handle_t, ur_adapter_handle_t,
+                                 const ur_platform_native_properties_t *,
+                                 ur_platform_handle_t *) {
   // There is no HIP equivalent to ur_platform_handle_t
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
@@ -143,9 +147,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
 // Current support is only for optimization options.
 // Return empty string for cuda.
 // TODO: Determine correct string to be passed.
-UR_APIEXPORT ur_result_t UR_APICALL
-urPlatformGetBackendOption(ur_platform_handle_t, const char *pFrontendOption,
-                           const char **ppPlatformOption) {
+ur_result_t urPlatformGetBackendOption(ur_platform_handle_t,
+                                       const char *pFrontendOption,
+                                       const char **ppPlatformOption) {
   using namespace std::literals;
   if (pFrontendOption == "-O0"sv || pFrontendOption == "-O1"sv ||
       pFrontendOption == "-O2"sv || pFrontendOption == "-O3"sv ||
@@ -155,3 +159,4 @@ urPlatformGetBackendOption(ur_platform_handle_t, const char *pFrontendOption,
   }
   return UR_RESULT_ERROR_INVALID_VALUE;
 }
+} // namespace ur::hip
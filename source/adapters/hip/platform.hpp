@@ -12,6 +12,7 @@
 #include "common.hpp"
 #include "device.hpp"
 
+#include <ur_peer_topology.hpp>
 #include <vector>
 
 /// A UR platform stores all known UR devices,
@@ -21,4 +22,6 @@
 ///
 struct ur_platform_handle_t_ {
   std::vector<std::unique_ptr<ur_device_handle_t_>> Devices;
+  // The links between the devices, for the P2P link and copy route queries
+  ur::peer_topology_t PeerTopology;
 };
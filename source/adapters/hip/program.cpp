@@ -17,6 +17,19 @@
 #else
 #include <amd_comgr/amd_comgr.h>
 #endif
+#include "ur_binary_cache.hpp"
+#include "ur_interface_loader.hpp"
+
+// The code objects linked from relocatable inputs, kept across processes in
+// the program cache, or in the directory UR_HIP_CODE_OBJECT_CACHE_DIR if it is
+// set.
+static const ur::binary_cache_t &getCodeObjectCache() {
+  static const ur::binary_cache_t Cache(
+      "hip", "UR_HIP_CODE_OBJECT_CACHE_DIR",
+      {'U', 'R', 'H', 'I', 'P', 'C', 'O', '2'});
+  return Cache;
+}
+
 namespace {
 template <typename ReleaseType, ReleaseType Release, typename T>
 struct COMgrObjCleanUp {
@@ -141,6 +154,30 @@ ur_result_t ur_program_handle_t_::finalizeRelocatable() {
   return UR_RESULT_ERROR_UNKNOWN;
 #else
   assert(IsRelocatable && "Not a relocatable input");
+  std::string ISA = "amdgcn-amd-amdhsa--";
+  hipDeviceProp_t Props;
+  detail::ur::assertion(hipGetDeviceProperties(&Props, getDevice()->get()) ==
+                        hipSuccess);
+  ISA += Props.gcnArchName;
+
+  // Code objects are only valid for the ISA and the driver which linked them
+  std::string CacheKey;
+  if (getCodeObjectCache().enabled()) {
+    ur::binary_hash_t Hash;
+    Hash.addField(Binary, BinarySizeInBytes);
+    Hash.addField(ISA);
+    int DriverVersion = 0;
+    UR_CHECK_ERROR(hipDriverGetVersion(&DriverVersion));
+    Hash.addField(&DriverVersion, sizeof(DriverVersion));
+    CacheKey = Hash.str();
+
+    if (getCodeObjectCache().load(CacheKey, CachedExecutable)) {
+      Binary = reinterpret_cast<const char *>(CachedExecutable.data());
+      BinarySizeInBytes = CachedExecutable.size();
+      return UR_RESULT_SUCCESS;
+    }
+  }
+
   amd_comgr_data_t ComgrData;
   amd_comgr_data_set_t RelocatableData;
   UR_CHECK_ERROR(amd_comgr_create_data_set(&RelocatableData));
@@ -160,11 +197,6 @@ ur_result_t ur_program_handle_t_::finalizeRelocatable() {
   UR_CHECK_ERROR(amd_comgr_create_action_info(&Action));
   COMgrActionInfoCleanUp ActionCleanUp{Action};
 
-  std::string ISA = "amdgcn-amd-amdhsa--";
-  hipDeviceProp_t Props;
-  detail::ur::assertion(hipGetDeviceProperties(&Props, getDevice()->get()) ==
-                        hipSuccess);
-  ISA += Props.gcnArchName;
   UR_CHECK_ERROR(amd_comgr_action_info_set_isa_name(Action, ISA.data()));
 
   UR_CHECK_ERROR(amd_comgr_action_info_set_logging(Action, true));
@@ -194,6 +226,8 @@ ur_result_t ur_program_handle_t_::finalizeRelocatable() {
     UR_CHECK_ERROR(
         amd_comgr_get_data(binaryData, &binarySize, ExecutableCache.data()));
   }
+  getCodeObjectCache().store(CacheKey, ExecutableCache.data(),
+                             ExecutableCache.size());
   Binary = ExecutableCache.data();
   BinarySizeInBytes = ExecutableCache.size();
   return UR_RESULT_SUCCESS;
@@ -259,6 +293,37 @@ ur_result_t ur_program_handle_t_::getGlobalVariablePointer(
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t
+ur_program_handle_t_::getKernelFunctions(const char *Name,
+                                         KernelFunctions &Functions) {
+  std::lock_guard<std::mutex> Lock(KernelFunctionsMutex);
+  if (auto It = KernelFunctionsByName.find(Name);
+      It != KernelFunctionsByName.end()) {
+    Functions = It->second;
+    return UR_RESULT_SUCCESS;
+  }
+
+  hipError_t KernelError =
+      hipModuleGetFunction(&Functions.Function, get(), Name);
+  if (KernelError == hipErrorNotFound) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_NAME;
+  }
+  UR_CHECK_ERROR(KernelError);
+
+  std::string KernelNameWoffset = std::string(Name) + "_with_offset";
+  hipError_t OffsetRes = hipModuleGetFunction(
+      &Functions.FunctionWithOffsetParam, get(), KernelNameWoffset.c_str());
+  // If there is no kernel with global offset parameter we mark it as missing
+  if (OffsetRes == hipErrorNotFound) {
+    Functions.FunctionWithOffsetParam = nullptr;
+  } else {
+    UR_CHECK_ERROR(OffsetRes);
+  }
+
+  KernelFunctionsByName.emplace(Name, Functions);
+  return UR_RESULT_SUCCESS;
+}
+
 /// Finds kernel names by searching for entry points in the PTX source, as the
 /// HIP driver API doesn't expose an operation for this.
 /// Note: This is currently only being used by the SYCL program class for the
@@ -268,10 +333,12 @@ ur_result_t getKernelNames(ur_program_handle_t) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
+namespace ur::hip {
+
 /// A program must be specific to a device so this entry point is UNSUPPORTED
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramCreateWithIL(ur_context_handle_t, const void *, size_t,
-                      const ur_program_properties_t *, ur_program_handle_t *) {
+ur_result_t urProgramCreateWithIL(ur_context_handle_t, const void *, size_t,
+                                  const ur_program_properties_t *,
+                                  ur_program_handle_t *) {
   detail::ur::die("urProgramCreateWithIL not implemented for HIP adapter"
                   " please use urProgramCreateWithBinary instead");
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
@@ -280,36 +347,31 @@ urProgramCreateWithIL(ur_context_handle_t, const void *, size_t,
 /// HIP will handle the PTX/HIPBIN binaries internally through a call to
 /// hipModuleLoadDataEx. So, urProgramCompile and urProgramBuild are equivalent
 /// in terms of HIP adapter. \TODO Implement asynchronous compilation
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramCompile(ur_context_handle_t hContext, ur_program_handle_t hProgram,
-                 const char *pOptions) {
-  UR_CHECK_ERROR(urProgramBuild(hContext, hProgram, pOptions));
+ur_result_t urProgramCompile(ur_context_handle_t hContext,
+                             ur_program_handle_t hProgram,
+                             const char *pOptions) {
+  UR_CHECK_ERROR(ur::hip::urProgramBuild(hContext, hProgram, pOptions));
   // urProgramBuild sets the BinaryType to UR_PROGRAM_BINARY_TYPE_EXECUTABLE, so
   // set it to the correct value for urProgramCompile post-hoc.
   hProgram->BinaryType = UR_PROGRAM_BINARY_TYPE_COMPILED_OBJECT;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCompileExp(ur_program_handle_t,
-                                                        uint32_t,
-                                                        ur_device_handle_t *,
-                                                        const char *) {
+ur_result_t urProgramCompileExp(ur_program_handle_t, uint32_t,
+                                ur_device_handle_t *, const char *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramBuildExp(ur_program_handle_t,
-                                                      uint32_t,
-                                                      ur_device_handle_t *,
-                                                      const char *) {
+ur_result_t urProgramBuildExp(ur_program_handle_t, uint32_t,
+                              ur_device_handle_t *, const char *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
 /// Loads the images from a UR program into a hipModule_t that can be
 /// used later on to extract functions (kernels).
 /// See \ref ur_program_handle_t for implementation details.
-UR_APIEXPORT ur_result_t UR_APICALL urProgramBuild(ur_context_handle_t,
-                                                   ur_program_handle_t hProgram,
-                                                   const char *pOptions) {
+ur_result_t urProgramBuild(ur_context_handle_t, ur_program_handle_t hProgram,
+                           const char *pOptions) {
   ur_result_t Result = UR_RESULT_SUCCESS;
 
   try {
@@ -324,18 +386,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramBuild(ur_context_handle_t,
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramLinkExp(
-    ur_context_handle_t, uint32_t, ur_device_handle_t *, uint32_t,
-    const ur_program_handle_t *, const char *, ur_program_handle_t *phProgram) {
+ur_result_t urProgramLinkExp(ur_context_handle_t, uint32_t,
+                             ur_device_handle_t *, uint32_t,
+                             const ur_program_handle_t *, const char *,
+                             ur_program_handle_t *phProgram) {
   if (nullptr != phProgram) {
     *phProgram = nullptr;
   }
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramLink(ur_context_handle_t, uint32_t, const ur_program_handle_t *,
-              const char *, ur_program_handle_t *phProgram) {
+ur_result_t urProgramLink(ur_context_handle_t, uint32_t,
+                          const ur_program_handle_t *, const char *,
+                          ur_program_handle_t *phProgram) {
   if (nullptr != phProgram) {
     *phProgram = nullptr;
   }
@@ -351,16 +414,18 @@ urProgramLink(ur_context_handle_t, uint32_t, const ur_program_handle_t *,
 /// phProgram Set to the UR program object created from native handle.
 ///
 /// \return UR_RESULT_ERROR_UNSUPPORTED_FEATURE
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
-    ur_native_handle_t, ur_context_handle_t,
-    const ur_program_native_properties_t *, ur_program_handle_t *) {
+ur_result_t
+urProgramCreateWithNativeHandle(ur_native_handle_t, ur_context_handle_t,
+                                const ur_program_native_properties_t *,
+                                ur_program_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramGetBuildInfo(ur_program_handle_t hProgram, ur_device_handle_t,
-                      ur_program_build_info_t propName, size_t propSize,
-                      void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urProgramGetBuildInfo(ur_program_handle_t hProgram,
+                                  ur_device_handle_t,
+                                  ur_program_build_info_t propName,
+                                  size_t propSize, void *pPropValue,
+                                  size_t *pPropSizeRet) {
   // Ignore unused parameter
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
@@ -389,9 +454,9 @@ urProgramGetBuildInfo(ur_program_handle_t hProgram, ur_device_handle_t,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramGetInfo(ur_program_handle_t hProgram, ur_program_info_t propName,
-                 size_t propSize, void *pProgramInfo, size_t *pPropSizeRet) {
+ur_result_t urProgramGetInfo(ur_program_handle_t hProgram,
+                             ur_program_info_t propName, size_t propSize,
+                             void *pProgramInfo, size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pProgramInfo, pPropSizeRet);
 
   switch (propName) {
@@ -417,8 +482,7 @@ urProgramGetInfo(ur_program_handle_t hProgram, ur_program_info_t propName,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramRetain(ur_program_handle_t hProgram) {
+ur_result_t urProgramRetain(ur_program_handle_t hProgram) {
   UR_ASSERT(hProgram->getReferenceCount() > 0, UR_RESULT_ERROR_INVALID_PROGRAM);
   hProgram->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
@@ -427,8 +491,7 @@ urProgramRetain(ur_program_handle_t hProgram) {
 /// Decreases the reference count of a ur_program_handle_t object.
 /// When the reference count reaches 0, it unloads the module from
 /// the context.
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramRelease(ur_program_handle_t hProgram) {
+ur_result_t urProgramRelease(ur_program_handle_t hProgram) {
   // double delete or someone is messing with the ref count.
   // either way, cannot safely proceed.
   UR_ASSERT(hProgram->getReferenceCount() != 0,
@@ -468,8 +531,8 @@ urProgramRelease(ur_program_handle_t hProgram) {
 /// object.
 ///
 /// \return UR_RESULT_SUCCESS
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetNativeHandle(
-    ur_program_handle_t hProgram, ur_native_handle_t *phNativeProgram) {
+ur_result_t urProgramGetNativeHandle(ur_program_handle_t hProgram,
+                                     ur_native_handle_t *phNativeProgram) {
   *phNativeProgram = reinterpret_cast<ur_native_handle_t>(hProgram->get());
   return UR_RESULT_SUCCESS;
 }
@@ -479,7 +542,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetNativeHandle(
 /// for later.
 ///
 /// Note: Only supports one device
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
+ur_result_t urProgramCreateWithBinary(
     ur_context_handle_t hContext, ur_device_handle_t hDevice, size_t size,
     const uint8_t *pBinary, const ur_program_properties_t *pProperties,
     ur_program_handle_t *phProgram) {
@@ -524,14 +587,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
 
 // This entry point is only used for native specialization constants (SPIR-V),
 // and the HIP plugin is AOT only so this entry point is not supported.
-UR_APIEXPORT ur_result_t UR_APICALL urProgramSetSpecializationConstants(
-    ur_program_handle_t, uint32_t, const ur_specialization_constant_info_t *) {
+ur_result_t
+urProgramSetSpecializationConstants(ur_program_handle_t, uint32_t,
+                                    const ur_specialization_constant_info_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
-    ur_device_handle_t hDevice, ur_program_handle_t hProgram,
-    const char *pFunctionName, void **ppFunctionPointer) {
+ur_result_t urProgramGetFunctionPointer(ur_device_handle_t hDevice,
+                                        ur_program_handle_t hProgram,
+                                        const char *pFunctionName,
+                                        void **ppFunctionPointer) {
   // Check if device passed is the same the device bound to the context
   UR_ASSERT(hDevice == hProgram->getDevice(), UR_RESULT_ERROR_INVALID_DEVICE);
 
@@ -550,10 +615,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
   return Result;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
+ur_result_t urProgramGetGlobalVariablePointer(
     ur_device_handle_t, ur_program_handle_t hProgram,
     const char *pGlobalVariableName, size_t *pGlobalVariableSizeRet,
     void **ppGlobalVariablePointerRet) {
   return hProgram->getGlobalVariablePointer(
       pGlobalVariableName, ppGlobalVariablePointerRet, pGlobalVariableSizeRet);
 }
+} // namespace ur::hip
@@ -12,9 +12,12 @@
 #include <ur_api.h>
 
 #include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 #include "context.hpp"
+#include "ur_binary_cache.hpp"
+#include "ur_interface_loader.hpp"
 
 /// Implementation of UR Program on HIP Module object
 struct ur_program_handle_t_ {
@@ -26,6 +29,8 @@ struct ur_program_handle_t_ {
   ur_context_handle_t Context;
   ur_device_handle_t Device;
   std::string ExecutableCache;
+  // The code object mapped from the code object cache, which Binary points to
+  ur::cached_binary_t CachedExecutable;
 
   // The ur_program_binary_type_t property is defined individually for every
   // device in a program. However, since the HIP adapter only has 1 device per
@@ -49,13 +54,13 @@ struct ur_program_handle_t_ {
   ur_program_handle_t_(ur_context_handle_t Ctxt, ur_device_handle_t Device)
       : Module{nullptr}, Binary{}, BinarySizeInBytes{0}, RefCount{1},
         Context{Ctxt}, Device{Device}, KernelReqdWorkGroupSizeMD{} {
-    urContextRetain(Context);
-    urDeviceRetain(Device);
+    ur::hip::urContextRetain(Context);
+    ur::hip::urDeviceRetain(Device);
   }
 
   ~ur_program_handle_t_() {
-    urContextRelease(Context);
-    urDeviceRelease(Device);
+    ur::hip::urContextRelease(Context);
+    ur::hip::urDeviceRelease(Device);
   }
 
   ur_result_t setMetadata(const ur_program_metadata_t *Metadata, size_t Length);
@@ -78,4 +83,19 @@ struct ur_program_handle_t_ {
   ur_result_t getGlobalVariablePointer(const char *name,
                                        hipDeviceptr_t *DeviceGlobal,
                                        size_t *DeviceGlobalSize);
+
+  // The functions of a kernel of the module
+  struct KernelFunctions {
+    hipFunction_t Function;
+    // nullptr if the kernel has no variant with a global offset parameter
+    hipFunction_t FunctionWithOffsetParam;
+  };
+
+  // The functions of the kernel Name, looked up in the module the first time
+  // only, as the kernels created again for a name share them
+  ur_result_t getKernelFunctions(const char *Name, KernelFunctions &Functions);
+
+private:
+  std::mutex KernelFunctionsMutex;
+  std::unordered_map<std::string, KernelFunctions> KernelFunctionsByName;
 };
@@ -11,20 +11,51 @@
 #include "queue.hpp"
 #include "context.hpp"
 #include "event.hpp"
+#include "latency_tracker.hpp"
+#include "ur_interface_loader.hpp"
+
+namespace {
+// The epoch is loaded before waiting, and bumped by the barrier once
+// BarrierEvent is recorded, so the wait is for the barrier of the epoch or a
+// later one. The stream waits again if a later barrier raced with the wait.
+void waitForBarrierIfNeeded(hipStream_t Stream, hipEvent_t &BarrierEvent,
+                            const std::atomic_uint32_t &BarrierEpoch,
+                            std::atomic_uint32_t &StreamEpoch) {
+  uint32_t Epoch = BarrierEpoch.load(std::memory_order_acquire);
+  if (StreamEpoch.load(std::memory_order_relaxed) != Epoch) {
+    UR_CHECK_ERROR(hipStreamWaitEvent(Stream, BarrierEvent, 0));
+    StreamEpoch.store(Epoch, std::memory_order_relaxed);
+  }
+}
+} // namespace
 
 void ur_queue_handle_t_::computeStreamWaitForBarrierIfNeeded(
     hipStream_t Stream, uint32_t Stream_i) {
-  if (BarrierEvent && !ComputeAppliedBarrier[Stream_i]) {
-    UR_CHECK_ERROR(hipStreamWaitEvent(Stream, BarrierEvent, 0));
-    ComputeAppliedBarrier[Stream_i] = true;
-  }
+  waitForBarrierIfNeeded(Stream, BarrierEvent, BarrierEpoch,
+                         ComputeBarrierEpochs[Stream_i]);
 }
 
 void ur_queue_handle_t_::transferStreamWaitForBarrierIfNeeded(
     hipStream_t Stream, uint32_t Stream_i) {
-  if (BarrierEvent && !TransferAppliedBarrier[Stream_i]) {
-    UR_CHECK_ERROR(hipStreamWaitEvent(Stream, BarrierEvent, 0));
-    TransferAppliedBarrier[Stream_i] = true;
+  waitForBarrierIfNeeded(Stream, BarrierEvent, BarrierEpoch,
+                         TransferBarrierEpochs[Stream_i]);
+}
+
+void ur_queue_handle_t_::createStreamsIfNeeded(
+    std::vector<native_type> &Streams, std::atomic_uint32_t &NumStreams,
+    std::mutex &Mutex, uint32_t Stream_i) {
+  // Lock-free once the stream is created
+  if (Stream_i < NumStreams.load(std::memory_order_acquire)) {
+    return;
+  }
+  std::lock_guard<std::mutex> Guard(Mutex);
+  // The streams are published by NumStreams once created, so the threads
+  // which got a token for them wait on Mutex until then
+  uint32_t Created = NumStreams.load(std::memory_order_relaxed);
+  for (; Created <= Stream_i; Created++) {
+    UR_CHECK_ERROR(
+        hipStreamCreateWithPriority(&Streams[Created], Flags, Priority));
+    NumStreams.store(Created + 1, std::memory_order_release);
   }
 }
 
@@ -34,27 +65,17 @@ hipStream_t ur_queue_handle_t_::getNextComputeStream(uint32_t *StreamToken) {
   uint32_t Stream_i;
   uint32_t Token;
   while (true) {
-    if (NumComputeStreams < ComputeStreams.size()) {
-      // the check above is for performance - so as not to lock mutex every time
-      std::lock_guard<std::mutex> guard(ComputeStreamMutex);
-      // The second check is done after mutex is locked so other threads can not
-      // change NumComputeStreams after that
-      if (NumComputeStreams < ComputeStreams.size()) {
-        UR_CHECK_ERROR(hipStreamCreateWithPriority(
-            &ComputeStreams[NumComputeStreams++], Flags, Priority));
-      }
-    }
     Token = ComputeStreamIdx++;
     Stream_i = Token % ComputeStreams.size();
     // if a stream has been reused before it was next selected round-robin
     // fashion, we want to delay its next use and instead select another one
     // that is more likely to have completed all the enqueued work.
-    if (DelayCompute[Stream_i]) {
-      DelayCompute[Stream_i] = false;
-    } else {
+    if (!DelayCompute[Stream_i].exchange(false)) {
       break;
     }
   }
+  createStreamsIfNeeded(ComputeStreams, NumComputeStreams, ComputeStreamMutex,
+                        Stream_i);
   if (StreamToken) {
     *StreamToken = Token;
   }
@@ -97,25 +118,26 @@ hipStream_t ur_queue_handle_t_::getNextTransferStream() {
   if (TransferStreams.empty()) { // for example in in-order queue
     return getNextComputeStream();
   }
-  if (NumTransferStreams < TransferStreams.size()) {
-    // the check above is for performance - so as not to lock mutex every time
-    std::lock_guard<std::mutex> Guard(TransferStreamMutex);
-    // The second check is done after mutex is locked so other threads can not
-    // change NumTransferStreams after that
-    if (NumTransferStreams < TransferStreams.size()) {
-      UR_CHECK_ERROR(hipStreamCreateWithPriority(
-          &TransferStreams[NumTransferStreams++], Flags, Priority));
-    }
-  }
   uint32_t Stream_i = TransferStreamIdx++ % TransferStreams.size();
+  createStreamsIfNeeded(TransferStreams, NumTransferStreams,
+                        TransferStreamMutex, Stream_i);
   hipStream_t Res = TransferStreams[Stream_i];
   transferStreamWaitForBarrierIfNeeded(Res, Stream_i);
   return Res;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urQueueCreate(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-              const ur_queue_properties_t *pProps, ur_queue_handle_t *phQueue) {
+unsigned int ur_queue_handle_t_::getBulkQueueMaxStreams() {
+  static const unsigned int MaxStreams = static_cast<unsigned int>(
+      getenv_to_unsigned("UR_HIP_BULK_QUEUE_MAX_STREAMS").value_or(0));
+  return MaxStreams;
+}
+
+namespace ur::hip {
+
+ur_result_t urQueueCreate(ur_context_handle_t hContext,
+                          ur_device_handle_t hDevice,
+                          const ur_queue_properties_t *pProps,
+                          ur_queue_handle_t *phQueue) {
   UR_ASSERT(std::find(hContext->getDevices().begin(),
                       hContext->getDevices().end(),
                       hDevice) != hContext->getDevices().end(),
@@ -147,15 +169,31 @@ urQueueCreate(ur_context_handle_t hContext, ur_device_handle_t hDevice,
         pProps ? pProps->flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE
                : false;
 
-    std::vector<hipStream_t> ComputeHipStreams(
-        IsOutOfOrder ? ur_queue_handle_t_::DefaultNumComputeStreams : 1);
-    std::vector<hipStream_t> TransferHipStreams(
-        IsOutOfOrder ? ur_queue_handle_t_::DefaultNumTransferStreams : 0);
+    unsigned int NumComputeStreams =
+        IsOutOfOrder ? ur_queue_handle_t_::DefaultNumComputeStreams : 1;
+    unsigned int NumTransferStreams =
+        IsOutOfOrder ? ur_queue_handle_t_::DefaultNumTransferStreams : 0;
+    // In the QoS mode the bulk queues take few streams at a low priority,
+    // leaving the other hardware queues of the device to the latency critical
+    // ones
+    if (unsigned int MaxStreams = ur_queue_handle_t_::getBulkQueueMaxStreams();
+        MaxStreams && !(URFlags & UR_QUEUE_FLAG_PRIORITY_HIGH)) {
+      NumComputeStreams = std::min(NumComputeStreams, MaxStreams);
+      NumTransferStreams = std::min(NumTransferStreams, MaxStreams);
+      if (!(URFlags & UR_QUEUE_FLAG_PRIORITY_LOW)) {
+        ScopedDevice Active(hDevice);
+        UR_CHECK_ERROR(hipDeviceGetStreamPriorityRange(&Priority, nullptr));
+      }
+    }
+
+    std::vector<hipStream_t> ComputeHipStreams(NumComputeStreams);
+    std::vector<hipStream_t> TransferHipStreams(NumTransferStreams);
 
     QueueImpl = std::unique_ptr<ur_queue_handle_t_>(new ur_queue_handle_t_{
         std::move(ComputeHipStreams), std::move(TransferHipStreams), hContext,
         hDevice, Flags, URFlags, Priority});
 
+    hContext->addQueue(QueueImpl.get());
     *phQueue = QueueImpl.release();
 
     return UR_RESULT_SUCCESS;
@@ -168,11 +206,9 @@ urQueueCreate(ur_context_handle_t hContext, ur_device_handle_t hDevice,
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
-                                                   ur_queue_info_t propName,
-                                                   size_t propValueSize,
-                                                   void *pPropValue,
-                                                   size_t *pPropSizeRet) {
+ur_result_t urQueueGetInfo(ur_queue_handle_t hQueue, ur_queue_info_t propName,
+                           size_t propValueSize, void *pPropValue,
+                           size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propValueSize, pPropValue, pPropSizeRet);
   switch (propName) {
   case UR_QUEUE_INFO_CONTEXT:
@@ -199,6 +235,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
     });
     return ReturnValue(IsReady);
   }
+  case UR_QUEUE_INFO_COMMAND_COUNTS:
+  case UR_QUEUE_INFO_BYTES_COPIED:
+  case UR_QUEUE_INFO_BATCH_COUNT:
+  case UR_QUEUE_INFO_AVERAGE_BATCH_SIZE:
+  case UR_QUEUE_INFO_HOST_WAIT_TIME:
+  case UR_QUEUE_INFO_CREATED_EVENT_COUNT:
+    return hQueue->Telemetry.getInfo(propName, ReturnValue);
   case UR_QUEUE_INFO_DEVICE_DEFAULT:
   case UR_QUEUE_INFO_SIZE:
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
@@ -207,20 +250,22 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueRetain(ur_queue_handle_t hQueue) {
+ur_result_t urQueueRetain(ur_queue_handle_t hQueue) {
   UR_ASSERT(hQueue->getReferenceCount() > 0, UR_RESULT_ERROR_INVALID_QUEUE);
 
   hQueue->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueRelease(ur_queue_handle_t hQueue) {
+ur_result_t urQueueRelease(ur_queue_handle_t hQueue) {
   if (hQueue->decrementReferenceCount() > 0) {
     return UR_RESULT_SUCCESS;
   }
 
   try {
     std::unique_ptr<ur_queue_handle_t_> QueueImpl(hQueue);
+    // Before its streams are destroyed, for the deferred frees
+    hQueue->getContext()->removeQueue(hQueue);
 
     if (!hQueue->backendHasOwnership())
       return UR_RESULT_SUCCESS;
@@ -245,13 +290,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueRelease(ur_queue_handle_t hQueue) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
+ur_result_t urQueueFinish(ur_queue_handle_t hQueue) {
+  TRACK_SCOPE_LATENCY("urQueueFinish");
   // set default result to a negative result (avoid false-positve tests)
   ur_result_t Result = UR_RESULT_ERROR_OUT_OF_RESOURCES;
 
   try {
 
     ScopedDevice Active(hQueue->getDevice());
+    ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
 
     hQueue->syncStreams<true>([&Result](hipStream_t S) {
       UR_CHECK_ERROR(hipStreamSynchronize(S));
@@ -270,7 +317,78 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
 // There is no HIP counterpart for queue flushing and we don't run into the
 // same problem of having to flush cross-queue dependencies as some of the
 // other plugins, so it can be left as no-op.
-UR_APIEXPORT ur_result_t UR_APICALL urQueueFlush(ur_queue_handle_t) {
+ur_result_t urQueueFlush(ur_queue_handle_t) {
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urQueueReserveTimestampMarkersExp(ur_queue_handle_t hQueue,
+                                              uint32_t capacity) {
+  UR_ASSERT(capacity > 0, UR_RESULT_ERROR_INVALID_SIZE);
+  try {
+    ScopedDevice Active(hQueue->getDevice());
+    std::lock_guard<std::mutex> Guard(hQueue->TimestampMarkersMutex);
+    if (hQueue->TimestampMarkers) {
+      return UR_RESULT_ERROR_INVALID_OPERATION;
+    }
+    // The events created before a failure are kept for the next attempt,
+    // and destroyed along with the queue
+    auto &Events = hQueue->TimestampMarkerEvents;
+    Events.reserve(capacity);
+    while (Events.size() < capacity) {
+      hipEvent_t Event;
+      UR_CHECK_ERROR(hipEventCreateWithFlags(&Event, hipEventDefault));
+      Events.push_back(Event);
+    }
+    hQueue->TimestampMarkers.emplace(capacity);
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urQueueReadTimestampMarkersExp(ur_queue_handle_t hQueue,
+                                           uint64_t firstMarker, uint32_t count,
+                                           uint64_t *pTimestamps) {
+  try {
+    ScopedDevice Active(hQueue->getDevice());
+    std::unique_lock<std::mutex> Guard(hQueue->TimestampMarkersMutex);
+    auto &Markers = hQueue->TimestampMarkers;
+    if (!Markers) {
+      return UR_RESULT_ERROR_INVALID_OPERATION;
+    }
+    ur_result_t Result = Markers->checkRange(firstMarker, count);
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+    std::vector<hipEvent_t> Events(count);
+    for (uint32_t i = 0; i < count; i++) {
+      Events[i] = hQueue->TimestampMarkerEvents[Markers->slot(firstMarker + i)];
+    }
+
+    // The events are waited for without the lock, the markers enqueued
+    // meanwhile may record them again, which the second check catches
+    Guard.unlock();
+    {
+      ur::queue_telemetry_t::wait_scope_t Wait(hQueue->Telemetry);
+      for (hipEvent_t Event : Events) {
+        UR_CHECK_ERROR(hipEventSynchronize(Event));
+      }
+    }
+    Guard.lock();
+    Result = Markers->checkRange(firstMarker, count);
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+      pTimestamps[i] = hQueue->getDevice()->getElapsedTime(Events[i]);
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -280,9 +398,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueFlush(ur_queue_handle_t) {
 /// \param[out] phNativeQueue Set to the native handle of the UR queue object.
 ///
 /// \return UR_RESULT_SUCCESS
-UR_APIEXPORT ur_result_t UR_APICALL
-urQueueGetNativeHandle(ur_queue_handle_t hQueue, ur_queue_native_desc_t *,
-                       ur_native_handle_t *phNativeQueue) {
+ur_result_t urQueueGetNativeHandle(ur_queue_handle_t hQueue,
+                                   ur_queue_native_desc_t *,
+                                   ur_native_handle_t *phNativeQueue) {
   ScopedDevice Active(hQueue->getDevice());
   *phNativeQueue =
       reinterpret_cast<ur_native_handle_t>(hQueue->getNextComputeStream());
@@ -295,7 +413,7 @@ urQueueGetNativeHandle(ur_queue_handle_t hQueue, ur_queue_native_desc_t *,
 /// \param[in] hNativeQueue The native handle to create UR queue object from.
 /// \param[in] hContext is the UR context of the queue.
 /// \param[out] phQueue Set to the UR queue object created from native handle.
-UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
+ur_result_t urQueueCreateWithNativeHandle(
     ur_native_handle_t hNativeQueue, ur_context_handle_t hContext,
     ur_device_handle_t hDevice, const ur_queue_native_properties_t *pProperties,
     ur_queue_handle_t *phQueue) {
@@ -330,6 +448,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
                              /*priority*/ 0,
                              /*backend_owns*/ pProperties->isNativeHandleOwned};
   (*phQueue)->NumComputeStreams = 1;
+  hContext->addQueue(*phQueue);
 
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::hip
@@ -10,8 +10,13 @@
 #pragma once
 
 #include "common.hpp"
+#include "ur_queue_telemetry.hpp"
+#include "ur_timestamp_markers.hpp"
+#include "ur_interface_loader.hpp"
+#include <atomic>
 #include <hip/hip_runtime.h>
 #include <mutex>
+#include <optional>
 #include <vector>
 
 using ur_stream_guard = std::unique_lock<std::mutex>;
@@ -22,6 +27,13 @@ struct ur_queue_handle_t_ {
   using native_type = hipStream_t;
   static constexpr int DefaultNumComputeStreams = 64;
   static constexpr int DefaultNumTransferStreams = 16;
+  // The number of streams of each pool the queues without
+  // UR_QUEUE_FLAG_PRIORITY_HIGH create at most, 0 (the default) for no limit.
+  // Set with UR_HIP_BULK_QUEUE_MAX_STREAMS. The streams of all the queues
+  // share the hardware queues of the device, so limiting the bulk queues
+  // keeps some for the latency critical ones. The bulk queues without a
+  // priority flag then get the low priority.
+  static unsigned int getBulkQueueMaxStreams();
 
   std::vector<native_type> ComputeStreams;
   std::vector<native_type> TransferStreams;
@@ -32,11 +44,15 @@ struct ur_queue_handle_t_ {
   // DelayCompute keeps track of which streams have been recently reused and
   // their next use should be delayed. If a stream has been recently reused it
   // will be skipped the next time it would be selected round-robin style. When
-  // skipped, its delay flag is cleared.
-  std::vector<bool> DelayCompute;
-  // keep track of which streams have applied barrier
-  std::vector<bool> ComputeAppliedBarrier;
-  std::vector<bool> TransferAppliedBarrier;
+  // skipped, its delay flag is cleared. The flags are atomic as the streams
+  // are selected without locking.
+  std::vector<std::atomic_bool> DelayCompute;
+  // Every barrier bumps BarrierEpoch once BarrierEvent is recorded, and each
+  // stream keeps the epoch of the last barrier it waits for, so that getting
+  // a stream which already waits for the last barrier takes no lock
+  std::atomic_uint32_t BarrierEpoch{0};
+  std::vector<std::atomic_uint32_t> ComputeBarrierEpochs;
+  std::vector<std::atomic_uint32_t> TransferBarrierEpochs;
   ur_context_handle_t Context;
   ur_device_handle_t Device;
   hipEvent_t BarrierEvent = nullptr;
@@ -45,8 +61,10 @@ struct ur_queue_handle_t_ {
   std::atomic_uint32_t EventCount;
   std::atomic_uint32_t ComputeStreamIdx;
   std::atomic_uint32_t TransferStreamIdx;
-  unsigned int NumComputeStreams;
-  unsigned int NumTransferStreams;
+  // The number of streams created, which are created in order the first
+  // time they are selected
+  std::atomic_uint32_t NumComputeStreams;
+  std::atomic_uint32_t NumTransferStreams;
   unsigned int LastSyncComputeStreams;
   unsigned int LastSyncTransferStreams;
   unsigned int Flags;
@@ -60,6 +78,14 @@ struct ur_queue_handle_t_ {
   std::mutex TransferStreamMutex;
   std::mutex BarrierMutex;
   bool HasOwnership;
+  // The counters of the telemetry queries of urQueueGetInfo, every command
+  // is submitted to a stream on its own so each one counts as a batch
+  ur::queue_telemetry_t Telemetry;
+  // The ring of urQueueReserveTimestampMarkersExp, each marker recording the
+  // timing event of its slot
+  std::mutex TimestampMarkersMutex;
+  std::optional<ur::timestamp_markers_t> TimestampMarkers;
+  std::vector<hipEvent_t> TimestampMarkerEvents;
 
   ur_queue_handle_t_(std::vector<native_type> &&ComputeStreams,
                      std::vector<native_type> &&TransferStreams,
@@ -68,20 +94,23 @@ struct ur_queue_handle_t_ {
                      bool BackendOwns = true)
       : ComputeStreams{std::move(ComputeStreams)}, TransferStreams{std::move(
                                                        TransferStreams)},
-        DelayCompute(this->ComputeStreams.size(), false),
-        ComputeAppliedBarrier(this->ComputeStreams.size()),
-        TransferAppliedBarrier(this->TransferStreams.size()), Context{Context},
+        DelayCompute(this->ComputeStreams.size()),
+        ComputeBarrierEpochs(this->ComputeStreams.size()),
+        TransferBarrierEpochs(this->TransferStreams.size()), Context{Context},
         Device{Device}, RefCount{1}, EventCount{0}, ComputeStreamIdx{0},
         TransferStreamIdx{0}, NumComputeStreams{0}, NumTransferStreams{0},
         LastSyncComputeStreams{0}, LastSyncTransferStreams{0}, Flags(Flags),
         URFlags(URFlags), Priority(Priority), HasOwnership{BackendOwns} {
-    urContextRetain(Context);
-    urDeviceRetain(Device);
+    ur::hip::urContextRetain(Context);
+    ur::hip::urDeviceRetain(Device);
   }
 
   ~ur_queue_handle_t_() {
-    urContextRelease(Context);
-    urDeviceRelease(Device);
+    for (hipEvent_t Event : TimestampMarkerEvents) {
+      std::ignore = hipEventDestroy(Event);
+    }
+    ur::hip::urContextRelease(Context);
+    ur::hip::urDeviceRelease(Device);
   }
 
   void computeStreamWaitForBarrierIfNeeded(hipStream_t Stream,
@@ -89,6 +118,12 @@ struct ur_queue_handle_t_ {
   void transferStreamWaitForBarrierIfNeeded(hipStream_t Stream,
                                             uint32_t Stream_i);
 
+  // Creates the streams up to Streams[Stream_i] if they aren't yet, only
+  // locking Mutex while some of the streams aren't created
+  void createStreamsIfNeeded(std::vector<native_type> &Streams,
+                             std::atomic_uint32_t &NumStreams,
+                             std::mutex &Mutex, uint32_t Stream_i);
+
   // getNextCompute/TransferStream() functions return streams from
   // appropriate pools in round-robin fashion
   native_type getNextComputeStream(uint32_t *StreamToken = nullptr);
@@ -147,7 +182,8 @@ struct ur_queue_handle_t_ {
     {
       std::lock_guard<std::mutex> ComputeGuard(ComputeStreamMutex);
       unsigned int End = std::min(
-          static_cast<unsigned int>(ComputeStreams.size()), NumComputeStreams);
+          static_cast<unsigned int>(ComputeStreams.size()),
+          NumComputeStreams.load());
       if (!std::all_of(ComputeStreams.begin(), ComputeStreams.begin() + End, F))
         return false;
     }
@@ -155,7 +191,7 @@ struct ur_queue_handle_t_ {
       std::lock_guard<std::mutex> TransferGuard(TransferStreamMutex);
       unsigned int End =
           std::min(static_cast<unsigned int>(TransferStreams.size()),
-                   NumTransferStreams);
+                   NumTransferStreams.load());
       if (!std::all_of(TransferStreams.begin(), TransferStreams.begin() + End,
                        F))
         return false;
@@ -167,7 +203,8 @@ struct ur_queue_handle_t_ {
     {
       std::lock_guard<std::mutex> ComputeGuard(ComputeStreamMutex);
       unsigned int End = std::min(
-          static_cast<unsigned int>(ComputeStreams.size()), NumComputeStreams);
+          static_cast<unsigned int>(ComputeStreams.size()),
+          NumComputeStreams.load());
       for (unsigned int i = 0; i < End; i++) {
         F(ComputeStreams[i]);
       }
@@ -176,7 +213,7 @@ struct ur_queue_handle_t_ {
       std::lock_guard<std::mutex> TransferGuard(TransferStreamMutex);
       unsigned int End =
           std::min(static_cast<unsigned int>(TransferStreams.size()),
-                   NumTransferStreams);
+                   NumTransferStreams.load());
       for (unsigned int i = 0; i < End; i++) {
         F(TransferStreams[i]);
       }
@@ -202,7 +239,7 @@ struct ur_queue_handle_t_ {
       std::lock_guard<std::mutex> ComputeSyncGuard(ComputeStreamSyncMutex);
       std::lock_guard<std::mutex> ComputeGuard(ComputeStreamMutex);
       unsigned int Start = LastSyncComputeStreams;
-      unsigned int End = NumComputeStreams < Size ? NumComputeStreams
+      unsigned int End = NumComputeStreams < Size ? NumComputeStreams.load()
                                                   : ComputeStreamIdx.load();
       if (End - Start >= Size) {
         SyncCompute(0, Size);
@@ -227,8 +264,9 @@ struct ur_queue_handle_t_ {
       }
       std::lock_guard<std::mutex> TransferGuard(TransferStreamMutex);
       unsigned int Start = LastSyncTransferStreams;
-      unsigned int End = NumTransferStreams < Size ? NumTransferStreams
-                                                   : TransferStreamIdx.load();
+      unsigned int End = NumTransferStreams < Size
+                             ? NumTransferStreams.load()
+                             : TransferStreamIdx.load();
       if (End - Start >= Size) {
         SyncTransfer(0, Size);
       } else {
@@ -266,6 +304,12 @@ struct ur_queue_handle_t_ {
   uint32_t getNextEventId() noexcept { return ++EventCount; }
 
   bool backendHasOwnership() const noexcept { return HasOwnership; }
+
+  // Whether the commands run one after the other on a single stream, which
+  // orders them without any event
+  bool isInOrder() const noexcept {
+    return ComputeStreams.size() == 1 && TransferStreams.empty();
+  }
 };
 
 // RAII object to make hQueue stream getter methods all return the same stream
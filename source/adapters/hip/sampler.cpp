@@ -10,6 +10,9 @@
 
 #include "sampler.hpp"
 #include "common.hpp"
+#include "ur_interface_loader.hpp"
+
+namespace ur::hip {
 
 ur_result_t urSamplerCreate(ur_context_handle_t hContext,
                             const ur_sampler_desc_t *pDesc,
@@ -86,7 +89,7 @@ ur_result_t urSamplerRelease(ur_sampler_handle_t hSampler) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
+ur_result_t urSamplerCreateWithNativeHandle(
     [[maybe_unused]] ur_native_handle_t hNativeSampler,
     [[maybe_unused]] ur_context_handle_t hContext,
     [[maybe_unused]] const ur_sampler_native_properties_t *pProperties,
@@ -94,8 +97,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urSamplerGetNativeHandle([[maybe_unused]] ur_sampler_handle_t hSampler,
                          [[maybe_unused]] ur_native_handle_t *phNativeSampler) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+} // namespace ur::hip
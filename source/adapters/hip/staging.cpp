@@ -0,0 +1,198 @@
+//===--------- staging.cpp - HIP Adapter ----------------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "staging.hpp"
+#include "common.hpp"
+#include "context.hpp"
+#include "queue.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+ur_staging_pool_t_::ur_staging_pool_t_()
+    : MaxChunks([] {
+        const char *EnvVar = std::getenv("UR_HIP_STAGING_POOL_SIZE");
+        size_t PoolSize = EnvVar ? std::strtoull(EnvVar, nullptr, 10)
+                                 : size_t{64} * 1024 * 1024;
+        return PoolSize / ChunkSize;
+      }()) {}
+
+ur_staging_pool_t_::~ur_staging_pool_t_() {
+  for (void *Chunk : Chunks) {
+    std::ignore = hipHostFree(Chunk);
+  }
+}
+
+void *ur_staging_pool_t_::acquire() {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  if (!FreeChunks.empty()) {
+    void *Chunk = FreeChunks.back();
+    FreeChunks.pop_back();
+    return Chunk;
+  }
+  if (Chunks.size() == MaxChunks) {
+    return nullptr;
+  }
+
+  // Portable, so that the chunks can stage the copies of every device
+  void *Chunk = nullptr;
+  if (hipHostMalloc(&Chunk, ChunkSize, hipHostMallocPortable) != hipSuccess) {
+    return nullptr;
+  }
+  Chunks.push_back(Chunk);
+  return Chunk;
+}
+
+void ur_staging_pool_t_::release(void *Chunk) {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  FreeChunks.push_back(Chunk);
+}
+
+namespace {
+// The host side of a staged copy, run by a host function on the stream
+struct host_step_t {
+  void *Dst;
+  const void *Src;
+  size_t Size;
+  // Released to Pool once copied, if set
+  void *Chunk;
+  ur_staging_pool_t_ *Pool;
+};
+
+void runHostStep(void *UserData) {
+  std::unique_ptr<host_step_t> Step(static_cast<host_step_t *>(UserData));
+  if (Step->Size) {
+    std::memcpy(Step->Dst, Step->Src, Step->Size);
+  }
+  if (Step->Chunk) {
+    Step->Pool->release(Step->Chunk);
+  }
+}
+
+void enqueueHostStep(hipStream_t Stream, const host_step_t &Step) {
+  auto StepPtr = std::make_unique<host_step_t>(Step);
+  UR_CHECK_ERROR(hipLaunchHostFunc(Stream, runHostStep, StepPtr.get()));
+  StepPtr.release();
+}
+
+bool isPageable(const void *Ptr) { return !getPointerAttributes(Ptr); }
+
+bool isDeviceMemory(const void *Ptr) {
+  std::optional<hipPointerAttribute_t> Attributes = getPointerAttributes(Ptr);
+  return Attributes && getMemoryType(*Attributes) == hipMemoryTypeDevice;
+}
+
+// Copies in chunks, alternating between two chunks and, if the queue has
+// more than one, two transfer streams, the second one joining Stream at the
+// end. Returns false if the pool has no chunk for the copy.
+bool enqueueStagedCopy(ur_queue_handle_t hQueue, hipStream_t Stream,
+                       bool ToDevice, void *HostMem, hipDeviceptr_t DevMem,
+                       size_t Size) {
+  using pool_t = ur_staging_pool_t_;
+  ur_context_handle_t hContext = hQueue->getContext();
+  ur_device_handle_t hDevice = hQueue->getDevice();
+  pool_t &Pool = hContext->getStagingPool();
+  char *HostPtr = static_cast<char *>(HostMem);
+  char *DevPtr = static_cast<char *>(DevMem);
+
+  void *Chunks[2] = {Pool.acquire(), nullptr};
+  if (!Chunks[0]) {
+    return false;
+  }
+  hipStream_t Streams[2] = {Stream, Stream};
+  size_t NumChunks = 1;
+  if (Size > pool_t::ChunkSize && (Chunks[1] = Pool.acquire())) {
+    NumChunks = 2;
+    Streams[1] = hQueue->getNextTransferStream();
+  }
+
+  // The second stream starts after what Stream waits for, and Stream ends
+  // after the second stream
+  auto joinStreams = [&](hipStream_t From, hipStream_t To) {
+    hipEvent_t Event = hContext->getEvent(hDevice, false);
+    UR_CHECK_ERROR(hipEventRecord(Event, From));
+    UR_CHECK_ERROR(hipStreamWaitEvent(To, Event, 0));
+    hContext->recycleEvent(hDevice, false, Event);
+  };
+  if (Streams[1] != Stream) {
+    joinStreams(Stream, Streams[1]);
+  }
+
+  for (size_t Offset = 0, i = 0; Offset < Size;
+       Offset += pool_t::ChunkSize, i++) {
+    size_t ChunkCopySize = std::min(pool_t::ChunkSize, Size - Offset);
+    void *Chunk = Chunks[i % NumChunks];
+    hipStream_t ChunkStream = Streams[i % NumChunks];
+    if (ToDevice) {
+      enqueueHostStep(ChunkStream, {Chunk, HostPtr + Offset, ChunkCopySize,
+                                    nullptr, nullptr});
+      UR_CHECK_ERROR(hipMemcpyHtoDAsync(DevPtr + Offset, Chunk, ChunkCopySize,
+                                        ChunkStream));
+    } else {
+      UR_CHECK_ERROR(hipMemcpyDtoHAsync(Chunk, DevPtr + Offset, ChunkCopySize,
+                                        ChunkStream));
+      enqueueHostStep(ChunkStream, {HostPtr + Offset, Chunk, ChunkCopySize,
+                                    nullptr, nullptr});
+    }
+  }
+  for (size_t i = 0; i < NumChunks; i++) {
+    enqueueHostStep(Streams[i], {nullptr, nullptr, 0, Chunks[i], &Pool});
+  }
+
+  if (Streams[1] != Stream) {
+    joinStreams(Streams[1], Stream);
+  }
+  return true;
+}
+
+bool shouldStage(ur_queue_handle_t hQueue, size_t Size) {
+  return Size >= ur_staging_pool_t_::MinStagedSize &&
+         hQueue->getContext()->getStagingPool().enabled();
+}
+} // namespace
+
+void enqueueCopyHtoD(ur_queue_handle_t hQueue, hipStream_t Stream,
+                     hipDeviceptr_t Dst, const void *Src, size_t Size) {
+  if (shouldStage(hQueue, Size) && isPageable(Src) &&
+      enqueueStagedCopy(hQueue, Stream, true, const_cast<void *>(Src), Dst,
+                        Size)) {
+    return;
+  }
+  UR_CHECK_ERROR(
+      hipMemcpyHtoDAsync(Dst, const_cast<void *>(Src), Size, Stream));
+}
+
+void enqueueCopyDtoH(ur_queue_handle_t hQueue, hipStream_t Stream, void *Dst,
+                     hipDeviceptr_t Src, size_t Size) {
+  if (shouldStage(hQueue, Size) && isPageable(Dst) &&
+      enqueueStagedCopy(hQueue, Stream, false, Dst, Src, Size)) {
+    return;
+  }
+  UR_CHECK_ERROR(hipMemcpyDtoHAsync(Dst, Src, Size, Stream));
+}
+
+void enqueueCopy(ur_queue_handle_t hQueue, hipStream_t Stream, void *Dst,
+                 const void *Src, size_t Size) {
+  if (shouldStage(hQueue, Size)) {
+    if (isDeviceMemory(Dst) && isPageable(Src) &&
+        enqueueStagedCopy(hQueue, Stream, true, const_cast<void *>(Src), Dst,
+                          Size)) {
+      return;
+    }
+    if (isDeviceMemory(Src) && isPageable(Dst) &&
+        enqueueStagedCopy(hQueue, Stream, false, Dst, const_cast<void *>(Src),
+                          Size)) {
+      return;
+    }
+  }
+  UR_CHECK_ERROR(hipMemcpyAsync(Dst, Src, Size, hipMemcpyDefault, Stream));
+}
@@ -11,6 +11,8 @@
 #include <ur_api.h>
 #include <ur_ddi.h>
 
+#include "ur_interface_loader.hpp"
+
 namespace {
 
 // TODO - this is a duplicate of what is in the L0 plugin
@@ -28,7 +30,9 @@ ur_result_t validateProcInputs(ur_api_version_t version, void *pDdiTable) {
 }
 } // namespace
 
-#if defined(__cplusplus)
+#ifdef UR_STATIC_ADAPTER_HIP
+namespace ur::hip {
+#elif defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -38,12 +42,13 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreateWithNativeHandle = urPlatformCreateWithNativeHandle;
-  pDdiTable->pfnGet = urPlatformGet;
-  pDdiTable->pfnGetApiVersion = urPlatformGetApiVersion;
-  pDdiTable->pfnGetInfo = urPlatformGetInfo;
-  pDdiTable->pfnGetNativeHandle = urPlatformGetNativeHandle;
-  pDdiTable->pfnGetBackendOption = urPlatformGetBackendOption;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::hip::urPlatformCreateWithNativeHandle;
+  pDdiTable->pfnGet = ur::hip::urPlatformGet;
+  pDdiTable->pfnGetApiVersion = ur::hip::urPlatformGetApiVersion;
+  pDdiTable->pfnGetInfo = ur::hip::urPlatformGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::hip::urPlatformGetNativeHandle;
+  pDdiTable->pfnGetBackendOption = ur::hip::urPlatformGetBackendOption;
   return UR_RESULT_SUCCESS;
 }
 
@@ -53,13 +58,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetContextProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urContextCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urContextCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urContextGetInfo;
-  pDdiTable->pfnGetNativeHandle = urContextGetNativeHandle;
-  pDdiTable->pfnRelease = urContextRelease;
-  pDdiTable->pfnRetain = urContextRetain;
-  pDdiTable->pfnSetExtendedDeleter = urContextSetExtendedDeleter;
+  pDdiTable->pfnCreate = ur::hip::urContextCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::hip::urContextCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::hip::urContextGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::hip::urContextGetNativeHandle;
+  pDdiTable->pfnRelease = ur::hip::urContextRelease;
+  pDdiTable->pfnRetain = ur::hip::urContextRetain;
+  pDdiTable->pfnSetExtendedDeleter = ur::hip::urContextSetExtendedDeleter;
   return UR_RESULT_SUCCESS;
 }
 
@@ -69,14 +75,25 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreateWithNativeHandle = urEventCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urEventGetInfo;
-  pDdiTable->pfnGetNativeHandle = urEventGetNativeHandle;
-  pDdiTable->pfnGetProfilingInfo = urEventGetProfilingInfo;
-  pDdiTable->pfnRelease = urEventRelease;
-  pDdiTable->pfnRetain = urEventRetain;
-  pDdiTable->pfnSetCallback = urEventSetCallback;
-  pDdiTable->pfnWait = urEventWait;
+  pDdiTable->pfnCreateWithNativeHandle = ur::hip::urEventCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::hip::urEventGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::hip::urEventGetNativeHandle;
+  pDdiTable->pfnGetProfilingInfo = ur::hip::urEventGetProfilingInfo;
+  pDdiTable->pfnRelease = ur::hip::urEventRelease;
+  pDdiTable->pfnRetain = ur::hip::urEventRetain;
+  pDdiTable->pfnSetCallback = ur::hip::urEventSetCallback;
+  pDdiTable->pfnWait = ur::hip::urEventWait;
+  return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ur_event_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnWaitAnyExp = ur::hip::urEventWaitAnyExp;
+  pDdiTable->pfnGetExecutionStatusExp = ur::hip::urEventGetExecutionStatusExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -86,21 +103,23 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnBuild = urProgramBuild;
-  pDdiTable->pfnCompile = urProgramCompile;
-  pDdiTable->pfnCreateWithBinary = urProgramCreateWithBinary;
-  pDdiTable->pfnCreateWithIL = urProgramCreateWithIL;
-  pDdiTable->pfnCreateWithNativeHandle = urProgramCreateWithNativeHandle;
-  pDdiTable->pfnGetBuildInfo = urProgramGetBuildInfo;
-  pDdiTable->pfnGetFunctionPointer = urProgramGetFunctionPointer;
-  pDdiTable->pfnGetGlobalVariablePointer = urProgramGetGlobalVariablePointer;
-  pDdiTable->pfnGetInfo = urProgramGetInfo;
-  pDdiTable->pfnGetNativeHandle = urProgramGetNativeHandle;
-  pDdiTable->pfnLink = urProgramLink;
-  pDdiTable->pfnRelease = urProgramRelease;
-  pDdiTable->pfnRetain = urProgramRetain;
+  pDdiTable->pfnBuild = ur::hip::urProgramBuild;
+  pDdiTable->pfnCompile = ur::hip::urProgramCompile;
+  pDdiTable->pfnCreateWithBinary = ur::hip::urProgramCreateWithBinary;
+  pDdiTable->pfnCreateWithIL = ur::hip::urProgramCreateWithIL;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::hip::urProgramCreateWithNativeHandle;
+  pDdiTable->pfnGetBuildInfo = ur::hip::urProgramGetBuildInfo;
+  pDdiTable->pfnGetFunctionPointer = ur::hip::urProgramGetFunctionPointer;
+  pDdiTable->pfnGetGlobalVariablePointer =
+      ur::hip::urProgramGetGlobalVariablePointer;
+  pDdiTable->pfnGetInfo = ur::hip::urProgramGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::hip::urProgramGetNativeHandle;
+  pDdiTable->pfnLink = ur::hip::urProgramLink;
+  pDdiTable->pfnRelease = ur::hip::urProgramRelease;
+  pDdiTable->pfnRetain = ur::hip::urProgramRetain;
   pDdiTable->pfnSetSpecializationConstants =
-      urProgramSetSpecializationConstants;
+      ur::hip::urProgramSetSpecializationConstants;
   return UR_RESULT_SUCCESS;
 }
 
@@ -110,22 +129,25 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urKernelCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urKernelCreateWithNativeHandle;
-  pDdiTable->pfnGetGroupInfo = urKernelGetGroupInfo;
-  pDdiTable->pfnGetInfo = urKernelGetInfo;
-  pDdiTable->pfnGetNativeHandle = urKernelGetNativeHandle;
-  pDdiTable->pfnGetSubGroupInfo = urKernelGetSubGroupInfo;
-  pDdiTable->pfnRelease = urKernelRelease;
-  pDdiTable->pfnRetain = urKernelRetain;
-  pDdiTable->pfnSetArgLocal = urKernelSetArgLocal;
-  pDdiTable->pfnSetArgMemObj = urKernelSetArgMemObj;
-  pDdiTable->pfnSetArgPointer = urKernelSetArgPointer;
-  pDdiTable->pfnSetArgSampler = urKernelSetArgSampler;
-  pDdiTable->pfnSetArgValue = urKernelSetArgValue;
-  pDdiTable->pfnSetExecInfo = urKernelSetExecInfo;
-  pDdiTable->pfnSetSpecializationConstants = urKernelSetSpecializationConstants;
-  pDdiTable->pfnGetSuggestedLocalWorkSize = urKernelGetSuggestedLocalWorkSize;
+  pDdiTable->pfnCreate = ur::hip::urKernelCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::hip::urKernelCreateWithNativeHandle;
+  pDdiTable->pfnGetGroupInfo = ur::hip::urKernelGetGroupInfo;
+  pDdiTable->pfnGetInfo = ur::hip::urKernelGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::hip::urKernelGetNativeHandle;
+  pDdiTable->pfnGetSubGroupInfo = ur::hip::urKernelGetSubGroupInfo;
+  pDdiTable->pfnRelease = ur::hip::urKernelRelease;
+  pDdiTable->pfnRetain = ur::hip::urKernelRetain;
+  pDdiTable->pfnSetArgLocal = ur::hip::urKernelSetArgLocal;
+  pDdiTable->pfnSetArgMemObj = ur::hip::urKernelSetArgMemObj;
+  pDdiTable->pfnSetArgPointer = ur::hip::urKernelSetArgPointer;
+  pDdiTable->pfnSetArgSampler = ur::hip::urKernelSetArgSampler;
+  pDdiTable->pfnSetArgValue = ur::hip::urKernelSetArgValue;
+  pDdiTable->pfnSetExecInfo = ur::hip::urKernelSetExecInfo;
+  pDdiTable->pfnSetSpecializationConstants =
+      ur::hip::urKernelSetSpecializationConstants;
+  pDdiTable->pfnGetSuggestedLocalWorkSize =
+      ur::hip::urKernelGetSuggestedLocalWorkSize;
   return UR_RESULT_SUCCESS;
 }
 
@@ -135,12 +157,13 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetSamplerProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urSamplerCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urSamplerCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urSamplerGetInfo;
-  pDdiTable->pfnGetNativeHandle = urSamplerGetNativeHandle;
-  pDdiTable->pfnRelease = urSamplerRelease;
-  pDdiTable->pfnRetain = urSamplerRetain;
+  pDdiTable->pfnCreate = ur::hip::urSamplerCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::hip::urSamplerCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::hip::urSamplerGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::hip::urSamplerGetNativeHandle;
+  pDdiTable->pfnRelease = ur::hip::urSamplerRelease;
+  pDdiTable->pfnRetain = ur::hip::urSamplerRetain;
   return UR_RESULT_SUCCESS;
 }
 
@@ -150,17 +173,18 @@ urGetMemProcAddrTable(ur_api_version_t version, ur_mem_dditable_t *pDdiTable) {
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnBufferCreate = urMemBufferCreate;
-  pDdiTable->pfnBufferPartition = urMemBufferPartition;
+  pDdiTable->pfnBufferCreate = ur::hip::urMemBufferCreate;
+  pDdiTable->pfnBufferPartition = ur::hip::urMemBufferPartition;
   pDdiTable->pfnBufferCreateWithNativeHandle =
-      urMemBufferCreateWithNativeHandle;
-  pDdiTable->pfnImageCreateWithNativeHandle = urMemImageCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urMemGetInfo;
-  pDdiTable->pfnGetNativeHandle = urMemGetNativeHandle;
-  pDdiTable->pfnImageCreate = urMemImageCreate;
-  pDdiTable->pfnImageGetInfo = urMemImageGetInfo;
-  pDdiTable->pfnRelease = urMemRelease;
-  pDdiTable->pfnRetain = urMemRetain;
+      ur::hip::urMemBufferCreateWithNativeHandle;
+  pDdiTable->pfnImageCreateWithNativeHandle =
+      ur::hip::urMemImageCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::hip::urMemGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::hip::urMemGetNativeHandle;
+  pDdiTable->pfnImageCreate = ur::hip::urMemImageCreate;
+  pDdiTable->pfnImageGetInfo = ur::hip::urMemImageGetInfo;
+  pDdiTable->pfnRelease = ur::hip::urMemRelease;
+  pDdiTable->pfnRetain = ur::hip::urMemRetain;
   return UR_RESULT_SUCCESS;
 }
 
@@ -170,31 +194,33 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnDeviceGlobalVariableRead = urEnqueueDeviceGlobalVariableRead;
-  pDdiTable->pfnDeviceGlobalVariableWrite = urEnqueueDeviceGlobalVariableWrite;
-  pDdiTable->pfnEventsWait = urEnqueueEventsWait;
-  pDdiTable->pfnEventsWaitWithBarrier = urEnqueueEventsWaitWithBarrier;
-  pDdiTable->pfnKernelLaunch = urEnqueueKernelLaunch;
-  pDdiTable->pfnMemBufferCopy = urEnqueueMemBufferCopy;
-  pDdiTable->pfnMemBufferCopyRect = urEnqueueMemBufferCopyRect;
-  pDdiTable->pfnMemBufferFill = urEnqueueMemBufferFill;
-  pDdiTable->pfnMemBufferMap = urEnqueueMemBufferMap;
-  pDdiTable->pfnMemBufferRead = urEnqueueMemBufferRead;
-  pDdiTable->pfnMemBufferReadRect = urEnqueueMemBufferReadRect;
-  pDdiTable->pfnMemBufferWrite = urEnqueueMemBufferWrite;
-  pDdiTable->pfnMemBufferWriteRect = urEnqueueMemBufferWriteRect;
-  pDdiTable->pfnMemImageCopy = urEnqueueMemImageCopy;
-  pDdiTable->pfnMemImageRead = urEnqueueMemImageRead;
-  pDdiTable->pfnMemImageWrite = urEnqueueMemImageWrite;
-  pDdiTable->pfnMemUnmap = urEnqueueMemUnmap;
-  pDdiTable->pfnUSMFill2D = urEnqueueUSMFill2D;
-  pDdiTable->pfnUSMFill = urEnqueueUSMFill;
-  pDdiTable->pfnUSMAdvise = urEnqueueUSMAdvise;
-  pDdiTable->pfnUSMMemcpy2D = urEnqueueUSMMemcpy2D;
-  pDdiTable->pfnUSMMemcpy = urEnqueueUSMMemcpy;
-  pDdiTable->pfnUSMPrefetch = urEnqueueUSMPrefetch;
-  pDdiTable->pfnReadHostPipe = urEnqueueReadHostPipe;
-  pDdiTable->pfnWriteHostPipe = urEnqueueWriteHostPipe;
+  pDdiTable->pfnDeviceGlobalVariableRead =
+      ur::hip::urEnqueueDeviceGlobalVariableRead;
+  pDdiTable->pfnDeviceGlobalVariableWrite =
+      ur::hip::urEnqueueDeviceGlobalVariableWrite;
+  pDdiTable->pfnEventsWait = ur::hip::urEnqueueEventsWait;
+  pDdiTable->pfnEventsWaitWithBarrier = ur::hip::urEnqueueEventsWaitWithBarrier;
+  pDdiTable->pfnKernelLaunch = ur::hip::urEnqueueKernelLaunch;
+  pDdiTable->pfnMemBufferCopy = ur::hip::urEnqueueMemBufferCopy;
+  pDdiTable->pfnMemBufferCopyRect = ur::hip::urEnqueueMemBufferCopyRect;
+  pDdiTable->pfnMemBufferFill = ur::hip::urEnqueueMemBufferFill;
+  pDdiTable->pfnMemBufferMap = ur::hip::urEnqueueMemBufferMap;
+  pDdiTable->pfnMemBufferRead = ur::hip::urEnqueueMemBufferRead;
+  pDdiTable->pfnMemBufferReadRect = ur::hip::urEnqueueMemBufferReadRect;
+  pDdiTable->pfnMemBufferWrite = ur::hip::urEnqueueMemBufferWrite;
+  pDdiTable->pfnMemBufferWriteRect = ur::hip::urEnqueueMemBufferWriteRect;
+  pDdiTable->pfnMemImageCopy = ur::hip::urEnqueueMemImageCopy;
+  pDdiTable->pfnMemImageRead = ur::hip::urEnqueueMemImageRead;
+  pDdiTable->pfnMemImageWrite = ur::hip::urEnqueueMemImageWrite;
+  pDdiTable->pfnMemUnmap = ur::hip::urEnqueueMemUnmap;
+  pDdiTable->pfnUSMFill2D = ur::hip::urEnqueueUSMFill2D;
+  pDdiTable->pfnUSMFill = ur::hip::urEnqueueUSMFill;
+  pDdiTable->pfnUSMAdvise = ur::hip::urEnqueueUSMAdvise;
+  pDdiTable->pfnUSMMemcpy2D = ur::hip::urEnqueueUSMMemcpy2D;
+  pDdiTable->pfnUSMMemcpy = ur::hip::urEnqueueUSMMemcpy;
+  pDdiTable->pfnUSMPrefetch = ur::hip::urEnqueueUSMPrefetch;
+  pDdiTable->pfnReadHostPipe = ur::hip::urEnqueueReadHostPipe;
+  pDdiTable->pfnWriteHostPipe = ur::hip::urEnqueueWriteHostPipe;
   return UR_RESULT_SUCCESS;
 }
 
@@ -204,11 +230,11 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnAdapterGet = urAdapterGet;
-  pDdiTable->pfnAdapterGetInfo = urAdapterGetInfo;
-  pDdiTable->pfnAdapterGetLastError = urAdapterGetLastError;
-  pDdiTable->pfnAdapterRelease = urAdapterRelease;
-  pDdiTable->pfnAdapterRetain = urAdapterRetain;
+  pDdiTable->pfnAdapterGet = ur::hip::urAdapterGet;
+  pDdiTable->pfnAdapterGetInfo = ur::hip::urAdapterGetInfo;
+  pDdiTable->pfnAdapterGetLastError = ur::hip::urAdapterGetLastError;
+  pDdiTable->pfnAdapterRelease = ur::hip::urAdapterRelease;
+  pDdiTable->pfnAdapterRetain = ur::hip::urAdapterRetain;
 
   return UR_RESULT_SUCCESS;
 }
@@ -219,14 +245,27 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urQueueCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urQueueCreateWithNativeHandle;
-  pDdiTable->pfnFinish = urQueueFinish;
-  pDdiTable->pfnFlush = urQueueFlush;
-  pDdiTable->pfnGetInfo = urQueueGetInfo;
-  pDdiTable->pfnGetNativeHandle = urQueueGetNativeHandle;
-  pDdiTable->pfnRelease = urQueueRelease;
-  pDdiTable->pfnRetain = urQueueRetain;
+  pDdiTable->pfnCreate = ur::hip::urQueueCreate;
+  pDdiTable->pfnCreateWithNativeHandle = ur::hip::urQueueCreateWithNativeHandle;
+  pDdiTable->pfnFinish = ur::hip::urQueueFinish;
+  pDdiTable->pfnFlush = ur::hip::urQueueFlush;
+  pDdiTable->pfnGetInfo = ur::hip::urQueueGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::hip::urQueueGetNativeHandle;
+  pDdiTable->pfnRelease = ur::hip::urQueueRelease;
+  pDdiTable->pfnRetain = ur::hip::urQueueRetain;
+  return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ur_queue_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnReserveTimestampMarkersExp =
+      ur::hip::urQueueReserveTimestampMarkersExp;
+  pDdiTable->pfnReadTimestampMarkersExp =
+      ur::hip::urQueueReadTimestampMarkersExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -236,15 +275,15 @@ urGetUSMProcAddrTable(ur_api_version_t version, ur_usm_dditable_t *pDdiTable) {
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnDeviceAlloc = urUSMDeviceAlloc;
-  pDdiTable->pfnFree = urUSMFree;
-  pDdiTable->pfnGetMemAllocInfo = urUSMGetMemAllocInfo;
-  pDdiTable->pfnHostAlloc = urUSMHostAlloc;
-  pDdiTable->pfnPoolCreate = urUSMPoolCreate;
-  pDdiTable->pfnPoolRetain = urUSMPoolRetain;
-  pDdiTable->pfnPoolRelease = urUSMPoolRelease;
-  pDdiTable->pfnPoolGetInfo = urUSMPoolGetInfo;
-  pDdiTable->pfnSharedAlloc = urUSMSharedAlloc;
+  pDdiTable->pfnDeviceAlloc = ur::hip::urUSMDeviceAlloc;
+  pDdiTable->pfnFree = ur::hip::urUSMFree;
+  pDdiTable->pfnGetMemAllocInfo = ur::hip::urUSMGetMemAllocInfo;
+  pDdiTable->pfnHostAlloc = ur::hip::urUSMHostAlloc;
+  pDdiTable->pfnPoolCreate = ur::hip::urUSMPoolCreate;
+  pDdiTable->pfnPoolRetain = ur::hip::urUSMPoolRetain;
+  pDdiTable->pfnPoolRelease = ur::hip::urUSMPoolRelease;
+  pDdiTable->pfnPoolGetInfo = ur::hip::urUSMPoolGetInfo;
+  pDdiTable->pfnSharedAlloc = ur::hip::urUSMSharedAlloc;
   return UR_RESULT_SUCCESS;
 }
 
@@ -254,15 +293,16 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetDeviceProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreateWithNativeHandle = urDeviceCreateWithNativeHandle;
-  pDdiTable->pfnGet = urDeviceGet;
-  pDdiTable->pfnGetGlobalTimestamps = urDeviceGetGlobalTimestamps;
-  pDdiTable->pfnGetInfo = urDeviceGetInfo;
-  pDdiTable->pfnGetNativeHandle = urDeviceGetNativeHandle;
-  pDdiTable->pfnPartition = urDevicePartition;
-  pDdiTable->pfnRelease = urDeviceRelease;
-  pDdiTable->pfnRetain = urDeviceRetain;
-  pDdiTable->pfnSelectBinary = urDeviceSelectBinary;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::hip::urDeviceCreateWithNativeHandle;
+  pDdiTable->pfnGet = ur::hip::urDeviceGet;
+  pDdiTable->pfnGetGlobalTimestamps = ur::hip::urDeviceGetGlobalTimestamps;
+  pDdiTable->pfnGetInfo = ur::hip::urDeviceGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::hip::urDeviceGetNativeHandle;
+  pDdiTable->pfnPartition = ur::hip::urDevicePartition;
+  pDdiTable->pfnRelease = ur::hip::urDeviceRelease;
+  pDdiTable->pfnRetain = ur::hip::urDeviceRetain;
+  pDdiTable->pfnSelectBinary = ur::hip::urDeviceSelectBinary;
   return UR_RESULT_SUCCESS;
 }
 
@@ -272,32 +312,38 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
   if (UR_RESULT_SUCCESS != retVal) {
     return retVal;
   }
-  pDdiTable->pfnCreateExp = urCommandBufferCreateExp;
-  pDdiTable->pfnRetainExp = urCommandBufferRetainExp;
-  pDdiTable->pfnReleaseExp = urCommandBufferReleaseExp;
-  pDdiTable->pfnFinalizeExp = urCommandBufferFinalizeExp;
-  pDdiTable->pfnAppendKernelLaunchExp = urCommandBufferAppendKernelLaunchExp;
-  pDdiTable->pfnAppendUSMMemcpyExp = urCommandBufferAppendUSMMemcpyExp;
-  pDdiTable->pfnAppendUSMFillExp = urCommandBufferAppendUSMFillExp;
-  pDdiTable->pfnAppendMemBufferCopyExp = urCommandBufferAppendMemBufferCopyExp;
+  pDdiTable->pfnCreateExp = ur::hip::urCommandBufferCreateExp;
+  pDdiTable->pfnRetainExp = ur::hip::urCommandBufferRetainExp;
+  pDdiTable->pfnReleaseExp = ur::hip::urCommandBufferReleaseExp;
+  pDdiTable->pfnFinalizeExp = ur::hip::urCommandBufferFinalizeExp;
+  pDdiTable->pfnAppendKernelLaunchExp =
+      ur::hip::urCommandBufferAppendKernelLaunchExp;
+  pDdiTable->pfnAppendUSMMemcpyExp = ur::hip::urCommandBufferAppendUSMMemcpyExp;
+  pDdiTable->pfnAppendUSMFillExp = ur::hip::urCommandBufferAppendUSMFillExp;
+  pDdiTable->pfnAppendMemBufferCopyExp =
+      ur::hip::urCommandBufferAppendMemBufferCopyExp;
   pDdiTable->pfnAppendMemBufferCopyRectExp =
-      urCommandBufferAppendMemBufferCopyRectExp;
-  pDdiTable->pfnAppendMemBufferReadExp = urCommandBufferAppendMemBufferReadExp;
+      ur::hip::urCommandBufferAppendMemBufferCopyRectExp;
+  pDdiTable->pfnAppendMemBufferReadExp =
+      ur::hip::urCommandBufferAppendMemBufferReadExp;
   pDdiTable->pfnAppendMemBufferReadRectExp =
-      urCommandBufferAppendMemBufferReadRectExp;
+      ur::hip::urCommandBufferAppendMemBufferReadRectExp;
   pDdiTable->pfnAppendMemBufferWriteExp =
-      urCommandBufferAppendMemBufferWriteExp;
+      ur::hip::urCommandBufferAppendMemBufferWriteExp;
   pDdiTable->pfnAppendMemBufferWriteRectExp =
-      urCommandBufferAppendMemBufferWriteRectExp;
-  pDdiTable->pfnAppendUSMPrefetchExp = urCommandBufferAppendUSMPrefetchExp;
-  pDdiTable->pfnAppendUSMAdviseExp = urCommandBufferAppendUSMAdviseExp;
-  pDdiTable->pfnEnqueueExp = urCommandBufferEnqueueExp;
-  pDdiTable->pfnAppendMemBufferFillExp = urCommandBufferAppendMemBufferFillExp;
-  pDdiTable->pfnUpdateKernelLaunchExp = urCommandBufferUpdateKernelLaunchExp;
-  pDdiTable->pfnGetInfoExp = urCommandBufferGetInfoExp;
-  pDdiTable->pfnCommandGetInfoExp = urCommandBufferCommandGetInfoExp;
-  pDdiTable->pfnReleaseCommandExp = urCommandBufferReleaseCommandExp;
-  pDdiTable->pfnRetainCommandExp = urCommandBufferRetainCommandExp;
+      ur::hip::urCommandBufferAppendMemBufferWriteRectExp;
+  pDdiTable->pfnAppendUSMPrefetchExp =
+      ur::hip::urCommandBufferAppendUSMPrefetchExp;
+  pDdiTable->pfnAppendUSMAdviseExp = ur::hip::urCommandBufferAppendUSMAdviseExp;
+  pDdiTable->pfnEnqueueExp = ur::hip::urCommandBufferEnqueueExp;
+  pDdiTable->pfnAppendMemBufferFillExp =
+      ur::hip::urCommandBufferAppendMemBufferFillExp;
+  pDdiTable->pfnUpdateKernelLaunchExp =
+      ur::hip::urCommandBufferUpdateKernelLaunchExp;
+  pDdiTable->pfnGetInfoExp = ur::hip::urCommandBufferGetInfoExp;
+  pDdiTable->pfnCommandGetInfoExp = ur::hip::urCommandBufferCommandGetInfoExp;
+  pDdiTable->pfnReleaseCommandExp = ur::hip::urCommandBufferReleaseCommandExp;
+  pDdiTable->pfnRetainCommandExp = ur::hip::urCommandBufferRetainCommandExp;
 
   return retVal;
 }
@@ -308,9 +354,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUsmP2PExpProcAddrTable(
   if (UR_RESULT_SUCCESS != retVal) {
     return retVal;
   }
-  pDdiTable->pfnEnablePeerAccessExp = urUsmP2PEnablePeerAccessExp;
-  pDdiTable->pfnDisablePeerAccessExp = urUsmP2PDisablePeerAccessExp;
-  pDdiTable->pfnPeerAccessGetInfoExp = urUsmP2PPeerAccessGetInfoExp;
+  pDdiTable->pfnEnablePeerAccessExp = ur::hip::urUsmP2PEnablePeerAccessExp;
+  pDdiTable->pfnDisablePeerAccessExp = ur::hip::urUsmP2PDisablePeerAccessExp;
+  pDdiTable->pfnPeerAccessGetInfoExp = ur::hip::urUsmP2PPeerAccessGetInfoExp;
 
   return retVal;
 }
@@ -341,13 +387,13 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetVirtualMemProcAddrTable(
     return retVal;
   }
 
-  pDdiTable->pfnFree = urVirtualMemFree;
-  pDdiTable->pfnGetInfo = urVirtualMemGetInfo;
-  pDdiTable->pfnGranularityGetInfo = urVirtualMemGranularityGetInfo;
-  pDdiTable->pfnMap = urVirtualMemMap;
-  pDdiTable->pfnReserve = urVirtualMemReserve;
-  pDdiTable->pfnSetAccess = urVirtualMemSetAccess;
-  pDdiTable->pfnUnmap = urVirtualMemUnmap;
+  pDdiTable->pfnFree = ur::hip::urVirtualMemFree;
+  pDdiTable->pfnGetInfo = ur::hip::urVirtualMemGetInfo;
+  pDdiTable->pfnGranularityGetInfo = ur::hip::urVirtualMemGranularityGetInfo;
+  pDdiTable->pfnMap = ur::hip::urVirtualMemMap;
+  pDdiTable->pfnReserve = ur::hip::urVirtualMemReserve;
+  pDdiTable->pfnSetAccess = ur::hip::urVirtualMemSetAccess;
+  pDdiTable->pfnUnmap = ur::hip::urVirtualMemUnmap;
 
   return retVal;
 }
@@ -362,9 +408,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPhysicalMemProcAddrTable(
     return retVal;
   }
 
-  pDdiTable->pfnCreate = urPhysicalMemCreate;
-  pDdiTable->pfnRelease = urPhysicalMemRelease;
-  pDdiTable->pfnRetain = urPhysicalMemRetain;
+  pDdiTable->pfnCreate = ur::hip::urPhysicalMemCreate;
+  pDdiTable->pfnRelease = ur::hip::urPhysicalMemRelease;
+  pDdiTable->pfnRetain = ur::hip::urPhysicalMemRetain;
 
   return retVal;
 }
@@ -377,9 +423,15 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
   }
 
   pDdiTable->pfnCooperativeKernelLaunchExp =
-      urEnqueueCooperativeKernelLaunchExp;
-  pDdiTable->pfnTimestampRecordingExp = urEnqueueTimestampRecordingExp;
-  pDdiTable->pfnNativeCommandExp = urEnqueueNativeCommandExp;
+      ur::hip::urEnqueueCooperativeKernelLaunchExp;
+  pDdiTable->pfnTimestampRecordingExp = ur::hip::urEnqueueTimestampRecordingExp;
+  pDdiTable->pfnNativeCommandExp = ur::hip::urEnqueueNativeCommandExp;
+  pDdiTable->pfnUSMDeviceAllocExp = ur::hip::urEnqueueUSMDeviceAllocExp;
+  pDdiTable->pfnUSMFreeExp = ur::hip::urEnqueueUSMFreeExp;
+  pDdiTable->pfnMemBufferCopyRectBatchExp =
+      ur::hip::urEnqueueMemBufferCopyRectBatchExp;
+  pDdiTable->pfnKernelLaunchBatchExp = ur::hip::urEnqueueKernelLaunchBatchExp;
+  pDdiTable->pfnTimestampMarkerExp = ur::hip::urEnqueueTimestampMarkerExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -392,7 +444,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
   }
 
   pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
-      urKernelSuggestMaxCooperativeGroupCountExp;
+      ur::hip::urKernelSuggestMaxCooperativeGroupCountExp;
+  pDdiTable->pfnSetArgsExp = ur::hip::urKernelSetArgsExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -404,13 +457,110 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
     return result;
   }
 
-  pDdiTable->pfnBuildExp = urProgramBuildExp;
-  pDdiTable->pfnCompileExp = urProgramCompileExp;
-  pDdiTable->pfnLinkExp = urProgramLinkExp;
+  pDdiTable->pfnBuildExp = ur::hip::urProgramBuildExp;
+  pDdiTable->pfnCompileExp = ur::hip::urProgramCompileExp;
+  pDdiTable->pfnLinkExp = ur::hip::urProgramLinkExp;
 
   return UR_RESULT_SUCCESS;
 }
 
-#if defined(__cplusplus)
+#ifdef UR_STATIC_ADAPTER_HIP
+} // namespace ur::hip
+#elif defined(__cplusplus)
 } // extern "C"
 #endif
+
+#ifdef UR_STATIC_ADAPTER_HIP
+namespace ur::hip {
+ur_result_t urAdapterGetDdiTables(ur_dditable_t *ddi) {
+  if (ddi == nullptr) {
+    return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+  }
+
+  ur_result_t result;
+
+  result = ur::hip::urGetPlatformProcAddrTable(UR_API_VERSION_CURRENT,
+                                               &ddi->Platform);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::hip::urGetContextProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Context);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::hip::urGetEventProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Event);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::hip::urGetEventExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                               &ddi->EventExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::hip::urGetProgramProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Program);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::hip::urGetKernelProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Kernel);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::hip::urGetSamplerProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Sampler);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::hip::urGetEnqueueProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Enqueue);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::hip::urGetGlobalProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Global);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::hip::urGetQueueProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Queue);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::hip::urGetQueueExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                               &ddi->QueueExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::hip::urGetDeviceProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Device);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::hip::urGetCommandBufferExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                       &ddi->CommandBufferExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::hip::urGetUsmP2PExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                &ddi->UsmP2PExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::hip::urGetBindlessImagesExpProcAddrTable(
+      UR_API_VERSION_CURRENT, &ddi->BindlessImagesExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::hip::urGetVirtualMemProcAddrTable(UR_API_VERSION_CURRENT,
+                                                 &ddi->VirtualMem);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::hip::urGetPhysicalMemProcAddrTable(UR_API_VERSION_CURRENT,
+                                                  &ddi->PhysicalMem);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::hip::urGetEnqueueExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                 &ddi->EnqueueExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::hip::urGetKernelExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                &ddi->KernelExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::hip::urGetProgramExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                 &ddi->ProgramExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+
+  return result;
+}
+} // namespace ur::hip
+#endif
@@ -14,18 +14,29 @@
 #include "common.hpp"
 #include "context.hpp"
 #include "device.hpp"
+#include "enqueue.hpp"
+#include "event.hpp"
 #include "platform.hpp"
+#include "queue.hpp"
 #include "ur_util.hpp"
 #include "usm.hpp"
+#include "ur_interface_loader.hpp"
+
+namespace ur::hip {
 
 /// USM: Implements USM Host allocations using HIP Pinned Memory
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
-               ur_usm_pool_handle_t hPool, size_t size, void **ppMem) {
+ur_result_t urUSMHostAlloc(ur_context_handle_t hContext,
+                           const ur_usm_desc_t *pUSMDesc,
+                           ur_usm_pool_handle_t hPool, size_t size,
+                           void **ppMem) {
   uint32_t alignment;
   UR_ASSERT(checkUSMAlignment(alignment, pUSMDesc),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  // The deferred frees which are done may make room for the allocation, the
+  // errors of freeing them are not those of the allocation
+  std::ignore = hContext->reclaimDeferredFrees();
+
   if (!hPool) {
     return USMHostAllocImpl(ppMem, hContext, /* flags */ 0, size, alignment);
   }
@@ -34,14 +45,19 @@ urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
 }
 
 /// USM: Implements USM device allocations using a normal HIP device pointer
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t hPool,
-                 size_t size, void **ppMem) {
+ur_result_t urUSMDeviceAlloc(ur_context_handle_t hContext,
+                             ur_device_handle_t hDevice,
+                             const ur_usm_desc_t *pUSMDesc,
+                             ur_usm_pool_handle_t hPool, size_t size,
+                             void **ppMem) {
   uint32_t alignment;
   UR_ASSERT(checkUSMAlignment(alignment, pUSMDesc),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  // The deferred frees which are done may make room for the allocation, the
+  // errors of freeing them are not those of the allocation
+  std::ignore = hContext->reclaimDeferredFrees();
+
   if (!hPool) {
     return USMDeviceAllocImpl(ppMem, hContext, hDevice, /* flags */ 0, size,
                               alignment);
@@ -51,14 +67,19 @@ urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
 }
 
 /// USM: Implements USM Shared allocations using HIP Managed Memory
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t hPool,
-                 size_t size, void **ppMem) {
+ur_result_t urUSMSharedAlloc(ur_context_handle_t hContext,
+                             ur_device_handle_t hDevice,
+                             const ur_usm_desc_t *pUSMDesc,
+                             ur_usm_pool_handle_t hPool, size_t size,
+                             void **ppMem) {
   uint32_t alignment;
   UR_ASSERT(checkUSMAlignment(alignment, pUSMDesc),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  // The deferred frees which are done may make room for the allocation, the
+  // errors of freeing them are not those of the allocation
+  std::ignore = hContext->reclaimDeferredFrees();
+
   if (!hPool) {
     return USMSharedAllocImpl(ppMem, hContext, hDevice, /*host flags*/ 0,
                               /*device flags*/ 0, size, alignment);
@@ -66,6 +87,7 @@ urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
 
   return umfPoolMallocHelper(hPool, ppMem, size, alignment);
 }
+} // namespace ur::hip
 
 UR_APIEXPORT ur_result_t UR_APICALL
 USMFreeImpl([[maybe_unused]] ur_context_handle_t hContext, void *pMem) {
@@ -93,16 +115,29 @@ USMFreeImpl([[maybe_unused]] ur_context_handle_t hContext, void *pMem) {
   return Result;
 }
 
-/// USM: Frees the given USM pointer associated with the context.
-UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
-                                              void *pMem) {
+ur_result_t USMFreeNow(ur_context_handle_t hContext, void *pMem) {
   if (auto Pool = umfPoolByPtr(pMem)) {
-    return umf::umf2urResult(umfPoolFree(Pool, pMem));
+    return umf::umf2urResult(umf::cachedFree(Pool, pMem));
   } else {
     return USMFreeImpl(hContext, pMem);
   }
 }
 
+namespace ur::hip {
+
+/// USM: Frees the given USM pointer associated with the context.
+///
+/// With UR_HIP_USM_DEFERRED_FREE the memory is only freed once the commands
+/// pending on the queues of the context have completed, rather than the
+/// caller having to wait for them.
+ur_result_t urUSMFree(ur_context_handle_t hContext, void *pMem) {
+  if (ur_context_handle_t_::isDeferredFreeEnabled()) {
+    return hContext->deferFree(pMem);
+  }
+  return USMFreeNow(hContext, pMem);
+}
+} // namespace ur::hip
+
 ur_result_t USMDeviceAllocImpl(void **ResultPtr, ur_context_handle_t,
                                ur_device_handle_t Device,
                                ur_usm_device_mem_flags_t, size_t Size,
@@ -148,10 +183,12 @@ ur_result_t USMHostAllocImpl(void **ResultPtr,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
-                     ur_usm_alloc_info_t propName, size_t propValueSize,
-                     void *pPropValue, size_t *pPropValueSizeRet) {
+namespace ur::hip {
+
+ur_result_t urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
+                                 ur_usm_alloc_info_t propName,
+                                 size_t propValueSize, void *pPropValue,
+                                 size_t *pPropValueSizeRet) {
   UrReturnHelper ReturnValue(propValueSize, pPropValue, pPropValueSizeRet);
 
   try {
@@ -193,7 +230,8 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
       // hip backend has only one platform containing all devices
       ur_platform_handle_t platform;
       ur_adapter_handle_t AdapterHandle = &adapter;
-      UR_CHECK_ERROR(urPlatformGet(&AdapterHandle, 1, 1, &platform, nullptr));
+      UR_CHECK_ERROR(ur::hip::urPlatformGet(&AdapterHandle, 1, 1, &platform,
+                                            nullptr));
 
       // get the device from the platform
       ur_device_handle_t Device = platform->Devices[DeviceIdx].get();
@@ -238,20 +276,116 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMImportExp(ur_context_handle_t Context,
-                                                   void *HostPtr, size_t Size) {
+ur_result_t urUSMImportExp(ur_context_handle_t Context, void *HostPtr,
+                           size_t Size) {
   UR_ASSERT(Context, UR_RESULT_ERROR_INVALID_CONTEXT);
   UR_ASSERT(!HostPtr, UR_RESULT_ERROR_INVALID_VALUE);
   UR_ASSERT(Size > 0, UR_RESULT_ERROR_INVALID_VALUE);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMReleaseExp(ur_context_handle_t Context,
-                                                    void *HostPtr) {
+ur_result_t urUSMReleaseExp(ur_context_handle_t Context, void *HostPtr) {
   UR_ASSERT(Context, UR_RESULT_ERROR_INVALID_CONTEXT);
   UR_ASSERT(!HostPtr, UR_RESULT_ERROR_INVALID_VALUE);
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::hip
+
+#if HIP_VERSION >= 50200000
+// Enqueues Enqueue(Stream) on a compute stream of hQueue, once the events of
+// the wait list are complete
+template <typename F>
+static ur_result_t enqueueStreamOrdered(
+    ur_queue_handle_t hQueue, ur_command_t Type, uint32_t NumEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    F &&Enqueue) {
+  try {
+    ScopedDevice Active(hQueue->getDevice());
+    uint32_t StreamToken;
+    ur_stream_guard Guard;
+    hipStream_t HIPStream = hQueue->getNextComputeStream(
+        NumEventsInWaitList, phEventWaitList, Guard, &StreamToken);
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, HIPStream, NumEventsInWaitList,
+                                     phEventWaitList));
+
+    std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+    if (phEvent) {
+      RetImplEvent =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              Type, hQueue, HIPStream, StreamToken));
+      UR_CHECK_ERROR(RetImplEvent->start());
+    }
+
+    UR_CHECK_ERROR(Enqueue(HIPStream));
+
+    if (phEvent) {
+      UR_CHECK_ERROR(RetImplEvent->record());
+      *phEvent = RetImplEvent.release();
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  return UR_RESULT_SUCCESS;
+}
+#endif // HIP_VERSION >= 50200000
+
+namespace ur::hip {
+
+/// USM: Implements stream ordered allocations with hipMallocFromPoolAsync,
+/// the memory freed by hipFreeAsync is reused by the allocations enqueued
+/// after the free without synchronizing the streams.
+ur_result_t urEnqueueUSMDeviceAllocExp(ur_queue_handle_t hQueue, size_t size,
+                                       uint32_t numEventsInWaitList,
+                                       const ur_event_handle_t *phEventWaitList,
+                                       void **ppMem,
+                                       ur_event_handle_t *phEvent) {
+#if HIP_VERSION >= 50200000
+  hipMemPool_t Pool;
+  try {
+    Pool = hQueue->getContext()->getAsyncMemPool(hQueue->getDevice());
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  if (!Pool) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  return enqueueStreamOrdered(
+      hQueue, UR_COMMAND_ENQUEUE_USM_DEVICE_ALLOC_EXP, numEventsInWaitList,
+      phEventWaitList, phEvent, [&](hipStream_t HIPStream) {
+        return hipMallocFromPoolAsync(ppMem, size, Pool, HIPStream);
+      });
+#else
+  std::ignore = hQueue;
+  std::ignore = size;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = ppMem;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
+}
+
+ur_result_t urEnqueueUSMFreeExp(ur_queue_handle_t hQueue, void *pMem,
+                                uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList,
+                                ur_event_handle_t *phEvent) {
+#if HIP_VERSION >= 50200000
+  return enqueueStreamOrdered(hQueue, UR_COMMAND_ENQUEUE_USM_FREE_EXP,
+                              numEventsInWaitList, phEventWaitList, phEvent,
+                              [&](hipStream_t HIPStream) {
+                                return hipFreeAsync(pMem, HIPStream);
+                              });
+#else
+  std::ignore = hQueue;
+  std::ignore = pMem;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
+}
+} // namespace ur::hip
 
 umf_result_t USMMemoryProvider::initialize(ur_context_handle_t Ctx,
                                            ur_device_handle_t Dev) {
@@ -315,53 +449,117 @@ ur_result_t USMDeviceMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
                             Alignment);
 }
 
+umf_result_t
+USMHostMemoryProvider::initialize(ur_context_handle_t Ctx,
+                                  ur_device_handle_t Dev,
+                                  const usm::host_memory_config_t &Memory) {
+  HostMemory = Memory;
+  return USMMemoryProvider::initialize(Ctx, Dev);
+}
+
 ur_result_t USMHostMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
                                                 uint32_t Alignment) {
-  return USMHostAllocImpl(ResultPtr, Context, /* flags */ 0, Size, Alignment);
+  if (HostMemory.isDefault())
+    return USMHostAllocImpl(ResultPtr, Context, /* flags */ 0, Size,
+                            Alignment);
+
+  size_t MappedSize = usm::hostMemoryRoundUp(Size, HostMemory);
+  UR_ASSERT(Alignment <= usm::hostMemoryPageSize(HostMemory),
+            UR_RESULT_ERROR_UNSUPPORTED_ALIGNMENT);
+  void *Ptr = usm::hostMemoryMap(MappedSize, HostMemory);
+  if (!Ptr)
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+
+  try {
+    UR_CHECK_ERROR(hipHostRegister(
+        Ptr, MappedSize, hipHostRegisterPortable | hipHostRegisterMapped));
+  } catch (ur_result_t Err) {
+    usm::hostMemoryUnmap(Ptr, MappedSize);
+    return Err;
+  }
+
+  *ResultPtr = Ptr;
+  return UR_RESULT_SUCCESS;
+}
+
+umf_result_t USMHostMemoryProvider::free(void *Ptr, size_t Size) {
+  if (HostMemory.isDefault())
+    return USMMemoryProvider::free(Ptr, Size);
+
+  try {
+    UR_CHECK_ERROR(hipHostUnregister(Ptr));
+  } catch (ur_result_t Err) {
+    getLastStatusRef() = Err;
+    return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+  }
+  usm::hostMemoryUnmap(Ptr, usm::hostMemoryRoundUp(Size, HostMemory));
+  return UMF_RESULT_SUCCESS;
+}
+
+umf_result_t USMHostMemoryProvider::get_min_page_size(void *Ptr,
+                                                      size_t *PageSize) {
+  if (HostMemory.isDefault())
+    return USMMemoryProvider::get_min_page_size(Ptr, PageSize);
+
+  *PageSize = usm::hostMemoryPageSize(HostMemory);
+  return UMF_RESULT_SUCCESS;
 }
 
 ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
                                              ur_usm_pool_desc_t *PoolDesc)
     : Context(Context) {
   if (PoolDesc) {
-    if (auto *Limits = find_stype_node<ur_usm_pool_limits_desc_t>(PoolDesc)) {
+    auto *Limits = find_stype_node<ur_usm_pool_limits_desc_t>(PoolDesc);
+    auto *HostPoolDesc = find_stype_node<ur_exp_usm_host_pool_desc_t>(PoolDesc);
+    if (!Limits && !HostPoolDesc) {
+      throw UsmAllocationException(UR_RESULT_ERROR_INVALID_ARGUMENT);
+    }
+    if (Limits) {
       for (auto &config : DisjointPoolConfigs.Configs) {
         config.MaxPoolableSize = Limits->maxPoolableSize;
         config.SlabMinSize = Limits->minDriverAllocSize;
       }
-    } else {
-      throw UsmAllocationException(UR_RESULT_ERROR_INVALID_ARGUMENT);
+    }
+    if (HostPoolDesc) {
+      auto [Result, Memory] = usm::makeHostMemoryConfig(
+          *HostPoolDesc, Context->getDevices(), ur::hip::urDeviceGetInfo);
+      if (Result != UR_RESULT_SUCCESS) {
+        throw UsmAllocationException(Result);
+      }
+      HostMemory = Memory;
     }
   }
 
-  auto MemProvider =
-      umf::memoryProviderMakeUnique<USMHostMemoryProvider>(Context, nullptr)
-          .second;
+  auto MemProvider = umf::memoryProviderMakeUnique<USMHostMemoryProvider>(
+                         Context, nullptr, HostMemory)
+                         .second;
 
-  HostMemPool =
+  HostMemPool = umf::poolAddStats(
       umf::poolMakeUniqueFromOps(
           umfDisjointPoolOps(), std::move(MemProvider),
           &this->DisjointPoolConfigs.Configs[usm::DisjointPoolMemType::Host])
-          .second;
+          .second);
 
   for (const auto &Device : Context->getDevices()) {
     MemProvider =
         umf::memoryProviderMakeUnique<USMDeviceMemoryProvider>(Context, Device)
             .second;
-    DeviceMemPool = umf::poolMakeUniqueFromOps(
-                        umfDisjointPoolOps(), std::move(MemProvider),
-                        &this->DisjointPoolConfigs
-                             .Configs[usm::DisjointPoolMemType::Device])
-                        .second;
+    DeviceMemPool = umf::poolAddStats(
+        umf::poolMakeUniqueFromOps(
+            umfDisjointPoolOps(), std::move(MemProvider),
+            &this->DisjointPoolConfigs
+                 .Configs[usm::DisjointPoolMemType::Device])
+            .second);
 
     MemProvider =
         umf::memoryProviderMakeUnique<USMSharedMemoryProvider>(Context, Device)
             .second;
-    SharedMemPool = umf::poolMakeUniqueFromOps(
-                        umfDisjointPoolOps(), std::move(MemProvider),
-                        &this->DisjointPoolConfigs
-                             .Configs[usm::DisjointPoolMemType::Shared])
-                        .second;
+    SharedMemPool = umf::poolAddStats(
+        umf::poolMakeUniqueFromOps(
+            umfDisjointPoolOps(), std::move(MemProvider),
+            &this->DisjointPoolConfigs
+                 .Configs[usm::DisjointPoolMemType::Shared])
+            .second);
     Context->addPool(this);
   }
 }
@@ -371,7 +569,9 @@ bool ur_usm_pool_handle_t_::hasUMFPool(umf_memory_pool_t *umf_pool) {
          HostMemPool.get() == umf_pool;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolCreate(
+namespace ur::hip {
+
+ur_result_t urUSMPoolCreate(
     ur_context_handle_t Context, ///< [in] handle of the context object
     ur_usm_pool_desc_t
         *PoolDesc, ///< [in] pointer to USM pool descriptor. Can be chained with
@@ -398,25 +598,27 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolCreate(
 #endif
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolRetain(
+ur_result_t urUSMPoolRetain(
     ur_usm_pool_handle_t Pool ///< [in] pointer to USM memory pool
 ) {
   Pool->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolRelease(
+ur_result_t urUSMPoolRelease(
     ur_usm_pool_handle_t Pool ///< [in] pointer to USM memory pool
 ) {
   if (Pool->decrementReferenceCount() > 0) {
     return UR_RESULT_SUCCESS;
   }
+  // The deferred frees may return memory to the pool
+  std::ignore = Pool->Context->reclaimDeferredFrees(/*WaitForMarkers=*/true);
   Pool->Context->removePool(Pool);
   delete Pool;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolGetInfo(
+ur_result_t urUSMPoolGetInfo(
     ur_usm_pool_handle_t hPool,  ///< [in] handle of the USM memory pool
     ur_usm_pool_info_t propName, ///< [in] name of the pool property to query
     size_t propSize, ///< [in] size in bytes of the pool property value provided
@@ -434,11 +636,22 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolGetInfo(
   case UR_USM_POOL_INFO_CONTEXT: {
     return ReturnValue(hPool->Context);
   }
+  case UR_USM_POOL_INFO_USED_SIZE:
+  case UR_USM_POOL_INFO_CACHED_SIZE:
+  case UR_USM_POOL_INFO_PEAK_USED_SIZE:
+  case UR_USM_POOL_INFO_BUCKET_HITS:
+  case UR_USM_POOL_INFO_BUCKET_MISSES:
+  case UR_USM_POOL_INFO_FRAGMENTATION: {
+    auto Stats = umf::poolStatsSnapshot(
+        hPool->HostMemPool, hPool->DeviceMemPool, hPool->SharedMemPool);
+    return umf::poolStatsInfo(Stats, propName, ReturnValue);
+  }
   default: {
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
   }
   }
 }
+} // namespace ur::hip
 
 bool checkUSMAlignment(uint32_t &alignment, const ur_usm_desc_t *pUSMDesc) {
   alignment = pUSMDesc ? pUSMDesc->align : 0u;
@@ -454,7 +667,7 @@ bool checkUSMImplAlignment(uint32_t Alignment, void **ResultPtr) {
 ur_result_t umfPoolMallocHelper(ur_usm_pool_handle_t hPool, void **ppMem,
                                 size_t size, uint32_t alignment) {
   auto UMFPool = hPool->DeviceMemPool.get();
-  *ppMem = umfPoolAlignedMalloc(UMFPool, size, alignment);
+  *ppMem = umf::cachedAlignedMalloc(UMFPool, size, alignment);
   if (*ppMem == nullptr) {
     auto umfErr = umfPoolGetLastAllocationError(UMFPool);
     return umf::umf2urResult(umfErr);
@@ -10,33 +10,122 @@
 
 #include "common.hpp"
 #include "context.hpp"
+#include "platform.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
-    ur_device_handle_t commandDevice, ur_device_handle_t peerDevice) {
+#include <algorithm>
+#include <chrono>
+
+namespace {
+// The size of the copies timed to find the bandwidth between two devices
+constexpr size_t BandwidthProbeSize = 16 * 1024 * 1024;
+constexpr int BandwidthProbeCount = 3;
+
+// The hsa_amd_link_info_type_t of hipExtGetLinkTypeAndHopCount
+constexpr uint32_t HsaLinkTypePCIe = 2;
+constexpr uint32_t HsaLinkTypeXGMI = 4;
+
+// Returns the bandwidth of the fastest of a few copies from Src to Dst, in
+// MB/s. The copies go through the host when peer access isn't enabled, so
+// does the bandwidth.
+uint64_t measureBandwidth(ur_device_handle_t Src, ur_device_handle_t Dst) {
+  void *SrcPtr = nullptr, *DstPtr = nullptr;
+  std::chrono::steady_clock::duration Fastest =
+      std::chrono::steady_clock::duration::max();
+  try {
+    {
+      ScopedDevice Active(Src);
+      UR_CHECK_ERROR(hipMalloc(&SrcPtr, BandwidthProbeSize));
+    }
+    {
+      ScopedDevice Active(Dst);
+      UR_CHECK_ERROR(hipMalloc(&DstPtr, BandwidthProbeSize));
+    }
+    for (int I = 0; I < BandwidthProbeCount; I++) {
+      auto Start = std::chrono::steady_clock::now();
+      UR_CHECK_ERROR(hipMemcpyPeer(DstPtr, Dst->get(), SrcPtr, Src->get(),
+                                   BandwidthProbeSize));
+      Fastest = std::min(Fastest, std::chrono::steady_clock::now() - Start);
+    }
+  } catch (ur_result_t) {
+    Fastest = std::chrono::steady_clock::duration::max();
+  }
+  if (SrcPtr) {
+    ScopedDevice Active(Src);
+    std::ignore = hipFree(SrcPtr);
+  }
+  if (DstPtr) {
+    ScopedDevice Active(Dst);
+    std::ignore = hipFree(DstPtr);
+  }
+
+  auto Ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(Fastest).count();
+  if (Fastest == std::chrono::steady_clock::duration::max() || Ns <= 0) {
+    return 0;
+  }
+  // bytes per ns are GB/s
+  return BandwidthProbeSize * 1000 / Ns;
+}
+
+// The type and hops of the P2P links come from HIP, their bandwidth is
+// measured
+ur_result_t queryPeerLink(ur_device_handle_t Src, ur_device_handle_t Dst,
+                          ur::peer_link_t &Link) {
+  try {
+    int Access = 0;
+    UR_CHECK_ERROR(hipDeviceGetP2PAttribute(
+        &Access, hipDevP2PAttrAccessSupported, Src->get(), Dst->get()));
+    if (Access) {
+      uint32_t LinkType = 0, HopCount = 0;
+      UR_CHECK_ERROR(hipExtGetLinkTypeAndHopCount(Src->get(), Dst->get(),
+                                                  &LinkType, &HopCount));
+      Link.type = LinkType == HsaLinkTypeXGMI   ? UR_EXP_PEER_LINK_TYPE_FABRIC
+                  : LinkType == HsaLinkTypePCIe ? UR_EXP_PEER_LINK_TYPE_PCIE
+                                                : UR_EXP_PEER_LINK_TYPE_OTHER;
+      Link.hops = HopCount;
+    }
+    Link.bandwidth = measureBandwidth(Src, Dst);
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  return UR_RESULT_SUCCESS;
+}
+} // namespace
+
+namespace ur::hip {
+
+ur_result_t urUsmP2PEnablePeerAccessExp(ur_device_handle_t commandDevice,
+                                        ur_device_handle_t peerDevice) {
   try {
     ScopedDevice active(commandDevice);
     UR_CHECK_ERROR(hipDeviceEnablePeerAccess(peerDevice->get(), 0));
+    // The copies between the devices take another path
+    commandDevice->getPlatform()->PeerTopology.invalidate(commandDevice);
   } catch (ur_result_t err) {
     return err;
   }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
-    ur_device_handle_t commandDevice, ur_device_handle_t peerDevice) {
+ur_result_t urUsmP2PDisablePeerAccessExp(ur_device_handle_t commandDevice,
+                                         ur_device_handle_t peerDevice) {
   try {
     ScopedDevice active(commandDevice);
     UR_CHECK_ERROR(hipDeviceDisablePeerAccess(peerDevice->get()));
+    // The copies between the devices take another path
+    commandDevice->getPlatform()->PeerTopology.invalidate(commandDevice);
   } catch (ur_result_t err) {
     return err;
   }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
-    ur_device_handle_t commandDevice, ur_device_handle_t peerDevice,
-    ur_exp_peer_info_t propName, size_t propSize, void *pPropValue,
-    size_t *pPropSizeRet) {
+ur_result_t urUsmP2PPeerAccessGetInfoExp(ur_device_handle_t commandDevice,
+                                         ur_device_handle_t peerDevice,
+                                         ur_exp_peer_info_t propName,
+                                         size_t propSize, void *pPropValue,
+                                         size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   int value;
@@ -53,7 +142,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
       break;
     }
     default: {
-      return UR_RESULT_ERROR_INVALID_ENUMERATION;
+      auto *Platform = commandDevice->getPlatform();
+      return Platform->PeerTopology.getInfo(propName, commandDevice,
+                                            peerDevice, Platform->Devices,
+                                            queryPeerLink, ReturnValue);
     }
     }
     UR_CHECK_ERROR(hipDeviceGetP2PAttribute(
@@ -63,3 +155,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
   }
   return ReturnValue(value);
 }
+} // namespace ur::hip
@@ -12,44 +12,44 @@
 #include "context.hpp"
 #include "event.hpp"
 #include "physical_mem.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
-    ur_context_handle_t, ur_device_handle_t, ur_virtual_mem_granularity_info_t,
-    size_t, void *, size_t *) {
+namespace ur::hip {
+
+ur_result_t urVirtualMemGranularityGetInfo(ur_context_handle_t,
+                                           ur_device_handle_t,
+                                           ur_virtual_mem_granularity_info_t,
+                                           size_t, void *, size_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemReserve(ur_context_handle_t,
-                                                        const void *, size_t,
-                                                        void **) {
+ur_result_t urVirtualMemReserve(ur_context_handle_t, const void *, size_t,
+                                void **) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemFree(ur_context_handle_t,
-                                                     const void *, size_t) {
+ur_result_t urVirtualMemFree(ur_context_handle_t, const void *, size_t) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemSetAccess(
-    ur_context_handle_t, const void *, size_t, ur_virtual_mem_access_flags_t) {
+ur_result_t urVirtualMemSetAccess(ur_context_handle_t, const void *, size_t,
+                                  ur_virtual_mem_access_flags_t) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemMap(
-    ur_context_handle_t, const void *, size_t, ur_physical_mem_handle_t, size_t,
-    ur_virtual_mem_access_flags_t) {
+ur_result_t urVirtualMemMap(ur_context_handle_t, const void *, size_t,
+                            ur_physical_mem_handle_t, size_t,
+                            ur_virtual_mem_access_flags_t) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemUnmap(ur_context_handle_t,
-                                                      const void *, size_t) {
+ur_result_t urVirtualMemUnmap(ur_context_handle_t, const void *, size_t) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemGetInfo(ur_context_handle_t,
-                                                        const void *, size_t,
-                                                        ur_virtual_mem_info_t,
-                                                        size_t, void *,
-                                                        size_t *) {
+ur_result_t urVirtualMemGetInfo(ur_context_handle_t, const void *, size_t,
+                                ur_virtual_mem_info_t, size_t, void *,
+                                size_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+} // namespace ur::hip
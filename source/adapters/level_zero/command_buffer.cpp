@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 #include "command_buffer.hpp"
 #include "helpers/kernel_helpers.hpp"
+#include "latency_tracker.hpp"
 #include "logger/ur_logger.hpp"
 #include "ur_interface_loader.hpp"
 #include "ur_level_zero.hpp"
@@ -140,7 +141,12 @@ ur_result_t createSyncPointAndGetZeEvents(
 
   ZeLaunchEvent = nullptr;
 
+  // Commands of in-order command-buffers run in the order they are appended,
+  // so their sync points need no event.
   if (CommandBuffer->IsInOrderCmdList) {
+    if (RetSyncPoint) {
+      *RetSyncPoint = CommandBuffer->NextSyncPoint++;
+    }
     return UR_RESULT_SUCCESS;
   }
 
@@ -347,31 +353,21 @@ void ur_exp_command_buffer_handle_t_::cleanupCommandBufferResources() {
 
   // Release fences allocated to command-buffer
   for (auto &ZeFencePair : ZeFencesMap) {
-    auto &ZeFence = ZeFencePair.second;
-    ZE_CALL_NOCHECK(zeFenceDestroy, (ZeFence));
+    for (auto ZeFence : ZeFencePair.second.ZeFences) {
+      if (ZeFence) {
+        ZE_CALL_NOCHECK(zeFenceDestroy, (ZeFence));
+      }
+    }
   }
 
   auto ReleaseIndirectMem = [](ur_kernel_handle_t Kernel) {
     if (IndirectAccessTrackingEnabled) {
       // urKernelRelease is called by CleanupCompletedEvent(Event) as soon as
       // kernel execution has finished. This is the place where we need to
-      // release memory allocations. If kernel is not in use (not submitted by
-      // some other thread) then release referenced memory allocations. As a
+      // release memory allocations freed while the kernel was in flight. As a
       // result, memory can be deallocated and context can be removed from
-      // container in the platform. That's why we need to lock a mutex here.
-      ur_platform_handle_t Platform = Kernel->Program->Context->getPlatform();
-      std::scoped_lock<ur_shared_mutex> ContextsLock(Platform->ContextsMutex);
-
-      if (--Kernel->SubmissionsCount == 0) {
-        // Kernel is not submitted for execution, release referenced memory
-        // allocations.
-        for (auto &MemAlloc : Kernel->MemAllocs) {
-          // std::pair<void *const, MemAllocRecord> *, Hash
-          USMFreeHelper(MemAlloc->second.Context, MemAlloc->first,
-                        MemAlloc->second.OwnNativeHandle);
-        }
-        Kernel->MemAllocs.clear();
-      }
+      // container in the platform, so this locks the mutex of the contexts.
+      USMReleaseIndirectAccesses(Kernel);
     }
   };
 
@@ -419,21 +415,94 @@ ur_exp_command_buffer_handle_t_::chooseCommandList(bool PreferCopyEngine) {
 
 ur_result_t ur_exp_command_buffer_handle_t_::getFenceForQueue(
     ze_command_queue_handle_t &ZeCommandQueue, ze_fence_handle_t &ZeFence) {
-  // If we already have created a fence for this queue, first reset then reuse
-  // it, otherwise create a new fence.
-  auto ZeWorkloadFenceForQueue = this->ZeFencesMap.find(ZeCommandQueue);
-  if (ZeWorkloadFenceForQueue == this->ZeFencesMap.end()) {
+  if (ZeCommandQueue != LastZeCommandQueue) {
+    LastQueueFences = &ZeFencesMap[ZeCommandQueue];
+    LastZeCommandQueue = ZeCommandQueue;
+  }
+  auto &QueueFences = *LastQueueFences;
+  auto &ZeQueueFence = QueueFences.ZeFences[QueueFences.Next];
+  QueueFences.Next = (QueueFences.Next + 1) % QueueFences.ZeFences.size();
+
+  // If we already have created this fence for the queue, first wait for its
+  // submission, which is usually complete by now, then reset and reuse it,
+  // otherwise create a new fence.
+  if (!ZeQueueFence) {
     ZeStruct<ze_fence_desc_t> ZeFenceDesc;
-    ZE2UR_CALL(zeFenceCreate, (ZeCommandQueue, &ZeFenceDesc, &ZeFence));
-    this->ZeFencesMap.insert({{ZeCommandQueue, ZeFence}});
+    ZE2UR_CALL(zeFenceCreate, (ZeCommandQueue, &ZeFenceDesc, &ZeQueueFence));
   } else {
-    ZeFence = ZeWorkloadFenceForQueue->second;
-    ZE2UR_CALL(zeFenceReset, (ZeFence));
+    if (ZE_CALL_NOCHECK(zeFenceQueryStatus, (ZeQueueFence)) ==
+        ZE_RESULT_NOT_READY) {
+      ZE2UR_CALL(zeFenceHostSynchronize, (ZeQueueFence, UINT64_MAX));
+    }
+    ZE2UR_CALL(zeFenceReset, (ZeQueueFence));
   }
+  ZeFence = ZeQueueFence;
   this->ZeActiveFence = ZeFence;
   return UR_RESULT_SUCCESS;
 }
 
+void mutable_command_updates_t::clear() {
+  ArgDescs.clear();
+  ArgValueOffsets.clear();
+  ArgValues.clear();
+  OffsetDescs.clear();
+  GroupSizeDescs.clear();
+  GroupCountDescs.clear();
+  GroupCounts.clear();
+  CommandIds.clear();
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::applyPendingUpdates() {
+  if (PendingUpdates.empty()) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  // We must synchronize mutable command list execution before mutating.
+  if (ZeActiveFence) {
+    ZE2UR_CALL(zeFenceHostSynchronize, (ZeActiveFence, UINT64_MAX));
+  }
+
+  // Chain all the descriptors now that they don't move anymore.
+  auto &Updates = PendingUpdates;
+  const void *NextDesc = nullptr;
+  auto Chain = [&](auto &Descs) {
+    for (auto &Desc : Descs) {
+      Desc.pNext = NextDesc;
+      NextDesc = &Desc;
+    }
+  };
+  for (size_t I = 0; I < Updates.ArgDescs.size(); I++) {
+    size_t Offset = Updates.ArgValueOffsets[I];
+    if (Offset != mutable_command_updates_t::NoArgValueOffset) {
+      Updates.ArgDescs[I].pArgValue = Updates.ArgValues.data() + Offset;
+    }
+  }
+  for (size_t I = 0; I < Updates.GroupCountDescs.size(); I++) {
+    Updates.GroupCountDescs[I].pGroupCount = &Updates.GroupCounts[I];
+  }
+  Chain(Updates.ArgDescs);
+  Chain(Updates.GroupCountDescs);
+  Chain(Updates.GroupSizeDescs);
+  Chain(Updates.OffsetDescs);
+
+  ZeStruct<ze_mutable_commands_exp_desc_t> MutableCommandDesc;
+  MutableCommandDesc.pNext = NextDesc;
+  MutableCommandDesc.flags = 0;
+
+  auto Platform = Context->getPlatform();
+  auto ZeResult = ZE_CALL_NOCHECK(
+      Platform->ZeMutableCmdListExt.zexCommandListUpdateMutableCommandsExp,
+      (ZeComputeCommandListTranslated, &MutableCommandDesc));
+  Updates.clear();
+  if (ZeResult) {
+    return ze2urResult(ZeResult);
+  }
+
+  ZE2UR_CALL(zeCommandListClose, (ZeComputeCommandList));
+
+  return UR_RESULT_SUCCESS;
+}
+
 namespace ur::level_zero {
 
 /**
@@ -482,17 +551,29 @@ ur_result_t createMainCommandList(ur_context_handle_t Context,
  * Checks whether the command buffer can be constructed using in order
  * command-lists.
  * @param[in] Context The Context associated with the command buffer.
+ * @param[in] Device The Device associated with the command buffer.
  * @param[in] CommandBufferDesc The description of the command buffer.
  * @return Returns true if in order command-lists can be enabled.
  */
-bool canBeInOrder(ur_context_handle_t Context,
+bool canBeInOrder(ur_context_handle_t Context, ur_device_handle_t Device,
                   const ur_exp_command_buffer_desc_t *CommandBufferDesc) {
   // In-order command-lists are not available in old driver version.
   bool CompatibleDriver = Context->getPlatform()->isDriverVersionNewerOrSimilar(
       1, 3, L0_DRIVER_INORDER_MIN_VERSION);
-  return CompatibleDriver
-             ? (CommandBufferDesc ? CommandBufferDesc->isInOrder : false)
-             : false;
+  if (!CompatibleDriver)
+    return false;
+  if (CommandBufferDesc && CommandBufferDesc->isInOrder)
+    return true;
+
+  // Running the commands in the order they are appended satisfies any sync
+  // points, and saves an event and its waits for each command. It's opt-in
+  // because it serializes commands which could run concurrently, and there
+  // are no timestamps of the individual commands without their events.
+  static const bool ForceInOrder =
+      getenv_to_unsigned("UR_L0_CMD_BUFFER_FORCE_IN_ORDER").value_or(0) != 0;
+  bool EnableProfiling =
+      CommandBufferDesc && CommandBufferDesc->enableProfiling;
+  return ForceInOrder && !EnableProfiling && Device->useDriverInOrderLists();
 }
 
 ur_result_t
@@ -500,7 +581,7 @@ urCommandBufferCreateExp(ur_context_handle_t Context, ur_device_handle_t Device,
                          const ur_exp_command_buffer_desc_t *CommandBufferDesc,
                          ur_exp_command_buffer_handle_t *CommandBuffer) {
 
-  bool IsInOrder = canBeInOrder(Context, CommandBufferDesc);
+  bool IsInOrder = canBeInOrder(Context, Device, CommandBufferDesc);
   bool EnableProfiling =
       CommandBufferDesc && CommandBufferDesc->enableProfiling;
   bool IsUpdatable = CommandBufferDesc && CommandBufferDesc->isUpdatable;
@@ -674,8 +755,9 @@ setKernelPendingArguments(ur_exp_command_buffer_handle_t CommandBuffer,
       UR_CALL(Arg.Value->getZeHandlePtr(ZeHandlePtr, Arg.AccessMode,
                                         CommandBuffer->Device, nullptr, 0u));
     }
-    ZE2UR_CALL(zeKernelSetArgumentValue,
-               (Kernel->ZeKernel, Arg.Index, Arg.Size, ZeHandlePtr));
+    if (auto ZeResult = Kernel->setArgument(Kernel->ZeKernel, Arg.Index,
+                                            Arg.Size, ZeHandlePtr))
+      return ze2urResult(ZeResult);
   }
   Kernel->PendingArguments.clear();
 
@@ -756,6 +838,13 @@ ur_result_t urCommandBufferAppendKernelLaunchExp(
 
   ze_group_count_t ZeThreadGroupDimensions{1, 1, 1};
   uint32_t WG[3];
+  size_t SuggestedLocalWorkSize[3];
+  if (!LocalWorkSize) {
+    UR_CALL(Kernel->getSuggestedGroupSize(
+        CommandBuffer->Device, Kernel->ZeKernel, WorkDim, GlobalWorkSize,
+        SuggestedLocalWorkSize));
+    LocalWorkSize = SuggestedLocalWorkSize;
+  }
   UR_CALL(calculateKernelWorkDimensions(Kernel->ZeKernel, CommandBuffer->Device,
                                         ZeThreadGroupDimensions, WG, WorkDim,
                                         GlobalWorkSize, LocalWorkSize));
@@ -977,6 +1066,9 @@ ur_result_t urCommandBufferAppendUSMPrefetchExp(
     // Note that L0 does not handle migration flags.
     ZE2UR_CALL(zeCommandListAppendMemoryPrefetch,
                (CommandBuffer->ZeComputeCommandList, Mem, Size));
+    if (RetSyncPoint) {
+      *RetSyncPoint = CommandBuffer->NextSyncPoint++;
+    }
   } else {
     std::vector<ze_event_handle_t> ZeEventList;
     ze_event_handle_t ZeLaunchEvent = nullptr;
@@ -1040,6 +1132,9 @@ ur_result_t urCommandBufferAppendUSMAdviseExp(
     ZE2UR_CALL(zeCommandListAppendMemAdvise,
                (CommandBuffer->ZeComputeCommandList,
                 CommandBuffer->Device->ZeDevice, Mem, Size, ZeAdvice));
+    if (RetSyncPoint) {
+      *RetSyncPoint = CommandBuffer->NextSyncPoint++;
+    }
   } else {
     std::vector<ze_event_handle_t> ZeEventList;
     ze_event_handle_t ZeLaunchEvent = nullptr;
@@ -1187,6 +1282,7 @@ ur_result_t createUserEvent(ur_exp_command_buffer_handle_t CommandBuffer,
   UR_CALL(createEventAndAssociateQueue(Queue, &RetEvent,
                                        UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP,
                                        SignalCommandList, false, false, true));
+  Queue->Telemetry.commandSubmitted(UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP);
 
   if ((Queue->Properties & UR_QUEUE_FLAG_PROFILING_ENABLE) &&
       (!CommandBuffer->IsInOrderCmdList) &&
@@ -1228,13 +1324,20 @@ urCommandBufferEnqueueExp(ur_exp_command_buffer_handle_t CommandBuffer,
                           ur_queue_handle_t Queue, uint32_t NumEventsInWaitList,
                           const ur_event_handle_t *EventWaitList,
                           ur_event_handle_t *Event) {
+  TRACK_SCOPE_LATENCY("urCommandBufferEnqueueExp");
+  if (CommandBuffer->IsUpdatable) {
+    // Before the fence of the running submission can be reset below.
+    std::scoped_lock<ur_shared_mutex> Guard(CommandBuffer->Mutex);
+    UR_CALL(CommandBuffer->applyPendingUpdates());
+  }
+
   std::scoped_lock<ur_shared_mutex> Lock(Queue->Mutex);
 
   ze_command_queue_handle_t ZeCommandQueue;
   getZeCommandQueue(Queue, false, ZeCommandQueue);
 
   ze_fence_handle_t ZeFence;
-  CommandBuffer->getFenceForQueue(ZeCommandQueue, ZeFence);
+  UR_CALL(CommandBuffer->getFenceForQueue(ZeCommandQueue, ZeFence));
 
   UR_CALL(waitForDependencies(CommandBuffer, Queue, NumEventsInWaitList,
                               EventWaitList));
@@ -1369,7 +1472,8 @@ ur_result_t validateCommandDesc(
 }
 
 /**
- * Update the kernel command with the new values.
+ * Adds the updates of the kernel command to the pending updates of its
+ * command-buffer.
  * @param[in] Command The command which is being updated.
  * @param[in] CommandDesc The update command description.
  * @return UR_RESULT_SUCCESS or an error code on failure
@@ -1378,18 +1482,15 @@ ur_result_t updateKernelCommand(
     ur_exp_command_buffer_command_handle_t Command,
     const ur_exp_command_buffer_update_kernel_launch_desc_t *CommandDesc) {
 
-  // We need the created descriptors to live till the point when
-  // zeCommandListUpdateMutableCommandsExp is called at the end of the
-  // function.
-  std::vector<std::variant<
-      std::unique_ptr<ZeStruct<ze_mutable_kernel_argument_exp_desc_t>>,
-      std::unique_ptr<ZeStruct<ze_mutable_global_offset_exp_desc_t>>,
-      std::unique_ptr<ZeStruct<ze_mutable_group_size_exp_desc_t>>,
-      std::unique_ptr<ZeStruct<ze_mutable_group_count_exp_desc_t>>>>
-      Descs;
-
   const auto CommandBuffer = Command->CommandBuffer;
-  const void *NextDesc = nullptr;
+  auto &Updates = CommandBuffer->PendingUpdates;
+
+  // The updates of a command are applied in an unspecified order, so a
+  // command updated again gets the previous updates applied first.
+  if (Updates.CommandIds.count(Command->CommandId)) {
+    UR_CALL(CommandBuffer->applyPendingUpdates());
+  }
+  Updates.CommandIds.insert(Command->CommandId);
 
   uint32_t Dim = CommandDesc->newWorkDim;
   size_t *NewGlobalWorkOffset = CommandDesc->pNewGlobalWorkOffset;
@@ -1398,89 +1499,98 @@ ur_result_t updateKernelCommand(
 
   // Check if a new global offset is provided.
   if (NewGlobalWorkOffset && Dim > 0) {
-    auto MutableGroupOffestDesc =
-        std::make_unique<ZeStruct<ze_mutable_global_offset_exp_desc_t>>();
-    MutableGroupOffestDesc->commandId = Command->CommandId;
-    DEBUG_LOG(MutableGroupOffestDesc->commandId);
-    MutableGroupOffestDesc->pNext = NextDesc;
-    DEBUG_LOG(MutableGroupOffestDesc->pNext);
-    MutableGroupOffestDesc->offsetX = NewGlobalWorkOffset[0];
-    DEBUG_LOG(MutableGroupOffestDesc->offsetX);
-    MutableGroupOffestDesc->offsetY = Dim >= 2 ? NewGlobalWorkOffset[1] : 0;
-    DEBUG_LOG(MutableGroupOffestDesc->offsetY);
-    MutableGroupOffestDesc->offsetZ = Dim == 3 ? NewGlobalWorkOffset[2] : 0;
-    DEBUG_LOG(MutableGroupOffestDesc->offsetZ);
-
-    NextDesc = MutableGroupOffestDesc.get();
-    Descs.push_back(std::move(MutableGroupOffestDesc));
+    auto &MutableGroupOffestDesc = Updates.OffsetDescs.emplace_back();
+    MutableGroupOffestDesc.commandId = Command->CommandId;
+    DEBUG_LOG(MutableGroupOffestDesc.commandId);
+    MutableGroupOffestDesc.offsetX = NewGlobalWorkOffset[0];
+    DEBUG_LOG(MutableGroupOffestDesc.offsetX);
+    MutableGroupOffestDesc.offsetY = Dim >= 2 ? NewGlobalWorkOffset[1] : 0;
+    DEBUG_LOG(MutableGroupOffestDesc.offsetY);
+    MutableGroupOffestDesc.offsetZ = Dim == 3 ? NewGlobalWorkOffset[2] : 0;
+    DEBUG_LOG(MutableGroupOffestDesc.offsetZ);
   }
 
   // Check if a new group size is provided.
   if (NewLocalWorkSize && Dim > 0) {
-    auto MutableGroupSizeDesc =
-        std::make_unique<ZeStruct<ze_mutable_group_size_exp_desc_t>>();
-    MutableGroupSizeDesc->commandId = Command->CommandId;
-    DEBUG_LOG(MutableGroupSizeDesc->commandId);
-    MutableGroupSizeDesc->pNext = NextDesc;
-    DEBUG_LOG(MutableGroupSizeDesc->pNext);
-    MutableGroupSizeDesc->groupSizeX = NewLocalWorkSize[0];
-    DEBUG_LOG(MutableGroupSizeDesc->groupSizeX);
-    MutableGroupSizeDesc->groupSizeY = Dim >= 2 ? NewLocalWorkSize[1] : 1;
-    DEBUG_LOG(MutableGroupSizeDesc->groupSizeY);
-    MutableGroupSizeDesc->groupSizeZ = Dim == 3 ? NewLocalWorkSize[2] : 1;
-    DEBUG_LOG(MutableGroupSizeDesc->groupSizeZ);
-
-    NextDesc = MutableGroupSizeDesc.get();
-    Descs.push_back(std::move(MutableGroupSizeDesc));
+    auto &MutableGroupSizeDesc = Updates.GroupSizeDescs.emplace_back();
+    MutableGroupSizeDesc.commandId = Command->CommandId;
+    DEBUG_LOG(MutableGroupSizeDesc.commandId);
+    MutableGroupSizeDesc.groupSizeX = NewLocalWorkSize[0];
+    DEBUG_LOG(MutableGroupSizeDesc.groupSizeX);
+    MutableGroupSizeDesc.groupSizeY = Dim >= 2 ? NewLocalWorkSize[1] : 1;
+    DEBUG_LOG(MutableGroupSizeDesc.groupSizeY);
+    MutableGroupSizeDesc.groupSizeZ = Dim == 3 ? NewLocalWorkSize[2] : 1;
+    DEBUG_LOG(MutableGroupSizeDesc.groupSizeZ);
   }
 
   // Check if a new global size is provided and if we need to update the group
   // count.
-  ze_group_count_t ZeThreadGroupDimensions{1, 1, 1};
   if (NewGlobalWorkSize && Dim > 0) {
     // If a new global work size is provided but a new local work size is not
     // then we still need to update local work size based on the size suggested
     // by the driver for the kernel.
     bool UpdateWGSize = NewLocalWorkSize == nullptr;
 
+    ze_group_count_t ZeThreadGroupDimensions{1, 1, 1};
     uint32_t WG[3];
+    size_t SuggestedLocalWorkSize[3];
+    const size_t *LocalWorkSize = NewLocalWorkSize;
+    if (!LocalWorkSize) {
+      UR_CALL(Command->Kernel->getSuggestedGroupSize(
+          CommandBuffer->Device, Command->Kernel->ZeKernel, Dim,
+          NewGlobalWorkSize, SuggestedLocalWorkSize));
+      LocalWorkSize = SuggestedLocalWorkSize;
+    }
     UR_CALL(calculateKernelWorkDimensions(
         Command->Kernel->ZeKernel, CommandBuffer->Device,
-        ZeThreadGroupDimensions, WG, Dim, NewGlobalWorkSize, NewLocalWorkSize));
-
-    auto MutableGroupCountDesc =
-        std::make_unique<ZeStruct<ze_mutable_group_count_exp_desc_t>>();
-    MutableGroupCountDesc->commandId = Command->CommandId;
-    DEBUG_LOG(MutableGroupCountDesc->commandId);
-    MutableGroupCountDesc->pNext = NextDesc;
-    DEBUG_LOG(MutableGroupCountDesc->pNext);
-    MutableGroupCountDesc->pGroupCount = &ZeThreadGroupDimensions;
-    DEBUG_LOG(MutableGroupCountDesc->pGroupCount->groupCountX);
-    DEBUG_LOG(MutableGroupCountDesc->pGroupCount->groupCountY);
-    DEBUG_LOG(MutableGroupCountDesc->pGroupCount->groupCountZ);
-
-    NextDesc = MutableGroupCountDesc.get();
-    Descs.push_back(std::move(MutableGroupCountDesc));
+        ZeThreadGroupDimensions, WG, Dim, NewGlobalWorkSize, LocalWorkSize));
+
+    // pGroupCount is set once the group counts stop moving.
+    auto &MutableGroupCountDesc = Updates.GroupCountDescs.emplace_back();
+    MutableGroupCountDesc.commandId = Command->CommandId;
+    DEBUG_LOG(MutableGroupCountDesc.commandId);
+    Updates.GroupCounts.push_back(ZeThreadGroupDimensions);
+    DEBUG_LOG(ZeThreadGroupDimensions.groupCountX);
+    DEBUG_LOG(ZeThreadGroupDimensions.groupCountY);
+    DEBUG_LOG(ZeThreadGroupDimensions.groupCountZ);
 
     if (UpdateWGSize) {
-      auto MutableGroupSizeDesc =
-          std::make_unique<ZeStruct<ze_mutable_group_size_exp_desc_t>>();
-      MutableGroupSizeDesc->commandId = Command->CommandId;
-      DEBUG_LOG(MutableGroupSizeDesc->commandId);
-      MutableGroupSizeDesc->pNext = NextDesc;
-      DEBUG_LOG(MutableGroupSizeDesc->pNext);
-      MutableGroupSizeDesc->groupSizeX = WG[0];
-      DEBUG_LOG(MutableGroupSizeDesc->groupSizeX);
-      MutableGroupSizeDesc->groupSizeY = WG[1];
-      DEBUG_LOG(MutableGroupSizeDesc->groupSizeY);
-      MutableGroupSizeDesc->groupSizeZ = WG[2];
-      DEBUG_LOG(MutableGroupSizeDesc->groupSizeZ);
-
-      NextDesc = MutableGroupSizeDesc.get();
-      Descs.push_back(std::move(MutableGroupSizeDesc));
+      auto &MutableGroupSizeDesc = Updates.GroupSizeDescs.emplace_back();
+      MutableGroupSizeDesc.commandId = Command->CommandId;
+      DEBUG_LOG(MutableGroupSizeDesc.commandId);
+      MutableGroupSizeDesc.groupSizeX = WG[0];
+      DEBUG_LOG(MutableGroupSizeDesc.groupSizeX);
+      MutableGroupSizeDesc.groupSizeY = WG[1];
+      DEBUG_LOG(MutableGroupSizeDesc.groupSizeY);
+      MutableGroupSizeDesc.groupSizeZ = WG[2];
+      DEBUG_LOG(MutableGroupSizeDesc.groupSizeZ);
     }
   }
 
+  // Adds an argument update, copying the value unless it's nullptr or
+  // CopyValue is false, since the caller's storage doesn't outlive the call.
+  auto AddArgument = [&](uint32_t ArgIndex, size_t ArgSize,
+                         const void *ArgValue, bool CopyValue) {
+    auto &ZeMutableArgDesc = Updates.ArgDescs.emplace_back();
+    ZeMutableArgDesc.commandId = Command->CommandId;
+    DEBUG_LOG(ZeMutableArgDesc.commandId);
+    ZeMutableArgDesc.argIndex = ArgIndex;
+    DEBUG_LOG(ZeMutableArgDesc.argIndex);
+    ZeMutableArgDesc.argSize = ArgSize;
+    DEBUG_LOG(ZeMutableArgDesc.argSize);
+    ZeMutableArgDesc.pArgValue = ArgValue;
+    DEBUG_LOG(ZeMutableArgDesc.pArgValue);
+
+    size_t Offset = mutable_command_updates_t::NoArgValueOffset;
+    if (CopyValue && ArgValue) {
+      Offset = Updates.ArgValues.size();
+      auto Bytes = static_cast<const char *>(ArgValue);
+      Updates.ArgValues.insert(Updates.ArgValues.end(), Bytes,
+                               Bytes + ArgSize);
+    }
+    Updates.ArgValueOffsets.push_back(Offset);
+  };
+
   // Check if new memory object arguments are provided.
   for (uint32_t NewMemObjArgNum = CommandDesc->numNewMemObjArgs;
        NewMemObjArgNum-- > 0;) {
@@ -1515,21 +1625,8 @@ ur_result_t updateKernelCommand(
                                            CommandBuffer->Device, nullptr, 0u));
     }
 
-    auto ZeMutableArgDesc =
-        std::make_unique<ZeStruct<ze_mutable_kernel_argument_exp_desc_t>>();
-    ZeMutableArgDesc->commandId = Command->CommandId;
-    DEBUG_LOG(ZeMutableArgDesc->commandId);
-    ZeMutableArgDesc->pNext = NextDesc;
-    DEBUG_LOG(ZeMutableArgDesc->pNext);
-    ZeMutableArgDesc->argIndex = NewMemObjArgDesc.argIndex;
-    DEBUG_LOG(ZeMutableArgDesc->argIndex);
-    ZeMutableArgDesc->argSize = sizeof(void *);
-    DEBUG_LOG(ZeMutableArgDesc->argSize);
-    ZeMutableArgDesc->pArgValue = ZeHandlePtr;
-    DEBUG_LOG(ZeMutableArgDesc->pArgValue);
-
-    NextDesc = ZeMutableArgDesc.get();
-    Descs.push_back(std::move(ZeMutableArgDesc));
+    // The handle lives in the memory object, which outlives the update.
+    AddArgument(NewMemObjArgDesc.argIndex, sizeof(void *), ZeHandlePtr, false);
   }
 
   // Check if there are new pointer arguments.
@@ -1538,21 +1635,8 @@ ur_result_t updateKernelCommand(
     ur_exp_command_buffer_update_pointer_arg_desc_t NewPointerArgDesc =
         CommandDesc->pNewPointerArgList[NewPointerArgNum];
 
-    auto ZeMutableArgDesc =
-        std::make_unique<ZeStruct<ze_mutable_kernel_argument_exp_desc_t>>();
-    ZeMutableArgDesc->commandId = Command->CommandId;
-    DEBUG_LOG(ZeMutableArgDesc->commandId);
-    ZeMutableArgDesc->pNext = NextDesc;
-    DEBUG_LOG(ZeMutableArgDesc->pNext);
-    ZeMutableArgDesc->argIndex = NewPointerArgDesc.argIndex;
-    DEBUG_LOG(ZeMutableArgDesc->argIndex);
-    ZeMutableArgDesc->argSize = sizeof(void *);
-    DEBUG_LOG(ZeMutableArgDesc->argSize);
-    ZeMutableArgDesc->pArgValue = NewPointerArgDesc.pNewPointerArg;
-    DEBUG_LOG(ZeMutableArgDesc->pArgValue);
-
-    NextDesc = ZeMutableArgDesc.get();
-    Descs.push_back(std::move(ZeMutableArgDesc));
+    AddArgument(NewPointerArgDesc.argIndex, sizeof(void *),
+                NewPointerArgDesc.pNewPointerArg, true);
   }
 
   // Check if there are new value arguments.
@@ -1561,16 +1645,6 @@ ur_result_t updateKernelCommand(
     ur_exp_command_buffer_update_value_arg_desc_t NewValueArgDesc =
         CommandDesc->pNewValueArgList[NewValueArgNum];
 
-    auto ZeMutableArgDesc =
-        std::make_unique<ZeStruct<ze_mutable_kernel_argument_exp_desc_t>>();
-    ZeMutableArgDesc->commandId = Command->CommandId;
-    DEBUG_LOG(ZeMutableArgDesc->commandId);
-    ZeMutableArgDesc->pNext = NextDesc;
-    DEBUG_LOG(ZeMutableArgDesc->pNext);
-    ZeMutableArgDesc->argIndex = NewValueArgDesc.argIndex;
-    DEBUG_LOG(ZeMutableArgDesc->argIndex);
-    ZeMutableArgDesc->argSize = NewValueArgDesc.argSize;
-    DEBUG_LOG(ZeMutableArgDesc->argSize);
     // OpenCL: "the arg_value pointer can be NULL or point to a NULL value
     // in which case a NULL value will be used as the value for the argument
     // declared as a pointer to global or constant memory in the kernel"
@@ -1583,22 +1657,10 @@ ur_result_t updateKernelCommand(
         *(void **)(const_cast<void *>(ArgValuePtr)) == nullptr) {
       ArgValuePtr = nullptr;
     }
-    ZeMutableArgDesc->pArgValue = ArgValuePtr;
-    DEBUG_LOG(ZeMutableArgDesc->pArgValue);
-
-    NextDesc = ZeMutableArgDesc.get();
-    Descs.push_back(std::move(ZeMutableArgDesc));
+    AddArgument(NewValueArgDesc.argIndex, NewValueArgDesc.argSize, ArgValuePtr,
+                true);
   }
 
-  ZeStruct<ze_mutable_commands_exp_desc_t> MutableCommandDesc;
-  MutableCommandDesc.pNext = NextDesc;
-  MutableCommandDesc.flags = 0;
-
-  auto Platform = CommandBuffer->Context->getPlatform();
-  ZE2UR_CALL(
-      Platform->ZeMutableCmdListExt.zexCommandListUpdateMutableCommandsExp,
-      (CommandBuffer->ZeComputeCommandListTranslated, &MutableCommandDesc));
-
   return UR_RESULT_SUCCESS;
 }
 
@@ -1618,16 +1680,10 @@ ur_result_t urCommandBufferUpdateKernelLaunchExp(
 
   UR_CALL(validateCommandDesc(Command, CommandDesc));
 
-  // We must synchronize mutable command list execution before mutating.
-  if (ze_fence_handle_t &ZeFence = Command->CommandBuffer->ZeActiveFence) {
-    ZE2UR_CALL(zeFenceHostSynchronize, (ZeFence, UINT64_MAX));
-  }
-
+  // The updates are applied with the ones of the other commands, before the
+  // next submission of the command-buffer.
   UR_CALL(updateKernelCommand(Command, CommandDesc));
 
-  ZE2UR_CALL(zeCommandListClose,
-             (Command->CommandBuffer->ZeComputeCommandList));
-
   return UR_RESULT_SUCCESS;
 }
 
@@ -9,6 +9,9 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <array>
+#include <unordered_set>
+
 #include <ur/ur.hpp>
 #include <ur_api.h>
 #include <ze_api.h>
@@ -25,6 +28,29 @@ struct command_buffer_profiling_t {
   ze_kernel_timestamp_result_t *Timestamps;
 };
 
+// Updates of the kernel commands of a command-buffer which haven't been passed
+// to the driver yet. They are applied by a single
+// zeCommandListUpdateMutableCommandsExp, and the storage is kept for the next
+// updates. The descriptors are only chained when they are applied, since the
+// vectors may grow until then.
+struct mutable_command_updates_t {
+  std::vector<ZeStruct<ze_mutable_kernel_argument_exp_desc_t>> ArgDescs;
+  // The offset of the value of each argument in ArgValues, or
+  // NoArgValueOffset if its pArgValue is used as is.
+  static constexpr size_t NoArgValueOffset = SIZE_MAX;
+  std::vector<size_t> ArgValueOffsets;
+  std::vector<char> ArgValues;
+  std::vector<ZeStruct<ze_mutable_global_offset_exp_desc_t>> OffsetDescs;
+  std::vector<ZeStruct<ze_mutable_group_size_exp_desc_t>> GroupSizeDescs;
+  std::vector<ZeStruct<ze_mutable_group_count_exp_desc_t>> GroupCountDescs;
+  std::vector<ze_group_count_t> GroupCounts;
+  // The commands with updates.
+  std::unordered_set<uint64_t> CommandIds;
+
+  bool empty() const { return CommandIds.empty(); }
+  void clear();
+};
+
 struct ur_exp_command_buffer_handle_t_ : public _ur_object {
   ur_exp_command_buffer_handle_t_(
       ur_context_handle_t Context, ur_device_handle_t Device,
@@ -47,7 +73,7 @@ struct ur_exp_command_buffer_handle_t_ : public _ur_object {
 
   /**
    * Obtains a fence for a specific L0 queue. If there is already an available
-   * fence for this queue, it will be reused.
+   * fence for this queue, it will be reused once its submission completed.
    * @param[in] ZeCommandQueue The L0 queue associated with the fence.
    * @param[out] ZeFence The fence.
    * @return UR_RESULT_SUCCESS or an error code on failure
@@ -68,6 +94,10 @@ struct ur_exp_command_buffer_handle_t_ : public _ur_object {
   // command-buffer object is destroyed.
   void cleanupCommandBufferResources();
 
+  // Waits for the running submission of the command-buffer, applies the
+  // pending kernel command updates, and closes the command list again.
+  ur_result_t applyPendingUpdates();
+
   // UR context associated with this command-buffer
   ur_context_handle_t Context;
   // Device associated with this command buffer
@@ -94,8 +124,20 @@ struct ur_exp_command_buffer_handle_t_ : public _ur_object {
   // added to `ZeCopyCommandList`
   bool MCopyCommandListEmpty = true;
   // Level Zero fences for each queue the command-buffer has been enqueued to.
-  // These should be destroyed when the command-buffer is released.
-  std::unordered_map<ze_command_queue_handle_t, ze_fence_handle_t> ZeFencesMap;
+  // They are used in turn, so that a submission only waits for the one before
+  // the previous submission to the queue to complete before reusing its
+  // fence, rather than for the previous one. These should be destroyed when
+  // the command-buffer is released.
+  struct queue_fences_t {
+    std::array<ze_fence_handle_t, 2> ZeFences{};
+    // The fence of the next submission.
+    size_t Next = 0;
+  };
+  std::unordered_map<ze_command_queue_handle_t, queue_fences_t> ZeFencesMap;
+  // The queue of the most recent enqueue and its fences, so that replays on
+  // the same queue don't look them up.
+  ze_command_queue_handle_t LastZeCommandQueue = nullptr;
+  queue_fences_t *LastQueueFences = nullptr;
   // The Level Zero fence from the most recent enqueue of the command-buffer.
   // Must be an element in ZeFencesMap, so is not required to be destroyed
   // itself.
@@ -117,6 +159,8 @@ struct ur_exp_command_buffer_handle_t_ : public _ur_object {
   bool IsProfilingEnabled = false;
   // Command-buffer can be submitted to an in-order command-list.
   bool IsInOrderCmdList = false;
+  // Kernel command updates for the next submission.
+  mutable_command_updates_t PendingUpdates;
   // This list is needed to release all kernels retained by the
   // command_buffer.
   std::vector<ur_kernel_handle_t> KernelsList;
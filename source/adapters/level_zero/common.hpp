@@ -275,6 +275,22 @@ static const uint32_t UrL0OutOfOrderIntegratedSignalEvent = [] {
   return UrL0OutOfOrderIntegratedSignalEventValue;
 }();
 
+// Controls whether the kernel timestamps of the profiled events of a batch
+// are written to a buffer by a single query appended to the command list,
+// instead of being queried from the driver for each event.
+static const bool UrL0BatchKernelTimestamps = [] {
+  const char *UrRet = std::getenv("UR_L0_BATCH_KERNEL_TIMESTAMPS");
+  return UrRet ? std::atoi(UrRet) != 0 : false;
+}();
+
+// Controls whether 1D kernel launches on a queue of a root device are split
+// by the adapter across queues of its sub-devices, for when the implicit
+// scaling of the driver is disabled.
+static const bool UrL0ExplicitScaling = [] {
+  const char *UrRet = std::getenv("UR_L0_EXPLICIT_SCALING");
+  return UrRet ? std::atoi(UrRet) != 0 : false;
+}();
+
 // This class encapsulates actions taken along with a call to Level Zero API.
 class ZeCall {
 private:
@@ -503,9 +519,44 @@ public:
   ZeUSMImportExtension() : Supported{false}, Enabled{false} {}
 
   void setZeUSMImport(ur_platform_handle_t_ *Platform);
-  void doZeUSMImport(ze_driver_handle_t DriverHandle, void *HostPtr,
-                     size_t Size);
+  ze_result_t doZeUSMImport(ze_driver_handle_t DriverHandle, void *HostPtr,
+                            size_t Size);
   void doZeUSMRelease(ze_driver_handle_t DriverHandle, void *HostPtr);
+
+  // Counts a reference to the imported range of DriverHandle containing
+  // [HostPtr, HostPtr + Size), if there is one. Returns false otherwise.
+  bool retainImportedHostPtr(ze_driver_handle_t DriverHandle, void *HostPtr,
+                             size_t Size);
+  // Imports [HostPtr, HostPtr + Size) with a reference, so that importing it
+  // or a part of it again, with retainImportedHostPtr, reuses the import.
+  ze_result_t importHostPtr(ze_driver_handle_t DriverHandle, void *HostPtr,
+                            size_t Size);
+  // Drops a reference to the imported range containing HostPtr. The last one
+  // releases the import, unless Keep is set, in which case it stays imported
+  // for reuse, up to UR_L0_USM_HOSTPTR_IMPORT_CACHE_SIZE released ranges.
+  // Keep is only safe for host memory which outlives the adapter or is
+  // released with urUSMReleaseExp before it's freed.
+  void releaseHostPtr(ze_driver_handle_t DriverHandle, void *HostPtr,
+                      bool Keep);
+
+private:
+  using ImportedRangeKey = std::pair<ze_driver_handle_t, uintptr_t>;
+  struct ImportedRange {
+    size_t Size;
+    uint32_t RefCount;
+    // The position in UnusedRanges if RefCount is 0.
+    std::list<ImportedRangeKey>::iterator Unused;
+  };
+  // Finds the range containing [HostPtr, HostPtr + Size).
+  std::map<ImportedRangeKey, ImportedRange>::iterator
+  findImportedRange(ze_driver_handle_t DriverHandle, void *HostPtr,
+                    size_t Size);
+
+  // The imported ranges by driver and start, and the ones without references,
+  // least recently used first.
+  std::map<ImportedRangeKey, ImportedRange> ImportedRanges;
+  std::list<ImportedRangeKey> UnusedRanges;
+  ur_mutex ImportedRangesMutex;
 };
 
 // Helper wrapper for working with USM import extension in Level Zero.
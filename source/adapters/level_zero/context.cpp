@@ -9,15 +9,79 @@
 //===----------------------------------------------------------------------===//
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <mutex>
 #include <string.h>
+#include <unordered_map>
 
 #include "context.hpp"
+#include "helpers/module_cache.hpp"
 #include "logger/ur_logger.hpp"
 #include "queue.hpp"
+#include "ur_interface_loader.hpp"
 #include "ur_level_zero.hpp"
 
+// Whether the contexts on the same Level Zero context share their USM pools,
+// so that the pools warm up and hold their slack once rather than per context.
+static const bool SharedContextPools = [] {
+  return getenv_to_unsigned("UR_L0_USM_SHARED_CONTEXT_POOLS").value_or(0) != 0;
+}();
+
+// Returns the retained owner of the USM pools shared by the contexts on
+// ZeContext, creating it with the first of them. The contexts created by
+// urContextCreate pass nullptr, and their owner creates their Level Zero
+// context.
+static ur_result_t retainSharedPoolsOwner(ur_platform_handle_t Platform,
+                                          ze_context_handle_t ZeContext,
+                                          ur_context_handle_t &Owner) {
+  std::scoped_lock<ur_mutex> Lock(Platform->SharedPoolsMutex);
+  auto It = Platform->SharedPoolsOwners.find(ZeContext);
+  if (It != Platform->SharedPoolsOwners.end()) {
+    It->second->RefCount.increment();
+    Owner = It->second;
+    return UR_RESULT_SUCCESS;
+  }
+
+  UR_CALL(Platform->populateDeviceCacheIfNeeded());
+  std::vector<ur_device_handle_t> Devices;
+  {
+    std::shared_lock<ur_shared_mutex> Lock(Platform->URDevicesCacheMutex);
+    for (auto &Device : Platform->URDevicesCache)
+      if (!Device->isSubDevice())
+        Devices.push_back(Device.get());
+  }
+
+  bool OwnZeContext = !ZeContext;
+  ze_context_handle_t OwnerZeContext = ZeContext;
+  if (OwnZeContext) {
+    ZeStruct<ze_context_desc_t> ContextDesc{};
+    ZE2UR_CALL(zeContextCreate,
+               (Platform->ZeDriver, &ContextDesc, &OwnerZeContext));
+  }
+  auto *NewOwner = new ur_context_handle_t_(OwnerZeContext, Devices.size(),
+                                            Devices.data(), OwnZeContext);
+  UR_CALL(NewOwner->initialize());
+  Platform->SharedPoolsOwners[ZeContext] = NewOwner;
+  Owner = NewOwner;
+  return UR_RESULT_SUCCESS;
+}
+
+static ur_result_t releaseSharedPoolsOwner(ur_context_handle_t Owner) {
+  ur_platform_handle_t Platform = Owner->getPlatform();
+  std::scoped_lock<ur_mutex> Lock(Platform->SharedPoolsMutex);
+  if (Owner->RefCount.load() == 1) {
+    auto &Owners = Platform->SharedPoolsOwners;
+    for (auto It = Owners.begin(); It != Owners.end(); ++It) {
+      if (It->second == Owner) {
+        Owners.erase(It);
+        break;
+      }
+    }
+  }
+  return ContextReleaseHelper(Owner);
+}
+
 namespace ur::level_zero {
 
 ur_result_t urContextCreate(
@@ -35,10 +99,17 @@ ur_result_t urContextCreate(
   ZeStruct<ze_context_desc_t> ContextDesc{};
 
   ze_context_handle_t ZeContext{};
-  ZE2UR_CALL(zeContextCreate, (Platform->ZeDriver, &ContextDesc, &ZeContext));
+  ur_context_handle_t PoolsOwner = nullptr;
+  if (SharedContextPools) {
+    UR_CALL(retainSharedPoolsOwner(Platform, nullptr, PoolsOwner));
+    ZeContext = PoolsOwner->ZeContext;
+  } else {
+    ZE2UR_CALL(zeContextCreate, (Platform->ZeDriver, &ContextDesc, &ZeContext));
+  }
   try {
-    ur_context_handle_t_ *Context =
-        new ur_context_handle_t_(ZeContext, DeviceCount, Devices, true);
+    ur_context_handle_t_ *Context = new ur_context_handle_t_(
+        ZeContext, DeviceCount, Devices, /* OwnZeContext */ !PoolsOwner);
+    Context->SharedPoolsOwner = PoolsOwner;
 
     Context->initialize();
     *RetContext = reinterpret_cast<ur_context_handle_t>(Context);
@@ -46,6 +117,7 @@ ur_result_t urContextCreate(
       std::scoped_lock<ur_shared_mutex> Lock(Platform->ContextsMutex);
       Platform->Contexts.push_back(*RetContext);
     }
+    Context->Warmup = ContextWarmupThread::create(*RetContext);
   } catch (const std::bad_alloc &) {
     return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
   } catch (...) {
@@ -156,8 +228,13 @@ ur_result_t urContextCreateWithNativeHandle(
   try {
     ze_context_handle_t ZeContext =
         reinterpret_cast<ze_context_handle_t>(NativeContext);
+    ur_context_handle_t PoolsOwner = nullptr;
+    if (SharedContextPools && NumDevices > 0)
+      UR_CALL(
+          retainSharedPoolsOwner(Devices[0]->Platform, ZeContext, PoolsOwner));
     ur_context_handle_t_ *UrContext = new ur_context_handle_t_(
         ZeContext, NumDevices, Devices, OwnNativeHandle);
+    UrContext->SharedPoolsOwner = PoolsOwner;
     UrContext->initialize();
     *Context = reinterpret_cast<ur_context_handle_t>(UrContext);
   } catch (const std::bad_alloc &) {
@@ -195,34 +272,27 @@ ur_result_t ur_context_handle_t_::initialize() {
                            .second;
     DeviceMemPools.emplace(
         std::piecewise_construct, std::make_tuple(Device->ZeDevice),
-        std::make_tuple(umf::poolMakeUniqueFromOps(
-                            umfDisjointPoolOps(), std::move(MemProvider),
-                            &DisjointPoolConfigInstance
-                                 .Configs[usm::DisjointPoolMemType::Device])
-                            .second));
+        std::make_tuple(makeDisjointPool(std::move(MemProvider),
+                                         DisjointPoolConfigInstance,
+                                         usm::DisjointPoolMemType::Device)));
 
     MemProvider = umf::memoryProviderMakeUnique<L0SharedMemoryProvider>(
                       reinterpret_cast<ur_context_handle_t>(this), Device)
                       .second;
     SharedMemPools.emplace(
         std::piecewise_construct, std::make_tuple(Device->ZeDevice),
-        std::make_tuple(umf::poolMakeUniqueFromOps(
-                            umfDisjointPoolOps(), std::move(MemProvider),
-                            &DisjointPoolConfigInstance
-                                 .Configs[usm::DisjointPoolMemType::Shared])
-                            .second));
+        std::make_tuple(makeDisjointPool(std::move(MemProvider),
+                                         DisjointPoolConfigInstance,
+                                         usm::DisjointPoolMemType::Shared)));
 
     MemProvider = umf::memoryProviderMakeUnique<L0SharedReadOnlyMemoryProvider>(
                       reinterpret_cast<ur_context_handle_t>(this), Device)
                       .second;
     SharedReadOnlyMemPools.emplace(
         std::piecewise_construct, std::make_tuple(Device->ZeDevice),
-        std::make_tuple(
-            umf::poolMakeUniqueFromOps(
-                umfDisjointPoolOps(), std::move(MemProvider),
-                &DisjointPoolConfigInstance
-                     .Configs[usm::DisjointPoolMemType::SharedReadOnly])
-                .second));
+        std::make_tuple(makeDisjointPool(
+            std::move(MemProvider), DisjointPoolConfigInstance,
+            usm::DisjointPoolMemType::SharedReadOnly)));
 
     MemProvider = umf::memoryProviderMakeUnique<L0DeviceMemoryProvider>(
                       reinterpret_cast<ur_context_handle_t>(this), Device)
@@ -259,33 +329,34 @@ ur_result_t ur_context_handle_t_::initialize() {
       createUSMAllocatorsRecursive(SubDevice);
   };
 
-  // Create USM pool for each pair (device, context).
-  //
-  for (auto &Device : Devices) {
-    createUSMAllocatorsRecursive(Device);
-  }
-  // Create USM pool for host. Device and Shared USM allocations
-  // are device-specific. Host allocations are not device-dependent therefore
-  // we don't need a map with device as key.
-  auto MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
-                         reinterpret_cast<ur_context_handle_t>(this), nullptr)
-                         .second;
-  HostMemPool =
-      umf::poolMakeUniqueFromOps(
-          umfDisjointPoolOps(), std::move(MemProvider),
-          &DisjointPoolConfigInstance.Configs[usm::DisjointPoolMemType::Host])
-          .second;
-
-  MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
-                    reinterpret_cast<ur_context_handle_t>(this), nullptr)
-                    .second;
-  HostMemProxyPool =
-      umf::poolMakeUnique<USMProxyPool>(std::move(MemProvider)).second;
-
-  // We may allocate memory to this root device so create allocators.
-  if (SingleRootDevice &&
-      DeviceMemPools.find(SingleRootDevice->ZeDevice) == DeviceMemPools.end()) {
-    createUSMAllocators(SingleRootDevice);
+  // The contexts sharing the pools of an owner don't have pools of their own.
+  if (!SharedPoolsOwner) {
+    // Create USM pool for each pair (device, context).
+    //
+    for (auto &Device : Devices) {
+      createUSMAllocatorsRecursive(Device);
+    }
+    // Create USM pool for host. Device and Shared USM allocations
+    // are device-specific. Host allocations are not device-dependent therefore
+    // we don't need a map with device as key.
+    auto MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
+                           reinterpret_cast<ur_context_handle_t>(this), nullptr)
+                           .second;
+    HostMemPool = makeDisjointPool(std::move(MemProvider),
+                                   DisjointPoolConfigInstance,
+                                   usm::DisjointPoolMemType::Host);
+
+    MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
+                      reinterpret_cast<ur_context_handle_t>(this), nullptr)
+                      .second;
+    HostMemProxyPool =
+        umf::poolMakeUnique<USMProxyPool>(std::move(MemProvider)).second;
+
+    // We may allocate memory to this root device so create allocators.
+    if (SingleRootDevice && DeviceMemPools.find(SingleRootDevice->ZeDevice) ==
+                                DeviceMemPools.end()) {
+      createUSMAllocators(SingleRootDevice);
+    }
   }
 
   // Create the immediate command list to be used for initializations.
@@ -319,9 +390,99 @@ ur_result_t ur_context_handle_t_::initialize() {
   ZE2UR_CALL(
       zeCommandListCreateImmediate,
       (ZeContext, Device->ZeDevice, &ZeCommandQueueDesc, &ZeCommandListInit));
+
+  TrimWatchdog =
+      USMTrimWatchdog::create(reinterpret_cast<ur_context_handle_t>(this));
+  EventCleaner = EventCleanupThread::create();
   return UR_RESULT_SUCCESS;
 }
 
+std::unique_ptr<ContextWarmupThread>
+ContextWarmupThread::create(ur_context_handle_t Context) {
+  static const bool Enabled =
+      getenv_to_unsigned("UR_L0_ASYNC_EAGER_INIT").value_or(0);
+  // Freeing the warmup memory takes the lock of the contexts of the platform
+  // with indirect access tracking, which is held by whoever is releasing the
+  // context and waiting for the thread.
+  if (!Enabled || IndirectAccessTrackingEnabled)
+    return nullptr;
+
+  return std::make_unique<ContextWarmupThread>(Context);
+}
+
+ContextWarmupThread::ContextWarmupThread(ur_context_handle_t Context)
+    : Context(Context) {
+  Thread = std::thread(&ContextWarmupThread::run, this);
+}
+
+ContextWarmupThread::~ContextWarmupThread() {
+  Stop = true;
+  Thread.join();
+}
+
+void ContextWarmupThread::run() {
+  // The host pool doesn't depend on the devices
+  void *HostMem = nullptr;
+  auto Result = ur::level_zero::urUSMHostAlloc(Context, nullptr, nullptr, 1,
+                                               &HostMem);
+  if (Result == UR_RESULT_SUCCESS)
+    Result = ur::level_zero::urUSMFree(Context, HostMem);
+
+  for (auto Device : Context->Devices) {
+    if (Result != UR_RESULT_SUCCESS || Stop)
+      break;
+    Result = warmupDevice(Device);
+  }
+  if (Result != UR_RESULT_SUCCESS)
+    logger::warning("failed to warm up the context: {}", Result);
+}
+
+ur_result_t ContextWarmupThread::warmupDevice(ur_device_handle_t Device) {
+  ur_queue_handle_t Queue = nullptr;
+  UR_CALL(ur::level_zero::urQueueCreate(Context, Device, nullptr, &Queue));
+
+  void *DeviceMem = nullptr;
+  void *SharedMem = nullptr;
+  const uint8_t Pattern = 0;
+  std::vector<ur_event_handle_t> Events;
+  auto Submit = [&]() -> ur_result_t {
+    UR_CALL(ur::level_zero::urUSMDeviceAlloc(Context, Device, nullptr, nullptr,
+                                             1, &DeviceMem));
+    UR_CALL(ur::level_zero::urUSMSharedAlloc(Context, Device, nullptr, nullptr,
+                                             1, &SharedMem));
+    ur_event_handle_t Event = nullptr;
+    UR_CALL(ur::level_zero::urEnqueueEventsWait(Queue, 0, nullptr, &Event));
+    Events.push_back(Event);
+    UR_CALL(ur::level_zero::urEnqueueUSMFill(Queue, DeviceMem, 1, &Pattern, 1,
+                                             0, nullptr, &Event));
+    Events.push_back(Event);
+    UR_CALL(ur::level_zero::urEnqueueUSMMemcpy(Queue, false, SharedMem,
+                                               DeviceMem, 1, 0, nullptr,
+                                               &Event));
+    Events.push_back(Event);
+    return UR_RESULT_SUCCESS;
+  };
+  ur_result_t Result = Submit();
+
+  // Everything goes back to the caches of the context, whatever failed
+  auto Finish = ur::level_zero::urQueueFinish(Queue);
+  if (Result == UR_RESULT_SUCCESS)
+    Result = Finish;
+  for (auto Event : Events)
+    ur::level_zero::urEventRelease(Event);
+  for (auto Mem : {DeviceMem, SharedMem})
+    if (Mem)
+      ur::level_zero::urUSMFree(Context, Mem);
+  ur::level_zero::urQueueRelease(Queue);
+  return Result;
+}
+
+std::shared_lock<ur_shared_mutex> ur_context_handle_t_::lockSharedPools() {
+  if (!SharedPoolsOwner || IndirectAccessTrackingEnabled)
+    return {};
+  return std::shared_lock<ur_shared_mutex>(SharedPoolsOwner->Mutex);
+}
+
 ur_device_handle_t ur_context_handle_t_::getRootDevice() const {
   assert(Devices.size() > 0);
 
@@ -365,17 +526,33 @@ ur_result_t ContextReleaseHelper(ur_context_handle_t Context) {
     if (It != Contexts.end())
       Contexts.erase(It);
   }
+
+  // The process exits once torn down, the context and its caches (events,
+  // command lists, USM pools, modules) are left to the OS. Its threads would
+  // race with the exit.
+  if (fast_teardown_enabled()) {
+    Context->stopThreads();
+    return UR_RESULT_SUCCESS;
+  }
+
   ze_context_handle_t DestroyZeContext =
       Context->OwnNativeHandle ? Context->ZeContext : nullptr;
 
   // Clean up any live memory associated with Context
   ur_result_t Result = Context->finalize();
+  // The Level Zero context of a context sharing pools is that of their owner.
+  ur_context_handle_t PoolsOwner = Context->SharedPoolsOwner;
+  if (!PoolsOwner)
+    destroyReusableModules(Context->ZeContext);
 
   // We must delete Context first and then destroy zeContext because
   // Context deallocation requires ZeContext in some member deallocation of
   // ur_context_handle_t.
   delete Context;
 
+  if (PoolsOwner)
+    UR_CALL(releaseSharedPoolsOwner(PoolsOwner));
+
   // Destruction of some members of ur_context_handle_t uses L0 context
   // and therefore it must be valid at that point.
   // Technically it should be placed to the destructor of ur_context_handle_t
@@ -394,22 +571,44 @@ ur_platform_handle_t ur_context_handle_t_::getPlatform() const {
   return Devices[0]->Platform;
 }
 
+void ur_context_handle_t_::stopThreads() {
+  // The warmup uses the context until it's done with.
+  Warmup.reset();
+  // Stop trimming the USM pools before they are destroyed.
+  TrimWatchdog.reset();
+  // Clean up the events handed over before the event caches are destroyed.
+  EventCleaner.reset();
+}
+
 ur_result_t ur_context_handle_t_::finalize() {
   // This function is called when ur_context_handle_t is deallocated,
   // urContextRelease. There could be some memory that may have not been
   // deallocated. For example, event and event pool caches would be still alive.
 
+  stopThreads();
+  trimPhysicalMemPool(reinterpret_cast<ur_context_handle_t>(this), 0);
+
   if (!DisableEventsCaching) {
     std::scoped_lock<ur_mutex> Lock(EventCacheMutex);
-    for (auto &EventCache : EventCaches) {
-      for (auto &Event : EventCache) {
+    auto DestroyEvents = [](auto &Events) {
+      for (auto &Event : Events) {
         auto ZeResult = ZE_CALL_NOCHECK(zeEventDestroy, (Event->ZeEvent));
         // Gracefully handle the case that L0 was already unloaded.
         if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
           return ze2urResult(ZeResult);
         delete Event;
       }
-      EventCache.clear();
+      Events.clear();
+      return UR_RESULT_SUCCESS;
+    };
+    for (auto &EventCache : EventCaches) {
+      UR_CALL(DestroyEvents(EventCache));
+    }
+    for (auto &ThreadEventCache : ThreadEventCaches) {
+      for (auto &Entry : ThreadEventCache->Events) {
+        UR_CALL(DestroyEvents(Entry.second));
+      }
+      ThreadEventCache->Released = true;
     }
   }
   {
@@ -457,6 +656,47 @@ ur_result_t ur_context_handle_t_::finalize() {
   return UR_RESULT_SUCCESS;
 }
 
+void ur_context_handle_t_::deferResidency(
+    void *Ptr, size_t Size, std::list<ur_device_handle_t> Devices) {
+  std::scoped_lock<ur_mutex> Lock(PendingResidencyMutex);
+  PendingResidency[Ptr] = {Size, std::move(Devices)};
+  HasPendingResidency = true;
+}
+
+void ur_context_handle_t_::cancelResidency(void *Ptr) {
+  if (!HasPendingResidency)
+    return;
+  std::scoped_lock<ur_mutex> Lock(PendingResidencyMutex);
+  PendingResidency.erase(Ptr);
+  HasPendingResidency = !PendingResidency.empty();
+}
+
+ur_result_t ur_context_handle_t_::makePendingResident() {
+  if (!HasPendingResidency)
+    return UR_RESULT_SUCCESS;
+
+  decltype(PendingResidency) Pending;
+  {
+    std::scoped_lock<ur_mutex> Lock(PendingResidencyMutex);
+    std::swap(Pending, PendingResidency);
+    HasPendingResidency = false;
+  }
+
+  // TODO: Return any non-success result once oneapi-src/level-zero-spec#240
+  // is resolved, as for the allocations made resident right away.
+  for (const auto &[Ptr, Residency] : Pending) {
+    for (const auto &D : Residency.second) {
+      auto ZeResult = ZE_CALL_NOCHECK(
+          zeContextMakeMemoryResident,
+          (ZeContext, D->ZeDevice, Ptr, Residency.first));
+      if (ZeResult == ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY ||
+          ZeResult == ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY)
+        return ze2urResult(ZeResult);
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 // Maximum number of events that can be present in an event ZePool is captured
 // here. Setting it to 256 gave best possible performance for several
 // benchmarks.
@@ -558,9 +798,102 @@ ur_result_t ur_context_handle_t_::getFreeSlotInExistingOrNewPool(
   return UR_RESULT_SUCCESS;
 }
 
+// The number of events a thread may cache for a context, 0 disables the
+// thread-local event caches.
+static const size_t ThreadEventCacheSize = [] {
+  return getenv_to_unsigned("UR_L0_EVENT_THREAD_CACHE_SIZE").value_or(64);
+}();
+
+// Events move between the caches of a thread and of the context by half of
+// the capacity of the thread cache at a time.
+static const size_t ThreadEventCacheBatch =
+    std::max<size_t>(ThreadEventCacheSize / 2, 1);
+
+namespace {
+// The event caches of a thread, by context.
+struct thread_event_caches_t {
+  std::unordered_map<uint64_t, std::shared_ptr<ur_thread_event_cache_t>>
+      Caches;
+
+  ~thread_event_caches_t() {
+    // The events are kept for the next threads.
+    for (auto &Entry : Caches) {
+      Entry.second->InUse = false;
+    }
+  }
+};
+thread_local thread_event_caches_t LocalEventCaches;
+} // namespace
+
+uint64_t ur_context_handle_t_::nextThreadEventCacheId() {
+  static std::atomic<uint64_t> NextId{0};
+  return NextId++;
+}
+
+ur_thread_event_cache_t *ur_context_handle_t_::getThreadEventCache() {
+  if (DisableEventsCaching || ThreadEventCacheSize == 0)
+    return nullptr;
+
+  auto &Caches = LocalEventCaches.Caches;
+  auto It = Caches.find(ThreadEventCacheId);
+  if (It != Caches.end())
+    return It->second.get();
+
+  // Forget about the caches of the contexts that were released.
+  for (auto CacheIt = Caches.begin(); CacheIt != Caches.end();) {
+    if (CacheIt->second->Released)
+      CacheIt = Caches.erase(CacheIt);
+    else
+      ++CacheIt;
+  }
+
+  std::shared_ptr<ur_thread_event_cache_t> Cache;
+  {
+    std::scoped_lock<ur_mutex> Lock(EventCacheMutex);
+    for (auto &ThreadEventCache : ThreadEventCaches) {
+      bool InUse = false;
+      if (ThreadEventCache->InUse.compare_exchange_strong(InUse, true)) {
+        Cache = ThreadEventCache;
+        break;
+      }
+    }
+    if (!Cache) {
+      Cache = std::make_shared<ur_thread_event_cache_t>();
+      Cache->InUse = true;
+      ThreadEventCaches.push_back(Cache);
+    }
+  }
+  return Caches.emplace(ThreadEventCacheId, std::move(Cache))
+      .first->second.get();
+}
+
 ur_event_handle_t ur_context_handle_t_::getEventFromContextCache(
     bool HostVisible, bool WithProfiling, ur_device_handle_t Device,
     bool CounterBasedEventEnabled) {
+  if (auto ThreadEventCache = getThreadEventCache()) {
+    auto &Events =
+        ThreadEventCache->Events[{HostVisible, WithProfiling, Device}];
+    if (Events.empty()) {
+      std::scoped_lock<ur_mutex> Lock(EventCacheMutex);
+      auto Cache = getEventCache(HostVisible, WithProfiling, Device);
+      while (!Cache->empty() && Events.size() < ThreadEventCacheBatch &&
+             Cache->front()->CounterBasedEventsEnabled ==
+                 CounterBasedEventEnabled) {
+        Events.push_back(Cache->front());
+        Cache->pop_front();
+      }
+    }
+    if (Events.empty() ||
+        Events.back()->CounterBasedEventsEnabled != CounterBasedEventEnabled)
+      return nullptr;
+
+    ur_event_handle_t Event = Events.back();
+    Events.pop_back();
+    // We have to reset event before using it.
+    Event->reset();
+    return Event;
+  }
+
   std::scoped_lock<ur_mutex> Lock(EventCacheMutex);
   auto Cache = getEventCache(HostVisible, WithProfiling, Device);
   if (Cache->empty())
@@ -578,15 +911,32 @@ ur_event_handle_t ur_context_handle_t_::getEventFromContextCache(
 }
 
 void ur_context_handle_t_::addEventToContextCache(ur_event_handle_t Event) {
-  std::scoped_lock<ur_mutex> Lock(EventCacheMutex);
   ur_device_handle_t Device = nullptr;
 
   if (!Event->IsMultiDevice && Event->UrQueue) {
     Device = Event->UrQueue->Device;
   }
 
-  auto Cache = getEventCache(Event->isHostVisible(),
-                             Event->isProfilingEnabled(), Device);
+  bool HostVisible = Event->isHostVisible();
+  bool WithProfiling = Event->isProfilingEnabled();
+  if (auto ThreadEventCache = getThreadEventCache()) {
+    auto &Events =
+        ThreadEventCache->Events[{HostVisible, WithProfiling, Device}];
+    Events.push_back(Event);
+    if (Events.size() <= ThreadEventCacheSize)
+      return;
+
+    // Hand the oldest events over to the other threads.
+    std::scoped_lock<ur_mutex> Lock(EventCacheMutex);
+    auto Cache = getEventCache(HostVisible, WithProfiling, Device);
+    auto End = Events.begin() + ThreadEventCacheBatch;
+    Cache->insert(Cache->end(), Events.begin(), End);
+    Events.erase(Events.begin(), End);
+    return;
+  }
+
+  std::scoped_lock<ur_mutex> Lock(EventCacheMutex);
+  auto Cache = getEventCache(HostVisible, WithProfiling, Device);
   Cache->emplace_back(Event);
 }
 
@@ -658,9 +1008,17 @@ ur_result_t ur_context_handle_t_::getAvailableCommandList(
     CommandList = Queue->getQueueGroup(UseCopyEngine).getImmCmdList();
     if (CommandList->second.EventList.size() >=
         Queue->getImmdCmmdListsEventCleanupThreshold()) {
-      std::vector<ur_event_handle_t> EventListToCleanup;
-      Queue->resetCommandList(CommandList, false, EventListToCleanup);
-      CleanupEventListFromResetCmdList(EventListToCleanup, true);
+      auto &EventList = CommandList->second.EventList;
+      // The events of discarded or batched completions can't be checked one
+      // by one, they are cleaned up inline
+      if (EventCleaner && !Queue->isDiscardEvents() &&
+          !CommandList->second.completions) {
+        EventCleaner->enqueue(Queue, EventList);
+      } else {
+        std::vector<ur_event_handle_t> EventListToCleanup;
+        Queue->resetCommandList(CommandList, false, EventListToCleanup);
+        CleanupEventListFromResetCmdList(EventListToCleanup, true);
+      }
     }
     UR_CALL(Queue->insertStartBarrierIfDiscardEventsMode(CommandList));
     if (auto Res = Queue->insertActiveBarriers(CommandList, UseCopyEngine))
@@ -9,10 +9,14 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <map>
+#include <memory>
 #include <stdarg.h>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -23,7 +27,9 @@
 #include <zes_api.h>
 
 #include "common.hpp"
+#include "physical_mem.hpp"
 #include "queue.hpp"
+#include "usm.hpp"
 
 #include <umf_helpers.hpp>
 
@@ -33,6 +39,51 @@ struct l0_command_list_cache_info {
   bool IsImmediate = false;
 };
 
+// Events cached by a thread for a context, on top of the caches of the
+// context. Only the thread holding it uses it, so that acquiring and caching
+// events takes no lock, and it's refilled from and spilled to the caches of
+// the context in batches.
+struct ur_thread_event_cache_t {
+  // Host visibility, profiling and device of the events
+  using key_t = std::tuple<bool, bool, ur_device_handle_t>;
+  std::map<key_t, std::vector<ur_event_handle_t>> Events;
+
+  // Whether a thread holds the cache, the caches of the threads that exited
+  // are handed to new threads.
+  std::atomic<bool> InUse{false};
+  // Set once the events were destroyed with the context.
+  std::atomic<bool> Released{false};
+};
+
+// Warms up a context created by urContextCreate on a background thread, so
+// that the first submissions of the application don't pay for creating the
+// event pools, command lists and Level Zero queues and for the first slabs of
+// the USM pools, without blocking the thread creating the context as
+// UR_L0_EAGER_INIT does. A small host allocation is made, and for each device
+// an in-order queue with the default properties submits a barrier, a fill and
+// a copy between small device and shared allocations before everything is
+// released: the events, command lists and slabs go back to the caches of the
+// context, for the queues the application creates next. Enabled by setting
+// UR_L0_ASYNC_EAGER_INIT=1.
+class ContextWarmupThread {
+public:
+  // Returns nullptr if the warmup is not enabled
+  static std::unique_ptr<ContextWarmupThread>
+  create(ur_context_handle_t Context);
+
+  ContextWarmupThread(ur_context_handle_t Context);
+  // Stops the warmup once the device in progress is done with
+  ~ContextWarmupThread();
+
+private:
+  void run();
+  ur_result_t warmupDevice(ur_device_handle_t Device);
+
+  ur_context_handle_t Context;
+  std::atomic<bool> Stop{false};
+  std::thread Thread;
+};
+
 struct ur_context_handle_t_ : _ur_object {
   ur_context_handle_t_(ze_context_handle_t ZeContext, uint32_t NumDevices,
                        const ur_device_handle_t *Devs, bool OwnZeContext)
@@ -103,6 +154,21 @@ struct ur_context_handle_t_ : _ur_object {
   std::unordered_map<ur_device_handle_t, std::list<ur_device_handle_t>>
       P2PDeviceCache;
 
+  // Allocations whose residency is deferred by UR_L0_USM_RESIDENT, with the
+  // devices to make them resident on. They are made resident in one batch
+  // before the next kernel launch in the context, or dropped if they are
+  // freed first.
+  std::unordered_map<void *, std::pair<size_t, std::list<ur_device_handle_t>>>
+      PendingResidency;
+  ur_mutex PendingResidencyMutex;
+  // Lets the kernel launches skip the mutex when nothing is pending.
+  std::atomic<bool> HasPendingResidency{false};
+
+  void deferResidency(void *Ptr, size_t Size,
+                      std::list<ur_device_handle_t> Devices);
+  void cancelResidency(void *Ptr);
+  ur_result_t makePendingResident();
+
   // Store USM pool for USM shared and device allocations. There is 1 memory
   // pool per each pair of (context, device) per each memory type.
   std::unordered_map<ze_device_handle_t, umf::pool_unique_handle_t>
@@ -124,9 +190,39 @@ struct ur_context_handle_t_ : _ur_object {
       SharedReadOnlyMemProxyPools;
   umf::pool_unique_handle_t HostMemProxyPool;
 
+  // With UR_L0_USM_SHARED_CONTEXT_POOLS=1 the contexts on the same Level Zero
+  // context share their USM pools above, which are those of an internal
+  // context of all the devices of the platform, retained by each of them.
+  // nullptr if the context has pools of its own.
+  ur_context_handle_t SharedPoolsOwner = nullptr;
+
+  // The context whose USM pools this context allocates from.
+  ur_context_handle_t getPoolsOwner() {
+    return SharedPoolsOwner ? SharedPoolsOwner : this;
+  }
+
+  // Locks out the trims of the shared USM pools, which hold the lock of their
+  // owner, while this context allocates or frees from them. Doesn't lock if
+  // the pools aren't shared, or if indirect access tracking is enabled as the
+  // platform lock is then held instead.
+  std::shared_lock<ur_shared_mutex> lockSharedPools();
+
   // Map associating pools created with urUsmPoolCreate and internal pools
   std::list<ur_usm_pool_handle_t> UsmPoolHandles{};
 
+  // Trims the USM pools when the devices are low on memory, if enabled.
+  std::unique_ptr<USMTrimWatchdog> TrimWatchdog;
+
+  // The physical memory of the released physical memory handles, reused by
+  // urPhysicalMemCreate. Trimmed with the USM pools of the context.
+  ur_physical_mem_pool_t PhysicalMemPool{PhysicalMemPoolSize};
+
+  // Cleans up the events of the immediate command lists, if enabled.
+  std::unique_ptr<EventCleanupThread> EventCleaner;
+
+  // Warms up the context created by urContextCreate, if enabled.
+  std::unique_ptr<ContextWarmupThread> Warmup;
+
   // We need to store all memory allocations in the context because there could
   // be kernels with indirect access. Kernels with indirect access start to
   // reference all existing memory allocations at the time when they are
@@ -178,6 +274,15 @@ struct ur_context_handle_t_ : _ur_object {
   std::vector<std::unordered_map<ur_device_handle_t, size_t>>
       EventCachesDeviceMap{4};
 
+  // The thread-local event caches of the context, guarded by EventCacheMutex.
+  // The mutex is only taken when a thread first uses the context, and to move
+  // events between the caches of the threads and of the context.
+  std::vector<std::shared_ptr<ur_thread_event_cache_t>> ThreadEventCaches;
+
+  // Tells the thread-local event caches of different contexts apart, the
+  // handles may be reused.
+  const uint64_t ThreadEventCacheId{nextThreadEventCacheId()};
+
   // Initialize the PI context.
   ur_result_t initialize();
 
@@ -193,6 +298,10 @@ struct ur_context_handle_t_ : _ur_object {
   // Finalize the PI context
   ur_result_t finalize();
 
+  // Stops the threads using the context, and cleans up the events handed over
+  // to the event cleanup thread. Called by finalize.
+  void stopThreads();
+
   // Return the Platform, which is the same for all devices in the context
   ur_platform_handle_t getPlatform() const;
 
@@ -313,6 +422,12 @@ struct ur_context_handle_t_ : _ur_object {
   ze_context_handle_t getZeHandle() const;
 
 private:
+  static uint64_t nextThreadEventCacheId();
+
+  // Get the event cache of the calling thread, nullptr if thread-local event
+  // caches are disabled.
+  ur_thread_event_cache_t *getThreadEventCache();
+
   // Get the cache of events for a provided scope and profiling mode.
   auto getEventCache(bool HostVisible, bool WithProfiling,
                      ur_device_handle_t Device) {
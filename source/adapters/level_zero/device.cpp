@@ -189,7 +189,7 @@ uint64_t calculateGlobalMemSize(ur_device_handle_t Device) {
   return Device->ZeGlobalMemSize.operator->()->value;
 }
 
-ur_result_t urDeviceGetInfo(
+static ur_result_t getDeviceInfo(
     ur_device_handle_t Device,  ///< [in] handle of the device instance
     ur_device_info_t ParamName, ///< [in] type of the info to retrieve
     size_t propSize,  ///< [in] the number of bytes pointed to by ParamValue.
@@ -1163,6 +1163,21 @@ ur_result_t urDeviceGetInfo(
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t urDeviceGetInfo(
+    ur_device_handle_t Device,  ///< [in] handle of the device instance
+    ur_device_info_t ParamName, ///< [in] type of the info to retrieve
+    size_t propSize,  ///< [in] the number of bytes pointed to by ParamValue.
+    void *ParamValue, ///< [out][optional] array of bytes holding the info.
+    size_t *pSize ///< [out][optional] pointer to the actual size in bytes of
+                  ///< the queried infoType.
+) {
+  return Device->InfoCache.get(
+      ParamName, propSize, ParamValue, pSize,
+      [Device, ParamName](size_t Size, void *Value, size_t *SizeRet) {
+        return getDeviceInfo(Device, ParamName, Size, Value, SizeRet);
+      });
+}
+
 bool CopyEngineRequested(const ur_device_handle_t &Device) {
   int LowerCopyQueueIndex = getRangeOfAllowedCopyEngines(Device).first;
   int UpperCopyQueueIndex = getRangeOfAllowedCopyEngines(Device).second;
@@ -1360,15 +1375,9 @@ ur_result_t urDeviceCreateWithNativeHandle(
   return UR_RESULT_SUCCESS;
 }
 
-ur_result_t urDeviceGetGlobalTimestamps(
-    ur_device_handle_t Device, ///< [in] handle of the device instance
-    uint64_t *DeviceTimestamp, ///< [out][optional] pointer to the Device's
-                               ///< global timestamp that correlates with the
-                               ///< Host's global timestamp value
-    uint64_t *HostTimestamp    ///< [out][optional] pointer to the Host's global
-                               ///< timestamp that correlates with the Device's
-                               ///< global timestamp value
-) {
+static ur_result_t queryGlobalTimestamps(ur_device_handle_t Device,
+                                         uint64_t *DeviceTimestamp,
+                                         uint64_t *HostTimestamp) {
   const uint64_t &ZeTimerResolution =
       Device->ZeDeviceProperties->timerResolution;
   const uint64_t TimestampMaxCount = Device->getTimestampMask();
@@ -1387,6 +1396,25 @@ ur_result_t urDeviceGetGlobalTimestamps(
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t urDeviceGetGlobalTimestamps(
+    ur_device_handle_t Device, ///< [in] handle of the device instance
+    uint64_t *DeviceTimestamp, ///< [out][optional] pointer to the Device's
+                               ///< global timestamp that correlates with the
+                               ///< Host's global timestamp value
+    uint64_t *HostTimestamp    ///< [out][optional] pointer to the Host's global
+                               ///< timestamp that correlates with the Device's
+                               ///< global timestamp value
+) {
+  if (!Device->ClockCalibration.enabled()) {
+    return queryGlobalTimestamps(Device, DeviceTimestamp, HostTimestamp);
+  }
+  return Device->ClockCalibration.getTimestamps(
+      DeviceTimestamp, HostTimestamp,
+      [Device](ur::clock_calibration_t::sample_t &Sample) {
+        return queryGlobalTimestamps(Device, &Sample.device, &Sample.host);
+      });
+}
+
 ur_result_t urDeviceRetain(ur_device_handle_t Device) {
   // The root-device ref-count remains unchanged (always 1).
   if (Device->isSubDevice()) {
@@ -1561,6 +1589,9 @@ ur_result_t ur_device_handle_t_::initialize(int SubSubDeviceOrdinal,
         ZE_CALL_NOCHECK(zeDeviceGetProperties, (ZeDevice, &P));
       };
 
+  Profile = ur::loadDeviceProfile(UR_ADAPTER_BACKEND_LEVEL_ZERO, this,
+                                  ur::level_zero::urDeviceGetInfo);
+
   ImmCommandListUsed = this->useImmediateCommandLists();
 
   uint32_t numQueueGroups = 0;
@@ -1688,9 +1719,11 @@ void ZeUSMImportExtension::setZeUSMImport(ur_platform_handle_t_ *Platform) {
     // Hostptr import/release is supported by this platform.
     Supported = true;
 
-    // Check if env var SYCL_USM_HOSTPTR_IMPORT has been set requesting
-    // host ptr import during buffer creation.
-    const char *USMHostPtrImportStr = std::getenv("SYCL_USM_HOSTPTR_IMPORT");
+    // Check if env var UR_L0_USM_HOSTPTR_IMPORT or SYCL_USM_HOSTPTR_IMPORT
+    // has been set requesting host ptr import during buffer creation.
+    const char *UrRet = std::getenv("UR_L0_USM_HOSTPTR_IMPORT");
+    const char *USMHostPtrImportStr =
+        UrRet ? UrRet : std::getenv("SYCL_USM_HOSTPTR_IMPORT");
     if (!USMHostPtrImportStr || std::atoi(USMHostPtrImportStr) == 0)
       return;
 
@@ -1703,12 +1736,96 @@ void ZeUSMImportExtension::setZeUSMImport(ur_platform_handle_t_ *Platform) {
     setEnvVar("SYCL_HOST_UNIFIED_MEMORY", "1");
   }
 }
-void ZeUSMImportExtension::doZeUSMImport(ze_driver_handle_t DriverHandle,
-                                         void *HostPtr, size_t Size) {
-  ZE_CALL_NOCHECK(zexDriverImportExternalPointer,
-                  (DriverHandle, HostPtr, Size));
+ze_result_t
+ZeUSMImportExtension::doZeUSMImport(ze_driver_handle_t DriverHandle,
+                                    void *HostPtr, size_t Size) {
+  return ZE_CALL_NOCHECK(zexDriverImportExternalPointer,
+                         (DriverHandle, HostPtr, Size));
 }
 void ZeUSMImportExtension::doZeUSMRelease(ze_driver_handle_t DriverHandle,
                                           void *HostPtr) {
   ZE_CALL_NOCHECK(zexDriverReleaseImportedPointer, (DriverHandle, HostPtr));
 }
+
+std::map<ZeUSMImportExtension::ImportedRangeKey,
+         ZeUSMImportExtension::ImportedRange>::iterator
+ZeUSMImportExtension::findImportedRange(ze_driver_handle_t DriverHandle,
+                                        void *HostPtr, size_t Size) {
+  auto Start = reinterpret_cast<uintptr_t>(HostPtr);
+  auto It = ImportedRanges.upper_bound({DriverHandle, Start});
+  if (It == ImportedRanges.begin())
+    return ImportedRanges.end();
+  --It;
+  if (It->first.first != DriverHandle ||
+      Start + Size > It->first.second + It->second.Size)
+    return ImportedRanges.end();
+  return It;
+}
+
+bool ZeUSMImportExtension::retainImportedHostPtr(
+    ze_driver_handle_t DriverHandle, void *HostPtr, size_t Size) {
+  std::scoped_lock<ur_mutex> Lock(ImportedRangesMutex);
+  auto It = findImportedRange(DriverHandle, HostPtr, Size);
+  if (It == ImportedRanges.end())
+    return false;
+  if (It->second.RefCount++ == 0)
+    UnusedRanges.erase(It->second.Unused);
+  return true;
+}
+
+ze_result_t ZeUSMImportExtension::importHostPtr(ze_driver_handle_t DriverHandle,
+                                                void *HostPtr, size_t Size) {
+  std::scoped_lock<ur_mutex> Lock(ImportedRangesMutex);
+  // The released ranges overlapping this one would make the import fail.
+  auto Start = reinterpret_cast<uintptr_t>(HostPtr);
+  for (auto It = UnusedRanges.begin(); It != UnusedRanges.end();) {
+    auto RangeStart = It->second;
+    auto RangeEnd = RangeStart + ImportedRanges.at(*It).Size;
+    if (It->first != DriverHandle || RangeEnd <= Start ||
+        RangeStart >= Start + Size) {
+      ++It;
+      continue;
+    }
+    doZeUSMRelease(DriverHandle, reinterpret_cast<void *>(RangeStart));
+    ImportedRanges.erase(*It);
+    It = UnusedRanges.erase(It);
+  }
+
+  auto ZeResult = doZeUSMImport(DriverHandle, HostPtr, Size);
+  if (ZeResult == ZE_RESULT_SUCCESS)
+    ImportedRanges.insert_or_assign({DriverHandle, Start},
+                                    ImportedRange{Size, 1, {}});
+  return ZeResult;
+}
+
+void ZeUSMImportExtension::releaseHostPtr(ze_driver_handle_t DriverHandle,
+                                          void *HostPtr, bool Keep) {
+  static const size_t CacheSize =
+      getenv_to_unsigned("UR_L0_USM_HOSTPTR_IMPORT_CACHE_SIZE").value_or(0);
+
+  std::scoped_lock<ur_mutex> Lock(ImportedRangesMutex);
+  auto It = findImportedRange(DriverHandle, HostPtr, 1);
+  if (It == ImportedRanges.end()) {
+    // Not imported by importHostPtr.
+    doZeUSMRelease(DriverHandle, HostPtr);
+    return;
+  }
+  auto &Range = It->second;
+  if (Range.RefCount == 0) {
+    // Already released, and kept for reuse.
+    if (Keep)
+      return;
+    UnusedRanges.erase(Range.Unused);
+  } else if (--Range.RefCount != 0) {
+    return;
+  } else if (Keep && CacheSize) {
+    Range.Unused = UnusedRanges.insert(UnusedRanges.end(), It->first);
+    if (UnusedRanges.size() <= CacheSize)
+      return;
+    // Evict the least recently used range.
+    It = ImportedRanges.find(UnusedRanges.front());
+    UnusedRanges.pop_front();
+  }
+  doZeUSMRelease(It->first.first, reinterpret_cast<void *>(It->first.second));
+  ImportedRanges.erase(It);
+}
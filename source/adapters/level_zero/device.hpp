@@ -19,7 +19,9 @@
 #include <vector>
 
 #include <ur/ur.hpp>
+#include <ur_clock_calibration.hpp>
 #include <ur_ddi.h>
+#include <ur_device_profile.hpp>
 #include <ze_api.h>
 #include <zes_api.h>
 
@@ -57,6 +59,48 @@ struct ur_ze_external_memory_data {
   size_t size;
 };
 
+// What a bindless image handle is created from, see
+// ur_device_handle_t_::BindlessImageHandles. Only created for descriptors
+// without extension structures.
+struct ur_bindless_image_key_t {
+  ur_exp_image_mem_native_handle_t ImageMem;
+  ur_image_format_t Format;
+  ur_image_desc_t Desc;
+  // The sampler is part of the handle, so is compared by its description
+  bool Sampled;
+  ze_sampler_address_mode_t AddressMode;
+  ze_sampler_filter_mode_t FilterMode;
+  ze_bool_t IsNormalized;
+
+  bool operator==(const ur_bindless_image_key_t &Other) const {
+    return ImageMem == Other.ImageMem &&
+           Format.channelOrder == Other.Format.channelOrder &&
+           Format.channelType == Other.Format.channelType &&
+           Desc.type == Other.Desc.type && Desc.width == Other.Desc.width &&
+           Desc.height == Other.Desc.height &&
+           Desc.depth == Other.Desc.depth &&
+           Desc.arraySize == Other.Desc.arraySize &&
+           Desc.rowPitch == Other.Desc.rowPitch &&
+           Desc.slicePitch == Other.Desc.slicePitch &&
+           Desc.numMipLevel == Other.Desc.numMipLevel &&
+           Desc.numSamples == Other.Desc.numSamples &&
+           Sampled == Other.Sampled && AddressMode == Other.AddressMode &&
+           FilterMode == Other.FilterMode &&
+           IsNormalized == Other.IsNormalized;
+  }
+};
+
+struct ur_bindless_image_key_hash_t {
+  size_t operator()(const ur_bindless_image_key_t &Key) const {
+    return combine_hashes(0, Key.ImageMem, Key.Format.channelOrder,
+                          Key.Format.channelType, Key.Desc.type,
+                          Key.Desc.width, Key.Desc.height, Key.Desc.depth,
+                          Key.Desc.arraySize, Key.Desc.rowPitch,
+                          Key.Desc.slicePitch, Key.Sampled, Key.AddressMode,
+                          Key.FilterMode);
+  }
+};
+
 struct ur_device_handle_t_ : _ur_object {
   ur_device_handle_t_(ze_device_handle_t Device, ur_platform_handle_t Plt,
                       ur_device_handle_t ParentDevice = nullptr)
@@ -224,10 +268,39 @@ struct ur_device_handle_t_ : _ur_object {
   ZeCache<ZeStruct<ze_mutable_command_list_exp_properties_t>>
       ZeDeviceMutableCmdListsProperties;
 
+  // The profile measured by urinfo --characterize for this device and driver
+  // version, if UR_DEVICE_PROFILE_DIR has one, loaded by initialize.
+  std::optional<ur::device_profile_t> Profile;
+
+  // Cache of the results of urDeviceGetInfo, only the dynamic properties,
+  // e.g. the free memory, are queried every time.
+  UrDeviceInfoCache InfoCache;
+
+  // A bindless image handle, destroyed when its last reference is.
+  struct BindlessImageT {
+    ze_image_handle_t ZeImage;
+    uint32_t RefCount;
+    // Set if the handle is in BindlessImageHandles
+    std::optional<ur_bindless_image_key_t> Key;
+  };
+
   // Map device bindless image offset to corresponding host image handle.
-  std::unordered_map<ur_exp_image_native_handle_t, ze_image_handle_t>
+  std::unordered_map<ur_exp_image_native_handle_t, BindlessImageT>
       ZeOffsetToImageHandleMap;
 
+  // The bindless image handles by what they were created from, so that
+  // creating the same handle again only takes a reference on it.
+  std::unordered_map<ur_bindless_image_key_t, ur_exp_image_native_handle_t,
+                     ur_bindless_image_key_hash_t>
+      BindlessImageHandles;
+
+  // Protects ZeOffsetToImageHandleMap and BindlessImageHandles.
+  ur_mutex BindlessImagesMutex;
+
+  // Answers urDeviceGetGlobalTimestamps without calling the driver, when
+  // enabled.
+  ur::clock_calibration_t ClockCalibration;
+
   // unique ephemeral identifer of the device in the adapter
   std::optional<DeviceId> Id;
 };
@@ -13,11 +13,15 @@
 #include <mutex>
 #include <optional>
 #include <string.h>
+#include <thread>
+#include <unordered_set>
 
 #include "command_buffer.hpp"
 #include "common.hpp"
 #include "event.hpp"
+#include "latency_tracker.hpp"
 #include "logger/ur_logger.hpp"
+#include "ur_event_callbacks.hpp"
 #include "ur_interface_loader.hpp"
 #include "ur_level_zero.hpp"
 
@@ -29,7 +33,7 @@ void printZeEventList(const _ur_ze_event_list_t &UrZeEventList) {
     for (uint32_t I = 0; I < UrZeEventList.Length; I++) {
       ss << " " << ur_cast<std::uintptr_t>(UrZeEventList.ZeEventList[I]);
     }
-    logger::debug(ss.str().c_str());
+    logger::debug("{}", ss.str());
   }
 }
 
@@ -60,6 +64,56 @@ bool WaitListEmptyOrAllEventsFromSameQueue(
   return true;
 }
 
+// Returns the execution status of Event as urEventGetInfo reports it
+static ur_result_t getEventExecutionStatus(ur_event_handle_t Event,
+                                           ur_event_status_t &Status) {
+  // Check to see if the event's Queue has an open command list due to
+  // batching. If so, go ahead and close and submit it, because it is
+  // possible that this is trying to query some event's status that
+  // is part of the batch.  This isn't strictly required, but it seems
+  // like a reasonable thing to do.
+  auto UrQueue = Event->UrQueue;
+  if (UrQueue) {
+    // Lock automatically releases when this goes out of scope.
+    std::unique_lock<ur_shared_mutex> Lock(UrQueue->Mutex, std::try_to_lock);
+    // If we fail to acquire the lock, it's possible that the queue might
+    // already be waiting for this event in synchronize().
+    if (Lock.owns_lock()) {
+      const auto &OpenCommandList = UrQueue->eventOpenCommandList(Event);
+      if (OpenCommandList != UrQueue->CommandListMap.end()) {
+        UR_CALL(UrQueue->executeOpenCommandList(
+            OpenCommandList->second.isCopy(UrQueue)));
+      }
+    }
+  }
+
+  // Level Zero has a much more explicit notion of command submission than
+  // OpenCL. It doesn't happen unless the user submits a command list. We've
+  // done it just above so the status is at least PI_EVENT_SUBMITTED.
+  //
+  // NOTE: We currently cannot tell if command is currently running, so
+  // it will always show up "submitted" before it is finally "completed".
+  //
+  Status = UR_EVENT_STATUS_SUBMITTED;
+
+  // Make sure that we query a host-visible event only.
+  // If one wasn't yet created then don't create it here as well, and
+  // just conservatively return that event is not yet completed.
+  std::shared_lock<ur_shared_mutex> EventLock(Event->Mutex);
+  auto HostVisibleEvent = Event->HostVisibleEvent;
+  if (Event->Completed) {
+    Status = UR_EVENT_STATUS_COMPLETE;
+  } else if (HostVisibleEvent) {
+    ze_result_t ZeResult;
+    ZeResult =
+        ZE_CALL_NOCHECK(zeEventQueryStatus, (HostVisibleEvent->ZeEvent));
+    if (ZeResult == ZE_RESULT_SUCCESS) {
+      Status = UR_EVENT_STATUS_COMPLETE;
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 namespace ur::level_zero {
 
 ur_result_t urEnqueueEventsWait(
@@ -75,6 +129,8 @@ ur_result_t urEnqueueEventsWait(
         *OutEvent ///< [in,out][optional] return an event object that identifies
                   ///< this particular command instance.
 ) {
+  TRACK_SCOPE_LATENCY("urEnqueueEventsWait");
+  Queue->Telemetry.commandSubmitted(UR_COMMAND_EVENTS_WAIT);
   if (EventWaitList) {
     bool UseCopyEngine = false;
 
@@ -169,6 +225,7 @@ ur_result_t urEnqueueEventsWaitWithBarrier(
 ) {
   // Lock automatically releases when this goes out of scope.
   std::scoped_lock<ur_shared_mutex> lock(Queue->Mutex);
+  Queue->Telemetry.commandSubmitted(UR_COMMAND_EVENTS_WAIT_WITH_BARRIER);
 
   // Helper function for appending a barrier to a command list.
   auto insertBarrierIntoCmdList = [&Queue](ur_command_list_ptr_t CmdList,
@@ -439,51 +496,9 @@ ur_result_t urEventGetInfo(
     return ReturnValue(ur_cast<uint64_t>(Event->CommandType));
   }
   case UR_EVENT_INFO_COMMAND_EXECUTION_STATUS: {
-    // Check to see if the event's Queue has an open command list due to
-    // batching. If so, go ahead and close and submit it, because it is
-    // possible that this is trying to query some event's status that
-    // is part of the batch.  This isn't strictly required, but it seems
-    // like a reasonable thing to do.
-    auto UrQueue = Event->UrQueue;
-    if (UrQueue) {
-      // Lock automatically releases when this goes out of scope.
-      std::unique_lock<ur_shared_mutex> Lock(UrQueue->Mutex, std::try_to_lock);
-      // If we fail to acquire the lock, it's possible that the queue might
-      // already be waiting for this event in synchronize().
-      if (Lock.owns_lock()) {
-        const auto &OpenCommandList = UrQueue->eventOpenCommandList(Event);
-        if (OpenCommandList != UrQueue->CommandListMap.end()) {
-          UR_CALL(UrQueue->executeOpenCommandList(
-              OpenCommandList->second.isCopy(UrQueue)));
-        }
-      }
-    }
-
-    // Level Zero has a much more explicit notion of command submission than
-    // OpenCL. It doesn't happen unless the user submits a command list. We've
-    // done it just above so the status is at least PI_EVENT_SUBMITTED.
-    //
-    // NOTE: We currently cannot tell if command is currently running, so
-    // it will always show up "submitted" before it is finally "completed".
-    //
-    uint32_t Result = ur_cast<uint32_t>(UR_EVENT_STATUS_SUBMITTED);
-
-    // Make sure that we query a host-visible event only.
-    // If one wasn't yet created then don't create it here as well, and
-    // just conservatively return that event is not yet completed.
-    std::shared_lock<ur_shared_mutex> EventLock(Event->Mutex);
-    auto HostVisibleEvent = Event->HostVisibleEvent;
-    if (Event->Completed) {
-      Result = UR_EVENT_STATUS_COMPLETE;
-    } else if (HostVisibleEvent) {
-      ze_result_t ZeResult;
-      ZeResult =
-          ZE_CALL_NOCHECK(zeEventQueryStatus, (HostVisibleEvent->ZeEvent));
-      if (ZeResult == ZE_RESULT_SUCCESS) {
-        Result = UR_EVENT_STATUS_COMPLETE;
-      }
-    }
-    return ReturnValue(Result);
+    ur_event_status_t Status;
+    UR_CALL(getEventExecutionStatus(Event, Status));
+    return ReturnValue(ur_cast<uint32_t>(Status));
   }
   case UR_EVENT_INFO_REFERENCE_COUNT: {
     return ReturnValue(Event->RefCount.load());
@@ -508,7 +523,8 @@ ur_result_t urEventGetProfilingInfo(
     size_t *PropValueSizeRet ///< [out][optional] pointer to the actual size in
                              ///< bytes returned in propValue
 ) {
-  std::shared_lock<ur_shared_mutex> EventLock(Event->Mutex);
+  // Exclusive, since the timestamps read are cached on the event.
+  std::scoped_lock<ur_shared_mutex> EventLock(Event->Mutex);
 
   // The event must either have profiling enabled or be recording timestamps.
   bool isTimestampedEvent = Event->isTimestamped();
@@ -647,13 +663,13 @@ ur_result_t urEventGetProfilingInfo(
 
   switch (PropName) {
   case UR_PROFILING_INFO_COMMAND_START: {
-    ZE2UR_CALL(zeEventQueryKernelTimestamp, (Event->ZeEvent, &tsResult));
+    UR_CALL(Event->getKernelTimestamp(tsResult));
     uint64_t ContextStartTime =
         (tsResult.global.kernelStart & TimestampMaxValue) * ZeTimerResolution;
     return ReturnValue(ContextStartTime);
   }
   case UR_PROFILING_INFO_COMMAND_END: {
-    ZE2UR_CALL(zeEventQueryKernelTimestamp, (Event->ZeEvent, &tsResult));
+    UR_CALL(Event->getKernelTimestamp(tsResult));
 
     uint64_t ContextStartTime =
         (tsResult.global.kernelStart & TimestampMaxValue);
@@ -721,6 +737,7 @@ ur_result_t urEnqueueTimestampRecordingExp(
   UR_CALL(createEventAndAssociateQueue(
       Queue, OutEvent, UR_COMMAND_TIMESTAMP_RECORDING_EXP, CommandList,
       /* IsInternal */ false, /* HostVisible */ true));
+  Queue->Telemetry.commandSubmitted(UR_COMMAND_TIMESTAMP_RECORDING_EXP);
   ze_event_handle_t ZeEvent = (*OutEvent)->ZeEvent;
   (*OutEvent)->WaitList = TmpWaitList;
 
@@ -745,6 +762,63 @@ ur_result_t urEnqueueTimestampRecordingExp(
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t Queue,      ///< [in] handle of the queue object
+    uint32_t NumEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t
+        *EventWaitList, ///< [in][optional][range(0, numEventsInWaitList)]
+                        ///< pointer to a list of events that must be complete
+                        ///< before this command can be executed.
+    uint64_t *Marker    ///< [out][optional] number of the marker
+) {
+  // Lock automatically releases when this goes out of scope.
+  std::scoped_lock<ur_shared_mutex> lock(Queue->Mutex);
+  auto &Markers = Queue->TimestampMarkers;
+  if (!Markers)
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+
+  bool UseCopyEngine = false;
+  _ur_ze_event_list_t TmpWaitList;
+  UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
+      NumEventsInWaitList, EventWaitList, Queue, UseCopyEngine));
+
+  // Unlike the recordings, the markers are batched, nothing waiting for them
+  // but the reads finishing the queue.
+  ur_command_list_ptr_t CommandList{};
+  UR_CALL(Queue->Context->getAvailableCommandList(
+      Queue, CommandList, UseCopyEngine, NumEventsInWaitList, EventWaitList));
+
+  ur_event_handle_t InternalEvent;
+  UR_CALL(createEventAndAssociateQueue(
+      Queue, &InternalEvent, UR_COMMAND_TIMESTAMP_RECORDING_EXP, CommandList,
+      /* IsInternal */ true, /* IsMultiDevice */ false));
+  InternalEvent->WaitList = TmpWaitList;
+
+  uint64_t *Slot =
+      &Queue->TimestampMarkerSlots[Markers->slot(Markers->enqueued())];
+  ZE2UR_CALL(zeCommandListAppendWriteGlobalTimestamp,
+             (CommandList->first, Slot, InternalEvent->ZeEvent,
+              InternalEvent->WaitList.Length,
+              InternalEvent->WaitList.ZeEventList));
+  uint64_t Number = Markers->push();
+
+  UR_CALL(Queue->executeCommandList(CommandList, /* IsBlocking */ false,
+                                    /* OkToBatch */ true));
+  if (Marker)
+    *Marker = Number;
+  return UR_RESULT_SUCCESS;
+}
+
+// The callbacks of urEventSetCallback of all the events, see
+// ur_event_callbacks.hpp.
+static ur::event_callback_dispatcher_t &getEventCallbackDispatcher() {
+  static ur::event_callback_dispatcher_t Dispatcher{
+      ur::event_callback_dispatcher_t::statusQuery(urEventGetInfo),
+      [](ur_event_handle_t Event) { urEventRetain(Event); },
+      [](ur_event_handle_t Event) { urEventRelease(Event); }};
+  return Dispatcher;
+}
+
 ur_result_t
 urEventWait(uint32_t NumEvents, ///< [in] number of events in the event list
             const ur_event_handle_t
@@ -796,6 +870,9 @@ urEventWait(uint32_t NumEvents, ///< [in] number of events in the event list
 
           ze_event_handle_t ZeEvent = HostVisibleEvent->ZeEvent;
           logger::debug("ZeEvent = {}", ur_cast<std::uintptr_t>(ZeEvent));
+          std::optional<ur::queue_telemetry_t::wait_scope_t> WaitScope;
+          if (Event->UrQueue)
+            WaitScope.emplace(Event->UrQueue->Telemetry);
           // If this event was an inner batched event, then sync with
           // the Queue instead of waiting on the event.
           if (HostVisibleEvent->IsInnerBatchedEvent && Event->ZeBatchedQueue) {
@@ -833,6 +910,95 @@ urEventWait(uint32_t NumEvents, ///< [in] number of events in the event list
     resetCommandLists(Q);
   }
 
+  // The callbacks of the events have run once they are waited for.
+  getEventCallbackDispatcher().flush(NumEvents, EventWaitList);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEventWaitAnyExp(
+    uint32_t NumEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t
+        *EventWaitList,  ///< [in][range(0, numEvents)] pointer to a list of
+                         ///< events to wait for
+    uint32_t *EventIndex ///< [out] index in phEventWaitList of an event which
+                         ///< is complete
+) {
+  if (NumEvents == 1) {
+    *EventIndex = 0;
+    return ur::level_zero::urEventWait(1, EventWaitList);
+  }
+
+  // Make sure that the events can be queried from the host, and that the
+  // commands signalling them are submitted, as urEventWait does.
+  std::unordered_set<ur_queue_handle_t> Queues;
+  for (uint32_t I = 0; I < NumEvents; I++) {
+    ur_event_handle_t_ *Event = ur_cast<ur_event_handle_t_ *>(EventWaitList[I]);
+    auto UrQueue = Event->UrQueue;
+    if (!UrQueue) {
+      continue;
+    }
+    if (UrQueue->ZeEventsScope == OnDemandHostVisibleProxy) {
+      if (!Event->hasExternalRefs())
+        die("urEventWaitAnyExp must not be called for an internal event");
+
+      ze_event_handle_t ZeHostVisibleEvent;
+      if (auto Res = Event->getOrCreateHostVisibleEvent(ZeHostVisibleEvent))
+        return Res;
+    }
+    if (Queues.insert(UrQueue).second) {
+      std::scoped_lock<ur_shared_mutex> Lock(UrQueue->Mutex);
+      UR_CALL(UrQueue->executeAllOpenCommandLists());
+    }
+  }
+
+  // Level Zero can only block on one event at a time, so poll them all,
+  // yielding the CPU between the rounds.
+  for (;;) {
+    for (uint32_t I = 0; I < NumEvents; I++) {
+      ur_event_handle_t_ *Event =
+          ur_cast<ur_event_handle_t_ *>(EventWaitList[I]);
+      bool IsComplete = false;
+      {
+        std::shared_lock<ur_shared_mutex> EventLock(Event->Mutex);
+        auto HostVisibleEvent = Event->HostVisibleEvent;
+        if (Event->Completed) {
+          IsComplete = true;
+        } else if (HostVisibleEvent) {
+          // An inner batched event is only signalled along with the batch
+          auto ZeResult =
+              HostVisibleEvent->IsInnerBatchedEvent && Event->ZeBatchedQueue
+                  ? ZE_CALL_NOCHECK(zeCommandQueueSynchronize,
+                                    (Event->ZeBatchedQueue, 0))
+                  : ZE_CALL_NOCHECK(zeEventQueryStatus,
+                                    (HostVisibleEvent->ZeEvent));
+          if (ZeResult != ZE_RESULT_SUCCESS &&
+              ZeResult != ZE_RESULT_NOT_READY) {
+            return ze2urResult(ZeResult);
+          }
+          IsComplete = ZeResult == ZE_RESULT_SUCCESS;
+        }
+      }
+      if (IsComplete) {
+        *EventIndex = I;
+        // Returns right away, and cleans up after the event
+        return ur::level_zero::urEventWait(1, &EventWaitList[I]);
+      }
+    }
+    std::this_thread::yield();
+  }
+}
+
+ur_result_t urEventGetExecutionStatusExp(
+    uint32_t NumEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t
+        *Events, ///< [in][range(0, numEvents)] pointer to a list of events to
+                 ///< query
+    ur_event_status_t *Statuses ///< [out][range(0, numEvents)] execution
+                                ///< status of each of the events of phEvents
+) {
+  for (uint32_t I = 0; I < NumEvents; I++) {
+    UR_CALL(getEventExecutionStatus(Events[I], Statuses[I]));
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -949,13 +1115,14 @@ ur_result_t urEventSetCallback(
     void *UserData ///< [in][out][optional] pointer to data to be passed to
                    ///< callback.
 ) {
-  std::ignore = Event;
-  std::ignore = ExecStatus;
-  std::ignore = Notify;
-  std::ignore = UserData;
-  logger::error(logger::LegacyMessage("[UR][L0] {} function not implemented!"),
-                "{} function not implemented!", __FUNCTION__);
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  try {
+    getEventCallbackDispatcher().add(Event, ExecStatus, Notify, UserData);
+  } catch (const std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    return UR_RESULT_ERROR_UNKNOWN;
+  }
+  return UR_RESULT_SUCCESS;
 }
 
 } // namespace ur::level_zero
@@ -1161,23 +1328,10 @@ ur_result_t CleanupCompletedEvent(ur_event_handle_t Event, bool QueueLocked,
     if (IndirectAccessTrackingEnabled) {
       // urKernelRelease is called by CleanupCompletedEvent(Event) as soon as
       // kernel execution has finished. This is the place where we need to
-      // release memory allocations. If kernel is not in use (not submitted by
-      // some other thread) then release referenced memory allocations. As a
+      // release memory allocations freed while the kernel was in flight. As a
       // result, memory can be deallocated and context can be removed from
-      // container in the platform. That's why we need to lock a mutex here.
-      ur_platform_handle_t Plt = Kernel->Program->Context->getPlatform();
-      std::scoped_lock<ur_shared_mutex> ContextsLock(Plt->ContextsMutex);
-
-      if (--Kernel->SubmissionsCount == 0) {
-        // Kernel is not submitted for execution, release referenced memory
-        // allocations.
-        for (auto &MemAlloc : Kernel->MemAllocs) {
-          // std::pair<void *const, MemAllocRecord> *, Hash
-          USMFreeHelper(MemAlloc->second.Context, MemAlloc->first,
-                        MemAlloc->second.OwnNativeHandle);
-        }
-        Kernel->MemAllocs.clear();
-      }
+      // container in the platform, so this locks the mutex of the contexts.
+      USMReleaseIndirectAccesses(Kernel);
     }
   };
 
@@ -1335,6 +1489,8 @@ ur_result_t ur_event_handle_t_::reset() {
   RefCount.reset();
   CommandList = std::nullopt;
   completionBatch = std::nullopt;
+  KernelTimestamp = std::nullopt;
+  BatchedKernelTimestamp = nullptr;
 
   if (!isHostVisible())
     HostVisibleEvent = nullptr;
@@ -1660,6 +1816,26 @@ ur_result_t _ur_ze_event_list_t::collectEventsForReleaseAndDestroyUrZeEventList(
 }
 
 // Tells if this event is with profiling capabilities.
+ur_result_t
+ur_event_handle_t_::getKernelTimestamp(ze_kernel_timestamp_result_t &Result) {
+  if (!KernelTimestamp) {
+    auto *Batched = BatchedKernelTimestamp.get();
+    if (Batched && Batched->global.kernelStart != KernelTimestampNotWritten &&
+        Batched->global.kernelEnd != KernelTimestampNotWritten) {
+      KernelTimestamp = *Batched;
+    } else {
+      // Fails with ZE_RESULT_NOT_READY until the event is signalled, so that
+      // only final timestamps are cached.
+      ze_kernel_timestamp_result_t ZeTimestamp;
+      ZE2UR_CALL(zeEventQueryKernelTimestamp, (ZeEvent, &ZeTimestamp));
+      KernelTimestamp = ZeTimestamp;
+    }
+    BatchedKernelTimestamp = nullptr;
+  }
+  Result = *KernelTimestamp;
+  return UR_RESULT_SUCCESS;
+}
+
 bool ur_event_handle_t_::isProfilingEnabled() const {
   return !UrQueue || // tentatively assume user events are profiling enabled
          (UrQueue->Properties & UR_QUEUE_FLAG_PROFILING_ENABLE) != 0;
@@ -215,6 +215,19 @@ struct ur_event_handle_t_ : _ur_object {
   uint64_t RecordEventStartTimestamp = 0;
   uint64_t RecordEventEndTimestamp = 0;
 
+  // The kernel timestamps of a profiled event, cached once they were read so
+  // that the start and end of the command don't query the driver again.
+  std::optional<ze_kernel_timestamp_result_t> KernelTimestamp;
+  // If UrL0BatchKernelTimestamps, where the query appended to the batch of the
+  // event writes its kernel timestamps, in a buffer shared by the events of
+  // the batch. Filled with KernelTimestampNotWritten until then.
+  std::shared_ptr<ze_kernel_timestamp_result_t> BatchedKernelTimestamp;
+  static constexpr uint64_t KernelTimestampNotWritten = UINT64_MAX;
+
+  // Reads the kernel timestamps of the event, from the cache, the batch
+  // buffer or the driver.
+  ur_result_t getKernelTimestamp(ze_kernel_timestamp_result_t &Result);
+
   // Besides each PI object keeping a total reference count in
   // _ur_object::RefCount we keep special track of the event *external*
   // references. This way we are able to tell when the event is not referenced
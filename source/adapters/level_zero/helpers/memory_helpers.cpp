@@ -11,6 +11,8 @@
 #include "memory_helpers.hpp"
 #include "../common.hpp"
 
+#include <algorithm>
+
 ze_memory_type_t getMemoryType(ze_context_handle_t hContext, void *ptr) {
   // TODO: use UMF once
   // https://github.com/oneapi-src/unified-memory-framework/issues/687 is
@@ -23,11 +25,68 @@ ze_memory_type_t getMemoryType(ze_context_handle_t hContext, void *ptr) {
 
 bool maybeImportUSM(ze_driver_handle_t hTranslatedDriver,
                     ze_context_handle_t hContext, void *ptr, size_t size) {
-  if (ZeUSMImport.Enabled && ptr != nullptr &&
-      getMemoryType(hContext, ptr) == ZE_MEMORY_TYPE_UNKNOWN) {
-    // Promote the host ptr to USM host memory
-    ZeUSMImport.doZeUSMImport(hTranslatedDriver, ptr, size);
+  if (!ZeUSMImport.Enabled || ptr == nullptr)
+    return false;
+  // Reuse the import of the same host memory, e.g. by a previous buffer
+  if (ZeUSMImport.retainImportedHostPtr(hTranslatedDriver, ptr, size))
     return true;
+  if (getMemoryType(hContext, ptr) == ZE_MEMORY_TYPE_UNKNOWN) {
+    // Promote the host ptr to USM host memory
+    return ZeUSMImport.importHostPtr(hTranslatedDriver, ptr, size) ==
+           ZE_RESULT_SUCCESS;
   }
   return false;
 }
+
+ur_result_t appendMemoryCopy2D(ze_command_list_handle_t zeCommandList,
+                               void *pDst, size_t dstPitch, const void *pSrc,
+                               size_t srcPitch, size_t width, size_t height,
+                               ze_event_handle_t zeSignalEvent,
+                               uint32_t numWaitEvents,
+                               ze_event_handle_t *phWaitEvents) {
+  const ze_copy_region_t zeRegion = {0, 0, 0, ur_cast<uint32_t>(width),
+                                     ur_cast<uint32_t>(height), 1};
+  ZE2UR_CALL(zeCommandListAppendMemoryCopyRegion,
+             (zeCommandList, pDst, &zeRegion, ur_cast<uint32_t>(dstPitch),
+              ur_cast<uint32_t>(dstPitch * height), pSrc, &zeRegion,
+              ur_cast<uint32_t>(srcPitch), ur_cast<uint32_t>(srcPitch * height),
+              zeSignalEvent, numWaitEvents, phWaitEvents));
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t appendMemoryFill2D(ze_command_list_handle_t zeCommandList,
+                               void *pMem, size_t pitch, const void *pPattern,
+                               size_t patternSize, size_t width, size_t height,
+                               ze_event_handle_t zeSignalEvent,
+                               uint32_t numWaitEvents,
+                               ze_event_handle_t *phWaitEvents) {
+  if (width == 0 || height == 0) {
+    ZE2UR_CALL(zeCommandListAppendBarrier,
+               (zeCommandList, zeSignalEvent, numWaitEvents, phWaitEvents));
+    return UR_RESULT_SUCCESS;
+  }
+
+  // Contiguous rows are a single fill
+  if (pitch == width || height == 1) {
+    ZE2UR_CALL(zeCommandListAppendMemoryFill,
+               (zeCommandList, pMem, pPattern, patternSize, width * height,
+                zeSignalEvent, numWaitEvents, phWaitEvents));
+    return UR_RESULT_SUCCESS;
+  }
+
+  ZE2UR_CALL(zeCommandListAppendMemoryFill,
+             (zeCommandList, pMem, pPattern, patternSize, width, nullptr,
+              numWaitEvents, phWaitEvents));
+
+  // Rows [0, filled) are copied to [filled, 2 * filled), which don't overlap
+  auto pRows = static_cast<char *>(pMem);
+  for (size_t filled = 1; filled < height;) {
+    size_t rows = std::min(filled, height - filled);
+    bool last = filled + rows == height;
+    UR_CALL(appendMemoryCopy2D(zeCommandList, pRows + filled * pitch, pitch,
+                               pRows, pitch, width, rows,
+                               last ? zeSignalEvent : nullptr, 0, nullptr));
+    filled += rows;
+  }
+  return UR_RESULT_SUCCESS;
+}
@@ -21,3 +21,24 @@ bool maybeImportUSM(ze_driver_handle_t hTranslatedDriver,
                     ze_context_handle_t hContext, void *ptr, size_t size);
 
 ze_memory_type_t getMemoryType(ze_context_handle_t hContext, void *ptr);
+
+// Appends the copy of height rows of width bytes, which are srcPitch bytes
+// apart in pSrc and dstPitch bytes apart in pDst, as a single region copy.
+ur_result_t appendMemoryCopy2D(ze_command_list_handle_t zeCommandList,
+                               void *pDst, size_t dstPitch, const void *pSrc,
+                               size_t srcPitch, size_t width, size_t height,
+                               ze_event_handle_t zeSignalEvent,
+                               uint32_t numWaitEvents,
+                               ze_event_handle_t *phWaitEvents);
+
+// Appends the fill of height rows of width bytes of pMem, pitch bytes apart,
+// with the pattern. Without a 2D fill in Level Zero, the first row is filled
+// and then copied over the next ones, doubling the rows filled with each
+// copy, so that it takes 1 + log2(height) commands instead of one per row.
+// The command list must be in-order.
+ur_result_t appendMemoryFill2D(ze_command_list_handle_t zeCommandList,
+                               void *pMem, size_t pitch, const void *pPattern,
+                               size_t patternSize, size_t width, size_t height,
+                               ze_event_handle_t zeSignalEvent,
+                               uint32_t numWaitEvents,
+                               ze_event_handle_t *phWaitEvents);
@@ -0,0 +1,184 @@
+//===--------- module_cache.cpp - Level Zero Adapter ---------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "module_cache.hpp"
+#include "../device.hpp"
+#include "../platform.hpp"
+#include "../program.hpp"
+
+#include <algorithm>
+#include <list>
+#include <mutex>
+
+#include "logger/ur_logger.hpp"
+#include "ur_binary_cache.hpp"
+#include "ur_util.hpp"
+
+// The magic identifies cache entries, and their format.
+static const ur::binary_cache_t &getModuleCache() {
+  static const ur::binary_cache_t Cache(
+      "level_zero", "UR_L0_MODULE_CACHE_DIR",
+      {'U', 'R', 'Z', 'E', 'M', 'O', 'D', '2'});
+  return Cache;
+}
+
+static const size_t ReusableModulesSize = [] {
+  return getenv_to_unsigned("UR_L0_MODULE_REUSE_CACHE_SIZE").value_or(0);
+}();
+
+// Adds the IL of hProgram, BuildFlags and the specialization constants of
+// hProgram to Hash.
+static void hashProgram(ur::binary_hash_t &Hash, ur_program_handle_t hProgram,
+                        const std::string &BuildFlags) {
+  Hash.addField(hProgram->Code, hProgram->CodeLength);
+  Hash.addField(BuildFlags);
+
+  // The values of the specialization constants, by increasing ids.
+  std::vector<uint32_t> SpecIds;
+  for (auto &SpecConstant : hProgram->SpecConstants)
+    SpecIds.push_back(SpecConstant.first);
+  std::sort(SpecIds.begin(), SpecIds.end());
+  for (auto SpecId : SpecIds) {
+    Hash.addField(&SpecId, sizeof(SpecId));
+    auto Size = hProgram->SpecConstantSizes[SpecId];
+    Hash.addField(hProgram->SpecConstants[SpecId], Size);
+  }
+}
+
+// The binaries are only valid for the device and the driver they were built
+// with.
+static void hashDevice(ur::binary_hash_t &Hash, ur_device_handle_t hDevice) {
+  auto &DeviceProperties = hDevice->ZeDeviceProperties;
+  Hash.addField(&DeviceProperties->vendorId,
+                sizeof(DeviceProperties->vendorId));
+  Hash.addField(&DeviceProperties->deviceId,
+                sizeof(DeviceProperties->deviceId));
+  Hash.addField(DeviceProperties->uuid.id, sizeof(DeviceProperties->uuid.id));
+  Hash.addField(hDevice->Platform->ZeDriverVersion);
+}
+
+std::string getModuleCacheKey(ur_program_handle_t hProgram,
+                              ur_device_handle_t hDevice,
+                              const std::string &BuildFlags) {
+  if (!getModuleCache().enabled() && !ReusableModulesSize)
+    return {};
+
+  ur::binary_hash_t Hash;
+  hashProgram(Hash, hProgram, BuildFlags);
+  hashDevice(Hash, hDevice);
+  return Hash.str();
+}
+
+std::string getLinkedModuleCacheKey(const ur_program_handle_t *phPrograms,
+                                    uint32_t Count,
+                                    ur_device_handle_t hDevice,
+                                    const std::string &LinkFlags) {
+  if (!getModuleCache().enabled() && !ReusableModulesSize)
+    return {};
+
+  // Tells the linked modules apart from the module built from the same IL
+  // and flags.
+  ur::binary_hash_t Hash;
+  Hash.addField(std::string("link"));
+  Hash.addField(&Count, sizeof(Count));
+  for (uint32_t I = 0; I < Count; I++)
+    hashProgram(Hash, phPrograms[I], phPrograms[I]->BuildFlags);
+  Hash.addField(LinkFlags);
+  hashDevice(Hash, hDevice);
+  return Hash.str();
+}
+
+bool loadCachedModule(const std::string &Key, ur::cached_binary_t &Binary) {
+  return getModuleCache().load(Key, Binary);
+}
+
+void storeCachedModule(const std::string &Key, ze_module_handle_t ZeModule) {
+  if (Key.empty() || !getModuleCache().enabled())
+    return;
+
+  size_t Size = 0;
+  if (ZE_CALL_NOCHECK(zeModuleGetNativeBinary, (ZeModule, &Size, nullptr)))
+    return;
+  std::vector<uint8_t> Binary(Size);
+  if (ZE_CALL_NOCHECK(zeModuleGetNativeBinary,
+                      (ZeModule, &Size, Binary.data())))
+    return;
+  getModuleCache().store(Key, Binary.data(), Size);
+}
+
+namespace {
+struct reusable_module_t {
+  ze_context_handle_t ZeContext;
+  std::string Key;
+  ze_module_handle_t ZeModule;
+};
+
+// Most recently kept first.
+struct reusable_modules_t {
+  std::mutex Mutex;
+  std::list<reusable_module_t> Modules;
+};
+
+reusable_modules_t &getReusableModules() {
+  static reusable_modules_t ReusableModules;
+  return ReusableModules;
+}
+} // namespace
+
+ze_module_handle_t takeReusableModule(ze_context_handle_t ZeContext,
+                                      const std::string &Key) {
+  if (Key.empty() || !ReusableModulesSize)
+    return nullptr;
+
+  auto &ReusableModules = getReusableModules();
+  std::scoped_lock<std::mutex> Lock(ReusableModules.Mutex);
+  auto &Modules = ReusableModules.Modules;
+  auto It = std::find_if(Modules.begin(), Modules.end(), [&](auto &Module) {
+    return Module.ZeContext == ZeContext && Module.Key == Key;
+  });
+  if (It == Modules.end())
+    return nullptr;
+
+  auto ZeModule = It->ZeModule;
+  Modules.erase(It);
+  logger::debug("module cache: reusing module {} for {}", (void *)ZeModule,
+                Key);
+  return ZeModule;
+}
+
+bool keepReusableModule(ze_context_handle_t ZeContext, const std::string &Key,
+                        ze_module_handle_t ZeModule) {
+  if (Key.empty() || !ReusableModulesSize)
+    return false;
+
+  auto &ReusableModules = getReusableModules();
+  std::scoped_lock<std::mutex> Lock(ReusableModules.Mutex);
+  auto &Modules = ReusableModules.Modules;
+  Modules.push_front({ZeContext, Key, ZeModule});
+  if (Modules.size() > ReusableModulesSize) {
+    ZE_CALL_NOCHECK(zeModuleDestroy, (Modules.back().ZeModule));
+    Modules.pop_back();
+  }
+  return true;
+}
+
+void destroyReusableModules(ze_context_handle_t ZeContext) {
+  if (!ReusableModulesSize)
+    return;
+
+  auto &ReusableModules = getReusableModules();
+  std::scoped_lock<std::mutex> Lock(ReusableModules.Mutex);
+  ReusableModules.Modules.remove_if([ZeContext](auto &Module) {
+    if (Module.ZeContext != ZeContext)
+      return false;
+    ZE_CALL_NOCHECK(zeModuleDestroy, (Module.ZeModule));
+    return true;
+  });
+}
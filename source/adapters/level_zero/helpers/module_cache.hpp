@@ -0,0 +1,63 @@
+//===--------- module_cache.hpp - Level Zero Adapter ---------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ur_api.h>
+#include <ze_api.h>
+
+#include "ur_binary_cache.hpp"
+
+// A persistent cache of the native binaries of the modules built from IL, in
+// the program cache of ur_binary_cache.hpp, or in the directory
+// UR_L0_MODULE_CACHE_DIR if it is set.
+
+// Returns the key of the module built for hDevice from the IL of hProgram,
+// with BuildFlags and the specialization constants of hProgram. The key is
+// empty if both this cache and the reusable modules below are disabled.
+std::string getModuleCacheKey(ur_program_handle_t hProgram,
+                              ur_device_handle_t hDevice,
+                              const std::string &BuildFlags);
+
+// Returns the key of the module linked for hDevice from the IL of the Count
+// programs of phPrograms, in this order, with their compile flags and
+// specialization constants, and with LinkFlags. The key is empty if both this
+// cache and the reusable modules below are disabled.
+std::string getLinkedModuleCacheKey(const ur_program_handle_t *phPrograms,
+                                    uint32_t Count,
+                                    ur_device_handle_t hDevice,
+                                    const std::string &LinkFlags);
+
+// Maps the native binary cached for Key, returns false if there is none.
+bool loadCachedModule(const std::string &Key, ur::cached_binary_t &Binary);
+
+// Caches the native binary of ZeModule for Key, errors are only logged.
+void storeCachedModule(const std::string &Key, ze_module_handle_t ZeModule);
+
+// The modules of the released programs, kept to be reused by the next program
+// built from the same input in the same context, e.g. when switching between
+// sets of specialization constants. UR_L0_MODULE_REUSE_CACHE_SIZE modules are
+// kept at most, 0 (the default) disables it. A reused module is only used by
+// one program at a time, but its device globals keep their values.
+
+// Takes the module kept for Key in ZeContext, nullptr if there is none.
+ze_module_handle_t takeReusableModule(ze_context_handle_t ZeContext,
+                                      const std::string &Key);
+
+// Keeps ZeModule, built for Key, to be reused. Returns false if it isn't
+// kept, in which case the caller destroys it.
+bool keepReusableModule(ze_context_handle_t ZeContext, const std::string &Key,
+                        ze_module_handle_t ZeModule);
+
+// Destroys the modules kept for ZeContext, before it is destroyed.
+void destroyReusableModules(ze_context_handle_t ZeContext);
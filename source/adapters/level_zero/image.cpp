@@ -487,6 +487,25 @@ ur_result_t bindlessImagesCreateImpl(ur_context_handle_t hContext,
     BindlessDesc.flags |= ZE_IMAGE_BINDLESS_EXP_FLAG_SAMPLED_IMAGE;
   }
 
+  // Apps may create the handles of the same images every frame
+  std::optional<ur_bindless_image_key_t> Key;
+  if (!pImageDesc->pNext && !(hSampler && ZeSamplerDesc.pNext)) {
+    Key = ur_bindless_image_key_t{hImageMem,
+                                  *pImageFormat,
+                                  *pImageDesc,
+                                  hSampler != nullptr,
+                                  ZeSamplerDesc.addressMode,
+                                  ZeSamplerDesc.filterMode,
+                                  ZeSamplerDesc.isNormalized};
+    std::scoped_lock<ur_mutex> ImagesLock(hDevice->BindlessImagesMutex);
+    auto It = hDevice->BindlessImageHandles.find(*Key);
+    if (It != hDevice->BindlessImageHandles.end()) {
+      hDevice->ZeOffsetToImageHandleMap[It->second].RefCount++;
+      *phImage = It->second;
+      return UR_RESULT_SUCCESS;
+    }
+  }
+
   ze_image_handle_t ZeImage;
 
   ze_memory_allocation_properties_t MemAllocProperties{
@@ -543,7 +562,13 @@ ur_result_t bindlessImagesCreateImpl(ur_context_handle_t hContext,
              (ZeImageTranslated, &DeviceOffset));
   *phImage = DeviceOffset;
 
-  hDevice->ZeOffsetToImageHandleMap[*phImage] = ZeImage;
+  std::scoped_lock<ur_mutex> ImagesLock(hDevice->BindlessImagesMutex);
+  // Another thread may have created the same handle in the meantime, this
+  // one is then only destroyed with its own reference
+  if (Key && !hDevice->BindlessImageHandles.emplace(*Key, *phImage).second) {
+    Key.reset();
+  }
+  hDevice->ZeOffsetToImageHandleMap[*phImage] = {ZeImage, 1, Key};
 
   return UR_RESULT_SUCCESS;
 }
@@ -729,10 +754,18 @@ ur_result_t urBindlessImagesUnsampledImageHandleDestroyExp(
     ur_exp_image_native_handle_t hImage) {
   UR_ASSERT(hContext && hDevice && hImage, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
+  std::scoped_lock<ur_mutex> ImagesLock(hDevice->BindlessImagesMutex);
   auto item = hDevice->ZeOffsetToImageHandleMap.find(hImage);
 
   if (item != hDevice->ZeOffsetToImageHandleMap.end()) {
-    ZE2UR_CALL(zeImageDestroy, (item->second));
+    auto &Image = item->second;
+    if (--Image.RefCount > 0) {
+      return UR_RESULT_SUCCESS;
+    }
+    if (Image.Key) {
+      hDevice->BindlessImageHandles.erase(*Image.Key);
+    }
+    ZE2UR_CALL(zeImageDestroy, (Image.ZeImage));
     hDevice->ZeOffsetToImageHandleMap.erase(item);
   } else {
     return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
@@ -784,7 +817,20 @@ urBindlessImagesImageFreeExp(ur_context_handle_t hContext,
                              ur_device_handle_t hDevice,
                              ur_exp_image_mem_native_handle_t hImageMem) {
   std::ignore = hContext;
-  std::ignore = hDevice;
+  {
+    // The handles of the image aren't handed out again, as a new image may
+    // reuse its address
+    std::scoped_lock<ur_mutex> ImagesLock(hDevice->BindlessImagesMutex);
+    for (auto It = hDevice->BindlessImageHandles.begin();
+         It != hDevice->BindlessImageHandles.end();) {
+      if (It->first.ImageMem == hImageMem) {
+        hDevice->ZeOffsetToImageHandleMap[It->second].Key.reset();
+        It = hDevice->BindlessImageHandles.erase(It);
+      } else {
+        ++It;
+      }
+    }
+  }
   UR_CALL(ur::level_zero::urMemRelease(
       reinterpret_cast<ur_mem_handle_t>(hImageMem)));
   return UR_RESULT_SUCCESS;
@@ -861,6 +907,7 @@ ur_result_t urBindlessImagesImageCopyExp(
   UR_CALL(createEventAndAssociateQueue(hQueue, Event, UR_COMMAND_MEM_IMAGE_COPY,
                                        CommandList, IsInternal,
                                        /*IsMultiDevice*/ false));
+  hQueue->Telemetry.commandSubmitted(UR_COMMAND_MEM_IMAGE_COPY);
   UR_CALL(setSignalEvent(hQueue, UseCopyEngine, &ZeEvent, Event,
                          numEventsInWaitList, phEventWaitList,
                          CommandList->second.ZeQueue));
@@ -8,7 +8,10 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+
 #include "kernel.hpp"
+#include "latency_tracker.hpp"
 #include "logger/ur_logger.hpp"
 #include "ur_api.h"
 #include "ur_interface_loader.hpp"
@@ -31,70 +34,31 @@ ur_result_t getZeKernel(ze_device_handle_t hDevice, ur_kernel_handle_t hKernel,
   return UR_RESULT_SUCCESS;
 }
 
-namespace ur::level_zero {
-
-ur_result_t urKernelGetSuggestedLocalWorkSize(
-    ur_kernel_handle_t hKernel, ur_queue_handle_t hQueue, uint32_t workDim,
-    [[maybe_unused]] const size_t *pGlobalWorkOffset,
-    const size_t *pGlobalWorkSize, size_t *pSuggestedLocalWorkSize) {
-  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
-  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
-  UR_ASSERT(pSuggestedLocalWorkSize != nullptr,
-            UR_RESULT_ERROR_INVALID_NULL_POINTER);
-
-  uint32_t LocalWorkSize[3];
-  size_t GlobalWorkSize3D[3]{1, 1, 1};
-  std::copy(pGlobalWorkSize, pGlobalWorkSize + workDim, GlobalWorkSize3D);
-
-  ze_kernel_handle_t ZeKernel{};
-  UR_CALL(getZeKernel(hQueue->Device->ZeDevice, hKernel, &ZeKernel));
-
-  UR_CALL(getSuggestedLocalWorkSize(hQueue->Device, ZeKernel, GlobalWorkSize3D,
-                                    LocalWorkSize));
-
-  std::copy(LocalWorkSize, LocalWorkSize + workDim, pSuggestedLocalWorkSize);
-  return UR_RESULT_SUCCESS;
+// Appends the prefetches of the shared USM allocations of the arguments of
+// Kernel to ZeCommandList, ahead of its launch. Must be called with the Mutex
+// of Kernel locked.
+static ur_result_t appendArgPrefetches(ur_kernel_handle_t Kernel,
+                                       ze_command_list_handle_t ZeCommandList) {
+  return Kernel->PrefetchArgs.forEachAllocation(
+      [&](const void *Ptr, size_t Size) -> ur_result_t {
+        ZE2UR_CALL(zeCommandListAppendMemoryPrefetch,
+                   (ZeCommandList, Ptr, Size));
+        return UR_RESULT_SUCCESS;
+      });
 }
 
-ur_result_t urEnqueueKernelLaunch(
-    ur_queue_handle_t Queue,   ///< [in] handle of the queue object
-    ur_kernel_handle_t Kernel, ///< [in] handle of the kernel object
-    uint32_t WorkDim, ///< [in] number of dimensions, from 1 to 3, to specify
-                      ///< the global and work-group work-items
-    const size_t
-        *GlobalWorkOffset, ///< [in] pointer to an array of workDim unsigned
-                           ///< values that specify the offset used to
-                           ///< calculate the global ID of a work-item
-    const size_t *GlobalWorkSize, ///< [in] pointer to an array of workDim
-                                  ///< unsigned values that specify the number
-                                  ///< of global work-items in workDim that
-                                  ///< will execute the kernel function
-    const size_t
-        *LocalWorkSize, ///< [in][optional] pointer to an array of workDim
-                        ///< unsigned values that specify the number of local
-                        ///< work-items forming a work-group that will execute
-                        ///< the kernel function. If nullptr, the runtime
-                        ///< implementation will choose the work-group size.
-    uint32_t NumEventsInWaitList, ///< [in] size of the event wait list
-    const ur_event_handle_t
-        *EventWaitList, ///< [in][optional][range(0, numEventsInWaitList)]
-                        ///< pointer to a list of events that must be complete
-                        ///< before the kernel execution. If nullptr, the
-                        ///< numEventsInWaitList must be 0, indicating that no
-                        ///< wait event.
-    ur_event_handle_t
-        *OutEvent ///< [in,out][optional] return an event object that identifies
-                  ///< this particular kernel execution instance.
-) {
-  UR_ASSERT(WorkDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
-  UR_ASSERT(WorkDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
-
-  ze_kernel_handle_t ZeKernel{};
-  UR_CALL(getZeKernel(Queue->Device->ZeDevice, Kernel, &ZeKernel));
+// Appends the launch of Kernel to a command list of Queue, with the mutexes
+// of the queue, the kernel and its program held by the caller.
+static ur_result_t enqueueKernelLaunchLocked(
+    ur_queue_handle_t Queue, ur_kernel_handle_t Kernel,
+    ze_kernel_handle_t ZeKernel, uint32_t WorkDim,
+    const size_t *GlobalWorkOffset, const size_t *GlobalWorkSize,
+    const size_t *LocalWorkSize, uint32_t NumEventsInWaitList,
+    const ur_event_handle_t *EventWaitList, ur_event_handle_t *OutEvent) {
+  // The allocations whose residency was deferred are made resident in one
+  // batch before they may be used by the kernel.
+  UR_CALL(Queue->Context->makePendingResident());
 
-  // Lock automatically releases when this goes out of scope.
-  std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
-      Queue->Mutex, Kernel->Mutex, Kernel->Program->Mutex);
   if (GlobalWorkOffset != NULL) {
     if (!Queue->Device->Platform->ZeDriverGlobalOffsetExtensionFound) {
       logger::error("No global offset extension found on this driver");
@@ -116,14 +80,22 @@ ur_result_t urEnqueueKernelLaunch(
                                         Queue->Device, EventWaitList,
                                         NumEventsInWaitList));
     }
-    ZE2UR_CALL(zeKernelSetArgumentValue,
-               (ZeKernel, Arg.Index, Arg.Size, ZeHandlePtr));
+    if (auto ZeResult =
+            Kernel->setArgument(ZeKernel, Arg.Index, Arg.Size, ZeHandlePtr))
+      return ze2urResult(ZeResult);
   }
   Kernel->PendingArguments.clear();
 
   ze_group_count_t ZeThreadGroupDimensions{1, 1, 1};
   uint32_t WG[3]{};
 
+  size_t SuggestedLocalWorkSize[3];
+  if (!LocalWorkSize) {
+    UR_CALL(Kernel->getSuggestedGroupSize(Queue->Device, Kernel->ZeKernel,
+                                          WorkDim, GlobalWorkSize,
+                                          SuggestedLocalWorkSize));
+    LocalWorkSize = SuggestedLocalWorkSize;
+  }
   UR_CALL(calculateKernelWorkDimensions(Kernel->ZeKernel, Queue->Device,
                                         ZeThreadGroupDimensions, WG, WorkDim,
                                         GlobalWorkSize, LocalWorkSize));
@@ -148,6 +120,7 @@ ur_result_t urEnqueueKernelLaunch(
 
   UR_CALL(createEventAndAssociateQueue(Queue, Event, UR_COMMAND_KERNEL_LAUNCH,
                                        CommandList, IsInternal, false));
+  Queue->Telemetry.commandSubmitted(UR_COMMAND_KERNEL_LAUNCH);
   UR_CALL(setSignalEvent(Queue, UseCopyEngine, &ZeEvent, Event,
                          NumEventsInWaitList, EventWaitList,
                          CommandList->second.ZeQueue));
@@ -167,6 +140,8 @@ ur_result_t urEnqueueKernelLaunch(
   if (IndirectAccessTrackingEnabled)
     Queue->KernelsToBeSubmitted.push_back(Kernel);
 
+  UR_CALL(appendArgPrefetches(Kernel, CommandList->first));
+
   if (Queue->UsingImmCmdLists && IndirectAccessTrackingEnabled) {
     // If using immediate commandlists then gathering of indirect
     // references and appending to the queue (which means submission)
@@ -207,6 +182,382 @@ ur_result_t urEnqueueKernelLaunch(
   return UR_RESULT_SUCCESS;
 }
 
+// Sets the argument of all the L0 kernels of Kernel, must be called with the
+// Mutex of Kernel locked.
+static ur_result_t setArgValueLocked(ur_kernel_handle_t Kernel,
+                                     uint32_t ArgIndex, size_t ArgSize,
+                                     const void *PArgValue) {
+  // OpenCL: "the arg_value pointer can be NULL or point to a NULL value
+  // in which case a NULL value will be used as the value for the argument
+  // declared as a pointer to global or constant memory in the kernel"
+  //
+  // We don't know the type of the argument but it seems that the only time
+  // SYCL RT would send a pointer to NULL in 'arg_value' is when the argument
+  // is a NULL pointer. Treat a pointer to NULL in 'arg_value' as a NULL.
+  if (ArgSize == sizeof(void *) && PArgValue &&
+      *(void **)(const_cast<void *>(PArgValue)) == nullptr) {
+    PArgValue = nullptr;
+  }
+
+  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+  }
+  Kernel->PrefetchArgs.clear(ArgIndex);
+
+  ze_result_t ZeResult = ZE_RESULT_SUCCESS;
+  if (Kernel->ZeKernelMap.empty()) {
+    auto ZeKernel = Kernel->ZeKernel;
+    ZeResult = Kernel->setArgument(ZeKernel, ArgIndex, ArgSize, PArgValue);
+  } else {
+    for (auto It : Kernel->ZeKernelMap) {
+      auto ZeKernel = It.second;
+      ZeResult = Kernel->setArgument(ZeKernel, ArgIndex, ArgSize, PArgValue);
+    }
+  }
+
+  if (ZeResult == ZE_RESULT_ERROR_INVALID_ARGUMENT) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
+  }
+
+  return ze2urResult(ZeResult);
+}
+
+// Sets the pointer argument, and keeps the shared USM allocation it points
+// into for prefetching with UR_USM_AUTO_PREFETCH. Must be called with the
+// Mutex of Kernel locked.
+static ur_result_t setArgPointerLocked(ur_kernel_handle_t Kernel,
+                                       uint32_t ArgIndex,
+                                       const void *ArgValue) {
+  // setArgValueLocked is expecting a pointer to the argument
+  UR_CALL(setArgValueLocked(Kernel, ArgIndex, sizeof(const void *),
+                            &ArgValue));
+  if (!ArgValue || !ur::usmAutoPrefetchEnabled() || !Kernel->Program) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  // Pointers which aren't to USM, e.g. to host memory, are of unknown type
+  ze_context_handle_t ZeContext = Kernel->Program->Context->ZeContext;
+  ZeStruct<ze_memory_allocation_properties_t> ZeMemoryAllocationProperties;
+  ze_device_handle_t ZeDevice = nullptr;
+  if (ZE_CALL_NOCHECK(zeMemGetAllocProperties,
+                      (ZeContext, ArgValue, &ZeMemoryAllocationProperties,
+                       &ZeDevice)) != ZE_RESULT_SUCCESS ||
+      ZeMemoryAllocationProperties.type != ZE_MEMORY_TYPE_SHARED) {
+    return UR_RESULT_SUCCESS;
+  }
+  void *Base = nullptr;
+  size_t Size = 0;
+  if (ZE_CALL_NOCHECK(zeMemGetAddressRange,
+                      (ZeContext, ArgValue, &Base, &Size)) ==
+      ZE_RESULT_SUCCESS) {
+    Kernel->PrefetchArgs.set(ArgIndex, Base, Size);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+// Must be called with the Mutex of Kernel locked.
+static ur_result_t setArgSamplerLocked(ur_kernel_handle_t Kernel,
+                                       uint32_t ArgIndex,
+                                       ur_sampler_handle_t ArgValue) {
+  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+  }
+  Kernel->PrefetchArgs.clear(ArgIndex);
+  if (auto ZeResult = Kernel->setArgument(Kernel->ZeKernel, ArgIndex,
+                                          sizeof(void *), &ArgValue->ZeSampler))
+    return ze2urResult(ZeResult);
+
+  return UR_RESULT_SUCCESS;
+}
+
+// Records the memory object argument, which is set on the L0 kernel at
+// launch once the memory is on the device. Must be called with the Mutex of
+// Kernel locked.
+static ur_result_t setArgMemObjLocked(ur_kernel_handle_t Kernel,
+                                      uint32_t ArgIndex,
+                                      ur_mem_flags_t MemoryAccess,
+                                      ur_mem_handle_t ArgValue) {
+  // The ArgValue may be a NULL pointer in which case a NULL value is used for
+  // the kernel argument declared as a pointer to global or constant memory.
+
+  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+  }
+  Kernel->PrefetchArgs.clear(ArgIndex);
+
+  ur_mem_handle_t_ *UrMem = ur_cast<ur_mem_handle_t_ *>(ArgValue);
+
+  ur_mem_handle_t_::access_mode_t UrAccessMode = ur_mem_handle_t_::read_write;
+  switch (MemoryAccess) {
+  case UR_MEM_FLAG_READ_WRITE:
+    UrAccessMode = ur_mem_handle_t_::read_write;
+    break;
+  case UR_MEM_FLAG_WRITE_ONLY:
+    UrAccessMode = ur_mem_handle_t_::write_only;
+    break;
+  case UR_MEM_FLAG_READ_ONLY:
+    UrAccessMode = ur_mem_handle_t_::read_only;
+    break;
+  default:
+    return UR_RESULT_ERROR_INVALID_ARGUMENT;
+  }
+  auto Arg = UrMem ? UrMem : nullptr;
+  // Setting the same argument again replaces the pending value.
+  auto It = std::find_if(
+      Kernel->PendingArguments.begin(), Kernel->PendingArguments.end(),
+      [ArgIndex](auto &Pending) { return Pending.Index == ArgIndex; });
+  if (It != Kernel->PendingArguments.end()) {
+    *It = {ArgIndex, sizeof(void *), Arg, UrAccessMode};
+  } else {
+    Kernel->PendingArguments.push_back(
+        {ArgIndex, sizeof(void *), Arg, UrAccessMode});
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+// Splits a 1D launch on a queue of a root device at work-group boundaries into
+// one launch per sub-device, with adjusted global offsets, and joins them with
+// one event of Queue (UR_L0_EXPLICIT_SCALING). Partitioned is left false if
+// the launch doesn't qualify, in which case nothing was enqueued.
+static ur_result_t enqueuePartitionedKernelLaunch(
+    ur_queue_handle_t Queue, ur_kernel_handle_t Kernel,
+    ze_kernel_handle_t ZeKernel, const size_t *GlobalWorkOffset,
+    const size_t *GlobalWorkSize, const size_t *LocalWorkSize,
+    uint32_t NumEventsInWaitList, const ur_event_handle_t *EventWaitList,
+    ur_event_handle_t *OutEvent, bool &Partitioned) {
+  Partitioned = false;
+  auto &SubDevices = Queue->Device->SubDevices;
+  // The arguments must resolve to the same memory on all the sub-devices,
+  // and all of them must launch the kernel handle the arguments are set on.
+  if (SubDevices.size() < 2 ||
+      Queue->Context->SingleRootDevice != Queue->Device ||
+      !Queue->Device->Platform->ZeDriverGlobalOffsetExtensionFound)
+    return UR_RESULT_SUCCESS;
+  for (auto SubDevice : SubDevices) {
+    ze_kernel_handle_t ZeSubDeviceKernel{};
+    if (getZeKernel(SubDevice->ZeDevice, Kernel, &ZeSubDeviceKernel) !=
+            UR_RESULT_SUCCESS ||
+        ZeSubDeviceKernel != ZeKernel)
+      return UR_RESULT_SUCCESS;
+  }
+
+  size_t GroupSize = 0;
+  if (LocalWorkSize) {
+    GroupSize = LocalWorkSize[0];
+  } else {
+    std::scoped_lock<ur_shared_mutex> Lock(Kernel->Mutex);
+    size_t SuggestedLocalWorkSize[3];
+    UR_CALL(Kernel->getSuggestedGroupSize(Queue->Device, ZeKernel, 1,
+                                          GlobalWorkSize,
+                                          SuggestedLocalWorkSize));
+    GroupSize = SuggestedLocalWorkSize[0];
+  }
+  if (GroupSize == 0 || GlobalWorkSize[0] % GroupSize != 0)
+    return UR_RESULT_SUCCESS;
+  size_t NumGroups = GlobalWorkSize[0] / GroupSize;
+  size_t NumParts = (std::min)(SubDevices.size(), NumGroups);
+  if (NumParts < 2)
+    return UR_RESULT_SUCCESS;
+
+  std::vector<ur_queue_handle_t> SubQueues;
+  UR_CALL(Queue->getSubDeviceQueues(SubQueues));
+  Partitioned = true;
+
+  // The launches of an in-order queue also wait for its previous commands.
+  ur_event_handle_t StartEvent = nullptr;
+  if (Queue->isInOrderQueue()) {
+    UR_CALL(ur::level_zero::urEnqueueEventsWait(Queue, NumEventsInWaitList,
+                                                EventWaitList, &StartEvent));
+    NumEventsInWaitList = 1;
+    EventWaitList = &StartEvent;
+  }
+
+  size_t BaseOffset = GlobalWorkOffset ? GlobalWorkOffset[0] : 0;
+  size_t FirstGroup = 0;
+  std::vector<ur_event_handle_t> PartEvents;
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  for (size_t I = 0; I < NumParts && Result == UR_RESULT_SUCCESS; I++) {
+    size_t PartGroups = NumGroups / NumParts + (I < NumGroups % NumParts);
+    size_t PartOffset[3] = {BaseOffset + FirstGroup * GroupSize, 0, 0};
+    size_t PartSize = PartGroups * GroupSize;
+    FirstGroup += PartGroups;
+
+    ur_event_handle_t PartEvent = nullptr;
+    std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
+        SubQueues[I]->Mutex, Kernel->Mutex, Kernel->Program->Mutex);
+    Result = enqueueKernelLaunchLocked(
+        SubQueues[I], Kernel, ZeKernel, 1, PartOffset, &PartSize, &GroupSize,
+        NumEventsInWaitList, EventWaitList, &PartEvent);
+    if (PartEvent)
+      PartEvents.push_back(PartEvent);
+  }
+  if (!GlobalWorkOffset) {
+    // The kernel keeps the offset for its next launches.
+    std::scoped_lock<ur_shared_mutex> Lock(Kernel->Mutex);
+    ZE2UR_CALL(zeKernelSetGlobalOffsetExp, (ZeKernel, 0, 0, 0));
+  }
+
+  // Joined even without OutEvent, so that the queue is done with the launch
+  // only once all its parts are.
+  if (Result == UR_RESULT_SUCCESS) {
+    Result = ur::level_zero::urEnqueueEventsWait(
+        Queue, static_cast<uint32_t>(PartEvents.size()), PartEvents.data(),
+        OutEvent);
+  }
+  if (Result == UR_RESULT_SUCCESS && OutEvent) {
+    std::scoped_lock<ur_shared_mutex> Lock((*OutEvent)->Mutex);
+    (*OutEvent)->CommandType = UR_COMMAND_KERNEL_LAUNCH;
+  }
+  for (ur_event_handle_t E : PartEvents)
+    UR_CALL(ur::level_zero::urEventRelease(E));
+  if (StartEvent)
+    UR_CALL(ur::level_zero::urEventRelease(StartEvent));
+  return Result;
+}
+
+namespace ur::level_zero {
+
+ur_result_t urKernelGetSuggestedLocalWorkSize(
+    ur_kernel_handle_t hKernel, ur_queue_handle_t hQueue, uint32_t workDim,
+    [[maybe_unused]] const size_t *pGlobalWorkOffset,
+    const size_t *pGlobalWorkSize, size_t *pSuggestedLocalWorkSize) {
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(pSuggestedLocalWorkSize != nullptr,
+            UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  size_t LocalWorkSize[3];
+
+  ze_kernel_handle_t ZeKernel{};
+  UR_CALL(getZeKernel(hQueue->Device->ZeDevice, hKernel, &ZeKernel));
+
+  std::scoped_lock<ur_shared_mutex> Guard(hKernel->Mutex);
+  UR_CALL(hKernel->getSuggestedGroupSize(hQueue->Device, ZeKernel, workDim,
+                                         pGlobalWorkSize, LocalWorkSize));
+
+  std::copy(LocalWorkSize, LocalWorkSize + workDim, pSuggestedLocalWorkSize);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEnqueueKernelLaunch(
+    ur_queue_handle_t Queue,   ///< [in] handle of the queue object
+    ur_kernel_handle_t Kernel, ///< [in] handle of the kernel object
+    uint32_t WorkDim, ///< [in] number of dimensions, from 1 to 3, to specify
+                      ///< the global and work-group work-items
+    const size_t
+        *GlobalWorkOffset, ///< [in] pointer to an array of workDim unsigned
+                           ///< values that specify the offset used to
+                           ///< calculate the global ID of a work-item
+    const size_t *GlobalWorkSize, ///< [in] pointer to an array of workDim
+                                  ///< unsigned values that specify the number
+                                  ///< of global work-items in workDim that
+                                  ///< will execute the kernel function
+    const size_t
+        *LocalWorkSize, ///< [in][optional] pointer to an array of workDim
+                        ///< unsigned values that specify the number of local
+                        ///< work-items forming a work-group that will execute
+                        ///< the kernel function. If nullptr, the runtime
+                        ///< implementation will choose the work-group size.
+    uint32_t NumEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t
+        *EventWaitList, ///< [in][optional][range(0, numEventsInWaitList)]
+                        ///< pointer to a list of events that must be complete
+                        ///< before the kernel execution. If nullptr, the
+                        ///< numEventsInWaitList must be 0, indicating that no
+                        ///< wait event.
+    ur_event_handle_t
+        *OutEvent ///< [in,out][optional] return an event object that identifies
+                  ///< this particular kernel execution instance.
+) {
+  TRACK_SCOPE_LATENCY("urEnqueueKernelLaunch");
+  UR_ASSERT(WorkDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(WorkDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+
+  ze_kernel_handle_t ZeKernel{};
+  UR_CALL(getZeKernel(Queue->Device->ZeDevice, Kernel, &ZeKernel));
+
+  if (UrL0ExplicitScaling && WorkDim == 1) {
+    bool Partitioned = false;
+    UR_CALL(enqueuePartitionedKernelLaunch(
+        Queue, Kernel, ZeKernel, GlobalWorkOffset, GlobalWorkSize,
+        LocalWorkSize, NumEventsInWaitList, EventWaitList, OutEvent,
+        Partitioned));
+    if (Partitioned)
+      return UR_RESULT_SUCCESS;
+  }
+
+  // Lock automatically releases when this goes out of scope.
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
+      Queue->Mutex, Kernel->Mutex, Kernel->Program->Mutex);
+  return enqueueKernelLaunchLocked(Queue, Kernel, ZeKernel, WorkDim,
+                                   GlobalWorkOffset, GlobalWorkSize,
+                                   LocalWorkSize, NumEventsInWaitList,
+                                   EventWaitList, OutEvent);
+}
+
+ur_result_t urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t Queue, uint32_t NumLaunches,
+    const ur_exp_kernel_launch_desc_t *Launches, uint32_t NumEventsInWaitList,
+    const ur_event_handle_t *EventWaitList, ur_event_handle_t *OutEvent) {
+  std::vector<ze_kernel_handle_t> ZeKernels(NumLaunches);
+  for (uint32_t I = 0; I < NumLaunches; I++) {
+    UR_ASSERT(Launches[I].hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+    UR_ASSERT(Launches[I].pGlobalWorkSize,
+              UR_RESULT_ERROR_INVALID_NULL_POINTER);
+    UR_ASSERT(Launches[I].workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+    UR_ASSERT(Launches[I].workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+    UR_CALL(getZeKernel(Queue->Device->ZeDevice, Launches[I].hKernel,
+                        &ZeKernels[I]));
+  }
+
+  // In an in-order queue only the first launch has to wait on the events and
+  // the event of the last launch completes after all of them. The launches of
+  // an out-of-order queue all wait on the events, and their events are joined
+  // once the queue is unlocked.
+  bool InOrder = Queue->isInOrderQueue();
+  std::vector<ur_event_handle_t> LaunchEvents;
+  {
+    std::scoped_lock<ur_shared_mutex> QueueLock(Queue->Mutex);
+    for (uint32_t I = 0; I < NumLaunches; I++) {
+      const ur_exp_kernel_launch_desc_t &Launch = Launches[I];
+      bool First = I == 0;
+      bool Last = I + 1 == NumLaunches;
+
+      ur_event_handle_t LaunchEvent = nullptr;
+      ur_event_handle_t *Event = nullptr;
+      if (OutEvent) {
+        Event = InOrder ? (Last ? OutEvent : nullptr) : &LaunchEvent;
+      }
+
+      std::scoped_lock<ur_shared_mutex, ur_shared_mutex> Lock(
+          Launch.hKernel->Mutex, Launch.hKernel->Program->Mutex);
+      ur_result_t Result = enqueueKernelLaunchLocked(
+          Queue, Launch.hKernel, ZeKernels[I], Launch.workDim,
+          Launch.pGlobalWorkOffset, Launch.pGlobalWorkSize,
+          Launch.pLocalWorkSize, InOrder && !First ? 0 : NumEventsInWaitList,
+          InOrder && !First ? nullptr : EventWaitList, Event);
+      if (Result != UR_RESULT_SUCCESS) {
+        for (ur_event_handle_t E : LaunchEvents)
+          UR_CALL(urEventRelease(E));
+        return Result;
+      }
+      if (LaunchEvent)
+        LaunchEvents.push_back(LaunchEvent);
+    }
+  }
+
+  if (LaunchEvents.empty())
+    return UR_RESULT_SUCCESS;
+
+  ur_result_t Result = urEnqueueEventsWait(
+      Queue, static_cast<uint32_t>(LaunchEvents.size()), LaunchEvents.data(),
+      OutEvent);
+  for (ur_event_handle_t E : LaunchEvents)
+    UR_CALL(urEventRelease(E));
+  return Result;
+}
+
 ur_result_t urEnqueueCooperativeKernelLaunchExp(
     ur_queue_handle_t Queue,   ///< [in] handle of the queue object
     ur_kernel_handle_t Kernel, ///< [in] handle of the kernel object
@@ -277,8 +628,9 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
                                         Queue->Device, EventWaitList,
                                         NumEventsInWaitList));
     }
-    ZE2UR_CALL(zeKernelSetArgumentValue,
-               (ZeKernel, Arg.Index, Arg.Size, ZeHandlePtr));
+    if (auto ZeResult =
+            Kernel->setArgument(ZeKernel, Arg.Index, Arg.Size, ZeHandlePtr))
+      return ze2urResult(ZeResult);
   }
   Kernel->PendingArguments.clear();
 
@@ -301,44 +653,12 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
     WG[1] = static_cast<uint32_t>(LocalWorkSize[1]);
     WG[2] = static_cast<uint32_t>(LocalWorkSize[2]);
   } else {
-    // We can't call to zeKernelSuggestGroupSize if 64-bit GlobalWorkSize
-    // values do not fit to 32-bit that the API only supports currently.
-    bool SuggestGroupSize = true;
-    for (int I : {0, 1, 2}) {
-      if (GlobalWorkSize3D[I] > UINT32_MAX) {
-        SuggestGroupSize = false;
-      }
-    }
-    if (SuggestGroupSize) {
-      ZE2UR_CALL(zeKernelSuggestGroupSize,
-                 (ZeKernel, GlobalWorkSize3D[0], GlobalWorkSize3D[1],
-                  GlobalWorkSize3D[2], &WG[0], &WG[1], &WG[2]));
-    } else {
-      for (int I : {0, 1, 2}) {
-        // Try to find a I-dimension WG size that the GlobalWorkSize[I] is
-        // fully divisable with. Start with the max possible size in
-        // each dimension.
-        uint32_t GroupSize[] = {
-            Queue->Device->ZeDeviceComputeProperties->maxGroupSizeX,
-            Queue->Device->ZeDeviceComputeProperties->maxGroupSizeY,
-            Queue->Device->ZeDeviceComputeProperties->maxGroupSizeZ};
-        GroupSize[I] = (std::min)(size_t(GroupSize[I]), GlobalWorkSize3D[I]);
-        while (GlobalWorkSize3D[I] % GroupSize[I]) {
-          --GroupSize[I];
-        }
-
-        if (GlobalWorkSize3D[I] / GroupSize[I] > UINT32_MAX) {
-          logger::error(
-              "urEnqueueCooperativeKernelLaunchExp: can't find a WG size "
-              "suitable for global work size > UINT32_MAX");
-          return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
-        }
-        WG[I] = GroupSize[I];
-      }
-      logger::debug("urEnqueueCooperativeKernelLaunchExp: using computed WG "
-                    "size = {{{}, {}, {}}}",
-                    WG[0], WG[1], WG[2]);
-    }
+    size_t SuggestedLocalWorkSize[3];
+    UR_CALL(Kernel->getSuggestedGroupSize(Queue->Device, ZeKernel, WorkDim,
+                                          GlobalWorkSize,
+                                          SuggestedLocalWorkSize));
+    for (int I : {0, 1, 2})
+      WG[I] = static_cast<uint32_t>(SuggestedLocalWorkSize[I]);
   }
 
   // TODO: assert if sizes do not fit into 32-bit?
@@ -413,6 +733,7 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
 
   UR_CALL(createEventAndAssociateQueue(Queue, Event, UR_COMMAND_KERNEL_LAUNCH,
                                        CommandList, IsInternal, false));
+  Queue->Telemetry.commandSubmitted(UR_COMMAND_KERNEL_LAUNCH);
   UR_CALL(setSignalEvent(Queue, UseCopyEngine, &ZeEvent, Event,
                          NumEventsInWaitList, EventWaitList,
                          CommandList->second.ZeQueue));
@@ -432,6 +753,8 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
   if (IndirectAccessTrackingEnabled)
     Queue->KernelsToBeSubmitted.push_back(Kernel);
 
+  UR_CALL(appendArgPrefetches(Kernel, CommandList->first));
+
   if (Queue->UsingImmCmdLists && IndirectAccessTrackingEnabled) {
     // If using immediate commandlists then gathering of indirect
     // references and appending to the queue (which means submission)
@@ -528,6 +851,7 @@ ur_result_t urEnqueueDeviceGlobalVariableWrite(
   // Temporary option added to use copy engine for D2D copy
   PreferCopyEngine |= UseCopyEngineForD2DCopy;
 
+  Queue->Telemetry.bytesCopied(ur::queue_telemetry_t::host_to_device, Count);
   return enqueueMemCopyHelper(UR_COMMAND_DEVICE_GLOBAL_VARIABLE_WRITE, Queue,
                               ur_cast<char *>(GlobalVarPtr) + Offset,
                               BlockingWrite, Count, Src, NumEventsInWaitList,
@@ -590,6 +914,7 @@ ur_result_t urEnqueueDeviceGlobalVariableRead(
   // Temporary option added to use copy engine for D2D copy
   PreferCopyEngine |= UseCopyEngineForD2DCopy;
 
+  Queue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_host, Count);
   return enqueueMemCopyHelper(
       UR_COMMAND_DEVICE_GLOBAL_VARIABLE_READ, Queue, Dst, BlockingRead, Count,
       ur_cast<char *>(GlobalVarPtr) + Offset, NumEventsInWaitList,
@@ -656,6 +981,17 @@ ur_result_t urKernelCreate(
 
   UR_CALL((*RetKernel)->initialize());
 
+  // The kernels created for the same name share their properties, kept by
+  // the program, and the name is known without asking the driver
+  (*RetKernel)->ZeKernelProperties.Compute =
+      [Kernel = *RetKernel,
+       Name = std::string(KernelName)](ze_kernel_properties_t &Properties) {
+        Kernel->Program->getKernelProperties(Name, Kernel->ZeKernel,
+                                             Properties);
+      };
+  (*RetKernel)->ZeKernelName.Compute =
+      [Name = std::string(KernelName)](std::string &Result) { Result = Name; };
+
   return UR_RESULT_SUCCESS;
 }
 
@@ -672,41 +1008,8 @@ ur_result_t urKernelSetArgValue(
 
   UR_ASSERT(Kernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  // OpenCL: "the arg_value pointer can be NULL or point to a NULL value
-  // in which case a NULL value will be used as the value for the argument
-  // declared as a pointer to global or constant memory in the kernel"
-  //
-  // We don't know the type of the argument but it seems that the only time
-  // SYCL RT would send a pointer to NULL in 'arg_value' is when the argument
-  // is a NULL pointer. Treat a pointer to NULL in 'arg_value' as a NULL.
-  if (ArgSize == sizeof(void *) && PArgValue &&
-      *(void **)(const_cast<void *>(PArgValue)) == nullptr) {
-    PArgValue = nullptr;
-  }
-
-  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
-    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
-  }
-
   std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
-  ze_result_t ZeResult = ZE_RESULT_SUCCESS;
-  if (Kernel->ZeKernelMap.empty()) {
-    auto ZeKernel = Kernel->ZeKernel;
-    ZeResult = ZE_CALL_NOCHECK(zeKernelSetArgumentValue,
-                               (ZeKernel, ArgIndex, ArgSize, PArgValue));
-  } else {
-    for (auto It : Kernel->ZeKernelMap) {
-      auto ZeKernel = It.second;
-      ZeResult = ZE_CALL_NOCHECK(zeKernelSetArgumentValue,
-                                 (ZeKernel, ArgIndex, ArgSize, PArgValue));
-    }
-  }
-
-  if (ZeResult == ZE_RESULT_ERROR_INVALID_ARGUMENT) {
-    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
-  }
-
-  return ze2urResult(ZeResult);
+  return setArgValueLocked(Kernel, ArgIndex, ArgSize, PArgValue);
 }
 
 ur_result_t urKernelSetArgLocal(
@@ -950,10 +1253,10 @@ ur_result_t urKernelSetArgPointer(
 ) {
   std::ignore = Properties;
 
-  // KernelSetArgValue is expecting a pointer to the argument
-  UR_CALL(ur::level_zero::urKernelSetArgValue(
-      Kernel, ArgIndex, sizeof(const void *), nullptr, &ArgValue));
-  return UR_RESULT_SUCCESS;
+  UR_ASSERT(Kernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
+  return setArgPointerLocked(Kernel, ArgIndex, ArgValue);
 }
 
 ur_result_t urKernelSetExecInfo(
@@ -1011,57 +1314,58 @@ ur_result_t urKernelSetArgSampler(
 ) {
   std::ignore = Properties;
   std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
-  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
-    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
-  }
-  ZE2UR_CALL(zeKernelSetArgumentValue, (Kernel->ZeKernel, ArgIndex,
-                                        sizeof(void *), &ArgValue->ZeSampler));
-
-  return UR_RESULT_SUCCESS;
+  return setArgSamplerLocked(Kernel, ArgIndex, ArgValue);
 }
 
-ur_result_t urKernelSetArgMemObj(
+ur_result_t urKernelSetArgsExp(
     ur_kernel_handle_t Kernel, ///< [in] handle of the kernel object
-    uint32_t ArgIndex, ///< [in] argument index in range [0, num args - 1]
-    const ur_kernel_arg_mem_obj_properties_t
-        *Properties, ///< [in][optional] pointer to Memory object properties.
-    ur_mem_handle_t ArgValue ///< [in][optional] handle of Memory object.
+    uint32_t NumArgs,          ///< [in] number of arguments
+    const ur_exp_kernel_arg_properties_t
+        *Args ///< [in][range(0, numArgs)] pointer to a list of kernel arguments
 ) {
-  std::ignore = Properties;
-
+  // The arguments are all set under a single lock of the kernel
   std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
-  // The ArgValue may be a NULL pointer in which case a NULL value is used for
-  // the kernel argument declared as a pointer to global or constant memory.
-
-  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
-    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
-  }
-
-  ur_mem_handle_t_ *UrMem = ur_cast<ur_mem_handle_t_ *>(ArgValue);
-
-  ur_mem_handle_t_::access_mode_t UrAccessMode = ur_mem_handle_t_::read_write;
-  if (Properties) {
-    switch (Properties->memoryAccess) {
-    case UR_MEM_FLAG_READ_WRITE:
-      UrAccessMode = ur_mem_handle_t_::read_write;
+  for (uint32_t I = 0; I < NumArgs; I++) {
+    const ur_exp_kernel_arg_properties_t &Arg = Args[I];
+    switch (Arg.type) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+      UR_CALL(setArgValueLocked(Kernel, Arg.index, Arg.size, Arg.value.value));
       break;
-    case UR_MEM_FLAG_WRITE_ONLY:
-      UrAccessMode = ur_mem_handle_t_::write_only;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+      UR_CALL(setArgPointerLocked(Kernel, Arg.index, Arg.value.pointer));
       break;
-    case UR_MEM_FLAG_READ_ONLY:
-      UrAccessMode = ur_mem_handle_t_::read_only;
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+      UR_CALL(setArgValueLocked(Kernel, Arg.index, Arg.size, nullptr));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ:
+      UR_CALL(setArgMemObjLocked(Kernel, Arg.index,
+                                 Arg.value.memObjTuple.flags,
+                                 Arg.value.memObjTuple.hMem));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+      UR_CALL(setArgSamplerLocked(Kernel, Arg.index, Arg.value.sampler));
       break;
     default:
-      return UR_RESULT_ERROR_INVALID_ARGUMENT;
+      return UR_RESULT_ERROR_INVALID_ENUMERATION;
     }
   }
-  auto Arg = UrMem ? UrMem : nullptr;
-  Kernel->PendingArguments.push_back(
-      {ArgIndex, sizeof(void *), Arg, UrAccessMode});
-
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t urKernelSetArgMemObj(
+    ur_kernel_handle_t Kernel, ///< [in] handle of the kernel object
+    uint32_t ArgIndex, ///< [in] argument index in range [0, num args - 1]
+    const ur_kernel_arg_mem_obj_properties_t
+        *Properties, ///< [in][optional] pointer to Memory object properties.
+    ur_mem_handle_t ArgValue ///< [in][optional] handle of Memory object.
+) {
+  std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
+  return setArgMemObjLocked(Kernel, ArgIndex,
+                            Properties ? Properties->memoryAccess
+                                       : UR_MEM_FLAG_READ_WRITE,
+                            ArgValue);
+}
+
 ur_result_t urKernelGetNativeHandle(
     ur_kernel_handle_t Kernel, ///< [in] handle of the kernel.
     ur_native_handle_t
@@ -1139,6 +1443,54 @@ ur_result_t urKernelSetSpecializationConstants(
 
 } // namespace ur::level_zero
 
+ze_result_t ur_kernel_handle_t_::setArgument(ze_kernel_handle_t ZeKernel,
+                                             uint32_t ArgIndex, size_t ArgSize,
+                                             const void *ArgValue) {
+  auto &Values = ArgumentValues[ZeKernel];
+  if (Values.size() <= ArgIndex)
+    Values.resize(ArgIndex + 1);
+  auto &Value = Values[ArgIndex];
+  auto Bytes = static_cast<const char *>(ArgValue);
+  if (Value.IsSet && Value.IsNull == !ArgValue &&
+      Value.Bytes.size() == ArgSize &&
+      (!ArgValue || std::equal(Bytes, Bytes + ArgSize, Value.Bytes.begin())))
+    return ZE_RESULT_SUCCESS;
+
+  auto ZeResult = ZE_CALL_NOCHECK(zeKernelSetArgumentValue,
+                                  (ZeKernel, ArgIndex, ArgSize, ArgValue));
+  Value.IsSet = ZeResult == ZE_RESULT_SUCCESS;
+  Value.IsNull = !ArgValue;
+  if (ArgValue)
+    Value.Bytes.assign(Bytes, Bytes + ArgSize);
+  else
+    Value.Bytes.resize(ArgSize);
+  return ZeResult;
+}
+
+ur_result_t ur_kernel_handle_t_::getSuggestedGroupSize(
+    ur_device_handle_t Device, ze_kernel_handle_t ZeKernel, uint32_t WorkDim,
+    const size_t *GlobalWorkSize, size_t (&LocalWorkSize)[3]) {
+  UR_ASSERT(GlobalWorkSize, UR_RESULT_ERROR_INVALID_VALUE);
+  size_t GlobalWorkSize3D[3]{1, 1, 1};
+  std::copy(GlobalWorkSize, GlobalWorkSize + WorkDim, GlobalWorkSize3D);
+
+  auto Key = std::make_tuple(ZeKernel, GlobalWorkSize3D[0],
+                             GlobalWorkSize3D[1], GlobalWorkSize3D[2]);
+  auto It = SuggestedGroupSizes.find(Key);
+  if (It == SuggestedGroupSizes.end()) {
+    uint32_t WG[3];
+    UR_CALL(getSuggestedLocalWorkSize(Device, ZeKernel, GlobalWorkSize3D, WG));
+    if (SuggestedGroupSizes.size() == MaxSuggestedGroupSizes)
+      SuggestedGroupSizes.clear();
+    It = SuggestedGroupSizes.emplace(Key, std::array<uint32_t, 3>{WG[0], WG[1],
+                                                                  WG[2]})
+             .first;
+  }
+
+  std::copy(It->second.begin(), It->second.end(), LocalWorkSize);
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t ur_kernel_handle_t_::initialize() {
   // Retain the program and context to show it's used by this kernel.
   UR_CALL(ur::level_zero::urProgramRetain(Program));
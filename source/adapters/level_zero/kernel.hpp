@@ -9,21 +9,22 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <array>
+#include <tuple>
+
 #include "common.hpp"
 #include "memory.hpp"
-#include <unordered_set>
+#include "ur_usm_prefetch_args.hpp"
 
 struct ur_kernel_handle_t_ : _ur_object {
   ur_kernel_handle_t_(bool OwnZeHandle, ur_program_handle_t Program)
-      : Context{nullptr}, Program{Program}, ZeKernel{nullptr},
-        SubmissionsCount{0}, MemAllocs{} {
+      : Context{nullptr}, Program{Program}, ZeKernel{nullptr} {
     OwnNativeHandle = OwnZeHandle;
   }
 
   ur_kernel_handle_t_(ze_kernel_handle_t Kernel, bool OwnZeHandle,
                       ur_context_handle_t Context)
-      : Context{Context}, Program{nullptr}, ZeKernel{Kernel},
-        SubmissionsCount{0}, MemAllocs{} {
+      : Context{Context}, Program{nullptr}, ZeKernel{Kernel} {
     OwnNativeHandle = OwnZeHandle;
   }
 
@@ -45,16 +46,11 @@ struct ur_kernel_handle_t_ : _ur_object {
   // destroying the kernels instead of ZeKernelMap
   std::vector<ze_kernel_handle_t> ZeKernels;
 
-  // Counter to track the number of submissions of the kernel.
-  // When this value is zero, it means that kernel is not submitted for an
-  // execution - at this time we can release memory allocations referenced by
-  // this kernel. We can do this when RefCount turns to 0 but it is too late
-  // because kernels are cached in the context by SYCL RT and they are released
-  // only during context object destruction. Regular RefCount is not usable to
-  // track submissions because user/SYCL RT can retain kernel object any number
-  // of times. And that's why there is no value of RefCount which can mean zero
-  // submissions.
-  std::atomic<uint32_t> SubmissionsCount;
+  // The epochs of the submissions of the kernel which haven't completed yet,
+  // see ur_platform_handle_t_::IndirectAccessEpoch. Regular RefCount is not
+  // usable to track submissions because user/SYCL RT can retain kernel object
+  // any number of times. Guarded by the ContextsMutex of the platform.
+  std::vector<uint64_t> SubmissionEpochs;
 
   // Returns true if kernel has indirect access, false otherwise.
   bool hasIndirectAccess() {
@@ -63,30 +59,6 @@ struct ur_kernel_handle_t_ : _ur_object {
     return true;
   }
 
-  // Hash function object for the unordered_set below.
-  struct Hash {
-    size_t operator()(const std::pair<void *const, MemAllocRecord> *P) const {
-      return std::hash<void *>()(P->first);
-    }
-  };
-
-  // If kernel has indirect access we need to make a snapshot of all existing
-  // memory allocations to defer deletion of these memory allocations to the
-  // moment when kernel execution has finished.
-  // We store pointers to the elements because pointers are not invalidated by
-  // insert/delete for std::unordered_map (iterators are invalidated). We need
-  // to take a snapshot instead of just reference-counting the allocations,
-  // because picture of active allocations can change during kernel execution
-  // (new allocations can be added) and we need to know which memory allocations
-  // were retained by this kernel to release them (and don't touch new
-  // allocations) at kernel completion. Same kernel may be submitted several
-  // times and retained allocations may be different at each submission. That's
-  // why we have a set of memory allocations here and increase ref count only
-  // once even if kernel is submitted many times. We don't want to know how many
-  // times and which allocations were retained by each submission. We release
-  // all allocations in the set only when SubmissionsCount == 0.
-  std::unordered_set<std::pair<void *const, MemAllocRecord> *, Hash> MemAllocs;
-
   // Completed initialization of PI kernel. Must be called after construction.
   ur_result_t initialize();
 
@@ -103,6 +75,40 @@ struct ur_kernel_handle_t_ : _ur_object {
   // before kernel is enqueued.
   std::vector<ArgumentInfo> PendingArguments;
 
+  // The shared USM allocations of the pointer arguments, prefetched to the
+  // device before the launches with UR_USM_AUTO_PREFETCH.
+  ur::usm_prefetch_args_t PrefetchArgs;
+
+  // Sets an argument of ZeKernel with zeKernelSetArgumentValue, unless it's
+  // already set to the same value. Must be called with Mutex locked.
+  ze_result_t setArgument(ze_kernel_handle_t ZeKernel, uint32_t ArgIndex,
+                          size_t ArgSize, const void *ArgValue);
+
+  // The value each argument of the L0 kernels was last set to.
+  struct ArgumentValue {
+    bool IsSet = false;
+    // No value, e.g. for local memory, Bytes only holds the size.
+    bool IsNull = false;
+    std::vector<char> Bytes;
+  };
+  std::unordered_map<ze_kernel_handle_t, std::vector<ArgumentValue>>
+      ArgumentValues;
+
+  // The group size suggested by the driver for ZeKernel, one of the L0
+  // kernels, and GlobalWorkSize, memoized so that launches of the same shape
+  // skip zeKernelSuggestGroupSize. Must be called with Mutex locked.
+  ur_result_t getSuggestedGroupSize(ur_device_handle_t Device,
+                                    ze_kernel_handle_t ZeKernel,
+                                    uint32_t WorkDim,
+                                    const size_t *GlobalWorkSize,
+                                    size_t (&LocalWorkSize)[3]);
+
+  // Cleared once full, launches usually have few distinct shapes.
+  static constexpr size_t MaxSuggestedGroupSizes = 64;
+  std::map<std::tuple<ze_kernel_handle_t, size_t, size_t, size_t>,
+           std::array<uint32_t, 3>>
+      SuggestedGroupSizes;
+
   // Cache of the kernel properties.
   ZeCache<ZeStruct<ze_kernel_properties_t>> ZeKernelProperties;
   ZeCache<std::string> ZeKernelName;
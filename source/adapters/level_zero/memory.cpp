@@ -17,6 +17,7 @@
 #include "event.hpp"
 #include "helpers/memory_helpers.hpp"
 #include "image.hpp"
+#include "latency_tracker.hpp"
 #include "logger/ur_logger.hpp"
 #include "queue.hpp"
 #include "ur_interface_loader.hpp"
@@ -57,6 +58,148 @@ bool IsSharedPointer(ur_context_handle_t Context, const void *Ptr) {
   return (ZeMemoryAllocationProperties.type == ZE_MEMORY_TYPE_SHARED);
 }
 
+// USM copies of at most this size, in bytes, between host-accessible memory
+// are done by the host when nothing needs to run before them. Set with
+// UR_L0_HOST_USM_COPY_THRESHOLD, 0 disables the host copies. Otherwise what
+// the host copies in the launch latency of the profile of Device, 256 bytes
+// without one. Kept small as touching shared USM from the host may migrate
+// its pages back from the device.
+static size_t getHostUSMCopyThreshold(ur_device_handle_t Device) {
+  static const auto EnvThreshold =
+      getenv_to_unsigned("UR_L0_HOST_USM_COPY_THRESHOLD");
+  if (EnvThreshold)
+    return *EnvThreshold;
+  if (Device->Profile && Device->Profile->hostCopyThreshold())
+    return std::min(Device->Profile->hostCopyThreshold(), size_t{64 * 1024});
+  return 256;
+}
+
+// Whether a command enqueued to Queue without a wait list runs right away,
+// with the queue's mutex locked.
+static bool IsQueueIdle(ur_queue_handle_t Queue) {
+  if (!Queue->isInOrderQueue())
+    return Queue->ActiveBarriers.empty();
+
+  ur_event_handle_t LastEvent = Queue->LastCommandEvent;
+  if (!LastEvent)
+    return true;
+  // Discarded events may have been reset and reused, their status can't be
+  // queried.
+  if (LastEvent->IsDiscarded)
+    return false;
+  return LastEvent->Completed ||
+         ZE_CALL_NOCHECK(zeEventQueryStatus, (LastEvent->ZeEvent)) ==
+             ZE_RESULT_SUCCESS;
+}
+
+// Copies of at least this size, in bytes, are split across all the copy
+// engines of the queue. Set with UR_L0_SPLIT_COPY_THRESHOLD_MB, 0 disables
+// the split. Otherwise derived from the profile of Device, the split being
+// disabled without one.
+static size_t getSplitCopyThreshold(ur_device_handle_t Device) {
+  static const auto EnvThreshold =
+      getenv_to_unsigned("UR_L0_SPLIT_COPY_THRESHOLD_MB");
+  if (EnvThreshold)
+    return *EnvThreshold * 1024 * 1024;
+  return Device->Profile ? Device->Profile->splitTransferThreshold() : 0;
+}
+
+// The number of copy engines a copy of Size bytes is split across, 1 if it
+// isn't split. Chunks are only submitted to immediate command lists, with
+// events the queue doesn't discard or count.
+static uint32_t getSplitCopyEngines(ur_queue_handle_t Queue, bool UseCopyEngine,
+                                    size_t Size) {
+  size_t SplitCopyThreshold = getSplitCopyThreshold(Queue->Device);
+  if (!SplitCopyThreshold || Size < SplitCopyThreshold || !UseCopyEngine ||
+      !Queue->UsingImmCmdLists || Queue->isDiscardEvents() ||
+      Queue->CounterBasedEventsEnabled)
+    return 1;
+  auto &QueueGroup = Queue->getQueueGroup(UseCopyEngine);
+  return QueueGroup.UpperIndex - QueueGroup.LowerIndex + 1;
+}
+
+// Splits a copy in NumEngines chunks, the first one on CommandList and the
+// others on the next copy engines of the queue, round robin. The chunks start
+// once the wait list of Event is done, and Event is signaled once they all
+// are.
+static ur_result_t enqueueSplitMemCopy(ur_queue_handle_t Queue,
+                                       ur_command_list_ptr_t CommandList,
+                                       ur_event_handle_t Event,
+                                       uint32_t NumEngines, void *Dst,
+                                       size_t Size, const void *Src) {
+  auto CommandType = Event->CommandType;
+  const auto &WaitList = Event->WaitList;
+
+  // The chunks on the other engines start when the wait list is done on
+  // CommandList, which keeps the ordering of the queue. The internal events
+  // aren't added to the command lists, so that Event stays the last one of
+  // the queue, and they are released with the wait list of Event once the
+  // barrier waiting for them is done.
+  ur_event_handle_t StartEvent;
+  UR_CALL(createEventAndAssociateQueue(Queue, &StartEvent, CommandType,
+                                       Queue->CommandListMap.end(), true,
+                                       false));
+  ze_event_handle_t ZeStartEvent = StartEvent->ZeEvent;
+  ZE2UR_CALL(zeCommandListAppendBarrier,
+             (CommandList->first, ZeStartEvent, WaitList.Length,
+              WaitList.ZeEventList));
+
+  // Page aligned chunks, the first one takes the remainder.
+  size_t ChunkSize = (Size / NumEngines + 4095) & ~size_t(4095);
+  std::vector<ur_event_handle_t> ChunkEvents{StartEvent};
+  std::vector<ze_event_handle_t> ZeChunkEvents;
+  size_t Offset = Size;
+  for (uint32_t I = 1; I < NumEngines && Offset > ChunkSize; I++) {
+    Offset -= ChunkSize;
+    ur_command_list_ptr_t ChunkCommandList{};
+    UR_CALL(Queue->Context->getAvailableCommandList(
+        Queue, ChunkCommandList, true, 0, nullptr, false));
+    ur_event_handle_t ChunkEvent;
+    UR_CALL(createEventAndAssociateQueue(Queue, &ChunkEvent, CommandType,
+                                         Queue->CommandListMap.end(), true,
+                                         false));
+    ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+               (ChunkCommandList->first, static_cast<char *>(Dst) + Offset,
+                static_cast<const char *>(Src) + Offset, ChunkSize,
+                ChunkEvent->ZeEvent, 1, &ZeStartEvent));
+    UR_CALL(Queue->executeCommandList(ChunkCommandList, false, false));
+    ChunkEvents.push_back(ChunkEvent);
+    ZeChunkEvents.push_back(ChunkEvent->ZeEvent);
+  }
+  logger::debug("enqueueSplitMemCopy: {} bytes in {} chunks", Size,
+                ChunkEvents.size());
+
+  ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+             (CommandList->first, Dst, Src, Offset, nullptr, 1,
+              &ZeStartEvent));
+  ze_event_handle_t ZeEvent = Event->ZeEvent;
+  ZE2UR_CALL(zeCommandListAppendBarrier,
+             (CommandList->first, ZeEvent,
+              static_cast<uint32_t>(ZeChunkEvents.size()),
+              ZeChunkEvents.data()));
+
+  _ur_ze_event_list_t ChunkWaitList;
+  ChunkWaitList.Length = static_cast<uint32_t>(ChunkEvents.size());
+  ChunkWaitList.UrEventList = new ur_event_handle_t[ChunkWaitList.Length];
+  ChunkWaitList.ZeEventList = new ze_event_handle_t[ChunkWaitList.Length];
+  for (uint32_t I = 0; I < ChunkWaitList.Length; I++) {
+    ChunkWaitList.UrEventList[I] = ChunkEvents[I];
+    ChunkWaitList.ZeEventList[I] = ChunkEvents[I]->ZeEvent;
+  }
+  return Event->WaitList.insert(ChunkWaitList);
+}
+
+// The direction of a USM copy in the queue telemetry, host and shared
+// allocations count as host memory.
+static ur::queue_telemetry_t::copy_direction_t
+usmCopyDirection(bool SrcIsDevice, bool DstIsDevice) {
+  if (SrcIsDevice)
+    return DstIsDevice ? ur::queue_telemetry_t::device_to_device
+                       : ur::queue_telemetry_t::device_to_host;
+  return DstIsDevice ? ur::queue_telemetry_t::host_to_device
+                     : ur::queue_telemetry_t::unknown_direction;
+}
+
 // Shared by all memory read/write/copy PI interfaces.
 // PI interfaces must have queue's and destination buffer's mutexes locked for
 // exclusive use and source buffer's mutex locked for shared use on entry.
@@ -88,6 +231,7 @@ ur_result_t enqueueMemCopyHelper(ur_command_t CommandType,
   ur_event_handle_t *Event = OutEvent ? OutEvent : &InternalEvent;
   UR_CALL(createEventAndAssociateQueue(Queue, Event, CommandType, CommandList,
                                        IsInternal, false));
+  Queue->Telemetry.commandSubmitted(CommandType);
   UR_CALL(setSignalEvent(Queue, UseCopyEngine, &ZeEvent, Event,
                          NumEventsInWaitList, EventWaitList,
                          CommandList->second.ZeQueue));
@@ -101,9 +245,15 @@ ur_result_t enqueueMemCopyHelper(ur_command_t CommandType,
                 ur_cast<std::uintptr_t>(ZeEvent));
   printZeEventList(WaitList);
 
-  ZE2UR_CALL(zeCommandListAppendMemoryCopy,
-             (ZeCommandList, Dst, Src, Size, ZeEvent, WaitList.Length,
-              WaitList.ZeEventList));
+  if (auto NumEngines = getSplitCopyEngines(Queue, UseCopyEngine, Size);
+      NumEngines > 1) {
+    UR_CALL(enqueueSplitMemCopy(Queue, CommandList, *Event, NumEngines, Dst,
+                                Size, Src));
+  } else {
+    ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+               (ZeCommandList, Dst, Src, Size, ZeEvent, WaitList.Length,
+                WaitList.ZeEventList));
+  }
 
   UR_CALL(Queue->executeCommandList(CommandList, BlockingWrite, OkToBatch));
 
@@ -141,6 +291,7 @@ ur_result_t enqueueMemCopyRectHelper(
   ur_event_handle_t *Event = OutEvent ? OutEvent : &InternalEvent;
   UR_CALL(createEventAndAssociateQueue(Queue, Event, CommandType, CommandList,
                                        IsInternal, false));
+  Queue->Telemetry.commandSubmitted(CommandType);
   UR_CALL(setSignalEvent(Queue, UseCopyEngine, &ZeEvent, Event,
                          NumEventsInWaitList, EventWaitList,
                          CommandList->second.ZeQueue));
@@ -224,14 +375,15 @@ static ur_result_t enqueueMemFillHelper(ur_command_t CommandType,
   }
 
   bool UseCopyEngine = Queue->useCopyEngine(PreferCopyEngine);
-  if (!UseCopyEngine) {
-    // Pattern size must fit the compute queue capabilities.
-    UR_ASSERT(
-        PatternSize <=
-            Device->QueueGroup[ur_device_handle_t_::queue_group_info_t::Compute]
-                .ZeProperties.maxMemoryFillPatternSize,
-        UR_RESULT_ERROR_INVALID_VALUE);
-  }
+  // PatternSize must be a power of two for zeCommandListAppendMemoryFill, and
+  // fit the compute queue capabilities if it's used. Other fills are emulated
+  // with zeCommandListAppendMemoryCopy.
+  bool UseFill =
+      isPowerOf2(PatternSize) &&
+      (UseCopyEngine ||
+       PatternSize <=
+           Device->QueueGroup[ur_device_handle_t_::queue_group_info_t::Compute]
+               .ZeProperties.maxMemoryFillPatternSize);
 
   _ur_ze_event_list_t TmpWaitList;
   UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
@@ -250,6 +402,7 @@ static ur_result_t enqueueMemFillHelper(ur_command_t CommandType,
   ur_event_handle_t *Event = OutEvent ? OutEvent : &InternalEvent;
   UR_CALL(createEventAndAssociateQueue(Queue, Event, CommandType, CommandList,
                                        IsInternal, false));
+  Queue->Telemetry.commandSubmitted(CommandType);
   UR_CALL(setSignalEvent(Queue, UseCopyEngine, &ZeEvent, Event,
                          NumEventsInWaitList, EventWaitList,
                          CommandList->second.ZeQueue));
@@ -258,9 +411,7 @@ static ur_result_t enqueueMemFillHelper(ur_command_t CommandType,
   const auto &ZeCommandList = CommandList->first;
   const auto &WaitList = (*Event)->WaitList;
 
-  // PatternSize must be a power of two for zeCommandListAppendMemoryFill.
-  // When it's not, the fill is emulated with zeCommandListAppendMemoryCopy.
-  if (isPowerOf2(PatternSize)) {
+  if (UseFill) {
     ZE2UR_CALL(zeCommandListAppendMemoryFill,
                (ZeCommandList, Ptr, Pattern, PatternSize, Size, ZeEvent,
                 WaitList.Length, WaitList.ZeEventList));
@@ -274,16 +425,24 @@ static ur_result_t enqueueMemFillHelper(ur_command_t CommandType,
     // to track down its completion.
     UR_CALL(Queue->executeCommandList(CommandList, false, OkToBatch));
   } else {
-    // Copy pattern into every entry in memory array pointed by Ptr.
-    uint32_t NumOfCopySteps = Size / PatternSize;
-    const void *Src = Pattern;
-
-    for (uint32_t step = 0; step < NumOfCopySteps; ++step) {
-      void *Dst = reinterpret_cast<void *>(reinterpret_cast<uint8_t *>(Ptr) +
-                                           step * PatternSize);
+    // Copy the pattern into the first entry of the memory array pointed by
+    // Ptr, and then double the filled part of the array with each copy, so
+    // that the fill takes a logarithmic number of copies rather than one per
+    // entry. Each copy reads the part filled by the previous ones.
+    auto *Dst = static_cast<uint8_t *>(Ptr);
+    size_t Filled = std::min(PatternSize, Size);
+    ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+               (ZeCommandList, Dst, Pattern, Filled,
+                Filled == Size ? ZeEvent : nullptr, WaitList.Length,
+                WaitList.ZeEventList));
+    while (Filled < Size) {
+      size_t CopySize = std::min(Filled, Size - Filled);
+      ZE2UR_CALL(zeCommandListAppendBarrier,
+                 (ZeCommandList, nullptr, 0, nullptr));
       ZE2UR_CALL(zeCommandListAppendMemoryCopy,
-                 (ZeCommandList, Dst, Src, PatternSize, ZeEvent,
-                  WaitList.Length, WaitList.ZeEventList));
+                 (ZeCommandList, Dst + Filled, Dst, CopySize,
+                  Filled + CopySize == Size ? ZeEvent : nullptr, 0, nullptr));
+      Filled += CopySize;
     }
 
     logger::debug("calling zeCommandListAppendMemoryCopy() with"
@@ -367,6 +526,7 @@ static ur_result_t enqueueMemImageCommandHelper(
   ur_event_handle_t *Event = OutEvent ? OutEvent : &InternalEvent;
   UR_CALL(createEventAndAssociateQueue(Queue, Event, CommandType, CommandList,
                                        IsInternal, false));
+  Queue->Telemetry.commandSubmitted(CommandType);
   UR_CALL(setSignalEvent(Queue, UseCopyEngine, &ZeEvent, Event,
                          NumEventsInWaitList, EventWaitList,
                          CommandList->second.ZeQueue));
@@ -500,6 +660,7 @@ ur_result_t urEnqueueMemBufferRead(
         *phEvent ///< [in,out][optional] return an event object that identifies
                  ///< this particular command instance.
 ) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferRead");
   ur_mem_handle_t_ *Src = ur_cast<ur_mem_handle_t_ *>(hBuffer);
 
   std::shared_lock<ur_shared_mutex> SrcLock(Src->Mutex, std::defer_lock);
@@ -510,6 +671,7 @@ ur_result_t urEnqueueMemBufferRead(
   UR_CALL(Src->getZeHandle(ZeHandleSrc, ur_mem_handle_t_::read_only,
                            Queue->Device, phEventWaitList,
                            numEventsInWaitList));
+  Queue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_host, size);
   return enqueueMemCopyHelper(UR_COMMAND_MEM_BUFFER_READ, Queue, pDst,
                               blockingRead, size, ZeHandleSrc + offset,
                               numEventsInWaitList, phEventWaitList, phEvent,
@@ -537,6 +699,7 @@ ur_result_t urEnqueueMemBufferWrite(
         *phEvent ///< [in,out][optional] return an event object that identifies
                  ///< this particular command instance.
 ) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferWrite");
   ur_mem_handle_t_ *Buffer = ur_cast<ur_mem_handle_t_ *>(hBuffer);
 
   std::scoped_lock<ur_shared_mutex, ur_shared_mutex> Lock(Queue->Mutex,
@@ -546,6 +709,7 @@ ur_result_t urEnqueueMemBufferWrite(
   UR_CALL(Buffer->getZeHandle(ZeHandleDst, ur_mem_handle_t_::write_only,
                               Queue->Device, phEventWaitList,
                               numEventsInWaitList));
+  Queue->Telemetry.bytesCopied(ur::queue_telemetry_t::host_to_device, size);
   return enqueueMemCopyHelper(UR_COMMAND_MEM_BUFFER_WRITE, Queue,
                               ZeHandleDst + offset, // dst
                               blockingWrite, size,
@@ -593,6 +757,8 @@ ur_result_t urEnqueueMemBufferReadRect(
   UR_CALL(Buffer->getZeHandle(ZeHandleSrc, ur_mem_handle_t_::read_only,
                               Queue->Device, phEventWaitList,
                               numEventsInWaitList));
+  Queue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_host,
+                               region.width * region.height * region.depth);
   return enqueueMemCopyRectHelper(
       UR_COMMAND_MEM_BUFFER_READ_RECT, Queue, ZeHandleSrc, pDst, bufferOffset,
       hostOffset, region, bufferRowPitch, hostRowPitch, bufferSlicePitch,
@@ -640,6 +806,8 @@ ur_result_t urEnqueueMemBufferWriteRect(
   UR_CALL(Buffer->getZeHandle(ZeHandleDst, ur_mem_handle_t_::write_only,
                               Queue->Device, phEventWaitList,
                               numEventsInWaitList));
+  Queue->Telemetry.bytesCopied(ur::queue_telemetry_t::host_to_device,
+                               region.width * region.height * region.depth);
   return enqueueMemCopyRectHelper(
       UR_COMMAND_MEM_BUFFER_WRITE_RECT, Queue,
       const_cast<char *>(static_cast<const char *>(pSrc)), ZeHandleDst,
@@ -667,6 +835,7 @@ ur_result_t urEnqueueMemBufferCopy(
         *OutEvent ///< [in,out][optional] return an event object that identifies
                   ///< this particular command instance.
 ) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferCopy");
   _ur_buffer *SrcBuffer = ur_cast<_ur_buffer *>(BufferSrc);
   _ur_buffer *DstBuffer = ur_cast<_ur_buffer *>(BufferDst);
 
@@ -694,6 +863,7 @@ ur_result_t urEnqueueMemBufferCopy(
                                  Queue->Device, EventWaitList,
                                  NumEventsInWaitList));
 
+  Queue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_device, Size);
   return enqueueMemCopyHelper(
       UR_COMMAND_MEM_BUFFER_COPY, Queue, ZeHandleDst + DstOffset,
       false, // blocking
@@ -753,6 +923,9 @@ ur_result_t urEnqueueMemBufferCopyRect(
                                  Queue->Device, EventWaitList,
                                  NumEventsInWaitList));
 
+  Queue->Telemetry.bytesCopied(ur::queue_telemetry_t::device_to_device,
+                               SrcRegion.width * SrcRegion.height *
+                                   SrcRegion.depth);
   return enqueueMemCopyRectHelper(
       UR_COMMAND_MEM_BUFFER_COPY_RECT, Queue, ZeHandleSrc, ZeHandleDst,
       SrcOrigin, DstOrigin, SrcRegion, SrcRowPitch, DstRowPitch, SrcSlicePitch,
@@ -761,6 +934,14 @@ ur_result_t urEnqueueMemBufferCopyRect(
       NumEventsInWaitList, EventWaitList, OutEvent, PreferCopyEngine);
 }
 
+ur_result_t urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t, ur_mem_handle_t, ur_mem_handle_t, uint32_t,
+    const ur_rect_offset_t *, const ur_rect_offset_t *,
+    const ur_rect_region_t *, size_t, size_t, size_t, size_t, uint32_t,
+    const ur_event_handle_t *, ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 ur_result_t urEnqueueMemBufferFill(
     ur_queue_handle_t Queue, ///< [in] handle of the queue object
     ur_mem_handle_t Buffer,  ///< [in] handle of the buffer object
@@ -780,6 +961,7 @@ ur_result_t urEnqueueMemBufferFill(
         *OutEvent ///< [in,out][optional] return an event object that identifies
                   ///< this particular command instance.
 ) {
+  TRACK_SCOPE_LATENCY("urEnqueueMemBufferFill");
   std::scoped_lock<ur_shared_mutex, ur_shared_mutex> Lock(Queue->Mutex,
                                                           Buffer->Mutex);
 
@@ -939,6 +1121,7 @@ ur_result_t urEnqueueMemBufferMap(
     UR_CALL(createEventAndAssociateQueue(
         Queue, Event, UR_COMMAND_MEM_BUFFER_MAP, Queue->CommandListMap.end(),
         IsInternal, false));
+    Queue->Telemetry.commandSubmitted(UR_COMMAND_MEM_BUFFER_MAP);
 
     ZeEvent = (*Event)->ZeEvent;
     (*Event)->WaitList = TmpWaitList;
@@ -1013,6 +1196,42 @@ ur_result_t urEnqueueMemBufferMap(
     return UR_RESULT_SUCCESS;
   }
 
+  // Buffers in host or shared USM, e.g. created from such a native handle,
+  // are mapped as is, the same as on integrated devices.
+  bool ZeroCopy = false;
+  if (!Buffer->MapHostPtr) {
+    std::scoped_lock<ur_shared_mutex> Guard(Buffer->Mutex);
+    ZeroCopy = Buffer->getHostAccessibleZeHandle(Queue->Device) != nullptr;
+  }
+  if (ZeroCopy) {
+    if (NumEventsInWaitList > 0)
+      UR_CALL(ur::level_zero::urEventWait(NumEventsInWaitList, EventWaitList));
+
+    if (Queue->isInOrderQueue())
+      UR_CALL(ur::level_zero::urQueueFinish(Queue));
+
+    // Lock automatically releases when this goes out of scope.
+    std::scoped_lock<ur_shared_mutex> Guard(Buffer->Mutex);
+
+    // Makes the allocation valid again if a device wrote the buffer since,
+    // and invalidates the other ones for a write access.
+    char *ZeHandle;
+    UR_CALL(Buffer->getZeHandle(ZeHandle, AccessMode, Queue->Device,
+                                EventWaitList, NumEventsInWaitList));
+    *RetMap = ZeHandle + Offset;
+
+    auto Res = Buffer->Mappings.insert({*RetMap, {Offset, Size, true}});
+    if (!Res.second) {
+      logger::error("urEnqueueMemBufferMap: duplicate mapping detected");
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+
+    if (!(*Event)->CounterBasedEventsEnabled)
+      ZE2UR_CALL(zeEventHostSignal, (ZeEvent));
+    (*Event)->Completed = true;
+    return UR_RESULT_SUCCESS;
+  }
+
   // Lock automatically releases when this goes out of scope.
   std::scoped_lock<ur_shared_mutex, ur_shared_mutex> Lock(Queue->Mutex,
                                                           Buffer->Mutex);
@@ -1104,6 +1323,7 @@ ur_result_t urEnqueueMemUnmap(
     UR_CALL(createEventAndAssociateQueue(Queue, Event, UR_COMMAND_MEM_UNMAP,
                                          Queue->CommandListMap.end(),
                                          IsInternal, false));
+    Queue->Telemetry.commandSubmitted(UR_COMMAND_MEM_UNMAP);
     ZeEvent = (*Event)->ZeEvent;
     (*Event)->WaitList = TmpWaitList;
   }
@@ -1127,11 +1347,14 @@ ur_result_t urEnqueueMemUnmap(
     // In the case of an integrated device, the map operation does not allocate
     // any memory, so there is nothing to free. This is indicated by a nullptr.
     (*Event)->CommandData =
-        (Buffer->OnHost ? nullptr : (Buffer->MapHostPtr ? nullptr : MappedPtr));
+        (Buffer->OnHost || MapInfo.ZeroCopy
+             ? nullptr
+             : (Buffer->MapHostPtr ? nullptr : MappedPtr));
   }
 
-  // For integrated devices the buffer is allocated in host memory.
-  if (Buffer->OnHost) {
+  // For integrated devices the buffer is allocated in host memory, and
+  // zero-copy mappings are the allocation itself.
+  if (Buffer->OnHost || MapInfo.ZeroCopy) {
     // Wait on incoming events before doing the copy
     if (NumEventsInWaitList > 0)
       UR_CALL(ur::level_zero::urEventWait(NumEventsInWaitList, EventWaitList));
@@ -1214,12 +1437,14 @@ ur_result_t urEnqueueUSMMemcpy(
         *OutEvent ///< [in,out][optional] return an event object that identifies
                   ///< this particular command instance.
 ) {
+  TRACK_SCOPE_LATENCY("urEnqueueUSMMemcpy");
   std::scoped_lock<ur_shared_mutex> lock(Queue->Mutex);
 
   // Device to Device copies are found to execute slower on copy engine
   // (versus compute engine).
-  bool PreferCopyEngine = !IsDevicePointer(Queue->Context, Src) ||
-                          !IsDevicePointer(Queue->Context, Dst);
+  bool SrcIsDevice = IsDevicePointer(Queue->Context, Src);
+  bool DstIsDevice = IsDevicePointer(Queue->Context, Dst);
+  bool PreferCopyEngine = !SrcIsDevice || !DstIsDevice;
   // For better performance, Copy Engines are not preferred given Shared
   // pointers on DG2.
   if (Queue->Device->isDG2() && (IsSharedPointer(Queue->Context, Src) ||
@@ -1230,6 +1455,29 @@ ur_result_t urEnqueueUSMMemcpy(
   // Temporary option added to use copy engine for D2D copy
   PreferCopyEngine |= UseCopyEngineForD2DCopy;
 
+  Queue->Telemetry.bytesCopied(usmCopyDirection(SrcIsDevice, DstIsDevice),
+                               Size);
+
+  // Small copies between host and shared USM are done by the host on an idle
+  // queue, rather than paying for a submission and waiting for the device to
+  // signal their event.
+  if (!SrcIsDevice && !DstIsDevice && Size > 0 &&
+      Size <= getHostUSMCopyThreshold(Queue->Device) &&
+      NumEventsInWaitList == 0 && IsQueueIdle(Queue)) {
+    memcpy(Dst, Src, Size);
+    Queue->Telemetry.commandSubmitted(UR_COMMAND_MEM_BUFFER_COPY);
+    if (OutEvent) {
+      UR_CALL(createEventAndAssociateQueue(
+          Queue, OutEvent, UR_COMMAND_MEM_BUFFER_COPY,
+          Queue->CommandListMap.end(), /* IsInternal */ false,
+          /* IsMultiDevice */ false));
+      if (!(*OutEvent)->CounterBasedEventsEnabled)
+        ZE2UR_CALL(zeEventHostSignal, ((*OutEvent)->ZeEvent));
+      (*OutEvent)->Completed = true;
+    }
+    return UR_RESULT_SUCCESS;
+  }
+
   return enqueueMemCopyHelper( // TODO: do we need a new command type for this?
       UR_COMMAND_MEM_BUFFER_COPY, Queue, Dst, Blocking, Size, Src,
       NumEventsInWaitList, EventWaitList, OutEvent, PreferCopyEngine);
@@ -1282,6 +1530,7 @@ ur_result_t urEnqueueUSMPrefetch(
   ur_event_handle_t *Event = OutEvent ? OutEvent : &InternalEvent;
   UR_CALL(createEventAndAssociateQueue(Queue, Event, UR_COMMAND_USM_PREFETCH,
                                        CommandList, IsInternal, false));
+  Queue->Telemetry.commandSubmitted(UR_COMMAND_USM_PREFETCH);
   ZeEvent = (*Event)->ZeEvent;
   (*Event)->WaitList = TmpWaitList;
 
@@ -1338,6 +1587,7 @@ ur_result_t urEnqueueUSMAdvise(
   ur_event_handle_t *Event = OutEvent ? OutEvent : &InternalEvent;
   UR_CALL(createEventAndAssociateQueue(Queue, Event, UR_COMMAND_USM_ADVISE,
                                        CommandList, IsInternal, false));
+  Queue->Telemetry.commandSubmitted(UR_COMMAND_USM_ADVISE);
   ZeEvent = (*Event)->ZeEvent;
   (*Event)->WaitList = TmpWaitList;
 
@@ -1425,8 +1675,9 @@ ur_result_t urEnqueueUSMMemcpy2D(
 
   // Device to Device copies are found to execute slower on copy engine
   // (versus compute engine).
-  bool PreferCopyEngine = !IsDevicePointer(Queue->Context, Src) ||
-                          !IsDevicePointer(Queue->Context, Dst);
+  bool SrcIsDevice = IsDevicePointer(Queue->Context, Src);
+  bool DstIsDevice = IsDevicePointer(Queue->Context, Dst);
+  bool PreferCopyEngine = !SrcIsDevice || !DstIsDevice;
   // For better performance, Copy Engines are not preferred given Shared
   // pointers on DG2.
   if (Queue->Device->isDG2() && (IsSharedPointer(Queue->Context, Src) ||
@@ -1437,6 +1688,8 @@ ur_result_t urEnqueueUSMMemcpy2D(
   // Temporary option added to use copy engine for D2D copy
   PreferCopyEngine |= UseCopyEngineForD2DCopy;
 
+  Queue->Telemetry.bytesCopied(usmCopyDirection(SrcIsDevice, DstIsDevice),
+                               Width * Height);
   return enqueueMemCopyRectHelper( // TODO: do we need a new command type for
                                    // this?
       UR_COMMAND_MEM_BUFFER_COPY_RECT, Queue, Src, Dst, ZeroOffset, ZeroOffset,
@@ -1935,6 +2188,7 @@ ur_result_t urEnqueueUSMFill(
     ur_event_handle_t *Event ///< [out][optional] return an event object that
                              ///< identifies this particular command instance.
 ) {
+  TRACK_SCOPE_LATENCY("urEnqueueUSMFill");
   std::scoped_lock<ur_shared_mutex> Lock(Queue->Mutex);
 
   return enqueueMemFillHelper(
@@ -2027,10 +2281,55 @@ static ur_result_t ZeDeviceMemAllocHelper(void **ResultPtr,
   return UR_RESULT_SUCCESS;
 }
 
+size_t _ur_buffer::getDeviceIndex(ur_device_handle_t Device) const {
+  auto &Devices = UrContext->Devices;
+  return std::find(Devices.begin(), Devices.end(), Device) - Devices.begin();
+}
+
 ur_result_t _ur_buffer::getZeHandle(char *&ZeHandle, access_mode_t AccessMode,
                                     ur_device_handle_t Device,
                                     const ur_event_handle_t *phWaitEvents,
                                     uint32_t numWaitEvents) {
+  // A read of an allocation that was valid in the current epoch doesn't need
+  // any allocation or copy, so it doesn't need to be serialized either.
+  size_t Index = ValidHandles ? getDeviceIndex(Device) : 0;
+  bool HasSlot = ValidHandles && Index < UrContext->Devices.size();
+  if (AccessMode == ur_mem_handle_t_::read_only && HasSlot) {
+    auto &Slot = ValidHandles[Index];
+    uint64_t Epoch = ValidEpoch.load(std::memory_order_acquire);
+    if (Slot.Epoch.load(std::memory_order_acquire) == Epoch) {
+      char *Handle = Slot.ZeHandle.load(std::memory_order_relaxed);
+      if (ValidEpoch.load(std::memory_order_acquire) == Epoch) {
+        ZeHandle = Handle;
+        return UR_RESULT_SUCCESS;
+      }
+    }
+  }
+
+  std::scoped_lock<ur_mutex> Lock(ZeHandleMutex);
+  if (AccessMode != ur_mem_handle_t_::read_only)
+    ValidEpoch.fetch_add(1, std::memory_order_acq_rel);
+  UR_CALL(getZeHandleLocked(ZeHandle, AccessMode, Device, phWaitEvents,
+                            numWaitEvents));
+
+  // Publish the allocation for the reads until the next write.
+  if (HasSlot) {
+    auto It = Allocations.find(Device);
+    if (It != Allocations.end() && It->second.Valid && It->second.ZeHandle) {
+      auto &Slot = ValidHandles[Index];
+      Slot.ZeHandle.store(It->second.ZeHandle, std::memory_order_relaxed);
+      Slot.Epoch.store(ValidEpoch.load(std::memory_order_relaxed),
+                       std::memory_order_release);
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+_ur_buffer::getZeHandleLocked(char *&ZeHandle, access_mode_t AccessMode,
+                              ur_device_handle_t Device,
+                              const ur_event_handle_t *phWaitEvents,
+                              uint32_t numWaitEvents) {
 
   // NOTE: There might be no valid allocation at all yet and we get
   // here from piEnqueueKernelLaunch that would be doing the buffer
@@ -2043,6 +2342,12 @@ ur_result_t _ur_buffer::getZeHandle(char *&ZeHandle, access_mode_t AccessMode,
   if (!Device)
     Device = UrContext->Devices[0];
 
+  if (Device == ExclusiveDevice && !this->isFreed) {
+    ZeHandle = Allocations[Device].ZeHandle;
+    return UR_RESULT_SUCCESS;
+  }
+  ExclusiveDevice = nullptr;
+
   auto &Allocation = Allocations[Device];
 
   if (this->isFreed) {
@@ -2132,8 +2437,9 @@ ur_result_t _ur_buffer::getZeHandle(char *&ZeHandle, access_mode_t AccessMode,
       // TODO: we can probably generalize this and share root-device
       //       allocations by its own sub-devices even if not all other
       //       devices in the context have the same root.
-      UR_CALL(getZeHandle(ZeHandle, AccessMode, UrContext->SingleRootDevice,
-                          phWaitEvents, numWaitEvents));
+      UR_CALL(getZeHandleLocked(ZeHandle, AccessMode,
+                                UrContext->SingleRootDevice, phWaitEvents,
+                                numWaitEvents));
       Allocation.ReleaseAction = allocation_t::keep;
       Allocation.ZeHandle = ZeHandle;
       Allocation.Valid = true;
@@ -2175,9 +2481,9 @@ ur_result_t _ur_buffer::getZeHandle(char *&ZeHandle, access_mode_t AccessMode,
     }
     char *ZeHandleSrc = nullptr;
     if (NeedCopy) {
-      UR_CALL(getZeHandle(ZeHandleSrc, ur_mem_handle_t_::read_only,
-                          LastDeviceWithValidAllocation, phWaitEvents,
-                          numWaitEvents));
+      UR_CALL(getZeHandleLocked(ZeHandleSrc, ur_mem_handle_t_::read_only,
+                                LastDeviceWithValidAllocation, phWaitEvents,
+                                numWaitEvents));
       // It's possible with the single root-device contexts that
       // the buffer is represented by the single root-device
       // allocation and then skip the copy to itself.
@@ -2281,6 +2587,8 @@ ur_result_t _ur_buffer::getZeHandle(char *&ZeHandle, access_mode_t AccessMode,
       if (Alloc.first != LastDeviceWithValidAllocation)
         Alloc.second.Valid = false;
     }
+    if (Device == LastDeviceWithValidAllocation)
+      ExclusiveDevice = Device;
   }
 
   logger::debug("getZeHandle(pi_device{{{}}}) = {}", (void *)Device,
@@ -2288,7 +2596,34 @@ ur_result_t _ur_buffer::getZeHandle(char *&ZeHandle, access_mode_t AccessMode,
   return UR_RESULT_SUCCESS;
 }
 
+char *_ur_buffer::getHostAccessibleZeHandle(ur_device_handle_t Device) {
+  if (SubBuffer || isFreed)
+    return nullptr;
+  auto It = Allocations.find(Device);
+  if (It == Allocations.end() || !It->second.Valid || !It->second.ZeHandle)
+    return nullptr;
+
+  auto &Allocation = It->second;
+  if (Allocation.ZeMemoryTypeHandle != Allocation.ZeHandle) {
+    ZeStruct<ze_memory_allocation_properties_t> ZeMemoryAllocationProperties;
+    ze_device_handle_t ZeDeviceHandle;
+    if (ZE_CALL_NOCHECK(zeMemGetAllocProperties,
+                        (UrContext->ZeContext, Allocation.ZeHandle,
+                         &ZeMemoryAllocationProperties, &ZeDeviceHandle)))
+      return nullptr;
+    Allocation.ZeMemoryType = ZeMemoryAllocationProperties.type;
+    Allocation.ZeMemoryTypeHandle = Allocation.ZeHandle;
+  }
+  if (Allocation.ZeMemoryType != ZE_MEMORY_TYPE_HOST &&
+      Allocation.ZeMemoryType != ZE_MEMORY_TYPE_SHARED)
+    return nullptr;
+  return Allocation.ZeHandle;
+}
+
 ur_result_t _ur_buffer::free() {
+  std::scoped_lock<ur_mutex> ZeHandleLock(ZeHandleMutex);
+  // Readers must not find the handles published before the release.
+  ValidEpoch.fetch_add(1, std::memory_order_acq_rel);
   for (auto &Alloc : Allocations) {
     auto &ZeHandle = Alloc.second.ZeHandle;
     // It is possible that the real allocation wasn't made if the buffer
@@ -2324,8 +2659,11 @@ ur_result_t _ur_buffer::free() {
       UR_CALL(ZeMemFreeHelper(UrContext, ZeHandle));
       break;
     case allocation_t::unimport:
-      ZeUSMImport.doZeUSMRelease(
-          UrContext->getPlatform()->ZeDriverHandleExpTranslated, ZeHandle);
+      // The host memory stays imported for the next buffers using it if
+      // UR_L0_USM_HOSTPTR_IMPORT_CACHE_SIZE allows.
+      ZeUSMImport.releaseHostPtr(
+          UrContext->getPlatform()->ZeDriverHandleExpTranslated, ZeHandle,
+          true);
       break;
     default:
       die("_ur_buffer::free(): Unhandled release action");
@@ -2364,11 +2702,14 @@ _ur_buffer::_ur_buffer(ur_context_handle_t Context, size_t Size, char *HostPtr,
 
   // This initialization does not end up with any valid allocation yet.
   LastDeviceWithValidAllocation = nullptr;
+  ValidHandles = std::make_unique<valid_handle_t[]>(Context->Devices.size());
 }
 
 _ur_buffer::_ur_buffer(ur_context_handle_t Context, ur_device_handle_t Device,
                        size_t Size)
-    : ur_mem_handle_t_(Context, Device), Size(Size) {}
+    : ur_mem_handle_t_(Context, Device), Size(Size) {
+  ValidHandles = std::make_unique<valid_handle_t[]>(Context->Devices.size());
+}
 
 // Interop-buffer constructor
 _ur_buffer::_ur_buffer(ur_context_handle_t Context, size_t Size,
@@ -2393,6 +2734,7 @@ _ur_buffer::_ur_buffer(ur_context_handle_t Context, size_t Size,
     }
   }
   LastDeviceWithValidAllocation = Device;
+  ValidHandles = std::make_unique<valid_handle_t[]>(Context->Devices.size());
 }
 
 ur_result_t _ur_buffer::getZeHandlePtr(char **&ZeHandlePtr,
@@ -2403,6 +2745,7 @@ ur_result_t _ur_buffer::getZeHandlePtr(char **&ZeHandlePtr,
   char *ZeHandle;
   UR_CALL(
       getZeHandle(ZeHandle, AccessMode, Device, phWaitEvents, numWaitEvents));
+  std::scoped_lock<ur_mutex> Lock(ZeHandleMutex);
   ZeHandlePtr = &Allocations[Device].ZeHandle;
   return UR_RESULT_SUCCESS;
 }
@@ -10,9 +10,11 @@
 #pragma once
 
 #include "common.hpp"
+#include <atomic>
 #include <cassert>
 #include <list>
 #include <map>
+#include <memory>
 #include <optional>
 #include <stdarg.h>
 #include <string>
@@ -136,6 +138,10 @@ struct _ur_buffer final : ur_mem_handle_t_ {
   bool isImage() const override { return false; }
   bool isSubBuffer() const { return SubBuffer != std::nullopt; }
 
+  // Returns the allocation of Device if it's valid and the host can access it
+  // as is, i.e. it's in host or shared USM, nullptr otherwise.
+  char *getHostAccessibleZeHandle(ur_device_handle_t Device);
+
   // Frees all allocations made for the buffer.
   ur_result_t free();
 
@@ -157,6 +163,10 @@ struct _ur_buffer final : ur_mem_handle_t_ {
       free,       // free from the pooling context (default)
       free_native // free with a native call
     } ReleaseAction{free};
+    // The type of the memory of ZeMemoryTypeHandle, so that it's only queried
+    // again once the allocation changes.
+    ze_memory_type_t ZeMemoryType{ZE_MEMORY_TYPE_UNKNOWN};
+    char *ZeMemoryTypeHandle{nullptr};
   };
 
   // We maintain multiple allocations on possibly all devices in the context.
@@ -165,6 +175,11 @@ struct _ur_buffer final : ur_mem_handle_t_ {
   std::unordered_map<ur_device_handle_t, allocation_t> Allocations;
   ur_device_handle_t LastDeviceWithValidAllocation{nullptr};
 
+  // The device with the only valid allocation since the last write, if the
+  // buffer wasn't accessed from another device since then. Its handle can be
+  // returned as is, nothing needs to be allocated, copied or invalidated.
+  ur_device_handle_t ExclusiveDevice{nullptr};
+
   // Flag to indicate that this memory is allocated in host memory.
   // Integrated device accesses this memory.
   bool OnHost{false};
@@ -183,6 +198,8 @@ struct _ur_buffer final : ur_mem_handle_t_ {
     size_t Offset;
     // The size of the mapped region.
     size_t Size;
+    // Whether the mapped region is the allocation of the buffer itself.
+    bool ZeroCopy = false;
   };
 
   // The key is the host pointer representing an active mapping.
@@ -198,6 +215,32 @@ struct _ur_buffer final : ur_mem_handle_t_ {
     size_t Origin;
   };
   std::optional<SubBuffer_t> SubBuffer;
+
+private:
+  // The body of getZeHandle, called with ZeHandleMutex held.
+  ur_result_t getZeHandleLocked(char *&ZeHandle, access_mode_t,
+                                ur_device_handle_t Device,
+                                const ur_event_handle_t *phWaitEvents,
+                                uint32_t numWaitEvents);
+
+  // Returns the index of Device in the devices of the context.
+  size_t getDeviceIndex(ur_device_handle_t Device) const;
+
+  // Serializes the allocation, copy and invalidation of the allocations.
+  ur_mutex ZeHandleMutex;
+
+  // Incremented before any access that may invalidate allocations, i.e.
+  // writes and the release of the buffer.
+  std::atomic<uint64_t> ValidEpoch{1};
+
+  // The allocation of a device of the context, published with the epoch it
+  // was known valid in. A read access finding the published epoch to still
+  // be the current one returns the handle without taking ZeHandleMutex.
+  struct valid_handle_t {
+    std::atomic<char *> ZeHandle{nullptr};
+    std::atomic<uint64_t> Epoch{0};
+  };
+  std::unique_ptr<valid_handle_t[]> ValidHandles;
 };
 
 struct _ur_image final : ur_mem_handle_t_ {
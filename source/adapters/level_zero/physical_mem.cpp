@@ -14,21 +14,48 @@
 #include "device.hpp"
 #include "ur_level_zero.hpp"
 
+const size_t PhysicalMemPoolSize =
+    getenv_to_unsigned("UR_L0_PHYSICAL_MEM_POOL_SIZE_MB").value_or(256) *
+    1024 * 1024;
+
+size_t trimPhysicalMemPool(ur_context_handle_t Context, size_t BytesToKeep) {
+  auto Destroy = [Context](ze_device_handle_t, ze_physical_mem_handle_t Mem) {
+    ZE_CALL_NOCHECK(zePhysicalMemDestroy, (Context->ZeContext, Mem));
+  };
+  return Context->PhysicalMemPool.trim(BytesToKeep, Destroy);
+}
+
 namespace ur::level_zero {
 
 ur_result_t urPhysicalMemCreate(
     ur_context_handle_t hContext, ur_device_handle_t hDevice, size_t size,
     [[maybe_unused]] const ur_physical_mem_properties_t *pProperties,
     ur_physical_mem_handle_t *phPhysicalMem) {
-  ZeStruct<ze_physical_mem_desc_t> PhysicalMemDesc;
-  PhysicalMemDesc.flags = 0;
-  PhysicalMemDesc.size = size;
-
   ze_physical_mem_handle_t ZePhysicalMem;
-  ZE2UR_CALL(zePhysicalMemCreate, (hContext->ZeContext, hDevice->ZeDevice,
-                                   &PhysicalMemDesc, &ZePhysicalMem));
+  if (auto Pooled =
+          hContext->PhysicalMemPool.acquire(hDevice->ZeDevice, size)) {
+    ZePhysicalMem = *Pooled;
+  } else {
+    ZeStruct<ze_physical_mem_desc_t> PhysicalMemDesc;
+    PhysicalMemDesc.flags = 0;
+    PhysicalMemDesc.size = size;
+
+    auto ZeResult = ZE_CALL_NOCHECK(zePhysicalMemCreate,
+                                    (hContext->ZeContext, hDevice->ZeDevice,
+                                     &PhysicalMemDesc, &ZePhysicalMem));
+    // Give the pooled memory of the other sizes back to the driver and retry
+    if (ZeResult == ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY &&
+        trimPhysicalMemPool(hContext, 0) > 0) {
+      ZeResult = ZE_CALL_NOCHECK(zePhysicalMemCreate,
+                                 (hContext->ZeContext, hDevice->ZeDevice,
+                                  &PhysicalMemDesc, &ZePhysicalMem));
+    }
+    if (ZeResult != ZE_RESULT_SUCCESS)
+      return ze2urResult(ZeResult);
+  }
   try {
-    *phPhysicalMem = new ur_physical_mem_handle_t_(ZePhysicalMem, hContext);
+    *phPhysicalMem = new ur_physical_mem_handle_t_(ZePhysicalMem, hContext,
+                                                   hDevice->ZeDevice, size);
   } catch (const std::bad_alloc &) {
     return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
   } catch (...) {
@@ -46,8 +73,13 @@ ur_result_t urPhysicalMemRelease(ur_physical_mem_handle_t hPhysicalMem) {
   if (!hPhysicalMem->RefCount.decrementAndTest())
     return UR_RESULT_SUCCESS;
 
-  ZE2UR_CALL(zePhysicalMemDestroy,
-             (hPhysicalMem->Context->ZeContext, hPhysicalMem->ZePhysicalMem));
+  // The mappings of sparse resources come and go, keep the memory for the
+  // next ones.
+  if (!hPhysicalMem->Context->PhysicalMemPool.release(
+          hPhysicalMem->ZeDevice, hPhysicalMem->Size,
+          hPhysicalMem->ZePhysicalMem))
+    ZE2UR_CALL(zePhysicalMemDestroy, (hPhysicalMem->Context->ZeContext,
+                                      hPhysicalMem->ZePhysicalMem));
   delete hPhysicalMem;
 
   return UR_RESULT_SUCCESS;
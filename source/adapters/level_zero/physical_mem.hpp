@@ -10,15 +10,33 @@
 #pragma once
 
 #include "common.hpp"
+#include "ur_physical_mem_pool.hpp"
 
 struct ur_physical_mem_handle_t_ : _ur_object {
   ur_physical_mem_handle_t_(ze_physical_mem_handle_t ZePhysicalMem,
-                            ur_context_handle_t Context)
-      : ZePhysicalMem{ZePhysicalMem}, Context{Context} {}
+                            ur_context_handle_t Context,
+                            ze_device_handle_t ZeDevice, size_t Size)
+      : ZePhysicalMem{ZePhysicalMem}, Context{Context}, ZeDevice{ZeDevice},
+        Size{Size} {}
 
   // Level Zero physical memory handle.
   ze_physical_mem_handle_t ZePhysicalMem;
 
   // Keeps the PI context of this memory handle.
   ur_context_handle_t Context;
+
+  // The device and size the memory was created with, to pool it on release.
+  ze_device_handle_t ZeDevice;
+  size_t Size;
 };
+
+using ur_physical_mem_pool_t =
+    ur::physical_mem_pool_t<ze_device_handle_t, ze_physical_mem_handle_t>;
+
+// The number of bytes of physical memory each context pools, set by
+// UR_L0_PHYSICAL_MEM_POOL_SIZE_MB (256 by default), 0 disables the pools.
+extern const size_t PhysicalMemPoolSize;
+
+// Destroys the physical memory pooled by Context past BytesToKeep bytes,
+// returns the number of bytes destroyed.
+size_t trimPhysicalMemPool(ur_context_handle_t Context, size_t BytesToKeep);
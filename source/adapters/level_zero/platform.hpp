@@ -9,7 +9,11 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <deque>
+#include <set>
+
 #include "common.hpp"
+#include "ur_peer_topology.hpp"
 #include "ur_api.h"
 #include "ze_api.h"
 #include "zes_api.h"
@@ -65,6 +69,9 @@ struct ur_platform_handle_t_ : public _ur_platform {
   ur_shared_mutex URDevicesCacheMutex;
   bool DeviceCachePopulated = false;
 
+  // The links between the devices, for the P2P link and copy route queries
+  ur::peer_topology_t PeerTopology;
+
   // Check the device cache and load it if necessary.
   ur_result_t populateDeviceCacheIfNeeded();
 
@@ -89,6 +96,32 @@ struct ur_platform_handle_t_ : public _ur_platform {
   std::list<ur_context_handle_t> Contexts;
   ur_shared_mutex ContextsMutex;
 
+  // Each submission of a kernel with indirect access takes the next epoch,
+  // and the allocations freed while submissions are in flight are freed only
+  // once all the submissions up to the epoch of their free have completed, so
+  // that a submission costs the same however many allocations are live.
+  // Guarded by ContextsMutex.
+  uint64_t IndirectAccessEpoch = 0;
+  std::set<uint64_t> IndirectAccessEpochsInFlight;
+  struct DeferredFree {
+    uint64_t Epoch;
+    ur_context_handle_t Context;
+    void *Ptr;
+    // Whether Ptr is freed with zeMemFree rather than by its UMF pool.
+    bool ZeMemFree;
+  };
+  // In the order of their epochs.
+  std::deque<DeferredFree> DeferredFrees;
+
+  // The internal contexts which own the USM pools shared by the contexts on
+  // each Level Zero context, see ur_context_handle_t_::SharedPoolsOwner. The
+  // one at nullptr owns the Level Zero context of the contexts created by
+  // urContextCreate. All the retains and releases of these contexts hold
+  // SharedPoolsMutex.
+  std::unordered_map<ze_context_handle_t, ur_context_handle_t>
+      SharedPoolsOwners;
+  ur_mutex SharedPoolsMutex;
+
   // Structure with function pointers for mutable command list extension.
   // Not all drivers may support it, so considering that the platform object is
   // associated with particular Level Zero driver, store this extension here.
@@ -10,8 +10,14 @@
 
 #include "program.hpp"
 #include "device.hpp"
+#include "helpers/module_cache.hpp"
 #include "logger/ur_logger.hpp"
 #include "ur_interface_loader.hpp"
+#include "ur_util.hpp"
+
+#include <atomic>
+#include <functional>
+#include <thread>
 
 #ifdef UR_ADAPTER_LEVEL_ZERO_V2
 #include "v2/context.hpp"
@@ -57,6 +63,180 @@ checkUnresolvedSymbols(ze_module_handle_t ZeModule,
 
 namespace ur::level_zero {
 
+namespace {
+// The module of one of the devices of urProgramBuildExp, built by one of
+// the threads of forEachParallel.
+struct DeviceBuild {
+  ur_device_handle_t hDevice = nullptr;
+  // The build of an identical device whose native binary is loaded instead
+  // of building this one, if any.
+  const DeviceBuild *Leader = nullptr;
+  ze_module_handle_t ZeModule = nullptr;
+  ze_module_build_log_handle_t ZeBuildLog = nullptr;
+  std::string CacheKey;
+  bool FromCache = false;
+  ur_result_t Result = UR_RESULT_SUCCESS;
+};
+} // namespace
+
+// The number of modules built at once by urProgramBuildExp, the number of
+// hardware threads by default, 1 builds them one after the other.
+static const size_t ProgramBuildThreads = [] {
+  auto Threads = getenv_to_unsigned("UR_L0_PROGRAM_BUILD_THREADS");
+  return Threads ? std::max<size_t>(*Threads, 1)
+                 : std::max(std::thread::hardware_concurrency(), 1u);
+}();
+
+// Calls Fn for 0 up to Count on at most ProgramBuildThreads threads.
+static void forEachParallel(size_t Count,
+                            const std::function<void(size_t)> &Fn) {
+  size_t NumThreads = std::min(Count, ProgramBuildThreads);
+  if (NumThreads <= 1) {
+    for (size_t i = 0; i < Count; i++)
+      Fn(i);
+    return;
+  }
+  std::atomic<size_t> Next = 0;
+  auto Run = [&]() {
+    for (size_t i = Next++; i < Count; i = Next++)
+      Fn(i);
+  };
+  std::vector<std::thread> Threads;
+  for (size_t i = 1; i < NumThreads; i++)
+    Threads.emplace_back(Run);
+  Run();
+  for (auto &Thread : Threads)
+    Thread.join();
+}
+
+// Devices with the same device id, of the same driver, run the same native
+// binaries.
+static bool isIdenticalDevice(ur_device_handle_t hDevice,
+                              ur_device_handle_t hOther) {
+  return hDevice->Platform == hOther->Platform &&
+         hDevice->ZeDeviceProperties->vendorId ==
+             hOther->ZeDeviceProperties->vendorId &&
+         hDevice->ZeDeviceProperties->deviceId ==
+             hOther->ZeDeviceProperties->deviceId;
+}
+
+// Loads the native binary of the module of Build.Leader on Build.hDevice.
+// Returns false if it can't, e.g. if the leader failed to build, in which
+// case the module is built from the code of the program.
+static bool loadLeaderModule(ze_context_handle_t ZeContext,
+                             const std::string &ZeBuildOptions,
+                             DeviceBuild &Build) {
+  if (!Build.Leader->ZeModule)
+    return false;
+  size_t Size = 0;
+  if (ZE_CALL_NOCHECK(zeModuleGetNativeBinary,
+                      (Build.Leader->ZeModule, &Size, nullptr)))
+    return false;
+  std::vector<uint8_t> Binary(Size);
+  if (ZE_CALL_NOCHECK(zeModuleGetNativeBinary,
+                      (Build.Leader->ZeModule, &Size, Binary.data())))
+    return false;
+
+  ZeStruct<ze_module_desc_t> ZeNativeModuleDesc;
+  ZeNativeModuleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+  ZeNativeModuleDesc.inputSize = Size;
+  ZeNativeModuleDesc.pInputModule = Binary.data();
+  ZeNativeModuleDesc.pBuildFlags = ZeBuildOptions.c_str();
+  if (ZE_CALL_NOCHECK(zeModuleCreate,
+                      (ZeContext, Build.hDevice->ZeDevice, &ZeNativeModuleDesc,
+                       &Build.ZeModule, &Build.ZeBuildLog))) {
+    if (Build.ZeModule)
+      ZE_CALL_NOCHECK(zeModuleDestroy, (Build.ZeModule));
+    if (Build.ZeBuildLog)
+      ZE_CALL_NOCHECK(zeModuleBuildLogDestroy, (Build.ZeBuildLog));
+    Build.ZeModule = nullptr;
+    Build.ZeBuildLog = nullptr;
+    return false;
+  }
+  return true;
+}
+
+// Creates ZeModule from the native binary in the module cache for Key.
+// Returns false if there is none, or if the driver rejects it, e.g. a stale
+// binary, in which case the module is built from IL instead.
+static bool createCachedModule(ze_context_handle_t ZeContext,
+                               ze_device_handle_t ZeDevice,
+                               const std::string &Key, const char *BuildFlags,
+                               ze_module_handle_t &ZeModule,
+                               ze_module_build_log_handle_t &ZeBuildLog) {
+  ur::cached_binary_t CachedBinary;
+  if (!loadCachedModule(Key, CachedBinary))
+    return false;
+
+  ZeStruct<ze_module_desc_t> ZeCachedModuleDesc;
+  ZeCachedModuleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+  ZeCachedModuleDesc.inputSize = CachedBinary.size();
+  ZeCachedModuleDesc.pInputModule = CachedBinary.data();
+  ZeCachedModuleDesc.pBuildFlags = BuildFlags;
+  if (ZE_CALL_NOCHECK(zeModuleCreate, (ZeContext, ZeDevice, &ZeCachedModuleDesc,
+                                       &ZeModule, &ZeBuildLog)) ==
+      ZE_RESULT_SUCCESS)
+    return true;
+
+  if (ZeModule)
+    ZE_CALL_NOCHECK(zeModuleDestroy, (ZeModule));
+  if (ZeBuildLog)
+    ZE_CALL_NOCHECK(zeModuleBuildLogDestroy, (ZeBuildLog));
+  ZeModule = nullptr;
+  ZeBuildLog = nullptr;
+  return false;
+}
+
+// Builds the module of Build.hDevice from the code of hProgram, or takes it
+// from the module cache, or loads the native binary of Build.Leader. Only
+// reads hProgram, the results are stored in it by the caller.
+static void buildModule(ur_program_handle_t hProgram,
+                        ze_context_handle_t ZeContext,
+                        const ze_module_desc_t &ZeModuleDesc,
+                        const std::string &ZeBuildOptions,
+                        DeviceBuild &Build) {
+  ze_device_handle_t ZeDevice = Build.hDevice->ZeDevice;
+  auto &ZeModuleHandle = Build.ZeModule;
+  auto &ZeBuildLog = Build.ZeBuildLog;
+
+  // Modules built from IL may be in the persistent cache, loading their
+  // native binary skips the JIT.
+  if (ZeModuleDesc.format == ZE_MODULE_FORMAT_IL_SPIRV)
+    Build.CacheKey = getModuleCacheKey(hProgram, Build.hDevice, ZeBuildOptions);
+  ZeModuleHandle = takeReusableModule(ZeContext, Build.CacheKey);
+  Build.FromCache =
+      ZeModuleHandle ||
+      createCachedModule(ZeContext, ZeDevice, Build.CacheKey,
+                         ZeBuildOptions.c_str(), ZeModuleHandle, ZeBuildLog);
+
+  bool Loaded =
+      Build.FromCache ||
+      (Build.Leader && loadLeaderModule(ZeContext, ZeBuildOptions, Build));
+  ze_result_t ZeResult =
+      Loaded ? ZE_RESULT_SUCCESS
+             : ZE_CALL_NOCHECK(zeModuleCreate,
+                               (ZeContext, ZeDevice, &ZeModuleDesc,
+                                &ZeModuleHandle, &ZeBuildLog));
+  if (ZeResult != ZE_RESULT_SUCCESS) {
+    Build.Result = ze2urResult(ZeResult);
+  } else {
+    // The call to zeModuleCreate does not report an error if there are
+    // unresolved symbols because it thinks these could be resolved later via
+    // a call to zeModuleDynamicLink.  However, modules created with
+    // urProgramBuild are supposed to be fully linked and ready to use.
+    // Therefore, do an extra check now for unresolved symbols.
+    ZeResult = checkUnresolvedSymbols(ZeModuleHandle, &ZeBuildLog);
+    if (ZeResult != ZE_RESULT_SUCCESS)
+      Build.Result = (ZeResult == ZE_RESULT_ERROR_MODULE_LINK_FAILURE)
+                         ? UR_RESULT_ERROR_PROGRAM_BUILD_FAILURE
+                         : ze2urResult(ZeResult);
+  }
+  if (Build.Result != UR_RESULT_SUCCESS && ZeModuleHandle) {
+    ZE_CALL_NOCHECK(zeModuleDestroy, (ZeModuleHandle));
+    ZeModuleHandle = nullptr;
+  }
+}
+
 ur_result_t urProgramCreateWithIL(
     ur_context_handle_t Context, ///< [in] handle of the context instance
     const void *IL,              ///< [in] pointer to IL binary.
@@ -163,7 +343,7 @@ ur_result_t urProgramBuildExp(
                             : ZE_MODULE_FORMAT_NATIVE;
 
   ZeModuleDesc.inputSize = hProgram->CodeLength;
-  ZeModuleDesc.pInputModule = hProgram->Code.get();
+  ZeModuleDesc.pInputModule = hProgram->Code;
 
   // if large allocations are selected, then pass
   // ze-opt-greater-than-4GB-buffer-required to disable
@@ -180,51 +360,60 @@ ur_result_t urProgramBuildExp(
 
   ZeModuleDesc.pBuildFlags = ZeBuildOptions.c_str();
   ZeModuleDesc.pConstants = Shim.ze();
-  ur_result_t Result = UR_RESULT_SUCCESS;
+  ze_context_handle_t ZeContext = hProgram->Context->getZeHandle();
 
+  // Identical devices, with the same device id and driver, load the native
+  // binary of the first of them instead of building it again.
+  std::vector<DeviceBuild> Builds(numDevices);
+  std::vector<DeviceBuild *> Leaders;
+  std::vector<DeviceBuild *> Followers;
   for (uint32_t i = 0; i < numDevices; i++) {
-    ze_device_handle_t ZeDevice = phDevices[i]->ZeDevice;
-    ze_context_handle_t ZeContext = hProgram->Context->getZeHandle();
-    ze_module_handle_t ZeModuleHandle = nullptr;
-    ze_module_build_log_handle_t ZeBuildLog{};
-
-    hProgram->State = ur_program_handle_t_::Exe;
-    ze_result_t ZeResult =
-        ZE_CALL_NOCHECK(zeModuleCreate, (ZeContext, ZeDevice, &ZeModuleDesc,
-                                         &ZeModuleHandle, &ZeBuildLog));
-    if (ZeResult != ZE_RESULT_SUCCESS) {
+    auto &Build = Builds[i];
+    Build.hDevice = phDevices[i];
+    if (ZeModuleDesc.format == ZE_MODULE_FORMAT_IL_SPIRV) {
+      for (auto Leader : Leaders) {
+        if (isIdenticalDevice(Leader->hDevice, Build.hDevice)) {
+          Build.Leader = Leader;
+          break;
+        }
+      }
+    }
+    (Build.Leader ? Followers : Leaders).push_back(&Build);
+  }
+
+  forEachParallel(Leaders.size(), [&](size_t i) {
+    buildModule(hProgram, ZeContext, ZeModuleDesc, ZeBuildOptions,
+                *Leaders[i]);
+  });
+  forEachParallel(Followers.size(), [&](size_t i) {
+    buildModule(hProgram, ZeContext, ZeModuleDesc, ZeBuildOptions,
+                *Followers[i]);
+  });
+
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  hProgram->State = ur_program_handle_t_::Exe;
+  for (auto &Build : Builds) {
+    ze_device_handle_t ZeDevice = Build.hDevice->ZeDevice;
+    if (Build.Result != UR_RESULT_SUCCESS) {
       // We adjust ur_program below to avoid attempting to release zeModule when
       // RT calls urProgramRelease().
       hProgram->State = ur_program_handle_t_::Invalid;
-      Result = ze2urResult(ZeResult);
-      if (ZeModuleHandle) {
-        ZE_CALL_NOCHECK(zeModuleDestroy, (ZeModuleHandle));
-        ZeModuleHandle = nullptr;
-      }
-    } else {
-      // The call to zeModuleCreate does not report an error if there are
-      // unresolved symbols because it thinks these could be resolved later via
-      // a call to zeModuleDynamicLink.  However, modules created with
-      // urProgramBuild are supposed to be fully linked and ready to use.
-      // Therefore, do an extra check now for unresolved symbols.
-      ZeResult = checkUnresolvedSymbols(ZeModuleHandle, &ZeBuildLog);
-      if (ZeResult != ZE_RESULT_SUCCESS) {
-        hProgram->State = ur_program_handle_t_::Invalid;
-        Result = (ZeResult == ZE_RESULT_ERROR_MODULE_LINK_FAILURE)
-                     ? UR_RESULT_ERROR_PROGRAM_BUILD_FAILURE
-                     : ze2urResult(ZeResult);
-        if (ZeModuleHandle) {
-          ZE_CALL_NOCHECK(zeModuleDestroy, (ZeModuleHandle));
-          ZeModuleHandle = nullptr;
-        }
-      }
-      hProgram->ZeModuleMap.insert(std::make_pair(ZeDevice, ZeModuleHandle));
+      Result = Build.Result;
+    } else if (!Build.CacheKey.empty()) {
+      if (!Build.FromCache)
+        storeCachedModule(Build.CacheKey, Build.ZeModule);
+      hProgram->ZeModuleKeys[ZeDevice] = Build.CacheKey;
     }
-    hProgram->ZeBuildLogMap.insert(std::make_pair(ZeDevice, ZeBuildLog));
+    if (Build.ZeModule)
+      hProgram->ZeModuleMap.insert(std::make_pair(ZeDevice, Build.ZeModule));
+    // Reused modules have no build log.
+    if (Build.ZeBuildLog)
+      hProgram->ZeBuildLogMap.insert(
+          std::make_pair(ZeDevice, Build.ZeBuildLog));
   }
 
   // We no longer need the IL / native code.
-  hProgram->Code.reset();
+  hProgram->Code = nullptr;
   if (!hProgram->ZeModuleMap.empty())
     hProgram->ZeModule = hProgram->ZeModuleMap.begin()->second;
   if (!hProgram->ZeBuildLogMap.empty())
@@ -376,7 +565,7 @@ ur_result_t urProgramLinkExp(
     for (uint32_t I = 0; I < count; I++) {
       ur_program_handle_t Program = phPrograms[I];
       CodeSizes[I] = Program->CodeLength;
-      CodeBufs[I] = Program->Code.get();
+      CodeBufs[I] = Program->Code;
       BuildFlagPtrs[I] = Program->BuildFlags.c_str();
       SpecConstShims.emplace_back(Program);
       SpecConstPtrs[I] = SpecConstShims[I].ze();
@@ -433,17 +622,28 @@ ur_result_t urProgramLinkExp(
     std::unordered_map<ze_device_handle_t, ze_module_handle_t> ZeModuleMap;
     std::unordered_map<ze_device_handle_t, ze_module_build_log_handle_t>
         ZeBuildLogMap;
+    std::unordered_map<ze_device_handle_t, std::string> ZeModuleKeys;
 
     for (uint32_t i = 0; i < numDevices; i++) {
 
-      // Call the Level Zero API to compile, link, and create the module.
+      // Call the Level Zero API to compile, link, and create the module,
+      // unless the same programs were linked before: the module is then
+      // reused, or loaded from the native binary in the module cache.
       ze_device_handle_t ZeDevice = phDevices[i]->ZeDevice;
       ze_context_handle_t ZeContext = hContext->getZeHandle();
       ze_module_handle_t ZeModule = nullptr;
       ze_module_build_log_handle_t ZeBuildLog = nullptr;
+      std::string CacheKey =
+          getLinkedModuleCacheKey(phPrograms, count, phDevices[i], "");
+      ZeModule = takeReusableModule(ZeContext, CacheKey);
+      bool FromCache = ZeModule || createCachedModule(ZeContext, ZeDevice,
+                                                      CacheKey, "", ZeModule,
+                                                      ZeBuildLog);
       ze_result_t ZeResult =
-          ZE_CALL_NOCHECK(zeModuleCreate, (ZeContext, ZeDevice, &ZeModuleDesc,
-                                           &ZeModule, &ZeBuildLog));
+          FromCache ? ZE_RESULT_SUCCESS
+                    : ZE_CALL_NOCHECK(zeModuleCreate,
+                                      (ZeContext, ZeDevice, &ZeModuleDesc,
+                                       &ZeModule, &ZeBuildLog));
 
       // We still create a ur_program_handle_t_ object even if there is a
       // BUILD_FAILURE because we need the object to hold the ZeBuildLog.  There
@@ -466,20 +666,28 @@ ur_result_t urProgramLinkExp(
         if (ZeResult != ZE_RESULT_SUCCESS) {
           return ze2urResult(ZeResult);
         }
+        if (!CacheKey.empty()) {
+          if (!FromCache)
+            storeCachedModule(CacheKey, ZeModule);
+          ZeModuleKeys[ZeDevice] = CacheKey;
+        }
       }
       ZeModuleMap.insert(std::make_pair(ZeDevice, ZeModule));
-      ZeBuildLogMap.insert(std::make_pair(ZeDevice, ZeBuildLog));
+      // Reused modules have no build log.
+      if (ZeBuildLog)
+        ZeBuildLogMap.insert(std::make_pair(ZeDevice, ZeBuildLog));
     }
 
     ur_program_handle_t_::state State = (UrResult == UR_RESULT_SUCCESS)
                                             ? ur_program_handle_t_::Exe
                                             : ur_program_handle_t_::Invalid;
-    ur_program_handle_t_ *UrProgram =
-        new ur_program_handle_t_(State, hContext, ZeModuleMap.begin()->second,
-                                 ZeBuildLogMap.begin()->second);
+    ur_program_handle_t_ *UrProgram = new ur_program_handle_t_(
+        State, hContext, ZeModuleMap.begin()->second,
+        ZeBuildLogMap.empty() ? nullptr : ZeBuildLogMap.begin()->second);
     *phProgram = reinterpret_cast<ur_program_handle_t>(UrProgram);
     (*phProgram)->ZeModuleMap = std::move(ZeModuleMap);
     (*phProgram)->ZeBuildLogMap = std::move(ZeBuildLogMap);
+    (*phProgram)->ZeModuleKeys = std::move(ZeModuleKeys);
   } catch (const std::bad_alloc &) {
     return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
   } catch (...) {
@@ -724,7 +932,7 @@ ur_result_t urProgramGetInfo(
       if (PropSizeRet)
         *PropSizeRet = Program->CodeLength;
       if (PBinary) {
-        std::memcpy(PBinary[0], Program->Code.get(), Program->CodeLength);
+        std::memcpy(PBinary[0], Program->Code, Program->CodeLength);
       }
     } else if (Program->State == ur_program_handle_t_::Exe) {
       // If the caller is using a Program which is a built binary, then
@@ -817,7 +1025,7 @@ ur_result_t urProgramGetInfo(
       return UR_RESULT_ERROR_UNKNOWN;
     }
   case UR_PROGRAM_INFO_SOURCE:
-    return ReturnValue(Program->Code.get());
+    return ReturnValue(Program->Code);
   default:
     return UR_RESULT_ERROR_INVALID_ENUMERATION;
   }
@@ -991,12 +1199,24 @@ ur_result_t urProgramSetSpecializationConstants(
   for (uint32_t SpecIt = 0; SpecIt < Count; SpecIt++) {
     uint32_t SpecId = SpecConstants[SpecIt].id;
     Program->SpecConstants[SpecId] = SpecConstants[SpecIt].pValue;
+    Program->SpecConstantSizes[SpecId] = SpecConstants[SpecIt].size;
   }
   return UR_RESULT_SUCCESS;
 }
 
 } // namespace ur::level_zero
 
+void ur_program_handle_t_::getKernelProperties(
+    const std::string &Name, ze_kernel_handle_t ZeKernel,
+    ze_kernel_properties_t &Properties) {
+  std::lock_guard<std::mutex> Lock(KernelPropertiesMutex);
+  auto [It, Inserted] = KernelProperties.try_emplace(Name);
+  if (Inserted) {
+    ZE_CALL_NOCHECK(zeKernelGetProperties, (ZeKernel, &It->second));
+  }
+  Properties = It->second;
+}
+
 ur_program_handle_t_::~ur_program_handle_t_() {
   if (!resourcesReleased) {
     ur_release_program_resources(true);
@@ -1023,6 +1243,11 @@ void ur_program_handle_t_::ur_release_program_resources(bool deletion) {
         ZE_CALL_NOCHECK(zeModuleDestroy, (ZeModule));
       } else {
         for (auto &ZeModulePair : this->ZeModuleMap) {
+          auto KeyIt = ZeModuleKeys.find(ZeModulePair.first);
+          if (KeyIt != ZeModuleKeys.end() &&
+              keepReusableModule(Context->getZeHandle(), KeyIt->second,
+                                 ZeModulePair.second))
+            continue;
           ZE_CALL_NOCHECK(zeModuleDestroy, (ZeModulePair.second));
         }
         this->ZeModuleMap.clear();
@@ -69,10 +69,9 @@ struct ur_program_handle_t_ : _ur_object {
   ur_program_handle_t_(state St, ur_context_handle_t Context, const void *Input,
                        size_t Length)
       : Context{Context}, NativeDevice{nullptr}, NativeProperties{nullptr},
-        OwnZeModule{true}, State{St}, Code{new uint8_t[Length]},
-        CodeLength{Length}, ZeModule{nullptr}, ZeBuildLog{nullptr} {
-    std::memcpy(Code.get(), Input, Length);
-  }
+        OwnZeModule{true}, State{St},
+        Code{static_cast<const uint8_t *>(Input)}, CodeLength{Length},
+        ZeModule{nullptr}, ZeBuildLog{nullptr} {}
 
   // Construct a program in NATIVE.
   ur_program_handle_t_(state St, ur_context_handle_t Context,
@@ -80,10 +79,9 @@ struct ur_program_handle_t_ : _ur_object {
                        const ur_program_properties_t *Properties,
                        const void *Input, size_t Length)
       : Context{Context}, NativeDevice(Device), NativeProperties(Properties),
-        OwnZeModule{true}, State{St}, Code{new uint8_t[Length]},
-        CodeLength{Length}, ZeModule{nullptr}, ZeBuildLog{nullptr} {
-    std::memcpy(Code.get(), Input, Length);
-  }
+        OwnZeModule{true}, State{St},
+        Code{static_cast<const uint8_t *>(Input)}, CodeLength{Length},
+        ZeModule{nullptr}, ZeBuildLog{nullptr} {}
 
   // Construct a program in Exe or Invalid state.
   ur_program_handle_t_(state St, ur_context_handle_t Context,
@@ -139,15 +137,23 @@ struct ur_program_handle_t_ : _ur_object {
   state State;
 
   // In IL and Object states, this contains the SPIR-V representation of the
-  // module.  In Native state, it contains the native code.
-  std::unique_ptr<uint8_t[]> Code; // Array containing raw IL / native code.
-  size_t CodeLength{0};            // Size (bytes) of the array.
+  // module.  In Native state, it contains the native code.  It points to the
+  // memory passed to urProgramCreateWithIL/Binary, which the caller keeps
+  // valid until the program is released, not to a copy of it.
+  const uint8_t *Code{nullptr}; // Array containing raw IL / native code.
+  size_t CodeLength{0};         // Size (bytes) of the array.
 
   // Used only in IL and Object states.  Contains the SPIR-V specialization
   // constants as a map from the SPIR-V "SpecID" to a buffer that contains the
   // associated value.  The caller of the PI layer is responsible for
   // maintaining the storage of this buffer.
   std::unordered_map<uint32_t, const void *> SpecConstants;
+  // The sizes of the values of SpecConstants, to key the module cache.
+  std::unordered_map<uint32_t, size_t> SpecConstantSizes;
+
+  // The module cache keys of the modules in ZeModuleMap, which are kept to be
+  // reused once the program is released.
+  std::unordered_map<ze_device_handle_t, std::string> ZeModuleKeys;
 
   // Used only in Object state.  Contains the build flags from the last call to
   // urProgramCompile().
@@ -167,4 +173,17 @@ struct ur_program_handle_t_ : _ur_object {
   // Program has been built.
   std::unordered_map<ze_device_handle_t, ze_module_build_log_handle_t>
       ZeBuildLogMap;
+
+  // The properties of the kernels of the program by name, the same for all
+  // the kernels created for a name, so they are only queried from the first
+  // one. Guarded by KernelPropertiesMutex as urKernelCreate only holds Mutex
+  // shared.
+  std::mutex KernelPropertiesMutex;
+  std::unordered_map<std::string, ZeStruct<ze_kernel_properties_t>>
+      KernelProperties;
+
+  // Sets Properties to the properties of the kernel Name, queried from
+  // ZeKernel, one of its L0 kernels, the first time.
+  void getKernelProperties(const std::string &Name, ze_kernel_handle_t ZeKernel,
+                           ze_kernel_properties_t &Properties);
 };
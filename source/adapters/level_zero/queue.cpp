@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <climits>
 #include <cstdint>
+#include <cstring>
 #include <optional>
 #include <string.h>
 #include <vector>
@@ -18,6 +19,7 @@
 #include "adapter.hpp"
 #include "common.hpp"
 #include "event.hpp"
+#include "latency_tracker.hpp"
 #include "queue.hpp"
 #include "ur_interface_loader.hpp"
 #include "ur_level_zero.hpp"
@@ -342,6 +344,119 @@ ur_result_t resetCommandLists(ur_queue_handle_t Queue) {
   return UR_RESULT_SUCCESS;
 }
 
+std::unique_ptr<EventCleanupThread> EventCleanupThread::create() {
+  static const bool Enabled =
+      getenv_to_unsigned("UR_L0_EVENT_CLEANUP_THREAD").value_or(0);
+  static const uint64_t IntervalUs =
+      getenv_to_unsigned("UR_L0_EVENT_CLEANUP_THREAD_INTERVAL_US")
+          .value_or(1000);
+  // Reclaiming the events may release the memory referenced by kernels,
+  // which takes the lock of the contexts of the platform. That lock can be
+  // held by whoever is destroying the context and waiting for the thread.
+  if (!Enabled || IndirectAccessTrackingEnabled)
+    return nullptr;
+
+  return std::make_unique<EventCleanupThread>(
+      std::chrono::microseconds(std::max<uint64_t>(IntervalUs, 1)));
+}
+
+EventCleanupThread::EventCleanupThread(std::chrono::microseconds Interval)
+    : Interval(Interval) {
+  Thread = std::thread(&EventCleanupThread::run, this);
+}
+
+EventCleanupThread::~EventCleanupThread() {
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    Stop = true;
+  }
+  Wakeup.notify_one();
+  Thread.join();
+}
+
+void EventCleanupThread::enqueue(ur_queue_handle_t Queue,
+                                 std::vector<ur_event_handle_t> &Events) {
+  // The events hold the queue, but the last of them may be released before
+  // the thread is done with the batch
+  Queue->RefCount.increment();
+  auto *Batch = new batch_t{Queue, std::move(Events), nullptr};
+  Events.clear();
+
+  auto *Head = Pending.load(std::memory_order_relaxed);
+  do {
+    Batch->Next = Head;
+  } while (!Pending.compare_exchange_weak(Head, Batch,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed));
+  // A notification racing with the thread going to sleep can be lost, the
+  // batch is then picked up at the next interval
+  if (!Head)
+    Wakeup.notify_one();
+}
+
+bool EventCleanupThread::cleanup(batch_t &Batch, bool Wait) {
+  std::vector<ur_event_handle_t> EventListToCleanup;
+  auto It = Batch.Events.begin();
+  for (; It != Batch.Events.end(); ++It) {
+    auto Event = *It;
+    bool Completed;
+    {
+      std::scoped_lock<ur_shared_mutex> EventLock(Event->Mutex);
+      Completed = Event->Completed ||
+                  ZE_CALL_NOCHECK(zeEventQueryStatus, (Event->ZeEvent)) ==
+                      ZE_RESULT_SUCCESS;
+    }
+    if (!Completed && Wait) {
+      ZE_CALL_NOCHECK(zeEventHostSynchronize, (Event->ZeEvent, UINT64_MAX));
+      Completed = true;
+    }
+    // The events of a command list mostly complete in the order they were
+    // submitted, the next ones are checked at the next interval
+    if (!Completed)
+      break;
+    EventListToCleanup.push_back(Event);
+  }
+  Batch.Events.erase(Batch.Events.begin(), It);
+
+  auto Result = CleanupEventListFromResetCmdList(EventListToCleanup, false);
+  if (Result != UR_RESULT_SUCCESS)
+    logger::error("Event cleanup thread failed to clean up events: {}",
+                  Result);
+  return Batch.Events.empty();
+}
+
+void EventCleanupThread::run() {
+  std::list<batch_t *> Batches;
+  bool Stopping = false;
+  while (!Stopping) {
+    {
+      std::unique_lock<std::mutex> Lock(Mutex);
+      Wakeup.wait_for(Lock, Interval, [this] {
+        return Stop || Pending.load(std::memory_order_relaxed);
+      });
+      Stopping = Stop;
+    }
+
+    // The stack has the newest batch first
+    auto *Batch = Pending.exchange(nullptr, std::memory_order_acquire);
+    auto InsertAt = Batches.end();
+    for (; Batch; Batch = Batch->Next)
+      InsertAt = Batches.insert(InsertAt, Batch);
+
+    for (auto It = Batches.begin(); It != Batches.end();) {
+      if (!cleanup(**It, Stopping)) {
+        ++It;
+        continue;
+      }
+      if (auto Result = urQueueReleaseInternal((*It)->Queue))
+        logger::error("Event cleanup thread failed to release a queue: {}",
+                      Result);
+      delete *It;
+      It = Batches.erase(It);
+    }
+  }
+}
+
 namespace ur::level_zero {
 
 ur_result_t urQueueGetInfo(
@@ -368,6 +483,13 @@ ur_result_t urQueueGetInfo(
   case UR_QUEUE_INFO_SIZE:
   case UR_QUEUE_INFO_DEVICE_DEFAULT:
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  case UR_QUEUE_INFO_COMMAND_COUNTS:
+  case UR_QUEUE_INFO_BYTES_COPIED:
+  case UR_QUEUE_INFO_BATCH_COUNT:
+  case UR_QUEUE_INFO_AVERAGE_BATCH_SIZE:
+  case UR_QUEUE_INFO_HOST_WAIT_TIME:
+  case UR_QUEUE_INFO_CREATED_EVENT_COUNT:
+    return Queue->Telemetry.getInfo(ParamName, ReturnValue);
   case UR_QUEUE_INFO_EMPTY: {
     // We can exit early if we have in-order queue.
     if (Queue->isInOrderQueue()) {
@@ -604,6 +726,12 @@ ur_result_t urQueueRelease(
       return UR_RESULT_SUCCESS;
     }
 
+    // The split kernel launches complete before the commands of this queue
+    // waiting for them.
+    for (auto SubQueue : Queue->SubDeviceQueues)
+      UR_CALL(ur::level_zero::urQueueRelease(SubQueue));
+    Queue->SubDeviceQueues.clear();
+
     // When external reference count goes to zero it is still possible
     // that internal references still exists, e.g. command-lists that
     // are not yet completed. So do full queue synchronization here
@@ -823,6 +951,8 @@ ur_result_t urQueueCreateWithNativeHandle(
 ur_result_t urQueueFinish(
     ur_queue_handle_t Queue ///< [in] handle of the queue to be finished.
 ) {
+  TRACK_SCOPE_LATENCY("urQueueFinish");
+  ur::queue_telemetry_t::wait_scope_t WaitScope(Queue->Telemetry);
   if (Queue->UsingImmCmdLists) {
     // Lock automatically releases when this goes out of scope.
     std::scoped_lock<ur_shared_mutex> Lock(Queue->Mutex);
@@ -894,6 +1024,57 @@ ur_result_t urQueueFlush(
   return Queue->executeAllOpenCommandLists();
 }
 
+ur_result_t urQueueReserveTimestampMarkersExp(ur_queue_handle_t Queue,
+                                              uint32_t Capacity) {
+  UR_ASSERT(Capacity > 0, UR_RESULT_ERROR_INVALID_SIZE);
+  std::scoped_lock<ur_shared_mutex> Lock(Queue->Mutex);
+  if (Queue->TimestampMarkers)
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+
+  ZeStruct<ze_host_mem_alloc_desc_t> ZeDesc;
+  void *Slots = nullptr;
+  ZE2UR_CALL(zeMemAllocHost,
+             (Queue->Context->ZeContext, &ZeDesc,
+              Capacity * sizeof(uint64_t), sizeof(uint64_t), &Slots));
+  Queue->TimestampMarkerSlots = static_cast<uint64_t *>(Slots);
+  Queue->TimestampMarkers.emplace(Capacity);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urQueueReadTimestampMarkersExp(ur_queue_handle_t Queue,
+                                           uint64_t FirstMarker,
+                                           uint32_t Count,
+                                           uint64_t *Timestamps) {
+  std::unique_lock<ur_shared_mutex> Lock(Queue->Mutex);
+  auto &Markers = Queue->TimestampMarkers;
+  if (!Markers)
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  UR_CALL(Markers->checkRange(FirstMarker, Count));
+
+  if (!Markers->written(FirstMarker + Count)) {
+    // The markers have no events of their own, so the whole queue is
+    // finished. The markers enqueued meanwhile may overwrite the range,
+    // which is checked again.
+    uint64_t Enqueued = Markers->enqueued();
+    Lock.unlock();
+    UR_CALL(ur::level_zero::urQueueFinish(Queue));
+    Lock.lock();
+    Markers->markWritten(Enqueued);
+    UR_CALL(Markers->checkRange(FirstMarker, Count));
+  }
+
+  // Same conversion as the end of urEnqueueTimestampRecordingExp
+  const uint64_t ZeTimerResolution =
+      Queue->Device->ZeDeviceProperties->timerResolution;
+  const uint64_t TimestampMaxValue = Queue->Device->getTimestampMask();
+  for (uint32_t I = 0; I < Count; I++) {
+    uint64_t Raw =
+        Queue->TimestampMarkerSlots[Markers->slot(FirstMarker + I)];
+    Timestamps[I] = (Raw & TimestampMaxValue) * ZeTimerResolution;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t urEnqueueKernelLaunchCustomExp(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
@@ -939,6 +1120,14 @@ struct zeCommandListBatchConfig {
   uint32_t NumTimesClosedEarlyThreshold{3};
   uint32_t NumTimesClosedFullThreshold{8};
 
+  // Target device time of a batch, in nanoseconds. If not 0, dynamic batch
+  // sizes are derived from the sampled device time of the batched commands
+  // instead of how often the batches fill up.
+  uint64_t LatencyBudget{0};
+
+  // The device time of the commands is sampled every SampleInterval batches.
+  uint32_t SampleInterval{8};
+
   // Tells the starting size of a batch.
   uint32_t startSize() const { return Size > 0 ? Size : DynamicSizeStart; }
   // Tells is we are doing dynamic batch size adjustment.
@@ -1034,6 +1223,13 @@ static const zeCommandListBatchConfig ZeCommandListBatchConfig(bool IsCopy) {
         logger::warning("UR_L0_BATCH_SIZE: ignored negative value");
     }
   }
+
+  if (Config.dynamic()) {
+    auto LatencyBudgetUs =
+        getenv_to_unsigned(IsCopy ? "UR_L0_COPY_BATCH_LATENCY_BUDGET_US"
+                                  : "UR_L0_BATCH_LATENCY_BUDGET_US");
+    Config.LatencyBudget = LatencyBudgetUs.value_or(0) * 1000;
+  }
   return Config;
 }
 
@@ -1198,7 +1394,8 @@ void ur_queue_handle_t_::adjustBatchSizeForFullBatch(bool IsCopy) {
       IsCopy ? ZeCommandListBatchCopyConfig : ZeCommandListBatchComputeConfig;
   uint32_t &QueueBatchSize = CommandBatch.QueueBatchSize;
   // QueueBatchSize of 0 means never allow batching.
-  if (QueueBatchSize == 0 || !ZeCommandListBatchConfig.dynamic())
+  if (QueueBatchSize == 0 || !ZeCommandListBatchConfig.dynamic() ||
+      ZeCommandListBatchConfig.LatencyBudget)
     return;
   CommandBatch.NumTimesClosedFull += 1;
 
@@ -1225,7 +1422,8 @@ void ur_queue_handle_t_::adjustBatchSizeForPartialBatch(bool IsCopy) {
       IsCopy ? ZeCommandListBatchCopyConfig : ZeCommandListBatchComputeConfig;
   uint32_t &QueueBatchSize = CommandBatch.QueueBatchSize;
   // QueueBatchSize of 0 means never allow batching.
-  if (QueueBatchSize == 0 || !ZeCommandListBatchConfig.dynamic())
+  if (QueueBatchSize == 0 || !ZeCommandListBatchConfig.dynamic() ||
+      ZeCommandListBatchConfig.LatencyBudget)
     return;
   CommandBatch.NumTimesClosedEarly += 1;
 
@@ -1245,6 +1443,132 @@ void ur_queue_handle_t_::adjustBatchSizeForPartialBatch(bool IsCopy) {
   }
 }
 
+void ur_queue_handle_t_::adjustBatchSizeForLatency(bool IsCopy) {
+  auto &CommandBatch = IsCopy ? CopyCommandBatch : ComputeCommandBatch;
+  auto &ZeCommandListBatchConfig =
+      IsCopy ? ZeCommandListBatchCopyConfig : ZeCommandListBatchComputeConfig;
+  // The device writes the end timestamp once the batched commands are done.
+  const volatile uint64_t &SampleEnd = CommandBatch.SampleTimestamps[1];
+  if (!CommandBatch.SamplePending || SampleEnd == 0)
+    return;
+  CommandBatch.SamplePending = false;
+
+  // The start timestamp is written after the first command.
+  uint32_t NumCommands = CommandBatch.SampledNumCommands;
+  if (NumCommands < 2)
+    return;
+  const uint64_t TimestampMask = Device->getTimestampMask();
+  uint64_t Start = CommandBatch.SampleTimestamps[0] & TimestampMask;
+  uint64_t End = SampleEnd & TimestampMask;
+  uint64_t Ticks =
+      End >= Start ? End - Start : End + (TimestampMask - Start) + 1;
+  uint64_t CommandTime =
+      Ticks * Device->ZeDeviceProperties->timerResolution / (NumCommands - 1);
+
+  // Smooth over the samples, kernels of a batch don't all take as long.
+  CommandBatch.CommandTime =
+      CommandBatch.CommandTime
+          ? (3 * CommandBatch.CommandTime + CommandTime) / 4
+          : CommandTime;
+
+  // Short commands are batched as much as the budget allows, commands
+  // longer than the budget are submitted one by one.
+  uint64_t BatchSize = ZeCommandListBatchConfig.LatencyBudget /
+                       std::max<uint64_t>(CommandBatch.CommandTime, 1);
+  BatchSize = std::clamp<uint64_t>(BatchSize, 1,
+                                   ZeCommandListBatchConfig.DynamicSizeMax);
+  TRACK_VALUE("ur_queue_handle_t_::QueueBatchSize", BatchSize);
+  if (BatchSize != CommandBatch.QueueBatchSize) {
+    logger::debug("Setting QueueBatchSize to {} for commands of {} ns",
+                  BatchSize, CommandBatch.CommandTime);
+    CommandBatch.QueueBatchSize = static_cast<uint32_t>(BatchSize);
+  }
+}
+
+ur_result_t
+ur_queue_handle_t_::startBatchSample(ur_command_list_ptr_t CommandList,
+                                     bool IsCopy) {
+  auto &CommandBatch = IsCopy ? CopyCommandBatch : ComputeCommandBatch;
+  auto &ZeCommandListBatchConfig =
+      IsCopy ? ZeCommandListBatchCopyConfig : ZeCommandListBatchComputeConfig;
+  // Discarded events may be reset before the timestamp waiting for them.
+  if (!ZeCommandListBatchConfig.LatencyBudget || isDiscardEvents() ||
+      CommandList->second.EventList.empty())
+    return UR_RESULT_SUCCESS;
+
+  adjustBatchSizeForLatency(IsCopy);
+  // Samples don't overlap, they share the timestamps.
+  if (CommandBatch.SampledCommandList || CommandBatch.SamplePending ||
+      CommandBatch.NumBatchesSinceSample++ %
+          ZeCommandListBatchConfig.SampleInterval)
+    return UR_RESULT_SUCCESS;
+
+  CommandBatch.SampleTimestamps[0] = 0;
+  CommandBatch.SampleTimestamps[1] = 0;
+  ze_event_handle_t FirstEvent = CommandList->second.EventList.back()->ZeEvent;
+  ZE2UR_CALL(zeCommandListAppendWriteGlobalTimestamp,
+             (CommandList->first, &CommandBatch.SampleTimestamps[0], nullptr,
+              1, &FirstEvent));
+  CommandBatch.SampledCommandList = CommandList->first;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+ur_queue_handle_t_::endBatchSample(ur_command_list_ptr_t CommandList,
+                                   bool IsCopy) {
+  auto &CommandBatch = IsCopy ? CopyCommandBatch : ComputeCommandBatch;
+  if (CommandBatch.SampledCommandList != CommandList->first)
+    return UR_RESULT_SUCCESS;
+
+  // The start timestamp is pending as well, so the end one is always
+  // written before another sample reuses them.
+  CommandBatch.SampledCommandList = nullptr;
+  CommandBatch.SampledNumCommands = CommandList->second.size();
+  ze_event_handle_t LastEvent = CommandList->second.EventList.back()->ZeEvent;
+  ZE2UR_CALL(zeCommandListAppendWriteGlobalTimestamp,
+             (CommandList->first, &CommandBatch.SampleTimestamps[1], nullptr,
+              1, &LastEvent));
+  CommandBatch.SamplePending = true;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_handle_t_::appendBatchedKernelTimestamps(
+    ur_command_list_ptr_t CommandList) {
+  std::vector<ur_event_handle_t> Events;
+  std::vector<ze_event_handle_t> ZeEvents;
+  for (auto &Event : CommandList->second.EventList) {
+    // Timestamp recordings and command-buffers have timestamps of their own,
+    // and the proxy events of the batch aren't commands.
+    if (!Event->ZeEvent || Event->isTimestamped() ||
+        Event->CommandType == UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP ||
+        Event->CommandType == UR_EXT_COMMAND_TYPE_USER)
+      continue;
+    Events.push_back(Event);
+    ZeEvents.push_back(Event->ZeEvent);
+  }
+  if (Events.empty())
+    return UR_RESULT_SUCCESS;
+
+  // Host memory, as for the profiling of command-buffers.
+  std::shared_ptr<ze_kernel_timestamp_result_t[]> Timestamps(
+      new ze_kernel_timestamp_result_t[Events.size()]);
+  std::memset(Timestamps.get(), 0xff,
+              Events.size() * sizeof(ze_kernel_timestamp_result_t));
+
+  ZE2UR_CALL(zeCommandListAppendQueryKernelTimestamps,
+             (CommandList->first, ZeEvents.size(), ZeEvents.data(),
+              Timestamps.get(), nullptr, nullptr, ZeEvents.size(),
+              ZeEvents.data()));
+
+  for (size_t I = 0; I < Events.size(); ++I) {
+    std::scoped_lock<ur_shared_mutex> EventLock(Events[I]->Mutex);
+    Events[I]->BatchedKernelTimestamp =
+        std::shared_ptr<ze_kernel_timestamp_result_t>(Timestamps,
+                                                      &Timestamps[I]);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t
 ur_queue_handle_t_::executeCommandList(ur_command_list_ptr_t CommandList,
                                        bool IsBlocking, bool OKToBatchCommand) {
@@ -1306,6 +1630,8 @@ ur_queue_handle_t_::executeCommandList(ur_command_list_ptr_t CommandList,
             "null or CommandList");
 
       if (CommandList->second.size() < CommandBatch.QueueBatchSize) {
+        if (CommandBatch.OpenCommandList != CommandList)
+          UR_CALL(startBatchSample(CommandList, UseCopyEngine));
         CommandBatch.OpenCommandList = CommandList;
         return UR_RESULT_SUCCESS;
       }
@@ -1450,6 +1776,13 @@ ur_queue_handle_t_::executeCommandList(ur_command_list_ptr_t CommandList,
       }
     }
 
+    if (UrL0BatchKernelTimestamps &&
+        (Properties & UR_QUEUE_FLAG_PROFILING_ENABLE) != 0) {
+      UR_CALL(appendBatchedKernelTimestamps(CommandList));
+    }
+
+    UR_CALL(endBatchSample(CommandList, UseCopyEngine));
+
     // Close the command list and have it ready for dispatch.
     ZE2UR_CALL(zeCommandListClose, (CommandList->first));
     // Mark this command list as closed.
@@ -1470,6 +1803,15 @@ ur_queue_handle_t_::executeCommandList(ur_command_list_ptr_t CommandList,
                                        true /* QueueLocked */);
       return ze2urResult(ZeResult);
     }
+    // The proxy events of the batch aren't commands.
+    Telemetry.batchSubmitted(std::count_if(
+        CommandList->second.EventList.begin(),
+        CommandList->second.EventList.end(), [](ur_event_handle_t E) {
+          return E->CommandType != UR_EXT_COMMAND_TYPE_USER;
+        }));
+  } else {
+    // Immediate command lists submit each command as it is appended.
+    Telemetry.batchSubmitted();
   }
 
   // Check global control to make every command blocking for debugging.
@@ -1601,6 +1943,9 @@ ur_result_t urQueueReleaseInternal(ur_queue_handle_t Queue) {
   }
 
   Queue->clearEndTimeRecordings();
+  if (Queue->TimestampMarkerSlots)
+    ZE_CALL_NOCHECK(zeMemFree,
+                    (Queue->Context->ZeContext, Queue->TimestampMarkerSlots));
 
   logger::debug("urQueueRelease(compute) NumTimesClosedFull {}, "
                 "NumTimesClosedEarly {}",
@@ -1634,6 +1979,35 @@ bool ur_queue_handle_t_::isPriorityHigh() const {
   return ((this->Properties & UR_QUEUE_FLAG_PRIORITY_HIGH) != 0);
 }
 
+ur_result_t
+ur_queue_handle_t_::getSubDeviceQueues(std::vector<ur_queue_handle_t> &Queues) {
+  std::scoped_lock<ur_shared_mutex> Lock(Mutex);
+  if (SubDeviceQueues.empty()) {
+    // The launches need events to be joined.
+    ur_queue_properties_t Props{UR_STRUCTURE_TYPE_QUEUE_PROPERTIES, nullptr,
+                                Properties & ~UR_QUEUE_FLAG_DISCARD_EVENTS};
+    std::vector<ur_queue_handle_t> Created;
+    for (auto SubDevice : Device->SubDevices) {
+      ur_queue_handle_t SubQueue = nullptr;
+      ur_result_t Result =
+          ur::level_zero::urQueueCreate(Context, SubDevice, &Props, &SubQueue);
+      if (Result != UR_RESULT_SUCCESS) {
+        for (auto Q : Created)
+          ur::level_zero::urQueueRelease(Q);
+        return Result;
+      }
+      Created.push_back(SubQueue);
+    }
+    SubDeviceQueues = std::move(Created);
+  }
+  Queues = SubDeviceQueues;
+  return UR_RESULT_SUCCESS;
+}
+
+bool ur_queue_handle_t_::isLoadBalanced() const {
+  return ((this->Properties & UR_QUEUE_FLAG_LOAD_BALANCED) != 0);
+}
+
 bool ur_queue_handle_t_::isBatchedSubmission() const {
   return ((this->Properties & UR_QUEUE_FLAG_SUBMISSION_BATCHED) != 0);
 }
@@ -1878,10 +2252,12 @@ ur_result_t createEventAndAssociateQueue(ur_queue_handle_t Queue,
                                                       HostVisible.value())
                       : nullptr;
 
-  if (*Event == nullptr)
+  if (*Event == nullptr) {
     UR_CALL(EventCreate(Queue->Context, Queue, IsMultiDevice,
                         HostVisible.value(), Event,
                         Queue->CounterBasedEventsEnabled));
+    Queue->Telemetry.eventCreated();
+  }
 
   (*Event)->UrQueue = Queue;
   (*Event)->CommandType = CommandType;
@@ -1927,21 +2303,12 @@ void ur_queue_handle_t_::CaptureIndirectAccesses() {
     if (!Kernel->hasIndirectAccess())
       continue;
 
-    auto &Contexts = Device->Platform->Contexts;
-    for (auto &Ctx : Contexts) {
-      for (auto &Elem : Ctx->MemAllocs) {
-        const auto &Pair = Kernel->MemAllocs.insert(&Elem);
-        // Kernel is referencing this memory allocation from now.
-        // If this memory allocation was already captured for this kernel, it
-        // means that kernel is submitted several times. Increase reference
-        // count only once because we release all allocations only when
-        // SubmissionsCount turns to 0. We don't want to know how many times
-        // allocation was retained by each submission.
-        if (Pair.second)
-          Elem.second.RefCount.increment();
-      }
-    }
-    Kernel->SubmissionsCount++;
+    // The allocations which are live from now are only freed once this
+    // submission has completed, see USMReleaseIndirectAccesses.
+    auto Platform = Device->Platform;
+    uint64_t Epoch = ++Platform->IndirectAccessEpoch;
+    Platform->IndirectAccessEpochsInFlight.insert(Epoch);
+    Kernel->SubmissionEpochs.push_back(Epoch);
   }
   KernelsToBeSubmitted.clear();
 }
@@ -2157,9 +2524,12 @@ ur_queue_handle_t_::getQueueGroup(bool UseCopyEngine) {
 uint32_t ur_queue_handle_t_::ur_queue_group_t::getQueueIndex(
     uint32_t *QueueGroupOrdinal, uint32_t *QueueIndex, bool QueryOnly) {
   auto CurrentIndex = NextIndex;
+  if (Type == queue_type::Compute && UpperIndex > LowerIndex &&
+      Queue->isLoadBalanced())
+    CurrentIndex = getLeastLoadedIndex();
 
   if (!QueryOnly) {
-    ++NextIndex;
+    NextIndex = CurrentIndex + 1;
     if (NextIndex > UpperIndex)
       NextIndex = LowerIndex;
   }
@@ -2185,6 +2555,40 @@ uint32_t ur_queue_handle_t_::ur_queue_group_t::getQueueIndex(
   return CurrentIndex;
 }
 
+uint32_t ur_queue_handle_t_::ur_queue_group_t::getLeastLoadedIndex() {
+  uint32_t NumQueues = UpperIndex - LowerIndex + 1;
+  uint32_t LeastLoaded = NextIndex;
+  size_t LeastLoad = SIZE_MAX;
+  for (uint32_t I = 0; I < NumQueues && LeastLoad != 0; ++I) {
+    uint32_t Index = LowerIndex + (NextIndex - LowerIndex + I) % NumQueues;
+    size_t Load = getOutstandingCommands(Index);
+    if (Load < LeastLoad) {
+      LeastLoaded = Index;
+      LeastLoad = Load;
+    }
+  }
+  return LeastLoaded;
+}
+
+size_t
+ur_queue_handle_t_::ur_queue_group_t::getOutstandingCommands(uint32_t Index) {
+  if (Queue->UsingImmCmdLists) {
+    auto CommandList = ImmCmdLists[Index];
+    return CommandList == Queue->CommandListMap.end()
+               ? 0
+               : CommandList->second.size();
+  }
+  if (!ZeQueues[Index])
+    return 0;
+  size_t Load = 0;
+  for (auto &MapEntry : Queue->CommandListMap) {
+    if (MapEntry.second.ZeQueue == ZeQueues[Index] &&
+        MapEntry.second.ZeFenceInUse)
+      Load += MapEntry.second.size();
+  }
+  return Load;
+}
+
 // This function will return one of possibly multiple available native
 // queues and the value of the queue group ordinal.
 ze_command_queue_handle_t &
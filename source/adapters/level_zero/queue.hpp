@@ -9,18 +9,26 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <queue>
 #include <stdarg.h>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include <ur/ur.hpp>
 #include <ur_ddi.h>
+#include <ur_queue_telemetry.hpp>
+#include <ur_timestamp_markers.hpp>
 #include <ze_api.h>
 #include <zes_api.h>
 
@@ -155,6 +163,49 @@ CleanupEventsInImmCmdLists(ur_queue_handle_t UrQueue, bool QueueLocked = false,
                            bool QueueSynced = false,
                            ur_event_handle_t CompletedEvent = nullptr);
 
+// Reclaims the events of the immediate command lists of a context on a
+// thread of its own, so that the enqueue reaching
+// UR_L0_IMMEDIATE_COMMANDLISTS_EVENT_CLEANUP_THRESHOLD only hands the events
+// over instead of querying and releasing all of them. The handoff is a
+// lock-free stack, the thread checks the events it holds every
+// UR_L0_EVENT_CLEANUP_THREAD_INTERVAL_US microseconds (1000 by default) and
+// cleans up the completed ones. Enabled by setting
+// UR_L0_EVENT_CLEANUP_THREAD=1.
+class EventCleanupThread {
+public:
+  // Returns nullptr if the thread is not enabled
+  static std::unique_ptr<EventCleanupThread> create();
+
+  EventCleanupThread(std::chrono::microseconds Interval);
+  // Waits for the events handed over and cleans them up
+  ~EventCleanupThread();
+
+  // Takes over the events of Events, which must have been signalled or
+  // submitted on Queue. The caller must lock the queue.
+  void enqueue(ur_queue_handle_t Queue, std::vector<ur_event_handle_t> &Events);
+
+private:
+  struct batch_t {
+    ur_queue_handle_t Queue;
+    std::vector<ur_event_handle_t> Events;
+    batch_t *Next;
+  };
+
+  void run();
+  // Cleans up the completed events of Batch, or all of them after waiting
+  // for them if Wait is true. Returns true once Batch is empty.
+  bool cleanup(batch_t &Batch, bool Wait);
+
+  std::chrono::microseconds Interval;
+  // Pushed by the enqueues, taken all at once by the thread
+  std::atomic<batch_t *> Pending{nullptr};
+
+  std::mutex Mutex;
+  std::condition_variable Wakeup;
+  bool Stop = false;
+  std::thread Thread;
+};
+
 // Structure describing the specific use of a command-list in a queue.
 // This is because command-lists are re-used across multiple queues
 // in the same context.
@@ -263,6 +314,16 @@ struct ur_queue_handle_t_ : _ur_object {
     uint32_t getQueueIndex(uint32_t *QueueGroupOrdinal, uint32_t *QueueIndex,
                            bool QueryOnly = false);
 
+    // Return the index of the compute queue with the fewest outstanding
+    // commands, for queues with UR_QUEUE_FLAG_LOAD_BALANCED. Of the equally
+    // loaded queues, e.g. idle ones, the first in round robin order is used.
+    uint32_t getLeastLoadedIndex();
+
+    // The number of commands submitted to the queue of Index which still have
+    // to be cleaned up: the events of its immediate command list, or of the
+    // executed command lists of its L0 queue.
+    size_t getOutstandingCommands(uint32_t Index);
+
     // Get the ordinal for a command queue handle.
     int32_t getCmdQueueOrdinal(ze_command_queue_handle_t CmdQueue);
 
@@ -373,6 +434,9 @@ struct ur_queue_handle_t_ : _ur_object {
   // Keeps the properties of this queue.
   ur_queue_flags_t Properties;
 
+  // Counters reported by the telemetry queries of urQueueGetInfo.
+  ur::queue_telemetry_t Telemetry;
+
   // Keeps track of whether we are using Counter-based Events
   bool CounterBasedEventsEnabled = false;
 
@@ -398,6 +462,19 @@ struct ur_queue_handle_t_ : _ur_object {
     // a queue specific basis. And by putting it in the queue itself, this
     // is thread safe because of the locking of the queue that occurs.
     uint32_t QueueBatchSize = {0};
+
+    // Sampling of the device time of the batched commands, when the batch
+    // size follows a latency budget. The device writes the timestamps after
+    // the first and after the last command of a sampled batch.
+    uint64_t SampleTimestamps[2] = {0, 0};
+    // The open command list being sampled, if any.
+    ze_command_list_handle_t SampledCommandList = nullptr;
+    // Whether the timestamps of an executed batch are yet to be read.
+    bool SamplePending = false;
+    uint32_t SampledNumCommands = {0};
+    uint32_t NumBatchesSinceSample = {0};
+    // Moving average of the device time of a command, in nanoseconds.
+    uint64_t CommandTime = {0};
   };
 
   // ComputeCommandBatch holds data related to batching of non-copy commands.
@@ -488,6 +565,15 @@ struct ur_queue_handle_t_ : _ur_object {
   std::vector<std::unordered_map<ur_device_handle_t, size_t>>
       EventCachesDeviceMap{2};
 
+  // Queues on the sub-devices of Device, for the kernel launches split across
+  // them (UR_L0_EXPLICIT_SCALING). Created on first use, and released with
+  // this queue.
+  std::vector<ur_queue_handle_t> SubDeviceQueues;
+
+  // Get the queues on the sub-devices of Device, creating them if needed.
+  // The lock of the queue must not be held.
+  ur_result_t getSubDeviceQueues(std::vector<ur_queue_handle_t> &Queues);
+
   // End-times enqueued are stored on the queue rather than on the event to
   // avoid the event objects having been destroyed prior to the write to the
   // end-time member.
@@ -504,6 +590,12 @@ struct ur_queue_handle_t_ : _ur_object {
   // Clear the end time recording timestamps entries.
   void clearEndTimeRecordings();
 
+  // The markers of urEnqueueTimestampMarkerExp, reserved by
+  // urQueueReserveTimestampMarkersExp. The device writes the raw timestamps
+  // of the markers to the host allocation of their slots.
+  std::optional<ur::timestamp_markers_t> TimestampMarkers;
+  uint64_t *TimestampMarkerSlots = nullptr;
+
   // adjust the queue's batch size, knowing that the current command list
   // is being closed with a full batch.
   // For copy commands, IsCopy is set to 'true'.
@@ -516,6 +608,23 @@ struct ur_queue_handle_t_ : _ur_object {
   // For non-copy commands, IsCopy is set to 'false'.
   void adjustBatchSizeForPartialBatch(bool IsCopy);
 
+  // adjust the queue's batch size to the latency budget
+  // (UR_L0_BATCH_LATENCY_BUDGET_US), from the device time of the commands of
+  // the last sampled batch, once the device is done with it.
+  void adjustBatchSizeForLatency(bool IsCopy);
+
+  // Start sampling the device time of the commands of a batch, every few
+  // batches, when CommandList is kept open with its first command. The
+  // sample ends when CommandList is executed.
+  ur_result_t startBatchSample(ur_command_list_ptr_t CommandList, bool IsCopy);
+  ur_result_t endBatchSample(ur_command_list_ptr_t CommandList, bool IsCopy);
+
+  // Append a single query of the kernel timestamps of the profiled events of
+  // CommandList, once they are signalled, to a buffer they share
+  // (UR_L0_BATCH_KERNEL_TIMESTAMPS). Their profiling info is then read from
+  // memory instead of a driver query per event.
+  ur_result_t appendBatchedKernelTimestamps(ur_command_list_ptr_t CommandList);
+
   // Attach a command list to this queue.
   // For non-immediate commandlist also close and execute it.
   // Note that this command list cannot be appended to after this.
@@ -563,6 +672,9 @@ struct ur_queue_handle_t_ : _ur_object {
   bool isPriorityLow() const;
   bool isPriorityHigh() const;
 
+  // Returns true if commands go to the least loaded compute engine.
+  bool isLoadBalanced() const;
+
   // Returns true if the queue has an explicitly selected submission mode.
   bool isBatchedSubmission() const;
   bool isImmediateSubmission() const;
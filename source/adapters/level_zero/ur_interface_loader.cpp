@@ -214,6 +214,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
   pDdiTable->pfnTimestampRecordingExp =
       ur::level_zero::urEnqueueTimestampRecordingExp;
   pDdiTable->pfnNativeCommandExp = ur::level_zero::urEnqueueNativeCommandExp;
+  pDdiTable->pfnUSMDeviceAllocExp = ur::level_zero::urEnqueueUSMDeviceAllocExp;
+  pDdiTable->pfnUSMFreeExp = ur::level_zero::urEnqueueUSMFreeExp;
+  pDdiTable->pfnMemBufferCopyRectBatchExp =
+      ur::level_zero::urEnqueueMemBufferCopyRectBatchExp;
+  pDdiTable->pfnKernelLaunchBatchExp =
+      ur::level_zero::urEnqueueKernelLaunchBatchExp;
+  pDdiTable->pfnTimestampMarkerExp =
+      ur::level_zero::urEnqueueTimestampMarkerExp;
 
   return result;
 }
@@ -238,6 +246,20 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
   return result;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ur_event_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+
+  pDdiTable->pfnWaitAnyExp = ur::level_zero::urEventWaitAnyExp;
+  pDdiTable->pfnGetExecutionStatusExp =
+      ur::level_zero::urEventGetExecutionStatusExp;
+
+  return result;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urGetKernelProcAddrTable(
     ur_api_version_t version, ur_kernel_dditable_t *pDdiTable) {
   auto result = validateProcInputs(version, pDdiTable);
@@ -277,6 +299,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
 
   pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
       ur::level_zero::urKernelSuggestMaxCooperativeGroupCountExp;
+  pDdiTable->pfnSetArgsExp = ur::level_zero::urKernelSetArgsExp;
 
   return result;
 }
@@ -399,6 +422,21 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
   return result;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ur_queue_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+
+  pDdiTable->pfnReserveTimestampMarkersExp =
+      ur::level_zero::urQueueReserveTimestampMarkersExp;
+  pDdiTable->pfnReadTimestampMarkersExp =
+      ur::level_zero::urQueueReadTimestampMarkersExp;
+
+  return result;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urGetSamplerProcAddrTable(
     ur_api_version_t version, ur_sampler_dditable_t *pDdiTable) {
   auto result = validateProcInputs(version, pDdiTable);
@@ -447,6 +485,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
   pDdiTable->pfnPitchedAllocExp = ur::level_zero::urUSMPitchedAllocExp;
   pDdiTable->pfnImportExp = ur::level_zero::urUSMImportExp;
   pDdiTable->pfnReleaseExp = ur::level_zero::urUSMReleaseExp;
+  pDdiTable->pfnPoolTrimExp = ur::level_zero::urUSMPoolTrimExp;
 
   return result;
 }
@@ -552,6 +591,10 @@ ur_result_t urAdapterGetDdiTables(ur_dditable_t *ddi) {
                                                    &ddi->Event);
   if (result != UR_RESULT_SUCCESS)
     return result;
+  result = ur::level_zero::urGetEventExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                      &ddi->EventExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
   result = ur::level_zero::urGetKernelProcAddrTable(UR_API_VERSION_CURRENT,
                                                     &ddi->Kernel);
   if (result != UR_RESULT_SUCCESS)
@@ -584,6 +627,10 @@ ur_result_t urAdapterGetDdiTables(ur_dditable_t *ddi) {
                                                    &ddi->Queue);
   if (result != UR_RESULT_SUCCESS)
     return result;
+  result = ur::level_zero::urGetQueueExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                      &ddi->QueueExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
   result = ur::level_zero::urGetSamplerProcAddrTable(UR_API_VERSION_CURRENT,
                                                      &ddi->Sampler);
   if (result != UR_RESULT_SUCCESS)
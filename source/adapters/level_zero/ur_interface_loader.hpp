@@ -660,6 +660,8 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
 ur_result_t urKernelSuggestMaxCooperativeGroupCountExp(
     ur_kernel_handle_t hKernel, size_t localWorkSize,
     size_t dynamicSharedMemorySize, uint32_t *pGroupCountRet);
+ur_result_t urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                               const ur_exp_kernel_arg_properties_t *pArgs);
 ur_result_t urEnqueueTimestampRecordingExp(
     ur_queue_handle_t hQueue, bool blocking, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent);
@@ -685,6 +687,9 @@ ur_result_t urProgramLinkExp(ur_context_handle_t hContext, uint32_t numDevices,
 ur_result_t urUSMImportExp(ur_context_handle_t hContext, void *pMem,
                            size_t size);
 ur_result_t urUSMReleaseExp(ur_context_handle_t hContext, void *pMem);
+ur_result_t urUSMPoolTrimExp(ur_context_handle_t hContext,
+                             ur_usm_pool_handle_t hPool,
+                             size_t minBytesToKeep);
 ur_result_t urUsmP2PEnablePeerAccessExp(ur_device_handle_t commandDevice,
                                         ur_device_handle_t peerDevice);
 ur_result_t urUsmP2PDisablePeerAccessExp(ur_device_handle_t commandDevice,
@@ -701,6 +706,40 @@ ur_result_t urEnqueueNativeCommandExp(
     const ur_exp_enqueue_native_command_properties_t *pProperties,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent);
+ur_result_t urEnqueueUSMDeviceAllocExp(ur_queue_handle_t hQueue, size_t size,
+                                       uint32_t numEventsInWaitList,
+                                       const ur_event_handle_t *phEventWaitList,
+                                       void **ppMem,
+                                       ur_event_handle_t *phEvent);
+ur_result_t urEnqueueUSMFreeExp(ur_queue_handle_t hQueue, void *pMem,
+                                uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList,
+                                ur_event_handle_t *phEvent);
+ur_result_t urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t hQueue, ur_mem_handle_t hBufferSrc,
+    ur_mem_handle_t hBufferDst, uint32_t numRegions,
+    const ur_rect_offset_t *pSrcOrigins, const ur_rect_offset_t *pDstOrigins,
+    const ur_rect_region_t *pRegions, size_t srcRowPitch, size_t srcSlicePitch,
+    size_t dstRowPitch, size_t dstSlicePitch, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent);
+ur_result_t urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue, uint32_t numLaunches,
+    const ur_exp_kernel_launch_desc_t *pLaunches, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent);
+ur_result_t urEventWaitAnyExp(uint32_t numEvents,
+                              const ur_event_handle_t *phEventWaitList,
+                              uint32_t *pEventIndex);
+ur_result_t urEventGetExecutionStatusExp(uint32_t numEvents,
+                                         const ur_event_handle_t *phEvents,
+                                         ur_event_status_t *pStatuses);
+ur_result_t urQueueReserveTimestampMarkersExp(ur_queue_handle_t hQueue,
+                                              uint32_t capacity);
+ur_result_t urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, uint64_t *pMarker);
+ur_result_t urQueueReadTimestampMarkersExp(ur_queue_handle_t hQueue,
+                                           uint64_t firstMarker, uint32_t count,
+                                           uint64_t *pTimestamps);
 #ifdef UR_STATIC_ADAPTER_LEVEL_ZERO
 ur_result_t urAdapterGetDdiTables(ur_dditable_t *ddi);
 #endif
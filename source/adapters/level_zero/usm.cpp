@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <optional>
 #include <string.h>
 
 #include "context.hpp"
@@ -78,6 +79,19 @@ usm::DisjointPoolAllConfigs InitializeDisjointPoolConfig() {
   return usm::parseDisjointPoolConfig(PoolConfigVal, PoolTrace);
 }
 
+umf::pool_unique_handle_t
+makeDisjointPool(umf::provider_unique_handle_t MemProvider,
+                 usm::DisjointPoolAllConfigs &Configs,
+                 usm::DisjointPoolMemType MemType) {
+  auto Pool = umf::poolMakeUniqueFromOps(umfDisjointPoolOps(),
+                                         std::move(MemProvider),
+                                         &Configs.Configs[MemType])
+                  .second;
+  return umf::poolAddThreadCache(std::move(Pool),
+                                 Configs.ThreadCaches[MemType].Capacity,
+                                 Configs.ThreadCaches[MemType].MaxSize);
+}
+
 enum class USMAllocationForceResidencyType {
   // Do not force memory residency at allocation time.
   None = 0,
@@ -94,7 +108,10 @@ enum class USMAllocationForceResidencyType {
 //   4-bits of D control device allocations
 //   4-bits of S control shared allocations
 //   4-bits of H control host allocations
-// Each 4-bit value is holding a USMAllocationForceResidencyType enum value.
+// The lower 3 bits of each 4-bit value hold a USMAllocationForceResidencyType
+// enum value. When its upper bit is set, e.g. 0xA, the residency is deferred:
+// the allocations are made resident in one batch before the next kernel
+// launch in the context, instead of one by one when they are allocated.
 // The default is 0x2, i.e. force full residency for device allocations only.
 //
 static uint32_t USMAllocationForceResidency = [] {
@@ -126,20 +143,28 @@ USMAllocationForceResidencyConvert(uint32_t Val) {
 
 static USMAllocationForceResidencyType USMHostAllocationForceResidency = [] {
   return USMAllocationForceResidencyConvert(
-      (USMAllocationForceResidency & 0xf00) >> 8);
+      (USMAllocationForceResidency & 0x700) >> 8);
 }();
 static USMAllocationForceResidencyType USMSharedAllocationForceResidency = [] {
   return USMAllocationForceResidencyConvert(
-      (USMAllocationForceResidency & 0x0f0) >> 4);
+      (USMAllocationForceResidency & 0x070) >> 4);
 }();
 static USMAllocationForceResidencyType USMDeviceAllocationForceResidency = [] {
   return USMAllocationForceResidencyConvert(
-      (USMAllocationForceResidency & 0x00f));
+      (USMAllocationForceResidency & 0x007));
 }();
 
+static const bool USMHostAllocationDeferResidency =
+    USMAllocationForceResidency & 0x800;
+static const bool USMSharedAllocationDeferResidency =
+    USMAllocationForceResidency & 0x080;
+static const bool USMDeviceAllocationDeferResidency =
+    USMAllocationForceResidency & 0x008;
+
 // Make USM allocation resident as requested
 static ur_result_t USMAllocationMakeResident(
-    USMAllocationForceResidencyType ForceResidency, ur_context_handle_t Context,
+    USMAllocationForceResidencyType ForceResidency, bool DeferResidency,
+    ur_context_handle_t Context,
     ur_device_handle_t Device, // nullptr for host allocation
     void *Ptr, size_t Size) {
 
@@ -177,6 +202,10 @@ static ur_result_t USMAllocationMakeResident(
       }
     }
   }
+  if (DeferResidency) {
+    Context->deferResidency(Ptr, Size, std::move(Devices));
+    return UR_RESULT_SUCCESS;
+  }
   for (const auto &D : Devices) {
     ZE2UR_CALL(zeContextMakeMemoryResident,
                (Context->ZeContext, D->ZeDevice, Ptr, Size));
@@ -220,8 +249,9 @@ static ur_result_t USMDeviceAllocImpl(void **ResultPtr,
 
   // TODO: Return any non-success result from USMAllocationMakeResident once
   // oneapi-src/level-zero-spec#240 is resolved.
-  auto Result = USMAllocationMakeResident(USMDeviceAllocationForceResidency,
-                                          Context, Device, *ResultPtr, Size);
+  auto Result = USMAllocationMakeResident(
+      USMDeviceAllocationForceResidency, USMDeviceAllocationDeferResidency,
+      Context, Device, *ResultPtr, Size);
   if (Result == UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY ||
       Result == UR_RESULT_ERROR_OUT_OF_HOST_MEMORY) {
     return Result;
@@ -264,8 +294,9 @@ USMSharedAllocImpl(void **ResultPtr, ur_context_handle_t Context,
 
   // TODO: Return any non-success result from USMAllocationMakeResident once
   // oneapi-src/level-zero-spec#240 is resolved.
-  auto Result = USMAllocationMakeResident(USMSharedAllocationForceResidency,
-                                          Context, Device, *ResultPtr, Size);
+  auto Result = USMAllocationMakeResident(
+      USMSharedAllocationForceResidency, USMSharedAllocationDeferResidency,
+      Context, Device, *ResultPtr, Size);
   if (Result == UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY ||
       Result == UR_RESULT_ERROR_OUT_OF_HOST_MEMORY) {
     return Result;
@@ -299,8 +330,9 @@ static ur_result_t USMHostAllocImpl(void **ResultPtr,
 
   // TODO: Return any non-success result from USMAllocationMakeResident once
   // oneapi-src/level-zero-spec#240 is resolved.
-  auto Result = USMAllocationMakeResident(USMHostAllocationForceResidency,
-                                          Context, nullptr, *ResultPtr, Size);
+  auto Result = USMAllocationMakeResident(
+      USMHostAllocationForceResidency, USMHostAllocationDeferResidency,
+      Context, nullptr, *ResultPtr, Size);
   if (Result == UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY ||
       Result == UR_RESULT_ERROR_OUT_OF_HOST_MEMORY) {
     return Result;
@@ -357,16 +389,18 @@ ur_result_t urUSMHostAlloc(
   // There is a single allocator for Host USM allocations, so we don't need to
   // find the allocator depending on context as we do for Shared and Device
   // allocations.
+  auto SharedPoolsLock = Context->lockSharedPools();
+  ur_context_handle_t PoolsOwner = Context->getPoolsOwner();
   umf_memory_pool_handle_t hPoolInternal = nullptr;
   if (!UseUSMAllocator) {
-    hPoolInternal = Context->HostMemProxyPool.get();
+    hPoolInternal = PoolsOwner->HostMemProxyPool.get();
   } else if (Pool) {
     hPoolInternal = Pool->HostMemPool.get();
   } else {
-    hPoolInternal = Context->HostMemPool.get();
+    hPoolInternal = PoolsOwner->HostMemPool.get();
   }
 
-  *RetMem = umfPoolAlignedMalloc(hPoolInternal, Size, Align);
+  *RetMem = umf::cachedAlignedMalloc(hPoolInternal, Size, Align);
   if (*RetMem == nullptr) {
     auto umfRet = umfPoolGetLastAllocationError(hPoolInternal);
     return umf2urResult(umfRet);
@@ -429,24 +463,26 @@ ur_result_t urUSMDeviceAlloc(
     ContextLock.lock();
   }
 
+  auto SharedPoolsLock = Context->lockSharedPools();
+  ur_context_handle_t PoolsOwner = Context->getPoolsOwner();
   umf_memory_pool_handle_t hPoolInternal = nullptr;
   if (!UseUSMAllocator) {
-    auto It = Context->DeviceMemProxyPools.find(Device->ZeDevice);
-    if (It == Context->DeviceMemProxyPools.end())
+    auto It = PoolsOwner->DeviceMemProxyPools.find(Device->ZeDevice);
+    if (It == PoolsOwner->DeviceMemProxyPools.end())
       return UR_RESULT_ERROR_INVALID_VALUE;
 
     hPoolInternal = It->second.get();
   } else if (Pool) {
     hPoolInternal = Pool->DeviceMemPools[Device].get();
   } else {
-    auto It = Context->DeviceMemPools.find(Device->ZeDevice);
-    if (It == Context->DeviceMemPools.end())
+    auto It = PoolsOwner->DeviceMemPools.find(Device->ZeDevice);
+    if (It == PoolsOwner->DeviceMemPools.end())
       return UR_RESULT_ERROR_INVALID_VALUE;
 
     hPoolInternal = It->second.get();
   }
 
-  *RetMem = umfPoolAlignedMalloc(hPoolInternal, Size, Alignment);
+  *RetMem = umf::cachedAlignedMalloc(hPoolInternal, Size, Alignment);
   if (*RetMem == nullptr) {
     auto umfRet = umfPoolGetLastAllocationError(hPoolInternal);
     return umf2urResult(umfRet);
@@ -530,10 +566,12 @@ ur_result_t urUSMSharedAlloc(
     UR_CALL(ur::level_zero::urContextRetain(Context));
   }
 
+  auto SharedPoolsLock = Context->lockSharedPools();
+  ur_context_handle_t PoolsOwner = Context->getPoolsOwner();
   umf_memory_pool_handle_t hPoolInternal = nullptr;
   if (!UseUSMAllocator) {
-    auto &Allocator = (DeviceReadOnly ? Context->SharedReadOnlyMemProxyPools
-                                      : Context->SharedMemProxyPools);
+    auto &Allocator = (DeviceReadOnly ? PoolsOwner->SharedReadOnlyMemProxyPools
+                                      : PoolsOwner->SharedMemProxyPools);
     auto It = Allocator.find(Device->ZeDevice);
     if (It == Allocator.end())
       return UR_RESULT_ERROR_INVALID_VALUE;
@@ -544,8 +582,8 @@ ur_result_t urUSMSharedAlloc(
                         ? Pool->SharedReadOnlyMemPools[Device].get()
                         : Pool->SharedMemPools[Device].get();
   } else {
-    auto &Allocator = (DeviceReadOnly ? Context->SharedReadOnlyMemPools
-                                      : Context->SharedMemPools);
+    auto &Allocator = (DeviceReadOnly ? PoolsOwner->SharedReadOnlyMemPools
+                                      : PoolsOwner->SharedMemPools);
     auto It = Allocator.find(Device->ZeDevice);
     if (It == Allocator.end())
       return UR_RESULT_ERROR_INVALID_VALUE;
@@ -553,7 +591,7 @@ ur_result_t urUSMSharedAlloc(
     hPoolInternal = It->second.get();
   }
 
-  *RetMem = umfPoolAlignedMalloc(hPoolInternal, Size, Alignment);
+  *RetMem = umf::cachedAlignedMalloc(hPoolInternal, Size, Alignment);
   if (*RetMem == nullptr) {
     auto umfRet = umfPoolGetLastAllocationError(hPoolInternal);
     return umf2urResult(umfRet);
@@ -737,6 +775,14 @@ ur_result_t urUSMPoolGetInfo(
   case UR_USM_POOL_INFO_CONTEXT: {
     return ReturnValue(Pool->Context);
   }
+  case UR_USM_POOL_INFO_USED_SIZE:
+  case UR_USM_POOL_INFO_CACHED_SIZE:
+  case UR_USM_POOL_INFO_PEAK_USED_SIZE:
+  case UR_USM_POOL_INFO_BUCKET_HITS:
+  case UR_USM_POOL_INFO_BUCKET_MISSES:
+  case UR_USM_POOL_INFO_FRAGMENTATION: {
+    return umf::poolStatsInfo(Pool->getStats(), PropName, ReturnValue);
+  }
   default: {
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
   }
@@ -749,6 +795,12 @@ ur_result_t urUSMImportExp(ur_context_handle_t Context, void *HostPtr,
 
   // Promote the host ptr to USM host memory.
   if (ZeUSMImport.Supported && HostPtr != nullptr) {
+    ze_driver_handle_t driverHandle =
+        Context->getPlatform()->ZeDriverHandleExpTranslated;
+    // Reuse the import of the same host memory, e.g. by a buffer
+    if (ZeUSMImport.retainImportedHostPtr(driverHandle, HostPtr, Size))
+      return UR_RESULT_SUCCESS;
+
     // Query memory type of the host pointer
     ze_device_handle_t ZeDeviceHandle;
     ZeStruct<ze_memory_allocation_properties_t> ZeMemoryAllocationProperties;
@@ -759,9 +811,7 @@ ur_result_t urUSMImportExp(ur_context_handle_t Context, void *HostPtr,
     // If not shared of any type, we can import the ptr
     if (ZeMemoryAllocationProperties.type == ZE_MEMORY_TYPE_UNKNOWN) {
       // Promote the host ptr to USM host memory
-      ze_driver_handle_t driverHandle =
-          Context->getPlatform()->ZeDriverHandleExpTranslated;
-      ZeUSMImport.doZeUSMImport(driverHandle, HostPtr, Size);
+      ZeUSMImport.importHostPtr(driverHandle, HostPtr, Size);
     }
   }
   return UR_RESULT_SUCCESS;
@@ -772,13 +822,37 @@ ur_result_t urUSMReleaseExp(ur_context_handle_t Context, void *HostPtr) {
 
   // Release the imported memory.
   if (ZeUSMImport.Supported && HostPtr != nullptr)
-    ZeUSMImport.doZeUSMRelease(
-        Context->getPlatform()->ZeDriverHandleExpTranslated, HostPtr);
+    ZeUSMImport.releaseHostPtr(
+        Context->getPlatform()->ZeDriverHandleExpTranslated, HostPtr, false);
   return UR_RESULT_SUCCESS;
 }
+
+ur_result_t urUSMPoolTrimExp(ur_context_handle_t Context,
+                             ur_usm_pool_handle_t Pool,
+                             size_t MinBytesToKeep) {
+  UR_ASSERT(!Pool || Pool->Context == Context,
+            UR_RESULT_ERROR_INVALID_CONTEXT);
+
+  size_t Released = USMTrimPools(Context, Pool, MinBytesToKeep);
+  logger::debug("urUSMPoolTrimExp: released {} bytes", Released);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEnqueueUSMDeviceAllocExp(ur_queue_handle_t, size_t, uint32_t,
+                                       const ur_event_handle_t *, void **,
+                                       ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t urEnqueueUSMFreeExp(ur_queue_handle_t, void *, uint32_t,
+                                const ur_event_handle_t *,
+                                ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
 } // namespace ur::level_zero
 
 static ur_result_t USMFreeImpl(ur_context_handle_t Context, void *Ptr) {
+  Context->cancelResidency(Ptr);
   auto ZeResult = ZE_CALL_NOCHECK(zeMemFree, (Context->ZeContext, Ptr));
   // Handle When the driver is already released
   if (ZeResult == ZE_RESULT_ERROR_UNINITIALIZED) {
@@ -892,9 +966,17 @@ umf_result_t L0MemoryProvider::get_min_page_size(void *Ptr, size_t *PageSize) {
 
 typedef struct ze_ipc_data_t {
   int pid;
+  // Unique to each export in the process pid
+  uint64_t id;
   ze_ipc_mem_handle_t zeHandle;
 } ze_ipc_data_t;
 
+L0MemoryProvider::~L0MemoryProvider() {
+  // Gracefully handle the case that L0 was already unloaded.
+  for (auto &[Key, Mapping] : IpcMappings)
+    ZE_CALL_NOCHECK(zeMemCloseIpcHandle, (Context->ZeContext, Mapping.Ptr));
+}
+
 umf_result_t L0MemoryProvider::get_ipc_handle_size(size_t *Size) {
   UR_ASSERT(Size, UMF_RESULT_ERROR_INVALID_ARGUMENT);
   *Size = sizeof(ze_ipc_data_t);
@@ -914,7 +996,9 @@ umf_result_t L0MemoryProvider::get_ipc_handle(const void *Ptr, size_t Size,
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
   }
 
+  static std::atomic<uint64_t> NextId{0};
   zeIpcData->pid = ur_getpid();
+  zeIpcData->id = NextId++;
 
   return UMF_RESULT_SUCCESS;
 }
@@ -942,6 +1026,15 @@ umf_result_t L0MemoryProvider::open_ipc_handle(void *IpcData, void **Ptr) {
   UR_ASSERT(IpcData && Ptr, UMF_RESULT_ERROR_INVALID_ARGUMENT);
   ze_ipc_data_t *zeIpcData = (ze_ipc_data_t *)IpcData;
 
+  std::lock_guard<std::mutex> Lock(IpcMappingsMutex);
+  auto Key = std::make_pair(zeIpcData->pid, zeIpcData->id);
+  auto It = IpcMappings.find(Key);
+  if (It != IpcMappings.end()) {
+    It->second.RefCount++;
+    *Ptr = It->second.Ptr;
+    return UMF_RESULT_SUCCESS;
+  }
+
   int fdLocal = -1;
   if (zeIpcData->pid != ur_getpid()) {
     int fdRemote = -1;
@@ -966,6 +1059,8 @@ umf_result_t L0MemoryProvider::open_ipc_handle(void *IpcData, void **Ptr) {
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
   }
 
+  It = IpcMappings.emplace(Key, ipc_mapping_t{*Ptr, 1}).first;
+  IpcMappingsByPtr.emplace(*Ptr, It);
   return UMF_RESULT_SUCCESS;
 }
 
@@ -973,6 +1068,14 @@ umf_result_t L0MemoryProvider::close_ipc_handle(void *Ptr, size_t Size) {
   std::ignore = Size;
 
   UR_ASSERT(Ptr, UMF_RESULT_ERROR_INVALID_ARGUMENT);
+  std::lock_guard<std::mutex> Lock(IpcMappingsMutex);
+  auto It = IpcMappingsByPtr.find(Ptr);
+  if (It != IpcMappingsByPtr.end()) {
+    if (--It->second->second.RefCount > 0)
+      return UMF_RESULT_SUCCESS;
+    IpcMappings.erase(It->second);
+    IpcMappingsByPtr.erase(It);
+  }
   auto Ret = ZE_CALL_NOCHECK(zeMemCloseIpcHandle, (Context->ZeContext, Ptr));
   if (Ret != ZE_RESULT_SUCCESS) {
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
@@ -1002,9 +1105,55 @@ ur_result_t L0DeviceMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
                             Alignment);
 }
 
+umf_result_t
+L0HostMemoryProvider::initialize(ur_context_handle_t Ctx,
+                                 ur_device_handle_t Dev,
+                                 const usm::host_memory_config_t &Memory) {
+  HostMemory = Memory;
+  return L0MemoryProvider::initialize(Ctx, Dev);
+}
+
 ur_result_t L0HostMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
                                                uint32_t Alignment) {
-  return USMHostAllocImpl(ResultPtr, Context, /* flags */ 0, Size, Alignment);
+  if (HostMemory.isDefault())
+    return USMHostAllocImpl(ResultPtr, Context, /* flags */ 0, Size,
+                            Alignment);
+
+  size_t MappedSize = usm::hostMemoryRoundUp(Size, HostMemory);
+  UR_ASSERT(Alignment <= usm::hostMemoryPageSize(HostMemory),
+            UR_RESULT_ERROR_UNSUPPORTED_ALIGNMENT);
+  void *Ptr = usm::hostMemoryMap(MappedSize, HostMemory);
+  if (!Ptr)
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+
+  auto ZeResult = ZeUSMImport.doZeUSMImport(
+      Context->getPlatform()->ZeDriverHandleExpTranslated, Ptr, MappedSize);
+  if (ZeResult != ZE_RESULT_SUCCESS) {
+    usm::hostMemoryUnmap(Ptr, MappedSize);
+    return ze2urResult(ZeResult);
+  }
+
+  *ResultPtr = Ptr;
+  return UR_RESULT_SUCCESS;
+}
+
+umf_result_t L0HostMemoryProvider::free(void *Ptr, size_t Size) {
+  if (HostMemory.isDefault())
+    return L0MemoryProvider::free(Ptr, Size);
+
+  ZeUSMImport.doZeUSMRelease(
+      Context->getPlatform()->ZeDriverHandleExpTranslated, Ptr);
+  usm::hostMemoryUnmap(Ptr, usm::hostMemoryRoundUp(Size, HostMemory));
+  return UMF_RESULT_SUCCESS;
+}
+
+umf_result_t L0HostMemoryProvider::get_min_page_size(void *Ptr,
+                                                     size_t *PageSize) {
+  if (HostMemory.isDefault())
+    return L0MemoryProvider::get_min_page_size(Ptr, PageSize);
+
+  *PageSize = usm::hostMemoryPageSize(HostMemory);
+  return UMF_RESULT_SUCCESS;
 }
 
 ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
@@ -1028,6 +1177,21 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
       }
       break;
     }
+    case UR_STRUCTURE_TYPE_EXP_USM_HOST_POOL_DESC: {
+      const ur_exp_usm_host_pool_desc_t *HostPoolDesc =
+          reinterpret_cast<const ur_exp_usm_host_pool_desc_t *>(BaseDesc);
+      auto [Result, Memory] = usm::makeHostMemoryConfig(
+          *HostPoolDesc, Context->Devices, ur::level_zero::urDeviceGetInfo);
+      if (Result != UR_RESULT_SUCCESS)
+        throw UsmAllocationException(Result);
+      // The memory is allocated from the OS and imported into the driver
+      if (!Memory.isDefault() && !ZeUSMImport.Supported) {
+        logger::error("urUSMPoolCreate: host memory import is not supported");
+        throw UsmAllocationException(UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+      }
+      HostMemory = Memory;
+      break;
+    }
     default: {
       logger::error("urUSMPoolCreate: unexpected chained stype");
       throw UsmAllocationException(UR_RESULT_ERROR_INVALID_ARGUMENT);
@@ -1036,51 +1200,137 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
     pNext = const_cast<void *>(BaseDesc->pNext);
   }
 
-  auto MemProvider =
-      umf::memoryProviderMakeUnique<L0HostMemoryProvider>(Context, nullptr)
-          .second;
-
-  HostMemPool =
-      umf::poolMakeUniqueFromOps(
-          umfDisjointPoolOps(), std::move(MemProvider),
-          &this->DisjointPoolConfigs.Configs[usm::DisjointPoolMemType::Host])
-          .second;
+  HostMemPool = makePool(usm::DisjointPoolMemType::Host, nullptr);
 
   for (auto device : Context->Devices) {
+    DeviceMemPools.emplace(device,
+                           makePool(usm::DisjointPoolMemType::Device, device));
+    SharedMemPools.emplace(device,
+                           makePool(usm::DisjointPoolMemType::Shared, device));
+    SharedReadOnlyMemPools.emplace(
+        device, makePool(usm::DisjointPoolMemType::SharedReadOnly, device));
+  }
+}
+
+umf::pool_unique_handle_t
+ur_usm_pool_handle_t_::makePool(usm::DisjointPoolMemType MemType,
+                                ur_device_handle_t Device) {
+  umf::provider_unique_handle_t MemProvider;
+  switch (MemType) {
+  case usm::DisjointPoolMemType::Host:
+    MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
+                      Context, nullptr, HostMemory)
+                      .second;
+    break;
+  case usm::DisjointPoolMemType::Device:
     MemProvider =
-        umf::memoryProviderMakeUnique<L0DeviceMemoryProvider>(Context, device)
+        umf::memoryProviderMakeUnique<L0DeviceMemoryProvider>(Context, Device)
             .second;
-    DeviceMemPools.emplace(
-        std::piecewise_construct, std::make_tuple(device),
-        std::make_tuple(umf::poolMakeUniqueFromOps(
-                            umfDisjointPoolOps(), std::move(MemProvider),
-                            &this->DisjointPoolConfigs
-                                 .Configs[usm::DisjointPoolMemType::Device])
-                            .second));
-
+    break;
+  case usm::DisjointPoolMemType::Shared:
     MemProvider =
-        umf::memoryProviderMakeUnique<L0SharedMemoryProvider>(Context, device)
+        umf::memoryProviderMakeUnique<L0SharedMemoryProvider>(Context, Device)
             .second;
-    SharedMemPools.emplace(
-        std::piecewise_construct, std::make_tuple(device),
-        std::make_tuple(umf::poolMakeUniqueFromOps(
-                            umfDisjointPoolOps(), std::move(MemProvider),
-                            &this->DisjointPoolConfigs
-                                 .Configs[usm::DisjointPoolMemType::Shared])
-                            .second));
-
+    break;
+  default:
     MemProvider = umf::memoryProviderMakeUnique<L0SharedReadOnlyMemoryProvider>(
-                      Context, device)
+                      Context, Device)
                       .second;
-    SharedReadOnlyMemPools.emplace(
-        std::piecewise_construct, std::make_tuple(device),
-        std::make_tuple(
-            umf::poolMakeUniqueFromOps(
-                umfDisjointPoolOps(), std::move(MemProvider),
-                &this->DisjointPoolConfigs
-                     .Configs[usm::DisjointPoolMemType::SharedReadOnly])
-                .second));
+    break;
   }
+  return umf::poolAddStats(
+      makeDisjointPool(std::move(MemProvider), DisjointPoolConfigs, MemType));
+}
+
+umf::pool_stats_t::snapshot_t ur_usm_pool_handle_t_::getStats() const {
+  auto Stats = umf::poolStatsSnapshot(HostMemPool);
+  for (auto *Pools :
+       {&DeviceMemPools, &SharedMemPools, &SharedReadOnlyMemPools})
+    for (auto &Pool : *Pools)
+      Stats += umf::poolStatsSnapshot(Pool.second);
+  return Stats;
+}
+
+size_t ur_usm_pool_handle_t_::trim(size_t BytesToKeep) {
+  size_t Released = 0;
+  auto TrimPool = [&](umf::pool_unique_handle_t &Pool,
+                      usm::DisjointPoolMemType MemType,
+                      ur_device_handle_t Device) {
+    Released += umf::poolTrim(Pool.get(), BytesToKeep);
+
+    // The disjoint pool never gives its free slabs back to the driver, so
+    // replace it once none of its memory is in use anymore.
+    auto *Stats = umf::findPoolStats(Pool.get());
+    if (!Stats)
+      return;
+    auto Snapshot = Stats->snapshot();
+    if (Snapshot.UsedSize == 0 && Snapshot.HeldSize > BytesToKeep) {
+      Pool = makePool(MemType, Device);
+      Released += Snapshot.HeldSize;
+    }
+  };
+
+  TrimPool(HostMemPool, usm::DisjointPoolMemType::Host, nullptr);
+  for (auto &[Device, Pool] : DeviceMemPools)
+    TrimPool(Pool, usm::DisjointPoolMemType::Device, Device);
+  for (auto &[Device, Pool] : SharedMemPools)
+    TrimPool(Pool, usm::DisjointPoolMemType::Shared, Device);
+  for (auto &[Device, Pool] : SharedReadOnlyMemPools)
+    TrimPool(Pool, usm::DisjointPoolMemType::SharedReadOnly, Device);
+  return Released;
+}
+
+// Trims the pools of Context once its allocations and frees, which hold one of
+// these locks, are locked out, so that the pools which aren't in use can be
+// replaced. Returns std::nullopt if Wait is false and the locks are taken.
+static std::optional<size_t> USMTrimPoolsImpl(ur_context_handle_t Context,
+                                              ur_usm_pool_handle_t Pool,
+                                              size_t BytesToKeep, bool Wait) {
+  std::unique_lock<ur_shared_mutex> ContextLock(Context->Mutex,
+                                                std::defer_lock);
+  std::unique_lock<ur_shared_mutex> ContextsLock(
+      Context->getPlatform()->ContextsMutex, std::defer_lock);
+  if (Wait) {
+    if (IndirectAccessTrackingEnabled)
+      std::lock(ContextLock, ContextsLock);
+    else
+      ContextLock.lock();
+  } else if (IndirectAccessTrackingEnabled
+                 ? std::try_lock(ContextLock, ContextsLock) != -1
+                 : !ContextLock.try_lock()) {
+    return std::nullopt;
+  }
+
+  if (Pool)
+    return Pool->trim(BytesToKeep);
+
+  // The shared pools are trimmed by their owner.
+  size_t Released = 0;
+  if (!Context->SharedPoolsOwner) {
+    Released += umf::poolTrim(Context->HostMemPool.get(), BytesToKeep);
+    for (auto *Pools : {&Context->DeviceMemPools, &Context->SharedMemPools,
+                        &Context->SharedReadOnlyMemPools})
+      for (auto &Entry : *Pools)
+        Released += umf::poolTrim(Entry.second.get(), BytesToKeep);
+  }
+  for (auto UsmPool : Context->UsmPoolHandles)
+    Released += UsmPool->trim(BytesToKeep);
+  Released += trimPhysicalMemPool(Context, BytesToKeep);
+  return Released;
+}
+
+size_t USMTrimPools(ur_context_handle_t Context, ur_usm_pool_handle_t Pool,
+                    size_t BytesToKeep) {
+  return *USMTrimPoolsImpl(Context, Pool, BytesToKeep, true);
+}
+
+static ur_result_t ZeMemFreeNow(ur_context_handle_t Context, void *Ptr) {
+  ZE2UR_CALL(zeMemFree, (Context->ZeContext, Ptr));
+
+  if (IndirectAccessTrackingEnabled)
+    UR_CALL(ContextReleaseHelper(Context));
+
+  return UR_RESULT_SUCCESS;
 }
 
 // If indirect access tracking is not enabled then this functions just performs
@@ -1104,14 +1354,16 @@ ur_result_t ZeMemFreeHelper(ur_context_handle_t Context, void *Ptr) {
     // Reference count is zero, it is ok to free memory.
     // We don't need to track this allocation anymore.
     Context->MemAllocs.erase(It);
-  }
 
-  ZE2UR_CALL(zeMemFree, (Context->ZeContext, Ptr));
-
-  if (IndirectAccessTrackingEnabled)
-    UR_CALL(ContextReleaseHelper(Context));
+    // Kernels in flight may still access the memory.
+    if (!Plt->IndirectAccessEpochsInFlight.empty()) {
+      Plt->DeferredFrees.push_back(
+          {Plt->IndirectAccessEpoch, Context, Ptr, true});
+      return UR_RESULT_SUCCESS;
+    }
+  }
 
-  return UR_RESULT_SUCCESS;
+  return ZeMemFreeNow(Context, Ptr);
 }
 
 static bool ShouldUseUSMAllocator() {
@@ -1124,6 +1376,72 @@ static bool ShouldUseUSMAllocator() {
 
 const bool UseUSMAllocator = ShouldUseUSMAllocator();
 
+std::unique_ptr<USMTrimWatchdog>
+USMTrimWatchdog::create(ur_context_handle_t Context) {
+  static const std::optional<uint64_t> ThresholdMB =
+      getenv_to_unsigned("UR_L0_USM_TRIM_FREE_MEMORY_THRESHOLD_MB");
+  static const uint64_t IntervalMs =
+      getenv_to_unsigned("UR_L0_USM_TRIM_INTERVAL_MS").value_or(100);
+  if (!ThresholdMB || !UseUSMAllocator)
+    return nullptr;
+
+  return std::make_unique<USMTrimWatchdog>(
+      Context, *ThresholdMB * 1024 * 1024,
+      std::chrono::milliseconds(std::max<uint64_t>(IntervalMs, 1)));
+}
+
+USMTrimWatchdog::USMTrimWatchdog(ur_context_handle_t Context,
+                                 uint64_t Threshold,
+                                 std::chrono::milliseconds Interval)
+    : Context(Context), Threshold(Threshold), Interval(Interval) {
+  Thread = std::thread(&USMTrimWatchdog::run, this);
+}
+
+USMTrimWatchdog::~USMTrimWatchdog() {
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    Stop = true;
+  }
+  Stopped.notify_one();
+  Thread.join();
+}
+
+void USMTrimWatchdog::run() {
+  bool WasLow = false;
+  std::unique_lock<std::mutex> Lock(Mutex);
+  while (!Stopped.wait_for(Lock, Interval, [this] { return Stop; })) {
+    bool IsLow = false;
+    for (auto Device : Context->Devices) {
+      uint64_t FreeMemory = 0;
+      auto Result = ur::level_zero::urDeviceGetInfo(
+          Device, UR_DEVICE_INFO_GLOBAL_MEM_FREE, sizeof(FreeMemory),
+          &FreeMemory, nullptr);
+      if (Result != UR_RESULT_SUCCESS) {
+        logger::warning("USM trim watchdog stopped, the free memory of the "
+                        "devices can't be queried: {}",
+                        Result);
+        return;
+      }
+      IsLow = IsLow || FreeMemory < Threshold;
+    }
+
+    // Trim once each time the free memory drops below the threshold, the
+    // pools would be of no use if they were trimmed at every check.
+    if (!IsLow || WasLow) {
+      WasLow = IsLow;
+      continue;
+    }
+    // Don't wait for the context, whoever holds its locks may be destroying
+    // it and waiting for the watchdog to stop. Try again at the next check.
+    if (auto Released = USMTrimPoolsImpl(Context, nullptr, 0, false)) {
+      logger::info("USM trim watchdog released {} bytes", *Released);
+      WasLow = true;
+    }
+  }
+}
+
+static ur_result_t USMFreeNow(ur_context_handle_t Context, void *Ptr);
+
 // Helper function to deallocate USM memory, if indirect access support is
 // enabled then a caller must lock the platform-level mutex guarding the
 // container with contexts because deallocating the memory can turn RefCount of
@@ -1151,8 +1469,20 @@ ur_result_t USMFreeHelper(ur_context_handle_t Context, void *Ptr,
     // Reference count is zero, it is ok to free memory.
     // We don't need to track this allocation anymore.
     Context->MemAllocs.erase(It);
+
+    // Kernels in flight may still access the memory.
+    ur_platform_handle_t Plt = Context->getPlatform();
+    if (!Plt->IndirectAccessEpochsInFlight.empty()) {
+      Plt->DeferredFrees.push_back(
+          {Plt->IndirectAccessEpoch, Context, Ptr, false});
+      return UR_RESULT_SUCCESS;
+    }
   }
 
+  return USMFreeNow(Context, Ptr);
+}
+
+static ur_result_t USMFreeNow(ur_context_handle_t Context, void *Ptr) {
   auto hPool = umfPoolByPtr(Ptr);
   if (!hPool) {
     if (IndirectAccessTrackingEnabled)
@@ -1160,8 +1490,43 @@ ur_result_t USMFreeHelper(ur_context_handle_t Context, void *Ptr,
     return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
   }
 
-  auto umfRet = umfPoolFree(hPool, Ptr);
+  auto umfRet = [&] {
+    auto SharedPoolsLock = Context->lockSharedPools();
+    return umf::cachedFree(hPool, Ptr);
+  }();
   if (IndirectAccessTrackingEnabled)
     UR_CALL(ContextReleaseHelper(Context));
   return umf2urResult(umfRet);
 }
+
+ur_result_t USMReleaseIndirectAccesses(ur_kernel_handle_t Kernel) {
+  ur_platform_handle_t Plt = Kernel->Program->Context->getPlatform();
+  std::scoped_lock<ur_shared_mutex> ContextsLock(Plt->ContextsMutex);
+
+  // Kernels submitted as part of a command-buffer aren't tracked.
+  if (Kernel->SubmissionEpochs.empty())
+    return UR_RESULT_SUCCESS;
+
+  // The submissions of the kernel may complete in any order. Dropping the
+  // latest epoch rather than the one of the submission which completed keeps
+  // the earliest epoch in flight no later than the actual one, so frees are
+  // only ever deferred for longer.
+  Plt->IndirectAccessEpochsInFlight.erase(Kernel->SubmissionEpochs.back());
+  Kernel->SubmissionEpochs.pop_back();
+
+  // A free can proceed once no submission up to its epoch is in flight.
+  auto &InFlight = Plt->IndirectAccessEpochsInFlight;
+  auto &DeferredFrees = Plt->DeferredFrees;
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  while (!DeferredFrees.empty() && (InFlight.empty() ||
+                                    DeferredFrees.front().Epoch <
+                                        *InFlight.begin())) {
+    auto Free = DeferredFrees.front();
+    DeferredFrees.pop_front();
+    auto FreeResult = Free.ZeMemFree ? ZeMemFreeNow(Free.Context, Free.Ptr)
+                                     : USMFreeNow(Free.Context, Free.Ptr);
+    if (FreeResult != UR_RESULT_SUCCESS)
+      Result = FreeResult;
+  }
+  return Result;
+}
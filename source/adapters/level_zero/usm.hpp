@@ -9,12 +9,27 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 #include "common.hpp"
 
 #include <umf_helpers.hpp>
+#include <ur_host_memory.hpp>
 
 usm::DisjointPoolAllConfigs InitializeDisjointPoolConfig();
 
+// Creates a disjoint pool of the given memory type, fronted by per-thread
+// caches when they are enabled in Configs.
+umf::pool_unique_handle_t
+makeDisjointPool(umf::provider_unique_handle_t MemProvider,
+                 usm::DisjointPoolAllConfigs &Configs,
+                 usm::DisjointPoolMemType MemType);
+
 struct ur_usm_pool_handle_t_ : _ur_object {
   bool zeroInit;
 
@@ -29,10 +44,57 @@ struct ur_usm_pool_handle_t_ : _ur_object {
       SharedReadOnlyMemPools;
   umf::pool_unique_handle_t HostMemPool;
 
+  // Placement of the memory of HostMemPool, from ur_exp_usm_host_pool_desc_t
+  usm::host_memory_config_t HostMemory;
+
   ur_context_handle_t Context{};
 
   ur_usm_pool_handle_t_(ur_context_handle_t Context,
                         ur_usm_pool_desc_t *PoolDesc);
+
+  // Usage of all the pools
+  umf::pool_stats_t::snapshot_t getStats() const;
+
+  // Returns the memory cached by the pools to the driver, keeping at most
+  // BytesToKeep cached in each of them. Allocations and frees in the context
+  // must be excluded by the caller. Returns the number of bytes released.
+  size_t trim(size_t BytesToKeep);
+
+private:
+  umf::pool_unique_handle_t makePool(usm::DisjointPoolMemType MemType,
+                                     ur_device_handle_t Device);
+};
+
+// Returns the memory cached by the USM pools of Context to the driver, only
+// by Pool if it is not null, keeping at most BytesToKeep cached in each of
+// them. Returns the number of bytes released.
+size_t USMTrimPools(ur_context_handle_t Context, ur_usm_pool_handle_t Pool,
+                    size_t BytesToKeep);
+
+// Trims all the USM pools of a context whenever the free memory of one of its
+// devices drops below a threshold. Enabled by setting
+// UR_L0_USM_TRIM_FREE_MEMORY_THRESHOLD_MB, the free memory is checked every
+// UR_L0_USM_TRIM_INTERVAL_MS milliseconds (100 by default).
+class USMTrimWatchdog {
+public:
+  // Returns nullptr if the watchdog is not enabled
+  static std::unique_ptr<USMTrimWatchdog> create(ur_context_handle_t Context);
+
+  USMTrimWatchdog(ur_context_handle_t Context, uint64_t Threshold,
+                  std::chrono::milliseconds Interval);
+  ~USMTrimWatchdog();
+
+private:
+  void run();
+
+  ur_context_handle_t Context;
+  uint64_t Threshold;
+  std::chrono::milliseconds Interval;
+
+  std::mutex Mutex;
+  std::condition_variable Stopped;
+  bool Stop = false;
+  std::thread Thread;
 };
 
 // Exception type to pass allocation errors
@@ -118,7 +180,22 @@ private:
   size_t MinPageSize = 0;
   bool MinPageSizeCached = false;
 
+  // The IPC handles opened by open_ipc_handle, by the process and the id of
+  // their export, so that opening a handle which is already open shares its
+  // mapping rather than duplicating the file descriptor of the peer and
+  // mapping the memory again. The mapping is closed with its last user. A
+  // handle exported again, e.g. once its memory is freed and reallocated,
+  // gets a new id, so the opens never reuse a stale mapping.
+  struct ipc_mapping_t {
+    void *Ptr;
+    size_t RefCount;
+  };
+  std::map<std::pair<int, uint64_t>, ipc_mapping_t> IpcMappings;
+  std::unordered_map<void *, decltype(IpcMappings)::iterator> IpcMappingsByPtr;
+  std::mutex IpcMappingsMutex;
+
 public:
+  ~L0MemoryProvider();
   umf_result_t initialize(ur_context_handle_t Ctx,
                           ur_device_handle_t Dev) override;
   umf_result_t alloc(size_t Size, size_t Align, void **Ptr) override;
@@ -154,8 +231,18 @@ protected:
                            uint32_t Alignment) override;
 };
 
-// Allocation routines for host memory type
+// Allocation routines for host memory type. Memory with a non-default
+// placement is mapped from the OS and imported into the driver.
 class L0HostMemoryProvider final : public L0MemoryProvider {
+  usm::host_memory_config_t HostMemory;
+
+public:
+  using L0MemoryProvider::initialize;
+  umf_result_t initialize(ur_context_handle_t Ctx, ur_device_handle_t Dev,
+                          const usm::host_memory_config_t &Memory);
+  umf_result_t free(void *Ptr, size_t Size) override;
+  umf_result_t get_min_page_size(void *Ptr, size_t *PageSize) override;
+
 protected:
   ur_result_t allocateImpl(void **ResultPtr, size_t Size,
                            uint32_t Alignment) override;
@@ -217,4 +304,9 @@ ur_result_t ZeMemFreeHelper(ur_context_handle_t Context, void *Ptr);
 ur_result_t USMFreeHelper(ur_context_handle_t Context, void *Ptr,
                           bool OwnZeMemHandle = true);
 
+// Called once a submission of Kernel has completed, when indirect access
+// tracking is enabled, to free the allocations which no submission in flight
+// may access anymore.
+ur_result_t USMReleaseIndirectAccesses(ur_kernel_handle_t Kernel);
+
 extern const bool UseUSMAllocator;
@@ -11,6 +11,54 @@
 #include "logger/ur_logger.hpp"
 #include "ur_level_zero.hpp"
 
+namespace {
+// The links reported by the driver. Devices with P2P access are linked over
+// the device fabric, e.g. Xe Link, when the fabric has an edge between them,
+// otherwise over PCIe, and the bandwidth needs the P2P bandwidth extension.
+ur_result_t queryPeerLink(ur_device_handle_t Src, ur_device_handle_t Dst,
+                          ur::peer_link_t &Link) {
+  const auto &Extensions = Src->Platform->zeDriverExtensionMap;
+  ZeStruct<ze_device_p2p_properties_t> P2PProperties;
+  ZeStruct<ze_device_p2p_bandwidth_exp_properties_t> BandwidthProperties;
+  bool HasBandwidth = Extensions.count(ZE_DEVICE_P2P_BANDWIDTH_EXP_NAME);
+  if (HasBandwidth) {
+    P2PProperties.pNext = &BandwidthProperties;
+  }
+  ZE2UR_CALL(zeDeviceGetP2PProperties,
+             (Src->ZeDevice, Dst->ZeDevice, &P2PProperties));
+  ze_bool_t CanAccess = false;
+  ZE2UR_CALL(zeDeviceCanAccessPeer,
+             (Src->ZeDevice, Dst->ZeDevice, &CanAccess));
+  if (!CanAccess ||
+      !(P2PProperties.flags & ZE_DEVICE_P2P_PROPERTY_FLAG_ACCESS)) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  Link.type = UR_EXP_PEER_LINK_TYPE_PCIE;
+  Link.hops = 1;
+  if (Extensions.count(ZE_FABRIC_EXP_NAME)) {
+    ze_fabric_vertex_handle_t SrcVertex = nullptr, DstVertex = nullptr;
+    uint32_t EdgeCount = 0;
+    if (ZE_CALL_NOCHECK(zeDeviceGetFabricVertexExp,
+                        (Src->ZeDevice, &SrcVertex)) == ZE_RESULT_SUCCESS &&
+        ZE_CALL_NOCHECK(zeDeviceGetFabricVertexExp,
+                        (Dst->ZeDevice, &DstVertex)) == ZE_RESULT_SUCCESS &&
+        ZE_CALL_NOCHECK(zeFabricEdgeGetExp,
+                        (SrcVertex, DstVertex, &EdgeCount, nullptr)) ==
+            ZE_RESULT_SUCCESS &&
+        EdgeCount > 0) {
+      Link.type = UR_EXP_PEER_LINK_TYPE_FABRIC;
+    }
+  }
+  // bytes per ns are GB/s
+  if (HasBandwidth && BandwidthProperties.bandwidthUnit ==
+                          ZE_BANDWIDTH_UNIT_BYTES_PER_NANOSEC) {
+    Link.bandwidth = uint64_t{BandwidthProperties.logicalBandwidth} * 1000;
+  }
+  return UR_RESULT_SUCCESS;
+}
+} // namespace
+
 namespace ur::level_zero {
 
 ur_result_t urUsmP2PEnablePeerAccessExp(ur_device_handle_t commandDevice,
@@ -66,7 +114,21 @@ ur_result_t urUsmP2PPeerAccessGetInfoExp(ur_device_handle_t commandDevice,
     break;
   }
   default: {
-    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    // Copies are staged through root devices only, the sub-devices of a
+    // root device share its links
+    auto *Platform = commandDevice->Platform;
+    std::vector<ur_device_handle_t> RootDevices;
+    {
+      std::shared_lock<ur_shared_mutex> Lock(Platform->URDevicesCacheMutex);
+      for (auto &Device : Platform->URDevicesCache) {
+        if (!Device->isSubDevice()) {
+          RootDevices.push_back(Device.get());
+        }
+      }
+    }
+    return Platform->PeerTopology.getInfo(propName, commandDevice, peerDevice,
+                                          RootDevices, queryPeerLink,
+                                          ReturnValue);
   }
   }
 
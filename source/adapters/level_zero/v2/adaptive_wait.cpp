@@ -0,0 +1,92 @@
+//===--------- adaptive_wait.cpp - Level Zero Adapter --------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "adaptive_wait.hpp"
+
+#include <algorithm>
+
+#include "../common.hpp"
+#include "ur_util.hpp"
+
+namespace v2 {
+
+// The newest completion time weighs 1/estimateWeight of the moving average
+static constexpr int64_t estimateWeight = 8;
+
+adaptive_wait_t::config_t adaptive_wait_t::getDefaultConfig() {
+  static const config_t defaultConfig = {
+      std::chrono::microseconds(
+          getenv_to_unsigned("UR_L0_V2_WAIT_SPIN_US").value_or(20)),
+      std::chrono::microseconds(
+          getenv_to_unsigned("UR_L0_V2_WAIT_YIELD_US").value_or(100))};
+  return defaultConfig;
+}
+
+adaptive_wait_t::adaptive_wait_t(config_t config)
+    : config(config), estimateNs(config.maxSpin.count() / 2) {}
+
+adaptive_wait_t::duration_t adaptive_wait_t::getSpinBudget() const {
+  auto estimate = getEstimate();
+  if (estimate > config.maxSpin + config.maxYield) {
+    return duration_t(0);
+  }
+  return std::min(2 * estimate, config.maxSpin);
+}
+
+adaptive_wait_t::duration_t adaptive_wait_t::getYieldBudget() const {
+  auto estimate = getEstimate();
+  if (estimate > config.maxSpin + config.maxYield) {
+    return duration_t(0);
+  }
+  return std::min(2 * estimate - getSpinBudget(), config.maxYield);
+}
+
+adaptive_wait_t::duration_t adaptive_wait_t::getEstimate() const {
+  return duration_t(estimateNs.load(std::memory_order_relaxed));
+}
+
+void adaptive_wait_t::record(duration_t elapsed) {
+  // Concurrent waits may lose an update, which only slows the learning down
+  auto estimate = estimateNs.load(std::memory_order_relaxed);
+  estimate += (elapsed.count() - estimate) / estimateWeight;
+  estimateNs.store(estimate, std::memory_order_relaxed);
+}
+
+adaptive_wait_t &getEventWaitPolicy() {
+  static adaptive_wait_t policy;
+  return policy;
+}
+
+ur_result_t hostSynchronize(adaptive_wait_t &policy,
+                            ze_command_list_handle_t zeCommandList) {
+  auto zeResult = policy.wait([zeCommandList](uint64_t timeout) {
+    return ZE_CALL_NOCHECK(zeCommandListHostSynchronize,
+                           (zeCommandList, timeout));
+  });
+  if (zeResult != ZE_RESULT_SUCCESS) {
+    logger::error("zeCommandListHostSynchronize failed: {}", zeResult);
+    return ze2urResult(zeResult);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t hostSynchronize(adaptive_wait_t &policy,
+                            ze_event_handle_t zeEvent) {
+  auto zeResult = policy.wait([zeEvent](uint64_t timeout) {
+    return ZE_CALL_NOCHECK(zeEventHostSynchronize, (zeEvent, timeout));
+  });
+  if (zeResult != ZE_RESULT_SUCCESS) {
+    logger::error("zeEventHostSynchronize failed: {}", zeResult);
+    return ze2urResult(zeResult);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+} // namespace v2
@@ -0,0 +1,95 @@
+//===--------- adaptive_wait.hpp - Level Zero Adapter --------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include <ur_api.h>
+#include <ze_api.h>
+
+namespace v2 {
+
+// Waits for the device by querying the status of the work for a while,
+// first spinning, then yielding the CPU between queries, and only then
+// blocking in the driver. Blocking costs a wakeup, which dominates the wait
+// for short kernels, while spinning burns a CPU for long ones, so the
+// phases are sized from the completion times of the recent waits: there is
+// no spinning or yielding when the work usually takes longer than the
+// configured maximum of the phase.
+class adaptive_wait_t {
+public:
+  using duration_t = std::chrono::nanoseconds;
+
+  struct config_t {
+    duration_t maxSpin;
+    duration_t maxYield;
+  };
+
+  // UR_L0_V2_WAIT_SPIN_US and UR_L0_V2_WAIT_YIELD_US, in microseconds,
+  // setting both to 0 blocks right away
+  static config_t getDefaultConfig();
+
+  adaptive_wait_t(config_t config = getDefaultConfig());
+
+  // Waits with sync(timeout), e.g. zeEventHostSynchronize or
+  // zeCommandListHostSynchronize, which returns ZE_RESULT_NOT_READY if the
+  // work isn't done within timeout nanoseconds
+  template <typename F> ze_result_t wait(F &&sync) {
+    if (config.maxSpin.count() == 0 && config.maxYield.count() == 0) {
+      return sync(UINT64_MAX);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto spinEnd = start + getSpinBudget();
+    auto yieldEnd = spinEnd + getYieldBudget();
+
+    ze_result_t result;
+    auto now = start;
+    while ((result = sync(0)) == ZE_RESULT_NOT_READY && now < yieldEnd) {
+      if (now >= spinEnd) {
+        std::this_thread::yield();
+      }
+      now = std::chrono::steady_clock::now();
+    }
+    if (result == ZE_RESULT_NOT_READY) {
+      result = sync(UINT64_MAX);
+    }
+
+    if (result == ZE_RESULT_SUCCESS) {
+      record(std::chrono::steady_clock::now() - start);
+    }
+    return result;
+  }
+
+  duration_t getSpinBudget() const;
+  duration_t getYieldBudget() const;
+  // The moving average of the recent completion times
+  duration_t getEstimate() const;
+
+private:
+  void record(duration_t elapsed);
+
+  const config_t config;
+  std::atomic<int64_t> estimateNs;
+};
+
+// The policy of the waits on events
+adaptive_wait_t &getEventWaitPolicy();
+
+// zeCommandListHostSynchronize and zeEventHostSynchronize with no timeout,
+// waiting as policy says
+ur_result_t hostSynchronize(adaptive_wait_t &policy,
+                            ze_command_list_handle_t zeCommandList);
+ur_result_t hostSynchronize(adaptive_wait_t &policy, ze_event_handle_t zeEvent);
+
+} // namespace v2
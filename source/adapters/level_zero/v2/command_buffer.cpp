@@ -0,0 +1,627 @@
+//===--------- command_buffer.cpp - Level Zero Adapter -------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "command_buffer.hpp"
+#include "adaptive_wait.hpp"
+#include "context.hpp"
+#include "event.hpp"
+#include "kernel.hpp"
+#include "memory.hpp"
+#include "queue_api.hpp"
+
+#include "../device.hpp"
+#include "../helpers/kernel_helpers.hpp"
+#include "../platform.hpp"
+#include "../ur_interface_loader.hpp"
+
+#include "loader/ze_loader.h"
+
+// The command list of a command-buffer is appended to the compute command
+// list of a queue, so it's for the same engine
+static uint32_t getComputeOrdinal(ur_device_handle_t hDevice) {
+  using queue_group_type = ur_device_handle_t_::queue_group_info_t::type;
+  return hDevice->QueueGroup[queue_group_type::Compute].ZeOrdinal;
+}
+
+ur_exp_command_buffer_handle_t_::ur_exp_command_buffer_handle_t_(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_exp_command_buffer_desc_t *pDesc)
+    : hContext(hContext), hDevice(hDevice),
+      isUpdatable(pDesc ? pDesc->isUpdatable : false),
+      commandList(hContext->commandListCache.getRegularCommandList(
+          hDevice->ZeDevice, true, getComputeOrdinal(hDevice), isUpdatable)) {
+  if (isUpdatable) {
+    ZE2UR_CALL_THROWS(zelLoaderTranslateHandle,
+                      (ZEL_HANDLE_COMMAND_LIST, commandList.get(),
+                       (void **)&zeCommandListTranslated));
+  }
+  hContext->retain();
+  ur::level_zero::urDeviceRetain(hDevice);
+}
+
+ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
+  // The command list goes back to the cache, where it's reset, so it must
+  // not be executing anymore
+  std::ignore = waitForLastSubmission();
+  commandList.reset();
+
+  ur::level_zero::urDeviceRelease(hDevice);
+  hContext->release();
+}
+
+void ur_exp_command_buffer_handle_t_::setLastSubmission(
+    ur_event_handle_t hEvent) {
+  if (lastSubmission) {
+    lastSubmission->release();
+  }
+  lastSubmission = hEvent;
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::waitForLastSubmission() {
+  if (!lastSubmission) {
+    return UR_RESULT_SUCCESS;
+  }
+  UR_CALL(v2::hostSynchronize(v2::getEventWaitPolicy(),
+                              lastSubmission->getZeEvent()));
+  setLastSubmission(nullptr);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_exp_command_buffer_command_handle_t_::
+    ur_exp_command_buffer_command_handle_t_(
+        ur_exp_command_buffer_handle_t hCommandBuffer, uint64_t commandId,
+        uint32_t workDim, ur_kernel_handle_t hKernel)
+    : hCommandBuffer(hCommandBuffer), commandId(commandId), workDim(workDim),
+      hKernel(hKernel) {
+  ur::level_zero::urCommandBufferRetainExp(hCommandBuffer);
+  ur::level_zero::urKernelRetain(hKernel);
+}
+
+ur_exp_command_buffer_command_handle_t_::
+    ~ur_exp_command_buffer_command_handle_t_() {
+  ur::level_zero::urCommandBufferReleaseExp(hCommandBuffer);
+  ur::level_zero::urKernelRelease(hKernel);
+}
+
+namespace {
+
+// The commands run in the order they are appended, so the sync points they
+// wait for have been reached when they start.
+void returnSyncPoint(ur_exp_command_buffer_handle_t hCommandBuffer,
+                     ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  auto syncPoint = hCommandBuffer->getNextSyncPoint();
+  if (pSyncPoint) {
+    *pSyncPoint = syncPoint;
+  }
+}
+
+ur_result_t appendMemoryCopy(ur_exp_command_buffer_handle_t hCommandBuffer,
+                             void *pDst, const void *pSrc, size_t size,
+                             ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::scoped_lock<ur_shared_mutex> Lock(hCommandBuffer->Mutex);
+
+  ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+             (hCommandBuffer->getZeCommandList(), pDst, pSrc, size, nullptr, 0,
+              nullptr));
+
+  returnSyncPoint(hCommandBuffer, pSyncPoint);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t appendMemoryFill(ur_exp_command_buffer_handle_t hCommandBuffer,
+                             void *pDst, const void *pPattern,
+                             size_t patternSize, size_t size,
+                             ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::scoped_lock<ur_shared_mutex> Lock(hCommandBuffer->Mutex);
+
+  ZE2UR_CALL(zeCommandListAppendMemoryFill,
+             (hCommandBuffer->getZeCommandList(), pDst, pPattern, patternSize,
+              size, nullptr, 0, nullptr));
+
+  returnSyncPoint(hCommandBuffer, pSyncPoint);
+  return UR_RESULT_SUCCESS;
+}
+
+// Creates the handle of a kernel command about to be appended to an
+// updatable command-buffer.
+ur_result_t
+createCommandHandle(ur_exp_command_buffer_handle_t hCommandBuffer,
+                    ur_kernel_handle_t hKernel, uint32_t workDim,
+                    ur_exp_command_buffer_command_handle_t *phCommand) {
+  ZeStruct<ze_mutable_command_id_exp_desc_t> zeMutableCommandDesc;
+  zeMutableCommandDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS |
+                               ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT |
+                               ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE |
+                               ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET;
+
+  uint64_t commandId = 0;
+  auto platform = hCommandBuffer->hContext->getPlatform();
+  ZE2UR_CALL(platform->ZeMutableCmdListExt.zexCommandListGetNextCommandIdExp,
+             (hCommandBuffer->zeCommandListTranslated, &zeMutableCommandDesc,
+              &commandId));
+
+  try {
+    *phCommand = new ur_exp_command_buffer_command_handle_t_(
+        hCommandBuffer, commandId, workDim, hKernel);
+  } catch (const std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    return UR_RESULT_ERROR_UNKNOWN;
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t validateUpdateDesc(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *pUpdate) {
+  auto hCommandBuffer = hCommand->hCommandBuffer;
+  auto supportedFeatures =
+      hCommandBuffer->hDevice->ZeDeviceMutableCmdListsProperties
+          ->mutableCommandFlags;
+
+  // Kernel handle updates are not supported
+  if (pUpdate->hNewKernel && pUpdate->hNewKernel != hCommand->hKernel) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  if (pUpdate->newWorkDim != hCommand->workDim &&
+      (!pUpdate->pNewGlobalWorkOffset || !pUpdate->pNewGlobalWorkSize)) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+
+  UR_ASSERT(!pUpdate->pNewGlobalWorkOffset ||
+                (supportedFeatures & ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET),
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+  if (pUpdate->pNewGlobalWorkOffset &&
+      !hCommandBuffer->hContext->getPlatform()
+           ->ZeDriverGlobalOffsetExtensionFound) {
+    logger::error("No global offset extension found on this driver");
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+
+  // A new global size without a new local size also updates the group size,
+  // to the one suggested by the driver
+  UR_ASSERT(!pUpdate->pNewLocalWorkSize ||
+                (supportedFeatures & ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE),
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+  UR_ASSERT(!pUpdate->pNewGlobalWorkSize ||
+                (supportedFeatures & ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT),
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+  UR_ASSERT(!pUpdate->pNewGlobalWorkSize ||
+                (supportedFeatures & ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE),
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+
+  UR_ASSERT(
+      (!pUpdate->numNewMemObjArgs && !pUpdate->numNewPointerArgs &&
+       !pUpdate->numNewValueArgs) ||
+          (supportedFeatures & ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS),
+      UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+
+  return UR_RESULT_SUCCESS;
+}
+
+} // namespace
+
+namespace ur::level_zero {
+
+ur_result_t
+urCommandBufferCreateExp(ur_context_handle_t hContext,
+                         ur_device_handle_t hDevice,
+                         const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
+                         ur_exp_command_buffer_handle_t *phCommandBuffer) {
+  if (pCommandBufferDesc && pCommandBufferDesc->isUpdatable) {
+    UR_ASSERT(hContext->getPlatform()->ZeMutableCmdListExt.Supported,
+              UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+  }
+
+  try {
+    *phCommandBuffer = new ur_exp_command_buffer_handle_t_(hContext, hDevice,
+                                                           pCommandBufferDesc);
+  } catch (const std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (ur_result_t result) {
+    return result;
+  } catch (...) {
+    return UR_RESULT_ERROR_UNKNOWN;
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+urCommandBufferRetainExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  hCommandBuffer->RefCount.increment();
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  if (!hCommandBuffer->RefCount.decrementAndTest())
+    return UR_RESULT_SUCCESS;
+
+  delete hCommandBuffer;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  std::scoped_lock<ur_shared_mutex> Lock(hCommandBuffer->Mutex);
+  UR_ASSERT(!hCommandBuffer->isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  ZE2UR_CALL(zeCommandListClose, (hCommandBuffer->getZeCommandList()));
+  hCommandBuffer->isFinalized = true;
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urCommandBufferAppendKernelLaunchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_kernel_handle_t hKernel,
+    uint32_t workDim, const size_t *pGlobalWorkOffset,
+    const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
+    uint32_t numKernelAlternatives, ur_kernel_handle_t *phKernelAlternatives,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  // Kernel handle updates aren't supported, so the alternatives are unused
+  std::ignore = numKernelAlternatives;
+  std::ignore = phKernelAlternatives;
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+
+  UR_ASSERT(hKernel->getProgramHandle(), UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+
+  auto hDevice = hCommandBuffer->hDevice;
+  ze_kernel_handle_t hZeKernel = hKernel->getZeHandle(hDevice);
+
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
+      hKernel->Mutex, hKernel->getProgramHandle()->Mutex,
+      hCommandBuffer->Mutex);
+
+  ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
+  UR_CALL(hKernel->prepareForSubmission(
+      hCommandBuffer->hContext, hDevice, pGlobalWorkOffset, workDim,
+      pGlobalWorkSize, pLocalWorkSize, zeThreadGroupDimensions));
+
+  UR_CALL(hKernel->appendArgPrefetches(hCommandBuffer->getZeCommandList()));
+
+  // The id of the command is the one of the next command appended
+  if (phCommand && hCommandBuffer->isUpdatable) {
+    UR_CALL(createCommandHandle(hCommandBuffer, hKernel, workDim, phCommand));
+  }
+
+  ZE2UR_CALL(zeCommandListAppendLaunchKernel,
+             (hCommandBuffer->getZeCommandList(), hZeKernel,
+              &zeThreadGroupDimensions, nullptr, 0, nullptr));
+
+  returnSyncPoint(hCommandBuffer, pSyncPoint);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urCommandBufferAppendUSMMemcpyExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst, const void *pSrc,
+    size_t size, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+
+  return appendMemoryCopy(hCommandBuffer, pDst, pSrc, size, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendUSMFillExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pMemory,
+    const void *pPattern, size_t patternSize, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+
+  return appendMemoryFill(hCommandBuffer, pMemory, pPattern, patternSize, size,
+                          pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendMemBufferCopyExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
+    ur_mem_handle_t hDstMem, size_t srcOffset, size_t dstOffset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+
+  UR_ASSERT(srcOffset + size <= hSrcMem->getSize(),
+            UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(dstOffset + size <= hDstMem->getSize(),
+            UR_RESULT_ERROR_INVALID_SIZE);
+
+  auto hDevice = hCommandBuffer->hDevice;
+  auto pSrc = ur_cast<char *>(hSrcMem->getPtr(hDevice));
+  auto pDst = ur_cast<char *>(hDstMem->getPtr(hDevice));
+  return appendMemoryCopy(hCommandBuffer, pDst + dstOffset, pSrc + srcOffset,
+                          size, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendMemBufferWriteExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, const void *pSrc,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+
+  UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
+
+  auto pDst = ur_cast<char *>(hBuffer->getPtr(hCommandBuffer->hDevice));
+  return appendMemoryCopy(hCommandBuffer, pDst + offset, pSrc, size,
+                          pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendMemBufferReadExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, void *pDst, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+
+  UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
+
+  auto pSrc = ur_cast<char *>(hBuffer->getPtr(hCommandBuffer->hDevice));
+  return appendMemoryCopy(hCommandBuffer, pDst, pSrc + offset, size,
+                          pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendMemBufferFillExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    const void *pPattern, size_t patternSize, size_t offset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+
+  UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
+
+  auto pDst = ur_cast<char *>(hBuffer->getPtr(hCommandBuffer->hDevice));
+  return appendMemoryFill(hCommandBuffer, pDst + offset, pPattern, patternSize,
+                          size, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendUSMPrefetchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_migration_flags_t flags,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  // TODO: figure out how to translate "flags"
+  std::ignore = flags;
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+
+  std::scoped_lock<ur_shared_mutex> Lock(hCommandBuffer->Mutex);
+
+  ZE2UR_CALL(zeCommandListAppendMemoryPrefetch,
+             (hCommandBuffer->getZeCommandList(), pMemory, size));
+
+  returnSyncPoint(hCommandBuffer, pSyncPoint);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urCommandBufferAppendUSMAdviseExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_advice_flags_t advice, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+
+  auto zeAdvice = ur_cast<ze_memory_advice_t>(advice);
+
+  std::scoped_lock<ur_shared_mutex> Lock(hCommandBuffer->Mutex);
+
+  ZE2UR_CALL(zeCommandListAppendMemAdvise,
+             (hCommandBuffer->getZeCommandList(),
+              hCommandBuffer->hDevice->ZeDevice, pMemory, size, zeAdvice));
+
+  returnSyncPoint(hCommandBuffer, pSyncPoint);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urCommandBufferEnqueueExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  std::scoped_lock<ur_shared_mutex> Lock(hCommandBuffer->Mutex);
+  UR_ASSERT(hCommandBuffer->isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  // The event of the submission is kept even if the caller doesn't want it,
+  // for the updates and the release of the command-buffer to wait for
+  ur_event_handle_t hEvent = nullptr;
+  UR_CALL(hQueue->enqueueCommandBuffer(hCommandBuffer->getZeCommandList(),
+                                       numEventsInWaitList, phEventWaitList,
+                                       &hEvent));
+  if (phEvent) {
+    hEvent->retain();
+    *phEvent = hEvent;
+  }
+  hCommandBuffer->setLastSubmission(hEvent);
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urCommandBufferRetainCommandExp(
+    ur_exp_command_buffer_command_handle_t hCommand) {
+  hCommand->RefCount.increment();
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urCommandBufferReleaseCommandExp(
+    ur_exp_command_buffer_command_handle_t hCommand) {
+  if (!hCommand->RefCount.decrementAndTest())
+    return UR_RESULT_SUCCESS;
+
+  delete hCommand;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urCommandBufferUpdateKernelLaunchExp(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) {
+  auto hCommandBuffer = hCommand->hCommandBuffer;
+  auto hDevice = hCommandBuffer->hDevice;
+
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
+      hCommand->Mutex, hCommandBuffer->Mutex, hCommand->hKernel->Mutex);
+
+  UR_ASSERT(hCommandBuffer->isUpdatable, UR_RESULT_ERROR_INVALID_OPERATION);
+  UR_ASSERT(hCommandBuffer->isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+  UR_CALL(validateUpdateDesc(hCommand, pUpdateKernelLaunch));
+
+  const uint64_t commandId = hCommand->commandId;
+  const uint32_t dim = pUpdateKernelLaunch->newWorkDim;
+
+  // The descriptors are chained once they don't move anymore
+  const void *pNext = nullptr;
+  auto chain = [&](auto &desc) {
+    desc.pNext = pNext;
+    pNext = &desc;
+  };
+
+  ZeStruct<ze_mutable_global_offset_exp_desc_t> offsetDesc;
+  if (size_t *pOffset = pUpdateKernelLaunch->pNewGlobalWorkOffset) {
+    offsetDesc.commandId = commandId;
+    offsetDesc.offsetX = pOffset[0];
+    offsetDesc.offsetY = dim >= 2 ? pOffset[1] : 0;
+    offsetDesc.offsetZ = dim == 3 ? pOffset[2] : 0;
+    chain(offsetDesc);
+  }
+
+  ZeStruct<ze_mutable_group_size_exp_desc_t> groupSizeDesc;
+  ZeStruct<ze_mutable_group_count_exp_desc_t> groupCountDesc;
+  ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
+  size_t *pLocalWorkSize = pUpdateKernelLaunch->pNewLocalWorkSize;
+  if (size_t *pGlobalWorkSize = pUpdateKernelLaunch->pNewGlobalWorkSize) {
+    uint32_t WG[3];
+    UR_CALL(calculateKernelWorkDimensions(
+        hCommand->hKernel->getZeHandle(hDevice), hDevice,
+        zeThreadGroupDimensions, WG, dim, pGlobalWorkSize, pLocalWorkSize));
+    groupCountDesc.commandId = commandId;
+    groupCountDesc.pGroupCount = &zeThreadGroupDimensions;
+    chain(groupCountDesc);
+
+    groupSizeDesc.commandId = commandId;
+    groupSizeDesc.groupSizeX = WG[0];
+    groupSizeDesc.groupSizeY = WG[1];
+    groupSizeDesc.groupSizeZ = WG[2];
+    chain(groupSizeDesc);
+  } else if (pLocalWorkSize) {
+    groupSizeDesc.commandId = commandId;
+    groupSizeDesc.groupSizeX = pLocalWorkSize[0];
+    groupSizeDesc.groupSizeY = dim >= 2 ? pLocalWorkSize[1] : 1;
+    groupSizeDesc.groupSizeZ = dim == 3 ? pLocalWorkSize[2] : 1;
+    chain(groupSizeDesc);
+  }
+
+  const uint32_t numMemObjArgs = pUpdateKernelLaunch->numNewMemObjArgs;
+  const uint32_t numArgs = numMemObjArgs +
+                           pUpdateKernelLaunch->numNewPointerArgs +
+                           pUpdateKernelLaunch->numNewValueArgs;
+  std::vector<ZeStruct<ze_mutable_kernel_argument_exp_desc_t>> argDescs(
+      numArgs);
+  // The pointers of the memory objects, which the descriptors point to
+  std::vector<void *> memObjPtrs(numMemObjArgs);
+  auto argDesc = argDescs.begin();
+  auto setArg = [&](uint32_t argIndex, size_t argSize, const void *pArgValue) {
+    argDesc->commandId = commandId;
+    argDesc->argIndex = argIndex;
+    argDesc->argSize = argSize;
+    argDesc->pArgValue = pArgValue;
+    chain(*argDesc++);
+  };
+
+  for (uint32_t i = 0; i < numMemObjArgs; ++i) {
+    const auto &arg = pUpdateKernelLaunch->pNewMemObjArgList[i];
+    memObjPtrs[i] =
+        arg.hNewMemObjArg ? arg.hNewMemObjArg->getPtr(hDevice) : nullptr;
+    setArg(arg.argIndex, sizeof(void *), &memObjPtrs[i]);
+  }
+  for (uint32_t i = 0; i < pUpdateKernelLaunch->numNewPointerArgs; ++i) {
+    const auto &arg = pUpdateKernelLaunch->pNewPointerArgList[i];
+    setArg(arg.argIndex, sizeof(void *), arg.pNewPointerArg);
+  }
+  for (uint32_t i = 0; i < pUpdateKernelLaunch->numNewValueArgs; ++i) {
+    const auto &arg = pUpdateKernelLaunch->pNewValueArgList[i];
+    // A pointer to a null pointer is a null pointer argument, as in
+    // urKernelSetArgValue
+    const void *pArgValue = arg.pNewValueArg;
+    if (arg.argSize == sizeof(void *) && pArgValue &&
+        *static_cast<void *const *>(pArgValue) == nullptr) {
+      pArgValue = nullptr;
+    }
+    setArg(arg.argIndex, arg.argSize, pArgValue);
+  }
+
+  ZeStruct<ze_mutable_commands_exp_desc_t> mutableCommandsDesc;
+  mutableCommandsDesc.pNext = pNext;
+  mutableCommandsDesc.flags = 0;
+
+  // The command list must not be executing while its commands are updated
+  UR_CALL(hCommandBuffer->waitForLastSubmission());
+
+  auto platform = hCommandBuffer->hContext->getPlatform();
+  ZE2UR_CALL(
+      platform->ZeMutableCmdListExt.zexCommandListUpdateMutableCommandsExp,
+      (hCommandBuffer->zeCommandListTranslated, &mutableCommandsDesc));
+  ZE2UR_CALL(zeCommandListClose, (hCommandBuffer->getZeCommandList()));
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+urCommandBufferGetInfoExp(ur_exp_command_buffer_handle_t hCommandBuffer,
+                          ur_exp_command_buffer_info_t propName,
+                          size_t propSize, void *pPropValue,
+                          size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{hCommandBuffer->RefCount.load()});
+  default:
+    assert(!"Command-buffer info request not implemented");
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
+}
+
+ur_result_t urCommandBufferCommandGetInfoExp(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    ur_exp_command_buffer_command_info_t propName, size_t propSize,
+    void *pPropValue, size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_COMMAND_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{hCommand->RefCount.load()});
+  default:
+    assert(!"Command-buffer command info request not implemented");
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
+}
+
+} // namespace ur::level_zero
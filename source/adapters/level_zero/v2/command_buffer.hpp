@@ -0,0 +1,73 @@
+//===--------- command_buffer.hpp - Level Zero Adapter -------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <ur/ur.hpp>
+#include <ur_api.h>
+#include <ze_api.h>
+
+#include "command_list_cache.hpp"
+#include "common.hpp"
+
+// A command-buffer is a regular, in-order command list of the compute engine,
+// borrowed from the command list cache of its context, which a queue appends
+// to its immediate command list on each submission. Its commands run one
+// after the other, so the sync points of the wait lists are already satisfied
+// when a command starts and no event is recorded for them.
+struct ur_exp_command_buffer_handle_t_ : public _ur_object {
+  ur_exp_command_buffer_handle_t_(ur_context_handle_t hContext,
+                                  ur_device_handle_t hDevice,
+                                  const ur_exp_command_buffer_desc_t *pDesc);
+  ~ur_exp_command_buffer_handle_t_();
+
+  // The sync point of the next command appended.
+  ur_exp_command_buffer_sync_point_t getNextSyncPoint() {
+    return nextSyncPoint++;
+  }
+
+  // Keeps the event signalled by the last submission of the command-buffer.
+  void setLastSubmission(ur_event_handle_t hEvent);
+  // Waits for the last submission, which must have completed before the
+  // commands of the command-buffer are updated.
+  ur_result_t waitForLastSubmission();
+
+  ze_command_list_handle_t getZeCommandList() const {
+    return commandList.get();
+  }
+
+  const ur_context_handle_t hContext;
+  const ur_device_handle_t hDevice;
+  const bool isUpdatable;
+  bool isFinalized = false;
+
+  // The handle of the command list known to the driver, for the functions of
+  // the mutable command list extension, which the loader doesn't intercept.
+  ze_command_list_handle_t zeCommandListTranslated = nullptr;
+
+private:
+  v2::raii::cache_borrowed_command_list_t commandList;
+  ur_exp_command_buffer_sync_point_t nextSyncPoint = 0;
+  ur_event_handle_t lastSubmission = nullptr;
+};
+
+// A kernel command of an updatable command-buffer.
+struct ur_exp_command_buffer_command_handle_t_ : public _ur_object {
+  ur_exp_command_buffer_command_handle_t_(
+      ur_exp_command_buffer_handle_t hCommandBuffer, uint64_t commandId,
+      uint32_t workDim, ur_kernel_handle_t hKernel);
+  ~ur_exp_command_buffer_command_handle_t_();
+
+  const ur_exp_command_buffer_handle_t hCommandBuffer;
+  // The id of the command in the mutable command list.
+  const uint64_t commandId;
+  // The work dimension the command was appended with.
+  const uint32_t workDim;
+  const ur_kernel_handle_t hKernel;
+};
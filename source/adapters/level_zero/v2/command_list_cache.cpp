@@ -16,13 +16,14 @@
 bool v2::immediate_command_list_descriptor_t::operator==(
     const immediate_command_list_descriptor_t &rhs) const {
   return ZeDevice == rhs.ZeDevice && IsInOrder == rhs.IsInOrder &&
-         Mode == rhs.Mode && Priority == rhs.Priority && Index == rhs.Index;
+         Ordinal == rhs.Ordinal && Mode == rhs.Mode &&
+         Priority == rhs.Priority && Index == rhs.Index;
 }
 
 bool v2::regular_command_list_descriptor_t::operator==(
     const regular_command_list_descriptor_t &rhs) const {
   return ZeDevice == rhs.ZeDevice && Ordinal == rhs.Ordinal &&
-         IsInOrder == rhs.IsInOrder;
+         IsInOrder == rhs.IsInOrder && IsMutable == rhs.IsMutable;
 }
 
 namespace v2 {
@@ -36,12 +37,19 @@ inline size_t command_list_descriptor_hash_t::operator()(
   } else {
     auto RegCmdDesc = std::get<regular_command_list_descriptor_t>(desc);
     return combine_hashes(0, RegCmdDesc.ZeDevice, RegCmdDesc.IsInOrder,
-                          RegCmdDesc.Ordinal);
+                          RegCmdDesc.Ordinal, RegCmdDesc.IsMutable);
   }
 }
 
-command_list_cache_t::command_list_cache_t(ze_context_handle_t ZeContext)
-    : ZeContext{ZeContext} {}
+size_t command_list_cache_t::getDefaultMaxNumCommandLists() {
+  static const size_t MaxNumCommandLists =
+      getenv_to_unsigned("UR_L0_V2_COMMAND_LIST_CACHE_SIZE").value_or(256);
+  return MaxNumCommandLists;
+}
+
+command_list_cache_t::command_list_cache_t(ze_context_handle_t ZeContext,
+                                           size_t MaxNumCommandLists)
+    : ZeContext{ZeContext}, MaxNumCommandLists{MaxNumCommandLists} {}
 
 raii::ze_command_list_handle_t
 command_list_cache_t::createCommandList(const command_list_descriptor_t &desc) {
@@ -69,6 +77,12 @@ command_list_cache_t::createCommandList(const command_list_descriptor_t &desc) {
         RegCmdDesc.IsInOrder ? ZE_COMMAND_LIST_FLAG_IN_ORDER : 0;
     CmdListDesc.commandQueueGroupOrdinal = RegCmdDesc.Ordinal;
 
+    ZeStruct<ze_mutable_command_list_exp_desc_t> MutableCmdListDesc;
+    if (RegCmdDesc.IsMutable) {
+      MutableCmdListDesc.flags = 0;
+      CmdListDesc.pNext = &MutableCmdListDesc;
+    }
+
     ze_command_list_handle_t ZeCommandList;
     ZE2UR_CALL_THROWS(zeCommandListCreate, (ZeContext, RegCmdDesc.ZeDevice,
                                             &CmdListDesc, &ZeCommandList));
@@ -100,68 +114,198 @@ command_list_cache_t::getImmediateCommandList(
 
 raii::cache_borrowed_command_list_t
 command_list_cache_t::getRegularCommandList(ze_device_handle_t ZeDevice,
-                                            bool IsInOrder, uint32_t Ordinal) {
+                                            bool IsInOrder, uint32_t Ordinal,
+                                            bool IsMutable) {
   TRACK_SCOPE_LATENCY("command_list_cache_t::getRegularCommandList");
 
   regular_command_list_descriptor_t Desc;
   Desc.ZeDevice = ZeDevice;
   Desc.IsInOrder = IsInOrder;
   Desc.Ordinal = Ordinal;
+  Desc.IsMutable = IsMutable;
 
   auto CommandList = getCommandList(Desc).release();
 
   return raii::cache_borrowed_command_list_t(
       CommandList, [Cache = this, Desc](ze_command_list_handle_t CmdList) {
+        // The next user expects an empty, open command list
+        ZE_CALL_NOCHECK(zeCommandListReset, (CmdList));
         Cache->addCommandList(Desc, raii::ze_command_list_handle_t(CmdList));
       });
 }
 
-raii::ze_command_list_handle_t
-command_list_cache_t::getCommandList(const command_list_descriptor_t &desc) {
+void command_list_cache_t::prewarmImmediateCommandLists(
+    ze_device_handle_t ZeDevice, bool IsInOrder, uint32_t Ordinal,
+    ze_command_queue_mode_t Mode, ze_command_queue_priority_t Priority,
+    size_t Count) {
+  TRACK_SCOPE_LATENCY("command_list_cache_t::prewarmImmediateCommandLists");
+
+  immediate_command_list_descriptor_t Desc;
+  Desc.ZeDevice = ZeDevice;
+  Desc.Ordinal = Ordinal;
+  Desc.IsInOrder = IsInOrder;
+  Desc.Mode = Mode;
+  Desc.Priority = Priority;
+  Desc.Index = std::nullopt;
+
+  for (size_t I = 0; I < Count; ++I) {
+    addToSharedCache(Desc, createCommandList(Desc));
+  }
+}
+
+command_list_cache_t::front_cache_t &command_list_cache_t::getFrontCache() {
+  static thread_local const size_t ThreadHash =
+      std::hash<std::thread::id>{}(std::this_thread::get_id());
+  return FrontCaches[ThreadHash % NumShards];
+}
+
+raii::ze_command_list_handle_t command_list_cache_t::takeFromFrontCache(
+    front_cache_t &FrontCache, const command_list_descriptor_t &desc) {
+  std::unique_lock<ur_mutex> Lock(FrontCache.Mutex);
+  auto &Entries = FrontCache.Entries;
+  for (auto It = Entries.rbegin(); It != Entries.rend(); ++It) {
+    if (It->first == desc) {
+      auto CommandListHandle = std::move(It->second);
+      Entries.erase(std::next(It).base());
+      return CommandListHandle;
+    }
+  }
+  return {};
+}
+
+raii::ze_command_list_handle_t command_list_cache_t::takeFromSharedCache(
+    const command_list_descriptor_t &desc) {
   std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
   auto it = ZeCommandListCache.find(desc);
   if (it == ZeCommandListCache.end()) {
-    Lock.unlock();
-    return createCommandList(desc);
+    return {};
   }
 
   assert(!it->second.empty());
 
-  raii::ze_command_list_handle_t CommandListHandle =
-      std::move(it->second.top());
-  it->second.pop();
-
+  auto LruIt = it->second.back();
+  it->second.pop_back();
   if (it->second.empty())
     ZeCommandListCache.erase(it);
 
+  raii::ze_command_list_handle_t CommandListHandle = std::move(LruIt->second);
+  ZeCommandListLru.erase(LruIt);
   return CommandListHandle;
 }
 
-void command_list_cache_t::addCommandList(
+void command_list_cache_t::addToSharedCache(
     const command_list_descriptor_t &desc,
     raii::ze_command_list_handle_t cmdList) {
-  // TODO: add a limit?
+  // Destroyed once the lock is released
+  raii::ze_command_list_handle_t Evicted;
+
   std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
+  if (MaxNumCommandLists == 0) {
+    Evicted = std::move(cmdList);
+    NumEvictions++;
+    return;
+  }
+
+  if (ZeCommandListLru.size() == MaxNumCommandLists) {
+    auto &Oldest = ZeCommandListLru.front();
+    auto OldestIt = ZeCommandListCache.find(Oldest.first);
+    OldestIt->second.pop_front();
+    if (OldestIt->second.empty())
+      ZeCommandListCache.erase(OldestIt);
+
+    Evicted = std::move(Oldest.second);
+    ZeCommandListLru.pop_front();
+    NumEvictions++;
+  }
+
+  ZeCommandListLru.emplace_back(desc, std::move(cmdList));
   auto [it, _] = ZeCommandListCache.try_emplace(desc);
-  it->second.emplace(std::move(cmdList));
+  it->second.push_back(std::prev(ZeCommandListLru.end()));
+}
+
+raii::ze_command_list_handle_t
+command_list_cache_t::getCommandList(const command_list_descriptor_t &desc) {
+  auto &FrontCache = getFrontCache();
+  if (auto CommandList = takeFromFrontCache(FrontCache, desc);
+      CommandList.get()) {
+    NumFrontHits++;
+    return CommandList;
+  }
+
+  if (auto CommandList = takeFromSharedCache(desc); CommandList.get()) {
+    NumHits++;
+    return CommandList;
+  }
+
+  // Command lists cached by other threads, so that the cache doesn't hold
+  // more of them than were in use at once
+  for (auto &OtherFrontCache : FrontCaches) {
+    if (&OtherFrontCache == &FrontCache) {
+      continue;
+    }
+    if (auto CommandList = takeFromFrontCache(OtherFrontCache, desc);
+        CommandList.get()) {
+      NumHits++;
+      return CommandList;
+    }
+  }
+
+  NumMisses++;
+  return createCommandList(desc);
+}
+
+void command_list_cache_t::addCommandList(
+    const command_list_descriptor_t &desc,
+    raii::ze_command_list_handle_t cmdList) {
+  auto &FrontCache = getFrontCache();
+  {
+    std::unique_lock<ur_mutex> Lock(FrontCache.Mutex);
+    if (FrontCache.Entries.size() < FrontCacheSize) {
+      FrontCache.Entries.emplace_back(desc, std::move(cmdList));
+      return;
+    }
+  }
+  addToSharedCache(desc, std::move(cmdList));
+}
+
+command_list_cache_stats_t command_list_cache_t::getStats() const {
+  return {NumFrontHits.load(), NumHits.load(), NumMisses.load(),
+          NumEvictions.load()};
 }
 
 size_t command_list_cache_t::getNumImmediateCommandLists() {
-  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
   size_t NumLists = 0;
-  for (auto &Pair : ZeCommandListCache) {
-    if (std::holds_alternative<immediate_command_list_descriptor_t>(Pair.first))
-      NumLists += Pair.second.size();
+  for (auto &FrontCache : FrontCaches) {
+    std::unique_lock<ur_mutex> Lock(FrontCache.Mutex);
+    for (auto &Entry : FrontCache.Entries) {
+      if (std::holds_alternative<immediate_command_list_descriptor_t>(
+              Entry.first))
+        NumLists++;
+    }
+  }
+  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
+  for (auto &Entry : ZeCommandListLru) {
+    if (std::holds_alternative<immediate_command_list_descriptor_t>(
+            Entry.first))
+      NumLists++;
   }
   return NumLists;
 }
 
 size_t command_list_cache_t::getNumRegularCommandLists() {
-  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
   size_t NumLists = 0;
-  for (auto &Pair : ZeCommandListCache) {
-    if (std::holds_alternative<regular_command_list_descriptor_t>(Pair.first))
-      NumLists += Pair.second.size();
+  for (auto &FrontCache : FrontCaches) {
+    std::unique_lock<ur_mutex> Lock(FrontCache.Mutex);
+    for (auto &Entry : FrontCache.Entries) {
+      if (std::holds_alternative<regular_command_list_descriptor_t>(
+              Entry.first))
+        NumLists++;
+    }
+  }
+  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
+  for (auto &Entry : ZeCommandListLru) {
+    if (std::holds_alternative<regular_command_list_descriptor_t>(Entry.first))
+      NumLists++;
   }
   return NumLists;
 }
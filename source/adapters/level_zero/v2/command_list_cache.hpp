@@ -9,7 +9,11 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <deque>
 #include <functional>
+#include <list>
 #include <stack>
 
 #include "latency_tracker.hpp"
@@ -40,6 +44,9 @@ struct regular_command_list_descriptor_t {
   ze_device_handle_t ZeDevice;
   bool IsInOrder;
   uint32_t Ordinal;
+  // Created with ze_mutable_command_list_exp_desc_t, for updatable
+  // command-buffers
+  bool IsMutable;
   bool operator==(const regular_command_list_descriptor_t &rhs) const;
 };
 
@@ -51,30 +58,98 @@ struct command_list_descriptor_hash_t {
   inline size_t operator()(const command_list_descriptor_t &desc) const;
 };
 
+struct command_list_cache_stats_t {
+  // Command lists found in the cache of the calling thread, or in the
+  // shared one
+  size_t FrontHits;
+  size_t Hits;
+  // Command lists created because none was cached
+  size_t Misses;
+  // Command lists destroyed to keep the shared cache within its bound
+  size_t Evictions;
+};
+
+// Command lists given back to the cache go to a small cache of the thread,
+// so that threads creating and destroying queues don't contend, and then to
+// a shared cache holding at most MaxNumCommandLists, which destroys the
+// least recently cached ones first.
 struct command_list_cache_t {
-  command_list_cache_t(ze_context_handle_t ZeContext);
+  // The number of threads sharing a front cache is roughly the number of
+  // threads over NumShards
+  static constexpr size_t NumShards = 8;
+  static constexpr size_t FrontCacheSize = 4;
+
+  // UR_L0_V2_COMMAND_LIST_CACHE_SIZE, or 256
+  static size_t getDefaultMaxNumCommandLists();
+
+  command_list_cache_t(
+      ze_context_handle_t ZeContext,
+      size_t MaxNumCommandLists = getDefaultMaxNumCommandLists());
 
   raii::cache_borrowed_command_list_t
   getImmediateCommandList(ze_device_handle_t ZeDevice, bool IsInOrder,
                           uint32_t Ordinal, ze_command_queue_mode_t Mode,
                           ze_command_queue_priority_t Priority,
                           std::optional<uint32_t> Index = std::nullopt);
+  // The command list is reset when it's given back to the cache
   raii::cache_borrowed_command_list_t
   getRegularCommandList(ze_device_handle_t ZeDevice, bool IsInOrder,
-                        uint32_t Ordinal);
+                        uint32_t Ordinal, bool IsMutable = false);
+
+  // Creates Count immediate command lists and adds them to the shared
+  // cache, so that the first queues using them don't create them
+  void prewarmImmediateCommandLists(ze_device_handle_t ZeDevice,
+                                    bool IsInOrder, uint32_t Ordinal,
+                                    ze_command_queue_mode_t Mode,
+                                    ze_command_queue_priority_t Priority,
+                                    size_t Count);
+
+  command_list_cache_stats_t getStats() const;
 
   // For testing purposes
   size_t getNumImmediateCommandLists();
   size_t getNumRegularCommandLists();
 
 private:
+  using cache_entry_t =
+      std::pair<command_list_descriptor_t, raii::ze_command_list_handle_t>;
+
+  struct front_cache_t {
+    ur_mutex Mutex;
+    // The most recently cached at the back
+    std::vector<cache_entry_t> Entries;
+  };
+
   ze_context_handle_t ZeContext;
+  const size_t MaxNumCommandLists;
+
+  std::array<front_cache_t, NumShards> FrontCaches;
+
+  // The shared cache, the least recently cached command list at the front
+  // of ZeCommandListLru, and the position of the command lists of each
+  // descriptor in it, the least recently cached first
+  std::list<cache_entry_t> ZeCommandListLru;
   std::unordered_map<command_list_descriptor_t,
-                     std::stack<raii::ze_command_list_handle_t>,
+                     std::deque<std::list<cache_entry_t>::iterator>,
                      command_list_descriptor_hash_t>
       ZeCommandListCache;
   ur_mutex ZeCommandListCacheMutex;
 
+  std::atomic<size_t> NumFrontHits{0};
+  std::atomic<size_t> NumHits{0};
+  std::atomic<size_t> NumMisses{0};
+  std::atomic<size_t> NumEvictions{0};
+
+  front_cache_t &getFrontCache();
+  // These return an empty handle when no command list of desc is cached
+  static raii::ze_command_list_handle_t
+  takeFromFrontCache(front_cache_t &FrontCache,
+                     const command_list_descriptor_t &desc);
+  raii::ze_command_list_handle_t
+  takeFromSharedCache(const command_list_descriptor_t &desc);
+  void addToSharedCache(const command_list_descriptor_t &desc,
+                        raii::ze_command_list_handle_t cmdList);
+
   raii::ze_command_list_handle_t
   getCommandList(const command_list_descriptor_t &desc);
   void addCommandList(const command_list_descriptor_t &desc,
@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "../device.hpp"
+#include "../helpers/module_cache.hpp"
 
 #include "context.hpp"
 #include "event_provider_normal.hpp"
@@ -28,7 +29,39 @@ ur_context_handle_t_::ur_context_handle_t_(ze_context_handle_t hContext,
                            context, device, v2::EVENT_COUNTER,
                            v2::QUEUE_IMMEDIATE);
                      }),
-      defaultUSMPool(this, nullptr) {}
+      defaultUSMPool(this, nullptr) {
+  prewarmCommandLists();
+}
+
+void ur_context_handle_t_::prewarmCommandLists() {
+  // The command lists of in-order queues with the default properties
+  static const size_t numPrewarmed =
+      getenv_to_unsigned("UR_L0_V2_PREWARM_COMMAND_LISTS").value_or(0);
+  if (!numPrewarmed) {
+    return;
+  }
+
+  using queue_group_type = ur_device_handle_t_::queue_group_info_t::type;
+  try {
+    for (auto hDevice : hDevices) {
+      auto computeOrdinal =
+          hDevice->QueueGroup[queue_group_type::Compute].ZeOrdinal;
+      auto copyOrdinal =
+          hDevice->hasMainCopyEngine()
+              ? hDevice->QueueGroup[queue_group_type::MainCopy].ZeOrdinal
+              : computeOrdinal;
+      for (auto ordinal : {computeOrdinal, copyOrdinal}) {
+        commandListCache.prewarmImmediateCommandLists(
+            hDevice->ZeDevice, true, ordinal,
+            ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS,
+            ZE_COMMAND_QUEUE_PRIORITY_NORMAL, numPrewarmed);
+      }
+    }
+  } catch (ur_result_t result) {
+    logger::warning("failed to prewarm the command lists of the context: {}",
+                    result);
+  }
+}
 
 ur_result_t ur_context_handle_t_::retain() {
   RefCount.increment();
@@ -39,6 +72,12 @@ ur_result_t ur_context_handle_t_::release() {
   if (!RefCount.decrementAndTest())
     return UR_RESULT_SUCCESS;
 
+  // The process exits once torn down, the context and its caches are left to
+  // the OS
+  if (fast_teardown_enabled())
+    return UR_RESULT_SUCCESS;
+
+  destroyReusableModules(getZeHandle());
   delete this;
   return UR_RESULT_SUCCESS;
 }
@@ -65,6 +104,31 @@ ur_usm_pool_handle_t ur_context_handle_t_::getDefaultUSMPool() {
   return &defaultUSMPool;
 }
 
+void ur_context_handle_t_::addUSMPool(ur_usm_pool_handle_t hPool) {
+  std::scoped_lock<ur_shared_mutex> lock(usmPoolsMutex);
+  usmPools.push_back(hPool);
+}
+
+void ur_context_handle_t_::removeUSMPool(ur_usm_pool_handle_t hPool) {
+  std::scoped_lock<ur_shared_mutex> lock(usmPoolsMutex);
+  usmPools.remove(hPool);
+}
+
+ur_usm_pool_handle_t
+ur_context_handle_t_::findUSMPool(umf_memory_pool_handle_t umfPool) {
+  if (defaultUSMPool.hasPool(umfPool)) {
+    return &defaultUSMPool;
+  }
+
+  std::shared_lock<ur_shared_mutex> lock(usmPoolsMutex);
+  for (auto hPool : usmPools) {
+    if (hPool->hasPool(umfPool)) {
+      return hPool;
+    }
+  }
+  return nullptr;
+}
+
 namespace ur::level_zero {
 ur_result_t urContextCreate(uint32_t deviceCount,
                             const ur_device_handle_t *phDevices,
@@ -109,11 +173,8 @@ ur_result_t urContextGetInfo(ur_context_handle_t hContext,
   case UR_CONTEXT_INFO_REFERENCE_COUNT:
     return ReturnValue(uint32_t{hContext->RefCount.load()});
   case UR_CONTEXT_INFO_USM_MEMCPY2D_SUPPORT:
-    // TODO: this is currently not implemented
-    return ReturnValue(uint8_t{false});
   case UR_CONTEXT_INFO_USM_FILL2D_SUPPORT:
-    // 2D USM fill is not supported.
-    return ReturnValue(uint8_t{false});
+    return ReturnValue(uint8_t{true});
   default:
     return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
   }
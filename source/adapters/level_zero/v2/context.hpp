@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <list>
+
 #include <ur_api.h>
 
 #include "command_list_cache.hpp"
@@ -29,6 +31,12 @@ struct ur_context_handle_t_ : _ur_object {
   const std::vector<ur_device_handle_t> &getDevices() const;
   ur_usm_pool_handle_t getDefaultUSMPool();
 
+  // Tracks the pools created with urUSMPoolCreate on this context
+  void addUSMPool(ur_usm_pool_handle_t hPool);
+  void removeUSMPool(ur_usm_pool_handle_t hPool);
+  // Returns the pool, the default one included, owning umfPool, or nullptr
+  ur_usm_pool_handle_t findUSMPool(umf_memory_pool_handle_t umfPool);
+
   // Checks if Device is covered by this context.
   // For that the Device or its root devices need to be in the context.
   bool isValidDevice(ur_device_handle_t Device) const;
@@ -38,4 +46,12 @@ struct ur_context_handle_t_ : _ur_object {
   v2::command_list_cache_t commandListCache;
   v2::event_pool_cache eventPoolCache;
   ur_usm_pool_handle_t_ defaultUSMPool;
+
+private:
+  ur_shared_mutex usmPoolsMutex;
+  std::list<ur_usm_pool_handle_t> usmPools;
+
+  // Fills the command list cache with UR_L0_V2_PREWARM_COMMAND_LISTS lists
+  // for each kind of list of the default queues of each device
+  void prewarmCommandLists();
 };
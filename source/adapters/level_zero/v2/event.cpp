@@ -8,11 +8,16 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+#include <thread>
+
 #include <ze_api.h>
 
+#include "adaptive_wait.hpp"
 #include "event.hpp"
 #include "event_pool.hpp"
 #include "event_provider.hpp"
+#include "ur_event_callbacks.hpp"
 
 ur_event_handle_t_::ur_event_handle_t_(v2::event_allocation eventAllocation,
                                        v2::event_pool *pool)
@@ -25,12 +30,46 @@ void ur_event_handle_t_::reset() {
   if (type == v2::event_type::EVENT_REGULAR) {
     zeEventHostReset(zeEvent.get());
   }
+  signalList = nullptr;
 }
 
 ze_event_handle_t ur_event_handle_t_::getZeEvent() const {
   return zeEvent.get();
 }
 
+void ur_event_handle_t_::setSignalList(
+    ze_command_list_handle_t hZeCommandList) {
+  signalList = hZeCommandList;
+}
+
+ze_command_list_handle_t ur_event_handle_t_::getSignalList() const {
+  return signalList;
+}
+
+bool ur_event_handle_t_::isCompleted() const {
+  return type == v2::event_type::EVENT_COUNTER &&
+         zeEventQueryStatus(zeEvent.get()) == ZE_RESULT_SUCCESS;
+}
+
+void v2::getPrunedWaitList(std::vector<ze_event_handle_t> &waitList,
+                           const ur_event_handle_t *phWaitEvents,
+                           uint32_t numWaitEvents,
+                           ze_command_list_handle_t hZeCommandList) {
+  waitList.clear();
+  for (uint32_t i = 0; i < numWaitEvents; i++) {
+    auto hEvent = phWaitEvents[i];
+    if (hEvent->getSignalList() == hZeCommandList || hEvent->isCompleted()) {
+      continue;
+    }
+    waitList.push_back(hEvent->getZeEvent());
+  }
+  if (waitList.size() > 1) {
+    std::sort(waitList.begin(), waitList.end());
+    waitList.erase(std::unique(waitList.begin(), waitList.end()),
+                   waitList.end());
+  }
+}
+
 ur_result_t ur_event_handle_t_::retain() {
   RefCount.increment();
   return UR_RESULT_SUCCESS;
@@ -52,11 +91,61 @@ ur_result_t urEventRelease(ur_event_handle_t hEvent) {
   return hEvent->release();
 }
 
+// The callbacks of urEventSetCallback of all the events, see
+// ur_event_callbacks.hpp.
+static ur::event_callback_dispatcher_t &getEventCallbackDispatcher() {
+  static ur::event_callback_dispatcher_t dispatcher{
+      ur::event_callback_dispatcher_t::statusQuery(urEventGetInfo),
+      [](ur_event_handle_t hEvent) { urEventRetain(hEvent); },
+      [](ur_event_handle_t hEvent) { urEventRelease(hEvent); }};
+  return dispatcher;
+}
+
 ur_result_t urEventWait(uint32_t numEvents,
                         const ur_event_handle_t *phEventWaitList) {
   for (uint32_t i = 0; i < numEvents; ++i) {
-    ZE2UR_CALL(zeEventHostSynchronize,
-               (phEventWaitList[i]->getZeEvent(), UINT64_MAX));
+    UR_CALL(v2::hostSynchronize(v2::getEventWaitPolicy(),
+                                phEventWaitList[i]->getZeEvent()));
+  }
+  // The callbacks of the events have run once they are waited for.
+  getEventCallbackDispatcher().flush(numEvents, phEventWaitList);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEventWaitAnyExp(uint32_t numEvents,
+                              const ur_event_handle_t *phEventWaitList,
+                              uint32_t *pEventIndex) {
+  if (numEvents == 1) {
+    *pEventIndex = 0;
+    return urEventWait(1, phEventWaitList);
+  }
+
+  // Level Zero can only block on one event at a time, so poll them all,
+  // yielding the CPU between the rounds
+  for (;;) {
+    for (uint32_t i = 0; i < numEvents; ++i) {
+      auto zeStatus = ZE_CALL_NOCHECK(zeEventQueryStatus,
+                                      (phEventWaitList[i]->getZeEvent()));
+      if (zeStatus == ZE_RESULT_SUCCESS) {
+        *pEventIndex = i;
+        return UR_RESULT_SUCCESS;
+      }
+      if (zeStatus != ZE_RESULT_NOT_READY) {
+        return ze2urResult(zeStatus);
+      }
+    }
+    std::this_thread::yield();
+  }
+}
+
+ur_result_t urEventGetExecutionStatusExp(uint32_t numEvents,
+                                         const ur_event_handle_t *phEvents,
+                                         ur_event_status_t *pStatuses) {
+  for (uint32_t i = 0; i < numEvents; ++i) {
+    auto zeStatus =
+        ZE_CALL_NOCHECK(zeEventQueryStatus, (phEvents[i]->getZeEvent()));
+    pStatuses[i] = zeStatus == ZE_RESULT_NOT_READY ? UR_EVENT_STATUS_SUBMITTED
+                                                   : UR_EVENT_STATUS_COMPLETE;
   }
   return UR_RESULT_SUCCESS;
 }
@@ -88,4 +177,17 @@ ur_result_t urEventGetInfo(ur_event_handle_t hEvent, ur_event_info_t propName,
 
   return UR_RESULT_SUCCESS;
 }
+
+ur_result_t urEventSetCallback(ur_event_handle_t hEvent,
+                               ur_execution_info_t execStatus,
+                               ur_event_callback_t pfnNotify, void *pUserData) {
+  try {
+    getEventCallbackDispatcher().add(hEvent, execStatus, pfnNotify, pUserData);
+  } catch (const std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    return UR_RESULT_ERROR_UNKNOWN;
+  }
+  return UR_RESULT_SUCCESS;
+}
 } // namespace ur::level_zero
@@ -9,7 +9,9 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <atomic>
 #include <stack>
+#include <vector>
 
 #include <ur/ur.hpp>
 #include <ur_api.h>
@@ -30,11 +32,39 @@ public:
   void reset();
   ze_event_handle_t getZeEvent() const;
 
+  // The in-order command list of the command which signals the event, if it
+  // was returned by a queue.
+  void setSignalList(ze_command_list_handle_t hZeCommandList);
+  ze_command_list_handle_t getSignalList() const;
+
+  // Tells if a counter-based event is known to be signalled, without waiting.
+  // Regular events may be reset and reused, so they never are.
+  bool isCompleted() const;
+
   ur_result_t retain();
   ur_result_t release();
 
 private:
+  friend class v2::event_pool;
+
   v2::event_type type;
   v2::raii::cache_borrowed_event zeEvent;
   v2::event_pool *pool;
+  ze_command_list_handle_t signalList = nullptr;
+
+  // The position of the event in the pool, and of the next free one while
+  // it's on the pool's free list
+  uint32_t poolIndex = 0;
+  std::atomic<uint32_t> nextFree{0};
 };
+
+namespace v2 {
+// Fills waitList with the events of phWaitEvents that a command appended to
+// the in-order list hZeCommandList has to wait for: without duplicates, the
+// events signalled by earlier commands of the same list, and the completed
+// counter-based events.
+void getPrunedWaitList(std::vector<ze_event_handle_t> &waitList,
+                       const ur_event_handle_t *phWaitEvents,
+                       uint32_t numWaitEvents,
+                       ze_command_list_handle_t hZeCommandList);
+} // namespace v2
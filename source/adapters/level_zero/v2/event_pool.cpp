@@ -15,37 +15,84 @@ namespace v2 {
 
 static constexpr size_t EVENTS_BURST = 64;
 
-ur_event_handle_t_ *event_pool::allocate() {
-  TRACK_SCOPE_LATENCY("event_pool::allocate");
+ur_event_handle_t_ *event_pool::getEvent(uint32_t index) {
+  // Segment i holds EVENTS_BURST << i events
+  size_t segment = 0;
+  size_t begin = 0;
+  while (index >= begin + (EVENTS_BURST << segment)) {
+    begin += EVENTS_BURST << segment;
+    segment++;
+  }
+  return &segments[segment][index - begin];
+}
+
+void event_pool::pushChain(ur_event_handle_t_ *first,
+                           ur_event_handle_t_ *last) {
+  auto head = freeHead.load(std::memory_order_relaxed);
+  do {
+    last->nextFree.store(headIndex(head), std::memory_order_relaxed);
+  } while (!freeHead.compare_exchange_weak(
+      head, makeHead(first->poolIndex, headTag(head) + 1),
+      std::memory_order_release, std::memory_order_relaxed));
+}
 
-  std::unique_lock<std::mutex> lock(*mutex);
+void event_pool::grow() {
+  std::unique_lock<std::mutex> lock(growMutex);
 
-  if (freelist.empty()) {
-    auto start = events.size();
-    auto end = start + EVENTS_BURST;
-    for (; start < end; ++start) {
-      events.emplace_back(provider->allocate(), this);
-      freelist.push_back(&events.at(start));
+  if (headIndex(freeHead.load(std::memory_order_acquire)) != emptyIndex) {
+    return;
+  }
+  if (numSegments == maxSegments) {
+    throw UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+
+  size_t begin = EVENTS_BURST * ((size_t(1) << numSegments) - 1);
+  auto &segment = segments[numSegments];
+  for (size_t i = 0; i < EVENTS_BURST << numSegments; ++i) {
+    auto &event = segment.emplace_back(provider->allocate(), this);
+    event.poolIndex = static_cast<uint32_t>(begin + i);
+    if (i) {
+      segment[i - 1].nextFree.store(event.poolIndex, std::memory_order_relaxed);
     }
   }
+  numSegments++;
 
-  auto event = freelist.back();
-  freelist.pop_back();
+  pushChain(&segment.front(), &segment.back());
+}
 
-  return event;
+ur_event_handle_t_ *event_pool::allocate() {
+  TRACK_SCOPE_LATENCY("event_pool::allocate");
+
+  auto head = freeHead.load(std::memory_order_acquire);
+  for (;;) {
+    if (headIndex(head) == emptyIndex) {
+      grow();
+      head = freeHead.load(std::memory_order_acquire);
+      continue;
+    }
+
+    // The event may be popped by another thread before the exchange, which
+    // then fails since the tag changed
+    auto event = getEvent(headIndex(head));
+    auto next = event->nextFree.load(std::memory_order_relaxed);
+    if (freeHead.compare_exchange_weak(head, makeHead(next, headTag(head) + 1),
+                                       std::memory_order_acquire,
+                                       std::memory_order_acquire)) {
+      return event;
+    }
+  }
 }
 
 void event_pool::free(ur_event_handle_t_ *event) {
   TRACK_SCOPE_LATENCY("event_pool::free");
 
-  std::unique_lock<std::mutex> lock(*mutex);
-
   event->reset();
-  freelist.push_back(event);
 
   // The event is still in the pool, so we need to increment the refcount
   assert(event->RefCount.load() == 0);
   event->RefCount.increment();
+
+  pushChain(event, event);
 }
 
 event_provider *event_pool::getProvider() { return provider.get(); }
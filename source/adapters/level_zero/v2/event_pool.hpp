@@ -9,6 +9,10 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <stack>
@@ -30,31 +34,54 @@ class event_pool {
 public:
   // store weak reference to the queue as event_pool is part of the queue
   event_pool(std::unique_ptr<event_provider> Provider)
-      : provider(std::move(Provider)), mutex(std::make_unique<std::mutex>()){};
-
-  event_pool(event_pool &&other) = default;
-  event_pool &operator=(event_pool &&other) = default;
+      : provider(std::move(Provider)){};
 
   event_pool(const event_pool &) = delete;
   event_pool &operator=(const event_pool &) = delete;
 
   DeviceId Id() { return provider->device()->Id.value(); };
 
-  // Allocate an event from the pool. Thread safe.
+  // Allocate an event from the pool. Thread safe, and lock-free unless
+  // the pool has to create more events.
   ur_event_handle_t_ *allocate();
 
-  // Free an event back to the pool. Thread safe.
+  // Free an event back to the pool. Thread safe and lock-free.
   void free(ur_event_handle_t_ *event);
 
   event_provider *getProvider();
 
 private:
+  // The free list is a stack of event indices. Its head keeps a tag, bumped
+  // by every change, so that a pop racing with other threads popping and
+  // pushing back the same event fails instead of corrupting the list.
+  static constexpr uint32_t emptyIndex = UINT32_MAX;
+  static uint64_t makeHead(uint32_t index, uint32_t tag) {
+    return (uint64_t(tag) << 32) | index;
+  }
+  static uint32_t headIndex(uint64_t head) { return uint32_t(head); }
+  static uint32_t headTag(uint64_t head) { return uint32_t(head >> 32); }
+
+  ur_event_handle_t_ *getEvent(uint32_t index);
+
+  // Pushes the events [first, last] of a segment, linked to one another
+  void pushChain(ur_event_handle_t_ *first, ur_event_handle_t_ *last);
+
+  // Creates the next segment of events, unless another thread refilled the
+  // free list in the meantime
+  void grow();
+
   std::unique_ptr<event_provider> provider;
 
-  std::deque<ur_event_handle_t_> events;
-  std::vector<ur_event_handle_t_ *> freelist;
+  // The events are created in segments of doubling size, which are never
+  // resized once published, so that they can be read without locking.
+  static constexpr size_t maxSegments = 26;
+  std::array<std::deque<ur_event_handle_t_>, maxSegments> segments;
+  size_t numSegments = 0;
+
+  std::atomic<uint64_t> freeHead{makeHead(emptyIndex, 0)};
 
-  std::unique_ptr<std::mutex> mutex;
+  // Serializes the creation of segments
+  std::mutex growMutex;
 };
 
 } // namespace v2
@@ -15,10 +15,13 @@
 #include "memory.hpp"
 
 #include "../device.hpp"
+#include "../helpers/kernel_helpers.hpp"
 #include "../platform.hpp"
 #include "../program.hpp"
 #include "../ur_interface_loader.hpp"
 
+#include <cstring>
+
 ur_single_device_kernel_t::ur_single_device_kernel_t(ur_device_handle_t hDevice,
                                                      ze_kernel_handle_t hKernel,
                                                      bool ownZeHandle)
@@ -34,6 +37,117 @@ ur_result_t ur_single_device_kernel_t::release() {
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t ur_single_device_kernel_t::setArgValue(uint32_t argIndex,
+                                                   size_t argSize,
+                                                   const void *pArgValue) {
+  if (argIndex >= argValues.size()) {
+    argValues.resize(argIndex + 1);
+  }
+
+  auto &arg = argValues[argIndex];
+  bool isNull = pArgValue == nullptr;
+  if (arg.isSet && arg.isNull == isNull && arg.value.size() == argSize &&
+      (isNull || std::memcmp(arg.value.data(), pArgValue, argSize) == 0)) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  // Forget the value until the driver has it
+  arg.isSet = false;
+  ZE2UR_CALL(zeKernelSetArgumentValue,
+             (hKernel.get(), argIndex, argSize, pArgValue));
+
+  arg.isNull = isNull;
+  if (isNull) {
+    arg.value.resize(argSize);
+  } else {
+    auto bytes = static_cast<const char *>(pArgValue);
+    arg.value.assign(bytes, bytes + argSize);
+  }
+  arg.isSet = true;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+ur_single_device_kernel_t::setGroupSize(const uint32_t (&groupSize)[3]) {
+  std::array<uint32_t, 3> size = {groupSize[0], groupSize[1], groupSize[2]};
+  if (appliedGroupSize == size) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  appliedGroupSize.reset();
+  ZE2UR_CALL(zeKernelSetGroupSize,
+             (hKernel.get(), groupSize[0], groupSize[1], groupSize[2]));
+  appliedGroupSize = size;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+ur_single_device_kernel_t::setGlobalOffset(ur_context_handle_t hContext,
+                                           uint32_t workDim,
+                                           const size_t *pGlobalWorkOffset) {
+  std::array<size_t, 3> offset = {0, 0, 0};
+  if (pGlobalWorkOffset) {
+    std::copy(pGlobalWorkOffset, pGlobalWorkOffset + workDim, offset.begin());
+  }
+  if (offset == appliedGlobalOffset) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  UR_CALL(setKernelGlobalOffset(hContext, hKernel.get(), offset.data()));
+  appliedGlobalOffset = offset;
+  return UR_RESULT_SUCCESS;
+}
+
+void ur_single_device_kernel_t::saveState(
+    ur_kernel_launch_state_t &state) const {
+  state.args.clear();
+  state.argData.clear();
+  for (auto &arg : argValues) {
+    state.args.push_back(
+        {arg.isSet, arg.isNull, arg.value.size(), state.argData.size()});
+    if (arg.isSet && !arg.isNull) {
+      state.argData.insert(state.argData.end(), arg.value.begin(),
+                           arg.value.end());
+    }
+  }
+  state.groupSize = appliedGroupSize.value_or(std::array<uint32_t, 3>{});
+  state.globalOffset = appliedGlobalOffset;
+}
+
+ur_result_t ur_single_device_kernel_t::restoreState(
+    ur_context_handle_t hContext, const ur_kernel_launch_state_t &state) {
+  for (size_t i = 0; i < state.args.size(); i++) {
+    if (state.args[i].isSet) {
+      UR_CALL(setArgValue(static_cast<uint32_t>(i), state.args[i].size,
+                          state.getArgValue(i)));
+    }
+  }
+  const uint32_t groupSize[3] = {state.groupSize[0], state.groupSize[1],
+                                 state.groupSize[2]};
+  UR_CALL(setGroupSize(groupSize));
+  return setGlobalOffset(hContext, 3, state.globalOffset.data());
+}
+
+ur_result_t ur_single_device_kernel_t::getSuggestedGroupSize(
+    ur_device_handle_t hQueueDevice, size_t (&globalSize)[3],
+    uint32_t (&groupSize)[3]) {
+  std::array<size_t, 3> key = {globalSize[0], globalSize[1], globalSize[2]};
+  auto it = suggestedGroupSizes.find(key);
+  if (it == suggestedGroupSizes.end()) {
+    UR_CALL(getSuggestedLocalWorkSize(hQueueDevice, hKernel.get(), globalSize,
+                                      groupSize));
+    if (suggestedGroupSizes.size() == maxSuggestedGroupSizes) {
+      suggestedGroupSizes.clear();
+    }
+    suggestedGroupSizes.emplace(
+        key, std::array<uint32_t, 3>{groupSize[0], groupSize[1], groupSize[2]});
+    return UR_RESULT_SUCCESS;
+  }
+
+  std::copy(it->second.begin(), it->second.end(), groupSize);
+  return UR_RESULT_SUCCESS;
+}
+
 ur_kernel_handle_t_::ur_kernel_handle_t_(ur_program_handle_t hProgram,
                                          const char *kernelName)
     : hProgram(hProgram),
@@ -105,8 +219,8 @@ void ur_kernel_handle_t_::completeInitialization() {
   };
 }
 
-ze_kernel_handle_t
-ur_kernel_handle_t_::getZeHandle(ur_device_handle_t hDevice) {
+ur_single_device_kernel_t &
+ur_kernel_handle_t_::getDeviceKernel(ur_device_handle_t hDevice) {
   // root-device's kernel can be submitted to a sub-device's queue
   if (hDevice->isSubDevice()) {
     hDevice = hDevice->RootDevice;
@@ -123,7 +237,7 @@ ur_kernel_handle_t_::getZeHandle(ur_device_handle_t hDevice) {
       throw UR_RESULT_ERROR_INVALID_DEVICE;
     }
 
-    return kernel.hKernel.get();
+    return kernel;
   }
 
   if (!deviceKernels[hDevice->Id.value()].has_value()) {
@@ -132,7 +246,52 @@ ur_kernel_handle_t_::getZeHandle(ur_device_handle_t hDevice) {
 
   assert(deviceKernels[hDevice->Id.value()].value().hKernel.get());
 
-  return deviceKernels[hDevice->Id.value()].value().hKernel.get();
+  return deviceKernels[hDevice->Id.value()].value();
+}
+
+ze_kernel_handle_t
+ur_kernel_handle_t_::getZeHandle(ur_device_handle_t hDevice) {
+  return getDeviceKernel(hDevice).hKernel.get();
+}
+
+ur_result_t ur_kernel_handle_t_::prepareForSubmission(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const size_t *pGlobalWorkOffset, uint32_t workDim,
+    const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
+    ze_group_count_t &zeThreadGroupDimensions) {
+  auto &kernel = getDeviceKernel(hDevice);
+
+  UR_CALL(kernel.setGlobalOffset(hContext, workDim, pGlobalWorkOffset));
+
+  // The suggestion is memoized, so only the first launch of each shape
+  // asks the driver
+  size_t localWorkSize[3];
+  if (!pLocalWorkSize) {
+    size_t globalWorkSize3D[3]{1, 1, 1};
+    std::copy(pGlobalWorkSize, pGlobalWorkSize + workDim, globalWorkSize3D);
+
+    uint32_t suggested[3];
+    UR_CALL(kernel.getSuggestedGroupSize(hDevice, globalWorkSize3D, suggested));
+    std::copy(suggested, suggested + 3, localWorkSize);
+    pLocalWorkSize = localWorkSize;
+  }
+
+  uint32_t WG[3];
+  UR_CALL(calculateKernelWorkDimensions(kernel.hKernel.get(), hDevice,
+                                        zeThreadGroupDimensions, WG, workDim,
+                                        pGlobalWorkSize, pLocalWorkSize));
+
+  return kernel.setGroupSize(WG);
+}
+
+ur_result_t ur_kernel_handle_t_::appendArgPrefetches(
+    ze_command_list_handle_t zeCommandList) {
+  return prefetchArgs.forEachAllocation(
+      [&](const void *ptr, size_t size) -> ur_result_t {
+        ZE2UR_CALL(zeCommandListAppendMemoryPrefetch,
+                   (zeCommandList, ptr, size));
+        return UR_RESULT_SUCCESS;
+      });
 }
 
 const std::string &ur_kernel_handle_t_::getName() const {
@@ -153,12 +312,30 @@ ur_kernel_handle_t_::getProperties(ur_device_handle_t hDevice) const {
               operator->();
 }
 
+void ur_kernel_handle_t_::saveLaunchState(ur_device_handle_t hDevice,
+                                          ur_kernel_launch_state_t &state) {
+  getDeviceKernel(hDevice).saveState(state);
+}
+
+ur_result_t ur_kernel_handle_t_::restoreLaunchState(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_kernel_launch_state_t &state) {
+  return getDeviceKernel(hDevice).restoreState(hContext, state);
+}
+
 ur_result_t ur_kernel_handle_t_::setArgValue(
     uint32_t argIndex, size_t argSize,
     const ur_kernel_arg_value_properties_t *pProperties,
     const void *pArgValue) {
   std::ignore = pProperties;
 
+  std::scoped_lock<ur_shared_mutex> guard(Mutex);
+  return setArgValueLocked(argIndex, argSize, pArgValue);
+}
+
+ur_result_t ur_kernel_handle_t_::setArgValueLocked(uint32_t argIndex,
+                                                   size_t argSize,
+                                                   const void *pArgValue) {
   // OpenCL: "the arg_value pointer can be NULL or point to a NULL value
   // in which case a NULL value will be used as the value for the argument
   // declared as a pointer to global or constant memory in the kernel"
@@ -170,17 +347,15 @@ ur_result_t ur_kernel_handle_t_::setArgValue(
       *(void **)(const_cast<void *>(pArgValue)) == nullptr) {
     pArgValue = nullptr;
   }
-
-  std::scoped_lock<ur_shared_mutex> guard(Mutex);
+  prefetchArgs.clear(argIndex);
 
   for (auto &singleDeviceKernel : deviceKernels) {
     if (!singleDeviceKernel.has_value()) {
       continue;
     }
 
-    ZE2UR_CALL(zeKernelSetArgumentValue,
-               (singleDeviceKernel.value().hKernel.get(), argIndex, argSize,
-                pArgValue));
+    UR_CALL(singleDeviceKernel.value().setArgValue(argIndex, argSize,
+                                                   pArgValue));
   }
   return UR_RESULT_SUCCESS;
 }
@@ -190,8 +365,75 @@ ur_result_t ur_kernel_handle_t_::setArgPointer(
     const void *pArgValue) {
   std::ignore = pProperties;
 
-  // KernelSetArgValue is expecting a pointer to the argument
-  return setArgValue(argIndex, sizeof(const void *), nullptr, &pArgValue);
+  std::scoped_lock<ur_shared_mutex> guard(Mutex);
+  return setArgPointerLocked(argIndex, pArgValue);
+}
+
+ur_result_t ur_kernel_handle_t_::setArgPointerLocked(uint32_t argIndex,
+                                                     const void *pArgValue) {
+  // setArgValueLocked is expecting a pointer to the argument
+  UR_CALL(setArgValueLocked(argIndex, sizeof(const void *), &pArgValue));
+  if (!pArgValue || !ur::usmAutoPrefetchEnabled()) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  // Pointers which aren't to USM, e.g. to host memory, are of unknown type
+  ze_context_handle_t zeContext = hProgram->Context->getZeHandle();
+  ZeStruct<ze_memory_allocation_properties_t> zeMemoryAllocationProperties;
+  ze_device_handle_t zeDevice = nullptr;
+  if (ZE_CALL_NOCHECK(zeMemGetAllocProperties,
+                      (zeContext, pArgValue, &zeMemoryAllocationProperties,
+                       &zeDevice)) != ZE_RESULT_SUCCESS ||
+      zeMemoryAllocationProperties.type != ZE_MEMORY_TYPE_SHARED) {
+    return UR_RESULT_SUCCESS;
+  }
+  void *base = nullptr;
+  size_t size = 0;
+  if (ZE_CALL_NOCHECK(zeMemGetAddressRange,
+                      (zeContext, pArgValue, &base, &size)) ==
+      ZE_RESULT_SUCCESS) {
+    prefetchArgs.set(argIndex, base, size);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+ur_kernel_handle_t_::setArgs(uint32_t numArgs,
+                             const ur_exp_kernel_arg_properties_t *pArgs) {
+  auto kernelDevices = getDevices();
+
+  std::scoped_lock<ur_shared_mutex> guard(Mutex);
+  for (uint32_t i = 0; i < numArgs; i++) {
+    const ur_exp_kernel_arg_properties_t &arg = pArgs[i];
+    switch (arg.type) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+      UR_CALL(setArgValueLocked(arg.index, arg.size, arg.value.value));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+      UR_CALL(setArgPointerLocked(arg.index, arg.value.pointer));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+      UR_CALL(setArgValueLocked(arg.index, arg.size, nullptr));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ: {
+      auto hMem = arg.value.memObjTuple.hMem;
+      // TODO: Implement this for multi-device kernels, as in
+      // urKernelSetArgMemObj.
+      if (hMem && kernelDevices.size() != 1) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+      }
+      void *zePtr = hMem ? hMem->getPtr(kernelDevices.front()) : nullptr;
+      UR_CALL(setArgValueLocked(arg.index, sizeof(void *), &zePtr));
+      break;
+    }
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+      logger::error("{}: sampler arguments are not supported", __FUNCTION__);
+      return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    default:
+      return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+  }
+  return UR_RESULT_SUCCESS;
 }
 
 ur_program_handle_t ur_kernel_handle_t_::getProgramHandle() const {
@@ -324,6 +566,13 @@ urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
   }
 }
 
+ur_result_t
+urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                   const ur_exp_kernel_arg_properties_t *pArgs) {
+  TRACK_SCOPE_LATENCY("ur_kernel_handle_t_::setArgs");
+  return hKernel->setArgs(numArgs, pArgs);
+}
+
 ur_result_t
 urKernelSetArgLocal(ur_kernel_handle_t hKernel, uint32_t argIndex,
                     size_t argSize,
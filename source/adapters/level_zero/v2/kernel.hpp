@@ -10,18 +10,84 @@
 
 #pragma once
 
+#include <array>
+#include <map>
+#include <optional>
+#include <vector>
+
 #include "../program.hpp"
 
 #include "common.hpp"
+#include "ur_usm_prefetch_args.hpp"
+
+// The state a launch applies to an L0 kernel, saved for a launch appended
+// after the arguments of the kernel may have been set again.
+struct ur_kernel_launch_state_t {
+  struct arg_t {
+    bool isSet;
+    bool isNull;
+    size_t size;
+    // The position of the value in argData
+    size_t offset;
+  };
+  std::vector<arg_t> args;
+  std::vector<char> argData;
+  std::array<uint32_t, 3> groupSize = {0, 0, 0};
+  std::array<size_t, 3> globalOffset = {0, 0, 0};
+
+  // The value of the argument, nullptr for null and local memory ones
+  const void *getArgValue(size_t argIndex) const {
+    return args[argIndex].isNull ? nullptr
+                                 : argData.data() + args[argIndex].offset;
+  }
+};
 
 struct ur_single_device_kernel_t {
   ur_single_device_kernel_t(ur_device_handle_t hDevice,
                             ze_kernel_handle_t hKernel, bool ownZeHandle);
   ur_result_t release();
 
+  // These skip the driver call when the kernel already has the state the
+  // call would set, e.g. when a loop launches it again with the same shape.
+  ur_result_t setArgValue(uint32_t argIndex, size_t argSize,
+                          const void *pArgValue);
+  ur_result_t setGroupSize(const uint32_t (&groupSize)[3]);
+  // Sets a zero offset when pGlobalWorkOffset is nullptr
+  ur_result_t setGlobalOffset(ur_context_handle_t hContext, uint32_t workDim,
+                              const size_t *pGlobalWorkOffset);
+
+  // Saves the state last applied to hKernel, and applies the saved state
+  // back, skipping what hKernel already has
+  void saveState(ur_kernel_launch_state_t &state) const;
+  ur_result_t restoreState(ur_context_handle_t hContext,
+                           const ur_kernel_launch_state_t &state);
+
+  // The group size suggested by the driver for globalSize, memoized
+  ur_result_t getSuggestedGroupSize(ur_device_handle_t hQueueDevice,
+                                    size_t (&globalSize)[3],
+                                    uint32_t (&groupSize)[3]);
+
   ur_device_handle_t hDevice;
   v2::raii::ze_kernel_handle_t hKernel;
   mutable ZeCache<ZeStruct<ze_kernel_properties_t>> zeKernelProperties;
+
+private:
+  struct arg_value_t {
+    bool isSet = false;
+    // Local memory arguments only have a size
+    bool isNull = false;
+    std::vector<char> value;
+  };
+
+  // The state last applied to hKernel
+  std::vector<arg_value_t> argValues;
+  std::optional<std::array<uint32_t, 3>> appliedGroupSize;
+  std::array<size_t, 3> appliedGlobalOffset = {0, 0, 0};
+
+  // Cleared once full, launches usually have few distinct shapes
+  static constexpr size_t maxSuggestedGroupSizes = 64;
+  std::map<std::array<size_t, 3>, std::array<uint32_t, 3>>
+      suggestedGroupSizes;
 };
 
 struct ur_kernel_handle_t_ : _ur_object {
@@ -37,6 +103,31 @@ public:
   // Get L0 kernel handle for a given device
   ze_kernel_handle_t getZeHandle(ur_device_handle_t hDevice);
 
+  // Sets the global offset and the group size of the kernel for a launch on
+  // hDevice, and computes its group count. The kernel must be locked until
+  // the launch is appended.
+  ur_result_t prepareForSubmission(ur_context_handle_t hContext,
+                                   ur_device_handle_t hDevice,
+                                   const size_t *pGlobalWorkOffset,
+                                   uint32_t workDim,
+                                   const size_t *pGlobalWorkSize,
+                                   const size_t *pLocalWorkSize,
+                                   ze_group_count_t &zeThreadGroupDimensions);
+
+  // Saves the state prepareForSubmission and the argument setters applied to
+  // the kernel of hDevice, and applies it back for a launch appended later.
+  // The kernel must be locked.
+  void saveLaunchState(ur_device_handle_t hDevice,
+                       ur_kernel_launch_state_t &state);
+  ur_result_t restoreLaunchState(ur_context_handle_t hContext,
+                                 ur_device_handle_t hDevice,
+                                 const ur_kernel_launch_state_t &state);
+
+  // Appends the prefetches of the shared USM allocations of the pointer
+  // arguments to zeCommandList, ahead of a launch, with
+  // UR_USM_AUTO_PREFETCH. The kernel must be locked.
+  ur_result_t appendArgPrefetches(ze_command_list_handle_t zeCommandList);
+
   // Get program handle of the kernel.
   ur_program_handle_t getProgramHandle() const;
 
@@ -60,6 +151,11 @@ public:
                 const ur_kernel_arg_pointer_properties_t *pProperties,
                 const void *pArgValue);
 
+  // Implementation of urKernelSetArgsExp, sets all the arguments under a
+  // single lock of the kernel.
+  ur_result_t setArgs(uint32_t numArgs,
+                      const ur_exp_kernel_arg_properties_t *pArgs);
+
   // Implementation of urKernelSetExecInfo.
   ur_result_t setExecInfo(ur_kernel_exec_info_t propName,
                           const void *pPropValue);
@@ -77,5 +173,19 @@ private:
   // Cache of the kernel name.
   mutable ZeCache<std::string> zeKernelName;
 
+  // The shared USM allocations of the pointer arguments.
+  ur::usm_prefetch_args_t prefetchArgs;
+
   void completeInitialization();
+
+  ur_single_device_kernel_t &getDeviceKernel(ur_device_handle_t hDevice);
+
+  // Sets the argument on all the device kernels, must be called with Mutex
+  // locked.
+  ur_result_t setArgValueLocked(uint32_t argIndex, size_t argSize,
+                                const void *pArgValue);
+
+  // Sets the pointer argument, and keeps the shared USM allocation it points
+  // into for prefetching, must be called with Mutex locked.
+  ur_result_t setArgPointerLocked(uint32_t argIndex, const void *pArgValue);
 };
@@ -76,6 +76,63 @@ ur_device_mem_handle_t::~ur_device_mem_handle_t() {
   }
 }
 
+static bool canCopyPeerToPeer(ur_device_handle_t hDstDevice,
+                              ur_device_handle_t hSrcDevice) {
+  // Same check as urUsmP2PPeerAccessGetInfoExp, for
+  // UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED
+  ZeStruct<ze_device_p2p_properties_t> p2pProperties;
+  ZE2UR_CALL_THROWS(zeDeviceGetP2PProperties,
+                    (hDstDevice->ZeDevice, hSrcDevice->ZeDevice,
+                     &p2pProperties));
+  if (!(p2pProperties.flags & ZE_DEVICE_P2P_PROPERTY_FLAG_ACCESS)) {
+    return false;
+  }
+  ze_bool_t canAccessPeer = false;
+  ZE2UR_CALL_THROWS(zeDeviceCanAccessPeer, (hDstDevice->ZeDevice,
+                                            hSrcDevice->ZeDevice,
+                                            &canAccessPeer));
+  return canAccessPeer;
+}
+
+void ur_device_mem_handle_t::copyOnDevice(ur_device_handle_t hDevice,
+                                          void *dst, const void *src) {
+  auto commandList = hContext->commandListCache.getImmediateCommandList(
+      hDevice->ZeDevice, true,
+      hDevice
+          ->QueueGroup[ur_device_handle_t_::queue_group_info_t::type::Compute]
+          .ZeOrdinal,
+      ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS, ZE_COMMAND_QUEUE_PRIORITY_NORMAL,
+      std::nullopt);
+  ZE2UR_CALL_THROWS(zeCommandListAppendMemoryCopy,
+                    (commandList.get(), dst, src, size, nullptr, 0, nullptr));
+}
+
+void ur_device_mem_handle_t::migrate(ur_device_handle_t hSrcDevice,
+                                     ur_device_handle_t hDstDevice) {
+  void *dst = deviceAllocations[hDstDevice->Id.value()];
+
+  if (!hSrcDevice) {
+    // Nothing to copy if the buffer was created without host data and hasn't
+    // been used on a device yet
+    if (!buffer.empty()) {
+      copyOnDevice(hDstDevice, dst, buffer.data());
+    }
+    return;
+  }
+
+  void *src = deviceAllocations[hSrcDevice->Id.value()];
+  if (canCopyPeerToPeer(hDstDevice, hSrcDevice)) {
+    copyOnDevice(hDstDevice, dst, src);
+    return;
+  }
+
+  // Stage through the host buffer, which then holds a copy as new as the
+  // devices' one as well
+  buffer.resize(size);
+  copyOnDevice(hSrcDevice, buffer.data(), src);
+  copyOnDevice(hDstDevice, dst, buffer.data());
+}
+
 void *ur_device_mem_handle_t::getPtr(ur_device_handle_t hDevice) {
   std::lock_guard lock(this->Mutex);
 
@@ -84,20 +141,15 @@ void *ur_device_mem_handle_t::getPtr(ur_device_handle_t hDevice) {
     ZeStruct<ze_device_mem_alloc_desc_t> deviceDesc;
     ZE2UR_CALL_THROWS(zeMemAllocDevice, (hContext->getZeHandle(), &deviceDesc,
                                          size, 0, hDevice->ZeDevice, &ptr));
+  }
 
-    if (!buffer.empty()) {
-      auto commandList = hContext->commandListCache.getImmediateCommandList(
-          hDevice->ZeDevice, true,
-          hDevice
-              ->QueueGroup
-                  [ur_device_handle_t_::queue_group_info_t::type::Compute]
-              .ZeOrdinal,
-          ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS, ZE_COMMAND_QUEUE_PRIORITY_NORMAL,
-          std::nullopt);
-      ZE2UR_CALL_THROWS(
-          zeCommandListAppendMemoryCopy,
-          (commandList.get(), ptr, buffer.data(), size, nullptr, 0, nullptr));
-    }
+  // TODO: the migration is synchronous, when the buffer is bound to the
+  // device, so it relies on the commands of the previous device having
+  // completed, as the legacy adapter does. It could be enqueued on the queue
+  // using the buffer instead.
+  if (activeAllocationDevice != hDevice) {
+    migrate(activeAllocationDevice, hDevice);
+    activeAllocationDevice = hDevice;
   }
   return ptr;
 }
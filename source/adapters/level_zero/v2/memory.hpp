@@ -45,11 +45,25 @@ struct ur_device_mem_handle_t : public ur_mem_handle_t_ {
                          size_t size);
   ~ur_device_mem_handle_t();
 
+  // Allocates the memory of hDevice on first use, and migrates the newest
+  // copy of the buffer to it. The device asking last is assumed to write to
+  // the buffer, so it holds the newest copy from then on.
   void *getPtr(ur_device_handle_t) override;
 
 private:
+  // Copies the newest copy, on hSrcDevice or in the host buffer when it's
+  // nullptr, to the allocation of hDstDevice
+  void migrate(ur_device_handle_t hSrcDevice, ur_device_handle_t hDstDevice);
+
+  // Copies size bytes on a synchronous immediate command list of hDevice
+  void copyOnDevice(ur_device_handle_t hDevice, void *dst, const void *src);
+
   std::vector<char> buffer;
 
   // Vector of per-device allocations indexed by device->Id
   std::vector<void *> deviceAllocations;
+
+  // The device holding the newest copy of the buffer, nullptr while it's the
+  // host buffer
+  ur_device_handle_t activeAllocationDevice = nullptr;
 };
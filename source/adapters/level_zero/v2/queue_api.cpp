@@ -338,4 +338,28 @@ ur_result_t urEnqueueNativeCommandExp(
       pfnNativeEnqueue, data, numMemsInMemList, phMemList, pProperties,
       numEventsInWaitList, phEventWaitList, phEvent);
 }
+ur_result_t urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue, uint32_t numLaunches,
+    const ur_exp_kernel_launch_desc_t *pLaunches, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return hQueue->enqueueKernelLaunchBatchExp(numLaunches, pLaunches,
+                                             numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+}
+ur_result_t urQueueReserveTimestampMarkersExp(ur_queue_handle_t hQueue,
+                                              uint32_t capacity) {
+  return hQueue->queueReserveTimestampMarkersExp(capacity);
+}
+ur_result_t urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, uint64_t *pMarker) {
+  return hQueue->enqueueTimestampMarkerExp(numEventsInWaitList,
+                                           phEventWaitList, pMarker);
+}
+ur_result_t urQueueReadTimestampMarkersExp(ur_queue_handle_t hQueue,
+                                           uint64_t firstMarker,
+                                           uint32_t count,
+                                           uint64_t *pTimestamps) {
+  return hQueue->queueReadTimestampMarkersExp(firstMarker, count, pTimestamps);
+}
 } // namespace ur::level_zero
\ No newline at end of file
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <ur_api.h>
+#include <ze_api.h>
 
 struct ur_queue_handle_t_ {
   virtual ~ur_queue_handle_t_();
@@ -150,4 +151,20 @@ struct ur_queue_handle_t_ {
                           const ur_exp_enqueue_native_command_properties_t *,
                           uint32_t, const ur_event_handle_t *,
                           ur_event_handle_t *) = 0;
+  virtual ur_result_t
+  enqueueKernelLaunchBatchExp(uint32_t, const ur_exp_kernel_launch_desc_t *,
+                              uint32_t, const ur_event_handle_t *,
+                              ur_event_handle_t *) = 0;
+  virtual ur_result_t queueReserveTimestampMarkersExp(uint32_t) = 0;
+  virtual ur_result_t enqueueTimestampMarkerExp(uint32_t,
+                                                const ur_event_handle_t *,
+                                                uint64_t *) = 0;
+  virtual ur_result_t queueReadTimestampMarkersExp(uint64_t, uint32_t,
+                                                   uint64_t *) = 0;
+
+  // Appends the closed regular command list of a command-buffer, for
+  // urCommandBufferEnqueueExp
+  virtual ur_result_t enqueueCommandBuffer(ze_command_list_handle_t, uint32_t,
+                                           const ur_event_handle_t *,
+                                           ur_event_handle_t *) = 0;
 };
@@ -14,9 +14,15 @@
 #include "ur.hpp"
 
 #include "../helpers/kernel_helpers.hpp"
+#include "../helpers/memory_helpers.hpp"
+#include "../platform.hpp"
 #include "../program.hpp"
+#include "../ur_interface_loader.hpp"
 
 #include "../common/latency_tracker.hpp"
+#include "loader/ze_loader.h"
+
+#include <cstring>
 
 namespace v2 {
 
@@ -28,18 +34,14 @@ ur_queue_immediate_in_order_t::getWaitListView(
                             ? lastHandler->lastEvent
                             : nullptr;
 
-  auto totalEvents = numWaitEvents + (extraWaitEvent != nullptr);
-  waitList.reserve(totalEvents);
-
-  for (uint32_t i = 0; i < numWaitEvents; i++) {
-    waitList[i] = phWaitEvents[i]->getZeEvent();
-  }
+  v2::getPrunedWaitList(waitList, phWaitEvents, numWaitEvents,
+                        pHandler->commandList.get());
 
   if (extraWaitEvent) {
-    waitList[numWaitEvents] = extraWaitEvent;
+    waitList.push_back(extraWaitEvent);
   }
 
-  return {waitList.data(), static_cast<uint32_t>(totalEvents)};
+  return {waitList.data(), static_cast<uint32_t>(waitList.size())};
 }
 
 static int32_t getZeOrdinal(ur_device_handle_t hDevice, queue_group_type type) {
@@ -49,7 +51,9 @@ static int32_t getZeOrdinal(ur_device_handle_t hDevice, queue_group_type type) {
   return hDevice->QueueGroup[queue_group_type::Compute].ZeOrdinal;
 }
 
-static std::optional<int32_t> getZeIndex(const ur_queue_properties_t *pProps) {
+static std::optional<int32_t>
+getZeIndex(const ur_queue_properties_t *pProps,
+           std::optional<int32_t> defaultIndex) {
   if (pProps && pProps->pNext) {
     const ur_base_properties_t *extendedDesc =
         reinterpret_cast<const ur_base_properties_t *>(pProps->pNext);
@@ -59,7 +63,7 @@ static std::optional<int32_t> getZeIndex(const ur_queue_properties_t *pProps) {
       return indexProperties->computeIndex;
     }
   }
-  return std::nullopt;
+  return defaultIndex;
 }
 
 static ze_command_queue_priority_t getZePriority(ur_queue_flags_t flags) {
@@ -73,13 +77,13 @@ static ze_command_queue_priority_t getZePriority(ur_queue_flags_t flags) {
 ur_command_list_handler_t::ur_command_list_handler_t(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     const ur_queue_properties_t *pProps, queue_group_type type,
-    event_pool *eventPool)
+    event_provider *eventProvider, std::optional<int32_t> defaultIndex)
     : commandList(hContext->commandListCache.getImmediateCommandList(
           hDevice->ZeDevice, true, getZeOrdinal(hDevice, type),
           ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS,
           getZePriority(pProps ? pProps->flags : ur_queue_flags_t{}),
-          getZeIndex(pProps))),
-      internalEvent(std::move(eventPool->getProvider()->allocate().borrow)) {}
+          getZeIndex(pProps, defaultIndex))),
+      internalEvent(std::move(eventProvider->allocate().borrow)) {}
 
 ur_queue_immediate_in_order_t::ur_queue_immediate_in_order_t(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
@@ -87,9 +91,23 @@ ur_queue_immediate_in_order_t::ur_queue_immediate_in_order_t(
     : hContext(hContext), hDevice(hDevice), flags(pProps ? pProps->flags : 0),
       eventPool(hContext->eventPoolCache.borrow(hDevice->Id.value())),
       copyHandler(hContext, hDevice, pProps, queue_group_type::MainCopy,
-                  eventPool.get()),
+                  eventPool->getProvider()),
       computeHandler(hContext, hDevice, pProps, queue_group_type::Compute,
-                     eventPool.get()) {}
+                     eventPool->getProvider()) {
+  captureReplay = isCaptureReplayEnabled(hDevice);
+  offsetIsMutable =
+      captureReplay &&
+      (hDevice->ZeDeviceMutableCmdListsProperties->mutableCommandFlags &
+       ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET);
+}
+
+ur_queue_immediate_in_order_t::~ur_queue_immediate_in_order_t() {
+  // The launches still held back must run before the queue goes away
+  std::ignore = flushDeferredLaunches();
+  for (auto &sequence : recordedSequences) {
+    destroySequence(sequence);
+  }
+}
 
 ur_command_list_handler_t *
 ur_queue_immediate_in_order_t::getCommandListHandlerForCompute() {
@@ -118,12 +136,323 @@ ze_event_handle_t ur_queue_immediate_in_order_t::getSignalEvent(
     handler->lastEvent = handler->internalEvent.get();
   } else {
     *hUserEvent = eventPool->allocate();
+    telemetry.eventCreated();
+    (*hUserEvent)->setSignalList(handler->commandList.get());
     handler->lastEvent = (*hUserEvent)->getZeEvent();
   }
 
   return handler->lastEvent;
 }
 
+bool ur_deferred_launch_t::hasSameShape(const ur_deferred_launch_t &other,
+                                        bool offsetIsMutable) const {
+  auto sameLayout = [](const ur_kernel_launch_state_t::arg_t &a,
+                       const ur_kernel_launch_state_t::arg_t &b) {
+    return a.isSet == b.isSet && a.isNull == b.isNull && a.size == b.size;
+  };
+  return zeKernel == other.zeKernel &&
+         groupCount.groupCountX == other.groupCount.groupCountX &&
+         groupCount.groupCountY == other.groupCount.groupCountY &&
+         groupCount.groupCountZ == other.groupCount.groupCountZ &&
+         state.groupSize == other.state.groupSize &&
+         (offsetIsMutable || state.globalOffset == other.state.globalOffset) &&
+         std::equal(state.args.begin(), state.args.end(),
+                    other.state.args.begin(), other.state.args.end(),
+                    sameLayout);
+}
+
+static bool haveSameShape(const std::vector<ur_deferred_launch_t> &a,
+                          const std::vector<ur_deferred_launch_t> &b,
+                          bool offsetIsMutable) {
+  return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                    [&](const ur_deferred_launch_t &l,
+                        const ur_deferred_launch_t &r) {
+                      return l.hasSameShape(r, offsetIsMutable);
+                    });
+}
+
+// Whether the launches of the same shape also have the same arguments
+static bool haveSameState(const std::vector<ur_deferred_launch_t> &a,
+                          const std::vector<ur_deferred_launch_t> &b) {
+  return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                    [](const ur_deferred_launch_t &l,
+                       const ur_deferred_launch_t &r) {
+                      return l.state.argData == r.state.argData &&
+                             l.state.globalOffset == r.state.globalOffset;
+                    });
+}
+
+bool ur_queue_immediate_in_order_t::isCaptureReplayEnabled(
+    ur_device_handle_t hDevice) {
+  static const bool enabled =
+      getenv_to_unsigned("UR_L0_V2_CAPTURE_REPLAY").value_or(0) != 0;
+  return enabled && hDevice->Platform->ZeMutableCmdListExt.Supported &&
+         (hDevice->ZeDeviceMutableCmdListsProperties->mutableCommandFlags &
+          ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS);
+}
+
+ur_result_t
+ur_queue_immediate_in_order_t::deferKernelLaunch(ur_deferred_launch_t &&launch,
+                                                 ur_kernel_handle_t hLocked) {
+  UR_CALL(ur::level_zero::urKernelRetain(launch.hKernel));
+  deferredLaunches.push_back(std::move(launch));
+  if (deferredLaunches.size() < maxDeferredLaunches) {
+    return UR_RESULT_SUCCESS;
+  }
+  return flushDeferredLaunches(hLocked);
+}
+
+ur_result_t ur_queue_immediate_in_order_t::flushDeferredLaunches(
+    ur_kernel_handle_t hLocked) {
+  if (deferredLaunches.empty()) {
+    return UR_RESULT_SUCCESS;
+  }
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::flushDeferredLaunches");
+
+  std::vector<ur_deferred_launch_t> launches;
+  launches.swap(deferredLaunches);
+  ur_result_t result = launchDeferred(launches, hLocked);
+  for (auto &launch : launches) {
+    ur::level_zero::urKernelRelease(launch.hKernel);
+    launch.hKernel = nullptr;
+  }
+  lastLaunches = std::move(launches);
+  return result;
+}
+
+ur_result_t ur_queue_immediate_in_order_t::launchDeferred(
+    const std::vector<ur_deferred_launch_t> &launches,
+    ur_kernel_handle_t hLocked) {
+  // A recording which failed half way doesn't have the launches' state
+  auto checked = [this](ur_recorded_sequence_t &sequence, ur_result_t result) {
+    if (result != UR_RESULT_SUCCESS) {
+      destroySequence(sequence);
+    }
+    return result;
+  };
+
+  auto &first = recordedSequences[0];
+  if (first.commandList &&
+      haveSameShape(launches, first.launches, offsetIsMutable)) {
+    // A recording with the same arguments is replayed as is, otherwise the
+    // one not replayed last is updated, so that it has likely completed
+    size_t next = (lastRecordedSequence + 1) % recordedSequences.size();
+    for (size_t i = 0; i < recordedSequences.size(); i++) {
+      if (recordedSequences[i].commandList &&
+          haveSameState(launches, recordedSequences[i].launches)) {
+        next = i;
+        break;
+      }
+    }
+    auto &sequence = recordedSequences[next];
+    if (!sequence.commandList) {
+      UR_CALL(checked(sequence, recordSequence(sequence, launches, hLocked)));
+    } else if (!haveSameState(launches, sequence.launches)) {
+      UR_CALL(checked(sequence, updateSequence(sequence, launches)));
+    }
+    lastRecordedSequence = next;
+    return replaySequence(sequence);
+  }
+
+  if (launches.size() >= minRecordedLaunches &&
+      haveSameShape(launches, lastLaunches, offsetIsMutable)) {
+    for (auto &sequence : recordedSequences) {
+      destroySequence(sequence);
+    }
+    UR_CALL(checked(first, recordSequence(first, launches, hLocked)));
+    lastRecordedSequence = 0;
+    return replaySequence(first);
+  }
+
+  auto handler = getCommandListHandlerForCompute();
+  auto [pWaitEvents, numWaitEvents] = getWaitListView(nullptr, 0, handler);
+  for (size_t i = 0; i < launches.size(); i++) {
+    bool last = i + 1 == launches.size();
+    UR_CALL(appendDeferredLaunch(
+        handler->commandList.get(), launches[i], hLocked,
+        last ? getSignalEvent(handler, nullptr) : nullptr,
+        i == 0 ? numWaitEvents : 0, i == 0 ? pWaitEvents : nullptr));
+  }
+  lastHandler = handler;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_in_order_t::recordSequence(
+    ur_recorded_sequence_t &sequence,
+    const std::vector<ur_deferred_launch_t> &launches,
+    ur_kernel_handle_t hLocked) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::recordSequence");
+  destroySequence(sequence);
+
+  // The recording runs on the engine of the compute command list it is
+  // appended to
+  sequence.commandList = hContext->commandListCache.getRegularCommandList(
+      hDevice->ZeDevice, true, getZeOrdinal(hDevice, queue_group_type::Compute),
+      true);
+  ZE2UR_CALL(zelLoaderTranslateHandle,
+             (ZEL_HANDLE_COMMAND_LIST, sequence.commandList.get(),
+              (void **)&sequence.zeCommandListTranslated));
+
+  ZeStruct<ze_mutable_command_id_exp_desc_t> zeMutableCommandDesc;
+  zeMutableCommandDesc.flags =
+      ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS |
+      (offsetIsMutable ? ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET : 0);
+  auto platform = hContext->getPlatform();
+  for (auto &launch : launches) {
+    uint64_t commandId = 0;
+    ZE2UR_CALL(platform->ZeMutableCmdListExt.zexCommandListGetNextCommandIdExp,
+               (sequence.zeCommandListTranslated, &zeMutableCommandDesc,
+                &commandId));
+    UR_CALL(appendDeferredLaunch(sequence.commandList.get(), launch, hLocked,
+                                 nullptr, 0, nullptr));
+
+    UR_CALL(ur::level_zero::urKernelRetain(launch.hKernel));
+    sequence.launches.push_back(launch);
+    sequence.commandIds.push_back(commandId);
+  }
+  ZE2UR_CALL(zeCommandListClose, (sequence.commandList.get()));
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_in_order_t::updateSequence(
+    ur_recorded_sequence_t &sequence,
+    const std::vector<ur_deferred_launch_t> &launches) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::updateSequence");
+
+  // The descriptors are chained as they are added, so they mustn't move
+  size_t numArgs = 0;
+  for (auto &launch : launches) {
+    numArgs += launch.state.args.size();
+  }
+  std::vector<ZeStruct<ze_mutable_kernel_argument_exp_desc_t>> argDescs;
+  std::vector<ZeStruct<ze_mutable_global_offset_exp_desc_t>> offsetDescs;
+  argDescs.reserve(numArgs);
+  offsetDescs.reserve(launches.size());
+  const void *pNext = nullptr;
+  auto chain = [&](auto &desc) {
+    desc.pNext = pNext;
+    pNext = &desc;
+  };
+
+  for (size_t i = 0; i < launches.size(); i++) {
+    const auto &from = sequence.launches[i].state;
+    const auto &to = launches[i].state;
+    for (size_t j = 0; j < to.args.size(); j++) {
+      // Null and local memory arguments are part of the shape
+      if (!to.args[j].isSet || to.args[j].isNull ||
+          std::memcmp(from.getArgValue(j), to.getArgValue(j),
+                      to.args[j].size) == 0) {
+        continue;
+      }
+      auto &argDesc = argDescs.emplace_back();
+      argDesc.commandId = sequence.commandIds[i];
+      argDesc.argIndex = static_cast<uint32_t>(j);
+      argDesc.argSize = to.args[j].size;
+      argDesc.pArgValue = to.getArgValue(j);
+      chain(argDesc);
+    }
+    if (from.globalOffset != to.globalOffset) {
+      auto &offsetDesc = offsetDescs.emplace_back();
+      offsetDesc.commandId = sequence.commandIds[i];
+      offsetDesc.offsetX = to.globalOffset[0];
+      offsetDesc.offsetY = to.globalOffset[1];
+      offsetDesc.offsetZ = to.globalOffset[2];
+      chain(offsetDesc);
+    }
+  }
+
+  // The command list must not be executing while its commands are updated
+  if (sequence.lastSubmission) {
+    ur::queue_telemetry_t::wait_scope_t waitScope(telemetry);
+    UR_CALL(v2::hostSynchronize(waitPolicy,
+                                sequence.lastSubmission->getZeEvent()));
+    sequence.lastSubmission->release();
+    sequence.lastSubmission = nullptr;
+  }
+
+  ZeStruct<ze_mutable_commands_exp_desc_t> mutableCommandsDesc;
+  mutableCommandsDesc.pNext = pNext;
+  mutableCommandsDesc.flags = 0;
+  auto platform = hContext->getPlatform();
+  ZE2UR_CALL(
+      platform->ZeMutableCmdListExt.zexCommandListUpdateMutableCommandsExp,
+      (sequence.zeCommandListTranslated, &mutableCommandsDesc));
+  ZE2UR_CALL(zeCommandListClose, (sequence.commandList.get()));
+
+  for (size_t i = 0; i < launches.size(); i++) {
+    sequence.launches[i].state = launches[i].state;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_in_order_t::replaySequence(
+    ur_recorded_sequence_t &sequence) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::replaySequence");
+
+  auto handler = getCommandListHandlerForCompute();
+  auto [pWaitEvents, numWaitEvents] = getWaitListView(nullptr, 0, handler);
+
+  // The replay signals an event of its own, to know when the recording can
+  // be updated again
+  ur_event_handle_t hEvent = eventPool->allocate();
+  hEvent->setSignalList(handler->commandList.get());
+  ze_command_list_handle_t zeCommandList = sequence.commandList.get();
+  ze_result_t zeResult = ZE_CALL_NOCHECK(
+      zeCommandListImmediateAppendCommandListsExp,
+      (handler->commandList.get(), 1, &zeCommandList, hEvent->getZeEvent(),
+       numWaitEvents, pWaitEvents));
+  if (zeResult != ZE_RESULT_SUCCESS) {
+    hEvent->release();
+    return ze2urResult(zeResult);
+  }
+
+  if (sequence.lastSubmission) {
+    sequence.lastSubmission->release();
+  }
+  sequence.lastSubmission = hEvent;
+  handler->lastEvent = hEvent->getZeEvent();
+  lastHandler = handler;
+  return UR_RESULT_SUCCESS;
+}
+
+void ur_queue_immediate_in_order_t::destroySequence(
+    ur_recorded_sequence_t &sequence) {
+  // The command list goes back to the cache, where it's reset
+  if (sequence.lastSubmission) {
+    std::ignore = v2::hostSynchronize(waitPolicy,
+                                      sequence.lastSubmission->getZeEvent());
+    sequence.lastSubmission->release();
+    sequence.lastSubmission = nullptr;
+  }
+  sequence.commandList.reset();
+  sequence.zeCommandListTranslated = nullptr;
+  sequence.commandIds.clear();
+  for (auto &launch : sequence.launches) {
+    ur::level_zero::urKernelRelease(launch.hKernel);
+  }
+  sequence.launches.clear();
+}
+
+ur_result_t ur_queue_immediate_in_order_t::appendDeferredLaunch(
+    ze_command_list_handle_t zeCommandList, const ur_deferred_launch_t &launch,
+    ur_kernel_handle_t hLocked, ze_event_handle_t signalEvent,
+    uint32_t numWaitEvents, ze_event_handle_t *pWaitEvents) {
+  std::unique_lock<ur_shared_mutex> Lock(launch.hKernel->Mutex,
+                                         std::defer_lock);
+  if (launch.hKernel != hLocked) {
+    Lock.lock();
+  }
+
+  // The kernel is left with the state it had, which its next launches use
+  ur_kernel_launch_state_t current;
+  launch.hKernel->saveLaunchState(hDevice, current);
+  UR_CALL(launch.hKernel->restoreLaunchState(hContext, hDevice, launch.state));
+  ZE2UR_CALL(zeCommandListAppendLaunchKernel,
+             (zeCommandList, launch.zeKernel, &launch.groupCount, signalEvent,
+              numWaitEvents, pWaitEvents));
+  return launch.hKernel->restoreLaunchState(hContext, hDevice, current);
+}
+
 ur_result_t
 ur_queue_immediate_in_order_t::queueGetInfo(ur_queue_info_t propName,
                                             size_t propSize, void *pPropValue,
@@ -143,9 +472,16 @@ ur_queue_immediate_in_order_t::queueGetInfo(ur_queue_info_t propName,
   case UR_QUEUE_INFO_SIZE:
   case UR_QUEUE_INFO_DEVICE_DEFAULT:
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  case UR_QUEUE_INFO_COMMAND_COUNTS:
+  case UR_QUEUE_INFO_BYTES_COPIED:
+  case UR_QUEUE_INFO_BATCH_COUNT:
+  case UR_QUEUE_INFO_AVERAGE_BATCH_SIZE:
+  case UR_QUEUE_INFO_HOST_WAIT_TIME:
+  case UR_QUEUE_INFO_CREATED_EVENT_COUNT:
+    return telemetry.getInfo(propName, ReturnValue);
   case UR_QUEUE_INFO_EMPTY: {
     // We can exit early if we have in-order queue.
-    if (!lastHandler)
+    if (!lastHandler && deferredLaunches.empty())
       return ReturnValue(true);
     [[fallthrough]];
   }
@@ -183,6 +519,7 @@ ur_result_t ur_queue_immediate_in_order_t::queueFinish() {
   TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::queueFinish");
   std::unique_lock<ur_shared_mutex> lock(this->Mutex);
 
+  UR_CALL(flushDeferredLaunches());
   if (!lastHandler) {
     return UR_RESULT_SUCCESS;
   }
@@ -191,16 +528,19 @@ ur_result_t ur_queue_immediate_in_order_t::queueFinish() {
   lastHandler = nullptr;
   lock.unlock();
 
+  ur::queue_telemetry_t::wait_scope_t waitScope(telemetry);
   // TODO: use zeEventHostSynchronize instead?
   TRACK_SCOPE_LATENCY(
       "ur_queue_immediate_in_order_t::zeCommandListHostSynchronize");
-  ZE2UR_CALL(zeCommandListHostSynchronize, (lastCmdList, UINT64_MAX));
-
-  return UR_RESULT_SUCCESS;
+  return v2::hostSynchronize(waitPolicy, lastCmdList);
 }
 
 ur_result_t ur_queue_immediate_in_order_t::queueFlush() {
-  return UR_RESULT_SUCCESS;
+  if (!captureReplay) {
+    return UR_RESULT_SUCCESS;
+  }
+  std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
+  return flushDeferredLaunches();
 }
 
 ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunch(
@@ -221,24 +561,34 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunch(
   std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
       hKernel->Mutex, hKernel->getProgramHandle()->Mutex, this->Mutex);
 
-  if (pGlobalWorkOffset != NULL) {
-    UR_CALL(setKernelGlobalOffset(hContext, hZeKernel, pGlobalWorkOffset));
-  }
-
   ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
-  uint32_t WG[3];
-  UR_CALL(calculateKernelWorkDimensions(hZeKernel, hDevice,
-                                        zeThreadGroupDimensions, WG, workDim,
-                                        pGlobalWorkSize, pLocalWorkSize));
-
-  ZE2UR_CALL(zeKernelSetGroupSize, (hZeKernel, WG[0], WG[1], WG[2]));
+  UR_CALL(hKernel->prepareForSubmission(hContext, hDevice, pGlobalWorkOffset,
+                                        workDim, pGlobalWorkSize,
+                                        pLocalWorkSize,
+                                        zeThreadGroupDimensions));
+
+  // Nothing can depend on a launch with no event, which only has to be
+  // ordered with the other commands of the queue, unless its memory has to
+  // be prefetched
+  if (captureReplay && !phEvent && numEventsInWaitList == 0 &&
+      !ur::usmAutoPrefetchEnabled()) {
+    ur_deferred_launch_t launch{hKernel, hZeKernel, zeThreadGroupDimensions,
+                                {}};
+    hKernel->saveLaunchState(hDevice, launch.state);
+    telemetry.commandSubmittedAsBatch(UR_COMMAND_KERNEL_LAUNCH);
+    return deferKernelLaunch(std::move(launch), hKernel);
+  }
+  UR_CALL(flushDeferredLaunches(hKernel));
 
   auto handler = getCommandListHandlerForCompute();
   auto signalEvent = getSignalEvent(handler, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_KERNEL_LAUNCH);
 
   auto [pWaitEvents, numWaitEvents] =
       getWaitListView(phEventWaitList, numEventsInWaitList, handler);
 
+  UR_CALL(hKernel->appendArgPrefetches(handler->commandList.get()));
+
   TRACK_SCOPE_LATENCY(
       "ur_queue_immediate_in_order_t::zeCommandListAppendLaunchKernel");
   ZE2UR_CALL(zeCommandListAppendLaunchKernel,
@@ -257,8 +607,10 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueEventsWait(
 
   std::unique_lock<ur_shared_mutex> lock(this->Mutex);
 
+  UR_CALL(flushDeferredLaunches());
   auto handler = getCommandListHandlerForCompute();
   auto signalEvent = getSignalEvent(handler, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_EVENTS_WAIT);
   auto [pWaitEvents, numWaitEvents] =
       getWaitListView(phEventWaitList, numEventsInWaitList, handler);
 
@@ -492,8 +844,10 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueUSMFill(
 
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
+  UR_CALL(flushDeferredLaunches());
   auto handler = getCommandListHandlerForFill(patternSize);
   auto signalEvent = getSignalEvent(handler, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_FILL);
 
   auto [pWaitEvents, numWaitEvents] =
       getWaitListView(phEventWaitList, numEventsInWaitList, handler);
@@ -520,8 +874,11 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueUSMMemcpy(
 
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
+  UR_CALL(flushDeferredLaunches());
   auto handler = getCommandListHandlerForCopy();
   auto signalEvent = getSignalEvent(handler, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_MEMCPY);
+  telemetry.bytesCopied(ur::queue_telemetry_t::unknown_direction, size);
 
   auto [pWaitEvents, numWaitEvents] =
       getWaitListView(phEventWaitList, numEventsInWaitList, handler);
@@ -531,8 +888,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueUSMMemcpy(
               numWaitEvents, pWaitEvents));
 
   if (blocking) {
-    ZE2UR_CALL(zeCommandListHostSynchronize,
-               (handler->commandList.get(), UINT64_MAX));
+    ur::queue_telemetry_t::wait_scope_t waitScope(telemetry);
+    UR_CALL(v2::hostSynchronize(waitPolicy, handler->commandList.get()));
     lastHandler = nullptr;
   } else {
     lastHandler = handler;
@@ -549,8 +906,10 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueUSMPrefetch(
 
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
+  UR_CALL(flushDeferredLaunches());
   auto handler = getCommandListHandlerForCompute();
   auto signalEvent = getSignalEvent(handler, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_PREFETCH);
 
   auto [pWaitEvents, numWaitEvents] =
       getWaitListView(phEventWaitList, numEventsInWaitList, handler);
@@ -580,8 +939,10 @@ ur_queue_immediate_in_order_t::enqueueUSMAdvise(const void *pMem, size_t size,
 
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
+  UR_CALL(flushDeferredLaunches());
   auto handler = getCommandListHandlerForCompute();
   auto signalEvent = getSignalEvent(handler, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_ADVISE);
 
   auto [pWaitEvents, numWaitEvents] = getWaitListView(nullptr, 0, handler);
 
@@ -606,33 +967,58 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueUSMFill2D(
     void *pMem, size_t pitch, size_t patternSize, const void *pPattern,
     size_t width, size_t height, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = pMem;
-  std::ignore = pitch;
-  std::ignore = patternSize;
-  std::ignore = pPattern;
-  std::ignore = width;
-  std::ignore = height;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueUSMFill2D");
+
+  std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
+
+  UR_CALL(flushDeferredLaunches());
+  auto handler = getCommandListHandlerForFill(patternSize);
+  auto signalEvent = getSignalEvent(handler, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_FILL_2D);
+
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+
+  UR_CALL(appendMemoryFill2D(handler->commandList.get(), pMem, pitch, pPattern,
+                             patternSize, width, height, signalEvent,
+                             numWaitEvents, pWaitEvents));
+
+  lastHandler = handler;
+
+  return UR_RESULT_SUCCESS;
 }
 
 ur_result_t ur_queue_immediate_in_order_t::enqueueUSMMemcpy2D(
     bool blocking, void *pDst, size_t dstPitch, const void *pSrc,
     size_t srcPitch, size_t width, size_t height, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blocking;
-  std::ignore = pDst;
-  std::ignore = dstPitch;
-  std::ignore = pSrc;
-  std::ignore = srcPitch;
-  std::ignore = width;
-  std::ignore = height;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueUSMMemcpy2D");
+
+  std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
+
+  UR_CALL(flushDeferredLaunches());
+  auto handler = getCommandListHandlerForCopy();
+  auto signalEvent = getSignalEvent(handler, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_MEMCPY_2D);
+  telemetry.bytesCopied(ur::queue_telemetry_t::unknown_direction,
+                        width * height);
+
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+
+  UR_CALL(appendMemoryCopy2D(handler->commandList.get(), pDst, dstPitch, pSrc,
+                             srcPitch, width, height, signalEvent,
+                             numWaitEvents, pWaitEvents));
+
+  if (blocking) {
+    ur::queue_telemetry_t::wait_scope_t waitScope(telemetry);
+    UR_CALL(v2::hostSynchronize(waitPolicy, handler->commandList.get()));
+    lastHandler = nullptr;
+  } else {
+    lastHandler = handler;
+  }
+
+  return UR_RESULT_SUCCESS;
 }
 
 ur_result_t ur_queue_immediate_in_order_t::enqueueDeviceGlobalVariableWrite(
@@ -773,6 +1159,22 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueTimestampRecordingExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
+// Like the timestamp recordings, the markers are not supported yet
+ur_result_t
+ur_queue_immediate_in_order_t::queueReserveTimestampMarkersExp(uint32_t) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_in_order_t::enqueueTimestampMarkerExp(
+    uint32_t, const ur_event_handle_t *, uint64_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_in_order_t::queueReadTimestampMarkersExp(
+    uint64_t, uint32_t, uint64_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunchCustomExp(
     ur_kernel_handle_t hKernel, uint32_t workDim, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numPropsInLaunchPropList,
@@ -797,4 +1199,86 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueNativeCommandExp(
     uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+
+ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunchBatchExp(
+    uint32_t numLaunches, const ur_exp_kernel_launch_desc_t *pLaunches,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_in_order_t::enqueueKernelLaunchBatchExp");
+
+  for (uint32_t i = 0; i < numLaunches; ++i) {
+    UR_ASSERT(pLaunches[i].hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+    UR_ASSERT(pLaunches[i].hKernel->getProgramHandle(),
+              UR_RESULT_ERROR_INVALID_NULL_POINTER);
+    UR_ASSERT(pLaunches[i].workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+    UR_ASSERT(pLaunches[i].workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  }
+
+  std::unique_lock<ur_shared_mutex> lock(this->Mutex);
+
+  // The launches are appended to the same command list, so only the first
+  // one waits on the events and only the last one signals the event
+  UR_CALL(flushDeferredLaunches());
+  auto handler = getCommandListHandlerForCompute();
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+  telemetry.commandSubmitted(ur::queue_telemetry_t::kernel_launch,
+                             numLaunches);
+  telemetry.batchSubmitted(numLaunches);
+
+  for (uint32_t i = 0; i < numLaunches; ++i) {
+    const ur_exp_kernel_launch_desc_t &launch = pLaunches[i];
+    ur_kernel_handle_t hKernel = launch.hKernel;
+    ze_kernel_handle_t hZeKernel = hKernel->getZeHandle(hDevice);
+
+    std::scoped_lock<ur_shared_mutex, ur_shared_mutex> Lock(
+        hKernel->Mutex, hKernel->getProgramHandle()->Mutex);
+
+    ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
+    UR_CALL(hKernel->prepareForSubmission(
+        hContext, hDevice, launch.pGlobalWorkOffset, launch.workDim,
+        launch.pGlobalWorkSize, launch.pLocalWorkSize,
+        zeThreadGroupDimensions));
+
+    UR_CALL(hKernel->appendArgPrefetches(handler->commandList.get()));
+
+    bool last = i + 1 == numLaunches;
+    ze_event_handle_t signalEvent =
+        last ? getSignalEvent(handler, phEvent) : nullptr;
+
+    ZE2UR_CALL(zeCommandListAppendLaunchKernel,
+               (handler->commandList.get(), hZeKernel,
+                &zeThreadGroupDimensions, signalEvent,
+                i == 0 ? numWaitEvents : 0, i == 0 ? pWaitEvents : nullptr));
+  }
+
+  lastHandler = handler;
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_in_order_t::enqueueCommandBuffer(
+    ze_command_list_handle_t zeCommandList, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueCommandBuffer");
+
+  std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
+
+  UR_CALL(flushDeferredLaunches());
+  auto handler = getCommandListHandlerForCompute();
+  auto signalEvent = getSignalEvent(handler, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP);
+
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+
+  ZE2UR_CALL(zeCommandListImmediateAppendCommandListsExp,
+             (handler->commandList.get(), 1, &zeCommandList, signalEvent,
+              numWaitEvents, pWaitEvents));
+
+  lastHandler = handler;
+
+  return UR_RESULT_SUCCESS;
+}
 } // namespace v2
@@ -12,12 +12,15 @@
 #include "../common.hpp"
 #include "../device.hpp"
 
+#include "adaptive_wait.hpp"
 #include "context.hpp"
 #include "event.hpp"
 #include "event_pool_cache.hpp"
+#include "kernel.hpp"
 #include "queue_api.hpp"
 
 #include "ur/ur.hpp"
+#include "ur_queue_telemetry.hpp"
 
 namespace v2 {
 
@@ -27,7 +30,9 @@ struct ur_command_list_handler_t {
   ur_command_list_handler_t(ur_context_handle_t hContext,
                             ur_device_handle_t hDevice,
                             const ur_queue_properties_t *pProps,
-                            queue_group_type type, event_pool *eventPool);
+                            queue_group_type type,
+                            event_provider *eventProvider,
+                            std::optional<int32_t> defaultIndex = std::nullopt);
 
   raii::cache_borrowed_command_list_t commandList;
   raii::cache_borrowed_event internalEvent;
@@ -38,6 +43,38 @@ struct ur_command_list_handler_t {
   ze_event_handle_t lastEvent = nullptr;
 };
 
+// A kernel launch held back by the capture of an in-order queue, with the
+// state it was enqueued with, as the arguments of the kernel can be set again
+// before it is appended.
+struct ur_deferred_launch_t {
+  ur_kernel_handle_t hKernel;
+  ze_kernel_handle_t zeKernel;
+  ze_group_count_t groupCount;
+  ur_kernel_launch_state_t state;
+
+  // Whether the launches can be the same command of a recorded command list,
+  // which may only update their arguments and, if offsetIsMutable, their
+  // global offsets
+  bool hasSameShape(const ur_deferred_launch_t &other,
+                    bool offsetIsMutable) const;
+};
+
+// A sequence of launches recorded into a mutable regular command list, which
+// is replayed by appending it to the immediate command list of the queue.
+struct ur_recorded_sequence_t {
+  raii::cache_borrowed_command_list_t commandList;
+  // The handle of the command list known to the driver, for the functions of
+  // the mutable command list extension
+  ze_command_list_handle_t zeCommandListTranslated = nullptr;
+  std::vector<uint64_t> commandIds;
+  // The launches the commands currently have the state of, which keep a
+  // reference to their kernels
+  std::vector<ur_deferred_launch_t> launches;
+  // Signalled by the last replay, which must have completed before the
+  // commands are updated
+  ur_event_handle_t lastSubmission = nullptr;
+};
+
 struct ur_queue_immediate_in_order_t : _ur_object, public ur_queue_handle_t_ {
 private:
   ur_context_handle_t hContext;
@@ -50,8 +87,65 @@ private:
   ur_command_list_handler_t computeHandler;
   ur_command_list_handler_t *lastHandler = nullptr;
 
+  v2::adaptive_wait_t waitPolicy;
+
+  ur::queue_telemetry_t telemetry;
+
   std::vector<ze_event_handle_t> waitList;
 
+  // Whether launches are held back to be recorded once the same sequence is
+  // submitted again, see deferKernelLaunch
+  bool captureReplay = false;
+  // The global offsets of the recorded commands can be updated
+  bool offsetIsMutable = false;
+  std::vector<ur_deferred_launch_t> deferredLaunches;
+  // The sequence launched before, to detect a repeated one
+  std::vector<ur_deferred_launch_t> lastLaunches;
+  // Two recordings of the same sequence, so that a replay whose arguments
+  // differ from the last one doesn't wait for it before updating them
+  std::array<ur_recorded_sequence_t, 2> recordedSequences;
+  size_t lastRecordedSequence = 0;
+
+  // The number of launches held back at most, launched as a sequence once
+  // reached
+  static constexpr size_t maxDeferredLaunches = 64;
+  // The length of the shortest sequence worth recording
+  static constexpr size_t minRecordedLaunches = 2;
+
+  // UR_L0_V2_CAPTURE_REPLAY, which turns on the capture of the in-order
+  // queues of the devices supporting mutable kernel arguments
+  static bool isCaptureReplayEnabled(ur_device_handle_t hDevice);
+
+  // Holds back a launch with no wait list and no signal event, to launch it
+  // along the following ones as a sequence when the queue is used for
+  // anything else. A sequence launched twice in a row is recorded into a
+  // command list, which replays it as a single append from then on,
+  // updating the arguments which changed. Must be called with Mutex locked,
+  // the caller holding the lock of hLocked, if any.
+  ur_result_t deferKernelLaunch(ur_deferred_launch_t &&launch,
+                                ur_kernel_handle_t hLocked);
+  // Launches the held back launches, must be called with Mutex locked
+  // before anything else is appended.
+  ur_result_t flushDeferredLaunches(ur_kernel_handle_t hLocked = nullptr);
+  ur_result_t launchDeferred(const std::vector<ur_deferred_launch_t> &launches,
+                             ur_kernel_handle_t hLocked);
+  ur_result_t recordSequence(ur_recorded_sequence_t &sequence,
+                             const std::vector<ur_deferred_launch_t> &launches,
+                             ur_kernel_handle_t hLocked);
+  ur_result_t updateSequence(ur_recorded_sequence_t &sequence,
+                             const std::vector<ur_deferred_launch_t> &launches);
+  ur_result_t replaySequence(ur_recorded_sequence_t &sequence);
+  // Waits for the last replay of sequence, and gives its command list back
+  void destroySequence(ur_recorded_sequence_t &sequence);
+  // Appends launch to zeCommandList with the state it was enqueued with,
+  // leaving its kernel with the state it has
+  ur_result_t appendDeferredLaunch(ze_command_list_handle_t zeCommandList,
+                                   const ur_deferred_launch_t &launch,
+                                   ur_kernel_handle_t hLocked,
+                                   ze_event_handle_t signalEvent,
+                                   uint32_t numWaitEvents,
+                                   ze_event_handle_t *pWaitEvents);
+
   std::pair<ze_event_handle_t *, uint32_t>
   getWaitListView(const ur_event_handle_t *phWaitEvents, uint32_t numWaitEvents,
                   ur_command_list_handler_t *pHandler);
@@ -66,7 +160,7 @@ private:
 public:
   ur_queue_immediate_in_order_t(ur_context_handle_t, ur_device_handle_t,
                                 const ur_queue_properties_t *);
-  ~ur_queue_immediate_in_order_t() {}
+  ~ur_queue_immediate_in_order_t();
 
   ur_result_t queueGetInfo(ur_queue_info_t propName, size_t propSize,
                            void *pPropValue, size_t *pPropSizeRet) override;
@@ -252,6 +346,24 @@ public:
                           const ur_exp_enqueue_native_command_properties_t *,
                           uint32_t, const ur_event_handle_t *,
                           ur_event_handle_t *) override;
+  ur_result_t
+  enqueueKernelLaunchBatchExp(uint32_t numLaunches,
+                              const ur_exp_kernel_launch_desc_t *pLaunches,
+                              uint32_t numEventsInWaitList,
+                              const ur_event_handle_t *phEventWaitList,
+                              ur_event_handle_t *phEvent) override;
+  ur_result_t queueReserveTimestampMarkersExp(uint32_t capacity) override;
+  ur_result_t
+  enqueueTimestampMarkerExp(uint32_t numEventsInWaitList,
+                            const ur_event_handle_t *phEventWaitList,
+                            uint64_t *pMarker) override;
+  ur_result_t queueReadTimestampMarkersExp(uint64_t firstMarker,
+                                           uint32_t count,
+                                           uint64_t *pTimestamps) override;
+  ur_result_t enqueueCommandBuffer(ze_command_list_handle_t zeCommandList,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) override;
 };
 
 } // namespace v2
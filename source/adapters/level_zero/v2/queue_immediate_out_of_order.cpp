@@ -0,0 +1,951 @@
+//===--------- queue_immediate_out_of_order.cpp - Level Zero Adapter -----===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "queue_immediate_out_of_order.hpp"
+#include "event_provider_counter.hpp"
+#include "kernel.hpp"
+#include "memory.hpp"
+#include "ur.hpp"
+
+#include "../helpers/kernel_helpers.hpp"
+#include "../helpers/memory_helpers.hpp"
+#include "../program.hpp"
+
+#include "../common/latency_tracker.hpp"
+
+#include <algorithm>
+
+namespace v2 {
+
+static uint32_t getNumEngines(ur_device_handle_t hDevice,
+                              queue_group_type type) {
+  if (type == queue_group_type::MainCopy && !hDevice->hasMainCopyEngine()) {
+    type = queue_group_type::Compute;
+  }
+  return std::max<uint32_t>(
+      hDevice->QueueGroup[type].ZeProperties.numQueues, 1);
+}
+
+static std::unique_ptr<event_provider>
+createCounterProvider(ur_context_handle_t hContext,
+                      ur_device_handle_t hDevice) {
+  try {
+    return std::make_unique<provider_counter>(hDevice->Platform, hContext,
+                                              hDevice);
+  } catch (...) {
+    logger::info("counter-based events are not supported by the driver, "
+                 "using the event pool for the internal events");
+    return nullptr;
+  }
+}
+
+ur_queue_immediate_out_of_order_t::ur_queue_immediate_out_of_order_t(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_queue_properties_t *pProps)
+    : hContext(hContext), hDevice(hDevice), flags(pProps ? pProps->flags : 0),
+      eventPool(hContext->eventPoolCache.borrow(hDevice->Id.value())),
+      counterProvider(createCounterProvider(hContext, hDevice)),
+      internalEventProvider(counterProvider ? counterProvider.get()
+                                            : eventPool->getProvider()) {
+  // Unless the queue is bound to an engine, the lists of each type are
+  // spread over the engines of their group
+  auto numComputeEngines = getNumEngines(hDevice, queue_group_type::Compute);
+  auto numCopyEngines = getNumEngines(hDevice, queue_group_type::MainCopy);
+  for (size_t i = 0; i < numCommandLists; i++) {
+    computeSlots.emplace_back(hContext, hDevice, pProps,
+                              queue_group_type::Compute, internalEventProvider,
+                              static_cast<int32_t>(i % numComputeEngines));
+    copySlots.emplace_back(hContext, hDevice, pProps,
+                           queue_group_type::MainCopy, internalEventProvider,
+                           static_cast<int32_t>(i % numCopyEngines));
+  }
+}
+
+ur_command_list_slot_t &ur_queue_immediate_out_of_order_t::getSlotForCompute() {
+  auto i = nextCompute.fetch_add(1, std::memory_order_relaxed);
+  return computeSlots[i % computeSlots.size()];
+}
+
+ur_command_list_slot_t &ur_queue_immediate_out_of_order_t::getSlotForCopy() {
+  // TODO: optimize for specific devices, see ../memory.cpp
+  auto i = nextCopy.fetch_add(1, std::memory_order_relaxed);
+  return copySlots[i % copySlots.size()];
+}
+
+ur_command_list_slot_t &
+ur_queue_immediate_out_of_order_t::getSlotForFill(size_t patternSize) {
+  if (patternSize <= hDevice->QueueGroup[queue_group_type::MainCopy]
+                         .ZeProperties.maxMemoryFillPatternSize)
+    return getSlotForCopy();
+  else
+    return getSlotForCompute();
+}
+
+std::pair<ze_event_handle_t *, uint32_t>
+ur_queue_immediate_out_of_order_t::getWaitListView(
+    const ur_event_handle_t *phWaitEvents, uint32_t numWaitEvents,
+    ur_command_list_slot_t &slot) {
+  // Commands only wait for the events they were given, the ones of the
+  // other lists are only waited on by barriers
+  v2::getPrunedWaitList(slot.waitList, phWaitEvents, numWaitEvents,
+                        slot.handler.commandList.get());
+
+  auto numEvents = static_cast<uint32_t>(slot.waitList.size());
+  return {numEvents ? slot.waitList.data() : nullptr, numEvents};
+}
+
+ze_event_handle_t ur_queue_immediate_out_of_order_t::getSignalEvent(
+    ur_command_list_slot_t &slot, ur_event_handle_t *hUserEvent) {
+  auto &handler = slot.handler;
+  if (!hUserEvent) {
+    handler.lastEvent = handler.internalEvent.get();
+  } else {
+    *hUserEvent = eventPool->allocate();
+    telemetry.eventCreated();
+    (*hUserEvent)->setSignalList(handler.commandList.get());
+    handler.lastEvent = (*hUserEvent)->getZeEvent();
+  }
+
+  return handler.lastEvent;
+}
+
+ur_result_t
+ur_queue_immediate_out_of_order_t::queueGetInfo(ur_queue_info_t propName,
+                                                size_t propSize,
+                                                void *pPropValue,
+                                                size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  // TODO: consider support for queue properties and size
+  switch ((uint32_t)propName) { // cast to avoid warnings on EXT enum values
+  case UR_QUEUE_INFO_CONTEXT:
+    return ReturnValue(hContext);
+  case UR_QUEUE_INFO_DEVICE:
+    return ReturnValue(hDevice);
+  case UR_QUEUE_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{RefCount.load()});
+  case UR_QUEUE_INFO_FLAGS:
+    return ReturnValue(flags);
+  case UR_QUEUE_INFO_SIZE:
+  case UR_QUEUE_INFO_DEVICE_DEFAULT:
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  case UR_QUEUE_INFO_COMMAND_COUNTS:
+  case UR_QUEUE_INFO_BYTES_COPIED:
+  case UR_QUEUE_INFO_BATCH_COUNT:
+  case UR_QUEUE_INFO_AVERAGE_BATCH_SIZE:
+  case UR_QUEUE_INFO_HOST_WAIT_TIME:
+  case UR_QUEUE_INFO_CREATED_EVENT_COUNT:
+    return telemetry.getInfo(propName, ReturnValue);
+  case UR_QUEUE_INFO_EMPTY: {
+    // The last command of each list completes after the ones before it
+    bool empty = true;
+    forEachSlot([&](ur_command_list_slot_t &slot) {
+      std::scoped_lock<std::mutex> lock(slot.mutex);
+      auto lastEvent = slot.handler.lastEvent;
+      if (empty && lastEvent &&
+          ZE_CALL_NOCHECK(zeEventQueryStatus, (lastEvent)) ==
+              ZE_RESULT_NOT_READY) {
+        empty = false;
+      }
+    });
+    return ReturnValue(empty);
+  }
+  default:
+    logger::error(
+        "Unsupported ParamName in urQueueGetInfo: ParamName=ParamName={}(0x{})",
+        propName, logger::toHex(propName));
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueRetain() {
+  RefCount.increment();
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueRelease() {
+  if (!RefCount.decrementAndTest())
+    return UR_RESULT_SUCCESS;
+
+  delete this;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueGetNativeHandle(
+    ur_queue_native_desc_t *pDesc, ur_native_handle_t *phNativeQueue) {
+  std::ignore = pDesc;
+  std::ignore = phNativeQueue;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueFinish() {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_out_of_order_t::queueFinish");
+
+  std::vector<ze_command_list_handle_t> usedCmdLists;
+  forEachSlot([&](ur_command_list_slot_t &slot) {
+    std::scoped_lock<std::mutex> lock(slot.mutex);
+    if (slot.handler.lastEvent) {
+      usedCmdLists.push_back(slot.handler.commandList.get());
+      slot.handler.lastEvent = nullptr;
+    }
+  });
+
+  ur::queue_telemetry_t::wait_scope_t waitScope(telemetry);
+  // TODO: use zeEventHostSynchronize instead?
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_out_of_order_t::zeCommandListHostSynchronize");
+  for (auto cmdList : usedCmdLists) {
+    UR_CALL(v2::hostSynchronize(waitPolicy, cmdList));
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueFlush() {
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueKernelLaunch(
+    ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_out_of_order_t::enqueueKernelLaunch");
+
+  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hKernel->getProgramHandle(), UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+
+  ze_kernel_handle_t hZeKernel = hKernel->getZeHandle(hDevice);
+
+  auto &slot = getSlotForCompute();
+
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex, std::mutex> Lock(
+      hKernel->Mutex, hKernel->getProgramHandle()->Mutex, slot.mutex);
+
+  ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
+  UR_CALL(hKernel->prepareForSubmission(hContext, hDevice, pGlobalWorkOffset,
+                                        workDim, pGlobalWorkSize,
+                                        pLocalWorkSize,
+                                        zeThreadGroupDimensions));
+
+  auto signalEvent = getSignalEvent(slot, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_KERNEL_LAUNCH);
+
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, slot);
+
+  UR_CALL(hKernel->appendArgPrefetches(slot.handler.commandList.get()));
+
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_out_of_order_t::zeCommandListAppendLaunchKernel");
+  ZE2UR_CALL(zeCommandListAppendLaunchKernel,
+             (slot.handler.commandList.get(), hZeKernel,
+              &zeThreadGroupDimensions, signalEvent, numWaitEvents,
+              pWaitEvents));
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueEventsWait(
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_out_of_order_t::enqueueEventsWait");
+
+  // Without events, the command waits for all the previous commands
+  if (!numEventsInWaitList) {
+    return enqueueEventsWaitWithBarrier(0, nullptr, phEvent);
+  }
+
+  auto &slot = getSlotForCompute();
+  std::scoped_lock<std::mutex> lock(slot.mutex);
+
+  auto signalEvent = getSignalEvent(slot, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_EVENTS_WAIT);
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, slot);
+
+  ZE2UR_CALL(zeCommandListAppendWaitOnEvents,
+             (slot.handler.commandList.get(), numWaitEvents, pWaitEvents));
+  ZE2UR_CALL(zeCommandListAppendSignalEvent,
+             (slot.handler.commandList.get(), signalEvent));
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueEventsWaitWithBarrier(
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_out_of_order_t::enqueueEventsWaitWithBarrier");
+
+  // The barrier is appended to the first compute list, after the last
+  // commands of all the lists, and every other list waits for it before
+  // running the commands enqueued after it.
+  std::vector<std::unique_lock<std::mutex>> locks;
+  locks.reserve(computeSlots.size() + copySlots.size());
+  forEachSlot([&](ur_command_list_slot_t &slot) {
+    locks.emplace_back(slot.mutex);
+  });
+
+  auto &barrierSlot = computeSlots.front();
+  getWaitListView(phEventWaitList, numEventsInWaitList, barrierSlot);
+  forEachSlot([&](ur_command_list_slot_t &slot) {
+    if (&slot != &barrierSlot && slot.handler.lastEvent) {
+      barrierSlot.waitList.push_back(slot.handler.lastEvent);
+    }
+  });
+
+  auto signalEvent = getSignalEvent(barrierSlot, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_EVENTS_WAIT_WITH_BARRIER);
+  auto &waitList = barrierSlot.waitList;
+  ZE2UR_CALL(zeCommandListAppendBarrier,
+             (barrierSlot.handler.commandList.get(), signalEvent,
+              static_cast<uint32_t>(waitList.size()),
+              waitList.empty() ? nullptr : waitList.data()));
+
+  ur_result_t result = UR_RESULT_SUCCESS;
+  forEachSlot([&](ur_command_list_slot_t &slot) {
+    if (&slot == &barrierSlot || result != UR_RESULT_SUCCESS) {
+      return;
+    }
+    result = ze2urResult(ZE_CALL_NOCHECK(
+        zeCommandListAppendWaitOnEvents,
+        (slot.handler.commandList.get(), 1, &signalEvent)));
+  });
+
+  return result;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferRead(
+    ur_mem_handle_t hBuffer, bool blockingRead, size_t offset, size_t size,
+    void *pDst, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_out_of_order_t::enqueueMemBufferRead");
+
+  UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
+
+  auto ptr = ur_cast<char *>(hBuffer->getPtr(hDevice));
+  return enqueueUSMMemcpy(blockingRead, pDst, ptr + offset, size,
+                          numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferWrite(
+    ur_mem_handle_t hBuffer, bool blockingWrite, size_t offset, size_t size,
+    const void *pSrc, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_out_of_order_t::enqueueMemBufferWrite");
+
+  UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
+
+  auto ptr = ur_cast<char *>(hBuffer->getPtr(hDevice));
+  return enqueueUSMMemcpy(blockingWrite, ptr + offset, pSrc, size,
+                          numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferReadRect(
+    ur_mem_handle_t hBuffer, bool blockingRead, ur_rect_offset_t bufferOrigin,
+    ur_rect_offset_t hostOrigin, ur_rect_region_t region, size_t bufferRowPitch,
+    size_t bufferSlicePitch, size_t hostRowPitch, size_t hostSlicePitch,
+    void *pDst, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hBuffer;
+  std::ignore = blockingRead;
+  std::ignore = bufferOrigin;
+  std::ignore = hostOrigin;
+  std::ignore = region;
+  std::ignore = bufferRowPitch;
+  std::ignore = bufferSlicePitch;
+  std::ignore = hostRowPitch;
+  std::ignore = hostSlicePitch;
+  std::ignore = pDst;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferWriteRect(
+    ur_mem_handle_t hBuffer, bool blockingWrite, ur_rect_offset_t bufferOrigin,
+    ur_rect_offset_t hostOrigin, ur_rect_region_t region, size_t bufferRowPitch,
+    size_t bufferSlicePitch, size_t hostRowPitch, size_t hostSlicePitch,
+    void *pSrc, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hBuffer;
+  std::ignore = blockingWrite;
+  std::ignore = bufferOrigin;
+  std::ignore = hostOrigin;
+  std::ignore = region;
+  std::ignore = bufferRowPitch;
+  std::ignore = bufferSlicePitch;
+  std::ignore = hostRowPitch;
+  std::ignore = hostSlicePitch;
+  std::ignore = pSrc;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferCopy(
+    ur_mem_handle_t hBufferSrc, ur_mem_handle_t hBufferDst, size_t srcOffset,
+    size_t dstOffset, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_out_of_order_t::enqueueMemBufferCopy");
+
+  UR_ASSERT(srcOffset + size <= hBufferSrc->getSize(),
+            UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(dstOffset + size <= hBufferDst->getSize(),
+            UR_RESULT_ERROR_INVALID_SIZE);
+
+  auto srcPtr = ur_cast<char *>(hBufferSrc->getPtr(hDevice));
+  auto dstPtr = ur_cast<char *>(hBufferDst->getPtr(hDevice));
+
+  return enqueueUSMMemcpy(false, dstPtr + dstOffset, srcPtr + srcOffset, size,
+                          numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferCopyRect(
+    ur_mem_handle_t hBufferSrc, ur_mem_handle_t hBufferDst,
+    ur_rect_offset_t srcOrigin, ur_rect_offset_t dstOrigin,
+    ur_rect_region_t region, size_t srcRowPitch, size_t srcSlicePitch,
+    size_t dstRowPitch, size_t dstSlicePitch, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hBufferSrc;
+  std::ignore = hBufferDst;
+  std::ignore = srcOrigin;
+  std::ignore = dstOrigin;
+  std::ignore = region;
+  std::ignore = srcRowPitch;
+  std::ignore = srcSlicePitch;
+  std::ignore = dstRowPitch;
+  std::ignore = dstSlicePitch;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferFill(
+    ur_mem_handle_t hBuffer, const void *pPattern, size_t patternSize,
+    size_t offset, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_out_of_order_t::enqueueMemBufferFill");
+
+  UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
+
+  auto ptr = ur_cast<char *>(hBuffer->getPtr(hDevice));
+  return enqueueUSMFill(ptr + offset, patternSize, pPattern, size,
+                        numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemImageRead(
+    ur_mem_handle_t hImage, bool blockingRead, ur_rect_offset_t origin,
+    ur_rect_region_t region, size_t rowPitch, size_t slicePitch, void *pDst,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  std::ignore = hImage;
+  std::ignore = blockingRead;
+  std::ignore = origin;
+  std::ignore = region;
+  std::ignore = rowPitch;
+  std::ignore = slicePitch;
+  std::ignore = pDst;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemImageWrite(
+    ur_mem_handle_t hImage, bool blockingWrite, ur_rect_offset_t origin,
+    ur_rect_region_t region, size_t rowPitch, size_t slicePitch, void *pSrc,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  std::ignore = hImage;
+  std::ignore = blockingWrite;
+  std::ignore = origin;
+  std::ignore = region;
+  std::ignore = rowPitch;
+  std::ignore = slicePitch;
+  std::ignore = pSrc;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemImageCopy(
+    ur_mem_handle_t hImageSrc, ur_mem_handle_t hImageDst,
+    ur_rect_offset_t srcOrigin, ur_rect_offset_t dstOrigin,
+    ur_rect_region_t region, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hImageSrc;
+  std::ignore = hImageDst;
+  std::ignore = srcOrigin;
+  std::ignore = dstOrigin;
+  std::ignore = region;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferMap(
+    ur_mem_handle_t hBuffer, bool blockingMap, ur_map_flags_t mapFlags,
+    size_t offset, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    void **ppRetMap) {
+  std::ignore = hBuffer;
+  std::ignore = blockingMap;
+  std::ignore = mapFlags;
+  std::ignore = offset;
+  std::ignore = size;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  std::ignore = ppRetMap;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemUnmap(
+    ur_mem_handle_t hMem, void *pMappedPtr, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hMem;
+  std::ignore = pMappedPtr;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMFill(
+    void *pMem, size_t patternSize, const void *pPattern, size_t size,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_out_of_order_t::enqueueUSMFill");
+
+  auto &slot = getSlotForFill(patternSize);
+  std::scoped_lock<std::mutex> lock(slot.mutex);
+
+  auto signalEvent = getSignalEvent(slot, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_FILL);
+
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, slot);
+
+  // TODO: support non-power-of-two pattern sizes
+
+  // PatternSize must be a power of two for zeCommandListAppendMemoryFill.
+  // When it's not, the fill is emulated with zeCommandListAppendMemoryCopy.
+  ZE2UR_CALL(zeCommandListAppendMemoryFill,
+             (slot.handler.commandList.get(), pMem, pPattern, patternSize, size,
+              signalEvent, numWaitEvents, pWaitEvents));
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMMemcpy(
+    bool blocking, void *pDst, const void *pSrc, size_t size,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  // TODO: parametrize latency tracking with 'blocking'
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_out_of_order_t::enqueueUSMMemcpy");
+
+  auto &slot = getSlotForCopy();
+  std::scoped_lock<std::mutex> lock(slot.mutex);
+
+  auto signalEvent = getSignalEvent(slot, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_MEMCPY);
+  telemetry.bytesCopied(ur::queue_telemetry_t::unknown_direction, size);
+
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, slot);
+
+  ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+             (slot.handler.commandList.get(), pDst, pSrc, size, signalEvent,
+              numWaitEvents, pWaitEvents));
+
+  if (blocking) {
+    ur::queue_telemetry_t::wait_scope_t waitScope(telemetry);
+    UR_CALL(v2::hostSynchronize(waitPolicy, slot.handler.commandList.get()));
+    slot.handler.lastEvent = nullptr;
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMPrefetch(
+    const void *pMem, size_t size, ur_usm_migration_flags_t flags,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  std::ignore = flags;
+
+  auto &slot = getSlotForCompute();
+  std::scoped_lock<std::mutex> lock(slot.mutex);
+
+  auto signalEvent = getSignalEvent(slot, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_PREFETCH);
+
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, slot);
+
+  if (pWaitEvents) {
+    ZE2UR_CALL(zeCommandListAppendBarrier,
+               (slot.handler.commandList.get(), nullptr, numWaitEvents,
+                pWaitEvents));
+  }
+  // TODO: figure out how to translate "flags"
+  ZE2UR_CALL(zeCommandListAppendMemoryPrefetch,
+             (slot.handler.commandList.get(), pMem, size));
+  ZE2UR_CALL(zeCommandListAppendSignalEvent,
+             (slot.handler.commandList.get(), signalEvent));
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMAdvise(
+    const void *pMem, size_t size, ur_usm_advice_flags_t advice,
+    ur_event_handle_t *phEvent) {
+  auto zeAdvice = ur_cast<ze_memory_advice_t>(advice);
+
+  auto &slot = getSlotForCompute();
+  std::scoped_lock<std::mutex> lock(slot.mutex);
+
+  auto signalEvent = getSignalEvent(slot, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_ADVISE);
+
+  // TODO: figure out how to translate "flags"
+  ZE2UR_CALL(zeCommandListAppendMemAdvise,
+             (slot.handler.commandList.get(), this->hDevice->ZeDevice, pMem,
+              size, zeAdvice));
+  ZE2UR_CALL(zeCommandListAppendSignalEvent,
+             (slot.handler.commandList.get(), signalEvent));
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMFill2D(
+    void *pMem, size_t pitch, size_t patternSize, const void *pPattern,
+    size_t width, size_t height, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_out_of_order_t::enqueueUSMFill2D");
+
+  auto &slot = getSlotForFill(patternSize);
+  std::scoped_lock<std::mutex> lock(slot.mutex);
+
+  auto signalEvent = getSignalEvent(slot, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_FILL_2D);
+
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, slot);
+
+  UR_CALL(appendMemoryFill2D(slot.handler.commandList.get(), pMem, pitch,
+                             pPattern, patternSize, width, height, signalEvent,
+                             numWaitEvents, pWaitEvents));
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMMemcpy2D(
+    bool blocking, void *pDst, size_t dstPitch, const void *pSrc,
+    size_t srcPitch, size_t width, size_t height, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_out_of_order_t::enqueueUSMMemcpy2D");
+
+  auto &slot = getSlotForCopy();
+  std::scoped_lock<std::mutex> lock(slot.mutex);
+
+  auto signalEvent = getSignalEvent(slot, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_USM_MEMCPY_2D);
+  telemetry.bytesCopied(ur::queue_telemetry_t::unknown_direction,
+                        width * height);
+
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, slot);
+
+  UR_CALL(appendMemoryCopy2D(slot.handler.commandList.get(), pDst, dstPitch,
+                             pSrc, srcPitch, width, height, signalEvent,
+                             numWaitEvents, pWaitEvents));
+
+  if (blocking) {
+    ur::queue_telemetry_t::wait_scope_t waitScope(telemetry);
+    UR_CALL(v2::hostSynchronize(waitPolicy, slot.handler.commandList.get()));
+    slot.handler.lastEvent = nullptr;
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueDeviceGlobalVariableWrite(
+    ur_program_handle_t hProgram, const char *name, bool blockingWrite,
+    size_t count, size_t offset, const void *pSrc, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hProgram;
+  std::ignore = name;
+  std::ignore = blockingWrite;
+  std::ignore = count;
+  std::ignore = offset;
+  std::ignore = pSrc;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueDeviceGlobalVariableRead(
+    ur_program_handle_t hProgram, const char *name, bool blockingRead,
+    size_t count, size_t offset, void *pDst, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hProgram;
+  std::ignore = name;
+  std::ignore = blockingRead;
+  std::ignore = count;
+  std::ignore = offset;
+  std::ignore = pDst;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueReadHostPipe(
+    ur_program_handle_t hProgram, const char *pipe_symbol, bool blocking,
+    void *pDst, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hProgram;
+  std::ignore = pipe_symbol;
+  std::ignore = blocking;
+  std::ignore = pDst;
+  std::ignore = size;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueWriteHostPipe(
+    ur_program_handle_t hProgram, const char *pipe_symbol, bool blocking,
+    void *pSrc, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hProgram;
+  std::ignore = pipe_symbol;
+  std::ignore = blocking;
+  std::ignore = pSrc;
+  std::ignore = size;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::bindlessImagesImageCopyExp(
+    const void *pSrc, void *pDst, const ur_image_desc_t *pSrcImageDesc,
+    const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat,
+    ur_exp_image_copy_region_t *pCopyRegion,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = pDst;
+  std::ignore = pSrc;
+  std::ignore = pSrcImageDesc;
+  std::ignore = pDstImageDesc;
+  std::ignore = imageCopyFlags;
+  std::ignore = pSrcImageFormat;
+  std::ignore = pDstImageFormat;
+  std::ignore = pCopyRegion;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t
+ur_queue_immediate_out_of_order_t::bindlessImagesWaitExternalSemaphoreExp(
+    ur_exp_external_semaphore_handle_t hSemaphore, bool hasWaitValue,
+    uint64_t waitValue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hSemaphore;
+  std::ignore = hasWaitValue;
+  std::ignore = waitValue;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t
+ur_queue_immediate_out_of_order_t::bindlessImagesSignalExternalSemaphoreExp(
+    ur_exp_external_semaphore_handle_t hSemaphore, bool hasSignalValue,
+    uint64_t signalValue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hSemaphore;
+  std::ignore = hasSignalValue;
+  std::ignore = signalValue;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t
+ur_queue_immediate_out_of_order_t::enqueueCooperativeKernelLaunchExp(
+    ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = hKernel;
+  std::ignore = workDim;
+  std::ignore = pGlobalWorkOffset;
+  std::ignore = pGlobalWorkSize;
+  std::ignore = pLocalWorkSize;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueTimestampRecordingExp(
+    bool blocking, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = blocking;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+// Like the timestamp recordings, the markers are not supported yet
+ur_result_t
+ur_queue_immediate_out_of_order_t::queueReserveTimestampMarkersExp(uint32_t) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueTimestampMarkerExp(
+    uint32_t, const ur_event_handle_t *, uint64_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueReadTimestampMarkersExp(
+    uint64_t, uint32_t, uint64_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueKernelLaunchCustomExp(
+    ur_kernel_handle_t hKernel, uint32_t workDim, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numPropsInLaunchPropList,
+    const ur_exp_launch_property_t *launchPropList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  std::ignore = hKernel;
+  std::ignore = workDim;
+  std::ignore = pGlobalWorkSize;
+  std::ignore = pLocalWorkSize;
+  std::ignore = numPropsInLaunchPropList;
+  std::ignore = launchPropList;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueNativeCommandExp(
+    ur_exp_enqueue_native_command_function_t, void *, uint32_t,
+    const ur_mem_handle_t *, const ur_exp_enqueue_native_command_properties_t *,
+    uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueKernelLaunchBatchExp(
+    uint32_t numLaunches, const ur_exp_kernel_launch_desc_t *pLaunches,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_out_of_order_t::enqueueKernelLaunchBatchExp");
+
+  for (uint32_t i = 0; i < numLaunches; ++i) {
+    UR_ASSERT(pLaunches[i].hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+    UR_ASSERT(pLaunches[i].hKernel->getProgramHandle(),
+              UR_RESULT_ERROR_INVALID_NULL_POINTER);
+    UR_ASSERT(pLaunches[i].workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+    UR_ASSERT(pLaunches[i].workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  }
+
+  // The whole batch goes to the in-order command list of one slot, so only
+  // the first launch waits on the events and only the last one signals the
+  // event
+  auto &slot = getSlotForCompute();
+  std::scoped_lock<std::mutex> lock(slot.mutex);
+
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, slot);
+  telemetry.commandSubmitted(ur::queue_telemetry_t::kernel_launch,
+                             numLaunches);
+  telemetry.batchSubmitted(numLaunches);
+
+  for (uint32_t i = 0; i < numLaunches; ++i) {
+    const ur_exp_kernel_launch_desc_t &launch = pLaunches[i];
+    ur_kernel_handle_t hKernel = launch.hKernel;
+    ze_kernel_handle_t hZeKernel = hKernel->getZeHandle(hDevice);
+
+    std::scoped_lock<ur_shared_mutex, ur_shared_mutex> Lock(
+        hKernel->Mutex, hKernel->getProgramHandle()->Mutex);
+
+    ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
+    UR_CALL(hKernel->prepareForSubmission(
+        hContext, hDevice, launch.pGlobalWorkOffset, launch.workDim,
+        launch.pGlobalWorkSize, launch.pLocalWorkSize,
+        zeThreadGroupDimensions));
+
+    UR_CALL(hKernel->appendArgPrefetches(slot.handler.commandList.get()));
+
+    bool last = i + 1 == numLaunches;
+    ze_event_handle_t signalEvent =
+        last ? getSignalEvent(slot, phEvent) : nullptr;
+
+    ZE2UR_CALL(zeCommandListAppendLaunchKernel,
+               (slot.handler.commandList.get(), hZeKernel,
+                &zeThreadGroupDimensions, signalEvent,
+                i == 0 ? numWaitEvents : 0, i == 0 ? pWaitEvents : nullptr));
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueCommandBuffer(
+    ze_command_list_handle_t zeCommandList, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_out_of_order_t::enqueueCommandBuffer");
+
+  auto &slot = getSlotForCompute();
+  std::scoped_lock<std::mutex> lock(slot.mutex);
+
+  auto signalEvent = getSignalEvent(slot, phEvent);
+  telemetry.commandSubmittedAsBatch(UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP);
+
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(phEventWaitList, numEventsInWaitList, slot);
+
+  ZE2UR_CALL(zeCommandListImmediateAppendCommandListsExp,
+             (slot.handler.commandList.get(), 1, &zeCommandList, signalEvent,
+              numWaitEvents, pWaitEvents));
+
+  return UR_RESULT_SUCCESS;
+}
+} // namespace v2
@@ -19,6 +19,8 @@
 #include <umf/pools/pool_proxy.h>
 #include <umf/providers/provider_level_zero.h>
 
+#include <algorithm>
+
 static usm::DisjointPoolAllConfigs initializeDisjointPoolConfig() {
   const char *PoolUrTraceVal = std::getenv("UR_L0_USM_ALLOCATOR_TRACE");
 
@@ -66,9 +68,14 @@ descToDisjoinPoolMemType(const usm::pool_descriptor &desc) {
   }
 }
 
-static umf::pool_unique_handle_t
-makePool(umf_disjoint_pool_params_t *poolParams,
-         usm::pool_descriptor poolDescriptor) {
+static umf::provider_unique_handle_t
+makeProvider(usm::pool_descriptor poolDescriptor) {
+  // TODO: allocate host memory placed following poolDescriptor.hostMemory,
+  // the Level Zero provider of UMF only allocates through the driver
+  if (!poolDescriptor.hostMemory.isDefault()) {
+    throw UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
   level_zero_memory_provider_params_t params = {};
   params.level_zero_context_handle = poolDescriptor.hContext->getZeHandle();
   params.level_zero_device_handle =
@@ -81,21 +88,30 @@ makePool(umf_disjoint_pool_params_t *poolParams,
   if (ret != UMF_RESULT_SUCCESS) {
     throw umf::umf2urResult(ret);
   }
+  return std::move(provider);
+}
 
-  if (!poolParams) {
-    auto [ret, poolHandle] = umf::poolMakeUniqueFromOps(
-        umfProxyPoolOps(), std::move(provider), nullptr);
-    if (ret != UMF_RESULT_SUCCESS)
-      throw umf::umf2urResult(ret);
-    return std::move(poolHandle);
-  } else {
-    auto [ret, poolHandle] =
-        umf::poolMakeUniqueFromOps(umfDisjointPoolOps(), std::move(provider),
-                                   static_cast<void *>(poolParams));
-    if (ret != UMF_RESULT_SUCCESS)
-      throw umf::umf2urResult(ret);
-    return std::move(poolHandle);
-  }
+static umf::pool_unique_handle_t
+makeProxyPool(umf::provider_unique_handle_t provider) {
+  auto [ret, poolHandle] = umf::poolMakeUniqueFromOps(
+      umfProxyPoolOps(), std::move(provider), nullptr);
+  if (ret != UMF_RESULT_SUCCESS)
+    throw umf::umf2urResult(ret);
+  return std::move(poolHandle);
+}
+
+static umf::pool_unique_handle_t
+makeDisjointPool(umf::provider_unique_handle_t provider,
+                 usm::DisjointPoolAllConfigs &configs,
+                 usm::DisjointPoolMemType memType) {
+  auto [ret, poolHandle] = umf::poolMakeUniqueFromOps(
+      umfDisjointPoolOps(), std::move(provider),
+      static_cast<void *>(&configs.Configs[memType]));
+  if (ret != UMF_RESULT_SUCCESS)
+    throw umf::umf2urResult(ret);
+  return umf::poolAddThreadCache(std::move(poolHandle),
+                                 configs.ThreadCaches[memType].Capacity,
+                                 configs.ThreadCaches[memType].MaxSize);
 }
 
 ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t hContext,
@@ -110,18 +126,33 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t hContext,
     }
   }
 
-  auto [result, descriptors] = usm::pool_descriptor::create(this, hContext);
+  auto [result, descriptors] = usm::pool_descriptor::create(
+      this, hContext, find_stype_node<ur_exp_usm_host_pool_desc_t>(pPoolDesc));
   if (result != UR_RESULT_SUCCESS) {
     throw result;
   }
 
+  for (size_t i = 0; i < usm::DisjointPoolMemType::All; i++) {
+    maxPoolableSize[i] = disjointPoolConfigs.EnableBuffers
+                             ? disjointPoolConfigs.Configs[i].MaxPoolableSize
+                             : SIZE_MAX;
+  }
+
+  auto addPool = [this](usm::pool_manager<usm::pool_descriptor> &manager,
+                        const usm::pool_descriptor &desc,
+                        umf::pool_unique_handle_t pool) {
+    umfPools.push_back(pool.get());
+    manager.addPool(desc, std::move(pool));
+  };
+
   for (auto &desc : descriptors) {
     if (disjointPoolConfigs.EnableBuffers) {
-      auto &poolConfig =
-          disjointPoolConfigs.Configs[descToDisjoinPoolMemType(desc)];
-      poolManager.addPool(desc, makePool(&poolConfig, desc));
+      addPool(poolManager, desc,
+              makeDisjointPool(makeProvider(desc), disjointPoolConfigs,
+                               descToDisjoinPoolMemType(desc)));
+      addPool(bypassPoolManager, desc, makeProxyPool(makeProvider(desc)));
     } else {
-      poolManager.addPool(desc, makePool(nullptr, desc));
+      addPool(poolManager, desc, makeProxyPool(makeProvider(desc)));
     }
   }
 }
@@ -130,9 +161,18 @@ ur_context_handle_t ur_usm_pool_handle_t_::getContextHandle() const {
   return hContext;
 }
 
+bool ur_usm_pool_handle_t_::hasPool(umf_memory_pool_handle_t umfPool) const {
+  return std::find(umfPools.begin(), umfPools.end(), umfPool) !=
+         umfPools.end();
+}
+
 umf_memory_pool_handle_t
-ur_usm_pool_handle_t_::getPool(const usm::pool_descriptor &desc) {
-  auto pool = poolManager.getPool(desc).value();
+ur_usm_pool_handle_t_::getPool(const usm::pool_descriptor &desc,
+                               size_t size) {
+  auto &manager = size > maxPoolableSize[descToDisjoinPoolMemType(desc)]
+                      ? bypassPoolManager
+                      : poolManager;
+  auto pool = manager.getPool(desc).value();
   assert(pool);
   return pool;
 }
@@ -144,13 +184,13 @@ ur_result_t ur_usm_pool_handle_t_::allocate(
     void **ppRetMem) {
   uint32_t alignment = pUSMDesc ? pUSMDesc->align : 0;
 
-  auto umfPool =
-      getPool(usm::pool_descriptor{this, hContext, hDevice, type, false});
+  auto umfPool = getPool(
+      usm::pool_descriptor{this, hContext, hDevice, type, false}, size);
   if (!umfPool) {
     return UR_RESULT_ERROR_INVALID_ARGUMENT;
   }
 
-  *ppRetMem = umfPoolAlignedMalloc(umfPool, size, alignment);
+  *ppRetMem = umf::cachedAlignedMalloc(umfPool, size, alignment);
   if (*ppRetMem == nullptr) {
     auto umfRet = umfPoolGetLastAllocationError(umfPool);
     return umf::umf2urResult(umfRet);
@@ -169,6 +209,7 @@ ur_result_t urUSMPoolCreate(
 ) {
 
   *hPool = new ur_usm_pool_handle_t_(hContext, pPoolDesc);
+  hContext->addUSMPool(*hPool);
   return UR_RESULT_SUCCESS;
 }
 
@@ -183,6 +224,7 @@ ur_result_t
 urUSMPoolRelease(ur_usm_pool_handle_t hPool ///< [in] pointer to USM memory pool
 ) {
   if (hPool->RefCount.decrementAndTest()) {
+    hPool->getContextHandle()->removeUSMPool(hPool);
     delete hPool;
   }
   return UR_RESULT_SUCCESS;
@@ -273,7 +315,11 @@ urUSMFree(ur_context_handle_t hContext, ///< [in] handle of the context object
           void *pMem                    ///< [in] pointer to USM memory object
 ) {
   std::ignore = hContext;
-  return umf::umf2urResult(umfFree(pMem));
+  auto umfPool = umfPoolByPtr(pMem);
+  if (!umfPool) {
+    return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+  }
+  return umf::umf2urResult(umf::cachedFree(umfPool, pMem));
 }
 
 ur_result_t urUSMGetMemAllocInfo(
@@ -342,13 +388,14 @@ ur_result_t urUSMGetMemAllocInfo(
     return ReturnValue(size);
   }
   case UR_USM_ALLOC_INFO_POOL: {
-    // TODO
-    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    auto umfPool = umfPoolByPtr(ptr);
+    auto hPool = umfPool ? hContext->findUSMPool(umfPool) : nullptr;
+    return hPool ? ReturnValue(hPool) : UR_RESULT_ERROR_INVALID_VALUE;
+  }
   default:
     logger::error("urUSMGetMemAllocInfo: unsupported ParamName");
     return UR_RESULT_ERROR_INVALID_VALUE;
   }
-  }
   return UR_RESULT_SUCCESS;
 }
 } // namespace ur::level_zero
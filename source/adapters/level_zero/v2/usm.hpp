@@ -25,9 +25,21 @@ struct ur_usm_pool_handle_t_ : _ur_object {
                        const ur_usm_desc_t *pUSMDesc, ur_usm_type_t type,
                        size_t size, void **ppRetMem);
 
+  // Whether umfPool is one of the pools of this handle
+  bool hasPool(umf_memory_pool_handle_t umfPool) const;
+
 private:
   ur_context_handle_t hContext;
   usm::pool_manager<usm::pool_descriptor> poolManager;
 
-  umf_memory_pool_handle_t getPool(const usm::pool_descriptor &desc);
+  // Pools passing allocations larger than the MaxPoolableSize of their type
+  // straight to the driver, so that they don't go through the bookkeeping of
+  // the disjoint pools. Empty when pooling is disabled.
+  usm::pool_manager<usm::pool_descriptor> bypassPoolManager;
+  size_t maxPoolableSize[usm::DisjointPoolMemType::All] = {};
+
+  std::vector<umf_memory_pool_handle_t> umfPools;
+
+  umf_memory_pool_handle_t getPool(const usm::pool_descriptor &desc,
+                                   size_t size);
 };
@@ -96,5 +96,6 @@ context_t::context_t() {
                                              &mock_urPlatformGetInfo);
     mock::getCallbacks().set_before_callback("urDeviceGetInfo",
                                              &mock_urDeviceGetInfo);
+    simulator.registerCallbacks();
 }
 } // namespace driver
@@ -14,6 +14,7 @@
 #define UR_ADAPTER_MOCK_H 1
 
 #include "ur_ddi.h"
+#include "ur_mock_simulator.hpp"
 #include "ur_util.hpp"
 
 namespace driver {
@@ -29,6 +30,8 @@ class __urdlllocal context_t {
     ur_adapter_handle_t adapter = reinterpret_cast<ur_adapter_handle_t>(1);
     ur_device_handle_t device = reinterpret_cast<ur_device_handle_t>(2);
     ur_platform_handle_t platform = reinterpret_cast<ur_platform_handle_t>(3);
+
+    simulator_t simulator;
 };
 
 extern context_t d_context;
@@ -0,0 +1,303 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_mock_simulator.cpp
+ *
+ */
+
+#include "ur_mock_simulator.hpp"
+#include "logger/ur_logger.hpp"
+#include "ur_mock.hpp"
+#include "ur_mock_helpers.hpp"
+#include "ur_util.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <string_view>
+#include <thread>
+
+namespace driver {
+
+// Parses the nanoseconds of the keys of env_var_name into times, the keys
+// in notTimes are left to the caller
+static std::optional<EnvVarMap>
+parseTimes(const char *env_var_name,
+           std::unordered_map<std::string, std::chrono::nanoseconds> &times,
+           const std::vector<std::string> &notTimes = {}) {
+    std::optional<EnvVarMap> options;
+    try {
+        options = getenv_to_map(env_var_name);
+    } catch (const std::invalid_argument &e) {
+        logger::get_logger("mock").error("unable to parse {}: {}",
+                                         env_var_name, e.what());
+        return std::nullopt;
+    }
+    if (!options) {
+        return std::nullopt;
+    }
+    for (auto &[key, values] : *options) {
+        if (std::find(notTimes.begin(), notTimes.end(), key) !=
+            notTimes.end()) {
+            continue;
+        }
+        try {
+            times[key] = std::chrono::nanoseconds(std::stoull(values.front()));
+        } catch (const std::exception &) {
+            logger::get_logger("mock").error(
+                "{}: invalid nanoseconds of {}: {}", env_var_name, key,
+                values.front());
+        }
+    }
+    return options;
+}
+
+simulator_t::simulator_t() {
+    parseTimes("UR_MOCK_LATENCY", latencies);
+
+    auto device = parseTimes("UR_MOCK_DEVICE", durations, {"concurrency"});
+    if (!device) {
+        return;
+    }
+    deviceEnabled = true;
+    size_t concurrency = 1;
+    auto it = device->find("concurrency");
+    if (it != device->end()) {
+        try {
+            concurrency = std::max<size_t>(1, std::stoull(it->second.front()));
+        } catch (const std::exception &) {
+            logger::get_logger("mock").error(
+                "UR_MOCK_DEVICE: invalid concurrency: {}", it->second.front());
+        }
+    }
+    engines.resize(concurrency);
+}
+
+void simulator_t::registerCallbacks() {
+    if (!deviceEnabled) {
+        return;
+    }
+    auto &callbacks = mock::getCallbacks();
+    callbacks.set_before_callback("urEventWait", &eventWait);
+    callbacks.set_before_callback("urEventGetInfo", &eventGetInfo);
+    callbacks.set_before_callback("urEventGetProfilingInfo",
+                                  &eventGetProfilingInfo);
+    callbacks.set_before_callback("urEventRelease", &eventRelease);
+    callbacks.set_after_callback("urQueueCreate", &queueCreate);
+    callbacks.set_before_callback("urQueueFinish", &queueFinish);
+    callbacks.set_before_callback("urQueueRelease", &queueRelease);
+}
+
+void simulator_t::waitUntil(clock::time_point time) {
+    // Sleeps overshoot by tens of microseconds, the rest is spun
+    auto sleepUntil = time - std::chrono::microseconds(100);
+    if (clock::now() < sleepUntil) {
+        std::this_thread::sleep_until(sleepUntil);
+    }
+    while (clock::now() < time) {
+        std::this_thread::yield();
+    }
+}
+
+void simulator_t::delay(const char *name) {
+    auto it = latencies.find(name);
+    if (it != latencies.end()) {
+        waitUntil(clock::now() + it->second);
+    }
+}
+
+void simulator_t::schedule(const char *name, ur_queue_handle_t hQueue,
+                           uint32_t numEventsInWaitList,
+                           const ur_event_handle_t *phEventWaitList,
+                           ur_event_handle_t *phEvent, bool blocking) {
+    const std::string_view function{name};
+    const bool barrier = function == "urEnqueueEventsWaitWithBarrier";
+    // Without a wait list, these wait for all the previous commands of the
+    // queue
+    const bool waitAll = numEventsInWaitList == 0 &&
+                         (barrier || function == "urEnqueueEventsWait");
+    auto it = durations.find(name);
+    auto duration =
+        it != durations.end() ? it->second : std::chrono::nanoseconds(0);
+
+    command_t command;
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        auto &queue = queues[hQueue];
+        command.submit = clock::now();
+        command.start = command.submit;
+        if (!queue.outOfOrder || waitAll) {
+            command.start = std::max(command.start, queue.last);
+        }
+        command.start = std::max(command.start, queue.barrier);
+        for (uint32_t i = 0; i < numEventsInWaitList; i++) {
+            auto waited = events.find(phEventWaitList[i]);
+            if (waited != events.end()) {
+                command.start = std::max(command.start, waited->second.end);
+            }
+        }
+        // The commands which take time occupy one of the engines of the
+        // device, those which don't only order the others
+        if (duration.count()) {
+            auto engine = std::min_element(engines.begin(), engines.end());
+            command.start = std::max(command.start, *engine);
+            *engine = command.start + duration;
+        }
+        command.end = command.start + duration;
+        queue.last = std::max(queue.last, command.end);
+        if (barrier) {
+            queue.barrier = command.end;
+        }
+        if (phEvent && *phEvent) {
+            events[*phEvent] = command;
+        }
+    }
+    if (blocking) {
+        waitUntil(command.end);
+    }
+}
+
+bool simulator_t::findCommand(ur_event_handle_t hEvent, command_t &command) {
+    std::scoped_lock<std::mutex> lock(mutex);
+    auto it = events.find(hEvent);
+    if (it == events.end()) {
+        return false;
+    }
+    command = it->second;
+    return true;
+}
+
+ur_result_t simulator_t::eventWait(void *pParams) {
+    const auto &params = *static_cast<ur_event_wait_params_t *>(pParams);
+    auto &self = d_context.simulator;
+    clock::time_point end{};
+    for (uint32_t i = 0; i < *params.pnumEvents; i++) {
+        command_t command;
+        if (self.findCommand((*params.pphEventWaitList)[i], command)) {
+            end = std::max(end, command.end);
+        }
+    }
+    waitUntil(end);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t simulator_t::eventGetInfo(void *pParams) {
+    const auto &params = *static_cast<ur_event_get_info_params_t *>(pParams);
+    command_t command;
+    if (*params.ppropName != UR_EVENT_INFO_COMMAND_EXECUTION_STATUS ||
+        !d_context.simulator.findCommand(*params.phEvent, command)) {
+        return UR_RESULT_SUCCESS;
+    }
+    auto now = clock::now();
+    ur_event_status_t status = UR_EVENT_STATUS_COMPLETE;
+    if (now < command.start) {
+        status = UR_EVENT_STATUS_SUBMITTED;
+    } else if (now < command.end) {
+        status = UR_EVENT_STATUS_RUNNING;
+    }
+    if (*params.ppPropValue) {
+        if (*params.ppropSize < sizeof(status)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        *static_cast<ur_event_status_t *>(*params.ppPropValue) = status;
+    }
+    if (*params.ppPropSizeRet) {
+        **params.ppPropSizeRet = sizeof(status);
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t simulator_t::eventGetProfilingInfo(void *pParams) {
+    const auto &params =
+        *static_cast<ur_event_get_profiling_info_params_t *>(pParams);
+    command_t command;
+    if (!d_context.simulator.findCommand(*params.phEvent, command)) {
+        return UR_RESULT_SUCCESS;
+    }
+    clock::time_point time;
+    switch (*params.ppropName) {
+    case UR_PROFILING_INFO_COMMAND_QUEUED:
+    case UR_PROFILING_INFO_COMMAND_SUBMIT:
+        time = command.submit;
+        break;
+    case UR_PROFILING_INFO_COMMAND_START:
+        time = command.start;
+        break;
+    case UR_PROFILING_INFO_COMMAND_END:
+    case UR_PROFILING_INFO_COMMAND_COMPLETE:
+        if (clock::now() < command.end) {
+            return UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE;
+        }
+        time = command.end;
+        break;
+    default:
+        return UR_RESULT_SUCCESS;
+    }
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      time.time_since_epoch())
+                      .count();
+    if (*params.ppPropValue) {
+        if (*params.ppropSize < sizeof(ns)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        *static_cast<uint64_t *>(*params.ppPropValue) = ns;
+    }
+    if (*params.ppPropSizeRet) {
+        **params.ppPropSizeRet = sizeof(ns);
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t simulator_t::eventRelease(void *pParams) {
+    const auto &params = *static_cast<ur_event_release_params_t *>(pParams);
+    auto handle = reinterpret_cast<mock::dummy_handle_t>(*params.phEvent);
+    if (handle->MRefCounter == 1) {
+        auto &self = d_context.simulator;
+        std::scoped_lock<std::mutex> lock(self.mutex);
+        self.events.erase(*params.phEvent);
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t simulator_t::queueCreate(void *pParams) {
+    const auto &params = *static_cast<ur_queue_create_params_t *>(pParams);
+    auto &self = d_context.simulator;
+    std::scoped_lock<std::mutex> lock(self.mutex);
+    auto &queue = self.queues[**params.pphQueue];
+    queue.outOfOrder = *params.ppProperties &&
+                       ((*params.ppProperties)->flags &
+                        UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t simulator_t::queueFinish(void *pParams) {
+    const auto &params = *static_cast<ur_queue_finish_params_t *>(pParams);
+    auto &self = d_context.simulator;
+    clock::time_point last{};
+    {
+        std::scoped_lock<std::mutex> lock(self.mutex);
+        auto it = self.queues.find(*params.phQueue);
+        if (it != self.queues.end()) {
+            last = it->second.last;
+        }
+    }
+    waitUntil(last);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t simulator_t::queueRelease(void *pParams) {
+    const auto &params = *static_cast<ur_queue_release_params_t *>(pParams);
+    auto handle = reinterpret_cast<mock::dummy_handle_t>(*params.phQueue);
+    if (handle->MRefCounter == 1) {
+        auto &self = d_context.simulator;
+        std::scoped_lock<std::mutex> lock(self.mutex);
+        self.queues.erase(*params.phQueue);
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+} // namespace driver
@@ -0,0 +1,109 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_mock_simulator.hpp
+ *
+ * Synthetic latencies of the entry points of the mock adapter, and the model
+ * of an asynchronous device whose commands complete after their modeled
+ * durations, configured with UR_MOCK_LATENCY and UR_MOCK_DEVICE.
+ *
+ */
+
+#ifndef UR_ADAPTER_MOCK_SIMULATOR_H
+#define UR_ADAPTER_MOCK_SIMULATOR_H 1
+
+#include "ur_api.h"
+#include "ur_util.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace driver {
+
+///////////////////////////////////////////////////////////////////////////////
+class __urdlllocal simulator_t {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    simulator_t();
+
+    // Installs the callbacks of the events and queues of the device model,
+    // if it's enabled
+    void registerCallbacks();
+
+    // Called on entry of every entry point, waits for its latency, if any
+    void call(const char *name) {
+        if (!latencies.empty()) {
+            delay(name);
+        }
+    }
+
+    // Called by the enqueue entry points once their handles are created,
+    // schedules the command on the device model, and waits for it to
+    // complete if it's blocking
+    void enqueue(const char *name, ur_queue_handle_t hQueue,
+                 uint32_t numEventsInWaitList,
+                 const ur_event_handle_t *phEventWaitList,
+                 ur_event_handle_t *phEvent, bool blocking) {
+        if (deviceEnabled) {
+            schedule(name, hQueue, numEventsInWaitList, phEventWaitList,
+                     phEvent, blocking);
+        }
+    }
+
+  private:
+    struct command_t {
+        clock::time_point submit;
+        clock::time_point start;
+        clock::time_point end;
+    };
+
+    struct queue_t {
+        bool outOfOrder = false;
+        // The end of the last command, and of the last barrier, which the
+        // commands of in-order and out-of-order queues start after
+        clock::time_point last{};
+        clock::time_point barrier{};
+    };
+
+    static ur_result_t eventWait(void *pParams);
+    static ur_result_t eventGetInfo(void *pParams);
+    static ur_result_t eventGetProfilingInfo(void *pParams);
+    static ur_result_t eventRelease(void *pParams);
+    static ur_result_t queueCreate(void *pParams);
+    static ur_result_t queueFinish(void *pParams);
+    static ur_result_t queueRelease(void *pParams);
+
+    static void waitUntil(clock::time_point time);
+
+    void delay(const char *name);
+    void schedule(const char *name, ur_queue_handle_t hQueue,
+                  uint32_t numEventsInWaitList,
+                  const ur_event_handle_t *phEventWaitList,
+                  ur_event_handle_t *phEvent, bool blocking);
+    bool findCommand(ur_event_handle_t hEvent, command_t &command);
+
+    // Of the entry points, and of the commands of the enqueue entry points
+    std::unordered_map<std::string, std::chrono::nanoseconds> latencies;
+    std::unordered_map<std::string, std::chrono::nanoseconds> durations;
+    bool deviceEnabled = false;
+
+    std::mutex mutex;
+    // The time each of the commands the device executes at once is free at
+    std::vector<clock::time_point> engines;
+    std::unordered_map<ur_queue_handle_t, queue_t> queues;
+    std::unordered_map<ur_event_handle_t, command_t> events;
+};
+
+} // namespace driver
+
+#endif /* UR_ADAPTER_MOCK_SIMULATOR_H */
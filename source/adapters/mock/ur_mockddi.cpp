@@ -32,6 +32,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
 
     ur_adapter_get_params_t params = {&NumEntries, &phAdapters, &pNumAdapters};
 
+    d_context.simulator.call("urAdapterGet");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urAdapterGet"));
     if (beforeCallback) {
@@ -80,6 +82,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
 
     ur_adapter_release_params_t params = {&hAdapter};
 
+    d_context.simulator.call("urAdapterRelease");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urAdapterRelease"));
     if (beforeCallback) {
@@ -122,6 +126,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
 
     ur_adapter_retain_params_t params = {&hAdapter};
 
+    d_context.simulator.call("urAdapterRetain");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urAdapterRetain"));
     if (beforeCallback) {
@@ -171,6 +177,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
     ur_adapter_get_last_error_params_t params = {&hAdapter, &ppMessage,
                                                  &pError};
 
+    d_context.simulator.call("urAdapterGetLastError");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urAdapterGetLastError"));
     if (beforeCallback) {
@@ -224,6 +232,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
     ur_adapter_get_info_params_t params = {&hAdapter, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urAdapterGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urAdapterGetInfo"));
     if (beforeCallback) {
@@ -280,6 +290,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
     ur_platform_get_params_t params = {&phAdapters, &NumAdapters, &NumEntries,
                                        &phPlatforms, &pNumPlatforms};
 
+    d_context.simulator.call("urPlatformGet");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urPlatformGet"));
     if (beforeCallback) {
@@ -339,6 +351,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
     ur_platform_get_info_params_t params = {&hPlatform, &propName, &propSize,
                                             &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urPlatformGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urPlatformGetInfo"));
     if (beforeCallback) {
@@ -382,6 +396,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
 
     ur_platform_get_api_version_params_t params = {&hPlatform, &pVersion};
 
+    d_context.simulator.call("urPlatformGetApiVersion");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urPlatformGetApiVersion"));
     if (beforeCallback) {
@@ -427,6 +443,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
     ur_platform_get_native_handle_params_t params = {&hPlatform,
                                                      &phNativePlatform};
 
+    d_context.simulator.call("urPlatformGetNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urPlatformGetNativeHandle"));
     if (beforeCallback) {
@@ -478,6 +496,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
     ur_platform_create_with_native_handle_params_t params = {
         &hNativePlatform, &hAdapter, &pProperties, &phPlatform};
 
+    d_context.simulator.call("urPlatformCreateWithNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urPlatformCreateWithNativeHandle"));
@@ -531,6 +551,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
     ur_platform_get_backend_option_params_t params = {
         &hPlatform, &pFrontendOption, &ppPlatformOption};
 
+    d_context.simulator.call("urPlatformGetBackendOption");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urPlatformGetBackendOption"));
     if (beforeCallback) {
@@ -587,6 +609,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
     ur_device_get_params_t params = {&hPlatform, &DeviceType, &NumEntries,
                                      &phDevices, &pNumDevices};
 
+    d_context.simulator.call("urDeviceGet");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urDeviceGet"));
     if (beforeCallback) {
@@ -647,6 +671,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
     ur_device_get_info_params_t params = {&hDevice, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urDeviceGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urDeviceGetInfo"));
     if (beforeCallback) {
@@ -690,6 +716,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
 
     ur_device_retain_params_t params = {&hDevice};
 
+    d_context.simulator.call("urDeviceRetain");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urDeviceRetain"));
     if (beforeCallback) {
@@ -733,6 +761,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
 
     ur_device_release_params_t params = {&hDevice};
 
+    d_context.simulator.call("urDeviceRelease");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urDeviceRelease"));
     if (beforeCallback) {
@@ -786,6 +816,8 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
     ur_device_partition_params_t params = {&hDevice, &pProperties, &NumDevices,
                                            &phSubDevices, &pNumDevicesRet};
 
+    d_context.simulator.call("urDevicePartition");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urDevicePartition"));
     if (beforeCallback) {
@@ -838,6 +870,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
     ur_device_select_binary_params_t params = {&hDevice, &pBinaries,
                                                &NumBinaries, &pSelectedBinary};
 
+    d_context.simulator.call("urDeviceSelectBinary");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urDeviceSelectBinary"));
     if (beforeCallback) {
@@ -882,6 +916,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
 
     ur_device_get_native_handle_params_t params = {&hDevice, &phNativeDevice};
 
+    d_context.simulator.call("urDeviceGetNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urDeviceGetNativeHandle"));
     if (beforeCallback) {
@@ -933,6 +969,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
     ur_device_create_with_native_handle_params_t params = {
         &hNativeDevice, &hAdapter, &pProperties, &phDevice};
 
+    d_context.simulator.call("urDeviceCreateWithNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urDeviceCreateWithNativeHandle"));
@@ -987,6 +1025,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     ur_device_get_global_timestamps_params_t params = {
         &hDevice, &pDeviceTimestamp, &pHostTimestamp};
 
+    d_context.simulator.call("urDeviceGetGlobalTimestamps");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urDeviceGetGlobalTimestamps"));
@@ -1038,6 +1078,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     ur_context_create_params_t params = {&DeviceCount, &phDevices, &pProperties,
                                          &phContext};
 
+    d_context.simulator.call("urContextCreate");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urContextCreate"));
     if (beforeCallback) {
@@ -1082,6 +1124,8 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
 
     ur_context_retain_params_t params = {&hContext};
 
+    d_context.simulator.call("urContextRetain");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urContextRetain"));
     if (beforeCallback) {
@@ -1126,6 +1170,8 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
 
     ur_context_release_params_t params = {&hContext};
 
+    d_context.simulator.call("urContextRelease");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urContextRelease"));
     if (beforeCallback) {
@@ -1182,6 +1228,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
     ur_context_get_info_params_t params = {&hContext, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urContextGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urContextGetInfo"));
     if (beforeCallback) {
@@ -1227,6 +1275,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
     ur_context_get_native_handle_params_t params = {&hContext,
                                                     &phNativeContext};
 
+    d_context.simulator.call("urContextGetNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urContextGetNativeHandle"));
     if (beforeCallback) {
@@ -1283,6 +1333,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         &hNativeContext, &hAdapter,    &numDevices,
         &phDevices,      &pProperties, &phContext};
 
+    d_context.simulator.call("urContextCreateWithNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urContextCreateWithNativeHandle"));
@@ -1335,6 +1387,8 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
     ur_context_set_extended_deleter_params_t params = {&hContext, &pfnDeleter,
                                                        &pUserData};
 
+    d_context.simulator.call("urContextSetExtendedDeleter");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urContextSetExtendedDeleter"));
@@ -1386,6 +1440,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
     ur_mem_image_create_params_t params = {&hContext,   &flags, &pImageFormat,
                                            &pImageDesc, &pHost, &phMem};
 
+    d_context.simulator.call("urMemImageCreate");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urMemImageCreate"));
     if (beforeCallback) {
@@ -1436,6 +1492,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
     ur_mem_buffer_create_params_t params = {&hContext, &flags, &size,
                                             &pProperties, &phBuffer};
 
+    d_context.simulator.call("urMemBufferCreate");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urMemBufferCreate"));
     if (beforeCallback) {
@@ -1486,6 +1544,8 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
 
     ur_mem_retain_params_t params = {&hMem};
 
+    d_context.simulator.call("urMemRetain");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urMemRetain"));
     if (beforeCallback) {
@@ -1530,6 +1590,8 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
 
     ur_mem_release_params_t params = {&hMem};
 
+    d_context.simulator.call("urMemRelease");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urMemRelease"));
     if (beforeCallback) {
@@ -1581,6 +1643,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
     ur_mem_buffer_partition_params_t params = {
         &hBuffer, &flags, &bufferCreateType, &pRegion, &phMem};
 
+    d_context.simulator.call("urMemBufferPartition");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urMemBufferPartition"));
     if (beforeCallback) {
@@ -1629,6 +1693,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
 
     ur_mem_get_native_handle_params_t params = {&hMem, &hDevice, &phNativeMem};
 
+    d_context.simulator.call("urMemGetNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urMemGetNativeHandle"));
     if (beforeCallback) {
@@ -1679,6 +1745,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
     ur_mem_buffer_create_with_native_handle_params_t params = {
         &hNativeMem, &hContext, &pProperties, &phMem};
 
+    d_context.simulator.call("urMemBufferCreateWithNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urMemBufferCreateWithNativeHandle"));
@@ -1737,6 +1805,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         &hNativeMem, &hContext,    &pImageFormat,
         &pImageDesc, &pProperties, &phMem};
 
+    d_context.simulator.call("urMemImageCreateWithNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urMemImageCreateWithNativeHandle"));
@@ -1797,6 +1867,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
     ur_mem_get_info_params_t params = {&hMemory, &propName, &propSize,
                                        &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urMemGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urMemGetInfo"));
     if (beforeCallback) {
@@ -1851,6 +1923,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
     ur_mem_image_get_info_params_t params = {&hMemory, &propName, &propSize,
                                              &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urMemImageGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urMemImageGetInfo"));
     if (beforeCallback) {
@@ -1896,6 +1970,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
 
     ur_sampler_create_params_t params = {&hContext, &pDesc, &phSampler};
 
+    d_context.simulator.call("urSamplerCreate");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urSamplerCreate"));
     if (beforeCallback) {
@@ -1940,6 +2016,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
 
     ur_sampler_retain_params_t params = {&hSampler};
 
+    d_context.simulator.call("urSamplerRetain");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urSamplerRetain"));
     if (beforeCallback) {
@@ -1984,6 +2062,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
 
     ur_sampler_release_params_t params = {&hSampler};
 
+    d_context.simulator.call("urSamplerRelease");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urSamplerRelease"));
     if (beforeCallback) {
@@ -2036,6 +2116,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
     ur_sampler_get_info_params_t params = {&hSampler, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urSamplerGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urSamplerGetInfo"));
     if (beforeCallback) {
@@ -2081,6 +2163,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
     ur_sampler_get_native_handle_params_t params = {&hSampler,
                                                     &phNativeSampler};
 
+    d_context.simulator.call("urSamplerGetNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urSamplerGetNativeHandle"));
     if (beforeCallback) {
@@ -2131,6 +2215,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
     ur_sampler_create_with_native_handle_params_t params = {
         &hNativeSampler, &hContext, &pProperties, &phSampler};
 
+    d_context.simulator.call("urSamplerCreateWithNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urSamplerCreateWithNativeHandle"));
@@ -2186,6 +2272,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
     ur_usm_host_alloc_params_t params = {&hContext, &pUSMDesc, &pool, &size,
                                          &ppMem};
 
+    d_context.simulator.call("urUSMHostAlloc");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMHostAlloc"));
     if (beforeCallback) {
@@ -2238,6 +2326,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
     ur_usm_device_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
 
+    d_context.simulator.call("urUSMDeviceAlloc");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMDeviceAlloc"));
     if (beforeCallback) {
@@ -2290,6 +2380,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
     ur_usm_shared_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
 
+    d_context.simulator.call("urUSMSharedAlloc");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMSharedAlloc"));
     if (beforeCallback) {
@@ -2334,6 +2426,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
 
     ur_usm_free_params_t params = {&hContext, &pMem};
 
+    d_context.simulator.call("urUSMFree");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMFree"));
     if (beforeCallback) {
@@ -2388,6 +2482,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
     ur_usm_get_mem_alloc_info_params_t params = {
         &hContext, &pMem, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urUSMGetMemAllocInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMGetMemAllocInfo"));
     if (beforeCallback) {
@@ -2434,6 +2530,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
 
     ur_usm_pool_create_params_t params = {&hContext, &pPoolDesc, &ppPool};
 
+    d_context.simulator.call("urUSMPoolCreate");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMPoolCreate"));
     if (beforeCallback) {
@@ -2477,6 +2575,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
 
     ur_usm_pool_retain_params_t params = {&pPool};
 
+    d_context.simulator.call("urUSMPoolRetain");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMPoolRetain"));
     if (beforeCallback) {
@@ -2520,6 +2620,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
 
     ur_usm_pool_release_params_t params = {&pPool};
 
+    d_context.simulator.call("urUSMPoolRelease");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMPoolRelease"));
     if (beforeCallback) {
@@ -2571,6 +2673,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
     ur_usm_pool_get_info_params_t params = {&hPool, &propName, &propSize,
                                             &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urUSMPoolGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMPoolGetInfo"));
     if (beforeCallback) {
@@ -2628,6 +2732,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
     ur_virtual_mem_granularity_get_info_params_t params = {
         &hContext, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urVirtualMemGranularityGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urVirtualMemGranularityGetInfo"));
@@ -2683,6 +2789,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
     ur_virtual_mem_reserve_params_t params = {&hContext, &pStart, &size,
                                               &ppStart};
 
+    d_context.simulator.call("urVirtualMemReserve");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urVirtualMemReserve"));
     if (beforeCallback) {
@@ -2728,6 +2836,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
 
     ur_virtual_mem_free_params_t params = {&hContext, &pStart, &size};
 
+    d_context.simulator.call("urVirtualMemFree");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urVirtualMemFree"));
     if (beforeCallback) {
@@ -2780,6 +2890,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
     ur_virtual_mem_map_params_t params = {&hContext,     &pStart, &size,
                                           &hPhysicalMem, &offset, &flags};
 
+    d_context.simulator.call("urVirtualMemMap");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urVirtualMemMap"));
     if (beforeCallback) {
@@ -2825,6 +2937,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
 
     ur_virtual_mem_unmap_params_t params = {&hContext, &pStart, &size};
 
+    d_context.simulator.call("urVirtualMemUnmap");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urVirtualMemUnmap"));
     if (beforeCallback) {
@@ -2873,6 +2987,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
     ur_virtual_mem_set_access_params_t params = {&hContext, &pStart, &size,
                                                  &flags};
 
+    d_context.simulator.call("urVirtualMemSetAccess");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urVirtualMemSetAccess"));
     if (beforeCallback) {
@@ -2930,6 +3046,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         &hContext, &pStart,     &size,        &propName,
         &propSize, &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urVirtualMemGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urVirtualMemGetInfo"));
     if (beforeCallback) {
@@ -2981,6 +3099,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
     ur_physical_mem_create_params_t params = {&hContext, &hDevice, &size,
                                               &pProperties, &phPhysicalMem};
 
+    d_context.simulator.call("urPhysicalMemCreate");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urPhysicalMemCreate"));
     if (beforeCallback) {
@@ -3025,6 +3145,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
 
     ur_physical_mem_retain_params_t params = {&hPhysicalMem};
 
+    d_context.simulator.call("urPhysicalMemRetain");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urPhysicalMemRetain"));
     if (beforeCallback) {
@@ -3069,6 +3191,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
 
     ur_physical_mem_release_params_t params = {&hPhysicalMem};
 
+    d_context.simulator.call("urPhysicalMemRelease");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urPhysicalMemRelease"));
     if (beforeCallback) {
@@ -3119,6 +3243,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
     ur_program_create_with_il_params_t params = {&hContext, &pIL, &length,
                                                  &pProperties, &phProgram};
 
+    d_context.simulator.call("urProgramCreateWithIL");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramCreateWithIL"));
     if (beforeCallback) {
@@ -3171,6 +3297,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
     ur_program_create_with_binary_params_t params = {
         &hContext, &hDevice, &size, &pBinary, &pProperties, &phProgram};
 
+    d_context.simulator.call("urProgramCreateWithBinary");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramCreateWithBinary"));
     if (beforeCallback) {
@@ -3217,6 +3345,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
 
     ur_program_build_params_t params = {&hContext, &hProgram, &pOptions};
 
+    d_context.simulator.call("urProgramBuild");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramBuild"));
     if (beforeCallback) {
@@ -3263,6 +3393,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
 
     ur_program_compile_params_t params = {&hContext, &hProgram, &pOptions};
 
+    d_context.simulator.call("urProgramCompile");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramCompile"));
     if (beforeCallback) {
@@ -3316,6 +3448,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
     ur_program_link_params_t params = {&hContext, &count, &phPrograms,
                                        &pOptions, &phProgram};
 
+    d_context.simulator.call("urProgramLink");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramLink"));
     if (beforeCallback) {
@@ -3360,6 +3494,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
 
     ur_program_retain_params_t params = {&hProgram};
 
+    d_context.simulator.call("urProgramRetain");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramRetain"));
     if (beforeCallback) {
@@ -3404,6 +3540,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
 
     ur_program_release_params_t params = {&hProgram};
 
+    d_context.simulator.call("urProgramRelease");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramRelease"));
     if (beforeCallback) {
@@ -3457,6 +3595,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
     ur_program_get_function_pointer_params_t params = {
         &hDevice, &hProgram, &pFunctionName, &ppFunctionPointer};
 
+    d_context.simulator.call("urProgramGetFunctionPointer");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urProgramGetFunctionPointer"));
@@ -3513,6 +3653,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
         &hDevice, &hProgram, &pGlobalVariableName, &pGlobalVariableSizeRet,
         &ppGlobalVariablePointerRet};
 
+    d_context.simulator.call("urProgramGetGlobalVariablePointer");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urProgramGetGlobalVariablePointer"));
@@ -3570,6 +3712,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
     ur_program_get_info_params_t params = {&hProgram, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urProgramGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramGetInfo"));
     if (beforeCallback) {
@@ -3626,6 +3770,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
     ur_program_get_build_info_params_t params = {
         &hProgram, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urProgramGetBuildInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramGetBuildInfo"));
     if (beforeCallback) {
@@ -3673,6 +3819,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
     ur_program_set_specialization_constants_params_t params = {
         &hProgram, &count, &pSpecConstants};
 
+    d_context.simulator.call("urProgramSetSpecializationConstants");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urProgramSetSpecializationConstants"));
@@ -3721,6 +3869,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
     ur_program_get_native_handle_params_t params = {&hProgram,
                                                     &phNativeProgram};
 
+    d_context.simulator.call("urProgramGetNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramGetNativeHandle"));
     if (beforeCallback) {
@@ -3771,6 +3921,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
     ur_program_create_with_native_handle_params_t params = {
         &hNativeProgram, &hContext, &pProperties, &phProgram};
 
+    d_context.simulator.call("urProgramCreateWithNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urProgramCreateWithNativeHandle"));
@@ -3821,6 +3973,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
 
     ur_kernel_create_params_t params = {&hProgram, &pKernelName, &phKernel};
 
+    d_context.simulator.call("urKernelCreate");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelCreate"));
     if (beforeCallback) {
@@ -3872,6 +4026,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
     ur_kernel_set_arg_value_params_t params = {&hKernel, &argIndex, &argSize,
                                                &pProperties, &pArgValue};
 
+    d_context.simulator.call("urKernelSetArgValue");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelSetArgValue"));
     if (beforeCallback) {
@@ -3920,6 +4076,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
     ur_kernel_set_arg_local_params_t params = {&hKernel, &argIndex, &argSize,
                                                &pProperties};
 
+    d_context.simulator.call("urKernelSetArgLocal");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelSetArgLocal"));
     if (beforeCallback) {
@@ -3975,6 +4133,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
     ur_kernel_get_info_params_t params = {&hKernel, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urKernelGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelGetInfo"));
     if (beforeCallback) {
@@ -4028,6 +4188,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
     ur_kernel_get_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urKernelGetGroupInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelGetGroupInfo"));
     if (beforeCallback) {
@@ -4081,6 +4243,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
     ur_kernel_get_sub_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urKernelGetSubGroupInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelGetSubGroupInfo"));
     if (beforeCallback) {
@@ -4123,6 +4287,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
 
     ur_kernel_retain_params_t params = {&hKernel};
 
+    d_context.simulator.call("urKernelRetain");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelRetain"));
     if (beforeCallback) {
@@ -4167,6 +4333,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
 
     ur_kernel_release_params_t params = {&hKernel};
 
+    d_context.simulator.call("urKernelRelease");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelRelease"));
     if (beforeCallback) {
@@ -4217,6 +4385,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
     ur_kernel_set_arg_pointer_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &pArgValue};
 
+    d_context.simulator.call("urKernelSetArgPointer");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelSetArgPointer"));
     if (beforeCallback) {
@@ -4267,6 +4437,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
     ur_kernel_set_exec_info_params_t params = {&hKernel, &propName, &propSize,
                                                &pProperties, &pPropValue};
 
+    d_context.simulator.call("urKernelSetExecInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelSetExecInfo"));
     if (beforeCallback) {
@@ -4314,6 +4486,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
     ur_kernel_set_arg_sampler_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &hArgValue};
 
+    d_context.simulator.call("urKernelSetArgSampler");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelSetArgSampler"));
     if (beforeCallback) {
@@ -4361,6 +4535,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
     ur_kernel_set_arg_mem_obj_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &hArgValue};
 
+    d_context.simulator.call("urKernelSetArgMemObj");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelSetArgMemObj"));
     if (beforeCallback) {
@@ -4407,6 +4583,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     ur_kernel_set_specialization_constants_params_t params = {&hKernel, &count,
                                                               &pSpecConstants};
 
+    d_context.simulator.call("urKernelSetSpecializationConstants");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urKernelSetSpecializationConstants"));
@@ -4454,6 +4632,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
 
     ur_kernel_get_native_handle_params_t params = {&hKernel, &phNativeKernel};
 
+    d_context.simulator.call("urKernelGetNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urKernelGetNativeHandle"));
     if (beforeCallback) {
@@ -4506,6 +4686,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
     ur_kernel_create_with_native_handle_params_t params = {
         &hNativeKernel, &hContext, &hProgram, &pProperties, &phKernel};
 
+    d_context.simulator.call("urKernelCreateWithNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urKernelCreateWithNativeHandle"));
@@ -4569,6 +4751,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         &hKernel,           &hQueue,          &numWorkDim,
         &pGlobalWorkOffset, &pGlobalWorkSize, &pSuggestedLocalWorkSize};
 
+    d_context.simulator.call("urKernelGetSuggestedLocalWorkSize");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urKernelGetSuggestedLocalWorkSize"));
@@ -4623,6 +4807,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
     ur_queue_get_info_params_t params = {&hQueue, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urQueueGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urQueueGetInfo"));
     if (beforeCallback) {
@@ -4671,6 +4857,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
     ur_queue_create_params_t params = {&hContext, &hDevice, &pProperties,
                                        &phQueue};
 
+    d_context.simulator.call("urQueueCreate");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urQueueCreate"));
     if (beforeCallback) {
@@ -4715,6 +4903,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
 
     ur_queue_retain_params_t params = {&hQueue};
 
+    d_context.simulator.call("urQueueRetain");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urQueueRetain"));
     if (beforeCallback) {
@@ -4759,6 +4949,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
 
     ur_queue_release_params_t params = {&hQueue};
 
+    d_context.simulator.call("urQueueRelease");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urQueueRelease"));
     if (beforeCallback) {
@@ -4807,6 +4999,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
     ur_queue_get_native_handle_params_t params = {&hQueue, &pDesc,
                                                   &phNativeQueue};
 
+    d_context.simulator.call("urQueueGetNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urQueueGetNativeHandle"));
     if (beforeCallback) {
@@ -4858,6 +5052,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
     ur_queue_create_with_native_handle_params_t params = {
         &hNativeQueue, &hContext, &hDevice, &pProperties, &phQueue};
 
+    d_context.simulator.call("urQueueCreateWithNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urQueueCreateWithNativeHandle"));
@@ -4905,6 +5101,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
 
     ur_queue_finish_params_t params = {&hQueue};
 
+    d_context.simulator.call("urQueueFinish");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urQueueFinish"));
     if (beforeCallback) {
@@ -4947,6 +5145,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
 
     ur_queue_flush_params_t params = {&hQueue};
 
+    d_context.simulator.call("urQueueFlush");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urQueueFlush"));
     if (beforeCallback) {
@@ -4996,6 +5196,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
     ur_event_get_info_params_t params = {&hEvent, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urEventGetInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEventGetInfo"));
     if (beforeCallback) {
@@ -5048,6 +5250,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
     ur_event_get_profiling_info_params_t params = {
         &hEvent, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urEventGetProfilingInfo");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEventGetProfilingInfo"));
     if (beforeCallback) {
@@ -5093,6 +5297,8 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
 
     ur_event_wait_params_t params = {&numEvents, &phEventWaitList};
 
+    d_context.simulator.call("urEventWait");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEventWait"));
     if (beforeCallback) {
@@ -5135,6 +5341,8 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
 
     ur_event_retain_params_t params = {&hEvent};
 
+    d_context.simulator.call("urEventRetain");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEventRetain"));
     if (beforeCallback) {
@@ -5178,6 +5386,8 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
 
     ur_event_release_params_t params = {&hEvent};
 
+    d_context.simulator.call("urEventRelease");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEventRelease"));
     if (beforeCallback) {
@@ -5223,6 +5433,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
 
     ur_event_get_native_handle_params_t params = {&hEvent, &phNativeEvent};
 
+    d_context.simulator.call("urEventGetNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEventGetNativeHandle"));
     if (beforeCallback) {
@@ -5273,6 +5485,8 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
     ur_event_create_with_native_handle_params_t params = {
         &hNativeEvent, &hContext, &pProperties, &phEvent};
 
+    d_context.simulator.call("urEventCreateWithNativeHandle");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urEventCreateWithNativeHandle"));
@@ -5325,6 +5539,8 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
     ur_event_set_callback_params_t params = {&hEvent, &execStatus, &pfnNotify,
                                              &pUserData};
 
+    d_context.simulator.call("urEventSetCallback");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEventSetCallback"));
     if (beforeCallback) {
@@ -5401,6 +5617,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
                                                 &phEventWaitList,
                                                 &phEvent};
 
+    d_context.simulator.call("urEnqueueKernelLaunch");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueKernelLaunch"));
     if (beforeCallback) {
@@ -5427,6 +5645,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueKernelLaunch", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueKernelLaunch"));
     if (afterCallback) {
@@ -5458,6 +5680,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
     ur_enqueue_events_wait_params_t params = {&hQueue, &numEventsInWaitList,
                                               &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueEventsWait");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueEventsWait"));
     if (beforeCallback) {
@@ -5484,6 +5708,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueEventsWait", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueEventsWait"));
     if (afterCallback) {
@@ -5515,6 +5743,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     ur_enqueue_events_wait_with_barrier_params_t params = {
         &hQueue, &numEventsInWaitList, &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueEventsWaitWithBarrier");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urEnqueueEventsWaitWithBarrier"));
@@ -5543,6 +5773,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueEventsWaitWithBarrier", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback(
             "urEnqueueEventsWaitWithBarrier"));
@@ -5582,6 +5816,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         &size,   &pDst,    &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
+    d_context.simulator.call("urEnqueueMemBufferRead");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueMemBufferRead"));
     if (beforeCallback) {
@@ -5608,6 +5844,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemBufferRead", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blockingRead);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemBufferRead"));
     if (afterCallback) {
@@ -5648,6 +5888,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         &size,   &pSrc,    &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
+    d_context.simulator.call("urEnqueueMemBufferWrite");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueMemBufferWrite"));
     if (beforeCallback) {
@@ -5674,6 +5916,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemBufferWrite", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blockingWrite);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemBufferWrite"));
     if (afterCallback) {
@@ -5734,6 +5980,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
                                                        &phEventWaitList,
                                                        &phEvent};
 
+    d_context.simulator.call("urEnqueueMemBufferReadRect");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueMemBufferReadRect"));
     if (beforeCallback) {
@@ -5761,6 +6009,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemBufferReadRect", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blockingRead);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemBufferReadRect"));
     if (afterCallback) {
@@ -5824,6 +6076,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
                                                         &phEventWaitList,
                                                         &phEvent};
 
+    d_context.simulator.call("urEnqueueMemBufferWriteRect");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urEnqueueMemBufferWriteRect"));
@@ -5852,6 +6106,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemBufferWriteRect", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blockingWrite);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemBufferWriteRect"));
     if (afterCallback) {
@@ -5890,6 +6148,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         &hQueue, &hBufferSrc,          &hBufferDst,      &srcOffset, &dstOffset,
         &size,   &numEventsInWaitList, &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueMemBufferCopy");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueMemBufferCopy"));
     if (beforeCallback) {
@@ -5916,6 +6176,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemBufferCopy", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemBufferCopy"));
     if (afterCallback) {
@@ -5965,6 +6229,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         &dstRowPitch, &dstSlicePitch, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
+    d_context.simulator.call("urEnqueueMemBufferCopyRect");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueMemBufferCopyRect"));
     if (beforeCallback) {
@@ -5992,6 +6258,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemBufferCopyRect", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemBufferCopyRect"));
     if (afterCallback) {
@@ -6035,6 +6305,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
                                                   &phEventWaitList,
                                                   &phEvent};
 
+    d_context.simulator.call("urEnqueueMemBufferFill");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueMemBufferFill"));
     if (beforeCallback) {
@@ -6061,6 +6333,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemBufferFill", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemBufferFill"));
     if (afterCallback) {
@@ -6105,6 +6381,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         &slicePitch,      &pDst,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueMemImageRead");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueMemImageRead"));
     if (beforeCallback) {
@@ -6131,6 +6409,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemImageRead", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blockingRead);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemImageRead"));
     if (afterCallback) {
@@ -6176,6 +6458,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         &slicePitch,      &pSrc,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueMemImageWrite");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueMemImageWrite"));
     if (beforeCallback) {
@@ -6202,6 +6486,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemImageWrite", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blockingWrite);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemImageWrite"));
     if (afterCallback) {
@@ -6246,6 +6534,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         &hQueue, &hImageSrc,           &hImageDst,       &srcOrigin, &dstOrigin,
         &region, &numEventsInWaitList, &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueMemImageCopy");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueMemImageCopy"));
     if (beforeCallback) {
@@ -6272,6 +6562,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemImageCopy", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemImageCopy"));
     if (afterCallback) {
@@ -6312,6 +6606,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         &offset,  &size,    &numEventsInWaitList, &phEventWaitList,
         &phEvent, &ppRetMap};
 
+    d_context.simulator.call("urEnqueueMemBufferMap");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueMemBufferMap"));
     if (beforeCallback) {
@@ -6341,6 +6637,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemBufferMap", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blockingMap);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemBufferMap"));
     if (afterCallback) {
@@ -6375,6 +6675,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         &hQueue,          &hMem,   &pMappedPtr, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueMemUnmap");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueMemUnmap"));
     if (beforeCallback) {
@@ -6401,6 +6703,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueMemUnmap", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueMemUnmap"));
     if (afterCallback) {
@@ -6441,6 +6747,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         &pPattern,        &size,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueUSMFill");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueUSMFill"));
     if (beforeCallback) {
@@ -6467,6 +6775,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueUSMFill", hQueue, numEventsInWaitList,
+                                phEventWaitList, phEvent, false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueUSMFill"));
     if (afterCallback) {
@@ -6504,6 +6815,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         &hQueue,          &blocking, &pDst, &pSrc, &size, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueUSMMemcpy");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueUSMMemcpy"));
     if (beforeCallback) {
@@ -6530,6 +6843,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueUSMMemcpy", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blocking);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueUSMMemcpy"));
     if (afterCallback) {
@@ -6565,6 +6882,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         &hQueue,          &pMem,   &size, &flags, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueUSMPrefetch");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueUSMPrefetch"));
     if (beforeCallback) {
@@ -6591,6 +6910,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueUSMPrefetch", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueUSMPrefetch"));
     if (afterCallback) {
@@ -6619,6 +6942,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
     ur_enqueue_usm_advise_params_t params = {&hQueue, &pMem, &size, &advice,
                                              &phEvent};
 
+    d_context.simulator.call("urEnqueueUSMAdvise");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueUSMAdvise"));
     if (beforeCallback) {
@@ -6645,6 +6970,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueUSMAdvise", hQueue, 0, nullptr,
+                                phEvent, false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueUSMAdvise"));
     if (afterCallback) {
@@ -6690,6 +7018,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         &pPattern,        &width,  &height, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueUSMFill2D");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueUSMFill2D"));
     if (beforeCallback) {
@@ -6716,6 +7046,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueUSMFill2D", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueUSMFill2D"));
     if (afterCallback) {
@@ -6761,6 +7095,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         &width,           &height,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueUSMMemcpy2D");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueUSMMemcpy2D"));
     if (beforeCallback) {
@@ -6787,6 +7123,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueUSMMemcpy2D", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blocking);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueUSMMemcpy2D"));
     if (afterCallback) {
@@ -6828,6 +7168,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         &count,           &offset,   &pSrc, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueDeviceGlobalVariableWrite");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urEnqueueDeviceGlobalVariableWrite"));
@@ -6856,6 +7198,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueDeviceGlobalVariableWrite", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blockingWrite);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback(
             "urEnqueueDeviceGlobalVariableWrite"));
@@ -6898,6 +7244,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         &count,           &offset,   &pDst, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueDeviceGlobalVariableRead");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urEnqueueDeviceGlobalVariableRead"));
@@ -6926,6 +7274,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueDeviceGlobalVariableRead", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blockingRead);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback(
             "urEnqueueDeviceGlobalVariableRead"));
@@ -6972,6 +7324,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         &pDst,   &size,     &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
+    d_context.simulator.call("urEnqueueReadHostPipe");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueReadHostPipe"));
     if (beforeCallback) {
@@ -6998,6 +7352,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueReadHostPipe", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blocking);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueReadHostPipe"));
     if (afterCallback) {
@@ -7043,6 +7401,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         &pSrc,   &size,     &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
+    d_context.simulator.call("urEnqueueWriteHostPipe");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urEnqueueWriteHostPipe"));
     if (beforeCallback) {
@@ -7069,6 +7429,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueWriteHostPipe", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blocking);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urEnqueueWriteHostPipe"));
     if (afterCallback) {
@@ -7103,6 +7467,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         &hContext, &hDevice,          &pUSMDesc, &pool,        &widthInBytes,
         &height,   &elementSizeBytes, &ppMem,    &pResultPitch};
 
+    d_context.simulator.call("urUSMPitchedAllocExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMPitchedAllocExp"));
     if (beforeCallback) {
@@ -7151,6 +7517,8 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
     ur_bindless_images_unsampled_image_handle_destroy_exp_params_t params = {
         &hContext, &hDevice, &hImage};
 
+    d_context.simulator.call("urBindlessImagesUnsampledImageHandleDestroyExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesUnsampledImageHandleDestroyExp"));
@@ -7202,6 +7570,8 @@ urBindlessImagesSampledImageHandleDestroyExp(
     ur_bindless_images_sampled_image_handle_destroy_exp_params_t params = {
         &hContext, &hDevice, &hImage};
 
+    d_context.simulator.call("urBindlessImagesSampledImageHandleDestroyExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesSampledImageHandleDestroyExp"));
@@ -7255,6 +7625,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
     ur_bindless_images_image_allocate_exp_params_t params = {
         &hContext, &hDevice, &pImageFormat, &pImageDesc, &phImageMem};
 
+    d_context.simulator.call("urBindlessImagesImageAllocateExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesImageAllocateExp"));
@@ -7306,6 +7678,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
     ur_bindless_images_image_free_exp_params_t params = {&hContext, &hDevice,
                                                          &hImageMem};
 
+    d_context.simulator.call("urBindlessImagesImageFreeExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesImageFreeExp"));
@@ -7361,6 +7735,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
     ur_bindless_images_unsampled_image_create_exp_params_t params = {
         &hContext, &hDevice, &hImageMem, &pImageFormat, &pImageDesc, &phImage};
 
+    d_context.simulator.call("urBindlessImagesUnsampledImageCreateExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesUnsampledImageCreateExp"));
@@ -7418,6 +7794,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         &hContext,   &hDevice,  &hImageMem, &pImageFormat,
         &pImageDesc, &hSampler, &phImage};
 
+    d_context.simulator.call("urBindlessImagesSampledImageCreateExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesSampledImageCreateExp"));
@@ -7498,6 +7876,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
                                                          &phEventWaitList,
                                                          &phEvent};
 
+    d_context.simulator.call("urBindlessImagesImageCopyExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesImageCopyExp"));
@@ -7526,6 +7906,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         return result;
     }
 
+    d_context.simulator.enqueue("urBindlessImagesImageCopyExp", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback(
             "urBindlessImagesImageCopyExp"));
@@ -7553,6 +7937,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
     ur_bindless_images_image_get_info_exp_params_t params = {
         &hContext, &hImageMem, &propName, &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urBindlessImagesImageGetInfoExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesImageGetInfoExp"));
@@ -7605,6 +7991,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
     ur_bindless_images_mipmap_get_level_exp_params_t params = {
         &hContext, &hDevice, &hImageMem, &mipmapLevel, &phImageMem};
 
+    d_context.simulator.call("urBindlessImagesMipmapGetLevelExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesMipmapGetLevelExp"));
@@ -7656,6 +8044,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
     ur_bindless_images_mipmap_free_exp_params_t params = {&hContext, &hDevice,
                                                           &hMem};
 
+    d_context.simulator.call("urBindlessImagesMipmapFreeExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesMipmapFreeExp"));
@@ -7712,6 +8102,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         &hContext,      &hDevice,          &size,
         &memHandleType, &pExternalMemDesc, &phExternalMem};
 
+    d_context.simulator.call("urBindlessImagesImportExternalMemoryExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesImportExternalMemoryExp"));
@@ -7769,6 +8161,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         &hContext,   &hDevice,      &pImageFormat,
         &pImageDesc, &hExternalMem, &phImageMem};
 
+    d_context.simulator.call("urBindlessImagesMapExternalArrayExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesMapExternalArrayExp"));
@@ -7823,6 +8217,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
     ur_bindless_images_map_external_linear_memory_exp_params_t params = {
         &hContext, &hDevice, &offset, &size, &hExternalMem, &ppRetMem};
 
+    d_context.simulator.call("urBindlessImagesMapExternalLinearMemoryExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesMapExternalLinearMemoryExp"));
@@ -7872,6 +8268,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
     ur_bindless_images_release_external_memory_exp_params_t params = {
         &hContext, &hDevice, &hExternalMem};
 
+    d_context.simulator.call("urBindlessImagesReleaseExternalMemoryExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesReleaseExternalMemoryExp"));
@@ -7927,6 +8325,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         &hContext, &hDevice, &semHandleType, &pExternalSemaphoreDesc,
         &phExternalSemaphore};
 
+    d_context.simulator.call("urBindlessImagesImportExternalSemaphoreExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesImportExternalSemaphoreExp"));
@@ -7978,6 +8378,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
     ur_bindless_images_release_external_semaphore_exp_params_t params = {
         &hContext, &hDevice, &hExternalSemaphore};
 
+    d_context.simulator.call("urBindlessImagesReleaseExternalSemaphoreExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesReleaseExternalSemaphoreExp"));
@@ -8045,6 +8447,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         &waitValue, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
+    d_context.simulator.call("urBindlessImagesWaitExternalSemaphoreExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesWaitExternalSemaphoreExp"));
@@ -8073,6 +8477,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         return result;
     }
 
+    d_context.simulator.enqueue("urBindlessImagesWaitExternalSemaphoreExp",
+                                hQueue, numEventsInWaitList, phEventWaitList,
+                                phEvent, false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback(
             "urBindlessImagesWaitExternalSemaphoreExp"));
@@ -8115,6 +8523,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         &signalValue, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
+    d_context.simulator.call("urBindlessImagesSignalExternalSemaphoreExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urBindlessImagesSignalExternalSemaphoreExp"));
@@ -8143,6 +8553,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         return result;
     }
 
+    d_context.simulator.enqueue("urBindlessImagesSignalExternalSemaphoreExp",
+                                hQueue, numEventsInWaitList, phEventWaitList,
+                                phEvent, false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback(
             "urBindlessImagesSignalExternalSemaphoreExp"));
@@ -8170,6 +8584,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
     ur_command_buffer_create_exp_params_t params = {
         &hContext, &hDevice, &pCommandBufferDesc, &phCommandBuffer};
 
+    d_context.simulator.call("urCommandBufferCreateExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urCommandBufferCreateExp"));
     if (beforeCallback) {
@@ -8215,6 +8631,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
 
     ur_command_buffer_retain_exp_params_t params = {&hCommandBuffer};
 
+    d_context.simulator.call("urCommandBufferRetainExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urCommandBufferRetainExp"));
     if (beforeCallback) {
@@ -8259,6 +8677,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
 
     ur_command_buffer_release_exp_params_t params = {&hCommandBuffer};
 
+    d_context.simulator.call("urCommandBufferReleaseExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urCommandBufferReleaseExp"));
     if (beforeCallback) {
@@ -8303,6 +8723,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
 
     ur_command_buffer_finalize_exp_params_t params = {&hCommandBuffer};
 
+    d_context.simulator.call("urCommandBufferFinalizeExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urCommandBufferFinalizeExp"));
     if (beforeCallback) {
@@ -8387,6 +8809,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         &pSyncPoint,
         &phCommand};
 
+    d_context.simulator.call("urCommandBufferAppendKernelLaunchExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendKernelLaunchExp"));
@@ -8450,6 +8874,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         &hCommandBuffer,     &pDst,      &pSrc, &size, &numSyncPointsInWaitList,
         &pSyncPointWaitList, &pSyncPoint};
 
+    d_context.simulator.call("urCommandBufferAppendUSMMemcpyExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendUSMMemcpyExp"));
@@ -8511,6 +8937,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         &patternSize,        &size,      &numSyncPointsInWaitList,
         &pSyncPointWaitList, &pSyncPoint};
 
+    d_context.simulator.call("urCommandBufferAppendUSMFillExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendUSMFillExp"));
@@ -8578,6 +9006,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         &pSyncPointWaitList,
         &pSyncPoint};
 
+    d_context.simulator.call("urCommandBufferAppendMemBufferCopyExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendMemBufferCopyExp"));
@@ -8644,6 +9074,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         &pSyncPointWaitList,
         &pSyncPoint};
 
+    d_context.simulator.call("urCommandBufferAppendMemBufferWriteExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendMemBufferWriteExp"));
@@ -8709,6 +9141,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         &pSyncPointWaitList,
         &pSyncPoint};
 
+    d_context.simulator.call("urCommandBufferAppendMemBufferReadExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendMemBufferReadExp"));
@@ -8787,6 +9221,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         &pSyncPointWaitList,
         &pSyncPoint};
 
+    d_context.simulator.call("urCommandBufferAppendMemBufferCopyRectExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendMemBufferCopyRectExp"));
@@ -8871,6 +9307,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         &pSyncPointWaitList,
         &pSyncPoint};
 
+    d_context.simulator.call("urCommandBufferAppendMemBufferWriteRectExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendMemBufferWriteRectExp"));
@@ -8953,6 +9391,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         &pSyncPointWaitList,
         &pSyncPoint};
 
+    d_context.simulator.call("urCommandBufferAppendMemBufferReadRectExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendMemBufferReadRectExp"));
@@ -9021,6 +9461,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         &pSyncPointWaitList,
         &pSyncPoint};
 
+    d_context.simulator.call("urCommandBufferAppendMemBufferFillExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendMemBufferFillExp"));
@@ -9084,6 +9526,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         &pSyncPointWaitList,
         &pSyncPoint};
 
+    d_context.simulator.call("urCommandBufferAppendUSMPrefetchExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendUSMPrefetchExp"));
@@ -9147,6 +9591,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         &pSyncPointWaitList,
         &pSyncPoint};
 
+    d_context.simulator.call("urCommandBufferAppendUSMAdviseExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferAppendUSMAdviseExp"));
@@ -9205,6 +9651,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         &hCommandBuffer, &hQueue, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
+    d_context.simulator.call("urCommandBufferEnqueueExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urCommandBufferEnqueueExp"));
     if (beforeCallback) {
@@ -9231,6 +9679,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         return result;
     }
 
+    d_context.simulator.enqueue("urCommandBufferEnqueueExp", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback("urCommandBufferEnqueueExp"));
     if (afterCallback) {
@@ -9252,6 +9704,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
 
     ur_command_buffer_retain_command_exp_params_t params = {&hCommand};
 
+    d_context.simulator.call("urCommandBufferRetainCommandExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferRetainCommandExp"));
@@ -9299,6 +9753,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
 
     ur_command_buffer_release_command_exp_params_t params = {&hCommand};
 
+    d_context.simulator.call("urCommandBufferReleaseCommandExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferReleaseCommandExp"));
@@ -9349,6 +9805,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
     ur_command_buffer_update_kernel_launch_exp_params_t params = {
         &hCommand, &pUpdateKernelLaunch};
 
+    d_context.simulator.call("urCommandBufferUpdateKernelLaunchExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferUpdateKernelLaunchExp"));
@@ -9405,6 +9863,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
     ur_command_buffer_get_info_exp_params_t params = {
         &hCommandBuffer, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urCommandBufferGetInfoExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urCommandBufferGetInfoExp"));
     if (beforeCallback) {
@@ -9458,6 +9918,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
     ur_command_buffer_command_get_info_exp_params_t params = {
         &hCommand, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urCommandBufferCommandGetInfoExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urCommandBufferCommandGetInfoExp"));
@@ -9538,6 +10000,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         &phEventWaitList,
         &phEvent};
 
+    d_context.simulator.call("urEnqueueCooperativeKernelLaunchExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urEnqueueCooperativeKernelLaunchExp"));
@@ -9566,6 +10030,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueCooperativeKernelLaunchExp", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback(
             "urEnqueueCooperativeKernelLaunchExp"));
@@ -9595,6 +10063,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     ur_kernel_suggest_max_cooperative_group_count_exp_params_t params = {
         &hKernel, &localWorkSize, &dynamicSharedMemorySize, &pGroupCountRet};
 
+    d_context.simulator.call("urKernelSuggestMaxCooperativeGroupCountExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urKernelSuggestMaxCooperativeGroupCountExp"));
@@ -9659,6 +10129,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     ur_enqueue_timestamp_recording_exp_params_t params = {
         &hQueue, &blocking, &numEventsInWaitList, &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueTimestampRecordingExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urEnqueueTimestampRecordingExp"));
@@ -9684,6 +10156,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueTimestampRecordingExp", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                blocking);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback(
             "urEnqueueTimestampRecordingExp"));
@@ -9735,6 +10211,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         &launchPropList,  &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
+    d_context.simulator.call("urEnqueueKernelLaunchCustomExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urEnqueueKernelLaunchCustomExp"));
@@ -9759,6 +10237,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         return result;
     }
 
+    d_context.simulator.enqueue("urEnqueueKernelLaunchCustomExp", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_after_callback(
             "urEnqueueKernelLaunchCustomExp"));
@@ -9786,6 +10268,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
     ur_program_build_exp_params_t params = {&hProgram, &numDevices, &phDevices,
                                             &pOptions};
 
+    d_context.simulator.call("urProgramBuildExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramBuildExp"));
     if (beforeCallback) {
@@ -9835,6 +10319,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
     ur_program_compile_exp_params_t params = {&hProgram, &numDevices,
                                               &phDevices, &pOptions};
 
+    d_context.simulator.call("urProgramCompileExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramCompileExp"));
     if (beforeCallback) {
@@ -9892,6 +10378,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
                                            &count,    &phPrograms, &pOptions,
                                            &phProgram};
 
+    d_context.simulator.call("urProgramLinkExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urProgramLinkExp"));
     if (beforeCallback) {
@@ -9937,6 +10425,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
 
     ur_usm_import_exp_params_t params = {&hContext, &pMem, &size};
 
+    d_context.simulator.call("urUSMImportExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMImportExp"));
     if (beforeCallback) {
@@ -9980,6 +10470,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
 
     ur_usm_release_exp_params_t params = {&hContext, &pMem};
 
+    d_context.simulator.call("urUSMReleaseExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback("urUSMReleaseExp"));
     if (beforeCallback) {
@@ -10025,6 +10517,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
     ur_usm_p2p_enable_peer_access_exp_params_t params = {&commandDevice,
                                                          &peerDevice};
 
+    d_context.simulator.call("urUsmP2PEnablePeerAccessExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urUsmP2PEnablePeerAccessExp"));
@@ -10072,6 +10566,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
     ur_usm_p2p_disable_peer_access_exp_params_t params = {&commandDevice,
                                                           &peerDevice};
 
+    d_context.simulator.call("urUsmP2PDisablePeerAccessExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urUsmP2PDisablePeerAccessExp"));
@@ -10132,6 +10628,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
         &commandDevice, &peerDevice, &propName,
         &propSize,      &pPropValue, &pPropSizeRet};
 
+    d_context.simulator.call("urUsmP2PPeerAccessGetInfoExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
         mock::getCallbacks().get_before_callback(
             "urUsmP2PPeerAccessGetInfoExp"));
@@ -10168,6 +10666,54 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
     return exceptionToResult(std::current_exception());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMPoolTrimExp
+__urdlllocal ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM pool to trim, NULL trims every pool of hContext
+    size_t minBytesToKeep ///< [in] number of cached bytes each pool may keep
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_usm_pool_trim_exp_params_t params = {&hContext, &hPool,
+                                            &minBytesToKeep};
+
+    d_context.simulator.call("urUSMPoolTrimExp");
+
+    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_before_callback("urUSMPoolTrimExp"));
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_replace_callback("urUSMPoolTrimExp"));
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_after_callback("urUSMPoolTrimExp"));
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urEnqueueNativeCommandExp
 __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
@@ -10205,8 +10751,410 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
                                                      &phEventWaitList,
                                                      &phEvent};
 
+    d_context.simulator.call("urEnqueueNativeCommandExp");
+
+    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_before_callback("urEnqueueNativeCommandExp"));
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_replace_callback("urEnqueueNativeCommandExp"));
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    d_context.simulator.enqueue("urEnqueueNativeCommandExp", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
+    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_after_callback("urEnqueueNativeCommandExp"));
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMDeviceAllocExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the allocation.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    void **ppMem, ///< [out] pointer to USM device memory object
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_enqueue_usm_device_alloc_exp_params_t params = {&hQueue,
+                                                       &size,
+                                                       &numEventsInWaitList,
+                                                       &phEventWaitList,
+                                                       &ppMem,
+                                                       &phEvent};
+
+    d_context.simulator.call("urEnqueueUSMDeviceAllocExp");
+
+    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_before_callback("urEnqueueUSMDeviceAllocExp"));
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_replace_callback(
+            "urEnqueueUSMDeviceAllocExp"));
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        *ppMem = mock::createDummyHandle<void *>(size);
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    d_context.simulator.enqueue("urEnqueueUSMDeviceAllocExp", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
+    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_after_callback("urEnqueueUSMDeviceAllocExp"));
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMFreeExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    void *
+        pMem, ///< [in] pointer to USM memory object allocated with
+              ///< ::urEnqueueUSMDeviceAllocExp
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the free.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_enqueue_usm_free_exp_params_t params = {
+        &hQueue, &pMem, &numEventsInWaitList, &phEventWaitList, &phEvent};
+
+    d_context.simulator.call("urEnqueueUSMFreeExp");
+
+    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_before_callback("urEnqueueUSMFreeExp"));
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_replace_callback("urEnqueueUSMFreeExp"));
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        mock::releaseDummyHandle(pMem);
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    d_context.simulator.enqueue("urEnqueueUSMFreeExp", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
+    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_after_callback("urEnqueueUSMFreeExp"));
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferCopyRectBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_mem_handle_t hBufferSrc, ///< [in] handle of the source buffer object
+    ur_mem_handle_t hBufferDst, ///< [in] handle of the dest buffer object
+    uint32_t numRegions, ///< [in] number of rectangular regions to copy
+    const ur_rect_offset_t *
+        pSrcOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the source
+                     ///< buffer
+    const ur_rect_offset_t *
+        pDstOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the
+                     ///< destination buffer
+    const ur_rect_region_t *
+        pRegions, ///< [in][range(0, numRegions)] 3D rectangular region descriptors: width,
+                  ///< height, depth
+    size_t
+        srcRowPitch, ///< [in] length of each row in bytes in the source buffer object
+    size_t
+        srcSlicePitch, ///< [in] length of each 2D slice in bytes in the source buffer object
+    size_t
+        dstRowPitch, ///< [in] length of each row in bytes in the destination buffer object
+    size_t
+        dstSlicePitch, ///< [in] length of each 2D slice in bytes in the destination buffer object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_enqueue_mem_buffer_copy_rect_batch_exp_params_t params = {
+        &hQueue,          &hBufferSrc,    &hBufferDst,
+        &numRegions,      &pSrcOrigins,   &pDstOrigins,
+        &pRegions,        &srcRowPitch,   &srcSlicePitch,
+        &dstRowPitch,     &dstSlicePitch, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+
+    d_context.simulator.call("urEnqueueMemBufferCopyRectBatchExp");
+
+    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_before_callback(
+            "urEnqueueMemBufferCopyRectBatchExp"));
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_replace_callback(
+            "urEnqueueMemBufferCopyRectBatchExp"));
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    d_context.simulator.enqueue("urEnqueueMemBufferCopyRectBatchExp", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
+    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_after_callback(
+            "urEnqueueMemBufferCopyRectBatchExp"));
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueKernelLaunchBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t numLaunches,     ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_desc_t *
+        pLaunches, ///< [in][range(0, numLaunches)] pointer to a list of kernel launch
+                   ///< descriptors
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernels execute.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the completion
+                ///< of all the launches.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_enqueue_kernel_launch_batch_exp_params_t params = {
+        &hQueue, &numLaunches, &pLaunches, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+
+    d_context.simulator.call("urEnqueueKernelLaunchBatchExp");
+
+    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_before_callback(
+            "urEnqueueKernelLaunchBatchExp"));
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_replace_callback(
+            "urEnqueueKernelLaunchBatchExp"));
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    d_context.simulator.enqueue("urEnqueueKernelLaunchBatchExp", hQueue,
+                                numEventsInWaitList, phEventWaitList, phEvent,
+                                false);
+
+    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_after_callback(
+            "urEnqueueKernelLaunchBatchExp"));
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelSetArgsExp
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments
+    const ur_exp_kernel_arg_properties_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to a list of kernel arguments
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_kernel_set_args_exp_params_t params = {&hKernel, &numArgs, &pArgs};
+
+    d_context.simulator.call("urKernelSetArgsExp");
+
+    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_before_callback("urKernelSetArgsExp"));
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_replace_callback("urKernelSetArgsExp"));
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_after_callback("urKernelSetArgsExp"));
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventWaitAnyExp
+__urdlllocal ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+    uint32_t *
+        pEventIndex ///< [out] index in phEventWaitList of an event which is complete
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_event_wait_any_exp_params_t params = {&numEvents, &phEventWaitList,
+                                             &pEventIndex};
+
+    d_context.simulator.call("urEventWaitAnyExp");
+
     auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueNativeCommandExp"));
+        mock::getCallbacks().get_before_callback("urEventWaitAnyExp"));
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10215,15 +11163,111 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     }
 
     auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueNativeCommandExp"));
+        mock::getCallbacks().get_replace_callback("urEventWaitAnyExp"));
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
 
-        // optional output handle
-        if (phEvent) {
-            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_after_callback("urEventWaitAnyExp"));
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventGetExecutionStatusExp
+__urdlllocal ur_result_t UR_APICALL urEventGetExecutionStatusExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEvents, ///< [in][range(0, numEvents)] pointer to a list of events to query
+    ur_event_status_t *
+        pStatuses ///< [out][range(0, numEvents)] execution status of each of the events of
+                  ///< phEvents
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_event_get_execution_status_exp_params_t params = {&numEvents, &phEvents,
+                                                         &pStatuses};
+
+    d_context.simulator.call("urEventGetExecutionStatusExp");
+
+    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_before_callback("urEventGetExecutionStatusExp"));
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_replace_callback("urEventGetExecutionStatusExp"));
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_after_callback("urEventGetExecutionStatusExp"));
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueReserveTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReserveTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t
+        capacity ///< [in] number of slots of the ring, the number of markers which can be
+    ///< enqueued before the first one is overwritten
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_queue_reserve_timestamp_markers_exp_params_t params = {&hQueue,
+                                                              &capacity};
+
+    d_context.simulator.call("urQueueReserveTimestampMarkersExp");
+
+    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_before_callback(
+            "urQueueReserveTimestampMarkersExp"));
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
         }
+    }
+
+    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_replace_callback(
+            "urQueueReserveTimestampMarkersExp"));
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
         result = UR_RESULT_SUCCESS;
     }
 
@@ -10232,7 +11276,118 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     }
 
     auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueNativeCommandExp"));
+        mock::getCallbacks().get_after_callback(
+            "urQueueReserveTimestampMarkersExp"));
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueTimestampMarkerExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the timestamp is written.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    uint64_t *pMarker ///< [out][optional] number of the marker
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_enqueue_timestamp_marker_exp_params_t params = {
+        &hQueue, &numEventsInWaitList, &phEventWaitList, &pMarker};
+
+    d_context.simulator.call("urEnqueueTimestampMarkerExp");
+
+    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_before_callback(
+            "urEnqueueTimestampMarkerExp"));
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_replace_callback(
+            "urEnqueueTimestampMarkerExp"));
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    d_context.simulator.enqueue("urEnqueueTimestampMarkerExp", hQueue,
+                                numEventsInWaitList, phEventWaitList, nullptr,
+                                false);
+
+    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_after_callback("urEnqueueTimestampMarkerExp"));
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueReadTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReadTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint64_t firstMarker,     ///< [in] number of the first marker to read
+    uint32_t count,           ///< [in] number of markers to read
+    uint64_t *
+        pTimestamps ///< [out][range(0, count)] timestamps in nanoseconds of the markers
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_queue_read_timestamp_markers_exp_params_t params = {
+        &hQueue, &firstMarker, &count, &pTimestamps};
+
+    d_context.simulator.call("urQueueReadTimestampMarkersExp");
+
+    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_before_callback(
+            "urQueueReadTimestampMarkersExp"));
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_replace_callback(
+            "urQueueReadTimestampMarkersExp"));
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
+        mock::getCallbacks().get_after_callback(
+            "urQueueReadTimestampMarkersExp"));
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10604,6 +11759,17 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
 
     pDdiTable->pfnNativeCommandExp = driver::urEnqueueNativeCommandExp;
 
+    pDdiTable->pfnUSMDeviceAllocExp = driver::urEnqueueUSMDeviceAllocExp;
+
+    pDdiTable->pfnUSMFreeExp = driver::urEnqueueUSMFreeExp;
+
+    pDdiTable->pfnMemBufferCopyRectBatchExp =
+        driver::urEnqueueMemBufferCopyRectBatchExp;
+
+    pDdiTable->pfnKernelLaunchBatchExp = driver::urEnqueueKernelLaunchBatchExp;
+
+    pDdiTable->pfnTimestampMarkerExp = driver::urEnqueueTimestampMarkerExp;
+
     return result;
 } catch (...) {
     return exceptionToResult(std::current_exception());
@@ -10654,6 +11820,38 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
     return exceptionToResult(std::current_exception());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EventExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_event_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+    ) try {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (driver::d_context.version < version) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnWaitAnyExp = driver::urEventWaitAnyExp;
+
+    pDdiTable->pfnGetExecutionStatusExp = driver::urEventGetExecutionStatusExp;
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Kernel table
 ///        with current process' addresses
@@ -10743,6 +11941,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
     pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
         driver::urKernelSuggestMaxCooperativeGroupCountExp;
 
+    pDdiTable->pfnSetArgsExp = driver::urKernelSetArgsExp;
+
     return result;
 } catch (...) {
     return exceptionToResult(std::current_exception());
@@ -11011,6 +12211,40 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
     return exceptionToResult(std::current_exception());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's QueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+    ) try {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (driver::d_context.version < version) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnReserveTimestampMarkersExp =
+        driver::urQueueReserveTimestampMarkersExp;
+
+    pDdiTable->pfnReadTimestampMarkersExp =
+        driver::urQueueReadTimestampMarkersExp;
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Sampler table
 ///        with current process' addresses
@@ -11127,6 +12361,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
 
     pDdiTable->pfnReleaseExp = driver::urUSMReleaseExp;
 
+    pDdiTable->pfnPoolTrimExp = driver::urUSMPoolTrimExp;
+
     return result;
 } catch (...) {
     return exceptionToResult(std::current_exception());
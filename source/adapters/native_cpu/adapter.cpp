@@ -10,14 +10,17 @@
 
 #include "common.hpp"
 #include "ur_api.h"
+#include "ur_interface_loader.hpp"
 
 struct ur_adapter_handle_t_ {
   std::atomic<uint32_t> RefCount = 0;
   logger::Logger &logger = logger::get_logger("native_cpu");
 } Adapter;
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterGet(
-    uint32_t, ur_adapter_handle_t *phAdapters, uint32_t *pNumAdapters) {
+namespace ur::native_cpu {
+
+ur_result_t urAdapterGet(uint32_t, ur_adapter_handle_t *phAdapters,
+                         uint32_t *pNumAdapters) {
   if (phAdapters) {
     Adapter.RefCount++;
     *phAdapters = &Adapter;
@@ -28,28 +31,26 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGet(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
+ur_result_t urAdapterRelease(ur_adapter_handle_t) {
   Adapter.RefCount--;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterRetain(ur_adapter_handle_t) {
+ur_result_t urAdapterRetain(ur_adapter_handle_t) {
   Adapter.RefCount++;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetLastError(
-    ur_adapter_handle_t, const char **ppMessage, int32_t *pError) {
+ur_result_t urAdapterGetLastError(ur_adapter_handle_t, const char **ppMessage,
+                                  int32_t *pError) {
   *ppMessage = ErrorMessage;
   *pError = ErrorMessageCode;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
-                                                     ur_adapter_info_t propName,
-                                                     size_t propSize,
-                                                     void *pPropValue,
-                                                     size_t *pPropSizeRet) {
+ur_result_t urAdapterGetInfo(ur_adapter_handle_t, ur_adapter_info_t propName,
+                             size_t propSize, void *pPropValue,
+                             size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   switch (propName) {
@@ -63,3 +64,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
 
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::native_cpu
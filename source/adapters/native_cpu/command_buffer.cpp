@@ -8,186 +8,564 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "command_buffer.hpp"
+#include "commands.hpp"
 #include "common.hpp"
+#include "memops.hpp"
+#include "memory.hpp"
+#include "queue.hpp"
+#include "ur_interface_loader.hpp"
 
-/// Stub implementations of UR experimental feature command-buffers
-/// Taken almost unchanged from another adapter. Perhaps going forward
-/// these stubs could be defined in core UR as the default which would
-/// reduce code duplication. Adapters could then "override" these defaults.
-/// Issue raised for this comment in
-/// https://github.com/oneapi-src/unified-runtime/issues/1064
-
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
-    ur_context_handle_t, ur_device_handle_t,
-    const ur_exp_command_buffer_desc_t *, ur_exp_command_buffer_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#include <cstring>
+#include <vector>
+
+using native_cpu::command_node_t;
+using native_cpu::memory_op_t;
+
+ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
+  if (lastEvent) {
+    decrementOrDelete(lastEvent);
+  }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferRetainExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ur_result_t ur_exp_command_buffer_handle_t_::checkAppend(
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList) const {
+  if (finalized) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+  UR_ASSERT(!numSyncPointsInWaitList == !pSyncPointWaitList,
+            UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP);
+  // The sync point of a command is its index
+  for (uint32_t i = 0; i < numSyncPointsInWaitList; i++) {
+    if (pSyncPointWaitList[i] >= nodes.size()) {
+      return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_EXP;
+    }
+  }
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ur_result_t ur_exp_command_buffer_handle_t_::append(
+    command_node_t &&node, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  if (auto result = checkAppend(numSyncPointsInWaitList, pSyncPointWaitList);
+      result != UR_RESULT_SUCCESS) {
+    return result;
+  }
+
+  auto index = static_cast<uint32_t>(nodes.size());
+  auto addDependency = [this, &node, index](uint32_t dependency) {
+    nodes[dependency].successors.push_back(index);
+    node.numDependencies++;
+  };
+  for (uint32_t i = 0; i < numSyncPointsInWaitList; i++) {
+    addDependency(pSyncPointWaitList[i]);
+  }
+  if (isInOrder && index > 0) {
+    addDependency(index - 1);
+  }
+  nodes.push_back(std::move(node));
+
+  if (pSyncPoint) {
+    *pSyncPoint = index;
+  }
+  if (phCommand) {
+    *phCommand = new ur_exp_command_buffer_command_handle_t_(this);
+  }
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ur_result_t ur_exp_command_buffer_handle_t_::finalize() {
+  if (finalized) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+  nodeTasks.reserve(nodes.size());
+  for (uint32_t i = 0; i < nodes.size(); i++) {
+    if (nodes[i].numDependencies == 0) {
+      roots.push_back(i);
+    }
+    nodeTasks.emplace_back(*this, i);
+  }
+  remaining = std::make_unique<std::atomic<uint32_t>[]>(nodes.size());
+  finalized = true;
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
-    ur_exp_command_buffer_handle_t, ur_kernel_handle_t, uint32_t,
-    const size_t *, const size_t *, const size_t *, uint32_t,
-    ur_kernel_handle_t *, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_command_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ur_result_t ur_exp_command_buffer_handle_t_::enqueue(
+    ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  if (!finalized) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  // The submission waits for the previous one, which uses the same state
+  std::vector<ur_event_handle_t> waitList(phEventWaitList,
+                                          phEventWaitList +
+                                              numEventsInWaitList);
+  if (lastEvent) {
+    waitList.push_back(lastEvent);
+  }
+
+  // The command holds a reference to the command buffer until it's complete
+  incrementReferenceCount();
+  ur_event_handle_t event = nullptr;
+  auto result = hQueue->enqueueCommand(
+      UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP,
+      static_cast<uint32_t>(waitList.size()), waitList.data(), &event,
+      [this](ur_event_handle_t event) { run(event); });
+  if (result != UR_RESULT_SUCCESS) {
+    decrementReferenceCount();
+    return result;
+  }
+
+  if (lastEvent) {
+    decrementOrDelete(lastEvent);
+  }
+  lastEvent = event;
+  if (phEvent) {
+    event->incrementReferenceCount();
+    *phEvent = event;
+  }
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
-    ur_exp_command_buffer_handle_t, void *, const void *, size_t, uint32_t,
-    const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+void ur_exp_command_buffer_handle_t_::run(ur_event_handle_t event) {
+  runEvent = event;
+  for (size_t i = 0; i < nodes.size(); i++) {
+    remaining[i].store(nodes[i].numDependencies, std::memory_order_relaxed);
+  }
+  // Held until all the roots are started, since the commands may all be done
+  // before that
+  nodesLeft.store(nodes.size() + 1, std::memory_order_relaxed);
+  for (auto root : roots) {
+    startNode(root);
+  }
+  countDown();
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_mem_handle_t, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+void ur_exp_command_buffer_handle_t_::startNode(uint32_t index) {
+  auto &node = nodes[index];
+  if (node.launch) {
+    node.launch->start([this, index] { completeNode(index); });
+  } else {
+    device->tp.schedule_task(&nodeTasks[index]);
+  }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_mem_handle_t,
-    ur_rect_offset_t, ur_rect_offset_t, ur_rect_region_t, size_t, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+void ur_exp_command_buffer_handle_t_::runNode(uint32_t index) {
+  auto &node = nodes[index];
+  if (node.op) {
+    node.op->start([this, index] { completeNode(index); });
+  } else {
+    completeNode(index);
+  }
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, size_t, size_t,
-    const void *, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+void ur_exp_command_buffer_handle_t_::completeNode(uint32_t index) {
+  for (auto successor : nodes[index].successors) {
+    if (remaining[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      startNode(successor);
+    }
+  }
+  countDown();
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+void ur_exp_command_buffer_handle_t_::countDown() {
+  if (nodesLeft.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+    return;
+  }
+  ur_event_handle_t event = runEvent;
+  // The next submission holds its own reference
+  decrementOrDelete(this);
+  event->queue->completeCommand(event);
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_rect_offset_t,
-    ur_rect_offset_t, ur_rect_region_t, size_t, size_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+// Appends a memory_op_t running f(begin, end, nonTemporal) over [0, size)
+template <typename F>
+static ur_result_t
+appendMemoryOp(ur_exp_command_buffer_handle_t hCommandBuffer, size_t size,
+               size_t granularity, F &&f, uint32_t numSyncPointsInWaitList,
+               const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+               ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  command_node_t node;
+  node.op = std::make_unique<memory_op_t>(hCommandBuffer->device->tp, size,
+                                          granularity, std::forward<F>(f));
+  return hCommandBuffer->append(std::move(node), numSyncPointsInWaitList,
+                                pSyncPointWaitList, pSyncPoint, nullptr);
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_rect_offset_t,
-    ur_rect_offset_t, ur_rect_region_t, size_t, size_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+static ur_result_t
+appendCopy(ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst,
+           const void *pSrc, size_t size, uint32_t numSyncPointsInWaitList,
+           const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+           ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  auto *dst = static_cast<char *>(pDst);
+  auto *src = static_cast<const char *>(pSrc);
+  if (dst < src + size && src < dst + size) {
+    // Overlapping copies can't be split
+    return appendMemoryOp(
+        hCommandBuffer, size, size,
+        [dst, src](size_t begin, size_t end, bool) {
+          if (dst != src) {
+            std::memmove(dst + begin, src + begin, end - begin);
+          }
+        },
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+  }
+  return appendMemoryOp(
+      hCommandBuffer, size, native_cpu::memops::chunkGranularity,
+      [dst, src](size_t begin, size_t end, bool) {
+        native_cpu::memops::copy(dst + begin, src + begin, end - begin);
+      },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
-    ur_exp_command_buffer_handle_t, ur_queue_handle_t, uint32_t,
-    const ur_event_handle_t *, ur_event_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+static ur_result_t
+appendFill(ur_exp_command_buffer_handle_t hCommandBuffer, void *ptr,
+           const void *pPattern, size_t patternSize, size_t size,
+           uint32_t numSyncPointsInWaitList,
+           const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+           ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE);
+  std::vector<uint8_t> pattern(static_cast<const uint8_t *>(pPattern),
+                               static_cast<const uint8_t *>(pPattern) +
+                                   patternSize);
+  auto *out = static_cast<uint8_t *>(ptr);
+  // Chunks start on a copy of the pattern
+  return appendMemoryOp(
+      hCommandBuffer, size, patternSize * native_cpu::memops::chunkGranularity,
+      [out, pattern = std::move(pattern)](size_t begin, size_t end,
+                                          bool nonTemporal) {
+        native_cpu::memops::fill(out + begin, end - begin, pattern.data(),
+                                 pattern.size(), nonTemporal);
+      },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, const void *, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+// Appends a copy of region from src to dst, split by slices
+static ur_result_t
+appendCopyRect(ur_exp_command_buffer_handle_t hCommandBuffer, char *dst,
+               ur_rect_offset_t dstOrigin, size_t dstRowPitch,
+               size_t dstSlicePitch, const char *src,
+               ur_rect_offset_t srcOrigin, size_t srcRowPitch,
+               size_t srcSlicePitch, ur_rect_region_t region,
+               uint32_t numSyncPointsInWaitList,
+               const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+               ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  if (srcRowPitch == 0)
+    srcRowPitch = region.width;
+  if (srcSlicePitch == 0)
+    srcSlicePitch = srcRowPitch * region.height;
+  if (dstRowPitch == 0)
+    dstRowPitch = region.width;
+  if (dstSlicePitch == 0)
+    dstSlicePitch = dstRowPitch * region.height;
+  size_t sliceSize = region.width * region.height;
+  if (sliceSize == 0) {
+    UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+    return hCommandBuffer->append(command_node_t{}, numSyncPointsInWaitList,
+                                  pSyncPointWaitList, pSyncPoint, nullptr);
+  }
+  return appendMemoryOp(
+      hCommandBuffer, sliceSize * region.depth, sliceSize,
+      [=](size_t begin, size_t end, bool) {
+        for (size_t d = begin / sliceSize; d < end / sliceSize; d++) {
+          for (size_t h = 0; h < region.height; h++) {
+            size_t srcOffset = (d + srcOrigin.z) * srcSlicePitch +
+                               (h + srcOrigin.y) * srcRowPitch + srcOrigin.x;
+            size_t dstOffset = (d + dstOrigin.z) * dstSlicePitch +
+                               (h + dstOrigin.y) * dstRowPitch + dstOrigin.x;
+            std::memmove(dst + dstOffset, src + srcOffset, region.width);
+          }
+        }
+      },
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
-    ur_exp_command_buffer_handle_t, void *, const void *, size_t, size_t,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+namespace ur::native_cpu {
+
+ur_result_t
+urCommandBufferCreateExp(ur_context_handle_t hContext,
+                         ur_device_handle_t hDevice,
+                         const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
+                         ur_exp_command_buffer_handle_t *phCommandBuffer) {
+  UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  // Commands can't be updated once recorded
+  if (pCommandBufferDesc && pCommandBufferDesc->isUpdatable) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+  bool isInOrder = pCommandBufferDesc && pCommandBufferDesc->isInOrder;
+  *phCommandBuffer =
+      new ur_exp_command_buffer_handle_t_(hContext, hDevice, isInOrder);
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
-    ur_exp_command_buffer_handle_t, const void *, size_t,
-    ur_usm_migration_flags_t, uint32_t,
-    const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ur_result_t
+urCommandBufferRetainExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  hCommandBuffer->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
-    ur_exp_command_buffer_handle_t, const void *, size_t, ur_usm_advice_flags_t,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    ur_exp_command_buffer_sync_point_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ur_result_t
+urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  decrementOrDelete(hCommandBuffer);
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferRetainCommandExp(ur_exp_command_buffer_command_handle_t) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ur_result_t
+urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  return hCommandBuffer->finalize();
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferReleaseCommandExp(ur_exp_command_buffer_command_handle_t) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ur_result_t urCommandBufferAppendKernelLaunchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_kernel_handle_t hKernel,
+    uint32_t workDim, const size_t *pGlobalWorkOffset,
+    const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
+    uint32_t numKernelAlternatives, ur_kernel_handle_t *phKernelAlternatives,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  // Kernel alternatives are only used to update commands
+  std::ignore = numKernelAlternatives;
+  std::ignore = phKernelAlternatives;
+
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pGlobalWorkSize, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+
+  if (*pGlobalWorkSize == 0) {
+    DIE_NO_IMPLEMENTATION;
+  }
+
+  if (auto result =
+          ::native_cpu::checkLocalSize(hKernel, workDim, pLocalWorkSize);
+      result != UR_RESULT_SUCCESS) {
+    return result;
+  }
+  // Checked before the launch takes the arguments of the kernel
+  if (auto result = hCommandBuffer->checkAppend(numSyncPointsInWaitList,
+                                                pSyncPointWaitList);
+      result != UR_RESULT_SUCCESS) {
+    return result;
+  }
+
+  // The work groups are split into tasks once, for all the submissions
+  ::native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
+                           pLocalWorkSize);
+  command_node_t node;
+  node.launch = std::make_unique<::native_cpu::kernel_launch_t>(
+      hCommandBuffer->device->tp, hKernel, ndr);
+  return hCommandBuffer->append(std::move(node), numSyncPointsInWaitList,
+                                pSyncPointWaitList, pSyncPoint, phCommand);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
+ur_result_t urCommandBufferAppendUSMMemcpyExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst, const void *pSrc,
+    size_t size, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  return appendCopy(hCommandBuffer, pDst, pSrc, size, numSyncPointsInWaitList,
+                    pSyncPointWaitList, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendMemBufferCopyExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
+    ur_mem_handle_t hDstMem, size_t srcOffset, size_t dstOffset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  return appendCopy(hCommandBuffer, hDstMem->_mem + dstOffset,
+                    hSrcMem->_mem + srcOffset, size, numSyncPointsInWaitList,
+                    pSyncPointWaitList, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendMemBufferCopyRectExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
+    ur_mem_handle_t hDstMem, ur_rect_offset_t srcOrigin,
+    ur_rect_offset_t dstOrigin, ur_rect_region_t region, size_t srcRowPitch,
+    size_t srcSlicePitch, size_t dstRowPitch, size_t dstSlicePitch,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  return appendCopyRect(hCommandBuffer, hDstMem->_mem, dstOrigin, dstRowPitch,
+                        dstSlicePitch, hSrcMem->_mem, srcOrigin, srcRowPitch,
+                        srcSlicePitch, region, numSyncPointsInWaitList,
+                        pSyncPointWaitList, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendMemBufferWriteExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, const void *pSrc,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  return appendCopy(hCommandBuffer, hBuffer->_mem + offset, pSrc, size,
+                    numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendMemBufferReadExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, void *pDst, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  return appendCopy(hCommandBuffer, pDst, hBuffer->_mem + offset, size,
+                    numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendMemBufferWriteRectExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
+    ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
+    size_t hostRowPitch, size_t hostSlicePitch, void *pSrc,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  return appendCopyRect(hCommandBuffer, hBuffer->_mem, bufferOffset,
+                        bufferRowPitch, bufferSlicePitch,
+                        static_cast<const char *>(pSrc), hostOffset,
+                        hostRowPitch, hostSlicePitch, region,
+                        numSyncPointsInWaitList, pSyncPointWaitList,
+                        pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendMemBufferReadRectExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
+    ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
+    size_t hostRowPitch, size_t hostSlicePitch, void *pDst,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  return appendCopyRect(hCommandBuffer, static_cast<char *>(pDst), hostOffset,
+                        hostRowPitch, hostSlicePitch, hBuffer->_mem,
+                        bufferOffset, bufferRowPitch, bufferSlicePitch, region,
+                        numSyncPointsInWaitList, pSyncPointWaitList,
+                        pSyncPoint);
+}
+
+ur_result_t urCommandBufferEnqueueExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  return hCommandBuffer->enqueue(hQueue, numEventsInWaitList, phEventWaitList,
+                                 phEvent);
+}
+
+ur_result_t urCommandBufferAppendMemBufferFillExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    const void *pPattern, size_t patternSize, size_t offset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE);
+  return appendFill(hCommandBuffer, hBuffer->_mem + offset, pPattern,
+                    patternSize, size / patternSize * patternSize,
+                    numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendUSMFillExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pMemory,
+    const void *pPattern, size_t patternSize, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  UR_ASSERT(pMemory, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(size % patternSize == 0, UR_RESULT_ERROR_INVALID_SIZE);
+  return appendFill(hCommandBuffer, pMemory, pPattern, patternSize, size,
+                    numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendUSMPrefetchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_migration_flags_t flags,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::ignore = pMemory;
+  std::ignore = size;
+  std::ignore = flags;
+
+  // USM lives in host memory, the command only orders the others
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  return hCommandBuffer->append(command_node_t{}, numSyncPointsInWaitList,
+                                pSyncPointWaitList, pSyncPoint, nullptr);
+}
+
+ur_result_t urCommandBufferAppendUSMAdviseExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_advice_flags_t advice, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::ignore = pMemory;
+  std::ignore = size;
+  std::ignore = advice;
+
+  UR_ASSERT(hCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  return hCommandBuffer->append(command_node_t{}, numSyncPointsInWaitList,
+                                pSyncPointWaitList, pSyncPoint, nullptr);
+}
+
+ur_result_t urCommandBufferRetainCommandExp(
+    ur_exp_command_buffer_command_handle_t hCommand) {
+  hCommand->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urCommandBufferReleaseCommandExp(
+    ur_exp_command_buffer_command_handle_t hCommand) {
+  decrementOrDelete(hCommand);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urCommandBufferUpdateKernelLaunchExp(
     ur_exp_command_buffer_command_handle_t,
     const ur_exp_command_buffer_update_kernel_launch_desc_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferGetInfoExp(
-    ur_exp_command_buffer_handle_t, ur_exp_command_buffer_info_t, size_t,
-    void *, size_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ur_result_t
+urCommandBufferGetInfoExp(ur_exp_command_buffer_handle_t hCommandBuffer,
+                          ur_exp_command_buffer_info_t propName,
+                          size_t propSize, void *pPropValue,
+                          size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_INFO_REFERENCE_COUNT:
+    return ReturnValue(hCommandBuffer->getReferenceCount());
+  default:
+    break;
+  }
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
-    ur_exp_command_buffer_command_handle_t,
-    ur_exp_command_buffer_command_info_t, size_t, void *, size_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+ur_result_t urCommandBufferCommandGetInfoExp(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    ur_exp_command_buffer_command_info_t propName, size_t propSize,
+    void *pPropValue, size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_COMMAND_INFO_REFERENCE_COUNT:
+    return ReturnValue(hCommand->getReferenceCount());
+  default:
+    break;
+  }
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
+} // namespace ur::native_cpu
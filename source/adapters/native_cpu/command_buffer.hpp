@@ -0,0 +1,121 @@
+//===--------- command_buffer.hpp - Native CPU Adapter --------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "commands.hpp"
+#include "common.hpp"
+#include "device.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace native_cpu {
+// A command recorded in a command buffer, and the commands waiting for it.
+// Commands with neither a launch nor an op, e.g. prefetches, only order the
+// others.
+struct command_node_t {
+  std::unique_ptr<kernel_launch_t> launch;
+  std::unique_ptr<memory_op_t> op;
+  uint32_t numDependencies = 0;
+  std::vector<uint32_t> successors;
+};
+} // namespace native_cpu
+
+// A graph of commands, split into tasks when they are appended. Enqueueing it
+// is a single command of the queue, which runs each command of the graph on
+// the thread pool as soon as the ones it depends on are done. Submissions of
+// the same command buffer run one after the other, since they share the
+// state of the graph.
+struct ur_exp_command_buffer_handle_t_ : RefCounted {
+  ur_exp_command_buffer_handle_t_(ur_context_handle_t context,
+                                  ur_device_handle_t device, bool isInOrder)
+      : context(context), device(device), isInOrder(isInOrder) {}
+
+  ~ur_exp_command_buffer_handle_t_();
+
+  // Checks that commands can be appended with the wait list
+  ur_result_t checkAppend(
+      uint32_t numSyncPointsInWaitList,
+      const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList) const;
+
+  // Appends node, depending on the sync points of the wait list, and on the
+  // previous command for in-order command buffers
+  ur_result_t
+  append(native_cpu::command_node_t &&node, uint32_t numSyncPointsInWaitList,
+         const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+         ur_exp_command_buffer_sync_point_t *pSyncPoint,
+         ur_exp_command_buffer_command_handle_t *phCommand);
+
+  ur_result_t finalize();
+
+  ur_result_t enqueue(ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+                      const ur_event_handle_t *phEventWaitList,
+                      ur_event_handle_t *phEvent);
+
+  ur_context_handle_t const context;
+  ur_device_handle_t const device;
+  const bool isInOrder;
+
+private:
+  // Runs a command which isn't a kernel launch on a worker, so that chains
+  // of small commands, which run inline, don't recurse
+  class node_task_t final : public native_cpu::detail::task_t {
+  public:
+    node_task_t(ur_exp_command_buffer_handle_t_ &commandBuffer,
+                uint32_t index)
+        : commandBuffer(commandBuffer), index(index) {}
+
+    void run(size_t) noexcept override { commandBuffer.runNode(index); }
+
+  private:
+    ur_exp_command_buffer_handle_t_ &commandBuffer;
+    const uint32_t index;
+  };
+
+  // Runs the graph, completing event once all the commands are done
+  void run(ur_event_handle_t event);
+  void startNode(uint32_t index);
+  void runNode(uint32_t index);
+  void completeNode(uint32_t index);
+  // Counts down a command, or the hold of run() while it starts the roots
+  void countDown();
+
+  std::vector<native_cpu::command_node_t> nodes;
+  // Filled when finalized
+  std::vector<uint32_t> roots;
+  std::vector<node_task_t> nodeTasks;
+  bool finalized = false;
+
+  // The state of the running submission
+  std::unique_ptr<std::atomic<uint32_t>[]> remaining;
+  std::atomic<size_t> nodesLeft{0};
+  ur_event_handle_t runEvent = nullptr;
+
+  std::mutex mutex;
+  // The event of the last submission
+  ur_event_handle_t lastEvent = nullptr;
+};
+
+struct ur_exp_command_buffer_command_handle_t_ : RefCounted {
+  ur_exp_command_buffer_command_handle_t_(
+      ur_exp_command_buffer_handle_t commandBuffer)
+      : commandBuffer(commandBuffer) {
+    commandBuffer->incrementReferenceCount();
+  }
+
+  ~ur_exp_command_buffer_command_handle_t_() {
+    decrementOrDelete(commandBuffer);
+  }
+
+  ur_exp_command_buffer_handle_t const commandBuffer;
+};
@@ -0,0 +1,263 @@
+//===----------- commands.hpp - Native CPU Adapter ------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "common.hpp"
+#include "fibers.hpp"
+#include "kernel.hpp"
+#include "memops.hpp"
+#include "threadpool.hpp"
+#include "tiling.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <vector>
+
+// The commands run on the thread pool, either enqueued on a queue or
+// recorded in a command buffer. They are split into tasks when they are
+// created, and can be started again once they are done, so that a command
+// buffer pays for the split only once.
+
+namespace native_cpu {
+struct NDRDescT {
+  using RangeT = std::array<size_t, 3>;
+  uint32_t WorkDim;
+  RangeT GlobalOffset;
+  RangeT GlobalSize;
+  RangeT LocalSize;
+  NDRDescT(uint32_t WorkDim, const size_t *GlobalWorkOffset,
+           const size_t *GlobalWorkSize, const size_t *LocalWorkSize)
+      : WorkDim(WorkDim) {
+    for (uint32_t I = 0; I < WorkDim; I++) {
+      GlobalOffset[I] = GlobalWorkOffset[I];
+      GlobalSize[I] = GlobalWorkSize[I];
+      LocalSize[I] = LocalWorkSize ? LocalWorkSize[I] : 1;
+    }
+    for (uint32_t I = WorkDim; I < 3; I++) {
+      GlobalSize[I] = 1;
+      LocalSize[I] = LocalSize[0] ? 1 : 0;
+      GlobalOffset[I] = 0;
+    }
+  }
+
+  void dump(std::ostream &os) const {
+    os << "GlobalSize: " << GlobalSize[0] << " " << GlobalSize[1] << " "
+       << GlobalSize[2] << "\n";
+    os << "LocalSize: " << LocalSize[0] << " " << LocalSize[1] << " "
+       << LocalSize[2] << "\n";
+    os << "GlobalOffset: " << GlobalOffset[0] << " " << GlobalOffset[1] << " "
+       << GlobalOffset[2] << "\n";
+  }
+};
+
+// Checks the local size of a launch against the constraints of the kernel
+ur_result_t checkLocalSize(ur_kernel_handle_t hKernel, uint32_t workDim,
+                           const size_t *pLocalWorkSize);
+
+class kernel_launch_t;
+
+// A batch of work groups of a kernel launch, run as one task on the thread
+// pool. The tasks of a launch are allocated together, and everything they
+// share is read from the launch.
+class kernel_task_t final : public detail::task_t {
+public:
+  enum class kind_t {
+    // Work groups [begin, end), numbered with dimension 0 varying fastest
+    groups,
+    // Every work item of every work group, one at a time
+    items,
+    // Work group begin of the range resized to one group per thread
+    resized,
+    // The work groups of tile begin of the launch
+    tile,
+    // Work groups [begin, end), each with its work items run as fibers
+    fibers,
+  };
+
+  kernel_task_t(kernel_launch_t &launch, kind_t kind, size_t begin,
+                size_t end, size_t node)
+      : launch(launch), kind(kind), begin(begin), end(end), node(node) {}
+
+  void run(size_t threadId) noexcept override;
+
+  kernel_launch_t &launch;
+  const kind_t kind;
+  const size_t begin;
+  const size_t end;
+  // The NUMA node the task is scheduled on
+  const size_t node;
+};
+
+// A kernel launch, with the arguments the kernel has when it's created. It's
+// immutable once split, apart from the per worker argument slots.
+class kernel_launch_t {
+public:
+  kernel_launch_t(threadpool_t &tp, ur_kernel_handle_t hKernel,
+                  const NDRDescT &ndr)
+      : hKernel(hKernel), ndr(ndr), tp(tp),
+#ifdef NATIVECPU_USE_OCK
+        numParallelThreads(tp.num_threads()),
+#else
+        numParallelThreads(1),
+#endif
+        numWG{ndr.GlobalSize[0] / ndr.LocalSize[0],
+              ndr.GlobalSize[1] / ndr.LocalSize[1],
+              ndr.GlobalSize[2] / ndr.LocalSize[2]},
+        baseState(ndr.GlobalSize[0], ndr.GlobalSize[1], ndr.GlobalSize[2],
+                  ndr.LocalSize[0], ndr.LocalSize[1], ndr.LocalSize[2],
+                  ndr.GlobalOffset[0], ndr.GlobalOffset[1],
+                  ndr.GlobalOffset[2]),
+        args(*hKernel, tp.num_threads()) {
+    hKernel->incrementReferenceCount();
+    split();
+  }
+
+  kernel_launch_t(const kernel_launch_t &) = delete;
+  kernel_launch_t &operator=(const kernel_launch_t &) = delete;
+
+  ~kernel_launch_t() { decrementOrDelete(hKernel); }
+
+  // Schedules the work groups on the thread pool. onDone runs on the worker
+  // finishing the last of them, and may destroy the launch.
+  void start(std::function<void()> onDone) {
+    done.add(1);
+    done.on_done([this, onDone = std::move(onDone)] {
+      for (auto &task : tasks) {
+        if (task.m_exception) {
+          logger::error("native_cpu: kernel {} failed", hKernel->_name);
+          break;
+        }
+      }
+      onDone();
+    });
+    for (auto &task : tasks) {
+      task.m_exception = nullptr;
+      task.m_latch = &done;
+      done.add(1);
+      tp.schedule_task(&task, task.node);
+    }
+    done.count_down();
+  }
+
+  // Runs the work groups of task on the worker threadId
+  void runTask(const kernel_task_t &task, size_t threadId);
+
+private:
+  // Splits the work groups into tasks
+  void split();
+
+  void addTask(kernel_task_t::kind_t kind, size_t begin, size_t end,
+               size_t node) {
+    tasks.emplace_back(*this, kind, begin, end, node);
+  }
+
+  // The NUMA node running task index of count, so that contiguous ranges of
+  // work groups, and the memory they touch first, stay on one node
+  size_t nodeOf(size_t index, size_t count) const {
+    size_t numNodes = tp.num_nodes();
+    return numNodes > 1 ? index * numNodes / count : any_node;
+  }
+
+  ur_kernel_handle_t hKernel;
+  const NDRDescT ndr;
+  threadpool_t &tp;
+  const size_t numParallelThreads;
+  const std::array<size_t, 3> numWG;
+  const native_cpu::state baseState;
+  // Work items per thread when the range is resized
+  size_t itemsPerThread = 0;
+  // How the work groups are tiled, for tile tasks
+  tiling_t tiling = {};
+  launch_args_t args;
+  // Not resized once split, the thread pool points to the tasks
+  std::vector<kernel_task_t> tasks;
+  completion_latch done;
+};
+
+// A copy or fill running f(begin, end, nonTemporal) over [0, size). Large
+// ones are split in chunks, multiples of granularity bytes, run by all the
+// workers. The chunks are spread across the NUMA nodes the same way as the
+// work groups of a kernel, so that the memory a command touches first is
+// placed on the node whose workers later run over it.
+class memory_op_t {
+public:
+  using function_t =
+      std::function<void(size_t begin, size_t end, bool nonTemporal)>;
+
+  memory_op_t(threadpool_t &tp, size_t size, size_t granularity,
+              function_t f)
+      : tp(tp), size(size), nonTemporal(size >= memops::nonTemporalThreshold),
+        f(std::move(f)) {
+    granularity = std::max<size_t>(granularity, 1);
+    size_t numUnits = (size + granularity - 1) / granularity;
+    size_t numChunks = std::min(tp.num_threads(), numUnits);
+    if (size < memops::parallelThreshold || numChunks <= 1) {
+      return;
+    }
+    size_t numNodes = tp.num_nodes();
+    chunks.reserve(numChunks);
+    for (size_t chunk = 0; chunk < numChunks; chunk++) {
+      size_t begin = numUnits * chunk / numChunks * granularity;
+      size_t end =
+          std::min(numUnits * (chunk + 1) / numChunks * granularity, size);
+      chunks.emplace_back(*this, begin, end,
+                          numNodes > 1 ? chunk * numNodes / numChunks
+                                       : any_node);
+    }
+  }
+
+  memory_op_t(const memory_op_t &) = delete;
+  memory_op_t &operator=(const memory_op_t &) = delete;
+
+  // Runs the chunks, onDone runs on the thread finishing the last of them
+  // and may destroy the op. Small ops run inline.
+  void start(std::function<void()> onDone) {
+    if (chunks.empty()) {
+      f(0, size, nonTemporal);
+      onDone();
+      return;
+    }
+    done.add(1);
+    done.on_done(std::move(onDone));
+    for (auto &chunk : chunks) {
+      chunk.m_latch = &done;
+      done.add(1);
+      tp.schedule_task(&chunk, chunk.node);
+    }
+    done.count_down();
+  }
+
+private:
+  class chunk_task_t final : public detail::task_t {
+  public:
+    chunk_task_t(memory_op_t &op, size_t begin, size_t end, size_t node)
+        : op(op), begin(begin), end(end), node(node) {}
+
+    void run(size_t) noexcept override { op.f(begin, end, op.nonTemporal); }
+
+    memory_op_t &op;
+    const size_t begin;
+    const size_t end;
+    const size_t node;
+  };
+
+  threadpool_t &tp;
+  const size_t size;
+  const bool nonTemporal;
+  function_t f;
+  std::vector<chunk_task_t> chunks;
+  completion_latch done;
+};
+} // namespace native_cpu
@@ -13,6 +13,8 @@
 #include "logger/ur_logger.hpp"
 #include "ur/ur.hpp"
 
+#include <chrono>
+
 constexpr size_t MaxMessageSize = 256;
 
 extern thread_local ur_result_t ErrorMessageCode;
@@ -70,3 +72,13 @@ template <typename T> inline void decrementOrDelete(T *refC) {
   if (refC->decrementReferenceCount() == 0)
     delete refC;
 }
+
+namespace native_cpu {
+// Nanoseconds of the steady clock, shared by the event profiling and the
+// device timestamps so that they can be compared
+inline uint64_t timestampNow() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+      .count();
+}
+} // namespace native_cpu
@@ -16,11 +16,21 @@
 
 #include "common.hpp"
 #include "context.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextCreate(
-    [[maybe_unused]] uint32_t DeviceCount, const ur_device_handle_t *phDevices,
-    const ur_context_properties_t *pProperties,
-    ur_context_handle_t *phContext) {
+ur_usm_pool_handle_t ur_context_handle_t_::getDefaultUSMPool() {
+  std::call_once(defaultPoolFlag, [this] {
+    defaultPool = std::make_unique<ur_usm_pool_handle_t_>(this, nullptr);
+  });
+  return defaultPool.get();
+}
+
+namespace ur::native_cpu {
+
+ur_result_t urContextCreate([[maybe_unused]] uint32_t DeviceCount,
+                            const ur_device_handle_t *phDevices,
+                            const ur_context_properties_t *pProperties,
+                            ur_context_handle_t *phContext) {
   std::ignore = pProperties;
   assert(DeviceCount == 1);
 
@@ -30,21 +40,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextCreate(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextRetain(ur_context_handle_t hContext) {
+ur_result_t urContextRetain(ur_context_handle_t hContext) {
   hContext->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextRelease(ur_context_handle_t hContext) {
+ur_result_t urContextRelease(ur_context_handle_t hContext) {
   decrementOrDelete(hContext);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
-                 size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urContextGetInfo(ur_context_handle_t hContext,
+                             ur_context_info_t propName, size_t propSize,
+                             void *pPropValue, size_t *pPropSizeRet) {
   UrReturnHelper returnValue(propSize, pPropValue, pPropSizeRet);
 
   switch (propName) {
@@ -71,14 +79,14 @@ urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextGetNativeHandle(
-    ur_context_handle_t hContext, ur_native_handle_t *phNativeContext) {
+ur_result_t urContextGetNativeHandle(ur_context_handle_t hContext,
+                                     ur_native_handle_t *phNativeContext) {
   std::ignore = hContext;
   std::ignore = phNativeContext;
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextCreateWithNativeHandle(
+ur_result_t urContextCreateWithNativeHandle(
     ur_native_handle_t hNativeContext, ur_adapter_handle_t hAdapter,
     uint32_t numDevices, const ur_device_handle_t *phDevices,
     const ur_context_native_properties_t *pProperties,
@@ -93,12 +101,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextCreateWithNativeHandle(
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextSetExtendedDeleter(
-    ur_context_handle_t hContext, ur_context_extended_deleter_t pfnDeleter,
-    void *pUserData) {
+ur_result_t
+urContextSetExtendedDeleter(ur_context_handle_t hContext,
+                            ur_context_extended_deleter_t pfnDeleter,
+                            void *pUserData) {
   std::ignore = hContext;
   std::ignore = pfnDeleter;
   std::ignore = pUserData;
 
   DIE_NO_IMPLEMENTATION
 }
+} // namespace ur::native_cpu
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <set>
 #include <ur_api.h>
@@ -17,6 +18,7 @@
 #include "common.hpp"
 #include "device.hpp"
 #include "ur/ur.hpp"
+#include "usm.hpp"
 
 namespace native_cpu {
 struct usm_alloc_info {
@@ -26,19 +28,21 @@ struct usm_alloc_info {
   ur_device_handle_t device;
   ur_usm_pool_handle_t pool;
 
-  // We store a pointer to the actual allocation because it is needed when
-  // freeing memory.
+  // We store a pointer to the actual allocation, and the UMF pool it comes
+  // from, because they are needed when freeing memory.
   void *base_alloc_ptr;
+  umf_memory_pool_handle_t umf_pool;
   constexpr usm_alloc_info(ur_usm_type_t type, const void *base_ptr,
                            size_t size, ur_device_handle_t device,
-                           ur_usm_pool_handle_t pool, void *base_alloc_ptr)
+                           ur_usm_pool_handle_t pool, void *base_alloc_ptr,
+                           umf_memory_pool_handle_t umf_pool)
       : type(type), base_ptr(base_ptr), size(size), device(device), pool(pool),
-        base_alloc_ptr(base_alloc_ptr) {}
+        base_alloc_ptr(base_alloc_ptr), umf_pool(umf_pool) {}
 };
 
 constexpr usm_alloc_info usm_alloc_info_null_entry(UR_USM_TYPE_UNKNOWN, nullptr,
                                                    0, nullptr, nullptr,
-                                                   nullptr);
+                                                   nullptr, nullptr);
 
 constexpr size_t alloc_header_size = sizeof(usm_alloc_info);
 
@@ -63,19 +67,12 @@ static size_t get_padding(uint32_t alignment) {
 // To satisfy the alignment requirements we "pad" the memory
 // allocation so that the pointer returned to the user
 // always satisfies (ptr % align) == 0.
-static inline void *malloc_impl(uint32_t alignment, size_t size) {
-  void *ptr = nullptr;
+static inline void *malloc_impl(umf_memory_pool_handle_t umf_pool,
+                                uint32_t alignment, size_t size) {
   assert(alignment >= alignof(usm_alloc_info) &&
          "memory not aligned to usm_alloc_info");
-#ifdef _MSC_VER
-  ptr = _aligned_malloc(alloc_header_size + get_padding(alignment) + size,
-                        alignment);
-
-#else
-  ptr = std::aligned_alloc(alignment,
-                           alloc_header_size + get_padding(alignment) + size);
-#endif
-  return ptr;
+  return umf::cachedAlignedMalloc(
+      umf_pool, alloc_header_size + get_padding(alignment) + size, alignment);
 }
 
 // The info struct is retrieved by subtracting its size from the pointer
@@ -96,17 +93,16 @@ struct ur_context_handle_t_ : RefCounted {
   ur_device_handle_t _device;
 
   ur_result_t remove_alloc(void *ptr) {
-    std::lock_guard<std::mutex> lock(alloc_mutex);
-    const native_cpu::usm_alloc_info &info = native_cpu::get_alloc_info(ptr);
+    const native_cpu::usm_alloc_info info = native_cpu::get_alloc_info(ptr);
     UR_ASSERT(info.type != UR_USM_TYPE_UNKNOWN,
               UR_RESULT_ERROR_INVALID_MEM_OBJECT);
-#ifdef _MSC_VER
-    _aligned_free(info.base_alloc_ptr);
-#else
-    free(info.base_alloc_ptr);
-#endif
-    allocations.erase(ptr);
-    return UR_RESULT_SUCCESS;
+    {
+      std::lock_guard<std::mutex> lock(alloc_mutex);
+      allocations.erase(ptr);
+    }
+    // The pools are thread safe, only the set of allocations needs the lock
+    return umf::umf2urResult(
+        umf::cachedFree(info.umf_pool, info.base_alloc_ptr));
   }
 
   // Note this is made non-const to access the mutex
@@ -120,14 +116,16 @@ struct ur_context_handle_t_ : RefCounted {
     return *(native_cpu::usm_alloc_info *)native_cpu::get_alloc_info_addr(ptr);
   }
 
+  // Allocates from umf_pool, which belongs to pool, nullptr for the default
+  // pool of the context
   void *add_alloc(uint32_t alignment, ur_usm_type_t type, size_t size,
-                  ur_usm_pool_handle_t pool) {
-    std::lock_guard<std::mutex> lock(alloc_mutex);
+                  ur_usm_pool_handle_t pool,
+                  umf_memory_pool_handle_t umf_pool) {
     // We need to ensure that we align to at least alignof(usm_alloc_info),
     // otherwise its start address may be unaligned.
     alignment =
         std::max<size_t>(alignment, alignof(native_cpu::usm_alloc_info));
-    void *alloc = native_cpu::malloc_impl(alignment, size);
+    void *alloc = native_cpu::malloc_impl(umf_pool, alignment, size);
     if (!alloc)
       return nullptr;
     // Compute the address of the pointer that we'll return to the user.
@@ -137,15 +135,22 @@ struct ur_context_handle_t_ : RefCounted {
     if (!info_addr)
       return nullptr;
     // Do a placement new of the alloc_info to avoid allocation and copy
-    auto info = new (info_addr)
-        native_cpu::usm_alloc_info(type, ptr, size, this->_device, pool, alloc);
+    auto info = new (info_addr) native_cpu::usm_alloc_info(
+        type, ptr, size, this->_device, pool, alloc, umf_pool);
     if (!info)
       return nullptr;
+    std::lock_guard<std::mutex> lock(alloc_mutex);
     allocations.insert(ptr);
     return ptr;
   }
 
+  // The pool of the allocations made without one, created on first use
+  ur_usm_pool_handle_t getDefaultUSMPool();
+
 private:
   std::mutex alloc_mutex;
   std::set<const void *> allocations;
+
+  std::once_flag defaultPoolFlag;
+  std::unique_ptr<ur_usm_pool_handle_t_> defaultPool;
 };
@@ -11,6 +11,9 @@
 #include <ur_api.h>
 
 #include "platform.hpp"
+#include "ur_interface_loader.hpp"
+
+#include <algorithm>
 
 #if defined(_MSC_VER) || defined(__MINGW32__) || defined(__MINGW64__)
 #ifndef NOMINMAX
@@ -78,11 +81,11 @@ static uint64_t os_memory_bounded_size() {
              : std::numeric_limits<size_t>::max();
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGet(ur_platform_handle_t hPlatform,
-                                                ur_device_type_t DeviceType,
-                                                uint32_t NumEntries,
-                                                ur_device_handle_t *phDevices,
-                                                uint32_t *pNumDevices) {
+namespace ur::native_cpu {
+
+ur_result_t urDeviceGet(ur_platform_handle_t hPlatform,
+                        ur_device_type_t DeviceType, uint32_t NumEntries,
+                        ur_device_handle_t *phDevices, uint32_t *pNumDevices) {
   UR_ASSERT(hPlatform, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
   const bool AskingForAll = DeviceType == UR_DEVICE_TYPE_ALL;
@@ -116,11 +119,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGet(ur_platform_handle_t hPlatform,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
-                                                    ur_device_info_t propName,
-                                                    size_t propSize,
-                                                    void *pPropValue,
-                                                    size_t *pPropSizeRet) {
+ur_result_t urDeviceGetInfo(ur_device_handle_t hDevice,
+                            ur_device_info_t propName, size_t propSize,
+                            void *pPropValue, size_t *pPropSizeRet) {
   UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
@@ -156,7 +157,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     // TODO : Populate return string accordingly - e.g. cl_khr_fp16,
     // cl_khr_fp64, cl_khr_int64_base_atomics,
     // cl_khr_int64_extended_atomics
-    return ReturnValue("cl_khr_fp16, cl_khr_fp64 ");
+    return ReturnValue("cl_khr_fp16, cl_khr_fp64 "
+                       UR_COMMAND_BUFFER_EXTENSION_STRING_EXP);
   case UR_DEVICE_INFO_VERSION:
     return ReturnValue("0.1");
   case UR_DEVICE_INFO_COMPILER_AVAILABLE:
@@ -304,9 +306,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     return ReturnValue(UR_DEVICE_LOCAL_MEM_TYPE_LOCAL);
   case UR_DEVICE_INFO_ERROR_CORRECTION_SUPPORT:
     return ReturnValue(bool{false});
-  case UR_DEVICE_INFO_PROFILING_TIMER_RESOLUTION:
-    // TODO : CHECK
-    return ReturnValue(size_t{0});
+  case UR_DEVICE_INFO_PROFILING_TIMER_RESOLUTION: {
+    // In nanoseconds, timestamps come from the steady clock of the host
+    using period = std::chrono::steady_clock::period;
+    return ReturnValue(
+        std::max<size_t>(1, period::num * 1000000000 / period::den));
+  }
   case UR_DEVICE_INFO_BUILT_IN_KERNELS:
     // TODO : CHECK
     return ReturnValue("");
@@ -400,13 +405,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     return ReturnValue(false);
 
   case UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP:
-    return ReturnValue(false);
+    return ReturnValue(true);
   case UR_DEVICE_INFO_COMMAND_BUFFER_UPDATE_CAPABILITIES_EXP:
     return ReturnValue(
         static_cast<ur_device_command_buffer_update_capability_flags_t>(0));
 
   case UR_DEVICE_INFO_TIMESTAMP_RECORDING_SUPPORT_EXP:
-    return ReturnValue(false);
+    return ReturnValue(true);
 
   case UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP:
     return ReturnValue(false);
@@ -417,44 +422,46 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceRetain(ur_device_handle_t hDevice) {
+ur_result_t urDeviceRetain(ur_device_handle_t hDevice) {
   UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE)
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urDeviceRelease(ur_device_handle_t hDevice) {
+ur_result_t urDeviceRelease(ur_device_handle_t hDevice) {
   UR_ASSERT(hDevice, UR_RESULT_ERROR_INVALID_NULL_HANDLE)
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDevicePartition(
-    ur_device_handle_t hDevice,
-    const ur_device_partition_properties_t *pProperties, uint32_t NumDevices,
-    ur_device_handle_t *phSubDevices, uint32_t *pNumDevicesRet) {
+ur_result_t
+urDevicePartition(ur_device_handle_t hDevice,
+                  const ur_device_partition_properties_t *pProperties,
+                  uint32_t NumDevices, ur_device_handle_t *phSubDevices,
+                  uint32_t *pNumDevicesRet) {
   std::ignore = hDevice;
   std::ignore = NumDevices;
   std::ignore = pProperties;
   std::ignore = phSubDevices;
   std::ignore = pNumDevicesRet;
 
-  DIE_NO_IMPLEMENTATION;
+  // Not logged, the USM pools query it for every pool they create
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetNativeHandle(
-    ur_device_handle_t hDevice, ur_native_handle_t *phNativeDevice) {
-  std::ignore = hDevice;
-  std::ignore = phNativeDevice;
-
-  DIE_NO_IMPLEMENTATION
+ur_result_t urDeviceGetNativeHandle(ur_device_handle_t hDevice,
+                                    ur_native_handle_t *phNativeDevice) {
+  // There's no native device, the handle identifies the device, e.g. for the
+  // USM pools
+  *phNativeDevice = reinterpret_cast<ur_native_handle_t>(hDevice);
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
-    ur_native_handle_t hNativeDevice, ur_adapter_handle_t hAdapter,
-    const ur_device_native_properties_t *pProperties,
-    ur_device_handle_t *phDevice) {
+ur_result_t
+urDeviceCreateWithNativeHandle(ur_native_handle_t hNativeDevice,
+                               ur_adapter_handle_t hAdapter,
+                               const ur_device_native_properties_t *pProperties,
+                               ur_device_handle_t *phDevice) {
   std::ignore = hNativeDevice;
   std::ignore = hAdapter;
   std::ignore = pProperties;
@@ -463,29 +470,25 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
-    ur_device_handle_t hDevice, uint64_t *pDeviceTimestamp,
-    uint64_t *pHostTimestamp) {
-  std::ignore = hDevice; // todo
+ur_result_t urDeviceGetGlobalTimestamps(ur_device_handle_t hDevice,
+                                        uint64_t *pDeviceTimestamp,
+                                        uint64_t *pHostTimestamp) {
+  std::ignore = hDevice;
+  // The device is the host, both use the clock of the event profiling
+  uint64_t now = ::native_cpu::timestampNow();
   if (pHostTimestamp) {
-    using namespace std::chrono;
-    *pHostTimestamp =
-        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
-            .count();
+    *pHostTimestamp = now;
   }
   if (pDeviceTimestamp) {
-    // todo: calculate elapsed time properly
-    using namespace std::chrono;
-    *pDeviceTimestamp =
-        duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
-            .count();
+    *pDeviceTimestamp = now;
   }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceSelectBinary(
-    ur_device_handle_t hDevice, const ur_device_binary_t *pBinaries,
-    uint32_t NumBinaries, uint32_t *pSelectedBinary) {
+ur_result_t urDeviceSelectBinary(ur_device_handle_t hDevice,
+                                 const ur_device_binary_t *pBinaries,
+                                 uint32_t NumBinaries,
+                                 uint32_t *pSelectedBinary) {
   std::ignore = hDevice;
   std::ignore = pBinaries;
   std::ignore = NumBinaries;
@@ -506,6 +509,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceSelectBinary(
   // No image can be loaded for the given device
   return UR_RESULT_ERROR_INVALID_BINARY;
 }
+} // namespace ur::native_cpu
 
 ur_device_handle_t_::ur_device_handle_t_(ur_platform_handle_t ArgPlt)
     : mem_size(os_memory_bounded_size()), Platform(ArgPlt) {}
@@ -8,48 +8,20 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <vector>
 
 #include "ur_api.h"
 
+#include "commands.hpp"
 #include "common.hpp"
 #include "kernel.hpp"
 #include "memory.hpp"
+#include "memops.hpp"
 #include "queue.hpp"
 #include "threadpool.hpp"
-
-namespace native_cpu {
-struct NDRDescT {
-  using RangeT = std::array<size_t, 3>;
-  uint32_t WorkDim;
-  RangeT GlobalOffset;
-  RangeT GlobalSize;
-  RangeT LocalSize;
-  NDRDescT(uint32_t WorkDim, const size_t *GlobalWorkOffset,
-           const size_t *GlobalWorkSize, const size_t *LocalWorkSize)
-      : WorkDim(WorkDim) {
-    for (uint32_t I = 0; I < WorkDim; I++) {
-      GlobalOffset[I] = GlobalWorkOffset[I];
-      GlobalSize[I] = GlobalWorkSize[I];
-      LocalSize[I] = LocalWorkSize ? LocalWorkSize[I] : 1;
-    }
-    for (uint32_t I = WorkDim; I < 3; I++) {
-      GlobalSize[I] = 1;
-      LocalSize[I] = LocalSize[0] ? 1 : 0;
-      GlobalOffset[I] = 0;
-    }
-  }
-
-  void dump(std::ostream &os) const {
-    os << "GlobalSize: " << GlobalSize[0] << " " << GlobalSize[1] << " "
-       << GlobalSize[2] << "\n";
-    os << "LocalSize: " << LocalSize[0] << " " << LocalSize[1] << " "
-       << LocalSize[2] << "\n";
-    os << "GlobalOffset: " << GlobalOffset[0] << " " << GlobalOffset[1] << " "
-       << GlobalOffset[2] << "\n";
-  }
-};
-} // namespace native_cpu
+#include "tiling.hpp"
+#include "ur_interface_loader.hpp"
 
 #ifdef NATIVECPU_USE_OCK
 static native_cpu::state getResizedState(const native_cpu::NDRDescT &ndr,
@@ -62,25 +34,9 @@ static native_cpu::state getResizedState(const native_cpu::NDRDescT &ndr,
 }
 #endif
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
-    ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
-    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
-    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
-  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
-  UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
-  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
-  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
-
-  if (*pGlobalWorkSize == 0) {
-    DIE_NO_IMPLEMENTATION;
-  }
-
+namespace native_cpu {
+ur_result_t checkLocalSize(ur_kernel_handle_t hKernel, uint32_t workDim,
+                           const size_t *pLocalWorkSize) {
   // Check reqd_work_group_size and other kernel constraints
   if (pLocalWorkSize != nullptr) {
     uint64_t TotalNumWIs = 1;
@@ -101,38 +57,121 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
       }
     }
   }
+  return UR_RESULT_SUCCESS;
+}
+
+void kernel_task_t::run(size_t threadId) noexcept {
+  try {
+    launch.runTask(*this, threadId);
+  } catch (...) {
+    m_exception = std::current_exception();
+  }
+}
 
-  // TODO: add proper error checking
-  // TODO: add proper event dep management
-  native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
-                           pLocalWorkSize);
-  auto &tp = hQueue->device->tp;
-  const size_t numParallelThreads = tp.num_threads();
-  hKernel->updateMemPool(numParallelThreads);
-  std::vector<std::future<void>> futures;
-  std::vector<std::function<void(size_t, ur_kernel_handle_t_)>> groups;
-  auto numWG0 = ndr.GlobalSize[0] / ndr.LocalSize[0];
-  auto numWG1 = ndr.GlobalSize[1] / ndr.LocalSize[1];
-  auto numWG2 = ndr.GlobalSize[2] / ndr.LocalSize[2];
-  native_cpu::state state(ndr.GlobalSize[0], ndr.GlobalSize[1],
-                          ndr.GlobalSize[2], ndr.LocalSize[0], ndr.LocalSize[1],
-                          ndr.LocalSize[2], ndr.GlobalOffset[0],
-                          ndr.GlobalOffset[1], ndr.GlobalOffset[2]);
-#ifndef NATIVECPU_USE_OCK
-  hKernel->handleLocalArgs(1, 0);
-  for (unsigned g2 = 0; g2 < numWG2; g2++) {
-    for (unsigned g1 = 0; g1 < numWG1; g1++) {
-      for (unsigned g0 = 0; g0 < numWG0; g0++) {
-        for (unsigned local2 = 0; local2 < ndr.LocalSize[2]; local2++) {
-          for (unsigned local1 = 0; local1 < ndr.LocalSize[1]; local1++) {
-            for (unsigned local0 = 0; local0 < ndr.LocalSize[0]; local0++) {
-              state.update(g0, g1, g2, local0, local1, local2);
-              hKernel->_subhandler(hKernel->_args.data(), &state);
+void kernel_launch_t::runTask(const kernel_task_t &task, size_t threadId) {
+  const NativeCPUArgDesc *kernelArgs = args.get(threadId);
+  native_cpu::state state = baseState;
+  switch (task.kind) {
+  case kernel_task_t::kind_t::groups:
+    for (size_t index = task.begin; index < task.end; index++) {
+      state.update(index % numWG[0], (index / numWG[0]) % numWG[1],
+                   index / (numWG[0] * numWG[1]));
+      hKernel->_subhandler(kernelArgs, &state);
+    }
+    break;
+  case kernel_task_t::kind_t::items:
+    for (unsigned g2 = 0; g2 < numWG[2]; g2++) {
+      for (unsigned g1 = 0; g1 < numWG[1]; g1++) {
+        for (unsigned g0 = 0; g0 < numWG[0]; g0++) {
+          for (unsigned local2 = 0; local2 < ndr.LocalSize[2]; local2++) {
+            for (unsigned local1 = 0; local1 < ndr.LocalSize[1]; local1++) {
+              for (unsigned local0 = 0; local0 < ndr.LocalSize[0]; local0++) {
+                state.update(g0, g1, g2, local0, local1, local2);
+                hKernel->_subhandler(kernelArgs, &state);
+              }
             }
           }
         }
       }
     }
+    break;
+  case kernel_task_t::kind_t::fibers: {
+#ifdef NATIVECPU_HAS_FIBERS
+    // Each work item keeps its own state across barriers
+    size_t numItems = ndr.LocalSize[0] * ndr.LocalSize[1] * ndr.LocalSize[2];
+    std::vector<native_cpu::state> states(numItems, baseState);
+    for (auto &itemState : states) {
+      itemState.MBarrier = [](native_cpu::state *) {
+        fiber_group_t::current().barrier();
+      };
+    }
+    auto &fibers = fiber_group_t::current();
+    for (size_t index = task.begin; index < task.end; index++) {
+      size_t g0 = index % numWG[0];
+      size_t g1 = (index / numWG[0]) % numWG[1];
+      size_t g2 = index / (numWG[0] * numWG[1]);
+      auto item = [&](size_t local) {
+        auto &itemState = states[local];
+        itemState.update(g0, g1, g2, local % ndr.LocalSize[0],
+                         (local / ndr.LocalSize[0]) % ndr.LocalSize[1],
+                         local / (ndr.LocalSize[0] * ndr.LocalSize[1]));
+        hKernel->_subhandler(kernelArgs, &itemState);
+      };
+      fibers.run(numItems, item);
+    }
+#endif
+    break;
+  }
+  case kernel_task_t::kind_t::resized: {
+#ifdef NATIVECPU_USE_OCK
+    native_cpu::state resized_state = getResizedState(ndr, itemsPerThread);
+    size_t index = task.begin;
+    resized_state.update(index % numParallelThreads,
+                         (index / numParallelThreads) % numWG[1],
+                         index / (numParallelThreads * numWG[1]));
+    hKernel->_subhandler(kernelArgs, &resized_state);
+#endif
+    break;
+  }
+  case kernel_task_t::kind_t::tile: {
+    auto origin = tiling.origin(task.begin);
+    std::array<size_t, 3> end;
+    for (unsigned dim = 0; dim < 3; dim++) {
+      end[dim] = std::min(origin[dim] + tiling.tileSize[dim], numWG[dim]);
+    }
+    for (size_t g2 = origin[2]; g2 < end[2]; g2++) {
+      for (size_t g1 = origin[1]; g1 < end[1]; g1++) {
+        for (size_t g0 = origin[0]; g0 < end[0]; g0++) {
+          state.update(g0, g1, g2);
+          hKernel->_subhandler(kernelArgs, &state);
+        }
+      }
+    }
+    break;
+  }
+  }
+}
+
+void kernel_launch_t::split() {
+  using kind_t = kernel_task_t::kind_t;
+  auto numWG0 = numWG[0];
+  auto numWG1 = numWG[1];
+  auto numWG2 = numWG[2];
+#ifndef NATIVECPU_USE_OCK
+  // The kernel runs one work item at a time. The work groups can run in
+  // parallel if their work items run as fibers, which is how they wait for
+  // each other at barriers.
+  if (!fibers_enabled()) {
+    addTask(kind_t::items, 0, 0, any_node);
+    return;
+  }
+  size_t numGroups = numWG0 * numWG1 * numWG2;
+  // A few tasks per worker, for the work stealing to even out the groups
+  size_t numTasks = std::min(numGroups, tp.num_threads() * 4);
+  tasks.reserve(numTasks);
+  for (size_t i = 0; i < numTasks; i++) {
+    addTask(kind_t::fibers, numGroups * i / numTasks,
+            numGroups * (i + 1) / numTasks, nodeOf(i, numTasks));
   }
 #else
   bool isLocalSizeOne =
@@ -153,26 +192,25 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     // size and peel everything else.
 
     size_t new_num_work_groups_0 = numParallelThreads;
-    size_t itemsPerThread = ndr.GlobalSize[0] / numParallelThreads;
-
-    for (unsigned g2 = 0; g2 < numWG2; g2++) {
-      for (unsigned g1 = 0; g1 < numWG1; g1++) {
-        for (unsigned g0 = 0; g0 < new_num_work_groups_0; g0 += 1) {
-          futures.emplace_back(
-              tp.schedule_task([&ndr = std::as_const(ndr), itemsPerThread,
-                                hKernel, g0, g1, g2](size_t) {
-                native_cpu::state resized_state =
-                    getResizedState(ndr, itemsPerThread);
-                resized_state.update(g0, g1, g2);
-                hKernel->_subhandler(hKernel->_args.data(), &resized_state);
-              }));
+    itemsPerThread = ndr.GlobalSize[0] / numParallelThreads;
+    size_t peelBegin = new_num_work_groups_0 * itemsPerThread;
+
+    tasks.reserve(numWG1 * numWG2 *
+                  (new_num_work_groups_0 + numWG0 - peelBegin));
+    for (size_t g2 = 0; g2 < numWG2; g2++) {
+      for (size_t g1 = 0; g1 < numWG1; g1++) {
+        size_t row = g2 * numWG1 + g1;
+        for (size_t g0 = 0; g0 < new_num_work_groups_0; g0 += 1) {
+          addTask(kind_t::resized, row * new_num_work_groups_0 + g0, 0,
+                  nodeOf(g0, new_num_work_groups_0));
         }
-        // Peel the remaining work items. Since the local size is 1, we iterate
-        // over the work groups.
-        for (unsigned g0 = new_num_work_groups_0 * itemsPerThread; g0 < numWG0;
-             g0++) {
-          state.update(g0, g1, g2);
-          hKernel->_subhandler(hKernel->_args.data(), &state);
+        // Peel the remaining work items, fewer than the threads. Since the
+        // local size is 1 they are work groups, one per task, so that the
+        // workers done with their resized group share them rather than one
+        // of them running the whole tail after the others.
+        for (size_t g0 = peelBegin; g0 < numWG0; g0++) {
+          addTask(kind_t::groups, row * numWG0 + g0, row * numWG0 + g0 + 1,
+                  nodeOf(new_num_work_groups_0 - 1, new_num_work_groups_0));
         }
       }
     }
@@ -180,107 +218,191 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
   } else {
     // We are running a parallel_for over an nd_range
 
-    if (numWG1 * numWG2 >= numParallelThreads) {
+    auto tileSize = tiling_t::tile_size_from_env();
+    bool isTilingDisabled = tileSize && (*tileSize)[0] == 0;
+    if ((numWG1 > 1 || numWG2 > 1) && !isTilingDisabled) {
+      // Neighbouring work groups of multi-dimensional ranges often share
+      // data, run them in tiles sized to the cache of a core
+      tiling = tiling_t::make(
+          numWG, {ndr.LocalSize[0], ndr.LocalSize[1], ndr.LocalSize[2]},
+          numParallelThreads, tiling_t::per_core_cache_size(), tileSize);
+      auto order = tiling.order();
+      tasks.reserve(order.size());
+      for (size_t i = 0; i < order.size(); i++) {
+        addTask(kind_t::tile, order[i], 0, nodeOf(i, order.size()));
+      }
+    } else if (numWG1 * numWG2 >= numParallelThreads) {
       // Dimensions 1 and 2 have enough work, split them across the threadpool
-      for (unsigned g2 = 0; g2 < numWG2; g2++) {
-        for (unsigned g1 = 0; g1 < numWG1; g1++) {
-          futures.emplace_back(
-              tp.schedule_task([state, kernel = *hKernel, numWG0, g1, g2,
-                                numParallelThreads](size_t threadId) mutable {
-                for (unsigned g0 = 0; g0 < numWG0; g0++) {
-                  kernel.handleLocalArgs(numParallelThreads, threadId);
-                  state.update(g0, g1, g2);
-                  kernel._subhandler(kernel._args.data(), &state);
-                }
-              }));
-        }
+      tasks.reserve(numWG1 * numWG2);
+      for (size_t row = 0; row < numWG1 * numWG2; row++) {
+        addTask(kind_t::groups, row * numWG0, (row + 1) * numWG0,
+                nodeOf(row, numWG1 * numWG2));
       }
     } else {
       // Split dimension 0 across the threadpool
       // Here we try to create groups of workgroups in order to reduce
-      // synchronization overhead
-      for (unsigned g2 = 0; g2 < numWG2; g2++) {
-        for (unsigned g1 = 0; g1 < numWG1; g1++) {
-          for (unsigned g0 = 0; g0 < numWG0; g0++) {
-            groups.push_back(
-                [state, g0, g1, g2, numParallelThreads](
-                    size_t threadId, ur_kernel_handle_t_ kernel) mutable {
-                  kernel.handleLocalArgs(numParallelThreads, threadId);
-                  state.update(g0, g1, g2);
-                  kernel._subhandler(kernel._args.data(), &state);
-                });
-          }
-        }
-      }
-      auto numGroups = groups.size();
+      // synchronization overhead. The work groups are numbered with dimension
+      // 0 varying fastest.
+      auto numGroups = numWG0 * numWG1 * numWG2;
       auto groupsPerThread = numGroups / numParallelThreads;
       auto remainder = numGroups % numParallelThreads;
-      for (unsigned thread = 0; thread < numParallelThreads; thread++) {
-        futures.emplace_back(tp.schedule_task(
-            [&groups, thread, groupsPerThread, hKernel](size_t threadId) {
-              for (unsigned i = 0; i < groupsPerThread; i++) {
-                auto index = thread * groupsPerThread + i;
-                groups[index](threadId, *hKernel);
-              }
-            }));
+      tasks.reserve(numParallelThreads + 1);
+      for (size_t thread = 0; thread < numParallelThreads; thread++) {
+        addTask(kind_t::groups, thread * groupsPerThread,
+                (thread + 1) * groupsPerThread,
+                nodeOf(thread, numParallelThreads));
       }
 
       // schedule the remaining tasks
       if (remainder) {
-        futures.emplace_back(
-            tp.schedule_task([&groups, remainder,
-                              scheduled = numParallelThreads * groupsPerThread,
-                              hKernel](size_t threadId) {
-              for (unsigned i = 0; i < remainder; i++) {
-                auto index = scheduled + i;
-                groups[index](threadId, *hKernel);
-              }
-            }));
+        size_t scheduled = numParallelThreads * groupsPerThread;
+        addTask(kind_t::groups, scheduled, scheduled + remainder,
+                nodeOf(numParallelThreads - 1, numParallelThreads));
       }
     }
   }
-
-  for (auto &f : futures)
-    f.get();
 #endif // NATIVECPU_USE_OCK
-  // TODO: we should avoid calling clear here by avoiding using push_back
-  // in setKernelArgs.
-  hKernel->_args.clear();
-  hKernel->_localArgInfo.clear();
-  return UR_RESULT_SUCCESS;
 }
+} // namespace native_cpu
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
-    ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+namespace ur::native_cpu {
+
+ur_result_t urEnqueueKernelLaunch(
+    ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
 
-  DIE_NO_IMPLEMENTATION;
+  if (*pGlobalWorkSize == 0) {
+    DIE_NO_IMPLEMENTATION;
+  }
+
+  if (auto result =
+          ::native_cpu::checkLocalSize(hKernel, workDim, pLocalWorkSize);
+      result != UR_RESULT_SUCCESS) {
+    return result;
+  }
+
+  // TODO: add proper error checking
+  ::native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
+                           pLocalWorkSize);
+  auto launch =
+      new ::native_cpu::kernel_launch_t(hQueue->device->tp, hKernel, ndr);
+  // The event is completed by the worker running the last work group
+  return hQueue->enqueueCommand(
+      UR_COMMAND_KERNEL_LAUNCH, numEventsInWaitList, phEventWaitList, phEvent,
+      [launch](ur_event_handle_t event) {
+        launch->start([launch, event] {
+          ur_queue_handle_t queue = event->queue;
+          delete launch;
+          queue->completeCommand(event);
+        });
+      });
+}
+} // namespace ur::native_cpu
+
+// Enqueues command, and waits for it if blocking
+static ur_result_t enqueueAndWait(ur_queue_handle_t hQueue, ur_command_t type,
+                                  bool blocking, uint32_t numEventsInWaitList,
+                                  const ur_event_handle_t *phEventWaitList,
+                                  ur_event_handle_t *phEvent,
+                                  native_cpu::command_t command,
+                                  bool isBarrier = false) {
+  ur_event_handle_t event = nullptr;
+  ur_event_handle_t *outEvent = (blocking || phEvent) ? &event : nullptr;
+  auto result =
+      hQueue->enqueueCommand(type, numEventsInWaitList, phEventWaitList,
+                             outEvent, std::move(command), isBarrier);
+  if (result != UR_RESULT_SUCCESS || !event) {
+    return result;
+  }
+  if (blocking) {
+    event->wait();
+  }
+  if (phEvent) {
+    *phEvent = event;
+  } else {
+    ur::native_cpu::urEventRelease(event);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+// Enqueues a command running f on the thread which completes its last
+// dependency, and waits for it if blocking
+template <typename F>
+static ur_result_t withQueue(ur_queue_handle_t hQueue, ur_command_t type,
+                             bool blocking, uint32_t numEventsInWaitList,
+                             const ur_event_handle_t *phEventWaitList,
+                             ur_event_handle_t *phEvent, F &&f,
+                             bool isBarrier = false) {
+  return enqueueAndWait(
+      hQueue, type, blocking, numEventsInWaitList, phEventWaitList, phEvent,
+      [f = std::forward<F>(f)](ur_event_handle_t event) {
+        f();
+        event->queue->completeCommand(event);
+      },
+      isBarrier);
+}
+
+// Enqueues a memory_op_t running f(begin, end, nonTemporal) over [0, size)
+template <typename F>
+static ur_result_t withChunks(ur_queue_handle_t hQueue, ur_command_t type,
+                              bool blocking, size_t size, size_t granularity,
+                              uint32_t numEventsInWaitList,
+                              const ur_event_handle_t *phEventWaitList,
+                              ur_event_handle_t *phEvent, F &&f) {
+  auto op = new native_cpu::memory_op_t(hQueue->device->tp, size, granularity,
+                                        std::forward<F>(f));
+  return enqueueAndWait(
+      hQueue, type, blocking, numEventsInWaitList, phEventWaitList, phEvent,
+      [op](ur_event_handle_t event) {
+        op->start([op, event] {
+          delete op;
+          event->queue->completeCommand(event);
+        });
+      });
+}
+
+namespace ur::native_cpu {
+
+ur_result_t urEnqueueEventsWait(ur_queue_handle_t hQueue,
+                                uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList,
+                                ur_event_handle_t *phEvent) {
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  // Without a wait list the command waits for everything enqueued before it
+  return withQueue(
+      hQueue, UR_COMMAND_EVENTS_WAIT, false, numEventsInWaitList,
+      phEventWaitList, phEvent, [] {}, numEventsInWaitList == 0);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
+ur_result_t urEnqueueEventsWaitWithBarrier(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  DIE_NO_IMPLEMENTATION;
+  return withQueue(
+      hQueue, UR_COMMAND_EVENTS_WAIT_WITH_BARRIER, false, numEventsInWaitList,
+      phEventWaitList, phEvent, [] {}, true);
 }
+} // namespace ur::native_cpu
 
 template <bool IsRead>
 static inline ur_result_t enqueueMemBufferReadWriteRect_impl(
-    ur_queue_handle_t, ur_mem_handle_t Buff, bool,
-    ur_rect_offset_t BufferOffset, ur_rect_offset_t HostOffset,
+    ur_queue_handle_t hQueue, ur_command_t type, ur_mem_handle_t Buff,
+    bool blocking, ur_rect_offset_t BufferOffset, ur_rect_offset_t HostOffset,
     ur_rect_region_t region, size_t BufferRowPitch, size_t BufferSlicePitch,
     size_t HostRowPitch, size_t HostSlicePitch,
     typename std::conditional<IsRead, void *, const void *>::type DstMem,
-    uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
-  // TODO: events, blocking, check other constraints, performance optimizations
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  // TODO: check other constraints, performance optimizations
   //       More sharing with level_zero where possible
 
   if (BufferRowPitch == 0)
@@ -291,62 +413,77 @@ static inline ur_result_t enqueueMemBufferReadWriteRect_impl(
     HostRowPitch = region.width;
   if (HostSlicePitch == 0)
     HostSlicePitch = HostRowPitch * region.height;
-  for (size_t w = 0; w < region.width; w++)
-    for (size_t h = 0; h < region.height; h++)
-      for (size_t d = 0; d < region.depth; d++) {
-        size_t buff_orign = (d + BufferOffset.z) * BufferSlicePitch +
-                            (h + BufferOffset.y) * BufferRowPitch + w +
-                            BufferOffset.x;
-        size_t host_origin = (d + HostOffset.z) * HostSlicePitch +
-                             (h + HostOffset.y) * HostRowPitch + w +
-                             HostOffset.x;
-        int8_t &buff_mem = ur_cast<int8_t *>(Buff->_mem)[buff_orign];
-        if constexpr (IsRead)
-          ur_cast<int8_t *>(DstMem)[host_origin] = buff_mem;
-        else
-          buff_mem = ur_cast<const int8_t *>(DstMem)[host_origin];
-      }
-  return UR_RESULT_SUCCESS;
+  return withQueue(
+      hQueue, type, blocking, numEventsInWaitList, phEventWaitList, phEvent,
+      [=] {
+        for (size_t w = 0; w < region.width; w++)
+          for (size_t h = 0; h < region.height; h++)
+            for (size_t d = 0; d < region.depth; d++) {
+              size_t buff_orign = (d + BufferOffset.z) * BufferSlicePitch +
+                                  (h + BufferOffset.y) * BufferRowPitch + w +
+                                  BufferOffset.x;
+              size_t host_origin = (d + HostOffset.z) * HostSlicePitch +
+                                   (h + HostOffset.y) * HostRowPitch + w +
+                                   HostOffset.x;
+              int8_t &buff_mem = ur_cast<int8_t *>(Buff->_mem)[buff_orign];
+              if constexpr (IsRead)
+                ur_cast<int8_t *>(DstMem)[host_origin] = buff_mem;
+              else
+                buff_mem = ur_cast<const int8_t *>(DstMem)[host_origin];
+            }
+      });
 }
 
-static inline ur_result_t doCopy_impl(ur_queue_handle_t hQueue, void *DstPtr,
-                                      const void *SrcPtr, size_t Size,
-                                      uint32_t numEventsInWaitList,
+static inline ur_result_t doCopy_impl(ur_queue_handle_t hQueue,
+                                      ur_command_t type, bool blocking,
+                                      void *DstPtr, const void *SrcPtr,
+                                      size_t Size, uint32_t numEventsInWaitList,
                                       const ur_event_handle_t *EventWaitList,
                                       ur_event_handle_t *Event) {
-  // todo: non-blocking, events, UR integration
-  std::ignore = EventWaitList;
-  std::ignore = Event;
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  if (SrcPtr != DstPtr && Size)
-    memmove(DstPtr, SrcPtr, Size);
-  return UR_RESULT_SUCCESS;
+  auto *Dst = static_cast<char *>(DstPtr);
+  auto *Src = static_cast<const char *>(SrcPtr);
+  if (Dst < Src + Size && Src < Dst + Size) {
+    // Overlapping copies can't be split
+    return withQueue(hQueue, type, blocking, numEventsInWaitList,
+                     EventWaitList, Event, [=] {
+                       if (SrcPtr != DstPtr && Size)
+                         memmove(DstPtr, SrcPtr, Size);
+                     });
+  }
+  return withChunks(hQueue, type, blocking, Size,
+                    native_cpu::memops::chunkGranularity, numEventsInWaitList,
+                    EventWaitList, Event,
+                    [=](size_t begin, size_t end, bool) {
+                      native_cpu::memops::copy(Dst + begin, Src + begin,
+                                               end - begin);
+                    });
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingRead,
-    size_t offset, size_t size, void *pDst, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingRead;
+namespace ur::native_cpu {
 
+ur_result_t urEnqueueMemBufferRead(ur_queue_handle_t hQueue,
+                                   ur_mem_handle_t hBuffer, bool blockingRead,
+                                   size_t offset, size_t size, void *pDst,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
   void *FromPtr = /*Src*/ hBuffer->_mem + offset;
-  return doCopy_impl(hQueue, pDst, FromPtr, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+  return doCopy_impl(hQueue, UR_COMMAND_MEM_BUFFER_READ, blockingRead, pDst,
+                     FromPtr, size, numEventsInWaitList, phEventWaitList,
+                     phEvent);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
+ur_result_t urEnqueueMemBufferWrite(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     size_t offset, size_t size, const void *pSrc, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingWrite;
-
   void *ToPtr = hBuffer->_mem + offset;
-  return doCopy_impl(hQueue, ToPtr, pSrc, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+  return doCopy_impl(hQueue, UR_COMMAND_MEM_BUFFER_WRITE, blockingWrite, ToPtr,
+                     pSrc, size, numEventsInWaitList, phEventWaitList,
+                     phEvent);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
+ur_result_t urEnqueueMemBufferReadRect(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingRead,
     ur_rect_offset_t bufferOrigin, ur_rect_offset_t hostOrigin,
     ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
@@ -354,12 +491,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
   return enqueueMemBufferReadWriteRect_impl<true /*read*/>(
-      hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
-      bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
-      numEventsInWaitList, phEventWaitList, phEvent);
+      hQueue, UR_COMMAND_MEM_BUFFER_READ_RECT, hBuffer, blockingRead,
+      bufferOrigin, hostOrigin, region, bufferRowPitch, bufferSlicePitch,
+      hostRowPitch, hostSlicePitch, pDst, numEventsInWaitList, phEventWaitList,
+      phEvent);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
+ur_result_t urEnqueueMemBufferWriteRect(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     ur_rect_offset_t bufferOrigin, ur_rect_offset_t hostOrigin,
     ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
@@ -367,23 +505,26 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
   return enqueueMemBufferReadWriteRect_impl<false /*write*/>(
-      hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
-      bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
-      numEventsInWaitList, phEventWaitList, phEvent);
+      hQueue, UR_COMMAND_MEM_BUFFER_WRITE_RECT, hBuffer, blockingWrite,
+      bufferOrigin, hostOrigin, region, bufferRowPitch, bufferSlicePitch,
+      hostRowPitch, hostSlicePitch, pSrc, numEventsInWaitList, phEventWaitList,
+      phEvent);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBufferSrc,
-    ur_mem_handle_t hBufferDst, size_t srcOffset, size_t dstOffset, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueMemBufferCopy(ur_queue_handle_t hQueue,
+                                   ur_mem_handle_t hBufferSrc,
+                                   ur_mem_handle_t hBufferDst, size_t srcOffset,
+                                   size_t dstOffset, size_t size,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
   const void *SrcPtr = hBufferSrc->_mem + srcOffset;
   void *DstPtr = hBufferDst->_mem + dstOffset;
-  return doCopy_impl(hQueue, DstPtr, SrcPtr, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+  return doCopy_impl(hQueue, UR_COMMAND_MEM_BUFFER_COPY, false, DstPtr, SrcPtr,
+                     size, numEventsInWaitList, phEventWaitList, phEvent);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
+ur_result_t urEnqueueMemBufferCopyRect(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBufferSrc,
     ur_mem_handle_t hBufferDst, ur_rect_offset_t srcOrigin,
     ur_rect_offset_t dstOrigin, ur_rect_region_t region, size_t srcRowPitch,
@@ -391,36 +532,92 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
   return enqueueMemBufferReadWriteRect_impl<true /*read*/>(
-      hQueue, hBufferSrc, false /*todo: check blocking*/, srcOrigin,
+      hQueue, UR_COMMAND_MEM_BUFFER_COPY_RECT, hBufferSrc, false, srcOrigin,
       /*HostOffset*/ dstOrigin, region, srcRowPitch, srcSlicePitch, dstRowPitch,
       dstSlicePitch, hBufferDst->_mem, numEventsInWaitList, phEventWaitList,
       phEvent);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, const void *pPattern,
-    size_t patternSize, size_t offset, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+ur_result_t urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue, uint32_t numLaunches,
+    const ur_exp_kernel_launch_desc_t *pLaunches, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  // The launches all wait on the events, and their events are joined when the
+  // caller asks for one
+  std::vector<ur_event_handle_t> LaunchEvents;
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  for (uint32_t i = 0; i < numLaunches && Result == UR_RESULT_SUCCESS; i++) {
+    const ur_exp_kernel_launch_desc_t &Launch = pLaunches[i];
+    ur_event_handle_t LaunchEvent = nullptr;
+    Result = ur::native_cpu::urEnqueueKernelLaunch(
+        hQueue, Launch.hKernel, Launch.workDim, Launch.pGlobalWorkOffset,
+        Launch.pGlobalWorkSize, Launch.pLocalWorkSize, numEventsInWaitList,
+        phEventWaitList, phEvent ? &LaunchEvent : nullptr);
+    if (LaunchEvent)
+      LaunchEvents.push_back(LaunchEvent);
+  }
+  if (Result == UR_RESULT_SUCCESS && phEvent) {
+    Result = ur::native_cpu::urEnqueueEventsWait(
+        hQueue, static_cast<uint32_t>(LaunchEvents.size()), LaunchEvents.data(),
+        phEvent);
+  }
+  for (ur_event_handle_t LaunchEvent : LaunchEvents)
+    ur::native_cpu::urEventRelease(LaunchEvent);
+  return Result;
+}
+
+ur_result_t urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t, ur_mem_handle_t, ur_mem_handle_t, uint32_t,
+    const ur_rect_offset_t *, const ur_rect_offset_t *,
+    const ur_rect_region_t *, size_t, size_t, size_t, size_t, uint32_t,
+    const ur_event_handle_t *, ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+// Enqueues a fill of size bytes at ptr with copies of the pattern
+static ur_result_t enqueueFill(ur_queue_handle_t hQueue, ur_command_t type,
+                               void *ptr, const void *pPattern,
+                               size_t patternSize, size_t size,
+                               uint32_t numEventsInWaitList,
+                               const ur_event_handle_t *phEventWaitList,
+                               ur_event_handle_t *phEvent) {
+  // The pattern may be freed as soon as this returns
+  std::vector<uint8_t> pattern(static_cast<const uint8_t *>(pPattern),
+                               static_cast<const uint8_t *>(pPattern) +
+                                   patternSize);
+  auto *out = static_cast<uint8_t *>(ptr);
+  // Chunks start on a copy of the pattern
+  return withChunks(
+      hQueue, type, false, size,
+      patternSize * ::native_cpu::memops::chunkGranularity, numEventsInWaitList,
+      phEventWaitList, phEvent,
+      [out, pattern = std::move(pattern)](size_t begin, size_t end,
+                                          bool nonTemporal) {
+        ::native_cpu::memops::fill(out + begin, end - begin, pattern.data(),
+                                 pattern.size(), nonTemporal);
+      });
+}
 
+ur_result_t urEnqueueMemBufferFill(ur_queue_handle_t hQueue,
+                                   ur_mem_handle_t hBuffer,
+                                   const void *pPattern, size_t patternSize,
+                                   size_t offset, size_t size,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
   // TODO: error checking
-  // TODO: handle async
   void *startingPtr = hBuffer->_mem + offset;
-  unsigned steps = size / patternSize;
-  for (unsigned i = 0; i < steps; i++) {
-    memcpy(static_cast<int8_t *>(startingPtr) + i * patternSize, pPattern,
-           patternSize);
-  }
-
-  return UR_RESULT_SUCCESS;
+  size_t fillSize = size / patternSize * patternSize;
+  return enqueueFill(hQueue, UR_COMMAND_MEM_BUFFER_FILL, startingPtr, pPattern,
+                     patternSize, fillSize, numEventsInWaitList,
+                     phEventWaitList, phEvent);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
+ur_result_t urEnqueueMemImageRead(
     ur_queue_handle_t hQueue, ur_mem_handle_t hImage, bool blockingRead,
     ur_rect_offset_t origin, ur_rect_region_t region, size_t rowPitch,
     size_t slicePitch, void *pDst, uint32_t numEventsInWaitList,
@@ -440,7 +637,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageWrite(
+ur_result_t urEnqueueMemImageWrite(
     ur_queue_handle_t hQueue, ur_mem_handle_t hImage, bool blockingWrite,
     ur_rect_offset_t origin, ur_rect_region_t region, size_t rowPitch,
     size_t slicePitch, void *pSrc, uint32_t numEventsInWaitList,
@@ -460,12 +657,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageWrite(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageCopy(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hImageSrc,
-    ur_mem_handle_t hImageDst, ur_rect_offset_t srcOrigin,
-    ur_rect_offset_t dstOrigin, ur_rect_region_t region,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t
+urEnqueueMemImageCopy(ur_queue_handle_t hQueue, ur_mem_handle_t hImageSrc,
+                      ur_mem_handle_t hImageDst, ur_rect_offset_t srcOrigin,
+                      ur_rect_offset_t dstOrigin, ur_rect_region_t region,
+                      uint32_t numEventsInWaitList,
+                      const ur_event_handle_t *phEventWaitList,
+                      ur_event_handle_t *phEvent) {
   std::ignore = hQueue;
   std::ignore = hImageSrc;
   std::ignore = hImageDst;
@@ -479,47 +677,42 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageCopy(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingMap,
-    ur_map_flags_t mapFlags, size_t offset, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent, void **ppRetMap) {
-  std::ignore = hQueue;
-  std::ignore = blockingMap;
+ur_result_t urEnqueueMemBufferMap(ur_queue_handle_t hQueue,
+                                  ur_mem_handle_t hBuffer, bool blockingMap,
+                                  ur_map_flags_t mapFlags, size_t offset,
+                                  size_t size, uint32_t numEventsInWaitList,
+                                  const ur_event_handle_t *phEventWaitList,
+                                  ur_event_handle_t *phEvent, void **ppRetMap) {
   std::ignore = mapFlags;
   std::ignore = size;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
 
+  // The buffer lives in host memory, so the map only has to wait for the
+  // commands writing to it
   *ppRetMap = hBuffer->_mem + offset;
 
-  return UR_RESULT_SUCCESS;
+  return withQueue(
+      hQueue, UR_COMMAND_MEM_BUFFER_MAP, blockingMap, numEventsInWaitList,
+      phEventWaitList, phEvent, [] {});
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
-    ur_queue_handle_t hQueue, ur_mem_handle_t hMem, void *pMappedPtr,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
+ur_result_t urEnqueueMemUnmap(ur_queue_handle_t hQueue, ur_mem_handle_t hMem,
+                              void *pMappedPtr, uint32_t numEventsInWaitList,
+                              const ur_event_handle_t *phEventWaitList,
+                              ur_event_handle_t *phEvent) {
   std::ignore = hMem;
   std::ignore = pMappedPtr;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
 
-  return UR_RESULT_SUCCESS;
+  return withQueue(
+      hQueue, UR_COMMAND_MEM_UNMAP, false, numEventsInWaitList,
+      phEventWaitList, phEvent, [] {});
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
-    ur_queue_handle_t hQueue, void *ptr, size_t patternSize,
-    const void *pPattern, size_t size, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
+ur_result_t urEnqueueUSMFill(ur_queue_handle_t hQueue, void *ptr,
+                             size_t patternSize, const void *pPattern,
+                             size_t size, uint32_t numEventsInWaitList,
+                             const ur_event_handle_t *phEventWaitList,
+                             ur_event_handle_t *phEvent) {
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(ptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE)
@@ -528,98 +721,56 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
   UR_ASSERT(size % patternSize == 0, UR_RESULT_ERROR_INVALID_SIZE)
   // TODO: add check for allocation size once the query is supported
 
-  switch (patternSize) {
-  case 1:
-    memset(ptr, *static_cast<const uint8_t *>(pPattern), size * patternSize);
-    break;
-  case 2: {
-    const auto pattern = *static_cast<const uint16_t *>(pPattern);
-    auto *start = reinterpret_cast<uint16_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  case 4: {
-    const auto pattern = *static_cast<const uint32_t *>(pPattern);
-    auto *start = reinterpret_cast<uint32_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint32_t *>(reinterpret_cast<uint8_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  case 8: {
-    const auto pattern = *static_cast<const uint64_t *>(pPattern);
-    auto *start = reinterpret_cast<uint64_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint64_t *>(reinterpret_cast<uint8_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  default: {
-    for (unsigned int step{0}; step < size; step += patternSize) {
-      auto *dest =
-          reinterpret_cast<void *>(reinterpret_cast<uint8_t *>(ptr) + step);
-      memcpy(dest, pPattern, patternSize);
-    }
-  }
-  }
-  return UR_RESULT_SUCCESS;
+  return enqueueFill(hQueue, UR_COMMAND_USM_FILL, ptr, pPattern, patternSize,
+                     size, numEventsInWaitList, phEventWaitList, phEvent);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
-    ur_queue_handle_t hQueue, bool blocking, void *pDst, const void *pSrc,
-    size_t size, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
+ur_result_t urEnqueueUSMMemcpy(ur_queue_handle_t hQueue, bool blocking,
+                               void *pDst, const void *pSrc, size_t size,
+                               uint32_t numEventsInWaitList,
+                               const ur_event_handle_t *phEventWaitList,
+                               ur_event_handle_t *phEvent) {
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_QUEUE);
   UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  memcpy(pDst, pSrc, size);
-
-  return UR_RESULT_SUCCESS;
+  return doCopy_impl(hQueue, UR_COMMAND_USM_MEMCPY, blocking, pDst, pSrc, size,
+                     numEventsInWaitList, phEventWaitList, phEvent);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
-    ur_queue_handle_t hQueue, const void *pMem, size_t size,
-    ur_usm_migration_flags_t flags, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
+ur_result_t urEnqueueUSMPrefetch(ur_queue_handle_t hQueue, const void *pMem,
+                                 size_t size, ur_usm_migration_flags_t flags,
+                                 uint32_t numEventsInWaitList,
+                                 const ur_event_handle_t *phEventWaitList,
+                                 ur_event_handle_t *phEvent) {
   std::ignore = pMem;
   std::ignore = size;
   std::ignore = flags;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
 
   // TODO: properly implement USM prefetch
-  return UR_RESULT_SUCCESS;
+  return withQueue(
+      hQueue, UR_COMMAND_USM_PREFETCH, false, numEventsInWaitList,
+      phEventWaitList, phEvent, [] {});
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem, size_t size,
-                   ur_usm_advice_flags_t advice, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
+ur_result_t urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem,
+                               size_t size, ur_usm_advice_flags_t advice,
+                               ur_event_handle_t *phEvent) {
   std::ignore = pMem;
   std::ignore = size;
   std::ignore = advice;
-  std::ignore = phEvent;
 
   // TODO: properly implement USM advise
-  return UR_RESULT_SUCCESS;
+  return withQueue(
+      hQueue, UR_COMMAND_USM_ADVISE, false, 0, nullptr, phEvent, [] {});
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
-    ur_queue_handle_t hQueue, void *pMem, size_t pitch, size_t patternSize,
-    const void *pPattern, size_t width, size_t height,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMFill2D(ur_queue_handle_t hQueue, void *pMem,
+                               size_t pitch, size_t patternSize,
+                               const void *pPattern, size_t width,
+                               size_t height, uint32_t numEventsInWaitList,
+                               const ur_event_handle_t *phEventWaitList,
+                               ur_event_handle_t *phEvent) {
   std::ignore = hQueue;
   std::ignore = pMem;
   std::ignore = pitch;
@@ -634,11 +785,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
-    ur_queue_handle_t hQueue, bool blocking, void *pDst, size_t dstPitch,
-    const void *pSrc, size_t srcPitch, size_t width, size_t height,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMMemcpy2D(ur_queue_handle_t hQueue, bool blocking,
+                                 void *pDst, size_t dstPitch, const void *pSrc,
+                                 size_t srcPitch, size_t width, size_t height,
+                                 uint32_t numEventsInWaitList,
+                                 const ur_event_handle_t *phEventWaitList,
+                                 ur_event_handle_t *phEvent) {
   std::ignore = hQueue;
   std::ignore = blocking;
   std::ignore = pDst;
@@ -654,7 +806,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
+ur_result_t urEnqueueDeviceGlobalVariableWrite(
     ur_queue_handle_t hQueue, ur_program_handle_t hProgram, const char *name,
     bool blockingWrite, size_t count, size_t offset, const void *pSrc,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
@@ -673,7 +825,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
+ur_result_t urEnqueueDeviceGlobalVariableRead(
     ur_queue_handle_t hQueue, ur_program_handle_t hProgram, const char *name,
     bool blockingRead, size_t count, size_t offset, void *pDst,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
@@ -692,11 +844,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueReadHostPipe(
-    ur_queue_handle_t hQueue, ur_program_handle_t hProgram,
-    const char *pipe_symbol, bool blocking, void *pDst, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueReadHostPipe(ur_queue_handle_t hQueue,
+                                  ur_program_handle_t hProgram,
+                                  const char *pipe_symbol, bool blocking,
+                                  void *pDst, size_t size,
+                                  uint32_t numEventsInWaitList,
+                                  const ur_event_handle_t *phEventWaitList,
+                                  ur_event_handle_t *phEvent) {
   std::ignore = hQueue;
   std::ignore = hProgram;
   std::ignore = pipe_symbol;
@@ -710,11 +864,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueReadHostPipe(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueWriteHostPipe(
-    ur_queue_handle_t hQueue, ur_program_handle_t hProgram,
-    const char *pipe_symbol, bool blocking, void *pSrc, size_t size,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueWriteHostPipe(ur_queue_handle_t hQueue,
+                                   ur_program_handle_t hProgram,
+                                   const char *pipe_symbol, bool blocking,
+                                   void *pSrc, size_t size,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
   std::ignore = hQueue;
   std::ignore = hProgram;
   std::ignore = pipe_symbol;
@@ -728,10 +884,23 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueWriteHostPipe(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+ur_result_t urEnqueueNativeCommandExp(
     ur_queue_handle_t, ur_exp_enqueue_native_command_function_t, void *,
     uint32_t, const ur_mem_handle_t *,
     const ur_exp_enqueue_native_command_properties_t *, uint32_t,
     const ur_event_handle_t *, ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+
+ur_result_t urEnqueueUSMDeviceAllocExp(ur_queue_handle_t, size_t, uint32_t,
+                                       const ur_event_handle_t *, void **,
+                                       ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t urEnqueueUSMFreeExp(ur_queue_handle_t, void *, uint32_t,
+                                const ur_event_handle_t *,
+                                ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+} // namespace ur::native_cpu
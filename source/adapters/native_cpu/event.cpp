@@ -11,64 +11,221 @@
 #include "ur_api.h"
 
 #include "common.hpp"
+#include "event.hpp"
+#include "queue.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
-                                                   ur_event_info_t propName,
-                                                   size_t propSize,
-                                                   void *pPropValue,
-                                                   size_t *pPropSizeRet) {
-  std::ignore = hEvent;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+#include <atomic>
+#include <memory>
 
-  DIE_NO_IMPLEMENTATION;
+using native_cpu::timestampNow;
+
+ur_event_handle_t_::ur_event_handle_t_(ur_queue_handle_t queue,
+                                       ur_context_handle_t context,
+                                       ur_command_t commandType,
+                                       bool profilingEnabled)
+    : queue(queue), context(context), commandType(commandType),
+      profilingEnabled(profilingEnabled) {
+  done.add(1);
+  if (profilingEnabled) {
+    queuedTime = timestampNow();
+  }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
-    ur_event_handle_t hEvent, ur_profiling_info_t propName, size_t propSize,
-    void *pPropValue, size_t *pPropSizeRet) {
-  std::ignore = hEvent;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+void ur_event_handle_t_::markSubmitted() {
+  if (profilingEnabled) {
+    submitTime = timestampNow();
+  }
+}
 
-  DIE_NO_IMPLEMENTATION;
+void ur_event_handle_t_::markStarted() {
+  if (profilingEnabled) {
+    startTime = timestampNow();
+  }
+  started.store(true, std::memory_order_release);
+}
+
+void ur_event_handle_t_::markComplete() {
+  std::vector<std::function<void()>> pending;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (profilingEnabled) {
+      endTime = timestampNow();
+    }
+    completed = true;
+    pending.swap(callbacks);
+  }
+  done.count_down();
+  for (auto &callback : pending) {
+    callback();
+  }
+}
+
+bool ur_event_handle_t_::addCallback(std::function<void()> callback) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (completed) {
+    return false;
+  }
+  callbacks.push_back(std::move(callback));
+  return true;
+}
+
+ur_event_status_t ur_event_handle_t_::getExecutionStatus() const {
+  if (isComplete()) {
+    return UR_EVENT_STATUS_COMPLETE;
+  }
+  if (started.load(std::memory_order_acquire)) {
+    return UR_EVENT_STATUS_RUNNING;
+  }
+  return UR_EVENT_STATUS_SUBMITTED;
+}
+
+uint64_t
+ur_event_handle_t_::getTimestamp(ur_profiling_info_t propName) const {
+  switch (propName) {
+  case UR_PROFILING_INFO_COMMAND_QUEUED:
+    return queuedTime;
+  case UR_PROFILING_INFO_COMMAND_SUBMIT:
+    // A timestamp recording reports a single point in time on the host and
+    // one on the device
+    return commandType == UR_COMMAND_TIMESTAMP_RECORDING_EXP ? queuedTime
+                                                             : submitTime;
+  case UR_PROFILING_INFO_COMMAND_START:
+    return commandType == UR_COMMAND_TIMESTAMP_RECORDING_EXP ? endTime
+                                                             : startTime;
+  case UR_PROFILING_INFO_COMMAND_END:
+  case UR_PROFILING_INFO_COMMAND_COMPLETE:
+    return endTime;
+  default:
+    return 0;
+  }
+}
+
+
+namespace ur::native_cpu {
+
+ur_result_t urEventGetInfo(ur_event_handle_t hEvent, ur_event_info_t propName,
+                           size_t propSize, void *pPropValue,
+                           size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_EVENT_INFO_COMMAND_QUEUE:
+    return ReturnValue(hEvent->queue);
+  case UR_EVENT_INFO_CONTEXT:
+    return ReturnValue(hEvent->context);
+  case UR_EVENT_INFO_COMMAND_TYPE:
+    return ReturnValue(hEvent->commandType);
+  case UR_EVENT_INFO_COMMAND_EXECUTION_STATUS:
+    return ReturnValue(hEvent->getExecutionStatus());
+  case UR_EVENT_INFO_REFERENCE_COUNT:
+    return ReturnValue(hEvent->getReferenceCount());
+  default:
+    break;
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
+}
+
+ur_result_t urEventGetProfilingInfo(ur_event_handle_t hEvent,
+                                    ur_profiling_info_t propName,
+                                    size_t propSize, void *pPropValue,
+                                    size_t *pPropSizeRet) {
+  if (!hEvent->profilingEnabled) {
+    return UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE;
+  }
+
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_PROFILING_INFO_COMMAND_QUEUED:
+  case UR_PROFILING_INFO_COMMAND_SUBMIT:
+  case UR_PROFILING_INFO_COMMAND_START:
+  case UR_PROFILING_INFO_COMMAND_END:
+  case UR_PROFILING_INFO_COMMAND_COMPLETE:
+    // The end timestamps are only written once the command is complete
+    if (!hEvent->isComplete()) {
+      return UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE;
+    }
+    return ReturnValue(hEvent->getTimestamp(propName));
+  default:
+    break;
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
-  std::ignore = numEvents;
-  std::ignore = phEventWaitList;
-  // TODO: currently we do everything synchronously so this is a no-op
+ur_result_t urEventWait(uint32_t numEvents,
+                        const ur_event_handle_t *phEventWaitList) {
+  for (uint32_t i = 0; i < numEvents; i++) {
+    phEventWaitList[i]->wait();
+  }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
-  std::ignore = hEvent;
+ur_result_t urEventWaitAnyExp(uint32_t numEvents,
+                              const ur_event_handle_t *phEventWaitList,
+                              uint32_t *pEventIndex) {
+  // Rather than polling, each event reports its index when it completes, and
+  // the first one to do so wakes us up. The state outlives the call since the
+  // callbacks of the other events still run when these complete.
+  struct wait_any_state {
+    ::native_cpu::completion_latch done;
+    std::atomic<uint32_t> index{UINT32_MAX};
+  };
+  auto state = std::make_shared<wait_any_state>();
+  state->done.add(1);
 
-  DIE_NO_IMPLEMENTATION;
+  for (uint32_t i = 0; i < numEvents; i++) {
+    auto onComplete = [state, i]() {
+      uint32_t none = UINT32_MAX;
+      if (state->index.compare_exchange_strong(none, i)) {
+        state->done.count_down();
+      }
+    };
+    if (!phEventWaitList[i]->addCallback(onComplete)) {
+      onComplete();
+      break;
+    }
+  }
+
+  state->done.wait();
+  *pEventIndex = state->index.load();
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventRelease(ur_event_handle_t hEvent) {
-  std::ignore = hEvent;
-  DIE_NO_IMPLEMENTATION;
+ur_result_t urEventGetExecutionStatusExp(uint32_t numEvents,
+                                         const ur_event_handle_t *phEvents,
+                                         ur_event_status_t *pStatuses) {
+  for (uint32_t i = 0; i < numEvents; i++) {
+    pStatuses[i] = phEvents[i]->getExecutionStatus();
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEventRetain(ur_event_handle_t hEvent) {
+  hEvent->incrementReferenceCount();
+
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetNativeHandle(
-    ur_event_handle_t hEvent, ur_native_handle_t *phNativeEvent) {
+ur_result_t urEventRelease(ur_event_handle_t hEvent) {
+  decrementOrDelete(hEvent);
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEventGetNativeHandle(ur_event_handle_t hEvent,
+                                   ur_native_handle_t *phNativeEvent) {
   std::ignore = hEvent;
   std::ignore = phNativeEvent;
 
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventCreateWithNativeHandle(
-    ur_native_handle_t hNativeEvent, ur_context_handle_t hContext,
-    const ur_event_native_properties_t *pProperties,
-    ur_event_handle_t *phEvent) {
+ur_result_t
+urEventCreateWithNativeHandle(ur_native_handle_t hNativeEvent,
+                              ur_context_handle_t hContext,
+                              const ur_event_native_properties_t *pProperties,
+                              ur_event_handle_t *phEvent) {
   std::ignore = hNativeEvent;
   std::ignore = hContext;
   std::ignore = pProperties;
@@ -77,25 +234,47 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventCreateWithNativeHandle(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urEventSetCallback(ur_event_handle_t hEvent, ur_execution_info_t execStatus,
-                   ur_event_callback_t pfnNotify, void *pUserData) {
-  std::ignore = hEvent;
-  std::ignore = execStatus;
-  std::ignore = pfnNotify;
-  std::ignore = pUserData;
+ur_result_t urEventSetCallback(ur_event_handle_t hEvent,
+                               ur_execution_info_t execStatus,
+                               ur_event_callback_t pfnNotify, void *pUserData) {
+  // Only completion is tracked
+  if (execStatus != UR_EXECUTION_INFO_COMPLETE) {
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  }
 
-  DIE_NO_IMPLEMENTATION;
+  hEvent->incrementReferenceCount();
+  auto callback = [hEvent, execStatus, pfnNotify, pUserData] {
+    pfnNotify(hEvent, execStatus, pUserData);
+    decrementOrDelete(hEvent);
+  };
+  if (!hEvent->addCallback(callback)) {
+    callback();
+  }
+
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
+ur_result_t urEnqueueTimestampRecordingExp(
     ur_queue_handle_t hQueue, bool blocking, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(phEvent, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  DIE_NO_IMPLEMENTATION;
+  // The queue records the timestamps of this command even without profiling,
+  // the time it completes is the device timestamp
+  ur_event_handle_t event = nullptr;
+  auto result = hQueue->enqueueCommand(
+      UR_COMMAND_TIMESTAMP_RECORDING_EXP, numEventsInWaitList,
+      phEventWaitList, &event, [](ur_event_handle_t event) {
+        event->queue->completeCommand(event);
+      });
+  if (result != UR_RESULT_SUCCESS) {
+    return result;
+  }
+  if (blocking) {
+    event->wait();
+  }
+  *phEvent = event;
+  return UR_RESULT_SUCCESS;
 }
+} // namespace ur::native_cpu
@@ -0,0 +1,65 @@
+//===----------- event.hpp - Native CPU Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common.hpp"
+#include "threadpool.hpp"
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+struct ur_event_handle_t_ : RefCounted {
+  ur_event_handle_t_(ur_queue_handle_t queue, ur_context_handle_t context,
+                     ur_command_t commandType, bool profilingEnabled);
+
+  // Blocks until the command of the event is complete
+  void wait() { done.wait(); }
+
+  bool isComplete() const { return done.is_done(); }
+
+  // Called by the queue when the dependencies of the command are complete
+  void markSubmitted();
+
+  // Called by the queue when the command starts running
+  void markStarted();
+
+  // Called by the queue when the command is done, runs the callbacks waiting
+  // for it
+  void markComplete();
+
+  // Calls callback once the command is complete, on the thread completing
+  // it. Returns false without calling it if the command already is complete.
+  bool addCallback(std::function<void()> callback);
+
+  ur_event_status_t getExecutionStatus() const;
+
+  // Returns 0 if the timestamp wasn't recorded
+  uint64_t getTimestamp(ur_profiling_info_t propName) const;
+
+  ur_queue_handle_t const queue;
+  ur_context_handle_t const context;
+  const ur_command_t commandType;
+  const bool profilingEnabled;
+
+private:
+  native_cpu::completion_latch done;
+  std::atomic<bool> started{false};
+
+  std::mutex mutex;
+  bool completed = false;
+  std::vector<std::function<void()>> callbacks;
+
+  // Nanoseconds of the steady clock, only recorded when profiling is enabled
+  uint64_t queuedTime = 0;
+  uint64_t submitTime = 0;
+  uint64_t startTime = 0;
+  uint64_t endTime = 0;
+};
@@ -0,0 +1,186 @@
+//===----------- fibers.hpp - Native CPU Adapter --------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) && __has_include(<ucontext.h>)
+#define NATIVECPU_HAS_FIBERS 1
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#endif
+
+namespace native_cpu {
+
+#ifdef NATIVECPU_HAS_FIBERS
+// Runs the work items of a work group as fibers on the calling thread, so
+// that kernels compiled one work item at a time can use barriers. A fiber
+// runs until it finishes or reaches a barrier, and the fibers are resumed in
+// turn, so none of them passes a barrier before all the others reached it.
+// There is one group per thread, which keeps its stacks for the next work
+// groups it runs.
+//
+// Every work item has its own stack, 64 KiB by default, so a worker running
+// groups of 2048 work items reserves 128 MiB of address space. The stacks
+// are mapped without committing them though, and only the pages a work item
+// touches use memory, usually one or two.
+class fiber_group_t {
+public:
+  static constexpr size_t defaultStackSize = 64 * 1024;
+
+  fiber_group_t(const fiber_group_t &) = delete;
+  fiber_group_t &operator=(const fiber_group_t &) = delete;
+
+  ~fiber_group_t() {
+    if (stacks) {
+      munmap(stacks, stacksBytes);
+    }
+  }
+
+  // Runs item(i) for i in [0, numItems), rethrowing the first exception one
+  // of them threw
+  template <typename F> void run(size_t numItems, F &item) {
+    if (fibers.size() < numItems) {
+      reserveStacks(numItems);
+      fibers.resize(numItems);
+    }
+    invoke = [](void *callable, size_t index) {
+      (*static_cast<F *>(callable))(index);
+    };
+    callable = &item;
+    for (size_t i = 0; i < numItems; i++) {
+      fiber_t &fiber = fibers[i];
+      getcontext(&fiber.context);
+      // Above the guard page of the fiber
+      fiber.context.uc_stack.ss_sp =
+          stacks + i * (stackSize + pageSize) + pageSize;
+      fiber.context.uc_stack.ss_size = stackSize;
+      fiber.context.uc_link = &scheduler;
+      makecontext(&fiber.context, &fiber_group_t::entry, 0);
+      fiber.done = false;
+    }
+
+    size_t left = numItems;
+    while (left) {
+      for (size_t i = 0; i < numItems; i++) {
+        if (fibers[i].done) {
+          continue;
+        }
+        running = i;
+        swapcontext(&scheduler, &fibers[i].context);
+        if (fibers[i].done) {
+          left--;
+        }
+      }
+    }
+    if (exception) {
+      std::rethrow_exception(std::exchange(exception, nullptr));
+    }
+  }
+
+  // Called by the running fiber, returns once all the other fibers of the
+  // group reached the barrier or finished
+  void barrier() { swapcontext(&fibers[running].context, &scheduler); }
+
+  // The group of the calling thread
+  static fiber_group_t &current() {
+    static thread_local fiber_group_t group;
+    return group;
+  }
+
+private:
+  struct fiber_t {
+    ucontext_t context;
+    bool done = true;
+  };
+
+  fiber_group_t() {
+    // In bytes, kernels with large private arrays may need more
+    const char *envVar = std::getenv("SYCL_NATIVE_CPU_FIBER_STACK_SIZE");
+    if (envVar) {
+      stackSize = std::max<size_t>(std::strtoull(envVar, nullptr, 10),
+                                   MINSIGSTKSZ);
+    }
+    pageSize = sysconf(_SC_PAGESIZE);
+    stackSize = (stackSize + pageSize - 1) / pageSize * pageSize;
+  }
+
+  // Maps the stacks of numItems fibers, each above a guard page so that a
+  // fiber overflowing its stack faults instead of writing over another one
+  void reserveStacks(size_t numItems) {
+    size_t bytes = numItems * (stackSize + pageSize);
+    void *mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mapping == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+    for (size_t i = 0; i < numItems; i++) {
+      mprotect(static_cast<char *>(mapping) + i * (stackSize + pageSize),
+               pageSize, PROT_NONE);
+    }
+    if (stacks) {
+      munmap(stacks, stacksBytes);
+    }
+    stacks = static_cast<char *>(mapping);
+    stacksBytes = bytes;
+  }
+
+  static void entry() {
+    fiber_group_t &group = current();
+    size_t index = group.running;
+    try {
+      group.invoke(group.callable, index);
+    } catch (...) {
+      if (!group.exception) {
+        group.exception = std::current_exception();
+      }
+    }
+    // Returns to the scheduler, through uc_link
+    group.fibers[index].done = true;
+  }
+
+  size_t stackSize = defaultStackSize;
+  size_t pageSize = 0;
+  char *stacks = nullptr;
+  size_t stacksBytes = 0;
+  std::vector<fiber_t> fibers;
+  ucontext_t scheduler;
+  size_t running = 0;
+  void (*invoke)(void *, size_t) = nullptr;
+  void *callable = nullptr;
+  std::exception_ptr exception;
+};
+#endif // NATIVECPU_HAS_FIBERS
+
+// Whether kernels compiled one work item at a time run their work groups as
+// fibers, in parallel, rather than every work item of the launch in turn on
+// a single thread. SYCL_NATIVE_CPU_FIBERS=0 turns it off.
+inline bool fibers_enabled() {
+#ifdef NATIVECPU_HAS_FIBERS
+  static const bool enabled = [] {
+    const char *envVar = std::getenv("SYCL_NATIVE_CPU_FIBERS");
+    return !envVar || std::string(envVar) != "0";
+  }();
+  return enabled;
+#else
+  return false;
+#endif
+}
+
+} // namespace native_cpu
@@ -15,10 +15,13 @@
 #include "kernel.hpp"
 #include "memory.hpp"
 #include "program.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
-               ur_kernel_handle_t *phKernel) {
+namespace ur::native_cpu {
+
+ur_result_t urKernelCreate(ur_program_handle_t hProgram,
+                           const char *pKernelName,
+                           ur_kernel_handle_t *phKernel) {
   UR_ASSERT(hProgram, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(pKernelName, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
@@ -31,13 +34,13 @@ urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
   ur_kernel_handle_t_ *kernel;
 
   // Set reqd_work_group_size for kernel if needed
-  std::optional<native_cpu::WGSize_t> ReqdWG;
+  std::optional<::native_cpu::WGSize_t> ReqdWG;
   const auto &ReqdMap = hProgram->KernelReqdWorkGroupSizeMD;
   if (auto ReqdIt = ReqdMap.find(pKernelName); ReqdIt != ReqdMap.end()) {
     ReqdWG = ReqdIt->second;
   }
 
-  std::optional<native_cpu::WGSize_t> MaxWG;
+  std::optional<::native_cpu::WGSize_t> MaxWG;
   const auto &MaxMap = hProgram->KernelMaxWorkGroupSizeMD;
   if (auto MaxIt = MaxMap.find(pKernelName); MaxIt != MaxMap.end()) {
     MaxWG = MaxIt->second;
@@ -55,14 +58,12 @@ urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
-    ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
-    const ur_kernel_arg_value_properties_t *pProperties,
-    const void *pArgValue) {
+ur_result_t
+urKernelSetArgValue(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                    size_t argSize,
+                    const ur_kernel_arg_value_properties_t *pProperties,
+                    const void *pArgValue) {
   // Todo: error checking
-  // Todo: I think that the opencl spec (and therefore the pi spec mandates that
-  // arg is copied (this is why it is defined as const void*, I guess we should
-  // do it
   // TODO: can args arrive out of order?
   std::ignore = argIndex;
   std::ignore = pProperties;
@@ -70,14 +71,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(argSize, UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE);
 
-  hKernel->_args.emplace_back(const_cast<void *>(pArgValue));
+  // The value is copied, since launches run after the caller may have reused
+  // it
+  auto Value = static_cast<const char *>(pArgValue);
+  auto &Copy = hKernel->_argValues.emplace_back(Value, Value + argSize);
+  hKernel->_args.emplace_back(Copy.data());
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgLocal(
-    ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
-    const ur_kernel_arg_local_properties_t *pProperties) {
+ur_result_t
+urKernelSetArgLocal(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                    size_t argSize,
+                    const ur_kernel_arg_local_properties_t *pProperties) {
   std::ignore = pProperties;
   // emplace a placeholder kernel arg, gets replaced with a pointer to the
   // memory pool before enqueueing the kernel.
@@ -86,11 +92,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgLocal(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelGetInfo(ur_kernel_handle_t hKernel,
-                                                    ur_kernel_info_t propName,
-                                                    size_t propSize,
-                                                    void *pPropValue,
-                                                    size_t *pPropSizeRet) {
+ur_result_t urKernelGetInfo(ur_kernel_handle_t hKernel,
+                            ur_kernel_info_t propName, size_t propSize,
+                            void *pPropValue, size_t *pPropSizeRet) {
   std::ignore = hKernel;
   std::ignore = propName;
   std::ignore = pPropValue;
@@ -114,10 +118,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelGetInfo(ur_kernel_handle_t hKernel,
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelGetGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
-                     ur_kernel_group_info_t propName, size_t propSize,
-                     void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urKernelGetGroupInfo(ur_kernel_handle_t hKernel,
+                                 ur_device_handle_t hDevice,
+                                 ur_kernel_group_info_t propName,
+                                 size_t propSize, void *pPropValue,
+                                 size_t *pPropSizeRet) {
   std::ignore = hDevice;
 
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
@@ -171,10 +176,11 @@ urKernelGetGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
-                        ur_kernel_sub_group_info_t propName, size_t propSize,
-                        void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel,
+                                    ur_device_handle_t hDevice,
+                                    ur_kernel_sub_group_info_t propName,
+                                    size_t propSize, void *pPropValue,
+                                    size_t *pPropSizeRet) {
   std::ignore = hKernel;
   std::ignore = hDevice;
 
@@ -205,19 +211,18 @@ urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelRetain(ur_kernel_handle_t hKernel) {
+ur_result_t urKernelRetain(ur_kernel_handle_t hKernel) {
   hKernel->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelRelease(ur_kernel_handle_t hKernel) {
+ur_result_t urKernelRelease(ur_kernel_handle_t hKernel) {
   decrementOrDelete(hKernel);
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urKernelSetArgPointer(ur_kernel_handle_t hKernel, uint32_t argIndex,
                       const ur_kernel_arg_pointer_properties_t *pProperties,
                       const void *pArgValue) {
@@ -233,10 +238,11 @@ urKernelSetArgPointer(ur_kernel_handle_t hKernel, uint32_t argIndex,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetExecInfo(
-    ur_kernel_handle_t hKernel, ur_kernel_exec_info_t propName, size_t propSize,
-    const ur_kernel_exec_info_properties_t *pProperties,
-    const void *pPropValue) {
+ur_result_t
+urKernelSetExecInfo(ur_kernel_handle_t hKernel, ur_kernel_exec_info_t propName,
+                    size_t propSize,
+                    const ur_kernel_exec_info_properties_t *pProperties,
+                    const void *pPropValue) {
   std::ignore = hKernel;
   std::ignore = propName;
   std::ignore = propSize;
@@ -246,7 +252,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetExecInfo(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urKernelSetArgSampler(ur_kernel_handle_t hKernel, uint32_t argIndex,
                       const ur_kernel_arg_sampler_properties_t *pProperties,
                       ur_sampler_handle_t hArgValue) {
@@ -258,7 +264,7 @@ urKernelSetArgSampler(ur_kernel_handle_t hKernel, uint32_t argIndex,
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
                      const ur_kernel_arg_mem_obj_properties_t *pProperties,
                      ur_mem_handle_t hArgValue) {
@@ -279,7 +285,47 @@ urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetSpecializationConstants(
+ur_result_t urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                               const ur_exp_kernel_arg_properties_t *pArgs) {
+  // TODO: out_of_order args?
+  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  hKernel->_args.reserve(hKernel->_args.size() + numArgs);
+  for (uint32_t i = 0; i < numArgs; i++) {
+    const ur_exp_kernel_arg_properties_t &Arg = pArgs[i];
+    switch (Arg.type) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE: {
+      UR_ASSERT(Arg.size, UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE);
+      // The value is copied, as in urKernelSetArgValue
+      auto Value = static_cast<const char *>(Arg.value.value);
+      auto &Copy = hKernel->_argValues.emplace_back(Value, Value + Arg.size);
+      hKernel->_args.emplace_back(Copy.data());
+      break;
+    }
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+      UR_ASSERT(Arg.value.pointer, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+      hKernel->_args.emplace_back(const_cast<void *>(Arg.value.pointer));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+      hKernel->_args.emplace_back(nullptr);
+      hKernel->_localArgInfo.emplace_back(Arg.index, Arg.size);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ: {
+      // zero-sized buffers are expected to be null.
+      auto hMem = Arg.value.memObjTuple.hMem;
+      hKernel->_args.emplace_back(hMem ? hMem->_mem : nullptr);
+      break;
+    }
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+      return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    default:
+      return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urKernelSetSpecializationConstants(
     ur_kernel_handle_t hKernel, uint32_t count,
     const ur_specialization_constant_info_t *pSpecConstants) {
   std::ignore = hKernel;
@@ -289,19 +335,20 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetSpecializationConstants(
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelGetNativeHandle(
-    ur_kernel_handle_t hKernel, ur_native_handle_t *phNativeKernel) {
+ur_result_t urKernelGetNativeHandle(ur_kernel_handle_t hKernel,
+                                    ur_native_handle_t *phNativeKernel) {
   std::ignore = hKernel;
   std::ignore = phNativeKernel;
 
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
-    ur_native_handle_t hNativeKernel, ur_context_handle_t hContext,
-    ur_program_handle_t hProgram,
-    const ur_kernel_native_properties_t *pProperties,
-    ur_kernel_handle_t *phKernel) {
+ur_result_t
+urKernelCreateWithNativeHandle(ur_native_handle_t hNativeKernel,
+                               ur_context_handle_t hContext,
+                               ur_program_handle_t hProgram,
+                               const ur_kernel_native_properties_t *pProperties,
+                               ur_kernel_handle_t *phKernel) {
   std::ignore = hNativeKernel;
   std::ignore = hContext;
   std::ignore = hProgram;
@@ -311,7 +358,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
+ur_result_t urKernelGetSuggestedLocalWorkSize(
     [[maybe_unused]] ur_kernel_handle_t hKernel,
     [[maybe_unused]] ur_queue_handle_t hQueue,
     [[maybe_unused]] uint32_t workDim,
@@ -320,3 +367,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
     [[maybe_unused]] size_t *pSuggestedLocalWorkSize) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+} // namespace ur::native_cpu
@@ -12,8 +12,12 @@
 #include "nativecpu_state.hpp"
 #include "program.hpp"
 #include <array>
+#include <cstdlib>
+#include <memory>
+#include <new>
 #include <ur_api.h>
 #include <utility>
+#include <vector>
 
 namespace native_cpu {
 
@@ -43,20 +47,6 @@ struct ur_kernel_handle_t_ : RefCounted {
                       nativecpu_task_t subhandler)
       : hProgram(hProgram), _name{name}, _subhandler{std::move(subhandler)} {}
 
-  ur_kernel_handle_t_(const ur_kernel_handle_t_ &other)
-      : hProgram(other.hProgram), _name(other._name),
-        _subhandler(other._subhandler), _args(other._args),
-        _localArgInfo(other._localArgInfo), _localMemPool(other._localMemPool),
-        _localMemPoolSize(other._localMemPoolSize),
-        ReqdWGSize(other.ReqdWGSize) {
-    incrementReferenceCount();
-  }
-
-  ~ur_kernel_handle_t_() {
-    if (decrementReferenceCount() == 0) {
-      free(_localMemPool);
-    }
-  }
   ur_kernel_handle_t_(ur_program_handle_t hProgram, const char *name,
                       nativecpu_task_t subhandler,
                       std::optional<native_cpu::WGSize_t> ReqdWGSize,
@@ -71,6 +61,8 @@ struct ur_kernel_handle_t_ : RefCounted {
   nativecpu_task_t _subhandler;
   std::vector<native_cpu::NativeCPUArgDesc> _args;
   std::vector<local_arg_info_t> _localArgInfo;
+  // Copies of the values passed to urKernelSetArgValue, _args points to them
+  std::vector<std::vector<char>> _argValues;
 
   std::optional<native_cpu::WGSize_t> getReqdWGSize() const {
     return ReqdWGSize;
@@ -80,36 +72,129 @@ struct ur_kernel_handle_t_ : RefCounted {
 
   std::optional<uint64_t> getMaxLinearWGSize() const { return MaxLinearWGSize; }
 
-  void updateMemPool(size_t numParallelThreads) {
-    // compute requested size.
-    size_t reqSize = 0;
-    for (auto &entry : _localArgInfo) {
-      reqSize += entry.argSize * numParallelThreads;
+private:
+  std::optional<native_cpu::WGSize_t> ReqdWGSize = std::nullopt;
+  std::optional<native_cpu::WGSize_t> MaxWGSize = std::nullopt;
+  std::optional<uint64_t> MaxLinearWGSize = std::nullopt;
+};
+
+namespace native_cpu {
+
+// The local memory of a worker thread, shared by all the kernels it runs,
+// since a worker runs a single work group at a time. It's page aligned, so
+// that the arenas of different workers never share a cache line, and only
+// ever grows.
+class local_arena_t {
+public:
+  static constexpr size_t alignment = 4096;
+
+  local_arena_t() = default;
+  local_arena_t(const local_arena_t &) = delete;
+  local_arena_t &operator=(const local_arena_t &) = delete;
+
+  ~local_arena_t() { release(); }
+
+  // Returns at least size bytes. The memory returned by previous calls is
+  // freed if it has to grow.
+  char *reserve(size_t size) {
+    if (size > capacity) {
+      release();
+      capacity = (size + alignment - 1) & ~(alignment - 1);
+#ifdef _MSC_VER
+      data = static_cast<char *>(_aligned_malloc(capacity, alignment));
+#else
+      data = static_cast<char *>(std::aligned_alloc(alignment, capacity));
+#endif
+      if (!data) {
+        capacity = 0;
+        throw std::bad_alloc();
+      }
     }
-    if (reqSize == 0 || reqSize == _localMemPoolSize) {
+    return data;
+  }
+
+  // The arena of the calling thread
+  static local_arena_t &current() {
+    static thread_local local_arena_t arena;
+    return arena;
+  }
+
+private:
+  void release() {
+#ifdef _MSC_VER
+    _aligned_free(data);
+#else
+    std::free(data);
+#endif
+    data = nullptr;
+    capacity = 0;
+  }
+
+  char *data = nullptr;
+  size_t capacity = 0;
+};
+
+// The arguments of a kernel launch. They are taken from the kernel when the
+// launch is enqueued, since the arguments of the next launch are set before
+// this one runs. The local arguments point into the arena of the worker
+// running the work group, they are set up the first time a worker runs a
+// work group of the launch, and again only if its arena moved since.
+class launch_args_t {
+public:
+  // Local arguments are aligned like the widest vector types
+  static constexpr size_t localArgAlignment = 64;
+
+  launch_args_t(ur_kernel_handle_t_ &kernel, size_t numParallelThreads)
+      : values(std::move(kernel._argValues)), args(std::move(kernel._args)),
+        localArgInfo(std::move(kernel._localArgInfo)) {
+    kernel._args.clear();
+    kernel._localArgInfo.clear();
+    kernel._argValues.clear();
+
+    if (localArgInfo.empty()) {
       return;
     }
-    // realloc handles nullptr case
-    _localMemPool = (char *)realloc(_localMemPool, reqSize);
-    _localMemPoolSize = reqSize;
+    for (auto &entry : localArgInfo) {
+      localOffsets.push_back(localMemSize);
+      localMemSize += (entry.argSize + localArgAlignment - 1) &
+                      ~(localArgAlignment - 1);
+    }
+    threadArgs = std::make_unique<thread_args_t[]>(numParallelThreads);
   }
 
-  // To be called before executing a work group
-  void handleLocalArgs(size_t numParallelThread, size_t threadId) {
-    // For each local argument we have size*numthreads
-    size_t offset = 0;
-    for (auto &entry : _localArgInfo) {
-      _args[entry.argIndex].MPtr =
-          _localMemPool + offset + (entry.argSize * threadId);
-      // update offset in the memory pool
-      offset += entry.argSize * numParallelThread;
+  // The arguments for the worker threadId, which must be the calling thread.
+  // Work groups run by the same worker share its local memory.
+  const NativeCPUArgDesc *get(size_t threadId) {
+    if (localArgInfo.empty()) {
+      return args.data();
+    }
+    thread_args_t &thread = threadArgs[threadId];
+    char *arena = local_arena_t::current().reserve(localMemSize);
+    if (thread.args.empty() || thread.arena != arena) {
+      if (thread.args.empty()) {
+        thread.args = args;
+      }
+      for (size_t i = 0; i < localArgInfo.size(); i++) {
+        thread.args[localArgInfo[i].argIndex].MPtr = arena + localOffsets[i];
+      }
+      thread.arena = arena;
     }
+    return thread.args.data();
   }
 
 private:
-  char *_localMemPool = nullptr;
-  size_t _localMemPoolSize = 0;
-  std::optional<native_cpu::WGSize_t> ReqdWGSize = std::nullopt;
-  std::optional<native_cpu::WGSize_t> MaxWGSize = std::nullopt;
-  std::optional<uint64_t> MaxLinearWGSize = std::nullopt;
+  // Only touched by its worker, padded so that workers don't share lines
+  struct alignas(64) thread_args_t {
+    char *arena = nullptr;
+    std::vector<NativeCPUArgDesc> args;
+  };
+
+  std::vector<std::vector<char>> values;
+  std::vector<NativeCPUArgDesc> args;
+  std::vector<local_arg_info_t> localArgInfo;
+  std::vector<size_t> localOffsets;
+  size_t localMemSize = 0;
+  std::unique_ptr<thread_args_t[]> threadArgs;
 };
+
+} // namespace native_cpu
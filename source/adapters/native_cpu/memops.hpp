@@ -0,0 +1,124 @@
+//===----------- memops.hpp - Native CPU Adapter --------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define NATIVECPU_HAS_SSE2 1
+#endif
+
+// Copies and fills of host memory used by the enqueue commands. They run on
+// chunks of the commands split across the thread pool. Fills use
+// non-temporal stores when the whole command is too large for the caches to
+// be of use, so that it doesn't evict the data of the kernels running next
+// to it.
+namespace native_cpu::memops {
+
+// Commands of at least this many bytes are split across the workers
+constexpr size_t parallelThreshold = 1 << 20;
+
+// Fills of at least this many bytes bypass the caches, they are larger
+// than the last level cache of most parts
+constexpr size_t nonTemporalThreshold = 32 << 20;
+
+// Chunks are multiples of this many bytes, page sized so that workers don't
+// share cache lines or pages
+constexpr size_t chunkGranularity = 4096;
+
+namespace detail {
+inline size_t alignmentGap(const void *ptr, size_t alignment) {
+  auto address = reinterpret_cast<uintptr_t>(ptr);
+  return (alignment - address % alignment) % alignment;
+}
+} // namespace detail
+
+// Copies size bytes from src to dst, which must not overlap. The C library
+// already uses the widest vectors of the CPU, and switches to non-temporal
+// stores above a size tuned for it, which measured faster than SSE2
+// streaming stores, so copies only gain from being split across workers.
+inline void copy(void *dst, const void *src, size_t size) {
+  std::memcpy(dst, src, size);
+}
+
+// Fills size bytes at ptr with copies of the patternSize bytes at pattern.
+// ptr must be at the start of a copy of the pattern, size may end in the
+// middle of one.
+inline void fill(void *ptr, size_t size, const void *pattern,
+                 size_t patternSize, bool nonTemporal) {
+  auto *out = static_cast<uint8_t *>(ptr);
+  auto *bytes = static_cast<const uint8_t *>(pattern);
+#ifdef NATIVECPU_HAS_SSE2
+  bool stream = nonTemporal && size >= 256;
+#else
+  bool stream = false;
+  std::ignore = nonTemporal;
+#endif
+  if (patternSize == 1 && !stream) {
+    std::memset(out, bytes[0], size);
+    return;
+  }
+
+  bool isVectorPattern = patternSize == 1 || patternSize == 2 ||
+                         patternSize == 4 || patternSize == 8 ||
+                         patternSize == 16;
+  if (isVectorPattern) {
+    // Scalar stores up to the first aligned vector, then vectors holding the
+    // pattern from that offset on, since 16 is a multiple of its size
+    size_t head = std::min(detail::alignmentGap(out, 16), size);
+    for (size_t i = 0; i < head; i++) {
+      out[i] = bytes[i % patternSize];
+    }
+    alignas(16) uint8_t vector[16];
+    for (size_t i = 0; i < 16; i++) {
+      vector[i] = bytes[(head + i) % patternSize];
+    }
+    size_t pos = head;
+#ifdef NATIVECPU_HAS_SSE2
+    __m128i value = _mm_load_si128(reinterpret_cast<const __m128i *>(vector));
+    if (stream) {
+      for (; pos + 16 <= size; pos += 16) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(out + pos), value);
+      }
+      _mm_sfence();
+    } else {
+      for (; pos + 16 <= size; pos += 16) {
+        _mm_store_si128(reinterpret_cast<__m128i *>(out + pos), value);
+      }
+    }
+#else
+    for (; pos + 16 <= size; pos += 16) {
+      std::memcpy(out + pos, vector, 16);
+    }
+#endif
+    for (; pos < size; pos++) {
+      out[pos] = bytes[pos % patternSize];
+    }
+    return;
+  }
+
+  // Other sizes double the filled prefix until it covers the range, each
+  // step is a large memcpy
+  size_t filled = std::min(patternSize, size);
+  std::memcpy(out, bytes, filled);
+  while (filled < size) {
+    size_t step = std::min(filled, size - filled);
+    std::memcpy(out + filled, out, step);
+    filled += step;
+  }
+}
+
+} // namespace native_cpu::memops
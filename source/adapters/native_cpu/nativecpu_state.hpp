@@ -20,6 +20,14 @@ struct state {
   size_t MNumGroups[3];
   size_t MGlobalOffset[3];
   uint32_t NumSubGroups, SubGroup_id, SubGroup_local_id, SubGroup_size;
+  // Waits for the other work items of the group at a barrier, set when the
+  // work items of a group run as fibers. It is meant to be called by the
+  // barrier builtin of the Native CPU device library when it isn't null,
+  // which is not part of this repository: until the device library calls
+  // it, the barriers of kernels built without the OCK don't synchronize
+  // their work items. Kept last, so that the offsets of the other fields
+  // don't change.
+  void (*MBarrier)(state *);
   state(size_t globalR0, size_t globalR1, size_t globalR2, size_t localR0,
         size_t localR1, size_t localR2, size_t globalO0, size_t globalO1,
         size_t globalO2)
@@ -41,6 +49,7 @@ struct state {
     SubGroup_id = 0;
     SubGroup_local_id = 0;
     SubGroup_size = 1;
+    MBarrier = nullptr;
   }
 
   void update(size_t group0, size_t group1, size_t group2, size_t local0,
@@ -13,12 +13,15 @@
 
 #include "ur/ur.hpp"
 #include "ur_api.h"
+#include "ur_interface_loader.hpp"
 
 #include <iostream>
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
-              ur_platform_handle_t *phPlatforms, uint32_t *pNumPlatforms) {
+namespace ur::native_cpu {
+
+ur_result_t urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
+                          ur_platform_handle_t *phPlatforms,
+                          uint32_t *pNumPlatforms) {
 
   UR_ASSERT(pNumPlatforms || phPlatforms, UR_RESULT_ERROR_INVALID_VALUE);
 
@@ -40,8 +43,8 @@ urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetApiVersion(
-    ur_platform_handle_t hDriver, ur_api_version_t *pVersion) {
+ur_result_t urPlatformGetApiVersion(ur_platform_handle_t hDriver,
+                                    ur_api_version_t *pVersion) {
   UR_ASSERT(hDriver, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(pVersion, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
@@ -49,9 +52,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetApiVersion(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urPlatformGetInfo(ur_platform_handle_t hPlatform, ur_platform_info_t propName,
-                  size_t propSize, void *pParamValue, size_t *pSizeRet) {
+ur_result_t urPlatformGetInfo(ur_platform_handle_t hPlatform,
+                              ur_platform_info_t propName, size_t propSize,
+                              void *pParamValue, size_t *pSizeRet) {
 
   if (hPlatform == nullptr) {
     return UR_RESULT_ERROR_INVALID_PLATFORM;
@@ -85,9 +88,9 @@ urPlatformGetInfo(ur_platform_handle_t hPlatform, ur_platform_info_t propName,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetBackendOption(
-    ur_platform_handle_t hPlatform, const char *pFrontendOption,
-    const char **ppPlatformOption) {
+ur_result_t urPlatformGetBackendOption(ur_platform_handle_t hPlatform,
+                                       const char *pFrontendOption,
+                                       const char **ppPlatformOption) {
   std::ignore = hPlatform;
   std::ignore = pFrontendOption;
   std::ignore = ppPlatformOption;
@@ -105,16 +108,18 @@ UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetBackendOption(
   return UR_RESULT_ERROR_INVALID_VALUE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
-    ur_native_handle_t, ur_adapter_handle_t,
-    const ur_platform_native_properties_t *, ur_platform_handle_t *) {
+ur_result_t
+urPlatformCreateWithNativeHandle(ur_native_handle_t, ur_adapter_handle_t,
+                                 const ur_platform_native_properties_t *,
+                                 ur_platform_handle_t *) {
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetNativeHandle(
-    ur_platform_handle_t hPlatform, ur_native_handle_t *phNativePlatform) {
+ur_result_t urPlatformGetNativeHandle(ur_platform_handle_t hPlatform,
+                                      ur_native_handle_t *phNativePlatform) {
   std::ignore = hPlatform;
   std::ignore = phNativePlatform;
 
   DIE_NO_IMPLEMENTATION;
 }
+} // namespace ur::native_cpu
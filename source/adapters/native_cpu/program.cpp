@@ -13,13 +13,16 @@
 #include "common.hpp"
 #include "common/ur_util.hpp"
 #include "program.hpp"
+#include "ur_interface_loader.hpp"
 #include <cstdint>
 #include <memory>
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramCreateWithIL(ur_context_handle_t hContext, const void *pIL,
-                      size_t length, const ur_program_properties_t *pProperties,
-                      ur_program_handle_t *phProgram) {
+namespace ur::native_cpu {
+
+ur_result_t urProgramCreateWithIL(ur_context_handle_t hContext, const void *pIL,
+                                  size_t length,
+                                  const ur_program_properties_t *pProperties,
+                                  ur_program_handle_t *phProgram) {
   std::ignore = hContext;
   std::ignore = pIL;
   std::ignore = length;
@@ -31,7 +34,7 @@ urProgramCreateWithIL(ur_context_handle_t hContext, const void *pIL,
 
 static ur_result_t
 deserializeWGMetadata(const ur_program_metadata_t &MetadataElement,
-                      native_cpu::WGSize_t &res, std::uint32_t DefaultVal) {
+                      ::native_cpu::WGSize_t &res, std::uint32_t DefaultVal) {
   size_t MDElemsSize = MetadataElement.size - sizeof(std::uint64_t);
 
   // Expect between 1 and 3 32-bit integer values.
@@ -53,7 +56,7 @@ deserializeWGMetadata(const ur_program_metadata_t &MetadataElement,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
+ur_result_t urProgramCreateWithBinary(
     ur_context_handle_t hContext, ur_device_handle_t hDevice, size_t size,
     const uint8_t *pBinary, const ur_program_properties_t *pProperties,
     ur_program_handle_t *phProgram) {
@@ -76,7 +79,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
           Tag == __SYCL_UR_PROGRAM_METADATA_TAG_MAX_WORK_GROUP_SIZE) {
         bool isReqd =
             Tag == __SYCL_UR_PROGRAM_METADATA_TAG_REQD_WORK_GROUP_SIZE;
-        native_cpu::WGSize_t wgSizeProp;
+        ::native_cpu::WGSize_t wgSizeProp;
         auto res = deserializeWGMetadata(
             mdNode, wgSizeProp,
             isReqd ? 1 : std::numeric_limits<std::uint32_t>::max());
@@ -106,9 +109,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramBuild(ur_context_handle_t hContext,
-                                                   ur_program_handle_t hProgram,
-                                                   const char *pOptions) {
+ur_result_t urProgramBuild(ur_context_handle_t hContext,
+                           ur_program_handle_t hProgram, const char *pOptions) {
   std::ignore = hContext;
   std::ignore = hProgram;
   std::ignore = pOptions;
@@ -116,9 +118,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramBuild(ur_context_handle_t hContext,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramCompile(ur_context_handle_t hContext, ur_program_handle_t hProgram,
-                 const char *pOptions) {
+ur_result_t urProgramCompile(ur_context_handle_t hContext,
+                             ur_program_handle_t hProgram,
+                             const char *pOptions) {
   std::ignore = hContext;
   std::ignore = hProgram;
   std::ignore = pOptions;
@@ -126,10 +128,10 @@ urProgramCompile(ur_context_handle_t hContext, ur_program_handle_t hProgram,
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramLink(ur_context_handle_t hContext, uint32_t count,
-              const ur_program_handle_t *phPrograms, const char *pOptions,
-              ur_program_handle_t *phProgram) {
+ur_result_t urProgramLink(ur_context_handle_t hContext, uint32_t count,
+                          const ur_program_handle_t *phPrograms,
+                          const char *pOptions,
+                          ur_program_handle_t *phProgram) {
   if (nullptr != phProgram) {
     *phProgram = nullptr;
   }
@@ -141,44 +143,40 @@ urProgramLink(ur_context_handle_t hContext, uint32_t count,
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCompileExp(ur_program_handle_t,
-                                                        uint32_t,
-                                                        ur_device_handle_t *,
-                                                        const char *) {
+ur_result_t urProgramCompileExp(ur_program_handle_t, uint32_t,
+                                ur_device_handle_t *, const char *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramBuildExp(ur_program_handle_t,
-                                                      uint32_t,
-                                                      ur_device_handle_t *,
-                                                      const char *) {
+ur_result_t urProgramBuildExp(ur_program_handle_t, uint32_t,
+                              ur_device_handle_t *, const char *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramLinkExp(
-    ur_context_handle_t, uint32_t, ur_device_handle_t *, uint32_t,
-    const ur_program_handle_t *, const char *, ur_program_handle_t *phProgram) {
+ur_result_t urProgramLinkExp(ur_context_handle_t, uint32_t,
+                             ur_device_handle_t *, uint32_t,
+                             const ur_program_handle_t *, const char *,
+                             ur_program_handle_t *phProgram) {
   if (nullptr != phProgram) {
     *phProgram = nullptr;
   }
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramRetain(ur_program_handle_t hProgram) {
+ur_result_t urProgramRetain(ur_program_handle_t hProgram) {
   hProgram->incrementReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramRelease(ur_program_handle_t hProgram) {
+ur_result_t urProgramRelease(ur_program_handle_t hProgram) {
   decrementOrDelete(hProgram);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
-    ur_device_handle_t hDevice, ur_program_handle_t hProgram,
-    const char *pFunctionName, void **ppFunctionPointer) {
+ur_result_t urProgramGetFunctionPointer(ur_device_handle_t hDevice,
+                                        ur_program_handle_t hProgram,
+                                        const char *pFunctionName,
+                                        void **ppFunctionPointer) {
   std::ignore = hDevice;
   std::ignore = hProgram;
   std::ignore = pFunctionName;
@@ -187,7 +185,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
+ur_result_t urProgramGetGlobalVariablePointer(
     ur_device_handle_t, ur_program_handle_t hProgram,
     const char *pGlobalVariableName, size_t *pGlobalVariableSizeRet,
     void **ppGlobalVariablePointerRet) {
@@ -199,9 +197,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramGetInfo(ur_program_handle_t hProgram, ur_program_info_t propName,
-                 size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urProgramGetInfo(ur_program_handle_t hProgram,
+                             ur_program_info_t propName, size_t propSize,
+                             void *pPropValue, size_t *pPropSizeRet) {
   UR_ASSERT(hProgram, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
   UrReturnHelper returnValue(propSize, pPropValue, pPropSizeRet);
@@ -231,10 +229,11 @@ urProgramGetInfo(ur_program_handle_t hProgram, ur_program_info_t propName,
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramGetBuildInfo(ur_program_handle_t hProgram, ur_device_handle_t hDevice,
-                      ur_program_build_info_t propName, size_t propSize,
-                      void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urProgramGetBuildInfo(ur_program_handle_t hProgram,
+                                  ur_device_handle_t hDevice,
+                                  ur_program_build_info_t propName,
+                                  size_t propSize, void *pPropValue,
+                                  size_t *pPropSizeRet) {
   std::ignore = hProgram;
   std::ignore = hDevice;
   std::ignore = propName;
@@ -245,7 +244,7 @@ urProgramGetBuildInfo(ur_program_handle_t hProgram, ur_device_handle_t hDevice,
   CONTINUE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramSetSpecializationConstants(
+ur_result_t urProgramSetSpecializationConstants(
     ur_program_handle_t hProgram, uint32_t count,
     const ur_specialization_constant_info_t *pSpecConstants) {
   std::ignore = hProgram;
@@ -255,15 +254,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramSetSpecializationConstants(
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetNativeHandle(
-    ur_program_handle_t hProgram, ur_native_handle_t *phNativeProgram) {
+ur_result_t urProgramGetNativeHandle(ur_program_handle_t hProgram,
+                                     ur_native_handle_t *phNativeProgram) {
   std::ignore = hProgram;
   std::ignore = phNativeProgram;
 
   DIE_NO_IMPLEMENTATION
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
+ur_result_t urProgramCreateWithNativeHandle(
     ur_native_handle_t hNativeProgram, ur_context_handle_t hContext,
     const ur_program_native_properties_t *pProperties,
     ur_program_handle_t *phProgram) {
@@ -274,3 +273,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
 
   DIE_NO_IMPLEMENTATION
 }
+} // namespace ur::native_cpu
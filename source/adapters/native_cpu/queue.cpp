@@ -13,50 +13,274 @@
 
 #include "ur/ur.hpp"
 #include "ur_api.h"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
-                                                   ur_queue_info_t propName,
-                                                   size_t propSize,
-                                                   void *pPropValue,
-                                                   size_t *pPropSizeRet) {
-  std::ignore = hQueue;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+#include <algorithm>
+#include <memory>
 
-  DIE_NO_IMPLEMENTATION;
+namespace {
+// A command waiting for its dependencies. Each dependency holds a reference
+// to it, plus one held while the command is enqueued. When the last
+// dependency completes, the command is scheduled on the thread pool rather
+// than started inline, so that long chains of commands don't recurse.
+class pending_command_t final : public native_cpu::detail::task_t {
+public:
+  pending_command_t(ur_event_handle_t event, native_cpu::command_t &&function)
+      : event(event), function(std::move(function)) {}
+
+  void addDependency() { remaining.fetch_add(1, std::memory_order_relaxed); }
+
+  // Returns true when the last dependency is released
+  bool releaseDependency() {
+    return remaining.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+  void submit() { event->markSubmitted(); }
+
+  void start() {
+    std::unique_ptr<pending_command_t> self(this);
+    event->markStarted();
+    try {
+      function(event);
+    } catch (...) {
+      logger::error("native_cpu: command {} failed to run",
+                    event->commandType);
+      event->queue->completeCommand(event);
+    }
+  }
+
+  void run(size_t) noexcept override { start(); }
+
+private:
+  ur_event_handle_t event;
+  native_cpu::command_t function;
+  std::atomic<uint32_t> remaining{1};
+};
+} // namespace
+
+ur_queue_handle_t_::~ur_queue_handle_t_() {
+  finish();
+  if (lastEvent) {
+    decrementOrDelete(lastEvent);
+  }
+  for (auto event : events) {
+    decrementOrDelete(event);
+  }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueCreate(
-    ur_context_handle_t hContext, ur_device_handle_t hDevice,
-    const ur_queue_properties_t *pProperties, ur_queue_handle_t *phQueue) {
-  std::ignore = hContext;
-  std::ignore = hDevice;
-  std::ignore = pProperties;
+void ur_queue_handle_t_::pruneEvents() {
+  auto complete = std::remove_if(events.begin(), events.end(),
+                                 [](ur_event_handle_t event) {
+                                   if (!event->isComplete()) {
+                                     return false;
+                                   }
+                                   decrementOrDelete(event);
+                                   return true;
+                                 });
+  events.erase(complete, events.end());
+  // Keeps the pruning amortized when many commands are in flight
+  pruneThreshold = std::max<size_t>(64, events.size() * 2);
+}
+
+ur_result_t ur_queue_handle_t_::enqueueCommand(
+    ur_command_t commandType, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    native_cpu::command_t function, bool isBarrier) {
+  // The command holds a reference to its event, and to the queue, until it
+  // is complete. Timestamp recordings are always profiled.
+  auto event = new ur_event_handle_t_(
+      this, context, commandType,
+      isProfilingEnabled() ||
+          commandType == UR_COMMAND_TIMESTAMP_RECORDING_EXP);
+  auto command = new pending_command_t(event, std::move(function));
+  incrementReferenceCount();
+  inFlight.add(1);
+
+  auto addDependency = [this, command](ur_event_handle_t dependency) {
+    command->addDependency();
+    bool registered = dependency->addCallback([this, command] {
+      if (command->releaseDependency()) {
+        command->submit();
+        device->tp.schedule_task(command);
+      }
+    });
+    if (!registered) {
+      command->releaseDependency();
+    }
+  };
+
+  for (uint32_t i = 0; i < numEventsInWaitList; i++) {
+    addDependency(phEventWaitList[i]);
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (lastEvent) {
+      addDependency(lastEvent);
+    }
+    if (isInOrder() || isBarrier) {
+      for (auto previous : events) {
+        addDependency(previous);
+        decrementOrDelete(previous);
+      }
+      events.clear();
+      if (lastEvent) {
+        decrementOrDelete(lastEvent);
+      }
+      event->incrementReferenceCount();
+      lastEvent = event;
+    } else {
+      if (events.size() >= pruneThreshold) {
+        pruneEvents();
+      }
+      event->incrementReferenceCount();
+      events.push_back(event);
+    }
+  }
+
+  if (phEvent) {
+    event->incrementReferenceCount();
+    *phEvent = event;
+  }
+
+  // Releases the reference held while the command was being enqueued, the
+  // command starts right away if its dependencies are already complete
+  if (command->releaseDependency()) {
+    command->submit();
+    command->start();
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+void ur_queue_handle_t_::completeCommand(ur_event_handle_t event) {
+  event->markComplete();
+  decrementOrDelete(event);
+  inFlight.count_down();
+  // The queue may be destroyed here
+  decrementOrDelete(this);
+}
+
+ur_result_t ur_queue_handle_t_::reserveTimestampMarkers(uint32_t capacity) {
+  std::lock_guard<std::mutex> lock(markerMutex);
+  if (markers) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+  markers.emplace(capacity);
+  markerSlots.resize(capacity);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_handle_t_::enqueueTimestampMarker(
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    uint64_t *pMarker) {
+  std::lock_guard<std::mutex> lock(markerMutex);
+  if (!markers) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+  uint64_t *slot = &markerSlots[markers->slot(markers->enqueued())];
+  auto result = enqueueCommand(
+      UR_COMMAND_TIMESTAMP_RECORDING_EXP, numEventsInWaitList,
+      phEventWaitList, nullptr, [slot](ur_event_handle_t event) {
+        *slot = native_cpu::timestampNow();
+        event->queue->completeCommand(event);
+      });
+  if (result != UR_RESULT_SUCCESS) {
+    return result;
+  }
+  uint64_t marker = markers->push();
+  if (pMarker) {
+    *pMarker = marker;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_handle_t_::readTimestampMarkers(uint64_t firstMarker,
+                                                     uint32_t count,
+                                                     uint64_t *pTimestamps) {
+  std::unique_lock<std::mutex> lock(markerMutex);
+  if (!markers) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+  auto result = markers->checkRange(firstMarker, count);
+  if (result != UR_RESULT_SUCCESS) {
+    return result;
+  }
+  if (!markers->written(firstMarker + count)) {
+    // The markers enqueued meanwhile may overwrite the range, which is
+    // checked again once they are all written
+    uint64_t enqueued = markers->enqueued();
+    lock.unlock();
+    finish();
+    lock.lock();
+    markers->markWritten(enqueued);
+    result = markers->checkRange(firstMarker, count);
+    if (result != UR_RESULT_SUCCESS) {
+      return result;
+    }
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    pTimestamps[i] = markerSlots[markers->slot(firstMarker + i)];
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+namespace ur::native_cpu {
 
-  auto Queue = new ur_queue_handle_t_(hDevice);
+ur_result_t urQueueGetInfo(ur_queue_handle_t hQueue, ur_queue_info_t propName,
+                           size_t propSize, void *pPropValue,
+                           size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch (propName) {
+  case UR_QUEUE_INFO_CONTEXT:
+    return ReturnValue(hQueue->context);
+  case UR_QUEUE_INFO_DEVICE:
+    return ReturnValue(static_cast<ur_device_handle_t>(hQueue->device));
+  case UR_QUEUE_INFO_FLAGS:
+    return ReturnValue(hQueue->flags);
+  case UR_QUEUE_INFO_REFERENCE_COUNT:
+    return ReturnValue(hQueue->getReferenceCount());
+  case UR_QUEUE_INFO_EMPTY:
+    return ReturnValue(static_cast<ur_bool_t>(hQueue->isEmpty()));
+  case UR_QUEUE_INFO_COMMAND_COUNTS:
+  case UR_QUEUE_INFO_BYTES_COPIED:
+  case UR_QUEUE_INFO_BATCH_COUNT:
+  case UR_QUEUE_INFO_AVERAGE_BATCH_SIZE:
+  case UR_QUEUE_INFO_HOST_WAIT_TIME:
+  case UR_QUEUE_INFO_CREATED_EVENT_COUNT:
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  default:
+    break;
+  }
+
+  DIE_NO_IMPLEMENTATION;
+}
+
+ur_result_t urQueueCreate(ur_context_handle_t hContext,
+                          ur_device_handle_t hDevice,
+                          const ur_queue_properties_t *pProperties,
+                          ur_queue_handle_t *phQueue) {
+  auto Queue = new ur_queue_handle_t_(hDevice, hContext,
+                                      pProperties ? pProperties->flags : 0);
   *phQueue = Queue;
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueRetain(ur_queue_handle_t hQueue) {
+ur_result_t urQueueRetain(ur_queue_handle_t hQueue) {
   std::ignore = hQueue;
   hQueue->incrementReferenceCount();
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueRelease(ur_queue_handle_t hQueue) {
+ur_result_t urQueueRelease(ur_queue_handle_t hQueue) {
   decrementOrDelete(hQueue);
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urQueueGetNativeHandle(ur_queue_handle_t hQueue, ur_queue_native_desc_t *pDesc,
-                       ur_native_handle_t *phNativeQueue) {
+ur_result_t urQueueGetNativeHandle(ur_queue_handle_t hQueue,
+                                   ur_queue_native_desc_t *pDesc,
+                                   ur_native_handle_t *phNativeQueue) {
   std::ignore = hQueue;
   std::ignore = pDesc;
   std::ignore = phNativeQueue;
@@ -64,7 +288,7 @@ urQueueGetNativeHandle(ur_queue_handle_t hQueue, ur_queue_native_desc_t *pDesc,
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
+ur_result_t urQueueCreateWithNativeHandle(
     ur_native_handle_t hNativeQueue, ur_context_handle_t hContext,
     ur_device_handle_t hDevice, const ur_queue_native_properties_t *pProperties,
     ur_queue_handle_t *phQueue) {
@@ -77,14 +301,34 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
-  std::ignore = hQueue;
-  // TODO: is this fine as no-op?
+ur_result_t urQueueFinish(ur_queue_handle_t hQueue) {
+  hQueue->finish();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueFlush(ur_queue_handle_t hQueue) {
-  std::ignore = hQueue;
+ur_result_t urQueueReserveTimestampMarkersExp(ur_queue_handle_t hQueue,
+                                              uint32_t capacity) {
+  UR_ASSERT(capacity > 0, UR_RESULT_ERROR_INVALID_SIZE);
+  return hQueue->reserveTimestampMarkers(capacity);
+}
 
-  DIE_NO_IMPLEMENTATION;
+ur_result_t urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, uint64_t *pMarker) {
+  return hQueue->enqueueTimestampMarker(numEventsInWaitList, phEventWaitList,
+                                        pMarker);
+}
+
+ur_result_t urQueueReadTimestampMarkersExp(ur_queue_handle_t hQueue,
+                                           uint64_t firstMarker, uint32_t count,
+                                           uint64_t *pTimestamps) {
+  return hQueue->readTimestampMarkers(firstMarker, count, pTimestamps);
+}
+
+ur_result_t urQueueFlush(ur_queue_handle_t hQueue) {
+  // Commands are submitted to the thread pool as soon as their dependencies
+  // are complete, there is nothing to flush
+  std::ignore = hQueue;
+  return UR_RESULT_SUCCESS;
 }
+} // namespace ur::native_cpu
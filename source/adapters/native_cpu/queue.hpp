@@ -10,9 +10,86 @@
 #pragma once
 #include "common.hpp"
 #include "device.hpp"
+#include "event.hpp"
+#include "ur_timestamp_markers.hpp"
+
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace native_cpu {
+// Runs a command once its dependencies are complete. It may finish
+// asynchronously, but must eventually call completeCommand with the event.
+using command_t = std::function<void(ur_event_handle_t)>;
+} // namespace native_cpu
 
 struct ur_queue_handle_t_ : RefCounted {
   ur_device_handle_t_ *const device;
+  ur_context_handle_t const context;
+  const ur_queue_flags_t flags;
+
+  ur_queue_handle_t_(ur_device_handle_t_ *device, ur_context_handle_t context,
+                     ur_queue_flags_t flags)
+      : device(device), context(context), flags(flags) {}
+
+  ~ur_queue_handle_t_();
+
+  bool isInOrder() const {
+    return !(flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+  }
+
+  bool isProfilingEnabled() const {
+    return flags & UR_QUEUE_FLAG_PROFILING_ENABLE;
+  }
+
+  // Enqueues a command running function once the events of the wait list are
+  // complete, along with the previous command for in-order queues and the
+  // previous barrier for out-of-order ones. A barrier also waits for all the
+  // commands enqueued before it, and the commands enqueued after it wait for
+  // it. The event of the command is returned in phEvent, if not null.
+  ur_result_t enqueueCommand(ur_command_t commandType,
+                             uint32_t numEventsInWaitList,
+                             const ur_event_handle_t *phEventWaitList,
+                             ur_event_handle_t *phEvent,
+                             native_cpu::command_t function,
+                             bool isBarrier = false);
+
+  // Completes the command of event, and starts the commands waiting for it
+  void completeCommand(ur_event_handle_t event);
+
+  // Blocks until all the commands enqueued so far are complete
+  void finish() { inFlight.wait(); }
+
+  bool isEmpty() const { return inFlight.is_done(); }
+
+  // The ring of urQueueReserveTimestampMarkersExp, each marker being a
+  // command which writes the time it runs at to its slot
+  ur_result_t reserveTimestampMarkers(uint32_t capacity);
+  ur_result_t enqueueTimestampMarker(uint32_t numEventsInWaitList,
+                                     const ur_event_handle_t *phEventWaitList,
+                                     uint64_t *pMarker);
+  ur_result_t readTimestampMarkers(uint64_t firstMarker, uint32_t count,
+                                   uint64_t *pTimestamps);
+
+private:
+  // Releases the events of the out-of-order queue which are complete
+  void pruneEvents();
+
+  std::mutex mutex;
+  // The last command of an in-order queue, or the last barrier of an
+  // out-of-order one
+  ur_event_handle_t lastEvent = nullptr;
+  // The commands of an out-of-order queue since lastEvent, some of them may
+  // be complete
+  std::vector<ur_event_handle_t> events;
+  size_t pruneThreshold = 64;
+  // Counts the commands which aren't complete
+  native_cpu::completion_latch inFlight;
 
-  ur_queue_handle_t_(ur_device_handle_t_ *device) : device(device) {}
+  // Guards the numbering of the markers, the commands write their slots
+  // without it, each to a slot no other pending marker uses
+  std::mutex markerMutex;
+  std::optional<ur::timestamp_markers_t> markers;
+  std::vector<uint64_t> markerSlots;
 };
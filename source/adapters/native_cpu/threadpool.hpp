@@ -9,168 +9,589 @@
 #pragma once
 #include <algorithm>
 #include <atomic>
-#include <condition_variable>
+#include <cctype>
+#include <cstdint>
 #include <cstdlib>
-#include <forward_list>
+#include <deque>
+#include <exception>
+#include <fstream>
 #include <functional>
-#include <future>
-#include <iterator>
+#include <memory>
 #include <mutex>
-#include <numeric>
-#include <queue>
+#include <optional>
 #include <string>
 #include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace native_cpu {
 
-using worker_task_t = std::function<void(size_t)>;
+// Schedules a task on any worker, rather than on the workers of one node
+constexpr size_t any_node = SIZE_MAX;
 
 namespace detail {
 
-class worker_thread {
-public:
-  // Initializes state, but does not start the worker thread
-  worker_thread(size_t threadId) noexcept
-      : m_threadId(threadId), m_isRunning(false), m_numTasks(0) {
-    std::lock_guard<std::mutex> lock(m_workMutex);
-    if (this->is_running()) {
-      return;
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+// Blocks while word holds expected, may return spuriously
+inline void futex_wait(std::atomic<uint32_t> &word, uint32_t expected) {
+#if defined(__linux__)
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT_PRIVATE,
+          expected, nullptr, nullptr, 0);
+#else
+  if (word.load(std::memory_order_relaxed) == expected) {
+    std::this_thread::yield();
+  }
+#endif
+}
+
+// Wakes up to count threads blocked in futex_wait on word
+inline void futex_wake(std::atomic<uint32_t> &word, int count) {
+#if defined(__linux__)
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE_PRIVATE,
+          count, nullptr, nullptr, 0);
+#else
+  std::ignore = word;
+  std::ignore = count;
+#endif
+}
+
+// Parses a list of CPUs or nodes in the format of the kernel, e.g. "0-3,8",
+// returns an empty list if it's malformed
+inline std::vector<unsigned> parse_cpu_list(const std::string &list) {
+  std::vector<unsigned> cpus;
+  size_t pos = 0;
+  while (pos < list.size()) {
+    size_t end = list.find(',', pos);
+    if (end == std::string::npos) {
+      end = list.size();
+    }
+    std::string range = list.substr(pos, end - pos);
+    pos = end + 1;
+    // Tolerates the trailing newline of the sysfs files
+    while (!range.empty() && std::isspace(range.back())) {
+      range.pop_back();
+    }
+    if (range.empty()) {
+      continue;
+    }
+    size_t dash = range.find('-');
+    try {
+      unsigned first = std::stoul(range.substr(0, dash));
+      unsigned last = dash == std::string::npos
+                          ? first
+                          : std::stoul(range.substr(dash + 1));
+      if (last < first) {
+        return {};
+      }
+      for (unsigned cpu = first; cpu <= last; cpu++) {
+        cpus.push_back(cpu);
+      }
+    } catch (...) {
+      return {};
+    }
+  }
+  return cpus;
+}
+
+// The CPUs the process may run on, grouped by NUMA node
+struct cpu_topology_t {
+  std::vector<std::vector<unsigned>> nodes;
+
+  // Returns the index in nodes of the node of cpu, 0 if it's unknown
+  size_t node_of(unsigned cpu) const {
+    for (size_t node = 0; node < nodes.size(); node++) {
+      if (std::find(nodes[node].begin(), nodes[node].end(), cpu) !=
+          nodes[node].end()) {
+        return node;
+      }
     }
-    m_worker = std::thread([this]() {
-      while (true) {
-        std::unique_lock<std::mutex> lock(m_workMutex);
-        // Wait until there's work available
-        m_startWorkCondition.wait(
-            lock, [this]() { return !this->is_running() || !m_tasks.empty(); });
-        if (!this->is_running() && m_tasks.empty()) {
-          // Can only break if there is no more work to be done
-          break;
+    return 0;
+  }
+
+  static const cpu_topology_t &get() {
+    static const cpu_topology_t topology = read();
+    return topology;
+  }
+
+private:
+  static std::string read_file(const std::string &path) {
+    std::ifstream file(path);
+    std::string contents;
+    std::getline(file, contents);
+    return contents;
+  }
+
+  static cpu_topology_t read() {
+    cpu_topology_t topology;
+#if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+      return topology;
+    }
+    for (unsigned node :
+         parse_cpu_list(read_file("/sys/devices/system/node/online"))) {
+      std::vector<unsigned> cpus;
+      for (unsigned cpu : parse_cpu_list(read_file(
+               "/sys/devices/system/node/node" + std::to_string(node) +
+               "/cpulist"))) {
+        if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) {
+          cpus.push_back(cpu);
         }
-        // Retrieve a task from the queue
-        worker_task_t task = std::move(m_tasks.front());
-        m_tasks.pop();
+      }
+      // Nodes without CPUs, e.g. memory only ones, can't run workers
+      if (!cpus.empty()) {
+        topology.nodes.push_back(std::move(cpus));
+      }
+    }
+    if (topology.nodes.empty()) {
+      // No NUMA support in the kernel, all the CPUs are in one node
+      std::vector<unsigned> cpus;
+      for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &allowed)) {
+          cpus.push_back(cpu);
+        }
+      }
+      topology.nodes.push_back(std::move(cpus));
+    }
+#endif
+    return topology;
+  }
+};
 
-        // Not modifying internal state anymore, can release the mutex
-        lock.unlock();
+// Where the workers of a pool run, set by SYCL_NATIVE_CPU_HOST_AFFINITY:
+//  - "none", the default, leaves the workers to the OS scheduler;
+//  - "compact" fills the CPUs of a NUMA node before moving to the next;
+//  - "scatter" spreads the workers round-robin across the nodes;
+//  - a list of CPUs, e.g. "0-7,16-23", pins worker i to the i-th CPU.
+// With more workers than CPUs, the CPUs are reused in the same order.
+struct affinity_t {
+  enum class policy_t { none, compact, scatter, cpu_list };
+
+  policy_t policy = policy_t::none;
+  std::vector<unsigned> cpus;
+
+  static affinity_t from_env() {
+    affinity_t affinity;
+    const char *envVar = std::getenv("SYCL_NATIVE_CPU_HOST_AFFINITY");
+    if (!envVar) {
+      return affinity;
+    }
+    std::string value = envVar;
+    if (value == "compact") {
+      affinity.policy = policy_t::compact;
+    } else if (value == "scatter") {
+      affinity.policy = policy_t::scatter;
+    } else if (value != "none") {
+      affinity.cpus = parse_cpu_list(value);
+      if (!affinity.cpus.empty()) {
+        affinity.policy = policy_t::cpu_list;
+      }
+    }
+    return affinity;
+  }
+};
 
-        // Execute the task
-        task(m_threadId);
-        --m_numTasks;
+// The CPU a worker is pinned to, and the index of its NUMA node
+struct placement_t {
+  std::optional<unsigned> cpu;
+  size_t node = 0;
+};
+
+// Places numThreads workers according to affinity. Without pinning the
+// workers are all treated as part of node 0, since they may run anywhere.
+inline std::vector<placement_t> place_workers(size_t numThreads,
+                                              const affinity_t &affinity,
+                                              const cpu_topology_t &topology) {
+  std::vector<placement_t> placements(numThreads);
+  if (topology.nodes.empty()) {
+    return placements;
+  }
+  switch (affinity.policy) {
+  case affinity_t::policy_t::none:
+    break;
+  case affinity_t::policy_t::compact: {
+    std::vector<placement_t> cpus;
+    for (size_t node = 0; node < topology.nodes.size(); node++) {
+      for (unsigned cpu : topology.nodes[node]) {
+        cpus.push_back({cpu, node});
       }
-    });
+    }
+    for (size_t i = 0; i < numThreads; i++) {
+      placements[i] = cpus[i % cpus.size()];
+    }
+    break;
+  }
+  case affinity_t::policy_t::scatter: {
+    size_t numNodes = topology.nodes.size();
+    for (size_t i = 0; i < numThreads; i++) {
+      auto &cpus = topology.nodes[i % numNodes];
+      placements[i] = {cpus[(i / numNodes) % cpus.size()], i % numNodes};
+    }
+    break;
+  }
+  case affinity_t::policy_t::cpu_list:
+    for (size_t i = 0; i < numThreads; i++) {
+      unsigned cpu = affinity.cpus[i % affinity.cpus.size()];
+      placements[i] = {cpu, topology.node_of(cpu)};
+    }
+    break;
+  }
+  return placements;
+}
+
+// Pins the calling thread to cpu, returns false if it's not allowed to run
+// there
+inline bool pin_current_thread(unsigned cpu) {
+#if defined(__linux__)
+  if (cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+  std::ignore = cpu;
+  return false;
+#endif
+}
+
+} // namespace detail
 
-    m_isRunning.store(true, std::memory_order_release);
+// Counts the tasks of a batch which haven't finished yet. wait() blocks on a
+// futex until the count drops to zero, or a callback registered with
+// on_done() runs on the thread counting down the last task.
+class completion_latch {
+  // The flags live in the counter so that count_down() knows what to do from
+  // the counter alone, since the latch may be destroyed as soon as it drops
+  // to zero
+  static constexpr uint32_t waitersFlag = 1u << 31;
+  static constexpr uint32_t callbackFlag = 1u << 30;
+  static constexpr uint32_t countMask = callbackFlag - 1;
+
+public:
+  void add(uint32_t count) noexcept {
+    m_count.fetch_add(count, std::memory_order_relaxed);
   }
 
-  inline void schedule(const worker_task_t &task) {
-    {
-      std::lock_guard<std::mutex> lock(m_workMutex);
-      // Add the task to the queue
-      m_tasks.push(task);
-      ++m_numTasks;
+  void count_down() noexcept {
+    uint32_t prev = m_count.fetch_sub(1, std::memory_order_acq_rel);
+    if ((prev & countMask) != 1) {
+      return;
+    }
+    if (prev & callbackFlag) {
+      // The callback may destroy the latch, or start another batch on it
+      auto onDone = std::move(m_onDone);
+      m_count.fetch_and(~callbackFlag, std::memory_order_relaxed);
+      onDone();
+    } else if (prev & waitersFlag) {
+      detail::futex_wake(m_count, INT32_MAX);
     }
-    m_startWorkCondition.notify_one();
   }
 
-  size_t num_pending_tasks() const noexcept {
-    // m_numTasks is an atomic counter because we don't want to lock the mutex
-    // here, num_pending_tasks is only used for heuristics
-    return m_numTasks.load(std::memory_order_acquire);
+  bool is_done() const noexcept {
+    return (m_count.load(std::memory_order_acquire) & countMask) == 0;
   }
 
-  // Waits for all tasks to finish and destroys the worker thread
-  inline void stop() {
-    {
-      std::lock_guard<std::mutex> lock(m_workMutex);
-      m_isRunning.store(false, std::memory_order_release);
-      m_startWorkCondition.notify_all();
+  void wait() noexcept {
+    // Kernels are often short, spin for a bit before going to sleep
+    for (unsigned spin = 0; spin < 1024; spin++) {
+      if (is_done()) {
+        return;
+      }
+      detail::cpu_relax();
     }
-    if (m_worker.joinable()) {
-      // Wait for the worker thread to finish handling the task queue
-      m_worker.join();
+    uint32_t count =
+        m_count.fetch_or(waitersFlag, std::memory_order_acq_rel) | waitersFlag;
+    while (count & countMask) {
+      detail::futex_wait(m_count, count);
+      count = m_count.load(std::memory_order_acquire);
     }
   }
 
-  // Checks whether the thread pool is currently running threads
-  inline bool is_running() const noexcept {
-    return m_isRunning.load(std::memory_order_acquire);
+  // Makes the next count down to zero call onDone instead of waking the
+  // waiters. The latch must not be waited on, and the count must not drop to
+  // zero before this is called.
+  void on_done(std::function<void()> onDone) {
+    m_onDone = std::move(onDone);
+    m_count.fetch_or(callbackFlag, std::memory_order_release);
   }
 
 private:
-  // Unique ID identifying the thread in the threadpool
-  const size_t m_threadId;
+  std::atomic<uint32_t> m_count{0};
+  std::function<void()> m_onDone;
+};
 
-  std::thread m_worker;
+namespace detail {
 
-  std::mutex m_workMutex;
+// A task scheduled on the thread pool. It's owned by whoever scheduled it and
+// must stay alive until its latch is counted down. Tasks without a latch own
+// themselves, and may destroy themselves in run().
+class task_t {
+public:
+  virtual ~task_t() = default;
 
-  std::condition_variable m_startWorkCondition;
+  // Runs the task on the worker identified by threadId, exceptions are kept
+  // in the task to be rethrown by the thread waiting on it
+  virtual void run(size_t threadId) noexcept = 0;
 
-  std::atomic<bool> m_isRunning;
+  completion_latch *m_latch = nullptr;
+  std::exception_ptr m_exception;
+};
 
-  std::queue<worker_task_t> m_tasks;
+template <typename F> class callable_task_t final : public task_t {
+public:
+  template <typename G>
+  explicit callable_task_t(G &&callable)
+      : m_callable(std::forward<G>(callable)) {}
+
+  void run(size_t threadId) noexcept override {
+    try {
+      m_callable(threadId);
+    } catch (...) {
+      m_exception = std::current_exception();
+    }
+  }
 
-  std::atomic<size_t> m_numTasks;
+private:
+  F m_callable;
 };
 
-// Implementation of a thread pool. The worker threads are created and
-// ready at construction. This class mainly holds the interface for
-// scheduling a task to the most appropriate thread and handling input
-// parameters and futures.
-class simple_thread_pool {
+// Chase-Lev work-stealing deque, as described in "Correct and Efficient
+// Work-Stealing for Weak Memory Models" (Lê et al., PPoPP 2013). The owner
+// pushes and pops at the bottom, other threads steal from the top.
+template <typename T> class chase_lev_deque {
+  static_assert(std::is_pointer_v<T>, "the deque holds pointers to tasks");
+
+  class ring_t {
+  public:
+    explicit ring_t(size_t capacity)
+        : m_mask(capacity - 1), m_slots(new std::atomic<T>[capacity]) {}
+
+    size_t capacity() const noexcept { return m_mask + 1; }
+
+    T load(int64_t index) const noexcept {
+      return m_slots[index & m_mask].load(std::memory_order_relaxed);
+    }
+
+    void store(int64_t index, T value) noexcept {
+      m_slots[index & m_mask].store(value, std::memory_order_relaxed);
+    }
+
+  private:
+    const size_t m_mask;
+    std::unique_ptr<std::atomic<T>[]> m_slots;
+  };
+
 public:
-  simple_thread_pool() noexcept
-      : m_isRunning(false), m_numThreads(get_num_threads()) {
-    for (size_t i = 0; i < m_numThreads; i++) {
-      m_workers.emplace_front(i);
+  explicit chase_lev_deque(size_t capacity = 256) {
+    m_rings.push_back(std::make_unique<ring_t>(capacity));
+    m_ring.store(m_rings.back().get(), std::memory_order_relaxed);
+  }
+
+  // Only called by the owner
+  void push(T value) {
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    int64_t top = m_top.load(std::memory_order_acquire);
+    ring_t *ring = m_ring.load(std::memory_order_relaxed);
+    if (bottom - top > static_cast<int64_t>(ring->capacity()) - 1) {
+      ring = grow(ring, top, bottom);
     }
-    m_isRunning.store(true, std::memory_order_release);
+    ring->store(bottom, value);
+    m_bottom.store(bottom + 1, std::memory_order_release);
   }
 
-  ~simple_thread_pool() {
-    for (auto &t : m_workers) {
-      t.stop();
+  // Only called by the owner, returns nullptr if the deque is empty
+  T pop() {
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    ring_t *ring = m_ring.load(std::memory_order_relaxed);
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+      m_bottom.store(bottom + 1, std::memory_order_relaxed);
+      return nullptr;
     }
-    m_isRunning.store(false, std::memory_order_release);
+
+    T value = ring->load(bottom);
+    if (top == bottom) {
+      // Last task, race against the thieves for it
+      if (!m_top.compare_exchange_strong(top, top + 1,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+        value = nullptr;
+      }
+      m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return value;
   }
 
-  inline void schedule(const worker_task_t &task) {
-    // Schedule the task on the best available worker thread
-    this->best_worker().schedule(task);
+  // Called by any thread, returns nullptr if the deque is empty or another
+  // thread took the task first
+  T steal() {
+    int64_t top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = m_bottom.load(std::memory_order_acquire);
+    if (top >= bottom) {
+      return nullptr;
+    }
+
+    ring_t *ring = m_ring.load(std::memory_order_acquire);
+    T value = ring->load(top);
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return value;
+  }
+
+  // Only an approximation when called while other threads use the deque
+  bool empty() const noexcept {
+    return m_bottom.load(std::memory_order_acquire) <=
+           m_top.load(std::memory_order_acquire);
   }
 
-  inline bool is_running() const noexcept {
-    return m_isRunning.load(std::memory_order_acquire);
+private:
+  ring_t *grow(ring_t *ring, int64_t top, int64_t bottom) {
+    auto bigger = std::make_unique<ring_t>(ring->capacity() * 2);
+    for (int64_t i = top; i < bottom; i++) {
+      bigger->store(i, ring->load(i));
+    }
+    // Thieves may still be reading the old ring, so it's only freed with the
+    // deque
+    m_rings.push_back(std::move(bigger));
+    m_ring.store(m_rings.back().get(), std::memory_order_release);
+    return m_rings.back().get();
   }
 
-  inline size_t num_threads() const noexcept { return m_numThreads; }
+  alignas(64) std::atomic<int64_t> m_top{0};
+  alignas(64) std::atomic<int64_t> m_bottom{0};
+  std::atomic<ring_t *> m_ring{nullptr};
+  std::vector<std::unique_ptr<ring_t>> m_rings;
+};
+
+// Implementation of a work-stealing thread pool. The worker threads are
+// created at construction, and pinned to CPUs according to the affinity.
+// Each worker runs the tasks of its own deque, then the tasks scheduled from
+// outside the pool for its NUMA node or for any node, then steals from the
+// workers of its node. Only then does it take work meant for other nodes.
+// Idle workers sleep on a futex until new tasks are scheduled.
+class work_stealing_thread_pool {
+  struct alignas(64) worker_t {
+    worker_t(work_stealing_thread_pool *pool, size_t threadId,
+             const placement_t &placement)
+        : m_pool(pool), m_threadId(threadId), m_cpu(placement.cpu),
+          m_node(placement.node), m_seed(threadId + 1) {}
+
+    work_stealing_thread_pool *const m_pool;
+    // Unique ID identifying the thread in the threadpool
+    const size_t m_threadId;
+    const std::optional<unsigned> m_cpu;
+    const size_t m_node;
+    uint32_t m_seed;
+    chase_lev_deque<task_t *> m_tasks;
+    std::thread m_thread;
+  };
+
+  // Tasks scheduled from outside the pool, for the workers of a node
+  struct alignas(64) injected_queue_t {
+    std::mutex m_mutex;
+    std::deque<task_t *> m_tasks;
+    std::atomic<size_t> m_size{0};
+    size_t m_numWorkers = 0;
+  };
+
+public:
+  work_stealing_thread_pool() : work_stealing_thread_pool(get_num_threads()) {}
+
+  explicit work_stealing_thread_pool(
+      size_t numThreads, const affinity_t &affinity = affinity_t::from_env())
+      : m_numThreads(std::max<size_t>(numThreads, 1)) {
+    auto placements =
+        place_workers(m_numThreads, affinity, cpu_topology_t::get());
+    // Numbers the nodes which have workers from 0
+    std::vector<size_t> nodes;
+    for (auto &placement : placements) {
+      nodes.push_back(placement.node);
+    }
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    m_numNodes = nodes.size();
+    // One queue per node, and the last one for any node
+    for (size_t i = 0; i <= m_numNodes; i++) {
+      m_injected.push_back(std::make_unique<injected_queue_t>());
+    }
+    m_injected[m_numNodes]->m_numWorkers = m_numThreads;
+
+    m_workers.reserve(m_numThreads);
+    for (size_t i = 0; i < m_numThreads; i++) {
+      placement_t &placement = placements[i];
+      placement.node = std::lower_bound(nodes.begin(), nodes.end(),
+                                        placement.node) -
+                       nodes.begin();
+      m_injected[placement.node]->m_numWorkers++;
+      m_workers.push_back(std::make_unique<worker_t>(this, i, placement));
+    }
+    for (auto &worker : m_workers) {
+      worker->m_thread = std::thread([this, w = worker.get()]() { run(*w); });
+    }
+  }
 
-  inline size_t num_pending_tasks() const noexcept {
-    return std::accumulate(std::begin(m_workers), std::end(m_workers),
-                           size_t(0),
-                           [](size_t numTasks, const worker_thread &t) {
-                             return (numTasks + t.num_pending_tasks());
-                           });
+  ~work_stealing_thread_pool() {
+    m_stop.store(true, std::memory_order_seq_cst);
+    m_epoch.fetch_add(1, std::memory_order_seq_cst);
+    futex_wake(m_epoch, INT32_MAX);
+    for (auto &worker : m_workers) {
+      worker->m_thread.join();
+    }
   }
 
-  void wait_for_all_pending_tasks() {
-    while (num_pending_tasks() > 0) {
-      std::this_thread::yield();
+  // Tasks scheduled by a worker for its own node, or any node, go to its own
+  // deque. The others go to the queue of the node, which idle workers take
+  // batches from.
+  void schedule(task_t *task, size_t node = any_node) {
+    if (node >= m_numNodes) {
+      node = any_node;
+    }
+    worker_t *worker = current_worker();
+    if (worker && worker->m_pool == this &&
+        (node == any_node || node == worker->m_node)) {
+      worker->m_tasks.push(task);
+    } else {
+      auto &queue = *m_injected[node == any_node ? m_numNodes : node];
+      std::lock_guard<std::mutex> lock(queue.m_mutex);
+      queue.m_tasks.push_back(task);
+      queue.m_size.store(queue.m_tasks.size(), std::memory_order_relaxed);
     }
+    notify();
   }
 
-protected:
-  // Determines which thread is the most appropriate for having work
-  // scheduled
-  worker_thread &best_worker() noexcept {
-    return *std::min_element(
-        std::begin(m_workers), std::end(m_workers),
-        [](const worker_thread &w1, const worker_thread &w2) {
-          // Prefer threads whose task queues are shorter
-          // This is just an approximation, it doesn't need to be exact
-          return (w1.num_pending_tasks() < w2.num_pending_tasks());
-        });
+  size_t num_threads() const noexcept { return m_numThreads; }
+
+  // The number of NUMA nodes the workers run on, 1 if they aren't pinned
+  size_t num_nodes() const noexcept { return m_numNodes; }
+
+  // The index of the NUMA node of the worker identified by threadId
+  size_t node_of(size_t threadId) const noexcept {
+    return m_workers[threadId]->m_node;
   }
 
 private:
@@ -185,11 +606,155 @@ private:
     return numThreads;
   }
 
-  std::forward_list<worker_thread> m_workers;
+  static worker_t *&current_worker() noexcept {
+    static thread_local worker_t *worker = nullptr;
+    return worker;
+  }
+
+  void notify() {
+    m_epoch.fetch_add(1, std::memory_order_seq_cst);
+    if (m_numSleeping.load(std::memory_order_seq_cst) > 0) {
+      futex_wake(m_epoch, 1);
+    }
+  }
 
-  std::atomic<bool> m_isRunning;
+  static void execute(task_t *task, size_t threadId) {
+    // The task may be destroyed as soon as its latch is counted down
+    completion_latch *latch = task->m_latch;
+    task->run(threadId);
+    if (latch) {
+      latch->count_down();
+    }
+  }
+
+  // Takes a share of the tasks of queue, the ones not returned go to the
+  // deque of worker for the others to steal
+  task_t *take_injected(worker_t &worker, injected_queue_t &queue) {
+    if (queue.m_size.load(std::memory_order_relaxed) == 0) {
+      return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(queue.m_mutex);
+    if (queue.m_tasks.empty()) {
+      return nullptr;
+    }
+    size_t count =
+        std::max<size_t>(queue.m_tasks.size() / queue.m_numWorkers, 1);
+    task_t *task = queue.m_tasks.front();
+    queue.m_tasks.pop_front();
+    for (size_t i = 1; i < count; i++) {
+      worker.m_tasks.push(queue.m_tasks.front());
+      queue.m_tasks.pop_front();
+    }
+    queue.m_size.store(queue.m_tasks.size(), std::memory_order_relaxed);
+    lock.unlock();
+
+    if (count > 1) {
+      notify();
+    }
+    return task;
+  }
+
+  // Steals from the workers of the node of worker if local, otherwise from
+  // the workers of the other nodes
+  task_t *steal(worker_t &worker, bool local) {
+    if (m_numThreads == 1) {
+      return nullptr;
+    }
+    // xorshift, to spread the thieves across the victims
+    worker.m_seed ^= worker.m_seed << 13;
+    worker.m_seed ^= worker.m_seed >> 17;
+    worker.m_seed ^= worker.m_seed << 5;
+    size_t first = worker.m_seed % m_numThreads;
+    for (size_t i = 0; i < m_numThreads; i++) {
+      worker_t &victim = *m_workers[(first + i) % m_numThreads];
+      if (&victim == &worker || (victim.m_node == worker.m_node) != local) {
+        continue;
+      }
+      if (task_t *task = victim.m_tasks.steal()) {
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  task_t *find_task(worker_t &worker) {
+    if (task_t *task = worker.m_tasks.pop()) {
+      return task;
+    }
+    if (task_t *task = take_injected(worker, *m_injected[worker.m_node])) {
+      return task;
+    }
+    if (task_t *task = take_injected(worker, *m_injected[m_numNodes])) {
+      return task;
+    }
+    if (task_t *task = steal(worker, true)) {
+      return task;
+    }
+    if (m_numNodes == 1) {
+      return nullptr;
+    }
+    // Nothing left on this node, help the others
+    for (size_t node = 0; node < m_numNodes; node++) {
+      if (node == worker.m_node) {
+        continue;
+      }
+      if (task_t *task = take_injected(worker, *m_injected[node])) {
+        return task;
+      }
+    }
+    return steal(worker, false);
+  }
+
+  void run(worker_t &worker) {
+    current_worker() = &worker;
+    if (worker.m_cpu) {
+      // The worker still runs, unpinned, if the CPU isn't available
+      pin_current_thread(*worker.m_cpu);
+    }
+    while (true) {
+      task_t *task = find_task(worker);
+      for (unsigned spin = 0; !task && spin < 256; spin++) {
+        cpu_relax();
+        task = find_task(worker);
+      }
+      if (task) {
+        execute(task, worker.m_threadId);
+        continue;
+      }
+
+      // Look for work once more after announcing that we are going to sleep,
+      // so that a task scheduled concurrently either is found or wakes us up
+      m_numSleeping.fetch_add(1, std::memory_order_seq_cst);
+      uint32_t epoch = m_epoch.load(std::memory_order_seq_cst);
+      task = find_task(worker);
+      if (!task && !m_stop.load(std::memory_order_seq_cst)) {
+        futex_wait(m_epoch, epoch);
+      }
+      m_numSleeping.fetch_sub(1, std::memory_order_seq_cst);
+
+      if (task) {
+        execute(task, worker.m_threadId);
+      } else if (m_stop.load(std::memory_order_seq_cst)) {
+        break;
+      }
+    }
+    current_worker() = nullptr;
+  }
 
   const size_t m_numThreads;
+
+  size_t m_numNodes = 1;
+
+  std::vector<std::unique_ptr<worker_t>> m_workers;
+
+  std::vector<std::unique_ptr<injected_queue_t>> m_injected;
+
+  // Bumped whenever tasks are scheduled, idle workers sleep on it
+  alignas(64) std::atomic<uint32_t> m_epoch{0};
+
+  std::atomic<uint32_t> m_numSleeping{0};
+
+  std::atomic<bool> m_stop{false};
 };
 } // namespace detail
 
@@ -199,16 +764,100 @@ template <typename ThreadPoolT> class threadpool_interface {
 public:
   size_t num_threads() const noexcept { return threadpool.num_threads(); }
 
+  size_t num_nodes() const noexcept { return threadpool.num_nodes(); }
+
+  size_t node_of(size_t threadId) const noexcept {
+    return threadpool.node_of(threadId);
+  }
+
   threadpool_interface() : threadpool() {}
 
-  auto schedule_task(worker_task_t &&task) {
-    auto workerTask = std::make_shared<std::packaged_task<void(size_t)>>(
-        [task](auto &&PH1) { return task(std::forward<decltype(PH1)>(PH1)); });
-    threadpool.schedule([=](size_t threadId) { (*workerTask)(threadId); });
-    return workerTask->get_future();
+  explicit threadpool_interface(size_t numThreads) : threadpool(numThreads) {}
+
+  threadpool_interface(size_t numThreads, const detail::affinity_t &affinity)
+      : threadpool(numThreads, affinity) {}
+
+  void schedule_task(detail::task_t *task, size_t node = any_node) {
+    threadpool.schedule(task, node);
   }
 };
 
-using threadpool_t = threadpool_interface<detail::simple_thread_pool>;
+using threadpool_t = threadpool_interface<detail::work_stealing_thread_pool>;
+
+// A batch of tasks scheduled on a thread pool. Each task is called with the
+// ID of the worker running it, in [0, num_threads()).
+class task_group_t {
+public:
+  explicit task_group_t(threadpool_t &tp) : m_tp(tp) {
+    // Held until wait() or notify(), so that the count can't drop to zero
+    // while tasks are still being scheduled
+    m_latch.add(1);
+  }
+
+  task_group_t(const task_group_t &) = delete;
+  task_group_t &operator=(const task_group_t &) = delete;
+
+  ~task_group_t() {
+    if (!m_notified) {
+      m_latch.count_down();
+      m_latch.wait();
+    }
+  }
+
+  // Schedules task on the workers of node, or on any worker
+  template <typename F> void schedule(F &&task, size_t node = any_node) {
+    auto workerTask =
+        std::make_unique<detail::callable_task_t<std::decay_t<F>>>(
+            std::forward<F>(task));
+    workerTask->m_latch = &m_latch;
+    m_tasks.push_back(std::move(workerTask));
+    m_latch.add(1);
+    m_tp.schedule_task(m_tasks.back().get(), node);
+  }
+
+  // Schedules a task owned by the caller, which must outlive the group. Its
+  // exception isn't rethrown by the group, the caller checks the task.
+  void schedule_task(detail::task_t &task, size_t node = any_node) {
+    task.m_latch = &m_latch;
+    m_latch.add(1);
+    m_tp.schedule_task(&task, node);
+  }
+
+  // Waits for all the tasks scheduled so far, and rethrows the first
+  // exception thrown by one of them
+  void wait() {
+    m_latch.count_down();
+    m_latch.wait();
+    m_latch.add(1);
+    if (auto exception = first_exception()) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  // Calls onDone, without blocking, on the thread finishing the last task or
+  // on this one if they are all done. No more tasks can be scheduled, and
+  // onDone may destroy the group.
+  void notify(std::function<void()> onDone) {
+    m_notified = true;
+    m_latch.on_done(std::move(onDone));
+    m_latch.count_down();
+  }
+
+  // The first exception thrown by the tasks, once they are done
+  std::exception_ptr first_exception() const {
+    for (auto &task : m_tasks) {
+      if (task->m_exception) {
+        return task->m_exception;
+      }
+    }
+    return nullptr;
+  }
+
+private:
+  threadpool_t &m_tp;
+  completion_latch m_latch;
+  std::vector<std::unique_ptr<detail::task_t>> m_tasks;
+  bool m_notified = false;
+};
 
 } // namespace native_cpu
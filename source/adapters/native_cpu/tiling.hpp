@@ -0,0 +1,218 @@
+//===----------- tiling.hpp - Native CPU Adapter --------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "threadpool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace native_cpu {
+
+// Groups neighbouring work groups of a multi-dimensional launch into tiles,
+// which are run in a space-filling order so that the work groups running
+// together on a core share the data they load, e.g. the halo of a stencil or
+// the rows and columns of a matrix block.
+struct tiling_t {
+  using range_t = std::array<size_t, 3>;
+
+  // In work groups, the tiles at the end of a dimension may be smaller
+  range_t tileSize;
+  range_t numTiles;
+
+  size_t count() const { return numTiles[0] * numTiles[1] * numTiles[2]; }
+
+  // The first work group of tile, numbered with dimension 0 varying fastest
+  range_t origin(size_t tile) const {
+    return {tile % numTiles[0] * tileSize[0],
+            tile / numTiles[0] % numTiles[1] * tileSize[1],
+            tile / (numTiles[0] * numTiles[1]) * tileSize[2]};
+  }
+
+  // The tiles in Morton order, so that consecutive tiles, and the batches of
+  // them taken by the workers, are close to each other in every dimension
+  std::vector<size_t> order() const {
+    std::vector<std::pair<uint64_t, size_t>> keys(count());
+    for (size_t tile = 0; tile < keys.size(); tile++) {
+      range_t coords = {tile % numTiles[0], tile / numTiles[0] % numTiles[1],
+                        tile / (numTiles[0] * numTiles[1])};
+      uint64_t key = 0;
+      // 21 bits per dimension fit in the key
+      for (unsigned bit = 0; bit < 21; bit++) {
+        for (unsigned dim = 0; dim < 3; dim++) {
+          key |= uint64_t((coords[dim] >> bit) & 1) << (bit * 3 + dim);
+        }
+      }
+      keys[tile] = {key, tile};
+    }
+    std::sort(keys.begin(), keys.end());
+    std::vector<size_t> tiles;
+    tiles.reserve(keys.size());
+    for (auto &key : keys) {
+      tiles.push_back(key.second);
+    }
+    return tiles;
+  }
+
+  // Sizes the tiles for numWG work groups of localSize work items, so that
+  // the data of a tile fits in cacheBytes, and that there are enough tiles
+  // to keep numThreads workers busy. The size is forced to tileSize instead
+  // when it's given.
+  static tiling_t make(const range_t &numWG, const range_t &localSize,
+                       size_t numThreads, size_t cacheBytes,
+                       const std::optional<range_t> &tileSize = std::nullopt) {
+    // A guess of the data touched by a work item, e.g. a few floats loaded
+    // and one stored
+    constexpr size_t bytesPerWorkItem = 32;
+    constexpr size_t tilesPerThread = 4;
+
+    tiling_t tiling;
+    range_t &tile = tiling.tileSize;
+    if (tileSize) {
+      for (unsigned dim = 0; dim < 3; dim++) {
+        tile[dim] = std::clamp<size_t>((*tileSize)[dim], 1, numWG[dim]);
+      }
+    } else {
+      auto items = [&localSize](const range_t &groups) {
+        return groups[0] * localSize[0] * groups[1] * localSize[1] *
+               groups[2] * localSize[2];
+      };
+      size_t maxItems = cacheBytes / bytesPerWorkItem;
+      tile = {1, 1, 1};
+      // Doubles the tile in the dimension where it's the shortest in work
+      // items, so that it stays close to a cube
+      while (true) {
+        int shortest = -1;
+        for (unsigned dim = 0; dim < 3; dim++) {
+          if (tile[dim] < numWG[dim] &&
+              (shortest < 0 || tile[dim] * localSize[dim] <
+                                   tile[shortest] * localSize[shortest])) {
+            shortest = dim;
+          }
+        }
+        if (shortest < 0) {
+          break;
+        }
+        range_t bigger = tile;
+        bigger[shortest] = std::min(tile[shortest] * 2, numWG[shortest]);
+        if (items(bigger) > maxItems) {
+          break;
+        }
+        tile = bigger;
+      }
+      // Load balancing matters more than locality
+      while (tiling.countFor(numWG) < numThreads * tilesPerThread) {
+        auto largest = std::max_element(tile.begin(), tile.end());
+        if (*largest == 1) {
+          break;
+        }
+        *largest = (*largest + 1) / 2;
+      }
+    }
+    for (unsigned dim = 0; dim < 3; dim++) {
+      tiling.numTiles[dim] = (numWG[dim] + tile[dim] - 1) / tile[dim];
+    }
+    return tiling;
+  }
+
+  // The size of the cache private to a core, from the sysfs entry of the last
+  // cache level not shared with other cores, or a default for typical L2
+  // caches when it's unknown
+  static size_t per_core_cache_size() {
+    static const size_t size = [] {
+      size_t best = 0;
+#if defined(__linux__)
+      const std::string dir = "/sys/devices/system/cpu/cpu0/cache/index";
+      for (unsigned index = 0;; index++) {
+        std::ifstream levelFile(dir + std::to_string(index) + "/level");
+        if (!levelFile) {
+          break;
+        }
+        unsigned level = 0;
+        levelFile >> level;
+        std::ifstream typeFile(dir + std::to_string(index) + "/type");
+        std::string type;
+        typeFile >> type;
+        std::ifstream sizeFile(dir + std::to_string(index) + "/size");
+        size_t bytes = 0;
+        std::string unit;
+        sizeFile >> bytes >> unit;
+        if (unit == "K") {
+          bytes *= 1024;
+        } else if (unit == "M") {
+          bytes *= 1024 * 1024;
+        }
+        std::ifstream sharedFile(dir + std::to_string(index) +
+                                 "/shared_cpu_list");
+        std::string shared;
+        std::getline(sharedFile, shared);
+        size_t numShared =
+            std::max<size_t>(detail::parse_cpu_list(shared).size(), 1);
+        // Caches shared by a few hyper threads still count as private
+        if (type != "Instruction" && level >= 2 && numShared <= 2 &&
+            bytes / numShared > best) {
+          best = bytes / numShared;
+        }
+      }
+#endif
+      return best ? best : size_t{512 * 1024};
+    }();
+    return size;
+  }
+
+  // The tile size set by SYCL_NATIVE_CPU_TILE_SIZE, as up to three sizes in
+  // work groups, e.g. "8,8". It's nullopt when unset, for automatic tiles,
+  // and all zeros with "0", which disables the tiling.
+  static std::optional<range_t> tile_size_from_env() {
+    static const std::optional<range_t> tileSize =
+        []() -> std::optional<range_t> {
+      const char *envVar = std::getenv("SYCL_NATIVE_CPU_TILE_SIZE");
+      if (!envVar) {
+        return std::nullopt;
+      }
+      std::string value = envVar;
+      if (value == "0") {
+        return range_t{0, 0, 0};
+      }
+      range_t size = {1, 1, 1};
+      size_t pos = 0;
+      for (unsigned dim = 0; dim < 3 && pos <= value.size(); dim++) {
+        size_t end = std::min(value.find(',', pos), value.size());
+        try {
+          size[dim] = std::stoul(value.substr(pos, end - pos));
+        } catch (...) {
+          return std::nullopt;
+        }
+        pos = end + 1;
+      }
+      return size;
+    }();
+    return tileSize;
+  }
+
+private:
+  size_t countFor(const range_t &numWG) const {
+    size_t tiles = 1;
+    for (unsigned dim = 0; dim < 3; dim++) {
+      tiles *= (numWG[dim] + tileSize[dim] - 1) / tileSize[dim];
+    }
+    return tiles;
+  }
+};
+
+} // namespace native_cpu
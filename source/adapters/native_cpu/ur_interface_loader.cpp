@@ -11,6 +11,8 @@
 #include <ur_api.h>
 #include <ur_ddi.h>
 
+#include "ur_interface_loader.hpp"
+
 namespace {
 
 // TODO - this is a duplicate of what is in the L0 plugin
@@ -28,7 +30,11 @@ ur_result_t validateProcInputs(ur_api_version_t version, void *pDdiTable) {
 }
 } // namespace
 
+#ifdef UR_STATIC_ADAPTER_NATIVE_CPU
+namespace ur::native_cpu {
+#elif defined(__cplusplus)
 extern "C" {
+#endif
 
 UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
     ur_api_version_t version, ur_platform_dditable_t *pDdiTable) {
@@ -36,12 +42,13 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreateWithNativeHandle = urPlatformCreateWithNativeHandle;
-  pDdiTable->pfnGet = urPlatformGet;
-  pDdiTable->pfnGetApiVersion = urPlatformGetApiVersion;
-  pDdiTable->pfnGetInfo = urPlatformGetInfo;
-  pDdiTable->pfnGetNativeHandle = urPlatformGetNativeHandle;
-  pDdiTable->pfnGetBackendOption = urPlatformGetBackendOption;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::native_cpu::urPlatformCreateWithNativeHandle;
+  pDdiTable->pfnGet = ur::native_cpu::urPlatformGet;
+  pDdiTable->pfnGetApiVersion = ur::native_cpu::urPlatformGetApiVersion;
+  pDdiTable->pfnGetInfo = ur::native_cpu::urPlatformGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::native_cpu::urPlatformGetNativeHandle;
+  pDdiTable->pfnGetBackendOption = ur::native_cpu::urPlatformGetBackendOption;
   return UR_RESULT_SUCCESS;
 }
 
@@ -51,13 +58,15 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetContextProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urContextCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urContextCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urContextGetInfo;
-  pDdiTable->pfnGetNativeHandle = urContextGetNativeHandle;
-  pDdiTable->pfnRelease = urContextRelease;
-  pDdiTable->pfnRetain = urContextRetain;
-  pDdiTable->pfnSetExtendedDeleter = urContextSetExtendedDeleter;
+  pDdiTable->pfnCreate = ur::native_cpu::urContextCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::native_cpu::urContextCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::native_cpu::urContextGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::native_cpu::urContextGetNativeHandle;
+  pDdiTable->pfnRelease = ur::native_cpu::urContextRelease;
+  pDdiTable->pfnRetain = ur::native_cpu::urContextRetain;
+  pDdiTable->pfnSetExtendedDeleter =
+      ur::native_cpu::urContextSetExtendedDeleter;
   return UR_RESULT_SUCCESS;
 }
 
@@ -67,14 +76,27 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreateWithNativeHandle = urEventCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urEventGetInfo;
-  pDdiTable->pfnGetNativeHandle = urEventGetNativeHandle;
-  pDdiTable->pfnGetProfilingInfo = urEventGetProfilingInfo;
-  pDdiTable->pfnRelease = urEventRelease;
-  pDdiTable->pfnRetain = urEventRetain;
-  pDdiTable->pfnSetCallback = urEventSetCallback;
-  pDdiTable->pfnWait = urEventWait;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::native_cpu::urEventCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::native_cpu::urEventGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::native_cpu::urEventGetNativeHandle;
+  pDdiTable->pfnGetProfilingInfo = ur::native_cpu::urEventGetProfilingInfo;
+  pDdiTable->pfnRelease = ur::native_cpu::urEventRelease;
+  pDdiTable->pfnRetain = ur::native_cpu::urEventRetain;
+  pDdiTable->pfnSetCallback = ur::native_cpu::urEventSetCallback;
+  pDdiTable->pfnWait = ur::native_cpu::urEventWait;
+  return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ur_event_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnWaitAnyExp = ur::native_cpu::urEventWaitAnyExp;
+  pDdiTable->pfnGetExecutionStatusExp =
+      ur::native_cpu::urEventGetExecutionStatusExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -84,21 +106,24 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnBuild = urProgramBuild;
-  pDdiTable->pfnCompile = urProgramCompile;
-  pDdiTable->pfnCreateWithBinary = urProgramCreateWithBinary;
-  pDdiTable->pfnCreateWithIL = urProgramCreateWithIL;
-  pDdiTable->pfnCreateWithNativeHandle = urProgramCreateWithNativeHandle;
-  pDdiTable->pfnGetBuildInfo = urProgramGetBuildInfo;
-  pDdiTable->pfnGetFunctionPointer = urProgramGetFunctionPointer;
-  pDdiTable->pfnGetGlobalVariablePointer = urProgramGetGlobalVariablePointer;
-  pDdiTable->pfnGetInfo = urProgramGetInfo;
-  pDdiTable->pfnGetNativeHandle = urProgramGetNativeHandle;
-  pDdiTable->pfnLink = urProgramLink;
-  pDdiTable->pfnRelease = urProgramRelease;
-  pDdiTable->pfnRetain = urProgramRetain;
+  pDdiTable->pfnBuild = ur::native_cpu::urProgramBuild;
+  pDdiTable->pfnCompile = ur::native_cpu::urProgramCompile;
+  pDdiTable->pfnCreateWithBinary = ur::native_cpu::urProgramCreateWithBinary;
+  pDdiTable->pfnCreateWithIL = ur::native_cpu::urProgramCreateWithIL;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::native_cpu::urProgramCreateWithNativeHandle;
+  pDdiTable->pfnGetBuildInfo = ur::native_cpu::urProgramGetBuildInfo;
+  pDdiTable->pfnGetFunctionPointer =
+      ur::native_cpu::urProgramGetFunctionPointer;
+  pDdiTable->pfnGetGlobalVariablePointer =
+      ur::native_cpu::urProgramGetGlobalVariablePointer;
+  pDdiTable->pfnGetInfo = ur::native_cpu::urProgramGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::native_cpu::urProgramGetNativeHandle;
+  pDdiTable->pfnLink = ur::native_cpu::urProgramLink;
+  pDdiTable->pfnRelease = ur::native_cpu::urProgramRelease;
+  pDdiTable->pfnRetain = ur::native_cpu::urProgramRetain;
   pDdiTable->pfnSetSpecializationConstants =
-      urProgramSetSpecializationConstants;
+      ur::native_cpu::urProgramSetSpecializationConstants;
   return UR_RESULT_SUCCESS;
 }
 
@@ -108,22 +133,25 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urKernelCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urKernelCreateWithNativeHandle;
-  pDdiTable->pfnGetGroupInfo = urKernelGetGroupInfo;
-  pDdiTable->pfnGetInfo = urKernelGetInfo;
-  pDdiTable->pfnGetNativeHandle = urKernelGetNativeHandle;
-  pDdiTable->pfnGetSubGroupInfo = urKernelGetSubGroupInfo;
-  pDdiTable->pfnRelease = urKernelRelease;
-  pDdiTable->pfnRetain = urKernelRetain;
-  pDdiTable->pfnSetArgLocal = urKernelSetArgLocal;
-  pDdiTable->pfnSetArgMemObj = urKernelSetArgMemObj;
-  pDdiTable->pfnSetArgPointer = urKernelSetArgPointer;
-  pDdiTable->pfnSetArgSampler = urKernelSetArgSampler;
-  pDdiTable->pfnSetArgValue = urKernelSetArgValue;
-  pDdiTable->pfnSetExecInfo = urKernelSetExecInfo;
-  pDdiTable->pfnSetSpecializationConstants = urKernelSetSpecializationConstants;
-  pDdiTable->pfnGetSuggestedLocalWorkSize = urKernelGetSuggestedLocalWorkSize;
+  pDdiTable->pfnCreate = ur::native_cpu::urKernelCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::native_cpu::urKernelCreateWithNativeHandle;
+  pDdiTable->pfnGetGroupInfo = ur::native_cpu::urKernelGetGroupInfo;
+  pDdiTable->pfnGetInfo = ur::native_cpu::urKernelGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::native_cpu::urKernelGetNativeHandle;
+  pDdiTable->pfnGetSubGroupInfo = ur::native_cpu::urKernelGetSubGroupInfo;
+  pDdiTable->pfnRelease = ur::native_cpu::urKernelRelease;
+  pDdiTable->pfnRetain = ur::native_cpu::urKernelRetain;
+  pDdiTable->pfnSetArgLocal = ur::native_cpu::urKernelSetArgLocal;
+  pDdiTable->pfnSetArgMemObj = ur::native_cpu::urKernelSetArgMemObj;
+  pDdiTable->pfnSetArgPointer = ur::native_cpu::urKernelSetArgPointer;
+  pDdiTable->pfnSetArgSampler = ur::native_cpu::urKernelSetArgSampler;
+  pDdiTable->pfnSetArgValue = ur::native_cpu::urKernelSetArgValue;
+  pDdiTable->pfnSetExecInfo = ur::native_cpu::urKernelSetExecInfo;
+  pDdiTable->pfnSetSpecializationConstants =
+      ur::native_cpu::urKernelSetSpecializationConstants;
+  pDdiTable->pfnGetSuggestedLocalWorkSize =
+      ur::native_cpu::urKernelGetSuggestedLocalWorkSize;
   return UR_RESULT_SUCCESS;
 }
 
@@ -133,12 +161,13 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetSamplerProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urSamplerCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urSamplerCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urSamplerGetInfo;
-  pDdiTable->pfnGetNativeHandle = urSamplerGetNativeHandle;
-  pDdiTable->pfnRelease = urSamplerRelease;
-  pDdiTable->pfnRetain = urSamplerRetain;
+  pDdiTable->pfnCreate = ur::native_cpu::urSamplerCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::native_cpu::urSamplerCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::native_cpu::urSamplerGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::native_cpu::urSamplerGetNativeHandle;
+  pDdiTable->pfnRelease = ur::native_cpu::urSamplerRelease;
+  pDdiTable->pfnRetain = ur::native_cpu::urSamplerRetain;
   return UR_RESULT_SUCCESS;
 }
 
@@ -148,17 +177,18 @@ urGetMemProcAddrTable(ur_api_version_t version, ur_mem_dditable_t *pDdiTable) {
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnBufferCreate = urMemBufferCreate;
-  pDdiTable->pfnBufferPartition = urMemBufferPartition;
+  pDdiTable->pfnBufferCreate = ur::native_cpu::urMemBufferCreate;
+  pDdiTable->pfnBufferPartition = ur::native_cpu::urMemBufferPartition;
   pDdiTable->pfnBufferCreateWithNativeHandle =
-      urMemBufferCreateWithNativeHandle;
-  pDdiTable->pfnImageCreateWithNativeHandle = urMemImageCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urMemGetInfo;
-  pDdiTable->pfnGetNativeHandle = urMemGetNativeHandle;
-  pDdiTable->pfnImageCreate = urMemImageCreate;
-  pDdiTable->pfnImageGetInfo = urMemImageGetInfo;
-  pDdiTable->pfnRelease = urMemRelease;
-  pDdiTable->pfnRetain = urMemRetain;
+      ur::native_cpu::urMemBufferCreateWithNativeHandle;
+  pDdiTable->pfnImageCreateWithNativeHandle =
+      ur::native_cpu::urMemImageCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::native_cpu::urMemGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::native_cpu::urMemGetNativeHandle;
+  pDdiTable->pfnImageCreate = ur::native_cpu::urMemImageCreate;
+  pDdiTable->pfnImageGetInfo = ur::native_cpu::urMemImageGetInfo;
+  pDdiTable->pfnRelease = ur::native_cpu::urMemRelease;
+  pDdiTable->pfnRetain = ur::native_cpu::urMemRetain;
   return UR_RESULT_SUCCESS;
 }
 
@@ -168,31 +198,35 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnDeviceGlobalVariableRead = urEnqueueDeviceGlobalVariableRead;
-  pDdiTable->pfnDeviceGlobalVariableWrite = urEnqueueDeviceGlobalVariableWrite;
-  pDdiTable->pfnEventsWait = urEnqueueEventsWait;
-  pDdiTable->pfnEventsWaitWithBarrier = urEnqueueEventsWaitWithBarrier;
-  pDdiTable->pfnKernelLaunch = urEnqueueKernelLaunch;
-  pDdiTable->pfnMemBufferCopy = urEnqueueMemBufferCopy;
-  pDdiTable->pfnMemBufferCopyRect = urEnqueueMemBufferCopyRect;
-  pDdiTable->pfnMemBufferFill = urEnqueueMemBufferFill;
-  pDdiTable->pfnMemBufferMap = urEnqueueMemBufferMap;
-  pDdiTable->pfnMemBufferRead = urEnqueueMemBufferRead;
-  pDdiTable->pfnMemBufferReadRect = urEnqueueMemBufferReadRect;
-  pDdiTable->pfnMemBufferWrite = urEnqueueMemBufferWrite;
-  pDdiTable->pfnMemBufferWriteRect = urEnqueueMemBufferWriteRect;
-  pDdiTable->pfnMemImageCopy = urEnqueueMemImageCopy;
-  pDdiTable->pfnMemImageRead = urEnqueueMemImageRead;
-  pDdiTable->pfnMemImageWrite = urEnqueueMemImageWrite;
-  pDdiTable->pfnMemUnmap = urEnqueueMemUnmap;
-  pDdiTable->pfnUSMFill2D = urEnqueueUSMFill2D;
-  pDdiTable->pfnUSMFill = urEnqueueUSMFill;
-  pDdiTable->pfnUSMAdvise = urEnqueueUSMAdvise;
-  pDdiTable->pfnUSMMemcpy2D = urEnqueueUSMMemcpy2D;
-  pDdiTable->pfnUSMMemcpy = urEnqueueUSMMemcpy;
-  pDdiTable->pfnUSMPrefetch = urEnqueueUSMPrefetch;
-  pDdiTable->pfnReadHostPipe = urEnqueueReadHostPipe;
-  pDdiTable->pfnWriteHostPipe = urEnqueueWriteHostPipe;
+  pDdiTable->pfnDeviceGlobalVariableRead =
+      ur::native_cpu::urEnqueueDeviceGlobalVariableRead;
+  pDdiTable->pfnDeviceGlobalVariableWrite =
+      ur::native_cpu::urEnqueueDeviceGlobalVariableWrite;
+  pDdiTable->pfnEventsWait = ur::native_cpu::urEnqueueEventsWait;
+  pDdiTable->pfnEventsWaitWithBarrier =
+      ur::native_cpu::urEnqueueEventsWaitWithBarrier;
+  pDdiTable->pfnKernelLaunch = ur::native_cpu::urEnqueueKernelLaunch;
+  pDdiTable->pfnMemBufferCopy = ur::native_cpu::urEnqueueMemBufferCopy;
+  pDdiTable->pfnMemBufferCopyRect = ur::native_cpu::urEnqueueMemBufferCopyRect;
+  pDdiTable->pfnMemBufferFill = ur::native_cpu::urEnqueueMemBufferFill;
+  pDdiTable->pfnMemBufferMap = ur::native_cpu::urEnqueueMemBufferMap;
+  pDdiTable->pfnMemBufferRead = ur::native_cpu::urEnqueueMemBufferRead;
+  pDdiTable->pfnMemBufferReadRect = ur::native_cpu::urEnqueueMemBufferReadRect;
+  pDdiTable->pfnMemBufferWrite = ur::native_cpu::urEnqueueMemBufferWrite;
+  pDdiTable->pfnMemBufferWriteRect =
+      ur::native_cpu::urEnqueueMemBufferWriteRect;
+  pDdiTable->pfnMemImageCopy = ur::native_cpu::urEnqueueMemImageCopy;
+  pDdiTable->pfnMemImageRead = ur::native_cpu::urEnqueueMemImageRead;
+  pDdiTable->pfnMemImageWrite = ur::native_cpu::urEnqueueMemImageWrite;
+  pDdiTable->pfnMemUnmap = ur::native_cpu::urEnqueueMemUnmap;
+  pDdiTable->pfnUSMFill2D = ur::native_cpu::urEnqueueUSMFill2D;
+  pDdiTable->pfnUSMFill = ur::native_cpu::urEnqueueUSMFill;
+  pDdiTable->pfnUSMAdvise = ur::native_cpu::urEnqueueUSMAdvise;
+  pDdiTable->pfnUSMMemcpy2D = ur::native_cpu::urEnqueueUSMMemcpy2D;
+  pDdiTable->pfnUSMMemcpy = ur::native_cpu::urEnqueueUSMMemcpy;
+  pDdiTable->pfnUSMPrefetch = ur::native_cpu::urEnqueueUSMPrefetch;
+  pDdiTable->pfnReadHostPipe = ur::native_cpu::urEnqueueReadHostPipe;
+  pDdiTable->pfnWriteHostPipe = ur::native_cpu::urEnqueueWriteHostPipe;
   return UR_RESULT_SUCCESS;
 }
 
@@ -202,10 +236,10 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnAdapterGet = urAdapterGet;
-  pDdiTable->pfnAdapterGetInfo = urAdapterGetInfo;
-  pDdiTable->pfnAdapterRelease = urAdapterRelease;
-  pDdiTable->pfnAdapterRetain = urAdapterRetain;
+  pDdiTable->pfnAdapterGet = ur::native_cpu::urAdapterGet;
+  pDdiTable->pfnAdapterGetInfo = ur::native_cpu::urAdapterGetInfo;
+  pDdiTable->pfnAdapterRelease = ur::native_cpu::urAdapterRelease;
+  pDdiTable->pfnAdapterRetain = ur::native_cpu::urAdapterRetain;
   return UR_RESULT_SUCCESS;
 }
 
@@ -215,14 +249,28 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreate = urQueueCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urQueueCreateWithNativeHandle;
-  pDdiTable->pfnFinish = urQueueFinish;
-  pDdiTable->pfnFlush = urQueueFlush;
-  pDdiTable->pfnGetInfo = urQueueGetInfo;
-  pDdiTable->pfnGetNativeHandle = urQueueGetNativeHandle;
-  pDdiTable->pfnRelease = urQueueRelease;
-  pDdiTable->pfnRetain = urQueueRetain;
+  pDdiTable->pfnCreate = ur::native_cpu::urQueueCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::native_cpu::urQueueCreateWithNativeHandle;
+  pDdiTable->pfnFinish = ur::native_cpu::urQueueFinish;
+  pDdiTable->pfnFlush = ur::native_cpu::urQueueFlush;
+  pDdiTable->pfnGetInfo = ur::native_cpu::urQueueGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::native_cpu::urQueueGetNativeHandle;
+  pDdiTable->pfnRelease = ur::native_cpu::urQueueRelease;
+  pDdiTable->pfnRetain = ur::native_cpu::urQueueRetain;
+  return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ur_queue_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnReserveTimestampMarkersExp =
+      ur::native_cpu::urQueueReserveTimestampMarkersExp;
+  pDdiTable->pfnReadTimestampMarkersExp =
+      ur::native_cpu::urQueueReadTimestampMarkersExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -232,15 +280,15 @@ urGetUSMProcAddrTable(ur_api_version_t version, ur_usm_dditable_t *pDdiTable) {
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnDeviceAlloc = urUSMDeviceAlloc;
-  pDdiTable->pfnFree = urUSMFree;
-  pDdiTable->pfnGetMemAllocInfo = urUSMGetMemAllocInfo;
-  pDdiTable->pfnHostAlloc = urUSMHostAlloc;
-  pDdiTable->pfnPoolCreate = urUSMPoolCreate;
-  pDdiTable->pfnPoolRetain = urUSMPoolRetain;
-  pDdiTable->pfnPoolRelease = urUSMPoolRelease;
-  pDdiTable->pfnPoolGetInfo = urUSMPoolGetInfo;
-  pDdiTable->pfnSharedAlloc = urUSMSharedAlloc;
+  pDdiTable->pfnDeviceAlloc = ur::native_cpu::urUSMDeviceAlloc;
+  pDdiTable->pfnFree = ur::native_cpu::urUSMFree;
+  pDdiTable->pfnGetMemAllocInfo = ur::native_cpu::urUSMGetMemAllocInfo;
+  pDdiTable->pfnHostAlloc = ur::native_cpu::urUSMHostAlloc;
+  pDdiTable->pfnPoolCreate = ur::native_cpu::urUSMPoolCreate;
+  pDdiTable->pfnPoolRetain = ur::native_cpu::urUSMPoolRetain;
+  pDdiTable->pfnPoolRelease = ur::native_cpu::urUSMPoolRelease;
+  pDdiTable->pfnPoolGetInfo = ur::native_cpu::urUSMPoolGetInfo;
+  pDdiTable->pfnSharedAlloc = ur::native_cpu::urUSMSharedAlloc;
   return UR_RESULT_SUCCESS;
 }
 
@@ -250,15 +298,17 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetDeviceProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnCreateWithNativeHandle = urDeviceCreateWithNativeHandle;
-  pDdiTable->pfnGet = urDeviceGet;
-  pDdiTable->pfnGetGlobalTimestamps = urDeviceGetGlobalTimestamps;
-  pDdiTable->pfnGetInfo = urDeviceGetInfo;
-  pDdiTable->pfnGetNativeHandle = urDeviceGetNativeHandle;
-  pDdiTable->pfnPartition = urDevicePartition;
-  pDdiTable->pfnRelease = urDeviceRelease;
-  pDdiTable->pfnRetain = urDeviceRetain;
-  pDdiTable->pfnSelectBinary = urDeviceSelectBinary;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::native_cpu::urDeviceCreateWithNativeHandle;
+  pDdiTable->pfnGet = ur::native_cpu::urDeviceGet;
+  pDdiTable->pfnGetGlobalTimestamps =
+      ur::native_cpu::urDeviceGetGlobalTimestamps;
+  pDdiTable->pfnGetInfo = ur::native_cpu::urDeviceGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::native_cpu::urDeviceGetNativeHandle;
+  pDdiTable->pfnPartition = ur::native_cpu::urDevicePartition;
+  pDdiTable->pfnRelease = ur::native_cpu::urDeviceRelease;
+  pDdiTable->pfnRetain = ur::native_cpu::urDeviceRetain;
+  pDdiTable->pfnSelectBinary = ur::native_cpu::urDeviceSelectBinary;
   return UR_RESULT_SUCCESS;
 }
 
@@ -268,28 +318,36 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
   if (UR_RESULT_SUCCESS != retVal) {
     return retVal;
   }
-  pDdiTable->pfnCreateExp = urCommandBufferCreateExp;
-  pDdiTable->pfnRetainExp = urCommandBufferRetainExp;
-  pDdiTable->pfnReleaseExp = urCommandBufferReleaseExp;
-  pDdiTable->pfnFinalizeExp = urCommandBufferFinalizeExp;
-  pDdiTable->pfnAppendKernelLaunchExp = urCommandBufferAppendKernelLaunchExp;
-  pDdiTable->pfnAppendUSMMemcpyExp = urCommandBufferAppendUSMMemcpyExp;
-  pDdiTable->pfnAppendMemBufferCopyExp = urCommandBufferAppendMemBufferCopyExp;
+  pDdiTable->pfnCreateExp = ur::native_cpu::urCommandBufferCreateExp;
+  pDdiTable->pfnRetainExp = ur::native_cpu::urCommandBufferRetainExp;
+  pDdiTable->pfnReleaseExp = ur::native_cpu::urCommandBufferReleaseExp;
+  pDdiTable->pfnFinalizeExp = ur::native_cpu::urCommandBufferFinalizeExp;
+  pDdiTable->pfnAppendKernelLaunchExp =
+      ur::native_cpu::urCommandBufferAppendKernelLaunchExp;
+  pDdiTable->pfnAppendUSMMemcpyExp =
+      ur::native_cpu::urCommandBufferAppendUSMMemcpyExp;
+  pDdiTable->pfnAppendMemBufferCopyExp =
+      ur::native_cpu::urCommandBufferAppendMemBufferCopyExp;
   pDdiTable->pfnAppendMemBufferCopyRectExp =
-      urCommandBufferAppendMemBufferCopyRectExp;
-  pDdiTable->pfnAppendMemBufferReadExp = urCommandBufferAppendMemBufferReadExp;
+      ur::native_cpu::urCommandBufferAppendMemBufferCopyRectExp;
+  pDdiTable->pfnAppendMemBufferReadExp =
+      ur::native_cpu::urCommandBufferAppendMemBufferReadExp;
   pDdiTable->pfnAppendMemBufferReadRectExp =
-      urCommandBufferAppendMemBufferReadRectExp;
+      ur::native_cpu::urCommandBufferAppendMemBufferReadRectExp;
   pDdiTable->pfnAppendMemBufferWriteExp =
-      urCommandBufferAppendMemBufferWriteExp;
+      ur::native_cpu::urCommandBufferAppendMemBufferWriteExp;
   pDdiTable->pfnAppendMemBufferWriteRectExp =
-      urCommandBufferAppendMemBufferWriteRectExp;
-  pDdiTable->pfnEnqueueExp = urCommandBufferEnqueueExp;
-  pDdiTable->pfnUpdateKernelLaunchExp = urCommandBufferUpdateKernelLaunchExp;
-  pDdiTable->pfnGetInfoExp = urCommandBufferGetInfoExp;
-  pDdiTable->pfnCommandGetInfoExp = urCommandBufferCommandGetInfoExp;
-  pDdiTable->pfnReleaseCommandExp = urCommandBufferReleaseCommandExp;
-  pDdiTable->pfnRetainCommandExp = urCommandBufferRetainCommandExp;
+      ur::native_cpu::urCommandBufferAppendMemBufferWriteRectExp;
+  pDdiTable->pfnEnqueueExp = ur::native_cpu::urCommandBufferEnqueueExp;
+  pDdiTable->pfnUpdateKernelLaunchExp =
+      ur::native_cpu::urCommandBufferUpdateKernelLaunchExp;
+  pDdiTable->pfnGetInfoExp = ur::native_cpu::urCommandBufferGetInfoExp;
+  pDdiTable->pfnCommandGetInfoExp =
+      ur::native_cpu::urCommandBufferCommandGetInfoExp;
+  pDdiTable->pfnReleaseCommandExp =
+      ur::native_cpu::urCommandBufferReleaseCommandExp;
+  pDdiTable->pfnRetainCommandExp =
+      ur::native_cpu::urCommandBufferRetainCommandExp;
 
   return retVal;
 }
@@ -300,9 +358,12 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUsmP2PExpProcAddrTable(
   if (UR_RESULT_SUCCESS != retVal) {
     return retVal;
   }
-  pDdiTable->pfnEnablePeerAccessExp = urUsmP2PEnablePeerAccessExp;
-  pDdiTable->pfnDisablePeerAccessExp = urUsmP2PDisablePeerAccessExp;
-  pDdiTable->pfnPeerAccessGetInfoExp = urUsmP2PPeerAccessGetInfoExp;
+  pDdiTable->pfnEnablePeerAccessExp =
+      ur::native_cpu::urUsmP2PEnablePeerAccessExp;
+  pDdiTable->pfnDisablePeerAccessExp =
+      ur::native_cpu::urUsmP2PDisablePeerAccessExp;
+  pDdiTable->pfnPeerAccessGetInfoExp =
+      ur::native_cpu::urUsmP2PPeerAccessGetInfoExp;
 
   return retVal;
 }
@@ -314,33 +375,38 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
     return result;
   }
   pDdiTable->pfnUnsampledImageHandleDestroyExp =
-      urBindlessImagesUnsampledImageHandleDestroyExp;
+      ur::native_cpu::urBindlessImagesUnsampledImageHandleDestroyExp;
   pDdiTable->pfnSampledImageHandleDestroyExp =
-      urBindlessImagesSampledImageHandleDestroyExp;
-  pDdiTable->pfnImageAllocateExp = urBindlessImagesImageAllocateExp;
-  pDdiTable->pfnImageFreeExp = urBindlessImagesImageFreeExp;
+      ur::native_cpu::urBindlessImagesSampledImageHandleDestroyExp;
+  pDdiTable->pfnImageAllocateExp =
+      ur::native_cpu::urBindlessImagesImageAllocateExp;
+  pDdiTable->pfnImageFreeExp = ur::native_cpu::urBindlessImagesImageFreeExp;
   pDdiTable->pfnUnsampledImageCreateExp =
-      urBindlessImagesUnsampledImageCreateExp;
-  pDdiTable->pfnSampledImageCreateExp = urBindlessImagesSampledImageCreateExp;
-  pDdiTable->pfnImageCopyExp = urBindlessImagesImageCopyExp;
-  pDdiTable->pfnImageGetInfoExp = urBindlessImagesImageGetInfoExp;
-  pDdiTable->pfnMipmapGetLevelExp = urBindlessImagesMipmapGetLevelExp;
-  pDdiTable->pfnMipmapFreeExp = urBindlessImagesMipmapFreeExp;
+      ur::native_cpu::urBindlessImagesUnsampledImageCreateExp;
+  pDdiTable->pfnSampledImageCreateExp =
+      ur::native_cpu::urBindlessImagesSampledImageCreateExp;
+  pDdiTable->pfnImageCopyExp = ur::native_cpu::urBindlessImagesImageCopyExp;
+  pDdiTable->pfnImageGetInfoExp =
+      ur::native_cpu::urBindlessImagesImageGetInfoExp;
+  pDdiTable->pfnMipmapGetLevelExp =
+      ur::native_cpu::urBindlessImagesMipmapGetLevelExp;
+  pDdiTable->pfnMipmapFreeExp = ur::native_cpu::urBindlessImagesMipmapFreeExp;
   pDdiTable->pfnImportExternalMemoryExp =
-      urBindlessImagesImportExternalMemoryExp;
-  pDdiTable->pfnMapExternalArrayExp = urBindlessImagesMapExternalArrayExp;
+      ur::native_cpu::urBindlessImagesImportExternalMemoryExp;
+  pDdiTable->pfnMapExternalArrayExp =
+      ur::native_cpu::urBindlessImagesMapExternalArrayExp;
   pDdiTable->pfnMapExternalLinearMemoryExp =
-      urBindlessImagesMapExternalLinearMemoryExp;
+      ur::native_cpu::urBindlessImagesMapExternalLinearMemoryExp;
   pDdiTable->pfnReleaseExternalMemoryExp =
-      urBindlessImagesReleaseExternalMemoryExp;
+      ur::native_cpu::urBindlessImagesReleaseExternalMemoryExp;
   pDdiTable->pfnImportExternalSemaphoreExp =
-      urBindlessImagesImportExternalSemaphoreExp;
+      ur::native_cpu::urBindlessImagesImportExternalSemaphoreExp;
   pDdiTable->pfnReleaseExternalSemaphoreExp =
-      urBindlessImagesReleaseExternalSemaphoreExp;
+      ur::native_cpu::urBindlessImagesReleaseExternalSemaphoreExp;
   pDdiTable->pfnWaitExternalSemaphoreExp =
-      urBindlessImagesWaitExternalSemaphoreExp;
+      ur::native_cpu::urBindlessImagesWaitExternalSemaphoreExp;
   pDdiTable->pfnSignalExternalSemaphoreExp =
-      urBindlessImagesSignalExternalSemaphoreExp;
+      ur::native_cpu::urBindlessImagesSignalExternalSemaphoreExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -351,9 +417,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPhysicalMemProcAddrTable(
     return retVal;
   }
 
-  pDdiTable->pfnCreate = urPhysicalMemCreate;
-  pDdiTable->pfnRelease = urPhysicalMemRelease;
-  pDdiTable->pfnRetain = urPhysicalMemRetain;
+  pDdiTable->pfnCreate = ur::native_cpu::urPhysicalMemCreate;
+  pDdiTable->pfnRelease = ur::native_cpu::urPhysicalMemRelease;
+  pDdiTable->pfnRetain = ur::native_cpu::urPhysicalMemRetain;
 
   return retVal;
 }
@@ -364,7 +430,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
   if (UR_RESULT_SUCCESS != result) {
     return result;
   }
-  pDdiTable->pfnPitchedAllocExp = urUSMPitchedAllocExp;
+  pDdiTable->pfnPitchedAllocExp = ur::native_cpu::urUSMPitchedAllocExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -378,13 +444,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetVirtualMemProcAddrTable(
     return retVal;
   }
 
-  pDdiTable->pfnFree = urVirtualMemFree;
-  pDdiTable->pfnGetInfo = urVirtualMemGetInfo;
-  pDdiTable->pfnGranularityGetInfo = urVirtualMemGranularityGetInfo;
-  pDdiTable->pfnMap = urVirtualMemMap;
-  pDdiTable->pfnReserve = urVirtualMemReserve;
-  pDdiTable->pfnSetAccess = urVirtualMemSetAccess;
-  pDdiTable->pfnUnmap = urVirtualMemUnmap;
+  pDdiTable->pfnFree = ur::native_cpu::urVirtualMemFree;
+  pDdiTable->pfnGetInfo = ur::native_cpu::urVirtualMemGetInfo;
+  pDdiTable->pfnGranularityGetInfo =
+      ur::native_cpu::urVirtualMemGranularityGetInfo;
+  pDdiTable->pfnMap = ur::native_cpu::urVirtualMemMap;
+  pDdiTable->pfnReserve = ur::native_cpu::urVirtualMemReserve;
+  pDdiTable->pfnSetAccess = ur::native_cpu::urVirtualMemSetAccess;
+  pDdiTable->pfnUnmap = ur::native_cpu::urVirtualMemUnmap;
 
   return retVal;
 }
@@ -397,8 +464,17 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
   }
 
   pDdiTable->pfnCooperativeKernelLaunchExp = nullptr;
-  pDdiTable->pfnTimestampRecordingExp = urEnqueueTimestampRecordingExp;
-  pDdiTable->pfnNativeCommandExp = urEnqueueNativeCommandExp;
+  pDdiTable->pfnTimestampRecordingExp =
+      ur::native_cpu::urEnqueueTimestampRecordingExp;
+  pDdiTable->pfnNativeCommandExp = ur::native_cpu::urEnqueueNativeCommandExp;
+  pDdiTable->pfnUSMDeviceAllocExp = ur::native_cpu::urEnqueueUSMDeviceAllocExp;
+  pDdiTable->pfnUSMFreeExp = ur::native_cpu::urEnqueueUSMFreeExp;
+  pDdiTable->pfnMemBufferCopyRectBatchExp =
+      ur::native_cpu::urEnqueueMemBufferCopyRectBatchExp;
+  pDdiTable->pfnKernelLaunchBatchExp =
+      ur::native_cpu::urEnqueueKernelLaunchBatchExp;
+  pDdiTable->pfnTimestampMarkerExp =
+      ur::native_cpu::urEnqueueTimestampMarkerExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -411,6 +487,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
   }
 
   pDdiTable->pfnSuggestMaxCooperativeGroupCountExp = nullptr;
+  pDdiTable->pfnSetArgsExp = ur::native_cpu::urKernelSetArgsExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -422,10 +499,113 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
     return result;
   }
 
-  pDdiTable->pfnBuildExp = urProgramBuildExp;
-  pDdiTable->pfnCompileExp = urProgramCompileExp;
-  pDdiTable->pfnLinkExp = urProgramLinkExp;
+  pDdiTable->pfnBuildExp = ur::native_cpu::urProgramBuildExp;
+  pDdiTable->pfnCompileExp = ur::native_cpu::urProgramCompileExp;
+  pDdiTable->pfnLinkExp = ur::native_cpu::urProgramLinkExp;
 
   return UR_RESULT_SUCCESS;
 }
+#ifdef UR_STATIC_ADAPTER_NATIVE_CPU
+} // namespace ur::native_cpu
+#elif defined(__cplusplus)
 } // extern "C"
+#endif
+
+#ifdef UR_STATIC_ADAPTER_NATIVE_CPU
+namespace ur::native_cpu {
+ur_result_t urAdapterGetDdiTables(ur_dditable_t *ddi) {
+  if (ddi == nullptr) {
+    return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+  }
+
+  ur_result_t result;
+
+  result = ur::native_cpu::urGetPlatformProcAddrTable(UR_API_VERSION_CURRENT,
+                                                      &ddi->Platform);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetContextProcAddrTable(UR_API_VERSION_CURRENT,
+                                                     &ddi->Context);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetEventProcAddrTable(UR_API_VERSION_CURRENT,
+                                                   &ddi->Event);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetEventExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                      &ddi->EventExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetProgramProcAddrTable(UR_API_VERSION_CURRENT,
+                                                     &ddi->Program);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetKernelProcAddrTable(UR_API_VERSION_CURRENT,
+                                                    &ddi->Kernel);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetSamplerProcAddrTable(UR_API_VERSION_CURRENT,
+                                                     &ddi->Sampler);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetEnqueueProcAddrTable(UR_API_VERSION_CURRENT,
+                                                     &ddi->Enqueue);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetGlobalProcAddrTable(UR_API_VERSION_CURRENT,
+                                                    &ddi->Global);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetQueueProcAddrTable(UR_API_VERSION_CURRENT,
+                                                   &ddi->Queue);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetQueueExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                      &ddi->QueueExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetDeviceProcAddrTable(UR_API_VERSION_CURRENT,
+                                                    &ddi->Device);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetCommandBufferExpProcAddrTable(
+      UR_API_VERSION_CURRENT, &ddi->CommandBufferExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetUsmP2PExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                       &ddi->UsmP2PExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetBindlessImagesExpProcAddrTable(
+      UR_API_VERSION_CURRENT, &ddi->BindlessImagesExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetPhysicalMemProcAddrTable(UR_API_VERSION_CURRENT,
+                                                         &ddi->PhysicalMem);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetUSMExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                    &ddi->USMExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetVirtualMemProcAddrTable(UR_API_VERSION_CURRENT,
+                                                        &ddi->VirtualMem);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetEnqueueExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                        &ddi->EnqueueExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetKernelExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                       &ddi->KernelExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::native_cpu::urGetProgramExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                        &ddi->ProgramExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+
+  return result;
+}
+} // namespace ur::native_cpu
+#endif
@@ -13,12 +13,126 @@
 
 #include "common.hpp"
 #include "context.hpp"
+#include "umf_pools/disjoint_pool_config_parser.hpp"
+#include "usm.hpp"
+#include "ur_interface_loader.hpp"
+
+#include <algorithm>
+#include <cstddef>
 #include <cstdlib>
 
+#include <umf/pools/pool_disjoint.h>
+#include <umf/pools/pool_proxy.h>
+
 namespace native_cpu {
 
+// Provides the memory of the pools, from the system allocator or, for pools
+// with a placement, e.g. on huge pages, mapped from the OS
+class usm_memory_provider_t {
+public:
+  umf_result_t initialize(const usm::host_memory_config_t &memory) {
+    hostMemory = memory;
+    return UMF_RESULT_SUCCESS;
+  }
+
+  umf_result_t alloc(size_t size, size_t alignment, void **ptr) {
+    alignment = std::max<size_t>(alignment, alignof(std::max_align_t));
+    if (hostMemory.isDefault()) {
+      // aligned_alloc needs a multiple of the alignment
+      *ptr = std::aligned_alloc(alignment,
+                                (size + alignment - 1) & ~(alignment - 1));
+    } else if (alignment <= usm::hostMemoryPageSize(hostMemory)) {
+      *ptr = usm::hostMemoryMap(usm::hostMemoryRoundUp(size, hostMemory),
+                                hostMemory);
+    } else {
+      getLastStatusRef() = UR_RESULT_ERROR_UNSUPPORTED_ALIGNMENT;
+      return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+    }
+    if (!*ptr) {
+      getLastStatusRef() = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+      return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+    }
+    return UMF_RESULT_SUCCESS;
+  }
+
+  umf_result_t free(void *ptr, size_t size) {
+    if (hostMemory.isDefault()) {
+      std::free(ptr);
+    } else {
+      usm::hostMemoryUnmap(ptr, usm::hostMemoryRoundUp(size, hostMemory));
+    }
+    return UMF_RESULT_SUCCESS;
+  }
+
+  void get_last_native_error(const char **errMsg, int32_t *errCode) {
+    std::ignore = errMsg;
+    *errCode = static_cast<int32_t>(getLastStatusRef());
+  }
+
+  umf_result_t get_min_page_size(void *, size_t *pageSize) {
+    *pageSize = usm::hostMemoryPageSize(hostMemory);
+    return UMF_RESULT_SUCCESS;
+  }
+
+  umf_result_t get_recommended_page_size(size_t, size_t *pageSize) {
+    *pageSize = usm::hostMemoryPageSize(hostMemory);
+    return UMF_RESULT_SUCCESS;
+  }
+
+  umf_result_t purge_lazy(void *, size_t) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  }
+  umf_result_t purge_force(void *, size_t) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  }
+  umf_result_t allocation_merge(void *, void *, size_t) {
+    return UMF_RESULT_ERROR_UNKNOWN;
+  }
+  umf_result_t allocation_split(void *, size_t, size_t) {
+    return UMF_RESULT_ERROR_UNKNOWN;
+  }
+
+  const char *get_name() { return "NativeCPUMemoryProvider"; }
+
+private:
+  static ur_result_t &getLastStatusRef() {
+    static thread_local ur_result_t lastStatus = UR_RESULT_SUCCESS;
+    return lastStatus;
+  }
+
+  usm::host_memory_config_t hostMemory;
+};
+
+static const usm::DisjointPoolAllConfigs &disjointPoolConfigs() {
+  static const usm::DisjointPoolAllConfigs configs = [] {
+    const char *traceVar = std::getenv("SYCL_NATIVE_CPU_USM_ALLOCATOR_TRACE");
+    int trace = traceVar ? std::atoi(traceVar) : 0;
+
+    // Same format as UR_L0_USM_ALLOCATOR, see disjoint_pool_config_parser.hpp
+    const char *configVar = std::getenv("SYCL_NATIVE_CPU_USM_ALLOCATOR");
+    return configVar ? usm::parseDisjointPoolConfig(configVar, trace)
+                     : usm::DisjointPoolAllConfigs(trace);
+  }();
+  return configs;
+}
+
+static usm::DisjointPoolMemType
+disjointPoolMemType(const usm::pool_descriptor &desc) {
+  switch (desc.type) {
+  case UR_USM_TYPE_DEVICE:
+    return usm::DisjointPoolMemType::Device;
+  case UR_USM_TYPE_SHARED:
+    return desc.deviceReadOnly ? usm::DisjointPoolMemType::SharedReadOnly
+                               : usm::DisjointPoolMemType::Shared;
+  default:
+    return usm::DisjointPoolMemType::Host;
+  }
+}
+
 static ur_result_t alloc_helper(ur_context_handle_t hContext,
-                                const ur_usm_desc_t *pUSMDesc, size_t size,
+                                ur_device_handle_t hDevice,
+                                const ur_usm_desc_t *pUSMDesc,
+                                ur_usm_pool_handle_t pool, size_t size,
                                 void **ppMem, ur_usm_type_t type) {
   auto alignment = pUSMDesc ? pUSMDesc->align : 1u;
   UR_ASSERT((alignment & (alignment - 1)) == 0, UR_RESULT_ERROR_INVALID_VALUE);
@@ -26,8 +140,21 @@ static ur_result_t alloc_helper(ur_context_handle_t hContext,
   // TODO: Check Max size when UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE is implemented
   UR_ASSERT(size > 0, UR_RESULT_ERROR_INVALID_USM_SIZE);
 
-  auto *ptr = hContext->add_alloc(alignment, type, size, nullptr);
-  UR_ASSERT(ptr != nullptr, UR_RESULT_ERROR_OUT_OF_RESOURCES);
+  umf_memory_pool_handle_t umfPool = nullptr;
+  try {
+    auto *urPool = pool ? pool : hContext->getDefaultUSMPool();
+    umfPool = urPool->getPool(hDevice, type);
+  } catch (ur_result_t result) {
+    return result;
+  }
+  UR_ASSERT(umfPool, UR_RESULT_ERROR_INVALID_ARGUMENT);
+
+  auto *ptr = hContext->add_alloc(alignment, type, size, pool, umfPool);
+  if (!ptr) {
+    auto umfResult = umfPoolGetLastAllocationError(umfPool);
+    return umfResult == UMF_RESULT_SUCCESS ? UR_RESULT_ERROR_OUT_OF_RESOURCES
+                                           : umf::umf2urResult(umfResult);
+  }
   *ppMem = ptr;
 
   return UR_RESULT_SUCCESS;
@@ -35,39 +162,114 @@ static ur_result_t alloc_helper(ur_context_handle_t hContext,
 
 } // namespace native_cpu
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
-               ur_usm_pool_handle_t pool, size_t size, void **ppMem) {
-  std::ignore = pool;
+ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(
+    ur_context_handle_t hContext, const ur_usm_pool_desc_t *pPoolDesc)
+    : hContext(hContext) {
+  // TODO: handle UR_USM_POOL_FLAG_ZERO_INITIALIZE_BLOCK from pPoolDesc
+  auto configs = native_cpu::disjointPoolConfigs();
+  if (auto limits = find_stype_node<ur_usm_pool_limits_desc_t>(pPoolDesc)) {
+    for (auto &config : configs.Configs) {
+      config.MaxPoolableSize = limits->maxPoolableSize;
+      config.SlabMinSize = limits->minDriverAllocSize;
+    }
+  }
+
+  auto [result, descriptors] = usm::pool_descriptor::create(
+      this, hContext, find_stype_node<ur_exp_usm_host_pool_desc_t>(pPoolDesc));
+  if (result != UR_RESULT_SUCCESS) {
+    throw result;
+  }
+
+  // All the memory is host memory, so the placement requested for the host
+  // pool, e.g. huge pages, applies to the pools of the device too
+  usm::host_memory_config_t hostMemory;
+  for (auto &desc : descriptors) {
+    if (desc.type == UR_USM_TYPE_HOST) {
+      hostMemory = desc.hostMemory;
+    }
+  }
+
+  for (auto &desc : descriptors) {
+    auto [providerResult, provider] =
+        umf::memoryProviderMakeUnique<native_cpu::usm_memory_provider_t>(
+            hostMemory);
+    if (providerResult != UMF_RESULT_SUCCESS) {
+      throw umf::umf2urResult(providerResult);
+    }
 
-  return native_cpu::alloc_helper(hContext, pUSMDesc, size, ppMem,
-                                  UR_USM_TYPE_HOST);
+    // The proxy pool sends every allocation to the provider
+    auto memType = native_cpu::disjointPoolMemType(desc);
+    auto [poolResult, pool] =
+        configs.EnableBuffers
+            ? umf::poolMakeUniqueFromOps(umfDisjointPoolOps(),
+                                         std::move(provider),
+                                         &configs.Configs[memType])
+            : umf::poolMakeUniqueFromOps(umfProxyPoolOps(),
+                                         std::move(provider), nullptr);
+    if (poolResult != UMF_RESULT_SUCCESS) {
+      throw umf::umf2urResult(poolResult);
+    }
+
+    if (configs.EnableBuffers) {
+      pool = umf::poolAddThreadCache(std::move(pool),
+                                     configs.ThreadCaches[memType].Capacity,
+                                     configs.ThreadCaches[memType].MaxSize);
+    }
+    pool = umf::poolAddStats(std::move(pool));
+    umfPools.push_back(pool.get());
+    auto addResult = poolManager.addPool(desc, std::move(pool));
+    if (addResult != UR_RESULT_SUCCESS) {
+      throw addResult;
+    }
+  }
+}
+
+umf_memory_pool_handle_t
+ur_usm_pool_handle_t_::getPool(ur_device_handle_t hDevice,
+                               ur_usm_type_t type) {
+  usm::pool_descriptor desc{this, hContext, hDevice, type, false};
+  return poolManager.getPool(desc).value_or(nullptr);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
-                 size_t size, void **ppMem) {
-  std::ignore = hDevice;
-  std::ignore = pool;
+umf::pool_stats_t::snapshot_t ur_usm_pool_handle_t_::getStats() const {
+  umf::pool_stats_t::snapshot_t stats;
+  for (auto umfPool : umfPools) {
+    if (auto *poolStats = umf::findPoolStats(umfPool)) {
+      stats += poolStats->snapshot();
+    }
+  }
+  return stats;
+}
 
-  return native_cpu::alloc_helper(hContext, pUSMDesc, size, ppMem,
-                                  UR_USM_TYPE_DEVICE);
+namespace ur::native_cpu {
+
+ur_result_t urUSMHostAlloc(ur_context_handle_t hContext,
+                           const ur_usm_desc_t *pUSMDesc,
+                           ur_usm_pool_handle_t pool, size_t size,
+                           void **ppMem) {
+  return ::native_cpu::alloc_helper(hContext, nullptr, pUSMDesc, pool, size,
+                                  ppMem, UR_USM_TYPE_HOST);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
-                 size_t size, void **ppMem) {
-  std::ignore = hDevice;
-  std::ignore = pool;
+ur_result_t urUSMDeviceAlloc(ur_context_handle_t hContext,
+                             ur_device_handle_t hDevice,
+                             const ur_usm_desc_t *pUSMDesc,
+                             ur_usm_pool_handle_t pool, size_t size,
+                             void **ppMem) {
+  return ::native_cpu::alloc_helper(hContext, hDevice, pUSMDesc, pool, size,
+                                  ppMem, UR_USM_TYPE_DEVICE);
+}
 
-  return native_cpu::alloc_helper(hContext, pUSMDesc, size, ppMem,
-                                  UR_USM_TYPE_SHARED);
+ur_result_t urUSMSharedAlloc(ur_context_handle_t hContext,
+                             ur_device_handle_t hDevice,
+                             const ur_usm_desc_t *pUSMDesc,
+                             ur_usm_pool_handle_t pool, size_t size,
+                             void **ppMem) {
+  return ::native_cpu::alloc_helper(hContext, hDevice, pUSMDesc, pool, size,
+                                  ppMem, UR_USM_TYPE_SHARED);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
-                                              void *pMem) {
+ur_result_t urUSMFree(ur_context_handle_t hContext, void *pMem) {
 
   UR_ASSERT(pMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(hContext, UR_RESULT_ERROR_INVALID_NULL_POINTER);
@@ -77,10 +279,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
   return res;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
-                     ur_usm_alloc_info_t propName, size_t propSize,
-                     void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
+                                 ur_usm_alloc_info_t propName, size_t propSize,
+                                 void *pPropValue, size_t *pPropSizeRet) {
 
   UR_ASSERT(pMem != nullptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
@@ -89,7 +290,7 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
     DIE_NO_IMPLEMENTATION;
   }
 
-  const native_cpu::usm_alloc_info &alloc_info =
+  const ::native_cpu::usm_alloc_info &alloc_info =
       hContext->get_alloc_info_entry(pMem);
   switch (propName) {
   case UR_USM_ALLOC_INFO_TYPE:
@@ -106,53 +307,62 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
   return UR_RESULT_ERROR_INVALID_VALUE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMPoolCreate(ur_context_handle_t hContext, ur_usm_pool_desc_t *pPoolDesc,
-                ur_usm_pool_handle_t *ppPool) {
-  std::ignore = hContext;
-  std::ignore = pPoolDesc;
-  std::ignore = ppPool;
-
-  DIE_NO_IMPLEMENTATION;
+ur_result_t urUSMPoolCreate(ur_context_handle_t hContext,
+                            ur_usm_pool_desc_t *pPoolDesc,
+                            ur_usm_pool_handle_t *ppPool) {
+  try {
+    *ppPool = new ur_usm_pool_handle_t_(hContext, pPoolDesc);
+  } catch (ur_result_t result) {
+    return result;
+  } catch (const std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMPoolRetain(ur_usm_pool_handle_t pPool) {
-  std::ignore = pPool;
-
-  DIE_NO_IMPLEMENTATION;
+ur_result_t urUSMPoolRetain(ur_usm_pool_handle_t pPool) {
+  pPool->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMPoolRelease(ur_usm_pool_handle_t pPool) {
-  std::ignore = pPool;
-
-  DIE_NO_IMPLEMENTATION;
+ur_result_t urUSMPoolRelease(ur_usm_pool_handle_t pPool) {
+  decrementOrDelete(pPool);
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMPoolGetInfo(ur_usm_pool_handle_t hPool, ur_usm_pool_info_t propName,
-                 size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
-  std::ignore = hPool;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
+ur_result_t urUSMPoolGetInfo(ur_usm_pool_handle_t hPool,
+                             ur_usm_pool_info_t propName, size_t propSize,
+                             void *pPropValue, size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
-  DIE_NO_IMPLEMENTATION;
+  switch (propName) {
+  case UR_USM_POOL_INFO_REFERENCE_COUNT:
+    return ReturnValue(hPool->getReferenceCount());
+  case UR_USM_POOL_INFO_CONTEXT:
+    return ReturnValue(hPool->hContext);
+  case UR_USM_POOL_INFO_USED_SIZE:
+  case UR_USM_POOL_INFO_CACHED_SIZE:
+  case UR_USM_POOL_INFO_PEAK_USED_SIZE:
+  case UR_USM_POOL_INFO_BUCKET_HITS:
+  case UR_USM_POOL_INFO_BUCKET_MISSES:
+  case UR_USM_POOL_INFO_FRAGMENTATION:
+    return umf::poolStatsInfo(hPool->getStats(), propName, ReturnValue);
+  default:
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMImportExp(ur_context_handle_t Context,
-                                                   void *HostPtr, size_t Size) {
+ur_result_t urUSMImportExp(ur_context_handle_t Context, void *HostPtr,
+                           size_t Size) {
   std::ignore = Context;
   std::ignore = HostPtr;
   std::ignore = Size;
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMReleaseExp(ur_context_handle_t Context,
-                                                    void *HostPtr) {
+ur_result_t urUSMReleaseExp(ur_context_handle_t Context, void *HostPtr) {
   std::ignore = Context;
   std::ignore = HostPtr;
   DIE_NO_IMPLEMENTATION;
 }
+} // namespace ur::native_cpu
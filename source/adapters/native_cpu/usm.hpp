@@ -0,0 +1,38 @@
+//===------------- usm.hpp - NATIVE CPU Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "ur_api.h"
+
+#include "common.hpp"
+#include "ur_pool_manager.hpp"
+
+// A USM pool, with a UMF pool for each type of allocation. The memory of
+// every type is host memory, it's cached by disjoint pools so that most
+// allocations don't reach the system allocator.
+struct ur_usm_pool_handle_t_ : RefCounted {
+  ur_usm_pool_handle_t_(ur_context_handle_t hContext,
+                        const ur_usm_pool_desc_t *pPoolDesc);
+
+  // The UMF pool of the allocations of type, hDevice is nullptr for host
+  // allocations
+  umf_memory_pool_handle_t getPool(ur_device_handle_t hDevice,
+                                   ur_usm_type_t type);
+
+  // Returns the combined usage of the UMF pools
+  umf::pool_stats_t::snapshot_t getStats() const;
+
+  ur_context_handle_t const hContext;
+
+private:
+  usm::pool_manager<usm::pool_descriptor> poolManager;
+  std::vector<umf_memory_pool_handle_t> umfPools;
+};
@@ -9,19 +9,23 @@
 //===----------------------------------------------------------------------===//
 
 #include "common.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUsmP2PEnablePeerAccessExp(ur_device_handle_t, ur_device_handle_t) {
+namespace ur::native_cpu {
+
+ur_result_t urUsmP2PEnablePeerAccessExp(ur_device_handle_t,
+                                        ur_device_handle_t) {
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUsmP2PDisablePeerAccessExp(ur_device_handle_t, ur_device_handle_t) {
+ur_result_t urUsmP2PDisablePeerAccessExp(ur_device_handle_t,
+                                         ur_device_handle_t) {
   DIE_NO_IMPLEMENTATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUsmP2PPeerAccessGetInfoExp(ur_device_handle_t, ur_device_handle_t,
-                             ur_exp_peer_info_t, size_t, void *, size_t *) {
+ur_result_t urUsmP2PPeerAccessGetInfoExp(ur_device_handle_t, ur_device_handle_t,
+                                         ur_exp_peer_info_t, size_t, void *,
+                                         size_t *) {
   DIE_NO_IMPLEMENTATION;
 }
+} // namespace ur::native_cpu
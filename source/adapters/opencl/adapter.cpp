@@ -9,7 +9,11 @@
 //===----------------------------------------------------------------------===//
 
 #include "common.hpp"
+#include "device.hpp"
+#include "queue.hpp"
+#include "usm_svm.hpp"
 #include "logger/ur_logger.hpp"
+#include "ur_interface_loader.hpp"
 
 struct ur_adapter_handle_t_ {
   std::atomic<uint32_t> RefCount = 0;
@@ -24,15 +28,32 @@ static void globalAdapterShutdown() {
     delete cl_ext::ExtFuncPtrCache;
     cl_ext::ExtFuncPtrCache = nullptr;
   }
+  if (cl_adapter::DeviceInfoCaches) {
+    delete cl_adapter::DeviceInfoCaches;
+    cl_adapter::DeviceInfoCaches = nullptr;
+  }
+  if (cl_adapter::QueuePool) {
+    // The driver may already be torn down at exit, so the pooled queues are
+    // left to it
+    cl_adapter::QueuePool->Map.clear();
+    delete cl_adapter::QueuePool;
+    cl_adapter::QueuePool = nullptr;
+  }
+  if (cl_adapter::SVMPools) {
+    cl_adapter::SVMPools->leak();
+    delete cl_adapter::SVMPools;
+    cl_adapter::SVMPools = nullptr;
+  }
   if (adapter) {
     delete adapter;
     adapter = nullptr;
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urAdapterGet(uint32_t NumEntries, ur_adapter_handle_t *phAdapters,
-             uint32_t *pNumAdapters) {
+namespace ur::opencl {
+
+ur_result_t urAdapterGet(uint32_t NumEntries, ur_adapter_handle_t *phAdapters,
+                         uint32_t *pNumAdapters) {
   if (NumEntries > 0 && phAdapters) {
     // Sometimes urAdaterGet may be called after the library already been torn
     // down, we also need to create a temporary handle for it.
@@ -44,6 +65,9 @@ urAdapterGet(uint32_t NumEntries, ur_adapter_handle_t *phAdapters,
     std::lock_guard<std::mutex> Lock{adapter->Mutex};
     if (adapter->RefCount++ == 0) {
       cl_ext::ExtFuncPtrCache = new cl_ext::ExtFuncPtrCacheT();
+      cl_adapter::DeviceInfoCaches = new cl_adapter::DeviceInfoCachesT();
+      cl_adapter::QueuePool = new cl_adapter::QueuePoolT();
+      cl_adapter::SVMPools = new cl_adapter::SVMPoolsT();
     }
 
     *phAdapters = adapter;
@@ -56,38 +80,58 @@ urAdapterGet(uint32_t NumEntries, ur_adapter_handle_t *phAdapters,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterRetain(ur_adapter_handle_t) {
+ur_result_t urAdapterRetain(ur_adapter_handle_t) {
   ++adapter->RefCount;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
+ur_result_t urAdapterRelease(ur_adapter_handle_t) {
   // Check first if the adapter is valid pointer
   if (adapter) {
     std::lock_guard<std::mutex> Lock{adapter->Mutex};
     if (--adapter->RefCount == 0) {
+      // The process exits once torn down, the pooled queues and SVM are left
+      // to the OS
+      if (fast_teardown_enabled()) {
+        if (cl_adapter::QueuePool) {
+          cl_adapter::QueuePool->Map.clear();
+        }
+        if (cl_adapter::SVMPools) {
+          cl_adapter::SVMPools->leak();
+        }
+      }
       if (cl_ext::ExtFuncPtrCache) {
         delete cl_ext::ExtFuncPtrCache;
         cl_ext::ExtFuncPtrCache = nullptr;
       }
+      if (cl_adapter::DeviceInfoCaches) {
+        delete cl_adapter::DeviceInfoCaches;
+        cl_adapter::DeviceInfoCaches = nullptr;
+      }
+      if (cl_adapter::QueuePool) {
+        delete cl_adapter::QueuePool;
+        cl_adapter::QueuePool = nullptr;
+      }
+      if (cl_adapter::SVMPools) {
+        delete cl_adapter::SVMPools;
+        cl_adapter::SVMPools = nullptr;
+      }
     }
   }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetLastError(
-    ur_adapter_handle_t, const char **ppMessage, int32_t *pError) {
+ur_result_t urAdapterGetLastError(ur_adapter_handle_t, const char **ppMessage,
+                                  int32_t *pError) {
   *ppMessage = cl_adapter::ErrorMessage;
   *pError = cl_adapter::ErrorMessageCode;
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
-                                                     ur_adapter_info_t propName,
-                                                     size_t propSize,
-                                                     void *pPropValue,
-                                                     size_t *pPropSizeRet) {
+ur_result_t urAdapterGetInfo(ur_adapter_handle_t, ur_adapter_info_t propName,
+                             size_t propSize, void *pPropValue,
+                             size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   switch (propName) {
@@ -101,3 +145,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
 
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::opencl
@@ -10,6 +10,7 @@
 
 #include "command_buffer.hpp"
 #include "common.hpp"
+#include "ur_interface_loader.hpp"
 
 namespace {
 ur_result_t
@@ -39,7 +40,7 @@ commandHandleReleaseInternal(ur_exp_command_buffer_command_handle_t Command) {
 /// The ur_exp_command_buffer_handle_t_ destructor calls CL release
 /// command-buffer to free the underlying object.
 ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
-  urQueueRelease(hInternalQueue);
+  ur::opencl::urQueueRelease(hInternalQueue);
 
   cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
   cl_ext::clReleaseCommandBufferKHR_fn clReleaseCommandBufferKHR = nullptr;
@@ -53,13 +54,17 @@ ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
   clReleaseCommandBufferKHR(CLCommandBuffer);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
-    ur_context_handle_t hContext, ur_device_handle_t hDevice,
-    const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
-    ur_exp_command_buffer_handle_t *phCommandBuffer) {
+namespace ur::opencl {
+
+ur_result_t
+urCommandBufferCreateExp(ur_context_handle_t hContext,
+                         ur_device_handle_t hDevice,
+                         const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
+                         ur_exp_command_buffer_handle_t *phCommandBuffer) {
 
   ur_queue_handle_t Queue = nullptr;
-  UR_RETURN_ON_FAILURE(urQueueCreate(hContext, hDevice, nullptr, &Queue));
+  UR_RETURN_ON_FAILURE(ur::opencl::urQueueCreate(hContext, hDevice, nullptr,
+                                                 &Queue));
 
   cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
   cl_ext::clCreateCommandBufferKHR_fn clCreateCommandBufferKHR = nullptr;
@@ -102,14 +107,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urCommandBufferRetainExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   hCommandBuffer->incrementInternalReferenceCount();
   hCommandBuffer->incrementExternalReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   if (hCommandBuffer->decrementExternalReferenceCount() == 0) {
     // External ref count has reached zero, internal release of created
@@ -122,7 +127,7 @@ urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   return commandBufferReleaseInternal(hCommandBuffer);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   cl_context CLContext = cl_adapter::cast<cl_context>(hCommandBuffer->hContext);
   cl_ext::clFinalizeCommandBufferKHR_fn clFinalizeCommandBufferKHR = nullptr;
@@ -137,7 +142,7 @@ urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
+ur_result_t urCommandBufferAppendKernelLaunchExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_kernel_handle_t hKernel,
     uint32_t workDim, const size_t *pGlobalWorkOffset,
     const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
@@ -192,7 +197,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
+ur_result_t urCommandBufferAppendUSMMemcpyExp(
     [[maybe_unused]] ur_exp_command_buffer_handle_t hCommandBuffer,
     [[maybe_unused]] void *pDst, [[maybe_unused]] const void *pSrc,
     [[maybe_unused]] size_t size,
@@ -203,7 +208,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
+ur_result_t urCommandBufferAppendUSMFillExp(
     [[maybe_unused]] ur_exp_command_buffer_handle_t hCommandBuffer,
     [[maybe_unused]] void *pMemory, [[maybe_unused]] const void *pPattern,
     [[maybe_unused]] size_t patternSize, [[maybe_unused]] size_t size,
@@ -214,7 +219,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
+ur_result_t urCommandBufferAppendMemBufferCopyExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
     ur_mem_handle_t hDstMem, size_t srcOffset, size_t dstOffset, size_t size,
     uint32_t numSyncPointsInWaitList,
@@ -237,7 +242,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
+ur_result_t urCommandBufferAppendMemBufferCopyRectExp(
     [[maybe_unused]] ur_exp_command_buffer_handle_t hCommandBuffer,
     [[maybe_unused]] ur_mem_handle_t hSrcMem,
     [[maybe_unused]] ur_mem_handle_t hDstMem,
@@ -272,8 +277,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
+ur_result_t urCommandBufferAppendMemBufferWriteExp(
     [[maybe_unused]] ur_exp_command_buffer_handle_t hCommandBuffer,
     [[maybe_unused]] ur_mem_handle_t hBuffer, [[maybe_unused]] size_t offset,
     [[maybe_unused]] size_t size, [[maybe_unused]] const void *pSrc,
@@ -284,8 +288,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
+ur_result_t urCommandBufferAppendMemBufferReadExp(
     [[maybe_unused]] ur_exp_command_buffer_handle_t hCommandBuffer,
     [[maybe_unused]] ur_mem_handle_t hBuffer, [[maybe_unused]] size_t offset,
     [[maybe_unused]] size_t size, [[maybe_unused]] void *pDst,
@@ -296,8 +299,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
+ur_result_t urCommandBufferAppendMemBufferWriteRectExp(
     [[maybe_unused]] ur_exp_command_buffer_handle_t hCommandBuffer,
     [[maybe_unused]] ur_mem_handle_t hBuffer,
     [[maybe_unused]] ur_rect_offset_t bufferOffset,
@@ -314,8 +316,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT
-ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
+ur_result_t urCommandBufferAppendMemBufferReadRectExp(
     [[maybe_unused]] ur_exp_command_buffer_handle_t hCommandBuffer,
     [[maybe_unused]] ur_mem_handle_t hBuffer,
     [[maybe_unused]] ur_rect_offset_t bufferOffset,
@@ -332,7 +333,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
+ur_result_t urCommandBufferAppendMemBufferFillExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
     const void *pPattern, size_t patternSize, size_t offset, size_t size,
     uint32_t numSyncPointsInWaitList,
@@ -354,7 +355,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
+ur_result_t urCommandBufferAppendUSMPrefetchExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, const void *mem, size_t size,
     ur_usm_migration_flags_t flags, uint32_t numSyncPointsInWaitList,
     const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
@@ -371,7 +372,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
+ur_result_t urCommandBufferAppendUSMAdviseExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, const void *mem, size_t size,
     ur_usm_advice_flags_t advice, uint32_t numSyncPointsInWaitList,
     const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
@@ -388,7 +389,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
+ur_result_t urCommandBufferEnqueueExp(
     ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
@@ -400,6 +401,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
           CLContext, cl_ext::ExtFuncPtrCache->clEnqueueCommandBufferKHRCache,
           cl_ext::EnqueueCommandBufferName, &clEnqueueCommandBufferKHR));
 
+  UR_RETURN_ON_FAILURE(hCommandBuffer->applyPendingUpdates());
+
   const uint32_t NumberOfQueues = 1;
 
   CL_RETURN_ON_FAILURE(clEnqueueCommandBufferKHR(
@@ -411,22 +414,91 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
+ur_result_t urCommandBufferRetainCommandExp(
     ur_exp_command_buffer_command_handle_t hCommand) {
   hCommand->incrementExternalReferenceCount();
   hCommand->incrementInternalReferenceCount();
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
+ur_result_t urCommandBufferReleaseCommandExp(
     ur_exp_command_buffer_command_handle_t hCommand) {
   hCommand->decrementExternalReferenceCount();
   return commandHandleReleaseInternal(hCommand);
 }
+} // namespace ur::opencl
+
+ur_result_t ur_exp_command_buffer_handle_t_::applyPendingUpdates() {
+  if (PendingUpdates.empty()) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
+  cl_ext::clUpdateMutableCommandsKHR_fn clUpdateMutableCommandsKHR = nullptr;
+  UR_RETURN_ON_FAILURE(
+      cl_ext::getExtFuncFromContext<decltype(clUpdateMutableCommandsKHR)>(
+          CLContext, cl_ext::ExtFuncPtrCache->clUpdateMutableCommandsKHRCache,
+          cl_ext::UpdateMutableCommandsName, &clUpdateMutableCommandsKHR));
+
+  auto dataOrNull = [](std::vector<size_t> &NDRange) {
+    return NDRange.empty() ? nullptr : NDRange.data();
+  };
+
+  UpdateConfigs.clear();
+  for (auto Command : PendingUpdates) {
+    auto &Update = Command->PendingUpdate;
+    UpdateConfigs.push_back({
+        Command->CLMutableCommand,
+        static_cast<cl_uint>(Update.Args.size()),    // num_args
+        static_cast<cl_uint>(Update.SVMArgs.size()), // num_svm_args
+        0,                                           // num_exec_infos
+        Command->WorkDim,                            // work_dim
+        Update.Args.data(),                          // arg_list
+        Update.SVMArgs.data(),                       // arg_svm_list
+        nullptr,                                     // exec_info_list
+        dataOrNull(Update.GlobalWorkOffset),         // global_work_offset
+        dataOrNull(Update.GlobalWorkSize),           // global_work_size
+        dataOrNull(Update.LocalWorkSize),            // local_work_size
+    });
+  }
+  // Only once UpdateConfigs doesn't grow anymore
+  UpdateConfigTypes.assign(UpdateConfigs.size(),
+                           CL_STRUCTURE_TYPE_MUTABLE_DISPATCH_CONFIG_KHR);
+  UpdateConfigPtrs.clear();
+  for (const auto &Config : UpdateConfigs) {
+    UpdateConfigPtrs.push_back(&Config);
+  }
+
+  cl_int Res = clUpdateMutableCommandsKHR(
+      CLCommandBuffer, static_cast<cl_uint>(UpdateConfigPtrs.size()),
+      UpdateConfigTypes.data(), UpdateConfigPtrs.data());
+
+  for (auto Command : PendingUpdates) {
+    Command->PendingUpdate.clear();
+    Command->UpdatePending = false;
+  }
+  PendingUpdates.clear();
+
+  CL_RETURN_ON_FAILURE(Res);
+  return UR_RESULT_SUCCESS;
+}
 
 namespace {
+// Returns the pending argument of Args with index ArgIndex, added if there is
+// none, so that the last update of an argument wins
+cl_mutable_dispatch_arg_khr &
+getPendingArg(std::vector<cl_mutable_dispatch_arg_khr> &Args,
+              cl_uint ArgIndex) {
+  for (auto &Arg : Args) {
+    if (Arg.arg_index == ArgIndex) {
+      return Arg;
+    }
+  }
+  return Args.emplace_back(cl_mutable_dispatch_arg_khr{ArgIndex, 0, nullptr});
+}
+
 void updateKernelPointerArgs(
-    std::vector<cl_mutable_dispatch_arg_khr> &CLUSMArgs,
+    ur_exp_command_buffer_command_handle_t_::PendingUpdateT &Update,
     const ur_exp_command_buffer_update_kernel_launch_desc_t
         *pUpdateKernelLaunch) {
 
@@ -437,19 +509,39 @@ void updateKernelPointerArgs(
   const ur_exp_command_buffer_update_pointer_arg_desc_t *ArgPointerList =
       pUpdateKernelLaunch->pNewPointerArgList;
 
-  CLUSMArgs.resize(NumPointerArgs);
   for (uint32_t i = 0; i < NumPointerArgs; i++) {
     const ur_exp_command_buffer_update_pointer_arg_desc_t &URPointerArg =
         ArgPointerList[i];
-    cl_mutable_dispatch_arg_khr &USMArg = CLUSMArgs[i];
-    USMArg.arg_index = URPointerArg.argIndex;
+    cl_mutable_dispatch_arg_khr &USMArg =
+        getPendingArg(Update.SVMArgs, URPointerArg.argIndex);
     USMArg.arg_value = *(void *const *)URPointerArg.pNewPointerArg;
   }
 }
 
-void updateKernelArgs(std::vector<cl_mutable_dispatch_arg_khr> &CLArgs,
-                      const ur_exp_command_buffer_update_kernel_launch_desc_t
-                          *pUpdateKernelLaunch) {
+void setPendingArgValue(
+    ur_exp_command_buffer_command_handle_t_::PendingUpdateT &Update,
+    cl_uint ArgIndex, size_t ArgSize, const void *ArgValue) {
+  cl_mutable_dispatch_arg_khr &CLArg = getPendingArg(Update.Args, ArgIndex);
+  size_t Index = &CLArg - Update.Args.data();
+  if (Update.ArgValues.size() <= Index) {
+    Update.ArgValues.resize(Index + 1);
+  }
+  std::vector<char> &Value = Update.ArgValues[Index];
+  if (ArgValue) {
+    Value.assign(static_cast<const char *>(ArgValue),
+                 static_cast<const char *>(ArgValue) + ArgSize);
+  } else {
+    // Local memory arguments have no value
+    Value.clear();
+  }
+  CLArg.arg_size = ArgSize;
+  CLArg.arg_value = ArgValue ? Value.data() : nullptr;
+}
+
+void updateKernelArgs(
+    ur_exp_command_buffer_command_handle_t_::PendingUpdateT &Update,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) {
   const uint32_t NumMemobjArgs = pUpdateKernelLaunch->numNewMemObjArgs;
   const ur_exp_command_buffer_update_memobj_arg_desc_t *ArgMemobjList =
       pUpdateKernelLaunch->pNewMemObjArgList;
@@ -460,31 +552,24 @@ void updateKernelArgs(std::vector<cl_mutable_dispatch_arg_khr> &CLArgs,
   for (uint32_t i = 0; i < NumMemobjArgs; i++) {
     const ur_exp_command_buffer_update_memobj_arg_desc_t &URMemObjArg =
         ArgMemobjList[i];
-    cl_mutable_dispatch_arg_khr CLArg{
-        URMemObjArg.argIndex, // arg_index
-        sizeof(cl_mem),       // arg_size
-        cl_adapter::cast<const cl_mem *>(
-            &URMemObjArg.hNewMemObjArg) // arg_value
-    };
-
-    CLArgs.push_back(CLArg);
+    setPendingArgValue(Update, URMemObjArg.argIndex, sizeof(cl_mem),
+                       cl_adapter::cast<const cl_mem *>(
+                           &URMemObjArg.hNewMemObjArg));
   }
 
   for (uint32_t i = 0; i < NumValueArgs; i++) {
     const ur_exp_command_buffer_update_value_arg_desc_t &URValueArg =
         ArgValueList[i];
-    cl_mutable_dispatch_arg_khr CLArg{
-        URValueArg.argIndex,    // arg_index
-        URValueArg.argSize,     // arg_size
-        URValueArg.pNewValueArg // arg_value
-    };
-    CLArgs.push_back(CLArg);
+    setPendingArgValue(Update, URValueArg.argIndex, URValueArg.argSize,
+                       URValueArg.pNewValueArg);
   }
 }
 
 } // end anonymous namespace
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
+namespace ur::opencl {
+
+ur_result_t urCommandBufferUpdateKernelLaunchExp(
     ur_exp_command_buffer_command_handle_t hCommand,
     const ur_exp_command_buffer_update_kernel_launch_desc_t
         *pUpdateKernelLaunch) {
@@ -512,17 +597,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
     return UR_RESULT_ERROR_INVALID_OPERATION;
   }
 
+  auto &Update = hCommand->PendingUpdate;
+
   // Find the CL USM pointer arguments to the kernel to update
-  std::vector<cl_mutable_dispatch_arg_khr> CLUSMArgs;
-  updateKernelPointerArgs(CLUSMArgs, pUpdateKernelLaunch);
+  updateKernelPointerArgs(Update, pUpdateKernelLaunch);
 
   // Find the memory object and scalar arguments to the kernel to update
-  std::vector<cl_mutable_dispatch_arg_khr> CLArgs;
-
-  updateKernelArgs(CLArgs, pUpdateKernelLaunch);
+  updateKernelArgs(Update, pUpdateKernelLaunch);
 
   // Find the updated ND-Range configuration of the kernel.
-  std::vector<size_t> CLGlobalWorkOffset, CLGlobalWorkSize, CLLocalWorkSize;
   cl_uint &CommandWorkDim = hCommand->WorkDim;
 
   // Lambda for N-Dimensional update
@@ -534,46 +617,34 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
   };
 
   if (auto GlobalWorkOffsetPtr = pUpdateKernelLaunch->pNewGlobalWorkOffset) {
-    updateNDRange(CLGlobalWorkOffset, GlobalWorkOffsetPtr);
+    updateNDRange(Update.GlobalWorkOffset, GlobalWorkOffsetPtr);
   }
 
   if (auto GlobalWorkSizePtr = pUpdateKernelLaunch->pNewGlobalWorkSize) {
-    updateNDRange(CLGlobalWorkSize, GlobalWorkSizePtr);
+    updateNDRange(Update.GlobalWorkSize, GlobalWorkSizePtr);
+    // As if applied after the earlier updates, which a new global size
+    // without a local size overrides
+    Update.LocalWorkSize.clear();
   }
 
   if (auto LocalWorkSizePtr = pUpdateKernelLaunch->pNewLocalWorkSize) {
-    updateNDRange(CLLocalWorkSize, LocalWorkSizePtr);
+    updateNDRange(Update.LocalWorkSize, LocalWorkSizePtr);
   }
 
-  cl_mutable_command_khr command =
-      cl_adapter::cast<cl_mutable_command_khr>(hCommand->CLMutableCommand);
-  cl_mutable_dispatch_config_khr dispatch_config = {
-      command,
-      static_cast<cl_uint>(CLArgs.size()),    // num_args
-      static_cast<cl_uint>(CLUSMArgs.size()), // num_svm_args
-      0,                                      // num_exec_infos
-      CommandWorkDim,                         // work_dim
-      CLArgs.data(),                          // arg_list
-      CLUSMArgs.data(),                       // arg_svm_list
-      nullptr,                                // exec_info_list
-      CLGlobalWorkOffset.data(),              // global_work_offset
-      CLGlobalWorkSize.data(),                // global_work_size
-      CLLocalWorkSize.data(),                 // local_work_size
-  };
-  cl_uint num_configs = 1;
-  cl_command_buffer_update_type_khr config_types[1] = {
-      CL_STRUCTURE_TYPE_MUTABLE_DISPATCH_CONFIG_KHR};
-  const void *configs[1] = {&dispatch_config};
-  CL_RETURN_ON_FAILURE(clUpdateMutableCommandsKHR(
-      hCommandBuffer->CLCommandBuffer, num_configs, config_types, configs));
-
+  // The command is updated with the others at the next enqueue, in a single
+  // clUpdateMutableCommandsKHR call
+  if (!hCommand->UpdatePending) {
+    hCommand->UpdatePending = true;
+    hCommandBuffer->PendingUpdates.push_back(hCommand);
+  }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferGetInfoExp(
-    ur_exp_command_buffer_handle_t hCommandBuffer,
-    ur_exp_command_buffer_info_t propName, size_t propSize, void *pPropValue,
-    size_t *pPropSizeRet) {
+ur_result_t
+urCommandBufferGetInfoExp(ur_exp_command_buffer_handle_t hCommandBuffer,
+                          ur_exp_command_buffer_info_t propName,
+                          size_t propSize, void *pPropValue,
+                          size_t *pPropSizeRet) {
 
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
@@ -587,7 +658,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferGetInfoExp(
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
+ur_result_t urCommandBufferCommandGetInfoExp(
     ur_exp_command_buffer_command_handle_t hCommand,
     ur_exp_command_buffer_command_info_t propName, size_t propSize,
     void *pPropValue, size_t *pPropSizeRet) {
@@ -602,3 +673,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
 
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
+} // namespace ur::opencl
@@ -23,6 +23,32 @@ struct ur_exp_command_buffer_command_handle_t_ {
   cl_uint WorkDim;
   /// Set to true if the user set the local work size on command creation.
   bool UserDefinedLocalSize;
+  /// Kernel updates not applied to CLMutableCommand yet, see
+  /// ur_exp_command_buffer_handle_t_::applyPendingUpdates.
+  struct PendingUpdateT {
+    /// Memory object and scalar arguments, one per index. Their arg_value
+    /// points into ArgValues, as the values of the updates are only valid
+    /// during the update call.
+    std::vector<cl_mutable_dispatch_arg_khr> Args;
+    std::vector<std::vector<char>> ArgValues;
+    /// USM arguments, one per index.
+    std::vector<cl_mutable_dispatch_arg_khr> SVMArgs;
+    /// Empty if not updated.
+    std::vector<size_t> GlobalWorkOffset;
+    std::vector<size_t> GlobalWorkSize;
+    std::vector<size_t> LocalWorkSize;
+
+    void clear() {
+      Args.clear();
+      ArgValues.clear();
+      SVMArgs.clear();
+      GlobalWorkOffset.clear();
+      GlobalWorkSize.clear();
+      LocalWorkSize.clear();
+    }
+  } PendingUpdate;
+  /// Whether the command is in hCommandBuffer->PendingUpdates.
+  bool UpdatePending = false;
   /// Internal & External reference counts.
   /// We need to maintain these because in OpenCL a command-handle isn't
   /// reference counting, but is tied to the lifetime of the parent
@@ -73,6 +99,13 @@ struct ur_exp_command_buffer_handle_t_ {
   bool IsFinalized;
   /// List of commands in the command-buffer.
   std::vector<ur_exp_command_buffer_command_handle_t> CommandHandles;
+  /// Commands updated since the command-buffer was last enqueued.
+  std::vector<ur_exp_command_buffer_command_handle_t> PendingUpdates;
+  /// The configs of the last clUpdateMutableCommandsKHR call, kept to reuse
+  /// their storage.
+  std::vector<cl_mutable_dispatch_config_khr> UpdateConfigs;
+  std::vector<cl_command_buffer_update_type_khr> UpdateConfigTypes;
+  std::vector<const void *> UpdateConfigPtrs;
   /// Internal & External reference counts of the command-buffer. We do this
   /// manually rather than forward to the OpenCL retain/release APIs because
   /// we also need to track the lifetimes of command handle objects, which
@@ -91,6 +124,10 @@ struct ur_exp_command_buffer_handle_t_ {
 
   ~ur_exp_command_buffer_handle_t_();
 
+  /// Applies the updates of the commands in PendingUpdates, all in one
+  /// clUpdateMutableCommandsKHR call.
+  ur_result_t applyPendingUpdates();
+
   uint32_t incrementInternalReferenceCount() noexcept {
     return ++RefCountInternal;
   }
@@ -9,6 +9,8 @@
 
 #include <CL/cl.h>
 #include <CL/cl_ext.h>
+#include <array>
+#include <atomic>
 #include <climits>
 #include <map>
 #include <mutex>
@@ -320,12 +322,70 @@ cl_int(CL_API_CALL *)(cl_command_buffer_khr command_buffer, cl_uint num_configs,
                       const cl_command_buffer_update_type_khr *config_types,
                       const void **configs);
 
+// The function pointers of an extension function for each context, nullptr
+// for the contexts which don't have it. The first few contexts go to Slots,
+// looked up without locking so that the calls into extension functions on
+// the hot paths, like the USM copies and fills, don't serialize on Mutex. A
+// slot is published by storing its context after its function pointer. The
+// other contexts go to Map.
 template <typename T> struct FuncPtrCache {
+  static constexpr size_t NumSlots = 8;
+  struct SlotT {
+    std::atomic<T> Func{nullptr};
+    std::atomic<cl_context> Context{nullptr};
+  };
+  std::array<SlotT, NumSlots> Slots;
   std::map<cl_context, T> Map;
   std::mutex Mutex;
 
+  // Returns true and sets F if the function of context is cached
+  bool find(cl_context context, T &F) {
+    if (!context) {
+      return false;
+    }
+    for (SlotT &Slot : Slots) {
+      if (Slot.Context.load(std::memory_order_acquire) == context) {
+        F = Slot.Func.load(std::memory_order_relaxed);
+        return true;
+      }
+    }
+    std::lock_guard<std::mutex> CacheLock{Mutex};
+    auto It = Map.find(context);
+    if (It == Map.end()) {
+      return false;
+    }
+    F = It->second;
+    return true;
+  }
+
+  void insert(cl_context context, T F) {
+    std::lock_guard<std::mutex> CacheLock{Mutex};
+    SlotT *FreeSlot = nullptr;
+    for (SlotT &Slot : Slots) {
+      cl_context SlotContext = Slot.Context.load(std::memory_order_relaxed);
+      if (SlotContext == context) {
+        // Resolved by another thread in the meantime
+        return;
+      }
+      if (!SlotContext && !FreeSlot) {
+        FreeSlot = &Slot;
+      }
+    }
+    if (FreeSlot) {
+      FreeSlot->Func.store(F, std::memory_order_relaxed);
+      FreeSlot->Context.store(context, std::memory_order_release);
+      return;
+    }
+    Map[context] = F;
+  }
+
   void clear(cl_context context) {
     std::lock_guard<std::mutex> CacheLock{Mutex};
+    for (SlotT &Slot : Slots) {
+      if (Slot.Context.load(std::memory_order_relaxed) == context) {
+        Slot.Context.store(nullptr, std::memory_order_relaxed);
+      }
+    }
     Map.erase(context);
   }
 };
@@ -362,14 +422,9 @@ template <typename T>
 static ur_result_t getExtFuncFromContext(cl_context Context,
                                          FuncPtrCache<T> &FPtrCache,
                                          const char *FuncName, T *Fptr) {
-  // TODO
-  // Potentially redo caching as UR interface changes.
   // if cached, return cached FuncPtr
-  std::lock_guard<std::mutex> CacheLock{FPtrCache.Mutex};
-  std::map<cl_context, T> &FPtrMap = FPtrCache.Map;
-  auto It = FPtrMap.find(Context);
-  if (It != FPtrMap.end()) {
-    auto F = It->second;
+  T F = nullptr;
+  if (FPtrCache.find(Context, F)) {
     // if cached that extension is not available return nullptr and
     // UR_RESULT_ERROR_UNSUPPORTED_FEATURE
     *Fptr = F;
@@ -406,12 +461,12 @@ static ur_result_t getExtFuncFromContext(cl_context Context,
 
   if (!FuncPtr) {
     // Cache that the extension is not available
-    FPtrMap[Context] = nullptr;
+    FPtrCache.insert(Context, nullptr);
     return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
   }
 
   *Fptr = FuncPtr;
-  FPtrMap[Context] = FuncPtr;
+  FPtrCache.insert(Context, FuncPtr);
 
   return UR_RESULT_SUCCESS;
 }
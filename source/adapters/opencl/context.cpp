@@ -9,6 +9,9 @@
 //===----------------------------------------------------------------------===//
 
 #include "context.hpp"
+#include "queue.hpp"
+#include "usm_svm.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <mutex>
 #include <set>
@@ -36,9 +39,12 @@ ur_result_t cl_adapter::getDevicesFromContext(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextCreate(
-    uint32_t DeviceCount, const ur_device_handle_t *phDevices,
-    const ur_context_properties_t *, ur_context_handle_t *phContext) {
+namespace ur::opencl {
+
+ur_result_t urContextCreate(uint32_t DeviceCount,
+                            const ur_device_handle_t *phDevices,
+                            const ur_context_properties_t *,
+                            ur_context_handle_t *phContext) {
 
   cl_int Ret;
   *phContext = cl_adapter::cast<ur_context_handle_t>(
@@ -69,9 +75,9 @@ static cl_int mapURContextInfoToCL(ur_context_info_t URPropName) {
   return CLPropName;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
-                 size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urContextGetInfo(ur_context_handle_t hContext,
+                             ur_context_info_t propName, size_t propSize,
+                             void *pPropValue, size_t *pPropSizeRet) {
 
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
   const cl_int CLPropName = mapURContextInfoToCL(propName);
@@ -111,8 +117,7 @@ urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextRelease(ur_context_handle_t hContext) {
+ur_result_t urContextRelease(ur_context_handle_t hContext) {
   // If we're reasonably sure this context is about to be detroyed we should
   // clear the ext function pointer cache. This isn't foolproof sadly but it
   // should drastically reduce the chances of the pathological case described
@@ -120,6 +125,12 @@ urContextRelease(ur_context_handle_t hContext) {
   static std::mutex contextReleaseMutex;
   auto clContext = cl_adapter::cast<cl_context>(hContext);
 
+  // The pooled queues hold references to the context, which would never be
+  // destroyed otherwise
+  if (cl_adapter::QueuePool) {
+    cl_adapter::QueuePool->releaseContext(clContext);
+  }
+
   {
     std::lock_guard<std::mutex> lock(contextReleaseMutex);
     size_t refCount = 0;
@@ -131,6 +142,10 @@ urContextRelease(ur_context_handle_t hContext) {
     if (refCount == 1 && cl_ext::ExtFuncPtrCache) {
       cl_ext::ExtFuncPtrCache->clearCache(clContext);
     }
+    // The pools free their SVM with the context
+    if (refCount == 1 && cl_adapter::SVMPools) {
+      cl_adapter::SVMPools->releaseContext(clContext);
+    }
   }
 
   CL_RETURN_ON_FAILURE(
@@ -139,21 +154,20 @@ urContextRelease(ur_context_handle_t hContext) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urContextRetain(ur_context_handle_t hContext) {
+ur_result_t urContextRetain(ur_context_handle_t hContext) {
 
   cl_int Ret = clRetainContext(cl_adapter::cast<cl_context>(hContext));
   return mapCLErrorToUR(Ret);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextGetNativeHandle(
-    ur_context_handle_t hContext, ur_native_handle_t *phNativeContext) {
+ur_result_t urContextGetNativeHandle(ur_context_handle_t hContext,
+                                     ur_native_handle_t *phNativeContext) {
 
   *phNativeContext = reinterpret_cast<ur_native_handle_t>(hContext);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextCreateWithNativeHandle(
+ur_result_t urContextCreateWithNativeHandle(
     ur_native_handle_t hNativeContext, ur_adapter_handle_t, uint32_t,
     const ur_device_handle_t *,
     const ur_context_native_properties_t *pProperties,
@@ -161,14 +175,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextCreateWithNativeHandle(
 
   *phContext = reinterpret_cast<ur_context_handle_t>(hNativeContext);
   if (!pProperties || !pProperties->isNativeHandleOwned) {
-    return urContextRetain(*phContext);
+    return ur::opencl::urContextRetain(*phContext);
   }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urContextSetExtendedDeleter(
-    ur_context_handle_t hContext, ur_context_extended_deleter_t pfnDeleter,
-    void *pUserData) {
+ur_result_t
+urContextSetExtendedDeleter(ur_context_handle_t hContext,
+                            ur_context_extended_deleter_t pfnDeleter,
+                            void *pUserData) {
   static std::unordered_map<ur_context_handle_t,
                             std::set<ur_context_extended_deleter_t>>
       ContextCallbackMap;
@@ -217,3 +232,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextSetExtendedDeleter(
 
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::opencl
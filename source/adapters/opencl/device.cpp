@@ -9,6 +9,8 @@
 #include "device.hpp"
 #include "common.hpp"
 #include "platform.hpp"
+#include "usm_svm.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <array>
 #include <cassert>
@@ -72,11 +74,11 @@ ur_result_t cl_adapter::checkDeviceExtensions(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGet(ur_platform_handle_t hPlatform,
-                                                ur_device_type_t DeviceType,
-                                                uint32_t NumEntries,
-                                                ur_device_handle_t *phDevices,
-                                                uint32_t *pNumDevices) {
+namespace ur::opencl {
+
+ur_result_t urDeviceGet(ur_platform_handle_t hPlatform,
+                        ur_device_type_t DeviceType, uint32_t NumEntries,
+                        ur_device_handle_t *phDevices, uint32_t *pNumDevices) {
 
   cl_device_type Type;
   switch (DeviceType) {
@@ -116,6 +118,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGet(ur_platform_handle_t hPlatform,
 
   return mapCLErrorToUR(Result);
 }
+} // namespace ur::opencl
 
 static ur_device_fp_capability_flags_t
 mapCLDeviceFpConfigToUR(cl_device_fp_config CLValue) {
@@ -329,11 +332,31 @@ static cl_int mapURDeviceInfoToCL(ur_device_info_t URPropName) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
-                                                    ur_device_info_t propName,
-                                                    size_t propSize,
-                                                    void *pPropValue,
-                                                    size_t *pPropSizeRet) {
+UrDeviceInfoCache *cl_adapter::getDeviceInfoCache(cl_device_id Dev) {
+  if (!DeviceInfoCaches) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> CacheLock{DeviceInfoCaches->Mutex};
+  auto It = DeviceInfoCaches->Map.find(Dev);
+  if (It != DeviceInfoCaches->Map.end()) {
+    return It->second.get();
+  }
+
+  cl_device_id Parent = nullptr;
+  if (clGetDeviceInfo(Dev, CL_DEVICE_PARENT_DEVICE, sizeof(Parent), &Parent,
+                      nullptr) != CL_SUCCESS) {
+    return nullptr;
+  }
+  auto &Cache = DeviceInfoCaches->Map[Dev];
+  if (!Parent) {
+    Cache = std::make_unique<UrDeviceInfoCache>();
+  }
+  return Cache.get();
+}
+
+static ur_result_t getDeviceInfo(ur_device_handle_t hDevice,
+                                 ur_device_info_t propName, size_t propSize,
+                                 void *pPropValue, size_t *pPropSizeRet) {
 
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
@@ -877,7 +900,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
                           sizeof(cl_bitfield), &CLValue, nullptr));
       return ReturnValue(static_cast<uint32_t>(CLValue));
     } else {
-      return ReturnValue(0);
+      return ReturnValue(cl_adapter::getSVMUSMCapabilities(
+          cl_adapter::cast<cl_device_id>(hDevice), propName));
     }
   }
   case UR_DEVICE_INFO_IMAGE_SUPPORTED:
@@ -1098,10 +1122,29 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDevicePartition(
-    ur_device_handle_t hDevice,
-    const ur_device_partition_properties_t *pProperties, uint32_t NumDevices,
-    ur_device_handle_t *phSubDevices, uint32_t *pNumDevicesRet) {
+namespace ur::opencl {
+
+ur_result_t urDeviceGetInfo(ur_device_handle_t hDevice,
+                            ur_device_info_t propName, size_t propSize,
+                            void *pPropValue, size_t *pPropSizeRet) {
+  UrDeviceInfoCache *Cache =
+      cl_adapter::getDeviceInfoCache(cl_adapter::cast<cl_device_id>(hDevice));
+  if (!Cache) {
+    return getDeviceInfo(hDevice, propName, propSize, pPropValue,
+                         pPropSizeRet);
+  }
+  return Cache->get(
+      propName, propSize, pPropValue, pPropSizeRet,
+      [hDevice, propName](size_t Size, void *Value, size_t *SizeRet) {
+        return getDeviceInfo(hDevice, propName, Size, Value, SizeRet);
+      });
+}
+
+ur_result_t
+urDevicePartition(ur_device_handle_t hDevice,
+                  const ur_device_partition_properties_t *pProperties,
+                  uint32_t NumDevices, ur_device_handle_t *phSubDevices,
+                  uint32_t *pNumDevicesRet) {
 
   std::vector<cl_device_partition_property> CLProperties(
       pProperties->PropCount + 2);
@@ -1163,29 +1206,28 @@ UR_APIEXPORT ur_result_t UR_APICALL urDevicePartition(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceRetain(ur_device_handle_t hDevice) {
+ur_result_t urDeviceRetain(ur_device_handle_t hDevice) {
 
   cl_int Result = clRetainDevice(cl_adapter::cast<cl_device_id>(hDevice));
 
   return mapCLErrorToUR(Result);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urDeviceRelease(ur_device_handle_t hDevice) {
+ur_result_t urDeviceRelease(ur_device_handle_t hDevice) {
 
   cl_int Result = clReleaseDevice(cl_adapter::cast<cl_device_id>(hDevice));
 
   return mapCLErrorToUR(Result);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetNativeHandle(
-    ur_device_handle_t hDevice, ur_native_handle_t *phNativeDevice) {
+ur_result_t urDeviceGetNativeHandle(ur_device_handle_t hDevice,
+                                    ur_native_handle_t *phNativeDevice) {
 
   *phNativeDevice = reinterpret_cast<ur_native_handle_t>(hDevice);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
+ur_result_t urDeviceCreateWithNativeHandle(
     ur_native_handle_t hNativeDevice, ur_adapter_handle_t,
     const ur_device_native_properties_t *, ur_device_handle_t *phDevice) {
 
@@ -1193,9 +1235,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
-    ur_device_handle_t hDevice, uint64_t *pDeviceTimestamp,
-    uint64_t *pHostTimestamp) {
+ur_result_t urDeviceGetGlobalTimestamps(ur_device_handle_t hDevice,
+                                        uint64_t *pDeviceTimestamp,
+                                        uint64_t *pHostTimestamp) {
   oclv::OpenCLVersion DevVer, PlatVer;
   cl_platform_id Platform;
   cl_device_id DeviceId = cl_adapter::cast<cl_device_id>(hDevice);
@@ -1227,9 +1269,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceSelectBinary(
-    ur_device_handle_t hDevice, const ur_device_binary_t *pBinaries,
-    uint32_t NumBinaries, uint32_t *pSelectedBinary) {
+ur_result_t urDeviceSelectBinary(ur_device_handle_t hDevice,
+                                 const ur_device_binary_t *pBinaries,
+                                 uint32_t NumBinaries,
+                                 uint32_t *pSelectedBinary) {
   // TODO: this is a bare-bones implementation for choosing a device image
   // that would be compatible with the targeted device. An AOT-compiled
   // image is preferred over SPIR-V for known devices (i.e. Intel devices)
@@ -1296,3 +1339,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceSelectBinary(
   // No image can be loaded for the given device
   return UR_RESULT_ERROR_INVALID_BINARY;
 }
+} // namespace ur::opencl
@@ -11,10 +11,27 @@
 
 #include "common.hpp"
 
+#include <map>
+#include <memory>
+
 namespace cl_adapter {
 ur_result_t getDeviceVersion(cl_device_id Dev, oclv::OpenCLVersion &Version);
 
 ur_result_t checkDeviceExtensions(cl_device_id Dev,
                                   const std::vector<std::string> &Exts,
                                   bool &Supported);
+
+// The caches of the results of urDeviceGetInfo of the root devices, which
+// live as long as their platform. Sub-devices aren't cached, as their
+// handles may be reused by the driver once they are released.
+struct DeviceInfoCachesT {
+  std::mutex Mutex;
+  // nullptr for the sub-devices
+  std::map<cl_device_id, std::unique_ptr<UrDeviceInfoCache>> Map;
+};
+// Like cl_ext::ExtFuncPtrCache, a raw pointer tied to the adapter lifetime
+inline DeviceInfoCachesT *DeviceInfoCaches;
+
+// The cache of Dev, nullptr if Dev isn't a root device
+UrDeviceInfoCache *getDeviceInfoCache(cl_device_id Dev);
 } // namespace cl_adapter
@@ -10,10 +10,15 @@
 
 #include <ur_api.h>
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+#include "ur_interface_loader.hpp"
+
+namespace ur::opencl {
+
+ur_result_t urEnqueueNativeCommandExp(
     ur_queue_handle_t, ur_exp_enqueue_native_command_function_t, void *,
     uint32_t, const ur_mem_handle_t *,
     const ur_exp_enqueue_native_command_properties_t *, uint32_t,
     const ur_event_handle_t *, ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+} // namespace ur::opencl
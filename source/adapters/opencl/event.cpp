@@ -9,7 +9,10 @@
 //===----------------------------------------------------------------------===//
 
 #include "common.hpp"
+#include "ur_interface_loader.hpp"
 
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <unordered_map>
@@ -110,48 +113,48 @@ ur_command_t convertCLCommandTypeToUR(const cl_command_type &CommandType) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+namespace ur::opencl {
+
+ur_result_t
 urEventCreateWithNativeHandle(ur_native_handle_t hNativeEvent,
                               [[maybe_unused]] ur_context_handle_t hContext,
                               const ur_event_native_properties_t *pProperties,
                               ur_event_handle_t *phEvent) {
   *phEvent = reinterpret_cast<ur_event_handle_t>(hNativeEvent);
   if (!pProperties || !pProperties->isNativeHandleOwned) {
-    return urEventRetain(*phEvent);
+    return ur::opencl::urEventRetain(*phEvent);
   }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetNativeHandle(
-    ur_event_handle_t hEvent, ur_native_handle_t *phNativeEvent) {
+ur_result_t urEventGetNativeHandle(ur_event_handle_t hEvent,
+                                   ur_native_handle_t *phNativeEvent) {
   return getNativeHandle(hEvent, phNativeEvent);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventRelease(ur_event_handle_t hEvent) {
+ur_result_t urEventRelease(ur_event_handle_t hEvent) {
   cl_int RetErr = clReleaseEvent(cl_adapter::cast<cl_event>(hEvent));
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
+ur_result_t urEventRetain(ur_event_handle_t hEvent) {
   cl_int RetErr = clRetainEvent(cl_adapter::cast<cl_event>(hEvent));
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
+ur_result_t urEventWait(uint32_t numEvents,
+                        const ur_event_handle_t *phEventWaitList) {
   cl_int RetErr = clWaitForEvents(
       numEvents, cl_adapter::cast<const cl_event *>(phEventWaitList));
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
-                                                   ur_event_info_t propName,
-                                                   size_t propSize,
-                                                   void *pPropValue,
-                                                   size_t *pPropSizeRet) {
+ur_result_t urEventGetInfo(ur_event_handle_t hEvent, ur_event_info_t propName,
+                           size_t propSize, void *pPropValue,
+                           size_t *pPropSizeRet) {
   cl_event_info CLEventInfo = convertUREventInfoToCL(propName);
 
   size_t CheckPropSize = 0;
@@ -183,9 +186,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
-    ur_event_handle_t hEvent, ur_profiling_info_t propName, size_t propSize,
-    void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urEventGetProfilingInfo(ur_event_handle_t hEvent,
+                                    ur_profiling_info_t propName,
+                                    size_t propSize, void *pPropValue,
+                                    size_t *pPropSizeRet) {
   cl_profiling_info CLProfilingInfo = convertURProfilingInfoToCL(propName);
   cl_int RetErr = clGetEventProfilingInfo(cl_adapter::cast<cl_event>(hEvent),
                                           CLProfilingInfo, propSize, pPropValue,
@@ -194,9 +198,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urEventSetCallback(ur_event_handle_t hEvent, ur_execution_info_t execStatus,
-                   ur_event_callback_t pfnNotify, void *pUserData) {
+ur_result_t urEventSetCallback(ur_event_handle_t hEvent,
+                               ur_execution_info_t execStatus,
+                               ur_event_callback_t pfnNotify, void *pUserData) {
   static std::unordered_map<ur_event_handle_t, std::set<ur_event_callback_t>>
       EventCallbackMap;
   static std::mutex EventCallbackMutex;
@@ -259,8 +263,80 @@ urEventSetCallback(ur_event_handle_t hEvent, ur_execution_info_t execStatus,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urEnqueueTimestampRecordingExp(ur_queue_handle_t, bool, uint32_t,
-                               const ur_event_handle_t *, ur_event_handle_t *) {
+ur_result_t urEventWaitAnyExp(uint32_t numEvents,
+                              const ur_event_handle_t *phEventWaitList,
+                              uint32_t *pEventIndex) {
+  if (numEvents == 1) {
+    *pEventIndex = 0;
+    return ur::opencl::urEventWait(1, phEventWaitList);
+  }
+
+  // OpenCL can't wait for any of many events, so rather than polling them
+  // each event reports its index when it completes and the first one to do
+  // so wakes us up. The state is shared with the callbacks since those of the
+  // other events run after we return.
+  struct WaitAnyState {
+    std::mutex Mutex;
+    std::condition_variable Cond;
+    bool Done = false;
+    uint32_t Index = 0;
+  };
+  struct WaitAnyCallback {
+    std::shared_ptr<WaitAnyState> State;
+    uint32_t Index;
+  };
+  auto State = std::make_shared<WaitAnyState>();
+  auto ClCallback = [](cl_event, cl_int, void *pUserData) {
+    std::unique_ptr<WaitAnyCallback> C(
+        static_cast<WaitAnyCallback *>(pUserData));
+    std::lock_guard<std::mutex> Lock(C->State->Mutex);
+    if (!C->State->Done) {
+      C->State->Done = true;
+      C->State->Index = C->Index;
+      C->State->Cond.notify_all();
+    }
+  };
+  for (uint32_t i = 0; i < numEvents; i++) {
+    auto Callback = new WaitAnyCallback({State, i});
+    cl_int RetErr =
+        clSetEventCallback(cl_adapter::cast<cl_event>(phEventWaitList[i]),
+                           CL_COMPLETE, ClCallback, Callback);
+    if (RetErr != CL_SUCCESS) {
+      delete Callback;
+      CL_RETURN_ON_FAILURE(RetErr);
+    }
+  }
+
+  std::unique_lock<std::mutex> Lock(State->Mutex);
+  State->Cond.wait(Lock, [&State] { return State->Done; });
+  *pEventIndex = State->Index;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEventGetExecutionStatusExp(uint32_t numEvents,
+                                         const ur_event_handle_t *phEvents,
+                                         ur_event_status_t *pStatuses) {
+  for (uint32_t i = 0; i < numEvents; i++) {
+    cl_int Status = CL_COMPLETE;
+    CL_RETURN_ON_FAILURE(clGetEventInfo(
+        cl_adapter::cast<cl_event>(phEvents[i]),
+        CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(Status), &Status, nullptr));
+    // A negative status is the error code of a command which terminated in an
+    // unexpected way
+    pStatuses[i] = Status < 0 ? UR_EVENT_STATUS_ERROR
+                              : static_cast<ur_event_status_t>(Status);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEnqueueTimestampRecordingExp(ur_queue_handle_t, bool, uint32_t,
+                                           const ur_event_handle_t *,
+                                           ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t urEnqueueTimestampMarkerExp(ur_queue_handle_t, uint32_t,
+                                        const ur_event_handle_t *, uint64_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+} // namespace ur::opencl
@@ -8,14 +8,17 @@
 //
 //===----------------------------------------------------------------------===//
 #include "common.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <algorithm>
 #include <cstddef>
 #include <memory>
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
-               ur_kernel_handle_t *phKernel) {
+namespace ur::opencl {
+
+ur_result_t urKernelCreate(ur_program_handle_t hProgram,
+                           const char *pKernelName,
+                           ur_kernel_handle_t *phKernel) {
 
   cl_int CLResult;
   *phKernel = cl_adapter::cast<ur_kernel_handle_t>(clCreateKernel(
@@ -24,9 +27,10 @@ urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
-    ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
-    const ur_kernel_arg_value_properties_t *, const void *pArgValue) {
+ur_result_t urKernelSetArgValue(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                                size_t argSize,
+                                const ur_kernel_arg_value_properties_t *,
+                                const void *pArgValue) {
 
   CL_RETURN_ON_FAILURE(clSetKernelArg(cl_adapter::cast<cl_kernel>(hKernel),
                                       cl_adapter::cast<cl_uint>(argIndex),
@@ -35,9 +39,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelSetArgLocal(ur_kernel_handle_t hKernel, uint32_t argIndex,
-                    size_t argSize, const ur_kernel_arg_local_properties_t *) {
+ur_result_t urKernelSetArgLocal(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                                size_t argSize,
+                                const ur_kernel_arg_local_properties_t *) {
 
   CL_RETURN_ON_FAILURE(clSetKernelArg(cl_adapter::cast<cl_kernel>(hKernel),
                                       cl_adapter::cast<cl_uint>(argIndex),
@@ -68,11 +72,9 @@ static cl_int mapURKernelInfoToCL(ur_kernel_info_t URPropName) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelGetInfo(ur_kernel_handle_t hKernel,
-                                                    ur_kernel_info_t propName,
-                                                    size_t propSize,
-                                                    void *pPropValue,
-                                                    size_t *pPropSizeRet) {
+ur_result_t urKernelGetInfo(ur_kernel_handle_t hKernel,
+                            ur_kernel_info_t propName, size_t propSize,
+                            void *pPropValue, size_t *pPropSizeRet) {
   // OpenCL doesn't have a way to support this.
   if (propName == UR_KERNEL_INFO_NUM_REGS) {
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
@@ -112,10 +114,11 @@ static cl_int mapURKernelGroupInfoToCL(ur_kernel_group_info_t URPropName) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelGetGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
-                     ur_kernel_group_info_t propName, size_t propSize,
-                     void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urKernelGetGroupInfo(ur_kernel_handle_t hKernel,
+                                 ur_device_handle_t hDevice,
+                                 ur_kernel_group_info_t propName,
+                                 size_t propSize, void *pPropValue,
+                                 size_t *pPropSizeRet) {
   // From the CL spec for GROUP_INFO_GLOBAL: "If device is not a custom device
   // and kernel is not a built-in kernel, clGetKernelWorkGroupInfo returns the
   // error CL_INVALID_VALUE.". Unfortunately there doesn't seem to be a nice
@@ -159,10 +162,10 @@ mapURKernelSubGroupInfoToCL(ur_kernel_sub_group_info_t URPropName) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
-                        ur_kernel_sub_group_info_t propName, size_t,
-                        void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel,
+                                    ur_device_handle_t hDevice,
+                                    ur_kernel_sub_group_info_t propName, size_t,
+                                    void *pPropValue, size_t *pPropSizeRet) {
 
   std::shared_ptr<void> InputValue;
   size_t InputValueSize = 0;
@@ -174,13 +177,16 @@ urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
     // dimension to avoid truncation of max sub-group size.
     uint32_t MaxDims = 0;
     ur_result_t URRet =
-        urDeviceGetInfo(hDevice, UR_DEVICE_INFO_MAX_WORK_ITEM_DIMENSIONS,
-                        sizeof(uint32_t), &MaxDims, nullptr);
+        ur::opencl::urDeviceGetInfo(hDevice,
+                                    UR_DEVICE_INFO_MAX_WORK_ITEM_DIMENSIONS,
+                                    sizeof(uint32_t), &MaxDims, nullptr);
     if (URRet != UR_RESULT_SUCCESS)
       return URRet;
     std::shared_ptr<size_t[]> WgSizes{new size_t[MaxDims]};
-    URRet = urDeviceGetInfo(hDevice, UR_DEVICE_INFO_MAX_WORK_ITEM_SIZES,
-                            MaxDims * sizeof(size_t), WgSizes.get(), nullptr);
+    URRet = ur::opencl::urDeviceGetInfo(hDevice,
+                                        UR_DEVICE_INFO_MAX_WORK_ITEM_SIZES,
+                                        MaxDims * sizeof(size_t), WgSizes.get(),
+                                        nullptr);
     if (URRet != UR_RESULT_SUCCESS)
       return URRet;
     for (size_t i = 1; i < MaxDims; ++i)
@@ -210,14 +216,14 @@ urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
       // Two calls to urDeviceGetInfo are needed: the first determines the size
       // required to store the result, and the second returns the actual size
       // values.
-      UR_RETURN_ON_FAILURE(urDeviceGetInfo(hDevice,
-                                           UR_DEVICE_INFO_SUB_GROUP_SIZES_INTEL,
-                                           0, nullptr, &ResultSize));
+      UR_RETURN_ON_FAILURE(ur::opencl::urDeviceGetInfo(
+          hDevice, UR_DEVICE_INFO_SUB_GROUP_SIZES_INTEL, 0, nullptr,
+          &ResultSize));
       assert(ResultSize % sizeof(uint32_t) == 0);
       std::vector<uint32_t> Result(ResultSize / sizeof(uint32_t));
-      UR_RETURN_ON_FAILURE(urDeviceGetInfo(hDevice,
-                                           UR_DEVICE_INFO_SUB_GROUP_SIZES_INTEL,
-                                           ResultSize, Result.data(), nullptr));
+      UR_RETURN_ON_FAILURE(ur::opencl::urDeviceGetInfo(
+          hDevice, UR_DEVICE_INFO_SUB_GROUP_SIZES_INTEL, ResultSize,
+          Result.data(), nullptr));
       RetVal = *std::max_element(Result.begin(), Result.end());
       Ret = CL_SUCCESS;
     } else if (propName == UR_KERNEL_SUB_GROUP_INFO_SUB_GROUP_SIZE_INTEL) {
@@ -236,13 +242,12 @@ urKernelGetSubGroupInfo(ur_kernel_handle_t hKernel, ur_device_handle_t hDevice,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelRetain(ur_kernel_handle_t hKernel) {
+ur_result_t urKernelRetain(ur_kernel_handle_t hKernel) {
   CL_RETURN_ON_FAILURE(clRetainKernel(cl_adapter::cast<cl_kernel>(hKernel)));
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urKernelRelease(ur_kernel_handle_t hKernel) {
+ur_result_t urKernelRelease(ur_kernel_handle_t hKernel) {
   CL_RETURN_ON_FAILURE(clReleaseKernel(cl_adapter::cast<cl_kernel>(hKernel)));
   return UR_RESULT_SUCCESS;
 }
@@ -300,9 +305,10 @@ static ur_result_t usmSetIndirectAccess(ur_kernel_handle_t hKernel) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetExecInfo(
-    ur_kernel_handle_t hKernel, ur_kernel_exec_info_t propName, size_t propSize,
-    const ur_kernel_exec_info_properties_t *, const void *pPropValue) {
+ur_result_t urKernelSetExecInfo(ur_kernel_handle_t hKernel,
+                                ur_kernel_exec_info_t propName, size_t propSize,
+                                const ur_kernel_exec_info_properties_t *,
+                                const void *pPropValue) {
 
   switch (propName) {
   case UR_KERNEL_EXEC_INFO_USM_INDIRECT_ACCESS: {
@@ -328,9 +334,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetExecInfo(
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgPointer(
-    ur_kernel_handle_t hKernel, uint32_t argIndex,
-    const ur_kernel_arg_pointer_properties_t *, const void *pArgValue) {
+ur_result_t urKernelSetArgPointer(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                                  const ur_kernel_arg_pointer_properties_t *,
+                                  const void *pArgValue) {
 
   cl_context CLContext;
   CL_RETURN_ON_FAILURE(clGetKernelInfo(cl_adapter::cast<cl_kernel>(hKernel),
@@ -338,28 +344,36 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgPointer(
                                        &CLContext, nullptr));
 
   clSetKernelArgMemPointerINTEL_fn FuncPtr = nullptr;
-  UR_RETURN_ON_FAILURE(
+  ur_result_t RetVal =
       cl_ext::getExtFuncFromContext<clSetKernelArgMemPointerINTEL_fn>(
           CLContext,
           cl_ext::ExtFuncPtrCache->clSetKernelArgMemPointerINTELCache,
-          cl_ext::SetKernelArgMemPointerName, &FuncPtr));
+          cl_ext::SetKernelArgMemPointerName, &FuncPtr);
 
   if (FuncPtr) {
     CL_RETURN_ON_FAILURE(FuncPtr(cl_adapter::cast<cl_kernel>(hKernel),
                                  cl_adapter::cast<cl_uint>(argIndex),
                                  pArgValue));
+  } else if (RetVal == UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
+    // USM is emulated with SVM, see SVMPoolsT
+    CL_RETURN_ON_FAILURE(
+        clSetKernelArgSVMPointer(cl_adapter::cast<cl_kernel>(hKernel),
+                                 cl_adapter::cast<cl_uint>(argIndex),
+                                 pArgValue));
+  } else {
+    return RetVal;
   }
 
   return UR_RESULT_SUCCESS;
 }
-UR_APIEXPORT ur_result_t UR_APICALL urKernelGetNativeHandle(
-    ur_kernel_handle_t hKernel, ur_native_handle_t *phNativeKernel) {
+ur_result_t urKernelGetNativeHandle(ur_kernel_handle_t hKernel,
+                                    ur_native_handle_t *phNativeKernel) {
 
   *phNativeKernel = reinterpret_cast<ur_native_handle_t>(hKernel);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
+ur_result_t urKernelSuggestMaxCooperativeGroupCountExp(
     [[maybe_unused]] ur_kernel_handle_t hKernel,
     [[maybe_unused]] size_t localWorkSize,
     [[maybe_unused]] size_t dynamicSharedMemorySize,
@@ -367,20 +381,21 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
-    ur_native_handle_t hNativeKernel, ur_context_handle_t, ur_program_handle_t,
-    const ur_kernel_native_properties_t *pProperties,
-    ur_kernel_handle_t *phKernel) {
+ur_result_t
+urKernelCreateWithNativeHandle(ur_native_handle_t hNativeKernel,
+                               ur_context_handle_t, ur_program_handle_t,
+                               const ur_kernel_native_properties_t *pProperties,
+                               ur_kernel_handle_t *phKernel) {
   *phKernel = reinterpret_cast<ur_kernel_handle_t>(hNativeKernel);
   if (!pProperties || !pProperties->isNativeHandleOwned) {
-    return urKernelRetain(*phKernel);
+    return ur::opencl::urKernelRetain(*phKernel);
   }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgMemObj(
-    ur_kernel_handle_t hKernel, uint32_t argIndex,
-    const ur_kernel_arg_mem_obj_properties_t *, ur_mem_handle_t hArgValue) {
+ur_result_t urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                                 const ur_kernel_arg_mem_obj_properties_t *,
+                                 ur_mem_handle_t hArgValue) {
 
   cl_int RetErr = clSetKernelArg(
       cl_adapter::cast<cl_kernel>(hKernel), cl_adapter::cast<cl_uint>(argIndex),
@@ -389,9 +404,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgMemObj(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgSampler(
-    ur_kernel_handle_t hKernel, uint32_t argIndex,
-    const ur_kernel_arg_sampler_properties_t *, ur_sampler_handle_t hArgValue) {
+ur_result_t urKernelSetArgSampler(ur_kernel_handle_t hKernel, uint32_t argIndex,
+                                  const ur_kernel_arg_sampler_properties_t *,
+                                  ur_sampler_handle_t hArgValue) {
 
   cl_int RetErr = clSetKernelArg(
       cl_adapter::cast<cl_kernel>(hKernel), cl_adapter::cast<cl_uint>(argIndex),
@@ -400,10 +415,66 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgSampler(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
-    ur_kernel_handle_t hKernel, ur_queue_handle_t hQueue, uint32_t workDim,
-    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
-    size_t *pSuggestedLocalWorkSize) {
+ur_result_t urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                               const ur_exp_kernel_arg_properties_t *pArgs) {
+  cl_kernel CLKernel = cl_adapter::cast<cl_kernel>(hKernel);
+  // Looked up on the first pointer argument
+  clSetKernelArgMemPointerINTEL_fn SetArgMemPointer = nullptr;
+
+  for (uint32_t i = 0; i < numArgs; i++) {
+    const ur_exp_kernel_arg_properties_t &Arg = pArgs[i];
+    cl_uint Index = cl_adapter::cast<cl_uint>(Arg.index);
+    switch (Arg.type) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+      CL_RETURN_ON_FAILURE(
+          clSetKernelArg(CLKernel, Index, Arg.size, Arg.value.value));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+      CL_RETURN_ON_FAILURE(clSetKernelArg(CLKernel, Index, Arg.size, nullptr));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ: {
+      cl_mem CLMem = cl_adapter::cast<cl_mem>(Arg.value.memObjTuple.hMem);
+      CL_RETURN_ON_FAILURE(
+          clSetKernelArg(CLKernel, Index, sizeof(CLMem), &CLMem));
+      break;
+    }
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER: {
+      cl_sampler CLSampler = cl_adapter::cast<cl_sampler>(Arg.value.sampler);
+      CL_RETURN_ON_FAILURE(
+          clSetKernelArg(CLKernel, Index, sizeof(CLSampler), &CLSampler));
+      break;
+    }
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+      if (!SetArgMemPointer) {
+        cl_context CLContext;
+        CL_RETURN_ON_FAILURE(clGetKernelInfo(CLKernel, CL_KERNEL_CONTEXT,
+                                             sizeof(cl_context), &CLContext,
+                                             nullptr));
+        UR_RETURN_ON_FAILURE(
+            cl_ext::getExtFuncFromContext<clSetKernelArgMemPointerINTEL_fn>(
+                CLContext,
+                cl_ext::ExtFuncPtrCache->clSetKernelArgMemPointerINTELCache,
+                cl_ext::SetKernelArgMemPointerName, &SetArgMemPointer));
+      }
+      if (SetArgMemPointer) {
+        CL_RETURN_ON_FAILURE(
+            SetArgMemPointer(CLKernel, Index, Arg.value.pointer));
+      }
+      break;
+    default:
+      return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urKernelGetSuggestedLocalWorkSize(ur_kernel_handle_t hKernel,
+                                              ur_queue_handle_t hQueue,
+                                              uint32_t workDim,
+                                              const size_t *pGlobalWorkOffset,
+                                              const size_t *pGlobalWorkSize,
+                                              size_t *pSuggestedLocalWorkSize) {
   cl_device_id Device;
   cl_platform_id Platform;
 
@@ -427,3 +498,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
       pGlobalWorkSize, pSuggestedLocalWorkSize));
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::opencl
@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "platform.hpp"
+#include "ur_interface_loader.hpp"
 
 ur_result_t cl_adapter::getPlatformVersion(cl_platform_id Plat,
                                            oclv::OpenCLVersion &Version) {
@@ -48,8 +49,9 @@ static cl_int mapURPlatformInfoToCL(ur_platform_info_t URPropName) {
 }
 
 UR_DLLEXPORT ur_result_t UR_APICALL
-urPlatformGetInfo(ur_platform_handle_t hPlatform, ur_platform_info_t propName,
-                  size_t propSize, void *pPropValue, size_t *pSizeRet) {
+ur::opencl::urPlatformGetInfo(ur_platform_handle_t hPlatform,
+                              ur_platform_info_t propName, size_t propSize,
+                              void *pPropValue, size_t *pSizeRet) {
 
   UrReturnHelper ReturnValue(propSize, pPropValue, pSizeRet);
   const cl_int CLPropName = mapURPlatformInfoToCL(propName);
@@ -73,15 +75,18 @@ urPlatformGetInfo(ur_platform_handle_t hPlatform, ur_platform_info_t propName,
 }
 
 UR_DLLEXPORT ur_result_t UR_APICALL
-urPlatformGetApiVersion([[maybe_unused]] ur_platform_handle_t hPlatform,
-                        ur_api_version_t *pVersion) {
+ur::opencl::urPlatformGetApiVersion(
+    [[maybe_unused]] ur_platform_handle_t hPlatform,
+    ur_api_version_t *pVersion) {
   *pVersion = UR_API_VERSION_CURRENT;
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
-              ur_platform_handle_t *phPlatforms, uint32_t *pNumPlatforms) {
+namespace ur::opencl {
+
+ur_result_t urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
+                          ur_platform_handle_t *phPlatforms,
+                          uint32_t *pNumPlatforms) {
 
   cl_int Result =
       clGetPlatformIDs(cl_adapter::cast<cl_uint>(NumEntries),
@@ -99,13 +104,13 @@ urPlatformGet(ur_adapter_handle_t *, uint32_t, uint32_t NumEntries,
   return mapCLErrorToUR(Result);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformGetNativeHandle(
-    ur_platform_handle_t hPlatform, ur_native_handle_t *phNativePlatform) {
+ur_result_t urPlatformGetNativeHandle(ur_platform_handle_t hPlatform,
+                                      ur_native_handle_t *phNativePlatform) {
   *phNativePlatform = reinterpret_cast<ur_native_handle_t>(hPlatform);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
+ur_result_t urPlatformCreateWithNativeHandle(
     ur_native_handle_t hNativePlatform, ur_adapter_handle_t,
     const ur_platform_native_properties_t *, ur_platform_handle_t *phPlatform) {
   *phPlatform = reinterpret_cast<ur_platform_handle_t>(hNativePlatform);
@@ -115,9 +120,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
 // Returns plugin specific backend option.
 // Current support is only for optimization options.
 // Return '-cl-opt-disable' for pFrontendOption = -O0 and '' for others.
-UR_APIEXPORT ur_result_t UR_APICALL
-urPlatformGetBackendOption(ur_platform_handle_t, const char *pFrontendOption,
-                           const char **ppPlatformOption) {
+ur_result_t urPlatformGetBackendOption(ur_platform_handle_t,
+                                       const char *pFrontendOption,
+                                       const char **ppPlatformOption) {
   using namespace std::literals;
   if (pFrontendOption == nullptr)
     return UR_RESULT_SUCCESS;
@@ -141,3 +146,4 @@ urPlatformGetBackendOption(ur_platform_handle_t, const char *pFrontendOption,
   }
   return UR_RESULT_ERROR_INVALID_VALUE;
 }
+} // namespace ur::opencl
@@ -12,6 +12,190 @@
 #include "context.hpp"
 #include "device.hpp"
 #include "platform.hpp"
+#include "logger/ur_logger.hpp"
+#include "ur_binary_cache.hpp"
+#include "ur_interface_loader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+
+// The program binaries built from IL, kept across processes in the program
+// cache, or in the directory UR_OPENCL_PROGRAM_CACHE_DIR if it is set. Not all
+// drivers have a working cache of their own.
+static const ur::binary_cache_t &getProgramCache() {
+  static const ur::binary_cache_t Cache(
+      "opencl", "UR_OPENCL_PROGRAM_CACHE_DIR",
+      {'U', 'R', 'O', 'C', 'L', 'P', 'G', '2'});
+  return Cache;
+}
+
+namespace {
+// A program created from IL while the cache is enabled, until it is built
+struct cached_program_t {
+  std::string Key;
+  // Set if the program was created from the cached binaries, which were
+  // built with these options
+  std::optional<std::string> Options;
+};
+
+struct cached_programs_t {
+  std::mutex Mutex;
+  std::map<cl_program, cached_program_t> Map;
+};
+
+// Never destroyed, as static objects of the application may release programs
+// in their destructor
+cached_programs_t &getCachedPrograms() {
+  static cached_programs_t *CachedPrograms = new cached_programs_t();
+  return *CachedPrograms;
+}
+
+std::optional<cached_program_t> takeCachedProgram(cl_program Program) {
+  cached_programs_t &CachedPrograms = getCachedPrograms();
+  std::lock_guard<std::mutex> Lock(CachedPrograms.Mutex);
+  auto It = CachedPrograms.Map.find(Program);
+  if (It == CachedPrograms.Map.end()) {
+    return std::nullopt;
+  }
+  cached_program_t CachedProgram = std::move(It->second);
+  CachedPrograms.Map.erase(It);
+  return CachedProgram;
+}
+
+ur_result_t hashDeviceInfo(ur::binary_hash_t &Hash, cl_device_id Dev,
+                           cl_device_info Name) {
+  size_t Size = 0;
+  CL_RETURN_ON_FAILURE(clGetDeviceInfo(Dev, Name, 0, nullptr, &Size));
+  std::string Info(Size, '\0');
+  CL_RETURN_ON_FAILURE(clGetDeviceInfo(Dev, Name, Size, Info.data(), nullptr));
+  Hash.addField(Info);
+  return UR_RESULT_SUCCESS;
+}
+
+// Returns the key of the binaries built from IL for Devices. Binaries are only
+// valid for the devices and the drivers which built them. The build options
+// aren't known yet when the program is created, they are part of the entry.
+ur_result_t getProgramCacheKey(const void *IL, size_t Length,
+                               const std::vector<cl_device_id> &Devices,
+                               std::string &Key) {
+  ur::binary_hash_t Hash;
+  Hash.addField(IL, Length);
+  for (cl_device_id Dev : Devices) {
+    for (cl_device_info Name : {CL_DEVICE_VENDOR, CL_DEVICE_NAME,
+                                CL_DEVICE_VERSION, CL_DRIVER_VERSION}) {
+      UR_RETURN_ON_FAILURE(hashDeviceInfo(Hash, Dev, Name));
+    }
+  }
+  Key = Hash.str();
+  return UR_RESULT_SUCCESS;
+}
+
+// The entries are the build options, then the binary of each device of the
+// program, each prefixed by its size
+void appendField(std::vector<uint8_t> &Entry, const void *Data, size_t Size) {
+  const uint8_t *SizeBytes = reinterpret_cast<const uint8_t *>(&Size);
+  Entry.insert(Entry.end(), SizeBytes, SizeBytes + sizeof(Size));
+  const uint8_t *Bytes = static_cast<const uint8_t *>(Data);
+  Entry.insert(Entry.end(), Bytes, Bytes + Size);
+}
+
+bool readField(const ur::cached_binary_t &Entry, size_t &Offset,
+               const uint8_t *&Data, size_t &Size) {
+  if (Entry.size() - Offset < sizeof(Size)) {
+    return false;
+  }
+  std::memcpy(&Size, Entry.data() + Offset, sizeof(Size));
+  Offset += sizeof(Size);
+  if (Entry.size() - Offset < Size) {
+    return false;
+  }
+  Data = Entry.data() + Offset;
+  Offset += Size;
+  return true;
+}
+
+// Creates the program from the binaries cached for Key, returns nullptr on a
+// miss or if the driver rejects them
+cl_program createProgramFromCache(cl_context Context,
+                                  const std::vector<cl_device_id> &Devices,
+                                  const std::string &Key,
+                                  std::string &Options) {
+  ur::cached_binary_t Entry;
+  if (!getProgramCache().load(Key, Entry)) {
+    return nullptr;
+  }
+  size_t Offset = 0;
+  const uint8_t *Data = nullptr;
+  size_t Size = 0;
+  if (!readField(Entry, Offset, Data, Size)) {
+    return nullptr;
+  }
+  Options.assign(reinterpret_cast<const char *>(Data), Size);
+
+  std::vector<const uint8_t *> Binaries(Devices.size());
+  std::vector<size_t> Lengths(Devices.size());
+  for (size_t i = 0; i < Devices.size(); i++) {
+    if (!readField(Entry, Offset, Binaries[i], Lengths[i])) {
+      return nullptr;
+    }
+  }
+
+  std::vector<cl_int> BinaryStatus(Devices.size());
+  cl_int Err = CL_SUCCESS;
+  cl_program Program = clCreateProgramWithBinary(
+      Context, Devices.size(), Devices.data(), Lengths.data(), Binaries.data(),
+      BinaryStatus.data(), &Err);
+  bool Valid = Err == CL_SUCCESS &&
+               std::all_of(BinaryStatus.begin(), BinaryStatus.end(),
+                           [](cl_int Status) { return Status == CL_SUCCESS; });
+  if (!Valid) {
+    if (Program) {
+      clReleaseProgram(Program);
+    }
+    return nullptr;
+  }
+  return Program;
+}
+
+// Caches the binaries of the built Program, errors are ignored as the program
+// itself is fine
+void storeProgramBinaries(cl_program Program, const std::string &Key,
+                          const std::string &Options) {
+  cl_uint DeviceCount = 0;
+  if (clGetProgramInfo(Program, CL_PROGRAM_NUM_DEVICES, sizeof(DeviceCount),
+                       &DeviceCount, nullptr) != CL_SUCCESS) {
+    return;
+  }
+  std::vector<size_t> Sizes(DeviceCount);
+  if (clGetProgramInfo(Program, CL_PROGRAM_BINARY_SIZES,
+                       DeviceCount * sizeof(size_t), Sizes.data(),
+                       nullptr) != CL_SUCCESS) {
+    return;
+  }
+  std::vector<std::vector<uint8_t>> Binaries(DeviceCount);
+  std::vector<uint8_t *> BinaryPtrs(DeviceCount);
+  for (cl_uint i = 0; i < DeviceCount; i++) {
+    if (Sizes[i] == 0) {
+      return;
+    }
+    Binaries[i].resize(Sizes[i]);
+    BinaryPtrs[i] = Binaries[i].data();
+  }
+  if (clGetProgramInfo(Program, CL_PROGRAM_BINARIES,
+                       DeviceCount * sizeof(uint8_t *), BinaryPtrs.data(),
+                       nullptr) != CL_SUCCESS) {
+    return;
+  }
+
+  std::vector<uint8_t> Entry;
+  appendField(Entry, Options.data(), Options.size());
+  for (const std::vector<uint8_t> &Binary : Binaries) {
+    appendField(Entry, Binary.data(), Binary.size());
+  }
+  getProgramCache().store(Key, Entry.data(), Entry.size());
+}
+} // namespace
 
 static ur_result_t getDevicesFromProgram(
     ur_program_handle_t hProgram,
@@ -35,14 +219,33 @@ static ur_result_t getDevicesFromProgram(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithIL(
-    ur_context_handle_t hContext, const void *pIL, size_t length,
-    const ur_program_properties_t *, ur_program_handle_t *phProgram) {
+namespace ur::opencl {
+
+ur_result_t urProgramCreateWithIL(ur_context_handle_t hContext, const void *pIL,
+                                  size_t length,
+                                  const ur_program_properties_t *,
+                                  ur_program_handle_t *phProgram) {
 
   std::unique_ptr<std::vector<cl_device_id>> DevicesInCtx;
   CL_RETURN_ON_FAILURE_AND_SET_NULL(
       cl_adapter::getDevicesFromContext(hContext, DevicesInCtx), phProgram);
 
+  std::string CacheKey;
+  if (getProgramCache().enabled()) {
+    UR_RETURN_ON_FAILURE(
+        getProgramCacheKey(pIL, length, *DevicesInCtx, CacheKey));
+    std::string Options;
+    if (cl_program Program = createProgramFromCache(
+            cl_adapter::cast<cl_context>(hContext), *DevicesInCtx, CacheKey,
+            Options)) {
+      cached_programs_t &CachedPrograms = getCachedPrograms();
+      std::lock_guard<std::mutex> Lock(CachedPrograms.Mutex);
+      CachedPrograms.Map[Program] = {CacheKey, std::move(Options)};
+      *phProgram = cl_adapter::cast<ur_program_handle_t>(Program);
+      return UR_RESULT_SUCCESS;
+    }
+  }
+
   cl_platform_id CurPlatform;
   CL_RETURN_ON_FAILURE_AND_SET_NULL(
       clGetDeviceInfo((*DevicesInCtx)[0], CL_DEVICE_PLATFORM,
@@ -112,13 +315,21 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithIL(
     CL_RETURN_ON_FAILURE(Err);
   }
 
+  if (!CacheKey.empty()) {
+    cached_programs_t &CachedPrograms = getCachedPrograms();
+    std::lock_guard<std::mutex> Lock(CachedPrograms.Mutex);
+    CachedPrograms.Map[cl_adapter::cast<cl_program>(*phProgram)] = {
+        CacheKey, std::nullopt};
+  }
+
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
-    ur_context_handle_t hContext, ur_device_handle_t hDevice, size_t size,
-    const uint8_t *pBinary, const ur_program_properties_t *,
-    ur_program_handle_t *phProgram) {
+ur_result_t urProgramCreateWithBinary(ur_context_handle_t hContext,
+                                      ur_device_handle_t hDevice, size_t size,
+                                      const uint8_t *pBinary,
+                                      const ur_program_properties_t *,
+                                      ur_program_handle_t *phProgram) {
 
   const cl_device_id Devices[1] = {cl_adapter::cast<cl_device_id>(hDevice)};
   const size_t Lengths[1] = {size};
@@ -133,9 +344,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithBinary(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramCompile([[maybe_unused]] ur_context_handle_t hContext,
-                 ur_program_handle_t hProgram, const char *pOptions) {
+ur_result_t urProgramCompile([[maybe_unused]] ur_context_handle_t hContext,
+                             ur_program_handle_t hProgram,
+                             const char *pOptions) {
 
   std::unique_ptr<std::vector<cl_device_id>> DevicesInProgram;
   UR_RETURN_ON_FAILURE(getDevicesFromProgram(hProgram, DevicesInProgram));
@@ -174,9 +385,9 @@ static cl_int mapURProgramInfoToCL(ur_program_info_t URPropName) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramGetInfo(ur_program_handle_t hProgram, ur_program_info_t propName,
-                 size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urProgramGetInfo(ur_program_handle_t hProgram,
+                             ur_program_info_t propName, size_t propSize,
+                             void *pPropValue, size_t *pPropSizeRet) {
   size_t CheckPropSize = 0;
   auto ClResult = clGetProgramInfo(cl_adapter::cast<cl_program>(hProgram),
                                    mapURProgramInfoToCL(propName), propSize,
@@ -191,23 +402,37 @@ urProgramGetInfo(ur_program_handle_t hProgram, ur_program_info_t propName,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramBuild([[maybe_unused]] ur_context_handle_t hContext,
-               ur_program_handle_t hProgram, const char *pOptions) {
+ur_result_t urProgramBuild([[maybe_unused]] ur_context_handle_t hContext,
+                           ur_program_handle_t hProgram, const char *pOptions) {
 
   std::unique_ptr<std::vector<cl_device_id>> DevicesInProgram;
   UR_RETURN_ON_FAILURE(getDevicesFromProgram(hProgram, DevicesInProgram));
 
-  CL_RETURN_ON_FAILURE(clBuildProgram(
-      cl_adapter::cast<cl_program>(hProgram), DevicesInProgram->size(),
-      DevicesInProgram->data(), pOptions, nullptr, nullptr));
+  cl_program Program = cl_adapter::cast<cl_program>(hProgram);
+  std::optional<cached_program_t> CachedProgram = takeCachedProgram(Program);
+  std::string Options = pOptions ? pOptions : "";
+  if (CachedProgram && CachedProgram->Options &&
+      *CachedProgram->Options != Options) {
+    // The program was created before its options were known
+    logger::warning("OpenCL program cache: program built from binaries "
+                    "built with options \"{}\", not \"{}\"",
+                    *CachedProgram->Options, Options);
+  }
+
+  CL_RETURN_ON_FAILURE(clBuildProgram(Program, DevicesInProgram->size(),
+                                      DevicesInProgram->data(), pOptions,
+                                      nullptr, nullptr));
+
+  if (CachedProgram && !CachedProgram->Options) {
+    storeProgramBinaries(Program, CachedProgram->Key, Options);
+  }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramLink(ur_context_handle_t hContext, uint32_t count,
-              const ur_program_handle_t *phPrograms, const char *pOptions,
-              ur_program_handle_t *phProgram) {
+ur_result_t urProgramLink(ur_context_handle_t hContext, uint32_t count,
+                          const ur_program_handle_t *phPrograms,
+                          const char *pOptions,
+                          ur_program_handle_t *phProgram) {
 
   cl_int CLResult;
   *phProgram = cl_adapter::cast<ur_program_handle_t>(
@@ -227,23 +452,20 @@ urProgramLink(ur_context_handle_t hContext, uint32_t count,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCompileExp(ur_program_handle_t,
-                                                        uint32_t,
-                                                        ur_device_handle_t *,
-                                                        const char *) {
+ur_result_t urProgramCompileExp(ur_program_handle_t, uint32_t,
+                                ur_device_handle_t *, const char *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramBuildExp(ur_program_handle_t,
-                                                      uint32_t,
-                                                      ur_device_handle_t *,
-                                                      const char *) {
+ur_result_t urProgramBuildExp(ur_program_handle_t, uint32_t,
+                              ur_device_handle_t *, const char *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramLinkExp(
-    ur_context_handle_t, uint32_t, ur_device_handle_t *, uint32_t,
-    const ur_program_handle_t *, const char *, ur_program_handle_t *phProgram) {
+ur_result_t urProgramLinkExp(ur_context_handle_t, uint32_t,
+                             ur_device_handle_t *, uint32_t,
+                             const ur_program_handle_t *, const char *,
+                             ur_program_handle_t *phProgram) {
   if (nullptr != phProgram) {
     *phProgram = nullptr;
   }
@@ -289,10 +511,11 @@ mapCLBinaryTypeToUR(cl_program_binary_type binaryType) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramGetBuildInfo(ur_program_handle_t hProgram, ur_device_handle_t hDevice,
-                      ur_program_build_info_t propName, size_t propSize,
-                      void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urProgramGetBuildInfo(ur_program_handle_t hProgram,
+                                  ur_device_handle_t hDevice,
+                                  ur_program_build_info_t propName,
+                                  size_t propSize, void *pPropValue,
+                                  size_t *pPropSizeRet) {
   if (propName == UR_PROGRAM_BUILD_INFO_BINARY_TYPE) {
     UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
     cl_program_binary_type BinaryType;
@@ -319,40 +542,48 @@ urProgramGetBuildInfo(ur_program_handle_t hProgram, ur_device_handle_t hDevice,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramRetain(ur_program_handle_t hProgram) {
+ur_result_t urProgramRetain(ur_program_handle_t hProgram) {
 
   CL_RETURN_ON_FAILURE(clRetainProgram(cl_adapter::cast<cl_program>(hProgram)));
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urProgramRelease(ur_program_handle_t hProgram) {
+ur_result_t urProgramRelease(ur_program_handle_t hProgram) {
+  // The driver may reuse the handle of a destroyed program
+  if (getProgramCache().enabled()) {
+    cl_uint RefCount = 0;
+    CL_RETURN_ON_FAILURE(clGetProgramInfo(
+        cl_adapter::cast<cl_program>(hProgram), CL_PROGRAM_REFERENCE_COUNT,
+        sizeof(RefCount), &RefCount, nullptr));
+    if (RefCount == 1) {
+      takeCachedProgram(cl_adapter::cast<cl_program>(hProgram));
+    }
+  }
 
   CL_RETURN_ON_FAILURE(
       clReleaseProgram(cl_adapter::cast<cl_program>(hProgram)));
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetNativeHandle(
-    ur_program_handle_t hProgram, ur_native_handle_t *phNativeProgram) {
+ur_result_t urProgramGetNativeHandle(ur_program_handle_t hProgram,
+                                     ur_native_handle_t *phNativeProgram) {
 
   *phNativeProgram = reinterpret_cast<ur_native_handle_t>(hProgram);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
+ur_result_t urProgramCreateWithNativeHandle(
     ur_native_handle_t hNativeProgram, ur_context_handle_t,
     const ur_program_native_properties_t *pProperties,
     ur_program_handle_t *phProgram) {
   *phProgram = reinterpret_cast<ur_program_handle_t>(hNativeProgram);
   if (!pProperties || !pProperties->isNativeHandleOwned) {
-    return urProgramRetain(*phProgram);
+    return ur::opencl::urProgramRetain(*phProgram);
   }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramSetSpecializationConstants(
+ur_result_t urProgramSetSpecializationConstants(
     ur_program_handle_t hProgram, uint32_t count,
     const ur_specialization_constant_info_t *pSpecConstants) {
 
@@ -445,9 +676,10 @@ static bool isInSeparatedString(const std::string &Str, char Delimiter,
   return false;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
-    ur_device_handle_t hDevice, ur_program_handle_t hProgram,
-    const char *pFunctionName, void **ppFunctionPointer) {
+ur_result_t urProgramGetFunctionPointer(ur_device_handle_t hDevice,
+                                        ur_program_handle_t hProgram,
+                                        const char *pFunctionName,
+                                        void **ppFunctionPointer) {
 
   cl_context CLContext = nullptr;
   CL_RETURN_ON_FAILURE(clGetProgramInfo(cl_adapter::cast<cl_program>(hProgram),
@@ -502,7 +734,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
+ur_result_t urProgramGetGlobalVariablePointer(
     ur_device_handle_t hDevice, ur_program_handle_t hProgram,
     const char *pGlobalVariableName, size_t *pGlobalVariableSizeRet,
     void **ppGlobalVariablePointerRet) {
@@ -536,3 +768,4 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
 
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::opencl
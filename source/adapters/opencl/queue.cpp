@@ -7,7 +7,10 @@
 //===-----------------------------------------------------------------===//
 
 #include "common.hpp"
+#include "latency_tracker.hpp"
 #include "platform.hpp"
+#include "queue.hpp"
+#include "ur_interface_loader.hpp"
 
 cl_command_queue_info mapURQueueInfoToCL(const ur_queue_info_t PropName) {
 
@@ -67,9 +70,86 @@ mapCLQueuePropsToUR(const cl_command_queue_properties &Properties) {
   return Flags;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueCreate(
-    ur_context_handle_t hContext, ur_device_handle_t hDevice,
-    const ur_queue_properties_t *pProperties, ur_queue_handle_t *phQueue) {
+cl_adapter::QueuePoolT::~QueuePoolT() {
+  for (auto &[Key, Queues] : Map) {
+    for (cl_command_queue Queue : Queues) {
+      clReleaseCommandQueue(Queue);
+    }
+  }
+}
+
+cl_command_queue cl_adapter::QueuePoolT::acquire(const KeyT &Key) {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  auto It = Map.find(Key);
+  if (It == Map.end() || It->second.empty()) {
+    return nullptr;
+  }
+  cl_command_queue Queue = It->second.back();
+  It->second.pop_back();
+  return Queue;
+}
+
+bool cl_adapter::QueuePoolT::release(cl_command_queue Queue) {
+  cl_context Context = nullptr;
+  cl_device_id Device = nullptr;
+  cl_command_queue_properties Properties = 0;
+  if (clGetCommandQueueInfo(Queue, CL_QUEUE_CONTEXT, sizeof(Context), &Context,
+                            nullptr) != CL_SUCCESS ||
+      clGetCommandQueueInfo(Queue, CL_QUEUE_DEVICE, sizeof(Device), &Device,
+                            nullptr) != CL_SUCCESS ||
+      clGetCommandQueueInfo(Queue, CL_QUEUE_PROPERTIES, sizeof(Properties),
+                            &Properties, nullptr) != CL_SUCCESS) {
+    return false;
+  }
+  // Device queues are only used from kernels
+  if (Properties & (CL_QUEUE_ON_DEVICE | CL_QUEUE_ON_DEVICE_DEFAULT)) {
+    return false;
+  }
+
+  KeyT Key{Context, Device, Properties};
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (Map[Key].size() >= MaxQueuesPerKey) {
+      return false;
+    }
+  }
+  // Outside of the lock, the queue can't be handed out until it is pooled
+  if (clFinish(Queue) != CL_SUCCESS) {
+    return false;
+  }
+  std::lock_guard<std::mutex> Lock(Mutex);
+  std::vector<cl_command_queue> &Queues = Map[Key];
+  if (Queues.size() >= MaxQueuesPerKey) {
+    return false;
+  }
+  Queues.push_back(Queue);
+  return true;
+}
+
+void cl_adapter::QueuePoolT::releaseContext(cl_context Context) {
+  std::vector<cl_command_queue> Released;
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    for (auto It = Map.begin(); It != Map.end();) {
+      if (std::get<cl_context>(It->first) == Context) {
+        Released.insert(Released.end(), It->second.begin(), It->second.end());
+        It = Map.erase(It);
+      } else {
+        ++It;
+      }
+    }
+  }
+  for (cl_command_queue Queue : Released) {
+    clReleaseCommandQueue(Queue);
+  }
+}
+
+namespace ur::opencl {
+
+ur_result_t urQueueCreate(ur_context_handle_t hContext,
+                          ur_device_handle_t hDevice,
+                          const ur_queue_properties_t *pProperties,
+                          ur_queue_handle_t *phQueue) {
 
   cl_platform_id CurPlatform;
   CL_RETURN_ON_FAILURE_AND_SET_NULL(
@@ -86,6 +166,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreate(
       CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE | CL_QUEUE_PROFILING_ENABLE |
       CL_QUEUE_ON_DEVICE | CL_QUEUE_ON_DEVICE_DEFAULT;
 
+  if (cl_adapter::QueuePool) {
+    if (cl_command_queue Queue = cl_adapter::QueuePool->acquire(
+            {cl_adapter::cast<cl_context>(hContext),
+             cl_adapter::cast<cl_device_id>(hDevice),
+             CLProperties & SupportByOpenCL})) {
+      *phQueue = cl_adapter::cast<ur_queue_handle_t>(Queue);
+      return UR_RESULT_SUCCESS;
+    }
+  }
+
   oclv::OpenCLVersion Version;
   CL_RETURN_ON_FAILURE_AND_SET_NULL(
       cl_adapter::getPlatformVersion(CurPlatform, Version), phQueue);
@@ -113,14 +203,22 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreate(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
-                                                   ur_queue_info_t propName,
-                                                   size_t propSize,
-                                                   void *pPropValue,
-                                                   size_t *pPropSizeRet) {
-  if (propName == UR_QUEUE_INFO_EMPTY) {
+ur_result_t urQueueGetInfo(ur_queue_handle_t hQueue, ur_queue_info_t propName,
+                           size_t propSize, void *pPropValue,
+                           size_t *pPropSizeRet) {
+  switch (propName) {
+  case UR_QUEUE_INFO_EMPTY:
     // OpenCL doesn't provide API to check the status of the queue.
+  case UR_QUEUE_INFO_COMMAND_COUNTS:
+  case UR_QUEUE_INFO_BYTES_COPIED:
+  case UR_QUEUE_INFO_BATCH_COUNT:
+  case UR_QUEUE_INFO_AVERAGE_BATCH_SIZE:
+  case UR_QUEUE_INFO_HOST_WAIT_TIME:
+  case UR_QUEUE_INFO_CREATED_EVENT_COUNT:
+    // Nor does it keep any telemetry of the queue.
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  default:
+    break;
   }
   cl_command_queue_info CLCommandQueueInfo = mapURQueueInfoToCL(propName);
 
@@ -152,13 +250,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urQueueGetNativeHandle(ur_queue_handle_t hQueue, ur_queue_native_desc_t *,
-                       ur_native_handle_t *phNativeQueue) {
+ur_result_t urQueueGetNativeHandle(ur_queue_handle_t hQueue,
+                                   ur_queue_native_desc_t *,
+                                   ur_native_handle_t *phNativeQueue) {
   return getNativeHandle(hQueue, phNativeQueue);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
+ur_result_t urQueueCreateWithNativeHandle(
     ur_native_handle_t hNativeQueue,
     [[maybe_unused]] ur_context_handle_t hContext,
     [[maybe_unused]] ur_device_handle_t hDevice,
@@ -172,28 +270,50 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
+ur_result_t urQueueFinish(ur_queue_handle_t hQueue) {
+  TRACK_SCOPE_LATENCY("urQueueFinish");
   cl_int RetErr = clFinish(cl_adapter::cast<cl_command_queue>(hQueue));
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueFlush(ur_queue_handle_t hQueue) {
+ur_result_t urQueueFlush(ur_queue_handle_t hQueue) {
   cl_int RetErr = clFinish(cl_adapter::cast<cl_command_queue>(hQueue));
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueRetain(ur_queue_handle_t hQueue) {
+ur_result_t urQueueRetain(ur_queue_handle_t hQueue) {
   cl_int RetErr =
       clRetainCommandQueue(cl_adapter::cast<cl_command_queue>(hQueue));
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urQueueRelease(ur_queue_handle_t hQueue) {
-  cl_int RetErr =
-      clReleaseCommandQueue(cl_adapter::cast<cl_command_queue>(hQueue));
+ur_result_t urQueueRelease(ur_queue_handle_t hQueue) {
+  cl_command_queue Queue = cl_adapter::cast<cl_command_queue>(hQueue);
+  if (cl_adapter::QueuePool) {
+    cl_uint RefCount = 0;
+    CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(Queue, CL_QUEUE_REFERENCE_COUNT,
+                                               sizeof(RefCount), &RefCount,
+                                               nullptr));
+    // The pool takes over the last reference
+    if (RefCount == 1 && cl_adapter::QueuePool->release(Queue)) {
+      return UR_RESULT_SUCCESS;
+    }
+  }
+
+  cl_int RetErr = clReleaseCommandQueue(Queue);
   CL_RETURN_ON_FAILURE(RetErr);
   return UR_RESULT_SUCCESS;
 }
+
+ur_result_t urQueueReserveTimestampMarkersExp(ur_queue_handle_t, uint32_t) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t urQueueReadTimestampMarkersExp(ur_queue_handle_t, uint64_t,
+                                           uint32_t, uint64_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+} // namespace ur::opencl
@@ -0,0 +1,44 @@
+//===--------- queue.hpp - OpenCL Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common.hpp"
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace cl_adapter {
+// The queues released without any other reference, finished and kept for
+// the next urQueueCreate of the same context, device and properties, as
+// creating a queue is slow on some drivers. Queues hold a reference to their
+// context, so the queues of a context are released with it.
+struct QueuePoolT {
+  static constexpr size_t MaxQueuesPerKey = 8;
+  using KeyT =
+      std::tuple<cl_context, cl_device_id, cl_command_queue_properties>;
+
+  std::mutex Mutex;
+  std::map<KeyT, std::vector<cl_command_queue>> Map;
+
+  ~QueuePoolT();
+
+  // Returns a pooled queue for Key, nullptr if there is none
+  cl_command_queue acquire(const KeyT &Key);
+
+  // Finishes and keeps Queue, returns false if it can't be pooled
+  bool release(cl_command_queue Queue);
+
+  // Releases the pooled queues of Context
+  void releaseContext(cl_context Context);
+};
+// Like DeviceInfoCaches, a raw pointer tied to the adapter lifetime
+inline QueuePoolT *QueuePool;
+} // namespace cl_adapter
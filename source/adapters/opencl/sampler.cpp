@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "common.hpp"
+#include "ur_interface_loader.hpp"
 
 namespace {
 
@@ -132,6 +133,8 @@ void cl2URSamplerInfoValue(cl_sampler_info Info, void *InfoValue) {
 
 } // namespace
 
+namespace ur::opencl {
+
 ur_result_t urSamplerCreate(ur_context_handle_t hContext,
                             const ur_sampler_desc_t *pDesc,
                             ur_sampler_handle_t *phSampler) {
@@ -151,9 +154,9 @@ ur_result_t urSamplerCreate(ur_context_handle_t hContext,
   return mapCLErrorToUR(ErrorCode);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urSamplerGetInfo(ur_sampler_handle_t hSampler, ur_sampler_info_t propName,
-                 size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+ur_result_t urSamplerGetInfo(ur_sampler_handle_t hSampler,
+                             ur_sampler_info_t propName, size_t propSize,
+                             void *pPropValue, size_t *pPropSizeRet) {
   cl_sampler_info SamplerInfo = ur2CLSamplerInfo(propName);
   static_assert(sizeof(cl_addressing_mode) ==
                 sizeof(ur_sampler_addressing_mode_t));
@@ -198,32 +201,31 @@ urSamplerGetInfo(ur_sampler_handle_t hSampler, ur_sampler_info_t propName,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urSamplerRetain(ur_sampler_handle_t hSampler) {
+ur_result_t urSamplerRetain(ur_sampler_handle_t hSampler) {
   return mapCLErrorToUR(
       clRetainSampler(cl_adapter::cast<cl_sampler>(hSampler)));
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urSamplerRelease(ur_sampler_handle_t hSampler) {
+ur_result_t urSamplerRelease(ur_sampler_handle_t hSampler) {
   return mapCLErrorToUR(
       clReleaseSampler(cl_adapter::cast<cl_sampler>(hSampler)));
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urSamplerGetNativeHandle(
-    ur_sampler_handle_t hSampler, ur_native_handle_t *phNativeSampler) {
+ur_result_t urSamplerGetNativeHandle(ur_sampler_handle_t hSampler,
+                                     ur_native_handle_t *phNativeSampler) {
   *phNativeSampler = reinterpret_cast<ur_native_handle_t>(
       cl_adapter::cast<cl_sampler>(hSampler));
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
+ur_result_t urSamplerCreateWithNativeHandle(
     ur_native_handle_t hNativeSampler, ur_context_handle_t,
     const ur_sampler_native_properties_t *pProperties,
     ur_sampler_handle_t *phSampler) {
   *phSampler = reinterpret_cast<ur_sampler_handle_t>(hNativeSampler);
   if (!pProperties || !pProperties->isNativeHandleOwned) {
-    return urSamplerRetain(*phSampler);
+    return ur::opencl::urSamplerRetain(*phSampler);
   }
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::opencl
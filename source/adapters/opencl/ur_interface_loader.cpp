@@ -11,6 +11,8 @@
 #include <ur_api.h>
 #include <ur_ddi.h>
 
+#include "ur_interface_loader.hpp"
+
 namespace {
 
 // TODO - this is a duplicate of what is in the L0 plugin
@@ -28,7 +30,9 @@ ur_result_t validateProcInputs(ur_api_version_t Version, void *pDdiTable) {
 }
 } // namespace
 
-#if defined(__cplusplus)
+#ifdef UR_STATIC_ADAPTER_OPENCL
+namespace ur::opencl {
+#elif defined(__cplusplus)
 extern "C" {
 #endif
 
@@ -38,12 +42,13 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnCreateWithNativeHandle = urPlatformCreateWithNativeHandle;
-  pDdiTable->pfnGet = urPlatformGet;
-  pDdiTable->pfnGetApiVersion = urPlatformGetApiVersion;
-  pDdiTable->pfnGetInfo = urPlatformGetInfo;
-  pDdiTable->pfnGetNativeHandle = urPlatformGetNativeHandle;
-  pDdiTable->pfnGetBackendOption = urPlatformGetBackendOption;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::opencl::urPlatformCreateWithNativeHandle;
+  pDdiTable->pfnGet = ur::opencl::urPlatformGet;
+  pDdiTable->pfnGetApiVersion = ur::opencl::urPlatformGetApiVersion;
+  pDdiTable->pfnGetInfo = ur::opencl::urPlatformGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::opencl::urPlatformGetNativeHandle;
+  pDdiTable->pfnGetBackendOption = ur::opencl::urPlatformGetBackendOption;
   return UR_RESULT_SUCCESS;
 }
 
@@ -53,13 +58,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetContextProcAddrTable(
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnCreate = urContextCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urContextCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urContextGetInfo;
-  pDdiTable->pfnGetNativeHandle = urContextGetNativeHandle;
-  pDdiTable->pfnRelease = urContextRelease;
-  pDdiTable->pfnRetain = urContextRetain;
-  pDdiTable->pfnSetExtendedDeleter = urContextSetExtendedDeleter;
+  pDdiTable->pfnCreate = ur::opencl::urContextCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::opencl::urContextCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::opencl::urContextGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::opencl::urContextGetNativeHandle;
+  pDdiTable->pfnRelease = ur::opencl::urContextRelease;
+  pDdiTable->pfnRetain = ur::opencl::urContextRetain;
+  pDdiTable->pfnSetExtendedDeleter = ur::opencl::urContextSetExtendedDeleter;
   return UR_RESULT_SUCCESS;
 }
 
@@ -69,14 +75,27 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnCreateWithNativeHandle = urEventCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urEventGetInfo;
-  pDdiTable->pfnGetNativeHandle = urEventGetNativeHandle;
-  pDdiTable->pfnGetProfilingInfo = urEventGetProfilingInfo;
-  pDdiTable->pfnRelease = urEventRelease;
-  pDdiTable->pfnRetain = urEventRetain;
-  pDdiTable->pfnSetCallback = urEventSetCallback;
-  pDdiTable->pfnWait = urEventWait;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::opencl::urEventCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::opencl::urEventGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::opencl::urEventGetNativeHandle;
+  pDdiTable->pfnGetProfilingInfo = ur::opencl::urEventGetProfilingInfo;
+  pDdiTable->pfnRelease = ur::opencl::urEventRelease;
+  pDdiTable->pfnRetain = ur::opencl::urEventRetain;
+  pDdiTable->pfnSetCallback = ur::opencl::urEventSetCallback;
+  pDdiTable->pfnWait = ur::opencl::urEventWait;
+  return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t Version, ur_event_exp_dditable_t *pDdiTable) {
+  auto Result = validateProcInputs(Version, pDdiTable);
+  if (UR_RESULT_SUCCESS != Result) {
+    return Result;
+  }
+  pDdiTable->pfnWaitAnyExp = ur::opencl::urEventWaitAnyExp;
+  pDdiTable->pfnGetExecutionStatusExp =
+      ur::opencl::urEventGetExecutionStatusExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -86,21 +105,23 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnBuild = urProgramBuild;
-  pDdiTable->pfnCompile = urProgramCompile;
-  pDdiTable->pfnCreateWithBinary = urProgramCreateWithBinary;
-  pDdiTable->pfnCreateWithIL = urProgramCreateWithIL;
-  pDdiTable->pfnCreateWithNativeHandle = urProgramCreateWithNativeHandle;
-  pDdiTable->pfnGetBuildInfo = urProgramGetBuildInfo;
-  pDdiTable->pfnGetFunctionPointer = urProgramGetFunctionPointer;
-  pDdiTable->pfnGetGlobalVariablePointer = urProgramGetGlobalVariablePointer;
-  pDdiTable->pfnGetInfo = urProgramGetInfo;
-  pDdiTable->pfnGetNativeHandle = urProgramGetNativeHandle;
-  pDdiTable->pfnLink = urProgramLink;
-  pDdiTable->pfnRelease = urProgramRelease;
-  pDdiTable->pfnRetain = urProgramRetain;
+  pDdiTable->pfnBuild = ur::opencl::urProgramBuild;
+  pDdiTable->pfnCompile = ur::opencl::urProgramCompile;
+  pDdiTable->pfnCreateWithBinary = ur::opencl::urProgramCreateWithBinary;
+  pDdiTable->pfnCreateWithIL = ur::opencl::urProgramCreateWithIL;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::opencl::urProgramCreateWithNativeHandle;
+  pDdiTable->pfnGetBuildInfo = ur::opencl::urProgramGetBuildInfo;
+  pDdiTable->pfnGetFunctionPointer = ur::opencl::urProgramGetFunctionPointer;
+  pDdiTable->pfnGetGlobalVariablePointer =
+      ur::opencl::urProgramGetGlobalVariablePointer;
+  pDdiTable->pfnGetInfo = ur::opencl::urProgramGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::opencl::urProgramGetNativeHandle;
+  pDdiTable->pfnLink = ur::opencl::urProgramLink;
+  pDdiTable->pfnRelease = ur::opencl::urProgramRelease;
+  pDdiTable->pfnRetain = ur::opencl::urProgramRetain;
   pDdiTable->pfnSetSpecializationConstants =
-      urProgramSetSpecializationConstants;
+      ur::opencl::urProgramSetSpecializationConstants;
   return UR_RESULT_SUCCESS;
 }
 
@@ -110,22 +131,24 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelProcAddrTable(
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnCreate = urKernelCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urKernelCreateWithNativeHandle;
-  pDdiTable->pfnGetGroupInfo = urKernelGetGroupInfo;
-  pDdiTable->pfnGetInfo = urKernelGetInfo;
-  pDdiTable->pfnGetNativeHandle = urKernelGetNativeHandle;
-  pDdiTable->pfnGetSubGroupInfo = urKernelGetSubGroupInfo;
-  pDdiTable->pfnRelease = urKernelRelease;
-  pDdiTable->pfnRetain = urKernelRetain;
-  pDdiTable->pfnSetArgLocal = urKernelSetArgLocal;
-  pDdiTable->pfnSetArgMemObj = urKernelSetArgMemObj;
-  pDdiTable->pfnSetArgPointer = urKernelSetArgPointer;
-  pDdiTable->pfnSetArgSampler = urKernelSetArgSampler;
-  pDdiTable->pfnSetArgValue = urKernelSetArgValue;
-  pDdiTable->pfnSetExecInfo = urKernelSetExecInfo;
+  pDdiTable->pfnCreate = ur::opencl::urKernelCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::opencl::urKernelCreateWithNativeHandle;
+  pDdiTable->pfnGetGroupInfo = ur::opencl::urKernelGetGroupInfo;
+  pDdiTable->pfnGetInfo = ur::opencl::urKernelGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::opencl::urKernelGetNativeHandle;
+  pDdiTable->pfnGetSubGroupInfo = ur::opencl::urKernelGetSubGroupInfo;
+  pDdiTable->pfnRelease = ur::opencl::urKernelRelease;
+  pDdiTable->pfnRetain = ur::opencl::urKernelRetain;
+  pDdiTable->pfnSetArgLocal = ur::opencl::urKernelSetArgLocal;
+  pDdiTable->pfnSetArgMemObj = ur::opencl::urKernelSetArgMemObj;
+  pDdiTable->pfnSetArgPointer = ur::opencl::urKernelSetArgPointer;
+  pDdiTable->pfnSetArgSampler = ur::opencl::urKernelSetArgSampler;
+  pDdiTable->pfnSetArgValue = ur::opencl::urKernelSetArgValue;
+  pDdiTable->pfnSetExecInfo = ur::opencl::urKernelSetExecInfo;
   pDdiTable->pfnSetSpecializationConstants = nullptr;
-  pDdiTable->pfnGetSuggestedLocalWorkSize = urKernelGetSuggestedLocalWorkSize;
+  pDdiTable->pfnGetSuggestedLocalWorkSize =
+      ur::opencl::urKernelGetSuggestedLocalWorkSize;
   return UR_RESULT_SUCCESS;
 }
 
@@ -135,12 +158,13 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetSamplerProcAddrTable(
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnCreate = urSamplerCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urSamplerCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urSamplerGetInfo;
-  pDdiTable->pfnGetNativeHandle = urSamplerGetNativeHandle;
-  pDdiTable->pfnRelease = urSamplerRelease;
-  pDdiTable->pfnRetain = urSamplerRetain;
+  pDdiTable->pfnCreate = ur::opencl::urSamplerCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::opencl::urSamplerCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::opencl::urSamplerGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::opencl::urSamplerGetNativeHandle;
+  pDdiTable->pfnRelease = ur::opencl::urSamplerRelease;
+  pDdiTable->pfnRetain = ur::opencl::urSamplerRetain;
   return UR_RESULT_SUCCESS;
 }
 
@@ -150,16 +174,16 @@ urGetMemProcAddrTable(ur_api_version_t Version, ur_mem_dditable_t *pDdiTable) {
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnBufferCreate = urMemBufferCreate;
-  pDdiTable->pfnBufferPartition = urMemBufferPartition;
+  pDdiTable->pfnBufferCreate = ur::opencl::urMemBufferCreate;
+  pDdiTable->pfnBufferPartition = ur::opencl::urMemBufferPartition;
   pDdiTable->pfnBufferCreateWithNativeHandle =
-      urMemBufferCreateWithNativeHandle;
-  pDdiTable->pfnGetInfo = urMemGetInfo;
-  pDdiTable->pfnGetNativeHandle = urMemGetNativeHandle;
-  pDdiTable->pfnImageCreate = urMemImageCreate;
-  pDdiTable->pfnImageGetInfo = urMemImageGetInfo;
-  pDdiTable->pfnRelease = urMemRelease;
-  pDdiTable->pfnRetain = urMemRetain;
+      ur::opencl::urMemBufferCreateWithNativeHandle;
+  pDdiTable->pfnGetInfo = ur::opencl::urMemGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::opencl::urMemGetNativeHandle;
+  pDdiTable->pfnImageCreate = ur::opencl::urMemImageCreate;
+  pDdiTable->pfnImageGetInfo = ur::opencl::urMemImageGetInfo;
+  pDdiTable->pfnRelease = ur::opencl::urMemRelease;
+  pDdiTable->pfnRetain = ur::opencl::urMemRetain;
   return UR_RESULT_SUCCESS;
 }
 
@@ -169,31 +193,34 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnDeviceGlobalVariableRead = urEnqueueDeviceGlobalVariableRead;
-  pDdiTable->pfnDeviceGlobalVariableWrite = urEnqueueDeviceGlobalVariableWrite;
-  pDdiTable->pfnEventsWait = urEnqueueEventsWait;
-  pDdiTable->pfnEventsWaitWithBarrier = urEnqueueEventsWaitWithBarrier;
-  pDdiTable->pfnKernelLaunch = urEnqueueKernelLaunch;
-  pDdiTable->pfnMemBufferCopy = urEnqueueMemBufferCopy;
-  pDdiTable->pfnMemBufferCopyRect = urEnqueueMemBufferCopyRect;
-  pDdiTable->pfnMemBufferFill = urEnqueueMemBufferFill;
-  pDdiTable->pfnMemBufferMap = urEnqueueMemBufferMap;
-  pDdiTable->pfnMemBufferRead = urEnqueueMemBufferRead;
-  pDdiTable->pfnMemBufferReadRect = urEnqueueMemBufferReadRect;
-  pDdiTable->pfnMemBufferWrite = urEnqueueMemBufferWrite;
-  pDdiTable->pfnMemBufferWriteRect = urEnqueueMemBufferWriteRect;
-  pDdiTable->pfnMemImageCopy = urEnqueueMemImageCopy;
-  pDdiTable->pfnMemImageRead = urEnqueueMemImageRead;
-  pDdiTable->pfnMemImageWrite = urEnqueueMemImageWrite;
-  pDdiTable->pfnMemUnmap = urEnqueueMemUnmap;
-  pDdiTable->pfnUSMFill2D = urEnqueueUSMFill2D;
-  pDdiTable->pfnUSMFill = urEnqueueUSMFill;
-  pDdiTable->pfnUSMAdvise = urEnqueueUSMAdvise;
-  pDdiTable->pfnUSMMemcpy2D = urEnqueueUSMMemcpy2D;
-  pDdiTable->pfnUSMMemcpy = urEnqueueUSMMemcpy;
-  pDdiTable->pfnUSMPrefetch = urEnqueueUSMPrefetch;
-  pDdiTable->pfnReadHostPipe = urEnqueueReadHostPipe;
-  pDdiTable->pfnWriteHostPipe = urEnqueueWriteHostPipe;
+  pDdiTable->pfnDeviceGlobalVariableRead =
+      ur::opencl::urEnqueueDeviceGlobalVariableRead;
+  pDdiTable->pfnDeviceGlobalVariableWrite =
+      ur::opencl::urEnqueueDeviceGlobalVariableWrite;
+  pDdiTable->pfnEventsWait = ur::opencl::urEnqueueEventsWait;
+  pDdiTable->pfnEventsWaitWithBarrier =
+      ur::opencl::urEnqueueEventsWaitWithBarrier;
+  pDdiTable->pfnKernelLaunch = ur::opencl::urEnqueueKernelLaunch;
+  pDdiTable->pfnMemBufferCopy = ur::opencl::urEnqueueMemBufferCopy;
+  pDdiTable->pfnMemBufferCopyRect = ur::opencl::urEnqueueMemBufferCopyRect;
+  pDdiTable->pfnMemBufferFill = ur::opencl::urEnqueueMemBufferFill;
+  pDdiTable->pfnMemBufferMap = ur::opencl::urEnqueueMemBufferMap;
+  pDdiTable->pfnMemBufferRead = ur::opencl::urEnqueueMemBufferRead;
+  pDdiTable->pfnMemBufferReadRect = ur::opencl::urEnqueueMemBufferReadRect;
+  pDdiTable->pfnMemBufferWrite = ur::opencl::urEnqueueMemBufferWrite;
+  pDdiTable->pfnMemBufferWriteRect = ur::opencl::urEnqueueMemBufferWriteRect;
+  pDdiTable->pfnMemImageCopy = ur::opencl::urEnqueueMemImageCopy;
+  pDdiTable->pfnMemImageRead = ur::opencl::urEnqueueMemImageRead;
+  pDdiTable->pfnMemImageWrite = ur::opencl::urEnqueueMemImageWrite;
+  pDdiTable->pfnMemUnmap = ur::opencl::urEnqueueMemUnmap;
+  pDdiTable->pfnUSMFill2D = ur::opencl::urEnqueueUSMFill2D;
+  pDdiTable->pfnUSMFill = ur::opencl::urEnqueueUSMFill;
+  pDdiTable->pfnUSMAdvise = ur::opencl::urEnqueueUSMAdvise;
+  pDdiTable->pfnUSMMemcpy2D = ur::opencl::urEnqueueUSMMemcpy2D;
+  pDdiTable->pfnUSMMemcpy = ur::opencl::urEnqueueUSMMemcpy;
+  pDdiTable->pfnUSMPrefetch = ur::opencl::urEnqueueUSMPrefetch;
+  pDdiTable->pfnReadHostPipe = ur::opencl::urEnqueueReadHostPipe;
+  pDdiTable->pfnWriteHostPipe = ur::opencl::urEnqueueWriteHostPipe;
   return UR_RESULT_SUCCESS;
 }
 
@@ -203,11 +230,11 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnAdapterGet = urAdapterGet;
-  pDdiTable->pfnAdapterRelease = urAdapterRelease;
-  pDdiTable->pfnAdapterRetain = urAdapterRetain;
-  pDdiTable->pfnAdapterGetLastError = urAdapterGetLastError;
-  pDdiTable->pfnAdapterGetInfo = urAdapterGetInfo;
+  pDdiTable->pfnAdapterGet = ur::opencl::urAdapterGet;
+  pDdiTable->pfnAdapterRelease = ur::opencl::urAdapterRelease;
+  pDdiTable->pfnAdapterRetain = ur::opencl::urAdapterRetain;
+  pDdiTable->pfnAdapterGetLastError = ur::opencl::urAdapterGetLastError;
+  pDdiTable->pfnAdapterGetInfo = ur::opencl::urAdapterGetInfo;
   return UR_RESULT_SUCCESS;
 }
 
@@ -217,14 +244,28 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnCreate = urQueueCreate;
-  pDdiTable->pfnCreateWithNativeHandle = urQueueCreateWithNativeHandle;
-  pDdiTable->pfnFinish = urQueueFinish;
-  pDdiTable->pfnFlush = urQueueFlush;
-  pDdiTable->pfnGetInfo = urQueueGetInfo;
-  pDdiTable->pfnGetNativeHandle = urQueueGetNativeHandle;
-  pDdiTable->pfnRelease = urQueueRelease;
-  pDdiTable->pfnRetain = urQueueRetain;
+  pDdiTable->pfnCreate = ur::opencl::urQueueCreate;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::opencl::urQueueCreateWithNativeHandle;
+  pDdiTable->pfnFinish = ur::opencl::urQueueFinish;
+  pDdiTable->pfnFlush = ur::opencl::urQueueFlush;
+  pDdiTable->pfnGetInfo = ur::opencl::urQueueGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::opencl::urQueueGetNativeHandle;
+  pDdiTable->pfnRelease = ur::opencl::urQueueRelease;
+  pDdiTable->pfnRetain = ur::opencl::urQueueRetain;
+  return UR_RESULT_SUCCESS;
+}
+
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ur_queue_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnReserveTimestampMarkersExp =
+      ur::opencl::urQueueReserveTimestampMarkersExp;
+  pDdiTable->pfnReadTimestampMarkersExp =
+      ur::opencl::urQueueReadTimestampMarkersExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -234,15 +275,15 @@ urGetUSMProcAddrTable(ur_api_version_t Version, ur_usm_dditable_t *pDdiTable) {
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnDeviceAlloc = urUSMDeviceAlloc;
-  pDdiTable->pfnFree = urUSMFree;
-  pDdiTable->pfnGetMemAllocInfo = urUSMGetMemAllocInfo;
-  pDdiTable->pfnHostAlloc = urUSMHostAlloc;
+  pDdiTable->pfnDeviceAlloc = ur::opencl::urUSMDeviceAlloc;
+  pDdiTable->pfnFree = ur::opencl::urUSMFree;
+  pDdiTable->pfnGetMemAllocInfo = ur::opencl::urUSMGetMemAllocInfo;
+  pDdiTable->pfnHostAlloc = ur::opencl::urUSMHostAlloc;
   pDdiTable->pfnPoolCreate = nullptr;
   pDdiTable->pfnPoolRetain = nullptr;
   pDdiTable->pfnPoolRelease = nullptr;
   pDdiTable->pfnPoolGetInfo = nullptr;
-  pDdiTable->pfnSharedAlloc = urUSMSharedAlloc;
+  pDdiTable->pfnSharedAlloc = ur::opencl::urUSMSharedAlloc;
   return UR_RESULT_SUCCESS;
 }
 
@@ -253,8 +294,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
     return Result;
   }
 
-  pDdiTable->pfnImportExp = urUSMImportExp;
-  pDdiTable->pfnReleaseExp = urUSMReleaseExp;
+  pDdiTable->pfnImportExp = ur::opencl::urUSMImportExp;
+  pDdiTable->pfnReleaseExp = ur::opencl::urUSMReleaseExp;
+  pDdiTable->pfnPoolTrimExp = ur::opencl::urUSMPoolTrimExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -264,15 +306,16 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetDeviceProcAddrTable(
   if (UR_RESULT_SUCCESS != Result) {
     return Result;
   }
-  pDdiTable->pfnCreateWithNativeHandle = urDeviceCreateWithNativeHandle;
-  pDdiTable->pfnGet = urDeviceGet;
-  pDdiTable->pfnGetGlobalTimestamps = urDeviceGetGlobalTimestamps;
-  pDdiTable->pfnGetInfo = urDeviceGetInfo;
-  pDdiTable->pfnGetNativeHandle = urDeviceGetNativeHandle;
-  pDdiTable->pfnPartition = urDevicePartition;
-  pDdiTable->pfnRelease = urDeviceRelease;
-  pDdiTable->pfnRetain = urDeviceRetain;
-  pDdiTable->pfnSelectBinary = urDeviceSelectBinary;
+  pDdiTable->pfnCreateWithNativeHandle =
+      ur::opencl::urDeviceCreateWithNativeHandle;
+  pDdiTable->pfnGet = ur::opencl::urDeviceGet;
+  pDdiTable->pfnGetGlobalTimestamps = ur::opencl::urDeviceGetGlobalTimestamps;
+  pDdiTable->pfnGetInfo = ur::opencl::urDeviceGetInfo;
+  pDdiTable->pfnGetNativeHandle = ur::opencl::urDeviceGetNativeHandle;
+  pDdiTable->pfnPartition = ur::opencl::urDevicePartition;
+  pDdiTable->pfnRelease = ur::opencl::urDeviceRelease;
+  pDdiTable->pfnRetain = ur::opencl::urDeviceRetain;
+  pDdiTable->pfnSelectBinary = ur::opencl::urDeviceSelectBinary;
   return UR_RESULT_SUCCESS;
 }
 
@@ -282,32 +325,42 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
   if (UR_RESULT_SUCCESS != retVal) {
     return retVal;
   }
-  pDdiTable->pfnCreateExp = urCommandBufferCreateExp;
-  pDdiTable->pfnRetainExp = urCommandBufferRetainExp;
-  pDdiTable->pfnReleaseExp = urCommandBufferReleaseExp;
-  pDdiTable->pfnFinalizeExp = urCommandBufferFinalizeExp;
-  pDdiTable->pfnAppendKernelLaunchExp = urCommandBufferAppendKernelLaunchExp;
-  pDdiTable->pfnAppendUSMMemcpyExp = urCommandBufferAppendUSMMemcpyExp;
-  pDdiTable->pfnAppendUSMFillExp = urCommandBufferAppendUSMFillExp;
-  pDdiTable->pfnAppendMemBufferCopyExp = urCommandBufferAppendMemBufferCopyExp;
+  pDdiTable->pfnCreateExp = ur::opencl::urCommandBufferCreateExp;
+  pDdiTable->pfnRetainExp = ur::opencl::urCommandBufferRetainExp;
+  pDdiTable->pfnReleaseExp = ur::opencl::urCommandBufferReleaseExp;
+  pDdiTable->pfnFinalizeExp = ur::opencl::urCommandBufferFinalizeExp;
+  pDdiTable->pfnAppendKernelLaunchExp =
+      ur::opencl::urCommandBufferAppendKernelLaunchExp;
+  pDdiTable->pfnAppendUSMMemcpyExp =
+      ur::opencl::urCommandBufferAppendUSMMemcpyExp;
+  pDdiTable->pfnAppendUSMFillExp = ur::opencl::urCommandBufferAppendUSMFillExp;
+  pDdiTable->pfnAppendMemBufferCopyExp =
+      ur::opencl::urCommandBufferAppendMemBufferCopyExp;
   pDdiTable->pfnAppendMemBufferCopyRectExp =
-      urCommandBufferAppendMemBufferCopyRectExp;
-  pDdiTable->pfnAppendMemBufferReadExp = urCommandBufferAppendMemBufferReadExp;
+      ur::opencl::urCommandBufferAppendMemBufferCopyRectExp;
+  pDdiTable->pfnAppendMemBufferReadExp =
+      ur::opencl::urCommandBufferAppendMemBufferReadExp;
   pDdiTable->pfnAppendMemBufferReadRectExp =
-      urCommandBufferAppendMemBufferReadRectExp;
+      ur::opencl::urCommandBufferAppendMemBufferReadRectExp;
   pDdiTable->pfnAppendMemBufferWriteExp =
-      urCommandBufferAppendMemBufferWriteExp;
+      ur::opencl::urCommandBufferAppendMemBufferWriteExp;
   pDdiTable->pfnAppendMemBufferWriteRectExp =
-      urCommandBufferAppendMemBufferWriteRectExp;
-  pDdiTable->pfnAppendUSMPrefetchExp = urCommandBufferAppendUSMPrefetchExp;
-  pDdiTable->pfnAppendUSMAdviseExp = urCommandBufferAppendUSMAdviseExp;
-  pDdiTable->pfnAppendMemBufferFillExp = urCommandBufferAppendMemBufferFillExp;
-  pDdiTable->pfnEnqueueExp = urCommandBufferEnqueueExp;
-  pDdiTable->pfnUpdateKernelLaunchExp = urCommandBufferUpdateKernelLaunchExp;
-  pDdiTable->pfnGetInfoExp = urCommandBufferGetInfoExp;
-  pDdiTable->pfnCommandGetInfoExp = urCommandBufferCommandGetInfoExp;
-  pDdiTable->pfnReleaseCommandExp = urCommandBufferReleaseCommandExp;
-  pDdiTable->pfnRetainCommandExp = urCommandBufferRetainCommandExp;
+      ur::opencl::urCommandBufferAppendMemBufferWriteRectExp;
+  pDdiTable->pfnAppendUSMPrefetchExp =
+      ur::opencl::urCommandBufferAppendUSMPrefetchExp;
+  pDdiTable->pfnAppendUSMAdviseExp =
+      ur::opencl::urCommandBufferAppendUSMAdviseExp;
+  pDdiTable->pfnAppendMemBufferFillExp =
+      ur::opencl::urCommandBufferAppendMemBufferFillExp;
+  pDdiTable->pfnEnqueueExp = ur::opencl::urCommandBufferEnqueueExp;
+  pDdiTable->pfnUpdateKernelLaunchExp =
+      ur::opencl::urCommandBufferUpdateKernelLaunchExp;
+  pDdiTable->pfnGetInfoExp = ur::opencl::urCommandBufferGetInfoExp;
+  pDdiTable->pfnCommandGetInfoExp =
+      ur::opencl::urCommandBufferCommandGetInfoExp;
+  pDdiTable->pfnReleaseCommandExp =
+      ur::opencl::urCommandBufferReleaseCommandExp;
+  pDdiTable->pfnRetainCommandExp = ur::opencl::urCommandBufferRetainCommandExp;
 
   return retVal;
 }
@@ -318,9 +371,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUsmP2PExpProcAddrTable(
   if (UR_RESULT_SUCCESS != retVal) {
     return retVal;
   }
-  pDdiTable->pfnEnablePeerAccessExp = urUsmP2PEnablePeerAccessExp;
-  pDdiTable->pfnDisablePeerAccessExp = urUsmP2PDisablePeerAccessExp;
-  pDdiTable->pfnPeerAccessGetInfoExp = urUsmP2PPeerAccessGetInfoExp;
+  pDdiTable->pfnEnablePeerAccessExp = ur::opencl::urUsmP2PEnablePeerAccessExp;
+  pDdiTable->pfnDisablePeerAccessExp = ur::opencl::urUsmP2PDisablePeerAccessExp;
+  pDdiTable->pfnPeerAccessGetInfoExp = ur::opencl::urUsmP2PPeerAccessGetInfoExp;
 
   return retVal;
 }
@@ -332,33 +385,36 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
     return result;
   }
   pDdiTable->pfnUnsampledImageHandleDestroyExp =
-      urBindlessImagesUnsampledImageHandleDestroyExp;
+      ur::opencl::urBindlessImagesUnsampledImageHandleDestroyExp;
   pDdiTable->pfnSampledImageHandleDestroyExp =
-      urBindlessImagesSampledImageHandleDestroyExp;
-  pDdiTable->pfnImageAllocateExp = urBindlessImagesImageAllocateExp;
-  pDdiTable->pfnImageFreeExp = urBindlessImagesImageFreeExp;
+      ur::opencl::urBindlessImagesSampledImageHandleDestroyExp;
+  pDdiTable->pfnImageAllocateExp = ur::opencl::urBindlessImagesImageAllocateExp;
+  pDdiTable->pfnImageFreeExp = ur::opencl::urBindlessImagesImageFreeExp;
   pDdiTable->pfnUnsampledImageCreateExp =
-      urBindlessImagesUnsampledImageCreateExp;
-  pDdiTable->pfnSampledImageCreateExp = urBindlessImagesSampledImageCreateExp;
-  pDdiTable->pfnImageCopyExp = urBindlessImagesImageCopyExp;
-  pDdiTable->pfnImageGetInfoExp = urBindlessImagesImageGetInfoExp;
-  pDdiTable->pfnMipmapGetLevelExp = urBindlessImagesMipmapGetLevelExp;
-  pDdiTable->pfnMipmapFreeExp = urBindlessImagesMipmapFreeExp;
+      ur::opencl::urBindlessImagesUnsampledImageCreateExp;
+  pDdiTable->pfnSampledImageCreateExp =
+      ur::opencl::urBindlessImagesSampledImageCreateExp;
+  pDdiTable->pfnImageCopyExp = ur::opencl::urBindlessImagesImageCopyExp;
+  pDdiTable->pfnImageGetInfoExp = ur::opencl::urBindlessImagesImageGetInfoExp;
+  pDdiTable->pfnMipmapGetLevelExp =
+      ur::opencl::urBindlessImagesMipmapGetLevelExp;
+  pDdiTable->pfnMipmapFreeExp = ur::opencl::urBindlessImagesMipmapFreeExp;
   pDdiTable->pfnImportExternalMemoryExp =
-      urBindlessImagesImportExternalMemoryExp;
-  pDdiTable->pfnMapExternalArrayExp = urBindlessImagesMapExternalArrayExp;
+      ur::opencl::urBindlessImagesImportExternalMemoryExp;
+  pDdiTable->pfnMapExternalArrayExp =
+      ur::opencl::urBindlessImagesMapExternalArrayExp;
   pDdiTable->pfnMapExternalLinearMemoryExp =
-      urBindlessImagesMapExternalLinearMemoryExp;
+      ur::opencl::urBindlessImagesMapExternalLinearMemoryExp;
   pDdiTable->pfnReleaseExternalMemoryExp =
-      urBindlessImagesReleaseExternalMemoryExp;
+      ur::opencl::urBindlessImagesReleaseExternalMemoryExp;
   pDdiTable->pfnImportExternalSemaphoreExp =
-      urBindlessImagesImportExternalSemaphoreExp;
+      ur::opencl::urBindlessImagesImportExternalSemaphoreExp;
   pDdiTable->pfnReleaseExternalSemaphoreExp =
-      urBindlessImagesReleaseExternalSemaphoreExp;
+      ur::opencl::urBindlessImagesReleaseExternalSemaphoreExp;
   pDdiTable->pfnWaitExternalSemaphoreExp =
-      urBindlessImagesWaitExternalSemaphoreExp;
+      ur::opencl::urBindlessImagesWaitExternalSemaphoreExp;
   pDdiTable->pfnSignalExternalSemaphoreExp =
-      urBindlessImagesSignalExternalSemaphoreExp;
+      ur::opencl::urBindlessImagesSignalExternalSemaphoreExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -369,13 +425,13 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetVirtualMemProcAddrTable(
     return retVal;
   }
 
-  pDdiTable->pfnFree = urVirtualMemFree;
-  pDdiTable->pfnGetInfo = urVirtualMemGetInfo;
-  pDdiTable->pfnGranularityGetInfo = urVirtualMemGranularityGetInfo;
-  pDdiTable->pfnMap = urVirtualMemMap;
-  pDdiTable->pfnReserve = urVirtualMemReserve;
-  pDdiTable->pfnSetAccess = urVirtualMemSetAccess;
-  pDdiTable->pfnUnmap = urVirtualMemUnmap;
+  pDdiTable->pfnFree = ur::opencl::urVirtualMemFree;
+  pDdiTable->pfnGetInfo = ur::opencl::urVirtualMemGetInfo;
+  pDdiTable->pfnGranularityGetInfo = ur::opencl::urVirtualMemGranularityGetInfo;
+  pDdiTable->pfnMap = ur::opencl::urVirtualMemMap;
+  pDdiTable->pfnReserve = ur::opencl::urVirtualMemReserve;
+  pDdiTable->pfnSetAccess = ur::opencl::urVirtualMemSetAccess;
+  pDdiTable->pfnUnmap = ur::opencl::urVirtualMemUnmap;
 
   return retVal;
 }
@@ -387,9 +443,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPhysicalMemProcAddrTable(
     return retVal;
   }
 
-  pDdiTable->pfnCreate = urPhysicalMemCreate;
-  pDdiTable->pfnRelease = urPhysicalMemRelease;
-  pDdiTable->pfnRetain = urPhysicalMemRetain;
+  pDdiTable->pfnCreate = ur::opencl::urPhysicalMemCreate;
+  pDdiTable->pfnRelease = ur::opencl::urPhysicalMemRelease;
+  pDdiTable->pfnRetain = ur::opencl::urPhysicalMemRetain;
 
   return retVal;
 }
@@ -402,9 +458,17 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
   }
 
   pDdiTable->pfnCooperativeKernelLaunchExp =
-      urEnqueueCooperativeKernelLaunchExp;
-  pDdiTable->pfnTimestampRecordingExp = urEnqueueTimestampRecordingExp;
-  pDdiTable->pfnNativeCommandExp = urEnqueueNativeCommandExp;
+      ur::opencl::urEnqueueCooperativeKernelLaunchExp;
+  pDdiTable->pfnTimestampRecordingExp =
+      ur::opencl::urEnqueueTimestampRecordingExp;
+  pDdiTable->pfnNativeCommandExp = ur::opencl::urEnqueueNativeCommandExp;
+  pDdiTable->pfnUSMDeviceAllocExp = ur::opencl::urEnqueueUSMDeviceAllocExp;
+  pDdiTable->pfnUSMFreeExp = ur::opencl::urEnqueueUSMFreeExp;
+  pDdiTable->pfnMemBufferCopyRectBatchExp =
+      ur::opencl::urEnqueueMemBufferCopyRectBatchExp;
+  pDdiTable->pfnKernelLaunchBatchExp =
+      ur::opencl::urEnqueueKernelLaunchBatchExp;
+  pDdiTable->pfnTimestampMarkerExp = ur::opencl::urEnqueueTimestampMarkerExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -417,7 +481,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
   }
 
   pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
-      urKernelSuggestMaxCooperativeGroupCountExp;
+      ur::opencl::urKernelSuggestMaxCooperativeGroupCountExp;
+  pDdiTable->pfnSetArgsExp = ur::opencl::urKernelSetArgsExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -429,12 +494,113 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
     return result;
   }
 
-  pDdiTable->pfnBuildExp = urProgramBuildExp;
-  pDdiTable->pfnCompileExp = urProgramCompileExp;
-  pDdiTable->pfnLinkExp = urProgramLinkExp;
+  pDdiTable->pfnBuildExp = ur::opencl::urProgramBuildExp;
+  pDdiTable->pfnCompileExp = ur::opencl::urProgramCompileExp;
+  pDdiTable->pfnLinkExp = ur::opencl::urProgramLinkExp;
 
   return UR_RESULT_SUCCESS;
 }
-#if defined(__cplusplus)
+#ifdef UR_STATIC_ADAPTER_OPENCL
+} // namespace ur::opencl
+#elif defined(__cplusplus)
 } // extern "C"
 #endif
+
+#ifdef UR_STATIC_ADAPTER_OPENCL
+namespace ur::opencl {
+ur_result_t urAdapterGetDdiTables(ur_dditable_t *ddi) {
+  if (ddi == nullptr) {
+    return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+  }
+
+  ur_result_t result;
+
+  result = ur::opencl::urGetPlatformProcAddrTable(UR_API_VERSION_CURRENT,
+                                                  &ddi->Platform);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetContextProcAddrTable(UR_API_VERSION_CURRENT,
+                                                 &ddi->Context);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::opencl::urGetEventProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Event);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetEventExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                  &ddi->EventExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetProgramProcAddrTable(UR_API_VERSION_CURRENT,
+                                                 &ddi->Program);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetKernelProcAddrTable(UR_API_VERSION_CURRENT,
+                                                &ddi->Kernel);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetSamplerProcAddrTable(UR_API_VERSION_CURRENT,
+                                                 &ddi->Sampler);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetEnqueueProcAddrTable(UR_API_VERSION_CURRENT,
+                                                 &ddi->Enqueue);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetGlobalProcAddrTable(UR_API_VERSION_CURRENT,
+                                                &ddi->Global);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result =
+      ur::opencl::urGetQueueProcAddrTable(UR_API_VERSION_CURRENT, &ddi->Queue);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetQueueExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                  &ddi->QueueExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetUSMExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                &ddi->USMExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetDeviceProcAddrTable(UR_API_VERSION_CURRENT,
+                                                &ddi->Device);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetCommandBufferExpProcAddrTable(
+      UR_API_VERSION_CURRENT, &ddi->CommandBufferExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetUsmP2PExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                   &ddi->UsmP2PExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetBindlessImagesExpProcAddrTable(
+      UR_API_VERSION_CURRENT, &ddi->BindlessImagesExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetVirtualMemProcAddrTable(UR_API_VERSION_CURRENT,
+                                                    &ddi->VirtualMem);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetPhysicalMemProcAddrTable(UR_API_VERSION_CURRENT,
+                                                     &ddi->PhysicalMem);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetEnqueueExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                    &ddi->EnqueueExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetKernelExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                   &ddi->KernelExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+  result = ur::opencl::urGetProgramExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                    &ddi->ProgramExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+
+  return result;
+}
+} // namespace ur::opencl
+#endif
@@ -11,6 +11,9 @@
 #include <ur/ur.hpp>
 
 #include "common.hpp"
+#include "latency_tracker.hpp"
+#include "usm_svm.hpp"
+#include "ur_interface_loader.hpp"
 
 inline cl_mem_alloc_flags_intel
 hostDescToClFlags(const ur_usm_host_desc_t &desc) {
@@ -80,9 +83,11 @@ usmDescToCLMemProperties(const ur_base_desc_t *Desc,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
-               ur_usm_pool_handle_t, size_t size, void **ppMem) {
+namespace ur::opencl {
+
+ur_result_t urUSMHostAlloc(ur_context_handle_t hContext,
+                           const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t,
+                           size_t size, void **ppMem) {
 
   void *Ptr = nullptr;
   uint32_t Alignment = pUSMDesc ? pUSMDesc->align : 0;
@@ -104,7 +109,12 @@ urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
   if (auto UrResult = cl_ext::getExtFuncFromContext<clHostMemAllocINTEL_fn>(
           CLContext, cl_ext::ExtFuncPtrCache->clHostMemAllocINTELCache,
           cl_ext::HostMemAllocName, &FuncPtr)) {
-    return UrResult;
+    if (UrResult != UR_RESULT_ERROR_UNSUPPORTED_FEATURE ||
+        !cl_adapter::SVMPools) {
+      return UrResult;
+    }
+    UR_RETURN_ON_FAILURE(cl_adapter::SVMPools->alloc(
+        CLContext, cl_adapter::SVMPoolsT::Host, size, Alignment, &Ptr));
   }
 
   if (FuncPtr) {
@@ -127,10 +137,10 @@ urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t,
-                 size_t size, void **ppMem) {
+ur_result_t urUSMDeviceAlloc(ur_context_handle_t hContext,
+                             ur_device_handle_t hDevice,
+                             const ur_usm_desc_t *pUSMDesc,
+                             ur_usm_pool_handle_t, size_t size, void **ppMem) {
 
   void *Ptr = nullptr;
   uint32_t Alignment = pUSMDesc ? pUSMDesc->align : 0;
@@ -152,7 +162,12 @@ urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
   if (auto UrResult = cl_ext::getExtFuncFromContext<clDeviceMemAllocINTEL_fn>(
           CLContext, cl_ext::ExtFuncPtrCache->clDeviceMemAllocINTELCache,
           cl_ext::DeviceMemAllocName, &FuncPtr)) {
-    return UrResult;
+    if (UrResult != UR_RESULT_ERROR_UNSUPPORTED_FEATURE ||
+        !cl_adapter::SVMPools) {
+      return UrResult;
+    }
+    UR_RETURN_ON_FAILURE(cl_adapter::SVMPools->alloc(
+        CLContext, cl_adapter::SVMPoolsT::Device, size, Alignment, &Ptr));
   }
 
   if (FuncPtr) {
@@ -175,10 +190,10 @@ urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t,
-                 size_t size, void **ppMem) {
+ur_result_t urUSMSharedAlloc(ur_context_handle_t hContext,
+                             ur_device_handle_t hDevice,
+                             const ur_usm_desc_t *pUSMDesc,
+                             ur_usm_pool_handle_t, size_t size, void **ppMem) {
 
   void *Ptr = nullptr;
   uint32_t Alignment = pUSMDesc ? pUSMDesc->align : 0;
@@ -200,7 +215,12 @@ urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
   if (auto UrResult = cl_ext::getExtFuncFromContext<clSharedMemAllocINTEL_fn>(
           CLContext, cl_ext::ExtFuncPtrCache->clSharedMemAllocINTELCache,
           cl_ext::SharedMemAllocName, &FuncPtr)) {
-    return UrResult;
+    if (UrResult != UR_RESULT_ERROR_UNSUPPORTED_FEATURE ||
+        !cl_adapter::SVMPools) {
+      return UrResult;
+    }
+    UR_RETURN_ON_FAILURE(cl_adapter::SVMPools->alloc(
+        CLContext, cl_adapter::SVMPoolsT::Shared, size, Alignment, &Ptr));
   }
 
   if (FuncPtr) {
@@ -222,8 +242,7 @@ urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
-                                              void *pMem) {
+ur_result_t urUSMFree(ur_context_handle_t hContext, void *pMem) {
 
   // Use a blocking free to avoid issues with indirect access from kernels that
   // might be still running.
@@ -237,15 +256,46 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
 
   if (FuncPtr) {
     RetVal = mapCLErrorToUR(FuncPtr(CLContext, pMem));
+  } else if (RetVal == UR_RESULT_ERROR_UNSUPPORTED_FEATURE &&
+             cl_adapter::SVMPools) {
+    RetVal = cl_adapter::SVMPools->free(CLContext, pMem);
   }
 
   return RetVal;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
-    ur_queue_handle_t hQueue, void *ptr, size_t patternSize,
-    const void *pPattern, size_t size, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+// urEnqueueUSMFill of the USM emulated with SVM
+static ur_result_t enqueueSVMFill(cl_command_queue Queue, void *Ptr,
+                                  size_t PatternSize, const void *Pattern,
+                                  size_t Size, uint32_t NumEventsInWaitList,
+                                  const cl_event *EventWaitList,
+                                  cl_event *Event) {
+  if (PatternSize <= 128 && isPowerOf2(PatternSize)) {
+    CL_RETURN_ON_FAILURE(clEnqueueSVMMemFill(Queue, Ptr, Pattern, PatternSize,
+                                             Size, NumEventsInWaitList,
+                                             EventWaitList, Event));
+    return UR_RESULT_SUCCESS;
+  }
+
+  // The same pattern sizes as clEnqueueMemFillINTEL, the others are filled
+  // on the host, blocking as the host buffer is freed on return
+  std::vector<uint8_t> HostBuffer(Size);
+  for (size_t Offset = 0; Offset < Size; Offset += PatternSize) {
+    std::memcpy(HostBuffer.data() + Offset, Pattern, PatternSize);
+  }
+  CL_RETURN_ON_FAILURE(clEnqueueSVMMemcpy(Queue, CL_TRUE, Ptr,
+                                          HostBuffer.data(), Size,
+                                          NumEventsInWaitList, EventWaitList,
+                                          Event));
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEnqueueUSMFill(ur_queue_handle_t hQueue, void *ptr,
+                             size_t patternSize, const void *pPattern,
+                             size_t size, uint32_t numEventsInWaitList,
+                             const ur_event_handle_t *phEventWaitList,
+                             ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueUSMFill");
   // Have to look up the context from the kernel
   cl_context CLContext;
   cl_int CLErr = clGetCommandQueueInfo(
@@ -255,13 +305,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
     return mapCLErrorToUR(CLErr);
   }
 
-  if (patternSize <= 128 && isPowerOf2(patternSize)) {
-    clEnqueueMemFillINTEL_fn EnqueueMemFill = nullptr;
-    UR_RETURN_ON_FAILURE(
-        cl_ext::getExtFuncFromContext<clEnqueueMemFillINTEL_fn>(
-            CLContext, cl_ext::ExtFuncPtrCache->clEnqueueMemFillINTELCache,
-            cl_ext::EnqueueMemFillName, &EnqueueMemFill));
+  clEnqueueMemFillINTEL_fn EnqueueMemFill = nullptr;
+  ur_result_t RetVal = cl_ext::getExtFuncFromContext<clEnqueueMemFillINTEL_fn>(
+      CLContext, cl_ext::ExtFuncPtrCache->clEnqueueMemFillINTELCache,
+      cl_ext::EnqueueMemFillName, &EnqueueMemFill);
+  if (RetVal == UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
+    return enqueueSVMFill(cl_adapter::cast<cl_command_queue>(hQueue), ptr,
+                          patternSize, pPattern, size, numEventsInWaitList,
+                          cl_adapter::cast<const cl_event *>(phEventWaitList),
+                          cl_adapter::cast<cl_event *>(phEvent));
+  }
+  UR_RETURN_ON_FAILURE(RetVal);
 
+  if (patternSize <= 128 && isPowerOf2(patternSize)) {
     CL_RETURN_ON_FAILURE(
         EnqueueMemFill(cl_adapter::cast<cl_command_queue>(hQueue), ptr,
                        pPattern, patternSize, size, numEventsInWaitList,
@@ -348,10 +404,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
-    ur_queue_handle_t hQueue, bool blocking, void *pDst, const void *pSrc,
-    size_t size, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMMemcpy(ur_queue_handle_t hQueue, bool blocking,
+                               void *pDst, const void *pSrc, size_t size,
+                               uint32_t numEventsInWaitList,
+                               const ur_event_handle_t *phEventWaitList,
+                               ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("urEnqueueUSMMemcpy");
 
   // Have to look up the context from the kernel
   cl_context CLContext;
@@ -373,12 +431,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
                 pSrc, size, numEventsInWaitList,
                 cl_adapter::cast<const cl_event *>(phEventWaitList),
                 cl_adapter::cast<cl_event *>(phEvent)));
+  } else if (RetVal == UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
+    // USM is emulated with SVM, see SVMPoolsT
+    RetVal = mapCLErrorToUR(clEnqueueSVMMemcpy(
+        cl_adapter::cast<cl_command_queue>(hQueue), blocking, pDst, pSrc, size,
+        numEventsInWaitList,
+        cl_adapter::cast<const cl_event *>(phEventWaitList),
+        cl_adapter::cast<cl_event *>(phEvent)));
   }
 
   return RetVal;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
+ur_result_t urEnqueueUSMPrefetch(
     ur_queue_handle_t hQueue, [[maybe_unused]] const void *pMem,
     [[maybe_unused]] size_t size,
     [[maybe_unused]] ur_usm_migration_flags_t flags,
@@ -419,10 +484,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
   */
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMAdvise(
-    ur_queue_handle_t hQueue, [[maybe_unused]] const void *pMem,
-    [[maybe_unused]] size_t size, [[maybe_unused]] ur_usm_advice_flags_t advice,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMAdvise(ur_queue_handle_t hQueue,
+                               [[maybe_unused]] const void *pMem,
+                               [[maybe_unused]] size_t size,
+                               [[maybe_unused]] ur_usm_advice_flags_t advice,
+                               ur_event_handle_t *phEvent) {
 
   return mapCLErrorToUR(clEnqueueMarkerWithWaitList(
       cl_adapter::cast<cl_command_queue>(hQueue), 0, nullptr,
@@ -457,7 +523,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMAdvise(
   */
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
+ur_result_t urEnqueueUSMFill2D(
     [[maybe_unused]] ur_queue_handle_t hQueue, [[maybe_unused]] void *pMem,
     [[maybe_unused]] size_t pitch, [[maybe_unused]] size_t patternSize,
     [[maybe_unused]] const void *pPattern, [[maybe_unused]] size_t width,
@@ -468,11 +534,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
-    ur_queue_handle_t hQueue, bool blocking, void *pDst, size_t dstPitch,
-    const void *pSrc, size_t srcPitch, size_t width, size_t height,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_event_handle_t *phEvent) {
+ur_result_t urEnqueueUSMMemcpy2D(ur_queue_handle_t hQueue, bool blocking,
+                                 void *pDst, size_t dstPitch, const void *pSrc,
+                                 size_t srcPitch, size_t width, size_t height,
+                                 uint32_t numEventsInWaitList,
+                                 const ur_event_handle_t *phEventWaitList,
+                                 ur_event_handle_t *phEvent) {
   cl_context CLContext;
   CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(
       cl_adapter::cast<cl_command_queue>(hQueue), CL_QUEUE_CONTEXT,
@@ -483,19 +550,27 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
       CLContext, cl_ext::ExtFuncPtrCache->clEnqueueMemcpyINTELCache,
       cl_ext::EnqueueMemcpyName, &FuncPtr);
 
-  if (!FuncPtr) {
+  if (!FuncPtr && RetVal != UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
     return RetVal;
   }
 
+  // Without FuncPtr, USM is emulated with SVM, see SVMPoolsT
+  auto Memcpy = [&](void *Dst, const void *Src, cl_event *Event) {
+    auto Queue = cl_adapter::cast<cl_command_queue>(hQueue);
+    auto WaitList = cl_adapter::cast<const cl_event *>(phEventWaitList);
+    return FuncPtr ? FuncPtr(Queue, false, Dst, Src, width,
+                             numEventsInWaitList, WaitList, Event)
+                   : clEnqueueSVMMemcpy(Queue, CL_FALSE, Dst, Src, width,
+                                        numEventsInWaitList, WaitList, Event);
+  };
+
   std::vector<cl_event> Events(height);
   for (size_t HeightIndex = 0; HeightIndex < height; HeightIndex++) {
     cl_event Event = nullptr;
     auto ClResult =
-        FuncPtr(cl_adapter::cast<cl_command_queue>(hQueue), false,
-                static_cast<uint8_t *>(pDst) + dstPitch * HeightIndex,
-                static_cast<const uint8_t *>(pSrc) + srcPitch * HeightIndex,
-                width, numEventsInWaitList,
-                cl_adapter::cast<const cl_event *>(phEventWaitList), &Event);
+        Memcpy(static_cast<uint8_t *>(pDst) + dstPitch * HeightIndex,
+               static_cast<const uint8_t *>(pSrc) + srcPitch * HeightIndex,
+               &Event);
     Events[HeightIndex] = Event;
     if (ClResult != CL_SUCCESS) {
       for (const auto &E : Events) {
@@ -519,6 +594,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
   CL_RETURN_ON_FAILURE(ClResult)
   return UR_RESULT_SUCCESS;
 }
+} // namespace ur::opencl
 
 ur_usm_type_t
 mapCLUSMTypeToUR(const cl_unified_shared_memory_type_intel &Type) {
@@ -535,16 +611,27 @@ mapCLUSMTypeToUR(const cl_unified_shared_memory_type_intel &Type) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
-                     ur_usm_alloc_info_t propName, size_t propSize,
-                     void *pPropValue, size_t *pPropSizeRet) {
+namespace ur::opencl {
+
+ur_result_t urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
+                                 ur_usm_alloc_info_t propName, size_t propSize,
+                                 void *pPropValue, size_t *pPropSizeRet) {
 
   clGetMemAllocInfoINTEL_fn GetMemAllocInfo = nullptr;
   cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
-  UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clGetMemAllocInfoINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clGetMemAllocInfoINTELCache,
-      cl_ext::GetMemAllocInfoName, &GetMemAllocInfo));
+  ur_result_t RetVal =
+      cl_ext::getExtFuncFromContext<clGetMemAllocInfoINTEL_fn>(
+          CLContext, cl_ext::ExtFuncPtrCache->clGetMemAllocInfoINTELCache,
+          cl_ext::GetMemAllocInfoName, &GetMemAllocInfo);
+  if (RetVal == UR_RESULT_ERROR_UNSUPPORTED_FEATURE && cl_adapter::SVMPools) {
+    // Only the type of the USM emulated with SVM is known
+    if (propName != UR_USM_ALLOC_INFO_TYPE) {
+      return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+    UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+    return ReturnValue(cl_adapter::SVMPools->getType(CLContext, pMem));
+  }
+  UR_RETURN_ON_FAILURE(RetVal);
 
   cl_mem_info_intel PropNameCL;
   switch (propName) {
@@ -584,14 +671,32 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMImportExp([[maybe_unused]] ur_context_handle_t Context,
-               [[maybe_unused]] void *HostPtr, [[maybe_unused]] size_t Size) {
+ur_result_t urUSMImportExp([[maybe_unused]] ur_context_handle_t Context,
+                           [[maybe_unused]] void *HostPtr,
+                           [[maybe_unused]] size_t Size) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t urUSMReleaseExp([[maybe_unused]] ur_context_handle_t Context,
+                            [[maybe_unused]] void *HostPtr) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t urUSMPoolTrimExp([[maybe_unused]] ur_context_handle_t Context,
+                             [[maybe_unused]] ur_usm_pool_handle_t Pool,
+                             [[maybe_unused]] size_t MinBytesToKeep) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t urEnqueueUSMDeviceAllocExp(ur_queue_handle_t, size_t, uint32_t,
+                                       const ur_event_handle_t *, void **,
+                                       ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMReleaseExp([[maybe_unused]] ur_context_handle_t Context,
-                [[maybe_unused]] void *HostPtr) {
+ur_result_t urEnqueueUSMFreeExp(ur_queue_handle_t, void *, uint32_t,
+                                const ur_event_handle_t *,
+                                ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+} // namespace ur::opencl
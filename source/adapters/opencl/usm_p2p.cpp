@@ -9,8 +9,11 @@
 //===----------------------------------------------------------------------===//
 
 #include "common.hpp"
+#include "ur_interface_loader.hpp"
 
-UR_APIEXPORT ur_result_t UR_APICALL
+namespace ur::opencl {
+
+ur_result_t
 urUsmP2PEnablePeerAccessExp([[maybe_unused]] ur_device_handle_t commandDevice,
                             [[maybe_unused]] ur_device_handle_t peerDevice) {
 
@@ -19,7 +22,7 @@ urUsmP2PEnablePeerAccessExp([[maybe_unused]] ur_device_handle_t commandDevice,
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
+ur_result_t
 urUsmP2PDisablePeerAccessExp([[maybe_unused]] ur_device_handle_t commandDevice,
                              [[maybe_unused]] ur_device_handle_t peerDevice) {
 
@@ -28,14 +31,16 @@ urUsmP2PDisablePeerAccessExp([[maybe_unused]] ur_device_handle_t commandDevice,
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
-    [[maybe_unused]] ur_device_handle_t commandDevice,
-    [[maybe_unused]] ur_device_handle_t peerDevice,
-    [[maybe_unused]] ur_exp_peer_info_t propName,
-    [[maybe_unused]] size_t propSize, [[maybe_unused]] void *pPropValue,
-    [[maybe_unused]] size_t *pPropSizeRet) {
+ur_result_t
+urUsmP2PPeerAccessGetInfoExp([[maybe_unused]] ur_device_handle_t commandDevice,
+                             [[maybe_unused]] ur_device_handle_t peerDevice,
+                             [[maybe_unused]] ur_exp_peer_info_t propName,
+                             [[maybe_unused]] size_t propSize,
+                             [[maybe_unused]] void *pPropValue,
+                             [[maybe_unused]] size_t *pPropSizeRet) {
 
   cl_adapter::die(
       "Experimental P2P feature is not implemented for OpenCL adapter.");
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+} // namespace ur::opencl
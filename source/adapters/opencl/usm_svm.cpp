@@ -0,0 +1,253 @@
+//===--------- usm_svm.cpp - OpenCL Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "usm_svm.hpp"
+#include "context.hpp"
+
+namespace {
+// Allocates the memory of an SVM pool with clSVMAlloc
+class SVMMemoryProvider {
+  ur_result_t &getLastStatusRef() {
+    static thread_local ur_result_t LastStatus = UR_RESULT_SUCCESS;
+    return LastStatus;
+  }
+
+  cl_context Context = nullptr;
+  cl_svm_mem_flags Flags = 0;
+
+public:
+  umf_result_t initialize(cl_context Ctx, cl_svm_mem_flags MemFlags) {
+    Context = Ctx;
+    Flags = MemFlags;
+    return UMF_RESULT_SUCCESS;
+  }
+  umf_result_t alloc(size_t Size, size_t Align, void **Ptr) {
+    *Ptr = clSVMAlloc(Context, Flags, Size, static_cast<cl_uint>(Align));
+    if (!*Ptr) {
+      // clSVMAlloc doesn't say why it failed
+      getLastStatusRef() = UR_RESULT_ERROR_OUT_OF_RESOURCES;
+      return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+    }
+    return UMF_RESULT_SUCCESS;
+  }
+  umf_result_t free(void *Ptr, size_t) {
+    clSVMFree(Context, Ptr);
+    return UMF_RESULT_SUCCESS;
+  }
+  void get_last_native_error(const char **, int32_t *ErrCode) {
+    *ErrCode = static_cast<int32_t>(getLastStatusRef());
+  }
+  umf_result_t get_min_page_size(void *, size_t *PageSize) {
+    *PageSize = 0;
+    return UMF_RESULT_SUCCESS;
+  }
+  umf_result_t get_recommended_page_size(size_t, size_t *) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  }
+  umf_result_t purge_lazy(void *, size_t) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  }
+  umf_result_t purge_force(void *, size_t) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  }
+  umf_result_t allocation_merge(void *, void *, size_t) {
+    return UMF_RESULT_ERROR_UNKNOWN;
+  }
+  umf_result_t allocation_split(void *, size_t, size_t) {
+    return UMF_RESULT_ERROR_UNKNOWN;
+  }
+  const char *get_name() { return "SVMMemoryProvider"; }
+};
+
+cl_device_svm_capabilities getSVMCapabilities(cl_device_id Device) {
+  cl_device_svm_capabilities Caps = 0;
+  // OpenCL 1.2 devices don't know the query
+  if (clGetDeviceInfo(Device, CL_DEVICE_SVM_CAPABILITIES, sizeof(Caps), &Caps,
+                      nullptr) != CL_SUCCESS) {
+    return 0;
+  }
+  return Caps;
+}
+
+ur_usm_type_t kindToUSMType(cl_adapter::SVMPoolsT::KindT Kind) {
+  switch (Kind) {
+  case cl_adapter::SVMPoolsT::Host:
+    return UR_USM_TYPE_HOST;
+  case cl_adapter::SVMPoolsT::Device:
+    return UR_USM_TYPE_DEVICE;
+  case cl_adapter::SVMPoolsT::Shared:
+    return UR_USM_TYPE_SHARED;
+  default:
+    return UR_USM_TYPE_UNKNOWN;
+  }
+}
+} // namespace
+
+std::vector<umf::pool_unique_handle_t> &
+cl_adapter::SVMPoolsT::getPools(cl_context Context) {
+  auto [It, Inserted] = Map.try_emplace(Context);
+  std::vector<umf::pool_unique_handle_t> &Pools = It->second;
+  if (!Inserted) {
+    return Pools;
+  }
+
+  std::unique_ptr<std::vector<cl_device_id>> Devices;
+  cl_device_svm_capabilities Caps = 0;
+  if (getDevicesFromContext(cast<ur_context_handle_t>(Context), Devices) ==
+      UR_RESULT_SUCCESS) {
+    Caps = ~cl_device_svm_capabilities{0};
+    for (cl_device_id Device : *Devices) {
+      Caps &= getSVMCapabilities(Device);
+    }
+  }
+
+  auto MakePool = [&](cl_device_svm_capabilities Required,
+                      cl_svm_mem_flags Flags, usm::DisjointPoolMemType Type) {
+    if (!(Caps & Required)) {
+      return umf::pool_unique_handle_t(nullptr, nullptr);
+    }
+    auto Provider =
+        umf::memoryProviderMakeUnique<SVMMemoryProvider>(Context, Flags)
+            .second;
+    if (!Provider) {
+      return umf::pool_unique_handle_t(nullptr, nullptr);
+    }
+    return umf::poolMakeUniqueFromOps(umfDisjointPoolOps(),
+                                      std::move(Provider),
+                                      &Configs.Configs[Type])
+        .second;
+  };
+  const cl_svm_mem_flags FineGrainFlags =
+      CL_MEM_READ_WRITE | CL_MEM_SVM_FINE_GRAIN_BUFFER;
+  Pools.resize(NumKinds);
+  Pools[Host] = MakePool(CL_DEVICE_SVM_FINE_GRAIN_BUFFER, FineGrainFlags,
+                         usm::DisjointPoolMemType::Host);
+  Pools[Device] = MakePool(CL_DEVICE_SVM_COARSE_GRAIN_BUFFER,
+                           CL_MEM_READ_WRITE, usm::DisjointPoolMemType::Device);
+  Pools[Shared] = MakePool(CL_DEVICE_SVM_FINE_GRAIN_BUFFER, FineGrainFlags,
+                           usm::DisjointPoolMemType::Shared);
+  return Pools;
+}
+
+umf_memory_pool_handle_t cl_adapter::SVMPoolsT::findPool(cl_context Context,
+                                                         const void *Ptr,
+                                                         KindT &Kind) {
+  umf_memory_pool_handle_t Pool = umfPoolByPtr(Ptr);
+  if (!Pool) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> Lock(Mutex);
+  auto It = Map.find(Context);
+  if (It == Map.end()) {
+    return nullptr;
+  }
+  for (size_t I = 0; I < It->second.size(); I++) {
+    if (It->second[I].get() == Pool) {
+      Kind = static_cast<KindT>(I);
+      return Pool;
+    }
+  }
+  return nullptr;
+}
+
+ur_result_t cl_adapter::SVMPoolsT::alloc(cl_context Context, KindT Kind,
+                                         size_t Size, uint32_t Alignment,
+                                         void **ppMem) {
+  umf_memory_pool_handle_t Pool = nullptr;
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    Pool = getPools(Context)[Kind].get();
+  }
+  if (!Pool) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  *ppMem = umfPoolAlignedMalloc(Pool, Size, Alignment);
+  if (!*ppMem) {
+    return umf::umf2urResult(umfPoolGetLastAllocationError(Pool));
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t cl_adapter::SVMPoolsT::free(cl_context Context, void *Ptr) {
+  KindT Kind;
+  umf_memory_pool_handle_t Pool = findPool(Context, Ptr, Kind);
+  if (!Pool) {
+    return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+  }
+  // Unlike clMemBlockingFreeINTEL this doesn't wait for the kernels using
+  // Ptr, the memory may be handed out again right away
+  return umf::umf2urResult(umfPoolFree(Pool, Ptr));
+}
+
+ur_usm_type_t cl_adapter::SVMPoolsT::getType(cl_context Context,
+                                             const void *Ptr) {
+  KindT Kind;
+  if (!findPool(Context, Ptr, Kind)) {
+    return UR_USM_TYPE_UNKNOWN;
+  }
+  return kindToUSMType(Kind);
+}
+
+void cl_adapter::SVMPoolsT::releaseContext(cl_context Context) {
+  std::vector<umf::pool_unique_handle_t> Released;
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    auto It = Map.find(Context);
+    if (It == Map.end()) {
+      return;
+    }
+    Released = std::move(It->second);
+    Map.erase(It);
+  }
+  // Released destroys the pools, freeing their SVM outside of the lock
+}
+
+void cl_adapter::SVMPoolsT::leak() {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  for (auto &[Context, Pools] : Map) {
+    for (umf::pool_unique_handle_t &Pool : Pools) {
+      std::ignore = Pool.release();
+    }
+  }
+  Map.clear();
+}
+
+ur_device_usm_access_capability_flags_t
+cl_adapter::getSVMUSMCapabilities(cl_device_id Device,
+                                  ur_device_info_t PropName) {
+  cl_device_svm_capabilities Caps = getSVMCapabilities(Device);
+  ur_device_usm_access_capability_flags_t Atomics =
+      (Caps & CL_DEVICE_SVM_ATOMICS)
+          ? UR_DEVICE_USM_ACCESS_CAPABILITY_FLAG_ATOMIC_ACCESS |
+                UR_DEVICE_USM_ACCESS_CAPABILITY_FLAG_ATOMIC_CONCURRENT_ACCESS
+          : 0;
+  // Fine-grained SVM can be accessed by the host and the devices while
+  // kernels are running
+  ur_device_usm_access_capability_flags_t FineGrain =
+      UR_DEVICE_USM_ACCESS_CAPABILITY_FLAG_ACCESS |
+      UR_DEVICE_USM_ACCESS_CAPABILITY_FLAG_CONCURRENT_ACCESS | Atomics;
+
+  switch (PropName) {
+  case UR_DEVICE_INFO_USM_HOST_SUPPORT:
+  case UR_DEVICE_INFO_USM_SINGLE_SHARED_SUPPORT:
+    return (Caps & CL_DEVICE_SVM_FINE_GRAIN_BUFFER) ? FineGrain : 0;
+  case UR_DEVICE_INFO_USM_DEVICE_SUPPORT:
+    return (Caps & CL_DEVICE_SVM_COARSE_GRAIN_BUFFER)
+               ? UR_DEVICE_USM_ACCESS_CAPABILITY_FLAG_ACCESS |
+                     UR_DEVICE_USM_ACCESS_CAPABILITY_FLAG_ATOMIC_ACCESS
+               : 0;
+  case UR_DEVICE_INFO_USM_SYSTEM_SHARED_SUPPORT:
+    return (Caps & CL_DEVICE_SVM_FINE_GRAIN_SYSTEM) ? FineGrain : 0;
+  default:
+    // The pools are per context, not shared across devices
+    return 0;
+  }
+}
@@ -0,0 +1,71 @@
+//===--------- usm_svm.hpp - OpenCL Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common.hpp"
+
+#include <umf_helpers.hpp>
+#include <umf_pools/disjoint_pool_config_parser.hpp>
+
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace cl_adapter {
+// USM emulated with SVM on the platforms without
+// cl_intel_unified_shared_memory: device allocations are coarse-grained SVM
+// buffers, host and shared ones fine-grained SVM buffers when all the devices
+// of the context support them.
+// clSVMAlloc is slow and SVM allocations are usually small, so they are
+// suballocated from a disjoint pool per context and kind. SVM pointers are
+// regular pointers in the SVM calls, which the USM entry points fall back on.
+struct SVMPoolsT {
+  enum KindT { Host, Device, Shared, NumKinds };
+
+  usm::DisjointPoolAllConfigs Configs;
+  std::mutex Mutex;
+  // The pools of each context, nullptr for the unsupported kinds
+  std::map<cl_context, std::vector<umf::pool_unique_handle_t>> Map;
+
+  // Allocates Size bytes of Kind in the pool of Context
+  ur_result_t alloc(cl_context Context, KindT Kind, size_t Size,
+                    uint32_t Alignment, void **ppMem);
+
+  // Frees Ptr, returns UR_RESULT_ERROR_INVALID_MEM_OBJECT if it wasn't
+  // allocated by alloc for Context
+  ur_result_t free(cl_context Context, void *Ptr);
+
+  // The USM type of Ptr, UR_USM_TYPE_UNKNOWN if it wasn't allocated by alloc
+  // for Context
+  ur_usm_type_t getType(cl_context Context, const void *Ptr);
+
+  // Destroys the pools of Context, before it is released
+  void releaseContext(cl_context Context);
+
+  // Leaves the pooled memory to the driver, which may already be torn down
+  // at exit
+  void leak();
+
+private:
+  // The pools of Context, created on first use. Mutex must be held.
+  std::vector<umf::pool_unique_handle_t> &getPools(cl_context Context);
+
+  // The pool of Context allocating Ptr and its kind, nullptr if there is none
+  umf_memory_pool_handle_t findPool(cl_context Context, const void *Ptr,
+                                    KindT &Kind);
+};
+// Like QueuePool, a raw pointer tied to the adapter lifetime
+inline SVMPoolsT *SVMPools;
+
+// The UR_DEVICE_INFO_*_SUPPORT value of the USM emulated with SVM on Device
+ur_device_usm_access_capability_flags_t
+getSVMUSMCapabilities(cl_device_id Device, ur_device_info_t PropName);
+} // namespace cl_adapter
@@ -10,10 +10,21 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <csignal>
 #include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
 
 #include "logger/ur_logger.hpp"
 
@@ -21,7 +32,10 @@
 
 #include <hdr/hdr_histogram.h>
 
-static inline bool trackLatency = []() {
+// Whether latencies are recorded, initially if UR_LOG_LATENCY sets a level.
+// Checked once per tracked scope, and can be changed at any time through
+// setLatencyTracking or the toggle signal of UR_LATENCY_EXPORT.
+static inline std::atomic<bool> trackLatency = []() {
     try {
         auto map = getenv_to_map("UR_LOG_LATENCY");
 
@@ -37,6 +51,16 @@ static inline bool trackLatency = []() {
     }
 }();
 
+inline bool isLatencyTracked() {
+    return trackLatency.load(std::memory_order_relaxed);
+}
+
+/// Enables or disables the tracking of latencies, without losing the values
+/// recorded so far.
+inline void setLatencyTracking(bool enable) {
+    trackLatency.store(enable, std::memory_order_relaxed);
+}
+
 static constexpr size_t numPercentiles = 7;
 static constexpr double percentiles[numPercentiles] = {
     50.0, 90.0, 99.0, 99.9, 99.99, 99.999, 99.9999};
@@ -53,6 +77,19 @@ struct latencyValues {
 using histogram_ptr =
     std::unique_ptr<struct hdr_histogram, decltype(&hdr_close)>;
 
+static inline histogram_ptr
+makeHistogram(int64_t lowestDiscernibleValue = 1,
+              int64_t highestTrackableValue = 100'000'000'000,
+              int significantFigures = 3) {
+    struct hdr_histogram *cHistogram = nullptr;
+    auto ret = hdr_init(lowestDiscernibleValue, highestTrackableValue,
+                        significantFigures, &cHistogram);
+    if (ret != 0) {
+        logger::error("Failed to initialize latency histogram");
+    }
+    return histogram_ptr(cHistogram, &hdr_close);
+}
+
 static inline latencyValues getValues(const struct hdr_histogram *histogram) {
     latencyValues values;
     values.count = histogram->total_count;
@@ -70,12 +107,74 @@ static inline latencyValues getValues(const struct hdr_histogram *histogram) {
     return values;
 }
 
+class latency_histogram;
+
+// Periodic export of the histograms, configured through UR_LATENCY_EXPORT:
+//   file:<path>             file the snapshot is (re)written to
+//   format:prometheus|json  defaults to prometheus (text exposition format)
+//   interval:<seconds>      defaults to 10
+//   signal:<number>         additionally export and print a snapshot when
+//                           the process receives the given signal (Linux)
+//   toggle:<number>         enable or disable the tracking when the process
+//                           receives the given signal (Linux)
+struct latency_export_config {
+    std::string file;
+    bool json = false;
+    std::chrono::seconds interval{10};
+    int signal = 0;
+    int toggle = 0;
+
+    static inline std::optional<latency_export_config> get() {
+        std::optional<EnvVarMap> map;
+        try {
+            map = getenv_to_map("UR_LATENCY_EXPORT");
+        } catch (const std::invalid_argument &e) {
+            logger::error("Invalid UR_LATENCY_EXPORT: {}", e.what());
+            return std::nullopt;
+        }
+        if (!map) {
+            return std::nullopt;
+        }
+
+        latency_export_config config;
+        try {
+            for (auto &[key, values] : *map) {
+                if (key == "file") {
+                    config.file = values.front();
+                } else if (key == "format") {
+                    config.json = values.front() == "json";
+                } else if (key == "interval") {
+                    config.interval = std::chrono::seconds(
+                        std::max(1ul, std::stoul(values.front())));
+                } else if (key == "signal") {
+                    config.signal = std::stoi(values.front());
+                } else if (key == "toggle") {
+                    config.toggle = std::stoi(values.front());
+                } else {
+                    logger::warning("Unknown UR_LATENCY_EXPORT option {}", key);
+                }
+            }
+        } catch (const std::exception &) {
+            logger::error("Invalid UR_LATENCY_EXPORT value");
+            return std::nullopt;
+        }
+        return config;
+    }
+};
+
 class latency_printer {
   public:
-    latency_printer() : logger(logger::create_logger("latency", true, false)) {}
+    inline latency_printer()
+        : logger(logger::create_logger("latency", true, false)) {
+        if (auto config = latency_export_config::get()) {
+            exportConfig = std::move(*config);
+            startExporter();
+        }
+    }
 
     inline void publishLatency(const std::string &name,
                                histogram_ptr histogram) {
+        std::lock_guard<std::mutex> lock(mutex);
         auto [it, inserted] = values.try_emplace(name, std::move(histogram));
         if (!inserted) {
             // combine histograms
@@ -83,17 +182,34 @@ class latency_printer {
         }
     }
 
+    inline void registerHistogram(latency_histogram *histogram) {
+        std::lock_guard<std::mutex> lock(mutex);
+        live.insert(histogram);
+    }
+
+    inline void unregisterHistogram(latency_histogram *histogram) {
+        std::lock_guard<std::mutex> lock(mutex);
+        live.erase(histogram);
+    }
+
     inline ~latency_printer() {
-        if (trackLatency) {
+        stopExporter();
+        if (hasValues()) {
             print();
+            if (!exportConfig.file.empty()) {
+                exportSnapshot();
+            }
         }
     }
 
+    /// Merges the histograms of all threads, including those of threads that
+    /// are still running, without resetting them.
+    inline std::map<std::string, latencyValues> snapshot();
+
     inline void print() {
         printHeader();
 
-        for (auto &[name, histogram] : values) {
-            auto value = getValues(histogram.get());
+        for (auto &[name, value] : snapshot()) {
             auto f = groupDigits<int64_t>;
             logger.log(
                 logger::Level::INFO,
@@ -107,7 +223,31 @@ class latency_printer {
         }
     }
 
+    /// Writes a snapshot to the UR_LATENCY_EXPORT file, replacing the
+    /// previous one.
+    inline void exportSnapshot() {
+        auto tmp = exportConfig.file + ".tmp";
+        std::ofstream out(tmp, std::ios::trunc);
+        if (!out) {
+            logger.error("Failed to open latency export file {}", tmp);
+            return;
+        }
+        auto snap = snapshot();
+        if (exportConfig.json) {
+            writeJson(out, snap);
+        } else {
+            writePrometheus(out, snap);
+        }
+        out.close();
+        std::rename(tmp.c_str(), exportConfig.file.c_str());
+    }
+
   private:
+    inline bool hasValues() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return !values.empty() || !live.empty();
+    }
+
     inline void printHeader() {
         logger.log(logger::Level::INFO, "Latency histogram:");
         logger.log(logger::Level::INFO,
@@ -118,8 +258,113 @@ class latency_printer {
                    percentiles[6]);
     }
 
+    static inline void
+    writePrometheus(std::ostream &out,
+                    const std::map<std::string, latencyValues> &snap) {
+        out << "# HELP ur_latency_ns Latency of Unified Runtime scopes\n";
+        out << "# TYPE ur_latency_ns summary\n";
+        for (auto &[name, value] : snap) {
+            for (size_t i = 0; i < numPercentiles; ++i) {
+                out << "ur_latency_ns{scope=\"" << name << "\",quantile=\""
+                    << percentiles[i] / 100.0 << "\"} "
+                    << value.percentileValues[i] << "\n";
+            }
+            out << "ur_latency_ns_sum{scope=\"" << name << "\"} "
+                << value.count * value.mean << "\n";
+            out << "ur_latency_ns_count{scope=\"" << name << "\"} "
+                << value.count << "\n";
+        }
+    }
+
+    static inline void
+    writeJson(std::ostream &out,
+              const std::map<std::string, latencyValues> &snap) {
+        out << "{";
+        const char *sep = "\n";
+        for (auto &[name, value] : snap) {
+            out << sep << "  \"" << name << "\": {\"count\": " << value.count
+                << ", \"mean\": " << value.mean << ", \"min\": " << value.min
+                << ", \"max\": " << value.max
+                << ", \"stddev\": " << value.stddev;
+            for (size_t i = 0; i < numPercentiles; ++i) {
+                out << ", \"p" << percentiles[i]
+                    << "\": " << value.percentileValues[i];
+            }
+            out << "}";
+            sep = ",\n";
+        }
+        out << "\n}\n";
+    }
+
+    static inline std::atomic<bool> &signalled() {
+        static std::atomic<bool> flag{false};
+        return flag;
+    }
+
+    inline void startExporter() {
+#if !defined(_WIN32)
+        if (exportConfig.signal) {
+            // Only sets a flag, the exporter thread does the work.
+            ::signal(exportConfig.signal,
+                     [](int) { signalled().store(true); });
+        }
+        if (exportConfig.toggle) {
+            ::signal(exportConfig.toggle, [](int) {
+                setLatencyTracking(!isLatencyTracked());
+            });
+        }
+#endif
+        if (exportConfig.file.empty() && !exportConfig.signal) {
+            return;
+        }
+        exporter = std::thread([this] {
+            auto nextExport =
+                std::chrono::steady_clock::now() + exportConfig.interval;
+            std::unique_lock<std::mutex> lock(exporterMutex);
+            while (!stopping) {
+                exporterCv.wait_for(lock, std::chrono::milliseconds(100),
+                                    [this] { return stopping; });
+                if (stopping) {
+                    break;
+                }
+                lock.unlock();
+                bool onSignal = signalled().exchange(false);
+                if (onSignal) {
+                    print();
+                }
+                if (!exportConfig.file.empty() &&
+                    (onSignal ||
+                     std::chrono::steady_clock::now() >= nextExport)) {
+                    exportSnapshot();
+                    nextExport = std::chrono::steady_clock::now() +
+                                 exportConfig.interval;
+                }
+                lock.lock();
+            }
+        });
+    }
+
+    inline void stopExporter() {
+        {
+            std::lock_guard<std::mutex> lock(exporterMutex);
+            stopping = true;
+        }
+        exporterCv.notify_one();
+        if (exporter.joinable()) {
+            exporter.join();
+        }
+    }
+
+    std::mutex mutex;
     std::map<std::string, histogram_ptr> values;
+    std::set<latency_histogram *> live;
     logger::Logger logger;
+
+    latency_export_config exportConfig;
+    std::mutex exporterMutex;
+    std::condition_variable exporterCv;
+    bool stopping = false;
+    std::thread exporter;
 };
 
 inline latency_printer &globalLatencyPrinter() {
@@ -134,27 +379,19 @@ class latency_histogram {
                              int64_t lowestDiscernibleValue = 1,
                              int64_t highestTrackableValue = 100'000'000'000,
                              int significantFigures = 3)
-        : name(name), histogram(nullptr, nullptr), printer(printer) {
-        if (trackLatency) {
-            struct hdr_histogram *cHistogram;
-            auto ret = hdr_init(lowestDiscernibleValue, highestTrackableValue,
-                                significantFigures, &cHistogram);
-            if (ret != 0) {
-                logger::error("Failed to initialize latency histogram");
-            }
-            histogram =
-                std::unique_ptr<struct hdr_histogram, decltype(&hdr_close)>(
-                    cHistogram, &hdr_close);
-        }
-    }
+        : name(name), histogram(nullptr, nullptr), printer(printer),
+          lowestDiscernibleValue(lowestDiscernibleValue),
+          highestTrackableValue(highestTrackableValue),
+          significantFigures(significantFigures) {}
 
     latency_histogram(const latency_histogram &) = delete;
     latency_histogram(latency_histogram &&) = delete;
 
     inline ~latency_histogram() {
-        if (!trackLatency || !histogram) {
+        if (!histogram) {
             return;
         }
+        printer.unregisterHistogram(this);
 
         if (hdr_min(histogram.get()) == std::numeric_limits<int64_t>::max()) {
             logger::info("[{}] latency: no data", name);
@@ -165,20 +402,72 @@ class latency_histogram {
     }
 
     inline void trackValue(int64_t value) {
+        // Created with the first value, so that the histograms of scopes
+        // which ran while the tracking was disabled cost nothing. Only the
+        // thread of the histogram gets here, and snapshots only see it once
+        // it's registered.
+        if (!histogram) {
+            histogram = makeHistogram(lowestDiscernibleValue,
+                                      highestTrackableValue,
+                                      significantFigures);
+            printer.registerHistogram(this);
+        }
+        // Only contended while a snapshot is being taken.
+        std::lock_guard<std::mutex> lock(mutex);
         hdr_record_value(histogram.get(), value);
     }
 
+    /// Adds the values recorded so far to into.
+    inline void mergeInto(struct hdr_histogram *into) {
+        std::lock_guard<std::mutex> lock(mutex);
+        hdr_add(into, histogram.get());
+    }
+
+    const char *getName() const { return name; }
+
   private:
     const char *name;
     histogram_ptr histogram;
     latency_printer &printer;
+    std::mutex mutex;
+    const int64_t lowestDiscernibleValue;
+    const int64_t highestTrackableValue;
+    const int significantFigures;
 };
 
+inline std::map<std::string, latencyValues> latency_printer::snapshot() {
+    std::map<std::string, histogram_ptr> merged;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto &[name, histogram] : values) {
+            auto copy = makeHistogram();
+            hdr_add(copy.get(), histogram.get());
+            merged.emplace(name, std::move(copy));
+        }
+        for (auto *histogram : live) {
+            auto [it, inserted] =
+                merged.try_emplace(histogram->getName(), nullptr, nullptr);
+            if (inserted) {
+                it->second = makeHistogram();
+            }
+            histogram->mergeInto(it->second.get());
+        }
+    }
+
+    std::map<std::string, latencyValues> snap;
+    for (auto &[name, histogram] : merged) {
+        if (histogram->total_count) {
+            snap.emplace(name, getValues(histogram.get()));
+        }
+    }
+    return snap;
+}
+
 class latency_tracker {
   public:
     inline explicit latency_tracker(latency_histogram &stats)
-        : stats(trackLatency ? &stats : nullptr), begin() {
-        if (trackLatency) {
+        : stats(isLatencyTracked() ? &stats : nullptr), begin() {
+        if (this->stats) {
             begin = std::chrono::steady_clock::now();
         }
     }
@@ -219,14 +508,27 @@ class latency_tracker {
 
 // Each tracker has it's own thread-local histogram.
 // At program exit, all histograms for the same scope are
-// aggregated.
+// aggregated. globalLatencyPrinter().snapshot() aggregates them on demand.
 #define TRACK_SCOPE_LATENCY_CNT(name, cnt)                                     \
     static thread_local latency_histogram CONCAT(histogram, cnt)(name);        \
     latency_tracker CONCAT(tracker, cnt)(CONCAT(histogram, cnt));
 #define TRACK_SCOPE_LATENCY(name) TRACK_SCOPE_LATENCY_CNT(name, __COUNTER__)
 
+// Records value, e.g. a size chosen by a heuristic, in the histogram of name,
+// reported along with the latencies.
+#define TRACK_VALUE_CNT(name, value, cnt)                                      \
+    static thread_local latency_histogram CONCAT(histogram, cnt)(name);        \
+    if (isLatencyTracked()) {                                                  \
+        CONCAT(histogram, cnt).trackValue(static_cast<int64_t>(value));        \
+    }
+#define TRACK_VALUE(name, value) TRACK_VALUE_CNT(name, value, __COUNTER__)
+
 #else // UR_ENABLE_LATENCY_HISTOGRAM
 
 #define TRACK_SCOPE_LATENCY(name)
+#define TRACK_VALUE(name, value)
+
+inline bool isLatencyTracked() { return false; }
+inline void setLatencyTracking(bool) {}
 
 #endif // UR_ENABLE_LATENCY_HISTOGRAM
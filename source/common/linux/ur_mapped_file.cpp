@@ -0,0 +1,49 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ur_mapped_file.hpp"
+
+namespace ur {
+
+bool mapped_file_t::map(const filesystem::path &Path) {
+    reset();
+    int Fd = open(Path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (Fd < 0) {
+        return false;
+    }
+    struct stat Stat;
+    void *Ptr = MAP_FAILED;
+    if (fstat(Fd, &Stat) == 0 && Stat.st_size > 0) {
+        Ptr = mmap(nullptr, static_cast<size_t>(Stat.st_size), PROT_READ,
+                   MAP_PRIVATE, Fd, 0);
+    }
+    // The mapping keeps the file open
+    close(Fd);
+    if (Ptr == MAP_FAILED) {
+        return false;
+    }
+    Data = static_cast<const uint8_t *>(Ptr);
+    Size = static_cast<size_t>(Stat.st_size);
+    return true;
+}
+
+void mapped_file_t::reset() {
+    if (Data) {
+        munmap(const_cast<uint8_t *>(Data), Size);
+        Data = nullptr;
+        Size = 0;
+    }
+}
+
+} // namespace ur
@@ -0,0 +1,185 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_FLIGHT_RECORDER_HPP
+#define UR_FLIGHT_RECORDER_HPP 1
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "ur_filesystem_resolved.hpp"
+
+/// Layout of the ring file written by logger::FlightRecorderSink.
+///
+/// The file starts with a file_header_t followed by `capacity` fixed size
+/// record_t slots. Record number N is stored in slot N % capacity, and its
+/// sequence is set to N + 1 only after the rest of the record was written, so
+/// a record interrupted by a crash is recognized and skipped when decoding.
+namespace logger::flight {
+
+constexpr char file_magic[8] = {'U', 'R', 'F', 'L', 'I', 'G', 'H', 'T'};
+constexpr uint32_t file_version = 1;
+constexpr size_t default_capacity = 16384;
+constexpr size_t text_size = 232;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "records are shared with the file through a memory mapping");
+
+struct file_header_t {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint64_t capacity;
+    /// Number of records claimed by writers so far
+    std::atomic<uint64_t> next;
+};
+
+struct record_t {
+    std::atomic<uint64_t> sequence;
+    /// Nanoseconds since the epoch of the system clock
+    uint64_t timestamp;
+    uint32_t thread;
+    uint8_t level;
+    uint8_t truncated;
+    uint16_t length;
+    char text[text_size];
+};
+
+static_assert(sizeof(record_t) == 256);
+
+/// @brief Maps a file of a given size into memory for reading and writing
+class mapped_file_t {
+  public:
+    mapped_file_t(const filesystem::path &path, size_t size) : size(size) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                                  FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file != INVALID_HANDLE_VALUE) {
+            HANDLE mapping = CreateFileMappingW(
+                file, nullptr, PAGE_READWRITE,
+                static_cast<DWORD>(static_cast<uint64_t>(size) >> 32),
+                static_cast<DWORD>(size), nullptr);
+            if (mapping) {
+                data = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size);
+                CloseHandle(mapping);
+            }
+            CloseHandle(file);
+        }
+#else
+        int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd != -1) {
+            if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+                void *mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                                    MAP_SHARED, fd, 0);
+                data = mapped == MAP_FAILED ? nullptr : mapped;
+            }
+            close(fd);
+        }
+#endif
+        if (!data) {
+            throw std::invalid_argument(
+                "Failure while mapping flight recorder file " + path.string() +
+                ". Check if given path exists.");
+        }
+    }
+
+    ~mapped_file_t() {
+#if defined(_WIN32)
+        UnmapViewOfFile(data);
+#else
+        munmap(data, size);
+#endif
+    }
+
+    mapped_file_t(const mapped_file_t &) = delete;
+    mapped_file_t &operator=(const mapped_file_t &) = delete;
+
+    void *get() const { return data; }
+
+    /// Starts writing the modified pages back to the file without waiting
+    void flush() {
+#if defined(_WIN32)
+        FlushViewOfFile(data, 0);
+#else
+        msync(data, size, MS_ASYNC);
+#endif
+    }
+
+  private:
+    void *data = nullptr;
+    size_t size;
+};
+
+struct decoded_record_t {
+    uint64_t sequence;
+    uint64_t timestamp;
+    uint32_t thread;
+    uint8_t level;
+    bool truncated;
+    std::string text;
+};
+
+/// @brief Reads the complete records of a ring file, oldest first
+inline std::vector<decoded_record_t> read_file(const filesystem::path &path) {
+    FILE *file = fopen(path.string().c_str(), "rb");
+    if (!file) {
+        throw std::invalid_argument("unable to open " + path.string());
+    }
+
+    file_header_t header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.magic, file_magic, sizeof(file_magic)) ||
+        header.version != file_version ||
+        header.record_size != sizeof(record_t)) {
+        fclose(file);
+        throw std::invalid_argument(path.string() +
+                                    " is not a supported flight recorder file");
+    }
+
+    std::vector<record_t> slots(header.capacity);
+    size_t read = fread(slots.data(), sizeof(record_t), slots.size(), file);
+    fclose(file);
+
+    std::vector<decoded_record_t> records;
+    for (size_t i = 0; i < read; ++i) {
+        const auto &slot = slots[i];
+        uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+        // Skip empty slots and the ones a writer was still filling in
+        if (sequence == 0 || (sequence - 1) % header.capacity != i ||
+            slot.length > text_size) {
+            continue;
+        }
+        records.push_back({sequence, slot.timestamp, slot.thread, slot.level,
+                           slot.truncated != 0,
+                           std::string(slot.text, slot.length)});
+    }
+    std::sort(records.begin(), records.end(),
+              [](const auto &a, const auto &b) {
+                  return a.sequence < b.sequence;
+              });
+    return records;
+}
+
+} // namespace logger::flight
+
+#endif /* UR_FLIGHT_RECORDER_HPP */
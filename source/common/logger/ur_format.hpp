@@ -0,0 +1,141 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_FORMAT_HPP
+#define UR_FORMAT_HPP 1
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace logger {
+
+namespace details {
+
+template <typename T> struct type_identity {
+    using type = T;
+};
+
+template <typename T, typename = void> struct is_streamable : std::false_type {};
+
+template <typename T>
+struct is_streamable<T, std::void_t<decltype(std::declval<std::ostream &>()
+                                             << std::declval<T &>())>>
+    : std::true_type {};
+
+/// Returns the number of "{}" placeholders in fmt, or -1 if fmt contains a
+/// brace which is neither a placeholder nor escaped.
+constexpr int count_placeholders(const char *fmt) {
+    int count = 0;
+    while (*fmt != '\0') {
+        if (fmt[0] == '{' && fmt[1] == '}') {
+            count++;
+        } else if ((fmt[0] == '{' || fmt[0] == '}') && fmt[1] != fmt[0]) {
+            return -1;
+        } else if (fmt[0] != '{' && fmt[0] != '}') {
+            fmt++;
+            continue;
+        }
+        fmt += 2;
+    }
+    return count;
+}
+
+// Not constexpr, so calling it while evaluating a format string at compile
+// time fails the compilation
+inline void invalid_format_string() {}
+
+// Only used unevaluated, by UR_LOG_CHECK_FORMAT, to count the arguments of a
+// logging call without evaluating them
+template <typename... Args>
+std::integral_constant<std::size_t, sizeof...(Args)>
+count_args(const Args &...);
+
+/// Arguments which can be formatted after the logging call returned: they
+/// don't refer to memory owned by the caller once they are captured.
+template <typename T>
+constexpr bool is_deferrable_v =
+    std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+    std::is_same_v<T, std::string> || std::is_same_v<T, const char *> ||
+    std::is_same_v<T, char *> || std::is_same_v<T, const void *> ||
+    std::is_same_v<T, void *>;
+
+template <typename T> auto capture(T &&value) {
+    using value_t = std::decay_t<T>;
+    if constexpr (std::is_array_v<std::remove_reference_t<T>>) {
+        return std::string(value);
+    } else if constexpr (std::is_same_v<value_t, const char *> ||
+                         std::is_same_v<value_t, char *>) {
+        return std::string(value ? value : "(null)");
+    } else {
+        return value_t(std::forward<T>(value));
+    }
+}
+
+} // namespace details
+
+struct runtime_format_t {
+    const char *str;
+};
+
+/// @brief Marks a format string which is only known at runtime, e.g. one that
+///        was passed through a LegacyMessage.
+constexpr runtime_format_t runtime(const char *fmt) { return {fmt}; }
+
+/// @brief Format string of a log message with arguments of type Args.
+///
+/// Every argument type is checked at compile time that it can be written to a
+/// std::ostream. When building as C++20 the placeholders of the format string
+/// are also counted at compile time and have to match the arguments. As C++17,
+/// the count is only checked by Sink::format when the message is logged,
+/// unless the call goes through UR_LOG, see UR_LOG_CHECK_FORMAT.
+template <typename... Args> class basic_format_string {
+    static_assert((details::is_streamable<Args>::value && ...),
+                  "log message argument can't be written to std::ostream");
+
+  public:
+#if defined(__cpp_consteval)
+    template <typename S,
+              typename = std::enable_if_t<
+                  std::is_convertible_v<const S &, const char *>>>
+    consteval basic_format_string(const S &fmt) : str(fmt) {
+        if (details::count_placeholders(str) != sizeof...(Args)) {
+            details::invalid_format_string();
+        }
+    }
+#else
+    constexpr basic_format_string(const char *fmt) : str(fmt) {}
+#endif
+    constexpr basic_format_string(runtime_format_t fmt) : str(fmt.str) {}
+
+    constexpr const char *get() const { return str; }
+
+  private:
+    const char *str;
+};
+
+template <typename... Args>
+using format_string = basic_format_string<
+    typename details::type_identity<std::decay_t<Args>>::type...>;
+
+} // namespace logger
+
+#define UR_LOG_EXPAND_(x) x
+#define UR_LOG_FORMAT_(fmt, ...) fmt
+
+/// @brief Fails the compilation when the placeholders of the literal format
+///        string don't match its arguments, given as (fmt, args...). Unlike
+///        basic_format_string, it also works when building as C++17.
+#define UR_LOG_CHECK_FORMAT(...)                                               \
+    static_assert(::logger::details::count_placeholders(                       \
+                      UR_LOG_EXPAND_(UR_LOG_FORMAT_(__VA_ARGS__, 0))) ==       \
+                      int(decltype(::logger::details::count_args(              \
+                          __VA_ARGS__))::value) -                              \
+                          1,                                                   \
+                  "log format string doesn't match its arguments")
+
+#endif /* UR_FORMAT_HPP */
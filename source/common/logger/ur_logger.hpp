@@ -29,53 +29,62 @@ get_logger(std::string name = "common",
 
 inline void init(const std::string &name) { get_logger(name.c_str()); }
 
+/// @brief Logs (fmt, args...) at the logger::Level level to the logger of
+///        get_logger(), e.g. UR_LOG(DEBUG, "{} of {}", done, total). Unlike
+///        logger::debug() and the like, the placeholders of the literal fmt
+///        are counted at compile time also when building as C++17.
+#define UR_LOG(level, ...)                                                     \
+    UR_LOG_L(::logger::get_logger(), level, __VA_ARGS__)
+
 template <typename... Args>
-inline void debug(const char *format, Args &&...args) {
+inline void debug(format_string<Args...> format, Args &&...args) {
     get_logger().log(logger::Level::DEBUG, format, std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void info(const char *format, Args &&...args) {
+inline void info(format_string<Args...> format, Args &&...args) {
     get_logger().log(logger::Level::INFO, format, std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void warning(const char *format, Args &&...args) {
+inline void warning(format_string<Args...> format, Args &&...args) {
     get_logger().log(logger::Level::WARN, format, std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void error(const char *format, Args &&...args) {
+inline void error(format_string<Args...> format, Args &&...args) {
     get_logger().log(logger::Level::ERR, format, std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void always(const char *format, Args &&...args) {
+inline void always(format_string<Args...> format, Args &&...args) {
     get_logger().always(format, std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void debug(const logger::LegacyMessage &p, const char *format,
-                  Args &&...args) {
+inline void debug(const logger::LegacyMessage &p,
+                  format_string<Args...> format, Args &&...args) {
     get_logger().log(p, logger::Level::DEBUG, format,
                      std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void info(logger::LegacyMessage p, const char *format, Args &&...args) {
+inline void info(logger::LegacyMessage p, format_string<Args...> format,
+                 Args &&...args) {
     get_logger().log(p, logger::Level::INFO, format,
                      std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void warning(logger::LegacyMessage p, const char *format,
+inline void warning(logger::LegacyMessage p, format_string<Args...> format,
                     Args &&...args) {
     get_logger().log(p, logger::Level::WARN, format,
                      std::forward<Args>(args)...);
 }
 
 template <typename... Args>
-inline void error(logger::LegacyMessage p, const char *format, Args &&...args) {
+inline void error(logger::LegacyMessage p, format_string<Args...> format,
+                  Args &&...args) {
     get_logger().log(p, logger::Level::ERR, format,
                      std::forward<Args>(args)...);
 }
@@ -102,6 +111,12 @@ template <typename T> inline std::string toHex(T t) {
 ///        level set to `info`, flush level set to `warning`, and output set to
 ///        the `out.log` file:
 ///             UR_LOG_LOADER="level:info;flush:warning;output:file,out.log"
+///        Adding `async:<drop|block|sample>[,<queue size>]` makes the output
+///        be written by a background thread. `output:flight,<path>[,<records>]`
+///        keeps the last messages in a memory mapped ring file instead.
+///        `limit:<messages>[,<milliseconds>]` logs at most that many messages
+///        of each call site per interval, by default per second, and counts
+///        the others.
 /// @param logger_name name that should be appended to the `UR_LOG_` prefix to
 ///        get the proper environment variable, ie. "loader"
 /// @param default_log_level provides the default logging configuration when the environment
@@ -124,6 +139,7 @@ inline Logger create_logger(std::string logger_name, bool skip_prefix,
     auto level = default_log_level;
     auto flush_level = default_flush_level;
     std::unique_ptr<logger::Sink> sink;
+    std::unique_ptr<logger::RateLimiter> rate_limiter;
 
     env_var_name << "UR_LOG_" << logger_name;
     try {
@@ -156,6 +172,19 @@ inline Logger create_logger(std::string logger_name, bool skip_prefix,
             map->erase(kv);
         }
 
+        kv = map->find("limit");
+        if (kv != map->end()) {
+            rate_limiter = rate_limiter_from_values(kv->second);
+            map->erase(kv);
+        }
+
+        std::vector<std::string> async_values;
+        kv = map->find("async");
+        if (kv != map->end()) {
+            async_values = kv->second;
+            map->erase(kv);
+        }
+
         if (!map->empty()) {
             std::cerr << "Wrong logger environment variable parameter: '"
                       << map->begin()->first
@@ -166,11 +195,13 @@ inline Logger create_logger(std::string logger_name, bool skip_prefix,
                     std::move(logger_name), skip_prefix, skip_linebreak));
         }
 
-        sink = values.size() == 2
-                   ? sink_from_str(logger_name, values[0], values[1],
-                                   skip_prefix, skip_linebreak)
-                   : sink_from_str(logger_name, values[0], "", skip_prefix,
-                                   skip_linebreak);
+        sink = sink_from_values(logger_name, values, skip_prefix,
+                                skip_linebreak);
+        if (!async_values.empty()) {
+            sink = async_sink_from_str(logger_name, std::move(sink),
+                                       async_values, skip_prefix,
+                                       skip_linebreak);
+        }
     } catch (const std::invalid_argument &e) {
         std::cerr << "Error when creating a logger instance from the '"
                   << env_var_name.str() << "' environment variable:\n"
@@ -181,7 +212,7 @@ inline Logger create_logger(std::string logger_name, bool skip_prefix,
     }
     sink->setFlushLevel(flush_level);
 
-    return Logger(level, std::move(sink));
+    return Logger(level, std::move(sink), std::move(rate_limiter));
 }
 
 } // namespace logger
@@ -7,6 +7,7 @@
 #define UR_LOGGER_DETAILS_HPP 1
 
 #include "ur_level.hpp"
+#include "ur_rate_limit.hpp"
 #include "ur_sinks.hpp"
 
 namespace logger {
@@ -22,11 +23,13 @@ class Logger {
         this->level = logger::Level::QUIET;
     }
 
-    Logger(logger::Level level, std::unique_ptr<logger::Sink> sink)
-        : level(level), sink(std::move(sink)) {}
+    Logger(logger::Level level, std::unique_ptr<logger::Sink> sink,
+           std::unique_ptr<logger::RateLimiter> rateLimiter = nullptr)
+        : level(level), sink(std::move(sink)),
+          rateLimiter(std::move(rateLimiter)) {}
 
     Logger &operator=(Logger &&) = default;
-    ~Logger() = default;
+    ~Logger() { flushSuppressed(); }
 
     void setLevel(logger::Level level) { this->level = level; }
 
@@ -38,29 +41,40 @@ class Logger {
         }
     }
 
-    template <typename... Args> void debug(const char *format, Args &&...args) {
+    /// Logs at most `messages` messages of each call site per interval, see
+    /// logger::RateLimiter
+    void setRateLimit(uint32_t messages, std::chrono::milliseconds interval) {
+        flushSuppressed();
+        rateLimiter = std::make_unique<logger::RateLimiter>(messages, interval);
+    }
+
+    template <typename... Args>
+    void debug(format_string<Args...> format, Args &&...args) {
         log(logger::Level::DEBUG, format, std::forward<Args>(args)...);
     }
 
-    template <typename... Args> void info(const char *format, Args &&...args) {
+    template <typename... Args>
+    void info(format_string<Args...> format, Args &&...args) {
         log(logger::Level::INFO, format, std::forward<Args>(args)...);
     }
 
     template <typename... Args>
-    void warning(const char *format, Args &&...args) {
+    void warning(format_string<Args...> format, Args &&...args) {
         log(logger::Level::WARN, format, std::forward<Args>(args)...);
     }
 
-    template <typename... Args> void warn(const char *format, Args &&...args) {
+    template <typename... Args>
+    void warn(format_string<Args...> format, Args &&...args) {
         warning(format, std::forward<Args>(args)...);
     }
 
-    template <typename... Args> void error(const char *format, Args &&...args) {
+    template <typename... Args>
+    void error(format_string<Args...> format, Args &&...args) {
         log(logger::Level::ERR, format, std::forward<Args>(args)...);
     }
 
     template <typename... Args>
-    void always(const char *format, Args &&...args) {
+    void always(format_string<Args...> format, Args &&...args) {
         if (sink) {
             sink->log(logger::Level::QUIET, format,
                       std::forward<Args>(args)...);
@@ -68,50 +82,64 @@ class Logger {
     }
 
     template <typename... Args>
-    void debug(const logger::LegacyMessage &p, const char *format,
+    void debug(const logger::LegacyMessage &p, format_string<Args...> format,
                Args &&...args) {
         log(p, logger::Level::DEBUG, format, std::forward<Args>(args)...);
     }
 
     template <typename... Args>
-    void info(const logger::LegacyMessage &p, const char *format,
+    void info(const logger::LegacyMessage &p, format_string<Args...> format,
               Args &&...args) {
         log(p, logger::Level::INFO, format, std::forward<Args>(args)...);
     }
 
     template <typename... Args>
-    void warning(const logger::LegacyMessage &p, const char *format,
+    void warning(const logger::LegacyMessage &p, format_string<Args...> format,
                  Args &&...args) {
         log(p, logger::Level::WARN, format, std::forward<Args>(args)...);
     }
 
     template <typename... Args>
-    void error(const logger::LegacyMessage &p, const char *format,
+    void error(const logger::LegacyMessage &p, format_string<Args...> format,
                Args &&...args) {
         log(p, logger::Level::ERR, format, std::forward<Args>(args)...);
     }
 
     template <typename... Args>
-    void log(logger::Level level, const char *format, Args &&...args) {
-        log(logger::LegacyMessage(format), level, format,
+    void log(logger::Level level, format_string<Args...> format,
+             Args &&...args) {
+        log(logger::LegacyMessage(format.get()), level, format,
             std::forward<Args>(args)...);
     }
 
     template <typename... Args>
     void log(const logger::LegacyMessage &p, logger::Level level,
-             const char *format, Args &&...args) {
+             format_string<Args...> format, Args &&...args) {
         if (!sink) {
             return;
         }
 
         if (isLegacySink) {
-            sink->log(level, p.message, std::forward<Args>(args)...);
+            sink->log(level, logger::runtime(p.message),
+                      std::forward<Args>(args)...);
             return;
         }
         if (level < this->level) {
             return;
         }
 
+        if (rateLimiter) {
+            uint64_t suppressed = 0;
+            bool allowed = rateLimiter->allow(format.get(), suppressed);
+            if (suppressed) {
+                sink->log(level, "{} messages like \"{}\" were suppressed",
+                          suppressed, format.get());
+            }
+            if (!allowed) {
+                return;
+            }
+        }
+
         sink->log(level, format, std::forward<Args>(args)...);
     }
 
@@ -121,11 +149,32 @@ class Logger {
     }
 
   private:
+    void flushSuppressed() {
+        if (!rateLimiter || !sink) {
+            return;
+        }
+        rateLimiter->flush([&](const char *format, uint64_t suppressed) {
+            sink->log(logger::Level::WARN,
+                      "{} messages like \"{}\" were suppressed", suppressed,
+                      format);
+        });
+    }
+
     logger::Level level;
     std::unique_ptr<logger::Sink> sink;
+    std::unique_ptr<logger::RateLimiter> rateLimiter;
     bool isLegacySink = false;
 };
 
 } // namespace logger
 
+/// @brief Logs (fmt, args...) at the logger::Level level to the Logger lg,
+///        e.g. UR_LOG_L(lg, WARN, "{} retries", n), the placeholders of the
+///        literal fmt being counted at compile time.
+#define UR_LOG_L(lg, level, ...)                                               \
+    do {                                                                       \
+        UR_LOG_CHECK_FORMAT(__VA_ARGS__);                                      \
+        (lg).log(::logger::Level::level, __VA_ARGS__);                         \
+    } while (0)
+
 #endif /* UR_LOGGER_DETAILS_HPP */
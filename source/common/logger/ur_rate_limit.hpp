@@ -0,0 +1,134 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_RATE_LIMIT_HPP
+#define UR_RATE_LIMIT_HPP 1
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace logger {
+
+/// @brief Limits the messages of each call site of a logger to a number per
+/// interval, e.g. those of an error path which an application hits in a loop.
+///
+/// The call sites are told apart by the address of their format string, in a
+/// fixed-size open-addressed table, and the sites past its size aren't
+/// limited. In each interval the first `messages` messages of a site are
+/// logged and the rest are only counted, so a suppressed message costs a
+/// single atomic increment. The first message of a site in a new interval
+/// reports how many were suppressed in the previous one.
+class RateLimiter {
+  public:
+    using clock = std::chrono::steady_clock;
+    static constexpr size_t num_sites = 256;
+
+    RateLimiter(uint32_t messages, std::chrono::milliseconds interval)
+        : messages(messages), interval(interval), start(clock::now()) {}
+
+    /// Returns whether the message of the site should be logged, and sets
+    /// suppressed to the number of messages of the site which weren't since
+    /// the last one which was
+    bool allow(const char *format, uint64_t &suppressed) {
+        suppressed = 0;
+        auto *site = find(format);
+        if (site == nullptr) {
+            return true;
+        }
+
+        uint32_t window = static_cast<uint32_t>((clock::now() - start) /
+                                                interval) +
+                          1;
+        if (site->window.load(std::memory_order_relaxed) != window &&
+            site->window.exchange(window, std::memory_order_relaxed) !=
+                window) {
+            uint32_t count = site->count.exchange(0, std::memory_order_relaxed);
+            suppressed = count > messages ? count - messages : 0;
+        }
+        return site->count.fetch_add(1, std::memory_order_relaxed) < messages;
+    }
+
+    /// Calls report(format, suppressed) for each site with messages
+    /// suppressed in its last interval, e.g. when the logger is destroyed
+    template <typename Report> void flush(Report report) {
+        for (auto &site : sites) {
+            const char *format = site.format.load(std::memory_order_acquire);
+            if (format == nullptr) {
+                continue;
+            }
+            uint32_t count = site.count.exchange(0, std::memory_order_relaxed);
+            if (count > messages) {
+                report(format, uint64_t(count - messages));
+            }
+        }
+    }
+
+  private:
+    struct site_t {
+        std::atomic<const char *> format{nullptr};
+        // The interval of the messages counted, 0 before the first one
+        std::atomic<uint32_t> window{0};
+        std::atomic<uint32_t> count{0};
+    };
+
+    site_t *find(const char *format) {
+        size_t slot = (reinterpret_cast<uintptr_t>(format) >> 3) % num_sites;
+        for (size_t probe = 0; probe < num_sites; ++probe) {
+            auto &site = sites[(slot + probe) % num_sites];
+            const char *current = site.format.load(std::memory_order_acquire);
+            if (current == format) {
+                return &site;
+            }
+            if (current == nullptr) {
+                if (site.format.compare_exchange_strong(
+                        current, format, std::memory_order_acq_rel) ||
+                    current == format) {
+                    return &site;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    const uint32_t messages;
+    const std::chrono::milliseconds interval;
+    const clock::time_point start;
+    std::array<site_t, num_sites> sites;
+};
+
+/// @brief Creates the rate limiter of the `limit:<messages>[,<milliseconds>]`
+/// option of a logger, by default per second
+inline std::unique_ptr<RateLimiter>
+rate_limiter_from_values(const std::vector<std::string> &values) {
+    if (values.empty() || values.size() > 2) {
+        throw std::invalid_argument(
+            "Expected limit:<messages>[,<milliseconds>]");
+    }
+    try {
+        unsigned long messages = std::stoul(values[0]);
+        unsigned long ms = values.size() > 1 ? std::stoul(values[1]) : 1000;
+        if (ms == 0 || messages > UINT32_MAX) {
+            throw std::out_of_range("limit");
+        }
+        return std::make_unique<RateLimiter>(
+            static_cast<uint32_t>(messages), std::chrono::milliseconds(ms));
+    } catch (const std::logic_error &) {
+        std::string value = values[0];
+        if (values.size() > 1) {
+            value += "," + values[1];
+        }
+        throw std::invalid_argument("Invalid limit: '" + value + "'");
+    }
+}
+
+} // namespace logger
+
+#endif /* UR_RATE_LIMIT_HPP */
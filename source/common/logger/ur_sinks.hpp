@@ -6,15 +6,24 @@
 #ifndef UR_SINKS_HPP
 #define UR_SINKS_HPP 1
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include "ur_filesystem_resolved.hpp"
+#include "ur_flight_recorder.hpp"
 #include "ur_level.hpp"
 #include "ur_print.hpp"
 
+#include "ur_format.hpp"
+
 namespace logger {
 
 #if defined(_WIN32)
@@ -24,14 +33,28 @@ inline bool isTearDowned = false;
 class Sink {
   public:
     template <typename... Args>
-    void log(logger::Level level, const char *fmt, Args &&...args) {
-        std::ostringstream buffer;
-        if (!skip_prefix && level != logger::Level::QUIET) {
-            buffer << "<" << logger_name << ">"
-                   << "[" << level_to_str(level) << "]: ";
+    void log(logger::Level level, format_string<Args...> fmt,
+             Args &&...args) {
+        if constexpr ((details::is_deferrable_v<std::decay_t<Args>> && ...)) {
+            if (deferred_format && sizeof...(Args) > 0) {
+                // The format string and the arguments are copied, so the
+                // message can be formatted after this call returned
+                printDeferred(
+                    level,
+                    [this, level, fmt = std::string(fmt.get()),
+                     values = std::make_tuple(details::capture(
+                         std::forward<Args>(args))...)]() {
+                        return std::apply(
+                            [&](const auto &...values) {
+                                return render(level, fmt.c_str(), values...);
+                            },
+                            values);
+                    });
+                return;
+            }
         }
 
-        format(buffer, fmt, std::forward<Args &&>(args)...);
+        auto msg = render(level, fmt.get(), std::forward<Args>(args)...);
 // This is a temporary workaround on windows, where UR adapter is teardowned
 // before the UR loader, which will result in access violation when we use print
 // function as the overrided print function was already released with the UR
@@ -40,16 +63,18 @@ class Sink {
 // using thier own sink class that inherit from logger::Sink.
 #if defined(_WIN32)
         if (isTearDowned) {
-            std::cerr << buffer.str() << "\n";
+            std::cerr << msg << "\n";
         } else {
-            print(level, buffer.str());
+            print(level, msg);
         }
 #else
-        print(level, buffer.str());
+        print(level, msg);
 #endif
     }
 
-    void setFlushLevel(logger::Level level) { this->flush_level = level; }
+    virtual void setFlushLevel(logger::Level level) {
+        this->flush_level = level;
+    }
 
     virtual ~Sink() = default;
 
@@ -65,6 +90,10 @@ class Sink {
         flush_level = logger::Level::ERR;
     }
 
+    /// Set by sinks which consume messages later, so that messages with
+    /// deferrable arguments are formatted by printDeferred's consumer.
+    bool deferred_format = false;
+
     virtual void print(logger::Level level, const std::string &msg) {
         std::scoped_lock<std::mutex> lock(output_mutex);
         *ostream << msg;
@@ -73,13 +102,32 @@ class Sink {
         }
     }
 
+    virtual void printDeferred(logger::Level level,
+                               std::function<std::string()> render) {
+        print(level, render());
+    }
+
   private:
+    friend class AsyncSink;
+
     std::string logger_name;
     bool skip_prefix;
     bool skip_linebreak;
     std::mutex output_mutex;
     const char *error_prefix = "Log message syntax error: ";
 
+    template <typename... Args>
+    std::string render(logger::Level level, const char *fmt, Args &&...args) {
+        std::ostringstream buffer;
+        if (!skip_prefix && level != logger::Level::QUIET) {
+            buffer << "<" << logger_name << ">"
+                   << "[" << level_to_str(level) << "]: ";
+        }
+
+        format(buffer, fmt, std::forward<Args &&>(args)...);
+        return buffer.str();
+    }
+
     void format(std::ostringstream &buffer, const char *fmt) {
         while (*fmt != '\0') {
             while (*fmt != '{' && *fmt != '}' && *fmt != '\0') {
@@ -213,6 +261,214 @@ class FileSink : public Sink {
     std::ofstream ofstream;
 };
 
+/// @brief Keeps the last messages in a memory mapped ring file.
+///
+/// Writing a message claims the next slot of the ring and copies the message
+/// into it, without taking a lock. The pages of the file are shared with the
+/// operating system, so the ring survives a crash of the process and can be
+/// decoded with logger::flight::read_file. Messages longer than a slot are
+/// truncated.
+class FlightRecorderSink : public Sink {
+  public:
+    FlightRecorderSink(std::string logger_name, filesystem::path file_path,
+                       size_t capacity = flight::default_capacity,
+                       bool skip_prefix = false, bool skip_linebreak = false)
+        : Sink(std::move(logger_name), skip_prefix, skip_linebreak),
+          capacity(capacity ? capacity : 1),
+          file(file_path, sizeof(flight::file_header_t) +
+                              this->capacity * sizeof(flight::record_t)) {
+        header = static_cast<flight::file_header_t *>(file.get());
+        records = reinterpret_cast<flight::record_t *>(header + 1);
+        std::memcpy(header->magic, flight::file_magic,
+                    sizeof(header->magic));
+        header->version = flight::file_version;
+        header->record_size = sizeof(flight::record_t);
+        header->capacity = this->capacity;
+        header->next.store(0, std::memory_order_release);
+    }
+
+    ~FlightRecorderSink() { file.flush(); }
+
+  protected:
+    void print(logger::Level level, const std::string &msg) override {
+        uint64_t index = header->next.fetch_add(1, std::memory_order_relaxed);
+        auto &record = records[index % capacity];
+
+        // Mark the slot as incomplete while it is overwritten
+        record.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        size_t length = std::min(msg.size(), flight::text_size);
+        record.timestamp =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now().time_since_epoch())
+                .count();
+        record.thread = threadId();
+        record.level = static_cast<uint8_t>(level);
+        record.truncated = length < msg.size();
+        record.length = static_cast<uint16_t>(length);
+        std::memcpy(record.text, msg.data(), length);
+        record.sequence.store(index + 1, std::memory_order_release);
+
+        if (level >= flush_level) {
+            file.flush();
+        }
+    }
+
+  private:
+    static uint32_t threadId() {
+        thread_local uint32_t id = static_cast<uint32_t>(
+            std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        return id;
+    }
+
+    size_t capacity;
+    flight::mapped_file_t file;
+    flight::file_header_t *header;
+    flight::record_t *records;
+};
+
+enum class AsyncPolicy {
+    DROP,   ///< drop messages while the queue is full
+    BLOCK,  ///< wait until the writer thread makes room
+    SAMPLE, ///< wait for every sample_rate-th message, drop the others
+};
+
+/// @brief Writes the messages of another sink on a background thread.
+///
+/// Messages are pushed into a bounded queue. Messages whose arguments can be
+/// copied are formatted by the background thread, others are formatted on the
+/// calling thread. Messages at or above the flush level are never dropped, and the
+/// caller waits until they have been written, so the last error before a crash
+/// is not lost in the queue. The queue is drained when the sink is destroyed.
+class AsyncSink : public Sink {
+  public:
+    static constexpr size_t default_capacity = 8192;
+    static constexpr uint64_t sample_rate = 64;
+
+    AsyncSink(std::string logger_name, std::unique_ptr<Sink> sink,
+              AsyncPolicy policy, size_t capacity = default_capacity,
+              bool skip_prefix = false, bool skip_linebreak = false)
+        : Sink(logger_name, skip_prefix, skip_linebreak),
+          sink(std::move(sink)), policy(policy),
+          capacity(capacity ? capacity : 1) {
+        deferred_format = true;
+        writer = std::thread([this] { writeLoop(); });
+    }
+
+    ~AsyncSink() {
+        {
+            std::scoped_lock<std::mutex> lock(queue_mutex);
+            stopping = true;
+        }
+        not_empty.notify_one();
+        writer.join();
+    }
+
+    void setFlushLevel(logger::Level level) override {
+        Sink::setFlushLevel(level);
+        sink->setFlushLevel(level);
+    }
+
+  protected:
+    void print(logger::Level level, const std::string &msg) override {
+        push({level, msg, nullptr});
+    }
+
+    void printDeferred(logger::Level level,
+                       std::function<std::string()> render) override {
+        push({level, std::string(), std::move(render)});
+    }
+
+  private:
+    struct record_t {
+        logger::Level level;
+        std::string msg;
+        /// Formats msg when it was deferred
+        std::function<std::string()> render;
+    };
+
+    void push(record_t &&record) {
+        const auto level = record.level;
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        const bool must_write = level >= flush_level;
+        if (queue.size() >= capacity && !stopping) {
+            if (!must_write && (policy == AsyncPolicy::DROP ||
+                                (policy == AsyncPolicy::SAMPLE &&
+                                 ++overflowed % sample_rate != 0))) {
+                dropped++;
+                return;
+            }
+            not_full.wait(lock, [this] {
+                return queue.size() < capacity || stopping;
+            });
+        }
+
+        queue.push_back(std::move(record));
+        const uint64_t seq = ++pushed;
+        not_empty.notify_one();
+
+        if (must_write) {
+            written_cv.wait(lock, [this, seq] { return written >= seq; });
+        }
+    }
+
+    void writeLoop() {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        while (true) {
+            not_empty.wait(lock, [this] { return !queue.empty() || stopping; });
+            if (queue.empty()) {
+                break;
+            }
+
+            std::deque<record_t> batch;
+            batch.swap(queue);
+            uint64_t lost = dropped;
+            dropped = 0;
+            lock.unlock();
+            not_full.notify_all();
+
+            if (lost) {
+                std::ostringstream buffer;
+                if (!skip_prefix) {
+                    buffer << "<" << logger_name << ">"
+                           << "[" << level_to_str(logger::Level::WARN)
+                           << "]: ";
+                }
+                buffer << lost << " log messages were dropped";
+                if (!skip_linebreak) {
+                    buffer << "\n";
+                }
+                sink->print(logger::Level::WARN, buffer.str());
+            }
+            for (auto &record : batch) {
+                sink->print(record.level,
+                            record.render ? record.render() : record.msg);
+            }
+
+            lock.lock();
+            written += batch.size();
+            written_cv.notify_all();
+        }
+    }
+
+    std::unique_ptr<Sink> sink;
+    const AsyncPolicy policy;
+    const size_t capacity;
+
+    std::mutex queue_mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    std::condition_variable written_cv;
+    std::deque<record_t> queue;
+    uint64_t pushed = 0;
+    uint64_t written = 0;
+    uint64_t dropped = 0;
+    uint64_t overflowed = 0;
+    bool stopping = false;
+    std::thread writer;
+};
+
 inline std::unique_ptr<Sink> sink_from_str(std::string logger_name,
                                            std::string name,
                                            filesystem::path file_path = "",
@@ -227,12 +483,83 @@ inline std::unique_ptr<Sink> sink_from_str(std::string logger_name,
     } else if (name == "file" && !file_path.empty()) {
         return std::make_unique<logger::FileSink>(logger_name, file_path,
                                                   skip_prefix, skip_linebreak);
+    } else if (name == "flight" && !file_path.empty()) {
+        return std::make_unique<logger::FlightRecorderSink>(
+            logger_name, file_path, flight::default_capacity, skip_prefix,
+            skip_linebreak);
     }
 
     throw std::invalid_argument(
         std::string("Parsing error: no valid sink for string '") + name +
         std::string("' with path '") + file_path.string() + std::string("'.") +
-        std::string("\nValid sink names are: stdout, stderr, file"));
+        std::string("\nValid sink names are: stdout, stderr, file, flight"));
+}
+
+/// @brief Creates a sink from the values of the "output" logger option:
+///        <stdout|stderr|file,<path>|flight,<path>[,<records>]>
+inline std::unique_ptr<Sink>
+sink_from_values(std::string logger_name,
+                 const std::vector<std::string> &values,
+                 bool skip_prefix = false, bool skip_linebreak = false) {
+    if (values.size() == 3 && values[0] == "flight") {
+        size_t capacity;
+        try {
+            capacity = std::stoul(values[2]);
+        } catch (const std::exception &) {
+            throw std::invalid_argument(
+                std::string("Parsing error: invalid flight recorder size '") +
+                values[2] + std::string("'."));
+        }
+        return std::make_unique<logger::FlightRecorderSink>(
+            std::move(logger_name), values[1], capacity, skip_prefix,
+            skip_linebreak);
+    }
+
+    return values.size() == 2
+               ? sink_from_str(std::move(logger_name), values[0], values[1],
+                               skip_prefix, skip_linebreak)
+               : sink_from_str(std::move(logger_name), values[0], "",
+                               skip_prefix, skip_linebreak);
+}
+
+/// @brief Wraps sink in an AsyncSink configured by the values of the "async"
+///        logger option: <drop|block|sample>[,<queue size>]
+inline std::unique_ptr<Sink>
+async_sink_from_str(std::string logger_name, std::unique_ptr<Sink> sink,
+                    const std::vector<std::string> &values,
+                    bool skip_prefix = false, bool skip_linebreak = false) {
+    AsyncPolicy policy;
+    if (values.empty() || values.size() > 2) {
+        throw std::invalid_argument(
+            "Parsing error: async option expects a policy and optionally a "
+            "queue size.");
+    } else if (values[0] == "drop") {
+        policy = AsyncPolicy::DROP;
+    } else if (values[0] == "block") {
+        policy = AsyncPolicy::BLOCK;
+    } else if (values[0] == "sample") {
+        policy = AsyncPolicy::SAMPLE;
+    } else {
+        throw std::invalid_argument(
+            std::string("Parsing error: no valid async policy for string '") +
+            values[0] + std::string("'.") +
+            std::string("\nValid async policies are: drop, block, sample"));
+    }
+
+    size_t capacity = AsyncSink::default_capacity;
+    if (values.size() == 2) {
+        try {
+            capacity = std::stoul(values[1]);
+        } catch (const std::exception &) {
+            throw std::invalid_argument(
+                std::string("Parsing error: invalid async queue size '") +
+                values[1] + std::string("'."));
+        }
+    }
+
+    return std::make_unique<AsyncSink>(std::move(logger_name), std::move(sink),
+                                       policy, capacity, skip_prefix,
+                                       skip_linebreak);
 }
 
 } // namespace logger
@@ -18,13 +18,21 @@
 #include <ur_api.h>
 
 #include "logger/ur_logger.hpp"
+#include "ur_util.hpp"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <stdexcept>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace umf {
 
@@ -91,6 +99,10 @@ DEFINE_CHECK_OP(close_ipc_handle)
     }
 
 namespace detail {
+/// Report the allocations of memory providers to the stats of their pool
+inline void onProviderAlloc(size_t Size);
+inline void onProviderFree(size_t Size);
+
 template <typename T, typename ArgsTuple>
 umf_result_t initialize(T *obj, ArgsTuple &&args) {
     try {
@@ -163,12 +175,33 @@ auto memoryProviderMakeUnique(Args &&...args) {
     };
     ops.finalize = [](void *obj) { delete reinterpret_cast<T *>(obj); };
 
-    UMF_ASSIGN_OP(ops, T, alloc, UMF_RESULT_ERROR_UNKNOWN);
+    // Allocations and frees are reported to the stats of the pool, if any
+    ops.alloc = [](void *obj, size_t size, size_t alignment, void **ptr) {
+        try {
+            auto ret = reinterpret_cast<T *>(obj)->alloc(size, alignment, ptr);
+            if (ret == UMF_RESULT_SUCCESS) {
+                detail::onProviderAlloc(size);
+            }
+            return ret;
+        } catch (...) {
+            return UMF_RESULT_ERROR_UNKNOWN;
+        }
+    };
     UMF_ASSIGN_OP_NORETURN(ops, T, get_last_native_error);
     UMF_ASSIGN_OP(ops, T, get_recommended_page_size, UMF_RESULT_ERROR_UNKNOWN);
     UMF_ASSIGN_OP(ops, T, get_min_page_size, UMF_RESULT_ERROR_UNKNOWN);
     UMF_ASSIGN_OP(ops, T, get_name, "");
-    UMF_ASSIGN_OP(ops.ext, T, free, UMF_RESULT_ERROR_UNKNOWN);
+    ops.ext.free = [](void *obj, void *ptr, size_t size) {
+        try {
+            auto ret = reinterpret_cast<T *>(obj)->free(ptr, size);
+            if (ret == UMF_RESULT_SUCCESS) {
+                detail::onProviderFree(size);
+            }
+            return ret;
+        } catch (...) {
+            return UMF_RESULT_ERROR_UNKNOWN;
+        }
+    };
     UMF_ASSIGN_OP(ops.ext, T, purge_lazy, UMF_RESULT_ERROR_UNKNOWN);
     UMF_ASSIGN_OP(ops.ext, T, purge_force, UMF_RESULT_ERROR_UNKNOWN);
     UMF_ASSIGN_OP(ops.ext, T, allocation_merge, UMF_RESULT_ERROR_UNKNOWN);
@@ -241,6 +274,710 @@ template <typename Type> umf_result_t &getPoolLastStatusRef() {
     return last_status;
 }
 
+class pool_cache_t;
+class pool_stats_t;
+
+namespace detail {
+constexpr size_t minCachedSize = 64;
+
+/// Returns the index of the smallest power of two size class, starting at
+/// minCachedSize, which fits Size.
+inline size_t cacheSizeClass(size_t Size) {
+    size_t Class = 0;
+    while ((minCachedSize << Class) < Size) {
+        Class++;
+    }
+    return Class;
+}
+
+/// Front-ends added to a pool, each of them is optional
+struct pool_entry_t {
+    pool_cache_t *Cache = nullptr;
+    pool_stats_t *Stats = nullptr;
+};
+
+struct pool_registry_t {
+    std::shared_mutex Mutex;
+    std::unordered_map<umf_memory_pool_handle_t, pool_entry_t> Pools;
+    /// Changes whenever a front-end is added or removed
+    std::atomic<uint64_t> Generation = 0;
+};
+
+inline pool_registry_t &poolRegistry() {
+    static pool_registry_t Registry;
+    return Registry;
+}
+
+/// Adds or removes (Front == nullptr) one front-end of hPool
+template <typename T>
+void registerPoolFrontEnd(umf_memory_pool_handle_t hPool,
+                          T *pool_entry_t::*Member, T *Front) {
+    auto &Registry = poolRegistry();
+    std::unique_lock<std::shared_mutex> Lock(Registry.Mutex);
+    auto &Entry = Registry.Pools[hPool];
+    Entry.*Member = Front;
+    if (!Entry.Cache && !Entry.Stats) {
+        Registry.Pools.erase(hPool);
+    }
+    Registry.Generation++;
+}
+
+inline pool_entry_t lookupPoolEntry(umf_memory_pool_handle_t hPool) {
+    auto &Registry = poolRegistry();
+    std::shared_lock<std::shared_mutex> Lock(Registry.Mutex);
+    auto Found = Registry.Pools.find(hPool);
+    return Found == Registry.Pools.end() ? pool_entry_t{} : Found->second;
+}
+
+/// Returns the front-ends of hPool
+inline pool_entry_t findPoolEntry(umf_memory_pool_handle_t hPool) {
+    auto &Registry = poolRegistry();
+    // Remember the lookups of this thread until a front-end is added or
+    // removed, the registry lock would be contended as much as the pool's
+    struct lookups_t {
+        uint64_t Generation = 0;
+        std::unordered_map<umf_memory_pool_handle_t, pool_entry_t> Pools;
+    };
+    static thread_local lookups_t Lookups;
+
+    uint64_t Generation = Registry.Generation.load(std::memory_order_acquire);
+    if (Generation == 0) {
+        return {};
+    }
+    if (Lookups.Generation != Generation) {
+        Lookups.Pools.clear();
+        Lookups.Generation = Generation;
+    }
+
+    auto It = Lookups.Pools.find(hPool);
+    if (It != Lookups.Pools.end()) {
+        return It->second;
+    }
+    return Lookups.Pools.emplace(hPool, lookupPoolEntry(hPool)).first->second;
+}
+
+/// Number of allocations this thread made from memory providers
+inline uint64_t &providerAllocCount() {
+    static thread_local uint64_t Count = 0;
+    return Count;
+}
+
+/// Stats of the pool this thread is allocating from or freeing to
+inline pool_stats_t *&currentPoolStats() {
+    static thread_local pool_stats_t *Stats = nullptr;
+    return Stats;
+}
+
+/// Whether the pool stats remember the size of every allocation, set by
+/// UR_USM_POOL_STATS_TRACK_SIZES
+inline bool poolStatsTrackSizes() {
+    static const bool Enabled =
+        getenv_tobool("UR_USM_POOL_STATS_TRACK_SIZES");
+    return Enabled;
+}
+
+/// Attributes the provider calls made while it is alive to Stats
+class pool_stats_scope_t {
+  public:
+    pool_stats_scope_t(pool_stats_t *Stats)
+        : Previous(currentPoolStats()), AllocCount(providerAllocCount()) {
+        currentPoolStats() = Stats;
+    }
+    ~pool_stats_scope_t() { currentPoolStats() = Previous; }
+
+    pool_stats_scope_t(const pool_stats_scope_t &) = delete;
+    pool_stats_scope_t &operator=(const pool_stats_scope_t &) = delete;
+
+    /// Whether the pool had to allocate from its provider
+    bool providerAllocated() const {
+        return providerAllocCount() != AllocCount;
+    }
+
+  private:
+    pool_stats_t *Previous;
+    uint64_t AllocCount;
+};
+} // namespace detail
+
+/// @brief Usage counters of a memory pool.
+///
+/// Allocations are counted in power of two size buckets, the same as the size
+/// classes of pool_cache_t: bucket N holds the sizes up to
+/// detail::minCachedSize << N and the last bucket every larger size. An
+/// allocation is a hit when the pool served it without allocating from its
+/// memory provider.
+///
+/// The counters are updated with relaxed atomics and can be read at any time
+/// without locking. The disjoint pool can't report the size of an allocation
+/// when it is freed, so the used sizes are only counted when TrackSizes is
+/// set, which remembers the size passed to malloc until the allocation is
+/// freed. That takes a lock on every allocation and free, and is meant for
+/// diagnosing the memory use of an application rather than for production.
+class pool_stats_t {
+  public:
+    static constexpr size_t NumBuckets = 32;
+
+    struct snapshot_t {
+        /// Bytes of the live allocations
+        size_t UsedSize = 0;
+        /// Highest UsedSize so far
+        size_t PeakUsedSize = 0;
+        /// Bytes allocated from the memory provider and not freed back yet
+        size_t HeldSize = 0;
+        std::array<uint64_t, NumBuckets> Hits = {};
+        std::array<uint64_t, NumBuckets> Misses = {};
+        /// Whether UsedSize and PeakUsedSize are counted
+        bool TracksSizes = true;
+
+        /// Bytes held by the pool which aren't used by live allocations
+        size_t cachedSize() const {
+            return HeldSize > UsedSize ? HeldSize - UsedSize : 0;
+        }
+
+        /// Share of the held bytes which aren't used, between 0 and 1
+        double fragmentation() const {
+            return HeldSize ? static_cast<double>(cachedSize()) / HeldSize
+                            : 0.0;
+        }
+
+        /// Accumulates the stats of several pools, the peak is the sum of the
+        /// peaks of the pools.
+        snapshot_t &operator+=(const snapshot_t &Other) {
+            UsedSize += Other.UsedSize;
+            PeakUsedSize += Other.PeakUsedSize;
+            HeldSize += Other.HeldSize;
+            for (size_t i = 0; i < NumBuckets; ++i) {
+                Hits[i] += Other.Hits[i];
+                Misses[i] += Other.Misses[i];
+            }
+            TracksSizes = TracksSizes && Other.TracksSizes;
+            return *this;
+        }
+    };
+
+    pool_stats_t(umf_memory_pool_handle_t hPool, bool TrackSizes)
+        : hPool(hPool), TrackSizes(TrackSizes) {
+        detail::registerPoolFrontEnd(hPool, &detail::pool_entry_t::Stats,
+                                     this);
+    }
+
+    ~pool_stats_t() {
+        detail::registerPoolFrontEnd<pool_stats_t>(
+            hPool, &detail::pool_entry_t::Stats, nullptr);
+    }
+
+    pool_stats_t(const pool_stats_t &) = delete;
+    pool_stats_t &operator=(const pool_stats_t &) = delete;
+
+    void recordAlloc(void *Ptr, size_t Size, bool Hit) {
+        size_t Bucket = std::min(detail::cacheSizeClass(Size), NumBuckets - 1);
+        (Hit ? Hits : Misses)[Bucket].fetch_add(1, std::memory_order_relaxed);
+        if (!TrackSizes) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(SizesMutex);
+            Sizes[Ptr] = Size;
+        }
+
+        size_t Used =
+            UsedSize.fetch_add(Size, std::memory_order_relaxed) + Size;
+        size_t Peak = PeakUsedSize.load(std::memory_order_relaxed);
+        while (Peak < Used && !PeakUsedSize.compare_exchange_weak(
+                                  Peak, Used, std::memory_order_relaxed)) {
+        }
+    }
+
+    void recordFree(void *Ptr) {
+        if (!TrackSizes) {
+            return;
+        }
+
+        size_t Size;
+        {
+            std::lock_guard<std::mutex> Lock(SizesMutex);
+            auto It = Sizes.find(Ptr);
+            if (It == Sizes.end()) {
+                return;
+            }
+            Size = It->second;
+            Sizes.erase(It);
+        }
+        UsedSize.fetch_sub(Size, std::memory_order_relaxed);
+    }
+
+    void recordProviderAlloc(size_t Size) {
+        HeldSize.fetch_add(Size, std::memory_order_relaxed);
+    }
+
+    void recordProviderFree(size_t Size) {
+        HeldSize.fetch_sub(Size, std::memory_order_relaxed);
+    }
+
+    snapshot_t snapshot() const {
+        snapshot_t Snapshot;
+        Snapshot.UsedSize = UsedSize.load(std::memory_order_relaxed);
+        Snapshot.PeakUsedSize = PeakUsedSize.load(std::memory_order_relaxed);
+        Snapshot.HeldSize = HeldSize.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < NumBuckets; ++i) {
+            Snapshot.Hits[i] = Hits[i].load(std::memory_order_relaxed);
+            Snapshot.Misses[i] = Misses[i].load(std::memory_order_relaxed);
+        }
+        Snapshot.TracksSizes = TrackSizes;
+        return Snapshot;
+    }
+
+  private:
+    umf_memory_pool_handle_t hPool;
+    bool TrackSizes;
+
+    std::atomic<size_t> UsedSize = 0;
+    std::atomic<size_t> PeakUsedSize = 0;
+    std::atomic<size_t> HeldSize = 0;
+    std::array<std::atomic<uint64_t>, NumBuckets> Hits = {};
+    std::array<std::atomic<uint64_t>, NumBuckets> Misses = {};
+
+    std::mutex SizesMutex;
+    std::unordered_map<void *, size_t> Sizes;
+};
+
+namespace detail {
+inline void onProviderAlloc(size_t Size) {
+    providerAllocCount()++;
+    if (auto *Stats = currentPoolStats()) {
+        Stats->recordProviderAlloc(Size);
+    }
+}
+
+inline void onProviderFree(size_t Size) {
+    if (auto *Stats = currentPoolStats()) {
+        Stats->recordProviderFree(Size);
+    }
+}
+} // namespace detail
+
+/// @brief Per-thread caches of freed allocations in front of a memory pool.
+///
+/// Every thread keeps a magazine of freed allocations for each power of two
+/// size class up to a maximum size, and serves allocations of the same class
+/// from it without taking the locks of the pool. When a magazine is full, the
+/// older half is returned to the pool in one batch. A thread returns its cached
+/// allocations when it exits, and all of them are returned when the
+/// pool_cache_t is destroyed, which has to happen before the pool is destroyed.
+///
+/// The size class of an allocation is remembered by the thread which made it,
+/// so that freeing it on the same thread doesn't take a lock shared with the
+/// other threads. An allocation freed by another thread is looked up in the
+/// states of every thread and moves to the one freeing it.
+class pool_cache_t {
+  public:
+    pool_cache_t(umf_memory_pool_handle_t hPool, size_t Capacity,
+                 size_t MaxSize)
+        : hPool(hPool), Capacity(Capacity),
+          NumClasses(detail::cacheSizeClass(MaxSize) + 1), Id(nextId()++) {
+        detail::registerPoolFrontEnd(hPool, &detail::pool_entry_t::Cache,
+                                     this);
+    }
+
+    ~pool_cache_t() {
+        detail::registerPoolFrontEnd<pool_cache_t>(
+            hPool, &detail::pool_entry_t::Cache, nullptr);
+
+        std::lock_guard<std::mutex> Lock(StatesMutex);
+        for (auto &State : States) {
+            std::lock_guard<std::mutex> StateLock(State->Mutex);
+            if (State->Owner) {
+                releaseAll(*State);
+                State->Owner = nullptr;
+            }
+        }
+    }
+
+    pool_cache_t(const pool_cache_t &) = delete;
+    pool_cache_t &operator=(const pool_cache_t &) = delete;
+
+    void *malloc(size_t Size, size_t Align) {
+        size_t Class = detail::cacheSizeClass(Size);
+        auto &State = getThreadState();
+        if (Class >= NumClasses) {
+            // Too large to be cached, but remembered so that free doesn't
+            // look for it in the other threads
+            Class = uncachedClass;
+        } else {
+            std::lock_guard<std::mutex> Lock(State.Mutex);
+            auto &Magazine = State.Magazines[Class];
+            if (!Magazine.empty() &&
+                (Align == 0 ||
+                 reinterpret_cast<uintptr_t>(Magazine.back()) % Align == 0)) {
+                void *Ptr = Magazine.back();
+                Magazine.pop_back();
+                return Ptr;
+            }
+            Size = detail::minCachedSize << Class;
+        }
+
+        void *Ptr = umfPoolAlignedMalloc(hPool, Size, Align);
+        if (Ptr) {
+            std::lock_guard<std::mutex> Lock(State.Mutex);
+            State.Classes.emplace(Ptr, static_cast<uint8_t>(Class));
+        }
+        return Ptr;
+    }
+
+    umf_result_t free(void *Ptr) {
+        auto &State = getThreadState();
+        {
+            std::unique_lock<std::mutex> Lock(State.Mutex);
+            auto It = State.Classes.find(Ptr);
+            if (It != State.Classes.end()) {
+                return cache(State, It, Lock);
+            }
+        }
+        return freeForeign(State, Ptr);
+    }
+
+    /// Returns the cached allocations of every thread to the pool, until at
+    /// most BytesToKeep are cached. The largest ones are returned first.
+    /// Returns the number of bytes returned to the pool.
+    size_t trim(size_t BytesToKeep) {
+        std::vector<std::shared_ptr<thread_state_t>> Current;
+        {
+            std::lock_guard<std::mutex> Lock(StatesMutex);
+            Current = States;
+        }
+
+        size_t Kept = 0;
+        size_t Released = 0;
+        for (auto &State : Current) {
+            std::vector<void *> Excess;
+            {
+                std::lock_guard<std::mutex> Lock(State->Mutex);
+                for (size_t Class = 0; Class < NumClasses; ++Class) {
+                    auto &Magazine = State->Magazines[Class];
+                    size_t Size = detail::minCachedSize << Class;
+                    size_t Keep = std::min(
+                        Magazine.size(),
+                        (BytesToKeep > Kept ? BytesToKeep - Kept : 0) / Size);
+                    Kept += Keep * Size;
+                    Released += (Magazine.size() - Keep) * Size;
+                    // The newest allocations are reused first, keep them
+                    auto End = Magazine.end() - Keep;
+                    Excess.insert(Excess.end(), Magazine.begin(), End);
+                    Magazine.erase(Magazine.begin(), End);
+                }
+                forget(*State, Excess);
+            }
+            release(Excess);
+        }
+        return Released;
+    }
+
+  private:
+    /// Size class of the allocations which are too large to be cached
+    static constexpr uint8_t uncachedClass = UINT8_MAX;
+
+    using classes_t = std::unordered_map<void *, uint8_t>;
+
+    struct thread_state_t {
+        thread_state_t(pool_cache_t *Owner, size_t NumClasses)
+            : Owner(Owner), Magazines(NumClasses) {}
+
+        std::mutex Mutex;
+        /// Reset when the cache is destroyed
+        pool_cache_t *Owner;
+        std::vector<std::vector<void *>> Magazines;
+        /// Size class of every allocation of this thread which wasn't
+        /// returned to the pool, whether it is in use or in a magazine
+        classes_t Classes;
+    };
+
+    /// Caches used by one thread, returned to their pools on thread exit
+    struct thread_caches_t {
+        std::vector<std::pair<uint64_t, std::shared_ptr<thread_state_t>>>
+            States;
+
+        ~thread_caches_t() {
+            for (auto &[Id, State] : States) {
+                std::lock_guard<std::mutex> Lock(State->Mutex);
+                if (State->Owner) {
+                    State->Owner->releaseAll(*State);
+                }
+            }
+        }
+    };
+
+    static std::atomic<uint64_t> &nextId() {
+        static std::atomic<uint64_t> NextId = 0;
+        return NextId;
+    }
+
+    thread_state_t &getThreadState() {
+        static thread_local thread_caches_t Caches;
+        for (auto &[CacheId, State] : Caches.States) {
+            if (CacheId == Id) {
+                return *State;
+            }
+        }
+
+        // Forget the caches which were destroyed
+        for (auto It = Caches.States.begin(); It != Caches.States.end();) {
+            std::unique_lock<std::mutex> Lock(It->second->Mutex);
+            bool Destroyed = !It->second->Owner;
+            Lock.unlock();
+            It = Destroyed ? Caches.States.erase(It) : It + 1;
+        }
+
+        auto State = std::make_shared<thread_state_t>(this, NumClasses);
+        {
+            std::lock_guard<std::mutex> Lock(StatesMutex);
+            // Drop the states of the threads which exited, once the other
+            // threads freed their allocations
+            for (auto It = States.begin(); It != States.end();) {
+                bool Exited = It->use_count() == 1;
+                if (Exited) {
+                    std::lock_guard<std::mutex> StateLock((*It)->Mutex);
+                    Exited = (*It)->Classes.empty();
+                }
+                It = Exited ? States.erase(It) : It + 1;
+            }
+            States.push_back(State);
+        }
+        return *Caches.States.emplace_back(Id, std::move(State)).second;
+    }
+
+    /// Puts the allocation It of State, locked by Lock, in its magazine or
+    /// returns it to the pool if it isn't cached
+    umf_result_t cache(thread_state_t &State, classes_t::iterator It,
+                       std::unique_lock<std::mutex> &Lock) {
+        void *Ptr = It->first;
+        size_t Class = It->second;
+        if (Class == uncachedClass) {
+            State.Classes.erase(It);
+            Lock.unlock();
+            return umfPoolFree(hPool, Ptr);
+        }
+
+        std::vector<void *> Excess;
+        auto &Magazine = State.Magazines[Class];
+        if (Magazine.size() >= Capacity) {
+            auto Half = Magazine.begin() + (Magazine.size() + 1) / 2;
+            Excess.assign(Magazine.begin(), Half);
+            Magazine.erase(Magazine.begin(), Half);
+            forget(State, Excess);
+        }
+        Magazine.push_back(Ptr);
+        Lock.unlock();
+        return release(Excess);
+    }
+
+    /// Frees an allocation which State didn't make, taking it over from the
+    /// thread which made it
+    umf_result_t freeForeign(thread_state_t &State, void *Ptr) {
+        std::optional<uint8_t> Class;
+        {
+            std::lock_guard<std::mutex> Lock(StatesMutex);
+            for (auto &Other : States) {
+                if (Other.get() == &State) {
+                    continue;
+                }
+                std::lock_guard<std::mutex> OtherLock(Other->Mutex);
+                auto It = Other->Classes.find(Ptr);
+                if (It != Other->Classes.end()) {
+                    Class = It->second;
+                    Other->Classes.erase(It);
+                    break;
+                }
+            }
+        }
+        if (!Class) {
+            // Not allocated through the cache
+            return umfPoolFree(hPool, Ptr);
+        }
+
+        std::unique_lock<std::mutex> Lock(State.Mutex);
+        return cache(State, State.Classes.emplace(Ptr, *Class).first, Lock);
+    }
+
+    /// Forgets the size classes of the allocations of State which are about
+    /// to be returned to the pool, State has to be locked
+    static void forget(thread_state_t &State, const std::vector<void *> &Ptrs) {
+        for (void *Ptr : Ptrs) {
+            State.Classes.erase(Ptr);
+        }
+    }
+
+    /// Returns every allocation cached by State to the pool
+    void releaseAll(thread_state_t &State) {
+        for (auto &Magazine : State.Magazines) {
+            forget(State, Magazine);
+            release(Magazine);
+            Magazine.clear();
+        }
+    }
+
+    umf_result_t release(const std::vector<void *> &Ptrs) {
+        umf_result_t Result = UMF_RESULT_SUCCESS;
+        if (Ptrs.empty()) {
+            return Result;
+        }
+        // Also released on thread exit, outside of cachedFree
+        detail::pool_stats_scope_t Scope(detail::lookupPoolEntry(hPool).Stats);
+        for (void *Ptr : Ptrs) {
+            auto Ret = umfPoolFree(hPool, Ptr);
+            if (Result == UMF_RESULT_SUCCESS) {
+                Result = Ret;
+            }
+        }
+        return Result;
+    }
+
+    umf_memory_pool_handle_t hPool;
+    size_t Capacity;
+    size_t NumClasses;
+    uint64_t Id;
+
+    std::mutex StatesMutex;
+    std::vector<std::shared_ptr<thread_state_t>> States;
+};
+
+/// @brief Puts per-thread caches in front of a pool, see pool_cache_t.
+/// Allocations up to MaxSize are cached, at most Capacity of each size class
+/// per thread. Returns the pool unchanged when Capacity or MaxSize is 0. The
+/// returned handle destroys the caches before the pool.
+inline pool_unique_handle_t poolAddThreadCache(pool_unique_handle_t Pool,
+                                               size_t Capacity,
+                                               size_t MaxSize) {
+    if (!Pool || Capacity == 0 || MaxSize == 0) {
+        return Pool;
+    }
+
+    auto Cache = std::make_shared<pool_cache_t>(Pool.get(), Capacity, MaxSize);
+    auto Deleter = Pool.get_deleter();
+    return pool_unique_handle_t(
+        Pool.release(),
+        [Cache = std::move(Cache),
+         Deleter](umf_memory_pool_handle_t hPool) mutable {
+            Cache.reset();
+            Deleter(hPool);
+        });
+}
+
+/// @brief Counts the usage of a pool, see pool_stats_t. The returned handle
+/// destroys the stats before the pool.
+inline pool_unique_handle_t
+poolAddStats(pool_unique_handle_t Pool,
+             bool TrackSizes = detail::poolStatsTrackSizes()) {
+    if (!Pool) {
+        return Pool;
+    }
+
+    auto Stats = std::make_shared<pool_stats_t>(Pool.get(), TrackSizes);
+    auto Deleter = Pool.get_deleter();
+    return pool_unique_handle_t(
+        Pool.release(),
+        [Stats = std::move(Stats),
+         Deleter](umf_memory_pool_handle_t hPool) mutable {
+            Stats.reset();
+            Deleter(hPool);
+        });
+}
+
+/// @brief Returns the allocations cached in front of hPool to it, keeping at
+/// most BytesToKeep cached. Returns the number of bytes returned to the pool.
+inline size_t poolTrim(umf_memory_pool_handle_t hPool, size_t BytesToKeep) {
+    auto *Cache = detail::lookupPoolEntry(hPool).Cache;
+    return Cache ? Cache->trim(BytesToKeep) : 0;
+}
+
+/// @brief Returns the caches in front of hPool, or nullptr if there are none
+inline pool_cache_t *findPoolCache(umf_memory_pool_handle_t hPool) {
+    return detail::findPoolEntry(hPool).Cache;
+}
+
+/// @brief Returns the stats of hPool, or nullptr if it has none
+inline pool_stats_t *findPoolStats(umf_memory_pool_handle_t hPool) {
+    return detail::findPoolEntry(hPool).Stats;
+}
+
+/// @brief umfPoolAlignedMalloc going through the caches of hPool and counted
+/// in its stats, if any
+inline void *cachedAlignedMalloc(umf_memory_pool_handle_t hPool, size_t Size,
+                                 size_t Align) {
+    auto Entry = detail::findPoolEntry(hPool);
+    auto Malloc = [&] {
+        return Entry.Cache ? Entry.Cache->malloc(Size, Align)
+                           : umfPoolAlignedMalloc(hPool, Size, Align);
+    };
+    if (!Entry.Stats) {
+        return Malloc();
+    }
+
+    detail::pool_stats_scope_t Scope(Entry.Stats);
+    void *Ptr = Malloc();
+    if (Ptr) {
+        Entry.Stats->recordAlloc(Ptr, Size, !Scope.providerAllocated());
+    }
+    return Ptr;
+}
+
+/// @brief umfPoolFree going through the caches of hPool and counted in its
+/// stats, if any
+inline umf_result_t cachedFree(umf_memory_pool_handle_t hPool, void *Ptr) {
+    auto Entry = detail::findPoolEntry(hPool);
+    detail::pool_stats_scope_t Scope(Entry.Stats);
+    if (Entry.Stats) {
+        Entry.Stats->recordFree(Ptr);
+    }
+    return Entry.Cache ? Entry.Cache->free(Ptr) : umfPoolFree(hPool, Ptr);
+}
+
+/// @brief Returns the combined stats of the given pools, the ones without
+/// stats are skipped.
+template <typename... Pools>
+pool_stats_t::snapshot_t poolStatsSnapshot(const Pools &...Handles) {
+    pool_stats_t::snapshot_t Snapshot;
+    auto Add = [&Snapshot](umf_memory_pool_handle_t hPool) {
+        if (auto *Stats = hPool ? findPoolStats(hPool) : nullptr) {
+            Snapshot += Stats->snapshot();
+        }
+    };
+    (Add(Handles.get()), ...);
+    return Snapshot;
+}
+
+/// @brief Answers the urUSMPoolGetInfo queries about pool usage from Stats.
+/// ReturnValue is the UrReturnHelper of the query.
+template <typename ReturnHelper>
+ur_result_t poolStatsInfo(const pool_stats_t::snapshot_t &Stats,
+                          ur_usm_pool_info_t PropName,
+                          ReturnHelper &ReturnValue) {
+    bool SizeQuery = PropName == UR_USM_POOL_INFO_USED_SIZE ||
+                     PropName == UR_USM_POOL_INFO_CACHED_SIZE ||
+                     PropName == UR_USM_POOL_INFO_PEAK_USED_SIZE ||
+                     PropName == UR_USM_POOL_INFO_FRAGMENTATION;
+    if (SizeQuery && !Stats.TracksSizes) {
+        return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+
+    switch (PropName) {
+    case UR_USM_POOL_INFO_USED_SIZE:
+        return ReturnValue(Stats.UsedSize);
+    case UR_USM_POOL_INFO_CACHED_SIZE:
+        return ReturnValue(Stats.cachedSize());
+    case UR_USM_POOL_INFO_PEAK_USED_SIZE:
+        return ReturnValue(Stats.PeakUsedSize);
+    case UR_USM_POOL_INFO_BUCKET_HITS:
+        return ReturnValue(Stats.Hits.data(), Stats.Hits.size());
+    case UR_USM_POOL_INFO_BUCKET_MISSES:
+        return ReturnValue(Stats.Misses.data(), Stats.Misses.size());
+    case UR_USM_POOL_INFO_FRAGMENTATION:
+        return ReturnValue(Stats.fragmentation());
+    default:
+        return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+}
+
 /// @brief translates UMF return values to UR.
 /// This function assumes that the native error of
 /// the last failed memory provider is ur_result_t.
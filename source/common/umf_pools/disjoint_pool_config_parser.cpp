@@ -64,6 +64,12 @@ DisjointPoolAllConfigs::DisjointPoolAllConfigs(int trace) {
     Configs[DisjointPoolMemType::SharedReadOnly].MaxPoolableSize = 4_MB;
     Configs[DisjointPoolMemType::SharedReadOnly].Capacity = 4;
     Configs[DisjointPoolMemType::SharedReadOnly].SlabMinSize = 2_MB;
+
+    // Per-thread caching is opt-in.
+    for (auto &ThreadCache : ThreadCaches) {
+        ThreadCache.Capacity = 0;
+        ThreadCache.MaxSize = 64_KB;
+    }
 }
 
 DisjointPoolAllConfigs parseDisjointPoolConfig(const std::string &config,
@@ -140,14 +146,32 @@ DisjointPoolAllConfigs parseDisjointPoolConfig(const std::string &config,
             }
         }
         if (More) {
-            ParamParser(Params, AllConfigs.Configs[LM].SlabMinSize,
-                        ParamWasSet);
+            More = ParamParser(Params, AllConfigs.Configs[LM].SlabMinSize,
+                               ParamWasSet);
             if (ParamWasSet && memType == DisjointPoolMemType::All) {
                 for (auto &Config : AllConfigs.Configs) {
                     Config.SlabMinSize = AllConfigs.Configs[LM].SlabMinSize;
                 }
             }
         }
+        if (More) {
+            More = ParamParser(Params, AllConfigs.ThreadCaches[LM].Capacity,
+                               ParamWasSet);
+            if (ParamWasSet && memType == DisjointPoolMemType::All) {
+                for (auto &ThreadCache : AllConfigs.ThreadCaches) {
+                    ThreadCache.Capacity = AllConfigs.ThreadCaches[LM].Capacity;
+                }
+            }
+        }
+        if (More) {
+            ParamParser(Params, AllConfigs.ThreadCaches[LM].MaxSize,
+                        ParamWasSet);
+            if (ParamWasSet && memType == DisjointPoolMemType::All) {
+                for (auto &ThreadCache : AllConfigs.ThreadCaches) {
+                    ThreadCache.MaxSize = AllConfigs.ThreadCaches[LM].MaxSize;
+                }
+            }
+        }
     };
 
     auto MemTypeParser = [MemParser](std::string &Params) {
@@ -269,6 +293,26 @@ DisjointPoolAllConfigs parseDisjointPoolConfig(const std::string &config,
         << std::setw(12)
         << AllConfigs.Configs[DisjointPoolMemType::SharedReadOnly].Capacity
         << std::endl;
+    std::cout
+        << std::setw(15) << "TCCapacity" << std::setw(12)
+        << AllConfigs.ThreadCaches[DisjointPoolMemType::Host].Capacity
+        << std::setw(12)
+        << AllConfigs.ThreadCaches[DisjointPoolMemType::Device].Capacity
+        << std::setw(12)
+        << AllConfigs.ThreadCaches[DisjointPoolMemType::Shared].Capacity
+        << std::setw(12)
+        << AllConfigs.ThreadCaches[DisjointPoolMemType::SharedReadOnly].Capacity
+        << std::endl;
+    std::cout
+        << std::setw(15) << "TCMaxSize" << std::setw(12)
+        << AllConfigs.ThreadCaches[DisjointPoolMemType::Host].MaxSize
+        << std::setw(12)
+        << AllConfigs.ThreadCaches[DisjointPoolMemType::Device].MaxSize
+        << std::setw(12)
+        << AllConfigs.ThreadCaches[DisjointPoolMemType::Shared].MaxSize
+        << std::setw(12)
+        << AllConfigs.ThreadCaches[DisjointPoolMemType::SharedReadOnly].MaxSize
+        << std::endl;
     std::cout << std::setw(15) << "MaxPoolSize" << std::setw(12) << MaxSize
               << std::endl;
     std::cout << std::setw(15) << "EnableBuffers" << std::setw(12)
@@ -18,12 +18,20 @@
 namespace usm {
 enum DisjointPoolMemType { Host, Device, Shared, SharedReadOnly, All };
 
+// Limits of the per-thread caches in front of a pool, see
+// umf::poolAddThreadCache. Caching is disabled when Capacity is 0.
+struct ThreadCacheConfig {
+    size_t Capacity = 0;
+    size_t MaxSize = 0;
+};
+
 // Stores configuration for all instances of USM allocator
 class DisjointPoolAllConfigs {
   public:
     size_t EnableBuffers = 1;
     std::shared_ptr<umf_disjoint_pool_shared_limits_t> limits;
     umf_disjoint_pool_params_t Configs[DisjointPoolMemType::All];
+    ThreadCacheConfig ThreadCaches[DisjointPoolMemType::All];
 
     DisjointPoolAllConfigs(int trace = 0);
 };
@@ -32,7 +40,8 @@ class DisjointPoolAllConfigs {
 // [EnableBuffers][;[MaxPoolSize][;memtypelimits]...]
 //  memtypelimits: [<memtype>:]<limits>
 //  memtype: host|device|shared
-//  limits:  [MaxPoolableSize][,[Capacity][,SlabMinSize]]
+//  limits:  [MaxPoolableSize][,[Capacity][,[SlabMinSize][,[ThreadCacheCapacity]
+//           [,ThreadCacheMaxSize]]]]
 //
 // Without a memory type, the limits are applied to each memory type.
 // Parameters are for each context, except MaxPoolSize, which is overall
@@ -49,9 +58,14 @@ class DisjointPoolAllConfigs {
 //                  Default 4.
 // SlabMinSize:     Minimum allocation size requested from USM.
 //                  Default 64KB host and device, 2MB shared.
+// ThreadCacheCapacity: Maximum number of freed allocations of each size
+//                  class every thread keeps for reuse, without going through
+//                  the pool. Default 0, meaning no per-thread caching.
+// ThreadCacheMaxSize: Maximum allocation size kept by the per-thread caches.
+//                  Default 64KB.
 //
 // Example of usage:
-// "1;32M;host:1M,4,64K;device:1M,4,64K;shared:0,0,2M"
+// "1;32M;host:1M,4,64K;device:1M,4,64K,32,4K;shared:0,0,2M"
 DisjointPoolAllConfigs parseDisjointPoolConfig(const std::string &config,
                                                int trace = 1);
 } // namespace usm
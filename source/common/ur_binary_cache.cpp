@@ -0,0 +1,240 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#include "ur_binary_cache.hpp"
+#include "logger/ur_logger.hpp"
+#include "ur_util.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <thread>
+
+namespace ur {
+
+void binary_hash_t::add(const void *Data, size_t Size) {
+    auto Bytes = static_cast<const uint8_t *>(Data);
+    for (size_t I = 0; I < Size; I++) {
+        for (auto &Hash : H) {
+            Hash = (Hash ^ Bytes[I]) * 0x100000001b3ULL;
+        }
+    }
+}
+
+void binary_hash_t::addField(const void *Data, size_t Size) {
+    uint64_t Size64 = Size;
+    add(&Size64, sizeof(Size64));
+    add(Data, Size);
+}
+
+std::string binary_hash_t::str() const {
+    char Buf[33];
+    snprintf(Buf, sizeof(Buf), "%016llx%016llx",
+             static_cast<unsigned long long>(H[0]),
+             static_cast<unsigned long long>(H[1]));
+    return Buf;
+}
+
+// The header of the entries, after their magic
+struct entry_header_t {
+    uint64_t Size;
+    uint64_t Checksum[2];
+};
+
+static bool isTemporaryFile(const filesystem::path &Path) {
+    return Path.filename().string().find(".tmp.") != std::string::npos;
+}
+
+binary_cache_t::binary_cache_t(const char *SubDir, const char *DirEnvVar,
+                               const std::array<char, 8> &Magic)
+    : Name(std::string("program cache ") + SubDir), Magic(Magic) {
+    filesystem::path Path;
+    if (auto EnvDir = ur_getenv(DirEnvVar); EnvDir && !EnvDir->empty()) {
+        Root = *EnvDir;
+        Path = Root;
+    } else if (auto EnvRoot = ur_getenv("UR_PROGRAM_CACHE_DIR");
+               EnvRoot && !EnvRoot->empty()) {
+        Root = *EnvRoot;
+        Path = Root / SubDir;
+    } else {
+        return;
+    }
+    MaxSize =
+        getenv_to_unsigned("UR_PROGRAM_CACHE_MAX_SIZE_MB").value_or(1024) *
+        1024 * 1024;
+
+    std::error_code Error;
+    filesystem::create_directories(Path, Error);
+    if (Error) {
+        logger::warning("{}: can't create {}: {}", Name, Path.string(),
+                        Error.message());
+        return;
+    }
+    Dir = Path;
+}
+
+bool binary_cache_t::load(const std::string &Key,
+                          cached_binary_t &Binary) const {
+    if (Key.empty() || !Dir) {
+        return false;
+    }
+
+    auto Path = *Dir / Key;
+    mapped_file_t File;
+    if (!File.map(Path)) {
+        logger::debug("{}: miss {} ({} misses)", Name, Key, ++Misses);
+        return false;
+    }
+
+    constexpr size_t HeaderSize = sizeof(Magic) + sizeof(entry_header_t);
+    entry_header_t Header{};
+    if (File.size() < HeaderSize ||
+        std::memcmp(File.data(), Magic.data(), sizeof(Magic)) != 0) {
+        logger::warning("{}: ignoring invalid entry {}", Name, Path.string());
+        ++Misses;
+        return false;
+    }
+    std::memcpy(&Header, File.data() + sizeof(Magic), sizeof(Header));
+    binary_hash_t Checksum;
+    bool Complete = File.size() - HeaderSize == Header.Size;
+    if (Complete) {
+        Checksum.add(File.data() + HeaderSize, Header.Size);
+    }
+    if (!Complete || Checksum.H[0] != Header.Checksum[0] ||
+        Checksum.H[1] != Header.Checksum[1]) {
+        logger::warning("{}: removing corrupted entry {}", Name,
+                        Path.string());
+        File.reset();
+        std::error_code Error;
+        filesystem::remove(Path, Error);
+        ++Misses;
+        return false;
+    }
+
+    // The modification time orders the entries for the eviction
+    std::error_code Error;
+    filesystem::last_write_time(
+        Path, filesystem::file_time_type::clock::now(), Error);
+    logger::debug("{}: hit {} ({} bytes, {} hits)", Name, Key, Header.Size,
+                  ++Hits);
+    Binary.File = std::move(File);
+    Binary.Offset = HeaderSize;
+    return true;
+}
+
+void binary_cache_t::store(const std::string &Key, const void *Binary,
+                           size_t Size) const {
+    if (Key.empty() || !Dir) {
+        return;
+    }
+
+    // The temporary file is unique to this writer, concurrent writers of the
+    // same entry write the same binary and the last rename wins.
+    static const auto ProcessId = std::random_device{}();
+    static std::atomic<uint64_t> Counter{0};
+    auto TmpName =
+        Key + ".tmp." + std::to_string(ProcessId) + "." +
+        std::to_string(
+            std::hash<std::thread::id>()(std::this_thread::get_id())) +
+        "." + std::to_string(Counter++);
+    auto TmpPath = *Dir / TmpName;
+    {
+        binary_hash_t Checksum;
+        Checksum.add(Binary, Size);
+        entry_header_t Header{Size, {Checksum.H[0], Checksum.H[1]}};
+        std::ofstream File(TmpPath, std::ios::binary | std::ios::trunc);
+        File.write(Magic.data(), sizeof(Magic));
+        File.write(reinterpret_cast<const char *>(&Header), sizeof(Header));
+        File.write(static_cast<const char *>(Binary), Size);
+        if (!File) {
+            logger::warning("{}: can't write {}", Name, TmpPath.string());
+            std::error_code Error;
+            filesystem::remove(TmpPath, Error);
+            return;
+        }
+    }
+
+    std::error_code Error;
+    filesystem::rename(TmpPath, *Dir / Key, Error);
+    if (Error) {
+        // e.g. on Windows, where another writer already created the entry.
+        logger::debug("{}: can't rename {}: {}", Name, TmpPath.string(),
+                      Error.message());
+        filesystem::remove(TmpPath, Error);
+        return;
+    }
+    logger::debug("{}: stored {} ({} bytes, {} stores)", Name, Key, Size,
+                  ++Stores);
+
+    if (MaxSize) {
+        evict();
+    }
+}
+
+void binary_cache_t::evict() const {
+    struct entry_t {
+        filesystem::file_time_type Time;
+        uint64_t Size;
+        filesystem::path Path;
+    };
+    std::vector<entry_t> Entries;
+    uint64_t TotalSize = 0;
+
+    // Other processes may add or remove entries meanwhile, the errors of the
+    // entries which are gone are ignored.
+    std::error_code Error;
+    for (filesystem::recursive_directory_iterator It(Root, Error), End;
+         !Error && It != End; It.increment(Error)) {
+        std::error_code EntryError;
+        if (!It->is_regular_file(EntryError) || isTemporaryFile(It->path())) {
+            continue;
+        }
+        auto Size = It->file_size(EntryError);
+        auto Time = It->last_write_time(EntryError);
+        if (EntryError) {
+            continue;
+        }
+        Entries.push_back({Time, Size, It->path()});
+        TotalSize += Size;
+    }
+    if (TotalSize <= MaxSize) {
+        return;
+    }
+
+    std::sort(Entries.begin(), Entries.end(),
+              [](const entry_t &A, const entry_t &B) {
+                  return A.Time < B.Time;
+              });
+    for (auto &Entry : Entries) {
+        if (TotalSize <= MaxSize) {
+            break;
+        }
+        if (filesystem::remove(Entry.Path, Error)) {
+            logger::debug("{}: evicted {} ({} evictions)", Name,
+                          Entry.Path.string(), ++Evictions);
+        }
+        TotalSize -= Entry.Size;
+    }
+}
+
+binary_cache_t::stats_t binary_cache_t::stats() const {
+    stats_t Stats;
+    Stats.Hits = Hits.load(std::memory_order_relaxed);
+    Stats.Misses = Misses.load(std::memory_order_relaxed);
+    Stats.Stores = Stores.load(std::memory_order_relaxed);
+    Stats.Evictions = Evictions.load(std::memory_order_relaxed);
+    return Stats;
+}
+
+} // namespace ur
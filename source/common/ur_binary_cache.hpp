@@ -0,0 +1,111 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_BINARY_CACHE_HPP
+#define UR_BINARY_CACHE_HPP 1
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ur_filesystem_resolved.hpp"
+#include "ur_mapped_file.hpp"
+
+namespace ur {
+
+// Two FNV-1a hashes with different offsets, 128 bits make collisions between
+// the entries of a cache unlikely.
+struct binary_hash_t {
+    uint64_t H[2] = {0xcbf29ce484222325ULL, 0x84222325cbf29ce4ULL};
+
+    void add(const void *Data, size_t Size);
+    // Each field is prefixed with its size, so that their bytes can't be
+    // shifted from one to the next.
+    void addField(const void *Data, size_t Size);
+    void addField(const std::string &Str) { addField(Str.data(), Str.size()); }
+
+    std::string str() const;
+};
+
+// A binary loaded from a binary_cache_t, mapped from the file of its entry so
+// that it isn't copied to the heap
+class cached_binary_t {
+  public:
+    const uint8_t *data() const { return File.data() + Offset; }
+    size_t size() const { return File.size() - Offset; }
+
+  private:
+    friend class binary_cache_t;
+    mapped_file_t File;
+    size_t Offset = 0;
+};
+
+// A persistent cache of the binaries built by the adapters. The adapters share
+// the directory named by UR_PROGRAM_CACHE_DIR, each in its own subdirectory,
+// and the cache is disabled if it isn't set. The directory variable of an
+// adapter overrides it for that adapter.
+//
+// Processes may share the directory: entries are written to a temporary file
+// which is then renamed into place, so that readers only see complete
+// entries. Each entry has a checksum of its binary, entries which don't match
+// it are removed. Once the entries in the directory take more than
+// UR_PROGRAM_CACHE_MAX_SIZE_MB megabytes (1024 by default, 0 for no limit),
+// the least recently used ones are evicted.
+class binary_cache_t {
+  public:
+    struct stats_t {
+        uint64_t Hits = 0;
+        uint64_t Misses = 0;
+        uint64_t Stores = 0;
+        uint64_t Evictions = 0;
+    };
+
+    // SubDir is the subdirectory of the adapter in UR_PROGRAM_CACHE_DIR,
+    // DirEnvVar its own directory variable and Magic identifies the entries
+    // of the cache, and their format
+    binary_cache_t(const char *SubDir, const char *DirEnvVar,
+                   const std::array<char, 8> &Magic);
+
+    bool enabled() const { return Dir.has_value(); }
+
+    // Maps the binary cached for Key, returns false if there is none.
+    bool load(const std::string &Key, cached_binary_t &Binary) const;
+
+    // Caches the binary for Key, errors are only logged.
+    void store(const std::string &Key, const void *Binary, size_t Size) const;
+
+    // The counters of this cache in this process
+    stats_t stats() const;
+
+  private:
+    // Removes the least recently used entries until the directory fits in
+    // MaxSize
+    void evict() const;
+
+    std::string Name;
+    std::array<char, 8> Magic;
+    std::optional<filesystem::path> Dir;
+    // The directory which MaxSize applies to
+    filesystem::path Root;
+    uint64_t MaxSize = 0;
+
+    mutable std::atomic<uint64_t> Hits{0};
+    mutable std::atomic<uint64_t> Misses{0};
+    mutable std::atomic<uint64_t> Stores{0};
+    mutable std::atomic<uint64_t> Evictions{0};
+};
+
+} // namespace ur
+
+#endif /* UR_BINARY_CACHE_HPP */
@@ -0,0 +1,162 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_CLOCK_CALIBRATION_HPP
+#define UR_CLOCK_CALIBRATION_HPP 1
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include <ur_api.h>
+
+#include "ur_util.hpp"
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// A model of the device and host timestamps of urDeviceGetGlobalTimestamps
+/// as linear functions of the steady clock of the process, so the queries
+/// are answered without calling the driver.
+///
+/// The pair of timestamps is sampled from the driver at most once per
+/// period, and the last max_samples samples are kept. The drift of each
+/// clock is the slope between the oldest and the newest sample, which are
+/// several periods apart, and its offset is given by the newest sample.
+/// The timestamps returned never decrease, and the samples are dropped
+/// when a clock goes backwards, e.g. when a device counter wraps.
+///
+/// The model is disabled, and the driver queried every time, unless the
+/// period is set with UR_DEVICE_TIMESTAMP_CALIBRATION_PERIOD_MS.
+class clock_calibration_t {
+  public:
+    static constexpr size_t max_samples = 8;
+
+    /// The timestamps of urDeviceGetGlobalTimestamps, in nanoseconds
+    struct sample_t {
+        uint64_t device = 0;
+        uint64_t host = 0;
+    };
+
+    clock_calibration_t() : period(defaultPeriod()) {}
+    explicit clock_calibration_t(std::chrono::nanoseconds period)
+        : period(period) {}
+
+    bool enabled() const { return period.count() > 0; }
+
+    /// Writes the timestamps of the model at the current time to the
+    /// non-null pointers. sample(sample_t &) queries the driver when the
+    /// newest sample is older than the period, and the error it returns,
+    /// if any, is returned
+    template <typename SampleFn>
+    ur_result_t getTimestamps(uint64_t *device_timestamp,
+                              uint64_t *host_timestamp, SampleFn &&sample) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto now = std::chrono::steady_clock::now();
+        if (count == 0 || now - newest().local >= period) {
+            sample_t timestamps;
+            if (auto result = sample(timestamps);
+                result != UR_RESULT_SUCCESS) {
+                return result;
+            }
+            // The driver call takes a while, the timestamps are taken
+            // halfway through it
+            auto after = std::chrono::steady_clock::now();
+            add(timestamps, now + (after - now) / 2);
+            now = after;
+        }
+
+        if (device_timestamp) {
+            last.device = std::max(
+                last.device, estimate(now, &sample_t::device));
+            *device_timestamp = last.device;
+        }
+        if (host_timestamp) {
+            last.host = std::max(last.host, estimate(now, &sample_t::host));
+            *host_timestamp = last.host;
+        }
+        return UR_RESULT_SUCCESS;
+    }
+
+    /// The number of times the driver was queried
+    uint64_t sampleCount() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return sample_count;
+    }
+
+  private:
+    struct entry_t {
+        sample_t timestamps;
+        std::chrono::steady_clock::time_point local;
+    };
+
+    static std::chrono::nanoseconds defaultPeriod() {
+        static const std::chrono::nanoseconds value =
+            std::chrono::milliseconds(
+                getenv_to_unsigned("UR_DEVICE_TIMESTAMP_CALIBRATION_PERIOD_MS")
+                    .value_or(0));
+        return value;
+    }
+
+    const entry_t &newest() const {
+        return entries[(first + count - 1) % max_samples];
+    }
+    const entry_t &oldest() const { return entries[first]; }
+
+    void add(const sample_t &timestamps,
+             std::chrono::steady_clock::time_point local) {
+        sample_count++;
+        if (count > 0 && (timestamps.device < newest().timestamps.device ||
+                          timestamps.host < newest().timestamps.host)) {
+            // A clock went backwards, the previous samples don't model it
+            count = 0;
+            last = sample_t{};
+        }
+        if (count == max_samples) {
+            first = (first + 1) % max_samples;
+            count--;
+        }
+        entries[(first + count) % max_samples] = {timestamps, local};
+        count++;
+    }
+
+    uint64_t estimate(std::chrono::steady_clock::time_point now,
+                      uint64_t sample_t::*clock) const {
+        const entry_t &base = newest();
+        double elapsed = std::chrono::duration<double, std::nano>(
+                             now - base.local)
+                             .count();
+        double drift = 1.0;
+        if (count > 1 && base.local > oldest().local) {
+            drift = static_cast<double>(base.timestamps.*clock -
+                                        oldest().timestamps.*clock) /
+                    std::chrono::duration<double, std::nano>(
+                        base.local - oldest().local)
+                        .count();
+        }
+        return base.timestamps.*clock +
+               static_cast<uint64_t>(std::max(0.0, elapsed * drift));
+    }
+
+    const std::chrono::nanoseconds period;
+    mutable std::mutex mutex;
+    std::array<entry_t, max_samples> entries;
+    size_t first = 0;
+    size_t count = 0;
+    sample_t last;
+    uint64_t sample_count = 0;
+};
+
+} // namespace ur
+
+#endif // UR_CLOCK_CALIBRATION_HPP
@@ -0,0 +1,84 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_DEFERRED_FREES_HPP
+#define UR_DEFERRED_FREES_HPP 1
+
+#include "ur_api.h"
+
+#include <list>
+#include <mutex>
+#include <vector>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// The USM frees of a context waiting for the commands which may use the
+/// memory to complete, so that urUSMFree doesn't have to wait for them.
+/// A free is recorded along with the markers of the commands submitted
+/// before it, native events recorded on the streams of the queues of the
+/// context, the memory being freed once all of them have completed.
+template <typename M> class deferred_frees_t {
+  public:
+    /// Frees ptr once all the markers have completed
+    void defer(void *ptr, std::vector<M> &&markers) {
+        std::lock_guard<std::mutex> lock(mutex);
+        frees.push_back(free_t{ptr, std::move(markers)});
+    }
+
+    /// Frees the memory of the frees whose markers have all completed,
+    /// is_done(marker) telling whether a marker has, with free_fn(ptr).
+    /// The completed markers are handed back to retire_fn(marker). Returns
+    /// the last error of free_fn, the memory being freed outside of the
+    /// lock.
+    template <typename D, typename R, typename F>
+    ur_result_t reclaim(D &&is_done, R &&retire_fn, F &&free_fn) {
+        std::vector<void *> ready;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto it = frees.begin(); it != frees.end();) {
+                auto &markers = it->markers;
+                while (!markers.empty() && is_done(markers.back())) {
+                    retire_fn(markers.back());
+                    markers.pop_back();
+                }
+                if (!markers.empty()) {
+                    ++it;
+                    continue;
+                }
+                ready.push_back(it->ptr);
+                it = frees.erase(it);
+            }
+        }
+
+        ur_result_t result = UR_RESULT_SUCCESS;
+        for (void *ptr : ready) {
+            ur_result_t free_result = free_fn(ptr);
+            if (free_result != UR_RESULT_SUCCESS) {
+                result = free_result;
+            }
+        }
+        return result;
+    }
+
+  private:
+    struct free_t {
+        void *ptr;
+        std::vector<M> markers;
+    };
+
+    std::mutex mutex;
+    // The pending frees, in the order of the urUSMFree calls
+    std::list<free_t> frees;
+};
+
+} // namespace ur
+
+#endif // UR_DEFERRED_FREES_HPP
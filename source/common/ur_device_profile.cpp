@@ -0,0 +1,178 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#include "ur_device_profile.hpp"
+#include "logger/ur_logger.hpp"
+#include "ur_util.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+namespace ur {
+
+// The keys of the values of a profile, in the order they are written
+static const struct {
+    const char *Key;
+    double device_profile_t::*Value;
+} ProfileKeys[] = {
+    {"launch_latency_us", &device_profile_t::LaunchLatencyUs},
+    {"h2d_gbps", &device_profile_t::HostToDeviceGBps},
+    {"d2h_gbps", &device_profile_t::DeviceToHostGBps},
+    {"d2d_gbps", &device_profile_t::DeviceToDeviceGBps},
+    {"fill_gbps", &device_profile_t::FillGBps},
+    {"host_copy_gbps", &device_profile_t::HostCopyGBps},
+    {"alloc_latency_us", &device_profile_t::AllocLatencyUs},
+};
+
+// 1 GB/s is 1000 bytes per microsecond
+size_t device_profile_t::hostCopyThreshold() const {
+    return static_cast<size_t>(LaunchLatencyUs * HostCopyGBps * 1000);
+}
+
+size_t device_profile_t::splitTransferThreshold() const {
+    double GBps = std::max(HostToDeviceGBps, DeviceToHostGBps);
+    return static_cast<size_t>(64 * LaunchLatencyUs * GBps * 1000);
+}
+
+std::string device_profile_t::serialize() const {
+    std::ostringstream Out;
+    Out << "# written by urinfo --characterize\n";
+    for (auto &Key : ProfileKeys) {
+        Out << Key.Key << " " << this->*Key.Value << "\n";
+    }
+    return Out.str();
+}
+
+std::optional<device_profile_t>
+device_profile_t::parse(const std::string &Text) {
+    device_profile_t Profile;
+    std::istringstream In(Text);
+    std::string Line;
+    while (std::getline(In, Line)) {
+        if (Line.empty() || Line[0] == '#') {
+            continue;
+        }
+        std::istringstream Fields(Line);
+        std::string Key;
+        double Value = 0;
+        if (!(Fields >> Key >> Value) || Value < 0) {
+            return std::nullopt;
+        }
+        for (auto &Known : ProfileKeys) {
+            if (Key == Known.Key) {
+                Profile.*Known.Value = Value;
+            }
+        }
+    }
+    return Profile;
+}
+
+static const char *backendName(ur_adapter_backend_t Backend) {
+    switch (Backend) {
+    case UR_ADAPTER_BACKEND_LEVEL_ZERO:
+        return "level_zero";
+    case UR_ADAPTER_BACKEND_OPENCL:
+        return "opencl";
+    case UR_ADAPTER_BACKEND_CUDA:
+        return "cuda";
+    case UR_ADAPTER_BACKEND_HIP:
+        return "hip";
+    case UR_ADAPTER_BACKEND_NATIVE_CPU:
+        return "native_cpu";
+    default:
+        return "unknown";
+    }
+}
+
+std::string deviceProfileName(ur_adapter_backend_t Backend, uint32_t VendorId,
+                              uint32_t DeviceId,
+                              const std::string &DriverVersion) {
+    char Ids[32];
+    snprintf(Ids, sizeof(Ids), "_%04x_%04x_", VendorId, DeviceId);
+    std::string Name = std::string(backendName(Backend)) + Ids;
+    for (char C : DriverVersion) {
+        Name += std::isalnum(static_cast<unsigned char>(C)) || C == '.' ||
+                        C == '-'
+                    ? C
+                    : '_';
+    }
+    return Name + ".profile";
+}
+
+std::optional<filesystem::path> deviceProfileDir() {
+    auto Dir = ur_getenv("UR_DEVICE_PROFILE_DIR");
+    if (!Dir || Dir->empty()) {
+        return std::nullopt;
+    }
+    return filesystem::path(*Dir);
+}
+
+std::optional<device_profile_t> loadDeviceProfile(const std::string &Name) {
+    auto Dir = deviceProfileDir();
+    if (!Dir) {
+        return std::nullopt;
+    }
+    auto Path = *Dir / Name;
+    std::ifstream File(Path);
+    if (!File) {
+        logger::debug("device profile {} not found", Path.string());
+        return std::nullopt;
+    }
+    std::ostringstream Text;
+    Text << File.rdbuf();
+    auto Profile = device_profile_t::parse(Text.str());
+    if (!Profile) {
+        logger::warning("device profile {} is malformed", Path.string());
+        return std::nullopt;
+    }
+    logger::info("using device profile {}", Path.string());
+    return Profile;
+}
+
+bool storeDeviceProfile(const std::string &Name,
+                        const device_profile_t &Profile) {
+    auto Dir = deviceProfileDir();
+    if (!Dir || Name.empty()) {
+        return false;
+    }
+    std::error_code Error;
+    filesystem::create_directories(*Dir, Error);
+    if (Error) {
+        logger::warning("can't create {}: {}", Dir->string(), Error.message());
+        return false;
+    }
+
+    // Adapters may be loading the profile meanwhile
+    auto TmpPath =
+        *Dir / (Name + ".tmp." + std::to_string(std::random_device{}()));
+    {
+        std::ofstream File(TmpPath, std::ios::trunc);
+        File << Profile.serialize();
+        if (!File) {
+            logger::warning("can't write {}", TmpPath.string());
+            filesystem::remove(TmpPath, Error);
+            return false;
+        }
+    }
+    filesystem::rename(TmpPath, *Dir / Name, Error);
+    if (Error) {
+        logger::warning("can't rename {}: {}", TmpPath.string(),
+                        Error.message());
+        filesystem::remove(TmpPath, Error);
+        return false;
+    }
+    return true;
+}
+
+} // namespace ur
@@ -0,0 +1,119 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_DEVICE_PROFILE_HPP
+#define UR_DEVICE_PROFILE_HPP 1
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+
+#include "ur_api.h"
+#include "ur_filesystem_resolved.hpp"
+
+namespace ur {
+
+// The measured characteristics of a device, written by urinfo --characterize
+// to the directory named by UR_DEVICE_PROFILE_DIR. The adapters load the
+// profile of their devices to derive the thresholds which aren't set by their
+// environment variables. Unmeasured values are 0.
+struct device_profile_t {
+    // From submitting a command which does nothing to its completion
+    double LaunchLatencyUs = 0;
+    double HostToDeviceGBps = 0;
+    double DeviceToHostGBps = 0;
+    double DeviceToDeviceGBps = 0;
+    double FillGBps = 0;
+    // memcpy by the host between host allocations
+    double HostCopyGBps = 0;
+    // Of a device allocation and its free
+    double AllocLatencyUs = 0;
+
+    // The bytes the host copies in LaunchLatencyUs, below which a copy
+    // between host-accessible memory is faster on the host, 0 if unknown
+    size_t hostCopyThreshold() const;
+
+    // The size from which a transfer takes 64 times LaunchLatencyUs, the
+    // submissions of its parts being negligible when splitting it across
+    // engines, 0 if unknown
+    size_t splitTransferThreshold() const;
+
+    // One "key value" line per value, lines starting with # are comments
+    std::string serialize() const;
+    // Unknown keys are skipped so that older adapters read newer profiles,
+    // returns std::nullopt if Text is malformed
+    static std::optional<device_profile_t> parse(const std::string &Text);
+};
+
+// The file name of the profile of a device, its driver version only keeping
+// the characters which are valid in file names
+std::string deviceProfileName(ur_adapter_backend_t Backend, uint32_t VendorId,
+                              uint32_t DeviceId,
+                              const std::string &DriverVersion);
+
+// UR_DEVICE_PROFILE_DIR, std::nullopt if it isn't set
+std::optional<filesystem::path> deviceProfileDir();
+
+// The profile of Name in deviceProfileDir(), std::nullopt if there is none
+std::optional<device_profile_t> loadDeviceProfile(const std::string &Name);
+
+// Writes the profile of Name to deviceProfileDir(), through a temporary file
+// renamed into place for concurrent readers. Returns false on errors.
+bool storeDeviceProfile(const std::string &Name,
+                        const device_profile_t &Profile);
+
+// The file name of the profile of hDevice, queried with GetInfo, a
+// urDeviceGetInfo, so that urinfo and the adapters agree on it. Returns an
+// empty string if a query fails.
+template <typename DeviceT, typename GetInfoT>
+std::string deviceProfileName(ur_adapter_backend_t Backend, DeviceT hDevice,
+                              GetInfoT &&GetInfo) {
+    uint32_t VendorId = 0;
+    uint32_t DeviceId = 0;
+    size_t VersionSize = 0;
+    if (GetInfo(hDevice, UR_DEVICE_INFO_VENDOR_ID, sizeof(VendorId),
+                &VendorId, nullptr) != UR_RESULT_SUCCESS ||
+        GetInfo(hDevice, UR_DEVICE_INFO_DEVICE_ID, sizeof(DeviceId),
+                &DeviceId, nullptr) != UR_RESULT_SUCCESS ||
+        GetInfo(hDevice, UR_DEVICE_INFO_DRIVER_VERSION, 0, nullptr,
+                &VersionSize) != UR_RESULT_SUCCESS ||
+        VersionSize == 0) {
+        return {};
+    }
+    std::string Version(VersionSize, '\0');
+    if (GetInfo(hDevice, UR_DEVICE_INFO_DRIVER_VERSION, VersionSize,
+                Version.data(), nullptr) != UR_RESULT_SUCCESS) {
+        return {};
+    }
+    Version.resize(std::strlen(Version.c_str()));
+    return deviceProfileName(Backend, VendorId, DeviceId, Version);
+}
+
+// The profile of hDevice, std::nullopt if profiles are disabled or there is
+// none for its device and driver version
+template <typename DeviceT, typename GetInfoT>
+std::optional<device_profile_t> loadDeviceProfile(ur_adapter_backend_t Backend,
+                                                  DeviceT hDevice,
+                                                  GetInfoT &&GetInfo) {
+    if (!deviceProfileDir()) {
+        return std::nullopt;
+    }
+    auto Name = deviceProfileName(Backend, hDevice, GetInfo);
+    if (Name.empty()) {
+        return std::nullopt;
+    }
+    return loadDeviceProfile(Name);
+}
+
+} // namespace ur
+
+#endif /* UR_DEVICE_PROFILE_HPP */
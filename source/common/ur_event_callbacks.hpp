@@ -0,0 +1,237 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_EVENT_CALLBACKS_HPP
+#define UR_EVENT_CALLBACKS_HPP 1
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ur_api.h>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// The callbacks of urEventSetCallback of the events of an adapter, run by
+/// a single thread which polls all the pending events with the non-blocking
+/// status query of the adapter. Each sweep over the pending events runs
+/// the callbacks of all those which reached their status, and the sweeps
+/// back off from min_poll_interval up to max_poll_interval while none do,
+/// so the thread costs little with thousands of pending callbacks or with
+/// none.
+///
+/// The callbacks of the events which already reached their status run
+/// right away on the calling thread, and urEventWait runs those of the
+/// events it waited for with flush, so they have run once it returns.
+///
+/// The thread is started by the first pending callback. The dispatcher
+/// holds a reference to the events until their callbacks have run. The
+/// callbacks still pending when it's destroyed, usually at the teardown of
+/// the adapter, are dropped with their references.
+class event_callback_dispatcher_t {
+  public:
+    static constexpr std::chrono::microseconds min_poll_interval{10};
+    static constexpr std::chrono::microseconds max_poll_interval{1000};
+
+    /// Returns the execution status of the event, without blocking
+    using query_fn_t = std::function<ur_event_status_t(ur_event_handle_t)>;
+    /// Retains or releases the event
+    using reference_fn_t = std::function<void(ur_event_handle_t)>;
+
+    /// A query_fn_t with the urEventGetInfo of an adapter. An event whose
+    /// status can't be queried, e.g. after a device failure, counts as
+    /// completed, so its callbacks don't wait forever
+    template <class GetInfo> static query_fn_t statusQuery(GetInfo get_info) {
+        return [get_info](ur_event_handle_t event) {
+            ur_event_status_t status = UR_EVENT_STATUS_QUEUED;
+            try {
+                if (get_info(event, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                             sizeof(status), &status,
+                             nullptr) != UR_RESULT_SUCCESS ||
+                    status == UR_EVENT_STATUS_ERROR) {
+                    return UR_EVENT_STATUS_COMPLETE;
+                }
+            } catch (...) {
+                return UR_EVENT_STATUS_COMPLETE;
+            }
+            return status;
+        };
+    }
+
+    event_callback_dispatcher_t(query_fn_t query, reference_fn_t retain,
+                                reference_fn_t release)
+        : query(std::move(query)), retain(std::move(retain)),
+          release(std::move(release)) {}
+
+    ~event_callback_dispatcher_t() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        added.notify_one();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    event_callback_dispatcher_t(const event_callback_dispatcher_t &) = delete;
+    event_callback_dispatcher_t &
+    operator=(const event_callback_dispatcher_t &) = delete;
+
+    /// Runs callback(event, status, user_data) once the event reaches the
+    /// status, or a later one
+    void add(ur_event_handle_t event, ur_execution_info_t status,
+             ur_event_callback_t callback, void *user_data) {
+        callback_t entry{event, status, callback, user_data};
+        if (reached(entry)) {
+            callback(event, status, user_data);
+            return;
+        }
+        retain(event);
+        num_pending++;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            incoming.push_back(entry);
+            if (!thread.joinable()) {
+                thread = std::thread([this] { run(); });
+            }
+        }
+        added.notify_one();
+    }
+
+    /// Runs the pending callbacks of the events which reached their status
+    /// on the calling thread, after those the thread of the dispatcher is
+    /// running, e.g. once urEventWait waited for the events
+    void flush(uint32_t num_events, const ur_event_handle_t *events) {
+        if (num_pending == 0) {
+            return;
+        }
+        auto waited = [&](const callback_t &entry) {
+            return std::find(events, events + num_events, entry.event) !=
+                   events + num_events;
+        };
+        std::vector<callback_t> flushed;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            // Unless a callback is waiting for events itself
+            if (std::this_thread::get_id() != thread.get_id()) {
+                swept.wait(lock, [&] { return !sweeping; });
+            }
+            for (auto *entries : {&incoming, &pending}) {
+                auto moved = std::stable_partition(
+                    entries->begin(), entries->end(),
+                    [&](const callback_t &entry) { return !waited(entry); });
+                flushed.insert(flushed.end(), moved, entries->end());
+                entries->erase(moved, entries->end());
+            }
+        }
+        dispatch(flushed);
+        if (!flushed.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                incoming.insert(incoming.end(), flushed.begin(),
+                                flushed.end());
+            }
+            added.notify_one();
+        }
+    }
+
+  private:
+    struct callback_t {
+        ur_event_handle_t event;
+        ur_execution_info_t status;
+        ur_event_callback_t callback;
+        void *user_data;
+    };
+
+    bool reached(const callback_t &entry) {
+        // Both statuses go in the same order, from complete to queued
+        return static_cast<uint32_t>(query(entry.event)) <=
+               static_cast<uint32_t>(entry.status);
+    }
+
+    // Runs the callbacks of the entries which reached their status, and
+    // leaves the others in entries
+    void dispatch(std::vector<callback_t> &entries) {
+        auto ready = std::stable_partition(
+            entries.begin(), entries.end(),
+            [&](const callback_t &entry) { return !reached(entry); });
+        for (auto it = ready; it != entries.end(); ++it) {
+            it->callback(it->event, it->status, it->user_data);
+            release(it->event);
+            num_pending--;
+        }
+        entries.erase(ready, entries.end());
+    }
+
+    void run() {
+        std::vector<callback_t> sweep;
+        auto interval = min_poll_interval;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                pending.insert(pending.end(), sweep.begin(), sweep.end());
+                sweep.clear();
+                sweeping = false;
+                swept.notify_all();
+
+                // Waits for new callbacks, and for the next sweep if any is
+                // pending
+                auto wakeup = [&] { return stopping || !incoming.empty(); };
+                if (pending.empty()) {
+                    added.wait(lock, wakeup);
+                } else if (added.wait_for(lock, interval, wakeup)) {
+                    interval = min_poll_interval;
+                }
+                if (stopping) {
+                    break;
+                }
+                pending.insert(pending.end(), incoming.begin(),
+                               incoming.end());
+                incoming.clear();
+                sweep.swap(pending);
+                sweeping = true;
+            }
+
+            // The callbacks run without the lock, they may add others
+            size_t count = sweep.size();
+            dispatch(sweep);
+            interval = sweep.size() == count
+                           ? std::min(interval * 2, max_poll_interval)
+                           : min_poll_interval;
+        }
+    }
+
+    query_fn_t query;
+    reference_fn_t retain;
+    reference_fn_t release;
+
+    std::atomic<size_t> num_pending = 0;
+    std::mutex mutex;
+    std::condition_variable added;
+    std::condition_variable swept;
+    std::vector<callback_t> incoming;
+    std::vector<callback_t> pending;
+    // Whether the thread is sweeping, with the callbacks it sweeps out of
+    // pending
+    bool sweeping = false;
+    bool stopping = false;
+    std::thread thread;
+};
+
+} // namespace ur
+
+#endif /* UR_EVENT_CALLBACKS_HPP */
@@ -0,0 +1,288 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef USM_HOST_MEMORY_HPP
+#define USM_HOST_MEMORY_HPP 1
+
+#include "logger/ur_logger.hpp"
+#include "ur_api.h"
+
+#include <cctype>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#endif
+
+namespace usm {
+
+/// @brief Placement of the host memory of a USM pool, requested through
+/// ur_exp_usm_host_pool_desc_t.
+///
+/// Memory with a non-default placement is allocated with hostMemoryMap and
+/// registered with the driver by the memory provider of the adapter, instead
+/// of being allocated by the driver.
+struct host_memory_config_t {
+    /// Size of the pages backing the memory, 0 for the system default
+    size_t pageSize = 0;
+    /// NUMA node the memory is placed on, -1 if it isn't bound to any
+    int numaNode = -1;
+
+    bool isDefault() const { return pageSize == 0 && numaNode < 0; }
+};
+
+namespace detail {
+#if !defined(_WIN32)
+inline size_t systemPageSize() {
+    static const size_t pageSize = sysconf(_SC_PAGESIZE);
+    return pageSize;
+}
+
+/// Size of the transparent huge pages, 0 if they are disabled
+inline size_t transparentHugePageSize() {
+    static const size_t pageSize = [] {
+        std::ifstream enabled("/sys/kernel/mm/transparent_hugepage/enabled");
+        std::string mode;
+        std::getline(enabled, mode);
+        if (mode.empty() || mode.find("[never]") != std::string::npos) {
+            return size_t{0};
+        }
+        std::ifstream size(
+            "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+        size_t bytes = 0;
+        size >> bytes;
+        return bytes;
+    }();
+    return pageSize;
+}
+
+/// Whether the kernel provides hugetlb pages of pageSize, they may still have
+/// to be reserved by the administrator
+inline bool hasHugeTlbPages(size_t pageSize) {
+    std::string path = "/sys/kernel/mm/hugepages/hugepages-" +
+                       std::to_string(pageSize / 1024) + "kB";
+    struct stat info;
+    return stat(path.c_str(), &info) == 0;
+}
+
+/// Maps size bytes aligned to alignment, the memory isn't populated
+inline void *mapAligned(size_t size, size_t alignment) {
+    void *mapped = mmap(nullptr, size + alignment, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) {
+        return nullptr;
+    }
+
+    auto begin = reinterpret_cast<uintptr_t>(mapped);
+    auto aligned = (begin + alignment - 1) & ~(alignment - 1);
+    if (aligned != begin) {
+        munmap(mapped, aligned - begin);
+    }
+    munmap(reinterpret_cast<void *>(aligned + size),
+           begin + alignment - aligned);
+    return reinterpret_cast<void *>(aligned);
+}
+
+/// Makes node the preferred NUMA node of the pages of [ptr, ptr + size), a
+/// strict binding would make allocations fail when the node is out of memory
+/// instead of taking the pages from another node.
+inline bool bindToNumaNode(void *ptr, size_t size, int node) {
+    constexpr int preferredPolicy = 1; // MPOL_PREFERRED
+    constexpr size_t bitsPerWord = sizeof(unsigned long) * CHAR_BIT;
+
+    std::vector<unsigned long> mask(node / bitsPerWord + 1);
+    mask[node / bitsPerWord] = 1UL << (node % bitsPerWord);
+    // The kernel reads one bit less than maxnode
+    return syscall(SYS_mbind, ptr, size, preferredPolicy, mask.data(),
+                   mask.size() * bitsPerWord + 1, 0) == 0;
+}
+#endif
+} // namespace detail
+
+/// @brief Returns the NUMA node of the PCI device at address, in the format
+/// of UR_DEVICE_INFO_PCI_ADDRESS, or -1 if the system has a single node or
+/// the node can't be found.
+inline int numaNodeOfPciAddress(std::string address) {
+#if defined(_WIN32)
+    std::ignore = address;
+    return -1;
+#else
+    for (auto &c : address) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    std::ifstream file("/sys/bus/pci/devices/" + address + "/numa_node");
+    int node = -1;
+    file >> node;
+    return file ? node : -1;
+#endif
+}
+
+/// @brief Whether the memory of config can be provided by this system
+inline bool isHostMemoryConfigSupported(const host_memory_config_t &config) {
+#if defined(_WIN32)
+    return config.isDefault();
+#else
+    return config.pageSize == 0 ||
+           config.pageSize == detail::systemPageSize() ||
+           config.pageSize == detail::transparentHugePageSize() ||
+           detail::hasHugeTlbPages(config.pageSize);
+#endif
+}
+
+/// @brief Returns the address of hDevice, as returned by
+/// UR_DEVICE_INFO_PCI_ADDRESS, or an empty string if it's unknown.
+template <typename DeviceGetInfo>
+std::string getPciAddress(ur_device_handle_t hDevice,
+                          DeviceGetInfo deviceGetInfo) {
+    size_t size = 0;
+    if (deviceGetInfo(hDevice, UR_DEVICE_INFO_PCI_ADDRESS, 0, nullptr,
+                      &size) != UR_RESULT_SUCCESS ||
+        size == 0) {
+        return {};
+    }
+
+    std::string address(size, '\0');
+    if (deviceGetInfo(hDevice, UR_DEVICE_INFO_PCI_ADDRESS, size,
+                      address.data(), nullptr) != UR_RESULT_SUCCESS) {
+        return {};
+    }
+    address.resize(std::strlen(address.c_str()));
+    return address;
+}
+
+/// @brief Returns the placement requested by desc for the host memory of a
+/// pool shared by devices.
+///
+/// The memory is placed on the NUMA node of the first device with a known
+/// node. deviceGetInfo is the urDeviceGetInfo of the adapter owning devices.
+template <typename Devices, typename DeviceGetInfo>
+std::pair<ur_result_t, host_memory_config_t>
+makeHostMemoryConfig(const ur_exp_usm_host_pool_desc_t &desc,
+                     const Devices &devices, DeviceGetInfo deviceGetInfo) {
+    if (desc.flags & UR_EXP_USM_HOST_POOL_FLAGS_MASK) {
+        return {UR_RESULT_ERROR_INVALID_ENUMERATION, {}};
+    }
+    if (desc.pageSize & (desc.pageSize - 1)) {
+        return {UR_RESULT_ERROR_INVALID_VALUE, {}};
+    }
+
+    host_memory_config_t config;
+    config.pageSize = desc.pageSize;
+
+    if (desc.flags & UR_EXP_USM_HOST_POOL_FLAG_NUMA_LOCAL) {
+        for (auto &device : devices) {
+            std::string address = getPciAddress(device, deviceGetInfo);
+            if (address.empty()) {
+                logger::error("unable to find the NUMA node of device {}",
+                              device);
+                return {UR_RESULT_ERROR_UNSUPPORTED_FEATURE, {}};
+            }
+            config.numaNode = numaNodeOfPciAddress(address);
+            if (config.numaNode >= 0) {
+                break;
+            }
+        }
+    }
+
+    if (!isHostMemoryConfigSupported(config)) {
+        logger::error("host pages of {} bytes are not supported",
+                      config.pageSize);
+        return {UR_RESULT_ERROR_UNSUPPORTED_FEATURE, {}};
+    }
+
+    return {UR_RESULT_SUCCESS, config};
+}
+
+/// @brief Returns the size of the pages backing the memory of config
+inline size_t hostMemoryPageSize(const host_memory_config_t &config) {
+#if defined(_WIN32)
+    return config.pageSize ? config.pageSize : 4096;
+#else
+    return config.pageSize ? config.pageSize : detail::systemPageSize();
+#endif
+}
+
+/// @brief Rounds size up to the page size of config
+inline size_t hostMemoryRoundUp(size_t size,
+                                const host_memory_config_t &config) {
+    size_t pageSize = hostMemoryPageSize(config);
+    return (size + pageSize - 1) & ~(pageSize - 1);
+}
+
+/// @brief Maps size bytes of host memory placed following config, size must
+/// be a multiple of its page size. Returns nullptr on failure.
+///
+/// Huge pages are taken from the hugetlb pool reserved by the administrator
+/// if there is one, or else from transparent huge pages of the same size.
+inline void *hostMemoryMap(size_t size, const host_memory_config_t &config) {
+#if defined(_WIN32)
+    std::ignore = size;
+    std::ignore = config;
+    return nullptr;
+#else
+    void *ptr = nullptr;
+    size_t pageSize = config.pageSize;
+    if (pageSize == 0 || pageSize == detail::systemPageSize()) {
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        ptr = ptr == MAP_FAILED ? nullptr : ptr;
+    } else {
+        int pageShift = __builtin_ctzll(pageSize);
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                       (pageShift << MAP_HUGE_SHIFT),
+                   -1, 0);
+        ptr = ptr == MAP_FAILED ? nullptr : ptr;
+        if (!ptr && pageSize == detail::transparentHugePageSize()) {
+            ptr = detail::mapAligned(size, pageSize);
+            if (ptr) {
+                madvise(ptr, size, MADV_HUGEPAGE);
+            }
+        }
+    }
+
+    // The pages are only allocated when the memory is first touched, so the
+    // policy applies to all of them
+    if (ptr && config.numaNode >= 0 &&
+        !detail::bindToNumaNode(ptr, size, config.numaNode)) {
+        logger::warning("unable to bind host memory to NUMA node {}",
+                        config.numaNode);
+    }
+    return ptr;
+#endif
+}
+
+/// @brief Unmaps memory returned by hostMemoryMap
+inline void hostMemoryUnmap(void *ptr, size_t size) {
+#if defined(_WIN32)
+    std::ignore = ptr;
+    std::ignore = size;
+#else
+    munmap(ptr, size);
+#endif
+}
+
+} // namespace usm
+
+#endif /* USM_HOST_MEMORY_HPP */
@@ -0,0 +1,146 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_HOST_REGISTER_CACHE_HPP
+#define UR_HOST_REGISTER_CACHE_HPP 1
+
+#include "ur_api.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// The host ranges of a context registered with the driver, for the
+/// buffers created with UR_MEM_FLAG_USE_HOST_POINTER. The buffers wrapping
+/// the same host memory share the registration of the range containing it
+/// rather than pinning its pages again.
+///
+/// A range is unregistered once its last buffer is released, unless
+/// max_unused allows it to stay registered for the next buffers wrapping
+/// it, the least recently used one being unregistered past max_unused
+/// unused ranges. This is only safe for memory which isn't freed before the
+/// context is released.
+class host_register_cache_t {
+  public:
+    explicit host_register_cache_t(size_t max_unused)
+        : max_unused(max_unused) {}
+
+    /// Counts a reference to the registered range containing
+    /// [ptr, ptr + size), registering [ptr, ptr + size) with
+    /// register_fn(ptr, size) if there is none. The unused ranges
+    /// overlapping it are unregistered first with unregister_fn(ptr), as
+    /// the driver doesn't register a page twice.
+    template <typename R, typename U>
+    ur_result_t acquire(void *ptr, size_t size, R &&register_fn,
+                        U &&unregister_fn) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto start = reinterpret_cast<uintptr_t>(ptr);
+        auto it = find(start, size);
+        if (it != ranges.end()) {
+            if (it->second.ref_count++ == 0) {
+                unused.erase(it->second.unused_pos);
+            }
+            return UR_RESULT_SUCCESS;
+        }
+
+        for (auto u = unused.begin(); u != unused.end();) {
+            auto range = ranges.find(*u);
+            if (range->first >= start + size ||
+                range->first + range->second.size <= start) {
+                ++u;
+                continue;
+            }
+            unregister_fn(reinterpret_cast<void *>(range->first));
+            ranges.erase(range);
+            u = unused.erase(u);
+        }
+
+        ur_result_t result = register_fn(ptr, size);
+        if (result == UR_RESULT_SUCCESS) {
+            ranges.insert_or_assign(start, range_t{size, 1, {}});
+        }
+        return result;
+    }
+
+    /// Drops the reference to the registered range containing ptr taken by
+    /// acquire, the last one keeping the range registered if max_unused
+    /// allows it. Memory which wasn't registered by acquire is unregistered
+    /// with unregister_fn(ptr) as is.
+    template <typename U> ur_result_t release(void *ptr, U &&unregister_fn) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = find(reinterpret_cast<uintptr_t>(ptr), 1);
+        if (it == ranges.end()) {
+            return unregister_fn(ptr);
+        }
+        if (it->second.ref_count == 0 || --it->second.ref_count != 0) {
+            return UR_RESULT_SUCCESS;
+        }
+        if (max_unused) {
+            it->second.unused_pos = unused.insert(unused.end(), it->first);
+            if (unused.size() <= max_unused) {
+                return UR_RESULT_SUCCESS;
+            }
+            it = ranges.find(unused.front());
+            unused.pop_front();
+        }
+        ur_result_t result =
+            unregister_fn(reinterpret_cast<void *>(it->first));
+        ranges.erase(it);
+        return result;
+    }
+
+    /// Unregisters the unused ranges with unregister_fn(ptr)
+    template <typename U> void clear(U &&unregister_fn) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto start : unused) {
+            unregister_fn(reinterpret_cast<void *>(start));
+            ranges.erase(start);
+        }
+        unused.clear();
+    }
+
+  private:
+    struct range_t {
+        size_t size;
+        uint32_t ref_count;
+        // The position in unused if ref_count is 0
+        std::list<uintptr_t>::iterator unused_pos;
+    };
+
+    // Finds the range containing [start, start + size)
+    std::map<uintptr_t, range_t>::iterator find(uintptr_t start,
+                                                size_t size) {
+        auto it = ranges.upper_bound(start);
+        if (it == ranges.begin()) {
+            return ranges.end();
+        }
+        --it;
+        if (start + size > it->first + it->second.size) {
+            return ranges.end();
+        }
+        return it;
+    }
+
+    std::mutex mutex;
+    // The registered ranges by start, and the unused ones, least recently
+    // used first
+    std::map<uintptr_t, range_t> ranges;
+    std::list<uintptr_t> unused;
+    const size_t max_unused;
+};
+
+} // namespace ur
+
+#endif // UR_HOST_REGISTER_CACHE_HPP
@@ -0,0 +1,104 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_LOCAL_SIZE_CACHE_HPP
+#define UR_LOCAL_SIZE_CACHE_HPP 1
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// The local sizes guessed for the launches of a kernel which don't give
+/// one. A guess comes from the occupancy of the kernel, which depends on the
+/// dynamic local memory of the launch, rounded to factors of its global
+/// size, so launches with the same work dimensions, local memory and global
+/// size reuse the guess of the first one.
+///
+/// Only the last max_entries guesses are kept, a kernel is usually launched
+/// with a few distinct global sizes.
+class local_size_cache_t {
+  public:
+    static constexpr size_t max_entries = 8;
+
+    /// Copies the local size guessed for the launch into local_size and
+    /// returns true, or returns false if there is no such guess
+    bool find(uint32_t work_dim, size_t local_mem_size,
+              const size_t *global_size, size_t *local_size) {
+        key_t key = makeKey(work_dim, local_mem_size, global_size);
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 0; i < count; i++) {
+            if (entries[i].key == key) {
+                std::memcpy(local_size, entries[i].local_size,
+                            sizeof(entries[i].local_size));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Keeps the local size guessed for the launch, replacing the oldest
+    /// guess when the cache is full
+    void insert(uint32_t work_dim, size_t local_mem_size,
+                const size_t *global_size, const size_t *local_size) {
+        key_t key = makeKey(work_dim, local_mem_size, global_size);
+        std::lock_guard<std::mutex> lock(mutex);
+        entry_t &entry = entries[next];
+        entry.key = key;
+        std::memcpy(entry.local_size, local_size, sizeof(entry.local_size));
+        next = (next + 1) % max_entries;
+        if (count < max_entries) {
+            count++;
+        }
+    }
+
+  private:
+    struct key_t {
+        uint32_t work_dim;
+        size_t local_mem_size;
+        // The dimensions past work_dim are 1
+        size_t global_size[3];
+
+        bool operator==(const key_t &other) const {
+            return work_dim == other.work_dim &&
+                   local_mem_size == other.local_mem_size &&
+                   global_size[0] == other.global_size[0] &&
+                   global_size[1] == other.global_size[1] &&
+                   global_size[2] == other.global_size[2];
+        }
+    };
+
+    struct entry_t {
+        key_t key;
+        size_t local_size[3];
+    };
+
+    static key_t makeKey(uint32_t work_dim, size_t local_mem_size,
+                         const size_t *global_size) {
+        key_t key = {work_dim, local_mem_size, {1, 1, 1}};
+        for (uint32_t i = 0; i < work_dim && i < 3; i++) {
+            key.global_size[i] = global_size[i];
+        }
+        return key;
+    }
+
+    std::mutex mutex;
+    std::array<entry_t, max_entries> entries;
+    size_t count = 0;
+    size_t next = 0;
+};
+
+} // namespace ur
+
+#endif // UR_LOCAL_SIZE_CACHE_HPP
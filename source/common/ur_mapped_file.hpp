@@ -0,0 +1,62 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_MAPPED_FILE_HPP
+#define UR_MAPPED_FILE_HPP 1
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "ur_filesystem_resolved.hpp"
+
+namespace ur {
+
+// A read-only mapping of a whole file, its pages are only read from the file
+// once they are accessed and they can be shared with the other processes
+// mapping the file. The mapping stays valid if the file is removed or
+// replaced (where the OS allows it).
+class mapped_file_t {
+  public:
+    mapped_file_t() = default;
+    mapped_file_t(const mapped_file_t &) = delete;
+    mapped_file_t &operator=(const mapped_file_t &) = delete;
+    mapped_file_t(mapped_file_t &&Other) noexcept { *this = std::move(Other); }
+    mapped_file_t &operator=(mapped_file_t &&Other) noexcept {
+        if (this != &Other) {
+            reset();
+            Data = Other.Data;
+            Size = Other.Size;
+            Other.Data = nullptr;
+            Other.Size = 0;
+        }
+        return *this;
+    }
+    ~mapped_file_t() { reset(); }
+
+    // Maps the file at Path, returns false if it can't be mapped, e.g. if it
+    // doesn't exist or is empty.
+    bool map(const filesystem::path &Path);
+
+    // Unmaps the file
+    void reset();
+
+    const uint8_t *data() const { return Data; }
+    size_t size() const { return Size; }
+    explicit operator bool() const { return Data != nullptr; }
+
+  private:
+    const uint8_t *Data = nullptr;
+    size_t Size = 0;
+};
+
+} // namespace ur
+
+#endif /* UR_MAPPED_FILE_HPP */
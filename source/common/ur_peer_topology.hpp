@@ -0,0 +1,205 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_PEER_TOPOLOGY_HPP
+#define UR_PEER_TOPOLOGY_HPP 1
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include <ur_api.h>
+
+namespace ur {
+
+/// A link between two devices, the answers of the link queries of
+/// urUsmP2PPeerAccessGetInfoExp
+struct peer_link_t {
+    ur_exp_peer_link_type_t type = UR_EXP_PEER_LINK_TYPE_NONE;
+    /// In MB/s, 0 if unknown
+    uint64_t bandwidth = 0;
+    uint32_t hops = 0;
+};
+
+/// The answers of the copy route queries of urUsmP2PPeerAccessGetInfoExp
+struct peer_route_t {
+    ur_exp_peer_copy_route_t route = UR_EXP_PEER_COPY_ROUTE_HOST;
+    ur_device_handle_t intermediate = nullptr;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// The links between the devices of a platform, each queried from the
+/// driver the first time it is needed, and the routes of copies over them.
+///
+/// Copies between two linked devices go over their link, unless staging
+/// them through a third device linked to both has more than twice the
+/// bandwidth, which pays for copying twice. Copies between two devices
+/// which aren't linked are staged through the device with the fastest
+/// device interconnect links to both, or through the host when there is
+/// none.
+class peer_topology_t {
+  public:
+    /// Copies the link from src to dst to link. query(src, dst, link)
+    /// queries it from the driver the first time
+    template <typename QueryFn>
+    ur_result_t getLink(ur_device_handle_t src, ur_device_handle_t dst,
+                        peer_link_t &link, QueryFn &&query) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return getLinkLocked(src, dst, link, query);
+    }
+
+    /// Finds the route of copies from src to dst through the devices of the
+    /// range devices, which holds device handles or unique_ptrs to them
+    template <typename Devices, typename QueryFn>
+    ur_result_t getRoute(ur_device_handle_t src, ur_device_handle_t dst,
+                         const Devices &devices, peer_route_t &route,
+                         QueryFn &&query) {
+        route = peer_route_t{};
+        if (src == dst) {
+            route.route = UR_EXP_PEER_COPY_ROUTE_DIRECT;
+            return UR_RESULT_SUCCESS;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        peer_link_t direct;
+        if (auto result = getLinkLocked(src, dst, direct, query);
+            result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+
+        ur_device_handle_t best = nullptr;
+        uint64_t best_bandwidth = 0;
+        for (const auto &device : devices) {
+            ur_device_handle_t through = &*device;
+            if (through == src || through == dst) {
+                continue;
+            }
+            peer_link_t first, second;
+            if (auto result = getLinkLocked(src, through, first, query);
+                result != UR_RESULT_SUCCESS) {
+                return result;
+            }
+            if (auto result = getLinkLocked(through, dst, second, query);
+                result != UR_RESULT_SUCCESS) {
+                return result;
+            }
+            if (first.type == UR_EXP_PEER_LINK_TYPE_NONE ||
+                second.type == UR_EXP_PEER_LINK_TYPE_NONE) {
+                continue;
+            }
+            // over PCIe, staging through the host is as good
+            if (direct.type == UR_EXP_PEER_LINK_TYPE_NONE &&
+                (first.type != UR_EXP_PEER_LINK_TYPE_FABRIC ||
+                 second.type != UR_EXP_PEER_LINK_TYPE_FABRIC)) {
+                continue;
+            }
+            uint64_t bandwidth = std::min(first.bandwidth, second.bandwidth);
+            if (!best || bandwidth > best_bandwidth) {
+                best = through;
+                best_bandwidth = bandwidth;
+            }
+        }
+
+        if (direct.type != UR_EXP_PEER_LINK_TYPE_NONE) {
+            route.route = UR_EXP_PEER_COPY_ROUTE_DIRECT;
+            if (best && direct.bandwidth &&
+                best_bandwidth / 2 > direct.bandwidth) {
+                route.route = UR_EXP_PEER_COPY_ROUTE_DEVICE;
+                route.intermediate = best;
+            }
+        } else if (best) {
+            route.route = UR_EXP_PEER_COPY_ROUTE_DEVICE;
+            route.intermediate = best;
+        }
+        return UR_RESULT_SUCCESS;
+    }
+
+    /// Answers the link and copy route queries of
+    /// urUsmP2PPeerAccessGetInfoExp, from the command device src to the peer
+    /// device dst, ReturnValue is the UrReturnHelper of the query
+    template <typename Devices, typename QueryFn, typename ReturnHelper>
+    ur_result_t getInfo(ur_exp_peer_info_t prop_name, ur_device_handle_t src,
+                        ur_device_handle_t dst, const Devices &devices,
+                        QueryFn &&query, ReturnHelper &ReturnValue) {
+        switch (prop_name) {
+        case UR_EXP_PEER_INFO_UR_PEER_LINK_TYPE:
+        case UR_EXP_PEER_INFO_UR_PEER_BANDWIDTH:
+        case UR_EXP_PEER_INFO_UR_PEER_HOP_COUNT: {
+            peer_link_t link;
+            if (auto result = getLink(src, dst, link, query);
+                result != UR_RESULT_SUCCESS) {
+                return result;
+            }
+            if (prop_name == UR_EXP_PEER_INFO_UR_PEER_LINK_TYPE) {
+                return ReturnValue(link.type);
+            }
+            if (prop_name == UR_EXP_PEER_INFO_UR_PEER_BANDWIDTH) {
+                return ReturnValue(link.bandwidth);
+            }
+            return ReturnValue(link.hops);
+        }
+        case UR_EXP_PEER_INFO_UR_PEER_COPY_ROUTE:
+        case UR_EXP_PEER_INFO_UR_PEER_COPY_INTERMEDIATE_DEVICE: {
+            peer_route_t route;
+            if (auto result = getRoute(src, dst, devices, route, query);
+                result != UR_RESULT_SUCCESS) {
+                return result;
+            }
+            if (prop_name == UR_EXP_PEER_INFO_UR_PEER_COPY_ROUTE) {
+                return ReturnValue(route.route);
+            }
+            return ReturnValue(route.intermediate);
+        }
+        default:
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    /// Forgets the links from and to device, which are queried again the
+    /// next time they are needed, e.g. after peer access to it changed
+    void invalidate(ur_device_handle_t device) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = links.begin(); it != links.end();) {
+            if (it->first.first == device || it->first.second == device) {
+                it = links.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+  private:
+    template <typename QueryFn>
+    ur_result_t getLinkLocked(ur_device_handle_t src, ur_device_handle_t dst,
+                              peer_link_t &link, QueryFn &query) {
+        auto key = std::make_pair(src, dst);
+        if (auto it = links.find(key); it != links.end()) {
+            link = it->second;
+            return UR_RESULT_SUCCESS;
+        }
+        peer_link_t queried;
+        if (auto result = query(src, dst, queried);
+            result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+        link = links[key] = queried;
+        return UR_RESULT_SUCCESS;
+    }
+
+    std::mutex mutex;
+    std::map<std::pair<ur_device_handle_t, ur_device_handle_t>, peer_link_t>
+        links;
+};
+
+} // namespace ur
+
+#endif // UR_PEER_TOPOLOGY_HPP
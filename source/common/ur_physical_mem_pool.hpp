@@ -0,0 +1,101 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_PHYSICAL_MEM_POOL_HPP
+#define UR_PHYSICAL_MEM_POOL_HPP 1
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// The physical memory of the released physical memory objects of a
+/// context, kept to back the next objects created of the same size on the
+/// same device instead of going to the driver. Mappings are in multiples of
+/// the granularity of the device, so the sizes repeat.
+///
+/// At most max_size bytes are pooled, past which the released memory is
+/// returned to the driver.
+template <typename device_t, typename handle_t> class physical_mem_pool_t {
+  public:
+    explicit physical_mem_pool_t(size_t max_size) : max_size(max_size) {}
+
+    /// Returns memory of size bytes on device from the pool, if there is
+    /// any
+    std::optional<handle_t> acquire(device_t device, size_t size) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = chunks.find({device, size});
+        if (it == chunks.end()) {
+            return std::nullopt;
+        }
+        handle_t handle = it->second.back();
+        it->second.pop_back();
+        if (it->second.empty()) {
+            chunks.erase(it);
+        }
+        pooled_size -= size;
+        return handle;
+    }
+
+    /// Keeps the memory of size bytes on device in the pool, or returns
+    /// false if the pool is full, the caller then frees the memory
+    bool release(device_t device, size_t size, handle_t handle) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pooled_size + size > max_size) {
+            return false;
+        }
+        chunks[{device, size}].push_back(handle);
+        pooled_size += size;
+        return true;
+    }
+
+    /// Frees the pooled memory with free_fn(device, handle) until at most
+    /// bytes_to_keep bytes remain pooled, and returns the number of bytes
+    /// freed
+    template <typename F> size_t trim(size_t bytes_to_keep, F &&free_fn) {
+        std::vector<std::pair<device_t, handle_t>> to_free;
+        size_t released = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto it = chunks.begin();
+                 it != chunks.end() && pooled_size > bytes_to_keep;) {
+                auto &[key, handles] = *it;
+                while (!handles.empty() && pooled_size > bytes_to_keep) {
+                    to_free.emplace_back(key.first, handles.back());
+                    handles.pop_back();
+                    pooled_size -= key.second;
+                    released += key.second;
+                }
+                it = handles.empty() ? chunks.erase(it) : std::next(it);
+            }
+        }
+        // The driver is called without the lock
+        for (auto &[device, handle] : to_free) {
+            free_fn(device, handle);
+        }
+        return released;
+    }
+
+  private:
+    std::mutex mutex;
+    std::map<std::pair<device_t, size_t>, std::vector<handle_t>> chunks;
+    size_t pooled_size = 0;
+    const size_t max_size;
+};
+
+} // namespace ur
+
+#endif // UR_PHYSICAL_MEM_POOL_HPP
@@ -15,6 +15,7 @@
 
 #include "logger/ur_logger.hpp"
 #include "umf_helpers.hpp"
+#include "ur_host_memory.hpp"
 #include "ur_api.h"
 #include "ur_util.hpp"
 
@@ -22,7 +23,9 @@
 #include <umf/memory_provider.h>
 #include <umf/pools/pool_disjoint.h>
 
+#include <array>
 #include <functional>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -57,11 +60,17 @@ struct pool_descriptor {
     ur_usm_type_t type;
     bool deviceReadOnly;
 
+    // Placement of the memory of UR_USM_TYPE_HOST pools. It's a property of
+    // the pool rather than a part of its identity, a pool handle has a single
+    // host pool, so it's neither compared nor hashed.
+    host_memory_config_t hostMemory = {};
+
     bool operator==(const pool_descriptor &other) const;
     friend std::ostream &operator<<(std::ostream &os,
                                     const pool_descriptor &desc);
     static std::pair<ur_result_t, std::vector<pool_descriptor>>
-    create(ur_usm_pool_handle_t poolHandle, ur_context_handle_t hContext);
+    create(ur_usm_pool_handle_t poolHandle, ur_context_handle_t hContext,
+           const ur_exp_usm_host_pool_desc_t *hostPoolDesc = nullptr);
 };
 
 static inline std::pair<ur_result_t, std::vector<ur_device_handle_t>>
@@ -207,9 +216,14 @@ inline std::ostream &operator<<(std::ostream &os, const pool_descriptor &desc) {
 
 inline std::pair<ur_result_t, std::vector<pool_descriptor>>
 pool_descriptor::create(ur_usm_pool_handle_t poolHandle,
-                        ur_context_handle_t hContext) {
+                        ur_context_handle_t hContext,
+                        const ur_exp_usm_host_pool_desc_t *hostPoolDesc) {
+    static detail::ddiTables ddi;
+
+    // Devices which can't be partitioned only have pools of their own
     auto [ret, devices] = urGetAllDevicesAndSubDevices(hContext);
-    if (ret != UR_RESULT_SUCCESS) {
+    if (ret != UR_RESULT_SUCCESS &&
+        ret != UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
         return {ret, {}};
     }
 
@@ -218,6 +232,14 @@ pool_descriptor::create(ur_usm_pool_handle_t poolHandle,
     desc.poolHandle = poolHandle;
     desc.hContext = hContext;
     desc.type = UR_USM_TYPE_HOST;
+    if (hostPoolDesc) {
+        auto [hostRet, hostMemory] = makeHostMemoryConfig(
+            *hostPoolDesc, devices, ddi.deviceDdiTable.pfnGetInfo);
+        if (hostRet != UR_RESULT_SUCCESS) {
+            return {hostRet, {}};
+        }
+        desc.hostMemory = hostMemory;
+    }
 
     for (auto &device : devices) {
         {
@@ -245,8 +267,34 @@ pool_descriptor::create(ur_usm_pool_handle_t poolHandle,
         }
     }
 
-    return {ret, descriptors};
+    return {UR_RESULT_SUCCESS, descriptors};
+}
+
+namespace detail {
+/// Pools of one device, indexed by the kind returned by fastPoolKind
+struct device_pools_t {
+    static constexpr size_t numKinds = 4;
+
+    ur_usm_pool_handle_t poolHandle;
+    ur_device_handle_t hDevice;
+    std::array<umf_memory_pool_handle_t, numKinds> pools;
+};
+
+/// Returns the slot of desc in device_pools_t, or nullopt if desc doesn't
+/// describe one of the pools created by pool_descriptor::create.
+inline std::optional<size_t> fastPoolKind(const pool_descriptor &desc) {
+    switch (desc.type) {
+    case UR_USM_TYPE_HOST:
+        return 0;
+    case UR_USM_TYPE_DEVICE:
+        return 1;
+    case UR_USM_TYPE_SHARED:
+        return isSharedAllocationReadOnlyOnDevice(desc) ? 3 : 2;
+    default:
+        return std::nullopt;
+    }
 }
+} // namespace detail
 
 template <typename D> struct pool_manager {
   private:
@@ -254,6 +302,23 @@ template <typename D> struct pool_manager {
 
     desc_to_pool_map_t descToPoolMap;
 
+    // Pools of usm::pool_descriptor keyed by the device handle and the kind
+    // of memory, so that getPool doesn't have to hash descriptors, which
+    // queries the native handle of the device. It's only modified by addPool,
+    // lookups don't take a lock. Descriptors of other devices, e.g.
+    // sub-devices sharing the pool of their parent, use descToPoolMap.
+    std::vector<detail::device_pools_t> devicePools;
+
+    detail::device_pools_t *findDevicePools(ur_usm_pool_handle_t poolHandle,
+                                            ur_device_handle_t hDevice) {
+        for (auto &entry : devicePools) {
+            if (entry.hDevice == hDevice && entry.poolHandle == poolHandle) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
   public:
     static std::pair<ur_result_t, pool_manager>
     create(desc_to_pool_map_t &&descToHandleMap = {}) {
@@ -271,15 +336,36 @@ template <typename D> struct pool_manager {
 
     ur_result_t addPool(const D &desc,
                         umf::pool_unique_handle_t &&hPool) noexcept {
-        if (!descToPoolMap.try_emplace(desc, std::move(hPool)).second) {
+        auto [it, inserted] = descToPoolMap.try_emplace(desc, std::move(hPool));
+        if (!inserted) {
             logger::error("Pool for pool descriptor: {}, already exists", desc);
             return UR_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        if constexpr (std::is_same_v<D, pool_descriptor>) {
+            if (auto kind = detail::fastPoolKind(desc)) {
+                auto *entry = findDevicePools(desc.poolHandle, desc.hDevice);
+                if (!entry) {
+                    entry = &devicePools.emplace_back(detail::device_pools_t{
+                        desc.poolHandle, desc.hDevice, {}});
+                }
+                entry->pools[*kind] = it->second.get();
+            }
+        }
+
         return UR_RESULT_SUCCESS;
     }
 
     std::optional<umf_memory_pool_handle_t> getPool(const D &desc) noexcept {
+        if constexpr (std::is_same_v<D, pool_descriptor>) {
+            if (auto kind = detail::fastPoolKind(desc)) {
+                auto *entry = findDevicePools(desc.poolHandle, desc.hDevice);
+                if (entry && entry->pools[*kind]) {
+                    return entry->pools[*kind];
+                }
+            }
+        }
+
         auto it = descToPoolMap.find(desc);
         if (it == descToPoolMap.end()) {
             logger::error("Pool descriptor doesn't match any existing pool: {}",
@@ -0,0 +1,188 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_QUEUE_TELEMETRY_HPP
+#define UR_QUEUE_TELEMETRY_HPP 1
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <ur_api.h>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// The always-on counters of a queue reported by the telemetry queries of
+/// urQueueGetInfo. They are relaxed atomics updated on the submission and
+/// wait paths, so counting takes no locks and a query only reads them,
+/// which also means a query running concurrently with submissions may see
+/// the counters of a command partially updated.
+class queue_telemetry_t {
+  public:
+    /// The entries of UR_QUEUE_INFO_COMMAND_COUNTS
+    enum command_class_t {
+        kernel_launch = 0,
+        mem_copy,
+        mem_fill,
+        other_command,
+        num_command_classes
+    };
+
+    /// The entries of UR_QUEUE_INFO_BYTES_COPIED
+    enum copy_direction_t {
+        host_to_device = 0,
+        device_to_host,
+        device_to_device,
+        unknown_direction,
+        num_copy_directions
+    };
+
+    static command_class_t classify(ur_command_t command_type) {
+        switch (command_type) {
+        case UR_COMMAND_KERNEL_LAUNCH:
+            return kernel_launch;
+        case UR_COMMAND_MEM_BUFFER_READ:
+        case UR_COMMAND_MEM_BUFFER_WRITE:
+        case UR_COMMAND_MEM_BUFFER_READ_RECT:
+        case UR_COMMAND_MEM_BUFFER_WRITE_RECT:
+        case UR_COMMAND_MEM_BUFFER_COPY:
+        case UR_COMMAND_MEM_BUFFER_COPY_RECT:
+        case UR_COMMAND_MEM_IMAGE_READ:
+        case UR_COMMAND_MEM_IMAGE_WRITE:
+        case UR_COMMAND_MEM_IMAGE_COPY:
+        case UR_COMMAND_USM_MEMCPY:
+        case UR_COMMAND_USM_MEMCPY_2D:
+        case UR_COMMAND_DEVICE_GLOBAL_VARIABLE_READ:
+        case UR_COMMAND_DEVICE_GLOBAL_VARIABLE_WRITE:
+        case UR_COMMAND_MEM_BUFFER_COPY_RECT_BATCH_EXP:
+            return mem_copy;
+        case UR_COMMAND_MEM_BUFFER_FILL:
+        case UR_COMMAND_USM_FILL:
+        case UR_COMMAND_USM_FILL_2D:
+            return mem_fill;
+        default:
+            return other_command;
+        }
+    }
+
+    void commandSubmitted(command_class_t command_class, uint64_t count = 1) {
+        command_counts[command_class].fetch_add(count,
+                                                std::memory_order_relaxed);
+    }
+
+    void commandSubmitted(ur_command_t command_type) {
+        commandSubmitted(classify(command_type));
+    }
+
+    void bytesCopied(copy_direction_t direction, uint64_t bytes) {
+        bytes_copied[direction].fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /// Counts a batch of num_commands commands submitted to the device
+    void batchSubmitted(uint64_t num_commands = 1) {
+        batch_count.fetch_add(1, std::memory_order_relaxed);
+        batched_commands.fetch_add(num_commands, std::memory_order_relaxed);
+    }
+
+    /// Counts a command which the adapter submits to the device on its own,
+    /// as a batch of one
+    void commandSubmittedAsBatch(ur_command_t command_type) {
+        commandSubmitted(command_type);
+        batchSubmitted();
+    }
+
+    void eventCreated() {
+        created_event_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void hostWaited(std::chrono::steady_clock::duration duration) {
+        host_wait_time_ns.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+                .count(),
+            std::memory_order_relaxed);
+    }
+
+    /// Adds the time from its construction to its destruction to the host
+    /// wait time of the queue
+    class wait_scope_t {
+      public:
+        explicit wait_scope_t(queue_telemetry_t &telemetry)
+            : telemetry(telemetry), start(std::chrono::steady_clock::now()) {}
+        wait_scope_t(const wait_scope_t &) = delete;
+        wait_scope_t &operator=(const wait_scope_t &) = delete;
+        ~wait_scope_t() {
+            telemetry.hostWaited(std::chrono::steady_clock::now() - start);
+        }
+
+      private:
+        queue_telemetry_t &telemetry;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    /// Answers the telemetry queries of urQueueGetInfo, ReturnValue is the
+    /// UrReturnHelper of the query
+    template <typename ReturnHelper>
+    ur_result_t getInfo(ur_queue_info_t prop_name,
+                        ReturnHelper &ReturnValue) const {
+        switch (prop_name) {
+        case UR_QUEUE_INFO_COMMAND_COUNTS: {
+            auto counts = load(command_counts);
+            return ReturnValue(counts.data(), counts.size());
+        }
+        case UR_QUEUE_INFO_BYTES_COPIED: {
+            auto bytes = load(bytes_copied);
+            return ReturnValue(bytes.data(), bytes.size());
+        }
+        case UR_QUEUE_INFO_BATCH_COUNT:
+            return ReturnValue(batch_count.load(std::memory_order_relaxed));
+        case UR_QUEUE_INFO_AVERAGE_BATCH_SIZE: {
+            uint64_t batches = batch_count.load(std::memory_order_relaxed);
+            uint64_t commands =
+                batched_commands.load(std::memory_order_relaxed);
+            return ReturnValue(batches ? static_cast<double>(commands) /
+                                             static_cast<double>(batches)
+                                       : 0.0);
+        }
+        case UR_QUEUE_INFO_HOST_WAIT_TIME:
+            return ReturnValue(
+                host_wait_time_ns.load(std::memory_order_relaxed));
+        case UR_QUEUE_INFO_CREATED_EVENT_COUNT:
+            return ReturnValue(
+                created_event_count.load(std::memory_order_relaxed));
+        default:
+            return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+        }
+    }
+
+  private:
+    template <size_t N>
+    static std::array<uint64_t, N>
+    load(const std::array<std::atomic<uint64_t>, N> &counters) {
+        std::array<uint64_t, N> values;
+        for (size_t i = 0; i < N; i++) {
+            values[i] = counters[i].load(std::memory_order_relaxed);
+        }
+        return values;
+    }
+
+    std::array<std::atomic<uint64_t>, num_command_classes> command_counts{};
+    std::array<std::atomic<uint64_t>, num_copy_directions> bytes_copied{};
+    std::atomic<uint64_t> batch_count{0};
+    std::atomic<uint64_t> batched_commands{0};
+    std::atomic<uint64_t> host_wait_time_ns{0};
+    std::atomic<uint64_t> created_event_count{0};
+};
+
+} // namespace ur
+
+#endif // UR_QUEUE_TELEMETRY_HPP
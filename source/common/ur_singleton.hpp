@@ -11,23 +11,98 @@
 #ifndef UR_SINGLETON_H
 #define UR_SINGLETON_H 1
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <unordered_map>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+/// a non thread-safe arena handing out storage for objects of a single type
+/// from slabs of slab_size slots, released slots are recycled through an
+/// intrusive free list, the slabs themselves are only freed with the arena
+template <typename object_tn, size_t slab_size = 64> class object_arena_t {
+    union slot_t {
+        slot_t *next;
+        alignas(object_tn) unsigned char storage[sizeof(object_tn)];
+    };
+
+    std::vector<std::unique_ptr<slot_t[]>> slabs;
+    slot_t *free_list = nullptr;
+
+    void grow() {
+        auto &slab = slabs.emplace_back(new slot_t[slab_size]);
+        for (size_t i = 0; i < slab_size; ++i) {
+            slab[i].next = free_list;
+            free_list = &slab[i];
+        }
+    }
+
+  public:
+    object_arena_t() = default;
+    object_arena_t(const object_arena_t &) = delete;
+    object_arena_t &operator=(const object_arena_t &) = delete;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// constructs a new object in a free slot, params are forwarded to its ctor
+    template <typename... Ts> object_tn *create(Ts &&...params) {
+        if (!free_list) {
+            grow();
+        }
+        slot_t *slot = free_list;
+        free_list = slot->next;
+        try {
+            return new (slot->storage) object_tn(std::forward<Ts>(params)...);
+        } catch (...) {
+            slot->next = free_list;
+            free_list = slot;
+            throw;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// destroys an object created by this arena and recycles its slot
+    void destroy(object_tn *object) {
+        object->~object_tn();
+        auto slot = reinterpret_cast<slot_t *>(object);
+        slot->next = free_list;
+        free_list = slot;
+    }
+};
 
 //////////////////////////////////////////////////////////////////////////
 /// a abstract factory for creation of singleton objects
+///
+/// The instances are spread across a fixed number of independently locked
+/// shards, selected by hashing the key, so that threads creating or looking
+/// up different handles do not serialize on a single mutex. Each shard
+/// carves its instances out of an object_arena_t rather than allocating them
+/// one by one, and keeps the map nodes of released instances for the next
+/// ones, so that creating and releasing instances doesn't allocate once a
+/// shard reached its highest number of instances.
 template <typename singleton_tn, typename key_tn> class singleton_factory_t {
   protected:
     using singleton_t = singleton_tn;
     using key_t = typename std::conditional<std::is_pointer<key_tn>::value,
                                             size_t, key_tn>::type;
 
-    using ptr_t = std::unique_ptr<singleton_t>;
+    using ptr_t = singleton_t *;
     using map_t = std::unordered_map<key_t, ptr_t>;
+    using node_t = typename map_t::node_type;
+
+    static constexpr size_t num_shards = 32; ///< must be a power of two
 
-    std::mutex mut; ///< lock for thread-safety
-    map_t map;      ///< single instance of singleton for each unique key
+    // each shard sits on its own cache line to avoid false sharing
+    struct alignas(64) shard_t {
+        std::mutex mut; ///< lock for thread-safety of this shard
+        map_t map;      ///< single instance of singleton for each unique key
+        object_arena_t<singleton_t> arena; ///< storage of the instances
+        std::vector<node_t> free_nodes;    ///< nodes of released instances
+    };
+
+    std::array<shard_t, num_shards> shards;
 
     //////////////////////////////////////////////////////////////////////////
     /// extract the key from parameter list and if necessary, convert type
@@ -36,11 +111,21 @@ template <typename singleton_tn, typename key_tn> class singleton_factory_t {
         return reinterpret_cast<key_t>(key);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// select the shard owning the key
+    shard_t &getShard(key_t key) {
+        // Handles are usually aligned pointers, so the low bits carry little
+        // entropy. Fibonacci hashing spreads them over the shards.
+        uint64_t hash = static_cast<uint64_t>(std::hash<key_t>{}(key));
+        hash *= 0x9E3779B97F4A7C15ull;
+        return shards[(hash >> 32) & (num_shards - 1)];
+    }
+
   public:
     //////////////////////////////////////////////////////////////////////////
     /// default ctor/dtor
     singleton_factory_t() = default;
-    ~singleton_factory_t() = default;
+    ~singleton_factory_t() { clear(); }
 
     //////////////////////////////////////////////////////////////////////////
     /// gets a pointer to a unique instance of singleton
@@ -54,27 +139,51 @@ template <typename singleton_tn, typename key_tn> class singleton_factory_t {
             return static_cast<singleton_tn *>(0);
         }
 
-        std::lock_guard<std::mutex> lk(mut);
-        auto iter = map.find(key);
+        auto &shard = getShard(key);
+        std::lock_guard<std::mutex> lk(shard.mut);
+        auto iter = shard.map.find(key);
 
-        if (map.end() == iter) {
-            auto ptr =
-                std::make_unique<singleton_t>(std::forward<Ts>(params)...);
-            iter = map.emplace(key, std::move(ptr)).first;
+        if (shard.map.end() == iter) {
+            auto ptr = shard.arena.create(std::forward<Ts>(params)...);
+            try {
+                if (shard.free_nodes.empty()) {
+                    iter = shard.map.emplace(key, ptr).first;
+                } else {
+                    node_t node = std::move(shard.free_nodes.back());
+                    shard.free_nodes.pop_back();
+                    node.key() = key;
+                    node.mapped() = ptr;
+                    iter = shard.map.insert(std::move(node)).position;
+                }
+            } catch (...) {
+                shard.arena.destroy(ptr);
+                throw;
+            }
         }
-        return iter->second.get();
+        return iter->second;
     }
 
     //////////////////////////////////////////////////////////////////////////
     /// once the key is no longer valid, release the singleton
     void release(key_tn key) {
-        std::lock_guard<std::mutex> lk(mut);
-        map.erase(getKey(key));
+        auto &shard = getShard(getKey(key));
+        std::lock_guard<std::mutex> lk(shard.mut);
+        auto iter = shard.map.find(getKey(key));
+        if (shard.map.end() != iter) {
+            shard.arena.destroy(iter->second);
+            shard.free_nodes.push_back(shard.map.extract(iter));
+        }
     }
 
     void clear() {
-        std::lock_guard<std::mutex> lk(mut);
-        map.clear();
+        for (auto &shard : shards) {
+            std::lock_guard<std::mutex> lk(shard.mut);
+            for (auto &entry : shard.map) {
+                shard.arena.destroy(entry.second);
+            }
+            shard.map.clear();
+            shard.free_nodes.clear();
+        }
     }
 };
 
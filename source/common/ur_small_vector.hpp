@@ -0,0 +1,65 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_SMALL_VECTOR_H
+#define UR_SMALL_VECTOR_H 1
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+//////////////////////////////////////////////////////////////////////////
+/// a fixed-size array of trivially copyable elements (typically handles)
+/// which lives on the stack when it has at most inline_size elements and
+/// only falls back to a heap allocation for larger sizes
+///
+/// Unlike std::vector, the elements are left uninitialized on construction,
+/// the caller is expected to write every element before reading it.
+template <typename T, size_t inline_size = 16> class small_vector_t {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "small_vector_t only supports trivially copyable types");
+
+  public:
+    explicit small_vector_t(size_t size) : count(size) {
+        if (size > inline_size) {
+            heap.reset(new T[size]);
+        }
+    }
+
+    small_vector_t(const small_vector_t &) = delete;
+    small_vector_t &operator=(const small_vector_t &) = delete;
+
+    /// nullptr when empty, like std::vector: the array is passed on to the
+    /// adapters, some of which reject a non-null list with a count of 0
+    T *data() noexcept {
+        return count == 0 ? nullptr : heap ? heap.get() : storage;
+    }
+    const T *data() const noexcept {
+        return count == 0 ? nullptr : heap ? heap.get() : storage;
+    }
+
+    T &operator[](size_t i) noexcept { return data()[i]; }
+    const T &operator[](size_t i) const noexcept { return data()[i]; }
+
+    size_t size() const noexcept { return count; }
+    bool empty() const noexcept { return count == 0; }
+
+    T *begin() noexcept { return data(); }
+    T *end() noexcept { return data() + count; }
+    const T *begin() const noexcept { return data(); }
+    const T *end() const noexcept { return data() + count; }
+
+  private:
+    size_t count;
+    T storage[inline_size];
+    std::unique_ptr<T[]> heap;
+};
+
+#endif /* UR_SMALL_VECTOR_H */
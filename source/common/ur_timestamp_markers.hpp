@@ -0,0 +1,75 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_TIMESTAMP_MARKERS_HPP
+#define UR_TIMESTAMP_MARKERS_HPP 1
+
+#include "ur_api.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// The numbering of the markers of urEnqueueTimestampMarkerExp over the
+/// ring of slots reserved by urQueueReserveTimestampMarkersExp, the
+/// adapters storing the timestamps of the slots their own way. Marker N
+/// goes to slot N % capacity, and stays readable until capacity more
+/// markers are enqueued. The adapters guard it with the mutex of their
+/// queue.
+class timestamp_markers_t {
+  public:
+    /// capacity must not be 0, which the adapters reject with
+    /// UR_RESULT_ERROR_INVALID_SIZE
+    explicit timestamp_markers_t(uint32_t capacity) : capacity_(capacity) {
+        assert(capacity > 0);
+    }
+
+    uint32_t capacity() const { return capacity_; }
+
+    /// The number of the markers enqueued so far
+    uint64_t enqueued() const { return next; }
+
+    uint32_t slot(uint64_t marker) const {
+        return static_cast<uint32_t>(marker % capacity_);
+    }
+
+    /// Numbers the marker being enqueued
+    uint64_t push() { return next++; }
+
+    /// Checks that the markers [first, first + count) were enqueued and
+    /// none was overwritten since
+    ur_result_t checkRange(uint64_t first, uint32_t count) const {
+        if (first > next || count > next - first ||
+            next - first > capacity_) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+        return UR_RESULT_SUCCESS;
+    }
+
+    /// Whether the markers before end are known to be written, because
+    /// the adapter waited for them with markWritten
+    bool written(uint64_t end) const { return end <= writtenEnd; }
+
+    /// Records that the markers before end are written, e.g. after the
+    /// queue was finished, end being enqueued() before the wait
+    void markWritten(uint64_t end) { writtenEnd = std::max(writtenEnd, end); }
+
+  private:
+    uint32_t capacity_;
+    uint64_t next = 0;
+    uint64_t writtenEnd = 0;
+};
+
+} // namespace ur
+
+#endif /* UR_TIMESTAMP_MARKERS_HPP */
@@ -0,0 +1,94 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_USM_PREFETCH_ARGS_HPP
+#define UR_USM_PREFETCH_ARGS_HPP 1
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <ur_api.h>
+
+#include "ur_util.hpp"
+
+namespace ur {
+
+/// Whether the adapters prefetch the shared USM allocations a kernel takes
+/// as pointer arguments to the device before its launches, set with
+/// UR_USM_AUTO_PREFETCH. Without it, the pages migrate on device page
+/// faults, which is much slower.
+inline bool usmAutoPrefetchEnabled() {
+    static const bool enabled = getenv_tobool("UR_USM_AUTO_PREFETCH");
+    return enabled;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// The shared USM allocations the pointer arguments of a kernel point
+/// into, which are prefetched before its launches. The kernel may access
+/// any of the allocation through the pointer, so the whole allocation is
+/// prefetched, once when several arguments point into it.
+///
+/// Adapters set the allocation of a pointer argument when it's shared
+/// memory, and clear it when the argument is set to anything else.
+class usm_prefetch_args_t {
+  public:
+    void set(uint32_t index, const void *base, size_t size) {
+        clear(index);
+        args.push_back({index, base, size});
+    }
+
+    void clear(uint32_t index) {
+        if (args.empty()) {
+            return;
+        }
+        args.erase(std::remove_if(args.begin(), args.end(),
+                                  [index](const arg_t &arg) {
+                                      return arg.index == index;
+                                  }),
+                   args.end());
+    }
+
+    bool empty() const { return args.empty(); }
+
+    /// Calls prefetch(base, size) once for each allocation, stopping at and
+    /// returning the first error it returns
+    template <typename PrefetchFn>
+    ur_result_t forEachAllocation(PrefetchFn &&prefetch) const {
+        for (size_t i = 0; i < args.size(); i++) {
+            const void *base = args[i].base;
+            bool seen = std::any_of(
+                args.begin(), args.begin() + i,
+                [base](const arg_t &arg) { return arg.base == base; });
+            if (seen) {
+                continue;
+            }
+            if (auto result = prefetch(base, args[i].size);
+                result != UR_RESULT_SUCCESS) {
+                return result;
+            }
+        }
+        return UR_RESULT_SUCCESS;
+    }
+
+  private:
+    struct arg_t {
+        uint32_t index;
+        const void *base;
+        size_t size;
+    };
+
+    std::vector<arg_t> args;
+};
+
+} // namespace ur
+
+#endif // UR_USM_PREFETCH_ARGS_HPP
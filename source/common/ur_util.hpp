@@ -20,6 +20,7 @@
 #include <atomic>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string.h>
@@ -115,6 +116,14 @@ inline std::optional<uint64_t> getenv_to_unsigned(const char *name) try {
     return std::nullopt;
 }
 
+/// @brief Whether UR_FAST_TEARDOWN is set, in which case the process is
+/// expected to exit once torn down: what the OS reclaims at exit, e.g. the
+/// cached driver objects, is left to it rather than released one by one.
+inline bool fast_teardown_enabled() {
+    static const bool enabled = getenv_tobool("UR_FAST_TEARDOWN");
+    return enabled;
+}
+
 static void throw_wrong_format_vec(const char *env_var_name,
                                    std::string env_var_value) {
     std::stringstream ex_ss;
@@ -265,6 +274,41 @@ inline std::optional<EnvVarMap> getenv_to_map(const char *env_var_name,
     return map;
 }
 
+/// @brief Caches the result of getenv_to_map() for \p env_var_name
+///        The variable is parsed again only when its raw value changes, so
+///        code that is called repeatedly, e.g. once per platform, does not
+///        parse the same string on every call. A value that fails to parse
+///        throws from get() and is not cached.
+class env_var_map_cache_t {
+  public:
+    env_var_map_cache_t(const char *env_var_name, bool reject_empty = true)
+        : env_var_name(env_var_name), reject_empty(reject_empty) {}
+
+    /// @return the same as getenv_to_map(env_var_name, reject_empty)
+    /// @throws std::invalid_argument() when the environment variable has
+    ///         wrong format
+    std::optional<EnvVarMap> get() {
+        auto value = ur_getenv(env_var_name);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!valid || value != cachedValue) {
+            cachedMap = getenv_to_map(env_var_name, reject_empty);
+            cachedValue = std::move(value);
+            valid = true;
+        }
+        return cachedMap;
+    }
+
+  private:
+    const char *env_var_name;
+    bool reject_empty;
+
+    std::mutex mutex;
+    bool valid = false;
+    std::optional<std::string> cachedValue;
+    std::optional<EnvVarMap> cachedMap;
+};
+
 inline std::size_t combine_hashes(std::size_t seed) { return seed; }
 
 template <typename T, typename... Args>
@@ -0,0 +1,55 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+#include <windows.h>
+
+#include "ur_mapped_file.hpp"
+
+namespace ur {
+
+bool mapped_file_t::map(const filesystem::path &Path) {
+    reset();
+    // Other processes may still remove or replace the file, which fails while
+    // it is mapped.
+    HANDLE File = CreateFileW(Path.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (File == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER FileSize;
+    HANDLE Mapping = nullptr;
+    if (GetFileSizeEx(File, &FileSize) && FileSize.QuadPart > 0) {
+        Mapping =
+            CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+    CloseHandle(File);
+    if (!Mapping) {
+        return false;
+    }
+    // The view keeps the mapping alive
+    void *Ptr = MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(Mapping);
+    if (!Ptr) {
+        return false;
+    }
+    Data = static_cast<const uint8_t *>(Ptr);
+    Size = static_cast<size_t>(FileSize.QuadPart);
+    return true;
+}
+
+void mapped_file_t::reset() {
+    if (Data) {
+        UnmapViewOfFile(Data);
+        Data = nullptr;
+        Size = 0;
+    }
+}
+
+} // namespace ur
@@ -0,0 +1,140 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file asan_allocation_index.hpp
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ur_sanitizer_layer {
+
+/// Maps addresses to the non-overlapping allocation that contains them.
+///
+/// Allocations are kept in radix buckets of increasing size, starting at the
+/// page size. Each allocation lives in the first level where it fits into a
+/// single bucket, and each bucket is a small array sorted by address, so a
+/// lookup is a hash and a binary search over a few contiguous entries per
+/// level in use.
+template <typename T> class AllocationIndex {
+  public:
+    void insert(uintptr_t Begin, uintptr_t End, const T &Value) {
+        unsigned Level = getLevel(Begin, End);
+        auto &Bucket = m_Levels[Level].Buckets[getBucketKey(Level, Begin)];
+        auto It = std::upper_bound(Bucket.begin(), Bucket.end(), Begin,
+                                   [](uintptr_t Addr, const Entry &E) {
+                                       return Addr < E.Begin;
+                                   });
+        Bucket.insert(It, Entry{Begin, End, Value});
+        m_Levels[Level].Count++;
+    }
+
+    /// Removes the allocation [Begin, End) added by insert()
+    bool erase(uintptr_t Begin, uintptr_t End) {
+        unsigned Level = getLevel(Begin, End);
+        auto &Buckets = m_Levels[Level].Buckets;
+        auto BucketIt = Buckets.find(getBucketKey(Level, Begin));
+        if (BucketIt == Buckets.end()) {
+            return false;
+        }
+        auto &Bucket = BucketIt->second;
+        auto It = std::lower_bound(Bucket.begin(), Bucket.end(), Begin,
+                                   [](const Entry &E, uintptr_t Addr) {
+                                       return E.Begin < Addr;
+                                   });
+        if (It == Bucket.end() || It->Begin != Begin) {
+            return false;
+        }
+        Bucket.erase(It);
+        if (Bucket.empty()) {
+            Buckets.erase(BucketIt);
+        }
+        m_Levels[Level].Count--;
+        return true;
+    }
+
+    /// Returns the allocation containing Address, or nullptr
+    const T *find(uintptr_t Address) const {
+        for (unsigned Level = 0; Level < NumLevels; ++Level) {
+            const auto &L = m_Levels[Level];
+            if (L.Count == 0) {
+                continue;
+            }
+            auto BucketIt = L.Buckets.find(getBucketKey(Level, Address));
+            if (BucketIt == L.Buckets.end()) {
+                continue;
+            }
+            const auto &Bucket = BucketIt->second;
+            auto It = std::upper_bound(Bucket.begin(), Bucket.end(), Address,
+                                       [](uintptr_t Addr, const Entry &E) {
+                                           return Addr < E.Begin;
+                                       });
+            if (It != Bucket.begin() && Address < std::prev(It)->End) {
+                return &std::prev(It)->Value;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t size() const {
+        size_t Size = 0;
+        for (const auto &L : m_Levels) {
+            Size += L.Count;
+        }
+        return Size;
+    }
+
+    void clear() {
+        for (auto &L : m_Levels) {
+            L.Buckets.clear();
+            L.Count = 0;
+        }
+    }
+
+  private:
+    struct Entry {
+        uintptr_t Begin;
+        uintptr_t End;
+        T Value;
+    };
+
+    struct Level {
+        std::unordered_map<uintptr_t, std::vector<Entry>> Buckets;
+        size_t Count = 0;
+    };
+
+    // Bucket sizes of each level, from one page up to the whole address space
+    static constexpr std::array<unsigned, 7> LevelShifts = {12, 16, 20, 24,
+                                                            28, 36, 63};
+    static constexpr unsigned NumLevels = LevelShifts.size();
+
+    static uintptr_t getBucketKey(unsigned Level, uintptr_t Addr) {
+        return Addr >> LevelShifts[Level];
+    }
+
+    static unsigned getLevel(uintptr_t Begin, uintptr_t End) {
+        uintptr_t Last = End > Begin ? End - 1 : Begin;
+        unsigned Level = 0;
+        while (Level + 1 < NumLevels &&
+               getBucketKey(Level, Begin) != getBucketKey(Level, Last)) {
+            ++Level;
+        }
+        return Level;
+    }
+
+    std::array<Level, NumLevels> m_Levels;
+};
+
+} // namespace ur_sanitizer_layer
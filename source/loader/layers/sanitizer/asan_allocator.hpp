@@ -17,6 +17,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 namespace ur_sanitizer_layer {
 
@@ -44,6 +45,9 @@ struct AllocInfo {
     StackTrace AllocStack;
     StackTrace ReleaseStack;
 
+    // Devices whose shadow memory pages are referenced by this allocation
+    std::vector<ur_device_handle_t> ShadowDevices;
+
     void print();
     size_t getRedzoneSize() { return AllocSize - (UserEnd - UserBegin); }
 };
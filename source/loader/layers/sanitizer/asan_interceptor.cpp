@@ -20,6 +20,8 @@
 #include "stacktrace.hpp"
 #include "ur_sanitizer_utils.hpp"
 
+#include <map>
+
 namespace ur_sanitizer_layer {
 
 namespace {
@@ -47,6 +49,16 @@ uptr MemToShadow_PVC(uptr USM_SHADOW_BASE, uptr UPtr) {
     }
 }
 
+// Returns 0 if the device doesn't have GPU shadow memory
+uptr MemToShadow_GPU(const DeviceInfo &DI, uptr UPtr) {
+    if (DI.Type == DeviceType::GPU_PVC) {
+        return MemToShadow_PVC(DI.ShadowOffset, UPtr);
+    } else if (DI.Type == DeviceType::GPU_DG2) {
+        return MemToShadow_DG2(DI.ShadowOffset, UPtr);
+    }
+    return 0;
+}
+
 ur_result_t urEnqueueUSMSet(ur_queue_handle_t Queue, void *Ptr, char Value,
                             size_t Size, uint32_t NumEvents = 0,
                             const ur_event_handle_t *EventWaitList = nullptr,
@@ -89,90 +101,202 @@ ur_result_t enqueueMemSetShadow(std::shared_ptr<ContextInfo> &ContextInfo,
         ///
         /// GPU Device: GPU needs to manually map physical memory before memset
         ///
-        uptr ShadowBegin = 0, ShadowEnd = 0;
-
-        if (DeviceInfo->Type == DeviceType::GPU_PVC) {
-            ShadowBegin = MemToShadow_PVC(DeviceInfo->ShadowOffset, Ptr);
-            ShadowEnd =
-                MemToShadow_PVC(DeviceInfo->ShadowOffset, Ptr + Size - 1);
-        } else if (DeviceInfo->Type == DeviceType::GPU_DG2) {
-            ShadowBegin = MemToShadow_DG2(DeviceInfo->ShadowOffset, Ptr);
-            ShadowEnd =
-                MemToShadow_DG2(DeviceInfo->ShadowOffset, Ptr + Size - 1);
-        } else {
+        if (!DeviceInfo->ShadowPages) {
             getContext()->logger.error("Unsupport device type");
             return UR_RESULT_ERROR_INVALID_ARGUMENT;
         }
 
+        uptr ShadowBegin = MemToShadow_GPU(*DeviceInfo, Ptr);
+        uptr ShadowEnd = MemToShadow_GPU(*DeviceInfo, Ptr + Size - 1);
         assert(ShadowBegin <= ShadowEnd);
 
-        {
-            static const size_t PageSize = GetVirtualMemGranularity(
-                ContextInfo->Handle, DeviceInfo->Handle);
-
-            ur_physical_mem_properties_t Desc{
-                UR_STRUCTURE_TYPE_PHYSICAL_MEM_PROPERTIES, nullptr, 0};
-            static ur_physical_mem_handle_t PhysicalMem{};
-
-            // Make sure [Ptr, Ptr + Size] is mapped to physical memory
-            for (auto MappedPtr = RoundDownTo(ShadowBegin, PageSize);
-                 MappedPtr <= ShadowEnd; MappedPtr += PageSize) {
-                if (!PhysicalMem) {
-                    auto URes = getContext()->urDdiTable.PhysicalMem.pfnCreate(
-                        ContextInfo->Handle, DeviceInfo->Handle, PageSize,
-                        &Desc, &PhysicalMem);
-                    if (URes != UR_RESULT_SUCCESS) {
-                        getContext()->logger.error("urPhysicalMemCreate(): {}",
-                                                   URes);
-                        return URes;
-                    }
-                }
+        // Make sure [Ptr, Ptr + Size] is mapped to physical memory, as far as
+        // it's covered by live allocations
+        std::vector<uptr> NewPages;
+        std::vector<std::pair<uptr, uptr>> Ranges;
+        UR_CALL(DeviceInfo->ShadowPages->commit(
+            ContextInfo->Handle, DeviceInfo->Handle, ShadowBegin, ShadowEnd,
+            NewPages, Ranges));
 
-                getContext()->logger.debug("urVirtualMemMap: {} ~ {}",
-                                           (void *)MappedPtr,
-                                           (void *)(MappedPtr + PageSize - 1));
-
-                // FIXME: No flag to check the failed reason is VA is already mapped
-                auto URes = getContext()->urDdiTable.VirtualMem.pfnMap(
-                    ContextInfo->Handle, (void *)MappedPtr, PageSize,
-                    PhysicalMem, 0, UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
-                if (URes != UR_RESULT_SUCCESS) {
-                    getContext()->logger.debug("urVirtualMemMap({}, {}): {}",
-                                               (void *)MappedPtr, PageSize,
-                                               URes);
-                }
+        const size_t PageSize = DeviceInfo->ShadowPages->getPageSize();
+        for (auto Page : NewPages) {
+            ContextInfo->Stats.UpdateShadowMmaped(PageSize);
 
-                // Initialize to zero
-                if (URes == UR_RESULT_SUCCESS) {
-                    // Reset PhysicalMem to null since it's been mapped
-                    PhysicalMem = nullptr;
-                    ContextInfo->Stats.UpdateShadowMmaped(PageSize);
-
-                    auto URes =
-                        urEnqueueUSMSet(Queue, (void *)MappedPtr, 0, PageSize);
-                    if (URes != UR_RESULT_SUCCESS) {
-                        getContext()->logger.error("urEnqueueUSMFill(): {}",
-                                                   URes);
-                        return URes;
-                    }
-                }
+            // Initialize to zero
+            auto URes = urEnqueueUSMSet(Queue, (void *)Page, 0, PageSize);
+            if (URes != UR_RESULT_SUCCESS) {
+                getContext()->logger.error("urEnqueueUSMFill(): {}", URes);
+                return URes;
             }
         }
 
-        auto URes = urEnqueueUSMSet(Queue, (void *)ShadowBegin, Value,
-                                    ShadowEnd - ShadowBegin + 1);
-        getContext()->logger.debug(
-            "enqueueMemSetShadow (addr={}, count={}, value={}): {}",
-            (void *)ShadowBegin, ShadowEnd - ShadowBegin + 1,
-            (void *)(size_t)Value, URes);
-        if (URes != UR_RESULT_SUCCESS) {
-            getContext()->logger.error("urEnqueueUSMFill(): {}", URes);
-            return URes;
+        for (const auto &[RangeBegin, RangeEnd] : Ranges) {
+            auto URes = urEnqueueUSMSet(Queue, (void *)RangeBegin, Value,
+                                        RangeEnd - RangeBegin + 1);
+            getContext()->logger.debug(
+                "enqueueMemSetShadow (addr={}, count={}, value={}): {}",
+                (void *)RangeBegin, RangeEnd - RangeBegin + 1,
+                (void *)(size_t)Value, URes);
+            if (URes != UR_RESULT_SUCCESS) {
+                getContext()->logger.error("urEnqueueUSMFill(): {}", URes);
+                return URes;
+            }
         }
     }
     return UR_RESULT_SUCCESS;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Shadow values of the memory touched by pending allocations and frees
+///
+/// Later updates of a range take precedence over earlier ones, and adjacent
+/// ranges with the same value are merged, so that the final state can be
+/// written with one fill per run instead of several fills per allocation.
+class ShadowUpdateBatch {
+  public:
+    void poison(uptr Begin, uptr Size, u8 Value) {
+        if (Size == 0) {
+            return;
+        }
+        // Every granule has a single shadow byte.
+        uptr End = RoundUpTo(Begin + Size, ASAN_SHADOW_GRANULARITY);
+        Begin = RoundDownTo(Begin, ASAN_SHADOW_GRANULARITY);
+
+        // Cut the part from Begin on out of the range overlapping Begin,
+        // keeping the part after End if there is one.
+        auto It = Ranges.lower_bound(Begin);
+        if (It != Ranges.begin()) {
+            auto Prev = std::prev(It);
+            if (Prev->second.End > Begin) {
+                if (Prev->second.End > End) {
+                    Ranges.emplace(End, Prev->second);
+                }
+                Prev->second.End = Begin;
+            }
+        }
+
+        // Drop the ranges starting inside [Begin, End), keeping the tail of
+        // the last one.
+        while (It != Ranges.end() && It->first < End) {
+            if (It->second.End > End) {
+                Ranges.emplace(End, It->second);
+            }
+            It = Ranges.erase(It);
+        }
+
+        It = Ranges.emplace(Begin, Range{End, Value}).first;
+
+        auto Next = std::next(It);
+        if (Next != Ranges.end() && Next->first == End &&
+            Next->second.Value == Value) {
+            It->second.End = Next->second.End;
+            Ranges.erase(Next);
+        }
+        if (It != Ranges.begin()) {
+            auto Prev = std::prev(It);
+            if (Prev->second.End == Begin && Prev->second.Value == Value) {
+                Prev->second.End = It->second.End;
+                Ranges.erase(It);
+            }
+        }
+    }
+
+    /// Records the shadow of an allocation, or of its release.
+    ///
+    /// Each 8 bytes of application memory are mapped into one byte of shadow
+    /// memory. The meaning of that byte:
+    ///  - Negative: All bytes are not accessible (poisoned)
+    ///  - 0: All bytes are accessible
+    ///  - 1 <= k <= 7: Only the first k bytes is accessible
+    ///
+    /// ref: https://github.com/google/sanitizers/wiki/AddressSanitizerAlgorithm#mapping
+    void poison(const AllocInfo &AI) {
+        if (AI.IsReleased) {
+            int ShadowByte;
+            switch (AI.Type) {
+            case AllocType::HOST_USM:
+                ShadowByte = kUsmHostDeallocatedMagic;
+                break;
+            case AllocType::DEVICE_USM:
+                ShadowByte = kUsmDeviceDeallocatedMagic;
+                break;
+            case AllocType::SHARED_USM:
+                ShadowByte = kUsmSharedDeallocatedMagic;
+                break;
+            case AllocType::MEM_BUFFER:
+                ShadowByte = kMemBufferDeallocatedMagic;
+                break;
+            default:
+                ShadowByte = 0xff;
+                assert(false && "Unknow AllocInfo Type");
+            }
+            poison(AI.AllocBegin, AI.AllocSize, ShadowByte);
+            return;
+        }
+
+        int ShadowByte;
+        switch (AI.Type) {
+        case AllocType::HOST_USM:
+            ShadowByte = kUsmHostRedzoneMagic;
+            break;
+        case AllocType::DEVICE_USM:
+            ShadowByte = kUsmDeviceRedzoneMagic;
+            break;
+        case AllocType::SHARED_USM:
+            ShadowByte = kUsmSharedRedzoneMagic;
+            break;
+        case AllocType::MEM_BUFFER:
+            ShadowByte = kMemBufferRedzoneMagic;
+            break;
+        case AllocType::DEVICE_GLOBAL:
+            ShadowByte = kDeviceGlobalRedzoneMagic;
+            break;
+        default:
+            ShadowByte = 0xff;
+            assert(false && "Unknow AllocInfo Type");
+        }
+
+        uptr UserTail = RoundDownTo(AI.UserEnd, ASAN_SHADOW_GRANULARITY);
+        uptr TailBegin = RoundUpTo(AI.UserEnd, ASAN_SHADOW_GRANULARITY);
+        uptr TailEnd = AI.AllocBegin + AI.AllocSize;
+
+        // Left red zone
+        poison(AI.AllocBegin, AI.UserBegin - AI.AllocBegin, ShadowByte);
+
+        // User memory
+        poison(AI.UserBegin, UserTail - AI.UserBegin, 0);
+
+        // User tail
+        if (TailBegin != AI.UserEnd) {
+            poison(UserTail, 1, static_cast<u8>(AI.UserEnd - UserTail));
+        }
+
+        // Right red zone
+        if (TailEnd > TailBegin) {
+            poison(TailBegin, TailEnd - TailBegin, ShadowByte);
+        }
+    }
+
+    size_t size() const { return Ranges.size(); }
+
+    ur_result_t enqueue(std::shared_ptr<ContextInfo> &ContextInfo,
+                        std::shared_ptr<DeviceInfo> &DeviceInfo,
+                        ur_queue_handle_t Queue) const {
+        for (const auto &[Begin, Run] : Ranges) {
+            UR_CALL(enqueueMemSetShadow(ContextInfo, DeviceInfo, Queue, Begin,
+                                        Run.End - Begin, Run.Value));
+        }
+        return UR_RESULT_SUCCESS;
+    }
+
+  private:
+    struct Range {
+        uptr End;
+        u8 Value;
+    };
+    std::map<uptr, Range> Ranges;
+};
+
 } // namespace
 
 SanitizerInterceptor::SanitizerInterceptor() {
@@ -188,10 +312,14 @@ SanitizerInterceptor::~SanitizerInterceptor() {
     DestroyShadowMemoryOnPVC();
     DestroyShadowMemoryOnDG2();
 
+    // The errors of the launches which nothing waited for
+    checkLaunches(true);
+
     // We must release these objects before releasing adapters, since
     // they may use the adapter in their destructor
     m_Quarantine = nullptr;
     m_MemBufferMap.clear();
+    m_AllocationIndex.clear();
     m_AllocationMap.clear();
     m_KernelMap.clear();
     m_ContextMap.clear();
@@ -282,22 +410,26 @@ ur_result_t SanitizerInterceptor::allocateMemory(
                                                     false,
                                                     Context,
                                                     Device,
-                                                    GetCurrentBacktrace(),
+                                                    getAllocStack(Size),
+                                                    {},
                                                     {}});
 
     AI->print();
 
     // For updating shadow memory
     if (Device) { // Device/Shared USM
+        retainShadowPages(*AI, {Device});
         ContextInfo->insertAllocInfo({Device}, AI);
     } else { // Host USM
+        retainShadowPages(*AI, ContextInfo->DeviceList);
         ContextInfo->insertAllocInfo(ContextInfo->DeviceList, AI);
     }
 
     // For memory release
     {
         std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-        m_AllocationMap.emplace(AI->AllocBegin, std::move(AI));
+        auto It = m_AllocationMap.emplace(AI->AllocBegin, std::move(AI)).first;
+        m_AllocationIndex.insert(AllocBegin, AllocBegin + NeededSize, It);
     }
 
     return UR_RESULT_SUCCESS;
@@ -341,7 +473,8 @@ ur_result_t SanitizerInterceptor::releaseMemory(ur_context_handle_t Context,
     }
 
     AllocInfo->IsReleased = true;
-    AllocInfo->ReleaseStack = GetCurrentBacktrace();
+    AllocInfo->ReleaseStack =
+        getAllocStack(AllocInfo->UserEnd - AllocInfo->UserBegin);
 
     if (AllocInfo->Type == AllocType::HOST_USM) {
         ContextInfo->insertAllocInfo(ContextInfo->DeviceList, AllocInfo);
@@ -356,8 +489,10 @@ ur_result_t SanitizerInterceptor::releaseMemory(ur_context_handle_t Context,
         ContextInfo->Stats.UpdateUSMRealFreed(AllocInfo->AllocSize,
                                               AllocInfo->getRedzoneSize());
 
+        releaseShadowPages(ContextInfo, *AllocInfo);
+
         std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-        m_AllocationMap.erase(AllocInfoIt);
+        eraseAllocInfo(AllocInfoIt);
 
         return getContext()->urDdiTable.USM.pfnFree(
             Context, (void *)(AllocInfo->AllocBegin));
@@ -365,24 +500,33 @@ ur_result_t SanitizerInterceptor::releaseMemory(ur_context_handle_t Context,
 
     // If quarantine is enabled, cache it
     auto ReleaseList = m_Quarantine->put(AllocInfo->Device, AllocInfoIt);
+    ur_result_t Result = UR_RESULT_SUCCESS;
     if (ReleaseList.size()) {
         std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
         for (auto &It : ReleaseList) {
+            auto &Evicted = It->second;
             getContext()->logger.info("Quarantine Free: {}",
-                                      (void *)It->second->AllocBegin);
-
-            ContextInfo->Stats.UpdateUSMRealFreed(AllocInfo->AllocSize,
-                                                  AllocInfo->getRedzoneSize());
+                                      (void *)Evicted->AllocBegin);
 
-            m_AllocationMap.erase(It);
+            ContextInfo->Stats.UpdateUSMRealFreed(Evicted->AllocSize,
+                                                  Evicted->getRedzoneSize());
 
-            UR_CALL(getContext()->urDdiTable.USM.pfnFree(
-                Context, (void *)(It->second->AllocBegin)));
+            releaseShadowPages(ContextInfo, *Evicted);
+            auto URes =
+                m_Quarantine->release(Evicted->Context, Evicted->AllocBegin);
+            if (URes != UR_RESULT_SUCCESS && Result == UR_RESULT_SUCCESS) {
+                Result = URes;
+            }
+            eraseAllocInfo(It);
         }
     }
     ContextInfo->Stats.UpdateUSMFreed(AllocInfo->AllocSize);
 
-    return UR_RESULT_SUCCESS;
+    // The free of an earlier eviction may have failed in the meantime
+    if (Result == UR_RESULT_SUCCESS) {
+        Result = m_Quarantine->takeReleaseResult();
+    }
+    return Result;
 }
 
 ur_result_t SanitizerInterceptor::preLaunchKernel(ur_kernel_handle_t Kernel,
@@ -394,7 +538,10 @@ ur_result_t SanitizerInterceptor::preLaunchKernel(ur_kernel_handle_t Kernel,
     auto DeviceInfo = getDeviceInfo(Device);
     auto KernelInfo = getKernelInfo(Kernel);
 
-    UR_CALL(LaunchInfo.updateKernelInfo(*KernelInfo.get()));
+    // Poll the launches before, so that their caches can be reused
+    checkLaunches();
+
+    UR_CALL(LaunchInfo.initialize(*KernelInfo.get()));
 
     ManagedQueue InternalQueue(Context, Device);
     if (!InternalQueue) {
@@ -412,43 +559,106 @@ ur_result_t SanitizerInterceptor::preLaunchKernel(ur_kernel_handle_t Kernel,
 
 ur_result_t SanitizerInterceptor::postLaunchKernel(ur_kernel_handle_t Kernel,
                                                    ur_queue_handle_t Queue,
+                                                   ur_event_handle_t Event,
                                                    USMLaunchInfo &LaunchInfo) {
-    // FIXME: We must use block operation here, until we support urEventSetCallback
-    auto Result = getContext()->urDdiTable.Queue.pfnFinish(Queue);
+    std::ignore = Queue;
 
-    if (Result == UR_RESULT_SUCCESS) {
-        for (const auto &AH : LaunchInfo.Data->SanitizerReport) {
-            if (!AH.Flag) {
-                continue;
-            }
-            switch (AH.ErrorType) {
-            case DeviceSanitizerErrorType::USE_AFTER_FREE:
-                ReportUseAfterFree(AH, Kernel, GetContext(Queue));
-                break;
-            case DeviceSanitizerErrorType::OUT_OF_BOUNDS:
-            case DeviceSanitizerErrorType::MISALIGNED:
-            case DeviceSanitizerErrorType::NULL_POINTER:
-                ReportGenericError(AH, Kernel);
-                break;
-            default:
-                ReportFatalError(AH);
+    // The reports are written to shared USM, so they are only read once the
+    // event of the launch has completed, instead of finishing the queue here
+    UR_CALL(getContext()->urDdiTable.Event.pfnRetain(Event));
+    UR_CALL(getContext()->urDdiTable.Kernel.pfnRetain(Kernel));
+    LaunchInfo.OwnsCache = false;
+
+    std::optional<PendingLaunch> Oldest;
+    {
+        std::scoped_lock<ur_mutex> Guard(m_PendingLaunchesMutex);
+        m_PendingLaunches.push_back(
+            PendingLaunch{Event, Kernel, std::move(LaunchInfo.Cache)});
+        if (m_PendingLaunches.size() > MAX_PENDING_LAUNCHES) {
+            Oldest = std::move(m_PendingLaunches.front());
+            m_PendingLaunches.pop_front();
+        }
+    }
+
+    if (Oldest) {
+        getContext()->urDdiTable.Event.pfnWait(1, &Oldest->Event);
+        reportLaunch(*Oldest);
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+void SanitizerInterceptor::checkLaunches(bool Wait,
+                                         ur_context_handle_t Context) {
+    std::vector<PendingLaunch> Completed;
+    {
+        std::scoped_lock<ur_mutex> Guard(m_PendingLaunchesMutex);
+        for (auto It = m_PendingLaunches.begin();
+             It != m_PendingLaunches.end();) {
+            bool Done = Wait && (!Context || It->Cache->Context == Context);
+            if (!Done) {
+                ur_event_status_t Status = UR_EVENT_STATUS_QUEUED;
+                getContext()->urDdiTable.Event.pfnGetInfo(
+                    It->Event, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                    sizeof(Status), &Status, nullptr);
+                Done = Status == UR_EVENT_STATUS_COMPLETE ||
+                       Status == UR_EVENT_STATUS_ERROR;
             }
-            if (!AH.IsRecover) {
-                exit(1);
+            if (Done) {
+                Completed.push_back(std::move(*It));
+                It = m_PendingLaunches.erase(It);
+            } else {
+                ++It;
             }
         }
     }
 
-    return Result;
+    for (auto &Launch : Completed) {
+        if (Wait) {
+            getContext()->urDdiTable.Event.pfnWait(1, &Launch.Event);
+        }
+        reportLaunch(Launch);
+    }
+}
+
+void SanitizerInterceptor::reportLaunch(PendingLaunch &Launch) {
+    auto Kernel = Launch.Kernel;
+    for (const auto &AH : Launch.Cache->Data->SanitizerReport) {
+        if (!AH.Flag) {
+            continue;
+        }
+        switch (AH.ErrorType) {
+        case DeviceSanitizerErrorType::USE_AFTER_FREE:
+            ReportUseAfterFree(AH, Kernel, Launch.Cache->Context);
+            break;
+        case DeviceSanitizerErrorType::OUT_OF_BOUNDS:
+        case DeviceSanitizerErrorType::MISALIGNED:
+        case DeviceSanitizerErrorType::NULL_POINTER:
+            ReportGenericError(AH, Kernel);
+            break;
+        default:
+            ReportFatalError(AH);
+        }
+        if (!AH.IsRecover) {
+            exit(1);
+        }
+    }
+
+    Launch.Cache->releaseLocalShadow();
+    Launch.Cache->InUse.store(false, std::memory_order_release);
+    getContext()->urDdiTable.Kernel.pfnRelease(Kernel);
+    getContext()->urDdiTable.Event.pfnRelease(Launch.Event);
 }
 
 ur_result_t DeviceInfo::allocShadowMemory(ur_context_handle_t Context) {
     if (Type == DeviceType::CPU) {
         UR_CALL(SetupShadowMemoryOnCPU(ShadowOffset, ShadowOffsetEnd));
     } else if (Type == DeviceType::GPU_PVC) {
-        UR_CALL(SetupShadowMemoryOnPVC(Context, ShadowOffset, ShadowOffsetEnd));
+        UR_CALL(SetupShadowMemoryOnPVC(Context, ShadowOffset, ShadowOffsetEnd,
+                                       ShadowPages));
     } else if (Type == DeviceType::GPU_DG2) {
-        UR_CALL(SetupShadowMemoryOnDG2(Context, ShadowOffset, ShadowOffsetEnd));
+        UR_CALL(SetupShadowMemoryOnDG2(Context, ShadowOffset, ShadowOffsetEnd,
+                                       ShadowPages));
     } else {
         getContext()->logger.error("Unsupport device type");
         return UR_RESULT_ERROR_INVALID_ARGUMENT;
@@ -461,6 +671,11 @@ ur_result_t DeviceInfo::allocShadowMemory(ur_context_handle_t Context) {
 
     auto CI = getContext()->interceptor->getContextInfo(Context);
     auto DI = getContext()->interceptor->getDeviceInfo(Handle);
+    if (ShadowPages) {
+        // The null pointer redzone is never released
+        ShadowPages->retain(MemToShadow_GPU(*this, 0),
+                            MemToShadow_GPU(*this, 0));
+    }
     auto URes =
         enqueueMemSetShadow(CI, DI, Queue, 0, 1, kNullPointerRedzoneMagic);
     if (URes != UR_RESULT_SUCCESS) {
@@ -471,98 +686,23 @@ ur_result_t DeviceInfo::allocShadowMemory(ur_context_handle_t Context) {
     return UR_RESULT_SUCCESS;
 }
 
-/// Each 8 bytes of application memory are mapped into one byte of shadow memory
-/// The meaning of that byte:
-///  - Negative: All bytes are not accessible (poisoned)
-///  - 0: All bytes are accessible
-///  - 1 <= k <= 7: Only the first k bytes is accessible
-///
-/// ref: https://github.com/google/sanitizers/wiki/AddressSanitizerAlgorithm#mapping
-ur_result_t SanitizerInterceptor::enqueueAllocInfo(
-    std::shared_ptr<ContextInfo> &ContextInfo,
-    std::shared_ptr<DeviceInfo> &DeviceInfo, ur_queue_handle_t Queue,
-    std::shared_ptr<AllocInfo> &AI) {
-    if (AI->IsReleased) {
-        int ShadowByte;
-        switch (AI->Type) {
-        case AllocType::HOST_USM:
-            ShadowByte = kUsmHostDeallocatedMagic;
-            break;
-        case AllocType::DEVICE_USM:
-            ShadowByte = kUsmDeviceDeallocatedMagic;
-            break;
-        case AllocType::SHARED_USM:
-            ShadowByte = kUsmSharedDeallocatedMagic;
-            break;
-        case AllocType::MEM_BUFFER:
-            ShadowByte = kMemBufferDeallocatedMagic;
-            break;
-        default:
-            ShadowByte = 0xff;
-            assert(false && "Unknow AllocInfo Type");
-        }
-        UR_CALL(enqueueMemSetShadow(ContextInfo, DeviceInfo, Queue,
-                                    AI->AllocBegin, AI->AllocSize, ShadowByte));
-        return UR_RESULT_SUCCESS;
-    }
-
-    // Init zero
-    UR_CALL(enqueueMemSetShadow(ContextInfo, DeviceInfo, Queue, AI->AllocBegin,
-                                AI->AllocSize, 0));
-
-    uptr TailBegin = RoundUpTo(AI->UserEnd, ASAN_SHADOW_GRANULARITY);
-    uptr TailEnd = AI->AllocBegin + AI->AllocSize;
-
-    // User tail
-    if (TailBegin != AI->UserEnd) {
-        auto Value =
-            AI->UserEnd - RoundDownTo(AI->UserEnd, ASAN_SHADOW_GRANULARITY);
-        UR_CALL(enqueueMemSetShadow(ContextInfo, DeviceInfo, Queue, AI->UserEnd,
-                                    1, static_cast<u8>(Value)));
-    }
-
-    int ShadowByte;
-    switch (AI->Type) {
-    case AllocType::HOST_USM:
-        ShadowByte = kUsmHostRedzoneMagic;
-        break;
-    case AllocType::DEVICE_USM:
-        ShadowByte = kUsmDeviceRedzoneMagic;
-        break;
-    case AllocType::SHARED_USM:
-        ShadowByte = kUsmSharedRedzoneMagic;
-        break;
-    case AllocType::MEM_BUFFER:
-        ShadowByte = kMemBufferRedzoneMagic;
-        break;
-    case AllocType::DEVICE_GLOBAL:
-        ShadowByte = kDeviceGlobalRedzoneMagic;
-        break;
-    default:
-        ShadowByte = 0xff;
-        assert(false && "Unknow AllocInfo Type");
-    }
-
-    // Left red zone
-    UR_CALL(enqueueMemSetShadow(ContextInfo, DeviceInfo, Queue, AI->AllocBegin,
-                                AI->UserBegin - AI->AllocBegin, ShadowByte));
-
-    // Right red zone
-    UR_CALL(enqueueMemSetShadow(ContextInfo, DeviceInfo, Queue, TailBegin,
-                                TailEnd - TailBegin, ShadowByte));
-
-    return UR_RESULT_SUCCESS;
-}
-
 ur_result_t SanitizerInterceptor::updateShadowMemory(
     std::shared_ptr<ContextInfo> &ContextInfo,
     std::shared_ptr<DeviceInfo> &DeviceInfo, ur_queue_handle_t Queue) {
     auto &AllocInfos = ContextInfo->AllocInfosMap[DeviceInfo->Handle];
     std::scoped_lock<ur_shared_mutex> Guard(AllocInfos.Mutex);
+    if (AllocInfos.List.empty()) {
+        return UR_RESULT_SUCCESS;
+    }
 
+    ShadowUpdateBatch Batch;
     for (auto &AI : AllocInfos.List) {
-        UR_CALL(enqueueAllocInfo(ContextInfo, DeviceInfo, Queue, AI));
+        Batch.poison(*AI);
     }
+    getContext()->logger.debug(
+        "updateShadowMemory: {} allocation update(s) in {} fill(s)",
+        AllocInfos.List.size(), Batch.size());
+    UR_CALL(Batch.enqueue(ContextInfo, DeviceInfo, Queue));
     AllocInfos.List.clear();
 
     return UR_RESULT_SUCCESS;
@@ -612,8 +752,10 @@ SanitizerInterceptor::registerDeviceGlobals(ur_context_handle_t Context,
                           Context,
                           Device,
                           GetCurrentBacktrace(),
+                          {},
                           {}});
 
+            retainShadowPages(*AI, {Device});
             ContextInfo->insertAllocInfo({Device}, AI);
         }
     }
@@ -794,24 +936,29 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
             return true;
         };
 
-        // Write debug
-        // We use "uint64_t" here because EnqueueWriteGlobal will fail when it's "uint32_t"
-        // Because EnqueueWriteGlobal is a async write, so
-        // we need to extend its lifetime
-        static uint64_t Debug = getOptions().Debug ? 1 : 0;
-        EnqueueWriteGlobal(kSPIR_AsanDebug, &Debug, sizeof(Debug), false);
-
-        // Write shadow memory offset for global memory
-        EnqueueWriteGlobal(kSPIR_AsanShadowMemoryGlobalStart,
-                           &DeviceInfo->ShadowOffset,
-                           sizeof(DeviceInfo->ShadowOffset));
-        EnqueueWriteGlobal(kSPIR_AsanShadowMemoryGlobalEnd,
-                           &DeviceInfo->ShadowOffsetEnd,
-                           sizeof(DeviceInfo->ShadowOffsetEnd));
-
-        // Write device type
-        EnqueueWriteGlobal(kSPIR_DeviceType, &DeviceInfo->Type,
-                           sizeof(DeviceInfo->Type));
+        // Device globals keep their values between launches
+        if (!LaunchInfo.Cache->GlobalsWritten) {
+            // Write debug
+            // We use "uint64_t" here because EnqueueWriteGlobal will fail when it's "uint32_t"
+            // Because EnqueueWriteGlobal is a async write, so
+            // we need to extend its lifetime
+            static uint64_t Debug = getOptions().Debug ? 1 : 0;
+            EnqueueWriteGlobal(kSPIR_AsanDebug, &Debug, sizeof(Debug), false);
+
+            // Write shadow memory offset for global memory
+            EnqueueWriteGlobal(kSPIR_AsanShadowMemoryGlobalStart,
+                               &DeviceInfo->ShadowOffset,
+                               sizeof(DeviceInfo->ShadowOffset));
+            EnqueueWriteGlobal(kSPIR_AsanShadowMemoryGlobalEnd,
+                               &DeviceInfo->ShadowOffsetEnd,
+                               sizeof(DeviceInfo->ShadowOffsetEnd));
+
+            // Write device type
+            EnqueueWriteGlobal(kSPIR_DeviceType, &DeviceInfo->Type,
+                               sizeof(DeviceInfo->Type));
+
+            LaunchInfo.Cache->GlobalsWritten = true;
+        }
 
         if (LaunchInfo.LocalWorkSize.empty()) {
             LaunchInfo.LocalWorkSize.resize(LaunchInfo.WorkDim);
@@ -839,28 +986,6 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
                      LocalWorkSize[Dim];
         }
 
-        auto EnqueueAllocateShadowMemory = [Context = ContextInfo->Handle,
-                                            Device = DeviceInfo->Handle,
-                                            Queue](size_t Size, uptr &Ptr) {
-            void *Allocated = nullptr;
-            auto URes = getContext()->urDdiTable.USM.pfnDeviceAlloc(
-                Context, Device, nullptr, nullptr, Size, &Allocated);
-            if (URes != UR_RESULT_SUCCESS) {
-                return URes;
-            }
-            // Initialize shadow memory
-            URes = urEnqueueUSMSet(Queue, Allocated, 0, Size);
-            if (URes != UR_RESULT_SUCCESS) {
-                [[maybe_unused]] auto URes =
-                    getContext()->urDdiTable.USM.pfnFree(Context, Allocated);
-                assert(URes == UR_RESULT_SUCCESS &&
-                       "urUSMFree failed at allocating shadow memory");
-                Allocated = nullptr;
-            }
-            Ptr = (uptr)Allocated;
-            return URes;
-        };
-
         auto LocalMemoryUsage =
             GetKernelLocalMemorySize(Kernel, DeviceInfo->Handle);
         auto PrivateMemoryUsage =
@@ -885,10 +1010,12 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
                     "LocalShadowMemorySize={})",
                     NumWG, LocalMemorySize, LocalShadowMemorySize);
 
-                if (EnqueueAllocateShadowMemory(
-                        LocalShadowMemorySize,
-                        LaunchInfo.Data->LocalShadowOffset) !=
-                    UR_RESULT_SUCCESS) {
+                auto &Cache = *LaunchInfo.Cache;
+                Cache.LocalShadow = ContextInfo->LocalShadows.acquire(
+                    DeviceInfo->Handle, LocalShadowMemorySize);
+                if (Cache.reserveShadow(Cache.LocalShadow,
+                                        LocalShadowMemorySize, Queue,
+                                        ContextInfo) != UR_RESULT_SUCCESS) {
                     getContext()->logger.warning(
                         "Failed to allocate shadow memory for local "
                         "memory, maybe the number of workgroup ({}) is too "
@@ -898,13 +1025,12 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
                         "Skip checking local memory of kernel <{}>",
                         GetKernelName(Kernel));
                 } else {
+                    LaunchInfo.Data->LocalShadowOffset =
+                        Cache.LocalShadow.Begin;
                     LaunchInfo.Data->LocalShadowOffsetEnd =
                         LaunchInfo.Data->LocalShadowOffset +
                         LocalShadowMemorySize - 1;
 
-                    ContextInfo->Stats.UpdateShadowMalloced(
-                        LocalShadowMemorySize);
-
                     getContext()->logger.info(
                         "ShadowMemory(Local, {} - {})",
                         (void *)LaunchInfo.Data->LocalShadowOffset,
@@ -926,10 +1052,10 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
                                            "PrivateShadowMemorySize={})",
                                            NumWG, PrivateShadowMemorySize);
 
-                if (EnqueueAllocateShadowMemory(
-                        PrivateShadowMemorySize,
-                        LaunchInfo.Data->PrivateShadowOffset) !=
-                    UR_RESULT_SUCCESS) {
+                auto &Cache = *LaunchInfo.Cache;
+                if (Cache.reserveShadow(Cache.PrivateShadow,
+                                        PrivateShadowMemorySize, Queue,
+                                        ContextInfo) != UR_RESULT_SUCCESS) {
                     getContext()->logger.warning(
                         "Failed to allocate shadow memory for private "
                         "memory, maybe the number of workgroup ({}) is too "
@@ -939,13 +1065,12 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
                         "Skip checking private memory of kernel <{}>",
                         GetKernelName(Kernel));
                 } else {
+                    LaunchInfo.Data->PrivateShadowOffset =
+                        Cache.PrivateShadow.Begin;
                     LaunchInfo.Data->PrivateShadowOffsetEnd =
                         LaunchInfo.Data->PrivateShadowOffset +
                         PrivateShadowMemorySize - 1;
 
-                    ContextInfo->Stats.UpdateShadowMalloced(
-                        PrivateShadowMemorySize);
-
                     getContext()->logger.info(
                         "ShadowMemory(Private, {} - {})",
                         (void *)LaunchInfo.Data->PrivateShadowOffset,
@@ -961,16 +1086,67 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
 std::optional<AllocationIterator>
 SanitizerInterceptor::findAllocInfoByAddress(uptr Address) {
     std::shared_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-    auto It = m_AllocationMap.upper_bound(Address);
-    if (It == m_AllocationMap.begin()) {
+    auto It = m_AllocationIndex.find(Address);
+    if (!It) {
         return std::optional<AllocationIterator>{};
     }
-    --It;
-    // Make sure we got the right AllocInfo
-    assert(Address >= It->second->AllocBegin &&
-           Address < It->second->AllocBegin + It->second->AllocSize &&
-           "Wrong AllocInfo for the address");
-    return It;
+    return *It;
+}
+
+void SanitizerInterceptor::retainShadowPages(
+    AllocInfo &AI, const std::vector<ur_device_handle_t> &Devices) {
+    for (auto Device : Devices) {
+        auto DI = getDeviceInfo(Device);
+        if (!DI->ShadowPages) {
+            continue;
+        }
+        DI->ShadowPages->retain(
+            MemToShadow_GPU(*DI, AI.AllocBegin),
+            MemToShadow_GPU(*DI, AI.AllocBegin + AI.AllocSize - 1));
+        AI.ShadowDevices.push_back(Device);
+    }
+}
+
+void SanitizerInterceptor::releaseShadowPages(
+    std::shared_ptr<ContextInfo> &ContextInfo, AllocInfo &AI) {
+    for (auto Device : AI.ShadowDevices) {
+        auto DI = getDeviceInfo(Device);
+        std::vector<ur_context_handle_t> Decommitted;
+        auto URes = DI->ShadowPages->release(
+            MemToShadow_GPU(*DI, AI.AllocBegin),
+            MemToShadow_GPU(*DI, AI.AllocBegin + AI.AllocSize - 1),
+            Decommitted);
+        if (URes != UR_RESULT_SUCCESS) {
+            getContext()->logger.warning(
+                "Failed to decommit shadow memory of {}: {}",
+                (void *)AI.AllocBegin, URes);
+        }
+        for (auto Context : Decommitted) {
+            if (Context == ContextInfo->Handle) {
+                ContextInfo->Stats.UpdateShadowUnmapped(
+                    DI->ShadowPages->getPageSize());
+            }
+        }
+    }
+    AI.ShadowDevices.clear();
+}
+
+void SanitizerInterceptor::eraseAllocInfo(AllocationIterator It) {
+    const auto &AI = It->second;
+    m_AllocationIndex.erase(AI->AllocBegin, AI->AllocBegin + AI->AllocSize);
+    m_AllocationMap.erase(It);
+}
+
+StackTrace SanitizerInterceptor::getAllocStack(size_t Size) {
+    const auto &Options = getOptions();
+    bool Sampled =
+        (Options.AllocStackMinSize && Size >= Options.AllocStackMinSize) ||
+        (Options.AllocStackSampleRate &&
+         m_AllocStackCount.fetch_add(1, std::memory_order_relaxed) %
+                 Options.AllocStackSampleRate ==
+             0);
+    return GetCurrentBacktrace(Sampled ? MAX_BACKTRACE_FRAMES
+                                       : CALLER_BACKTRACE_FRAMES);
 }
 
 std::vector<AllocationIterator>
@@ -987,6 +1163,7 @@ SanitizerInterceptor::findAllocInfoByContext(ur_context_handle_t Context) {
 }
 
 ContextInfo::~ContextInfo() {
+    LocalShadows.clear(Handle, Stats);
     Stats.Print(Handle);
 
     [[maybe_unused]] auto Result =
@@ -1004,60 +1181,26 @@ ContextInfo::~ContextInfo() {
     }
 }
 
-ur_result_t USMLaunchInfo::initialize() {
-    UR_CALL(getContext()->urDdiTable.Context.pfnRetain(Context));
-    UR_CALL(getContext()->urDdiTable.Device.pfnRetain(Device));
-    UR_CALL(getContext()->urDdiTable.USM.pfnSharedAlloc(
-        Context, Device, nullptr, nullptr, sizeof(LaunchInfo), (void **)&Data));
-    *Data = LaunchInfo{};
-    return UR_RESULT_SUCCESS;
-}
-
-ur_result_t USMLaunchInfo::updateKernelInfo(const KernelInfo &KI) {
-    auto NumArgs = KI.LocalArgs.size();
-    if (NumArgs) {
-        Data->NumLocalArgs = NumArgs;
-        UR_CALL(getContext()->urDdiTable.USM.pfnSharedAlloc(
-            Context, Device, nullptr, nullptr, sizeof(LocalArgsInfo) * NumArgs,
-            (void **)&Data->LocalArgs));
-        uint32_t i = 0;
-        for (auto [ArgIndex, ArgInfo] : KI.LocalArgs) {
-            Data->LocalArgs[i++] = ArgInfo;
-            getContext()->logger.debug(
-                "local_args (argIndex={}, size={}, sizeWithRZ={})", ArgIndex,
-                ArgInfo.Size, ArgInfo.SizeWithRedZone);
-        }
-    }
-    return UR_RESULT_SUCCESS;
+LaunchCache::LaunchCache(ur_context_handle_t Context,
+                         ur_device_handle_t Device)
+    : Context(Context), Device(Device) {
+    [[maybe_unused]] auto Result =
+        getContext()->urDdiTable.Context.pfnRetain(Context);
+    assert(Result == UR_RESULT_SUCCESS);
+    Result = getContext()->urDdiTable.Device.pfnRetain(Device);
+    assert(Result == UR_RESULT_SUCCESS);
 }
 
-USMLaunchInfo::~USMLaunchInfo() {
+LaunchCache::~LaunchCache() {
     [[maybe_unused]] ur_result_t Result;
+    freeShadow(PrivateShadow);
+    freeShadow(LocalShadow);
+    if (LocalArgs) {
+        Result = getContext()->urDdiTable.USM.pfnFree(Context,
+                                                       (void *)LocalArgs);
+        assert(Result == UR_RESULT_SUCCESS);
+    }
     if (Data) {
-        auto Type = GetDeviceType(Context, Device);
-        auto ContextInfo = getContext()->interceptor->getContextInfo(Context);
-        if (Type == DeviceType::GPU_PVC || Type == DeviceType::GPU_DG2) {
-            if (Data->PrivateShadowOffset) {
-                ContextInfo->Stats.UpdateShadowFreed(
-                    Data->PrivateShadowOffsetEnd - Data->PrivateShadowOffset +
-                    1);
-                Result = getContext()->urDdiTable.USM.pfnFree(
-                    Context, (void *)Data->PrivateShadowOffset);
-                assert(Result == UR_RESULT_SUCCESS);
-            }
-            if (Data->LocalShadowOffset) {
-                ContextInfo->Stats.UpdateShadowFreed(
-                    Data->LocalShadowOffsetEnd - Data->LocalShadowOffset + 1);
-                Result = getContext()->urDdiTable.USM.pfnFree(
-                    Context, (void *)Data->LocalShadowOffset);
-                assert(Result == UR_RESULT_SUCCESS);
-            }
-        }
-        if (Data->LocalArgs) {
-            Result = getContext()->urDdiTable.USM.pfnFree(
-                Context, (void *)Data->LocalArgs);
-            assert(Result == UR_RESULT_SUCCESS);
-        }
         Result = getContext()->urDdiTable.USM.pfnFree(Context, (void *)Data);
         assert(Result == UR_RESULT_SUCCESS);
     }
@@ -1067,4 +1210,146 @@ USMLaunchInfo::~USMLaunchInfo() {
     assert(Result == UR_RESULT_SUCCESS);
 }
 
+void LaunchCache::freeShadow(ShadowBuffer &Buffer) {
+    if (!Buffer.Begin) {
+        return;
+    }
+    // The statistics are gone if the context was released before the kernel
+    if (auto CI = ShadowOwner.lock()) {
+        CI->Stats.UpdateShadowFreed(Buffer.Size);
+    }
+    [[maybe_unused]] auto Result =
+        getContext()->urDdiTable.USM.pfnFree(Context, (void *)Buffer.Begin);
+    assert(Result == UR_RESULT_SUCCESS);
+    Buffer = ShadowBuffer{};
+}
+
+ur_result_t LaunchCache::reserveShadow(ShadowBuffer &Buffer, size_t Size,
+                                       ur_queue_handle_t Queue,
+                                       std::shared_ptr<ContextInfo> &CI) {
+    ShadowOwner = CI;
+    if (Buffer.Size < Size) {
+        freeShadow(Buffer);
+        void *Allocated = nullptr;
+        UR_CALL(getContext()->urDdiTable.USM.pfnDeviceAlloc(
+            Context, Device, nullptr, nullptr, Size, &Allocated));
+        Buffer.Begin = (uptr)Allocated;
+        Buffer.Size = Size;
+        CI->Stats.UpdateShadowMalloced(Size);
+    }
+    // Initialize shadow memory
+    return urEnqueueUSMSet(Queue, (void *)Buffer.Begin, 0, Size);
+}
+
+void LaunchCache::releaseLocalShadow() {
+    if (!LocalShadow.Begin) {
+        return;
+    }
+    if (auto CI = ShadowOwner.lock()) {
+        CI->LocalShadows.release(Device, LocalShadow);
+        LocalShadow = ShadowBuffer{};
+    } else {
+        freeShadow(LocalShadow);
+    }
+}
+
+ShadowBuffer ShadowBufferPool::acquire(ur_device_handle_t Device,
+                                       size_t Size) {
+    std::scoped_lock<ur_mutex> Guard(Mutex);
+    auto &Free = Buffers[Device];
+    if (Free.empty()) {
+        return ShadowBuffer{};
+    }
+    auto Best = Free.begin();
+    for (auto It = Free.begin(); It != Free.end(); ++It) {
+        bool Fits = It->Size >= Size;
+        bool BestFits = Best->Size >= Size;
+        if (Fits ? !BestFits || It->Size < Best->Size
+                 : !BestFits && It->Size > Best->Size) {
+            Best = It;
+        }
+    }
+    ShadowBuffer Buffer = *Best;
+    Free.erase(Best);
+    return Buffer;
+}
+
+void ShadowBufferPool::release(ur_device_handle_t Device,
+                               ShadowBuffer Buffer) {
+    std::scoped_lock<ur_mutex> Guard(Mutex);
+    Buffers[Device].push_back(Buffer);
+}
+
+void ShadowBufferPool::clear(ur_context_handle_t Context,
+                             AsanStatsWrapper &Stats) {
+    std::scoped_lock<ur_mutex> Guard(Mutex);
+    for (auto &[_, Free] : Buffers) {
+        for (auto &Buffer : Free) {
+            Stats.UpdateShadowFreed(Buffer.Size);
+            [[maybe_unused]] auto Result = getContext()->urDdiTable.USM.pfnFree(
+                Context, (void *)Buffer.Begin);
+            assert(Result == UR_RESULT_SUCCESS);
+        }
+    }
+    Buffers.clear();
+}
+
+ur_result_t USMLaunchInfo::initialize(KernelInfo &KI) {
+    {
+        std::scoped_lock<ur_shared_mutex> Guard(KI.Mutex);
+        auto &Cached = KI.LaunchCaches[Device];
+        if (!Cached) {
+            Cached = std::make_shared<LaunchCache>(Context, Device);
+        }
+        Cache = Cached;
+    }
+
+    if (Cache->InUse.exchange(true, std::memory_order_acquire)) {
+        // Another launch of the kernel on this device hasn't been checked yet,
+        // use private buffers which are freed after this one is
+        Cache = std::make_shared<LaunchCache>(Context, Device);
+        Cache->InUse.store(true, std::memory_order_relaxed);
+    }
+    OwnsCache = true;
+
+    // The previous launch has been checked, so the buffers can be reused
+    if (!Cache->Data) {
+        UR_CALL(getContext()->urDdiTable.USM.pfnSharedAlloc(
+            Context, Device, nullptr, nullptr, sizeof(LaunchInfo),
+            (void **)&Cache->Data));
+    }
+    Data = Cache->Data;
+    *Data = LaunchInfo{};
+
+    std::shared_lock<ur_shared_mutex> Guard(KI.Mutex);
+    auto NumArgs = KI.LocalArgs.size();
+    if (Cache->LocalArgsVersion != KI.LocalArgsVersion) {
+        if (Cache->LocalArgsCapacity < NumArgs) {
+            if (Cache->LocalArgs) {
+                UR_CALL(getContext()->urDdiTable.USM.pfnFree(
+                    Context, (void *)Cache->LocalArgs));
+                Cache->LocalArgs = nullptr;
+                Cache->LocalArgsCapacity = 0;
+            }
+            UR_CALL(getContext()->urDdiTable.USM.pfnSharedAlloc(
+                Context, Device, nullptr, nullptr,
+                sizeof(LocalArgsInfo) * NumArgs, (void **)&Cache->LocalArgs));
+            Cache->LocalArgsCapacity = NumArgs;
+        }
+        uint32_t i = 0;
+        for (auto [ArgIndex, ArgInfo] : KI.LocalArgs) {
+            Cache->LocalArgs[i++] = ArgInfo;
+            getContext()->logger.debug(
+                "local_args (argIndex={}, size={}, sizeWithRZ={})", ArgIndex,
+                ArgInfo.Size, ArgInfo.SizeWithRedZone);
+        }
+        Cache->LocalArgsVersion = KI.LocalArgsVersion;
+    }
+    if (NumArgs) {
+        Data->NumLocalArgs = NumArgs;
+        Data->LocalArgs = Cache->LocalArgs;
+    }
+    return UR_RESULT_SUCCESS;
+}
+
 } // namespace ur_sanitizer_layer
@@ -12,15 +12,20 @@
 
 #pragma once
 
+#include "asan_allocation_index.hpp"
 #include "asan_allocator.hpp"
 #include "asan_buffer.hpp"
 #include "asan_libdevice.hpp"
 #include "asan_options.hpp"
+#include "asan_shadow_setup.hpp"
 #include "asan_statistics.hpp"
 #include "common.hpp"
 #include "ur_sanitizer_layer.hpp"
 
+#include <atomic>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <queue>
 #include <unordered_map>
@@ -30,6 +35,7 @@
 namespace ur_sanitizer_layer {
 
 class Quarantine;
+struct ContextInfo;
 
 struct AllocInfoList {
     std::vector<std::shared_ptr<AllocInfo>> List;
@@ -43,6 +49,8 @@ struct DeviceInfo {
     size_t Alignment = 0;
     uptr ShadowOffset = 0;
     uptr ShadowOffsetEnd = 0;
+    // Physical memory backing of the shadow memory, GPU devices only
+    ShadowPageTable *ShadowPages = nullptr;
 
     // Device features
     bool IsSupportSharedSystemUSM = false;
@@ -80,6 +88,63 @@ struct QueueInfo {
     }
 };
 
+struct ShadowBuffer {
+    uptr Begin = 0;
+    size_t Size = 0;
+};
+
+// The local shadow buffers of a context which no launch is using, so that the
+// launches of any kernel on a device reuse them instead of allocating their own
+struct ShadowBufferPool {
+    // The smallest buffer of Device of at least Size bytes, or else the
+    // largest one, which is empty if there is none
+    ShadowBuffer acquire(ur_device_handle_t Device, size_t Size);
+    void release(ur_device_handle_t Device, ShadowBuffer Buffer);
+    // Frees the buffers, which Stats accounts for
+    void clear(ur_context_handle_t Context, AsanStatsWrapper &Stats);
+
+  private:
+    ur_mutex Mutex;
+    std::unordered_map<ur_device_handle_t, std::vector<ShadowBuffer>> Buffers;
+};
+
+// Device side data used by the launches of a kernel on one device. It is kept
+// across launches, so that they don't need to allocate it again.
+struct LaunchCache {
+    ur_context_handle_t Context;
+    ur_device_handle_t Device;
+
+    // Set while a launch uses the buffers, until its reports are checked
+    std::atomic<bool> InUse{false};
+
+    LaunchInfo *Data = nullptr;
+    LocalArgsInfo *LocalArgs = nullptr;
+    size_t LocalArgsCapacity = 0;
+    // The version of KernelInfo::LocalArgs which is stored in LocalArgs
+    uint64_t LocalArgsVersion = 0;
+
+    ShadowBuffer LocalShadow;
+    ShadowBuffer PrivateShadow;
+    // Shadow memory is accounted to the statistics of this context
+    std::weak_ptr<ContextInfo> ShadowOwner;
+
+    bool GlobalsWritten = false;
+
+    LaunchCache(ur_context_handle_t Context, ur_device_handle_t Device);
+    ~LaunchCache();
+
+    // Makes Buffer at least Size bytes large and zeroes its first Size bytes
+    ur_result_t reserveShadow(ShadowBuffer &Buffer, size_t Size,
+                              ur_queue_handle_t Queue,
+                              std::shared_ptr<ContextInfo> &CI);
+    // Gives LocalShadow back to the pool of its context once the launch which
+    // used it has been checked
+    void releaseLocalShadow();
+
+  private:
+    void freeShadow(ShadowBuffer &Buffer);
+};
+
 struct KernelInfo {
     ur_kernel_handle_t Handle;
     std::atomic<int32_t> RefCount = 1;
@@ -92,6 +157,11 @@ struct KernelInfo {
 
     // Need preserve the order of local arguments
     std::map<uint32_t, LocalArgsInfo> LocalArgs;
+    // Bumped whenever LocalArgs is changed
+    uint64_t LocalArgsVersion = 0;
+
+    std::unordered_map<ur_device_handle_t, std::shared_ptr<LaunchCache>>
+        LaunchCaches;
 
     explicit KernelInfo(ur_kernel_handle_t Kernel) : Handle(Kernel) {
         [[maybe_unused]] auto Result =
@@ -115,6 +185,8 @@ struct ContextInfo {
 
     AsanStatsWrapper Stats;
 
+    ShadowBufferPool LocalShadows;
+
     explicit ContextInfo(ur_context_handle_t Context) : Handle(Context) {
         [[maybe_unused]] auto Result =
             getContext()->urDdiTable.Context.pfnRetain(Context);
@@ -135,6 +207,9 @@ struct ContextInfo {
 
 struct USMLaunchInfo {
     LaunchInfo *Data = nullptr;
+    std::shared_ptr<LaunchCache> Cache;
+    // Whether the launch still has to clear Cache->InUse
+    bool OwnsCache = false;
 
     ur_context_handle_t Context = nullptr;
     ur_device_handle_t Device = nullptr;
@@ -153,12 +228,28 @@ struct USMLaunchInfo {
                 std::vector<size_t>(LocalWorkSize, LocalWorkSize + WorkDim);
         }
     }
-    ~USMLaunchInfo();
 
-    ur_result_t initialize();
-    ur_result_t updateKernelInfo(const KernelInfo &KI);
+    ~USMLaunchInfo() {
+        if (OwnsCache) {
+            Cache->releaseLocalShadow();
+            Cache->InUse.store(false, std::memory_order_release);
+        }
+    }
+
+    ur_result_t initialize(KernelInfo &KI);
+};
+
+// A launch whose reports are checked once its event has completed
+struct PendingLaunch {
+    ur_event_handle_t Event;
+    ur_kernel_handle_t Kernel;
+    std::shared_ptr<LaunchCache> Cache;
 };
 
+// The launches which may be pending before the oldest one is waited for, so
+// that the buffers of their caches don't pile up
+constexpr size_t MAX_PENDING_LAUNCHES = 64;
+
 struct DeviceGlobalInfo {
     uptr Size;
     uptr SizeWithRedZone;
@@ -187,8 +278,14 @@ class SanitizerInterceptor {
 
     ur_result_t postLaunchKernel(ur_kernel_handle_t Kernel,
                                  ur_queue_handle_t Queue,
+                                 ur_event_handle_t Event,
                                  USMLaunchInfo &LaunchInfo);
 
+    /// Reports the errors of the pending launches which have completed. With
+    /// Wait, waits for those of Context first, or for all if it is null.
+    void checkLaunches(bool Wait = false,
+                       ur_context_handle_t Context = nullptr);
+
     ur_result_t insertContext(ur_context_handle_t Context,
                               std::shared_ptr<ContextInfo> &CI);
     ur_result_t eraseContext(ur_context_handle_t Context);
@@ -240,13 +337,17 @@ class SanitizerInterceptor {
     const AsanOptions &getOptions() { return m_Options; }
 
   private:
+    /// m_AllocationMapMutex must be held
+    void eraseAllocInfo(AllocationIterator It);
+
+    void retainShadowPages(AllocInfo &AI,
+                           const std::vector<ur_device_handle_t> &Devices);
+    void releaseShadowPages(std::shared_ptr<ContextInfo> &ContextInfo,
+                            AllocInfo &AI);
+
     ur_result_t updateShadowMemory(std::shared_ptr<ContextInfo> &ContextInfo,
                                    std::shared_ptr<DeviceInfo> &DeviceInfo,
                                    ur_queue_handle_t Queue);
-    ur_result_t enqueueAllocInfo(std::shared_ptr<ContextInfo> &ContextInfo,
-                                 std::shared_ptr<DeviceInfo> &DeviceInfo,
-                                 ur_queue_handle_t Queue,
-                                 std::shared_ptr<AllocInfo> &AI);
 
     /// Initialize Global Variables & Kernel Name at first Launch
     ur_result_t prepareLaunch(std::shared_ptr<ContextInfo> &ContextInfo,
@@ -258,6 +359,12 @@ class SanitizerInterceptor {
     ur_result_t allocShadowMemory(ur_context_handle_t Context,
                                   std::shared_ptr<DeviceInfo> &DeviceInfo);
 
+    /// The backtrace of an allocation or release of Size bytes, only of its
+    /// caller unless it is sampled
+    StackTrace getAllocStack(size_t Size);
+
+    void reportLaunch(PendingLaunch &Launch);
+
   private:
     std::unordered_map<ur_context_handle_t, std::shared_ptr<ContextInfo>>
         m_ContextMap;
@@ -276,11 +383,18 @@ class SanitizerInterceptor {
 
     /// Assumption: all USM chunks are allocated in one VA
     AllocationMap m_AllocationMap;
+    /// Address lookups into m_AllocationMap, guarded by the same mutex
+    AllocationIndex<AllocationIterator> m_AllocationIndex;
     ur_shared_mutex m_AllocationMapMutex;
 
     std::unique_ptr<Quarantine> m_Quarantine;
 
+    /// Oldest first
+    std::deque<PendingLaunch> m_PendingLaunches;
+    ur_mutex m_PendingLaunchesMutex;
+
     AsanOptions m_Options;
+    std::atomic<uint64_t> m_AllocStackCount{0};
 
     std::unordered_set<ur_adapter_handle_t> m_Adapters;
     ur_shared_mutex m_AdaptersMutex;
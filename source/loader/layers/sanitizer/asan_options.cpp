@@ -27,7 +27,7 @@ AsanOptions::AsanOptions() {
         std::stringstream SS;
         SS << "<SANITIZER>[ERROR]: ";
         SS << e.what();
-        getContext()->logger.always(SS.str().c_str());
+        getContext()->logger.always("{}", SS.str());
         die("Sanitizer failed to parse options.\n");
     }
 
@@ -74,7 +74,7 @@ AsanOptions::AsanOptions() {
                     SS << " \"" << S << "\"";
                 }
                 SS << ".";
-                getContext()->logger.error(SS.str().c_str());
+                getContext()->logger.error("{}", SS.str());
                 die("Sanitizer failed to parse options.\n");
             }
         }
@@ -103,6 +103,35 @@ AsanOptions::AsanOptions() {
         }
     }
 
+    KV = OptionsEnvMap->find("alloc_stack_sample_rate");
+    if (KV != OptionsEnvMap->end()) {
+        const auto &Value = KV->second.front();
+        try {
+            auto temp_long = std::stoul(Value);
+            if (temp_long > UINT32_MAX) {
+                throw std::out_of_range("");
+            }
+            AllocStackSampleRate = temp_long;
+        } catch (...) {
+            getContext()->logger.error("\"alloc_stack_sample_rate\" should be "
+                                       "an integer in range[0, {}].",
+                                       UINT32_MAX);
+            die("Sanitizer failed to parse options.\n");
+        }
+    }
+
+    KV = OptionsEnvMap->find("alloc_stack_min_size");
+    if (KV != OptionsEnvMap->end()) {
+        const auto &Value = KV->second.front();
+        try {
+            AllocStackMinSize = std::stoull(Value);
+        } catch (...) {
+            getContext()->logger.error(
+                "\"alloc_stack_min_size\" should be an integer.");
+            die("Sanitizer failed to parse options.\n");
+        }
+    }
+
     KV = OptionsEnvMap->find("redzone");
     if (KV != OptionsEnvMap->end()) {
         const auto &Value = KV->second.front();
@@ -25,6 +25,11 @@ struct AsanOptions {
     bool DetectPrivates = true;
     bool PrintStats = false;
     bool DetectKernelArguments = true;
+    // The full backtrace of every Nth allocation and release is recorded, and
+    // of all of those of at least AllocStackMinSize bytes if it isn't 0. The
+    // others only record their caller.
+    uint32_t AllocStackSampleRate = 1;
+    uint64_t AllocStackMinSize = 0;
 
     explicit AsanOptions();
 };
@@ -11,9 +11,26 @@
  */
 
 #include "asan_quarantine.hpp"
+#include "ur_sanitizer_layer.hpp"
+
+#include <utility>
 
 namespace ur_sanitizer_layer {
 
+Quarantine::Quarantine(size_t MaxQuarantineSize)
+    : m_MaxQuarantineSize(MaxQuarantineSize) {
+    m_ReleaseThread = std::thread([this] { releaseLoop(); });
+}
+
+Quarantine::~Quarantine() {
+    {
+        std::scoped_lock<std::mutex> Guard(m_ReleaseMutex);
+        m_Stopping = true;
+    }
+    m_ReleaseCv.notify_one();
+    m_ReleaseThread.join();
+}
+
 std::vector<AllocationIterator> Quarantine::put(ur_device_handle_t Device,
                                                 AllocationIterator &It) {
     auto &AI = It->second;
@@ -33,4 +50,60 @@ std::vector<AllocationIterator> Quarantine::put(ur_device_handle_t Device,
     return DequeueList;
 }
 
+ur_result_t Quarantine::release(ur_context_handle_t Context,
+                                uptr AllocBegin) {
+    // Keep the context alive until the memory has been freed
+    UR_CALL(getContext()->urDdiTable.Context.pfnRetain(Context));
+    {
+        std::scoped_lock<std::mutex> Guard(m_ReleaseMutex);
+        m_ReleaseList.emplace_back(Context, AllocBegin);
+    }
+    m_ReleaseCv.notify_one();
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t Quarantine::takeReleaseResult() {
+    std::scoped_lock<std::mutex> Guard(m_ReleaseMutex);
+    return std::exchange(m_ReleaseResult, UR_RESULT_SUCCESS);
+}
+
+void Quarantine::releaseLoop() {
+    std::unique_lock<std::mutex> Lock(m_ReleaseMutex);
+    while (true) {
+        m_ReleaseCv.wait(
+            Lock, [this] { return m_Stopping || !m_ReleaseList.empty(); });
+        if (m_ReleaseList.empty()) {
+            // Stopping, and everything has been released
+            return;
+        }
+
+        auto ReleaseList = std::move(m_ReleaseList);
+        m_ReleaseList.clear();
+        Lock.unlock();
+
+        ur_result_t Result = UR_RESULT_SUCCESS;
+        for (auto &[Context, AllocBegin] : ReleaseList) {
+            auto URes = getContext()->urDdiTable.USM.pfnFree(
+                Context, (void *)AllocBegin);
+            if (URes != UR_RESULT_SUCCESS) {
+                getContext()->logger.error("urUSMFree({}): {}",
+                                           (void *)AllocBegin, URes);
+                if (Result == UR_RESULT_SUCCESS) {
+                    Result = URes;
+                }
+            }
+            URes = getContext()->urDdiTable.Context.pfnRelease(Context);
+            if (URes != UR_RESULT_SUCCESS && Result == UR_RESULT_SUCCESS) {
+                Result = URes;
+            }
+        }
+
+        Lock.lock();
+        // Only the first error is kept until it's taken
+        if (m_ReleaseResult == UR_RESULT_SUCCESS) {
+            m_ReleaseResult = Result;
+        }
+    }
+}
+
 } // namespace ur_sanitizer_layer
@@ -14,8 +14,13 @@
 
 #include "asan_allocator.hpp"
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
 #include <queue>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -26,6 +31,9 @@ class QuarantineCache {
     using Element = AllocationIterator;
     using List = std::queue<Element>;
 
+    // Allocations are binned by the log2 of their size
+    static constexpr size_t NumSizeClasses = 64;
+
     // The following methods are not thread safe, use this lock
     ur_mutex Mutex;
 
@@ -33,42 +41,74 @@ class QuarantineCache {
     uptr size() const { return m_Size; }
 
     void enqueue(Element &It) {
-        m_List.push(It);
+        m_Lists[getSizeClass(It->second->AllocSize)].push(It);
         m_Size += It->second->AllocSize;
     }
 
+    // Evicts the oldest allocation of the largest size class, so that small
+    // allocations stay quarantined for as long as possible.
     std::optional<Element> dequeue() {
-        if (m_List.empty()) {
-            return std::optional<Element>{};
+        for (size_t Class = NumSizeClasses; Class-- > 0;) {
+            auto &List = m_Lists[Class];
+            if (List.empty()) {
+                continue;
+            }
+            auto It = List.front();
+            List.pop();
+            m_Size -= It->second->AllocSize;
+            return It;
         }
-        auto It = m_List.front();
-        m_List.pop();
-        m_Size -= It->second->AllocSize;
-        return It;
+        return std::optional<Element>{};
     }
 
   private:
-    List m_List;
+    static size_t getSizeClass(uptr Size) {
+        size_t Class = 0;
+        while (Size >>= 1) {
+            ++Class;
+        }
+        return Class;
+    }
+
+    std::array<List, NumSizeClasses> m_Lists;
     std::atomic_uintptr_t m_Size = 0;
 };
 
 class Quarantine {
   public:
-    explicit Quarantine(size_t MaxQuarantineSize)
-        : m_MaxQuarantineSize(MaxQuarantineSize) {}
+    explicit Quarantine(size_t MaxQuarantineSize);
+    ~Quarantine();
 
     std::vector<AllocationIterator> put(ur_device_handle_t Device,
                                         AllocationIterator &Ptr);
 
+    // Frees evicted memory on a background thread, so that the thread
+    // releasing an allocation doesn't wait for the driver. The context is
+    // retained until then.
+    ur_result_t release(ur_context_handle_t Context, uptr AllocBegin);
+
+    // Returns the first error of the background frees since the last call,
+    // so that it is reported by a later urUSMFree.
+    ur_result_t takeReleaseResult();
+
   private:
     QuarantineCache &getCache(ur_device_handle_t Device) {
         std::scoped_lock<ur_mutex> Guard(m_Mutex);
         return m_Map[Device];
     }
 
+    void releaseLoop();
+
     std::unordered_map<ur_device_handle_t, QuarantineCache> m_Map;
     ur_mutex m_Mutex;
     size_t m_MaxQuarantineSize;
+
+    std::vector<std::pair<ur_context_handle_t, uptr>> m_ReleaseList;
+    std::mutex m_ReleaseMutex;
+    std::condition_variable m_ReleaseCv;
+    ur_result_t m_ReleaseResult = UR_RESULT_SUCCESS;
+    bool m_Stopping = false;
+    std::thread m_ReleaseThread;
 };
 
 } // namespace ur_sanitizer_layer
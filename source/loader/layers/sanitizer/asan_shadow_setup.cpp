@@ -12,9 +12,130 @@
 
 #include "asan_shadow_setup.hpp"
 #include "ur_sanitizer_layer.hpp"
+#include "ur_sanitizer_utils.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
 
 namespace ur_sanitizer_layer {
 
+void ShadowPageTable::retain(uptr Begin, uptr End) {
+    std::scoped_lock<ur_mutex> Guard(m_Mutex);
+    for (uptr Addr = RoundDownTo(Begin, m_PageSize); Addr <= End;
+         Addr += m_PageSize) {
+        m_Pages[Addr].RefCount++;
+    }
+}
+
+ur_result_t
+ShadowPageTable::release(uptr Begin, uptr End,
+                         std::vector<ur_context_handle_t> &Decommitted) {
+    std::scoped_lock<ur_mutex> Guard(m_Mutex);
+    for (uptr Addr = RoundDownTo(Begin, m_PageSize); Addr <= End;
+         Addr += m_PageSize) {
+        auto It = m_Pages.find(Addr);
+        assert(It != m_Pages.end() && It->second.RefCount > 0);
+        if (--It->second.RefCount > 0) {
+            continue;
+        }
+        if (It->second.PhysicalMem) {
+            Decommitted.push_back(It->second.Context);
+            UR_CALL(decommit(Addr, It->second));
+        }
+        m_Pages.erase(It);
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+ShadowPageTable::commit(ur_context_handle_t Context, ur_device_handle_t Device,
+                        uptr Begin, uptr End, std::vector<uptr> &NewPages,
+                        std::vector<std::pair<uptr, uptr>> &Ranges) {
+    std::scoped_lock<ur_mutex> Guard(m_Mutex);
+    std::optional<uptr> RangeBegin;
+    for (uptr Addr = RoundDownTo(Begin, m_PageSize); Addr <= End;
+         Addr += m_PageSize) {
+        auto It = m_Pages.find(Addr);
+        if (It == m_Pages.end()) {
+            // No live allocation is left on this page, so nothing reads it
+            if (RangeBegin) {
+                Ranges.emplace_back(*RangeBegin, Addr - 1);
+                RangeBegin.reset();
+            }
+            continue;
+        }
+
+        auto &P = It->second;
+        if (!P.PhysicalMem) {
+            ur_physical_mem_properties_t Desc{
+                UR_STRUCTURE_TYPE_PHYSICAL_MEM_PROPERTIES, nullptr, 0};
+            auto URes = getContext()->urDdiTable.PhysicalMem.pfnCreate(
+                Context, Device, m_PageSize, &Desc, &P.PhysicalMem);
+            if (URes != UR_RESULT_SUCCESS) {
+                getContext()->logger.error("urPhysicalMemCreate(): {}", URes);
+                P.PhysicalMem = nullptr;
+                return URes;
+            }
+
+            getContext()->logger.debug("urVirtualMemMap: {} ~ {}",
+                                       (void *)Addr,
+                                       (void *)(Addr + m_PageSize - 1));
+
+            URes = getContext()->urDdiTable.VirtualMem.pfnMap(
+                Context, (void *)Addr, m_PageSize, P.PhysicalMem, 0,
+                UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+            if (URes != UR_RESULT_SUCCESS) {
+                getContext()->logger.error("urVirtualMemMap({}, {}): {}",
+                                           (void *)Addr, m_PageSize, URes);
+                getContext()->urDdiTable.PhysicalMem.pfnRelease(P.PhysicalMem);
+                P.PhysicalMem = nullptr;
+                return URes;
+            }
+
+            P.Context = Context;
+            getContext()->urDdiTable.Context.pfnRetain(Context);
+            NewPages.push_back(Addr);
+        }
+
+        if (!RangeBegin) {
+            RangeBegin = std::max(Begin, Addr);
+        }
+    }
+    if (RangeBegin) {
+        Ranges.emplace_back(*RangeBegin, End);
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+void ShadowPageTable::clear() {
+    std::scoped_lock<ur_mutex> Guard(m_Mutex);
+    for (auto &[Addr, P] : m_Pages) {
+        if (P.PhysicalMem) {
+            decommit(Addr, P);
+        }
+    }
+    m_Pages.clear();
+}
+
+ur_result_t ShadowPageTable::decommit(uptr Addr, Page &P) {
+    getContext()->logger.debug("urVirtualMemUnmap: {} ~ {}", (void *)Addr,
+                               (void *)(Addr + m_PageSize - 1));
+
+    auto URes = getContext()->urDdiTable.VirtualMem.pfnUnmap(
+        P.Context, (void *)Addr, m_PageSize);
+    if (URes != UR_RESULT_SUCCESS) {
+        getContext()->logger.error("urVirtualMemUnmap({}, {}): {}",
+                                   (void *)Addr, m_PageSize, URes);
+        return URes;
+    }
+    getContext()->urDdiTable.PhysicalMem.pfnRelease(P.PhysicalMem);
+    getContext()->urDdiTable.Context.pfnRelease(P.Context);
+    P.PhysicalMem = nullptr;
+    P.Context = nullptr;
+    return UR_RESULT_SUCCESS;
+}
+
 namespace cpu {
 
 constexpr size_t SHADOW_SIZE = 0x80000000000ULL;
@@ -73,9 +194,10 @@ uptr LOW_SHADOW_BEGIN;
 uptr HIGH_SHADOW_END;
 
 ur_context_handle_t ShadowContext;
+std::unique_ptr<ShadowPageTable> PageTable;
 
 ur_result_t SetupShadowMemory(ur_context_handle_t Context, uptr &ShadowBegin,
-                              uptr &ShadowEnd) {
+                              uptr &ShadowEnd, ShadowPageTable *&ShadowPages) {
     // Currently, Level-Zero doesn't create independent VAs for each contexts, if we reserve
     // shadow memory for each contexts, this will cause out-of-resource error when user uses
     // multiple contexts. Therefore, we just create one shadow memory here.
@@ -85,6 +207,8 @@ ur_result_t SetupShadowMemory(ur_context_handle_t Context, uptr &ShadowBegin,
             Context, nullptr, SHADOW_SIZE, (void **)&LOW_SHADOW_BEGIN);
         if (Result == UR_RESULT_SUCCESS) {
             HIGH_SHADOW_END = LOW_SHADOW_BEGIN + SHADOW_SIZE;
+            PageTable = std::make_unique<ShadowPageTable>(
+                GetVirtualMemGranularity(Context, nullptr));
             // Retain the context which reserves shadow memory
             ShadowContext = Context;
             getContext()->urDdiTable.Context.pfnRetain(Context);
@@ -93,6 +217,7 @@ ur_result_t SetupShadowMemory(ur_context_handle_t Context, uptr &ShadowBegin,
     }();
     ShadowBegin = LOW_SHADOW_BEGIN;
     ShadowEnd = HIGH_SHADOW_END;
+    ShadowPages = PageTable.get();
     return Result;
 }
 
@@ -101,6 +226,7 @@ ur_result_t DestroyShadowMemory() {
         if (!ShadowContext) {
             return UR_RESULT_SUCCESS;
         }
+        PageTable->clear();
         auto Result = getContext()->urDdiTable.VirtualMem.pfnFree(
             ShadowContext, (const void *)LOW_SHADOW_BEGIN, SHADOW_SIZE);
         getContext()->urDdiTable.Context.pfnRelease(ShadowContext);
@@ -127,9 +253,10 @@ uptr LOW_SHADOW_BEGIN;
 uptr HIGH_SHADOW_END;
 
 ur_context_handle_t ShadowContext;
+std::unique_ptr<ShadowPageTable> PageTable;
 
 ur_result_t SetupShadowMemory(ur_context_handle_t Context, uptr &ShadowBegin,
-                              uptr &ShadowEnd) {
+                              uptr &ShadowEnd, ShadowPageTable *&ShadowPages) {
     // Currently, Level-Zero doesn't create independent VAs for each contexts, if we reserve
     // shadow memory for each contexts, this will cause out-of-resource error when user uses
     // multiple contexts. Therefore, we just create one shadow memory here.
@@ -139,6 +266,8 @@ ur_result_t SetupShadowMemory(ur_context_handle_t Context, uptr &ShadowBegin,
             Context, nullptr, SHADOW_SIZE, (void **)&LOW_SHADOW_BEGIN);
         if (Result == UR_RESULT_SUCCESS) {
             HIGH_SHADOW_END = LOW_SHADOW_BEGIN + SHADOW_SIZE;
+            PageTable = std::make_unique<ShadowPageTable>(
+                GetVirtualMemGranularity(Context, nullptr));
             // Retain the context which reserves shadow memory
             ShadowContext = Context;
             getContext()->urDdiTable.Context.pfnRetain(Context);
@@ -147,6 +276,7 @@ ur_result_t SetupShadowMemory(ur_context_handle_t Context, uptr &ShadowBegin,
     }();
     ShadowBegin = LOW_SHADOW_BEGIN;
     ShadowEnd = HIGH_SHADOW_END;
+    ShadowPages = PageTable.get();
     return Result;
 }
 
@@ -155,6 +285,7 @@ ur_result_t DestroyShadowMemory() {
         if (!ShadowContext) {
             return UR_RESULT_SUCCESS;
         }
+        PageTable->clear();
         auto Result = getContext()->urDdiTable.VirtualMem.pfnFree(
             ShadowContext, (const void *)LOW_SHADOW_BEGIN, SHADOW_SIZE);
         getContext()->urDdiTable.Context.pfnRelease(ShadowContext);
@@ -172,15 +303,19 @@ ur_result_t SetupShadowMemoryOnCPU(uptr &ShadowBegin, uptr &ShadowEnd) {
 ur_result_t DestroyShadowMemoryOnCPU() { return cpu::DestroyShadowMemory(); }
 
 ur_result_t SetupShadowMemoryOnPVC(ur_context_handle_t Context,
-                                   uptr &ShadowBegin, uptr &ShadowEnd) {
-    return pvc::SetupShadowMemory(Context, ShadowBegin, ShadowEnd);
+                                   uptr &ShadowBegin, uptr &ShadowEnd,
+                                   ShadowPageTable *&ShadowPages) {
+    return pvc::SetupShadowMemory(Context, ShadowBegin, ShadowEnd,
+                                  ShadowPages);
 }
 
 ur_result_t DestroyShadowMemoryOnPVC() { return pvc::DestroyShadowMemory(); }
 
 ur_result_t SetupShadowMemoryOnDG2(ur_context_handle_t Context,
-                                   uptr &ShadowBegin, uptr &ShadowEnd) {
-    return dg2::SetupShadowMemory(Context, ShadowBegin, ShadowEnd);
+                                   uptr &ShadowBegin, uptr &ShadowEnd,
+                                   ShadowPageTable *&ShadowPages) {
+    return dg2::SetupShadowMemory(Context, ShadowBegin, ShadowEnd,
+                                  ShadowPages);
 }
 
 ur_result_t DestroyShadowMemoryOnDG2() { return dg2::DestroyShadowMemory(); }
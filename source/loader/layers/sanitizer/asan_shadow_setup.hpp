@@ -14,17 +14,68 @@
 
 #include "common.hpp"
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace ur_sanitizer_layer {
 
+///
+/// Physical memory backing of a GPU shadow memory reservation. A page is
+/// committed when the shadow of a live allocation on it is first written, and
+/// decommitted again once no live allocation is left on it.
+///
+class ShadowPageTable {
+  public:
+    explicit ShadowPageTable(size_t PageSize) : m_PageSize(PageSize) {}
+
+    size_t getPageSize() const { return m_PageSize; }
+
+    // Takes a reference on every page of shadow memory [Begin, End]
+    void retain(uptr Begin, uptr End);
+
+    // Drops the references on the pages of shadow memory [Begin, End], and
+    // decommits the pages which aren't referenced anymore. The context which
+    // committed each of them is appended to Decommitted.
+    ur_result_t release(uptr Begin, uptr End,
+                        std::vector<ur_context_handle_t> &Decommitted);
+
+    // Backs the referenced pages of shadow memory [Begin, End] with physical
+    // memory. Pages committed by this call are appended to NewPages, and the
+    // parts of [Begin, End] which lie on committed pages to Ranges.
+    ur_result_t commit(ur_context_handle_t Context, ur_device_handle_t Device,
+                       uptr Begin, uptr End, std::vector<uptr> &NewPages,
+                       std::vector<std::pair<uptr, uptr>> &Ranges);
+
+    // Decommits all pages
+    void clear();
+
+  private:
+    struct Page {
+        size_t RefCount = 0;
+        // Retained while the page is committed
+        ur_context_handle_t Context = nullptr;
+        ur_physical_mem_handle_t PhysicalMem = nullptr;
+    };
+
+    ur_result_t decommit(uptr Addr, Page &P);
+
+    const size_t m_PageSize;
+    ur_mutex m_Mutex;
+    std::unordered_map<uptr, Page> m_Pages;
+};
+
 ur_result_t SetupShadowMemoryOnCPU(uptr &ShadowBegin, uptr &ShadowEnd);
 ur_result_t DestroyShadowMemoryOnCPU();
 
 ur_result_t SetupShadowMemoryOnPVC(ur_context_handle_t Context,
-                                   uptr &ShadowBegin, uptr &ShadowEnd);
+                                   uptr &ShadowBegin, uptr &ShadowEnd,
+                                   ShadowPageTable *&ShadowPages);
 ur_result_t DestroyShadowMemoryOnPVC();
 
 ur_result_t SetupShadowMemoryOnDG2(ur_context_handle_t Context,
-                                   uptr &ShadowBegin, uptr &ShadowEnd);
+                                   uptr &ShadowBegin, uptr &ShadowEnd,
+                                   ShadowPageTable *&ShadowPages);
 ur_result_t DestroyShadowMemoryOnDG2();
 
 } // namespace ur_sanitizer_layer
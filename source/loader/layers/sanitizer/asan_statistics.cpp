@@ -24,6 +24,7 @@ struct AsanStats {
     void UpdateUSMRealFreed(uptr FreedSize, uptr RedzoneSize);
 
     void UpdateShadowMmaped(uptr ShadowSize);
+    void UpdateShadowUnmapped(uptr ShadowSize);
     void UpdateShadowMalloced(uptr ShadowSize);
     void UpdateShadowFreed(uptr ShadowSize);
 
@@ -83,6 +84,13 @@ void AsanStats::UpdateShadowMmaped(uptr ShadowSize) {
     UpdateOverhead();
 }
 
+void AsanStats::UpdateShadowUnmapped(uptr ShadowSize) {
+    ShadowMmaped -= ShadowSize;
+    getContext()->logger.debug("Stats: UpdateShadowUnmapped(ShadowMmaped={})",
+                               ShadowMmaped);
+    UpdateOverhead();
+}
+
 void AsanStats::UpdateShadowMalloced(uptr ShadowSize) {
     ShadowMalloced += ShadowSize;
     getContext()->logger.debug("Stats: UpdateShadowMalloced(ShadowMalloced={})",
@@ -131,6 +139,12 @@ void AsanStatsWrapper::UpdateShadowMmaped(uptr ShadowSize) {
     }
 }
 
+void AsanStatsWrapper::UpdateShadowUnmapped(uptr ShadowSize) {
+    if (Stat) {
+        Stat->UpdateShadowUnmapped(ShadowSize);
+    }
+}
+
 void AsanStatsWrapper::UpdateShadowMalloced(uptr ShadowSize) {
     if (Stat) {
         Stat->UpdateShadowMalloced(ShadowSize);
@@ -28,6 +28,7 @@ struct AsanStatsWrapper {
     void UpdateUSMRealFreed(uptr FreedSize, uptr RedzoneSize);
 
     void UpdateShadowMmaped(uptr ShadowSize);
+    void UpdateShadowUnmapped(uptr ShadowSize);
     void UpdateShadowMalloced(uptr ShadowSize);
     void UpdateShadowFreed(uptr ShadowSize);
 
@@ -9,24 +9,37 @@
  */
 #include "stacktrace.hpp"
 
+#include <algorithm>
 #include <execinfo.h>
 #include <string>
 
 namespace ur_sanitizer_layer {
 
-StackTrace GetCurrentBacktrace() {
+StackTrace GetCurrentBacktrace(size_t MaxFrames) {
+    MaxFrames = std::min(MaxFrames, MAX_BACKTRACE_FRAMES);
+
     void *Frames[MAX_BACKTRACE_FRAMES];
-    int FrameCount = backtrace(Frames, MAX_BACKTRACE_FRAMES);
-    char **Symbols = backtrace_symbols(Frames, FrameCount);
+    int FrameCount = backtrace(Frames, static_cast<int>(MaxFrames));
+
+    StackTrace Stack;
+    Stack.frames.assign(Frames, Frames + FrameCount);
+    Stack.callerOnly = MaxFrames < MAX_BACKTRACE_FRAMES;
+
+    return Stack;
+}
+
+std::vector<BacktraceInfo>
+SymbolizeBacktrace(const std::vector<void *> &Frames) {
+    std::vector<BacktraceInfo> Stack;
+    char **Symbols =
+        backtrace_symbols(Frames.data(), static_cast<int>(Frames.size()));
 
     if (Symbols == nullptr) {
-        return StackTrace();
+        return Stack;
     }
 
-    StackTrace Stack;
-    for (int i = 0; i < FrameCount; i++) {
-        BacktraceInfo addr_info(Symbols[i]);
-        Stack.stack.emplace_back(addr_info);
+    for (size_t i = 0; i < Frames.size(); i++) {
+        Stack.emplace_back(Symbols[i]);
     }
     free(Symbols);
 
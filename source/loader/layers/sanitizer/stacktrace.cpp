@@ -80,6 +80,7 @@ SourceInfo ParseSymbolizerOutput(const std::string &Output) {
 } // namespace
 
 void StackTrace::print() const {
+    auto stack = SymbolizeBacktrace(frames);
     if (!stack.size()) {
         getContext()->logger.always("  failed to acquire backtrace");
     }
@@ -87,6 +88,10 @@ void StackTrace::print() const {
     unsigned index = 0;
 
     for (auto &BI : stack) {
+        if (callerOnly && index) {
+            break;
+        }
+
         // Skip runtime modules
         if (Contains(BI, "libsycl.so") ||
             Contains(BI, "libpi_unified_runtime.so") ||
@@ -122,6 +127,10 @@ void StackTrace::print() const {
         }
         ++index;
     }
+    if (callerOnly) {
+        getContext()->logger.always(
+            "  (only the caller was recorded, the backtrace wasn't sampled)");
+    }
     getContext()->logger.always("");
 }
 
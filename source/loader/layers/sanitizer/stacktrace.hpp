@@ -19,13 +19,23 @@
 namespace ur_sanitizer_layer {
 
 constexpr size_t MAX_BACKTRACE_FRAMES = 64;
+// Enough frames to reach the caller of the runtime through the layers of the
+// SYCL runtime and the loader, for the backtraces which aren't sampled
+constexpr size_t CALLER_BACKTRACE_FRAMES = 8;
 
 struct StackTrace {
-    std::vector<BacktraceInfo> stack;
+    // The return addresses of the frames, which are only symbolized when the
+    // backtrace is printed in a report
+    std::vector<void *> frames;
+    // Whether only the caller of the runtime should be printed
+    bool callerOnly = false;
 
     void print() const;
 };
 
-StackTrace GetCurrentBacktrace();
+StackTrace GetCurrentBacktrace(size_t MaxFrames = MAX_BACKTRACE_FRAMES);
+
+std::vector<BacktraceInfo>
+SymbolizeBacktrace(const std::vector<void *> &Frames);
 
 } // namespace ur_sanitizer_layer
@@ -325,7 +325,6 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
     USMLaunchInfo LaunchInfo(GetContext(hQueue), GetDevice(hQueue),
                              pGlobalWorkSize, pLocalWorkSize, pGlobalWorkOffset,
                              workDim);
-    UR_CALL(LaunchInfo.initialize());
 
     UR_CALL(getContext()->interceptor->preLaunchKernel(hKernel, hQueue,
                                                        LaunchInfo));
@@ -337,17 +336,62 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
                         numEventsInWaitList, phEventWaitList, &hEvent);
 
     if (result == UR_RESULT_SUCCESS) {
-        UR_CALL(getContext()->interceptor->postLaunchKernel(hKernel, hQueue,
-                                                            LaunchInfo));
+        UR_CALL(getContext()->interceptor->postLaunchKernel(
+            hKernel, hQueue, hEvent, LaunchInfo));
     }
 
     if (phEvent) {
         *phEvent = hEvent;
+    } else if (hEvent) {
+        UR_CALL(getContext()->urDdiTable.Event.pfnRelease(hEvent));
     }
 
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueFinish
+__urdlllocal ur_result_t UR_APICALL urQueueFinish(
+    ur_queue_handle_t hQueue ///< [in] handle of the queue to be finished.
+) {
+    auto pfnFinish = getContext()->urDdiTable.Queue.pfnFinish;
+
+    if (nullptr == pfnFinish) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    getContext()->logger.debug("==== urQueueFinish");
+
+    ur_result_t result = pfnFinish(hQueue);
+
+    getContext()->interceptor->checkLaunches();
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventWait
+__urdlllocal ur_result_t UR_APICALL urEventWait(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+                        ///< completion
+) {
+    auto pfnWait = getContext()->urDdiTable.Event.pfnWait;
+
+    if (nullptr == pfnWait) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    getContext()->logger.debug("==== urEventWait");
+
+    ur_result_t result = pfnWait(numEvents, phEventWaitList);
+
+    getContext()->interceptor->checkLaunches();
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urContextCreate
 __urdlllocal ur_result_t UR_APICALL urContextCreate(
@@ -452,6 +496,7 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
     auto ContextInfo = getContext()->interceptor->getContextInfo(hContext);
     UR_ASSERT(ContextInfo != nullptr, UR_RESULT_ERROR_INVALID_VALUE);
     if (--ContextInfo->RefCount == 0) {
+        getContext()->interceptor->checkLaunches(true, hContext);
         UR_CALL(getContext()->interceptor->eraseContext(hContext));
     }
 
@@ -1353,7 +1398,12 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         // TODO: get local variable alignment
         auto argSizeWithRZ = GetSizeAndRedzoneSizeForLocal(
             argSize, ASAN_SHADOW_GRANULARITY, ASAN_SHADOW_GRANULARITY);
-        KI->LocalArgs[argIndex] = LocalArgsInfo{argSize, argSizeWithRZ};
+        auto [It, Inserted] = KI->LocalArgs.try_emplace(
+            argIndex, LocalArgsInfo{argSize, argSizeWithRZ});
+        if (Inserted || It->second.Size != argSize) {
+            It->second = LocalArgsInfo{argSize, argSizeWithRZ};
+            KI->LocalArgsVersion++;
+        }
         argSize = argSizeWithRZ;
     }
 
@@ -1667,6 +1717,66 @@ __urdlllocal ur_result_t UR_APICALL urGetUSMProcAddrTable(
 
     return result;
 }
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Queue table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetQueueProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_sanitizer_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_sanitizer_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnFinish = ur_sanitizer_layer::urQueueFinish;
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Event table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetEventProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_event_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_sanitizer_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_sanitizer_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnWait = ur_sanitizer_layer::urEventWait;
+
+    return result;
+}
 
 ur_result_t context_t::init(ur_dditable_t *dditable,
                             const std::set<std::string> &enabledLayerNames,
@@ -1689,11 +1799,13 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
 
     if (enabledType == SanitizerType::AddressSanitizer) {
         if (!(dditable->VirtualMem.pfnReserve && dditable->VirtualMem.pfnMap &&
+              dditable->VirtualMem.pfnUnmap &&
               dditable->VirtualMem.pfnGranularityGetInfo)) {
             die("Some VirtualMem APIs are needed to enable UR_LAYER_ASAN");
         }
 
-        if (!dditable->PhysicalMem.pfnCreate) {
+        if (!(dditable->PhysicalMem.pfnCreate &&
+              dditable->PhysicalMem.pfnRelease)) {
             die("Some PhysicalMem APIs are needed to enable UR_LAYER_ASAN");
         }
     }
@@ -1745,6 +1857,16 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
             UR_API_VERSION_CURRENT, &dditable->USM);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_sanitizer_layer::urGetQueueProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->Queue);
+    }
+
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_sanitizer_layer::urGetEventProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->Event);
+    }
+
     return result;
 }
 
@@ -0,0 +1,122 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_tracing_binary.hpp
+ *
+ * Binary trace format written by the tracing layer when it is configured with
+ * a binary output file, and the per-thread sink that produces it. The format
+ * is shared with the offline decoder in tools/urtrace.
+ *
+ */
+
+#ifndef UR_TRACING_BINARY_H
+#define UR_TRACING_BINARY_H 1
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace ur_tracing_layer {
+namespace binary {
+
+constexpr char FILE_MAGIC[8] = {'U', 'R', 'T', 'R', 'A', 'C', 'E', 'B'};
+constexpr uint32_t FILE_VERSION = 1;
+
+/// Number of leading call arguments captured in each begin record.
+constexpr size_t MAX_ARGS = 4;
+
+enum record_kind_t : uint16_t {
+    /// Maps functionId to a name. Followed by args[0] bytes of the name.
+    RECORD_NAME = 0,
+    RECORD_BEGIN = 1,
+    RECORD_END = 2,
+    /// args[0] records were lost on threadIndex because its buffer was full.
+    RECORD_DROPPED = 3,
+};
+
+struct file_header_t {
+    char magic[sizeof(FILE_MAGIC)];
+    uint32_t version;
+    uint32_t recordSize;
+};
+
+struct record_t {
+    uint64_t timestamp; ///< steady clock, in nanoseconds
+    uint64_t instance;  ///< correlates begin and end records
+    uint16_t kind;      ///< record_kind_t
+    uint16_t numArgs;   ///< total number of call arguments
+    uint32_t functionId;
+    uint32_t threadIndex;
+    int32_t result; ///< ur_result_t, end records only
+    /// Raw values of the first MAX_ARGS arguments, begin records only.
+    /// Arguments that are wider than 8 bytes are recorded as 0.
+    uint64_t args[MAX_ARGS];
+};
+static_assert(sizeof(record_t) == 64, "records are one cache line");
+
+template <typename T> inline uint64_t snapshotArg(const T &value) {
+    if constexpr (std::is_trivially_copyable_v<T> &&
+                  sizeof(T) <= sizeof(uint64_t)) {
+        uint64_t raw = 0;
+        std::memcpy(&raw, &value, sizeof(T));
+        return raw;
+    } else {
+        return 0;
+    }
+}
+
+template <typename... Args>
+inline void snapshotArgs(record_t &record, const Args &...values) {
+    size_t i = 0;
+    ((i < MAX_ARGS ? (void)(record.args[i++] = snapshotArg(values)) : (void)0),
+     ...);
+    record.numArgs = static_cast<uint16_t>(sizeof...(Args));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Fixed capacity single-producer single-consumer ring buffer.
+template <typename T, size_t capacity> class spsc_ring_t {
+    static_assert((capacity & (capacity - 1)) == 0,
+                  "capacity must be a power of two");
+
+  public:
+    /// Called only by the producer. Returns false when the ring is full.
+    bool push(const T &value) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == capacity) {
+            return false;
+        }
+        slots[h & (capacity - 1)] = value;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Called only by the consumer. Invokes f on every available element.
+    template <typename F> size_t drain(F &&f) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t h = head.load(std::memory_order_acquire);
+        size_t count = h - t;
+        for (; t != h; ++t) {
+            f(slots[t & (capacity - 1)]);
+        }
+        tail.store(t, std::memory_order_release);
+        return count;
+    }
+
+  private:
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+    T slots[capacity];
+};
+
+} // namespace binary
+} // namespace ur_tracing_layer
+
+#endif /* UR_TRACING_BINARY_H */
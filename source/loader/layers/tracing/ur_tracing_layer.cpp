@@ -14,9 +14,15 @@
 #include "ur_util.hpp"
 #include "xpti/xpti_data_types.h"
 #include "xpti/xpti_trace_framework.h"
+#include <algorithm>
 #include <atomic>
 #include <optional>
+#include <regex>
+#include <stdexcept>
 #include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 
 namespace ur_tracing_layer {
 context_t *getContext() { return context_t::get_direct(); }
@@ -40,9 +46,71 @@ static std::shared_ptr<XptiContextManager> xptiContextManagerGet() {
 };
 static thread_local xpti_td *activeEvent;
 
+///////////////////////////////////////////////////////////////////////////////
+/// The XPTI events of the code locations returned by the code location
+/// callback, so that the payload and the event, which hash the strings of the
+/// location and take the locks of the framework, are only made once per call
+/// site. The locations are compared by value, as the callback may return the
+/// same location in different buffers, or reuse a buffer. It's kept per
+/// thread so the lookups take no lock.
+class codeloc_events_t {
+  public:
+    xpti_td *get(const ur_code_location_t &loc) {
+        std::string_view function = str(loc.functionName);
+        std::string_view file = str(loc.sourceFile);
+        size_t hash = std::hash<std::string_view>{}(function);
+        hash = hash * 31 + std::hash<std::string_view>{}(file);
+        hash = hash * 31 + loc.lineNumber;
+        hash = hash * 31 + loc.columnNumber;
+
+        auto [begin, end] = events.equal_range(hash);
+        for (auto it = begin; it != end; ++it) {
+            auto &entry = it->second;
+            if (entry.line == loc.lineNumber &&
+                entry.column == loc.columnNumber &&
+                entry.function == function && entry.file == file) {
+                return entry.event;
+            }
+        }
+
+        // Bounds the memory if the locations are generated
+        if (events.size() >= max_events) {
+            events.clear();
+        }
+        xpti::payload_t payload =
+            xpti::payload_t(loc.functionName, loc.sourceFile, loc.lineNumber,
+                            loc.columnNumber, nullptr);
+        uint64_t InstanceNumber{};
+        xpti_td *event = xptiMakeEvent("Unified Runtime call", &payload,
+                                       xpti::trace_graph_event,
+                                       xpti_at::active, &InstanceNumber);
+        events.emplace(hash, entry_t{std::string(function), std::string(file),
+                                     loc.lineNumber, loc.columnNumber, event});
+        return event;
+    }
+
+  private:
+    static constexpr size_t max_events = 4096;
+
+    struct entry_t {
+        std::string function;
+        std::string file;
+        uint32_t line;
+        uint32_t column;
+        xpti_td *event;
+    };
+
+    static std::string_view str(const char *s) { return s ? s : ""; }
+
+    std::unordered_multimap<size_t, entry_t> events;
+};
+
+static thread_local codeloc_events_t codelocEvents;
+
 ///////////////////////////////////////////////////////////////////////////////
 context_t::context_t() : logger(logger::create_logger("tracing", true, true)) {
     this->xptiContextManager = xptiContextManagerGet();
+    functionEnabled.fill(true);
 
     call_stream_id = xptiRegisterStream(CALL_STREAM_NAME);
     std::ostringstream streamv;
@@ -51,6 +119,126 @@ context_t::context_t() : logger(logger::create_logger("tracing", true, true)) {
                    streamv.str().data());
 }
 
+void context_t::configure() {
+    binarySink.reset();
+    functionEnabled.fill(true);
+    samplingEnabled = false;
+    sampleEvery = 1;
+    sampleWindow = samplePeriod = std::chrono::nanoseconds(0);
+
+    std::optional<EnvVarMap> options;
+    try {
+        options = getenv_to_map("UR_LAYER_TRACING_OPTIONS");
+    } catch (const std::invalid_argument &e) {
+        logger.error("unable to parse UR_LAYER_TRACING_OPTIONS: {}", e.what());
+        return;
+    }
+    if (!options) {
+        return;
+    }
+
+    for (auto &[key, values] : *options) {
+        if (key == "binary_output" && values.size() == 1) {
+            binarySink = binary_sink_t::create(values.front(), logger);
+        } else if (key == "filter" && !values.empty()) {
+            // The map splits values on commas, which are valid in a regex.
+            std::string filter = values.front();
+            for (size_t i = 1; i < values.size(); ++i) {
+                filter += "," + values[i];
+            }
+            applyFilter(filter);
+        } else if (key == "sample_every" && values.size() == 1) {
+            try {
+                sampleEvery = static_cast<uint32_t>(
+                    std::max(1ul, std::stoul(values.front())));
+            } catch (const std::exception &) {
+                logger.error("invalid sample_every value {}", values.front());
+            }
+        } else if (key == "sample_window" && values.size() == 2) {
+            // <window ms>,<period s>
+            try {
+                sampleWindow = std::chrono::milliseconds(
+                    std::stoul(values.front()));
+                samplePeriod =
+                    std::chrono::seconds(std::stoul(values.back()));
+            } catch (const std::exception &) {
+                logger.error("invalid sample_window value {},{}",
+                             values.front(), values.back());
+                sampleWindow = samplePeriod = std::chrono::nanoseconds(0);
+            }
+        } else {
+            logger.warning("unknown or malformed UR_LAYER_TRACING_OPTIONS "
+                           "option {}",
+                           key);
+        }
+    }
+
+    // A window covering the whole period is the same as no window.
+    if (samplePeriod.count() && sampleWindow >= samplePeriod) {
+        sampleWindow = samplePeriod = std::chrono::nanoseconds(0);
+    }
+    samplingEnabled = sampleEvery > 1 || samplePeriod.count();
+    sampleStart = std::chrono::steady_clock::now();
+    if (samplingEnabled) {
+        logger.debug("sampling every {} call(s) of each function", sampleEvery);
+    }
+    if (samplePeriod.count()) {
+        logger.debug("sampling only {}ms out of every {}s",
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        sampleWindow)
+                        .count(),
+                    std::chrono::duration_cast<std::chrono::seconds>(
+                        samplePeriod)
+                        .count());
+    }
+}
+
+void context_t::applyFilter(const std::string &filter) {
+    std::regex regex;
+    try {
+        regex = std::regex(filter);
+    } catch (const std::regex_error &e) {
+        logger.error("invalid filter regex {}: {}", filter, e.what());
+        return;
+    }
+
+    // Resolve the filter once so that the wrappers only need to check
+    // functionEnabled.
+    functionEnabled.fill(false);
+    size_t enabled = 0;
+    for (auto &[id, name] : getTracedFunctions()) {
+        if (id < max_function_id && std::regex_match(name, regex)) {
+            functionEnabled[id] = true;
+            ++enabled;
+        }
+    }
+    logger.debug("filter {} selects {} functions", filter, enabled);
+}
+
+bool context_t::sample(uint32_t id) {
+    if (sampleEvery > 1) {
+        // Counted per thread so that sampling doesn't contend on shared
+        // counters. Functions past the end of the table are always counted.
+        static thread_local uint32_t callCounts[max_function_id];
+        if (id < std::size(callCounts) && callCounts[id]++ % sampleEvery) {
+            return false;
+        }
+    }
+    if (samplePeriod.count()) {
+        auto elapsed = std::chrono::steady_clock::now() - sampleStart;
+        if (elapsed % samplePeriod >= sampleWindow) {
+            return false;
+        }
+    }
+    return true;
+}
+
+ur_result_t context_t::tearDown() {
+    // Drains all outstanding records and closes the output file.
+    binarySink.reset();
+    return UR_RESULT_SUCCESS;
+}
+
 void context_t::notify(uint16_t trace_type, uint32_t id, const char *name,
                        void *args, ur_result_t *resultp, uint64_t instance) {
     xpti::function_with_args_t payload{id, name, args, resultp, nullptr};
@@ -60,13 +248,7 @@ void context_t::notify(uint16_t trace_type, uint32_t id, const char *name,
 
 uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args) {
     if (auto loc = codelocData.get_codeloc()) {
-        xpti::payload_t payload =
-            xpti::payload_t(loc->functionName, loc->sourceFile, loc->lineNumber,
-                            loc->columnNumber, nullptr);
-        uint64_t InstanceNumber{};
-        activeEvent = xptiMakeEvent("Unified Runtime call", &payload,
-                                    xpti::trace_graph_event, xpti_at::active,
-                                    &InstanceNumber);
+        activeEvent = codelocEvents.get(*loc);
     }
 
     uint64_t instance = xptiGetUniqueId();
@@ -77,6 +259,10 @@ uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args) {
 
 void context_t::notify_end(uint32_t id, const char *name, void *args,
                            ur_result_t *resultp, uint64_t instance) {
+    if (binarySink) {
+        binarySink->end(id, *resultp, instance);
+        return;
+    }
     notify((uint16_t)xpti::trace_point_type_t::function_with_args_end, id, name,
            args, resultp, instance);
 }
@@ -16,8 +16,12 @@
 #include "logger/ur_logger.hpp"
 #include "ur_ddi.h"
 #include "ur_proxy_layer.hpp"
+#include "ur_tracing_sink.hpp"
 #include "ur_util.hpp"
 
+#include <array>
+#include <chrono>
+
 #define TRACING_COMP_NAME "tracing layer"
 
 namespace ur_tracing_layer {
@@ -38,12 +42,33 @@ class __urdlllocal context_t : public proxy_layer_context_t,
     ur_result_t init(ur_dditable_t *dditable,
                      const std::set<std::string> &enabledLayerNames,
                      codeloc_data codelocData) override;
-    ur_result_t tearDown() override { return UR_RESULT_SUCCESS; }
+    ur_result_t tearDown() override;
+
+    /// Returns whether this call of function id should be traced. Calls that
+    /// are filtered out or not sampled go straight to the next layer.
+    bool isTraced(uint32_t id) {
+        return (id >= max_function_id || functionEnabled[id]) &&
+               (!samplingEnabled || sample(id));
+    }
+
+    /// Called with the call's arguments as well, so that they can be captured
+    /// by the binary sink without going through args.
+    template <typename... Args>
+    uint64_t notify_begin(uint32_t id, const char *name, void *args,
+                          const Args &...values) {
+        if (binarySink) {
+            return binarySink->begin(id, name, values...);
+        }
+        return notify_begin(id, name, args);
+    }
     uint64_t notify_begin(uint32_t id, const char *name, void *args);
     void notify_end(uint32_t id, const char *name, void *args,
                     ur_result_t *resultp, uint64_t instance);
 
   private:
+    void configure();
+    void applyFilter(const std::string &filter);
+    bool sample(uint32_t id);
     void notify(uint16_t trace_type, uint32_t id, const char *name, void *args,
                 ur_result_t *resultp, uint64_t instance);
     uint8_t call_stream_id;
@@ -51,9 +76,28 @@ class __urdlllocal context_t : public proxy_layer_context_t,
     inline static const std::string name = "UR_LAYER_TRACING";
 
     std::shared_ptr<XptiContextManager> xptiContextManager;
+
+    /// Set when UR_LAYER_TRACING_OPTIONS selects a binary output file, in
+    /// which case XPTI subscribers are not notified.
+    std::unique_ptr<binary_sink_t> binarySink;
+
+    /// Functions selected by the filter option of UR_LAYER_TRACING_OPTIONS.
+    static constexpr uint32_t max_function_id = 1024;
+    std::array<bool, max_function_id> functionEnabled;
+
+    /// Sampling configured through UR_LAYER_TRACING_OPTIONS. Every
+    /// sampleEvery-th call of each function (counted per thread) is traced,
+    /// and only during the first sampleWindow of every samplePeriod.
+    bool samplingEnabled = false;
+    uint32_t sampleEvery = 1;
+    std::chrono::nanoseconds sampleWindow{0};
+    std::chrono::nanoseconds samplePeriod{0};
+    std::chrono::steady_clock::time_point sampleStart;
 };
 
 context_t *getContext();
+
+std::vector<std::pair<uint32_t, const char *>> getTracedFunctions();
 } // namespace ur_tracing_layer
 
 #endif /* UR_TRACING_LAYER_H */
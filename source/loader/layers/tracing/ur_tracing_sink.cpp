@@ -0,0 +1,174 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_tracing_sink.cpp
+ *
+ */
+
+#include "ur_tracing_sink.hpp"
+
+namespace ur_tracing_layer {
+
+namespace {
+// Sinks can be created and destroyed repeatedly (urLoaderInit/TearDown), so
+// each thread remembers which sink its cached buffer belongs to.
+struct thread_slot_t {
+    uint64_t sinkId = 0;
+    void *buffer = nullptr;
+};
+thread_local thread_slot_t threadSlot;
+std::atomic<uint64_t> nextSinkId{1};
+
+uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // namespace
+
+std::unique_ptr<binary_sink_t> binary_sink_t::create(const std::string &path,
+                                                     logger::Logger &logger) {
+    FILE *file = fopen(path.c_str(), "wb");
+    if (!file) {
+        logger.error("unable to open binary trace output file {}", path);
+        return nullptr;
+    }
+
+    binary::file_header_t header{};
+    std::memcpy(header.magic, binary::FILE_MAGIC, sizeof(header.magic));
+    header.version = binary::FILE_VERSION;
+    header.recordSize = sizeof(binary::record_t);
+    if (fwrite(&header, sizeof(header), 1, file) != 1) {
+        logger.error("unable to write binary trace output file {}", path);
+        fclose(file);
+        return nullptr;
+    }
+
+    logger.debug("writing binary trace to {}", path);
+    return std::unique_ptr<binary_sink_t>(new binary_sink_t(file, logger));
+}
+
+binary_sink_t::binary_sink_t(FILE *file, logger::Logger &logger)
+    : file(file), logger(logger), id(nextSinkId++),
+      namesWritten(max_named_functions, false) {
+    drainThread = std::thread([this] { drainLoop(); });
+}
+
+binary_sink_t::~binary_sink_t() {
+    {
+        std::lock_guard<std::mutex> lock(drainMutex);
+        stopping = true;
+    }
+    drainCv.notify_one();
+    drainThread.join();
+    fclose(file);
+}
+
+binary_sink_t::thread_buffer_t *binary_sink_t::getThreadBuffer() {
+    if (threadSlot.sinkId == id) {
+        return static_cast<thread_buffer_t *>(threadSlot.buffer);
+    }
+
+    auto buffer = std::make_unique<thread_buffer_t>();
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    buffer->index = static_cast<uint32_t>(buffers.size());
+    threadSlot.sinkId = id;
+    threadSlot.buffer = buffer.get();
+    buffers.push_back(std::move(buffer));
+    return static_cast<thread_buffer_t *>(threadSlot.buffer);
+}
+
+uint64_t binary_sink_t::push(binary::record_t &record, const char *name) {
+    auto *buffer = getThreadBuffer();
+    if (record.functionId < max_named_functions &&
+        !names[record.functionId].load(std::memory_order_relaxed)) {
+        names[record.functionId].store(name, std::memory_order_relaxed);
+    }
+
+    record.instance =
+        (static_cast<uint64_t>(buffer->index) << 40) | buffer->nextInstance++;
+    record.threadIndex = buffer->index;
+    record.timestamp = now();
+    if (!buffer->ring.push(record)) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    return record.instance;
+}
+
+void binary_sink_t::end(uint32_t id, ur_result_t result, uint64_t instance) {
+    auto timestamp = now();
+    auto *buffer = getThreadBuffer();
+
+    binary::record_t record{};
+    record.kind = binary::RECORD_END;
+    record.functionId = id;
+    record.threadIndex = buffer->index;
+    record.instance = instance;
+    record.result = static_cast<int32_t>(result);
+    record.timestamp = timestamp;
+    if (!buffer->ring.push(record)) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void binary_sink_t::write(const binary::record_t &record) {
+    if (record.kind == binary::RECORD_BEGIN &&
+        record.functionId < max_named_functions &&
+        !namesWritten[record.functionId]) {
+        // The producer stored the name before publishing the record, so it
+        // is visible here.
+        const char *name = names[record.functionId].load();
+        if (name) {
+            binary::record_t nameRecord{};
+            nameRecord.kind = binary::RECORD_NAME;
+            nameRecord.functionId = record.functionId;
+            nameRecord.args[0] = strlen(name);
+            fwrite(&nameRecord, sizeof(nameRecord), 1, file);
+            fwrite(name, 1, nameRecord.args[0], file);
+        }
+        namesWritten[record.functionId] = true;
+    }
+    fwrite(&record, sizeof(record), 1, file);
+}
+
+void binary_sink_t::drainAll() {
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    for (auto &buffer : buffers) {
+        buffer->ring.drain(
+            [this](const binary::record_t &record) { write(record); });
+
+        uint64_t dropped = buffer->dropped.load(std::memory_order_relaxed);
+        if (dropped != buffer->droppedReported) {
+            binary::record_t record{};
+            record.kind = binary::RECORD_DROPPED;
+            record.threadIndex = buffer->index;
+            record.timestamp = now();
+            record.args[0] = dropped - buffer->droppedReported;
+            write(record);
+            logger.warning("binary trace buffer of thread {} overflowed, {} "
+                           "records dropped",
+                           buffer->index, record.args[0]);
+            buffer->droppedReported = dropped;
+        }
+    }
+}
+
+void binary_sink_t::drainLoop() {
+    std::unique_lock<std::mutex> lock(drainMutex);
+    while (!stopping) {
+        drainCv.wait_for(lock, drain_interval, [this] { return stopping; });
+        lock.unlock();
+        drainAll();
+        lock.lock();
+    }
+    lock.unlock();
+    drainAll();
+    fflush(file);
+}
+
+} // namespace ur_tracing_layer
@@ -0,0 +1,99 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_tracing_sink.hpp
+ *
+ */
+
+#ifndef UR_TRACING_SINK_H
+#define UR_TRACING_SINK_H 1
+
+#include "logger/ur_logger.hpp"
+#include "ur_api.h"
+#include "ur_tracing_binary.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ur_tracing_layer {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Writes begin/end records of traced calls to a binary file.
+///
+/// Every calling thread gets its own lock-free ring buffer, so recording a
+/// call is a handful of stores. A background thread periodically drains all
+/// buffers into the output file. When a buffer is full new records are
+/// dropped and accounted for with a RECORD_DROPPED record.
+class binary_sink_t {
+  public:
+    static std::unique_ptr<binary_sink_t> create(const std::string &path,
+                                                 logger::Logger &logger);
+    ~binary_sink_t();
+
+    binary_sink_t(const binary_sink_t &) = delete;
+    binary_sink_t &operator=(const binary_sink_t &) = delete;
+
+    template <typename... Args>
+    uint64_t begin(uint32_t id, const char *name, const Args &...values) {
+        binary::record_t record{};
+        record.kind = binary::RECORD_BEGIN;
+        record.functionId = id;
+        binary::snapshotArgs(record, values...);
+        return push(record, name);
+    }
+
+    void end(uint32_t id, ur_result_t result, uint64_t instance);
+
+  private:
+    static constexpr size_t ring_capacity = 4096;
+    static constexpr size_t max_named_functions = 1024;
+    static constexpr auto drain_interval = std::chrono::milliseconds(1);
+
+    struct thread_buffer_t {
+        binary::spsc_ring_t<binary::record_t, ring_capacity> ring;
+        uint32_t index = 0;
+        uint64_t nextInstance = 0;
+        std::atomic<uint64_t> dropped{0};
+        uint64_t droppedReported = 0;
+    };
+
+    binary_sink_t(FILE *file, logger::Logger &logger);
+
+    /// Fills in the common fields of record and publishes it. Returns the
+    /// call instance the record was assigned.
+    uint64_t push(binary::record_t &record, const char *name);
+    thread_buffer_t *getThreadBuffer();
+    void drainLoop();
+    void drainAll();
+    void write(const binary::record_t &record);
+
+    FILE *file;
+    logger::Logger &logger;
+    const uint64_t id;
+
+    std::mutex buffersMutex;
+    std::vector<std::unique_ptr<thread_buffer_t>> buffers;
+
+    std::atomic<const char *> names[max_named_functions] = {};
+    std::vector<bool> namesWritten;
+
+    std::mutex drainMutex;
+    std::condition_variable drainCv;
+    bool stopping = false;
+    std::thread drainThread;
+};
+
+} // namespace ur_tracing_layer
+
+#endif /* UR_TRACING_SINK_H */
@@ -36,9 +36,15 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET)) {
+        return pfnAdapterGet(NumEntries, phAdapters, pNumAdapters);
+    }
+
     ur_adapter_get_params_t params = {&NumEntries, &phAdapters, &pNumAdapters};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_GET,
-                                                   "urAdapterGet", &params);
+                                                   "urAdapterGet", &params,
+                                                   NumEntries, phAdapters,
+                                                   pNumAdapters);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urAdapterGet\n");
@@ -70,9 +76,14 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_RELEASE)) {
+        return pfnAdapterRelease(hAdapter);
+    }
+
     ur_adapter_release_params_t params = {&hAdapter};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_RELEASE,
-                                                   "urAdapterRelease", &params);
+                                                   "urAdapterRelease", &params,
+                                                   hAdapter);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urAdapterRelease\n");
@@ -104,9 +115,14 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_RETAIN)) {
+        return pfnAdapterRetain(hAdapter);
+    }
+
     ur_adapter_retain_params_t params = {&hAdapter};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_RETAIN,
-                                                   "urAdapterRetain", &params);
+                                                   "urAdapterRetain", &params,
+                                                   hAdapter);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urAdapterRetain\n");
@@ -145,10 +161,15 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET_LAST_ERROR)) {
+        return pfnAdapterGetLastError(hAdapter, ppMessage, pError);
+    }
+
     ur_adapter_get_last_error_params_t params = {&hAdapter, &ppMessage,
                                                  &pError};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ADAPTER_GET_LAST_ERROR, "urAdapterGetLastError", &params);
+        UR_FUNCTION_ADAPTER_GET_LAST_ERROR, "urAdapterGetLastError", &params,
+        hAdapter, ppMessage, pError);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urAdapterGetLastError\n");
@@ -191,10 +212,17 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET_INFO)) {
+        return pfnAdapterGetInfo(hAdapter, propName, propSize, pPropValue,
+                                 pPropSizeRet);
+    }
+
     ur_adapter_get_info_params_t params = {&hAdapter, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_GET_INFO,
-                                                   "urAdapterGetInfo", &params);
+                                                   "urAdapterGetInfo", &params,
+                                                   hAdapter, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urAdapterGetInfo\n");
@@ -240,10 +268,18 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET)) {
+        return pfnGet(phAdapters, NumAdapters, NumEntries, phPlatforms,
+                      pNumPlatforms);
+    }
+
     ur_platform_get_params_t params = {&phAdapters, &NumAdapters, &NumEntries,
                                        &phPlatforms, &pNumPlatforms};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET,
-                                                   "urPlatformGet", &params);
+                                                   "urPlatformGet", &params,
+                                                   phAdapters, NumAdapters,
+                                                   NumEntries, phPlatforms,
+                                                   pNumPlatforms);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urPlatformGet\n");
@@ -286,10 +322,16 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_INFO)) {
+        return pfnGetInfo(hPlatform, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_platform_get_info_params_t params = {&hPlatform, &propName, &propSize,
                                             &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_PLATFORM_GET_INFO, "urPlatformGetInfo", &params);
+        UR_FUNCTION_PLATFORM_GET_INFO, "urPlatformGetInfo", &params, hPlatform,
+        propName, propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urPlatformGetInfo\n");
@@ -323,10 +365,14 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_API_VERSION)) {
+        return pfnGetApiVersion(hPlatform, pVersion);
+    }
+
     ur_platform_get_api_version_params_t params = {&hPlatform, &pVersion};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET_API_VERSION,
-                                   "urPlatformGetApiVersion", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PLATFORM_GET_API_VERSION, "urPlatformGetApiVersion",
+        &params, hPlatform, pVersion);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urPlatformGetApiVersion\n");
@@ -362,11 +408,15 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hPlatform, phNativePlatform);
+    }
+
     ur_platform_get_native_handle_params_t params = {&hPlatform,
                                                      &phNativePlatform};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE,
-                                   "urPlatformGetNativeHandle", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE, "urPlatformGetNativeHandle",
+        &params, hPlatform, phNativePlatform);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urPlatformGetNativeHandle\n");
@@ -407,11 +457,18 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativePlatform, hAdapter, pProperties,
+                                         phPlatform);
+    }
+
     ur_platform_create_with_native_handle_params_t params = {
         &hNativePlatform, &hAdapter, &pProperties, &phPlatform};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE,
-        "urPlatformCreateWithNativeHandle", &params);
+        "urPlatformCreateWithNativeHandle", &params, hNativePlatform, hAdapter,
+        pProperties, phPlatform);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urPlatformCreateWithNativeHandle\n");
@@ -451,11 +508,16 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION)) {
+        return pfnGetBackendOption(hPlatform, pFrontendOption,
+                                   ppPlatformOption);
+    }
+
     ur_platform_get_backend_option_params_t params = {
         &hPlatform, &pFrontendOption, &ppPlatformOption};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION,
-                                   "urPlatformGetBackendOption", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION, "urPlatformGetBackendOption",
+        &params, hPlatform, pFrontendOption, ppPlatformOption);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urPlatformGetBackendOption\n");
@@ -501,10 +563,18 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET)) {
+        return pfnGet(hPlatform, DeviceType, NumEntries, phDevices,
+                      pNumDevices);
+    }
+
     ur_device_get_params_t params = {&hPlatform, &DeviceType, &NumEntries,
                                      &phDevices, &pNumDevices};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_GET,
-                                                   "urDeviceGet", &params);
+                                                   "urDeviceGet", &params,
+                                                   hPlatform, DeviceType,
+                                                   NumEntries, phDevices,
+                                                   pNumDevices);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urDeviceGet\n");
@@ -547,10 +617,17 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_INFO)) {
+        return pfnGetInfo(hDevice, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_device_get_info_params_t params = {&hDevice, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_GET_INFO,
-                                                   "urDeviceGetInfo", &params);
+                                                   "urDeviceGetInfo", &params,
+                                                   hDevice, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urDeviceGetInfo\n");
@@ -584,9 +661,14 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_RETAIN)) {
+        return pfnRetain(hDevice);
+    }
+
     ur_device_retain_params_t params = {&hDevice};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_RETAIN,
-                                                   "urDeviceRetain", &params);
+                                                   "urDeviceRetain", &params,
+                                                   hDevice);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urDeviceRetain\n");
@@ -619,9 +701,14 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_RELEASE)) {
+        return pfnRelease(hDevice);
+    }
+
     ur_device_release_params_t params = {&hDevice};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_RELEASE,
-                                                   "urDeviceRelease", &params);
+                                                   "urDeviceRelease", &params,
+                                                   hDevice);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urDeviceRelease\n");
@@ -663,10 +750,18 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_PARTITION)) {
+        return pfnPartition(hDevice, pProperties, NumDevices, phSubDevices,
+                            pNumDevicesRet);
+    }
+
     ur_device_partition_params_t params = {&hDevice, &pProperties, &NumDevices,
                                            &phSubDevices, &pNumDevicesRet};
-    uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_DEVICE_PARTITION, "urDevicePartition", &params);
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_PARTITION,
+                                                   "urDevicePartition", &params,
+                                                   hDevice, pProperties,
+                                                   NumDevices, phSubDevices,
+                                                   pNumDevicesRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urDevicePartition\n");
@@ -708,10 +803,16 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_SELECT_BINARY)) {
+        return pfnSelectBinary(hDevice, pBinaries, NumBinaries,
+                               pSelectedBinary);
+    }
+
     ur_device_select_binary_params_t params = {&hDevice, &pBinaries,
                                                &NumBinaries, &pSelectedBinary};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_DEVICE_SELECT_BINARY, "urDeviceSelectBinary", &params);
+        UR_FUNCTION_DEVICE_SELECT_BINARY, "urDeviceSelectBinary", &params,
+        hDevice, pBinaries, NumBinaries, pSelectedBinary);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urDeviceSelectBinary\n");
@@ -748,10 +849,14 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hDevice, phNativeDevice);
+    }
+
     ur_device_get_native_handle_params_t params = {&hDevice, &phNativeDevice};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE,
-                                   "urDeviceGetNativeHandle", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE, "urDeviceGetNativeHandle",
+        &params, hDevice, phNativeDevice);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urDeviceGetNativeHandle\n");
@@ -792,11 +897,18 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeDevice, hAdapter, pProperties,
+                                         phDevice);
+    }
+
     ur_device_create_with_native_handle_params_t params = {
         &hNativeDevice, &hAdapter, &pProperties, &phDevice};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE,
-                                   "urDeviceCreateWithNativeHandle", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE,
+        "urDeviceCreateWithNativeHandle", &params, hNativeDevice, hAdapter,
+        pProperties, phDevice);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urDeviceCreateWithNativeHandle\n");
@@ -837,11 +949,16 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS)) {
+        return pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp,
+                                      pHostTimestamp);
+    }
+
     ur_device_get_global_timestamps_params_t params = {
         &hDevice, &pDeviceTimestamp, &pHostTimestamp};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS,
-                                   "urDeviceGetGlobalTimestamps", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS, "urDeviceGetGlobalTimestamps",
+        &params, hDevice, pDeviceTimestamp, pHostTimestamp);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urDeviceGetGlobalTimestamps\n");
@@ -881,10 +998,16 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_CREATE)) {
+        return pfnCreate(DeviceCount, phDevices, pProperties, phContext);
+    }
+
     ur_context_create_params_t params = {&DeviceCount, &phDevices, &pProperties,
                                          &phContext};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_CREATE,
-                                                   "urContextCreate", &params);
+                                                   "urContextCreate", &params,
+                                                   DeviceCount, phDevices,
+                                                   pProperties, phContext);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urContextCreate\n");
@@ -918,9 +1041,14 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_RETAIN)) {
+        return pfnRetain(hContext);
+    }
+
     ur_context_retain_params_t params = {&hContext};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_RETAIN,
-                                                   "urContextRetain", &params);
+                                                   "urContextRetain", &params,
+                                                   hContext);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urContextRetain\n");
@@ -953,9 +1081,14 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_RELEASE)) {
+        return pfnRelease(hContext);
+    }
+
     ur_context_release_params_t params = {&hContext};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_RELEASE,
-                                                   "urContextRelease", &params);
+                                                   "urContextRelease", &params,
+                                                   hContext);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urContextRelease\n");
@@ -999,10 +1132,17 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_GET_INFO)) {
+        return pfnGetInfo(hContext, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_context_get_info_params_t params = {&hContext, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_GET_INFO,
-                                                   "urContextGetInfo", &params);
+                                                   "urContextGetInfo", &params,
+                                                   hContext, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urContextGetInfo\n");
@@ -1038,11 +1178,15 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hContext, phNativeContext);
+    }
+
     ur_context_get_native_handle_params_t params = {&hContext,
                                                     &phNativeContext};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE,
-                                   "urContextGetNativeHandle", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE, "urContextGetNativeHandle",
+        &params, hContext, phNativeContext);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urContextGetNativeHandle\n");
@@ -1087,12 +1231,19 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeContext, hAdapter, numDevices,
+                                         phDevices, pProperties, phContext);
+    }
+
     ur_context_create_with_native_handle_params_t params = {
         &hNativeContext, &hAdapter,    &numDevices,
         &phDevices,      &pProperties, &phContext};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE,
-        "urContextCreateWithNativeHandle", &params);
+        "urContextCreateWithNativeHandle", &params, hNativeContext, hAdapter,
+        numDevices, phDevices, pProperties, phContext);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urContextCreateWithNativeHandle\n");
@@ -1132,11 +1283,15 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER)) {
+        return pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
+    }
+
     ur_context_set_extended_deleter_params_t params = {&hContext, &pfnDeleter,
                                                        &pUserData};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER,
-                                   "urContextSetExtendedDeleter", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER, "urContextSetExtendedDeleter",
+        &params, hContext, pfnDeleter, pUserData);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urContextSetExtendedDeleter\n");
@@ -1175,10 +1330,18 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_IMAGE_CREATE)) {
+        return pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost,
+                              phMem);
+    }
+
     ur_mem_image_create_params_t params = {&hContext,   &flags, &pImageFormat,
                                            &pImageDesc, &pHost, &phMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_IMAGE_CREATE,
-                                                   "urMemImageCreate", &params);
+                                                   "urMemImageCreate", &params,
+                                                   hContext, flags,
+                                                   pImageFormat, pImageDesc,
+                                                   pHost, phMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urMemImageCreate\n");
@@ -1217,10 +1380,15 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_BUFFER_CREATE)) {
+        return pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
+    }
+
     ur_mem_buffer_create_params_t params = {&hContext, &flags, &size,
                                             &pProperties, &phBuffer};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_MEM_BUFFER_CREATE, "urMemBufferCreate", &params);
+        UR_FUNCTION_MEM_BUFFER_CREATE, "urMemBufferCreate", &params, hContext,
+        flags, size, pProperties, phBuffer);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urMemBufferCreate\n");
@@ -1254,9 +1422,14 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_RETAIN)) {
+        return pfnRetain(hMem);
+    }
+
     ur_mem_retain_params_t params = {&hMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_RETAIN,
-                                                   "urMemRetain", &params);
+                                                   "urMemRetain", &params,
+                                                   hMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urMemRetain\n");
@@ -1288,9 +1461,14 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_RELEASE)) {
+        return pfnRelease(hMem);
+    }
+
     ur_mem_release_params_t params = {&hMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_RELEASE,
-                                                   "urMemRelease", &params);
+                                                   "urMemRelease", &params,
+                                                   hMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urMemRelease\n");
@@ -1329,10 +1507,16 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_BUFFER_PARTITION)) {
+        return pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion,
+                                  phMem);
+    }
+
     ur_mem_buffer_partition_params_t params = {
         &hBuffer, &flags, &bufferCreateType, &pRegion, &phMem};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_MEM_BUFFER_PARTITION, "urMemBufferPartition", &params);
+        UR_FUNCTION_MEM_BUFFER_PARTITION, "urMemBufferPartition", &params,
+        hBuffer, flags, bufferCreateType, pRegion, phMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urMemBufferPartition\n");
@@ -1371,9 +1555,14 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hMem, hDevice, phNativeMem);
+    }
+
     ur_mem_get_native_handle_params_t params = {&hMem, &hDevice, &phNativeMem};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_MEM_GET_NATIVE_HANDLE, "urMemGetNativeHandle", &params);
+        UR_FUNCTION_MEM_GET_NATIVE_HANDLE, "urMemGetNativeHandle", &params,
+        hMem, hDevice, phNativeMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urMemGetNativeHandle\n");
@@ -1413,11 +1602,18 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnBufferCreateWithNativeHandle(hNativeMem, hContext,
+                                               pProperties, phMem);
+    }
+
     ur_mem_buffer_create_with_native_handle_params_t params = {
         &hNativeMem, &hContext, &pProperties, &phMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE,
-        "urMemBufferCreateWithNativeHandle", &params);
+        "urMemBufferCreateWithNativeHandle", &params, hNativeMem, hContext,
+        pProperties, phMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urMemBufferCreateWithNativeHandle\n");
@@ -1462,12 +1658,20 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnImageCreateWithNativeHandle(hNativeMem, hContext,
+                                              pImageFormat, pImageDesc,
+                                              pProperties, phMem);
+    }
+
     ur_mem_image_create_with_native_handle_params_t params = {
         &hNativeMem, &hContext,    &pImageFormat,
         &pImageDesc, &pProperties, &phMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE,
-        "urMemImageCreateWithNativeHandle", &params);
+        "urMemImageCreateWithNativeHandle", &params, hNativeMem, hContext,
+        pImageFormat, pImageDesc, pProperties, phMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urMemImageCreateWithNativeHandle\n");
@@ -1513,10 +1717,17 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_GET_INFO)) {
+        return pfnGetInfo(hMemory, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_mem_get_info_params_t params = {&hMemory, &propName, &propSize,
                                        &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_GET_INFO,
-                                                   "urMemGetInfo", &params);
+                                                   "urMemGetInfo", &params,
+                                                   hMemory, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urMemGetInfo\n");
@@ -1560,10 +1771,16 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_IMAGE_GET_INFO)) {
+        return pfnImageGetInfo(hMemory, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    }
+
     ur_mem_image_get_info_params_t params = {&hMemory, &propName, &propSize,
                                              &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_MEM_IMAGE_GET_INFO, "urMemImageGetInfo", &params);
+        UR_FUNCTION_MEM_IMAGE_GET_INFO, "urMemImageGetInfo", &params, hMemory,
+        propName, propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urMemImageGetInfo\n");
@@ -1599,9 +1816,14 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_CREATE)) {
+        return pfnCreate(hContext, pDesc, phSampler);
+    }
+
     ur_sampler_create_params_t params = {&hContext, &pDesc, &phSampler};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_CREATE,
-                                                   "urSamplerCreate", &params);
+                                                   "urSamplerCreate", &params,
+                                                   hContext, pDesc, phSampler);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urSamplerCreate\n");
@@ -1634,9 +1856,14 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_RETAIN)) {
+        return pfnRetain(hSampler);
+    }
+
     ur_sampler_retain_params_t params = {&hSampler};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_RETAIN,
-                                                   "urSamplerRetain", &params);
+                                                   "urSamplerRetain", &params,
+                                                   hSampler);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urSamplerRetain\n");
@@ -1669,9 +1896,14 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_RELEASE)) {
+        return pfnRelease(hSampler);
+    }
+
     ur_sampler_release_params_t params = {&hSampler};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_RELEASE,
-                                                   "urSamplerRelease", &params);
+                                                   "urSamplerRelease", &params,
+                                                   hSampler);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urSamplerRelease\n");
@@ -1711,10 +1943,17 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_GET_INFO)) {
+        return pfnGetInfo(hSampler, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_sampler_get_info_params_t params = {&hSampler, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_GET_INFO,
-                                                   "urSamplerGetInfo", &params);
+                                                   "urSamplerGetInfo", &params,
+                                                   hSampler, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urSamplerGetInfo\n");
@@ -1750,11 +1989,15 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hSampler, phNativeSampler);
+    }
+
     ur_sampler_get_native_handle_params_t params = {&hSampler,
                                                     &phNativeSampler};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE,
-                                   "urSamplerGetNativeHandle", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE, "urSamplerGetNativeHandle",
+        &params, hSampler, phNativeSampler);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urSamplerGetNativeHandle\n");
@@ -1794,11 +2037,18 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeSampler, hContext, pProperties,
+                                         phSampler);
+    }
+
     ur_sampler_create_with_native_handle_params_t params = {
         &hNativeSampler, &hContext, &pProperties, &phSampler};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE,
-        "urSamplerCreateWithNativeHandle", &params);
+        "urSamplerCreateWithNativeHandle", &params, hNativeSampler, hContext,
+        pProperties, phSampler);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urSamplerCreateWithNativeHandle\n");
@@ -1839,10 +2089,16 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_HOST_ALLOC)) {
+        return pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_host_alloc_params_t params = {&hContext, &pUSMDesc, &pool, &size,
                                          &ppMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_HOST_ALLOC,
-                                                   "urUSMHostAlloc", &params);
+                                                   "urUSMHostAlloc", &params,
+                                                   hContext, pUSMDesc, pool,
+                                                   size, ppMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMHostAlloc\n");
@@ -1882,10 +2138,16 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_DEVICE_ALLOC)) {
+        return pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_device_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_DEVICE_ALLOC,
-                                                   "urUSMDeviceAlloc", &params);
+                                                   "urUSMDeviceAlloc", &params,
+                                                   hContext, hDevice, pUSMDesc,
+                                                   pool, size, ppMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMDeviceAlloc\n");
@@ -1926,10 +2188,16 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_SHARED_ALLOC)) {
+        return pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_shared_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_SHARED_ALLOC,
-                                                   "urUSMSharedAlloc", &params);
+                                                   "urUSMSharedAlloc", &params,
+                                                   hContext, hDevice, pUSMDesc,
+                                                   pool, size, ppMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMSharedAlloc\n");
@@ -1963,9 +2231,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_FREE)) {
+        return pfnFree(hContext, pMem);
+    }
+
     ur_usm_free_params_t params = {&hContext, &pMem};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_USM_FREE, "urUSMFree", &params);
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_FREE,
+                                                   "urUSMFree", &params,
+                                                   hContext, pMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMFree\n");
@@ -2006,10 +2279,16 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO)) {
+        return pfnGetMemAllocInfo(hContext, pMem, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    }
+
     ur_usm_get_mem_alloc_info_params_t params = {
         &hContext, &pMem, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, "urUSMGetMemAllocInfo", &params);
+        UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, "urUSMGetMemAllocInfo", &params,
+        hContext, pMem, propName, propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMGetMemAllocInfo\n");
@@ -2047,9 +2326,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_CREATE)) {
+        return pfnPoolCreate(hContext, pPoolDesc, ppPool);
+    }
+
     ur_usm_pool_create_params_t params = {&hContext, &pPoolDesc, &ppPool};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_CREATE,
-                                                   "urUSMPoolCreate", &params);
+                                                   "urUSMPoolCreate", &params,
+                                                   hContext, pPoolDesc, ppPool);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMPoolCreate\n");
@@ -2081,9 +2365,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_RETAIN)) {
+        return pfnPoolRetain(pPool);
+    }
+
     ur_usm_pool_retain_params_t params = {&pPool};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_RETAIN,
-                                                   "urUSMPoolRetain", &params);
+                                                   "urUSMPoolRetain", &params,
+                                                   pPool);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMPoolRetain\n");
@@ -2115,9 +2404,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_RELEASE)) {
+        return pfnPoolRelease(pPool);
+    }
+
     ur_usm_pool_release_params_t params = {&pPool};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_RELEASE,
-                                                   "urUSMPoolRelease", &params);
+                                                   "urUSMPoolRelease", &params,
+                                                   pPool);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMPoolRelease\n");
@@ -2156,10 +2450,16 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_GET_INFO)) {
+        return pfnPoolGetInfo(hPool, propName, propSize, pPropValue,
+                              pPropSizeRet);
+    }
+
     ur_usm_pool_get_info_params_t params = {&hPool, &propName, &propSize,
                                             &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_USM_POOL_GET_INFO, "urUSMPoolGetInfo", &params);
+        UR_FUNCTION_USM_POOL_GET_INFO, "urUSMPoolGetInfo", &params, hPool,
+        propName, propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMPoolGetInfo\n");
@@ -2207,11 +2507,18 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO)) {
+        return pfnGranularityGetInfo(hContext, hDevice, propName, propSize,
+                                     pPropValue, pPropSizeRet);
+    }
+
     ur_virtual_mem_granularity_get_info_params_t params = {
         &hContext, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO,
-                                   "urVirtualMemGranularityGetInfo", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO,
+        "urVirtualMemGranularityGetInfo", &params, hContext, hDevice, propName,
+        propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urVirtualMemGranularityGetInfo\n");
@@ -2254,10 +2561,15 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_RESERVE)) {
+        return pfnReserve(hContext, pStart, size, ppStart);
+    }
+
     ur_virtual_mem_reserve_params_t params = {&hContext, &pStart, &size,
                                               &ppStart};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_VIRTUAL_MEM_RESERVE, "urVirtualMemReserve", &params);
+        UR_FUNCTION_VIRTUAL_MEM_RESERVE, "urVirtualMemReserve", &params,
+        hContext, pStart, size, ppStart);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urVirtualMemReserve\n");
@@ -2292,9 +2604,14 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_FREE)) {
+        return pfnFree(hContext, pStart, size);
+    }
+
     ur_virtual_mem_free_params_t params = {&hContext, &pStart, &size};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_FREE,
-                                                   "urVirtualMemFree", &params);
+                                                   "urVirtualMemFree", &params,
+                                                   hContext, pStart, size);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urVirtualMemFree\n");
@@ -2335,10 +2652,16 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_MAP)) {
+        return pfnMap(hContext, pStart, size, hPhysicalMem, offset, flags);
+    }
+
     ur_virtual_mem_map_params_t params = {&hContext,     &pStart, &size,
                                           &hPhysicalMem, &offset, &flags};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_MAP,
-                                                   "urVirtualMemMap", &params);
+                                                   "urVirtualMemMap", &params,
+                                                   hContext, pStart, size,
+                                                   hPhysicalMem, offset, flags);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urVirtualMemMap\n");
@@ -2374,9 +2697,14 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_UNMAP)) {
+        return pfnUnmap(hContext, pStart, size);
+    }
+
     ur_virtual_mem_unmap_params_t params = {&hContext, &pStart, &size};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_VIRTUAL_MEM_UNMAP, "urVirtualMemUnmap", &params);
+        UR_FUNCTION_VIRTUAL_MEM_UNMAP, "urVirtualMemUnmap", &params, hContext,
+        pStart, size);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urVirtualMemUnmap\n");
@@ -2413,10 +2741,15 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS)) {
+        return pfnSetAccess(hContext, pStart, size, flags);
+    }
+
     ur_virtual_mem_set_access_params_t params = {&hContext, &pStart, &size,
                                                  &flags};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, "urVirtualMemSetAccess", &params);
+        UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, "urVirtualMemSetAccess", &params,
+        hContext, pStart, size, flags);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urVirtualMemSetAccess\n");
@@ -2462,11 +2795,17 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_GET_INFO)) {
+        return pfnGetInfo(hContext, pStart, size, propName, propSize,
+                          pPropValue, pPropSizeRet);
+    }
+
     ur_virtual_mem_get_info_params_t params = {
         &hContext, &pStart,     &size,        &propName,
         &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_VIRTUAL_MEM_GET_INFO, "urVirtualMemGetInfo", &params);
+        UR_FUNCTION_VIRTUAL_MEM_GET_INFO, "urVirtualMemGetInfo", &params,
+        hContext, pStart, size, propName, propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urVirtualMemGetInfo\n");
@@ -2507,10 +2846,15 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_CREATE)) {
+        return pfnCreate(hContext, hDevice, size, pProperties, phPhysicalMem);
+    }
+
     ur_physical_mem_create_params_t params = {&hContext, &hDevice, &size,
                                               &pProperties, &phPhysicalMem};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_PHYSICAL_MEM_CREATE, "urPhysicalMemCreate", &params);
+        UR_FUNCTION_PHYSICAL_MEM_CREATE, "urPhysicalMemCreate", &params,
+        hContext, hDevice, size, pProperties, phPhysicalMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urPhysicalMemCreate\n");
@@ -2544,9 +2888,14 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_RETAIN)) {
+        return pfnRetain(hPhysicalMem);
+    }
+
     ur_physical_mem_retain_params_t params = {&hPhysicalMem};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_PHYSICAL_MEM_RETAIN, "urPhysicalMemRetain", &params);
+        UR_FUNCTION_PHYSICAL_MEM_RETAIN, "urPhysicalMemRetain", &params,
+        hPhysicalMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urPhysicalMemRetain\n");
@@ -2579,9 +2928,14 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_RELEASE)) {
+        return pfnRelease(hPhysicalMem);
+    }
+
     ur_physical_mem_release_params_t params = {&hPhysicalMem};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_PHYSICAL_MEM_RELEASE, "urPhysicalMemRelease", &params);
+        UR_FUNCTION_PHYSICAL_MEM_RELEASE, "urPhysicalMemRelease", &params,
+        hPhysicalMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urPhysicalMemRelease\n");
@@ -2620,10 +2974,15 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_CREATE_WITH_IL)) {
+        return pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
+    }
+
     ur_program_create_with_il_params_t params = {&hContext, &pIL, &length,
                                                  &pProperties, &phProgram};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_PROGRAM_CREATE_WITH_IL, "urProgramCreateWithIL", &params);
+        UR_FUNCTION_PROGRAM_CREATE_WITH_IL, "urProgramCreateWithIL", &params,
+        hContext, pIL, length, pProperties, phProgram);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramCreateWithIL\n");
@@ -2666,11 +3025,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY)) {
+        return pfnCreateWithBinary(hContext, hDevice, size, pBinary,
+                                   pProperties, phProgram);
+    }
+
     ur_program_create_with_binary_params_t params = {
         &hContext, &hDevice, &size, &pBinary, &pProperties, &phProgram};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY,
-                                   "urProgramCreateWithBinary", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY, "urProgramCreateWithBinary",
+        &params, hContext, hDevice, size, pBinary, pProperties, phProgram);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramCreateWithBinary\n");
@@ -2707,9 +3071,15 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_BUILD)) {
+        return pfnBuild(hContext, hProgram, pOptions);
+    }
+
     ur_program_build_params_t params = {&hContext, &hProgram, &pOptions};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_BUILD,
-                                                   "urProgramBuild", &params);
+                                                   "urProgramBuild", &params,
+                                                   hContext, hProgram,
+                                                   pOptions);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramBuild\n");
@@ -2745,9 +3115,15 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_COMPILE)) {
+        return pfnCompile(hContext, hProgram, pOptions);
+    }
+
     ur_program_compile_params_t params = {&hContext, &hProgram, &pOptions};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_COMPILE,
-                                                   "urProgramCompile", &params);
+                                                   "urProgramCompile", &params,
+                                                   hContext, hProgram,
+                                                   pOptions);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramCompile\n");
@@ -2789,10 +3165,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_LINK)) {
+        return pfnLink(hContext, count, phPrograms, pOptions, phProgram);
+    }
+
     ur_program_link_params_t params = {&hContext, &count, &phPrograms,
                                        &pOptions, &phProgram};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_LINK,
-                                                   "urProgramLink", &params);
+                                                   "urProgramLink", &params,
+                                                   hContext, count, phPrograms,
+                                                   pOptions, phProgram);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramLink\n");
@@ -2826,9 +3208,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_RETAIN)) {
+        return pfnRetain(hProgram);
+    }
+
     ur_program_retain_params_t params = {&hProgram};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_RETAIN,
-                                                   "urProgramRetain", &params);
+                                                   "urProgramRetain", &params,
+                                                   hProgram);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramRetain\n");
@@ -2861,9 +3248,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_RELEASE)) {
+        return pfnRelease(hProgram);
+    }
+
     ur_program_release_params_t params = {&hProgram};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_RELEASE,
-                                                   "urProgramRelease", &params);
+                                                   "urProgramRelease", &params,
+                                                   hProgram);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramRelease\n");
@@ -2905,11 +3297,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER)) {
+        return pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
+                                     ppFunctionPointer);
+    }
+
     ur_program_get_function_pointer_params_t params = {
         &hDevice, &hProgram, &pFunctionName, &ppFunctionPointer};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER,
-                                   "urProgramGetFunctionPointer", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER, "urProgramGetFunctionPointer",
+        &params, hDevice, hProgram, pFunctionName, ppFunctionPointer);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramGetFunctionPointer\n");
@@ -2954,12 +3351,22 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER)) {
+        return pfnGetGlobalVariablePointer(hDevice, hProgram,
+                                           pGlobalVariableName,
+                                           pGlobalVariableSizeRet,
+                                           ppGlobalVariablePointerRet);
+    }
+
     ur_program_get_global_variable_pointer_params_t params = {
         &hDevice, &hProgram, &pGlobalVariableName, &pGlobalVariableSizeRet,
         &ppGlobalVariablePointerRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER,
-        "urProgramGetGlobalVariablePointer", &params);
+        "urProgramGetGlobalVariablePointer", &params, hDevice, hProgram,
+        pGlobalVariableName, pGlobalVariableSizeRet,
+        ppGlobalVariablePointerRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramGetGlobalVariablePointer\n");
@@ -3005,10 +3412,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_INFO)) {
+        return pfnGetInfo(hProgram, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_program_get_info_params_t params = {&hProgram, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_GET_INFO,
-                                                   "urProgramGetInfo", &params);
+                                                   "urProgramGetInfo", &params,
+                                                   hProgram, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramGetInfo\n");
@@ -3054,10 +3468,16 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_BUILD_INFO)) {
+        return pfnGetBuildInfo(hProgram, hDevice, propName, propSize,
+                               pPropValue, pPropSizeRet);
+    }
+
     ur_program_get_build_info_params_t params = {
         &hProgram, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_PROGRAM_GET_BUILD_INFO, "urProgramGetBuildInfo", &params);
+        UR_FUNCTION_PROGRAM_GET_BUILD_INFO, "urProgramGetBuildInfo", &params,
+        hProgram, hDevice, propName, propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramGetBuildInfo\n");
@@ -3096,11 +3516,17 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS)) {
+        return pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
+    }
+
     ur_program_set_specialization_constants_params_t params = {
         &hProgram, &count, &pSpecConstants};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
-        "urProgramSetSpecializationConstants", &params);
+        "urProgramSetSpecializationConstants", &params, hProgram, count,
+        pSpecConstants);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramSetSpecializationConstants\n");
@@ -3138,11 +3564,15 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hProgram, phNativeProgram);
+    }
+
     ur_program_get_native_handle_params_t params = {&hProgram,
                                                     &phNativeProgram};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE,
-                                   "urProgramGetNativeHandle", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE, "urProgramGetNativeHandle",
+        &params, hProgram, phNativeProgram);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramGetNativeHandle\n");
@@ -3182,11 +3612,18 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeProgram, hContext, pProperties,
+                                         phProgram);
+    }
+
     ur_program_create_with_native_handle_params_t params = {
         &hNativeProgram, &hContext, &pProperties, &phProgram};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE,
-        "urProgramCreateWithNativeHandle", &params);
+        "urProgramCreateWithNativeHandle", &params, hNativeProgram, hContext,
+        pProperties, phProgram);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramCreateWithNativeHandle\n");
@@ -3223,9 +3660,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_CREATE)) {
+        return pfnCreate(hProgram, pKernelName, phKernel);
+    }
+
     ur_kernel_create_params_t params = {&hProgram, &pKernelName, &phKernel};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_CREATE,
-                                                   "urKernelCreate", &params);
+                                                   "urKernelCreate", &params,
+                                                   hProgram, pKernelName,
+                                                   phKernel);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelCreate\n");
@@ -3264,10 +3707,16 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_VALUE)) {
+        return pfnSetArgValue(hKernel, argIndex, argSize, pProperties,
+                              pArgValue);
+    }
+
     ur_kernel_set_arg_value_params_t params = {&hKernel, &argIndex, &argSize,
                                                &pProperties, &pArgValue};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_KERNEL_SET_ARG_VALUE, "urKernelSetArgValue", &params);
+        UR_FUNCTION_KERNEL_SET_ARG_VALUE, "urKernelSetArgValue", &params,
+        hKernel, argIndex, argSize, pProperties, pArgValue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelSetArgValue\n");
@@ -3305,10 +3754,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_LOCAL)) {
+        return pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
+    }
+
     ur_kernel_set_arg_local_params_t params = {&hKernel, &argIndex, &argSize,
                                                &pProperties};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_KERNEL_SET_ARG_LOCAL, "urKernelSetArgLocal", &params);
+        UR_FUNCTION_KERNEL_SET_ARG_LOCAL, "urKernelSetArgLocal", &params,
+        hKernel, argIndex, argSize, pProperties);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelSetArgLocal\n");
@@ -3353,10 +3807,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_INFO)) {
+        return pfnGetInfo(hKernel, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_kernel_get_info_params_t params = {&hKernel, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_GET_INFO,
-                                                   "urKernelGetInfo", &params);
+                                                   "urKernelGetInfo", &params,
+                                                   hKernel, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelGetInfo\n");
@@ -3399,10 +3860,16 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_GROUP_INFO)) {
+        return pfnGetGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    }
+
     ur_kernel_get_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_KERNEL_GET_GROUP_INFO, "urKernelGetGroupInfo", &params);
+        UR_FUNCTION_KERNEL_GET_GROUP_INFO, "urKernelGetGroupInfo", &params,
+        hKernel, hDevice, propName, propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelGetGroupInfo\n");
@@ -3447,11 +3914,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO)) {
+        return pfnGetSubGroupInfo(hKernel, hDevice, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    }
+
     ur_kernel_get_sub_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO,
-                                   "urKernelGetSubGroupInfo", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO, "urKernelGetSubGroupInfo",
+        &params, hKernel, hDevice, propName, propSize, pPropValue,
+        pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelGetSubGroupInfo\n");
@@ -3485,9 +3958,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_RETAIN)) {
+        return pfnRetain(hKernel);
+    }
+
     ur_kernel_retain_params_t params = {&hKernel};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_RETAIN,
-                                                   "urKernelRetain", &params);
+                                                   "urKernelRetain", &params,
+                                                   hKernel);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelRetain\n");
@@ -3520,9 +3998,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_RELEASE)) {
+        return pfnRelease(hKernel);
+    }
+
     ur_kernel_release_params_t params = {&hKernel};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_RELEASE,
-                                                   "urKernelRelease", &params);
+                                                   "urKernelRelease", &params,
+                                                   hKernel);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelRelease\n");
@@ -3560,10 +4043,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_POINTER)) {
+        return pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
+    }
+
     ur_kernel_set_arg_pointer_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &pArgValue};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_KERNEL_SET_ARG_POINTER, "urKernelSetArgPointer", &params);
+        UR_FUNCTION_KERNEL_SET_ARG_POINTER, "urKernelSetArgPointer", &params,
+        hKernel, argIndex, pProperties, pArgValue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelSetArgPointer\n");
@@ -3604,10 +4092,16 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_EXEC_INFO)) {
+        return pfnSetExecInfo(hKernel, propName, propSize, pProperties,
+                              pPropValue);
+    }
+
     ur_kernel_set_exec_info_params_t params = {&hKernel, &propName, &propSize,
                                                &pProperties, &pPropValue};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_KERNEL_SET_EXEC_INFO, "urKernelSetExecInfo", &params);
+        UR_FUNCTION_KERNEL_SET_EXEC_INFO, "urKernelSetExecInfo", &params,
+        hKernel, propName, propSize, pProperties, pPropValue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelSetExecInfo\n");
@@ -3644,10 +4138,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER)) {
+        return pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
+    }
+
     ur_kernel_set_arg_sampler_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &hArgValue};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, "urKernelSetArgSampler", &params);
+        UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, "urKernelSetArgSampler", &params,
+        hKernel, argIndex, pProperties, hArgValue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelSetArgSampler\n");
@@ -3685,10 +4184,15 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ)) {
+        return pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
+    }
+
     ur_kernel_set_arg_mem_obj_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &hArgValue};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, "urKernelSetArgMemObj", &params);
+        UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, "urKernelSetArgMemObj", &params,
+        hKernel, argIndex, pProperties, hArgValue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelSetArgMemObj\n");
@@ -3726,11 +4230,17 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS)) {
+        return pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
+    }
+
     ur_kernel_set_specialization_constants_params_t params = {&hKernel, &count,
                                                               &pSpecConstants};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS,
-        "urKernelSetSpecializationConstants", &params);
+        "urKernelSetSpecializationConstants", &params, hKernel, count,
+        pSpecConstants);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelSetSpecializationConstants\n");
@@ -3767,10 +4277,14 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hKernel, phNativeKernel);
+    }
+
     ur_kernel_get_native_handle_params_t params = {&hKernel, &phNativeKernel};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE,
-                                   "urKernelGetNativeHandle", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE, "urKernelGetNativeHandle",
+        &params, hKernel, phNativeKernel);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelGetNativeHandle\n");
@@ -3812,11 +4326,18 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeKernel, hContext, hProgram,
+                                         pProperties, phKernel);
+    }
+
     ur_kernel_create_with_native_handle_params_t params = {
         &hNativeKernel, &hContext, &hProgram, &pProperties, &phKernel};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE,
-                                   "urKernelCreateWithNativeHandle", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE,
+        "urKernelCreateWithNativeHandle", &params, hNativeKernel, hContext,
+        hProgram, pProperties, phKernel);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelCreateWithNativeHandle\n");
@@ -3865,12 +4386,21 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE)) {
+        return pfnGetSuggestedLocalWorkSize(hKernel, hQueue, numWorkDim,
+                                            pGlobalWorkOffset, pGlobalWorkSize,
+                                            pSuggestedLocalWorkSize);
+    }
+
     ur_kernel_get_suggested_local_work_size_params_t params = {
         &hKernel,           &hQueue,          &numWorkDim,
         &pGlobalWorkOffset, &pGlobalWorkSize, &pSuggestedLocalWorkSize};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE,
-        "urKernelGetSuggestedLocalWorkSize", &params);
+        "urKernelGetSuggestedLocalWorkSize", &params, hKernel, hQueue,
+        numWorkDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pSuggestedLocalWorkSize);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelGetSuggestedLocalWorkSize\n");
@@ -3914,10 +4444,16 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_GET_INFO)) {
+        return pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
+    }
+
     ur_queue_get_info_params_t params = {&hQueue, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_GET_INFO,
-                                                   "urQueueGetInfo", &params);
+                                                   "urQueueGetInfo", &params,
+                                                   hQueue, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urQueueGetInfo\n");
@@ -3955,10 +4491,16 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_CREATE)) {
+        return pfnCreate(hContext, hDevice, pProperties, phQueue);
+    }
+
     ur_queue_create_params_t params = {&hContext, &hDevice, &pProperties,
                                        &phQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_CREATE,
-                                                   "urQueueCreate", &params);
+                                                   "urQueueCreate", &params,
+                                                   hContext, hDevice,
+                                                   pProperties, phQueue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urQueueCreate\n");
@@ -3991,9 +4533,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_RETAIN)) {
+        return pfnRetain(hQueue);
+    }
+
     ur_queue_retain_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_RETAIN,
-                                                   "urQueueRetain", &params);
+                                                   "urQueueRetain", &params,
+                                                   hQueue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urQueueRetain\n");
@@ -4026,9 +4573,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_RELEASE)) {
+        return pfnRelease(hQueue);
+    }
+
     ur_queue_release_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_RELEASE,
-                                                   "urQueueRelease", &params);
+                                                   "urQueueRelease", &params,
+                                                   hQueue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urQueueRelease\n");
@@ -4064,10 +4616,15 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hQueue, pDesc, phNativeQueue);
+    }
+
     ur_queue_get_native_handle_params_t params = {&hQueue, &pDesc,
                                                   &phNativeQueue};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, "urQueueGetNativeHandle", &params);
+        UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, "urQueueGetNativeHandle", &params,
+        hQueue, pDesc, phNativeQueue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urQueueGetNativeHandle\n");
@@ -4108,11 +4665,17 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeQueue, hContext, hDevice,
+                                         pProperties, phQueue);
+    }
+
     ur_queue_create_with_native_handle_params_t params = {
         &hNativeQueue, &hContext, &hDevice, &pProperties, &phQueue};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE,
-                                   "urQueueCreateWithNativeHandle", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE,
+        "urQueueCreateWithNativeHandle", &params, hNativeQueue, hContext,
+        hDevice, pProperties, phQueue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urQueueCreateWithNativeHandle\n");
@@ -4146,9 +4709,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_FINISH)) {
+        return pfnFinish(hQueue);
+    }
+
     ur_queue_finish_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_FINISH,
-                                                   "urQueueFinish", &params);
+                                                   "urQueueFinish", &params,
+                                                   hQueue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urQueueFinish\n");
@@ -4180,9 +4748,14 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_FLUSH)) {
+        return pfnFlush(hQueue);
+    }
+
     ur_queue_flush_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_FLUSH,
-                                                   "urQueueFlush", &params);
+                                                   "urQueueFlush", &params,
+                                                   hQueue);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urQueueFlush\n");
@@ -4220,10 +4793,16 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_INFO)) {
+        return pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
+    }
+
     ur_event_get_info_params_t params = {&hEvent, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_GET_INFO,
-                                                   "urEventGetInfo", &params);
+                                                   "urEventGetInfo", &params,
+                                                   hEvent, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEventGetInfo\n");
@@ -4266,11 +4845,16 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_PROFILING_INFO)) {
+        return pfnGetProfilingInfo(hEvent, propName, propSize, pPropValue,
+                                   pPropSizeRet);
+    }
+
     ur_event_get_profiling_info_params_t params = {
         &hEvent, &propName, &propSize, &pPropValue, &pPropSizeRet};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_EVENT_GET_PROFILING_INFO,
-                                   "urEventGetProfilingInfo", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_EVENT_GET_PROFILING_INFO, "urEventGetProfilingInfo",
+        &params, hEvent, propName, propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEventGetProfilingInfo\n");
@@ -4307,9 +4891,14 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_WAIT)) {
+        return pfnWait(numEvents, phEventWaitList);
+    }
+
     ur_event_wait_params_t params = {&numEvents, &phEventWaitList};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_WAIT,
-                                                   "urEventWait", &params);
+                                                   "urEventWait", &params,
+                                                   numEvents, phEventWaitList);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEventWait\n");
@@ -4340,9 +4929,14 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_RETAIN)) {
+        return pfnRetain(hEvent);
+    }
+
     ur_event_retain_params_t params = {&hEvent};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_RETAIN,
-                                                   "urEventRetain", &params);
+                                                   "urEventRetain", &params,
+                                                   hEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEventRetain\n");
@@ -4374,9 +4968,14 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_RELEASE)) {
+        return pfnRelease(hEvent);
+    }
+
     ur_event_release_params_t params = {&hEvent};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_RELEASE,
-                                                   "urEventRelease", &params);
+                                                   "urEventRelease", &params,
+                                                   hEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEventRelease\n");
@@ -4410,9 +5009,14 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hEvent, phNativeEvent);
+    }
+
     ur_event_get_native_handle_params_t params = {&hEvent, &phNativeEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, "urEventGetNativeHandle", &params);
+        UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, "urEventGetNativeHandle", &params,
+        hEvent, phNativeEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEventGetNativeHandle\n");
@@ -4452,11 +5056,17 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeEvent, hContext, pProperties,
+                                         phEvent);
+    }
+
     ur_event_create_with_native_handle_params_t params = {
         &hNativeEvent, &hContext, &pProperties, &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE,
-                                   "urEventCreateWithNativeHandle", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE,
+        "urEventCreateWithNativeHandle", &params, hNativeEvent, hContext,
+        pProperties, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEventCreateWithNativeHandle\n");
@@ -4494,10 +5104,15 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_SET_CALLBACK)) {
+        return pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
+    }
+
     ur_event_set_callback_params_t params = {&hEvent, &execStatus, &pfnNotify,
                                              &pUserData};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_EVENT_SET_CALLBACK, "urEventSetCallback", &params);
+        UR_FUNCTION_EVENT_SET_CALLBACK, "urEventSetCallback", &params, hEvent,
+        execStatus, pfnNotify, pUserData);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEventSetCallback\n");
@@ -4556,6 +5171,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH)) {
+        return pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
+                               pGlobalWorkSize, pLocalWorkSize,
+                               numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_kernel_launch_params_t params = {&hQueue,
                                                 &hKernel,
                                                 &workDim,
@@ -4566,7 +5187,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
                                                 &phEventWaitList,
                                                 &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, "urEnqueueKernelLaunch", &params);
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, "urEnqueueKernelLaunch", &params,
+        hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueKernelLaunch\n");
@@ -4611,10 +5234,16 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_EVENTS_WAIT)) {
+        return pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList,
+                             phEvent);
+    }
+
     ur_enqueue_events_wait_params_t params = {&hQueue, &numEventsInWaitList,
                                               &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_EVENTS_WAIT, "urEnqueueEventsWait", &params);
+        UR_FUNCTION_ENQUEUE_EVENTS_WAIT, "urEnqueueEventsWait", &params, hQueue,
+        numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueEventsWait\n");
@@ -4658,11 +5287,18 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER)) {
+        return pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
     ur_enqueue_events_wait_with_barrier_params_t params = {
         &hQueue, &numEventsInWaitList, &phEventWaitList, &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER,
-                                   "urEnqueueEventsWaitWithBarrier", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER,
+        "urEnqueueEventsWaitWithBarrier", &params, hQueue, numEventsInWaitList,
+        phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueEventsWaitWithBarrier\n");
@@ -4711,12 +5347,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ)) {
+        return pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size,
+                                pDst, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
     ur_enqueue_mem_buffer_read_params_t params = {
         &hQueue, &hBuffer, &blockingRead,        &offset,
         &size,   &pDst,    &numEventsInWaitList, &phEventWaitList,
         &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, "urEnqueueMemBufferRead", &params);
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, "urEnqueueMemBufferRead", &params,
+        hQueue, hBuffer, blockingRead, offset, size, pDst, numEventsInWaitList,
+        phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemBufferRead\n");
@@ -4768,13 +5412,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE)) {
+        return pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size,
+                                 pSrc, numEventsInWaitList, phEventWaitList,
+                                 phEvent);
+    }
+
     ur_enqueue_mem_buffer_write_params_t params = {
         &hQueue, &hBuffer, &blockingWrite,       &offset,
         &size,   &pSrc,    &numEventsInWaitList, &phEventWaitList,
         &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE,
-                                   "urEnqueueMemBufferWrite", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE, "urEnqueueMemBufferWrite",
+        &params, hQueue, hBuffer, blockingWrite, offset, size, pSrc,
+        numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemBufferWrite\n");
@@ -4837,6 +5488,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT)) {
+        return pfnMemBufferReadRect(hQueue, hBuffer, blockingRead, bufferOrigin,
+                                    hostOrigin, region, bufferRowPitch,
+                                    bufferSlicePitch, hostRowPitch,
+                                    hostSlicePitch, pDst, numEventsInWaitList,
+                                    phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_buffer_read_rect_params_t params = {&hQueue,
                                                        &hBuffer,
                                                        &blockingRead,
@@ -4851,9 +5510,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
                                                        &numEventsInWaitList,
                                                        &phEventWaitList,
                                                        &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT,
-                                   "urEnqueueMemBufferReadRect", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT, "urEnqueueMemBufferReadRect",
+        &params, hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin,
+        region, bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+        pDst, numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemBufferReadRect\n");
@@ -4920,6 +5581,15 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT)) {
+        return pfnMemBufferWriteRect(hQueue, hBuffer, blockingWrite,
+                                     bufferOrigin, hostOrigin, region,
+                                     bufferRowPitch, bufferSlicePitch,
+                                     hostRowPitch, hostSlicePitch, pSrc,
+                                     numEventsInWaitList, phEventWaitList,
+                                     phEvent);
+    }
+
     ur_enqueue_mem_buffer_write_rect_params_t params = {&hQueue,
                                                         &hBuffer,
                                                         &blockingWrite,
@@ -4934,9 +5604,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
                                                         &numEventsInWaitList,
                                                         &phEventWaitList,
                                                         &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT,
-                                   "urEnqueueMemBufferWriteRect", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT,
+        "urEnqueueMemBufferWriteRect", &params, hQueue, hBuffer, blockingWrite,
+        bufferOrigin, hostOrigin, region, bufferRowPitch, bufferSlicePitch,
+        hostRowPitch, hostSlicePitch, pSrc, numEventsInWaitList,
+        phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemBufferWriteRect\n");
@@ -4988,11 +5661,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY)) {
+        return pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset,
+                                dstOffset, size, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_buffer_copy_params_t params = {
         &hQueue, &hBufferSrc,          &hBufferDst,      &srcOffset, &dstOffset,
         &size,   &numEventsInWaitList, &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, "urEnqueueMemBufferCopy", &params);
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, "urEnqueueMemBufferCopy", &params,
+        hQueue, hBufferSrc, hBufferDst, srcOffset, dstOffset, size,
+        numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemBufferCopy\n");
@@ -5053,14 +5734,24 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT)) {
+        return pfnMemBufferCopyRect(hQueue, hBufferSrc, hBufferDst, srcOrigin,
+                                    dstOrigin, region, srcRowPitch,
+                                    srcSlicePitch, dstRowPitch, dstSlicePitch,
+                                    numEventsInWaitList, phEventWaitList,
+                                    phEvent);
+    }
+
     ur_enqueue_mem_buffer_copy_rect_params_t params = {
         &hQueue,      &hBufferSrc,    &hBufferDst,          &srcOrigin,
         &dstOrigin,   &region,        &srcRowPitch,         &srcSlicePitch,
         &dstRowPitch, &dstSlicePitch, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT,
-                                   "urEnqueueMemBufferCopyRect", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT, "urEnqueueMemBufferCopyRect",
+        &params, hQueue, hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemBufferCopyRect\n");
@@ -5111,6 +5802,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL)) {
+        return pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset,
+                                size, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
     ur_enqueue_mem_buffer_fill_params_t params = {&hQueue,
                                                   &hBuffer,
                                                   &pPattern,
@@ -5121,7 +5818,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
                                                   &phEventWaitList,
                                                   &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, "urEnqueueMemBufferFill", &params);
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, "urEnqueueMemBufferFill", &params,
+        hQueue, hBuffer, pPattern, patternSize, offset, size,
+        numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemBufferFill\n");
@@ -5176,13 +5875,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ)) {
+        return pfnMemImageRead(hQueue, hImage, blockingRead, origin, region,
+                               rowPitch, slicePitch, pDst, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_read_params_t params = {
         &hQueue,          &hImage, &blockingRead,
         &origin,          &region, &rowPitch,
         &slicePitch,      &pDst,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, "urEnqueueMemImageRead", &params);
+        UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, "urEnqueueMemImageRead", &params,
+        hQueue, hImage, blockingRead, origin, region, rowPitch, slicePitch,
+        pDst, numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemImageRead\n");
@@ -5238,13 +5945,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE)) {
+        return pfnMemImageWrite(hQueue, hImage, blockingWrite, origin, region,
+                                rowPitch, slicePitch, pSrc, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_write_params_t params = {
         &hQueue,          &hImage, &blockingWrite,
         &origin,          &region, &rowPitch,
         &slicePitch,      &pSrc,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, "urEnqueueMemImageWrite", &params);
+        UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, "urEnqueueMemImageWrite", &params,
+        hQueue, hImage, blockingWrite, origin, region, rowPitch, slicePitch,
+        pSrc, numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemImageWrite\n");
@@ -5301,11 +6016,19 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY)) {
+        return pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin,
+                               dstOrigin, region, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_copy_params_t params = {
         &hQueue, &hImageSrc,           &hImageDst,       &srcOrigin, &dstOrigin,
         &region, &numEventsInWaitList, &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, "urEnqueueMemImageCopy", &params);
+        UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, "urEnqueueMemImageCopy", &params,
+        hQueue, hImageSrc, hImageDst, srcOrigin, dstOrigin, region,
+        numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemImageCopy\n");
@@ -5357,12 +6080,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP)) {
+        return pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags, offset,
+                               size, numEventsInWaitList, phEventWaitList,
+                               phEvent, ppRetMap);
+    }
+
     ur_enqueue_mem_buffer_map_params_t params = {
         &hQueue,  &hBuffer, &blockingMap,         &mapFlags,
         &offset,  &size,    &numEventsInWaitList, &phEventWaitList,
         &phEvent, &ppRetMap};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, "urEnqueueMemBufferMap", &params);
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, "urEnqueueMemBufferMap", &params,
+        hQueue, hBuffer, blockingMap, mapFlags, offset, size,
+        numEventsInWaitList, phEventWaitList, phEvent, ppRetMap);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemBufferMap\n");
@@ -5409,11 +6140,17 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_UNMAP)) {
+        return pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
+                           phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_unmap_params_t params = {
         &hQueue,          &hMem,   &pMappedPtr, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_MEM_UNMAP, "urEnqueueMemUnmap", &params);
+        UR_FUNCTION_ENQUEUE_MEM_UNMAP, "urEnqueueMemUnmap", &params, hQueue,
+        hMem, pMappedPtr, numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueMemUnmap\n");
@@ -5464,12 +6201,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_FILL)) {
+        return pfnUSMFill(hQueue, pMem, patternSize, pPattern, size,
+                          numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_fill_params_t params = {
         &hQueue,          &pMem,   &patternSize,
         &pPattern,        &size,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ENQUEUE_USM_FILL,
-                                                   "urEnqueueUSMFill", &params);
+                                                   "urEnqueueUSMFill", &params,
+                                                   hQueue, pMem, patternSize,
+                                                   pPattern, size,
+                                                   numEventsInWaitList,
+                                                   phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueUSMFill\n");
@@ -5518,11 +6264,18 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_MEMCPY)) {
+        return pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size,
+                            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_memcpy_params_t params = {
         &hQueue,          &blocking, &pDst, &pSrc, &size, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_USM_MEMCPY, "urEnqueueUSMMemcpy", &params);
+        UR_FUNCTION_ENQUEUE_USM_MEMCPY, "urEnqueueUSMMemcpy", &params, hQueue,
+        blocking, pDst, pSrc, size, numEventsInWaitList, phEventWaitList,
+        phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueUSMMemcpy\n");
@@ -5569,11 +6322,18 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_PREFETCH)) {
+        return pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_prefetch_params_t params = {
         &hQueue,          &pMem,   &size, &flags, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_USM_PREFETCH, "urEnqueueUSMPrefetch", &params);
+        UR_FUNCTION_ENQUEUE_USM_PREFETCH, "urEnqueueUSMPrefetch", &params,
+        hQueue, pMem, size, flags, numEventsInWaitList, phEventWaitList,
+        phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueUSMPrefetch\n");
@@ -5615,10 +6375,15 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_ADVISE)) {
+        return pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
+    }
+
     ur_enqueue_usm_advise_params_t params = {&hQueue, &pMem, &size, &advice,
                                              &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_USM_ADVISE, "urEnqueueUSMAdvise", &params);
+        UR_FUNCTION_ENQUEUE_USM_ADVISE, "urEnqueueUSMAdvise", &params, hQueue,
+        pMem, size, advice, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueUSMAdvise\n");
@@ -5672,12 +6437,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_FILL_2D)) {
+        return pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width,
+                            height, numEventsInWaitList, phEventWaitList,
+                            phEvent);
+    }
+
     ur_enqueue_usm_fill_2d_params_t params = {
         &hQueue,          &pMem,   &pitch,  &patternSize,
         &pPattern,        &width,  &height, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_USM_FILL_2D, "urEnqueueUSMFill2D", &params);
+        UR_FUNCTION_ENQUEUE_USM_FILL_2D, "urEnqueueUSMFill2D", &params, hQueue,
+        pMem, pitch, patternSize, pPattern, width, height, numEventsInWaitList,
+        phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueUSMFill2D\n");
@@ -5732,13 +6505,21 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D)) {
+        return pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch,
+                              width, height, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_memcpy_2d_params_t params = {
         &hQueue,          &blocking, &pDst,
         &dstPitch,        &pSrc,     &srcPitch,
         &width,           &height,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D, "urEnqueueUSMMemcpy2D", &params);
+        UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D, "urEnqueueUSMMemcpy2D", &params,
+        hQueue, blocking, pDst, dstPitch, pSrc, srcPitch, width, height,
+        numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueUSMMemcpy2D\n");
@@ -5792,13 +6573,23 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE)) {
+        return pfnDeviceGlobalVariableWrite(hQueue, hProgram, name,
+                                            blockingWrite, count, offset, pSrc,
+                                            numEventsInWaitList,
+                                            phEventWaitList, phEvent);
+    }
+
     ur_enqueue_device_global_variable_write_params_t params = {
         &hQueue,          &hProgram, &name, &blockingWrite,
         &count,           &offset,   &pSrc, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
-        "urEnqueueDeviceGlobalVariableWrite", &params);
+        "urEnqueueDeviceGlobalVariableWrite", &params, hQueue, hProgram, name,
+        blockingWrite, count, offset, pSrc, numEventsInWaitList,
+        phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueDeviceGlobalVariableWrite\n");
@@ -5853,13 +6644,23 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ)) {
+        return pfnDeviceGlobalVariableRead(hQueue, hProgram, name, blockingRead,
+                                           count, offset, pDst,
+                                           numEventsInWaitList, phEventWaitList,
+                                           phEvent);
+    }
+
     ur_enqueue_device_global_variable_read_params_t params = {
         &hQueue,          &hProgram, &name, &blockingRead,
         &count,           &offset,   &pDst, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ,
-        "urEnqueueDeviceGlobalVariableRead", &params);
+        "urEnqueueDeviceGlobalVariableRead", &params, hQueue, hProgram, name,
+        blockingRead, count, offset, pDst, numEventsInWaitList, phEventWaitList,
+        phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueDeviceGlobalVariableRead\n");
@@ -5916,12 +6717,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE)) {
+        return pfnReadHostPipe(hQueue, hProgram, pipe_symbol, blocking, pDst,
+                               size, numEventsInWaitList, phEventWaitList,
+                               phEvent);
+    }
+
     ur_enqueue_read_host_pipe_params_t params = {
         &hQueue, &hProgram, &pipe_symbol,         &blocking,
         &pDst,   &size,     &numEventsInWaitList, &phEventWaitList,
         &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, "urEnqueueReadHostPipe", &params);
+        UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, "urEnqueueReadHostPipe", &params,
+        hQueue, hProgram, pipe_symbol, blocking, pDst, size,
+        numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueReadHostPipe\n");
@@ -5978,12 +6787,20 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE)) {
+        return pfnWriteHostPipe(hQueue, hProgram, pipe_symbol, blocking, pSrc,
+                                size, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
     ur_enqueue_write_host_pipe_params_t params = {
         &hQueue, &hProgram, &pipe_symbol,         &blocking,
         &pSrc,   &size,     &numEventsInWaitList, &phEventWaitList,
         &phEvent};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, "urEnqueueWriteHostPipe", &params);
+        UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, "urEnqueueWriteHostPipe", &params,
+        hQueue, hProgram, pipe_symbol, blocking, pSrc, size,
+        numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueWriteHostPipe\n");
@@ -6031,11 +6848,19 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_PITCHED_ALLOC_EXP)) {
+        return pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool,
+                                  widthInBytes, height, elementSizeBytes, ppMem,
+                                  pResultPitch);
+    }
+
     ur_usm_pitched_alloc_exp_params_t params = {
         &hContext, &hDevice,          &pUSMDesc, &pool,        &widthInBytes,
         &height,   &elementSizeBytes, &ppMem,    &pResultPitch};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_USM_PITCHED_ALLOC_EXP, "urUSMPitchedAllocExp", &params);
+        UR_FUNCTION_USM_PITCHED_ALLOC_EXP, "urUSMPitchedAllocExp", &params,
+        hContext, hDevice, pUSMDesc, pool, widthInBytes, height,
+        elementSizeBytes, ppMem, pResultPitch);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMPitchedAllocExp\n");
@@ -6076,11 +6901,17 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP)) {
+        return pfnUnsampledImageHandleDestroyExp(hContext, hDevice, hImage);
+    }
+
     ur_bindless_images_unsampled_image_handle_destroy_exp_params_t params = {
         &hContext, &hDevice, &hImage};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
-        "urBindlessImagesUnsampledImageHandleDestroyExp", &params);
+        "urBindlessImagesUnsampledImageHandleDestroyExp", &params, hContext,
+        hDevice, hImage);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesUnsampledImageHandleDestroyExp\n");
@@ -6125,11 +6956,17 @@ urBindlessImagesSampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP)) {
+        return pfnSampledImageHandleDestroyExp(hContext, hDevice, hImage);
+    }
+
     ur_bindless_images_sampled_image_handle_destroy_exp_params_t params = {
         &hContext, &hDevice, &hImage};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
-        "urBindlessImagesSampledImageHandleDestroyExp", &params);
+        "urBindlessImagesSampledImageHandleDestroyExp", &params, hContext,
+        hDevice, hImage);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesSampledImageHandleDestroyExp\n");
@@ -6174,11 +7011,18 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP)) {
+        return pfnImageAllocateExp(hContext, hDevice, pImageFormat, pImageDesc,
+                                   phImageMem);
+    }
+
     ur_bindless_images_image_allocate_exp_params_t params = {
         &hContext, &hDevice, &pImageFormat, &pImageDesc, &phImageMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP,
-        "urBindlessImagesImageAllocateExp", &params);
+        "urBindlessImagesImageAllocateExp", &params, hContext, hDevice,
+        pImageFormat, pImageDesc, phImageMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesImageAllocateExp\n");
@@ -6216,11 +7060,15 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP)) {
+        return pfnImageFreeExp(hContext, hDevice, hImageMem);
+    }
+
     ur_bindless_images_image_free_exp_params_t params = {&hContext, &hDevice,
                                                          &hImageMem};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP,
-                                   "urBindlessImagesImageFreeExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP,
+        "urBindlessImagesImageFreeExp", &params, hContext, hDevice, hImageMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesImageFreeExp\n");
@@ -6262,11 +7110,18 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP)) {
+        return pfnUnsampledImageCreateExp(hContext, hDevice, hImageMem,
+                                          pImageFormat, pImageDesc, phImage);
+    }
+
     ur_bindless_images_unsampled_image_create_exp_params_t params = {
         &hContext, &hDevice, &hImageMem, &pImageFormat, &pImageDesc, &phImage};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
-        "urBindlessImagesUnsampledImageCreateExp", &params);
+        "urBindlessImagesUnsampledImageCreateExp", &params, hContext, hDevice,
+        hImageMem, pImageFormat, pImageDesc, phImage);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesUnsampledImageCreateExp\n");
@@ -6312,12 +7167,20 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP)) {
+        return pfnSampledImageCreateExp(hContext, hDevice, hImageMem,
+                                        pImageFormat, pImageDesc, hSampler,
+                                        phImage);
+    }
+
     ur_bindless_images_sampled_image_create_exp_params_t params = {
         &hContext,   &hDevice,  &hImageMem, &pImageFormat,
         &pImageDesc, &hSampler, &phImage};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
-        "urBindlessImagesSampledImageCreateExp", &params);
+        "urBindlessImagesSampledImageCreateExp", &params, hContext, hDevice,
+        hImageMem, pImageFormat, pImageDesc, hSampler, phImage);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesSampledImageCreateExp\n");
@@ -6378,6 +7241,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP)) {
+        return pfnImageCopyExp(hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc,
+                               pSrcImageFormat, pDstImageFormat, pCopyRegion,
+                               imageCopyFlags, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
     ur_bindless_images_image_copy_exp_params_t params = {&hQueue,
                                                          &pSrc,
                                                          &pDst,
@@ -6390,9 +7260,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
                                                          &numEventsInWaitList,
                                                          &phEventWaitList,
                                                          &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP,
-                                   "urBindlessImagesImageCopyExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP,
+        "urBindlessImagesImageCopyExp", &params, hQueue, pSrc, pDst,
+        pSrcImageDesc, pDstImageDesc, pSrcImageFormat, pDstImageFormat,
+        pCopyRegion, imageCopyFlags, numEventsInWaitList, phEventWaitList,
+        phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesImageCopyExp\n");
@@ -6434,11 +7307,18 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP)) {
+        return pfnImageGetInfoExp(hContext, hImageMem, propName, pPropValue,
+                                  pPropSizeRet);
+    }
+
     ur_bindless_images_image_get_info_exp_params_t params = {
         &hContext, &hImageMem, &propName, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP,
-        "urBindlessImagesImageGetInfoExp", &params);
+        "urBindlessImagesImageGetInfoExp", &params, hContext, hImageMem,
+        propName, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesImageGetInfoExp\n");
@@ -6479,11 +7359,18 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP)) {
+        return pfnMipmapGetLevelExp(hContext, hDevice, hImageMem, mipmapLevel,
+                                    phImageMem);
+    }
+
     ur_bindless_images_mipmap_get_level_exp_params_t params = {
         &hContext, &hDevice, &hImageMem, &mipmapLevel, &phImageMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP,
-        "urBindlessImagesMipmapGetLevelExp", &params);
+        "urBindlessImagesMipmapGetLevelExp", &params, hContext, hDevice,
+        hImageMem, mipmapLevel, phImageMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesMipmapGetLevelExp\n");
@@ -6522,11 +7409,15 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP)) {
+        return pfnMipmapFreeExp(hContext, hDevice, hMem);
+    }
+
     ur_bindless_images_mipmap_free_exp_params_t params = {&hContext, &hDevice,
                                                           &hMem};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP,
-                                   "urBindlessImagesMipmapFreeExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP,
+        "urBindlessImagesMipmapFreeExp", &params, hContext, hDevice, hMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesMipmapFreeExp\n");
@@ -6568,12 +7459,20 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP)) {
+        return pfnImportExternalMemoryExp(hContext, hDevice, size,
+                                          memHandleType, pExternalMemDesc,
+                                          phExternalMem);
+    }
+
     ur_bindless_images_import_external_memory_exp_params_t params = {
         &hContext,      &hDevice,          &size,
         &memHandleType, &pExternalMemDesc, &phExternalMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
-        "urBindlessImagesImportExternalMemoryExp", &params);
+        "urBindlessImagesImportExternalMemoryExp", &params, hContext, hDevice,
+        size, memHandleType, pExternalMemDesc, phExternalMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesImportExternalMemoryExp\n");
@@ -6619,12 +7518,19 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP)) {
+        return pfnMapExternalArrayExp(hContext, hDevice, pImageFormat,
+                                      pImageDesc, hExternalMem, phImageMem);
+    }
+
     ur_bindless_images_map_external_array_exp_params_t params = {
         &hContext,   &hDevice,      &pImageFormat,
         &pImageDesc, &hExternalMem, &phImageMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP,
-        "urBindlessImagesMapExternalArrayExp", &params);
+        "urBindlessImagesMapExternalArrayExp", &params, hContext, hDevice,
+        pImageFormat, pImageDesc, hExternalMem, phImageMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesMapExternalArrayExp\n");
@@ -6667,11 +7573,18 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP)) {
+        return pfnMapExternalLinearMemoryExp(hContext, hDevice, offset, size,
+                                             hExternalMem, ppRetMem);
+    }
+
     ur_bindless_images_map_external_linear_memory_exp_params_t params = {
         &hContext, &hDevice, &offset, &size, &hExternalMem, &ppRetMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
-        "urBindlessImagesMapExternalLinearMemoryExp", &params);
+        "urBindlessImagesMapExternalLinearMemoryExp", &params, hContext,
+        hDevice, offset, size, hExternalMem, ppRetMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesMapExternalLinearMemoryExp\n");
@@ -6713,11 +7626,17 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP)) {
+        return pfnReleaseExternalMemoryExp(hContext, hDevice, hExternalMem);
+    }
+
     ur_bindless_images_release_external_memory_exp_params_t params = {
         &hContext, &hDevice, &hExternalMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
-        "urBindlessImagesReleaseExternalMemoryExp", &params);
+        "urBindlessImagesReleaseExternalMemoryExp", &params, hContext, hDevice,
+        hExternalMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesReleaseExternalMemoryExp\n");
@@ -6762,12 +7681,20 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnImportExternalSemaphoreExp(hContext, hDevice, semHandleType,
+                                             pExternalSemaphoreDesc,
+                                             phExternalSemaphore);
+    }
+
     ur_bindless_images_import_external_semaphore_exp_params_t params = {
         &hContext, &hDevice, &semHandleType, &pExternalSemaphoreDesc,
         &phExternalSemaphore};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP,
-        "urBindlessImagesImportExternalSemaphoreExp", &params);
+        "urBindlessImagesImportExternalSemaphoreExp", &params, hContext,
+        hDevice, semHandleType, pExternalSemaphoreDesc, phExternalSemaphore);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesImportExternalSemaphoreExp\n");
@@ -6810,11 +7737,18 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnReleaseExternalSemaphoreExp(hContext, hDevice,
+                                              hExternalSemaphore);
+    }
+
     ur_bindless_images_release_external_semaphore_exp_params_t params = {
         &hContext, &hDevice, &hExternalSemaphore};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
-        "urBindlessImagesReleaseExternalSemaphoreExp", &params);
+        "urBindlessImagesReleaseExternalSemaphoreExp", &params, hContext,
+        hDevice, hExternalSemaphore);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesReleaseExternalSemaphoreExp\n");
@@ -6871,13 +7805,21 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnWaitExternalSemaphoreExp(hQueue, hSemaphore, hasWaitValue,
+                                           waitValue, numEventsInWaitList,
+                                           phEventWaitList, phEvent);
+    }
+
     ur_bindless_images_wait_external_semaphore_exp_params_t params = {
         &hQueue,    &hSemaphore,          &hasWaitValue,
         &waitValue, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
-        "urBindlessImagesWaitExternalSemaphoreExp", &params);
+        "urBindlessImagesWaitExternalSemaphoreExp", &params, hQueue, hSemaphore,
+        hasWaitValue, waitValue, numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesWaitExternalSemaphoreExp\n");
@@ -6934,13 +7876,22 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnSignalExternalSemaphoreExp(hQueue, hSemaphore, hasSignalValue,
+                                             signalValue, numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+    }
+
     ur_bindless_images_signal_external_semaphore_exp_params_t params = {
         &hQueue,      &hSemaphore,          &hasSignalValue,
         &signalValue, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
-        "urBindlessImagesSignalExternalSemaphoreExp", &params);
+        "urBindlessImagesSignalExternalSemaphoreExp", &params, hQueue,
+        hSemaphore, hasSignalValue, signalValue, numEventsInWaitList,
+        phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urBindlessImagesSignalExternalSemaphoreExp\n");
@@ -6983,11 +7934,16 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP)) {
+        return pfnCreateExp(hContext, hDevice, pCommandBufferDesc,
+                            phCommandBuffer);
+    }
+
     ur_command_buffer_create_exp_params_t params = {
         &hContext, &hDevice, &pCommandBufferDesc, &phCommandBuffer};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP,
-                                   "urCommandBufferCreateExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP, "urCommandBufferCreateExp",
+        &params, hContext, hDevice, pCommandBufferDesc, phCommandBuffer);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferCreateExp\n");
@@ -7022,10 +7978,14 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP)) {
+        return pfnRetainExp(hCommandBuffer);
+    }
+
     ur_command_buffer_retain_exp_params_t params = {&hCommandBuffer};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP,
-                                   "urCommandBufferRetainExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP, "urCommandBufferRetainExp",
+        &params, hCommandBuffer);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferRetainExp\n");
@@ -7060,10 +8020,14 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP)) {
+        return pfnReleaseExp(hCommandBuffer);
+    }
+
     ur_command_buffer_release_exp_params_t params = {&hCommandBuffer};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP,
-                                   "urCommandBufferReleaseExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP, "urCommandBufferReleaseExp",
+        &params, hCommandBuffer);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferReleaseExp\n");
@@ -7098,10 +8062,14 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP)) {
+        return pfnFinalizeExp(hCommandBuffer);
+    }
+
     ur_command_buffer_finalize_exp_params_t params = {&hCommandBuffer};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP,
-                                   "urCommandBufferFinalizeExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP, "urCommandBufferFinalizeExp",
+        &params, hCommandBuffer);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferFinalizeExp\n");
@@ -7164,6 +8132,17 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP)) {
+        return pfnAppendKernelLaunchExp(hCommandBuffer, hKernel, workDim,
+                                        pGlobalWorkOffset, pGlobalWorkSize,
+                                        pLocalWorkSize, numKernelAlternatives,
+                                        phKernelAlternatives,
+                                        numSyncPointsInWaitList,
+                                        pSyncPointWaitList, pSyncPoint,
+                                        phCommand);
+    }
+
     ur_command_buffer_append_kernel_launch_exp_params_t params = {
         &hCommandBuffer,
         &hKernel,
@@ -7179,7 +8158,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         &phCommand};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
-        "urCommandBufferAppendKernelLaunchExp", &params);
+        "urCommandBufferAppendKernelLaunchExp", &params, hCommandBuffer,
+        hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize, pLocalWorkSize,
+        numKernelAlternatives, phKernelAlternatives, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint, phCommand);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendKernelLaunchExp\n");
@@ -7228,12 +8210,20 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP)) {
+        return pfnAppendUSMMemcpyExp(hCommandBuffer, pDst, pSrc, size,
+                                     numSyncPointsInWaitList,
+                                     pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_usm_memcpy_exp_params_t params = {
         &hCommandBuffer,     &pDst,      &pSrc, &size, &numSyncPointsInWaitList,
         &pSyncPointWaitList, &pSyncPoint};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP,
-        "urCommandBufferAppendUSMMemcpyExp", &params);
+        "urCommandBufferAppendUSMMemcpyExp", &params, hCommandBuffer, pDst,
+        pSrc, size, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendUSMMemcpyExp\n");
@@ -7283,13 +8273,22 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP)) {
+        return pfnAppendUSMFillExp(hCommandBuffer, pMemory, pPattern,
+                                   patternSize, size, numSyncPointsInWaitList,
+                                   pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_usm_fill_exp_params_t params = {
         &hCommandBuffer,     &pMemory,   &pPattern,
         &patternSize,        &size,      &numSyncPointsInWaitList,
         &pSyncPointWaitList, &pSyncPoint};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP,
-        "urCommandBufferAppendUSMFillExp", &params);
+        "urCommandBufferAppendUSMFillExp", &params, hCommandBuffer, pMemory,
+        pPattern, patternSize, size, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendUSMFillExp\n");
@@ -7338,6 +8337,14 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP)) {
+        return pfnAppendMemBufferCopyExp(hCommandBuffer, hSrcMem, hDstMem,
+                                         srcOffset, dstOffset, size,
+                                         numSyncPointsInWaitList,
+                                         pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_copy_exp_params_t params = {
         &hCommandBuffer,
         &hSrcMem,
@@ -7350,7 +8357,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         &pSyncPoint};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
-        "urCommandBufferAppendMemBufferCopyExp", &params);
+        "urCommandBufferAppendMemBufferCopyExp", &params, hCommandBuffer,
+        hSrcMem, hDstMem, srcOffset, dstOffset, size, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendMemBufferCopyExp\n");
@@ -7401,6 +8410,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP)) {
+        return pfnAppendMemBufferWriteExp(hCommandBuffer, hBuffer, offset, size,
+                                          pSrc, numSyncPointsInWaitList,
+                                          pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_write_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7412,7 +8428,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         &pSyncPoint};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
-        "urCommandBufferAppendMemBufferWriteExp", &params);
+        "urCommandBufferAppendMemBufferWriteExp", &params, hCommandBuffer,
+        hBuffer, offset, size, pSrc, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendMemBufferWriteExp\n");
@@ -7462,6 +8480,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP)) {
+        return pfnAppendMemBufferReadExp(hCommandBuffer, hBuffer, offset, size,
+                                         pDst, numSyncPointsInWaitList,
+                                         pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_read_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7473,7 +8498,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         &pSyncPoint};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
-        "urCommandBufferAppendMemBufferReadExp", &params);
+        "urCommandBufferAppendMemBufferReadExp", &params, hCommandBuffer,
+        hBuffer, offset, size, pDst, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendMemBufferReadExp\n");
@@ -7531,6 +8558,16 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP)) {
+        return pfnAppendMemBufferCopyRectExp(hCommandBuffer, hSrcMem, hDstMem,
+                                             srcOrigin, dstOrigin, region,
+                                             srcRowPitch, srcSlicePitch,
+                                             dstRowPitch, dstSlicePitch,
+                                             numSyncPointsInWaitList,
+                                             pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_copy_rect_exp_params_t params = {
         &hCommandBuffer,
         &hSrcMem,
@@ -7547,7 +8584,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         &pSyncPoint};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
-        "urCommandBufferAppendMemBufferCopyRectExp", &params);
+        "urCommandBufferAppendMemBufferCopyRectExp", &params, hCommandBuffer,
+        hSrcMem, hDstMem, srcOrigin, dstOrigin, region, srcRowPitch,
+        srcSlicePitch, dstRowPitch, dstSlicePitch, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendMemBufferCopyRectExp\n");
@@ -7615,6 +8655,16 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP)) {
+        return pfnAppendMemBufferWriteRectExp(hCommandBuffer, hBuffer,
+                                              bufferOffset, hostOffset, region,
+                                              bufferRowPitch, bufferSlicePitch,
+                                              hostRowPitch, hostSlicePitch,
+                                              pSrc, numSyncPointsInWaitList,
+                                              pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_write_rect_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7631,7 +8681,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         &pSyncPoint};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
-        "urCommandBufferAppendMemBufferWriteRectExp", &params);
+        "urCommandBufferAppendMemBufferWriteRectExp", &params, hCommandBuffer,
+        hBuffer, bufferOffset, hostOffset, region, bufferRowPitch,
+        bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendMemBufferWriteRectExp\n");
@@ -7696,6 +8749,16 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP)) {
+        return pfnAppendMemBufferReadRectExp(hCommandBuffer, hBuffer,
+                                             bufferOffset, hostOffset, region,
+                                             bufferRowPitch, bufferSlicePitch,
+                                             hostRowPitch, hostSlicePitch, pDst,
+                                             numSyncPointsInWaitList,
+                                             pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_read_rect_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7712,7 +8775,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         &pSyncPoint};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
-        "urCommandBufferAppendMemBufferReadRectExp", &params);
+        "urCommandBufferAppendMemBufferReadRectExp", &params, hCommandBuffer,
+        hBuffer, bufferOffset, hostOffset, region, bufferRowPitch,
+        bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendMemBufferReadRectExp\n");
@@ -7767,6 +8833,14 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP)) {
+        return pfnAppendMemBufferFillExp(hCommandBuffer, hBuffer, pPattern,
+                                         patternSize, offset, size,
+                                         numSyncPointsInWaitList,
+                                         pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_mem_buffer_fill_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7779,7 +8853,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         &pSyncPoint};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
-        "urCommandBufferAppendMemBufferFillExp", &params);
+        "urCommandBufferAppendMemBufferFillExp", &params, hCommandBuffer,
+        hBuffer, pPattern, patternSize, offset, size, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendMemBufferFillExp\n");
@@ -7828,6 +8904,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP)) {
+        return pfnAppendUSMPrefetchExp(hCommandBuffer, pMemory, size, flags,
+                                       numSyncPointsInWaitList,
+                                       pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_usm_prefetch_exp_params_t params = {
         &hCommandBuffer,
         &pMemory,
@@ -7838,7 +8921,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         &pSyncPoint};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP,
-        "urCommandBufferAppendUSMPrefetchExp", &params);
+        "urCommandBufferAppendUSMPrefetchExp", &params, hCommandBuffer, pMemory,
+        size, flags, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendUSMPrefetchExp\n");
@@ -7886,6 +8970,13 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP)) {
+        return pfnAppendUSMAdviseExp(hCommandBuffer, pMemory, size, advice,
+                                     numSyncPointsInWaitList,
+                                     pSyncPointWaitList, pSyncPoint);
+    }
+
     ur_command_buffer_append_usm_advise_exp_params_t params = {
         &hCommandBuffer,
         &pMemory,
@@ -7896,7 +8987,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         &pSyncPoint};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP,
-        "urCommandBufferAppendUSMAdviseExp", &params);
+        "urCommandBufferAppendUSMAdviseExp", &params, hCommandBuffer, pMemory,
+        size, advice, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferAppendUSMAdviseExp\n");
@@ -7944,12 +9036,18 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP)) {
+        return pfnEnqueueExp(hCommandBuffer, hQueue, numEventsInWaitList,
+                             phEventWaitList, phEvent);
+    }
+
     ur_command_buffer_enqueue_exp_params_t params = {
         &hCommandBuffer, &hQueue, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP,
-                                   "urCommandBufferEnqueueExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP, "urCommandBufferEnqueueExp",
+        &params, hCommandBuffer, hQueue, numEventsInWaitList, phEventWaitList,
+        phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferEnqueueExp\n");
@@ -7985,10 +9083,15 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP)) {
+        return pfnRetainCommandExp(hCommand);
+    }
+
     ur_command_buffer_retain_command_exp_params_t params = {&hCommand};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP,
-        "urCommandBufferRetainCommandExp", &params);
+        "urCommandBufferRetainCommandExp", &params, hCommand);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferRetainCommandExp\n");
@@ -8023,10 +9126,15 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP)) {
+        return pfnReleaseCommandExp(hCommand);
+    }
+
     ur_command_buffer_release_command_exp_params_t params = {&hCommand};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP,
-        "urCommandBufferReleaseCommandExp", &params);
+        "urCommandBufferReleaseCommandExp", &params, hCommand);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferReleaseCommandExp\n");
@@ -8063,11 +9171,17 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP)) {
+        return pfnUpdateKernelLaunchExp(hCommand, pUpdateKernelLaunch);
+    }
+
     ur_command_buffer_update_kernel_launch_exp_params_t params = {
         &hCommand, &pUpdateKernelLaunch};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
-        "urCommandBufferUpdateKernelLaunchExp", &params);
+        "urCommandBufferUpdateKernelLaunchExp", &params, hCommand,
+        pUpdateKernelLaunch);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferUpdateKernelLaunchExp\n");
@@ -8113,11 +9227,16 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP)) {
+        return pfnGetInfoExp(hCommandBuffer, propName, propSize, pPropValue,
+                             pPropSizeRet);
+    }
+
     ur_command_buffer_get_info_exp_params_t params = {
         &hCommandBuffer, &propName, &propSize, &pPropValue, &pPropSizeRet};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP,
-                                   "urCommandBufferGetInfoExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP, "urCommandBufferGetInfoExp",
+        &params, hCommandBuffer, propName, propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferGetInfoExp\n");
@@ -8162,11 +9281,18 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP)) {
+        return pfnCommandGetInfoExp(hCommand, propName, propSize, pPropValue,
+                                    pPropSizeRet);
+    }
+
     ur_command_buffer_command_get_info_exp_params_t params = {
         &hCommand, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP,
-        "urCommandBufferCommandGetInfoExp", &params);
+        "urCommandBufferCommandGetInfoExp", &params, hCommand, propName,
+        propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urCommandBufferCommandGetInfoExp\n");
@@ -8227,6 +9353,15 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP)) {
+        return pfnCooperativeKernelLaunchExp(hQueue, hKernel, workDim,
+                                             pGlobalWorkOffset, pGlobalWorkSize,
+                                             pLocalWorkSize,
+                                             numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+    }
+
     ur_enqueue_cooperative_kernel_launch_exp_params_t params = {
         &hQueue,
         &hKernel,
@@ -8239,7 +9374,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         &phEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
-        "urEnqueueCooperativeKernelLaunchExp", &params);
+        "urEnqueueCooperativeKernelLaunchExp", &params, hQueue, hKernel,
+        workDim, pGlobalWorkOffset, pGlobalWorkSize, pLocalWorkSize,
+        numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueCooperativeKernelLaunchExp\n");
@@ -8284,11 +9421,19 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP)) {
+        return pfnSuggestMaxCooperativeGroupCountExp(hKernel, localWorkSize,
+                                                     dynamicSharedMemorySize,
+                                                     pGroupCountRet);
+    }
+
     ur_kernel_suggest_max_cooperative_group_count_exp_params_t params = {
         &hKernel, &localWorkSize, &dynamicSharedMemorySize, &pGroupCountRet};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
-        "urKernelSuggestMaxCooperativeGroupCountExp", &params);
+        "urKernelSuggestMaxCooperativeGroupCountExp", &params, hKernel,
+        localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urKernelSuggestMaxCooperativeGroupCountExp\n");
@@ -8345,11 +9490,17 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP)) {
+        return pfnTimestampRecordingExp(hQueue, blocking, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
     ur_enqueue_timestamp_recording_exp_params_t params = {
         &hQueue, &blocking, &numEventsInWaitList, &phEventWaitList, &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP,
-                                   "urEnqueueTimestampRecordingExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP,
+        "urEnqueueTimestampRecordingExp", &params, hQueue, blocking,
+        numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueTimestampRecordingExp\n");
@@ -8409,15 +9560,26 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP)) {
+        return pfnKernelLaunchCustomExp(hQueue, hKernel, workDim,
+                                        pGlobalWorkSize, pLocalWorkSize,
+                                        numPropsInLaunchPropList,
+                                        launchPropList, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
     ur_enqueue_kernel_launch_custom_exp_params_t params = {
         &hQueue,          &hKernel,
         &workDim,         &pGlobalWorkSize,
         &pLocalWorkSize,  &numPropsInLaunchPropList,
         &launchPropList,  &numEventsInWaitList,
         &phEventWaitList, &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP,
-                                   "urEnqueueKernelLaunchCustomExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP,
+        "urEnqueueKernelLaunchCustomExp", &params, hQueue, hKernel, workDim,
+        pGlobalWorkSize, pLocalWorkSize, numPropsInLaunchPropList,
+        launchPropList, numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueKernelLaunchCustomExp\n");
@@ -8458,10 +9620,15 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_BUILD_EXP)) {
+        return pfnBuildExp(hProgram, numDevices, phDevices, pOptions);
+    }
+
     ur_program_build_exp_params_t params = {&hProgram, &numDevices, &phDevices,
                                             &pOptions};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_PROGRAM_BUILD_EXP, "urProgramBuildExp", &params);
+        UR_FUNCTION_PROGRAM_BUILD_EXP, "urProgramBuildExp", &params, hProgram,
+        numDevices, phDevices, pOptions);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramBuildExp\n");
@@ -8499,10 +9666,15 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_COMPILE_EXP)) {
+        return pfnCompileExp(hProgram, numDevices, phDevices, pOptions);
+    }
+
     ur_program_compile_exp_params_t params = {&hProgram, &numDevices,
                                               &phDevices, &pOptions};
     uint64_t instance = getContext()->notify_begin(
-        UR_FUNCTION_PROGRAM_COMPILE_EXP, "urProgramCompileExp", &params);
+        UR_FUNCTION_PROGRAM_COMPILE_EXP, "urProgramCompileExp", &params,
+        hProgram, numDevices, phDevices, pOptions);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramCompileExp\n");
@@ -8548,11 +9720,19 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_LINK_EXP)) {
+        return pfnLinkExp(hContext, numDevices, phDevices, count, phPrograms,
+                          pOptions, phProgram);
+    }
+
     ur_program_link_exp_params_t params = {&hContext, &numDevices, &phDevices,
                                            &count,    &phPrograms, &pOptions,
                                            &phProgram};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_LINK_EXP,
-                                                   "urProgramLinkExp", &params);
+                                                   "urProgramLinkExp", &params,
+                                                   hContext, numDevices,
+                                                   phDevices, count, phPrograms,
+                                                   pOptions, phProgram);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urProgramLinkExp\n");
@@ -8587,9 +9767,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_IMPORT_EXP)) {
+        return pfnImportExp(hContext, pMem, size);
+    }
+
     ur_usm_import_exp_params_t params = {&hContext, &pMem, &size};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_IMPORT_EXP,
-                                                   "urUSMImportExp", &params);
+                                                   "urUSMImportExp", &params,
+                                                   hContext, pMem, size);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMImportExp\n");
@@ -8622,9 +9807,14 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_RELEASE_EXP)) {
+        return pfnReleaseExp(hContext, pMem);
+    }
+
     ur_usm_release_exp_params_t params = {&hContext, &pMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_RELEASE_EXP,
-                                                   "urUSMReleaseExp", &params);
+                                                   "urUSMReleaseExp", &params,
+                                                   hContext, pMem);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUSMReleaseExp\n");
@@ -8659,11 +9849,15 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP)) {
+        return pfnEnablePeerAccessExp(commandDevice, peerDevice);
+    }
+
     ur_usm_p2p_enable_peer_access_exp_params_t params = {&commandDevice,
                                                          &peerDevice};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
-                                   "urUsmP2PEnablePeerAccessExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
+        "urUsmP2PEnablePeerAccessExp", &params, commandDevice, peerDevice);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUsmP2PEnablePeerAccessExp\n");
@@ -8699,11 +9893,15 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP)) {
+        return pfnDisablePeerAccessExp(commandDevice, peerDevice);
+    }
+
     ur_usm_p2p_disable_peer_access_exp_params_t params = {&commandDevice,
                                                           &peerDevice};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
-                                   "urUsmP2PDisablePeerAccessExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
+        "urUsmP2PDisablePeerAccessExp", &params, commandDevice, peerDevice);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUsmP2PDisablePeerAccessExp\n");
@@ -8750,12 +9948,19 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP)) {
+        return pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName,
+                                       propSize, pPropValue, pPropSizeRet);
+    }
+
     ur_usm_p2p_peer_access_get_info_exp_params_t params = {
         &commandDevice, &peerDevice, &propName,
         &propSize,      &pPropValue, &pPropSizeRet};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
-                                   "urUsmP2PPeerAccessGetInfoExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
+        "urUsmP2PPeerAccessGetInfoExp", &params, commandDevice, peerDevice,
+        propName, propSize, pPropValue, pPropSizeRet);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urUsmP2PPeerAccessGetInfoExp\n");
@@ -8779,6 +9984,49 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMPoolTrimExp
+__urdlllocal ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM pool to trim, NULL trims every pool of hContext
+    size_t minBytesToKeep ///< [in] number of cached bytes each pool may keep
+) {
+    auto pfnPoolTrimExp = getContext()->urDdiTable.USMExp.pfnPoolTrimExp;
+
+    if (nullptr == pfnPoolTrimExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_TRIM_EXP)) {
+        return pfnPoolTrimExp(hContext, hPool, minBytesToKeep);
+    }
+
+    ur_usm_pool_trim_exp_params_t params = {&hContext, &hPool,
+                                            &minBytesToKeep};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_POOL_TRIM_EXP, "urUSMPoolTrimExp", &params, hContext,
+        hPool, minBytesToKeep);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMPoolTrimExp\n");
+
+    ur_result_t result = pfnPoolTrimExp(hContext, hPool, minBytesToKeep);
+
+    getContext()->notify_end(UR_FUNCTION_USM_POOL_TRIM_EXP, "urUSMPoolTrimExp",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_TRIM_EXP,
+                                        &params);
+        logger.info("   <--- urUSMPoolTrimExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urEnqueueNativeCommandExp
 __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
@@ -8811,6 +10059,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP)) {
+        return pfnNativeCommandExp(hQueue, pfnNativeEnqueue, data,
+                                   numMemsInMemList, phMemList, pProperties,
+                                   numEventsInWaitList, phEventWaitList,
+                                   phEvent);
+    }
+
     ur_enqueue_native_command_exp_params_t params = {&hQueue,
                                                      &pfnNativeEnqueue,
                                                      &data,
@@ -8820,9 +10075,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
                                                      &numEventsInWaitList,
                                                      &phEventWaitList,
                                                      &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP,
-                                   "urEnqueueNativeCommandExp", &params);
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP, "urEnqueueNativeCommandExp",
+        &params, hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemList,
+        pProperties, numEventsInWaitList, phEventWaitList, phEvent);
 
     auto &logger = getContext()->logger;
     logger.info("   ---> urEnqueueNativeCommandExp\n");
@@ -8847,32 +10103,851 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Exported function for filling application's Global table
-///        with current process' addresses
-///
-/// @returns
-///     - ::UR_RESULT_SUCCESS
-///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
-__urdlllocal ur_result_t UR_APICALL urGetGlobalProcAddrTable(
-    ur_api_version_t version, ///< [in] API version requested
-    ur_global_dditable_t
-        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+/// @brief Intercept function for urEnqueueUSMDeviceAllocExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the allocation.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    void **ppMem, ///< [out] pointer to USM device memory object
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Global;
+    auto pfnUSMDeviceAllocExp =
+        getContext()->urDdiTable.EnqueueExp.pfnUSMDeviceAllocExp;
 
-    if (nullptr == pDdiTable) {
-        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    if (nullptr == pfnUSMDeviceAllocExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
-        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP)) {
+        return pfnUSMDeviceAllocExp(hQueue, size, numEventsInWaitList,
+                                    phEventWaitList, ppMem, phEvent);
     }
 
-    ur_result_t result = UR_RESULT_SUCCESS;
+    ur_enqueue_usm_device_alloc_exp_params_t params = {&hQueue,
+                                                       &size,
+                                                       &numEventsInWaitList,
+                                                       &phEventWaitList,
+                                                       &ppMem,
+                                                       &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP, "urEnqueueUSMDeviceAllocExp",
+        &params, hQueue, size, numEventsInWaitList, phEventWaitList, ppMem,
+        phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueUSMDeviceAllocExp\n");
+
+    ur_result_t result = pfnUSMDeviceAllocExp(
+        hQueue, size, numEventsInWaitList, phEventWaitList, ppMem, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP,
+                             "urEnqueueUSMDeviceAllocExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP, &params);
+        logger.info("   <--- urEnqueueUSMDeviceAllocExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMFreeExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    void *
+        pMem, ///< [in] pointer to USM memory object allocated with
+              ///< ::urEnqueueUSMDeviceAllocExp
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the free.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
+) {
+    auto pfnUSMFreeExp = getContext()->urDdiTable.EnqueueExp.pfnUSMFreeExp;
+
+    if (nullptr == pfnUSMFreeExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_FREE_EXP)) {
+        return pfnUSMFreeExp(hQueue, pMem, numEventsInWaitList,
+                             phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_usm_free_exp_params_t params = {
+        &hQueue, &pMem, &numEventsInWaitList, &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_FREE_EXP, "urEnqueueUSMFreeExp", &params,
+        hQueue, pMem, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueUSMFreeExp\n");
+
+    ur_result_t result = pfnUSMFreeExp(hQueue, pMem, numEventsInWaitList,
+                                       phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_FREE_EXP,
+                             "urEnqueueUSMFreeExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_USM_FREE_EXP, &params);
+        logger.info("   <--- urEnqueueUSMFreeExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferCopyRectBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_mem_handle_t hBufferSrc, ///< [in] handle of the source buffer object
+    ur_mem_handle_t hBufferDst, ///< [in] handle of the dest buffer object
+    uint32_t numRegions, ///< [in] number of rectangular regions to copy
+    const ur_rect_offset_t *
+        pSrcOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the source
+                     ///< buffer
+    const ur_rect_offset_t *
+        pDstOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the
+                     ///< destination buffer
+    const ur_rect_region_t *
+        pRegions, ///< [in][range(0, numRegions)] 3D rectangular region descriptors: width,
+                  ///< height, depth
+    size_t
+        srcRowPitch, ///< [in] length of each row in bytes in the source buffer object
+    size_t
+        srcSlicePitch, ///< [in] length of each 2D slice in bytes in the source buffer object
+    size_t
+        dstRowPitch, ///< [in] length of each row in bytes in the destination buffer object
+    size_t
+        dstSlicePitch, ///< [in] length of each 2D slice in bytes in the destination buffer object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferCopyRectBatchExp =
+        getContext()->urDdiTable.EnqueueExp.pfnMemBufferCopyRectBatchExp;
+
+    if (nullptr == pfnMemBufferCopyRectBatchExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP)) {
+        return pfnMemBufferCopyRectBatchExp(
+            hQueue, hBufferSrc, hBufferDst, numRegions, pSrcOrigins,
+            pDstOrigins, pRegions, srcRowPitch, srcSlicePitch, dstRowPitch,
+            dstSlicePitch, numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_buffer_copy_rect_batch_exp_params_t params = {
+        &hQueue,          &hBufferSrc,    &hBufferDst,
+        &numRegions,      &pSrcOrigins,   &pDstOrigins,
+        &pRegions,        &srcRowPitch,   &srcSlicePitch,
+        &dstRowPitch,     &dstSlicePitch, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP,
+        "urEnqueueMemBufferCopyRectBatchExp", &params, hQueue, hBufferSrc,
+        hBufferDst, numRegions, pSrcOrigins, pDstOrigins, pRegions,
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemBufferCopyRectBatchExp\n");
+
+    ur_result_t result = pfnMemBufferCopyRectBatchExp(
+        hQueue, hBufferSrc, hBufferDst, numRegions, pSrcOrigins, pDstOrigins,
+        pRegions, srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP,
+                             "urEnqueueMemBufferCopyRectBatchExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP,
+            &params);
+        logger.info("   <--- urEnqueueMemBufferCopyRectBatchExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueKernelLaunchBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t numLaunches,     ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_desc_t *
+        pLaunches, ///< [in][range(0, numLaunches)] pointer to a list of kernel launch
+                   ///< descriptors
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernels execute.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the completion
+                ///< of all the launches.
+) {
+    auto pfnKernelLaunchBatchExp =
+        getContext()->urDdiTable.EnqueueExp.pfnKernelLaunchBatchExp;
+
+    if (nullptr == pfnKernelLaunchBatchExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP)) {
+        return pfnKernelLaunchBatchExp(hQueue, numLaunches, pLaunches,
+                                       numEventsInWaitList, phEventWaitList,
+                                       phEvent);
+    }
+
+    ur_enqueue_kernel_launch_batch_exp_params_t params = {
+        &hQueue, &numLaunches, &pLaunches, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP,
+        "urEnqueueKernelLaunchBatchExp", &params, hQueue, numLaunches,
+        pLaunches, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueKernelLaunchBatchExp\n");
+
+    ur_result_t result = pfnKernelLaunchBatchExp(
+        hQueue, numLaunches, pLaunches, numEventsInWaitList, phEventWaitList,
+        phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP,
+                             "urEnqueueKernelLaunchBatchExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP, &params);
+        logger.info("   <--- urEnqueueKernelLaunchBatchExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelSetArgsExp
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments
+    const ur_exp_kernel_arg_properties_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to a list of kernel arguments
+) {
+    auto pfnSetArgsExp = getContext()->urDdiTable.KernelExp.pfnSetArgsExp;
+
+    if (nullptr == pfnSetArgsExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARGS_EXP)) {
+        return pfnSetArgsExp(hKernel, numArgs, pArgs);
+    }
+
+    ur_kernel_set_args_exp_params_t params = {&hKernel, &numArgs, &pArgs};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_SET_ARGS_EXP, "urKernelSetArgsExp", &params, hKernel,
+        numArgs, pArgs);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelSetArgsExp\n");
+
+    ur_result_t result = pfnSetArgsExp(hKernel, numArgs, pArgs);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_SET_ARGS_EXP,
+                             "urKernelSetArgsExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_SET_ARGS_EXP, &params);
+        logger.info("   <--- urKernelSetArgsExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventWaitAnyExp
+__urdlllocal ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+    uint32_t *
+        pEventIndex ///< [out] index in phEventWaitList of an event which is complete
+) {
+    auto pfnWaitAnyExp = getContext()->urDdiTable.EventExp.pfnWaitAnyExp;
+
+    if (nullptr == pfnWaitAnyExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_WAIT_ANY_EXP)) {
+        return pfnWaitAnyExp(numEvents, phEventWaitList, pEventIndex);
+    }
+
+    ur_event_wait_any_exp_params_t params = {&numEvents, &phEventWaitList,
+                                             &pEventIndex};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_EVENT_WAIT_ANY_EXP, "urEventWaitAnyExp", &params, numEvents,
+        phEventWaitList, pEventIndex);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventWaitAnyExp\n");
+
+    ur_result_t result = pfnWaitAnyExp(numEvents, phEventWaitList, pEventIndex);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_WAIT_ANY_EXP,
+                             "urEventWaitAnyExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_EVENT_WAIT_ANY_EXP, &params);
+        logger.info("   <--- urEventWaitAnyExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventGetExecutionStatusExp
+__urdlllocal ur_result_t UR_APICALL urEventGetExecutionStatusExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEvents, ///< [in][range(0, numEvents)] pointer to a list of events to query
+    ur_event_status_t *
+        pStatuses ///< [out][range(0, numEvents)] execution status of each of the events of
+                  ///< phEvents
+) {
+    auto pfnGetExecutionStatusExp = getContext()->urDdiTable.EventExp.pfnGetExecutionStatusExp;
+
+    if (nullptr == pfnGetExecutionStatusExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP)) {
+        return pfnGetExecutionStatusExp(numEvents, phEvents, pStatuses);
+    }
+
+    ur_event_get_execution_status_exp_params_t params = {&numEvents, &phEvents,
+                                                         &pStatuses};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP,
+        "urEventGetExecutionStatusExp", &params, numEvents, phEvents,
+        pStatuses);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventGetExecutionStatusExp\n");
+
+    ur_result_t result = pfnGetExecutionStatusExp(numEvents, phEvents, pStatuses);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP,
+                             "urEventGetExecutionStatusExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP, &params);
+        logger.info("   <--- urEventGetExecutionStatusExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueReserveTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReserveTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t
+        capacity ///< [in] number of slots of the ring, the number of markers which can be
+    ///< enqueued before the first one is overwritten
+) {
+    auto pfnReserveTimestampMarkersExp =
+        getContext()->urDdiTable.QueueExp.pfnReserveTimestampMarkersExp;
+
+    if (nullptr == pfnReserveTimestampMarkersExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(
+            UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP)) {
+        return pfnReserveTimestampMarkersExp(hQueue, capacity);
+    }
+
+    ur_queue_reserve_timestamp_markers_exp_params_t params = {&hQueue,
+                                                              &capacity};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP,
+        "urQueueReserveTimestampMarkersExp", &params, hQueue, capacity);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueReserveTimestampMarkersExp\n");
+
+    ur_result_t result = pfnReserveTimestampMarkersExp(hQueue, capacity);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP,
+                             "urQueueReserveTimestampMarkersExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP,
+            &params);
+        logger.info("   <--- urQueueReserveTimestampMarkersExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueTimestampMarkerExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the timestamp is written.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    uint64_t *pMarker ///< [out][optional] number of the marker
+) {
+    auto pfnTimestampMarkerExp =
+        getContext()->urDdiTable.EnqueueExp.pfnTimestampMarkerExp;
+
+    if (nullptr == pfnTimestampMarkerExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP)) {
+        return pfnTimestampMarkerExp(hQueue, numEventsInWaitList,
+                                     phEventWaitList, pMarker);
+    }
+
+    ur_enqueue_timestamp_marker_exp_params_t params = {
+        &hQueue, &numEventsInWaitList, &phEventWaitList, &pMarker};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP, "urEnqueueTimestampMarkerExp",
+        &params, hQueue, numEventsInWaitList, phEventWaitList, pMarker);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueTimestampMarkerExp\n");
+
+    ur_result_t result = pfnTimestampMarkerExp(hQueue, numEventsInWaitList,
+                                               phEventWaitList, pMarker);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP,
+                             "urEnqueueTimestampMarkerExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP, &params);
+        logger.info("   <--- urEnqueueTimestampMarkerExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueReadTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReadTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint64_t firstMarker,     ///< [in] number of the first marker to read
+    uint32_t count,           ///< [in] number of markers to read
+    uint64_t *
+        pTimestamps ///< [out][range(0, count)] timestamps in nanoseconds of the markers
+) {
+    auto pfnReadTimestampMarkersExp =
+        getContext()->urDdiTable.QueueExp.pfnReadTimestampMarkersExp;
+
+    if (nullptr == pfnReadTimestampMarkersExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP)) {
+        return pfnReadTimestampMarkersExp(hQueue, firstMarker, count,
+                                          pTimestamps);
+    }
+
+    ur_queue_read_timestamp_markers_exp_params_t params = {
+        &hQueue, &firstMarker, &count, &pTimestamps};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP,
+        "urQueueReadTimestampMarkersExp", &params, hQueue, firstMarker, count,
+        pTimestamps);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueReadTimestampMarkersExp\n");
+
+    ur_result_t result =
+        pfnReadTimestampMarkersExp(hQueue, firstMarker, count, pTimestamps);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP,
+                             "urQueueReadTimestampMarkersExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP, &params);
+        logger.info("   <--- urQueueReadTimestampMarkersExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Ids and names of all functions intercepted by the tracing layer
+std::vector<std::pair<uint32_t, const char *>> getTracedFunctions() {
+    return {
+        {UR_FUNCTION_ADAPTER_GET, "urAdapterGet"},
+        {UR_FUNCTION_ADAPTER_RELEASE, "urAdapterRelease"},
+        {UR_FUNCTION_ADAPTER_RETAIN, "urAdapterRetain"},
+        {UR_FUNCTION_ADAPTER_GET_LAST_ERROR, "urAdapterGetLastError"},
+        {UR_FUNCTION_ADAPTER_GET_INFO, "urAdapterGetInfo"},
+        {UR_FUNCTION_PLATFORM_GET, "urPlatformGet"},
+        {UR_FUNCTION_PLATFORM_GET_INFO, "urPlatformGetInfo"},
+        {UR_FUNCTION_PLATFORM_GET_API_VERSION, "urPlatformGetApiVersion"},
+        {UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE, "urPlatformGetNativeHandle"},
+        {UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE,
+         "urPlatformCreateWithNativeHandle"},
+        {UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION, "urPlatformGetBackendOption"},
+        {UR_FUNCTION_DEVICE_GET, "urDeviceGet"},
+        {UR_FUNCTION_DEVICE_GET_INFO, "urDeviceGetInfo"},
+        {UR_FUNCTION_DEVICE_RETAIN, "urDeviceRetain"},
+        {UR_FUNCTION_DEVICE_RELEASE, "urDeviceRelease"},
+        {UR_FUNCTION_DEVICE_PARTITION, "urDevicePartition"},
+        {UR_FUNCTION_DEVICE_SELECT_BINARY, "urDeviceSelectBinary"},
+        {UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE, "urDeviceGetNativeHandle"},
+        {UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE,
+         "urDeviceCreateWithNativeHandle"},
+        {UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS,
+         "urDeviceGetGlobalTimestamps"},
+        {UR_FUNCTION_CONTEXT_CREATE, "urContextCreate"},
+        {UR_FUNCTION_CONTEXT_RETAIN, "urContextRetain"},
+        {UR_FUNCTION_CONTEXT_RELEASE, "urContextRelease"},
+        {UR_FUNCTION_CONTEXT_GET_INFO, "urContextGetInfo"},
+        {UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE, "urContextGetNativeHandle"},
+        {UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE,
+         "urContextCreateWithNativeHandle"},
+        {UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER,
+         "urContextSetExtendedDeleter"},
+        {UR_FUNCTION_MEM_IMAGE_CREATE, "urMemImageCreate"},
+        {UR_FUNCTION_MEM_BUFFER_CREATE, "urMemBufferCreate"},
+        {UR_FUNCTION_MEM_RETAIN, "urMemRetain"},
+        {UR_FUNCTION_MEM_RELEASE, "urMemRelease"},
+        {UR_FUNCTION_MEM_BUFFER_PARTITION, "urMemBufferPartition"},
+        {UR_FUNCTION_MEM_GET_NATIVE_HANDLE, "urMemGetNativeHandle"},
+        {UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE,
+         "urMemBufferCreateWithNativeHandle"},
+        {UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE,
+         "urMemImageCreateWithNativeHandle"},
+        {UR_FUNCTION_MEM_GET_INFO, "urMemGetInfo"},
+        {UR_FUNCTION_MEM_IMAGE_GET_INFO, "urMemImageGetInfo"},
+        {UR_FUNCTION_SAMPLER_CREATE, "urSamplerCreate"},
+        {UR_FUNCTION_SAMPLER_RETAIN, "urSamplerRetain"},
+        {UR_FUNCTION_SAMPLER_RELEASE, "urSamplerRelease"},
+        {UR_FUNCTION_SAMPLER_GET_INFO, "urSamplerGetInfo"},
+        {UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE, "urSamplerGetNativeHandle"},
+        {UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE,
+         "urSamplerCreateWithNativeHandle"},
+        {UR_FUNCTION_USM_HOST_ALLOC, "urUSMHostAlloc"},
+        {UR_FUNCTION_USM_DEVICE_ALLOC, "urUSMDeviceAlloc"},
+        {UR_FUNCTION_USM_SHARED_ALLOC, "urUSMSharedAlloc"},
+        {UR_FUNCTION_USM_FREE, "urUSMFree"},
+        {UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, "urUSMGetMemAllocInfo"},
+        {UR_FUNCTION_USM_POOL_CREATE, "urUSMPoolCreate"},
+        {UR_FUNCTION_USM_POOL_RETAIN, "urUSMPoolRetain"},
+        {UR_FUNCTION_USM_POOL_RELEASE, "urUSMPoolRelease"},
+        {UR_FUNCTION_USM_POOL_GET_INFO, "urUSMPoolGetInfo"},
+        {UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO,
+         "urVirtualMemGranularityGetInfo"},
+        {UR_FUNCTION_VIRTUAL_MEM_RESERVE, "urVirtualMemReserve"},
+        {UR_FUNCTION_VIRTUAL_MEM_FREE, "urVirtualMemFree"},
+        {UR_FUNCTION_VIRTUAL_MEM_MAP, "urVirtualMemMap"},
+        {UR_FUNCTION_VIRTUAL_MEM_UNMAP, "urVirtualMemUnmap"},
+        {UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, "urVirtualMemSetAccess"},
+        {UR_FUNCTION_VIRTUAL_MEM_GET_INFO, "urVirtualMemGetInfo"},
+        {UR_FUNCTION_PHYSICAL_MEM_CREATE, "urPhysicalMemCreate"},
+        {UR_FUNCTION_PHYSICAL_MEM_RETAIN, "urPhysicalMemRetain"},
+        {UR_FUNCTION_PHYSICAL_MEM_RELEASE, "urPhysicalMemRelease"},
+        {UR_FUNCTION_PROGRAM_CREATE_WITH_IL, "urProgramCreateWithIL"},
+        {UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY, "urProgramCreateWithBinary"},
+        {UR_FUNCTION_PROGRAM_BUILD, "urProgramBuild"},
+        {UR_FUNCTION_PROGRAM_COMPILE, "urProgramCompile"},
+        {UR_FUNCTION_PROGRAM_LINK, "urProgramLink"},
+        {UR_FUNCTION_PROGRAM_RETAIN, "urProgramRetain"},
+        {UR_FUNCTION_PROGRAM_RELEASE, "urProgramRelease"},
+        {UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER,
+         "urProgramGetFunctionPointer"},
+        {UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER,
+         "urProgramGetGlobalVariablePointer"},
+        {UR_FUNCTION_PROGRAM_GET_INFO, "urProgramGetInfo"},
+        {UR_FUNCTION_PROGRAM_GET_BUILD_INFO, "urProgramGetBuildInfo"},
+        {UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
+         "urProgramSetSpecializationConstants"},
+        {UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE, "urProgramGetNativeHandle"},
+        {UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE,
+         "urProgramCreateWithNativeHandle"},
+        {UR_FUNCTION_KERNEL_CREATE, "urKernelCreate"},
+        {UR_FUNCTION_KERNEL_SET_ARG_VALUE, "urKernelSetArgValue"},
+        {UR_FUNCTION_KERNEL_SET_ARG_LOCAL, "urKernelSetArgLocal"},
+        {UR_FUNCTION_KERNEL_GET_INFO, "urKernelGetInfo"},
+        {UR_FUNCTION_KERNEL_GET_GROUP_INFO, "urKernelGetGroupInfo"},
+        {UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO, "urKernelGetSubGroupInfo"},
+        {UR_FUNCTION_KERNEL_RETAIN, "urKernelRetain"},
+        {UR_FUNCTION_KERNEL_RELEASE, "urKernelRelease"},
+        {UR_FUNCTION_KERNEL_SET_ARG_POINTER, "urKernelSetArgPointer"},
+        {UR_FUNCTION_KERNEL_SET_EXEC_INFO, "urKernelSetExecInfo"},
+        {UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, "urKernelSetArgSampler"},
+        {UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, "urKernelSetArgMemObj"},
+        {UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS,
+         "urKernelSetSpecializationConstants"},
+        {UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE, "urKernelGetNativeHandle"},
+        {UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE,
+         "urKernelCreateWithNativeHandle"},
+        {UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE,
+         "urKernelGetSuggestedLocalWorkSize"},
+        {UR_FUNCTION_QUEUE_GET_INFO, "urQueueGetInfo"},
+        {UR_FUNCTION_QUEUE_CREATE, "urQueueCreate"},
+        {UR_FUNCTION_QUEUE_RETAIN, "urQueueRetain"},
+        {UR_FUNCTION_QUEUE_RELEASE, "urQueueRelease"},
+        {UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, "urQueueGetNativeHandle"},
+        {UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE,
+         "urQueueCreateWithNativeHandle"},
+        {UR_FUNCTION_QUEUE_FINISH, "urQueueFinish"},
+        {UR_FUNCTION_QUEUE_FLUSH, "urQueueFlush"},
+        {UR_FUNCTION_EVENT_GET_INFO, "urEventGetInfo"},
+        {UR_FUNCTION_EVENT_GET_PROFILING_INFO, "urEventGetProfilingInfo"},
+        {UR_FUNCTION_EVENT_WAIT, "urEventWait"},
+        {UR_FUNCTION_EVENT_RETAIN, "urEventRetain"},
+        {UR_FUNCTION_EVENT_RELEASE, "urEventRelease"},
+        {UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, "urEventGetNativeHandle"},
+        {UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE,
+         "urEventCreateWithNativeHandle"},
+        {UR_FUNCTION_EVENT_SET_CALLBACK, "urEventSetCallback"},
+        {UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, "urEnqueueKernelLaunch"},
+        {UR_FUNCTION_ENQUEUE_EVENTS_WAIT, "urEnqueueEventsWait"},
+        {UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER,
+         "urEnqueueEventsWaitWithBarrier"},
+        {UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, "urEnqueueMemBufferRead"},
+        {UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE, "urEnqueueMemBufferWrite"},
+        {UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT,
+         "urEnqueueMemBufferReadRect"},
+        {UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT,
+         "urEnqueueMemBufferWriteRect"},
+        {UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, "urEnqueueMemBufferCopy"},
+        {UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT,
+         "urEnqueueMemBufferCopyRect"},
+        {UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, "urEnqueueMemBufferFill"},
+        {UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, "urEnqueueMemImageRead"},
+        {UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, "urEnqueueMemImageWrite"},
+        {UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, "urEnqueueMemImageCopy"},
+        {UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, "urEnqueueMemBufferMap"},
+        {UR_FUNCTION_ENQUEUE_MEM_UNMAP, "urEnqueueMemUnmap"},
+        {UR_FUNCTION_ENQUEUE_USM_FILL, "urEnqueueUSMFill"},
+        {UR_FUNCTION_ENQUEUE_USM_MEMCPY, "urEnqueueUSMMemcpy"},
+        {UR_FUNCTION_ENQUEUE_USM_PREFETCH, "urEnqueueUSMPrefetch"},
+        {UR_FUNCTION_ENQUEUE_USM_ADVISE, "urEnqueueUSMAdvise"},
+        {UR_FUNCTION_ENQUEUE_USM_FILL_2D, "urEnqueueUSMFill2D"},
+        {UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D, "urEnqueueUSMMemcpy2D"},
+        {UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
+         "urEnqueueDeviceGlobalVariableWrite"},
+        {UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ,
+         "urEnqueueDeviceGlobalVariableRead"},
+        {UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, "urEnqueueReadHostPipe"},
+        {UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, "urEnqueueWriteHostPipe"},
+        {UR_FUNCTION_USM_PITCHED_ALLOC_EXP, "urUSMPitchedAllocExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+         "urBindlessImagesUnsampledImageHandleDestroyExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+         "urBindlessImagesSampledImageHandleDestroyExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP,
+         "urBindlessImagesImageAllocateExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP,
+         "urBindlessImagesImageFreeExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
+         "urBindlessImagesUnsampledImageCreateExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
+         "urBindlessImagesSampledImageCreateExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP,
+         "urBindlessImagesImageCopyExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP,
+         "urBindlessImagesImageGetInfoExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP,
+         "urBindlessImagesMipmapGetLevelExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP,
+         "urBindlessImagesMipmapFreeExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
+         "urBindlessImagesImportExternalMemoryExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP,
+         "urBindlessImagesMapExternalArrayExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
+         "urBindlessImagesMapExternalLinearMemoryExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
+         "urBindlessImagesReleaseExternalMemoryExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP,
+         "urBindlessImagesImportExternalSemaphoreExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
+         "urBindlessImagesReleaseExternalSemaphoreExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
+         "urBindlessImagesWaitExternalSemaphoreExp"},
+        {UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
+         "urBindlessImagesSignalExternalSemaphoreExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP, "urCommandBufferCreateExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP, "urCommandBufferRetainExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP, "urCommandBufferReleaseExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP, "urCommandBufferFinalizeExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
+         "urCommandBufferAppendKernelLaunchExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP,
+         "urCommandBufferAppendUSMMemcpyExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP,
+         "urCommandBufferAppendUSMFillExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
+         "urCommandBufferAppendMemBufferCopyExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
+         "urCommandBufferAppendMemBufferWriteExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
+         "urCommandBufferAppendMemBufferReadExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
+         "urCommandBufferAppendMemBufferCopyRectExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
+         "urCommandBufferAppendMemBufferWriteRectExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
+         "urCommandBufferAppendMemBufferReadRectExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
+         "urCommandBufferAppendMemBufferFillExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP,
+         "urCommandBufferAppendUSMPrefetchExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP,
+         "urCommandBufferAppendUSMAdviseExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP, "urCommandBufferEnqueueExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP,
+         "urCommandBufferRetainCommandExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP,
+         "urCommandBufferReleaseCommandExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
+         "urCommandBufferUpdateKernelLaunchExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP, "urCommandBufferGetInfoExp"},
+        {UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP,
+         "urCommandBufferCommandGetInfoExp"},
+        {UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
+         "urEnqueueCooperativeKernelLaunchExp"},
+        {UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
+         "urKernelSuggestMaxCooperativeGroupCountExp"},
+        {UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP,
+         "urEnqueueTimestampRecordingExp"},
+        {UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP,
+         "urEnqueueKernelLaunchCustomExp"},
+        {UR_FUNCTION_PROGRAM_BUILD_EXP, "urProgramBuildExp"},
+        {UR_FUNCTION_PROGRAM_COMPILE_EXP, "urProgramCompileExp"},
+        {UR_FUNCTION_PROGRAM_LINK_EXP, "urProgramLinkExp"},
+        {UR_FUNCTION_USM_IMPORT_EXP, "urUSMImportExp"},
+        {UR_FUNCTION_USM_RELEASE_EXP, "urUSMReleaseExp"},
+        {UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
+         "urUsmP2PEnablePeerAccessExp"},
+        {UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
+         "urUsmP2PDisablePeerAccessExp"},
+        {UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
+         "urUsmP2PPeerAccessGetInfoExp"},
+        {UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP, "urEnqueueNativeCommandExp"},
+        {UR_FUNCTION_USM_POOL_TRIM_EXP, "urUSMPoolTrimExp"},
+        {UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP,
+         "urEnqueueUSMDeviceAllocExp"},
+        {UR_FUNCTION_ENQUEUE_USM_FREE_EXP, "urEnqueueUSMFreeExp"},
+        {UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP,
+         "urEnqueueMemBufferCopyRectBatchExp"},
+        {UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP,
+         "urEnqueueKernelLaunchBatchExp"},
+        {UR_FUNCTION_KERNEL_SET_ARGS_EXP, "urKernelSetArgsExp"},
+        {UR_FUNCTION_EVENT_WAIT_ANY_EXP, "urEventWaitAnyExp"},
+        {UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP,
+         "urEventGetExecutionStatusExp"},
+        {UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP,
+         "urQueueReserveTimestampMarkersExp"},
+        {UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP,
+         "urEnqueueTimestampMarkerExp"},
+        {UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP,
+         "urQueueReadTimestampMarkersExp"},
+    };
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Global table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetGlobalProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_global_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Global;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnAdapterGet = pDdiTable->pfnAdapterGet;
     pDdiTable->pfnAdapterGet = ur_tracing_layer::urAdapterGet;
@@ -9327,6 +11402,26 @@ __urdlllocal ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
     pDdiTable->pfnNativeCommandExp =
         ur_tracing_layer::urEnqueueNativeCommandExp;
 
+    dditable.pfnUSMDeviceAllocExp = pDdiTable->pfnUSMDeviceAllocExp;
+    pDdiTable->pfnUSMDeviceAllocExp =
+        ur_tracing_layer::urEnqueueUSMDeviceAllocExp;
+
+    dditable.pfnUSMFreeExp = pDdiTable->pfnUSMFreeExp;
+    pDdiTable->pfnUSMFreeExp = ur_tracing_layer::urEnqueueUSMFreeExp;
+
+    dditable.pfnMemBufferCopyRectBatchExp =
+        pDdiTable->pfnMemBufferCopyRectBatchExp;
+    pDdiTable->pfnMemBufferCopyRectBatchExp =
+        ur_tracing_layer::urEnqueueMemBufferCopyRectBatchExp;
+
+    dditable.pfnKernelLaunchBatchExp = pDdiTable->pfnKernelLaunchBatchExp;
+    pDdiTable->pfnKernelLaunchBatchExp =
+        ur_tracing_layer::urEnqueueKernelLaunchBatchExp;
+
+    dditable.pfnTimestampMarkerExp = pDdiTable->pfnTimestampMarkerExp;
+    pDdiTable->pfnTimestampMarkerExp =
+        ur_tracing_layer::urEnqueueTimestampMarkerExp;
+
     return result;
 }
 ///////////////////////////////////////////////////////////////////////////////
@@ -9385,6 +11480,43 @@ __urdlllocal ur_result_t UR_APICALL urGetEventProcAddrTable(
     return result;
 }
 ///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EventExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_event_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.EventExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnWaitAnyExp = pDdiTable->pfnWaitAnyExp;
+    pDdiTable->pfnWaitAnyExp = ur_tracing_layer::urEventWaitAnyExp;
+
+    dditable.pfnGetExecutionStatusExp = pDdiTable->pfnGetExecutionStatusExp;
+    pDdiTable->pfnGetExecutionStatusExp =
+        ur_tracing_layer::urEventGetExecutionStatusExp;
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Kernel table
 ///        with current process' addresses
 ///
@@ -9500,6 +11632,9 @@ __urdlllocal ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
     pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
         ur_tracing_layer::urKernelSuggestMaxCooperativeGroupCountExp;
 
+    dditable.pfnSetArgsExp = pDdiTable->pfnSetArgsExp;
+    pDdiTable->pfnSetArgsExp = ur_tracing_layer::urKernelSetArgsExp;
+
     return result;
 }
 ///////////////////////////////////////////////////////////////////////////////
@@ -9829,6 +11964,45 @@ __urdlllocal ur_result_t UR_APICALL urGetQueueProcAddrTable(
     return result;
 }
 ///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's QueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.QueueExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnReserveTimestampMarkersExp =
+        pDdiTable->pfnReserveTimestampMarkersExp;
+    pDdiTable->pfnReserveTimestampMarkersExp =
+        ur_tracing_layer::urQueueReserveTimestampMarkersExp;
+
+    dditable.pfnReadTimestampMarkersExp = pDdiTable->pfnReadTimestampMarkersExp;
+    pDdiTable->pfnReadTimestampMarkersExp =
+        ur_tracing_layer::urQueueReadTimestampMarkersExp;
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Sampler table
 ///        with current process' addresses
 ///
@@ -9971,6 +12145,9 @@ __urdlllocal ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
     dditable.pfnReleaseExp = pDdiTable->pfnReleaseExp;
     pDdiTable->pfnReleaseExp = ur_tracing_layer::urUSMReleaseExp;
 
+    dditable.pfnPoolTrimExp = pDdiTable->pfnPoolTrimExp;
+    pDdiTable->pfnPoolTrimExp = ur_tracing_layer::urUSMPoolTrimExp;
+
     return result;
 }
 ///////////////////////////////////////////////////////////////////////////////
@@ -10142,6 +12319,8 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
 
     ur_tracing_layer::getContext()->codelocData = codelocData;
 
+    configure();
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_tracing_layer::urGetGlobalProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Global);
@@ -10177,6 +12356,11 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
             UR_API_VERSION_CURRENT, &dditable->Event);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_tracing_layer::urGetEventExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->EventExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_tracing_layer::urGetKernelProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Kernel);
@@ -10217,6 +12401,11 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
             UR_API_VERSION_CURRENT, &dditable->Queue);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_tracing_layer::urGetQueueExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->QueueExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_tracing_layer::urGetSamplerProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Sampler);
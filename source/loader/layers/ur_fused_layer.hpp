@@ -0,0 +1,33 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_fused_layer.hpp
+ *
+ */
+#ifndef UR_FUSED_LAYER_H
+#define UR_FUSED_LAYER_H 1
+
+#include "ur_ddi.h"
+#include "ur_util.hpp"
+
+/// The layers which are usually enabled together, the tracing and validation
+/// layers, fused in a single intercept function per API. It has the prologue
+/// and epilogue of each layer one after the other and calls what the
+/// innermost layer would, instead of an indirect call per layer, see
+/// fusedddi.cpp.mako.
+namespace ur_fused_layer {
+
+/// Replaces the functions of the table which call the fused layers one after
+/// the other, e.g. those the layers in between didn't intercept, with the
+/// fused functions. Called once the layers were initialized, on the table of
+/// the loader and on those of the layers above the fused ones.
+__urdlllocal void fuse(ur_dditable_t *dditable);
+
+} // namespace ur_fused_layer
+
+#endif /* UR_FUSED_LAYER_H */
@@ -0,0 +1,22050 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_fusedddi.cpp
+ *
+ */
+#include "ur_fused_layer.hpp"
+#include "tracing/ur_tracing_layer.hpp"
+#include "validation/ur_leak_check.hpp"
+#include "validation/ur_validation_layer.hpp"
+
+#include <iostream>
+#include <type_traits>
+
+namespace ur_tracing_layer {
+__urdlllocal std::remove_pointer_t<ur_pfnAdapterGet_t> urAdapterGet;
+__urdlllocal std::remove_pointer_t<ur_pfnAdapterRelease_t> urAdapterRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnAdapterRetain_t> urAdapterRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnAdapterGetLastError_t>
+    urAdapterGetLastError;
+__urdlllocal std::remove_pointer_t<ur_pfnAdapterGetInfo_t> urAdapterGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformGet_t> urPlatformGet;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformGetInfo_t> urPlatformGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformGetApiVersion_t>
+    urPlatformGetApiVersion;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformGetNativeHandle_t>
+    urPlatformGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformCreateWithNativeHandle_t>
+    urPlatformCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformGetBackendOption_t>
+    urPlatformGetBackendOption;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceGet_t> urDeviceGet;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceGetInfo_t> urDeviceGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceRetain_t> urDeviceRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceRelease_t> urDeviceRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnDevicePartition_t> urDevicePartition;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceSelectBinary_t>
+    urDeviceSelectBinary;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceGetNativeHandle_t>
+    urDeviceGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceCreateWithNativeHandle_t>
+    urDeviceCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceGetGlobalTimestamps_t>
+    urDeviceGetGlobalTimestamps;
+__urdlllocal std::remove_pointer_t<ur_pfnContextCreate_t> urContextCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnContextRetain_t> urContextRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnContextRelease_t> urContextRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnContextGetInfo_t> urContextGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnContextGetNativeHandle_t>
+    urContextGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnContextCreateWithNativeHandle_t>
+    urContextCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnContextSetExtendedDeleter_t>
+    urContextSetExtendedDeleter;
+__urdlllocal std::remove_pointer_t<ur_pfnMemImageCreate_t> urMemImageCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnMemBufferCreate_t> urMemBufferCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnMemRetain_t> urMemRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnMemRelease_t> urMemRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnMemBufferPartition_t>
+    urMemBufferPartition;
+__urdlllocal std::remove_pointer_t<ur_pfnMemGetNativeHandle_t>
+    urMemGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnMemBufferCreateWithNativeHandle_t>
+    urMemBufferCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnMemImageCreateWithNativeHandle_t>
+    urMemImageCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnMemGetInfo_t> urMemGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnMemImageGetInfo_t> urMemImageGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerCreate_t> urSamplerCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerRetain_t> urSamplerRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerRelease_t> urSamplerRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerGetInfo_t> urSamplerGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerGetNativeHandle_t>
+    urSamplerGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerCreateWithNativeHandle_t>
+    urSamplerCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMHostAlloc_t> urUSMHostAlloc;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMDeviceAlloc_t> urUSMDeviceAlloc;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMSharedAlloc_t> urUSMSharedAlloc;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMFree_t> urUSMFree;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMGetMemAllocInfo_t>
+    urUSMGetMemAllocInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPoolCreate_t> urUSMPoolCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPoolRetain_t> urUSMPoolRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPoolRelease_t> urUSMPoolRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPoolGetInfo_t> urUSMPoolGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemGranularityGetInfo_t>
+    urVirtualMemGranularityGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemReserve_t>
+    urVirtualMemReserve;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemFree_t> urVirtualMemFree;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemMap_t> urVirtualMemMap;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemUnmap_t> urVirtualMemUnmap;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemSetAccess_t>
+    urVirtualMemSetAccess;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemGetInfo_t>
+    urVirtualMemGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnPhysicalMemCreate_t>
+    urPhysicalMemCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnPhysicalMemRetain_t>
+    urPhysicalMemRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnPhysicalMemRelease_t>
+    urPhysicalMemRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramCreateWithIL_t>
+    urProgramCreateWithIL;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramCreateWithBinary_t>
+    urProgramCreateWithBinary;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramBuild_t> urProgramBuild;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramCompile_t> urProgramCompile;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramLink_t> urProgramLink;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramRetain_t> urProgramRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramRelease_t> urProgramRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramGetFunctionPointer_t>
+    urProgramGetFunctionPointer;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramGetGlobalVariablePointer_t>
+    urProgramGetGlobalVariablePointer;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramGetInfo_t> urProgramGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramGetBuildInfo_t>
+    urProgramGetBuildInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramSetSpecializationConstants_t>
+    urProgramSetSpecializationConstants;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramGetNativeHandle_t>
+    urProgramGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramCreateWithNativeHandle_t>
+    urProgramCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelCreate_t> urKernelCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgValue_t>
+    urKernelSetArgValue;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgLocal_t>
+    urKernelSetArgLocal;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelGetInfo_t> urKernelGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelGetGroupInfo_t>
+    urKernelGetGroupInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelGetSubGroupInfo_t>
+    urKernelGetSubGroupInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelRetain_t> urKernelRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelRelease_t> urKernelRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgPointer_t>
+    urKernelSetArgPointer;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetExecInfo_t>
+    urKernelSetExecInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgSampler_t>
+    urKernelSetArgSampler;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgMemObj_t>
+    urKernelSetArgMemObj;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetSpecializationConstants_t>
+    urKernelSetSpecializationConstants;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelGetNativeHandle_t>
+    urKernelGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelCreateWithNativeHandle_t>
+    urKernelCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelGetSuggestedLocalWorkSize_t>
+    urKernelGetSuggestedLocalWorkSize;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueGetInfo_t> urQueueGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueCreate_t> urQueueCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueRetain_t> urQueueRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueRelease_t> urQueueRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueGetNativeHandle_t>
+    urQueueGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueCreateWithNativeHandle_t>
+    urQueueCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueFinish_t> urQueueFinish;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueFlush_t> urQueueFlush;
+__urdlllocal std::remove_pointer_t<ur_pfnEventGetInfo_t> urEventGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnEventGetProfilingInfo_t>
+    urEventGetProfilingInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnEventWait_t> urEventWait;
+__urdlllocal std::remove_pointer_t<ur_pfnEventRetain_t> urEventRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnEventRelease_t> urEventRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnEventGetNativeHandle_t>
+    urEventGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnEventCreateWithNativeHandle_t>
+    urEventCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnEventSetCallback_t> urEventSetCallback;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueKernelLaunch_t>
+    urEnqueueKernelLaunch;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueEventsWait_t>
+    urEnqueueEventsWait;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueEventsWaitWithBarrier_t>
+    urEnqueueEventsWaitWithBarrier;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferRead_t>
+    urEnqueueMemBufferRead;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferWrite_t>
+    urEnqueueMemBufferWrite;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferReadRect_t>
+    urEnqueueMemBufferReadRect;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferWriteRect_t>
+    urEnqueueMemBufferWriteRect;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferCopy_t>
+    urEnqueueMemBufferCopy;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferCopyRect_t>
+    urEnqueueMemBufferCopyRect;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferFill_t>
+    urEnqueueMemBufferFill;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemImageRead_t>
+    urEnqueueMemImageRead;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemImageWrite_t>
+    urEnqueueMemImageWrite;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemImageCopy_t>
+    urEnqueueMemImageCopy;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferMap_t>
+    urEnqueueMemBufferMap;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemUnmap_t> urEnqueueMemUnmap;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMFill_t> urEnqueueUSMFill;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMMemcpy_t> urEnqueueUSMMemcpy;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMPrefetch_t>
+    urEnqueueUSMPrefetch;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMAdvise_t> urEnqueueUSMAdvise;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMFill2D_t> urEnqueueUSMFill2D;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMMemcpy2D_t>
+    urEnqueueUSMMemcpy2D;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueDeviceGlobalVariableWrite_t>
+    urEnqueueDeviceGlobalVariableWrite;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueDeviceGlobalVariableRead_t>
+    urEnqueueDeviceGlobalVariableRead;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueReadHostPipe_t>
+    urEnqueueReadHostPipe;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueWriteHostPipe_t>
+    urEnqueueWriteHostPipe;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPitchedAllocExp_t>
+    urUSMPitchedAllocExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesUnsampledImageHandleDestroyExp_t>
+    urBindlessImagesUnsampledImageHandleDestroyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesSampledImageHandleDestroyExp_t>
+    urBindlessImagesSampledImageHandleDestroyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImageAllocateExp_t>
+    urBindlessImagesImageAllocateExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImageFreeExp_t>
+    urBindlessImagesImageFreeExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesUnsampledImageCreateExp_t>
+    urBindlessImagesUnsampledImageCreateExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesSampledImageCreateExp_t>
+    urBindlessImagesSampledImageCreateExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImageCopyExp_t>
+    urBindlessImagesImageCopyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImageGetInfoExp_t>
+    urBindlessImagesImageGetInfoExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesMipmapGetLevelExp_t>
+    urBindlessImagesMipmapGetLevelExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesMipmapFreeExp_t>
+    urBindlessImagesMipmapFreeExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImportExternalMemoryExp_t>
+    urBindlessImagesImportExternalMemoryExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesMapExternalArrayExp_t>
+    urBindlessImagesMapExternalArrayExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesMapExternalLinearMemoryExp_t>
+    urBindlessImagesMapExternalLinearMemoryExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesReleaseExternalMemoryExp_t>
+    urBindlessImagesReleaseExternalMemoryExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImportExternalSemaphoreExp_t>
+    urBindlessImagesImportExternalSemaphoreExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesReleaseExternalSemaphoreExp_t>
+    urBindlessImagesReleaseExternalSemaphoreExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesWaitExternalSemaphoreExp_t>
+    urBindlessImagesWaitExternalSemaphoreExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesSignalExternalSemaphoreExp_t>
+    urBindlessImagesSignalExternalSemaphoreExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferCreateExp_t>
+    urCommandBufferCreateExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferRetainExp_t>
+    urCommandBufferRetainExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferReleaseExp_t>
+    urCommandBufferReleaseExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferFinalizeExp_t>
+    urCommandBufferFinalizeExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendKernelLaunchExp_t>
+    urCommandBufferAppendKernelLaunchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendUSMMemcpyExp_t>
+    urCommandBufferAppendUSMMemcpyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendUSMFillExp_t>
+    urCommandBufferAppendUSMFillExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferCopyExp_t>
+    urCommandBufferAppendMemBufferCopyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferWriteExp_t>
+    urCommandBufferAppendMemBufferWriteExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferReadExp_t>
+    urCommandBufferAppendMemBufferReadExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferCopyRectExp_t>
+    urCommandBufferAppendMemBufferCopyRectExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferWriteRectExp_t>
+    urCommandBufferAppendMemBufferWriteRectExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferReadRectExp_t>
+    urCommandBufferAppendMemBufferReadRectExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferFillExp_t>
+    urCommandBufferAppendMemBufferFillExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendUSMPrefetchExp_t>
+    urCommandBufferAppendUSMPrefetchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendUSMAdviseExp_t>
+    urCommandBufferAppendUSMAdviseExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferEnqueueExp_t>
+    urCommandBufferEnqueueExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferRetainCommandExp_t>
+    urCommandBufferRetainCommandExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferReleaseCommandExp_t>
+    urCommandBufferReleaseCommandExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferUpdateKernelLaunchExp_t>
+    urCommandBufferUpdateKernelLaunchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferGetInfoExp_t>
+    urCommandBufferGetInfoExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferCommandGetInfoExp_t>
+    urCommandBufferCommandGetInfoExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueCooperativeKernelLaunchExp_t>
+    urEnqueueCooperativeKernelLaunchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSuggestMaxCooperativeGroupCountExp_t>
+    urKernelSuggestMaxCooperativeGroupCountExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferCopyRectBatchExp_t>
+    urEnqueueMemBufferCopyRectBatchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueKernelLaunchBatchExp_t>
+    urEnqueueKernelLaunchBatchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueTimestampRecordingExp_t>
+    urEnqueueTimestampRecordingExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMDeviceAllocExp_t>
+    urEnqueueUSMDeviceAllocExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMFreeExp_t>
+    urEnqueueUSMFreeExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEventWaitAnyExp_t> urEventWaitAnyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEventGetExecutionStatusExp_t>
+    urEventGetExecutionStatusExp;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueReserveTimestampMarkersExp_t>
+    urQueueReserveTimestampMarkersExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueTimestampMarkerExp_t>
+    urEnqueueTimestampMarkerExp;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueReadTimestampMarkersExp_t>
+    urQueueReadTimestampMarkersExp;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgsExp_t> urKernelSetArgsExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueKernelLaunchCustomExp_t>
+    urEnqueueKernelLaunchCustomExp;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramBuildExp_t> urProgramBuildExp;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramCompileExp_t>
+    urProgramCompileExp;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramLinkExp_t> urProgramLinkExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMImportExp_t> urUSMImportExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMReleaseExp_t> urUSMReleaseExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUsmP2PEnablePeerAccessExp_t>
+    urUsmP2PEnablePeerAccessExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUsmP2PDisablePeerAccessExp_t>
+    urUsmP2PDisablePeerAccessExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUsmP2PPeerAccessGetInfoExp_t>
+    urUsmP2PPeerAccessGetInfoExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPoolTrimExp_t> urUSMPoolTrimExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueNativeCommandExp_t>
+    urEnqueueNativeCommandExp;
+} // namespace ur_tracing_layer
+
+namespace ur_validation_layer {
+__urdlllocal std::remove_pointer_t<ur_pfnAdapterGet_t> urAdapterGet;
+__urdlllocal std::remove_pointer_t<ur_pfnAdapterRelease_t> urAdapterRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnAdapterRetain_t> urAdapterRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnAdapterGetLastError_t>
+    urAdapterGetLastError;
+__urdlllocal std::remove_pointer_t<ur_pfnAdapterGetInfo_t> urAdapterGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformGet_t> urPlatformGet;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformGetInfo_t> urPlatformGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformGetApiVersion_t>
+    urPlatformGetApiVersion;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformGetNativeHandle_t>
+    urPlatformGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformCreateWithNativeHandle_t>
+    urPlatformCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnPlatformGetBackendOption_t>
+    urPlatformGetBackendOption;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceGet_t> urDeviceGet;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceGetInfo_t> urDeviceGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceRetain_t> urDeviceRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceRelease_t> urDeviceRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnDevicePartition_t> urDevicePartition;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceSelectBinary_t>
+    urDeviceSelectBinary;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceGetNativeHandle_t>
+    urDeviceGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceCreateWithNativeHandle_t>
+    urDeviceCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnDeviceGetGlobalTimestamps_t>
+    urDeviceGetGlobalTimestamps;
+__urdlllocal std::remove_pointer_t<ur_pfnContextCreate_t> urContextCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnContextRetain_t> urContextRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnContextRelease_t> urContextRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnContextGetInfo_t> urContextGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnContextGetNativeHandle_t>
+    urContextGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnContextCreateWithNativeHandle_t>
+    urContextCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnContextSetExtendedDeleter_t>
+    urContextSetExtendedDeleter;
+__urdlllocal std::remove_pointer_t<ur_pfnMemImageCreate_t> urMemImageCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnMemBufferCreate_t> urMemBufferCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnMemRetain_t> urMemRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnMemRelease_t> urMemRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnMemBufferPartition_t>
+    urMemBufferPartition;
+__urdlllocal std::remove_pointer_t<ur_pfnMemGetNativeHandle_t>
+    urMemGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnMemBufferCreateWithNativeHandle_t>
+    urMemBufferCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnMemImageCreateWithNativeHandle_t>
+    urMemImageCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnMemGetInfo_t> urMemGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnMemImageGetInfo_t> urMemImageGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerCreate_t> urSamplerCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerRetain_t> urSamplerRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerRelease_t> urSamplerRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerGetInfo_t> urSamplerGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerGetNativeHandle_t>
+    urSamplerGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnSamplerCreateWithNativeHandle_t>
+    urSamplerCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMHostAlloc_t> urUSMHostAlloc;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMDeviceAlloc_t> urUSMDeviceAlloc;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMSharedAlloc_t> urUSMSharedAlloc;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMFree_t> urUSMFree;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMGetMemAllocInfo_t>
+    urUSMGetMemAllocInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPoolCreate_t> urUSMPoolCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPoolRetain_t> urUSMPoolRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPoolRelease_t> urUSMPoolRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPoolGetInfo_t> urUSMPoolGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemGranularityGetInfo_t>
+    urVirtualMemGranularityGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemReserve_t>
+    urVirtualMemReserve;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemFree_t> urVirtualMemFree;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemMap_t> urVirtualMemMap;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemUnmap_t> urVirtualMemUnmap;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemSetAccess_t>
+    urVirtualMemSetAccess;
+__urdlllocal std::remove_pointer_t<ur_pfnVirtualMemGetInfo_t>
+    urVirtualMemGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnPhysicalMemCreate_t>
+    urPhysicalMemCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnPhysicalMemRetain_t>
+    urPhysicalMemRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnPhysicalMemRelease_t>
+    urPhysicalMemRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramCreateWithIL_t>
+    urProgramCreateWithIL;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramCreateWithBinary_t>
+    urProgramCreateWithBinary;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramBuild_t> urProgramBuild;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramCompile_t> urProgramCompile;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramLink_t> urProgramLink;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramRetain_t> urProgramRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramRelease_t> urProgramRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramGetFunctionPointer_t>
+    urProgramGetFunctionPointer;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramGetGlobalVariablePointer_t>
+    urProgramGetGlobalVariablePointer;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramGetInfo_t> urProgramGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramGetBuildInfo_t>
+    urProgramGetBuildInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramSetSpecializationConstants_t>
+    urProgramSetSpecializationConstants;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramGetNativeHandle_t>
+    urProgramGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramCreateWithNativeHandle_t>
+    urProgramCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelCreate_t> urKernelCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgValue_t>
+    urKernelSetArgValue;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgLocal_t>
+    urKernelSetArgLocal;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelGetInfo_t> urKernelGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelGetGroupInfo_t>
+    urKernelGetGroupInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelGetSubGroupInfo_t>
+    urKernelGetSubGroupInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelRetain_t> urKernelRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelRelease_t> urKernelRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgPointer_t>
+    urKernelSetArgPointer;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetExecInfo_t>
+    urKernelSetExecInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgSampler_t>
+    urKernelSetArgSampler;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgMemObj_t>
+    urKernelSetArgMemObj;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetSpecializationConstants_t>
+    urKernelSetSpecializationConstants;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelGetNativeHandle_t>
+    urKernelGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelCreateWithNativeHandle_t>
+    urKernelCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelGetSuggestedLocalWorkSize_t>
+    urKernelGetSuggestedLocalWorkSize;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueGetInfo_t> urQueueGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueCreate_t> urQueueCreate;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueRetain_t> urQueueRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueRelease_t> urQueueRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueGetNativeHandle_t>
+    urQueueGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueCreateWithNativeHandle_t>
+    urQueueCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueFinish_t> urQueueFinish;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueFlush_t> urQueueFlush;
+__urdlllocal std::remove_pointer_t<ur_pfnEventGetInfo_t> urEventGetInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnEventGetProfilingInfo_t>
+    urEventGetProfilingInfo;
+__urdlllocal std::remove_pointer_t<ur_pfnEventWait_t> urEventWait;
+__urdlllocal std::remove_pointer_t<ur_pfnEventRetain_t> urEventRetain;
+__urdlllocal std::remove_pointer_t<ur_pfnEventRelease_t> urEventRelease;
+__urdlllocal std::remove_pointer_t<ur_pfnEventGetNativeHandle_t>
+    urEventGetNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnEventCreateWithNativeHandle_t>
+    urEventCreateWithNativeHandle;
+__urdlllocal std::remove_pointer_t<ur_pfnEventSetCallback_t> urEventSetCallback;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueKernelLaunch_t>
+    urEnqueueKernelLaunch;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueEventsWait_t>
+    urEnqueueEventsWait;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueEventsWaitWithBarrier_t>
+    urEnqueueEventsWaitWithBarrier;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferRead_t>
+    urEnqueueMemBufferRead;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferWrite_t>
+    urEnqueueMemBufferWrite;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferReadRect_t>
+    urEnqueueMemBufferReadRect;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferWriteRect_t>
+    urEnqueueMemBufferWriteRect;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferCopy_t>
+    urEnqueueMemBufferCopy;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferCopyRect_t>
+    urEnqueueMemBufferCopyRect;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferFill_t>
+    urEnqueueMemBufferFill;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemImageRead_t>
+    urEnqueueMemImageRead;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemImageWrite_t>
+    urEnqueueMemImageWrite;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemImageCopy_t>
+    urEnqueueMemImageCopy;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferMap_t>
+    urEnqueueMemBufferMap;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemUnmap_t> urEnqueueMemUnmap;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMFill_t> urEnqueueUSMFill;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMMemcpy_t> urEnqueueUSMMemcpy;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMPrefetch_t>
+    urEnqueueUSMPrefetch;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMAdvise_t> urEnqueueUSMAdvise;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMFill2D_t> urEnqueueUSMFill2D;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMMemcpy2D_t>
+    urEnqueueUSMMemcpy2D;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueDeviceGlobalVariableWrite_t>
+    urEnqueueDeviceGlobalVariableWrite;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueDeviceGlobalVariableRead_t>
+    urEnqueueDeviceGlobalVariableRead;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueReadHostPipe_t>
+    urEnqueueReadHostPipe;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueWriteHostPipe_t>
+    urEnqueueWriteHostPipe;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPitchedAllocExp_t>
+    urUSMPitchedAllocExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesUnsampledImageHandleDestroyExp_t>
+    urBindlessImagesUnsampledImageHandleDestroyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesSampledImageHandleDestroyExp_t>
+    urBindlessImagesSampledImageHandleDestroyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImageAllocateExp_t>
+    urBindlessImagesImageAllocateExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImageFreeExp_t>
+    urBindlessImagesImageFreeExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesUnsampledImageCreateExp_t>
+    urBindlessImagesUnsampledImageCreateExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesSampledImageCreateExp_t>
+    urBindlessImagesSampledImageCreateExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImageCopyExp_t>
+    urBindlessImagesImageCopyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImageGetInfoExp_t>
+    urBindlessImagesImageGetInfoExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesMipmapGetLevelExp_t>
+    urBindlessImagesMipmapGetLevelExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesMipmapFreeExp_t>
+    urBindlessImagesMipmapFreeExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImportExternalMemoryExp_t>
+    urBindlessImagesImportExternalMemoryExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesMapExternalArrayExp_t>
+    urBindlessImagesMapExternalArrayExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesMapExternalLinearMemoryExp_t>
+    urBindlessImagesMapExternalLinearMemoryExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesReleaseExternalMemoryExp_t>
+    urBindlessImagesReleaseExternalMemoryExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesImportExternalSemaphoreExp_t>
+    urBindlessImagesImportExternalSemaphoreExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesReleaseExternalSemaphoreExp_t>
+    urBindlessImagesReleaseExternalSemaphoreExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesWaitExternalSemaphoreExp_t>
+    urBindlessImagesWaitExternalSemaphoreExp;
+__urdlllocal std::remove_pointer_t<ur_pfnBindlessImagesSignalExternalSemaphoreExp_t>
+    urBindlessImagesSignalExternalSemaphoreExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferCreateExp_t>
+    urCommandBufferCreateExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferRetainExp_t>
+    urCommandBufferRetainExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferReleaseExp_t>
+    urCommandBufferReleaseExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferFinalizeExp_t>
+    urCommandBufferFinalizeExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendKernelLaunchExp_t>
+    urCommandBufferAppendKernelLaunchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendUSMMemcpyExp_t>
+    urCommandBufferAppendUSMMemcpyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendUSMFillExp_t>
+    urCommandBufferAppendUSMFillExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferCopyExp_t>
+    urCommandBufferAppendMemBufferCopyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferWriteExp_t>
+    urCommandBufferAppendMemBufferWriteExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferReadExp_t>
+    urCommandBufferAppendMemBufferReadExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferCopyRectExp_t>
+    urCommandBufferAppendMemBufferCopyRectExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferWriteRectExp_t>
+    urCommandBufferAppendMemBufferWriteRectExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferReadRectExp_t>
+    urCommandBufferAppendMemBufferReadRectExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendMemBufferFillExp_t>
+    urCommandBufferAppendMemBufferFillExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendUSMPrefetchExp_t>
+    urCommandBufferAppendUSMPrefetchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferAppendUSMAdviseExp_t>
+    urCommandBufferAppendUSMAdviseExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferEnqueueExp_t>
+    urCommandBufferEnqueueExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferRetainCommandExp_t>
+    urCommandBufferRetainCommandExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferReleaseCommandExp_t>
+    urCommandBufferReleaseCommandExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferUpdateKernelLaunchExp_t>
+    urCommandBufferUpdateKernelLaunchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferGetInfoExp_t>
+    urCommandBufferGetInfoExp;
+__urdlllocal std::remove_pointer_t<ur_pfnCommandBufferCommandGetInfoExp_t>
+    urCommandBufferCommandGetInfoExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueCooperativeKernelLaunchExp_t>
+    urEnqueueCooperativeKernelLaunchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSuggestMaxCooperativeGroupCountExp_t>
+    urKernelSuggestMaxCooperativeGroupCountExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueMemBufferCopyRectBatchExp_t>
+    urEnqueueMemBufferCopyRectBatchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueKernelLaunchBatchExp_t>
+    urEnqueueKernelLaunchBatchExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueTimestampRecordingExp_t>
+    urEnqueueTimestampRecordingExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMDeviceAllocExp_t>
+    urEnqueueUSMDeviceAllocExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueUSMFreeExp_t>
+    urEnqueueUSMFreeExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEventWaitAnyExp_t> urEventWaitAnyExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEventGetExecutionStatusExp_t>
+    urEventGetExecutionStatusExp;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueReserveTimestampMarkersExp_t>
+    urQueueReserveTimestampMarkersExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueTimestampMarkerExp_t>
+    urEnqueueTimestampMarkerExp;
+__urdlllocal std::remove_pointer_t<ur_pfnQueueReadTimestampMarkersExp_t>
+    urQueueReadTimestampMarkersExp;
+__urdlllocal std::remove_pointer_t<ur_pfnKernelSetArgsExp_t> urKernelSetArgsExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueKernelLaunchCustomExp_t>
+    urEnqueueKernelLaunchCustomExp;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramBuildExp_t> urProgramBuildExp;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramCompileExp_t>
+    urProgramCompileExp;
+__urdlllocal std::remove_pointer_t<ur_pfnProgramLinkExp_t> urProgramLinkExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMImportExp_t> urUSMImportExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMReleaseExp_t> urUSMReleaseExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUsmP2PEnablePeerAccessExp_t>
+    urUsmP2PEnablePeerAccessExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUsmP2PDisablePeerAccessExp_t>
+    urUsmP2PDisablePeerAccessExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUsmP2PPeerAccessGetInfoExp_t>
+    urUsmP2PPeerAccessGetInfoExp;
+__urdlllocal std::remove_pointer_t<ur_pfnUSMPoolTrimExp_t> urUSMPoolTrimExp;
+__urdlllocal std::remove_pointer_t<ur_pfnEnqueueNativeCommandExp_t>
+    urEnqueueNativeCommandExp;
+} // namespace ur_validation_layer
+
+namespace ur_fused_layer {
+namespace {
+namespace validation {
+using ur_validation_layer::bounds;
+using ur_validation_layer::boundsImage;
+using ur_validation_layer::getContext;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urAdapterGet
+__urdlllocal ur_result_t UR_APICALL urAdapterGet(
+    uint32_t
+        NumEntries, ///< [in] the number of adapters to be added to phAdapters.
+    ///< If phAdapters is not NULL, then NumEntries should be greater than
+    ///< zero, otherwise ::UR_RESULT_ERROR_INVALID_SIZE,
+    ///< will be returned.
+    ur_adapter_handle_t *
+        phAdapters, ///< [out][optional][range(0, NumEntries)] array of handle of adapters.
+    ///< If NumEntries is less than the number of adapters available, then
+    ///< ::urAdapterGet shall only retrieve that number of adapters.
+    uint32_t *
+        pNumAdapters ///< [out][optional] returns the total number of adapters available.
+) {
+    auto pfnAdapterGet = getContext()->urDdiTable.Global.pfnAdapterGet;
+
+    if (nullptr == pfnAdapterGet) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NumEntries == 0 && phAdapters != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    ur_result_t result = pfnAdapterGet(NumEntries, phAdapters, pNumAdapters);
+
+    if (getContext()->enableLeakChecking && phAdapters &&
+        result == UR_RESULT_SUCCESS) {
+        for (uint32_t i = 0; i < NumEntries; i++) {
+            getContext()->refCountContext->createOrIncrementRefCount(
+                phAdapters[i], true);
+        }
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urAdapterRelease
+__urdlllocal ur_result_t UR_APICALL urAdapterRelease(
+    ur_adapter_handle_t hAdapter ///< [in][release] Adapter handle to release
+) {
+    auto pfnAdapterRelease = getContext()->urDdiTable.Global.pfnAdapterRelease;
+
+    if (nullptr == pfnAdapterRelease) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hAdapter) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnAdapterRelease(hAdapter);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->decrementRefCount(hAdapter, true);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urAdapterRetain
+__urdlllocal ur_result_t UR_APICALL urAdapterRetain(
+    ur_adapter_handle_t hAdapter ///< [in][retain] Adapter handle to retain
+) {
+    auto pfnAdapterRetain = getContext()->urDdiTable.Global.pfnAdapterRetain;
+
+    if (nullptr == pfnAdapterRetain) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hAdapter) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnAdapterRetain(hAdapter);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->incrementRefCount(hAdapter, true);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urAdapterGetLastError
+__urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
+    ur_adapter_handle_t hAdapter, ///< [in] handle of the adapter instance
+    const char **
+        ppMessage, ///< [out] pointer to a C string where the adapter specific error message
+                   ///< will be stored.
+    int32_t *
+        pError ///< [out] pointer to an integer where the adapter specific error code will
+               ///< be stored.
+) {
+    auto pfnAdapterGetLastError =
+        getContext()->urDdiTable.Global.pfnAdapterGetLastError;
+
+    if (nullptr == pfnAdapterGetLastError) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hAdapter) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppMessage) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pError) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hAdapter)) {
+        getContext()->refCountContext->logInvalidReference(hAdapter);
+    }
+
+    ur_result_t result = pfnAdapterGetLastError(hAdapter, ppMessage, pError);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urAdapterGetInfo
+__urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
+    ur_adapter_handle_t hAdapter, ///< [in] handle of the adapter
+    ur_adapter_info_t propName,   ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If Size is not equal to or greater to the real number of bytes needed
+    ///< to return the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is
+    ///< returned and pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual number of bytes being queried by pPropValue.
+) {
+    auto pfnAdapterGetInfo = getContext()->urDdiTable.Global.pfnAdapterGetInfo;
+
+    if (nullptr == pfnAdapterGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hAdapter) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_ADAPTER_INFO_REFERENCE_COUNT < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hAdapter)) {
+        getContext()->refCountContext->logInvalidReference(hAdapter);
+    }
+
+    ur_result_t result = pfnAdapterGetInfo(hAdapter, propName, propSize,
+                                           pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urPlatformGet
+__urdlllocal ur_result_t UR_APICALL urPlatformGet(
+    ur_adapter_handle_t *
+        phAdapters, ///< [in][range(0, NumAdapters)] array of adapters to query for platforms.
+    uint32_t NumAdapters, ///< [in] number of adapters pointed to by phAdapters
+    uint32_t
+        NumEntries, ///< [in] the number of platforms to be added to phPlatforms.
+    ///< If phPlatforms is not NULL, then NumEntries should be greater than
+    ///< zero, otherwise ::UR_RESULT_ERROR_INVALID_SIZE,
+    ///< will be returned.
+    ur_platform_handle_t *
+        phPlatforms, ///< [out][optional][range(0, NumEntries)] array of handle of platforms.
+    ///< If NumEntries is less than the number of platforms available, then
+    ///< ::urPlatformGet shall only retrieve that number of platforms.
+    uint32_t *
+        pNumPlatforms ///< [out][optional] returns the total number of platforms available.
+) {
+    auto pfnGet = getContext()->urDdiTable.Platform.pfnGet;
+
+    if (nullptr == pfnGet) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == phAdapters) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NumEntries == 0 && phPlatforms != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    ur_result_t result =
+        pfnGet(phAdapters, NumAdapters, NumEntries, phPlatforms, pNumPlatforms);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urPlatformGetInfo
+__urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
+    ur_platform_handle_t hPlatform, ///< [in] handle of the platform
+    ur_platform_info_t propName,    ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPlatformInfo.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If Size is not equal to or greater to the real number of bytes needed
+    ///< to return the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is
+    ///< returned and pPlatformInfo is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual number of bytes being queried by pPlatformInfo.
+) {
+    auto pfnGetInfo = getContext()->urDdiTable.Platform.pfnGetInfo;
+
+    if (nullptr == pfnGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hPlatform) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_PLATFORM_INFO_BACKEND < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    ur_result_t result =
+        pfnGetInfo(hPlatform, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urPlatformGetApiVersion
+__urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
+    ur_platform_handle_t hPlatform, ///< [in] handle of the platform
+    ur_api_version_t *pVersion      ///< [out] api version
+) {
+    auto pfnGetApiVersion = getContext()->urDdiTable.Platform.pfnGetApiVersion;
+
+    if (nullptr == pfnGetApiVersion) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hPlatform) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pVersion) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    ur_result_t result = pfnGetApiVersion(hPlatform, pVersion);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urPlatformGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
+    ur_platform_handle_t hPlatform, ///< [in] handle of the platform.
+    ur_native_handle_t *
+        phNativePlatform ///< [out] a pointer to the native handle of the platform.
+) {
+    auto pfnGetNativeHandle =
+        getContext()->urDdiTable.Platform.pfnGetNativeHandle;
+
+    if (nullptr == pfnGetNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hPlatform) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phNativePlatform) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    ur_result_t result = pfnGetNativeHandle(hPlatform, phNativePlatform);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urPlatformCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativePlatform, ///< [in][nocheck] the native handle of the platform.
+    ur_adapter_handle_t
+        hAdapter, ///< [in] handle of the adapter associated with the native backend.
+    const ur_platform_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native platform properties struct.
+    ur_platform_handle_t *
+        phPlatform ///< [out] pointer to the handle of the platform object created.
+) {
+    auto pfnCreateWithNativeHandle =
+        getContext()->urDdiTable.Platform.pfnCreateWithNativeHandle;
+
+    if (nullptr == pfnCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hAdapter) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phPlatform) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hAdapter)) {
+        getContext()->refCountContext->logInvalidReference(hAdapter);
+    }
+
+    ur_result_t result = pfnCreateWithNativeHandle(hNativePlatform, hAdapter,
+                                                   pProperties, phPlatform);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urPlatformGetBackendOption
+__urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
+    ur_platform_handle_t hPlatform, ///< [in] handle of the platform instance.
+    const char
+        *pFrontendOption, ///< [in] string containing the frontend option.
+    const char **
+        ppPlatformOption ///< [out] returns the correct platform specific compiler option based on
+                         ///< the frontend option.
+) {
+    auto pfnGetBackendOption =
+        getContext()->urDdiTable.Platform.pfnGetBackendOption;
+
+    if (nullptr == pfnGetBackendOption) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hPlatform) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pFrontendOption) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == ppPlatformOption) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    ur_result_t result =
+        pfnGetBackendOption(hPlatform, pFrontendOption, ppPlatformOption);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urDeviceGet
+__urdlllocal ur_result_t UR_APICALL urDeviceGet(
+    ur_platform_handle_t hPlatform, ///< [in] handle of the platform instance
+    ur_device_type_t DeviceType,    ///< [in] the type of the devices.
+    uint32_t
+        NumEntries, ///< [in] the number of devices to be added to phDevices.
+    ///< If phDevices is not NULL, then NumEntries should be greater than zero.
+    ///< Otherwise ::UR_RESULT_ERROR_INVALID_SIZE
+    ///< will be returned.
+    ur_device_handle_t *
+        phDevices, ///< [out][optional][range(0, NumEntries)] array of handle of devices.
+    ///< If NumEntries is less than the number of devices available, then
+    ///< platform shall only retrieve that number of devices.
+    uint32_t *pNumDevices ///< [out][optional] pointer to the number of devices.
+    ///< pNumDevices will be updated with the total number of devices available.
+) {
+    auto pfnGet = getContext()->urDdiTable.Device.pfnGet;
+
+    if (nullptr == pfnGet) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hPlatform) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NumEntries > 0 && phDevices == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_DEVICE_TYPE_VPU < DeviceType) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (NumEntries == 0 && phDevices != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    ur_result_t result =
+        pfnGet(hPlatform, DeviceType, NumEntries, phDevices, pNumDevices);
+
+    if (getContext()->enableLeakChecking && phDevices &&
+        result == UR_RESULT_SUCCESS) {
+        for (uint32_t i = 0; i < NumEntries; i++) {
+            getContext()->refCountContext->createOrIncrementRefCount(
+                phDevices[i], false);
+        }
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urDeviceGetInfo
+__urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
+    ur_device_handle_t hDevice, ///< [in] handle of the device instance
+    ur_device_info_t propName,  ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return the info
+    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    auto pfnGetInfo = getContext()->urDdiTable.Device.pfnGetInfo;
+
+    if (nullptr == pfnGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result =
+        pfnGetInfo(hDevice, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urDeviceRetain
+__urdlllocal ur_result_t UR_APICALL urDeviceRetain(
+    ur_device_handle_t
+        hDevice ///< [in][retain] handle of the device to get a reference of.
+) {
+    auto pfnRetain = getContext()->urDdiTable.Device.pfnRetain;
+
+    if (nullptr == pfnRetain) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRetain(hDevice);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->incrementRefCount(hDevice, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urDeviceRelease
+__urdlllocal ur_result_t UR_APICALL urDeviceRelease(
+    ur_device_handle_t
+        hDevice ///< [in][release] handle of the device to release.
+) {
+    auto pfnRelease = getContext()->urDdiTable.Device.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRelease(hDevice);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->decrementRefCount(hDevice, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urDevicePartition
+__urdlllocal ur_result_t UR_APICALL urDevicePartition(
+    ur_device_handle_t hDevice, ///< [in] handle of the device to partition.
+    const ur_device_partition_properties_t
+        *pProperties,    ///< [in] Device partition properties.
+    uint32_t NumDevices, ///< [in] the number of sub-devices.
+    ur_device_handle_t *
+        phSubDevices, ///< [out][optional][range(0, NumDevices)] array of handle of devices.
+    ///< If NumDevices is less than the number of sub-devices available, then
+    ///< the function shall only retrieve that number of sub-devices.
+    uint32_t *
+        pNumDevicesRet ///< [out][optional] pointer to the number of sub-devices the device can be
+    ///< partitioned into according to the partitioning property.
+) {
+    auto pfnPartition = getContext()->urDdiTable.Device.pfnPartition;
+
+    if (nullptr == pfnPartition) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pProperties) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pProperties->pProperties) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnPartition(hDevice, pProperties, NumDevices,
+                                      phSubDevices, pNumDevicesRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urDeviceSelectBinary
+__urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device to select binary for.
+    const ur_device_binary_t
+        *pBinaries,       ///< [in] the array of binaries to select from.
+    uint32_t NumBinaries, ///< [in] the number of binaries passed in ppBinaries.
+                          ///< Must greater than or equal to zero otherwise
+                          ///< ::UR_RESULT_ERROR_INVALID_VALUE is returned.
+    uint32_t *
+        pSelectedBinary ///< [out] the index of the selected binary in the input array of binaries.
+    ///< If a suitable binary was not found the function returns ::UR_RESULT_ERROR_INVALID_BINARY.
+) {
+    auto pfnSelectBinary = getContext()->urDdiTable.Device.pfnSelectBinary;
+
+    if (nullptr == pfnSelectBinary) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pBinaries) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSelectedBinary) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NumBinaries == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result =
+        pfnSelectBinary(hDevice, pBinaries, NumBinaries, pSelectedBinary);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urDeviceGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
+    ur_device_handle_t hDevice, ///< [in] handle of the device.
+    ur_native_handle_t
+        *phNativeDevice ///< [out] a pointer to the native handle of the device.
+) {
+    auto pfnGetNativeHandle =
+        getContext()->urDdiTable.Device.pfnGetNativeHandle;
+
+    if (nullptr == pfnGetNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phNativeDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnGetNativeHandle(hDevice, phNativeDevice);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urDeviceCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeDevice, ///< [in][nocheck] the native handle of the device.
+    ur_adapter_handle_t
+        hAdapter, ///< [in] handle of the adapter to which `hNativeDevice` belongs
+    const ur_device_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native device properties struct.
+    ur_device_handle_t
+        *phDevice ///< [out] pointer to the handle of the device object created.
+) {
+    auto pfnCreateWithNativeHandle =
+        getContext()->urDdiTable.Device.pfnCreateWithNativeHandle;
+
+    if (nullptr == pfnCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hAdapter) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hAdapter)) {
+        getContext()->refCountContext->logInvalidReference(hAdapter);
+    }
+
+    ur_result_t result = pfnCreateWithNativeHandle(hNativeDevice, hAdapter,
+                                                   pProperties, phDevice);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phDevice);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urDeviceGetGlobalTimestamps
+__urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
+    ur_device_handle_t hDevice, ///< [in] handle of the device instance
+    uint64_t *
+        pDeviceTimestamp, ///< [out][optional] pointer to the Device's global timestamp that
+                          ///< correlates with the Host's global timestamp value
+    uint64_t *
+        pHostTimestamp ///< [out][optional] pointer to the Host's global timestamp that
+                       ///< correlates with the Device's global timestamp value
+) {
+    auto pfnGetGlobalTimestamps =
+        getContext()->urDdiTable.Device.pfnGetGlobalTimestamps;
+
+    if (nullptr == pfnGetGlobalTimestamps) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result =
+        pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp, pHostTimestamp);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urContextCreate
+__urdlllocal ur_result_t UR_APICALL urContextCreate(
+    uint32_t DeviceCount, ///< [in] the number of devices given in phDevices
+    const ur_device_handle_t
+        *phDevices, ///< [in][range(0, DeviceCount)] array of handle of devices.
+    const ur_context_properties_t *
+        pProperties, ///< [in][optional] pointer to context creation properties.
+    ur_context_handle_t
+        *phContext ///< [out] pointer to handle of context object created
+) {
+    auto pfnCreate = getContext()->urDdiTable.Context.pfnCreate;
+
+    if (nullptr == pfnCreate) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == phDevices) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL != pProperties && UR_CONTEXT_FLAGS_MASK & pProperties->flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    ur_result_t result =
+        pfnCreate(DeviceCount, phDevices, pProperties, phContext);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phContext);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urContextRetain
+__urdlllocal ur_result_t UR_APICALL urContextRetain(
+    ur_context_handle_t
+        hContext ///< [in][retain] handle of the context to get a reference of.
+) {
+    auto pfnRetain = getContext()->urDdiTable.Context.pfnRetain;
+
+    if (nullptr == pfnRetain) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRetain(hContext);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->incrementRefCount(hContext, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urContextRelease
+__urdlllocal ur_result_t UR_APICALL urContextRelease(
+    ur_context_handle_t
+        hContext ///< [in][release] handle of the context to release.
+) {
+    auto pfnRelease = getContext()->urDdiTable.Context.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRelease(hContext);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->decrementRefCount(hContext, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urContextGetInfo
+__urdlllocal ur_result_t UR_APICALL urContextGetInfo(
+    ur_context_handle_t hContext, ///< [in] handle of the context
+    ur_context_info_t propName,   ///< [in] type of the info to retrieve
+    size_t
+        propSize, ///< [in] the number of bytes of memory pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< if propSize is not equal to or greater than the real number of bytes
+    ///< needed to return
+    ///< the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    auto pfnGetInfo = getContext()->urDdiTable.Context.pfnGetInfo;
+
+    if (nullptr == pfnGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_CONTEXT_INFO_ATOMIC_FENCE_SCOPE_CAPABILITIES < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result =
+        pfnGetInfo(hContext, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urContextGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
+    ur_context_handle_t hContext, ///< [in] handle of the context.
+    ur_native_handle_t *
+        phNativeContext ///< [out] a pointer to the native handle of the context.
+) {
+    auto pfnGetNativeHandle =
+        getContext()->urDdiTable.Context.pfnGetNativeHandle;
+
+    if (nullptr == pfnGetNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phNativeContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnGetNativeHandle(hContext, phNativeContext);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urContextCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeContext, ///< [in][nocheck] the native handle of the context.
+    ur_adapter_handle_t
+        hAdapter, ///< [in] handle of the adapter that owns the native handle
+    uint32_t numDevices, ///< [in] number of devices associated with the context
+    const ur_device_handle_t *
+        phDevices, ///< [in][optional][range(0, numDevices)] list of devices associated with
+                   ///< the context
+    const ur_context_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native context properties struct
+    ur_context_handle_t *
+        phContext ///< [out] pointer to the handle of the context object created.
+) {
+    auto pfnCreateWithNativeHandle =
+        getContext()->urDdiTable.Context.pfnCreateWithNativeHandle;
+
+    if (nullptr == pfnCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hAdapter) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hAdapter)) {
+        getContext()->refCountContext->logInvalidReference(hAdapter);
+    }
+
+    ur_result_t result =
+        pfnCreateWithNativeHandle(hNativeContext, hAdapter, numDevices,
+                                  phDevices, pProperties, phContext);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phContext);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urContextSetExtendedDeleter
+__urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
+    ur_context_handle_t hContext, ///< [in] handle of the context.
+    ur_context_extended_deleter_t
+        pfnDeleter, ///< [in] Function pointer to extended deleter.
+    void *
+        pUserData ///< [in][out][optional] pointer to data to be passed to callback.
+) {
+    auto pfnSetExtendedDeleter =
+        getContext()->urDdiTable.Context.pfnSetExtendedDeleter;
+
+    if (nullptr == pfnSetExtendedDeleter) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pfnDeleter) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urMemImageCreate
+__urdlllocal ur_result_t UR_APICALL urMemImageCreate(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_mem_flags_t flags, ///< [in] allocation and usage information flags
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
+    void *pHost,           ///< [in][optional] pointer to the buffer data
+    ur_mem_handle_t *phMem ///< [out] pointer to handle of image object created
+) {
+    auto pfnImageCreate = getContext()->urDdiTable.Mem.pfnImageCreate;
+
+    if (nullptr == pfnImageCreate) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pImageFormat) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pImageDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_MEM_FLAGS_MASK & flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (pImageDesc && UR_MEM_TYPE_IMAGE1D_ARRAY < pImageDesc->type) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+
+        if (pImageDesc && pImageDesc->numMipLevel != 0) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+
+        if (pImageDesc && pImageDesc->numSamples != 0) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+
+        if (pImageDesc && pImageDesc->rowPitch != 0 && pHost == nullptr) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+
+        if (pImageDesc && pImageDesc->slicePitch != 0 && pHost == nullptr) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+
+        if (pHost == NULL &&
+            (flags & (UR_MEM_FLAG_USE_HOST_POINTER |
+                      UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER)) != 0) {
+            return UR_RESULT_ERROR_INVALID_HOST_PTR;
+        }
+
+        if (pHost != NULL &&
+            (flags & (UR_MEM_FLAG_USE_HOST_POINTER |
+                      UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER)) == 0) {
+            return UR_RESULT_ERROR_INVALID_HOST_PTR;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result =
+        pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost, phMem);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phMem);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urMemBufferCreate
+__urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_mem_flags_t flags, ///< [in] allocation and usage information flags
+    size_t size, ///< [in] size in bytes of the memory object to be allocated
+    const ur_buffer_properties_t
+        *pProperties, ///< [in][optional] pointer to buffer creation properties
+    ur_mem_handle_t
+        *phBuffer ///< [out] pointer to handle of the memory buffer created
+) {
+    auto pfnBufferCreate = getContext()->urDdiTable.Mem.pfnBufferCreate;
+
+    if (nullptr == pfnBufferCreate) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_MEM_FLAGS_MASK & flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_BUFFER_SIZE;
+        }
+
+        if (pProperties == NULL &&
+            (flags & (UR_MEM_FLAG_USE_HOST_POINTER |
+                      UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER)) != 0) {
+            return UR_RESULT_ERROR_INVALID_HOST_PTR;
+        }
+
+        if (pProperties != NULL && pProperties->pHost == NULL &&
+            (flags & (UR_MEM_FLAG_USE_HOST_POINTER |
+                      UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER)) != 0) {
+            return UR_RESULT_ERROR_INVALID_HOST_PTR;
+        }
+
+        if (pProperties != NULL && pProperties->pHost != NULL &&
+            (flags & (UR_MEM_FLAG_USE_HOST_POINTER |
+                      UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER)) == 0) {
+            return UR_RESULT_ERROR_INVALID_HOST_PTR;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result =
+        pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phBuffer);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urMemRetain
+__urdlllocal ur_result_t UR_APICALL urMemRetain(
+    ur_mem_handle_t
+        hMem ///< [in][retain] handle of the memory object to get access
+) {
+    auto pfnRetain = getContext()->urDdiTable.Mem.pfnRetain;
+
+    if (nullptr == pfnRetain) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRetain(hMem);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->incrementRefCount(hMem, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urMemRelease
+__urdlllocal ur_result_t UR_APICALL urMemRelease(
+    ur_mem_handle_t
+        hMem ///< [in][release] handle of the memory object to release
+) {
+    auto pfnRelease = getContext()->urDdiTable.Mem.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRelease(hMem);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->decrementRefCount(hMem, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urMemBufferPartition
+__urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
+    ur_mem_handle_t
+        hBuffer,          ///< [in] handle of the buffer object to allocate from
+    ur_mem_flags_t flags, ///< [in] allocation and usage information flags
+    ur_buffer_create_type_t bufferCreateType, ///< [in] buffer creation type
+    const ur_buffer_region_t
+        *pRegion, ///< [in] pointer to buffer create region information
+    ur_mem_handle_t
+        *phMem ///< [out] pointer to the handle of sub buffer created
+) {
+    auto pfnBufferPartition = getContext()->urDdiTable.Mem.pfnBufferPartition;
+
+    if (nullptr == pfnBufferPartition) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pRegion) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_MEM_FLAGS_MASK & flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (UR_BUFFER_CREATE_TYPE_REGION < bufferCreateType) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (pRegion && pRegion->size == 0) {
+            return UR_RESULT_ERROR_INVALID_BUFFER_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result =
+        pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion, phMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urMemGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
+    ur_mem_handle_t hMem, ///< [in] handle of the mem.
+    ur_device_handle_t
+        hDevice, ///< [in][optional] handle of the device that the native handle will be
+                 ///< resident on.
+    ur_native_handle_t
+        *phNativeMem ///< [out] a pointer to the native handle of the mem.
+) {
+    auto pfnGetNativeHandle = getContext()->urDdiTable.Mem.pfnGetNativeHandle;
+
+    if (nullptr == pfnGetNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phNativeMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hMem)) {
+        getContext()->refCountContext->logInvalidReference(hMem);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnGetNativeHandle(hMem, hDevice, phNativeMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urMemBufferCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeMem, ///< [in][nocheck] the native handle to the memory.
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    const ur_mem_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native memory creation properties.
+    ur_mem_handle_t
+        *phMem ///< [out] pointer to handle of buffer memory object created.
+) {
+    auto pfnBufferCreateWithNativeHandle =
+        getContext()->urDdiTable.Mem.pfnBufferCreateWithNativeHandle;
+
+    if (nullptr == pfnBufferCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnBufferCreateWithNativeHandle(hNativeMem, hContext,
+                                                         pProperties, phMem);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phMem);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urMemImageCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeMem, ///< [in][nocheck] the native handle to the memory.
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification.
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description.
+    const ur_mem_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native memory creation properties.
+    ur_mem_handle_t
+        *phMem ///< [out] pointer to handle of image memory object created.
+) {
+    auto pfnImageCreateWithNativeHandle =
+        getContext()->urDdiTable.Mem.pfnImageCreateWithNativeHandle;
+
+    if (nullptr == pfnImageCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pImageFormat) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pImageDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnImageCreateWithNativeHandle(
+        hNativeMem, hContext, pImageFormat, pImageDesc, pProperties, phMem);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phMem);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urMemGetInfo
+__urdlllocal ur_result_t UR_APICALL urMemGetInfo(
+    ur_mem_handle_t
+        hMemory,            ///< [in] handle to the memory object being queried.
+    ur_mem_info_t propName, ///< [in] type of the info to retrieve.
+    size_t
+        propSize, ///< [in] the number of bytes of memory pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is less than the real number of bytes needed to return
+    ///< the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    auto pfnGetInfo = getContext()->urDdiTable.Mem.pfnGetInfo;
+
+    if (nullptr == pfnGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hMemory) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_MEM_INFO_CONTEXT < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hMemory)) {
+        getContext()->refCountContext->logInvalidReference(hMemory);
+    }
+
+    ur_result_t result =
+        pfnGetInfo(hMemory, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urMemImageGetInfo
+__urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
+    ur_mem_handle_t hMemory, ///< [in] handle to the image object being queried.
+    ur_image_info_t propName, ///< [in] type of image info to retrieve.
+    size_t
+        propSize, ///< [in] the number of bytes of memory pointer to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is less than the real number of bytes needed to return
+    ///< the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    auto pfnImageGetInfo = getContext()->urDdiTable.Mem.pfnImageGetInfo;
+
+    if (nullptr == pfnImageGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hMemory) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_IMAGE_INFO_DEPTH < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hMemory)) {
+        getContext()->refCountContext->logInvalidReference(hMemory);
+    }
+
+    ur_result_t result =
+        pfnImageGetInfo(hMemory, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urSamplerCreate
+__urdlllocal ur_result_t UR_APICALL urSamplerCreate(
+    ur_context_handle_t hContext,   ///< [in] handle of the context object
+    const ur_sampler_desc_t *pDesc, ///< [in] pointer to the sampler description
+    ur_sampler_handle_t
+        *phSampler ///< [out] pointer to handle of sampler object created
+) {
+    auto pfnCreate = getContext()->urDdiTable.Sampler.pfnCreate;
+
+    if (nullptr == pfnCreate) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phSampler) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_SAMPLER_ADDRESSING_MODE_MIRRORED_REPEAT <
+            pDesc->addressingMode) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (UR_SAMPLER_FILTER_MODE_LINEAR < pDesc->filterMode) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnCreate(hContext, pDesc, phSampler);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phSampler);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urSamplerRetain
+__urdlllocal ur_result_t UR_APICALL urSamplerRetain(
+    ur_sampler_handle_t
+        hSampler ///< [in][retain] handle of the sampler object to get access
+) {
+    auto pfnRetain = getContext()->urDdiTable.Sampler.pfnRetain;
+
+    if (nullptr == pfnRetain) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hSampler) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRetain(hSampler);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->incrementRefCount(hSampler, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urSamplerRelease
+__urdlllocal ur_result_t UR_APICALL urSamplerRelease(
+    ur_sampler_handle_t
+        hSampler ///< [in][release] handle of the sampler object to release
+) {
+    auto pfnRelease = getContext()->urDdiTable.Sampler.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hSampler) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRelease(hSampler);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->decrementRefCount(hSampler, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urSamplerGetInfo
+__urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
+    ur_sampler_handle_t hSampler, ///< [in] handle of the sampler object
+    ur_sampler_info_t propName, ///< [in] name of the sampler property to query
+    size_t
+        propSize, ///< [in] size in bytes of the sampler property value provided
+    void *
+        pPropValue, ///< [out][typename(propName, propSize)][optional] value of the sampler
+                    ///< property
+    size_t *
+        pPropSizeRet ///< [out][optional] size in bytes returned in sampler property value
+) {
+    auto pfnGetInfo = getContext()->urDdiTable.Sampler.pfnGetInfo;
+
+    if (nullptr == pfnGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hSampler) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_SAMPLER_INFO_FILTER_MODE < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hSampler)) {
+        getContext()->refCountContext->logInvalidReference(hSampler);
+    }
+
+    ur_result_t result =
+        pfnGetInfo(hSampler, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urSamplerGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
+    ur_sampler_handle_t hSampler, ///< [in] handle of the sampler.
+    ur_native_handle_t *
+        phNativeSampler ///< [out] a pointer to the native handle of the sampler.
+) {
+    auto pfnGetNativeHandle =
+        getContext()->urDdiTable.Sampler.pfnGetNativeHandle;
+
+    if (nullptr == pfnGetNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hSampler) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phNativeSampler) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hSampler)) {
+        getContext()->refCountContext->logInvalidReference(hSampler);
+    }
+
+    ur_result_t result = pfnGetNativeHandle(hSampler, phNativeSampler);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urSamplerCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeSampler, ///< [in][nocheck] the native handle of the sampler.
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    const ur_sampler_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native sampler properties struct.
+    ur_sampler_handle_t *
+        phSampler ///< [out] pointer to the handle of the sampler object created.
+) {
+    auto pfnCreateWithNativeHandle =
+        getContext()->urDdiTable.Sampler.pfnCreateWithNativeHandle;
+
+    if (nullptr == pfnCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phSampler) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnCreateWithNativeHandle(hNativeSampler, hContext,
+                                                   pProperties, phSampler);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phSampler);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMHostAlloc
+__urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    const ur_usm_desc_t
+        *pUSMDesc, ///< [in][optional] USM memory allocation descriptor
+    ur_usm_pool_handle_t
+        pool, ///< [in][optional] Pointer to a pool created using urUSMPoolCreate
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    void **ppMem ///< [out] pointer to USM host memory object
+) {
+    auto pfnHostAlloc = getContext()->urDdiTable.USM.pfnHostAlloc;
+
+    if (nullptr == pfnHostAlloc) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL != pUSMDesc && UR_USM_ADVICE_FLAGS_MASK & pUSMDesc->hints) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (pUSMDesc && pUSMDesc->align != 0 &&
+            ((pUSMDesc->align & (pUSMDesc->align - 1)) != 0)) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_USM_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(pool)) {
+        getContext()->refCountContext->logInvalidReference(pool);
+    }
+
+    ur_result_t result = pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMDeviceAlloc
+__urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_usm_desc_t
+        *pUSMDesc, ///< [in][optional] USM memory allocation descriptor
+    ur_usm_pool_handle_t
+        pool, ///< [in][optional] Pointer to a pool created using urUSMPoolCreate
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    void **ppMem ///< [out] pointer to USM device memory object
+) {
+    auto pfnDeviceAlloc = getContext()->urDdiTable.USM.pfnDeviceAlloc;
+
+    if (nullptr == pfnDeviceAlloc) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL != pUSMDesc && UR_USM_ADVICE_FLAGS_MASK & pUSMDesc->hints) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (pUSMDesc && pUSMDesc->align != 0 &&
+            ((pUSMDesc->align & (pUSMDesc->align - 1)) != 0)) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_USM_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(pool)) {
+        getContext()->refCountContext->logInvalidReference(pool);
+    }
+
+    ur_result_t result =
+        pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMSharedAlloc
+__urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_usm_desc_t *
+        pUSMDesc, ///< [in][optional] Pointer to USM memory allocation descriptor.
+    ur_usm_pool_handle_t
+        pool, ///< [in][optional] Pointer to a pool created using urUSMPoolCreate
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    void **ppMem ///< [out] pointer to USM shared memory object
+) {
+    auto pfnSharedAlloc = getContext()->urDdiTable.USM.pfnSharedAlloc;
+
+    if (nullptr == pfnSharedAlloc) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL != pUSMDesc && UR_USM_ADVICE_FLAGS_MASK & pUSMDesc->hints) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (pUSMDesc && pUSMDesc->align != 0 &&
+            ((pUSMDesc->align & (pUSMDesc->align - 1)) != 0)) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_USM_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(pool)) {
+        getContext()->refCountContext->logInvalidReference(pool);
+    }
+
+    ur_result_t result =
+        pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMFree
+__urdlllocal ur_result_t UR_APICALL urUSMFree(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem                    ///< [in] pointer to USM memory object
+) {
+    auto pfnFree = getContext()->urDdiTable.USM.pfnFree;
+
+    if (nullptr == pfnFree) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnFree(hContext, pMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMGetMemAllocInfo
+__urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    const void *pMem,             ///< [in] pointer to USM memory object
+    ur_usm_alloc_info_t
+        propName, ///< [in] the name of the USM allocation property to query
+    size_t
+        propSize, ///< [in] size in bytes of the USM allocation property value
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the USM
+                    ///< allocation property
+    size_t *
+        pPropSizeRet ///< [out][optional] bytes returned in USM allocation property
+) {
+    auto pfnGetMemAllocInfo = getContext()->urDdiTable.USM.pfnGetMemAllocInfo;
+
+    if (nullptr == pfnGetMemAllocInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_USM_ALLOC_INFO_POOL < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnGetMemAllocInfo(hContext, pMem, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMPoolCreate
+__urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_desc_t *
+        pPoolDesc, ///< [in] pointer to USM pool descriptor. Can be chained with
+                   ///< ::ur_usm_pool_limits_desc_t
+    ur_usm_pool_handle_t *ppPool ///< [out] pointer to USM memory pool
+) {
+    auto pfnPoolCreate = getContext()->urDdiTable.USM.pfnPoolCreate;
+
+    if (nullptr == pfnPoolCreate) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pPoolDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == ppPool) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_USM_POOL_FLAGS_MASK & pPoolDesc->flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnPoolCreate(hContext, pPoolDesc, ppPool);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*ppPool);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMPoolRetain
+__urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
+    ur_usm_pool_handle_t pPool ///< [in][retain] pointer to USM memory pool
+) {
+    auto pfnPoolRetain = getContext()->urDdiTable.USM.pfnPoolRetain;
+
+    if (nullptr == pfnPoolRetain) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == pPool) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnPoolRetain(pPool);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->incrementRefCount(pPool, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMPoolRelease
+__urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
+    ur_usm_pool_handle_t pPool ///< [in][release] pointer to USM memory pool
+) {
+    auto pfnPoolRelease = getContext()->urDdiTable.USM.pfnPoolRelease;
+
+    if (nullptr == pfnPoolRelease) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == pPool) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnPoolRelease(pPool);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->decrementRefCount(pPool, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMPoolGetInfo
+__urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
+    ur_usm_pool_handle_t hPool,  ///< [in] handle of the USM memory pool
+    ur_usm_pool_info_t propName, ///< [in] name of the pool property to query
+    size_t propSize, ///< [in] size in bytes of the pool property value provided
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the pool
+                    ///< property
+    size_t *
+        pPropSizeRet ///< [out][optional] size in bytes returned in pool property value
+) {
+    auto pfnPoolGetInfo = getContext()->urDdiTable.USM.pfnPoolGetInfo;
+
+    if (nullptr == pfnPoolGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hPool) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_USM_POOL_INFO_FRAGMENTATION < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hPool)) {
+        getContext()->refCountContext->logInvalidReference(hPool);
+    }
+
+    ur_result_t result =
+        pfnPoolGetInfo(hPool, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urVirtualMemGranularityGetInfo
+__urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    ur_device_handle_t
+        hDevice, ///< [in][optional] is the device to get the granularity from, if the
+    ///< device is null then the granularity is suitable for all devices in context.
+    ur_virtual_mem_granularity_info_t
+        propName, ///< [in] type of the info to query.
+    size_t
+        propSize, ///< [in] size in bytes of the memory pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+    ///< the info. If propSize is less than the real number of bytes needed to
+    ///< return the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is
+    ///< returned and pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName."
+) {
+    auto pfnGranularityGetInfo =
+        getContext()->urDdiTable.VirtualMem.pfnGranularityGetInfo;
+
+    if (nullptr == pfnGranularityGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_VIRTUAL_MEM_GRANULARITY_INFO_RECOMMENDED < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnGranularityGetInfo(
+        hContext, hDevice, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urVirtualMemReserve
+__urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    const void *
+        pStart, ///< [in][optional] pointer to the start of the virtual memory region to
+    ///< reserve, specifying a null value causes the implementation to select a
+    ///< start address.
+    size_t
+        size, ///< [in] size in bytes of the virtual address range to reserve.
+    void **
+        ppStart ///< [out] pointer to the returned address at the start of reserved virtual
+                ///< memory range.
+) {
+    auto pfnReserve = getContext()->urDdiTable.VirtualMem.pfnReserve;
+
+    if (nullptr == pfnReserve) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppStart) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnReserve(hContext, pStart, size, ppStart);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urVirtualMemFree
+__urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    const void *
+        pStart, ///< [in] pointer to the start of the virtual memory range to free.
+    size_t size ///< [in] size in bytes of the virtual memory range to free.
+) {
+    auto pfnFree = getContext()->urDdiTable.VirtualMem.pfnFree;
+
+    if (nullptr == pfnFree) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pStart) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnFree(hContext, pStart, size);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urVirtualMemMap
+__urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
+    ur_context_handle_t hContext, ///< [in] handle to the context object.
+    const void
+        *pStart, ///< [in] pointer to the start of the virtual memory range.
+    size_t size, ///< [in] size in bytes of the virtual memory range to map.
+    ur_physical_mem_handle_t
+        hPhysicalMem, ///< [in] handle of the physical memory to map pStart to.
+    size_t
+        offset, ///< [in] offset in bytes into the physical memory to map pStart to.
+    ur_virtual_mem_access_flags_t
+        flags ///< [in] access flags for the physical memory mapping.
+) {
+    auto pfnMap = getContext()->urDdiTable.VirtualMem.pfnMap;
+
+    if (nullptr == pfnMap) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hPhysicalMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pStart) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_VIRTUAL_MEM_ACCESS_FLAGS_MASK & flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hPhysicalMem)) {
+        getContext()->refCountContext->logInvalidReference(hPhysicalMem);
+    }
+
+    ur_result_t result =
+        pfnMap(hContext, pStart, size, hPhysicalMem, offset, flags);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urVirtualMemUnmap
+__urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
+    ur_context_handle_t hContext, ///< [in] handle to the context object.
+    const void *
+        pStart, ///< [in] pointer to the start of the mapped virtual memory range
+    size_t size ///< [in] size in bytes of the virtual memory range.
+) {
+    auto pfnUnmap = getContext()->urDdiTable.VirtualMem.pfnUnmap;
+
+    if (nullptr == pfnUnmap) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pStart) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnUnmap(hContext, pStart, size);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urVirtualMemSetAccess
+__urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
+    ur_context_handle_t hContext, ///< [in] handle to the context object.
+    const void
+        *pStart, ///< [in] pointer to the start of the virtual memory range.
+    size_t size, ///< [in] size in bytes of the virtual memory range.
+    ur_virtual_mem_access_flags_t
+        flags ///< [in] access flags to set for the mapped virtual memory range.
+) {
+    auto pfnSetAccess = getContext()->urDdiTable.VirtualMem.pfnSetAccess;
+
+    if (nullptr == pfnSetAccess) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pStart) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_VIRTUAL_MEM_ACCESS_FLAGS_MASK & flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnSetAccess(hContext, pStart, size, flags);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urVirtualMemGetInfo
+__urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
+    ur_context_handle_t hContext, ///< [in] handle to the context object.
+    const void
+        *pStart, ///< [in] pointer to the start of the virtual memory range.
+    size_t size, ///< [in] size in bytes of the virtual memory range.
+    ur_virtual_mem_info_t propName, ///< [in] type of the info to query.
+    size_t
+        propSize, ///< [in] size in bytes of the memory pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+    ///< the info. If propSize is less than the real number of bytes needed to
+    ///< return the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is
+    ///< returned and pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName."
+) {
+    auto pfnGetInfo = getContext()->urDdiTable.VirtualMem.pfnGetInfo;
+
+    if (nullptr == pfnGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pStart) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_VIRTUAL_MEM_INFO_ACCESS_MODE < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnGetInfo(hContext, pStart, size, propName, propSize,
+                                    pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urPhysicalMemCreate
+__urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object.
+    size_t
+        size, ///< [in] size in bytes of physical memory to allocate, must be a multiple
+              ///< of ::UR_VIRTUAL_MEM_GRANULARITY_INFO_MINIMUM.
+    const ur_physical_mem_properties_t *
+        pProperties, ///< [in][optional] pointer to physical memory creation properties.
+    ur_physical_mem_handle_t *
+        phPhysicalMem ///< [out] pointer to handle of physical memory object created.
+) {
+    auto pfnCreate = getContext()->urDdiTable.PhysicalMem.pfnCreate;
+
+    if (nullptr == pfnCreate) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phPhysicalMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL != pProperties &&
+            UR_PHYSICAL_MEM_FLAGS_MASK & pProperties->flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result =
+        pfnCreate(hContext, hDevice, size, pProperties, phPhysicalMem);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phPhysicalMem);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urPhysicalMemRetain
+__urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
+    ur_physical_mem_handle_t
+        hPhysicalMem ///< [in][retain] handle of the physical memory object to retain.
+) {
+    auto pfnRetain = getContext()->urDdiTable.PhysicalMem.pfnRetain;
+
+    if (nullptr == pfnRetain) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hPhysicalMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRetain(hPhysicalMem);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->incrementRefCount(hPhysicalMem, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urPhysicalMemRelease
+__urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
+    ur_physical_mem_handle_t
+        hPhysicalMem ///< [in][release] handle of the physical memory object to release.
+) {
+    auto pfnRelease = getContext()->urDdiTable.PhysicalMem.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hPhysicalMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRelease(hPhysicalMem);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->decrementRefCount(hPhysicalMem, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramCreateWithIL
+__urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance
+    const void *pIL,              ///< [in] pointer to IL binary.
+    size_t length,                ///< [in] length of `pIL` in bytes.
+    const ur_program_properties_t *
+        pProperties, ///< [in][optional] pointer to program creation properties.
+    ur_program_handle_t
+        *phProgram ///< [out] pointer to handle of program object created.
+) {
+    auto pfnCreateWithIL = getContext()->urDdiTable.Program.pfnCreateWithIL;
+
+    if (nullptr == pfnCreateWithIL) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pIL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL != pProperties && pProperties->count > 0 &&
+            NULL == pProperties->pMetadatas) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL != pProperties && NULL != pProperties->pMetadatas &&
+            pProperties->count == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (length == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result =
+        pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phProgram);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramCreateWithBinary
+__urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance
+    ur_device_handle_t
+        hDevice,            ///< [in] handle to device associated with binary.
+    size_t size,            ///< [in] size in bytes.
+    const uint8_t *pBinary, ///< [in] pointer to binary.
+    const ur_program_properties_t *
+        pProperties, ///< [in][optional] pointer to program creation properties.
+    ur_program_handle_t
+        *phProgram ///< [out] pointer to handle of Program object created.
+) {
+    auto pfnCreateWithBinary =
+        getContext()->urDdiTable.Program.pfnCreateWithBinary;
+
+    if (nullptr == pfnCreateWithBinary) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pBinary) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL != pProperties && pProperties->count > 0 &&
+            NULL == pProperties->pMetadatas) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL != pProperties && NULL != pProperties->pMetadatas &&
+            pProperties->count == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnCreateWithBinary(hContext, hDevice, size, pBinary,
+                                             pProperties, phProgram);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phProgram);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramBuild
+__urdlllocal ur_result_t UR_APICALL urProgramBuild(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance.
+    ur_program_handle_t hProgram, ///< [in] Handle of the program to build.
+    const char *
+        pOptions ///< [in][optional] pointer to build options null-terminated string.
+) {
+    auto pfnBuild = getContext()->urDdiTable.Program.pfnBuild;
+
+    if (nullptr == pfnBuild) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result = pfnBuild(hContext, hProgram, pOptions);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramCompile
+__urdlllocal ur_result_t UR_APICALL urProgramCompile(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance.
+    ur_program_handle_t
+        hProgram, ///< [in][out] handle of the program to compile.
+    const char *
+        pOptions ///< [in][optional] pointer to build options null-terminated string.
+) {
+    auto pfnCompile = getContext()->urDdiTable.Program.pfnCompile;
+
+    if (nullptr == pfnCompile) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result = pfnCompile(hContext, hProgram, pOptions);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramLink
+__urdlllocal ur_result_t UR_APICALL urProgramLink(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance.
+    uint32_t count, ///< [in] number of program handles in `phPrograms`.
+    const ur_program_handle_t *
+        phPrograms, ///< [in][range(0, count)] pointer to array of program handles.
+    const char *
+        pOptions, ///< [in][optional] pointer to linker options null-terminated string.
+    ur_program_handle_t
+        *phProgram ///< [out] pointer to handle of program object created.
+) {
+    if (nullptr != phProgram) {
+        *phProgram = nullptr;
+    }
+    auto pfnLink = getContext()->urDdiTable.Program.pfnLink;
+
+    if (nullptr == pfnLink) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phPrograms) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (count == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result =
+        pfnLink(hContext, count, phPrograms, pOptions, phProgram);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramRetain
+__urdlllocal ur_result_t UR_APICALL urProgramRetain(
+    ur_program_handle_t
+        hProgram ///< [in][retain] handle for the Program to retain
+) {
+    auto pfnRetain = getContext()->urDdiTable.Program.pfnRetain;
+
+    if (nullptr == pfnRetain) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRetain(hProgram);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->incrementRefCount(hProgram, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramRelease
+__urdlllocal ur_result_t UR_APICALL urProgramRelease(
+    ur_program_handle_t
+        hProgram ///< [in][release] handle for the Program to release
+) {
+    auto pfnRelease = getContext()->urDdiTable.Program.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRelease(hProgram);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->decrementRefCount(hProgram, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramGetFunctionPointer
+__urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device to retrieve pointer for.
+    ur_program_handle_t
+        hProgram, ///< [in] handle of the program to search for function in.
+    ///< The program must already be built to the specified device, or
+    ///< otherwise ::UR_RESULT_ERROR_INVALID_PROGRAM_EXECUTABLE is returned.
+    const char *
+        pFunctionName, ///< [in] A null-terminates string denoting the mangled function name.
+    void **
+        ppFunctionPointer ///< [out] Returns the pointer to the function if it is found in the program.
+) {
+    auto pfnGetFunctionPointer =
+        getContext()->urDdiTable.Program.pfnGetFunctionPointer;
+
+    if (nullptr == pfnGetFunctionPointer) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pFunctionName) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == ppFunctionPointer) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result = pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
+                                               ppFunctionPointer);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramGetGlobalVariablePointer
+__urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device to retrieve the pointer for.
+    ur_program_handle_t
+        hProgram, ///< [in] handle of the program where the global variable is.
+    const char *
+        pGlobalVariableName, ///< [in] mangled name of the global variable to retrieve the pointer for.
+    size_t *
+        pGlobalVariableSizeRet, ///< [out][optional] Returns the size of the global variable if it is found
+                                ///< in the program.
+    void **
+        ppGlobalVariablePointerRet ///< [out] Returns the pointer to the global variable if it is found in the program.
+) {
+    auto pfnGetGlobalVariablePointer =
+        getContext()->urDdiTable.Program.pfnGetGlobalVariablePointer;
+
+    if (nullptr == pfnGetGlobalVariablePointer) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pGlobalVariableName) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == ppGlobalVariablePointerRet) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result = pfnGetGlobalVariablePointer(
+        hDevice, hProgram, pGlobalVariableName, pGlobalVariableSizeRet,
+        ppGlobalVariablePointerRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramGetInfo
+__urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
+    ur_program_handle_t hProgram, ///< [in] handle of the Program object
+    ur_program_info_t propName, ///< [in] name of the Program property to query
+    size_t propSize,            ///< [in] the size of the Program property.
+    void *
+        pPropValue, ///< [in,out][optional][typename(propName, propSize)] array of bytes of
+                    ///< holding the program info property.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return
+    ///< the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    auto pfnGetInfo = getContext()->urDdiTable.Program.pfnGetInfo;
+
+    if (nullptr == pfnGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_PROGRAM_INFO_KERNEL_NAMES < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result =
+        pfnGetInfo(hProgram, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramGetBuildInfo
+__urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
+    ur_program_handle_t hProgram, ///< [in] handle of the Program object
+    ur_device_handle_t hDevice,   ///< [in] handle of the Device object
+    ur_program_build_info_t
+        propName,    ///< [in] name of the Program build info to query
+    size_t propSize, ///< [in] size of the Program build info property.
+    void *
+        pPropValue, ///< [in,out][optional][typename(propName, propSize)] value of the Program
+                    ///< build property.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return the info then the ::UR_RESULT_ERROR_INVALID_SIZE
+    ///< error is returned and pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
+                     ///< queried by propName.
+) {
+    auto pfnGetBuildInfo = getContext()->urDdiTable.Program.pfnGetBuildInfo;
+
+    if (nullptr == pfnGetBuildInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_PROGRAM_BUILD_INFO_BINARY_TYPE < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnGetBuildInfo(hProgram, hDevice, propName, propSize,
+                                         pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramSetSpecializationConstants
+__urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
+    ur_program_handle_t hProgram, ///< [in] handle of the Program object
+    uint32_t count, ///< [in] the number of elements in the pSpecConstants array
+    const ur_specialization_constant_info_t *
+        pSpecConstants ///< [in][range(0, count)] array of specialization constant value
+                       ///< descriptions
+) {
+    auto pfnSetSpecializationConstants =
+        getContext()->urDdiTable.Program.pfnSetSpecializationConstants;
+
+    if (nullptr == pfnSetSpecializationConstants) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pSpecConstants) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (count == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result =
+        pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
+    ur_program_handle_t hProgram, ///< [in] handle of the program.
+    ur_native_handle_t *
+        phNativeProgram ///< [out] a pointer to the native handle of the program.
+) {
+    auto pfnGetNativeHandle =
+        getContext()->urDdiTable.Program.pfnGetNativeHandle;
+
+    if (nullptr == pfnGetNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phNativeProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result = pfnGetNativeHandle(hProgram, phNativeProgram);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeProgram, ///< [in][nocheck] the native handle of the program.
+    ur_context_handle_t hContext, ///< [in] handle of the context instance
+    const ur_program_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native program properties struct.
+    ur_program_handle_t *
+        phProgram ///< [out] pointer to the handle of the program object created.
+) {
+    auto pfnCreateWithNativeHandle =
+        getContext()->urDdiTable.Program.pfnCreateWithNativeHandle;
+
+    if (nullptr == pfnCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnCreateWithNativeHandle(hNativeProgram, hContext,
+                                                   pProperties, phProgram);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phProgram);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelCreate
+__urdlllocal ur_result_t UR_APICALL urKernelCreate(
+    ur_program_handle_t hProgram, ///< [in] handle of the program instance
+    const char *pKernelName,      ///< [in] pointer to null-terminated string.
+    ur_kernel_handle_t
+        *phKernel ///< [out] pointer to handle of kernel object created.
+) {
+    auto pfnCreate = getContext()->urDdiTable.Kernel.pfnCreate;
+
+    if (nullptr == pfnCreate) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pKernelName) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result = pfnCreate(hProgram, pKernelName, phKernel);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phKernel);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelSetArgValue
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t argIndex, ///< [in] argument index in range [0, num args - 1]
+    size_t argSize,    ///< [in] size of argument type
+    const ur_kernel_arg_value_properties_t
+        *pProperties, ///< [in][optional] pointer to value properties.
+    const void
+        *pArgValue ///< [in] argument value represented as matching arg type.
+    ///< The data pointed to will be copied and therefore can be reused on return.
+) {
+    auto pfnSetArgValue = getContext()->urDdiTable.Kernel.pfnSetArgValue;
+
+    if (nullptr == pfnSetArgValue) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pArgValue) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result =
+        pfnSetArgValue(hKernel, argIndex, argSize, pProperties, pArgValue);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelSetArgLocal
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t argIndex, ///< [in] argument index in range [0, num args - 1]
+    size_t
+        argSize, ///< [in] size of the local buffer to be allocated by the runtime
+    const ur_kernel_arg_local_properties_t
+        *pProperties ///< [in][optional] pointer to local buffer properties.
+) {
+    auto pfnSetArgLocal = getContext()->urDdiTable.Kernel.pfnSetArgLocal;
+
+    if (nullptr == pfnSetArgLocal) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result =
+        pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelGetInfo
+__urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the Kernel object
+    ur_kernel_info_t propName,  ///< [in] name of the Kernel property to query
+    size_t propSize,            ///< [in] the size of the Kernel property value.
+    void *
+        pPropValue, ///< [in,out][optional][typename(propName, propSize)] array of bytes
+                    ///< holding the kernel info property.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return
+    ///< the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
+                     ///< queried by propName.
+) {
+    auto pfnGetInfo = getContext()->urDdiTable.Kernel.pfnGetInfo;
+
+    if (nullptr == pfnGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_KERNEL_INFO_NUM_REGS < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result =
+        pfnGetInfo(hKernel, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelGetGroupInfo
+__urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the Kernel object
+    ur_device_handle_t hDevice, ///< [in] handle of the Device object
+    ur_kernel_group_info_t
+        propName,    ///< [in] name of the work Group property to query
+    size_t propSize, ///< [in] size of the Kernel Work Group property value
+    void *
+        pPropValue, ///< [in,out][optional][typename(propName, propSize)] value of the Kernel
+                    ///< Work Group property.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
+                     ///< queried by propName.
+) {
+    auto pfnGetGroupInfo = getContext()->urDdiTable.Kernel.pfnGetGroupInfo;
+
+    if (nullptr == pfnGetGroupInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_KERNEL_GROUP_INFO_COMPILE_MAX_LINEAR_WORK_GROUP_SIZE <
+            propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnGetGroupInfo(hKernel, hDevice, propName, propSize,
+                                         pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelGetSubGroupInfo
+__urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the Kernel object
+    ur_device_handle_t hDevice, ///< [in] handle of the Device object
+    ur_kernel_sub_group_info_t
+        propName,    ///< [in] name of the SubGroup property to query
+    size_t propSize, ///< [in] size of the Kernel SubGroup property value
+    void *
+        pPropValue, ///< [in,out][optional][typename(propName, propSize)] value of the Kernel
+                    ///< SubGroup property.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
+                     ///< queried by propName.
+) {
+    auto pfnGetSubGroupInfo =
+        getContext()->urDdiTable.Kernel.pfnGetSubGroupInfo;
+
+    if (nullptr == pfnGetSubGroupInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_KERNEL_SUB_GROUP_INFO_SUB_GROUP_SIZE_INTEL < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnGetSubGroupInfo(hKernel, hDevice, propName,
+                                            propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelRetain
+__urdlllocal ur_result_t UR_APICALL urKernelRetain(
+    ur_kernel_handle_t hKernel ///< [in][retain] handle for the Kernel to retain
+) {
+    auto pfnRetain = getContext()->urDdiTable.Kernel.pfnRetain;
+
+    if (nullptr == pfnRetain) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRetain(hKernel);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->incrementRefCount(hKernel, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelRelease
+__urdlllocal ur_result_t UR_APICALL urKernelRelease(
+    ur_kernel_handle_t
+        hKernel ///< [in][release] handle for the Kernel to release
+) {
+    auto pfnRelease = getContext()->urDdiTable.Kernel.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRelease(hKernel);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->decrementRefCount(hKernel, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelSetArgPointer
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t argIndex, ///< [in] argument index in range [0, num args - 1]
+    const ur_kernel_arg_pointer_properties_t
+        *pProperties, ///< [in][optional] pointer to USM pointer properties.
+    const void *
+        pArgValue ///< [in][optional] Pointer obtained by USM allocation or virtual memory
+    ///< mapping operation. If null then argument value is considered null.
+) {
+    auto pfnSetArgPointer = getContext()->urDdiTable.Kernel.pfnSetArgPointer;
+
+    if (nullptr == pfnSetArgPointer) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result =
+        pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelSetExecInfo
+__urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
+    ur_kernel_handle_t hKernel,     ///< [in] handle of the kernel object
+    ur_kernel_exec_info_t propName, ///< [in] name of the execution attribute
+    size_t propSize,                ///< [in] size in byte the attribute value
+    const ur_kernel_exec_info_properties_t
+        *pProperties, ///< [in][optional] pointer to execution info properties.
+    const void *
+        pPropValue ///< [in][typename(propName, propSize)] pointer to memory location holding
+                   ///< the property value.
+) {
+    auto pfnSetExecInfo = getContext()->urDdiTable.Kernel.pfnSetExecInfo;
+
+    if (nullptr == pfnSetExecInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pPropValue) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_KERNEL_EXEC_INFO_CACHE_CONFIG < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result =
+        pfnSetExecInfo(hKernel, propName, propSize, pProperties, pPropValue);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelSetArgSampler
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t argIndex, ///< [in] argument index in range [0, num args - 1]
+    const ur_kernel_arg_sampler_properties_t
+        *pProperties, ///< [in][optional] pointer to sampler properties.
+    ur_sampler_handle_t hArgValue ///< [in] handle of Sampler object.
+) {
+    auto pfnSetArgSampler = getContext()->urDdiTable.Kernel.pfnSetArgSampler;
+
+    if (nullptr == pfnSetArgSampler) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hArgValue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hArgValue)) {
+        getContext()->refCountContext->logInvalidReference(hArgValue);
+    }
+
+    ur_result_t result =
+        pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelSetArgMemObj
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t argIndex, ///< [in] argument index in range [0, num args - 1]
+    const ur_kernel_arg_mem_obj_properties_t
+        *pProperties, ///< [in][optional] pointer to Memory object properties.
+    ur_mem_handle_t hArgValue ///< [in][optional] handle of Memory object.
+) {
+    auto pfnSetArgMemObj = getContext()->urDdiTable.Kernel.pfnSetArgMemObj;
+
+    if (nullptr == pfnSetArgMemObj) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL != pProperties &&
+            UR_MEM_FLAGS_MASK & pProperties->memoryAccess) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hArgValue)) {
+        getContext()->refCountContext->logInvalidReference(hArgValue);
+    }
+
+    ur_result_t result =
+        pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelSetSpecializationConstants
+__urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t count, ///< [in] the number of elements in the pSpecConstants array
+    const ur_specialization_constant_info_t *
+        pSpecConstants ///< [in] array of specialization constant value descriptions
+) {
+    auto pfnSetSpecializationConstants =
+        getContext()->urDdiTable.Kernel.pfnSetSpecializationConstants;
+
+    if (nullptr == pfnSetSpecializationConstants) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pSpecConstants) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (count == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result =
+        pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel.
+    ur_native_handle_t
+        *phNativeKernel ///< [out] a pointer to the native handle of the kernel.
+) {
+    auto pfnGetNativeHandle =
+        getContext()->urDdiTable.Kernel.pfnGetNativeHandle;
+
+    if (nullptr == pfnGetNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phNativeKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result = pfnGetNativeHandle(hKernel, phNativeKernel);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeKernel, ///< [in][nocheck] the native handle of the kernel.
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_program_handle_t
+        hProgram, ///< [in][optional] handle of the program associated with the kernel
+    const ur_kernel_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native kernel properties struct
+    ur_kernel_handle_t
+        *phKernel ///< [out] pointer to the handle of the kernel object created.
+) {
+    auto pfnCreateWithNativeHandle =
+        getContext()->urDdiTable.Kernel.pfnCreateWithNativeHandle;
+
+    if (nullptr == pfnCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result = pfnCreateWithNativeHandle(
+        hNativeKernel, hContext, hProgram, pProperties, phKernel);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phKernel);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelGetSuggestedLocalWorkSize
+__urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    uint32_t
+        numWorkDim, ///< [in] number of dimensions, from 1 to 3, to specify the global
+                    ///< and work-group work-items
+    const size_t *
+        pGlobalWorkOffset, ///< [in] pointer to an array of numWorkDim unsigned values that specify
+    ///< the offset used to calculate the global ID of a work-item
+    const size_t *
+        pGlobalWorkSize, ///< [in] pointer to an array of numWorkDim unsigned values that specify
+    ///< the number of global work-items in workDim that will execute the
+    ///< kernel function
+    size_t *
+        pSuggestedLocalWorkSize ///< [out] pointer to an array of numWorkDim unsigned values that specify
+    ///< suggested local work size that will contain the result of the query
+) {
+    auto pfnGetSuggestedLocalWorkSize =
+        getContext()->urDdiTable.Kernel.pfnGetSuggestedLocalWorkSize;
+
+    if (nullptr == pfnGetSuggestedLocalWorkSize) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pGlobalWorkOffset) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pGlobalWorkSize) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSuggestedLocalWorkSize) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnGetSuggestedLocalWorkSize(
+        hKernel, hQueue, numWorkDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pSuggestedLocalWorkSize);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urQueueGetInfo
+__urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_queue_info_t propName, ///< [in] name of the queue property to query
+    size_t
+        propSize, ///< [in] size in bytes of the queue property value provided
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the queue
+                    ///< property
+    size_t *
+        pPropSizeRet ///< [out][optional] size in bytes returned in queue property value
+) {
+    auto pfnGetInfo = getContext()->urDdiTable.Queue.pfnGetInfo;
+
+    if (nullptr == pfnGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_QUEUE_INFO_CREATED_EVENT_COUNT < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result =
+        pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urQueueCreate
+__urdlllocal ur_result_t UR_APICALL urQueueCreate(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_queue_properties_t
+        *pProperties, ///< [in][optional] pointer to queue creation properties.
+    ur_queue_handle_t
+        *phQueue ///< [out] pointer to handle of queue object created
+) {
+    auto pfnCreate = getContext()->urDdiTable.Queue.pfnCreate;
+
+    if (nullptr == pfnCreate) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL != pProperties && UR_QUEUE_FLAGS_MASK & pProperties->flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (pProperties != NULL &&
+            pProperties->flags & UR_QUEUE_FLAG_PRIORITY_HIGH &&
+            pProperties->flags & UR_QUEUE_FLAG_PRIORITY_LOW) {
+            return UR_RESULT_ERROR_INVALID_QUEUE_PROPERTIES;
+        }
+
+        if (pProperties != NULL &&
+            pProperties->flags & UR_QUEUE_FLAG_SUBMISSION_BATCHED &&
+            pProperties->flags & UR_QUEUE_FLAG_SUBMISSION_IMMEDIATE) {
+            return UR_RESULT_ERROR_INVALID_QUEUE_PROPERTIES;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnCreate(hContext, hDevice, pProperties, phQueue);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phQueue);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urQueueRetain
+__urdlllocal ur_result_t UR_APICALL urQueueRetain(
+    ur_queue_handle_t
+        hQueue ///< [in][retain] handle of the queue object to get access
+) {
+    auto pfnRetain = getContext()->urDdiTable.Queue.pfnRetain;
+
+    if (nullptr == pfnRetain) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRetain(hQueue);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->incrementRefCount(hQueue, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urQueueRelease
+__urdlllocal ur_result_t UR_APICALL urQueueRelease(
+    ur_queue_handle_t
+        hQueue ///< [in][release] handle of the queue object to release
+) {
+    auto pfnRelease = getContext()->urDdiTable.Queue.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRelease(hQueue);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->decrementRefCount(hQueue, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urQueueGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue.
+    ur_queue_native_desc_t
+        *pDesc, ///< [in][optional] pointer to native descriptor
+    ur_native_handle_t
+        *phNativeQueue ///< [out] a pointer to the native handle of the queue.
+) {
+    auto pfnGetNativeHandle = getContext()->urDdiTable.Queue.pfnGetNativeHandle;
+
+    if (nullptr == pfnGetNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phNativeQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnGetNativeHandle(hQueue, pDesc, phNativeQueue);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urQueueCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeQueue, ///< [in][nocheck] the native handle of the queue.
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice, ///< [in][optional] handle of the device object
+    const ur_queue_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native queue properties struct
+    ur_queue_handle_t
+        *phQueue ///< [out] pointer to the handle of the queue object created.
+) {
+    auto pfnCreateWithNativeHandle =
+        getContext()->urDdiTable.Queue.pfnCreateWithNativeHandle;
+
+    if (nullptr == pfnCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnCreateWithNativeHandle(
+        hNativeQueue, hContext, hDevice, pProperties, phQueue);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phQueue);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urQueueFinish
+__urdlllocal ur_result_t UR_APICALL urQueueFinish(
+    ur_queue_handle_t hQueue ///< [in] handle of the queue to be finished.
+) {
+    auto pfnFinish = getContext()->urDdiTable.Queue.pfnFinish;
+
+    if (nullptr == pfnFinish) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnFinish(hQueue);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urQueueFlush
+__urdlllocal ur_result_t UR_APICALL urQueueFlush(
+    ur_queue_handle_t hQueue ///< [in] handle of the queue to be flushed.
+) {
+    auto pfnFlush = getContext()->urDdiTable.Queue.pfnFlush;
+
+    if (nullptr == pfnFlush) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnFlush(hQueue);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEventGetInfo
+__urdlllocal ur_result_t UR_APICALL urEventGetInfo(
+    ur_event_handle_t hEvent, ///< [in] handle of the event object
+    ur_event_info_t propName, ///< [in] the name of the event property to query
+    size_t propSize, ///< [in] size in bytes of the event property value
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the event
+                    ///< property
+    size_t *pPropSizeRet ///< [out][optional] bytes returned in event property
+) {
+    auto pfnGetInfo = getContext()->urDdiTable.Event.pfnGetInfo;
+
+    if (nullptr == pfnGetInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_EVENT_INFO_REFERENCE_COUNT < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hEvent)) {
+        getContext()->refCountContext->logInvalidReference(hEvent);
+    }
+
+    ur_result_t result =
+        pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEventGetProfilingInfo
+__urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
+    ur_event_handle_t hEvent, ///< [in] handle of the event object
+    ur_profiling_info_t
+        propName,    ///< [in] the name of the profiling property to query
+    size_t propSize, ///< [in] size in bytes of the profiling property value
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the profiling
+                    ///< property
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes returned in
+                     ///< propValue
+) {
+    auto pfnGetProfilingInfo =
+        getContext()->urDdiTable.Event.pfnGetProfilingInfo;
+
+    if (nullptr == pfnGetProfilingInfo) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_PROFILING_INFO_COMMAND_COMPLETE < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (pPropValue && propSize == 0) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hEvent)) {
+        getContext()->refCountContext->logInvalidReference(hEvent);
+    }
+
+    ur_result_t result = pfnGetProfilingInfo(hEvent, propName, propSize,
+                                             pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEventWait
+__urdlllocal ur_result_t UR_APICALL urEventWait(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+                        ///< completion
+) {
+    auto pfnWait = getContext()->urDdiTable.Event.pfnWait;
+
+    if (nullptr == pfnWait) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == phEventWaitList) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (numEvents == 0) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+    }
+
+    ur_result_t result = pfnWait(numEvents, phEventWaitList);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEventRetain
+__urdlllocal ur_result_t UR_APICALL urEventRetain(
+    ur_event_handle_t hEvent ///< [in][retain] handle of the event object
+) {
+    auto pfnRetain = getContext()->urDdiTable.Event.pfnRetain;
+
+    if (nullptr == pfnRetain) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRetain(hEvent);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->incrementRefCount(hEvent, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEventRelease
+__urdlllocal ur_result_t UR_APICALL urEventRelease(
+    ur_event_handle_t hEvent ///< [in][release] handle of the event object
+) {
+    auto pfnRelease = getContext()->urDdiTable.Event.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRelease(hEvent);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->decrementRefCount(hEvent, false);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEventGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
+    ur_event_handle_t hEvent, ///< [in] handle of the event.
+    ur_native_handle_t
+        *phNativeEvent ///< [out] a pointer to the native handle of the event.
+) {
+    auto pfnGetNativeHandle = getContext()->urDdiTable.Event.pfnGetNativeHandle;
+
+    if (nullptr == pfnGetNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phNativeEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hEvent)) {
+        getContext()->refCountContext->logInvalidReference(hEvent);
+    }
+
+    ur_result_t result = pfnGetNativeHandle(hEvent, phNativeEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEventCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeEvent, ///< [in][nocheck] the native handle of the event.
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    const ur_event_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native event properties struct
+    ur_event_handle_t
+        *phEvent ///< [out] pointer to the handle of the event object created.
+) {
+    auto pfnCreateWithNativeHandle =
+        getContext()->urDdiTable.Event.pfnCreateWithNativeHandle;
+
+    if (nullptr == pfnCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result =
+        pfnCreateWithNativeHandle(hNativeEvent, hContext, pProperties, phEvent);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phEvent);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEventSetCallback
+__urdlllocal ur_result_t UR_APICALL urEventSetCallback(
+    ur_event_handle_t hEvent,       ///< [in] handle of the event object
+    ur_execution_info_t execStatus, ///< [in] execution status of the event
+    ur_event_callback_t pfnNotify,  ///< [in] execution status of the event
+    void *
+        pUserData ///< [in][out][optional] pointer to data to be passed to callback.
+) {
+    auto pfnSetCallback = getContext()->urDdiTable.Event.pfnSetCallback;
+
+    if (nullptr == pfnSetCallback) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pfnNotify) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_EXECUTION_INFO_QUEUED < execStatus) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (execStatus == UR_EXECUTION_INFO_QUEUED) {
+            return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hEvent)) {
+        getContext()->refCountContext->logInvalidReference(hEvent);
+    }
+
+    ur_result_t result =
+        pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueKernelLaunch
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t
+        workDim, ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                 ///< work-group work-items
+    const size_t *
+        pGlobalWorkOffset, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< offset used to calculate the global ID of a work-item
+    const size_t *
+        pGlobalWorkSize, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< number of global work-items in workDim that will execute the kernel
+    ///< function
+    const size_t *
+        pLocalWorkSize, ///< [in][optional] pointer to an array of workDim unsigned values that
+    ///< specify the number of local work-items forming a work-group that will
+    ///< execute the kernel function.
+    ///< If nullptr, the runtime implementation will choose the work-group
+    ///< size.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnKernelLaunch = getContext()->urDdiTable.Enqueue.pfnKernelLaunch;
+
+    if (nullptr == pfnKernelLaunch) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pGlobalWorkOffset) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pGlobalWorkSize) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result = pfnKernelLaunch(
+        hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueEventsWait
+__urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnEventsWait = getContext()->urDdiTable.Enqueue.pfnEventsWait;
+
+    if (nullptr == pfnEventsWait) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result =
+        pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueEventsWaitWithBarrier
+__urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnEventsWaitWithBarrier =
+        getContext()->urDdiTable.Enqueue.pfnEventsWaitWithBarrier;
+
+    if (nullptr == pfnEventsWaitWithBarrier) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemBufferRead
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
+    size_t offset,     ///< [in] offset in bytes in the buffer object
+    size_t size,       ///< [in] size in bytes of data being read
+    void *pDst, ///< [in] pointer to host memory where data is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferRead = getContext()->urDdiTable.Enqueue.pfnMemBufferRead;
+
+    if (nullptr == pfnMemBufferRead) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hBuffer, offset, size);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result =
+        pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size, pDst,
+                         numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemBufferWrite
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    bool
+        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
+    size_t offset,     ///< [in] offset in bytes in the buffer object
+    size_t size,       ///< [in] size in bytes of data being written
+    const void
+        *pSrc, ///< [in] pointer to host memory where data is to be written from
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferWrite = getContext()->urDdiTable.Enqueue.pfnMemBufferWrite;
+
+    if (nullptr == pfnMemBufferWrite) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hBuffer, offset, size);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result =
+        pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size, pSrc,
+                          numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemBufferReadRect
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(bufferOrigin, region)] handle of the buffer object
+    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t bufferOrigin, ///< [in] 3D offset in the buffer
+    ur_rect_offset_t hostOrigin,   ///< [in] 3D offset in the host region
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth
+    size_t
+        bufferRowPitch, ///< [in] length of each row in bytes in the buffer object
+    size_t
+        bufferSlicePitch, ///< [in] length of each 2D slice in bytes in the buffer object being read
+    size_t
+        hostRowPitch, ///< [in] length of each row in bytes in the host memory region pointed by
+                      ///< dst
+    size_t
+        hostSlicePitch, ///< [in] length of each 2D slice in bytes in the host memory region
+                        ///< pointed by dst
+    void *pDst, ///< [in] pointer to host memory where data is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferReadRect =
+        getContext()->urDdiTable.Enqueue.pfnMemBufferReadRect;
+
+    if (nullptr == pfnMemBufferReadRect) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (region.width == 0 || region.height == 0 || region.width == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (bufferRowPitch != 0 && bufferRowPitch < region.width) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (hostRowPitch != 0 && hostRowPitch < region.width) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (bufferSlicePitch != 0 &&
+            bufferSlicePitch <
+                region.height *
+                    (bufferRowPitch != 0 ? bufferRowPitch : region.width)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (bufferSlicePitch != 0 &&
+            bufferSlicePitch %
+                    (bufferRowPitch != 0 ? bufferRowPitch : region.width) !=
+                0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (hostSlicePitch != 0 &&
+            hostSlicePitch <
+                region.height *
+                    (hostRowPitch != 0 ? hostRowPitch : region.width)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (hostSlicePitch != 0 &&
+            hostSlicePitch %
+                    (hostRowPitch != 0 ? hostRowPitch : region.width) !=
+                0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hBuffer, bufferOrigin, region);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result = pfnMemBufferReadRect(
+        hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemBufferWriteRect
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(bufferOrigin, region)] handle of the buffer object
+    bool
+        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t bufferOrigin, ///< [in] 3D offset in the buffer
+    ur_rect_offset_t hostOrigin,   ///< [in] 3D offset in the host region
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth
+    size_t
+        bufferRowPitch, ///< [in] length of each row in bytes in the buffer object
+    size_t
+        bufferSlicePitch, ///< [in] length of each 2D slice in bytes in the buffer object being
+                          ///< written
+    size_t
+        hostRowPitch, ///< [in] length of each row in bytes in the host memory region pointed by
+                      ///< src
+    size_t
+        hostSlicePitch, ///< [in] length of each 2D slice in bytes in the host memory region
+                        ///< pointed by src
+    void
+        *pSrc, ///< [in] pointer to host memory where data is to be written from
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] points to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferWriteRect =
+        getContext()->urDdiTable.Enqueue.pfnMemBufferWriteRect;
+
+    if (nullptr == pfnMemBufferWriteRect) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (region.width == 0 || region.height == 0 || region.width == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (bufferRowPitch != 0 && bufferRowPitch < region.width) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (hostRowPitch != 0 && hostRowPitch < region.width) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (bufferSlicePitch != 0 &&
+            bufferSlicePitch <
+                region.height *
+                    (bufferRowPitch != 0 ? bufferRowPitch : region.width)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (bufferSlicePitch != 0 &&
+            bufferSlicePitch %
+                    (bufferRowPitch != 0 ? bufferRowPitch : region.width) !=
+                0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (hostSlicePitch != 0 &&
+            hostSlicePitch <
+                region.height *
+                    (hostRowPitch != 0 ? hostRowPitch : region.width)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (hostSlicePitch != 0 &&
+            hostSlicePitch %
+                    (hostRowPitch != 0 ? hostRowPitch : region.width) !=
+                0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hBuffer, bufferOrigin, region);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result = pfnMemBufferWriteRect(
+        hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemBufferCopy
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBufferSrc, ///< [in][bounds(srcOffset, size)] handle of the src buffer object
+    ur_mem_handle_t
+        hBufferDst, ///< [in][bounds(dstOffset, size)] handle of the dest buffer object
+    size_t srcOffset, ///< [in] offset into hBufferSrc to begin copying from
+    size_t dstOffset, ///< [in] offset info hBufferDst to begin copying into
+    size_t size,      ///< [in] size in bytes of data being copied
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferCopy = getContext()->urDdiTable.Enqueue.pfnMemBufferCopy;
+
+    if (nullptr == pfnMemBufferCopy) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBufferSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBufferDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hBufferSrc, srcOffset, size);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hBufferDst, dstOffset, size);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBufferSrc)) {
+        getContext()->refCountContext->logInvalidReference(hBufferSrc);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBufferDst)) {
+        getContext()->refCountContext->logInvalidReference(hBufferDst);
+    }
+
+    ur_result_t result =
+        pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset, dstOffset,
+                         size, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemBufferCopyRect
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBufferSrc, ///< [in][bounds(srcOrigin, region)] handle of the source buffer object
+    ur_mem_handle_t
+        hBufferDst, ///< [in][bounds(dstOrigin, region)] handle of the dest buffer object
+    ur_rect_offset_t srcOrigin, ///< [in] 3D offset in the source buffer
+    ur_rect_offset_t dstOrigin, ///< [in] 3D offset in the destination buffer
+    ur_rect_region_t
+        region, ///< [in] source 3D rectangular region descriptor: width, height, depth
+    size_t
+        srcRowPitch, ///< [in] length of each row in bytes in the source buffer object
+    size_t
+        srcSlicePitch, ///< [in] length of each 2D slice in bytes in the source buffer object
+    size_t
+        dstRowPitch, ///< [in] length of each row in bytes in the destination buffer object
+    size_t
+        dstSlicePitch, ///< [in] length of each 2D slice in bytes in the destination buffer object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferCopyRect =
+        getContext()->urDdiTable.Enqueue.pfnMemBufferCopyRect;
+
+    if (nullptr == pfnMemBufferCopyRect) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBufferSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBufferDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (region.width == 0 || region.height == 0 || region.depth == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (srcRowPitch != 0 && srcRowPitch < region.width) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (dstRowPitch != 0 && dstRowPitch < region.width) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (srcSlicePitch != 0 &&
+            srcSlicePitch < region.height * (srcRowPitch != 0 ? srcRowPitch
+                                                              : region.width)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (srcSlicePitch != 0 &&
+            srcSlicePitch % (srcRowPitch != 0 ? srcRowPitch : region.width) !=
+                0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (dstSlicePitch != 0 &&
+            dstSlicePitch < region.height * (dstRowPitch != 0 ? dstRowPitch
+                                                              : region.width)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (dstSlicePitch != 0 &&
+            dstSlicePitch % (dstRowPitch != 0 ? dstRowPitch : region.width) !=
+                0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hBufferSrc, srcOrigin, region);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hBufferDst, dstOrigin, region);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBufferSrc)) {
+        getContext()->refCountContext->logInvalidReference(hBufferSrc);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBufferDst)) {
+        getContext()->refCountContext->logInvalidReference(hBufferDst);
+    }
+
+    ur_result_t result = pfnMemBufferCopyRect(
+        hQueue, hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemBufferFill
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    const void *pPattern, ///< [in] pointer to the fill pattern
+    size_t patternSize,   ///< [in] size in bytes of the pattern
+    size_t offset,        ///< [in] offset into the buffer
+    size_t size, ///< [in] fill size in bytes, must be a multiple of patternSize
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferFill = getContext()->urDdiTable.Enqueue.pfnMemBufferFill;
+
+    if (nullptr == pfnMemBufferFill) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pPattern) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (patternSize == 0 || size == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (patternSize > size) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if ((patternSize & (patternSize - 1)) != 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (size % patternSize != 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (offset % patternSize != 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hBuffer, offset, size);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result =
+        pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset, size,
+                         numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemImageRead
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hImage, ///< [in][bounds(origin, region)] handle of the image object
+    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t
+        origin, ///< [in] defines the (x,y,z) offset in pixels in the 1D, 2D, or 3D image
+    ur_rect_region_t
+        region, ///< [in] defines the (width, height, depth) in pixels of the 1D, 2D, or 3D
+                ///< image
+    size_t rowPitch,   ///< [in] length of each row in bytes
+    size_t slicePitch, ///< [in] length of each 2D slice of the 3D image
+    void *pDst, ///< [in] pointer to host memory where image is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemImageRead = getContext()->urDdiTable.Enqueue.pfnMemImageRead;
+
+    if (nullptr == pfnMemImageRead) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hImage) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (region.width == 0 || region.height == 0 || region.depth == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = boundsImage(hImage, origin, region);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hImage)) {
+        getContext()->refCountContext->logInvalidReference(hImage);
+    }
+
+    ur_result_t result = pfnMemImageRead(
+        hQueue, hImage, blockingRead, origin, region, rowPitch, slicePitch,
+        pDst, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemImageWrite
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hImage, ///< [in][bounds(origin, region)] handle of the image object
+    bool
+        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t
+        origin, ///< [in] defines the (x,y,z) offset in pixels in the 1D, 2D, or 3D image
+    ur_rect_region_t
+        region, ///< [in] defines the (width, height, depth) in pixels of the 1D, 2D, or 3D
+                ///< image
+    size_t rowPitch,   ///< [in] length of each row in bytes
+    size_t slicePitch, ///< [in] length of each 2D slice of the 3D image
+    void *pSrc, ///< [in] pointer to host memory where image is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemImageWrite = getContext()->urDdiTable.Enqueue.pfnMemImageWrite;
+
+    if (nullptr == pfnMemImageWrite) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hImage) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (region.width == 0 || region.height == 0 || region.depth == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = boundsImage(hImage, origin, region);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hImage)) {
+        getContext()->refCountContext->logInvalidReference(hImage);
+    }
+
+    ur_result_t result = pfnMemImageWrite(
+        hQueue, hImage, blockingWrite, origin, region, rowPitch, slicePitch,
+        pSrc, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemImageCopy
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hImageSrc, ///< [in][bounds(srcOrigin, region)] handle of the src image object
+    ur_mem_handle_t
+        hImageDst, ///< [in][bounds(dstOrigin, region)] handle of the dest image object
+    ur_rect_offset_t
+        srcOrigin, ///< [in] defines the (x,y,z) offset in pixels in the source 1D, 2D, or 3D
+                   ///< image
+    ur_rect_offset_t
+        dstOrigin, ///< [in] defines the (x,y,z) offset in pixels in the destination 1D, 2D,
+                   ///< or 3D image
+    ur_rect_region_t
+        region, ///< [in] defines the (width, height, depth) in pixels of the 1D, 2D, or 3D
+                ///< image
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemImageCopy = getContext()->urDdiTable.Enqueue.pfnMemImageCopy;
+
+    if (nullptr == pfnMemImageCopy) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hImageSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hImageDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (region.width == 0 || region.height == 0 || region.depth == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = boundsImage(hImageSrc, srcOrigin, region);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = boundsImage(hImageDst, dstOrigin, region);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hImageSrc)) {
+        getContext()->refCountContext->logInvalidReference(hImageSrc);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hImageDst)) {
+        getContext()->refCountContext->logInvalidReference(hImageDst);
+    }
+
+    ur_result_t result =
+        pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin, dstOrigin,
+                        region, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemBufferMap
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    bool blockingMap, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_map_flags_t mapFlags, ///< [in] flags for read, write, readwrite mapping
+    size_t offset, ///< [in] offset in bytes of the buffer region being mapped
+    size_t size,   ///< [in] size in bytes of the buffer region being mapped
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent, ///< [out][optional] return an event object that identifies this particular
+                 ///< command instance.
+    void **ppRetMap ///< [out] return mapped pointer.  TODO: move it before
+                    ///< numEventsInWaitList?
+) {
+    auto pfnMemBufferMap = getContext()->urDdiTable.Enqueue.pfnMemBufferMap;
+
+    if (nullptr == pfnMemBufferMap) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppRetMap) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_MAP_FLAGS_MASK & mapFlags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hBuffer, offset, size);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result = pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags,
+                                         offset, size, numEventsInWaitList,
+                                         phEventWaitList, phEvent, ppRetMap);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemUnmap
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hMem,         ///< [in] handle of the memory (buffer or image) object
+    void *pMappedPtr, ///< [in] mapped host address
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemUnmap = getContext()->urDdiTable.Enqueue.pfnMemUnmap;
+
+    if (nullptr == pfnMemUnmap) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMappedPtr) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hMem)) {
+        getContext()->refCountContext->logInvalidReference(hMem);
+    }
+
+    ur_result_t result =
+        pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
+                    phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueUSMFill
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    void *pMem, ///< [in][bounds(0, size)] pointer to USM memory object
+    size_t
+        patternSize, ///< [in] the size in bytes of the pattern. Must be a power of 2 and less
+                     ///< than or equal to width.
+    const void
+        *pPattern, ///< [in] pointer with the bytes of the pattern to set.
+    size_t
+        size, ///< [in] size in bytes to be set. Must be a multiple of patternSize.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnUSMFill = getContext()->urDdiTable.Enqueue.pfnUSMFill;
+
+    if (nullptr == pfnUSMFill) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pPattern) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (patternSize == 0 || size == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (patternSize > size) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (size % patternSize != 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hQueue, pMem, 0, size);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result =
+        pfnUSMFill(hQueue, pMem, patternSize, pPattern, size,
+                   numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueUSMMemcpy
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    bool blocking,            ///< [in] blocking or non-blocking copy
+    void *
+        pDst, ///< [in][bounds(0, size)] pointer to the destination USM memory object
+    const void *
+        pSrc, ///< [in][bounds(0, size)] pointer to the source USM memory object
+    size_t size,                  ///< [in] size in bytes to be copied
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnUSMMemcpy = getContext()->urDdiTable.Enqueue.pfnUSMMemcpy;
+
+    if (nullptr == pfnUSMMemcpy) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hQueue, pDst, 0, size);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hQueue, pSrc, 0, size);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result =
+        pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size, numEventsInWaitList,
+                     phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueUSMPrefetch
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void
+        *pMem,   ///< [in][bounds(0, size)] pointer to the USM memory object
+    size_t size, ///< [in] size in bytes to be fetched
+    ur_usm_migration_flags_t flags, ///< [in] USM prefetch flags
+    uint32_t numEventsInWaitList,   ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnUSMPrefetch = getContext()->urDdiTable.Enqueue.pfnUSMPrefetch;
+
+    if (nullptr == pfnUSMPrefetch) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_USM_MIGRATION_FLAGS_MASK & flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hQueue, pMem, 0, size);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result =
+        pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
+                       phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueUSMAdvise
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void
+        *pMem,   ///< [in][bounds(0, size)] pointer to the USM memory object
+    size_t size, ///< [in] size in bytes to be advised
+    ur_usm_advice_flags_t advice, ///< [in] USM memory advice
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnUSMAdvise = getContext()->urDdiTable.Enqueue.pfnUSMAdvise;
+
+    if (nullptr == pfnUSMAdvise) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_USM_ADVICE_FLAGS_MASK & advice) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hQueue, pMem, 0, size);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueUSMFill2D
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    void *
+        pMem, ///< [in][bounds(0, pitch * height)] pointer to memory to be filled.
+    size_t
+        pitch, ///< [in] the total width of the destination memory including padding.
+    size_t
+        patternSize, ///< [in] the size in bytes of the pattern. Must be a power of 2 and less
+                     ///< than or equal to width.
+    const void
+        *pPattern, ///< [in] pointer with the bytes of the pattern to set.
+    size_t
+        width, ///< [in] the width in bytes of each row to fill. Must be a multiple of
+               ///< patternSize.
+    size_t height,                ///< [in] the height of the columns to fill.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnUSMFill2D = getContext()->urDdiTable.Enqueue.pfnUSMFill2D;
+
+    if (nullptr == pfnUSMFill2D) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pPattern) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pitch == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (pitch < width) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (patternSize == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (patternSize > width * height) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (patternSize != 0 && ((patternSize & (patternSize - 1)) != 0)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (width == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (height == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (width * height % patternSize != 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hQueue, pMem, 0, pitch * height);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result =
+        pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width, height,
+                     numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueUSMMemcpy2D
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    bool blocking, ///< [in] indicates if this operation should block the host.
+    void *
+        pDst, ///< [in][bounds(0, dstPitch * height)] pointer to memory where data will
+              ///< be copied.
+    size_t
+        dstPitch, ///< [in] the total width of the source memory including padding.
+    const void *
+        pSrc, ///< [in][bounds(0, srcPitch * height)] pointer to memory to be copied.
+    size_t
+        srcPitch, ///< [in] the total width of the source memory including padding.
+    size_t width,  ///< [in] the width in bytes of each row to be copied.
+    size_t height, ///< [in] the height of columns to be copied.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnUSMMemcpy2D = getContext()->urDdiTable.Enqueue.pfnUSMMemcpy2D;
+
+    if (nullptr == pfnUSMMemcpy2D) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (srcPitch == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (dstPitch == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (srcPitch < width) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (dstPitch < width) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (height == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hQueue, pDst, 0, dstPitch * height);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (getContext()->enableBoundsChecking) {
+            if (auto boundsError = bounds(hQueue, pSrc, 0, srcPitch * height);
+                boundsError != UR_RESULT_SUCCESS) {
+                return boundsError;
+            }
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result =
+        pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch, width,
+                       height, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueDeviceGlobalVariableWrite
+__urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    ur_program_handle_t
+        hProgram, ///< [in] handle of the program containing the device global variable.
+    const char
+        *name, ///< [in] the unique identifier for the device global variable.
+    bool blockingWrite, ///< [in] indicates if this operation should block.
+    size_t count,       ///< [in] the number of bytes to copy.
+    size_t
+        offset, ///< [in] the byte offset into the device global variable to start copying.
+    const void *pSrc, ///< [in] pointer to where the data must be copied from.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnDeviceGlobalVariableWrite =
+        getContext()->urDdiTable.Enqueue.pfnDeviceGlobalVariableWrite;
+
+    if (nullptr == pfnDeviceGlobalVariableWrite) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == name) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result = pfnDeviceGlobalVariableWrite(
+        hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueDeviceGlobalVariableRead
+__urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    ur_program_handle_t
+        hProgram, ///< [in] handle of the program containing the device global variable.
+    const char
+        *name, ///< [in] the unique identifier for the device global variable.
+    bool blockingRead, ///< [in] indicates if this operation should block.
+    size_t count,      ///< [in] the number of bytes to copy.
+    size_t
+        offset, ///< [in] the byte offset into the device global variable to start copying.
+    void *pDst, ///< [in] pointer to where the data must be copied to.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnDeviceGlobalVariableRead =
+        getContext()->urDdiTable.Enqueue.pfnDeviceGlobalVariableRead;
+
+    if (nullptr == pfnDeviceGlobalVariableRead) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == name) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result = pfnDeviceGlobalVariableRead(
+        hQueue, hProgram, name, blockingRead, count, offset, pDst,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueReadHostPipe
+__urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
+    ur_queue_handle_t
+        hQueue, ///< [in] a valid host command-queue in which the read command
+    ///< will be queued. hQueue and hProgram must be created with the same
+    ///< UR context.
+    ur_program_handle_t
+        hProgram, ///< [in] a program object with a successfully built executable.
+    const char *
+        pipe_symbol, ///< [in] the name of the program scope pipe global variable.
+    bool
+        blocking, ///< [in] indicate if the read operation is blocking or non-blocking.
+    void *
+        pDst, ///< [in] a pointer to buffer in host memory that will hold resulting data
+              ///< from pipe.
+    size_t size, ///< [in] size of the memory region to read, in bytes.
+    uint32_t numEventsInWaitList, ///< [in] number of events in the wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the host pipe read.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] returns an event object that identifies this read
+                ///< command
+    ///< and can be used to query or queue a wait for this command to complete.
+) {
+    auto pfnReadHostPipe = getContext()->urDdiTable.Enqueue.pfnReadHostPipe;
+
+    if (nullptr == pfnReadHostPipe) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pipe_symbol) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result =
+        pfnReadHostPipe(hQueue, hProgram, pipe_symbol, blocking, pDst, size,
+                        numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueWriteHostPipe
+__urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
+    ur_queue_handle_t
+        hQueue, ///< [in] a valid host command-queue in which the write command
+    ///< will be queued. hQueue and hProgram must be created with the same
+    ///< UR context.
+    ur_program_handle_t
+        hProgram, ///< [in] a program object with a successfully built executable.
+    const char *
+        pipe_symbol, ///< [in] the name of the program scope pipe global variable.
+    bool
+        blocking, ///< [in] indicate if the read and write operations are blocking or
+                  ///< non-blocking.
+    void *
+        pSrc, ///< [in] a pointer to buffer in host memory that holds data to be written
+              ///< to the host pipe.
+    size_t size, ///< [in] size of the memory region to read or write, in bytes.
+    uint32_t numEventsInWaitList, ///< [in] number of events in the wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the host pipe write.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] returns an event object that identifies this write command
+    ///< and can be used to query or queue a wait for this command to complete.
+) {
+    auto pfnWriteHostPipe = getContext()->urDdiTable.Enqueue.pfnWriteHostPipe;
+
+    if (nullptr == pfnWriteHostPipe) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pipe_symbol) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result =
+        pfnWriteHostPipe(hQueue, hProgram, pipe_symbol, blocking, pSrc, size,
+                         numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMPitchedAllocExp
+__urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_usm_desc_t *
+        pUSMDesc, ///< [in][optional] Pointer to USM memory allocation descriptor.
+    ur_usm_pool_handle_t
+        pool, ///< [in][optional] Pointer to a pool created using urUSMPoolCreate
+    size_t
+        widthInBytes, ///< [in] width in bytes of the USM memory object to be allocated
+    size_t height, ///< [in] height of the USM memory object to be allocated
+    size_t
+        elementSizeBytes, ///< [in] size in bytes of an element in the allocation
+    void **ppMem,         ///< [out] pointer to USM shared memory object
+    size_t *pResultPitch  ///< [out] pitch of the allocation
+) {
+    auto pfnPitchedAllocExp =
+        getContext()->urDdiTable.USMExp.pfnPitchedAllocExp;
+
+    if (nullptr == pfnPitchedAllocExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pResultPitch) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL != pUSMDesc && UR_USM_ADVICE_FLAGS_MASK & pUSMDesc->hints) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (pUSMDesc && pUSMDesc->align != 0 &&
+            ((pUSMDesc->align & (pUSMDesc->align - 1)) != 0)) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+
+        if (widthInBytes == 0) {
+            return UR_RESULT_ERROR_INVALID_USM_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(pool)) {
+        getContext()->refCountContext->logInvalidReference(pool);
+    }
+
+    ur_result_t result =
+        pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool, widthInBytes,
+                           height, elementSizeBytes, ppMem, pResultPitch);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesUnsampledImageHandleDestroyExp
+__urdlllocal ur_result_t UR_APICALL
+urBindlessImagesUnsampledImageHandleDestroyExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_native_handle_t
+        hImage ///< [in][release] pointer to handle of image object to destroy
+) {
+    auto pfnUnsampledImageHandleDestroyExp =
+        getContext()
+            ->urDdiTable.BindlessImagesExp.pfnUnsampledImageHandleDestroyExp;
+
+    if (nullptr == pfnUnsampledImageHandleDestroyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result =
+        pfnUnsampledImageHandleDestroyExp(hContext, hDevice, hImage);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesSampledImageHandleDestroyExp
+__urdlllocal ur_result_t UR_APICALL
+urBindlessImagesSampledImageHandleDestroyExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_native_handle_t
+        hImage ///< [in][release] pointer to handle of image object to destroy
+) {
+    auto pfnSampledImageHandleDestroyExp =
+        getContext()
+            ->urDdiTable.BindlessImagesExp.pfnSampledImageHandleDestroyExp;
+
+    if (nullptr == pfnSampledImageHandleDestroyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result =
+        pfnSampledImageHandleDestroyExp(hContext, hDevice, hImage);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesImageAllocateExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
+    ur_exp_image_mem_native_handle_t
+        *phImageMem ///< [out] pointer to handle of image memory allocated
+) {
+    auto pfnImageAllocateExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnImageAllocateExp;
+
+    if (nullptr == pfnImageAllocateExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pImageFormat) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pImageDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phImageMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pImageDesc->type) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnImageAllocateExp(hContext, hDevice, pImageFormat,
+                                             pImageDesc, phImageMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesImageFreeExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_mem_native_handle_t
+        hImageMem ///< [in][release] handle of image memory to be freed
+) {
+    auto pfnImageFreeExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnImageFreeExp;
+
+    if (nullptr == pfnImageFreeExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnImageFreeExp(hContext, hDevice, hImageMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesUnsampledImageCreateExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_mem_native_handle_t
+        hImageMem, ///< [in] handle to memory from which to create the image
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
+    ur_exp_image_native_handle_t
+        *phImage ///< [out] pointer to handle of image object created
+) {
+    auto pfnUnsampledImageCreateExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnUnsampledImageCreateExp;
+
+    if (nullptr == pfnUnsampledImageCreateExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pImageFormat) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pImageDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phImage) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pImageDesc->type) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnUnsampledImageCreateExp(
+        hContext, hDevice, hImageMem, pImageFormat, pImageDesc, phImage);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesSampledImageCreateExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_mem_native_handle_t
+        hImageMem, ///< [in] handle to memory from which to create the image
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
+    ur_sampler_handle_t hSampler,      ///< [in] sampler to be used
+    ur_exp_image_native_handle_t
+        *phImage ///< [out] pointer to handle of image object created
+) {
+    auto pfnSampledImageCreateExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnSampledImageCreateExp;
+
+    if (nullptr == pfnSampledImageCreateExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hSampler) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pImageFormat) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pImageDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phImage) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pImageDesc->type) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hSampler)) {
+        getContext()->refCountContext->logInvalidReference(hSampler);
+    }
+
+    ur_result_t result =
+        pfnSampledImageCreateExp(hContext, hDevice, hImageMem, pImageFormat,
+                                 pImageDesc, hSampler, phImage);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesImageCopyExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void *pSrc,         ///< [in] location the data will be copied from
+    void *pDst,               ///< [in] location the data will be copied to
+    const ur_image_desc_t *pSrcImageDesc, ///< [in] pointer to image description
+    const ur_image_desc_t *pDstImageDesc, ///< [in] pointer to image description
+    const ur_image_format_t
+        *pSrcImageFormat, ///< [in] pointer to image format specification
+    const ur_image_format_t
+        *pDstImageFormat, ///< [in] pointer to image format specification
+    ur_exp_image_copy_region_t *
+        pCopyRegion, ///< [in] Pointer to structure describing the (sub-)regions of source and
+                     ///< destination images
+    ur_exp_image_copy_flags_t
+        imageCopyFlags, ///< [in] flags describing copy direction e.g. H2D or D2H
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnImageCopyExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnImageCopyExp;
+
+    if (nullptr == pfnImageCopyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSrcImageDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pDstImageDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSrcImageFormat) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pDstImageFormat) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pCopyRegion) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_EXP_IMAGE_COPY_FLAGS_MASK & imageCopyFlags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (pSrcImageDesc &&
+            UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pSrcImageDesc->type) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+
+        if (pDstImageDesc &&
+            UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pDstImageDesc->type) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnImageCopyExp(
+        hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+        pDstImageFormat, pCopyRegion, imageCopyFlags, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesImageGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_exp_image_mem_native_handle_t
+        hImageMem,            ///< [in] handle to the image memory
+    ur_image_info_t propName, ///< [in] queried info name
+    void *pPropValue,         ///< [out][optional] returned query value
+    size_t *pPropSizeRet      ///< [out][optional] returned query value size
+) {
+    auto pfnImageGetInfoExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnImageGetInfoExp;
+
+    if (nullptr == pfnImageGetInfoExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_IMAGE_INFO_DEPTH < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnImageGetInfoExp(hContext, hImageMem, propName,
+                                            pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesMipmapGetLevelExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_mem_native_handle_t
+        hImageMem,        ///< [in] memory handle to the mipmap image
+    uint32_t mipmapLevel, ///< [in] requested level of the mipmap
+    ur_exp_image_mem_native_handle_t
+        *phImageMem ///< [out] returning memory handle to the individual image
+) {
+    auto pfnMipmapGetLevelExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnMipmapGetLevelExp;
+
+    if (nullptr == pfnMipmapGetLevelExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phImageMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnMipmapGetLevelExp(hContext, hDevice, hImageMem,
+                                              mipmapLevel, phImageMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesMipmapFreeExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_mem_native_handle_t
+        hMem ///< [in][release] handle of image memory to be freed
+) {
+    auto pfnMipmapFreeExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnMipmapFreeExp;
+
+    if (nullptr == pfnMipmapFreeExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnMipmapFreeExp(hContext, hDevice, hMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesImportExternalMemoryExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    size_t size,                  ///< [in] size of the external memory
+    ur_exp_external_mem_type_t
+        memHandleType, ///< [in] type of external memory handle
+    ur_exp_external_mem_desc_t
+        *pExternalMemDesc, ///< [in] the external memory descriptor
+    ur_exp_external_mem_handle_t
+        *phExternalMem ///< [out] external memory handle to the external memory
+) {
+    auto pfnImportExternalMemoryExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnImportExternalMemoryExp;
+
+    if (nullptr == pfnImportExternalMemoryExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pExternalMemDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phExternalMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_EXP_EXTERNAL_MEM_TYPE_WIN32_NT_DX12_RESOURCE < memHandleType) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result =
+        pfnImportExternalMemoryExp(hContext, hDevice, size, memHandleType,
+                                   pExternalMemDesc, phExternalMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesMapExternalArrayExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
+    ur_exp_external_mem_handle_t
+        hExternalMem, ///< [in] external memory handle to the external memory
+    ur_exp_image_mem_native_handle_t *
+        phImageMem ///< [out] image memory handle to the externally allocated memory
+) {
+    auto pfnMapExternalArrayExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnMapExternalArrayExp;
+
+    if (nullptr == pfnMapExternalArrayExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hExternalMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pImageFormat) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pImageDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phImageMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pImageDesc->type) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnMapExternalArrayExp(
+        hContext, hDevice, pImageFormat, pImageDesc, hExternalMem, phImageMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesMapExternalLinearMemoryExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    uint64_t offset,              ///< [in] offset into memory region to map
+    uint64_t size,                ///< [in] size of memory region to map
+    ur_exp_external_mem_handle_t
+        hExternalMem, ///< [in] external memory handle to the external memory
+    void **ppRetMem   ///< [out] pointer of the externally allocated memory
+) {
+    auto pfnMapExternalLinearMemoryExp =
+        getContext()
+            ->urDdiTable.BindlessImagesExp.pfnMapExternalLinearMemoryExp;
+
+    if (nullptr == pfnMapExternalLinearMemoryExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hExternalMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppRetMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnMapExternalLinearMemoryExp(
+        hContext, hDevice, offset, size, hExternalMem, ppRetMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesReleaseExternalMemoryExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_external_mem_handle_t
+        hExternalMem ///< [in][release] handle of external memory to be destroyed
+) {
+    auto pfnReleaseExternalMemoryExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnReleaseExternalMemoryExp;
+
+    if (nullptr == pfnReleaseExternalMemoryExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hExternalMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result =
+        pfnReleaseExternalMemoryExp(hContext, hDevice, hExternalMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesImportExternalSemaphoreExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_external_semaphore_type_t
+        semHandleType, ///< [in] type of external memory handle
+    ur_exp_external_semaphore_desc_t
+        *pExternalSemaphoreDesc, ///< [in] the external semaphore descriptor
+    ur_exp_external_semaphore_handle_t *
+        phExternalSemaphore ///< [out] external semaphore handle to the external semaphore
+) {
+    auto pfnImportExternalSemaphoreExp =
+        getContext()
+            ->urDdiTable.BindlessImagesExp.pfnImportExternalSemaphoreExp;
+
+    if (nullptr == pfnImportExternalSemaphoreExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pExternalSemaphoreDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phExternalSemaphore) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_EXP_EXTERNAL_SEMAPHORE_TYPE_WIN32_NT_DX12_FENCE <
+            semHandleType) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnImportExternalSemaphoreExp(
+        hContext, hDevice, semHandleType, pExternalSemaphoreDesc,
+        phExternalSemaphore);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesReleaseExternalSemaphoreExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_external_semaphore_handle_t
+        hExternalSemaphore ///< [in][release] handle of external semaphore to be destroyed
+) {
+    auto pfnReleaseExternalSemaphoreExp =
+        getContext()
+            ->urDdiTable.BindlessImagesExp.pfnReleaseExternalSemaphoreExp;
+
+    if (nullptr == pfnReleaseExternalSemaphoreExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hExternalSemaphore) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result =
+        pfnReleaseExternalSemaphoreExp(hContext, hDevice, hExternalSemaphore);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesWaitExternalSemaphoreExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_external_semaphore_handle_t
+        hSemaphore, ///< [in] external semaphore handle
+    bool
+        hasWaitValue, ///< [in] indicates whether the samephore is capable and should wait on a
+                      ///< certain value.
+    ///< Otherwise the semaphore is treated like a binary state, and
+    ///< `waitValue` is ignored.
+    uint64_t waitValue,           ///< [in] the value to be waited on
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnWaitExternalSemaphoreExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnWaitExternalSemaphoreExp;
+
+    if (nullptr == pfnWaitExternalSemaphoreExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hSemaphore) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnWaitExternalSemaphoreExp(
+        hQueue, hSemaphore, hasWaitValue, waitValue, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urBindlessImagesSignalExternalSemaphoreExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_external_semaphore_handle_t
+        hSemaphore, ///< [in] external semaphore handle
+    bool
+        hasSignalValue, ///< [in] indicates whether the samephore is capable and should signal on a
+                        ///< certain value.
+    ///< Otherwise the semaphore is treated like a binary state, and
+    ///< `signalValue` is ignored.
+    uint64_t signalValue,         ///< [in] the value to be signalled
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnSignalExternalSemaphoreExp =
+        getContext()
+            ->urDdiTable.BindlessImagesExp.pfnSignalExternalSemaphoreExp;
+
+    if (nullptr == pfnSignalExternalSemaphoreExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hSemaphore) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnSignalExternalSemaphoreExp(
+        hQueue, hSemaphore, hasSignalValue, signalValue, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferCreateExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
+    ur_context_handle_t hContext, ///< [in] Handle of the context object.
+    ur_device_handle_t hDevice,   ///< [in] Handle of the device object.
+    const ur_exp_command_buffer_desc_t
+        *pCommandBufferDesc, ///< [in][optional] command-buffer descriptor.
+    ur_exp_command_buffer_handle_t
+        *phCommandBuffer ///< [out] Pointer to command-Buffer handle.
+) {
+    auto pfnCreateExp = getContext()->urDdiTable.CommandBufferExp.pfnCreateExp;
+
+    if (nullptr == pfnCreateExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result =
+        pfnCreateExp(hContext, hDevice, pCommandBufferDesc, phCommandBuffer);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferRetainExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer ///< [in][retain] Handle of the command-buffer object.
+) {
+    auto pfnRetainExp = getContext()->urDdiTable.CommandBufferExp.pfnRetainExp;
+
+    if (nullptr == pfnRetainExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRetainExp(hCommandBuffer);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferReleaseExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer ///< [in][release] Handle of the command-buffer object.
+) {
+    auto pfnReleaseExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnReleaseExp;
+
+    if (nullptr == pfnReleaseExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnReleaseExp(hCommandBuffer);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferFinalizeExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer ///< [in] Handle of the command-buffer object.
+) {
+    auto pfnFinalizeExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnFinalizeExp;
+
+    if (nullptr == pfnFinalizeExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnFinalizeExp(hCommandBuffer);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendKernelLaunchExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,         ///< [in] Handle of the command-buffer object.
+    ur_kernel_handle_t hKernel, ///< [in] Kernel to append.
+    uint32_t workDim,           ///< [in] Dimension of the kernel execution.
+    const size_t
+        *pGlobalWorkOffset, ///< [in] Offset to use when executing kernel.
+    const size_t *
+        pGlobalWorkSize, ///< [in] Global work size to use when executing kernel.
+    const size_t *
+        pLocalWorkSize, ///< [in][optional] Local work size to use when executing kernel. If this
+    ///< parameter is nullptr, then a local work size will be generated by the
+    ///< implementation.
+    uint32_t
+        numKernelAlternatives, ///< [in] The number of kernel alternatives provided in
+                               ///< phKernelAlternatives.
+    ur_kernel_handle_t *
+        phKernelAlternatives, ///< [in][optional][range(0, numKernelAlternatives)] List of kernel handles
+    ///< that might be used to update the kernel in this
+    ///< command after the command-buffer is finalized. The default kernel
+    ///< `hKernel` is implicitly marked as an alternative. It's
+    ///< invalid to specify it as part of this list.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint, ///< [out][optional] Sync point associated with this command.
+    ur_exp_command_buffer_command_handle_t
+        *phCommand ///< [out][optional] Handle to this command.
+) {
+    auto pfnAppendKernelLaunchExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnAppendKernelLaunchExp;
+
+    if (nullptr == pfnAppendKernelLaunchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pGlobalWorkOffset) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pGlobalWorkSize) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phKernelAlternatives == NULL && numKernelAlternatives > 0) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+
+        if (phKernelAlternatives != NULL && numKernelAlternatives == 0) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result = pfnAppendKernelLaunchExp(
+        hCommandBuffer, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numKernelAlternatives, phKernelAlternatives,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, phCommand);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendUSMMemcpyExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer object.
+    void *pDst,         ///< [in] Location the data will be copied to.
+    const void *pSrc,   ///< [in] The data to be copied.
+    size_t size,        ///< [in] The number of bytes to copy.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    auto pfnAppendUSMMemcpyExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnAppendUSMMemcpyExp;
+
+    if (nullptr == pfnAppendUSMMemcpyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+    }
+
+    ur_result_t result = pfnAppendUSMMemcpyExp(hCommandBuffer, pDst, pSrc, size,
+                                               numSyncPointsInWaitList,
+                                               pSyncPointWaitList, pSyncPoint);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendUSMFillExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,   ///< [in] handle of the command-buffer object.
+    void *pMemory,        ///< [in] pointer to USM allocated memory to fill.
+    const void *pPattern, ///< [in] pointer to the fill pattern.
+    size_t patternSize,   ///< [in] size in bytes of the pattern.
+    size_t
+        size, ///< [in] fill size in bytes, must be a multiple of patternSize.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] sync point associated with this command.
+) {
+    auto pfnAppendUSMFillExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnAppendUSMFillExp;
+
+    if (nullptr == pfnAppendUSMFillExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMemory) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pPattern) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (patternSize == 0 || size == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (patternSize > size) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (size % patternSize != 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+    }
+
+    ur_result_t result = pfnAppendUSMFillExp(
+        hCommandBuffer, pMemory, pPattern, patternSize, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendMemBufferCopyExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hSrcMem, ///< [in] The data to be copied.
+    ur_mem_handle_t hDstMem, ///< [in] The location the data will be copied to.
+    size_t srcOffset,        ///< [in] Offset into the source memory.
+    size_t dstOffset,        ///< [in] Offset into the destination memory
+    size_t size,             ///< [in] The number of bytes to be copied.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    auto pfnAppendMemBufferCopyExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnAppendMemBufferCopyExp;
+
+    if (nullptr == pfnAppendMemBufferCopyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hSrcMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDstMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hSrcMem)) {
+        getContext()->refCountContext->logInvalidReference(hSrcMem);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDstMem)) {
+        getContext()->refCountContext->logInvalidReference(hDstMem);
+    }
+
+    ur_result_t result = pfnAppendMemBufferCopyExp(
+        hCommandBuffer, hSrcMem, hDstMem, srcOffset, dstOffset, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendMemBufferWriteExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hBuffer, ///< [in] Handle of the buffer object.
+    size_t offset,           ///< [in] Offset in bytes in the buffer object.
+    size_t size,             ///< [in] Size in bytes of data being written.
+    const void *
+        pSrc, ///< [in] Pointer to host memory where data is to be written from.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    auto pfnAppendMemBufferWriteExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnAppendMemBufferWriteExp;
+
+    if (nullptr == pfnAppendMemBufferWriteExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result = pfnAppendMemBufferWriteExp(
+        hCommandBuffer, hBuffer, offset, size, pSrc, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendMemBufferReadExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hBuffer, ///< [in] Handle of the buffer object.
+    size_t offset,           ///< [in] Offset in bytes in the buffer object.
+    size_t size,             ///< [in] Size in bytes of data being written.
+    void *pDst, ///< [in] Pointer to host memory where data is to be written to.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    auto pfnAppendMemBufferReadExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnAppendMemBufferReadExp;
+
+    if (nullptr == pfnAppendMemBufferReadExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result = pfnAppendMemBufferReadExp(
+        hCommandBuffer, hBuffer, offset, size, pDst, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendMemBufferCopyRectExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hSrcMem, ///< [in] The data to be copied.
+    ur_mem_handle_t hDstMem, ///< [in] The location the data will be copied to.
+    ur_rect_offset_t
+        srcOrigin, ///< [in] Origin for the region of data to be copied from the source.
+    ur_rect_offset_t
+        dstOrigin, ///< [in] Origin for the region of data to be copied to in the destination.
+    ur_rect_region_t
+        region, ///< [in] The extents describing the region to be copied.
+    size_t srcRowPitch,   ///< [in] Row pitch of the source memory.
+    size_t srcSlicePitch, ///< [in] Slice pitch of the source memory.
+    size_t dstRowPitch,   ///< [in] Row pitch of the destination memory.
+    size_t dstSlicePitch, ///< [in] Slice pitch of the destination memory.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    auto pfnAppendMemBufferCopyRectExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnAppendMemBufferCopyRectExp;
+
+    if (nullptr == pfnAppendMemBufferCopyRectExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hSrcMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDstMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hSrcMem)) {
+        getContext()->refCountContext->logInvalidReference(hSrcMem);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDstMem)) {
+        getContext()->refCountContext->logInvalidReference(hDstMem);
+    }
+
+    ur_result_t result = pfnAppendMemBufferCopyRectExp(
+        hCommandBuffer, hSrcMem, hDstMem, srcOrigin, dstOrigin, region,
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendMemBufferWriteRectExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hBuffer, ///< [in] Handle of the buffer object.
+    ur_rect_offset_t bufferOffset, ///< [in] 3D offset in the buffer.
+    ur_rect_offset_t hostOffset,   ///< [in] 3D offset in the host region.
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth.
+    size_t
+        bufferRowPitch, ///< [in] Length of each row in bytes in the buffer object.
+    size_t
+        bufferSlicePitch, ///< [in] Length of each 2D slice in bytes in the buffer object being
+                          ///< written.
+    size_t
+        hostRowPitch, ///< [in] Length of each row in bytes in the host memory region pointed to
+                      ///< by pSrc.
+    size_t
+        hostSlicePitch, ///< [in] Length of each 2D slice in bytes in the host memory region
+                        ///< pointed to by pSrc.
+    void *
+        pSrc, ///< [in] Pointer to host memory where data is to be written from.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    auto pfnAppendMemBufferWriteRectExp =
+        getContext()
+            ->urDdiTable.CommandBufferExp.pfnAppendMemBufferWriteRectExp;
+
+    if (nullptr == pfnAppendMemBufferWriteRectExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result = pfnAppendMemBufferWriteRectExp(
+        hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendMemBufferReadRectExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hBuffer, ///< [in] Handle of the buffer object.
+    ur_rect_offset_t bufferOffset, ///< [in] 3D offset in the buffer.
+    ur_rect_offset_t hostOffset,   ///< [in] 3D offset in the host region.
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth.
+    size_t
+        bufferRowPitch, ///< [in] Length of each row in bytes in the buffer object.
+    size_t
+        bufferSlicePitch, ///< [in] Length of each 2D slice in bytes in the buffer object being read.
+    size_t
+        hostRowPitch, ///< [in] Length of each row in bytes in the host memory region pointed to
+                      ///< by pDst.
+    size_t
+        hostSlicePitch, ///< [in] Length of each 2D slice in bytes in the host memory region
+                        ///< pointed to by pDst.
+    void *pDst, ///< [in] Pointer to host memory where data is to be read into.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    auto pfnAppendMemBufferReadRectExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnAppendMemBufferReadRectExp;
+
+    if (nullptr == pfnAppendMemBufferReadRectExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result = pfnAppendMemBufferReadRectExp(
+        hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendMemBufferFillExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] handle of the command-buffer object.
+    ur_mem_handle_t hBuffer, ///< [in] handle of the buffer object.
+    const void *pPattern,    ///< [in] pointer to the fill pattern.
+    size_t patternSize,      ///< [in] size in bytes of the pattern.
+    size_t offset,           ///< [in] offset into the buffer.
+    size_t
+        size, ///< [in] fill size in bytes, must be a multiple of patternSize.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] sync point associated with this command.
+) {
+    auto pfnAppendMemBufferFillExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnAppendMemBufferFillExp;
+
+    if (nullptr == pfnAppendMemBufferFillExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pPattern) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBuffer)) {
+        getContext()->refCountContext->logInvalidReference(hBuffer);
+    }
+
+    ur_result_t result = pfnAppendMemBufferFillExp(
+        hCommandBuffer, hBuffer, pPattern, patternSize, offset, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendUSMPrefetchExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,  ///< [in] handle of the command-buffer object.
+    const void *pMemory, ///< [in] pointer to USM allocated memory to prefetch.
+    size_t size,         ///< [in] size in bytes to be fetched.
+    ur_usm_migration_flags_t flags, ///< [in] USM prefetch flags
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] sync point associated with this command.
+) {
+    auto pfnAppendUSMPrefetchExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnAppendUSMPrefetchExp;
+
+    if (nullptr == pfnAppendUSMPrefetchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMemory) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_USM_MIGRATION_FLAGS_MASK & flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    ur_result_t result = pfnAppendUSMPrefetchExp(
+        hCommandBuffer, pMemory, size, flags, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferAppendUSMAdviseExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,           ///< [in] handle of the command-buffer object.
+    const void *pMemory,          ///< [in] pointer to the USM memory object.
+    size_t size,                  ///< [in] size in bytes to be advised.
+    ur_usm_advice_flags_t advice, ///< [in] USM memory advice
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] sync point associated with this command.
+) {
+    auto pfnAppendUSMAdviseExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnAppendUSMAdviseExp;
+
+    if (nullptr == pfnAppendUSMAdviseExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMemory) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_USM_ADVICE_FLAGS_MASK & advice) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (pSyncPointWaitList != NULL && numSyncPointsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
+        }
+
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    ur_result_t result = pfnAppendUSMAdviseExp(hCommandBuffer, pMemory, size,
+                                               advice, numSyncPointsInWaitList,
+                                               pSyncPointWaitList, pSyncPoint);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferEnqueueExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer object.
+    ur_queue_handle_t
+        hQueue, ///< [in] The queue to submit this command-buffer for execution.
+    uint32_t numEventsInWaitList, ///< [in] Size of the event wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the command-buffer execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command-buffer execution instance.
+) {
+    auto pfnEnqueueExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnEnqueueExp;
+
+    if (nullptr == pfnEnqueueExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnEnqueueExp(
+        hCommandBuffer, hQueue, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferRetainCommandExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
+    ur_exp_command_buffer_command_handle_t
+        hCommand ///< [in][retain] Handle of the command-buffer command.
+) {
+    auto pfnRetainCommandExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnRetainCommandExp;
+
+    if (nullptr == pfnRetainCommandExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommand) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnRetainCommandExp(hCommand);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferReleaseCommandExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
+    ur_exp_command_buffer_command_handle_t
+        hCommand ///< [in][release] Handle of the command-buffer command.
+) {
+    auto pfnReleaseCommandExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnReleaseCommandExp;
+
+    if (nullptr == pfnReleaseCommandExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommand) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    ur_result_t result = pfnReleaseCommandExp(hCommand);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferUpdateKernelLaunchExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
+    ur_exp_command_buffer_command_handle_t
+        hCommand, ///< [in] Handle of the command-buffer kernel command to update.
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *
+        pUpdateKernelLaunch ///< [in] Struct defining how the kernel command is to be updated.
+) {
+    auto pfnUpdateKernelLaunchExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnUpdateKernelLaunchExp;
+
+    if (nullptr == pfnUpdateKernelLaunchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommand) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pUpdateKernelLaunch) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (pUpdateKernelLaunch->newWorkDim < 1 ||
+            pUpdateKernelLaunch->newWorkDim > 3) {
+            return UR_RESULT_ERROR_INVALID_WORK_DIMENSION;
+        }
+    }
+
+    ur_result_t result =
+        pfnUpdateKernelLaunchExp(hCommand, pUpdateKernelLaunch);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] handle of the command-buffer object
+    ur_exp_command_buffer_info_t
+        propName, ///< [in] the name of the command-buffer property to query
+    size_t
+        propSize, ///< [in] size in bytes of the command-buffer property value
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the
+                    ///< command-buffer property
+    size_t *
+        pPropSizeRet ///< [out][optional] bytes returned in command-buffer property
+) {
+    auto pfnGetInfoExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnGetInfoExp;
+
+    if (nullptr == pfnGetInfoExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_EXP_COMMAND_BUFFER_INFO_REFERENCE_COUNT < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    ur_result_t result = pfnGetInfoExp(hCommandBuffer, propName, propSize,
+                                       pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urCommandBufferCommandGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
+    ur_exp_command_buffer_command_handle_t
+        hCommand, ///< [in] handle of the command-buffer command object
+    ur_exp_command_buffer_command_info_t
+        propName, ///< [in] the name of the command-buffer command property to query
+    size_t
+        propSize, ///< [in] size in bytes of the command-buffer command property value
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the
+                    ///< command-buffer command property
+    size_t *
+        pPropSizeRet ///< [out][optional] bytes returned in command-buffer command property
+) {
+    auto pfnCommandGetInfoExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnCommandGetInfoExp;
+
+    if (nullptr == pfnCommandGetInfoExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hCommand) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_EXP_COMMAND_BUFFER_COMMAND_INFO_REFERENCE_COUNT < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    ur_result_t result = pfnCommandGetInfoExp(hCommand, propName, propSize,
+                                              pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueCooperativeKernelLaunchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t
+        workDim, ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                 ///< work-group work-items
+    const size_t *
+        pGlobalWorkOffset, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< offset used to calculate the global ID of a work-item
+    const size_t *
+        pGlobalWorkSize, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< number of global work-items in workDim that will execute the kernel
+    ///< function
+    const size_t *
+        pLocalWorkSize, ///< [in][optional] pointer to an array of workDim unsigned values that
+    ///< specify the number of local work-items forming a work-group that will
+    ///< execute the kernel function.
+    ///< If nullptr, the runtime implementation will choose the work-group
+    ///< size.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnCooperativeKernelLaunchExp =
+        getContext()->urDdiTable.EnqueueExp.pfnCooperativeKernelLaunchExp;
+
+    if (nullptr == pfnCooperativeKernelLaunchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pGlobalWorkOffset) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pGlobalWorkSize) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result = pfnCooperativeKernelLaunchExp(
+        hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelSuggestMaxCooperativeGroupCountExp
+__urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    size_t
+        localWorkSize, ///< [in] number of local work-items that will form a work-group when the
+                       ///< kernel is launched
+    size_t
+        dynamicSharedMemorySize, ///< [in] size of dynamic shared memory, for each work-group, in bytes,
+    ///< that will be used when the kernel is launched
+    uint32_t *pGroupCountRet ///< [out] pointer to maximum number of groups
+) {
+    auto pfnSuggestMaxCooperativeGroupCountExp =
+        getContext()
+            ->urDdiTable.KernelExp.pfnSuggestMaxCooperativeGroupCountExp;
+
+    if (nullptr == pfnSuggestMaxCooperativeGroupCountExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pGroupCountRet) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result = pfnSuggestMaxCooperativeGroupCountExp(
+        hKernel, localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueMemBufferCopyRectBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_mem_handle_t hBufferSrc, ///< [in] handle of the source buffer object
+    ur_mem_handle_t hBufferDst, ///< [in] handle of the dest buffer object
+    uint32_t numRegions, ///< [in] number of rectangular regions to copy
+    const ur_rect_offset_t *
+        pSrcOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the source
+                     ///< buffer
+    const ur_rect_offset_t *
+        pDstOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the
+                     ///< destination buffer
+    const ur_rect_region_t *
+        pRegions, ///< [in][range(0, numRegions)] 3D rectangular region descriptors: width,
+                  ///< height, depth
+    size_t
+        srcRowPitch, ///< [in] length of each row in bytes in the source buffer object
+    size_t
+        srcSlicePitch, ///< [in] length of each 2D slice in bytes in the source buffer object
+    size_t
+        dstRowPitch, ///< [in] length of each row in bytes in the destination buffer object
+    size_t
+        dstSlicePitch, ///< [in] length of each 2D slice in bytes in the destination buffer object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferCopyRectBatchExp =
+        getContext()->urDdiTable.EnqueueExp.pfnMemBufferCopyRectBatchExp;
+
+    if (nullptr == pfnMemBufferCopyRectBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBufferSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBufferDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pSrcOrigins) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pDstOrigins) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pRegions) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (numRegions == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBufferSrc)) {
+        getContext()->refCountContext->logInvalidReference(hBufferSrc);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBufferDst)) {
+        getContext()->refCountContext->logInvalidReference(hBufferDst);
+    }
+
+    ur_result_t result = pfnMemBufferCopyRectBatchExp(
+        hQueue, hBufferSrc, hBufferDst, numRegions, pSrcOrigins, pDstOrigins,
+        pRegions, srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueKernelLaunchBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t numLaunches,     ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_desc_t *
+        pLaunches, ///< [in][range(0, numLaunches)] pointer to a list of kernel launch
+                   ///< descriptors
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernels execute.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the completion
+                ///< of all the launches.
+) {
+    auto pfnKernelLaunchBatchExp =
+        getContext()->urDdiTable.EnqueueExp.pfnKernelLaunchBatchExp;
+
+    if (nullptr == pfnKernelLaunchBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pLaunches) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (numLaunches == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnKernelLaunchBatchExp(
+        hQueue, numLaunches, pLaunches, numEventsInWaitList, phEventWaitList,
+        phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueTimestampRecordingExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    bool
+        blocking, ///< [in] indicates whether the call to this function should block until
+    ///< until the device timestamp recording command has executed on the
+    ///< device.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [in,out] return an event object that identifies this particular kernel
+                ///< execution instance. Profiling information can be queried
+    ///< from this event as if `hQueue` had profiling enabled. Querying
+    ///< `UR_PROFILING_INFO_COMMAND_QUEUED` or `UR_PROFILING_INFO_COMMAND_SUBMIT`
+    ///< reports the timestamp at the time of the call to this function.
+    ///< Querying `UR_PROFILING_INFO_COMMAND_START` or `UR_PROFILING_INFO_COMMAND_END`
+    ///< reports the timestamp recorded when the command is executed on the device.
+) {
+    auto pfnTimestampRecordingExp =
+        getContext()->urDdiTable.EnqueueExp.pfnTimestampRecordingExp;
+
+    if (nullptr == pfnTimestampRecordingExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnTimestampRecordingExp(
+        hQueue, blocking, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueUSMDeviceAllocExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the allocation.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    void **ppMem, ///< [out] pointer to USM device memory object
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
+) {
+    auto pfnUSMDeviceAllocExp =
+        getContext()->urDdiTable.EnqueueExp.pfnUSMDeviceAllocExp;
+
+    if (nullptr == pfnUSMDeviceAllocExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_USM_SIZE;
+        }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnUSMDeviceAllocExp(
+        hQueue, size, numEventsInWaitList, phEventWaitList, ppMem, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueUSMFreeExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    void *
+        pMem, ///< [in] pointer to USM memory object allocated with
+              ///< ::urEnqueueUSMDeviceAllocExp
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the free.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
+) {
+    auto pfnUSMFreeExp = getContext()->urDdiTable.EnqueueExp.pfnUSMFreeExp;
+
+    if (nullptr == pfnUSMFreeExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnUSMFreeExp(hQueue, pMem, numEventsInWaitList,
+                                       phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEventWaitAnyExp
+__urdlllocal ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+    uint32_t *
+        pEventIndex ///< [out] index in phEventWaitList of an event which is complete
+) {
+    auto pfnWaitAnyExp = getContext()->urDdiTable.EventExp.pfnWaitAnyExp;
+
+    if (nullptr == pfnWaitAnyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == phEventWaitList) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pEventIndex) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (numEvents == 0) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+    }
+
+    ur_result_t result = pfnWaitAnyExp(numEvents, phEventWaitList, pEventIndex);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEventGetExecutionStatusExp
+__urdlllocal ur_result_t UR_APICALL urEventGetExecutionStatusExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEvents, ///< [in][range(0, numEvents)] pointer to a list of events to query
+    ur_event_status_t *
+        pStatuses ///< [out][range(0, numEvents)] execution status of each of the events of
+                  ///< phEvents
+) {
+    auto pfnGetExecutionStatusExp = getContext()->urDdiTable.EventExp.pfnGetExecutionStatusExp;
+
+    if (nullptr == pfnGetExecutionStatusExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == phEvents) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pStatuses) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (numEvents == 0) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+    }
+
+    ur_result_t result = pfnGetExecutionStatusExp(numEvents, phEvents, pStatuses);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urQueueReserveTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReserveTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t
+        capacity ///< [in] number of slots of the ring, the number of markers which can be
+    ///< enqueued before the first one is overwritten
+) {
+    auto pfnReserveTimestampMarkersExp =
+        getContext()->urDdiTable.QueueExp.pfnReserveTimestampMarkersExp;
+
+    if (nullptr == pfnReserveTimestampMarkersExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (capacity == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnReserveTimestampMarkersExp(hQueue, capacity);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueTimestampMarkerExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the timestamp is written.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    uint64_t *pMarker ///< [out][optional] number of the marker
+) {
+    auto pfnTimestampMarkerExp =
+        getContext()->urDdiTable.EnqueueExp.pfnTimestampMarkerExp;
+
+    if (nullptr == pfnTimestampMarkerExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnTimestampMarkerExp(hQueue, numEventsInWaitList,
+                                               phEventWaitList, pMarker);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urQueueReadTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReadTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint64_t firstMarker,     ///< [in] number of the first marker to read
+    uint32_t count,           ///< [in] number of markers to read
+    uint64_t *
+        pTimestamps ///< [out][range(0, count)] timestamps in nanoseconds of the markers
+) {
+    auto pfnReadTimestampMarkersExp =
+        getContext()->urDdiTable.QueueExp.pfnReadTimestampMarkersExp;
+
+    if (nullptr == pfnReadTimestampMarkersExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pTimestamps) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (count == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result =
+        pfnReadTimestampMarkersExp(hQueue, firstMarker, count, pTimestamps);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urKernelSetArgsExp
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments
+    const ur_exp_kernel_arg_properties_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to a list of kernel arguments
+) {
+    auto pfnSetArgsExp = getContext()->urDdiTable.KernelExp.pfnSetArgsExp;
+
+    if (nullptr == pfnSetArgsExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pArgs) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (numArgs == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result = pfnSetArgsExp(hKernel, numArgs, pArgs);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueKernelLaunchCustomExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t
+        workDim, ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                 ///< work-group work-items
+    const size_t *
+        pGlobalWorkSize, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< number of global work-items in workDim that will execute the kernel
+    ///< function
+    const size_t *
+        pLocalWorkSize, ///< [in][optional] pointer to an array of workDim unsigned values that
+    ///< specify the number of local work-items forming a work-group that will
+    ///< execute the kernel function. If nullptr, the runtime implementation
+    ///< will choose the work-group size.
+    uint32_t numPropsInLaunchPropList, ///< [in] size of the launch prop list
+    const ur_exp_launch_property_t *
+        launchPropList, ///< [in][range(0, numPropsInLaunchPropList)] pointer to a list of launch
+                        ///< properties
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution. If nullptr,
+    ///< the numEventsInWaitList must be 0, indicating that no wait event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    auto pfnKernelLaunchCustomExp =
+        getContext()->urDdiTable.EnqueueExp.pfnKernelLaunchCustomExp;
+
+    if (nullptr == pfnKernelLaunchCustomExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pGlobalWorkSize) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == launchPropList) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result = pfnKernelLaunchCustomExp(
+        hQueue, hKernel, workDim, pGlobalWorkSize, pLocalWorkSize,
+        numPropsInLaunchPropList, launchPropList, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramBuildExp
+__urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
+    ur_program_handle_t hProgram, ///< [in] Handle of the program to build.
+    uint32_t numDevices,          ///< [in] number of devices
+    ur_device_handle_t *
+        phDevices, ///< [in][range(0, numDevices)] pointer to array of device handles
+    const char *
+        pOptions ///< [in][optional] pointer to build options null-terminated string.
+) {
+    auto pfnBuildExp = getContext()->urDdiTable.ProgramExp.pfnBuildExp;
+
+    if (nullptr == pfnBuildExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phDevices) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result = pfnBuildExp(hProgram, numDevices, phDevices, pOptions);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramCompileExp
+__urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
+    ur_program_handle_t
+        hProgram,        ///< [in][out] handle of the program to compile.
+    uint32_t numDevices, ///< [in] number of devices
+    ur_device_handle_t *
+        phDevices, ///< [in][range(0, numDevices)] pointer to array of device handles
+    const char *
+        pOptions ///< [in][optional] pointer to build options null-terminated string.
+) {
+    auto pfnCompileExp = getContext()->urDdiTable.ProgramExp.pfnCompileExp;
+
+    if (nullptr == pfnCompileExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phDevices) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    ur_result_t result =
+        pfnCompileExp(hProgram, numDevices, phDevices, pOptions);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urProgramLinkExp
+__urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance.
+    uint32_t numDevices,          ///< [in] number of devices
+    ur_device_handle_t *
+        phDevices, ///< [in][range(0, numDevices)] pointer to array of device handles
+    uint32_t count, ///< [in] number of program handles in `phPrograms`.
+    const ur_program_handle_t *
+        phPrograms, ///< [in][range(0, count)] pointer to array of program handles.
+    const char *
+        pOptions, ///< [in][optional] pointer to linker options null-terminated string.
+    ur_program_handle_t
+        *phProgram ///< [out] pointer to handle of program object created.
+) {
+    if (nullptr != phProgram) {
+        *phProgram = nullptr;
+    }
+    auto pfnLinkExp = getContext()->urDdiTable.ProgramExp.pfnLinkExp;
+
+    if (nullptr == pfnLinkExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phDevices) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phPrograms) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (count == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnLinkExp(hContext, numDevices, phDevices, count,
+                                    phPrograms, pOptions, phProgram);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMImportExp
+__urdlllocal ur_result_t UR_APICALL urUSMImportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem,                   ///< [in] pointer to host memory object
+    size_t size ///< [in] size in bytes of the host memory object to be imported
+) {
+    auto pfnImportExp = getContext()->urDdiTable.USMExp.pfnImportExp;
+
+    if (nullptr == pfnImportExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnImportExp(hContext, pMem, size);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMReleaseExp
+__urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem                    ///< [in] pointer to host memory object
+) {
+    auto pfnReleaseExp = getContext()->urDdiTable.USMExp.pfnReleaseExp;
+
+    if (nullptr == pfnReleaseExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnReleaseExp(hContext, pMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUsmP2PEnablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+) {
+    auto pfnEnablePeerAccessExp =
+        getContext()->urDdiTable.UsmP2PExp.pfnEnablePeerAccessExp;
+
+    if (nullptr == pfnEnablePeerAccessExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == commandDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == peerDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(commandDevice)) {
+        getContext()->refCountContext->logInvalidReference(commandDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(peerDevice)) {
+        getContext()->refCountContext->logInvalidReference(peerDevice);
+    }
+
+    ur_result_t result = pfnEnablePeerAccessExp(commandDevice, peerDevice);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUsmP2PDisablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+) {
+    auto pfnDisablePeerAccessExp =
+        getContext()->urDdiTable.UsmP2PExp.pfnDisablePeerAccessExp;
+
+    if (nullptr == pfnDisablePeerAccessExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == commandDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == peerDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(commandDevice)) {
+        getContext()->refCountContext->logInvalidReference(commandDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(peerDevice)) {
+        getContext()->refCountContext->logInvalidReference(peerDevice);
+    }
+
+    ur_result_t result = pfnDisablePeerAccessExp(commandDevice, peerDevice);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUsmP2PPeerAccessGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
+    ur_device_handle_t
+        commandDevice,             ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice, ///< [in] handle of the peer device object
+    ur_exp_peer_info_t propName,   ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return the info
+    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    auto pfnPeerAccessGetInfoExp =
+        getContext()->urDdiTable.UsmP2PExp.pfnPeerAccessGetInfoExp;
+
+    if (nullptr == pfnPeerAccessGetInfoExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == commandDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == peerDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (UR_EXP_PEER_INFO_UR_PEER_COPY_INTERMEDIATE_DEVICE < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(commandDevice)) {
+        getContext()->refCountContext->logInvalidReference(commandDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(peerDevice)) {
+        getContext()->refCountContext->logInvalidReference(peerDevice);
+    }
+
+    ur_result_t result =
+        pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName, propSize,
+                                pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urUSMPoolTrimExp
+__urdlllocal ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM pool to trim, NULL trims every pool of hContext
+    size_t minBytesToKeep ///< [in] number of cached bytes each pool may keep
+) {
+    auto pfnPoolTrimExp = getContext()->urDdiTable.USMExp.pfnPoolTrimExp;
+
+    if (nullptr == pfnPoolTrimExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hPool)) {
+        getContext()->refCountContext->logInvalidReference(hPool);
+    }
+
+    ur_result_t result = pfnPoolTrimExp(hContext, hPool, minBytesToKeep);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation layer part of urEnqueueNativeCommandExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_enqueue_native_command_function_t
+        pfnNativeEnqueue, ///< [in] function calling the native underlying API, to be executed
+                          ///< immediately.
+    void *data,                ///< [in][optional] data used by pfnNativeEnqueue
+    uint32_t numMemsInMemList, ///< [in] size of the mem list
+    const ur_mem_handle_t *
+        phMemList, ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
+                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
+    ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
+    ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
+    const ur_exp_enqueue_native_command_properties_t *
+        pProperties, ///< [in][optional] pointer to the native enqueue properties
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the work that has
+    ///< been enqueued in nativeEnqueueFunc.
+) {
+    auto pfnNativeCommandExp =
+        getContext()->urDdiTable.EnqueueExp.pfnNativeCommandExp;
+
+    if (nullptr == pfnNativeCommandExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pfnNativeEnqueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL != pProperties &&
+            UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAGS_MASK & pProperties->flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnNativeCommandExp(
+        hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemList,
+        pProperties, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+} // namespace validation
+
+namespace tracing {
+using ur_tracing_layer::getContext;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urAdapterGet
+__urdlllocal ur_result_t UR_APICALL urAdapterGet(
+    uint32_t
+        NumEntries, ///< [in] the number of adapters to be added to phAdapters.
+    ///< If phAdapters is not NULL, then NumEntries should be greater than
+    ///< zero, otherwise ::UR_RESULT_ERROR_INVALID_SIZE,
+    ///< will be returned.
+    ur_adapter_handle_t *
+        phAdapters, ///< [out][optional][range(0, NumEntries)] array of handle of adapters.
+    ///< If NumEntries is less than the number of adapters available, then
+    ///< ::urAdapterGet shall only retrieve that number of adapters.
+    uint32_t *
+        pNumAdapters ///< [out][optional] returns the total number of adapters available.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET)) {
+        return validation::urAdapterGet(NumEntries, phAdapters, pNumAdapters);
+    }
+
+    ur_adapter_get_params_t params = {&NumEntries, &phAdapters, &pNumAdapters};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_GET,
+                                                   "urAdapterGet", &params,
+                                                   NumEntries, phAdapters,
+                                                   pNumAdapters);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urAdapterGet\n");
+
+    ur_result_t result = validation::urAdapterGet(NumEntries, phAdapters,
+                                                  pNumAdapters);
+
+    getContext()->notify_end(UR_FUNCTION_ADAPTER_GET, "urAdapterGet", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_GET,
+                                        &params);
+        logger.info("   <--- urAdapterGet({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urAdapterRelease
+__urdlllocal ur_result_t UR_APICALL urAdapterRelease(
+    ur_adapter_handle_t hAdapter ///< [in][release] Adapter handle to release
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_RELEASE)) {
+        return validation::urAdapterRelease(hAdapter);
+    }
+
+    ur_adapter_release_params_t params = {&hAdapter};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_RELEASE,
+                                                   "urAdapterRelease", &params,
+                                                   hAdapter);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urAdapterRelease\n");
+
+    ur_result_t result = validation::urAdapterRelease(hAdapter);
+
+    getContext()->notify_end(UR_FUNCTION_ADAPTER_RELEASE, "urAdapterRelease",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_RELEASE,
+                                        &params);
+        logger.info("   <--- urAdapterRelease({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urAdapterRetain
+__urdlllocal ur_result_t UR_APICALL urAdapterRetain(
+    ur_adapter_handle_t hAdapter ///< [in][retain] Adapter handle to retain
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_RETAIN)) {
+        return validation::urAdapterRetain(hAdapter);
+    }
+
+    ur_adapter_retain_params_t params = {&hAdapter};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_RETAIN,
+                                                   "urAdapterRetain", &params,
+                                                   hAdapter);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urAdapterRetain\n");
+
+    ur_result_t result = validation::urAdapterRetain(hAdapter);
+
+    getContext()->notify_end(UR_FUNCTION_ADAPTER_RETAIN, "urAdapterRetain",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_RETAIN,
+                                        &params);
+        logger.info("   <--- urAdapterRetain({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urAdapterGetLastError
+__urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
+    ur_adapter_handle_t hAdapter, ///< [in] handle of the adapter instance
+    const char **
+        ppMessage, ///< [out] pointer to a C string where the adapter specific error message
+                   ///< will be stored.
+    int32_t *
+        pError ///< [out] pointer to an integer where the adapter specific error code will
+               ///< be stored.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET_LAST_ERROR)) {
+        return validation::urAdapterGetLastError(hAdapter, ppMessage, pError);
+    }
+
+    ur_adapter_get_last_error_params_t params = {&hAdapter, &ppMessage,
+                                                 &pError};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ADAPTER_GET_LAST_ERROR, "urAdapterGetLastError", &params,
+        hAdapter, ppMessage, pError);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urAdapterGetLastError\n");
+
+    ur_result_t result = validation::urAdapterGetLastError(hAdapter, ppMessage,
+                                                           pError);
+
+    getContext()->notify_end(UR_FUNCTION_ADAPTER_GET_LAST_ERROR,
+                             "urAdapterGetLastError", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ADAPTER_GET_LAST_ERROR, &params);
+        logger.info("   <--- urAdapterGetLastError({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urAdapterGetInfo
+__urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
+    ur_adapter_handle_t hAdapter, ///< [in] handle of the adapter
+    ur_adapter_info_t propName,   ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If Size is not equal to or greater to the real number of bytes needed
+    ///< to return the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is
+    ///< returned and pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual number of bytes being queried by pPropValue.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET_INFO)) {
+        return validation::urAdapterGetInfo(hAdapter, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+    }
+
+    ur_adapter_get_info_params_t params = {&hAdapter, &propName, &propSize,
+                                           &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_GET_INFO,
+                                                   "urAdapterGetInfo", &params,
+                                                   hAdapter, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urAdapterGetInfo\n");
+
+    ur_result_t result = validation::urAdapterGetInfo(hAdapter, propName,
+                                                      propSize, pPropValue,
+                                                      pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_ADAPTER_GET_INFO, "urAdapterGetInfo",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_GET_INFO,
+                                        &params);
+        logger.info("   <--- urAdapterGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urPlatformGet
+__urdlllocal ur_result_t UR_APICALL urPlatformGet(
+    ur_adapter_handle_t *
+        phAdapters, ///< [in][range(0, NumAdapters)] array of adapters to query for platforms.
+    uint32_t NumAdapters, ///< [in] number of adapters pointed to by phAdapters
+    uint32_t
+        NumEntries, ///< [in] the number of platforms to be added to phPlatforms.
+    ///< If phPlatforms is not NULL, then NumEntries should be greater than
+    ///< zero, otherwise ::UR_RESULT_ERROR_INVALID_SIZE,
+    ///< will be returned.
+    ur_platform_handle_t *
+        phPlatforms, ///< [out][optional][range(0, NumEntries)] array of handle of platforms.
+    ///< If NumEntries is less than the number of platforms available, then
+    ///< ::urPlatformGet shall only retrieve that number of platforms.
+    uint32_t *
+        pNumPlatforms ///< [out][optional] returns the total number of platforms available.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET)) {
+        return validation::urPlatformGet(phAdapters, NumAdapters, NumEntries,
+                                         phPlatforms, pNumPlatforms);
+    }
+
+    ur_platform_get_params_t params = {&phAdapters, &NumAdapters, &NumEntries,
+                                       &phPlatforms, &pNumPlatforms};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET,
+                                                   "urPlatformGet", &params,
+                                                   phAdapters, NumAdapters,
+                                                   NumEntries, phPlatforms,
+                                                   pNumPlatforms);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urPlatformGet\n");
+
+    ur_result_t result = validation::urPlatformGet(phAdapters, NumAdapters,
+                                                   NumEntries, phPlatforms,
+                                                   pNumPlatforms);
+
+    getContext()->notify_end(UR_FUNCTION_PLATFORM_GET, "urPlatformGet", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PLATFORM_GET,
+                                        &params);
+        logger.info("   <--- urPlatformGet({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urPlatformGetInfo
+__urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
+    ur_platform_handle_t hPlatform, ///< [in] handle of the platform
+    ur_platform_info_t propName,    ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPlatformInfo.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If Size is not equal to or greater to the real number of bytes needed
+    ///< to return the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is
+    ///< returned and pPlatformInfo is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual number of bytes being queried by pPlatformInfo.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_INFO)) {
+        return validation::urPlatformGetInfo(hPlatform, propName, propSize,
+                                             pPropValue, pPropSizeRet);
+    }
+
+    ur_platform_get_info_params_t params = {&hPlatform, &propName, &propSize,
+                                            &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PLATFORM_GET_INFO, "urPlatformGetInfo", &params, hPlatform,
+        propName, propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urPlatformGetInfo\n");
+
+    ur_result_t result = validation::urPlatformGetInfo(hPlatform, propName,
+                                                       propSize, pPropValue,
+                                                       pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_PLATFORM_GET_INFO, "urPlatformGetInfo",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PLATFORM_GET_INFO,
+                                        &params);
+        logger.info("   <--- urPlatformGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urPlatformGetApiVersion
+__urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
+    ur_platform_handle_t hPlatform, ///< [in] handle of the platform
+    ur_api_version_t *pVersion      ///< [out] api version
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_API_VERSION)) {
+        return validation::urPlatformGetApiVersion(hPlatform, pVersion);
+    }
+
+    ur_platform_get_api_version_params_t params = {&hPlatform, &pVersion};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PLATFORM_GET_API_VERSION, "urPlatformGetApiVersion",
+        &params, hPlatform, pVersion);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urPlatformGetApiVersion\n");
+
+    ur_result_t result = validation::urPlatformGetApiVersion(hPlatform,
+                                                             pVersion);
+
+    getContext()->notify_end(UR_FUNCTION_PLATFORM_GET_API_VERSION,
+                             "urPlatformGetApiVersion", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PLATFORM_GET_API_VERSION, &params);
+        logger.info("   <--- urPlatformGetApiVersion({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urPlatformGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
+    ur_platform_handle_t hPlatform, ///< [in] handle of the platform.
+    ur_native_handle_t *
+        phNativePlatform ///< [out] a pointer to the native handle of the platform.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE)) {
+        return validation::urPlatformGetNativeHandle(hPlatform,
+                                                     phNativePlatform);
+    }
+
+    ur_platform_get_native_handle_params_t params = {&hPlatform,
+                                                     &phNativePlatform};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE, "urPlatformGetNativeHandle",
+        &params, hPlatform, phNativePlatform);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urPlatformGetNativeHandle\n");
+
+    ur_result_t result = validation::urPlatformGetNativeHandle(
+        hPlatform, phNativePlatform);
+
+    getContext()->notify_end(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE,
+                             "urPlatformGetNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE, &params);
+        logger.info("   <--- urPlatformGetNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urPlatformCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativePlatform, ///< [in][nocheck] the native handle of the platform.
+    ur_adapter_handle_t
+        hAdapter, ///< [in] handle of the adapter associated with the native backend.
+    const ur_platform_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native platform properties struct.
+    ur_platform_handle_t *
+        phPlatform ///< [out] pointer to the handle of the platform object created.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE)) {
+        return validation::urPlatformCreateWithNativeHandle(hNativePlatform,
+                                                            hAdapter,
+                                                            pProperties,
+                                                            phPlatform);
+    }
+
+    ur_platform_create_with_native_handle_params_t params = {
+        &hNativePlatform, &hAdapter, &pProperties, &phPlatform};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE,
+        "urPlatformCreateWithNativeHandle", &params, hNativePlatform, hAdapter,
+        pProperties, phPlatform);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urPlatformCreateWithNativeHandle\n");
+
+    ur_result_t result = validation::urPlatformCreateWithNativeHandle(
+        hNativePlatform, hAdapter, pProperties, phPlatform);
+
+    getContext()->notify_end(UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE,
+                             "urPlatformCreateWithNativeHandle", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE, &params);
+        logger.info("   <--- urPlatformCreateWithNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urPlatformGetBackendOption
+__urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
+    ur_platform_handle_t hPlatform, ///< [in] handle of the platform instance.
+    const char
+        *pFrontendOption, ///< [in] string containing the frontend option.
+    const char **
+        ppPlatformOption ///< [out] returns the correct platform specific compiler option based on
+                         ///< the frontend option.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION)) {
+        return validation::urPlatformGetBackendOption(hPlatform,
+                                                      pFrontendOption,
+                                                      ppPlatformOption);
+    }
+
+    ur_platform_get_backend_option_params_t params = {
+        &hPlatform, &pFrontendOption, &ppPlatformOption};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION, "urPlatformGetBackendOption",
+        &params, hPlatform, pFrontendOption, ppPlatformOption);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urPlatformGetBackendOption\n");
+
+    ur_result_t result = validation::urPlatformGetBackendOption(
+        hPlatform, pFrontendOption, ppPlatformOption);
+
+    getContext()->notify_end(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION,
+                             "urPlatformGetBackendOption", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION, &params);
+        logger.info("   <--- urPlatformGetBackendOption({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urDeviceGet
+__urdlllocal ur_result_t UR_APICALL urDeviceGet(
+    ur_platform_handle_t hPlatform, ///< [in] handle of the platform instance
+    ur_device_type_t DeviceType,    ///< [in] the type of the devices.
+    uint32_t
+        NumEntries, ///< [in] the number of devices to be added to phDevices.
+    ///< If phDevices is not NULL, then NumEntries should be greater than zero.
+    ///< Otherwise ::UR_RESULT_ERROR_INVALID_SIZE
+    ///< will be returned.
+    ur_device_handle_t *
+        phDevices, ///< [out][optional][range(0, NumEntries)] array of handle of devices.
+    ///< If NumEntries is less than the number of devices available, then
+    ///< platform shall only retrieve that number of devices.
+    uint32_t *pNumDevices ///< [out][optional] pointer to the number of devices.
+    ///< pNumDevices will be updated with the total number of devices available.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET)) {
+        return validation::urDeviceGet(hPlatform, DeviceType, NumEntries,
+                                       phDevices, pNumDevices);
+    }
+
+    ur_device_get_params_t params = {&hPlatform, &DeviceType, &NumEntries,
+                                     &phDevices, &pNumDevices};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_GET,
+                                                   "urDeviceGet", &params,
+                                                   hPlatform, DeviceType,
+                                                   NumEntries, phDevices,
+                                                   pNumDevices);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urDeviceGet\n");
+
+    ur_result_t result = validation::urDeviceGet(hPlatform, DeviceType,
+                                                 NumEntries, phDevices,
+                                                 pNumDevices);
+
+    getContext()->notify_end(UR_FUNCTION_DEVICE_GET, "urDeviceGet", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_GET,
+                                        &params);
+        logger.info("   <--- urDeviceGet({}) -> {};\n", args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urDeviceGetInfo
+__urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
+    ur_device_handle_t hDevice, ///< [in] handle of the device instance
+    ur_device_info_t propName,  ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return the info
+    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_INFO)) {
+        return validation::urDeviceGetInfo(hDevice, propName, propSize,
+                                           pPropValue, pPropSizeRet);
+    }
+
+    ur_device_get_info_params_t params = {&hDevice, &propName, &propSize,
+                                          &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_GET_INFO,
+                                                   "urDeviceGetInfo", &params,
+                                                   hDevice, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urDeviceGetInfo\n");
+
+    ur_result_t result = validation::urDeviceGetInfo(hDevice, propName,
+                                                     propSize, pPropValue,
+                                                     pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_DEVICE_GET_INFO, "urDeviceGetInfo",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_GET_INFO,
+                                        &params);
+        logger.info("   <--- urDeviceGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urDeviceRetain
+__urdlllocal ur_result_t UR_APICALL urDeviceRetain(
+    ur_device_handle_t
+        hDevice ///< [in][retain] handle of the device to get a reference of.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_RETAIN)) {
+        return validation::urDeviceRetain(hDevice);
+    }
+
+    ur_device_retain_params_t params = {&hDevice};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_RETAIN,
+                                                   "urDeviceRetain", &params,
+                                                   hDevice);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urDeviceRetain\n");
+
+    ur_result_t result = validation::urDeviceRetain(hDevice);
+
+    getContext()->notify_end(UR_FUNCTION_DEVICE_RETAIN, "urDeviceRetain",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_RETAIN,
+                                        &params);
+        logger.info("   <--- urDeviceRetain({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urDeviceRelease
+__urdlllocal ur_result_t UR_APICALL urDeviceRelease(
+    ur_device_handle_t
+        hDevice ///< [in][release] handle of the device to release.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_RELEASE)) {
+        return validation::urDeviceRelease(hDevice);
+    }
+
+    ur_device_release_params_t params = {&hDevice};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_RELEASE,
+                                                   "urDeviceRelease", &params,
+                                                   hDevice);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urDeviceRelease\n");
+
+    ur_result_t result = validation::urDeviceRelease(hDevice);
+
+    getContext()->notify_end(UR_FUNCTION_DEVICE_RELEASE, "urDeviceRelease",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_RELEASE,
+                                        &params);
+        logger.info("   <--- urDeviceRelease({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urDevicePartition
+__urdlllocal ur_result_t UR_APICALL urDevicePartition(
+    ur_device_handle_t hDevice, ///< [in] handle of the device to partition.
+    const ur_device_partition_properties_t
+        *pProperties,    ///< [in] Device partition properties.
+    uint32_t NumDevices, ///< [in] the number of sub-devices.
+    ur_device_handle_t *
+        phSubDevices, ///< [out][optional][range(0, NumDevices)] array of handle of devices.
+    ///< If NumDevices is less than the number of sub-devices available, then
+    ///< the function shall only retrieve that number of sub-devices.
+    uint32_t *
+        pNumDevicesRet ///< [out][optional] pointer to the number of sub-devices the device can be
+    ///< partitioned into according to the partitioning property.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_PARTITION)) {
+        return validation::urDevicePartition(hDevice, pProperties, NumDevices,
+                                             phSubDevices, pNumDevicesRet);
+    }
+
+    ur_device_partition_params_t params = {&hDevice, &pProperties, &NumDevices,
+                                           &phSubDevices, &pNumDevicesRet};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_PARTITION,
+                                                   "urDevicePartition", &params,
+                                                   hDevice, pProperties,
+                                                   NumDevices, phSubDevices,
+                                                   pNumDevicesRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urDevicePartition\n");
+
+    ur_result_t result = validation::urDevicePartition(hDevice, pProperties,
+                                                       NumDevices, phSubDevices,
+                                                       pNumDevicesRet);
+
+    getContext()->notify_end(UR_FUNCTION_DEVICE_PARTITION, "urDevicePartition",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_PARTITION,
+                                        &params);
+        logger.info("   <--- urDevicePartition({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urDeviceSelectBinary
+__urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device to select binary for.
+    const ur_device_binary_t
+        *pBinaries,       ///< [in] the array of binaries to select from.
+    uint32_t NumBinaries, ///< [in] the number of binaries passed in ppBinaries.
+                          ///< Must greater than or equal to zero otherwise
+                          ///< ::UR_RESULT_ERROR_INVALID_VALUE is returned.
+    uint32_t *
+        pSelectedBinary ///< [out] the index of the selected binary in the input array of binaries.
+    ///< If a suitable binary was not found the function returns ::UR_RESULT_ERROR_INVALID_BINARY.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_SELECT_BINARY)) {
+        return validation::urDeviceSelectBinary(hDevice, pBinaries, NumBinaries,
+                                                pSelectedBinary);
+    }
+
+    ur_device_select_binary_params_t params = {&hDevice, &pBinaries,
+                                               &NumBinaries, &pSelectedBinary};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_DEVICE_SELECT_BINARY, "urDeviceSelectBinary", &params,
+        hDevice, pBinaries, NumBinaries, pSelectedBinary);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urDeviceSelectBinary\n");
+
+    ur_result_t result = validation::urDeviceSelectBinary(hDevice, pBinaries,
+                                                          NumBinaries,
+                                                          pSelectedBinary);
+
+    getContext()->notify_end(UR_FUNCTION_DEVICE_SELECT_BINARY,
+                             "urDeviceSelectBinary", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_DEVICE_SELECT_BINARY, &params);
+        logger.info("   <--- urDeviceSelectBinary({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urDeviceGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
+    ur_device_handle_t hDevice, ///< [in] handle of the device.
+    ur_native_handle_t
+        *phNativeDevice ///< [out] a pointer to the native handle of the device.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE)) {
+        return validation::urDeviceGetNativeHandle(hDevice, phNativeDevice);
+    }
+
+    ur_device_get_native_handle_params_t params = {&hDevice, &phNativeDevice};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE, "urDeviceGetNativeHandle",
+        &params, hDevice, phNativeDevice);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urDeviceGetNativeHandle\n");
+
+    ur_result_t result = validation::urDeviceGetNativeHandle(hDevice,
+                                                             phNativeDevice);
+
+    getContext()->notify_end(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE,
+                             "urDeviceGetNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE, &params);
+        logger.info("   <--- urDeviceGetNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urDeviceCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeDevice, ///< [in][nocheck] the native handle of the device.
+    ur_adapter_handle_t
+        hAdapter, ///< [in] handle of the adapter to which `hNativeDevice` belongs
+    const ur_device_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native device properties struct.
+    ur_device_handle_t
+        *phDevice ///< [out] pointer to the handle of the device object created.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE)) {
+        return validation::urDeviceCreateWithNativeHandle(hNativeDevice,
+                                                          hAdapter, pProperties,
+                                                          phDevice);
+    }
+
+    ur_device_create_with_native_handle_params_t params = {
+        &hNativeDevice, &hAdapter, &pProperties, &phDevice};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE,
+        "urDeviceCreateWithNativeHandle", &params, hNativeDevice, hAdapter,
+        pProperties, phDevice);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urDeviceCreateWithNativeHandle\n");
+
+    ur_result_t result = validation::urDeviceCreateWithNativeHandle(
+        hNativeDevice, hAdapter, pProperties, phDevice);
+
+    getContext()->notify_end(UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE,
+                             "urDeviceCreateWithNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE, &params);
+        logger.info("   <--- urDeviceCreateWithNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urDeviceGetGlobalTimestamps
+__urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
+    ur_device_handle_t hDevice, ///< [in] handle of the device instance
+    uint64_t *
+        pDeviceTimestamp, ///< [out][optional] pointer to the Device's global timestamp that
+                          ///< correlates with the Host's global timestamp value
+    uint64_t *
+        pHostTimestamp ///< [out][optional] pointer to the Host's global timestamp that
+                       ///< correlates with the Device's global timestamp value
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS)) {
+        return validation::urDeviceGetGlobalTimestamps(hDevice,
+                                                       pDeviceTimestamp,
+                                                       pHostTimestamp);
+    }
+
+    ur_device_get_global_timestamps_params_t params = {
+        &hDevice, &pDeviceTimestamp, &pHostTimestamp};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS, "urDeviceGetGlobalTimestamps",
+        &params, hDevice, pDeviceTimestamp, pHostTimestamp);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urDeviceGetGlobalTimestamps\n");
+
+    ur_result_t result = validation::urDeviceGetGlobalTimestamps(
+        hDevice, pDeviceTimestamp, pHostTimestamp);
+
+    getContext()->notify_end(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS,
+                             "urDeviceGetGlobalTimestamps", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS, &params);
+        logger.info("   <--- urDeviceGetGlobalTimestamps({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urContextCreate
+__urdlllocal ur_result_t UR_APICALL urContextCreate(
+    uint32_t DeviceCount, ///< [in] the number of devices given in phDevices
+    const ur_device_handle_t
+        *phDevices, ///< [in][range(0, DeviceCount)] array of handle of devices.
+    const ur_context_properties_t *
+        pProperties, ///< [in][optional] pointer to context creation properties.
+    ur_context_handle_t
+        *phContext ///< [out] pointer to handle of context object created
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_CREATE)) {
+        return validation::urContextCreate(DeviceCount, phDevices, pProperties,
+                                           phContext);
+    }
+
+    ur_context_create_params_t params = {&DeviceCount, &phDevices, &pProperties,
+                                         &phContext};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_CREATE,
+                                                   "urContextCreate", &params,
+                                                   DeviceCount, phDevices,
+                                                   pProperties, phContext);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urContextCreate\n");
+
+    ur_result_t result = validation::urContextCreate(DeviceCount, phDevices,
+                                                     pProperties, phContext);
+
+    getContext()->notify_end(UR_FUNCTION_CONTEXT_CREATE, "urContextCreate",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_CREATE,
+                                        &params);
+        logger.info("   <--- urContextCreate({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urContextRetain
+__urdlllocal ur_result_t UR_APICALL urContextRetain(
+    ur_context_handle_t
+        hContext ///< [in][retain] handle of the context to get a reference of.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_RETAIN)) {
+        return validation::urContextRetain(hContext);
+    }
+
+    ur_context_retain_params_t params = {&hContext};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_RETAIN,
+                                                   "urContextRetain", &params,
+                                                   hContext);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urContextRetain\n");
+
+    ur_result_t result = validation::urContextRetain(hContext);
+
+    getContext()->notify_end(UR_FUNCTION_CONTEXT_RETAIN, "urContextRetain",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_RETAIN,
+                                        &params);
+        logger.info("   <--- urContextRetain({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urContextRelease
+__urdlllocal ur_result_t UR_APICALL urContextRelease(
+    ur_context_handle_t
+        hContext ///< [in][release] handle of the context to release.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_RELEASE)) {
+        return validation::urContextRelease(hContext);
+    }
+
+    ur_context_release_params_t params = {&hContext};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_RELEASE,
+                                                   "urContextRelease", &params,
+                                                   hContext);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urContextRelease\n");
+
+    ur_result_t result = validation::urContextRelease(hContext);
+
+    getContext()->notify_end(UR_FUNCTION_CONTEXT_RELEASE, "urContextRelease",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_RELEASE,
+                                        &params);
+        logger.info("   <--- urContextRelease({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urContextGetInfo
+__urdlllocal ur_result_t UR_APICALL urContextGetInfo(
+    ur_context_handle_t hContext, ///< [in] handle of the context
+    ur_context_info_t propName,   ///< [in] type of the info to retrieve
+    size_t
+        propSize, ///< [in] the number of bytes of memory pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< if propSize is not equal to or greater than the real number of bytes
+    ///< needed to return
+    ///< the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_GET_INFO)) {
+        return validation::urContextGetInfo(hContext, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+    }
+
+    ur_context_get_info_params_t params = {&hContext, &propName, &propSize,
+                                           &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_GET_INFO,
+                                                   "urContextGetInfo", &params,
+                                                   hContext, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urContextGetInfo\n");
+
+    ur_result_t result = validation::urContextGetInfo(hContext, propName,
+                                                      propSize, pPropValue,
+                                                      pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_CONTEXT_GET_INFO, "urContextGetInfo",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_GET_INFO,
+                                        &params);
+        logger.info("   <--- urContextGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urContextGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
+    ur_context_handle_t hContext, ///< [in] handle of the context.
+    ur_native_handle_t *
+        phNativeContext ///< [out] a pointer to the native handle of the context.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE)) {
+        return validation::urContextGetNativeHandle(hContext, phNativeContext);
+    }
+
+    ur_context_get_native_handle_params_t params = {&hContext,
+                                                    &phNativeContext};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE, "urContextGetNativeHandle",
+        &params, hContext, phNativeContext);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urContextGetNativeHandle\n");
+
+    ur_result_t result = validation::urContextGetNativeHandle(hContext,
+                                                              phNativeContext);
+
+    getContext()->notify_end(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE,
+                             "urContextGetNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE, &params);
+        logger.info("   <--- urContextGetNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urContextCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeContext, ///< [in][nocheck] the native handle of the context.
+    ur_adapter_handle_t
+        hAdapter, ///< [in] handle of the adapter that owns the native handle
+    uint32_t numDevices, ///< [in] number of devices associated with the context
+    const ur_device_handle_t *
+        phDevices, ///< [in][optional][range(0, numDevices)] list of devices associated with
+                   ///< the context
+    const ur_context_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native context properties struct
+    ur_context_handle_t *
+        phContext ///< [out] pointer to the handle of the context object created.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE)) {
+        return validation::urContextCreateWithNativeHandle(hNativeContext,
+                                                           hAdapter, numDevices,
+                                                           phDevices,
+                                                           pProperties,
+                                                           phContext);
+    }
+
+    ur_context_create_with_native_handle_params_t params = {
+        &hNativeContext, &hAdapter,    &numDevices,
+        &phDevices,      &pProperties, &phContext};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE,
+        "urContextCreateWithNativeHandle", &params, hNativeContext, hAdapter,
+        numDevices, phDevices, pProperties, phContext);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urContextCreateWithNativeHandle\n");
+
+    ur_result_t result = validation::urContextCreateWithNativeHandle(
+        hNativeContext, hAdapter, numDevices, phDevices, pProperties,
+        phContext);
+
+    getContext()->notify_end(UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE,
+                             "urContextCreateWithNativeHandle", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE, &params);
+        logger.info("   <--- urContextCreateWithNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urContextSetExtendedDeleter
+__urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
+    ur_context_handle_t hContext, ///< [in] handle of the context.
+    ur_context_extended_deleter_t
+        pfnDeleter, ///< [in] Function pointer to extended deleter.
+    void *
+        pUserData ///< [in][out][optional] pointer to data to be passed to callback.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER)) {
+        return validation::urContextSetExtendedDeleter(hContext, pfnDeleter,
+                                                       pUserData);
+    }
+
+    ur_context_set_extended_deleter_params_t params = {&hContext, &pfnDeleter,
+                                                       &pUserData};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER, "urContextSetExtendedDeleter",
+        &params, hContext, pfnDeleter, pUserData);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urContextSetExtendedDeleter\n");
+
+    ur_result_t result = validation::urContextSetExtendedDeleter(hContext,
+                                                                 pfnDeleter,
+                                                                 pUserData);
+
+    getContext()->notify_end(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER,
+                             "urContextSetExtendedDeleter", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER, &params);
+        logger.info("   <--- urContextSetExtendedDeleter({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urMemImageCreate
+__urdlllocal ur_result_t UR_APICALL urMemImageCreate(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_mem_flags_t flags, ///< [in] allocation and usage information flags
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
+    void *pHost,           ///< [in][optional] pointer to the buffer data
+    ur_mem_handle_t *phMem ///< [out] pointer to handle of image object created
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_IMAGE_CREATE)) {
+        return validation::urMemImageCreate(hContext, flags, pImageFormat,
+                                            pImageDesc, pHost, phMem);
+    }
+
+    ur_mem_image_create_params_t params = {&hContext,   &flags, &pImageFormat,
+                                           &pImageDesc, &pHost, &phMem};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_IMAGE_CREATE,
+                                                   "urMemImageCreate", &params,
+                                                   hContext, flags,
+                                                   pImageFormat, pImageDesc,
+                                                   pHost, phMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urMemImageCreate\n");
+
+    ur_result_t result = validation::urMemImageCreate(hContext, flags,
+                                                      pImageFormat, pImageDesc,
+                                                      pHost, phMem);
+
+    getContext()->notify_end(UR_FUNCTION_MEM_IMAGE_CREATE, "urMemImageCreate",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_IMAGE_CREATE,
+                                        &params);
+        logger.info("   <--- urMemImageCreate({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urMemBufferCreate
+__urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_mem_flags_t flags, ///< [in] allocation and usage information flags
+    size_t size, ///< [in] size in bytes of the memory object to be allocated
+    const ur_buffer_properties_t
+        *pProperties, ///< [in][optional] pointer to buffer creation properties
+    ur_mem_handle_t
+        *phBuffer ///< [out] pointer to handle of the memory buffer created
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_BUFFER_CREATE)) {
+        return validation::urMemBufferCreate(hContext, flags, size, pProperties,
+                                             phBuffer);
+    }
+
+    ur_mem_buffer_create_params_t params = {&hContext, &flags, &size,
+                                            &pProperties, &phBuffer};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_MEM_BUFFER_CREATE, "urMemBufferCreate", &params, hContext,
+        flags, size, pProperties, phBuffer);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urMemBufferCreate\n");
+
+    ur_result_t result = validation::urMemBufferCreate(hContext, flags, size,
+                                                       pProperties, phBuffer);
+
+    getContext()->notify_end(UR_FUNCTION_MEM_BUFFER_CREATE, "urMemBufferCreate",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_BUFFER_CREATE,
+                                        &params);
+        logger.info("   <--- urMemBufferCreate({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urMemRetain
+__urdlllocal ur_result_t UR_APICALL urMemRetain(
+    ur_mem_handle_t
+        hMem ///< [in][retain] handle of the memory object to get access
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_RETAIN)) {
+        return validation::urMemRetain(hMem);
+    }
+
+    ur_mem_retain_params_t params = {&hMem};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_RETAIN,
+                                                   "urMemRetain", &params,
+                                                   hMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urMemRetain\n");
+
+    ur_result_t result = validation::urMemRetain(hMem);
+
+    getContext()->notify_end(UR_FUNCTION_MEM_RETAIN, "urMemRetain", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_RETAIN,
+                                        &params);
+        logger.info("   <--- urMemRetain({}) -> {};\n", args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urMemRelease
+__urdlllocal ur_result_t UR_APICALL urMemRelease(
+    ur_mem_handle_t
+        hMem ///< [in][release] handle of the memory object to release
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_RELEASE)) {
+        return validation::urMemRelease(hMem);
+    }
+
+    ur_mem_release_params_t params = {&hMem};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_RELEASE,
+                                                   "urMemRelease", &params,
+                                                   hMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urMemRelease\n");
+
+    ur_result_t result = validation::urMemRelease(hMem);
+
+    getContext()->notify_end(UR_FUNCTION_MEM_RELEASE, "urMemRelease", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_RELEASE,
+                                        &params);
+        logger.info("   <--- urMemRelease({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urMemBufferPartition
+__urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
+    ur_mem_handle_t
+        hBuffer,          ///< [in] handle of the buffer object to allocate from
+    ur_mem_flags_t flags, ///< [in] allocation and usage information flags
+    ur_buffer_create_type_t bufferCreateType, ///< [in] buffer creation type
+    const ur_buffer_region_t
+        *pRegion, ///< [in] pointer to buffer create region information
+    ur_mem_handle_t
+        *phMem ///< [out] pointer to the handle of sub buffer created
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_BUFFER_PARTITION)) {
+        return validation::urMemBufferPartition(hBuffer, flags,
+                                                bufferCreateType, pRegion,
+                                                phMem);
+    }
+
+    ur_mem_buffer_partition_params_t params = {
+        &hBuffer, &flags, &bufferCreateType, &pRegion, &phMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_MEM_BUFFER_PARTITION, "urMemBufferPartition", &params,
+        hBuffer, flags, bufferCreateType, pRegion, phMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urMemBufferPartition\n");
+
+    ur_result_t result = validation::urMemBufferPartition(hBuffer, flags,
+                                                          bufferCreateType,
+                                                          pRegion, phMem);
+
+    getContext()->notify_end(UR_FUNCTION_MEM_BUFFER_PARTITION,
+                             "urMemBufferPartition", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_MEM_BUFFER_PARTITION, &params);
+        logger.info("   <--- urMemBufferPartition({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urMemGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
+    ur_mem_handle_t hMem, ///< [in] handle of the mem.
+    ur_device_handle_t
+        hDevice, ///< [in][optional] handle of the device that the native handle will be
+                 ///< resident on.
+    ur_native_handle_t
+        *phNativeMem ///< [out] a pointer to the native handle of the mem.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_GET_NATIVE_HANDLE)) {
+        return validation::urMemGetNativeHandle(hMem, hDevice, phNativeMem);
+    }
+
+    ur_mem_get_native_handle_params_t params = {&hMem, &hDevice, &phNativeMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_MEM_GET_NATIVE_HANDLE, "urMemGetNativeHandle", &params,
+        hMem, hDevice, phNativeMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urMemGetNativeHandle\n");
+
+    ur_result_t result = validation::urMemGetNativeHandle(hMem, hDevice,
+                                                          phNativeMem);
+
+    getContext()->notify_end(UR_FUNCTION_MEM_GET_NATIVE_HANDLE,
+                             "urMemGetNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_MEM_GET_NATIVE_HANDLE, &params);
+        logger.info("   <--- urMemGetNativeHandle({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urMemBufferCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeMem, ///< [in][nocheck] the native handle to the memory.
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    const ur_mem_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native memory creation properties.
+    ur_mem_handle_t
+        *phMem ///< [out] pointer to handle of buffer memory object created.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE)) {
+        return validation::urMemBufferCreateWithNativeHandle(hNativeMem,
+                                                             hContext,
+                                                             pProperties,
+                                                             phMem);
+    }
+
+    ur_mem_buffer_create_with_native_handle_params_t params = {
+        &hNativeMem, &hContext, &pProperties, &phMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE,
+        "urMemBufferCreateWithNativeHandle", &params, hNativeMem, hContext,
+        pProperties, phMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urMemBufferCreateWithNativeHandle\n");
+
+    ur_result_t result = validation::urMemBufferCreateWithNativeHandle(
+        hNativeMem, hContext, pProperties, phMem);
+
+    getContext()->notify_end(UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE,
+                             "urMemBufferCreateWithNativeHandle", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE,
+            &params);
+        logger.info("   <--- urMemBufferCreateWithNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urMemImageCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeMem, ///< [in][nocheck] the native handle to the memory.
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification.
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description.
+    const ur_mem_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native memory creation properties.
+    ur_mem_handle_t
+        *phMem ///< [out] pointer to handle of image memory object created.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE)) {
+        return validation::urMemImageCreateWithNativeHandle(hNativeMem,
+                                                            hContext,
+                                                            pImageFormat,
+                                                            pImageDesc,
+                                                            pProperties, phMem);
+    }
+
+    ur_mem_image_create_with_native_handle_params_t params = {
+        &hNativeMem, &hContext,    &pImageFormat,
+        &pImageDesc, &pProperties, &phMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE,
+        "urMemImageCreateWithNativeHandle", &params, hNativeMem, hContext,
+        pImageFormat, pImageDesc, pProperties, phMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urMemImageCreateWithNativeHandle\n");
+
+    ur_result_t result = validation::urMemImageCreateWithNativeHandle(
+        hNativeMem, hContext, pImageFormat, pImageDesc, pProperties, phMem);
+
+    getContext()->notify_end(UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE,
+                             "urMemImageCreateWithNativeHandle", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE, &params);
+        logger.info("   <--- urMemImageCreateWithNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urMemGetInfo
+__urdlllocal ur_result_t UR_APICALL urMemGetInfo(
+    ur_mem_handle_t
+        hMemory,            ///< [in] handle to the memory object being queried.
+    ur_mem_info_t propName, ///< [in] type of the info to retrieve.
+    size_t
+        propSize, ///< [in] the number of bytes of memory pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is less than the real number of bytes needed to return
+    ///< the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_GET_INFO)) {
+        return validation::urMemGetInfo(hMemory, propName, propSize, pPropValue,
+                                        pPropSizeRet);
+    }
+
+    ur_mem_get_info_params_t params = {&hMemory, &propName, &propSize,
+                                       &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_GET_INFO,
+                                                   "urMemGetInfo", &params,
+                                                   hMemory, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urMemGetInfo\n");
+
+    ur_result_t result = validation::urMemGetInfo(hMemory, propName, propSize,
+                                                  pPropValue, pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_MEM_GET_INFO, "urMemGetInfo", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_GET_INFO,
+                                        &params);
+        logger.info("   <--- urMemGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urMemImageGetInfo
+__urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
+    ur_mem_handle_t hMemory, ///< [in] handle to the image object being queried.
+    ur_image_info_t propName, ///< [in] type of image info to retrieve.
+    size_t
+        propSize, ///< [in] the number of bytes of memory pointer to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is less than the real number of bytes needed to return
+    ///< the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_IMAGE_GET_INFO)) {
+        return validation::urMemImageGetInfo(hMemory, propName, propSize,
+                                             pPropValue, pPropSizeRet);
+    }
+
+    ur_mem_image_get_info_params_t params = {&hMemory, &propName, &propSize,
+                                             &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_MEM_IMAGE_GET_INFO, "urMemImageGetInfo", &params, hMemory,
+        propName, propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urMemImageGetInfo\n");
+
+    ur_result_t result = validation::urMemImageGetInfo(hMemory, propName,
+                                                       propSize, pPropValue,
+                                                       pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_MEM_IMAGE_GET_INFO,
+                             "urMemImageGetInfo", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_MEM_IMAGE_GET_INFO, &params);
+        logger.info("   <--- urMemImageGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urSamplerCreate
+__urdlllocal ur_result_t UR_APICALL urSamplerCreate(
+    ur_context_handle_t hContext,   ///< [in] handle of the context object
+    const ur_sampler_desc_t *pDesc, ///< [in] pointer to the sampler description
+    ur_sampler_handle_t
+        *phSampler ///< [out] pointer to handle of sampler object created
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_CREATE)) {
+        return validation::urSamplerCreate(hContext, pDesc, phSampler);
+    }
+
+    ur_sampler_create_params_t params = {&hContext, &pDesc, &phSampler};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_CREATE,
+                                                   "urSamplerCreate", &params,
+                                                   hContext, pDesc, phSampler);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urSamplerCreate\n");
+
+    ur_result_t result = validation::urSamplerCreate(hContext, pDesc,
+                                                     phSampler);
+
+    getContext()->notify_end(UR_FUNCTION_SAMPLER_CREATE, "urSamplerCreate",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_CREATE,
+                                        &params);
+        logger.info("   <--- urSamplerCreate({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urSamplerRetain
+__urdlllocal ur_result_t UR_APICALL urSamplerRetain(
+    ur_sampler_handle_t
+        hSampler ///< [in][retain] handle of the sampler object to get access
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_RETAIN)) {
+        return validation::urSamplerRetain(hSampler);
+    }
+
+    ur_sampler_retain_params_t params = {&hSampler};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_RETAIN,
+                                                   "urSamplerRetain", &params,
+                                                   hSampler);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urSamplerRetain\n");
+
+    ur_result_t result = validation::urSamplerRetain(hSampler);
+
+    getContext()->notify_end(UR_FUNCTION_SAMPLER_RETAIN, "urSamplerRetain",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_RETAIN,
+                                        &params);
+        logger.info("   <--- urSamplerRetain({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urSamplerRelease
+__urdlllocal ur_result_t UR_APICALL urSamplerRelease(
+    ur_sampler_handle_t
+        hSampler ///< [in][release] handle of the sampler object to release
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_RELEASE)) {
+        return validation::urSamplerRelease(hSampler);
+    }
+
+    ur_sampler_release_params_t params = {&hSampler};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_RELEASE,
+                                                   "urSamplerRelease", &params,
+                                                   hSampler);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urSamplerRelease\n");
+
+    ur_result_t result = validation::urSamplerRelease(hSampler);
+
+    getContext()->notify_end(UR_FUNCTION_SAMPLER_RELEASE, "urSamplerRelease",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_RELEASE,
+                                        &params);
+        logger.info("   <--- urSamplerRelease({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urSamplerGetInfo
+__urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
+    ur_sampler_handle_t hSampler, ///< [in] handle of the sampler object
+    ur_sampler_info_t propName, ///< [in] name of the sampler property to query
+    size_t
+        propSize, ///< [in] size in bytes of the sampler property value provided
+    void *
+        pPropValue, ///< [out][typename(propName, propSize)][optional] value of the sampler
+                    ///< property
+    size_t *
+        pPropSizeRet ///< [out][optional] size in bytes returned in sampler property value
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_GET_INFO)) {
+        return validation::urSamplerGetInfo(hSampler, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+    }
+
+    ur_sampler_get_info_params_t params = {&hSampler, &propName, &propSize,
+                                           &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_GET_INFO,
+                                                   "urSamplerGetInfo", &params,
+                                                   hSampler, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urSamplerGetInfo\n");
+
+    ur_result_t result = validation::urSamplerGetInfo(hSampler, propName,
+                                                      propSize, pPropValue,
+                                                      pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_SAMPLER_GET_INFO, "urSamplerGetInfo",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_GET_INFO,
+                                        &params);
+        logger.info("   <--- urSamplerGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urSamplerGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
+    ur_sampler_handle_t hSampler, ///< [in] handle of the sampler.
+    ur_native_handle_t *
+        phNativeSampler ///< [out] a pointer to the native handle of the sampler.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE)) {
+        return validation::urSamplerGetNativeHandle(hSampler, phNativeSampler);
+    }
+
+    ur_sampler_get_native_handle_params_t params = {&hSampler,
+                                                    &phNativeSampler};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE, "urSamplerGetNativeHandle",
+        &params, hSampler, phNativeSampler);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urSamplerGetNativeHandle\n");
+
+    ur_result_t result = validation::urSamplerGetNativeHandle(hSampler,
+                                                              phNativeSampler);
+
+    getContext()->notify_end(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE,
+                             "urSamplerGetNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE, &params);
+        logger.info("   <--- urSamplerGetNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urSamplerCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeSampler, ///< [in][nocheck] the native handle of the sampler.
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    const ur_sampler_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native sampler properties struct.
+    ur_sampler_handle_t *
+        phSampler ///< [out] pointer to the handle of the sampler object created.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE)) {
+        return validation::urSamplerCreateWithNativeHandle(hNativeSampler,
+                                                           hContext,
+                                                           pProperties,
+                                                           phSampler);
+    }
+
+    ur_sampler_create_with_native_handle_params_t params = {
+        &hNativeSampler, &hContext, &pProperties, &phSampler};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE,
+        "urSamplerCreateWithNativeHandle", &params, hNativeSampler, hContext,
+        pProperties, phSampler);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urSamplerCreateWithNativeHandle\n");
+
+    ur_result_t result = validation::urSamplerCreateWithNativeHandle(
+        hNativeSampler, hContext, pProperties, phSampler);
+
+    getContext()->notify_end(UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE,
+                             "urSamplerCreateWithNativeHandle", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE, &params);
+        logger.info("   <--- urSamplerCreateWithNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMHostAlloc
+__urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    const ur_usm_desc_t
+        *pUSMDesc, ///< [in][optional] USM memory allocation descriptor
+    ur_usm_pool_handle_t
+        pool, ///< [in][optional] Pointer to a pool created using urUSMPoolCreate
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    void **ppMem ///< [out] pointer to USM host memory object
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_HOST_ALLOC)) {
+        return validation::urUSMHostAlloc(hContext, pUSMDesc, pool, size,
+                                          ppMem);
+    }
+
+    ur_usm_host_alloc_params_t params = {&hContext, &pUSMDesc, &pool, &size,
+                                         &ppMem};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_HOST_ALLOC,
+                                                   "urUSMHostAlloc", &params,
+                                                   hContext, pUSMDesc, pool,
+                                                   size, ppMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMHostAlloc\n");
+
+    ur_result_t result = validation::urUSMHostAlloc(hContext, pUSMDesc, pool,
+                                                    size, ppMem);
+
+    getContext()->notify_end(UR_FUNCTION_USM_HOST_ALLOC, "urUSMHostAlloc",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_HOST_ALLOC,
+                                        &params);
+        logger.info("   <--- urUSMHostAlloc({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMDeviceAlloc
+__urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_usm_desc_t
+        *pUSMDesc, ///< [in][optional] USM memory allocation descriptor
+    ur_usm_pool_handle_t
+        pool, ///< [in][optional] Pointer to a pool created using urUSMPoolCreate
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    void **ppMem ///< [out] pointer to USM device memory object
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_DEVICE_ALLOC)) {
+        return validation::urUSMDeviceAlloc(hContext, hDevice, pUSMDesc, pool,
+                                            size, ppMem);
+    }
+
+    ur_usm_device_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
+                                           &pool,     &size,    &ppMem};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_DEVICE_ALLOC,
+                                                   "urUSMDeviceAlloc", &params,
+                                                   hContext, hDevice, pUSMDesc,
+                                                   pool, size, ppMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMDeviceAlloc\n");
+
+    ur_result_t result = validation::urUSMDeviceAlloc(hContext, hDevice,
+                                                      pUSMDesc, pool, size,
+                                                      ppMem);
+
+    getContext()->notify_end(UR_FUNCTION_USM_DEVICE_ALLOC, "urUSMDeviceAlloc",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_DEVICE_ALLOC,
+                                        &params);
+        logger.info("   <--- urUSMDeviceAlloc({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMSharedAlloc
+__urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_usm_desc_t *
+        pUSMDesc, ///< [in][optional] Pointer to USM memory allocation descriptor.
+    ur_usm_pool_handle_t
+        pool, ///< [in][optional] Pointer to a pool created using urUSMPoolCreate
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    void **ppMem ///< [out] pointer to USM shared memory object
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_SHARED_ALLOC)) {
+        return validation::urUSMSharedAlloc(hContext, hDevice, pUSMDesc, pool,
+                                            size, ppMem);
+    }
+
+    ur_usm_shared_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
+                                           &pool,     &size,    &ppMem};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_SHARED_ALLOC,
+                                                   "urUSMSharedAlloc", &params,
+                                                   hContext, hDevice, pUSMDesc,
+                                                   pool, size, ppMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMSharedAlloc\n");
+
+    ur_result_t result = validation::urUSMSharedAlloc(hContext, hDevice,
+                                                      pUSMDesc, pool, size,
+                                                      ppMem);
+
+    getContext()->notify_end(UR_FUNCTION_USM_SHARED_ALLOC, "urUSMSharedAlloc",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_SHARED_ALLOC,
+                                        &params);
+        logger.info("   <--- urUSMSharedAlloc({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMFree
+__urdlllocal ur_result_t UR_APICALL urUSMFree(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem                    ///< [in] pointer to USM memory object
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_FREE)) {
+        return validation::urUSMFree(hContext, pMem);
+    }
+
+    ur_usm_free_params_t params = {&hContext, &pMem};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_FREE,
+                                                   "urUSMFree", &params,
+                                                   hContext, pMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMFree\n");
+
+    ur_result_t result = validation::urUSMFree(hContext, pMem);
+
+    getContext()->notify_end(UR_FUNCTION_USM_FREE, "urUSMFree", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_FREE,
+                                        &params);
+        logger.info("   <--- urUSMFree({}) -> {};\n", args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMGetMemAllocInfo
+__urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    const void *pMem,             ///< [in] pointer to USM memory object
+    ur_usm_alloc_info_t
+        propName, ///< [in] the name of the USM allocation property to query
+    size_t
+        propSize, ///< [in] size in bytes of the USM allocation property value
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the USM
+                    ///< allocation property
+    size_t *
+        pPropSizeRet ///< [out][optional] bytes returned in USM allocation property
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO)) {
+        return validation::urUSMGetMemAllocInfo(hContext, pMem, propName,
+                                                propSize, pPropValue,
+                                                pPropSizeRet);
+    }
+
+    ur_usm_get_mem_alloc_info_params_t params = {
+        &hContext, &pMem, &propName, &propSize, &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, "urUSMGetMemAllocInfo", &params,
+        hContext, pMem, propName, propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMGetMemAllocInfo\n");
+
+    ur_result_t result = validation::urUSMGetMemAllocInfo(hContext, pMem,
+                                                          propName, propSize,
+                                                          pPropValue,
+                                                          pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO,
+                             "urUSMGetMemAllocInfo", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, &params);
+        logger.info("   <--- urUSMGetMemAllocInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMPoolCreate
+__urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_desc_t *
+        pPoolDesc, ///< [in] pointer to USM pool descriptor. Can be chained with
+                   ///< ::ur_usm_pool_limits_desc_t
+    ur_usm_pool_handle_t *ppPool ///< [out] pointer to USM memory pool
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_CREATE)) {
+        return validation::urUSMPoolCreate(hContext, pPoolDesc, ppPool);
+    }
+
+    ur_usm_pool_create_params_t params = {&hContext, &pPoolDesc, &ppPool};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_CREATE,
+                                                   "urUSMPoolCreate", &params,
+                                                   hContext, pPoolDesc, ppPool);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMPoolCreate\n");
+
+    ur_result_t result = validation::urUSMPoolCreate(hContext, pPoolDesc,
+                                                     ppPool);
+
+    getContext()->notify_end(UR_FUNCTION_USM_POOL_CREATE, "urUSMPoolCreate",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_CREATE,
+                                        &params);
+        logger.info("   <--- urUSMPoolCreate({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMPoolRetain
+__urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
+    ur_usm_pool_handle_t pPool ///< [in][retain] pointer to USM memory pool
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_RETAIN)) {
+        return validation::urUSMPoolRetain(pPool);
+    }
+
+    ur_usm_pool_retain_params_t params = {&pPool};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_RETAIN,
+                                                   "urUSMPoolRetain", &params,
+                                                   pPool);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMPoolRetain\n");
+
+    ur_result_t result = validation::urUSMPoolRetain(pPool);
+
+    getContext()->notify_end(UR_FUNCTION_USM_POOL_RETAIN, "urUSMPoolRetain",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_RETAIN,
+                                        &params);
+        logger.info("   <--- urUSMPoolRetain({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMPoolRelease
+__urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
+    ur_usm_pool_handle_t pPool ///< [in][release] pointer to USM memory pool
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_RELEASE)) {
+        return validation::urUSMPoolRelease(pPool);
+    }
+
+    ur_usm_pool_release_params_t params = {&pPool};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_RELEASE,
+                                                   "urUSMPoolRelease", &params,
+                                                   pPool);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMPoolRelease\n");
+
+    ur_result_t result = validation::urUSMPoolRelease(pPool);
+
+    getContext()->notify_end(UR_FUNCTION_USM_POOL_RELEASE, "urUSMPoolRelease",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_RELEASE,
+                                        &params);
+        logger.info("   <--- urUSMPoolRelease({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMPoolGetInfo
+__urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
+    ur_usm_pool_handle_t hPool,  ///< [in] handle of the USM memory pool
+    ur_usm_pool_info_t propName, ///< [in] name of the pool property to query
+    size_t propSize, ///< [in] size in bytes of the pool property value provided
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the pool
+                    ///< property
+    size_t *
+        pPropSizeRet ///< [out][optional] size in bytes returned in pool property value
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_GET_INFO)) {
+        return validation::urUSMPoolGetInfo(hPool, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+    }
+
+    ur_usm_pool_get_info_params_t params = {&hPool, &propName, &propSize,
+                                            &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_POOL_GET_INFO, "urUSMPoolGetInfo", &params, hPool,
+        propName, propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMPoolGetInfo\n");
+
+    ur_result_t result = validation::urUSMPoolGetInfo(hPool, propName, propSize,
+                                                      pPropValue, pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_USM_POOL_GET_INFO, "urUSMPoolGetInfo",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_GET_INFO,
+                                        &params);
+        logger.info("   <--- urUSMPoolGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urVirtualMemGranularityGetInfo
+__urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    ur_device_handle_t
+        hDevice, ///< [in][optional] is the device to get the granularity from, if the
+    ///< device is null then the granularity is suitable for all devices in context.
+    ur_virtual_mem_granularity_info_t
+        propName, ///< [in] type of the info to query.
+    size_t
+        propSize, ///< [in] size in bytes of the memory pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+    ///< the info. If propSize is less than the real number of bytes needed to
+    ///< return the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is
+    ///< returned and pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName."
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO)) {
+        return validation::urVirtualMemGranularityGetInfo(hContext, hDevice,
+                                                          propName, propSize,
+                                                          pPropValue,
+                                                          pPropSizeRet);
+    }
+
+    ur_virtual_mem_granularity_get_info_params_t params = {
+        &hContext, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO,
+        "urVirtualMemGranularityGetInfo", &params, hContext, hDevice, propName,
+        propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urVirtualMemGranularityGetInfo\n");
+
+    ur_result_t result = validation::urVirtualMemGranularityGetInfo(
+        hContext, hDevice, propName, propSize, pPropValue, pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO,
+                             "urVirtualMemGranularityGetInfo", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO, &params);
+        logger.info("   <--- urVirtualMemGranularityGetInfo({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urVirtualMemReserve
+__urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    const void *
+        pStart, ///< [in][optional] pointer to the start of the virtual memory region to
+    ///< reserve, specifying a null value causes the implementation to select a
+    ///< start address.
+    size_t
+        size, ///< [in] size in bytes of the virtual address range to reserve.
+    void **
+        ppStart ///< [out] pointer to the returned address at the start of reserved virtual
+                ///< memory range.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_RESERVE)) {
+        return validation::urVirtualMemReserve(hContext, pStart, size, ppStart);
+    }
+
+    ur_virtual_mem_reserve_params_t params = {&hContext, &pStart, &size,
+                                              &ppStart};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_VIRTUAL_MEM_RESERVE, "urVirtualMemReserve", &params,
+        hContext, pStart, size, ppStart);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urVirtualMemReserve\n");
+
+    ur_result_t result = validation::urVirtualMemReserve(hContext, pStart, size,
+                                                         ppStart);
+
+    getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_RESERVE,
+                             "urVirtualMemReserve", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_VIRTUAL_MEM_RESERVE, &params);
+        logger.info("   <--- urVirtualMemReserve({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urVirtualMemFree
+__urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    const void *
+        pStart, ///< [in] pointer to the start of the virtual memory range to free.
+    size_t size ///< [in] size in bytes of the virtual memory range to free.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_FREE)) {
+        return validation::urVirtualMemFree(hContext, pStart, size);
+    }
+
+    ur_virtual_mem_free_params_t params = {&hContext, &pStart, &size};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_FREE,
+                                                   "urVirtualMemFree", &params,
+                                                   hContext, pStart, size);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urVirtualMemFree\n");
+
+    ur_result_t result = validation::urVirtualMemFree(hContext, pStart, size);
+
+    getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_FREE, "urVirtualMemFree",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_FREE,
+                                        &params);
+        logger.info("   <--- urVirtualMemFree({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urVirtualMemMap
+__urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
+    ur_context_handle_t hContext, ///< [in] handle to the context object.
+    const void
+        *pStart, ///< [in] pointer to the start of the virtual memory range.
+    size_t size, ///< [in] size in bytes of the virtual memory range to map.
+    ur_physical_mem_handle_t
+        hPhysicalMem, ///< [in] handle of the physical memory to map pStart to.
+    size_t
+        offset, ///< [in] offset in bytes into the physical memory to map pStart to.
+    ur_virtual_mem_access_flags_t
+        flags ///< [in] access flags for the physical memory mapping.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_MAP)) {
+        return validation::urVirtualMemMap(hContext, pStart, size, hPhysicalMem,
+                                           offset, flags);
+    }
+
+    ur_virtual_mem_map_params_t params = {&hContext,     &pStart, &size,
+                                          &hPhysicalMem, &offset, &flags};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_MAP,
+                                                   "urVirtualMemMap", &params,
+                                                   hContext, pStart, size,
+                                                   hPhysicalMem, offset, flags);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urVirtualMemMap\n");
+
+    ur_result_t result = validation::urVirtualMemMap(hContext, pStart, size,
+                                                     hPhysicalMem, offset,
+                                                     flags);
+
+    getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_MAP, "urVirtualMemMap",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_MAP,
+                                        &params);
+        logger.info("   <--- urVirtualMemMap({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urVirtualMemUnmap
+__urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
+    ur_context_handle_t hContext, ///< [in] handle to the context object.
+    const void *
+        pStart, ///< [in] pointer to the start of the mapped virtual memory range
+    size_t size ///< [in] size in bytes of the virtual memory range.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_UNMAP)) {
+        return validation::urVirtualMemUnmap(hContext, pStart, size);
+    }
+
+    ur_virtual_mem_unmap_params_t params = {&hContext, &pStart, &size};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_VIRTUAL_MEM_UNMAP, "urVirtualMemUnmap", &params, hContext,
+        pStart, size);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urVirtualMemUnmap\n");
+
+    ur_result_t result = validation::urVirtualMemUnmap(hContext, pStart, size);
+
+    getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_UNMAP, "urVirtualMemUnmap",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_UNMAP,
+                                        &params);
+        logger.info("   <--- urVirtualMemUnmap({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urVirtualMemSetAccess
+__urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
+    ur_context_handle_t hContext, ///< [in] handle to the context object.
+    const void
+        *pStart, ///< [in] pointer to the start of the virtual memory range.
+    size_t size, ///< [in] size in bytes of the virtual memory range.
+    ur_virtual_mem_access_flags_t
+        flags ///< [in] access flags to set for the mapped virtual memory range.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS)) {
+        return validation::urVirtualMemSetAccess(hContext, pStart, size, flags);
+    }
+
+    ur_virtual_mem_set_access_params_t params = {&hContext, &pStart, &size,
+                                                 &flags};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, "urVirtualMemSetAccess", &params,
+        hContext, pStart, size, flags);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urVirtualMemSetAccess\n");
+
+    ur_result_t result = validation::urVirtualMemSetAccess(hContext, pStart,
+                                                           size, flags);
+
+    getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS,
+                             "urVirtualMemSetAccess", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, &params);
+        logger.info("   <--- urVirtualMemSetAccess({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urVirtualMemGetInfo
+__urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
+    ur_context_handle_t hContext, ///< [in] handle to the context object.
+    const void
+        *pStart, ///< [in] pointer to the start of the virtual memory range.
+    size_t size, ///< [in] size in bytes of the virtual memory range.
+    ur_virtual_mem_info_t propName, ///< [in] type of the info to query.
+    size_t
+        propSize, ///< [in] size in bytes of the memory pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+    ///< the info. If propSize is less than the real number of bytes needed to
+    ///< return the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is
+    ///< returned and pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName."
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_GET_INFO)) {
+        return validation::urVirtualMemGetInfo(hContext, pStart, size, propName,
+                                               propSize, pPropValue,
+                                               pPropSizeRet);
+    }
+
+    ur_virtual_mem_get_info_params_t params = {
+        &hContext, &pStart,     &size,        &propName,
+        &propSize, &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_VIRTUAL_MEM_GET_INFO, "urVirtualMemGetInfo", &params,
+        hContext, pStart, size, propName, propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urVirtualMemGetInfo\n");
+
+    ur_result_t result = validation::urVirtualMemGetInfo(hContext, pStart, size,
+                                                         propName, propSize,
+                                                         pPropValue,
+                                                         pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_VIRTUAL_MEM_GET_INFO,
+                             "urVirtualMemGetInfo", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_VIRTUAL_MEM_GET_INFO, &params);
+        logger.info("   <--- urVirtualMemGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urPhysicalMemCreate
+__urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
+    ur_context_handle_t hContext, ///< [in] handle of the context object.
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object.
+    size_t
+        size, ///< [in] size in bytes of physical memory to allocate, must be a multiple
+              ///< of ::UR_VIRTUAL_MEM_GRANULARITY_INFO_MINIMUM.
+    const ur_physical_mem_properties_t *
+        pProperties, ///< [in][optional] pointer to physical memory creation properties.
+    ur_physical_mem_handle_t *
+        phPhysicalMem ///< [out] pointer to handle of physical memory object created.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_CREATE)) {
+        return validation::urPhysicalMemCreate(hContext, hDevice, size,
+                                               pProperties, phPhysicalMem);
+    }
+
+    ur_physical_mem_create_params_t params = {&hContext, &hDevice, &size,
+                                              &pProperties, &phPhysicalMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PHYSICAL_MEM_CREATE, "urPhysicalMemCreate", &params,
+        hContext, hDevice, size, pProperties, phPhysicalMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urPhysicalMemCreate\n");
+
+    ur_result_t result = validation::urPhysicalMemCreate(hContext, hDevice,
+                                                         size, pProperties,
+                                                         phPhysicalMem);
+
+    getContext()->notify_end(UR_FUNCTION_PHYSICAL_MEM_CREATE,
+                             "urPhysicalMemCreate", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PHYSICAL_MEM_CREATE, &params);
+        logger.info("   <--- urPhysicalMemCreate({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urPhysicalMemRetain
+__urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
+    ur_physical_mem_handle_t
+        hPhysicalMem ///< [in][retain] handle of the physical memory object to retain.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_RETAIN)) {
+        return validation::urPhysicalMemRetain(hPhysicalMem);
+    }
+
+    ur_physical_mem_retain_params_t params = {&hPhysicalMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PHYSICAL_MEM_RETAIN, "urPhysicalMemRetain", &params,
+        hPhysicalMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urPhysicalMemRetain\n");
+
+    ur_result_t result = validation::urPhysicalMemRetain(hPhysicalMem);
+
+    getContext()->notify_end(UR_FUNCTION_PHYSICAL_MEM_RETAIN,
+                             "urPhysicalMemRetain", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PHYSICAL_MEM_RETAIN, &params);
+        logger.info("   <--- urPhysicalMemRetain({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urPhysicalMemRelease
+__urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
+    ur_physical_mem_handle_t
+        hPhysicalMem ///< [in][release] handle of the physical memory object to release.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_RELEASE)) {
+        return validation::urPhysicalMemRelease(hPhysicalMem);
+    }
+
+    ur_physical_mem_release_params_t params = {&hPhysicalMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PHYSICAL_MEM_RELEASE, "urPhysicalMemRelease", &params,
+        hPhysicalMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urPhysicalMemRelease\n");
+
+    ur_result_t result = validation::urPhysicalMemRelease(hPhysicalMem);
+
+    getContext()->notify_end(UR_FUNCTION_PHYSICAL_MEM_RELEASE,
+                             "urPhysicalMemRelease", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PHYSICAL_MEM_RELEASE, &params);
+        logger.info("   <--- urPhysicalMemRelease({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramCreateWithIL
+__urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance
+    const void *pIL,              ///< [in] pointer to IL binary.
+    size_t length,                ///< [in] length of `pIL` in bytes.
+    const ur_program_properties_t *
+        pProperties, ///< [in][optional] pointer to program creation properties.
+    ur_program_handle_t
+        *phProgram ///< [out] pointer to handle of program object created.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_CREATE_WITH_IL)) {
+        return validation::urProgramCreateWithIL(hContext, pIL, length,
+                                                 pProperties, phProgram);
+    }
+
+    ur_program_create_with_il_params_t params = {&hContext, &pIL, &length,
+                                                 &pProperties, &phProgram};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_CREATE_WITH_IL, "urProgramCreateWithIL", &params,
+        hContext, pIL, length, pProperties, phProgram);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramCreateWithIL\n");
+
+    ur_result_t result = validation::urProgramCreateWithIL(hContext, pIL,
+                                                           length, pProperties,
+                                                           phProgram);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_CREATE_WITH_IL,
+                             "urProgramCreateWithIL", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_IL, &params);
+        logger.info("   <--- urProgramCreateWithIL({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramCreateWithBinary
+__urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance
+    ur_device_handle_t
+        hDevice,            ///< [in] handle to device associated with binary.
+    size_t size,            ///< [in] size in bytes.
+    const uint8_t *pBinary, ///< [in] pointer to binary.
+    const ur_program_properties_t *
+        pProperties, ///< [in][optional] pointer to program creation properties.
+    ur_program_handle_t
+        *phProgram ///< [out] pointer to handle of Program object created.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY)) {
+        return validation::urProgramCreateWithBinary(hContext, hDevice, size,
+                                                     pBinary, pProperties,
+                                                     phProgram);
+    }
+
+    ur_program_create_with_binary_params_t params = {
+        &hContext, &hDevice, &size, &pBinary, &pProperties, &phProgram};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY, "urProgramCreateWithBinary",
+        &params, hContext, hDevice, size, pBinary, pProperties, phProgram);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramCreateWithBinary\n");
+
+    ur_result_t result = validation::urProgramCreateWithBinary(hContext,
+                                                               hDevice, size,
+                                                               pBinary,
+                                                               pProperties,
+                                                               phProgram);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY,
+                             "urProgramCreateWithBinary", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY, &params);
+        logger.info("   <--- urProgramCreateWithBinary({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramBuild
+__urdlllocal ur_result_t UR_APICALL urProgramBuild(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance.
+    ur_program_handle_t hProgram, ///< [in] Handle of the program to build.
+    const char *
+        pOptions ///< [in][optional] pointer to build options null-terminated string.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_BUILD)) {
+        return validation::urProgramBuild(hContext, hProgram, pOptions);
+    }
+
+    ur_program_build_params_t params = {&hContext, &hProgram, &pOptions};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_BUILD,
+                                                   "urProgramBuild", &params,
+                                                   hContext, hProgram,
+                                                   pOptions);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramBuild\n");
+
+    ur_result_t result = validation::urProgramBuild(hContext, hProgram,
+                                                    pOptions);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_BUILD, "urProgramBuild",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_BUILD,
+                                        &params);
+        logger.info("   <--- urProgramBuild({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramCompile
+__urdlllocal ur_result_t UR_APICALL urProgramCompile(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance.
+    ur_program_handle_t
+        hProgram, ///< [in][out] handle of the program to compile.
+    const char *
+        pOptions ///< [in][optional] pointer to build options null-terminated string.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_COMPILE)) {
+        return validation::urProgramCompile(hContext, hProgram, pOptions);
+    }
+
+    ur_program_compile_params_t params = {&hContext, &hProgram, &pOptions};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_COMPILE,
+                                                   "urProgramCompile", &params,
+                                                   hContext, hProgram,
+                                                   pOptions);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramCompile\n");
+
+    ur_result_t result = validation::urProgramCompile(hContext, hProgram,
+                                                      pOptions);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_COMPILE, "urProgramCompile",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_COMPILE,
+                                        &params);
+        logger.info("   <--- urProgramCompile({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramLink
+__urdlllocal ur_result_t UR_APICALL urProgramLink(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance.
+    uint32_t count, ///< [in] number of program handles in `phPrograms`.
+    const ur_program_handle_t *
+        phPrograms, ///< [in][range(0, count)] pointer to array of program handles.
+    const char *
+        pOptions, ///< [in][optional] pointer to linker options null-terminated string.
+    ur_program_handle_t
+        *phProgram ///< [out] pointer to handle of program object created.
+) {
+    if (nullptr != phProgram) {
+        *phProgram = nullptr;
+    }
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_LINK)) {
+        return validation::urProgramLink(hContext, count, phPrograms, pOptions,
+                                         phProgram);
+    }
+
+    ur_program_link_params_t params = {&hContext, &count, &phPrograms,
+                                       &pOptions, &phProgram};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_LINK,
+                                                   "urProgramLink", &params,
+                                                   hContext, count, phPrograms,
+                                                   pOptions, phProgram);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramLink\n");
+
+    ur_result_t result = validation::urProgramLink(hContext, count, phPrograms,
+                                                   pOptions, phProgram);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_LINK, "urProgramLink", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_LINK,
+                                        &params);
+        logger.info("   <--- urProgramLink({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramRetain
+__urdlllocal ur_result_t UR_APICALL urProgramRetain(
+    ur_program_handle_t
+        hProgram ///< [in][retain] handle for the Program to retain
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_RETAIN)) {
+        return validation::urProgramRetain(hProgram);
+    }
+
+    ur_program_retain_params_t params = {&hProgram};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_RETAIN,
+                                                   "urProgramRetain", &params,
+                                                   hProgram);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramRetain\n");
+
+    ur_result_t result = validation::urProgramRetain(hProgram);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_RETAIN, "urProgramRetain",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_RETAIN,
+                                        &params);
+        logger.info("   <--- urProgramRetain({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramRelease
+__urdlllocal ur_result_t UR_APICALL urProgramRelease(
+    ur_program_handle_t
+        hProgram ///< [in][release] handle for the Program to release
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_RELEASE)) {
+        return validation::urProgramRelease(hProgram);
+    }
+
+    ur_program_release_params_t params = {&hProgram};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_RELEASE,
+                                                   "urProgramRelease", &params,
+                                                   hProgram);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramRelease\n");
+
+    ur_result_t result = validation::urProgramRelease(hProgram);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_RELEASE, "urProgramRelease",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_RELEASE,
+                                        &params);
+        logger.info("   <--- urProgramRelease({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramGetFunctionPointer
+__urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device to retrieve pointer for.
+    ur_program_handle_t
+        hProgram, ///< [in] handle of the program to search for function in.
+    ///< The program must already be built to the specified device, or
+    ///< otherwise ::UR_RESULT_ERROR_INVALID_PROGRAM_EXECUTABLE is returned.
+    const char *
+        pFunctionName, ///< [in] A null-terminates string denoting the mangled function name.
+    void **
+        ppFunctionPointer ///< [out] Returns the pointer to the function if it is found in the program.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER)) {
+        return validation::urProgramGetFunctionPointer(hDevice, hProgram,
+                                                       pFunctionName,
+                                                       ppFunctionPointer);
+    }
+
+    ur_program_get_function_pointer_params_t params = {
+        &hDevice, &hProgram, &pFunctionName, &ppFunctionPointer};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER, "urProgramGetFunctionPointer",
+        &params, hDevice, hProgram, pFunctionName, ppFunctionPointer);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramGetFunctionPointer\n");
+
+    ur_result_t result = validation::urProgramGetFunctionPointer(
+        hDevice, hProgram, pFunctionName, ppFunctionPointer);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER,
+                             "urProgramGetFunctionPointer", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER, &params);
+        logger.info("   <--- urProgramGetFunctionPointer({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramGetGlobalVariablePointer
+__urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device to retrieve the pointer for.
+    ur_program_handle_t
+        hProgram, ///< [in] handle of the program where the global variable is.
+    const char *
+        pGlobalVariableName, ///< [in] mangled name of the global variable to retrieve the pointer for.
+    size_t *
+        pGlobalVariableSizeRet, ///< [out][optional] Returns the size of the global variable if it is found
+                                ///< in the program.
+    void **
+        ppGlobalVariablePointerRet ///< [out] Returns the pointer to the global variable if it is found in the program.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER)) {
+        return validation::urProgramGetGlobalVariablePointer(
+            hDevice, hProgram, pGlobalVariableName, pGlobalVariableSizeRet,
+            ppGlobalVariablePointerRet);
+    }
+
+    ur_program_get_global_variable_pointer_params_t params = {
+        &hDevice, &hProgram, &pGlobalVariableName, &pGlobalVariableSizeRet,
+        &ppGlobalVariablePointerRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER,
+        "urProgramGetGlobalVariablePointer", &params, hDevice, hProgram,
+        pGlobalVariableName, pGlobalVariableSizeRet,
+        ppGlobalVariablePointerRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramGetGlobalVariablePointer\n");
+
+    ur_result_t result = validation::urProgramGetGlobalVariablePointer(
+        hDevice, hProgram, pGlobalVariableName, pGlobalVariableSizeRet,
+        ppGlobalVariablePointerRet);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER,
+                             "urProgramGetGlobalVariablePointer", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER, &params);
+        logger.info("   <--- urProgramGetGlobalVariablePointer({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramGetInfo
+__urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
+    ur_program_handle_t hProgram, ///< [in] handle of the Program object
+    ur_program_info_t propName, ///< [in] name of the Program property to query
+    size_t propSize,            ///< [in] the size of the Program property.
+    void *
+        pPropValue, ///< [in,out][optional][typename(propName, propSize)] array of bytes of
+                    ///< holding the program info property.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return
+    ///< the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_INFO)) {
+        return validation::urProgramGetInfo(hProgram, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+    }
+
+    ur_program_get_info_params_t params = {&hProgram, &propName, &propSize,
+                                           &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_GET_INFO,
+                                                   "urProgramGetInfo", &params,
+                                                   hProgram, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramGetInfo\n");
+
+    ur_result_t result = validation::urProgramGetInfo(hProgram, propName,
+                                                      propSize, pPropValue,
+                                                      pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_GET_INFO, "urProgramGetInfo",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_GET_INFO,
+                                        &params);
+        logger.info("   <--- urProgramGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramGetBuildInfo
+__urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
+    ur_program_handle_t hProgram, ///< [in] handle of the Program object
+    ur_device_handle_t hDevice,   ///< [in] handle of the Device object
+    ur_program_build_info_t
+        propName,    ///< [in] name of the Program build info to query
+    size_t propSize, ///< [in] size of the Program build info property.
+    void *
+        pPropValue, ///< [in,out][optional][typename(propName, propSize)] value of the Program
+                    ///< build property.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return the info then the ::UR_RESULT_ERROR_INVALID_SIZE
+    ///< error is returned and pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
+                     ///< queried by propName.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_BUILD_INFO)) {
+        return validation::urProgramGetBuildInfo(hProgram, hDevice, propName,
+                                                 propSize, pPropValue,
+                                                 pPropSizeRet);
+    }
+
+    ur_program_get_build_info_params_t params = {
+        &hProgram, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_GET_BUILD_INFO, "urProgramGetBuildInfo", &params,
+        hProgram, hDevice, propName, propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramGetBuildInfo\n");
+
+    ur_result_t result = validation::urProgramGetBuildInfo(hProgram, hDevice,
+                                                           propName, propSize,
+                                                           pPropValue,
+                                                           pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_GET_BUILD_INFO,
+                             "urProgramGetBuildInfo", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PROGRAM_GET_BUILD_INFO, &params);
+        logger.info("   <--- urProgramGetBuildInfo({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramSetSpecializationConstants
+__urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
+    ur_program_handle_t hProgram, ///< [in] handle of the Program object
+    uint32_t count, ///< [in] the number of elements in the pSpecConstants array
+    const ur_specialization_constant_info_t *
+        pSpecConstants ///< [in][range(0, count)] array of specialization constant value
+                       ///< descriptions
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS)) {
+        return validation::urProgramSetSpecializationConstants(hProgram, count,
+                                                               pSpecConstants);
+    }
+
+    ur_program_set_specialization_constants_params_t params = {
+        &hProgram, &count, &pSpecConstants};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
+        "urProgramSetSpecializationConstants", &params, hProgram, count,
+        pSpecConstants);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramSetSpecializationConstants\n");
+
+    ur_result_t result = validation::urProgramSetSpecializationConstants(
+        hProgram, count, pSpecConstants);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
+                             "urProgramSetSpecializationConstants", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
+            &params);
+        logger.info("   <--- urProgramSetSpecializationConstants({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
+    ur_program_handle_t hProgram, ///< [in] handle of the program.
+    ur_native_handle_t *
+        phNativeProgram ///< [out] a pointer to the native handle of the program.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE)) {
+        return validation::urProgramGetNativeHandle(hProgram, phNativeProgram);
+    }
+
+    ur_program_get_native_handle_params_t params = {&hProgram,
+                                                    &phNativeProgram};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE, "urProgramGetNativeHandle",
+        &params, hProgram, phNativeProgram);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramGetNativeHandle\n");
+
+    ur_result_t result = validation::urProgramGetNativeHandle(hProgram,
+                                                              phNativeProgram);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE,
+                             "urProgramGetNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE, &params);
+        logger.info("   <--- urProgramGetNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeProgram, ///< [in][nocheck] the native handle of the program.
+    ur_context_handle_t hContext, ///< [in] handle of the context instance
+    const ur_program_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native program properties struct.
+    ur_program_handle_t *
+        phProgram ///< [out] pointer to the handle of the program object created.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE)) {
+        return validation::urProgramCreateWithNativeHandle(hNativeProgram,
+                                                           hContext,
+                                                           pProperties,
+                                                           phProgram);
+    }
+
+    ur_program_create_with_native_handle_params_t params = {
+        &hNativeProgram, &hContext, &pProperties, &phProgram};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE,
+        "urProgramCreateWithNativeHandle", &params, hNativeProgram, hContext,
+        pProperties, phProgram);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramCreateWithNativeHandle\n");
+
+    ur_result_t result = validation::urProgramCreateWithNativeHandle(
+        hNativeProgram, hContext, pProperties, phProgram);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE,
+                             "urProgramCreateWithNativeHandle", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE, &params);
+        logger.info("   <--- urProgramCreateWithNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelCreate
+__urdlllocal ur_result_t UR_APICALL urKernelCreate(
+    ur_program_handle_t hProgram, ///< [in] handle of the program instance
+    const char *pKernelName,      ///< [in] pointer to null-terminated string.
+    ur_kernel_handle_t
+        *phKernel ///< [out] pointer to handle of kernel object created.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_CREATE)) {
+        return validation::urKernelCreate(hProgram, pKernelName, phKernel);
+    }
+
+    ur_kernel_create_params_t params = {&hProgram, &pKernelName, &phKernel};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_CREATE,
+                                                   "urKernelCreate", &params,
+                                                   hProgram, pKernelName,
+                                                   phKernel);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelCreate\n");
+
+    ur_result_t result = validation::urKernelCreate(hProgram, pKernelName,
+                                                    phKernel);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_CREATE, "urKernelCreate",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_CREATE,
+                                        &params);
+        logger.info("   <--- urKernelCreate({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelSetArgValue
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t argIndex, ///< [in] argument index in range [0, num args - 1]
+    size_t argSize,    ///< [in] size of argument type
+    const ur_kernel_arg_value_properties_t
+        *pProperties, ///< [in][optional] pointer to value properties.
+    const void
+        *pArgValue ///< [in] argument value represented as matching arg type.
+    ///< The data pointed to will be copied and therefore can be reused on return.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_VALUE)) {
+        return validation::urKernelSetArgValue(hKernel, argIndex, argSize,
+                                               pProperties, pArgValue);
+    }
+
+    ur_kernel_set_arg_value_params_t params = {&hKernel, &argIndex, &argSize,
+                                               &pProperties, &pArgValue};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_SET_ARG_VALUE, "urKernelSetArgValue", &params,
+        hKernel, argIndex, argSize, pProperties, pArgValue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelSetArgValue\n");
+
+    ur_result_t result = validation::urKernelSetArgValue(hKernel, argIndex,
+                                                         argSize, pProperties,
+                                                         pArgValue);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_SET_ARG_VALUE,
+                             "urKernelSetArgValue", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_SET_ARG_VALUE, &params);
+        logger.info("   <--- urKernelSetArgValue({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelSetArgLocal
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t argIndex, ///< [in] argument index in range [0, num args - 1]
+    size_t
+        argSize, ///< [in] size of the local buffer to be allocated by the runtime
+    const ur_kernel_arg_local_properties_t
+        *pProperties ///< [in][optional] pointer to local buffer properties.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_LOCAL)) {
+        return validation::urKernelSetArgLocal(hKernel, argIndex, argSize,
+                                               pProperties);
+    }
+
+    ur_kernel_set_arg_local_params_t params = {&hKernel, &argIndex, &argSize,
+                                               &pProperties};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_SET_ARG_LOCAL, "urKernelSetArgLocal", &params,
+        hKernel, argIndex, argSize, pProperties);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelSetArgLocal\n");
+
+    ur_result_t result = validation::urKernelSetArgLocal(hKernel, argIndex,
+                                                         argSize, pProperties);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_SET_ARG_LOCAL,
+                             "urKernelSetArgLocal", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_SET_ARG_LOCAL, &params);
+        logger.info("   <--- urKernelSetArgLocal({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelGetInfo
+__urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the Kernel object
+    ur_kernel_info_t propName,  ///< [in] name of the Kernel property to query
+    size_t propSize,            ///< [in] the size of the Kernel property value.
+    void *
+        pPropValue, ///< [in,out][optional][typename(propName, propSize)] array of bytes
+                    ///< holding the kernel info property.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return
+    ///< the info then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
+                     ///< queried by propName.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_INFO)) {
+        return validation::urKernelGetInfo(hKernel, propName, propSize,
+                                           pPropValue, pPropSizeRet);
+    }
+
+    ur_kernel_get_info_params_t params = {&hKernel, &propName, &propSize,
+                                          &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_GET_INFO,
+                                                   "urKernelGetInfo", &params,
+                                                   hKernel, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelGetInfo\n");
+
+    ur_result_t result = validation::urKernelGetInfo(hKernel, propName,
+                                                     propSize, pPropValue,
+                                                     pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_GET_INFO, "urKernelGetInfo",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_GET_INFO,
+                                        &params);
+        logger.info("   <--- urKernelGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelGetGroupInfo
+__urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the Kernel object
+    ur_device_handle_t hDevice, ///< [in] handle of the Device object
+    ur_kernel_group_info_t
+        propName,    ///< [in] name of the work Group property to query
+    size_t propSize, ///< [in] size of the Kernel Work Group property value
+    void *
+        pPropValue, ///< [in,out][optional][typename(propName, propSize)] value of the Kernel
+                    ///< Work Group property.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
+                     ///< queried by propName.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_GROUP_INFO)) {
+        return validation::urKernelGetGroupInfo(hKernel, hDevice, propName,
+                                                propSize, pPropValue,
+                                                pPropSizeRet);
+    }
+
+    ur_kernel_get_group_info_params_t params = {
+        &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_GET_GROUP_INFO, "urKernelGetGroupInfo", &params,
+        hKernel, hDevice, propName, propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelGetGroupInfo\n");
+
+    ur_result_t result = validation::urKernelGetGroupInfo(hKernel, hDevice,
+                                                          propName, propSize,
+                                                          pPropValue,
+                                                          pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_GET_GROUP_INFO,
+                             "urKernelGetGroupInfo", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_GET_GROUP_INFO, &params);
+        logger.info("   <--- urKernelGetGroupInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelGetSubGroupInfo
+__urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the Kernel object
+    ur_device_handle_t hDevice, ///< [in] handle of the Device object
+    ur_kernel_sub_group_info_t
+        propName,    ///< [in] name of the SubGroup property to query
+    size_t propSize, ///< [in] size of the Kernel SubGroup property value
+    void *
+        pPropValue, ///< [in,out][optional][typename(propName, propSize)] value of the Kernel
+                    ///< SubGroup property.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
+                     ///< queried by propName.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO)) {
+        return validation::urKernelGetSubGroupInfo(hKernel, hDevice, propName,
+                                                   propSize, pPropValue,
+                                                   pPropSizeRet);
+    }
+
+    ur_kernel_get_sub_group_info_params_t params = {
+        &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO, "urKernelGetSubGroupInfo",
+        &params, hKernel, hDevice, propName, propSize, pPropValue,
+        pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelGetSubGroupInfo\n");
+
+    ur_result_t result = validation::urKernelGetSubGroupInfo(hKernel, hDevice,
+                                                             propName, propSize,
+                                                             pPropValue,
+                                                             pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO,
+                             "urKernelGetSubGroupInfo", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO, &params);
+        logger.info("   <--- urKernelGetSubGroupInfo({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelRetain
+__urdlllocal ur_result_t UR_APICALL urKernelRetain(
+    ur_kernel_handle_t hKernel ///< [in][retain] handle for the Kernel to retain
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_RETAIN)) {
+        return validation::urKernelRetain(hKernel);
+    }
+
+    ur_kernel_retain_params_t params = {&hKernel};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_RETAIN,
+                                                   "urKernelRetain", &params,
+                                                   hKernel);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelRetain\n");
+
+    ur_result_t result = validation::urKernelRetain(hKernel);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_RETAIN, "urKernelRetain",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_RETAIN,
+                                        &params);
+        logger.info("   <--- urKernelRetain({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelRelease
+__urdlllocal ur_result_t UR_APICALL urKernelRelease(
+    ur_kernel_handle_t
+        hKernel ///< [in][release] handle for the Kernel to release
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_RELEASE)) {
+        return validation::urKernelRelease(hKernel);
+    }
+
+    ur_kernel_release_params_t params = {&hKernel};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_RELEASE,
+                                                   "urKernelRelease", &params,
+                                                   hKernel);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelRelease\n");
+
+    ur_result_t result = validation::urKernelRelease(hKernel);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_RELEASE, "urKernelRelease",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_RELEASE,
+                                        &params);
+        logger.info("   <--- urKernelRelease({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelSetArgPointer
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t argIndex, ///< [in] argument index in range [0, num args - 1]
+    const ur_kernel_arg_pointer_properties_t
+        *pProperties, ///< [in][optional] pointer to USM pointer properties.
+    const void *
+        pArgValue ///< [in][optional] Pointer obtained by USM allocation or virtual memory
+    ///< mapping operation. If null then argument value is considered null.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_POINTER)) {
+        return validation::urKernelSetArgPointer(hKernel, argIndex, pProperties,
+                                                 pArgValue);
+    }
+
+    ur_kernel_set_arg_pointer_params_t params = {&hKernel, &argIndex,
+                                                 &pProperties, &pArgValue};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_SET_ARG_POINTER, "urKernelSetArgPointer", &params,
+        hKernel, argIndex, pProperties, pArgValue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelSetArgPointer\n");
+
+    ur_result_t result = validation::urKernelSetArgPointer(hKernel, argIndex,
+                                                           pProperties,
+                                                           pArgValue);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_SET_ARG_POINTER,
+                             "urKernelSetArgPointer", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_SET_ARG_POINTER, &params);
+        logger.info("   <--- urKernelSetArgPointer({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelSetExecInfo
+__urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
+    ur_kernel_handle_t hKernel,     ///< [in] handle of the kernel object
+    ur_kernel_exec_info_t propName, ///< [in] name of the execution attribute
+    size_t propSize,                ///< [in] size in byte the attribute value
+    const ur_kernel_exec_info_properties_t
+        *pProperties, ///< [in][optional] pointer to execution info properties.
+    const void *
+        pPropValue ///< [in][typename(propName, propSize)] pointer to memory location holding
+                   ///< the property value.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_EXEC_INFO)) {
+        return validation::urKernelSetExecInfo(hKernel, propName, propSize,
+                                               pProperties, pPropValue);
+    }
+
+    ur_kernel_set_exec_info_params_t params = {&hKernel, &propName, &propSize,
+                                               &pProperties, &pPropValue};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_SET_EXEC_INFO, "urKernelSetExecInfo", &params,
+        hKernel, propName, propSize, pProperties, pPropValue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelSetExecInfo\n");
+
+    ur_result_t result = validation::urKernelSetExecInfo(hKernel, propName,
+                                                         propSize, pProperties,
+                                                         pPropValue);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_SET_EXEC_INFO,
+                             "urKernelSetExecInfo", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_SET_EXEC_INFO, &params);
+        logger.info("   <--- urKernelSetExecInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelSetArgSampler
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t argIndex, ///< [in] argument index in range [0, num args - 1]
+    const ur_kernel_arg_sampler_properties_t
+        *pProperties, ///< [in][optional] pointer to sampler properties.
+    ur_sampler_handle_t hArgValue ///< [in] handle of Sampler object.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER)) {
+        return validation::urKernelSetArgSampler(hKernel, argIndex, pProperties,
+                                                 hArgValue);
+    }
+
+    ur_kernel_set_arg_sampler_params_t params = {&hKernel, &argIndex,
+                                                 &pProperties, &hArgValue};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, "urKernelSetArgSampler", &params,
+        hKernel, argIndex, pProperties, hArgValue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelSetArgSampler\n");
+
+    ur_result_t result = validation::urKernelSetArgSampler(hKernel, argIndex,
+                                                           pProperties,
+                                                           hArgValue);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER,
+                             "urKernelSetArgSampler", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, &params);
+        logger.info("   <--- urKernelSetArgSampler({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelSetArgMemObj
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t argIndex, ///< [in] argument index in range [0, num args - 1]
+    const ur_kernel_arg_mem_obj_properties_t
+        *pProperties, ///< [in][optional] pointer to Memory object properties.
+    ur_mem_handle_t hArgValue ///< [in][optional] handle of Memory object.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ)) {
+        return validation::urKernelSetArgMemObj(hKernel, argIndex, pProperties,
+                                                hArgValue);
+    }
+
+    ur_kernel_set_arg_mem_obj_params_t params = {&hKernel, &argIndex,
+                                                 &pProperties, &hArgValue};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, "urKernelSetArgMemObj", &params,
+        hKernel, argIndex, pProperties, hArgValue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelSetArgMemObj\n");
+
+    ur_result_t result = validation::urKernelSetArgMemObj(hKernel, argIndex,
+                                                          pProperties,
+                                                          hArgValue);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ,
+                             "urKernelSetArgMemObj", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, &params);
+        logger.info("   <--- urKernelSetArgMemObj({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelSetSpecializationConstants
+__urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t count, ///< [in] the number of elements in the pSpecConstants array
+    const ur_specialization_constant_info_t *
+        pSpecConstants ///< [in] array of specialization constant value descriptions
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS)) {
+        return validation::urKernelSetSpecializationConstants(hKernel, count,
+                                                              pSpecConstants);
+    }
+
+    ur_kernel_set_specialization_constants_params_t params = {&hKernel, &count,
+                                                              &pSpecConstants};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS,
+        "urKernelSetSpecializationConstants", &params, hKernel, count,
+        pSpecConstants);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelSetSpecializationConstants\n");
+
+    ur_result_t result = validation::urKernelSetSpecializationConstants(
+        hKernel, count, pSpecConstants);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS,
+                             "urKernelSetSpecializationConstants", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS, &params);
+        logger.info("   <--- urKernelSetSpecializationConstants({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel.
+    ur_native_handle_t
+        *phNativeKernel ///< [out] a pointer to the native handle of the kernel.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE)) {
+        return validation::urKernelGetNativeHandle(hKernel, phNativeKernel);
+    }
+
+    ur_kernel_get_native_handle_params_t params = {&hKernel, &phNativeKernel};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE, "urKernelGetNativeHandle",
+        &params, hKernel, phNativeKernel);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelGetNativeHandle\n");
+
+    ur_result_t result = validation::urKernelGetNativeHandle(hKernel,
+                                                             phNativeKernel);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE,
+                             "urKernelGetNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE, &params);
+        logger.info("   <--- urKernelGetNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeKernel, ///< [in][nocheck] the native handle of the kernel.
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_program_handle_t
+        hProgram, ///< [in][optional] handle of the program associated with the kernel
+    const ur_kernel_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native kernel properties struct
+    ur_kernel_handle_t
+        *phKernel ///< [out] pointer to the handle of the kernel object created.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE)) {
+        return validation::urKernelCreateWithNativeHandle(hNativeKernel,
+                                                          hContext, hProgram,
+                                                          pProperties,
+                                                          phKernel);
+    }
+
+    ur_kernel_create_with_native_handle_params_t params = {
+        &hNativeKernel, &hContext, &hProgram, &pProperties, &phKernel};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE,
+        "urKernelCreateWithNativeHandle", &params, hNativeKernel, hContext,
+        hProgram, pProperties, phKernel);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelCreateWithNativeHandle\n");
+
+    ur_result_t result = validation::urKernelCreateWithNativeHandle(
+        hNativeKernel, hContext, hProgram, pProperties, phKernel);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE,
+                             "urKernelCreateWithNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE, &params);
+        logger.info("   <--- urKernelCreateWithNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelGetSuggestedLocalWorkSize
+__urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    uint32_t
+        numWorkDim, ///< [in] number of dimensions, from 1 to 3, to specify the global
+                    ///< and work-group work-items
+    const size_t *
+        pGlobalWorkOffset, ///< [in] pointer to an array of numWorkDim unsigned values that specify
+    ///< the offset used to calculate the global ID of a work-item
+    const size_t *
+        pGlobalWorkSize, ///< [in] pointer to an array of numWorkDim unsigned values that specify
+    ///< the number of global work-items in workDim that will execute the
+    ///< kernel function
+    size_t *
+        pSuggestedLocalWorkSize ///< [out] pointer to an array of numWorkDim unsigned values that specify
+    ///< suggested local work size that will contain the result of the query
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE)) {
+        return validation::urKernelGetSuggestedLocalWorkSize(
+            hKernel, hQueue, numWorkDim, pGlobalWorkOffset, pGlobalWorkSize,
+            pSuggestedLocalWorkSize);
+    }
+
+    ur_kernel_get_suggested_local_work_size_params_t params = {
+        &hKernel,           &hQueue,          &numWorkDim,
+        &pGlobalWorkOffset, &pGlobalWorkSize, &pSuggestedLocalWorkSize};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE,
+        "urKernelGetSuggestedLocalWorkSize", &params, hKernel, hQueue,
+        numWorkDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pSuggestedLocalWorkSize);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelGetSuggestedLocalWorkSize\n");
+
+    ur_result_t result = validation::urKernelGetSuggestedLocalWorkSize(
+        hKernel, hQueue, numWorkDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pSuggestedLocalWorkSize);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE,
+                             "urKernelGetSuggestedLocalWorkSize", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE,
+            &params);
+        logger.info("   <--- urKernelGetSuggestedLocalWorkSize({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urQueueGetInfo
+__urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_queue_info_t propName, ///< [in] name of the queue property to query
+    size_t
+        propSize, ///< [in] size in bytes of the queue property value provided
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the queue
+                    ///< property
+    size_t *
+        pPropSizeRet ///< [out][optional] size in bytes returned in queue property value
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_GET_INFO)) {
+        return validation::urQueueGetInfo(hQueue, propName, propSize,
+                                          pPropValue, pPropSizeRet);
+    }
+
+    ur_queue_get_info_params_t params = {&hQueue, &propName, &propSize,
+                                         &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_GET_INFO,
+                                                   "urQueueGetInfo", &params,
+                                                   hQueue, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueGetInfo\n");
+
+    ur_result_t result = validation::urQueueGetInfo(hQueue, propName, propSize,
+                                                    pPropValue, pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_GET_INFO, "urQueueGetInfo",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_GET_INFO,
+                                        &params);
+        logger.info("   <--- urQueueGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urQueueCreate
+__urdlllocal ur_result_t UR_APICALL urQueueCreate(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_queue_properties_t
+        *pProperties, ///< [in][optional] pointer to queue creation properties.
+    ur_queue_handle_t
+        *phQueue ///< [out] pointer to handle of queue object created
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_CREATE)) {
+        return validation::urQueueCreate(hContext, hDevice, pProperties,
+                                         phQueue);
+    }
+
+    ur_queue_create_params_t params = {&hContext, &hDevice, &pProperties,
+                                       &phQueue};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_CREATE,
+                                                   "urQueueCreate", &params,
+                                                   hContext, hDevice,
+                                                   pProperties, phQueue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueCreate\n");
+
+    ur_result_t result = validation::urQueueCreate(hContext, hDevice,
+                                                   pProperties, phQueue);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_CREATE, "urQueueCreate", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_CREATE,
+                                        &params);
+        logger.info("   <--- urQueueCreate({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urQueueRetain
+__urdlllocal ur_result_t UR_APICALL urQueueRetain(
+    ur_queue_handle_t
+        hQueue ///< [in][retain] handle of the queue object to get access
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_RETAIN)) {
+        return validation::urQueueRetain(hQueue);
+    }
+
+    ur_queue_retain_params_t params = {&hQueue};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_RETAIN,
+                                                   "urQueueRetain", &params,
+                                                   hQueue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueRetain\n");
+
+    ur_result_t result = validation::urQueueRetain(hQueue);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_RETAIN, "urQueueRetain", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_RETAIN,
+                                        &params);
+        logger.info("   <--- urQueueRetain({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urQueueRelease
+__urdlllocal ur_result_t UR_APICALL urQueueRelease(
+    ur_queue_handle_t
+        hQueue ///< [in][release] handle of the queue object to release
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_RELEASE)) {
+        return validation::urQueueRelease(hQueue);
+    }
+
+    ur_queue_release_params_t params = {&hQueue};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_RELEASE,
+                                                   "urQueueRelease", &params,
+                                                   hQueue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueRelease\n");
+
+    ur_result_t result = validation::urQueueRelease(hQueue);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_RELEASE, "urQueueRelease",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_RELEASE,
+                                        &params);
+        logger.info("   <--- urQueueRelease({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urQueueGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue.
+    ur_queue_native_desc_t
+        *pDesc, ///< [in][optional] pointer to native descriptor
+    ur_native_handle_t
+        *phNativeQueue ///< [out] a pointer to the native handle of the queue.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE)) {
+        return validation::urQueueGetNativeHandle(hQueue, pDesc, phNativeQueue);
+    }
+
+    ur_queue_get_native_handle_params_t params = {&hQueue, &pDesc,
+                                                  &phNativeQueue};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, "urQueueGetNativeHandle", &params,
+        hQueue, pDesc, phNativeQueue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueGetNativeHandle\n");
+
+    ur_result_t result = validation::urQueueGetNativeHandle(hQueue, pDesc,
+                                                            phNativeQueue);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE,
+                             "urQueueGetNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, &params);
+        logger.info("   <--- urQueueGetNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urQueueCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeQueue, ///< [in][nocheck] the native handle of the queue.
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice, ///< [in][optional] handle of the device object
+    const ur_queue_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native queue properties struct
+    ur_queue_handle_t
+        *phQueue ///< [out] pointer to the handle of the queue object created.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE)) {
+        return validation::urQueueCreateWithNativeHandle(hNativeQueue, hContext,
+                                                         hDevice, pProperties,
+                                                         phQueue);
+    }
+
+    ur_queue_create_with_native_handle_params_t params = {
+        &hNativeQueue, &hContext, &hDevice, &pProperties, &phQueue};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE,
+        "urQueueCreateWithNativeHandle", &params, hNativeQueue, hContext,
+        hDevice, pProperties, phQueue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueCreateWithNativeHandle\n");
+
+    ur_result_t result = validation::urQueueCreateWithNativeHandle(hNativeQueue,
+                                                                   hContext,
+                                                                   hDevice,
+                                                                   pProperties,
+                                                                   phQueue);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE,
+                             "urQueueCreateWithNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE, &params);
+        logger.info("   <--- urQueueCreateWithNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urQueueFinish
+__urdlllocal ur_result_t UR_APICALL urQueueFinish(
+    ur_queue_handle_t hQueue ///< [in] handle of the queue to be finished.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_FINISH)) {
+        return validation::urQueueFinish(hQueue);
+    }
+
+    ur_queue_finish_params_t params = {&hQueue};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_FINISH,
+                                                   "urQueueFinish", &params,
+                                                   hQueue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueFinish\n");
+
+    ur_result_t result = validation::urQueueFinish(hQueue);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_FINISH, "urQueueFinish", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_FINISH,
+                                        &params);
+        logger.info("   <--- urQueueFinish({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urQueueFlush
+__urdlllocal ur_result_t UR_APICALL urQueueFlush(
+    ur_queue_handle_t hQueue ///< [in] handle of the queue to be flushed.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_FLUSH)) {
+        return validation::urQueueFlush(hQueue);
+    }
+
+    ur_queue_flush_params_t params = {&hQueue};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_FLUSH,
+                                                   "urQueueFlush", &params,
+                                                   hQueue);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueFlush\n");
+
+    ur_result_t result = validation::urQueueFlush(hQueue);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_FLUSH, "urQueueFlush", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_FLUSH,
+                                        &params);
+        logger.info("   <--- urQueueFlush({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEventGetInfo
+__urdlllocal ur_result_t UR_APICALL urEventGetInfo(
+    ur_event_handle_t hEvent, ///< [in] handle of the event object
+    ur_event_info_t propName, ///< [in] the name of the event property to query
+    size_t propSize, ///< [in] size in bytes of the event property value
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the event
+                    ///< property
+    size_t *pPropSizeRet ///< [out][optional] bytes returned in event property
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_INFO)) {
+        return validation::urEventGetInfo(hEvent, propName, propSize,
+                                          pPropValue, pPropSizeRet);
+    }
+
+    ur_event_get_info_params_t params = {&hEvent, &propName, &propSize,
+                                         &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_GET_INFO,
+                                                   "urEventGetInfo", &params,
+                                                   hEvent, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventGetInfo\n");
+
+    ur_result_t result = validation::urEventGetInfo(hEvent, propName, propSize,
+                                                    pPropValue, pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_GET_INFO, "urEventGetInfo",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_GET_INFO,
+                                        &params);
+        logger.info("   <--- urEventGetInfo({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEventGetProfilingInfo
+__urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
+    ur_event_handle_t hEvent, ///< [in] handle of the event object
+    ur_profiling_info_t
+        propName,    ///< [in] the name of the profiling property to query
+    size_t propSize, ///< [in] size in bytes of the profiling property value
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the profiling
+                    ///< property
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes returned in
+                     ///< propValue
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_PROFILING_INFO)) {
+        return validation::urEventGetProfilingInfo(hEvent, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+    }
+
+    ur_event_get_profiling_info_params_t params = {
+        &hEvent, &propName, &propSize, &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_EVENT_GET_PROFILING_INFO, "urEventGetProfilingInfo",
+        &params, hEvent, propName, propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventGetProfilingInfo\n");
+
+    ur_result_t result = validation::urEventGetProfilingInfo(hEvent, propName,
+                                                             propSize,
+                                                             pPropValue,
+                                                             pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_GET_PROFILING_INFO,
+                             "urEventGetProfilingInfo", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_EVENT_GET_PROFILING_INFO, &params);
+        logger.info("   <--- urEventGetProfilingInfo({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEventWait
+__urdlllocal ur_result_t UR_APICALL urEventWait(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+                        ///< completion
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_WAIT)) {
+        return validation::urEventWait(numEvents, phEventWaitList);
+    }
+
+    ur_event_wait_params_t params = {&numEvents, &phEventWaitList};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_WAIT,
+                                                   "urEventWait", &params,
+                                                   numEvents, phEventWaitList);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventWait\n");
+
+    ur_result_t result = validation::urEventWait(numEvents, phEventWaitList);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_WAIT, "urEventWait", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_WAIT,
+                                        &params);
+        logger.info("   <--- urEventWait({}) -> {};\n", args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEventRetain
+__urdlllocal ur_result_t UR_APICALL urEventRetain(
+    ur_event_handle_t hEvent ///< [in][retain] handle of the event object
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_RETAIN)) {
+        return validation::urEventRetain(hEvent);
+    }
+
+    ur_event_retain_params_t params = {&hEvent};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_RETAIN,
+                                                   "urEventRetain", &params,
+                                                   hEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventRetain\n");
+
+    ur_result_t result = validation::urEventRetain(hEvent);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_RETAIN, "urEventRetain", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_RETAIN,
+                                        &params);
+        logger.info("   <--- urEventRetain({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEventRelease
+__urdlllocal ur_result_t UR_APICALL urEventRelease(
+    ur_event_handle_t hEvent ///< [in][release] handle of the event object
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_RELEASE)) {
+        return validation::urEventRelease(hEvent);
+    }
+
+    ur_event_release_params_t params = {&hEvent};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_RELEASE,
+                                                   "urEventRelease", &params,
+                                                   hEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventRelease\n");
+
+    ur_result_t result = validation::urEventRelease(hEvent);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_RELEASE, "urEventRelease",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_RELEASE,
+                                        &params);
+        logger.info("   <--- urEventRelease({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEventGetNativeHandle
+__urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
+    ur_event_handle_t hEvent, ///< [in] handle of the event.
+    ur_native_handle_t
+        *phNativeEvent ///< [out] a pointer to the native handle of the event.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE)) {
+        return validation::urEventGetNativeHandle(hEvent, phNativeEvent);
+    }
+
+    ur_event_get_native_handle_params_t params = {&hEvent, &phNativeEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, "urEventGetNativeHandle", &params,
+        hEvent, phNativeEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventGetNativeHandle\n");
+
+    ur_result_t result = validation::urEventGetNativeHandle(hEvent,
+                                                            phNativeEvent);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE,
+                             "urEventGetNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, &params);
+        logger.info("   <--- urEventGetNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEventCreateWithNativeHandle
+__urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
+    ur_native_handle_t
+        hNativeEvent, ///< [in][nocheck] the native handle of the event.
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    const ur_event_native_properties_t *
+        pProperties, ///< [in][optional] pointer to native event properties struct
+    ur_event_handle_t
+        *phEvent ///< [out] pointer to the handle of the event object created.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE)) {
+        return validation::urEventCreateWithNativeHandle(hNativeEvent, hContext,
+                                                         pProperties, phEvent);
+    }
+
+    ur_event_create_with_native_handle_params_t params = {
+        &hNativeEvent, &hContext, &pProperties, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE,
+        "urEventCreateWithNativeHandle", &params, hNativeEvent, hContext,
+        pProperties, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventCreateWithNativeHandle\n");
+
+    ur_result_t result = validation::urEventCreateWithNativeHandle(hNativeEvent,
+                                                                   hContext,
+                                                                   pProperties,
+                                                                   phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE,
+                             "urEventCreateWithNativeHandle", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE, &params);
+        logger.info("   <--- urEventCreateWithNativeHandle({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEventSetCallback
+__urdlllocal ur_result_t UR_APICALL urEventSetCallback(
+    ur_event_handle_t hEvent,       ///< [in] handle of the event object
+    ur_execution_info_t execStatus, ///< [in] execution status of the event
+    ur_event_callback_t pfnNotify,  ///< [in] execution status of the event
+    void *
+        pUserData ///< [in][out][optional] pointer to data to be passed to callback.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_SET_CALLBACK)) {
+        return validation::urEventSetCallback(hEvent, execStatus, pfnNotify,
+                                              pUserData);
+    }
+
+    ur_event_set_callback_params_t params = {&hEvent, &execStatus, &pfnNotify,
+                                             &pUserData};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_EVENT_SET_CALLBACK, "urEventSetCallback", &params, hEvent,
+        execStatus, pfnNotify, pUserData);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventSetCallback\n");
+
+    ur_result_t result = validation::urEventSetCallback(hEvent, execStatus,
+                                                        pfnNotify, pUserData);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_SET_CALLBACK,
+                             "urEventSetCallback", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_EVENT_SET_CALLBACK, &params);
+        logger.info("   <--- urEventSetCallback({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueKernelLaunch
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t
+        workDim, ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                 ///< work-group work-items
+    const size_t *
+        pGlobalWorkOffset, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< offset used to calculate the global ID of a work-item
+    const size_t *
+        pGlobalWorkSize, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< number of global work-items in workDim that will execute the kernel
+    ///< function
+    const size_t *
+        pLocalWorkSize, ///< [in][optional] pointer to an array of workDim unsigned values that
+    ///< specify the number of local work-items forming a work-group that will
+    ///< execute the kernel function.
+    ///< If nullptr, the runtime implementation will choose the work-group
+    ///< size.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH)) {
+        return validation::urEnqueueKernelLaunch(hQueue, hKernel, workDim,
+                                                 pGlobalWorkOffset,
+                                                 pGlobalWorkSize,
+                                                 pLocalWorkSize,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_kernel_launch_params_t params = {&hQueue,
+                                                &hKernel,
+                                                &workDim,
+                                                &pGlobalWorkOffset,
+                                                &pGlobalWorkSize,
+                                                &pLocalWorkSize,
+                                                &numEventsInWaitList,
+                                                &phEventWaitList,
+                                                &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, "urEnqueueKernelLaunch", &params,
+        hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueKernelLaunch\n");
+
+    ur_result_t result = validation::urEnqueueKernelLaunch(hQueue, hKernel,
+                                                           workDim,
+                                                           pGlobalWorkOffset,
+                                                           pGlobalWorkSize,
+                                                           pLocalWorkSize,
+                                                           numEventsInWaitList,
+                                                           phEventWaitList,
+                                                           phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH,
+                             "urEnqueueKernelLaunch", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, &params);
+        logger.info("   <--- urEnqueueKernelLaunch({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueEventsWait
+__urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_EVENTS_WAIT)) {
+        return validation::urEnqueueEventsWait(hQueue, numEventsInWaitList,
+                                               phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_events_wait_params_t params = {&hQueue, &numEventsInWaitList,
+                                              &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_EVENTS_WAIT, "urEnqueueEventsWait", &params, hQueue,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueEventsWait\n");
+
+    ur_result_t result = validation::urEnqueueEventsWait(hQueue,
+                                                         numEventsInWaitList,
+                                                         phEventWaitList,
+                                                         phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_EVENTS_WAIT,
+                             "urEnqueueEventsWait", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_EVENTS_WAIT, &params);
+        logger.info("   <--- urEnqueueEventsWait({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueEventsWaitWithBarrier
+__urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER)) {
+        return validation::urEnqueueEventsWaitWithBarrier(hQueue,
+                                                          numEventsInWaitList,
+                                                          phEventWaitList,
+                                                          phEvent);
+    }
+
+    ur_enqueue_events_wait_with_barrier_params_t params = {
+        &hQueue, &numEventsInWaitList, &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER,
+        "urEnqueueEventsWaitWithBarrier", &params, hQueue, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueEventsWaitWithBarrier\n");
+
+    ur_result_t result = validation::urEnqueueEventsWaitWithBarrier(
+        hQueue, numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER,
+                             "urEnqueueEventsWaitWithBarrier", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER, &params);
+        logger.info("   <--- urEnqueueEventsWaitWithBarrier({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemBufferRead
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
+    size_t offset,     ///< [in] offset in bytes in the buffer object
+    size_t size,       ///< [in] size in bytes of data being read
+    void *pDst, ///< [in] pointer to host memory where data is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ)) {
+        return validation::urEnqueueMemBufferRead(hQueue, hBuffer, blockingRead,
+                                                  offset, size, pDst,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_buffer_read_params_t params = {
+        &hQueue, &hBuffer, &blockingRead,        &offset,
+        &size,   &pDst,    &numEventsInWaitList, &phEventWaitList,
+        &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, "urEnqueueMemBufferRead", &params,
+        hQueue, hBuffer, blockingRead, offset, size, pDst, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemBufferRead\n");
+
+    ur_result_t result = validation::urEnqueueMemBufferRead(hQueue, hBuffer,
+                                                            blockingRead,
+                                                            offset, size, pDst,
+                                                            numEventsInWaitList,
+                                                            phEventWaitList,
+                                                            phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ,
+                             "urEnqueueMemBufferRead", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, &params);
+        logger.info("   <--- urEnqueueMemBufferRead({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemBufferWrite
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    bool
+        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
+    size_t offset,     ///< [in] offset in bytes in the buffer object
+    size_t size,       ///< [in] size in bytes of data being written
+    const void
+        *pSrc, ///< [in] pointer to host memory where data is to be written from
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE)) {
+        return validation::urEnqueueMemBufferWrite(hQueue, hBuffer,
+                                                   blockingWrite, offset, size,
+                                                   pSrc, numEventsInWaitList,
+                                                   phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_buffer_write_params_t params = {
+        &hQueue, &hBuffer, &blockingWrite,       &offset,
+        &size,   &pSrc,    &numEventsInWaitList, &phEventWaitList,
+        &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE, "urEnqueueMemBufferWrite",
+        &params, hQueue, hBuffer, blockingWrite, offset, size, pSrc,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemBufferWrite\n");
+
+    ur_result_t result = validation::urEnqueueMemBufferWrite(
+        hQueue, hBuffer, blockingWrite, offset, size, pSrc, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE,
+                             "urEnqueueMemBufferWrite", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE, &params);
+        logger.info("   <--- urEnqueueMemBufferWrite({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemBufferReadRect
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(bufferOrigin, region)] handle of the buffer object
+    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t bufferOrigin, ///< [in] 3D offset in the buffer
+    ur_rect_offset_t hostOrigin,   ///< [in] 3D offset in the host region
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth
+    size_t
+        bufferRowPitch, ///< [in] length of each row in bytes in the buffer object
+    size_t
+        bufferSlicePitch, ///< [in] length of each 2D slice in bytes in the buffer object being read
+    size_t
+        hostRowPitch, ///< [in] length of each row in bytes in the host memory region pointed by
+                      ///< dst
+    size_t
+        hostSlicePitch, ///< [in] length of each 2D slice in bytes in the host memory region
+                        ///< pointed by dst
+    void *pDst, ///< [in] pointer to host memory where data is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT)) {
+        return validation::urEnqueueMemBufferReadRect(hQueue, hBuffer,
+                                                      blockingRead,
+                                                      bufferOrigin, hostOrigin,
+                                                      region, bufferRowPitch,
+                                                      bufferSlicePitch,
+                                                      hostRowPitch,
+                                                      hostSlicePitch, pDst,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_buffer_read_rect_params_t params = {&hQueue,
+                                                       &hBuffer,
+                                                       &blockingRead,
+                                                       &bufferOrigin,
+                                                       &hostOrigin,
+                                                       &region,
+                                                       &bufferRowPitch,
+                                                       &bufferSlicePitch,
+                                                       &hostRowPitch,
+                                                       &hostSlicePitch,
+                                                       &pDst,
+                                                       &numEventsInWaitList,
+                                                       &phEventWaitList,
+                                                       &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT, "urEnqueueMemBufferReadRect",
+        &params, hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin,
+        region, bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+        pDst, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemBufferReadRect\n");
+
+    ur_result_t result = validation::urEnqueueMemBufferReadRect(
+        hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT,
+                             "urEnqueueMemBufferReadRect", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT, &params);
+        logger.info("   <--- urEnqueueMemBufferReadRect({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemBufferWriteRect
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(bufferOrigin, region)] handle of the buffer object
+    bool
+        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t bufferOrigin, ///< [in] 3D offset in the buffer
+    ur_rect_offset_t hostOrigin,   ///< [in] 3D offset in the host region
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth
+    size_t
+        bufferRowPitch, ///< [in] length of each row in bytes in the buffer object
+    size_t
+        bufferSlicePitch, ///< [in] length of each 2D slice in bytes in the buffer object being
+                          ///< written
+    size_t
+        hostRowPitch, ///< [in] length of each row in bytes in the host memory region pointed by
+                      ///< src
+    size_t
+        hostSlicePitch, ///< [in] length of each 2D slice in bytes in the host memory region
+                        ///< pointed by src
+    void
+        *pSrc, ///< [in] pointer to host memory where data is to be written from
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] points to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT)) {
+        return validation::urEnqueueMemBufferWriteRect(hQueue, hBuffer,
+                                                       blockingWrite,
+                                                       bufferOrigin, hostOrigin,
+                                                       region, bufferRowPitch,
+                                                       bufferSlicePitch,
+                                                       hostRowPitch,
+                                                       hostSlicePitch, pSrc,
+                                                       numEventsInWaitList,
+                                                       phEventWaitList,
+                                                       phEvent);
+    }
+
+    ur_enqueue_mem_buffer_write_rect_params_t params = {&hQueue,
+                                                        &hBuffer,
+                                                        &blockingWrite,
+                                                        &bufferOrigin,
+                                                        &hostOrigin,
+                                                        &region,
+                                                        &bufferRowPitch,
+                                                        &bufferSlicePitch,
+                                                        &hostRowPitch,
+                                                        &hostSlicePitch,
+                                                        &pSrc,
+                                                        &numEventsInWaitList,
+                                                        &phEventWaitList,
+                                                        &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT,
+        "urEnqueueMemBufferWriteRect", &params, hQueue, hBuffer, blockingWrite,
+        bufferOrigin, hostOrigin, region, bufferRowPitch, bufferSlicePitch,
+        hostRowPitch, hostSlicePitch, pSrc, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemBufferWriteRect\n");
+
+    ur_result_t result = validation::urEnqueueMemBufferWriteRect(
+        hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT,
+                             "urEnqueueMemBufferWriteRect", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT, &params);
+        logger.info("   <--- urEnqueueMemBufferWriteRect({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemBufferCopy
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBufferSrc, ///< [in][bounds(srcOffset, size)] handle of the src buffer object
+    ur_mem_handle_t
+        hBufferDst, ///< [in][bounds(dstOffset, size)] handle of the dest buffer object
+    size_t srcOffset, ///< [in] offset into hBufferSrc to begin copying from
+    size_t dstOffset, ///< [in] offset info hBufferDst to begin copying into
+    size_t size,      ///< [in] size in bytes of data being copied
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY)) {
+        return validation::urEnqueueMemBufferCopy(hQueue, hBufferSrc,
+                                                  hBufferDst, srcOffset,
+                                                  dstOffset, size,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_buffer_copy_params_t params = {
+        &hQueue, &hBufferSrc,          &hBufferDst,      &srcOffset, &dstOffset,
+        &size,   &numEventsInWaitList, &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, "urEnqueueMemBufferCopy", &params,
+        hQueue, hBufferSrc, hBufferDst, srcOffset, dstOffset, size,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemBufferCopy\n");
+
+    ur_result_t result = validation::urEnqueueMemBufferCopy(hQueue, hBufferSrc,
+                                                            hBufferDst,
+                                                            srcOffset,
+                                                            dstOffset, size,
+                                                            numEventsInWaitList,
+                                                            phEventWaitList,
+                                                            phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY,
+                             "urEnqueueMemBufferCopy", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, &params);
+        logger.info("   <--- urEnqueueMemBufferCopy({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemBufferCopyRect
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBufferSrc, ///< [in][bounds(srcOrigin, region)] handle of the source buffer object
+    ur_mem_handle_t
+        hBufferDst, ///< [in][bounds(dstOrigin, region)] handle of the dest buffer object
+    ur_rect_offset_t srcOrigin, ///< [in] 3D offset in the source buffer
+    ur_rect_offset_t dstOrigin, ///< [in] 3D offset in the destination buffer
+    ur_rect_region_t
+        region, ///< [in] source 3D rectangular region descriptor: width, height, depth
+    size_t
+        srcRowPitch, ///< [in] length of each row in bytes in the source buffer object
+    size_t
+        srcSlicePitch, ///< [in] length of each 2D slice in bytes in the source buffer object
+    size_t
+        dstRowPitch, ///< [in] length of each row in bytes in the destination buffer object
+    size_t
+        dstSlicePitch, ///< [in] length of each 2D slice in bytes in the destination buffer object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT)) {
+        return validation::urEnqueueMemBufferCopyRect(hQueue, hBufferSrc,
+                                                      hBufferDst, srcOrigin,
+                                                      dstOrigin, region,
+                                                      srcRowPitch,
+                                                      srcSlicePitch,
+                                                      dstRowPitch,
+                                                      dstSlicePitch,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_buffer_copy_rect_params_t params = {
+        &hQueue,      &hBufferSrc,    &hBufferDst,          &srcOrigin,
+        &dstOrigin,   &region,        &srcRowPitch,         &srcSlicePitch,
+        &dstRowPitch, &dstSlicePitch, &numEventsInWaitList, &phEventWaitList,
+        &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT, "urEnqueueMemBufferCopyRect",
+        &params, hQueue, hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemBufferCopyRect\n");
+
+    ur_result_t result = validation::urEnqueueMemBufferCopyRect(
+        hQueue, hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region,
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT,
+                             "urEnqueueMemBufferCopyRect", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT, &params);
+        logger.info("   <--- urEnqueueMemBufferCopyRect({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemBufferFill
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    const void *pPattern, ///< [in] pointer to the fill pattern
+    size_t patternSize,   ///< [in] size in bytes of the pattern
+    size_t offset,        ///< [in] offset into the buffer
+    size_t size, ///< [in] fill size in bytes, must be a multiple of patternSize
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL)) {
+        return validation::urEnqueueMemBufferFill(hQueue, hBuffer, pPattern,
+                                                  patternSize, offset, size,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_buffer_fill_params_t params = {&hQueue,
+                                                  &hBuffer,
+                                                  &pPattern,
+                                                  &patternSize,
+                                                  &offset,
+                                                  &size,
+                                                  &numEventsInWaitList,
+                                                  &phEventWaitList,
+                                                  &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, "urEnqueueMemBufferFill", &params,
+        hQueue, hBuffer, pPattern, patternSize, offset, size,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemBufferFill\n");
+
+    ur_result_t result = validation::urEnqueueMemBufferFill(hQueue, hBuffer,
+                                                            pPattern,
+                                                            patternSize, offset,
+                                                            size,
+                                                            numEventsInWaitList,
+                                                            phEventWaitList,
+                                                            phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL,
+                             "urEnqueueMemBufferFill", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, &params);
+        logger.info("   <--- urEnqueueMemBufferFill({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemImageRead
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hImage, ///< [in][bounds(origin, region)] handle of the image object
+    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t
+        origin, ///< [in] defines the (x,y,z) offset in pixels in the 1D, 2D, or 3D image
+    ur_rect_region_t
+        region, ///< [in] defines the (width, height, depth) in pixels of the 1D, 2D, or 3D
+                ///< image
+    size_t rowPitch,   ///< [in] length of each row in bytes
+    size_t slicePitch, ///< [in] length of each 2D slice of the 3D image
+    void *pDst, ///< [in] pointer to host memory where image is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ)) {
+        return validation::urEnqueueMemImageRead(hQueue, hImage, blockingRead,
+                                                 origin, region, rowPitch,
+                                                 slicePitch, pDst,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_image_read_params_t params = {
+        &hQueue,          &hImage, &blockingRead,
+        &origin,          &region, &rowPitch,
+        &slicePitch,      &pDst,   &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, "urEnqueueMemImageRead", &params,
+        hQueue, hImage, blockingRead, origin, region, rowPitch, slicePitch,
+        pDst, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemImageRead\n");
+
+    ur_result_t result = validation::urEnqueueMemImageRead(hQueue, hImage,
+                                                           blockingRead, origin,
+                                                           region, rowPitch,
+                                                           slicePitch, pDst,
+                                                           numEventsInWaitList,
+                                                           phEventWaitList,
+                                                           phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ,
+                             "urEnqueueMemImageRead", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, &params);
+        logger.info("   <--- urEnqueueMemImageRead({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemImageWrite
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hImage, ///< [in][bounds(origin, region)] handle of the image object
+    bool
+        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t
+        origin, ///< [in] defines the (x,y,z) offset in pixels in the 1D, 2D, or 3D image
+    ur_rect_region_t
+        region, ///< [in] defines the (width, height, depth) in pixels of the 1D, 2D, or 3D
+                ///< image
+    size_t rowPitch,   ///< [in] length of each row in bytes
+    size_t slicePitch, ///< [in] length of each 2D slice of the 3D image
+    void *pSrc, ///< [in] pointer to host memory where image is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE)) {
+        return validation::urEnqueueMemImageWrite(hQueue, hImage, blockingWrite,
+                                                  origin, region, rowPitch,
+                                                  slicePitch, pSrc,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_image_write_params_t params = {
+        &hQueue,          &hImage, &blockingWrite,
+        &origin,          &region, &rowPitch,
+        &slicePitch,      &pSrc,   &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, "urEnqueueMemImageWrite", &params,
+        hQueue, hImage, blockingWrite, origin, region, rowPitch, slicePitch,
+        pSrc, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemImageWrite\n");
+
+    ur_result_t result = validation::urEnqueueMemImageWrite(hQueue, hImage,
+                                                            blockingWrite,
+                                                            origin, region,
+                                                            rowPitch,
+                                                            slicePitch, pSrc,
+                                                            numEventsInWaitList,
+                                                            phEventWaitList,
+                                                            phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE,
+                             "urEnqueueMemImageWrite", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, &params);
+        logger.info("   <--- urEnqueueMemImageWrite({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemImageCopy
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hImageSrc, ///< [in][bounds(srcOrigin, region)] handle of the src image object
+    ur_mem_handle_t
+        hImageDst, ///< [in][bounds(dstOrigin, region)] handle of the dest image object
+    ur_rect_offset_t
+        srcOrigin, ///< [in] defines the (x,y,z) offset in pixels in the source 1D, 2D, or 3D
+                   ///< image
+    ur_rect_offset_t
+        dstOrigin, ///< [in] defines the (x,y,z) offset in pixels in the destination 1D, 2D,
+                   ///< or 3D image
+    ur_rect_region_t
+        region, ///< [in] defines the (width, height, depth) in pixels of the 1D, 2D, or 3D
+                ///< image
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY)) {
+        return validation::urEnqueueMemImageCopy(hQueue, hImageSrc, hImageDst,
+                                                 srcOrigin, dstOrigin, region,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_image_copy_params_t params = {
+        &hQueue, &hImageSrc,           &hImageDst,       &srcOrigin, &dstOrigin,
+        &region, &numEventsInWaitList, &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, "urEnqueueMemImageCopy", &params,
+        hQueue, hImageSrc, hImageDst, srcOrigin, dstOrigin, region,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemImageCopy\n");
+
+    ur_result_t result = validation::urEnqueueMemImageCopy(hQueue, hImageSrc,
+                                                           hImageDst, srcOrigin,
+                                                           dstOrigin, region,
+                                                           numEventsInWaitList,
+                                                           phEventWaitList,
+                                                           phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY,
+                             "urEnqueueMemImageCopy", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, &params);
+        logger.info("   <--- urEnqueueMemImageCopy({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemBufferMap
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    bool blockingMap, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_map_flags_t mapFlags, ///< [in] flags for read, write, readwrite mapping
+    size_t offset, ///< [in] offset in bytes of the buffer region being mapped
+    size_t size,   ///< [in] size in bytes of the buffer region being mapped
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent, ///< [out][optional] return an event object that identifies this particular
+                 ///< command instance.
+    void **ppRetMap ///< [out] return mapped pointer.  TODO: move it before
+                    ///< numEventsInWaitList?
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP)) {
+        return validation::urEnqueueMemBufferMap(hQueue, hBuffer, blockingMap,
+                                                 mapFlags, offset, size,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent,
+                                                 ppRetMap);
+    }
+
+    ur_enqueue_mem_buffer_map_params_t params = {
+        &hQueue,  &hBuffer, &blockingMap,         &mapFlags,
+        &offset,  &size,    &numEventsInWaitList, &phEventWaitList,
+        &phEvent, &ppRetMap};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, "urEnqueueMemBufferMap", &params,
+        hQueue, hBuffer, blockingMap, mapFlags, offset, size,
+        numEventsInWaitList, phEventWaitList, phEvent, ppRetMap);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemBufferMap\n");
+
+    ur_result_t result = validation::urEnqueueMemBufferMap(hQueue, hBuffer,
+                                                           blockingMap,
+                                                           mapFlags, offset,
+                                                           size,
+                                                           numEventsInWaitList,
+                                                           phEventWaitList,
+                                                           phEvent, ppRetMap);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP,
+                             "urEnqueueMemBufferMap", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, &params);
+        logger.info("   <--- urEnqueueMemBufferMap({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemUnmap
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hMem,         ///< [in] handle of the memory (buffer or image) object
+    void *pMappedPtr, ///< [in] mapped host address
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_UNMAP)) {
+        return validation::urEnqueueMemUnmap(hQueue, hMem, pMappedPtr,
+                                             numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_unmap_params_t params = {
+        &hQueue,          &hMem,   &pMappedPtr, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_UNMAP, "urEnqueueMemUnmap", &params, hQueue,
+        hMem, pMappedPtr, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemUnmap\n");
+
+    ur_result_t result = validation::urEnqueueMemUnmap(hQueue, hMem, pMappedPtr,
+                                                       numEventsInWaitList,
+                                                       phEventWaitList,
+                                                       phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_UNMAP, "urEnqueueMemUnmap",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_MEM_UNMAP,
+                                        &params);
+        logger.info("   <--- urEnqueueMemUnmap({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueUSMFill
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    void *pMem, ///< [in][bounds(0, size)] pointer to USM memory object
+    size_t
+        patternSize, ///< [in] the size in bytes of the pattern. Must be a power of 2 and less
+                     ///< than or equal to width.
+    const void
+        *pPattern, ///< [in] pointer with the bytes of the pattern to set.
+    size_t
+        size, ///< [in] size in bytes to be set. Must be a multiple of patternSize.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_FILL)) {
+        return validation::urEnqueueUSMFill(hQueue, pMem, patternSize, pPattern,
+                                            size, numEventsInWaitList,
+                                            phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_usm_fill_params_t params = {
+        &hQueue,          &pMem,   &patternSize,
+        &pPattern,        &size,   &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ENQUEUE_USM_FILL,
+                                                   "urEnqueueUSMFill", &params,
+                                                   hQueue, pMem, patternSize,
+                                                   pPattern, size,
+                                                   numEventsInWaitList,
+                                                   phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueUSMFill\n");
+
+    ur_result_t result = validation::urEnqueueUSMFill(hQueue, pMem, patternSize,
+                                                      pPattern, size,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_FILL, "urEnqueueUSMFill",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_USM_FILL,
+                                        &params);
+        logger.info("   <--- urEnqueueUSMFill({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueUSMMemcpy
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    bool blocking,            ///< [in] blocking or non-blocking copy
+    void *
+        pDst, ///< [in][bounds(0, size)] pointer to the destination USM memory object
+    const void *
+        pSrc, ///< [in][bounds(0, size)] pointer to the source USM memory object
+    size_t size,                  ///< [in] size in bytes to be copied
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_MEMCPY)) {
+        return validation::urEnqueueUSMMemcpy(hQueue, blocking, pDst, pSrc,
+                                              size, numEventsInWaitList,
+                                              phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_usm_memcpy_params_t params = {
+        &hQueue,          &blocking, &pDst, &pSrc, &size, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_MEMCPY, "urEnqueueUSMMemcpy", &params, hQueue,
+        blocking, pDst, pSrc, size, numEventsInWaitList, phEventWaitList,
+        phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueUSMMemcpy\n");
+
+    ur_result_t result = validation::urEnqueueUSMMemcpy(hQueue, blocking, pDst,
+                                                        pSrc, size,
+                                                        numEventsInWaitList,
+                                                        phEventWaitList,
+                                                        phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_MEMCPY,
+                             "urEnqueueUSMMemcpy", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_USM_MEMCPY, &params);
+        logger.info("   <--- urEnqueueUSMMemcpy({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueUSMPrefetch
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void
+        *pMem,   ///< [in][bounds(0, size)] pointer to the USM memory object
+    size_t size, ///< [in] size in bytes to be fetched
+    ur_usm_migration_flags_t flags, ///< [in] USM prefetch flags
+    uint32_t numEventsInWaitList,   ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_PREFETCH)) {
+        return validation::urEnqueueUSMPrefetch(hQueue, pMem, size, flags,
+                                                numEventsInWaitList,
+                                                phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_usm_prefetch_params_t params = {
+        &hQueue,          &pMem,   &size, &flags, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_PREFETCH, "urEnqueueUSMPrefetch", &params,
+        hQueue, pMem, size, flags, numEventsInWaitList, phEventWaitList,
+        phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueUSMPrefetch\n");
+
+    ur_result_t result = validation::urEnqueueUSMPrefetch(hQueue, pMem, size,
+                                                          flags,
+                                                          numEventsInWaitList,
+                                                          phEventWaitList,
+                                                          phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_PREFETCH,
+                             "urEnqueueUSMPrefetch", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_USM_PREFETCH, &params);
+        logger.info("   <--- urEnqueueUSMPrefetch({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueUSMAdvise
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void
+        *pMem,   ///< [in][bounds(0, size)] pointer to the USM memory object
+    size_t size, ///< [in] size in bytes to be advised
+    ur_usm_advice_flags_t advice, ///< [in] USM memory advice
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_ADVISE)) {
+        return validation::urEnqueueUSMAdvise(hQueue, pMem, size, advice,
+                                              phEvent);
+    }
+
+    ur_enqueue_usm_advise_params_t params = {&hQueue, &pMem, &size, &advice,
+                                             &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_ADVISE, "urEnqueueUSMAdvise", &params, hQueue,
+        pMem, size, advice, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueUSMAdvise\n");
+
+    ur_result_t result = validation::urEnqueueUSMAdvise(hQueue, pMem, size,
+                                                        advice, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_ADVISE,
+                             "urEnqueueUSMAdvise", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_USM_ADVISE, &params);
+        logger.info("   <--- urEnqueueUSMAdvise({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueUSMFill2D
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    void *
+        pMem, ///< [in][bounds(0, pitch * height)] pointer to memory to be filled.
+    size_t
+        pitch, ///< [in] the total width of the destination memory including padding.
+    size_t
+        patternSize, ///< [in] the size in bytes of the pattern. Must be a power of 2 and less
+                     ///< than or equal to width.
+    const void
+        *pPattern, ///< [in] pointer with the bytes of the pattern to set.
+    size_t
+        width, ///< [in] the width in bytes of each row to fill. Must be a multiple of
+               ///< patternSize.
+    size_t height,                ///< [in] the height of the columns to fill.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_FILL_2D)) {
+        return validation::urEnqueueUSMFill2D(hQueue, pMem, pitch, patternSize,
+                                              pPattern, width, height,
+                                              numEventsInWaitList,
+                                              phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_usm_fill_2d_params_t params = {
+        &hQueue,          &pMem,   &pitch,  &patternSize,
+        &pPattern,        &width,  &height, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_FILL_2D, "urEnqueueUSMFill2D", &params, hQueue,
+        pMem, pitch, patternSize, pPattern, width, height, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueUSMFill2D\n");
+
+    ur_result_t result = validation::urEnqueueUSMFill2D(hQueue, pMem, pitch,
+                                                        patternSize, pPattern,
+                                                        width, height,
+                                                        numEventsInWaitList,
+                                                        phEventWaitList,
+                                                        phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_FILL_2D,
+                             "urEnqueueUSMFill2D", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_USM_FILL_2D, &params);
+        logger.info("   <--- urEnqueueUSMFill2D({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueUSMMemcpy2D
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    bool blocking, ///< [in] indicates if this operation should block the host.
+    void *
+        pDst, ///< [in][bounds(0, dstPitch * height)] pointer to memory where data will
+              ///< be copied.
+    size_t
+        dstPitch, ///< [in] the total width of the source memory including padding.
+    const void *
+        pSrc, ///< [in][bounds(0, srcPitch * height)] pointer to memory to be copied.
+    size_t
+        srcPitch, ///< [in] the total width of the source memory including padding.
+    size_t width,  ///< [in] the width in bytes of each row to be copied.
+    size_t height, ///< [in] the height of columns to be copied.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D)) {
+        return validation::urEnqueueUSMMemcpy2D(hQueue, blocking, pDst,
+                                                dstPitch, pSrc, srcPitch, width,
+                                                height, numEventsInWaitList,
+                                                phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_usm_memcpy_2d_params_t params = {
+        &hQueue,          &blocking, &pDst,
+        &dstPitch,        &pSrc,     &srcPitch,
+        &width,           &height,   &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D, "urEnqueueUSMMemcpy2D", &params,
+        hQueue, blocking, pDst, dstPitch, pSrc, srcPitch, width, height,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueUSMMemcpy2D\n");
+
+    ur_result_t result = validation::urEnqueueUSMMemcpy2D(hQueue, blocking,
+                                                          pDst, dstPitch, pSrc,
+                                                          srcPitch, width,
+                                                          height,
+                                                          numEventsInWaitList,
+                                                          phEventWaitList,
+                                                          phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D,
+                             "urEnqueueUSMMemcpy2D", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D, &params);
+        logger.info("   <--- urEnqueueUSMMemcpy2D({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueDeviceGlobalVariableWrite
+__urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    ur_program_handle_t
+        hProgram, ///< [in] handle of the program containing the device global variable.
+    const char
+        *name, ///< [in] the unique identifier for the device global variable.
+    bool blockingWrite, ///< [in] indicates if this operation should block.
+    size_t count,       ///< [in] the number of bytes to copy.
+    size_t
+        offset, ///< [in] the byte offset into the device global variable to start copying.
+    const void *pSrc, ///< [in] pointer to where the data must be copied from.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE)) {
+        return validation::urEnqueueDeviceGlobalVariableWrite(
+            hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
+            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_device_global_variable_write_params_t params = {
+        &hQueue,          &hProgram, &name, &blockingWrite,
+        &count,           &offset,   &pSrc, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
+        "urEnqueueDeviceGlobalVariableWrite", &params, hQueue, hProgram, name,
+        blockingWrite, count, offset, pSrc, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueDeviceGlobalVariableWrite\n");
+
+    ur_result_t result = validation::urEnqueueDeviceGlobalVariableWrite(
+        hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
+                             "urEnqueueDeviceGlobalVariableWrite", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
+            &params);
+        logger.info("   <--- urEnqueueDeviceGlobalVariableWrite({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueDeviceGlobalVariableRead
+__urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue to submit to.
+    ur_program_handle_t
+        hProgram, ///< [in] handle of the program containing the device global variable.
+    const char
+        *name, ///< [in] the unique identifier for the device global variable.
+    bool blockingRead, ///< [in] indicates if this operation should block.
+    size_t count,      ///< [in] the number of bytes to copy.
+    size_t
+        offset, ///< [in] the byte offset into the device global variable to start copying.
+    void *pDst, ///< [in] pointer to where the data must be copied to.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ)) {
+        return validation::urEnqueueDeviceGlobalVariableRead(
+            hQueue, hProgram, name, blockingRead, count, offset, pDst,
+            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_device_global_variable_read_params_t params = {
+        &hQueue,          &hProgram, &name, &blockingRead,
+        &count,           &offset,   &pDst, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ,
+        "urEnqueueDeviceGlobalVariableRead", &params, hQueue, hProgram, name,
+        blockingRead, count, offset, pDst, numEventsInWaitList, phEventWaitList,
+        phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueDeviceGlobalVariableRead\n");
+
+    ur_result_t result = validation::urEnqueueDeviceGlobalVariableRead(
+        hQueue, hProgram, name, blockingRead, count, offset, pDst,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ,
+                             "urEnqueueDeviceGlobalVariableRead", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ, &params);
+        logger.info("   <--- urEnqueueDeviceGlobalVariableRead({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueReadHostPipe
+__urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
+    ur_queue_handle_t
+        hQueue, ///< [in] a valid host command-queue in which the read command
+    ///< will be queued. hQueue and hProgram must be created with the same
+    ///< UR context.
+    ur_program_handle_t
+        hProgram, ///< [in] a program object with a successfully built executable.
+    const char *
+        pipe_symbol, ///< [in] the name of the program scope pipe global variable.
+    bool
+        blocking, ///< [in] indicate if the read operation is blocking or non-blocking.
+    void *
+        pDst, ///< [in] a pointer to buffer in host memory that will hold resulting data
+              ///< from pipe.
+    size_t size, ///< [in] size of the memory region to read, in bytes.
+    uint32_t numEventsInWaitList, ///< [in] number of events in the wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the host pipe read.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] returns an event object that identifies this read
+                ///< command
+    ///< and can be used to query or queue a wait for this command to complete.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE)) {
+        return validation::urEnqueueReadHostPipe(hQueue, hProgram, pipe_symbol,
+                                                 blocking, pDst, size,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_read_host_pipe_params_t params = {
+        &hQueue, &hProgram, &pipe_symbol,         &blocking,
+        &pDst,   &size,     &numEventsInWaitList, &phEventWaitList,
+        &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, "urEnqueueReadHostPipe", &params,
+        hQueue, hProgram, pipe_symbol, blocking, pDst, size,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueReadHostPipe\n");
+
+    ur_result_t result = validation::urEnqueueReadHostPipe(hQueue, hProgram,
+                                                           pipe_symbol,
+                                                           blocking, pDst, size,
+                                                           numEventsInWaitList,
+                                                           phEventWaitList,
+                                                           phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE,
+                             "urEnqueueReadHostPipe", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, &params);
+        logger.info("   <--- urEnqueueReadHostPipe({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueWriteHostPipe
+__urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
+    ur_queue_handle_t
+        hQueue, ///< [in] a valid host command-queue in which the write command
+    ///< will be queued. hQueue and hProgram must be created with the same
+    ///< UR context.
+    ur_program_handle_t
+        hProgram, ///< [in] a program object with a successfully built executable.
+    const char *
+        pipe_symbol, ///< [in] the name of the program scope pipe global variable.
+    bool
+        blocking, ///< [in] indicate if the read and write operations are blocking or
+                  ///< non-blocking.
+    void *
+        pSrc, ///< [in] a pointer to buffer in host memory that holds data to be written
+              ///< to the host pipe.
+    size_t size, ///< [in] size of the memory region to read or write, in bytes.
+    uint32_t numEventsInWaitList, ///< [in] number of events in the wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the host pipe write.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] returns an event object that identifies this write command
+    ///< and can be used to query or queue a wait for this command to complete.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE)) {
+        return validation::urEnqueueWriteHostPipe(hQueue, hProgram, pipe_symbol,
+                                                  blocking, pSrc, size,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_write_host_pipe_params_t params = {
+        &hQueue, &hProgram, &pipe_symbol,         &blocking,
+        &pSrc,   &size,     &numEventsInWaitList, &phEventWaitList,
+        &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, "urEnqueueWriteHostPipe", &params,
+        hQueue, hProgram, pipe_symbol, blocking, pSrc, size,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueWriteHostPipe\n");
+
+    ur_result_t result = validation::urEnqueueWriteHostPipe(hQueue, hProgram,
+                                                            pipe_symbol,
+                                                            blocking, pSrc,
+                                                            size,
+                                                            numEventsInWaitList,
+                                                            phEventWaitList,
+                                                            phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE,
+                             "urEnqueueWriteHostPipe", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, &params);
+        logger.info("   <--- urEnqueueWriteHostPipe({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMPitchedAllocExp
+__urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_usm_desc_t *
+        pUSMDesc, ///< [in][optional] Pointer to USM memory allocation descriptor.
+    ur_usm_pool_handle_t
+        pool, ///< [in][optional] Pointer to a pool created using urUSMPoolCreate
+    size_t
+        widthInBytes, ///< [in] width in bytes of the USM memory object to be allocated
+    size_t height, ///< [in] height of the USM memory object to be allocated
+    size_t
+        elementSizeBytes, ///< [in] size in bytes of an element in the allocation
+    void **ppMem,         ///< [out] pointer to USM shared memory object
+    size_t *pResultPitch  ///< [out] pitch of the allocation
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_PITCHED_ALLOC_EXP)) {
+        return validation::urUSMPitchedAllocExp(hContext, hDevice, pUSMDesc,
+                                                pool, widthInBytes, height,
+                                                elementSizeBytes, ppMem,
+                                                pResultPitch);
+    }
+
+    ur_usm_pitched_alloc_exp_params_t params = {
+        &hContext, &hDevice,          &pUSMDesc, &pool,        &widthInBytes,
+        &height,   &elementSizeBytes, &ppMem,    &pResultPitch};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_PITCHED_ALLOC_EXP, "urUSMPitchedAllocExp", &params,
+        hContext, hDevice, pUSMDesc, pool, widthInBytes, height,
+        elementSizeBytes, ppMem, pResultPitch);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMPitchedAllocExp\n");
+
+    ur_result_t result = validation::urUSMPitchedAllocExp(hContext, hDevice,
+                                                          pUSMDesc, pool,
+                                                          widthInBytes, height,
+                                                          elementSizeBytes,
+                                                          ppMem, pResultPitch);
+
+    getContext()->notify_end(UR_FUNCTION_USM_PITCHED_ALLOC_EXP,
+                             "urUSMPitchedAllocExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_USM_PITCHED_ALLOC_EXP, &params);
+        logger.info("   <--- urUSMPitchedAllocExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesUnsampledImageHandleDestroyExp
+__urdlllocal ur_result_t UR_APICALL
+urBindlessImagesUnsampledImageHandleDestroyExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_native_handle_t
+        hImage ///< [in][release] pointer to handle of image object to destroy
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP)) {
+        return validation::urBindlessImagesUnsampledImageHandleDestroyExp(
+            hContext, hDevice, hImage);
+    }
+
+    ur_bindless_images_unsampled_image_handle_destroy_exp_params_t params = {
+        &hContext, &hDevice, &hImage};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+        "urBindlessImagesUnsampledImageHandleDestroyExp", &params, hContext,
+        hDevice, hImage);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesUnsampledImageHandleDestroyExp\n");
+
+    ur_result_t result = validation::urBindlessImagesUnsampledImageHandleDestroyExp(
+        hContext, hDevice, hImage);
+
+    getContext()->notify_end(
+        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+        "urBindlessImagesUnsampledImageHandleDestroyExp", &params, &result,
+        instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str,
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+            &params);
+        logger.info(
+            "   <--- urBindlessImagesUnsampledImageHandleDestroyExp({}) -> "
+            "{};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesSampledImageHandleDestroyExp
+__urdlllocal ur_result_t UR_APICALL
+urBindlessImagesSampledImageHandleDestroyExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_native_handle_t
+        hImage ///< [in][release] pointer to handle of image object to destroy
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP)) {
+        return validation::urBindlessImagesSampledImageHandleDestroyExp(
+            hContext, hDevice, hImage);
+    }
+
+    ur_bindless_images_sampled_image_handle_destroy_exp_params_t params = {
+        &hContext, &hDevice, &hImage};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+        "urBindlessImagesSampledImageHandleDestroyExp", &params, hContext,
+        hDevice, hImage);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesSampledImageHandleDestroyExp\n");
+
+    ur_result_t result = validation::urBindlessImagesSampledImageHandleDestroyExp(
+        hContext, hDevice, hImage);
+
+    getContext()->notify_end(
+        UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+        "urBindlessImagesSampledImageHandleDestroyExp", &params, &result,
+        instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str,
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
+            &params);
+        logger.info(
+            "   <--- urBindlessImagesSampledImageHandleDestroyExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesImageAllocateExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
+    ur_exp_image_mem_native_handle_t
+        *phImageMem ///< [out] pointer to handle of image memory allocated
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP)) {
+        return validation::urBindlessImagesImageAllocateExp(hContext, hDevice,
+                                                            pImageFormat,
+                                                            pImageDesc,
+                                                            phImageMem);
+    }
+
+    ur_bindless_images_image_allocate_exp_params_t params = {
+        &hContext, &hDevice, &pImageFormat, &pImageDesc, &phImageMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP,
+        "urBindlessImagesImageAllocateExp", &params, hContext, hDevice,
+        pImageFormat, pImageDesc, phImageMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesImageAllocateExp\n");
+
+    ur_result_t result = validation::urBindlessImagesImageAllocateExp(
+        hContext, hDevice, pImageFormat, pImageDesc, phImageMem);
+
+    getContext()->notify_end(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP,
+                             "urBindlessImagesImageAllocateExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP, &params);
+        logger.info("   <--- urBindlessImagesImageAllocateExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesImageFreeExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_mem_native_handle_t
+        hImageMem ///< [in][release] handle of image memory to be freed
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP)) {
+        return validation::urBindlessImagesImageFreeExp(hContext, hDevice,
+                                                        hImageMem);
+    }
+
+    ur_bindless_images_image_free_exp_params_t params = {&hContext, &hDevice,
+                                                         &hImageMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP,
+        "urBindlessImagesImageFreeExp", &params, hContext, hDevice, hImageMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesImageFreeExp\n");
+
+    ur_result_t result = validation::urBindlessImagesImageFreeExp(hContext,
+                                                                  hDevice,
+                                                                  hImageMem);
+
+    getContext()->notify_end(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP,
+                             "urBindlessImagesImageFreeExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP, &params);
+        logger.info("   <--- urBindlessImagesImageFreeExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesUnsampledImageCreateExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_mem_native_handle_t
+        hImageMem, ///< [in] handle to memory from which to create the image
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
+    ur_exp_image_native_handle_t
+        *phImage ///< [out] pointer to handle of image object created
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP)) {
+        return validation::urBindlessImagesUnsampledImageCreateExp(hContext,
+                                                                   hDevice,
+                                                                   hImageMem,
+                                                                   pImageFormat,
+                                                                   pImageDesc,
+                                                                   phImage);
+    }
+
+    ur_bindless_images_unsampled_image_create_exp_params_t params = {
+        &hContext, &hDevice, &hImageMem, &pImageFormat, &pImageDesc, &phImage};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
+        "urBindlessImagesUnsampledImageCreateExp", &params, hContext, hDevice,
+        hImageMem, pImageFormat, pImageDesc, phImage);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesUnsampledImageCreateExp\n");
+
+    ur_result_t result = validation::urBindlessImagesUnsampledImageCreateExp(
+        hContext, hDevice, hImageMem, pImageFormat, pImageDesc, phImage);
+
+    getContext()->notify_end(
+        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
+        "urBindlessImagesUnsampledImageCreateExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
+            &params);
+        logger.info(
+            "   <--- urBindlessImagesUnsampledImageCreateExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesSampledImageCreateExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_mem_native_handle_t
+        hImageMem, ///< [in] handle to memory from which to create the image
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
+    ur_sampler_handle_t hSampler,      ///< [in] sampler to be used
+    ur_exp_image_native_handle_t
+        *phImage ///< [out] pointer to handle of image object created
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP)) {
+        return validation::urBindlessImagesSampledImageCreateExp(hContext,
+                                                                 hDevice,
+                                                                 hImageMem,
+                                                                 pImageFormat,
+                                                                 pImageDesc,
+                                                                 hSampler,
+                                                                 phImage);
+    }
+
+    ur_bindless_images_sampled_image_create_exp_params_t params = {
+        &hContext,   &hDevice,  &hImageMem, &pImageFormat,
+        &pImageDesc, &hSampler, &phImage};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
+        "urBindlessImagesSampledImageCreateExp", &params, hContext, hDevice,
+        hImageMem, pImageFormat, pImageDesc, hSampler, phImage);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesSampledImageCreateExp\n");
+
+    ur_result_t result = validation::urBindlessImagesSampledImageCreateExp(
+        hContext, hDevice, hImageMem, pImageFormat, pImageDesc, hSampler,
+        phImage);
+
+    getContext()->notify_end(
+        UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
+        "urBindlessImagesSampledImageCreateExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
+            &params);
+        logger.info(
+            "   <--- urBindlessImagesSampledImageCreateExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesImageCopyExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void *pSrc,         ///< [in] location the data will be copied from
+    void *pDst,               ///< [in] location the data will be copied to
+    const ur_image_desc_t *pSrcImageDesc, ///< [in] pointer to image description
+    const ur_image_desc_t *pDstImageDesc, ///< [in] pointer to image description
+    const ur_image_format_t
+        *pSrcImageFormat, ///< [in] pointer to image format specification
+    const ur_image_format_t
+        *pDstImageFormat, ///< [in] pointer to image format specification
+    ur_exp_image_copy_region_t *
+        pCopyRegion, ///< [in] Pointer to structure describing the (sub-)regions of source and
+                     ///< destination images
+    ur_exp_image_copy_flags_t
+        imageCopyFlags, ///< [in] flags describing copy direction e.g. H2D or D2H
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP)) {
+        return validation::urBindlessImagesImageCopyExp(hQueue, pSrc, pDst,
+                                                        pSrcImageDesc,
+                                                        pDstImageDesc,
+                                                        pSrcImageFormat,
+                                                        pDstImageFormat,
+                                                        pCopyRegion,
+                                                        imageCopyFlags,
+                                                        numEventsInWaitList,
+                                                        phEventWaitList,
+                                                        phEvent);
+    }
+
+    ur_bindless_images_image_copy_exp_params_t params = {&hQueue,
+                                                         &pSrc,
+                                                         &pDst,
+                                                         &pSrcImageDesc,
+                                                         &pDstImageDesc,
+                                                         &pSrcImageFormat,
+                                                         &pDstImageFormat,
+                                                         &pCopyRegion,
+                                                         &imageCopyFlags,
+                                                         &numEventsInWaitList,
+                                                         &phEventWaitList,
+                                                         &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP,
+        "urBindlessImagesImageCopyExp", &params, hQueue, pSrc, pDst,
+        pSrcImageDesc, pDstImageDesc, pSrcImageFormat, pDstImageFormat,
+        pCopyRegion, imageCopyFlags, numEventsInWaitList, phEventWaitList,
+        phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesImageCopyExp\n");
+
+    ur_result_t result = validation::urBindlessImagesImageCopyExp(
+        hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+        pDstImageFormat, pCopyRegion, imageCopyFlags, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP,
+                             "urBindlessImagesImageCopyExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP, &params);
+        logger.info("   <--- urBindlessImagesImageCopyExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesImageGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_exp_image_mem_native_handle_t
+        hImageMem,            ///< [in] handle to the image memory
+    ur_image_info_t propName, ///< [in] queried info name
+    void *pPropValue,         ///< [out][optional] returned query value
+    size_t *pPropSizeRet      ///< [out][optional] returned query value size
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP)) {
+        return validation::urBindlessImagesImageGetInfoExp(hContext, hImageMem,
+                                                           propName, pPropValue,
+                                                           pPropSizeRet);
+    }
+
+    ur_bindless_images_image_get_info_exp_params_t params = {
+        &hContext, &hImageMem, &propName, &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP,
+        "urBindlessImagesImageGetInfoExp", &params, hContext, hImageMem,
+        propName, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesImageGetInfoExp\n");
+
+    ur_result_t result = validation::urBindlessImagesImageGetInfoExp(
+        hContext, hImageMem, propName, pPropValue, pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP,
+                             "urBindlessImagesImageGetInfoExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP, &params);
+        logger.info("   <--- urBindlessImagesImageGetInfoExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesMipmapGetLevelExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_mem_native_handle_t
+        hImageMem,        ///< [in] memory handle to the mipmap image
+    uint32_t mipmapLevel, ///< [in] requested level of the mipmap
+    ur_exp_image_mem_native_handle_t
+        *phImageMem ///< [out] returning memory handle to the individual image
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP)) {
+        return validation::urBindlessImagesMipmapGetLevelExp(hContext, hDevice,
+                                                             hImageMem,
+                                                             mipmapLevel,
+                                                             phImageMem);
+    }
+
+    ur_bindless_images_mipmap_get_level_exp_params_t params = {
+        &hContext, &hDevice, &hImageMem, &mipmapLevel, &phImageMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP,
+        "urBindlessImagesMipmapGetLevelExp", &params, hContext, hDevice,
+        hImageMem, mipmapLevel, phImageMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesMipmapGetLevelExp\n");
+
+    ur_result_t result = validation::urBindlessImagesMipmapGetLevelExp(
+        hContext, hDevice, hImageMem, mipmapLevel, phImageMem);
+
+    getContext()->notify_end(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP,
+                             "urBindlessImagesMipmapGetLevelExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP,
+            &params);
+        logger.info("   <--- urBindlessImagesMipmapGetLevelExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesMipmapFreeExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_image_mem_native_handle_t
+        hMem ///< [in][release] handle of image memory to be freed
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP)) {
+        return validation::urBindlessImagesMipmapFreeExp(hContext, hDevice,
+                                                         hMem);
+    }
+
+    ur_bindless_images_mipmap_free_exp_params_t params = {&hContext, &hDevice,
+                                                          &hMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP,
+        "urBindlessImagesMipmapFreeExp", &params, hContext, hDevice, hMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesMipmapFreeExp\n");
+
+    ur_result_t result = validation::urBindlessImagesMipmapFreeExp(hContext,
+                                                                   hDevice,
+                                                                   hMem);
+
+    getContext()->notify_end(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP,
+                             "urBindlessImagesMipmapFreeExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP, &params);
+        logger.info("   <--- urBindlessImagesMipmapFreeExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesImportExternalMemoryExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    size_t size,                  ///< [in] size of the external memory
+    ur_exp_external_mem_type_t
+        memHandleType, ///< [in] type of external memory handle
+    ur_exp_external_mem_desc_t
+        *pExternalMemDesc, ///< [in] the external memory descriptor
+    ur_exp_external_mem_handle_t
+        *phExternalMem ///< [out] external memory handle to the external memory
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP)) {
+        return validation::urBindlessImagesImportExternalMemoryExp(
+            hContext, hDevice, size, memHandleType, pExternalMemDesc,
+            phExternalMem);
+    }
+
+    ur_bindless_images_import_external_memory_exp_params_t params = {
+        &hContext,      &hDevice,          &size,
+        &memHandleType, &pExternalMemDesc, &phExternalMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
+        "urBindlessImagesImportExternalMemoryExp", &params, hContext, hDevice,
+        size, memHandleType, pExternalMemDesc, phExternalMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesImportExternalMemoryExp\n");
+
+    ur_result_t result = validation::urBindlessImagesImportExternalMemoryExp(
+        hContext, hDevice, size, memHandleType, pExternalMemDesc,
+        phExternalMem);
+
+    getContext()->notify_end(
+        UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
+        "urBindlessImagesImportExternalMemoryExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
+            &params);
+        logger.info(
+            "   <--- urBindlessImagesImportExternalMemoryExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesMapExternalArrayExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    const ur_image_format_t
+        *pImageFormat, ///< [in] pointer to image format specification
+    const ur_image_desc_t *pImageDesc, ///< [in] pointer to image description
+    ur_exp_external_mem_handle_t
+        hExternalMem, ///< [in] external memory handle to the external memory
+    ur_exp_image_mem_native_handle_t *
+        phImageMem ///< [out] image memory handle to the externally allocated memory
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP)) {
+        return validation::urBindlessImagesMapExternalArrayExp(hContext,
+                                                               hDevice,
+                                                               pImageFormat,
+                                                               pImageDesc,
+                                                               hExternalMem,
+                                                               phImageMem);
+    }
+
+    ur_bindless_images_map_external_array_exp_params_t params = {
+        &hContext,   &hDevice,      &pImageFormat,
+        &pImageDesc, &hExternalMem, &phImageMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP,
+        "urBindlessImagesMapExternalArrayExp", &params, hContext, hDevice,
+        pImageFormat, pImageDesc, hExternalMem, phImageMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesMapExternalArrayExp\n");
+
+    ur_result_t result = validation::urBindlessImagesMapExternalArrayExp(
+        hContext, hDevice, pImageFormat, pImageDesc, hExternalMem, phImageMem);
+
+    getContext()->notify_end(UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP,
+                             "urBindlessImagesMapExternalArrayExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP,
+            &params);
+        logger.info("   <--- urBindlessImagesMapExternalArrayExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesMapExternalLinearMemoryExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    uint64_t offset,              ///< [in] offset into memory region to map
+    uint64_t size,                ///< [in] size of memory region to map
+    ur_exp_external_mem_handle_t
+        hExternalMem, ///< [in] external memory handle to the external memory
+    void **ppRetMem   ///< [out] pointer of the externally allocated memory
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP)) {
+        return validation::urBindlessImagesMapExternalLinearMemoryExp(
+            hContext, hDevice, offset, size, hExternalMem, ppRetMem);
+    }
+
+    ur_bindless_images_map_external_linear_memory_exp_params_t params = {
+        &hContext, &hDevice, &offset, &size, &hExternalMem, &ppRetMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
+        "urBindlessImagesMapExternalLinearMemoryExp", &params, hContext,
+        hDevice, offset, size, hExternalMem, ppRetMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesMapExternalLinearMemoryExp\n");
+
+    ur_result_t result = validation::urBindlessImagesMapExternalLinearMemoryExp(
+        hContext, hDevice, offset, size, hExternalMem, ppRetMem);
+
+    getContext()->notify_end(
+        UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
+        "urBindlessImagesMapExternalLinearMemoryExp", &params, &result,
+        instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str,
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
+            &params);
+        logger.info(
+            "   <--- urBindlessImagesMapExternalLinearMemoryExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesReleaseExternalMemoryExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_external_mem_handle_t
+        hExternalMem ///< [in][release] handle of external memory to be destroyed
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP)) {
+        return validation::urBindlessImagesReleaseExternalMemoryExp(
+            hContext, hDevice, hExternalMem);
+    }
+
+    ur_bindless_images_release_external_memory_exp_params_t params = {
+        &hContext, &hDevice, &hExternalMem};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
+        "urBindlessImagesReleaseExternalMemoryExp", &params, hContext, hDevice,
+        hExternalMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesReleaseExternalMemoryExp\n");
+
+    ur_result_t result = validation::urBindlessImagesReleaseExternalMemoryExp(
+        hContext, hDevice, hExternalMem);
+
+    getContext()->notify_end(
+        UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
+        "urBindlessImagesReleaseExternalMemoryExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
+            &params);
+        logger.info(
+            "   <--- urBindlessImagesReleaseExternalMemoryExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesImportExternalSemaphoreExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_external_semaphore_type_t
+        semHandleType, ///< [in] type of external memory handle
+    ur_exp_external_semaphore_desc_t
+        *pExternalSemaphoreDesc, ///< [in] the external semaphore descriptor
+    ur_exp_external_semaphore_handle_t *
+        phExternalSemaphore ///< [out] external semaphore handle to the external semaphore
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP)) {
+        return validation::urBindlessImagesImportExternalSemaphoreExp(
+            hContext, hDevice, semHandleType, pExternalSemaphoreDesc,
+            phExternalSemaphore);
+    }
+
+    ur_bindless_images_import_external_semaphore_exp_params_t params = {
+        &hContext, &hDevice, &semHandleType, &pExternalSemaphoreDesc,
+        &phExternalSemaphore};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP,
+        "urBindlessImagesImportExternalSemaphoreExp", &params, hContext,
+        hDevice, semHandleType, pExternalSemaphoreDesc, phExternalSemaphore);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesImportExternalSemaphoreExp\n");
+
+    ur_result_t result = validation::urBindlessImagesImportExternalSemaphoreExp(
+        hContext, hDevice, semHandleType, pExternalSemaphoreDesc,
+        phExternalSemaphore);
+
+    getContext()->notify_end(
+        UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP,
+        "urBindlessImagesImportExternalSemaphoreExp", &params, &result,
+        instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP,
+            &params);
+        logger.info(
+            "   <--- urBindlessImagesImportExternalSemaphoreExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesReleaseExternalSemaphoreExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    ur_exp_external_semaphore_handle_t
+        hExternalSemaphore ///< [in][release] handle of external semaphore to be destroyed
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP)) {
+        return validation::urBindlessImagesReleaseExternalSemaphoreExp(
+            hContext, hDevice, hExternalSemaphore);
+    }
+
+    ur_bindless_images_release_external_semaphore_exp_params_t params = {
+        &hContext, &hDevice, &hExternalSemaphore};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
+        "urBindlessImagesReleaseExternalSemaphoreExp", &params, hContext,
+        hDevice, hExternalSemaphore);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesReleaseExternalSemaphoreExp\n");
+
+    ur_result_t result = validation::urBindlessImagesReleaseExternalSemaphoreExp(
+        hContext, hDevice, hExternalSemaphore);
+
+    getContext()->notify_end(
+        UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
+        "urBindlessImagesReleaseExternalSemaphoreExp", &params, &result,
+        instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str,
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
+            &params);
+        logger.info(
+            "   <--- urBindlessImagesReleaseExternalSemaphoreExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesWaitExternalSemaphoreExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_external_semaphore_handle_t
+        hSemaphore, ///< [in] external semaphore handle
+    bool
+        hasWaitValue, ///< [in] indicates whether the samephore is capable and should wait on a
+                      ///< certain value.
+    ///< Otherwise the semaphore is treated like a binary state, and
+    ///< `waitValue` is ignored.
+    uint64_t waitValue,           ///< [in] the value to be waited on
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP)) {
+        return validation::urBindlessImagesWaitExternalSemaphoreExp(
+            hQueue, hSemaphore, hasWaitValue, waitValue, numEventsInWaitList,
+            phEventWaitList, phEvent);
+    }
+
+    ur_bindless_images_wait_external_semaphore_exp_params_t params = {
+        &hQueue,    &hSemaphore,          &hasWaitValue,
+        &waitValue, &numEventsInWaitList, &phEventWaitList,
+        &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
+        "urBindlessImagesWaitExternalSemaphoreExp", &params, hQueue, hSemaphore,
+        hasWaitValue, waitValue, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesWaitExternalSemaphoreExp\n");
+
+    ur_result_t result = validation::urBindlessImagesWaitExternalSemaphoreExp(
+        hQueue, hSemaphore, hasWaitValue, waitValue, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    getContext()->notify_end(
+        UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
+        "urBindlessImagesWaitExternalSemaphoreExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
+            &params);
+        logger.info(
+            "   <--- urBindlessImagesWaitExternalSemaphoreExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urBindlessImagesSignalExternalSemaphoreExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_external_semaphore_handle_t
+        hSemaphore, ///< [in] external semaphore handle
+    bool
+        hasSignalValue, ///< [in] indicates whether the samephore is capable and should signal on a
+                        ///< certain value.
+    ///< Otherwise the semaphore is treated like a binary state, and
+    ///< `signalValue` is ignored.
+    uint64_t signalValue,         ///< [in] the value to be signalled
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP)) {
+        return validation::urBindlessImagesSignalExternalSemaphoreExp(
+            hQueue, hSemaphore, hasSignalValue, signalValue,
+            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    ur_bindless_images_signal_external_semaphore_exp_params_t params = {
+        &hQueue,      &hSemaphore,          &hasSignalValue,
+        &signalValue, &numEventsInWaitList, &phEventWaitList,
+        &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
+        "urBindlessImagesSignalExternalSemaphoreExp", &params, hQueue,
+        hSemaphore, hasSignalValue, signalValue, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesSignalExternalSemaphoreExp\n");
+
+    ur_result_t result = validation::urBindlessImagesSignalExternalSemaphoreExp(
+        hQueue, hSemaphore, hasSignalValue, signalValue, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    getContext()->notify_end(
+        UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
+        "urBindlessImagesSignalExternalSemaphoreExp", &params, &result,
+        instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
+            &params);
+        logger.info(
+            "   <--- urBindlessImagesSignalExternalSemaphoreExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferCreateExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
+    ur_context_handle_t hContext, ///< [in] Handle of the context object.
+    ur_device_handle_t hDevice,   ///< [in] Handle of the device object.
+    const ur_exp_command_buffer_desc_t
+        *pCommandBufferDesc, ///< [in][optional] command-buffer descriptor.
+    ur_exp_command_buffer_handle_t
+        *phCommandBuffer ///< [out] Pointer to command-Buffer handle.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP)) {
+        return validation::urCommandBufferCreateExp(hContext, hDevice,
+                                                    pCommandBufferDesc,
+                                                    phCommandBuffer);
+    }
+
+    ur_command_buffer_create_exp_params_t params = {
+        &hContext, &hDevice, &pCommandBufferDesc, &phCommandBuffer};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP, "urCommandBufferCreateExp",
+        &params, hContext, hDevice, pCommandBufferDesc, phCommandBuffer);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferCreateExp\n");
+
+    ur_result_t result = validation::urCommandBufferCreateExp(
+        hContext, hDevice, pCommandBufferDesc, phCommandBuffer);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP,
+                             "urCommandBufferCreateExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP, &params);
+        logger.info("   <--- urCommandBufferCreateExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferRetainExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer ///< [in][retain] Handle of the command-buffer object.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP)) {
+        return validation::urCommandBufferRetainExp(hCommandBuffer);
+    }
+
+    ur_command_buffer_retain_exp_params_t params = {&hCommandBuffer};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP, "urCommandBufferRetainExp",
+        &params, hCommandBuffer);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferRetainExp\n");
+
+    ur_result_t result = validation::urCommandBufferRetainExp(hCommandBuffer);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP,
+                             "urCommandBufferRetainExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP, &params);
+        logger.info("   <--- urCommandBufferRetainExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferReleaseExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer ///< [in][release] Handle of the command-buffer object.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP)) {
+        return validation::urCommandBufferReleaseExp(hCommandBuffer);
+    }
+
+    ur_command_buffer_release_exp_params_t params = {&hCommandBuffer};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP, "urCommandBufferReleaseExp",
+        &params, hCommandBuffer);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferReleaseExp\n");
+
+    ur_result_t result = validation::urCommandBufferReleaseExp(hCommandBuffer);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP,
+                             "urCommandBufferReleaseExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP, &params);
+        logger.info("   <--- urCommandBufferReleaseExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferFinalizeExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer ///< [in] Handle of the command-buffer object.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP)) {
+        return validation::urCommandBufferFinalizeExp(hCommandBuffer);
+    }
+
+    ur_command_buffer_finalize_exp_params_t params = {&hCommandBuffer};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP, "urCommandBufferFinalizeExp",
+        &params, hCommandBuffer);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferFinalizeExp\n");
+
+    ur_result_t result = validation::urCommandBufferFinalizeExp(hCommandBuffer);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP,
+                             "urCommandBufferFinalizeExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP, &params);
+        logger.info("   <--- urCommandBufferFinalizeExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendKernelLaunchExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,         ///< [in] Handle of the command-buffer object.
+    ur_kernel_handle_t hKernel, ///< [in] Kernel to append.
+    uint32_t workDim,           ///< [in] Dimension of the kernel execution.
+    const size_t
+        *pGlobalWorkOffset, ///< [in] Offset to use when executing kernel.
+    const size_t *
+        pGlobalWorkSize, ///< [in] Global work size to use when executing kernel.
+    const size_t *
+        pLocalWorkSize, ///< [in][optional] Local work size to use when executing kernel. If this
+    ///< parameter is nullptr, then a local work size will be generated by the
+    ///< implementation.
+    uint32_t
+        numKernelAlternatives, ///< [in] The number of kernel alternatives provided in
+                               ///< phKernelAlternatives.
+    ur_kernel_handle_t *
+        phKernelAlternatives, ///< [in][optional][range(0, numKernelAlternatives)] List of kernel handles
+    ///< that might be used to update the kernel in this
+    ///< command after the command-buffer is finalized. The default kernel
+    ///< `hKernel` is implicitly marked as an alternative. It's
+    ///< invalid to specify it as part of this list.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint, ///< [out][optional] Sync point associated with this command.
+    ur_exp_command_buffer_command_handle_t
+        *phCommand ///< [out][optional] Handle to this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP)) {
+        return validation::urCommandBufferAppendKernelLaunchExp(
+            hCommandBuffer, hKernel, workDim, pGlobalWorkOffset,
+            pGlobalWorkSize, pLocalWorkSize, numKernelAlternatives,
+            phKernelAlternatives, numSyncPointsInWaitList, pSyncPointWaitList,
+            pSyncPoint, phCommand);
+    }
+
+    ur_command_buffer_append_kernel_launch_exp_params_t params = {
+        &hCommandBuffer,
+        &hKernel,
+        &workDim,
+        &pGlobalWorkOffset,
+        &pGlobalWorkSize,
+        &pLocalWorkSize,
+        &numKernelAlternatives,
+        &phKernelAlternatives,
+        &numSyncPointsInWaitList,
+        &pSyncPointWaitList,
+        &pSyncPoint,
+        &phCommand};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
+        "urCommandBufferAppendKernelLaunchExp", &params, hCommandBuffer,
+        hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize, pLocalWorkSize,
+        numKernelAlternatives, phKernelAlternatives, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint, phCommand);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendKernelLaunchExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendKernelLaunchExp(
+        hCommandBuffer, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numKernelAlternatives, phKernelAlternatives,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, phCommand);
+
+    getContext()->notify_end(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
+        "urCommandBufferAppendKernelLaunchExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
+            &params);
+        logger.info("   <--- urCommandBufferAppendKernelLaunchExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendUSMMemcpyExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer object.
+    void *pDst,         ///< [in] Location the data will be copied to.
+    const void *pSrc,   ///< [in] The data to be copied.
+    size_t size,        ///< [in] The number of bytes to copy.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP)) {
+        return validation::urCommandBufferAppendUSMMemcpyExp(
+            hCommandBuffer, pDst, pSrc, size, numSyncPointsInWaitList,
+            pSyncPointWaitList, pSyncPoint);
+    }
+
+    ur_command_buffer_append_usm_memcpy_exp_params_t params = {
+        &hCommandBuffer,     &pDst,      &pSrc, &size, &numSyncPointsInWaitList,
+        &pSyncPointWaitList, &pSyncPoint};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP,
+        "urCommandBufferAppendUSMMemcpyExp", &params, hCommandBuffer, pDst,
+        pSrc, size, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendUSMMemcpyExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendUSMMemcpyExp(
+        hCommandBuffer, pDst, pSrc, size, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP,
+                             "urCommandBufferAppendUSMMemcpyExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP,
+            &params);
+        logger.info("   <--- urCommandBufferAppendUSMMemcpyExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendUSMFillExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,   ///< [in] handle of the command-buffer object.
+    void *pMemory,        ///< [in] pointer to USM allocated memory to fill.
+    const void *pPattern, ///< [in] pointer to the fill pattern.
+    size_t patternSize,   ///< [in] size in bytes of the pattern.
+    size_t
+        size, ///< [in] fill size in bytes, must be a multiple of patternSize.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] sync point associated with this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP)) {
+        return validation::urCommandBufferAppendUSMFillExp(
+            hCommandBuffer, pMemory, pPattern, patternSize, size,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    ur_command_buffer_append_usm_fill_exp_params_t params = {
+        &hCommandBuffer,     &pMemory,   &pPattern,
+        &patternSize,        &size,      &numSyncPointsInWaitList,
+        &pSyncPointWaitList, &pSyncPoint};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP,
+        "urCommandBufferAppendUSMFillExp", &params, hCommandBuffer, pMemory,
+        pPattern, patternSize, size, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendUSMFillExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendUSMFillExp(
+        hCommandBuffer, pMemory, pPattern, patternSize, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP,
+                             "urCommandBufferAppendUSMFillExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP, &params);
+        logger.info("   <--- urCommandBufferAppendUSMFillExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendMemBufferCopyExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hSrcMem, ///< [in] The data to be copied.
+    ur_mem_handle_t hDstMem, ///< [in] The location the data will be copied to.
+    size_t srcOffset,        ///< [in] Offset into the source memory.
+    size_t dstOffset,        ///< [in] Offset into the destination memory
+    size_t size,             ///< [in] The number of bytes to be copied.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP)) {
+        return validation::urCommandBufferAppendMemBufferCopyExp(
+            hCommandBuffer, hSrcMem, hDstMem, srcOffset, dstOffset, size,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    ur_command_buffer_append_mem_buffer_copy_exp_params_t params = {
+        &hCommandBuffer,
+        &hSrcMem,
+        &hDstMem,
+        &srcOffset,
+        &dstOffset,
+        &size,
+        &numSyncPointsInWaitList,
+        &pSyncPointWaitList,
+        &pSyncPoint};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
+        "urCommandBufferAppendMemBufferCopyExp", &params, hCommandBuffer,
+        hSrcMem, hDstMem, srcOffset, dstOffset, size, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendMemBufferCopyExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendMemBufferCopyExp(
+        hCommandBuffer, hSrcMem, hDstMem, srcOffset, dstOffset, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    getContext()->notify_end(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
+        "urCommandBufferAppendMemBufferCopyExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
+            &params);
+        logger.info(
+            "   <--- urCommandBufferAppendMemBufferCopyExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendMemBufferWriteExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hBuffer, ///< [in] Handle of the buffer object.
+    size_t offset,           ///< [in] Offset in bytes in the buffer object.
+    size_t size,             ///< [in] Size in bytes of data being written.
+    const void *
+        pSrc, ///< [in] Pointer to host memory where data is to be written from.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP)) {
+        return validation::urCommandBufferAppendMemBufferWriteExp(
+            hCommandBuffer, hBuffer, offset, size, pSrc,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    ur_command_buffer_append_mem_buffer_write_exp_params_t params = {
+        &hCommandBuffer,
+        &hBuffer,
+        &offset,
+        &size,
+        &pSrc,
+        &numSyncPointsInWaitList,
+        &pSyncPointWaitList,
+        &pSyncPoint};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
+        "urCommandBufferAppendMemBufferWriteExp", &params, hCommandBuffer,
+        hBuffer, offset, size, pSrc, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendMemBufferWriteExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendMemBufferWriteExp(
+        hCommandBuffer, hBuffer, offset, size, pSrc, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    getContext()->notify_end(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
+        "urCommandBufferAppendMemBufferWriteExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
+            &params);
+        logger.info(
+            "   <--- urCommandBufferAppendMemBufferWriteExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendMemBufferReadExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hBuffer, ///< [in] Handle of the buffer object.
+    size_t offset,           ///< [in] Offset in bytes in the buffer object.
+    size_t size,             ///< [in] Size in bytes of data being written.
+    void *pDst, ///< [in] Pointer to host memory where data is to be written to.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP)) {
+        return validation::urCommandBufferAppendMemBufferReadExp(
+            hCommandBuffer, hBuffer, offset, size, pDst,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    ur_command_buffer_append_mem_buffer_read_exp_params_t params = {
+        &hCommandBuffer,
+        &hBuffer,
+        &offset,
+        &size,
+        &pDst,
+        &numSyncPointsInWaitList,
+        &pSyncPointWaitList,
+        &pSyncPoint};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
+        "urCommandBufferAppendMemBufferReadExp", &params, hCommandBuffer,
+        hBuffer, offset, size, pDst, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendMemBufferReadExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendMemBufferReadExp(
+        hCommandBuffer, hBuffer, offset, size, pDst, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    getContext()->notify_end(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
+        "urCommandBufferAppendMemBufferReadExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
+            &params);
+        logger.info(
+            "   <--- urCommandBufferAppendMemBufferReadExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendMemBufferCopyRectExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hSrcMem, ///< [in] The data to be copied.
+    ur_mem_handle_t hDstMem, ///< [in] The location the data will be copied to.
+    ur_rect_offset_t
+        srcOrigin, ///< [in] Origin for the region of data to be copied from the source.
+    ur_rect_offset_t
+        dstOrigin, ///< [in] Origin for the region of data to be copied to in the destination.
+    ur_rect_region_t
+        region, ///< [in] The extents describing the region to be copied.
+    size_t srcRowPitch,   ///< [in] Row pitch of the source memory.
+    size_t srcSlicePitch, ///< [in] Slice pitch of the source memory.
+    size_t dstRowPitch,   ///< [in] Row pitch of the destination memory.
+    size_t dstSlicePitch, ///< [in] Slice pitch of the destination memory.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP)) {
+        return validation::urCommandBufferAppendMemBufferCopyRectExp(
+            hCommandBuffer, hSrcMem, hDstMem, srcOrigin, dstOrigin, region,
+            srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    ur_command_buffer_append_mem_buffer_copy_rect_exp_params_t params = {
+        &hCommandBuffer,
+        &hSrcMem,
+        &hDstMem,
+        &srcOrigin,
+        &dstOrigin,
+        &region,
+        &srcRowPitch,
+        &srcSlicePitch,
+        &dstRowPitch,
+        &dstSlicePitch,
+        &numSyncPointsInWaitList,
+        &pSyncPointWaitList,
+        &pSyncPoint};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
+        "urCommandBufferAppendMemBufferCopyRectExp", &params, hCommandBuffer,
+        hSrcMem, hDstMem, srcOrigin, dstOrigin, region, srcRowPitch,
+        srcSlicePitch, dstRowPitch, dstSlicePitch, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendMemBufferCopyRectExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendMemBufferCopyRectExp(
+        hCommandBuffer, hSrcMem, hDstMem, srcOrigin, dstOrigin, region,
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    getContext()->notify_end(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
+        "urCommandBufferAppendMemBufferCopyRectExp", &params, &result,
+        instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str,
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
+            &params);
+        logger.info(
+            "   <--- urCommandBufferAppendMemBufferCopyRectExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendMemBufferWriteRectExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hBuffer, ///< [in] Handle of the buffer object.
+    ur_rect_offset_t bufferOffset, ///< [in] 3D offset in the buffer.
+    ur_rect_offset_t hostOffset,   ///< [in] 3D offset in the host region.
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth.
+    size_t
+        bufferRowPitch, ///< [in] Length of each row in bytes in the buffer object.
+    size_t
+        bufferSlicePitch, ///< [in] Length of each 2D slice in bytes in the buffer object being
+                          ///< written.
+    size_t
+        hostRowPitch, ///< [in] Length of each row in bytes in the host memory region pointed to
+                      ///< by pSrc.
+    size_t
+        hostSlicePitch, ///< [in] Length of each 2D slice in bytes in the host memory region
+                        ///< pointed to by pSrc.
+    void *
+        pSrc, ///< [in] Pointer to host memory where data is to be written from.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP)) {
+        return validation::urCommandBufferAppendMemBufferWriteRectExp(
+            hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+            bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+            pSrc, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    ur_command_buffer_append_mem_buffer_write_rect_exp_params_t params = {
+        &hCommandBuffer,
+        &hBuffer,
+        &bufferOffset,
+        &hostOffset,
+        &region,
+        &bufferRowPitch,
+        &bufferSlicePitch,
+        &hostRowPitch,
+        &hostSlicePitch,
+        &pSrc,
+        &numSyncPointsInWaitList,
+        &pSyncPointWaitList,
+        &pSyncPoint};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
+        "urCommandBufferAppendMemBufferWriteRectExp", &params, hCommandBuffer,
+        hBuffer, bufferOffset, hostOffset, region, bufferRowPitch,
+        bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendMemBufferWriteRectExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendMemBufferWriteRectExp(
+        hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    getContext()->notify_end(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
+        "urCommandBufferAppendMemBufferWriteRectExp", &params, &result,
+        instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str,
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
+            &params);
+        logger.info(
+            "   <--- urCommandBufferAppendMemBufferWriteRectExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendMemBufferReadRectExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] Handle of the command-buffer object.
+    ur_mem_handle_t hBuffer, ///< [in] Handle of the buffer object.
+    ur_rect_offset_t bufferOffset, ///< [in] 3D offset in the buffer.
+    ur_rect_offset_t hostOffset,   ///< [in] 3D offset in the host region.
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth.
+    size_t
+        bufferRowPitch, ///< [in] Length of each row in bytes in the buffer object.
+    size_t
+        bufferSlicePitch, ///< [in] Length of each 2D slice in bytes in the buffer object being read.
+    size_t
+        hostRowPitch, ///< [in] Length of each row in bytes in the host memory region pointed to
+                      ///< by pDst.
+    size_t
+        hostSlicePitch, ///< [in] Length of each 2D slice in bytes in the host memory region
+                        ///< pointed to by pDst.
+    void *pDst, ///< [in] Pointer to host memory where data is to be read into.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] Sync point associated with this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP)) {
+        return validation::urCommandBufferAppendMemBufferReadRectExp(
+            hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+            bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch,
+            pDst, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    ur_command_buffer_append_mem_buffer_read_rect_exp_params_t params = {
+        &hCommandBuffer,
+        &hBuffer,
+        &bufferOffset,
+        &hostOffset,
+        &region,
+        &bufferRowPitch,
+        &bufferSlicePitch,
+        &hostRowPitch,
+        &hostSlicePitch,
+        &pDst,
+        &numSyncPointsInWaitList,
+        &pSyncPointWaitList,
+        &pSyncPoint};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
+        "urCommandBufferAppendMemBufferReadRectExp", &params, hCommandBuffer,
+        hBuffer, bufferOffset, hostOffset, region, bufferRowPitch,
+        bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendMemBufferReadRectExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendMemBufferReadRectExp(
+        hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    getContext()->notify_end(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
+        "urCommandBufferAppendMemBufferReadRectExp", &params, &result,
+        instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str,
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
+            &params);
+        logger.info(
+            "   <--- urCommandBufferAppendMemBufferReadRectExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendMemBufferFillExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,      ///< [in] handle of the command-buffer object.
+    ur_mem_handle_t hBuffer, ///< [in] handle of the buffer object.
+    const void *pPattern,    ///< [in] pointer to the fill pattern.
+    size_t patternSize,      ///< [in] size in bytes of the pattern.
+    size_t offset,           ///< [in] offset into the buffer.
+    size_t
+        size, ///< [in] fill size in bytes, must be a multiple of patternSize.
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] sync point associated with this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP)) {
+        return validation::urCommandBufferAppendMemBufferFillExp(
+            hCommandBuffer, hBuffer, pPattern, patternSize, offset, size,
+            numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+    }
+
+    ur_command_buffer_append_mem_buffer_fill_exp_params_t params = {
+        &hCommandBuffer,
+        &hBuffer,
+        &pPattern,
+        &patternSize,
+        &offset,
+        &size,
+        &numSyncPointsInWaitList,
+        &pSyncPointWaitList,
+        &pSyncPoint};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
+        "urCommandBufferAppendMemBufferFillExp", &params, hCommandBuffer,
+        hBuffer, pPattern, patternSize, offset, size, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendMemBufferFillExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendMemBufferFillExp(
+        hCommandBuffer, hBuffer, pPattern, patternSize, offset, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    getContext()->notify_end(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
+        "urCommandBufferAppendMemBufferFillExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
+            &params);
+        logger.info(
+            "   <--- urCommandBufferAppendMemBufferFillExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendUSMPrefetchExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,  ///< [in] handle of the command-buffer object.
+    const void *pMemory, ///< [in] pointer to USM allocated memory to prefetch.
+    size_t size,         ///< [in] size in bytes to be fetched.
+    ur_usm_migration_flags_t flags, ///< [in] USM prefetch flags
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] sync point associated with this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP)) {
+        return validation::urCommandBufferAppendUSMPrefetchExp(
+            hCommandBuffer, pMemory, size, flags, numSyncPointsInWaitList,
+            pSyncPointWaitList, pSyncPoint);
+    }
+
+    ur_command_buffer_append_usm_prefetch_exp_params_t params = {
+        &hCommandBuffer,
+        &pMemory,
+        &size,
+        &flags,
+        &numSyncPointsInWaitList,
+        &pSyncPointWaitList,
+        &pSyncPoint};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP,
+        "urCommandBufferAppendUSMPrefetchExp", &params, hCommandBuffer, pMemory,
+        size, flags, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendUSMPrefetchExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendUSMPrefetchExp(
+        hCommandBuffer, pMemory, size, flags, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP,
+                             "urCommandBufferAppendUSMPrefetchExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP,
+            &params);
+        logger.info("   <--- urCommandBufferAppendUSMPrefetchExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferAppendUSMAdviseExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer,           ///< [in] handle of the command-buffer object.
+    const void *pMemory,          ///< [in] pointer to the USM memory object.
+    size_t size,                  ///< [in] size in bytes to be advised.
+    ur_usm_advice_flags_t advice, ///< [in] USM memory advice
+    uint32_t
+        numSyncPointsInWaitList, ///< [in] The number of sync points in the provided dependency list.
+    const ur_exp_command_buffer_sync_point_t *
+        pSyncPointWaitList, ///< [in][optional] A list of sync points that this command depends on. May
+                            ///< be ignored if command-buffer is in-order.
+    ur_exp_command_buffer_sync_point_t *
+        pSyncPoint ///< [out][optional] sync point associated with this command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP)) {
+        return validation::urCommandBufferAppendUSMAdviseExp(
+            hCommandBuffer, pMemory, size, advice, numSyncPointsInWaitList,
+            pSyncPointWaitList, pSyncPoint);
+    }
+
+    ur_command_buffer_append_usm_advise_exp_params_t params = {
+        &hCommandBuffer,
+        &pMemory,
+        &size,
+        &advice,
+        &numSyncPointsInWaitList,
+        &pSyncPointWaitList,
+        &pSyncPoint};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP,
+        "urCommandBufferAppendUSMAdviseExp", &params, hCommandBuffer, pMemory,
+        size, advice, numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferAppendUSMAdviseExp\n");
+
+    ur_result_t result = validation::urCommandBufferAppendUSMAdviseExp(
+        hCommandBuffer, pMemory, size, advice, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP,
+                             "urCommandBufferAppendUSMAdviseExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP,
+            &params);
+        logger.info("   <--- urCommandBufferAppendUSMAdviseExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferEnqueueExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer object.
+    ur_queue_handle_t
+        hQueue, ///< [in] The queue to submit this command-buffer for execution.
+    uint32_t numEventsInWaitList, ///< [in] Size of the event wait list.
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the command-buffer execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command-buffer execution instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP)) {
+        return validation::urCommandBufferEnqueueExp(hCommandBuffer, hQueue,
+                                                     numEventsInWaitList,
+                                                     phEventWaitList, phEvent);
+    }
+
+    ur_command_buffer_enqueue_exp_params_t params = {
+        &hCommandBuffer, &hQueue, &numEventsInWaitList, &phEventWaitList,
+        &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP, "urCommandBufferEnqueueExp",
+        &params, hCommandBuffer, hQueue, numEventsInWaitList, phEventWaitList,
+        phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferEnqueueExp\n");
+
+    ur_result_t result = validation::urCommandBufferEnqueueExp(
+        hCommandBuffer, hQueue, numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP,
+                             "urCommandBufferEnqueueExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP, &params);
+        logger.info("   <--- urCommandBufferEnqueueExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferRetainCommandExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
+    ur_exp_command_buffer_command_handle_t
+        hCommand ///< [in][retain] Handle of the command-buffer command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP)) {
+        return validation::urCommandBufferRetainCommandExp(hCommand);
+    }
+
+    ur_command_buffer_retain_command_exp_params_t params = {&hCommand};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP,
+        "urCommandBufferRetainCommandExp", &params, hCommand);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferRetainCommandExp\n");
+
+    ur_result_t result = validation::urCommandBufferRetainCommandExp(hCommand);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP,
+                             "urCommandBufferRetainCommandExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP, &params);
+        logger.info("   <--- urCommandBufferRetainCommandExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferReleaseCommandExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
+    ur_exp_command_buffer_command_handle_t
+        hCommand ///< [in][release] Handle of the command-buffer command.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP)) {
+        return validation::urCommandBufferReleaseCommandExp(hCommand);
+    }
+
+    ur_command_buffer_release_command_exp_params_t params = {&hCommand};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP,
+        "urCommandBufferReleaseCommandExp", &params, hCommand);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferReleaseCommandExp\n");
+
+    ur_result_t result = validation::urCommandBufferReleaseCommandExp(hCommand);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP,
+                             "urCommandBufferReleaseCommandExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP, &params);
+        logger.info("   <--- urCommandBufferReleaseCommandExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferUpdateKernelLaunchExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
+    ur_exp_command_buffer_command_handle_t
+        hCommand, ///< [in] Handle of the command-buffer kernel command to update.
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *
+        pUpdateKernelLaunch ///< [in] Struct defining how the kernel command is to be updated.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP)) {
+        return validation::urCommandBufferUpdateKernelLaunchExp(
+            hCommand, pUpdateKernelLaunch);
+    }
+
+    ur_command_buffer_update_kernel_launch_exp_params_t params = {
+        &hCommand, &pUpdateKernelLaunch};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
+        "urCommandBufferUpdateKernelLaunchExp", &params, hCommand,
+        pUpdateKernelLaunch);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferUpdateKernelLaunchExp\n");
+
+    ur_result_t result = validation::urCommandBufferUpdateKernelLaunchExp(
+        hCommand, pUpdateKernelLaunch);
+
+    getContext()->notify_end(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
+        "urCommandBufferUpdateKernelLaunchExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
+            &params);
+        logger.info("   <--- urCommandBufferUpdateKernelLaunchExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] handle of the command-buffer object
+    ur_exp_command_buffer_info_t
+        propName, ///< [in] the name of the command-buffer property to query
+    size_t
+        propSize, ///< [in] size in bytes of the command-buffer property value
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the
+                    ///< command-buffer property
+    size_t *
+        pPropSizeRet ///< [out][optional] bytes returned in command-buffer property
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP)) {
+        return validation::urCommandBufferGetInfoExp(hCommandBuffer, propName,
+                                                     propSize, pPropValue,
+                                                     pPropSizeRet);
+    }
+
+    ur_command_buffer_get_info_exp_params_t params = {
+        &hCommandBuffer, &propName, &propSize, &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP, "urCommandBufferGetInfoExp",
+        &params, hCommandBuffer, propName, propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferGetInfoExp\n");
+
+    ur_result_t result = validation::urCommandBufferGetInfoExp(hCommandBuffer,
+                                                               propName,
+                                                               propSize,
+                                                               pPropValue,
+                                                               pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP,
+                             "urCommandBufferGetInfoExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP, &params);
+        logger.info("   <--- urCommandBufferGetInfoExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urCommandBufferCommandGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
+    ur_exp_command_buffer_command_handle_t
+        hCommand, ///< [in] handle of the command-buffer command object
+    ur_exp_command_buffer_command_info_t
+        propName, ///< [in] the name of the command-buffer command property to query
+    size_t
+        propSize, ///< [in] size in bytes of the command-buffer command property value
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] value of the
+                    ///< command-buffer command property
+    size_t *
+        pPropSizeRet ///< [out][optional] bytes returned in command-buffer command property
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP)) {
+        return validation::urCommandBufferCommandGetInfoExp(hCommand, propName,
+                                                            propSize,
+                                                            pPropValue,
+                                                            pPropSizeRet);
+    }
+
+    ur_command_buffer_command_get_info_exp_params_t params = {
+        &hCommand, &propName, &propSize, &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP,
+        "urCommandBufferCommandGetInfoExp", &params, hCommand, propName,
+        propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferCommandGetInfoExp\n");
+
+    ur_result_t result = validation::urCommandBufferCommandGetInfoExp(
+        hCommand, propName, propSize, pPropValue, pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP,
+                             "urCommandBufferCommandGetInfoExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP, &params);
+        logger.info("   <--- urCommandBufferCommandGetInfoExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueCooperativeKernelLaunchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t
+        workDim, ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                 ///< work-group work-items
+    const size_t *
+        pGlobalWorkOffset, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< offset used to calculate the global ID of a work-item
+    const size_t *
+        pGlobalWorkSize, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< number of global work-items in workDim that will execute the kernel
+    ///< function
+    const size_t *
+        pLocalWorkSize, ///< [in][optional] pointer to an array of workDim unsigned values that
+    ///< specify the number of local work-items forming a work-group that will
+    ///< execute the kernel function.
+    ///< If nullptr, the runtime implementation will choose the work-group
+    ///< size.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP)) {
+        return validation::urEnqueueCooperativeKernelLaunchExp(
+            hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+            pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_cooperative_kernel_launch_exp_params_t params = {
+        &hQueue,
+        &hKernel,
+        &workDim,
+        &pGlobalWorkOffset,
+        &pGlobalWorkSize,
+        &pLocalWorkSize,
+        &numEventsInWaitList,
+        &phEventWaitList,
+        &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
+        "urEnqueueCooperativeKernelLaunchExp", &params, hQueue, hKernel,
+        workDim, pGlobalWorkOffset, pGlobalWorkSize, pLocalWorkSize,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueCooperativeKernelLaunchExp\n");
+
+    ur_result_t result = validation::urEnqueueCooperativeKernelLaunchExp(
+        hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
+                             "urEnqueueCooperativeKernelLaunchExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
+            &params);
+        logger.info("   <--- urEnqueueCooperativeKernelLaunchExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelSuggestMaxCooperativeGroupCountExp
+__urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    size_t
+        localWorkSize, ///< [in] number of local work-items that will form a work-group when the
+                       ///< kernel is launched
+    size_t
+        dynamicSharedMemorySize, ///< [in] size of dynamic shared memory, for each work-group, in bytes,
+    ///< that will be used when the kernel is launched
+    uint32_t *pGroupCountRet ///< [out] pointer to maximum number of groups
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP)) {
+        return validation::urKernelSuggestMaxCooperativeGroupCountExp(
+            hKernel, localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
+    }
+
+    ur_kernel_suggest_max_cooperative_group_count_exp_params_t params = {
+        &hKernel, &localWorkSize, &dynamicSharedMemorySize, &pGroupCountRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
+        "urKernelSuggestMaxCooperativeGroupCountExp", &params, hKernel,
+        localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelSuggestMaxCooperativeGroupCountExp\n");
+
+    ur_result_t result = validation::urKernelSuggestMaxCooperativeGroupCountExp(
+        hKernel, localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
+
+    getContext()->notify_end(
+        UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
+        "urKernelSuggestMaxCooperativeGroupCountExp", &params, &result,
+        instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str,
+            UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
+            &params);
+        logger.info(
+            "   <--- urKernelSuggestMaxCooperativeGroupCountExp({}) -> {};\n",
+            args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueMemBufferCopyRectBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_mem_handle_t hBufferSrc, ///< [in] handle of the source buffer object
+    ur_mem_handle_t hBufferDst, ///< [in] handle of the dest buffer object
+    uint32_t numRegions, ///< [in] number of rectangular regions to copy
+    const ur_rect_offset_t *
+        pSrcOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the source
+                     ///< buffer
+    const ur_rect_offset_t *
+        pDstOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the
+                     ///< destination buffer
+    const ur_rect_region_t *
+        pRegions, ///< [in][range(0, numRegions)] 3D rectangular region descriptors: width,
+                  ///< height, depth
+    size_t
+        srcRowPitch, ///< [in] length of each row in bytes in the source buffer object
+    size_t
+        srcSlicePitch, ///< [in] length of each 2D slice in bytes in the source buffer object
+    size_t
+        dstRowPitch, ///< [in] length of each row in bytes in the destination buffer object
+    size_t
+        dstSlicePitch, ///< [in] length of each 2D slice in bytes in the destination buffer object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP)) {
+        return validation::urEnqueueMemBufferCopyRectBatchExp(
+            hQueue, hBufferSrc, hBufferDst, numRegions, pSrcOrigins,
+            pDstOrigins, pRegions, srcRowPitch, srcSlicePitch, dstRowPitch,
+            dstSlicePitch, numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_mem_buffer_copy_rect_batch_exp_params_t params = {
+        &hQueue,          &hBufferSrc,    &hBufferDst,
+        &numRegions,      &pSrcOrigins,   &pDstOrigins,
+        &pRegions,        &srcRowPitch,   &srcSlicePitch,
+        &dstRowPitch,     &dstSlicePitch, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP,
+        "urEnqueueMemBufferCopyRectBatchExp", &params, hQueue, hBufferSrc,
+        hBufferDst, numRegions, pSrcOrigins, pDstOrigins, pRegions,
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueMemBufferCopyRectBatchExp\n");
+
+    ur_result_t result = validation::urEnqueueMemBufferCopyRectBatchExp(
+        hQueue, hBufferSrc, hBufferDst, numRegions, pSrcOrigins, pDstOrigins,
+        pRegions, srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP,
+                             "urEnqueueMemBufferCopyRectBatchExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT_BATCH_EXP,
+            &params);
+        logger.info("   <--- urEnqueueMemBufferCopyRectBatchExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueKernelLaunchBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t numLaunches,     ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_desc_t *
+        pLaunches, ///< [in][range(0, numLaunches)] pointer to a list of kernel launch
+                   ///< descriptors
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernels execute.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the completion
+                ///< of all the launches.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP)) {
+        return validation::urEnqueueKernelLaunchBatchExp(hQueue, numLaunches,
+                                                         pLaunches,
+                                                         numEventsInWaitList,
+                                                         phEventWaitList,
+                                                         phEvent);
+    }
+
+    ur_enqueue_kernel_launch_batch_exp_params_t params = {
+        &hQueue, &numLaunches, &pLaunches, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP,
+        "urEnqueueKernelLaunchBatchExp", &params, hQueue, numLaunches,
+        pLaunches, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueKernelLaunchBatchExp\n");
+
+    ur_result_t result = validation::urEnqueueKernelLaunchBatchExp(
+        hQueue, numLaunches, pLaunches, numEventsInWaitList, phEventWaitList,
+        phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP,
+                             "urEnqueueKernelLaunchBatchExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_BATCH_EXP, &params);
+        logger.info("   <--- urEnqueueKernelLaunchBatchExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueTimestampRecordingExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    bool
+        blocking, ///< [in] indicates whether the call to this function should block until
+    ///< until the device timestamp recording command has executed on the
+    ///< device.
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [in,out] return an event object that identifies this particular kernel
+                ///< execution instance. Profiling information can be queried
+    ///< from this event as if `hQueue` had profiling enabled. Querying
+    ///< `UR_PROFILING_INFO_COMMAND_QUEUED` or `UR_PROFILING_INFO_COMMAND_SUBMIT`
+    ///< reports the timestamp at the time of the call to this function.
+    ///< Querying `UR_PROFILING_INFO_COMMAND_START` or `UR_PROFILING_INFO_COMMAND_END`
+    ///< reports the timestamp recorded when the command is executed on the device.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP)) {
+        return validation::urEnqueueTimestampRecordingExp(hQueue, blocking,
+                                                          numEventsInWaitList,
+                                                          phEventWaitList,
+                                                          phEvent);
+    }
+
+    ur_enqueue_timestamp_recording_exp_params_t params = {
+        &hQueue, &blocking, &numEventsInWaitList, &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP,
+        "urEnqueueTimestampRecordingExp", &params, hQueue, blocking,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueTimestampRecordingExp\n");
+
+    ur_result_t result = validation::urEnqueueTimestampRecordingExp(
+        hQueue, blocking, numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP,
+                             "urEnqueueTimestampRecordingExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP, &params);
+        logger.info("   <--- urEnqueueTimestampRecordingExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueUSMDeviceAllocExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the allocation.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    void **ppMem, ///< [out] pointer to USM device memory object
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP)) {
+        return validation::urEnqueueUSMDeviceAllocExp(hQueue, size,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, ppMem,
+                                                      phEvent);
+    }
+
+    ur_enqueue_usm_device_alloc_exp_params_t params = {&hQueue,
+                                                       &size,
+                                                       &numEventsInWaitList,
+                                                       &phEventWaitList,
+                                                       &ppMem,
+                                                       &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP, "urEnqueueUSMDeviceAllocExp",
+        &params, hQueue, size, numEventsInWaitList, phEventWaitList, ppMem,
+        phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueUSMDeviceAllocExp\n");
+
+    ur_result_t result = validation::urEnqueueUSMDeviceAllocExp(
+        hQueue, size, numEventsInWaitList, phEventWaitList, ppMem, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP,
+                             "urEnqueueUSMDeviceAllocExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP, &params);
+        logger.info("   <--- urEnqueueUSMDeviceAllocExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueUSMFreeExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    void *
+        pMem, ///< [in] pointer to USM memory object allocated with
+              ///< ::urEnqueueUSMDeviceAllocExp
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the free.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_FREE_EXP)) {
+        return validation::urEnqueueUSMFreeExp(hQueue, pMem,
+                                               numEventsInWaitList,
+                                               phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_usm_free_exp_params_t params = {
+        &hQueue, &pMem, &numEventsInWaitList, &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_FREE_EXP, "urEnqueueUSMFreeExp", &params,
+        hQueue, pMem, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueUSMFreeExp\n");
+
+    ur_result_t result = validation::urEnqueueUSMFreeExp(hQueue, pMem,
+                                                         numEventsInWaitList,
+                                                         phEventWaitList,
+                                                         phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_FREE_EXP,
+                             "urEnqueueUSMFreeExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_USM_FREE_EXP, &params);
+        logger.info("   <--- urEnqueueUSMFreeExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEventWaitAnyExp
+__urdlllocal ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+    uint32_t *
+        pEventIndex ///< [out] index in phEventWaitList of an event which is complete
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_WAIT_ANY_EXP)) {
+        return validation::urEventWaitAnyExp(numEvents, phEventWaitList,
+                                             pEventIndex);
+    }
+
+    ur_event_wait_any_exp_params_t params = {&numEvents, &phEventWaitList,
+                                             &pEventIndex};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_EVENT_WAIT_ANY_EXP, "urEventWaitAnyExp", &params, numEvents,
+        phEventWaitList, pEventIndex);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventWaitAnyExp\n");
+
+    ur_result_t result = validation::urEventWaitAnyExp(numEvents,
+                                                       phEventWaitList,
+                                                       pEventIndex);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_WAIT_ANY_EXP,
+                             "urEventWaitAnyExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_EVENT_WAIT_ANY_EXP, &params);
+        logger.info("   <--- urEventWaitAnyExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEventGetExecutionStatusExp
+__urdlllocal ur_result_t UR_APICALL urEventGetExecutionStatusExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEvents, ///< [in][range(0, numEvents)] pointer to a list of events to query
+    ur_event_status_t *
+        pStatuses ///< [out][range(0, numEvents)] execution status of each of the events of
+                  ///< phEvents
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP)) {
+        return validation::urEventGetExecutionStatusExp(numEvents, phEvents,
+                                                        pStatuses);
+    }
+
+    ur_event_get_execution_status_exp_params_t params = {&numEvents, &phEvents,
+                                                         &pStatuses};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP,
+        "urEventGetExecutionStatusExp", &params, numEvents, phEvents,
+        pStatuses);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventGetExecutionStatusExp\n");
+
+    ur_result_t result = validation::urEventGetExecutionStatusExp(numEvents,
+                                                                  phEvents,
+                                                                  pStatuses);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP,
+                             "urEventGetExecutionStatusExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_EVENT_GET_EXECUTION_STATUS_EXP, &params);
+        logger.info("   <--- urEventGetExecutionStatusExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urQueueReserveTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReserveTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t
+        capacity ///< [in] number of slots of the ring, the number of markers which can be
+    ///< enqueued before the first one is overwritten
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP)) {
+        return validation::urQueueReserveTimestampMarkersExp(hQueue, capacity);
+    }
+
+    ur_queue_reserve_timestamp_markers_exp_params_t params = {&hQueue,
+                                                              &capacity};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP,
+        "urQueueReserveTimestampMarkersExp", &params, hQueue, capacity);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueReserveTimestampMarkersExp\n");
+
+    ur_result_t result = validation::urQueueReserveTimestampMarkersExp(
+        hQueue, capacity);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP,
+                             "urQueueReserveTimestampMarkersExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_QUEUE_RESERVE_TIMESTAMP_MARKERS_EXP,
+            &params);
+        logger.info("   <--- urQueueReserveTimestampMarkersExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueTimestampMarkerExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the timestamp is written.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    uint64_t *pMarker ///< [out][optional] number of the marker
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP)) {
+        return validation::urEnqueueTimestampMarkerExp(
+            hQueue, numEventsInWaitList, phEventWaitList, pMarker);
+    }
+
+    ur_enqueue_timestamp_marker_exp_params_t params = {
+        &hQueue, &numEventsInWaitList, &phEventWaitList, &pMarker};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP, "urEnqueueTimestampMarkerExp",
+        &params, hQueue, numEventsInWaitList, phEventWaitList, pMarker);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueTimestampMarkerExp\n");
+
+    ur_result_t result = validation::urEnqueueTimestampMarkerExp(
+        hQueue, numEventsInWaitList, phEventWaitList, pMarker);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP,
+                             "urEnqueueTimestampMarkerExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_TIMESTAMP_MARKER_EXP, &params);
+        logger.info("   <--- urEnqueueTimestampMarkerExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urQueueReadTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReadTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint64_t firstMarker,     ///< [in] number of the first marker to read
+    uint32_t count,           ///< [in] number of markers to read
+    uint64_t *
+        pTimestamps ///< [out][range(0, count)] timestamps in nanoseconds of the markers
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP)) {
+        return validation::urQueueReadTimestampMarkersExp(hQueue, firstMarker,
+                                                          count, pTimestamps);
+    }
+
+    ur_queue_read_timestamp_markers_exp_params_t params = {
+        &hQueue, &firstMarker, &count, &pTimestamps};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP,
+        "urQueueReadTimestampMarkersExp", &params, hQueue, firstMarker, count,
+        pTimestamps);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urQueueReadTimestampMarkersExp\n");
+
+    ur_result_t result = validation::urQueueReadTimestampMarkersExp(
+        hQueue, firstMarker, count, pTimestamps);
+
+    getContext()->notify_end(UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP,
+                             "urQueueReadTimestampMarkersExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_QUEUE_READ_TIMESTAMP_MARKERS_EXP, &params);
+        logger.info("   <--- urQueueReadTimestampMarkersExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urKernelSetArgsExp
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments
+    const ur_exp_kernel_arg_properties_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to a list of kernel arguments
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARGS_EXP)) {
+        return validation::urKernelSetArgsExp(hKernel, numArgs, pArgs);
+    }
+
+    ur_kernel_set_args_exp_params_t params = {&hKernel, &numArgs, &pArgs};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_KERNEL_SET_ARGS_EXP, "urKernelSetArgsExp", &params, hKernel,
+        numArgs, pArgs);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelSetArgsExp\n");
+
+    ur_result_t result = validation::urKernelSetArgsExp(hKernel, numArgs,
+                                                        pArgs);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_SET_ARGS_EXP,
+                             "urKernelSetArgsExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_KERNEL_SET_ARGS_EXP, &params);
+        logger.info("   <--- urKernelSetArgsExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueKernelLaunchCustomExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t
+        workDim, ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                 ///< work-group work-items
+    const size_t *
+        pGlobalWorkSize, ///< [in] pointer to an array of workDim unsigned values that specify the
+    ///< number of global work-items in workDim that will execute the kernel
+    ///< function
+    const size_t *
+        pLocalWorkSize, ///< [in][optional] pointer to an array of workDim unsigned values that
+    ///< specify the number of local work-items forming a work-group that will
+    ///< execute the kernel function. If nullptr, the runtime implementation
+    ///< will choose the work-group size.
+    uint32_t numPropsInLaunchPropList, ///< [in] size of the launch prop list
+    const ur_exp_launch_property_t *
+        launchPropList, ///< [in][range(0, numPropsInLaunchPropList)] pointer to a list of launch
+                        ///< properties
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution. If nullptr,
+    ///< the numEventsInWaitList must be 0, indicating that no wait event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< kernel execution instance.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP)) {
+        return validation::urEnqueueKernelLaunchCustomExp(
+            hQueue, hKernel, workDim, pGlobalWorkSize, pLocalWorkSize,
+            numPropsInLaunchPropList, launchPropList, numEventsInWaitList,
+            phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_kernel_launch_custom_exp_params_t params = {
+        &hQueue,          &hKernel,
+        &workDim,         &pGlobalWorkSize,
+        &pLocalWorkSize,  &numPropsInLaunchPropList,
+        &launchPropList,  &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP,
+        "urEnqueueKernelLaunchCustomExp", &params, hQueue, hKernel, workDim,
+        pGlobalWorkSize, pLocalWorkSize, numPropsInLaunchPropList,
+        launchPropList, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueKernelLaunchCustomExp\n");
+
+    ur_result_t result = validation::urEnqueueKernelLaunchCustomExp(
+        hQueue, hKernel, workDim, pGlobalWorkSize, pLocalWorkSize,
+        numPropsInLaunchPropList, launchPropList, numEventsInWaitList,
+        phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP,
+                             "urEnqueueKernelLaunchCustomExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP, &params);
+        logger.info("   <--- urEnqueueKernelLaunchCustomExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramBuildExp
+__urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
+    ur_program_handle_t hProgram, ///< [in] Handle of the program to build.
+    uint32_t numDevices,          ///< [in] number of devices
+    ur_device_handle_t *
+        phDevices, ///< [in][range(0, numDevices)] pointer to array of device handles
+    const char *
+        pOptions ///< [in][optional] pointer to build options null-terminated string.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_BUILD_EXP)) {
+        return validation::urProgramBuildExp(hProgram, numDevices, phDevices,
+                                             pOptions);
+    }
+
+    ur_program_build_exp_params_t params = {&hProgram, &numDevices, &phDevices,
+                                            &pOptions};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_BUILD_EXP, "urProgramBuildExp", &params, hProgram,
+        numDevices, phDevices, pOptions);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramBuildExp\n");
+
+    ur_result_t result = validation::urProgramBuildExp(hProgram, numDevices,
+                                                       phDevices, pOptions);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_BUILD_EXP, "urProgramBuildExp",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_BUILD_EXP,
+                                        &params);
+        logger.info("   <--- urProgramBuildExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramCompileExp
+__urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
+    ur_program_handle_t
+        hProgram,        ///< [in][out] handle of the program to compile.
+    uint32_t numDevices, ///< [in] number of devices
+    ur_device_handle_t *
+        phDevices, ///< [in][range(0, numDevices)] pointer to array of device handles
+    const char *
+        pOptions ///< [in][optional] pointer to build options null-terminated string.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_COMPILE_EXP)) {
+        return validation::urProgramCompileExp(hProgram, numDevices, phDevices,
+                                               pOptions);
+    }
+
+    ur_program_compile_exp_params_t params = {&hProgram, &numDevices,
+                                              &phDevices, &pOptions};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_PROGRAM_COMPILE_EXP, "urProgramCompileExp", &params,
+        hProgram, numDevices, phDevices, pOptions);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramCompileExp\n");
+
+    ur_result_t result = validation::urProgramCompileExp(hProgram, numDevices,
+                                                         phDevices, pOptions);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_COMPILE_EXP,
+                             "urProgramCompileExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_PROGRAM_COMPILE_EXP, &params);
+        logger.info("   <--- urProgramCompileExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urProgramLinkExp
+__urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context instance.
+    uint32_t numDevices,          ///< [in] number of devices
+    ur_device_handle_t *
+        phDevices, ///< [in][range(0, numDevices)] pointer to array of device handles
+    uint32_t count, ///< [in] number of program handles in `phPrograms`.
+    const ur_program_handle_t *
+        phPrograms, ///< [in][range(0, count)] pointer to array of program handles.
+    const char *
+        pOptions, ///< [in][optional] pointer to linker options null-terminated string.
+    ur_program_handle_t
+        *phProgram ///< [out] pointer to handle of program object created.
+) {
+    if (nullptr != phProgram) {
+        *phProgram = nullptr;
+    }
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_LINK_EXP)) {
+        return validation::urProgramLinkExp(hContext, numDevices, phDevices,
+                                            count, phPrograms, pOptions,
+                                            phProgram);
+    }
+
+    ur_program_link_exp_params_t params = {&hContext, &numDevices, &phDevices,
+                                           &count,    &phPrograms, &pOptions,
+                                           &phProgram};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_LINK_EXP,
+                                                   "urProgramLinkExp", &params,
+                                                   hContext, numDevices,
+                                                   phDevices, count, phPrograms,
+                                                   pOptions, phProgram);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urProgramLinkExp\n");
+
+    ur_result_t result = validation::urProgramLinkExp(hContext, numDevices,
+                                                      phDevices, count,
+                                                      phPrograms, pOptions,
+                                                      phProgram);
+
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_LINK_EXP, "urProgramLinkExp",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_LINK_EXP,
+                                        &params);
+        logger.info("   <--- urProgramLinkExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMImportExp
+__urdlllocal ur_result_t UR_APICALL urUSMImportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem,                   ///< [in] pointer to host memory object
+    size_t size ///< [in] size in bytes of the host memory object to be imported
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_IMPORT_EXP)) {
+        return validation::urUSMImportExp(hContext, pMem, size);
+    }
+
+    ur_usm_import_exp_params_t params = {&hContext, &pMem, &size};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_IMPORT_EXP,
+                                                   "urUSMImportExp", &params,
+                                                   hContext, pMem, size);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMImportExp\n");
+
+    ur_result_t result = validation::urUSMImportExp(hContext, pMem, size);
+
+    getContext()->notify_end(UR_FUNCTION_USM_IMPORT_EXP, "urUSMImportExp",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_IMPORT_EXP,
+                                        &params);
+        logger.info("   <--- urUSMImportExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMReleaseExp
+__urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem                    ///< [in] pointer to host memory object
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_RELEASE_EXP)) {
+        return validation::urUSMReleaseExp(hContext, pMem);
+    }
+
+    ur_usm_release_exp_params_t params = {&hContext, &pMem};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_RELEASE_EXP,
+                                                   "urUSMReleaseExp", &params,
+                                                   hContext, pMem);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMReleaseExp\n");
+
+    ur_result_t result = validation::urUSMReleaseExp(hContext, pMem);
+
+    getContext()->notify_end(UR_FUNCTION_USM_RELEASE_EXP, "urUSMReleaseExp",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_RELEASE_EXP,
+                                        &params);
+        logger.info("   <--- urUSMReleaseExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUsmP2PEnablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP)) {
+        return validation::urUsmP2PEnablePeerAccessExp(commandDevice,
+                                                       peerDevice);
+    }
+
+    ur_usm_p2p_enable_peer_access_exp_params_t params = {&commandDevice,
+                                                         &peerDevice};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
+        "urUsmP2PEnablePeerAccessExp", &params, commandDevice, peerDevice);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUsmP2PEnablePeerAccessExp\n");
+
+    ur_result_t result = validation::urUsmP2PEnablePeerAccessExp(commandDevice,
+                                                                 peerDevice);
+
+    getContext()->notify_end(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
+                             "urUsmP2PEnablePeerAccessExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP, &params);
+        logger.info("   <--- urUsmP2PEnablePeerAccessExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUsmP2PDisablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP)) {
+        return validation::urUsmP2PDisablePeerAccessExp(commandDevice,
+                                                        peerDevice);
+    }
+
+    ur_usm_p2p_disable_peer_access_exp_params_t params = {&commandDevice,
+                                                          &peerDevice};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
+        "urUsmP2PDisablePeerAccessExp", &params, commandDevice, peerDevice);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUsmP2PDisablePeerAccessExp\n");
+
+    ur_result_t result = validation::urUsmP2PDisablePeerAccessExp(commandDevice,
+                                                                  peerDevice);
+
+    getContext()->notify_end(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
+                             "urUsmP2PDisablePeerAccessExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP, &params);
+        logger.info("   <--- urUsmP2PDisablePeerAccessExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUsmP2PPeerAccessGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
+    ur_device_handle_t
+        commandDevice,             ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice, ///< [in] handle of the peer device object
+    ur_exp_peer_info_t propName,   ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return the info
+    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    if (!getContext()->isTraced(
+            UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP)) {
+        return validation::urUsmP2PPeerAccessGetInfoExp(commandDevice,
+                                                        peerDevice, propName,
+                                                        propSize, pPropValue,
+                                                        pPropSizeRet);
+    }
+
+    ur_usm_p2p_peer_access_get_info_exp_params_t params = {
+        &commandDevice, &peerDevice, &propName,
+        &propSize,      &pPropValue, &pPropSizeRet};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
+        "urUsmP2PPeerAccessGetInfoExp", &params, commandDevice, peerDevice,
+        propName, propSize, pPropValue, pPropSizeRet);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUsmP2PPeerAccessGetInfoExp\n");
+
+    ur_result_t result = validation::urUsmP2PPeerAccessGetInfoExp(commandDevice,
+                                                                  peerDevice,
+                                                                  propName,
+                                                                  propSize,
+                                                                  pPropValue,
+                                                                  pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
+                             "urUsmP2PPeerAccessGetInfoExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP, &params);
+        logger.info("   <--- urUsmP2PPeerAccessGetInfoExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urUSMPoolTrimExp
+__urdlllocal ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM pool to trim, NULL trims every pool of hContext
+    size_t minBytesToKeep ///< [in] number of cached bytes each pool may keep
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_TRIM_EXP)) {
+        return validation::urUSMPoolTrimExp(hContext, hPool, minBytesToKeep);
+    }
+
+    ur_usm_pool_trim_exp_params_t params = {&hContext, &hPool,
+                                            &minBytesToKeep};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_POOL_TRIM_EXP, "urUSMPoolTrimExp", &params, hContext,
+        hPool, minBytesToKeep);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMPoolTrimExp\n");
+
+    ur_result_t result = validation::urUSMPoolTrimExp(hContext, hPool,
+                                                      minBytesToKeep);
+
+    getContext()->notify_end(UR_FUNCTION_USM_POOL_TRIM_EXP, "urUSMPoolTrimExp",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_TRIM_EXP,
+                                        &params);
+        logger.info("   <--- urUSMPoolTrimExp({}) -> {};\n", args_str.str(),
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracing layer part of urEnqueueNativeCommandExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_enqueue_native_command_function_t
+        pfnNativeEnqueue, ///< [in] function calling the native underlying API, to be executed
+                          ///< immediately.
+    void *data,                ///< [in][optional] data used by pfnNativeEnqueue
+    uint32_t numMemsInMemList, ///< [in] size of the mem list
+    const ur_mem_handle_t *
+        phMemList, ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
+                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
+    ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
+    ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
+    const ur_exp_enqueue_native_command_properties_t *
+        pProperties, ///< [in][optional] pointer to the native enqueue properties
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the work that has
+    ///< been enqueued in nativeEnqueueFunc.
+) {
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP)) {
+        return validation::urEnqueueNativeCommandExp(hQueue, pfnNativeEnqueue,
+                                                     data, numMemsInMemList,
+                                                     phMemList, pProperties,
+                                                     numEventsInWaitList,
+                                                     phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_native_command_exp_params_t params = {&hQueue,
+                                                     &pfnNativeEnqueue,
+                                                     &data,
+                                                     &numMemsInMemList,
+                                                     &phMemList,
+                                                     &pProperties,
+                                                     &numEventsInWaitList,
+                                                     &phEventWaitList,
+                                                     &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP, "urEnqueueNativeCommandExp",
+        &params, hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemList,
+        pProperties, numEventsInWaitList, phEventWaitList, phEvent);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueNativeCommandExp\n");
+
+    ur_result_t result = validation::urEnqueueNativeCommandExp(
+        hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemList,
+        pProperties, numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP,
+                             "urEnqueueNativeCommandExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        std::ostringstream args_str;
+        ur::extras::printFunctionParams(
+            args_str, UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP, &params);
+        logger.info("   <--- urEnqueueNativeCommandExp({}) -> {};\n",
+                    args_str.str(), result);
+    }
+
+    return result;
+}
+
+} // namespace tracing
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Replaces the functions of the table which call the tracing and
+///        validation layers one after the other with the fused functions
+void fuse(ur_dditable_t *dditable) {
+    auto &tracingTable = ur_tracing_layer::getContext()->urDdiTable;
+
+    if (dditable->Platform.pfnGet == ur_tracing_layer::urPlatformGet &&
+        tracingTable.Platform.pfnGet == ur_validation_layer::urPlatformGet) {
+        dditable->Platform.pfnGet = tracing::urPlatformGet;
+    }
+    if (dditable->Platform.pfnGetInfo == ur_tracing_layer::urPlatformGetInfo &&
+        tracingTable.Platform.pfnGetInfo ==
+            ur_validation_layer::urPlatformGetInfo) {
+        dditable->Platform.pfnGetInfo = tracing::urPlatformGetInfo;
+    }
+    if (dditable->Platform.pfnGetNativeHandle ==
+            ur_tracing_layer::urPlatformGetNativeHandle &&
+        tracingTable.Platform.pfnGetNativeHandle ==
+            ur_validation_layer::urPlatformGetNativeHandle) {
+        dditable->Platform.pfnGetNativeHandle =
+            tracing::urPlatformGetNativeHandle;
+    }
+    if (dditable->Platform.pfnCreateWithNativeHandle ==
+            ur_tracing_layer::urPlatformCreateWithNativeHandle &&
+        tracingTable.Platform.pfnCreateWithNativeHandle ==
+            ur_validation_layer::urPlatformCreateWithNativeHandle) {
+        dditable->Platform.pfnCreateWithNativeHandle =
+            tracing::urPlatformCreateWithNativeHandle;
+    }
+    if (dditable->Platform.pfnGetApiVersion ==
+            ur_tracing_layer::urPlatformGetApiVersion &&
+        tracingTable.Platform.pfnGetApiVersion ==
+            ur_validation_layer::urPlatformGetApiVersion) {
+        dditable->Platform.pfnGetApiVersion = tracing::urPlatformGetApiVersion;
+    }
+    if (dditable->Platform.pfnGetBackendOption ==
+            ur_tracing_layer::urPlatformGetBackendOption &&
+        tracingTable.Platform.pfnGetBackendOption ==
+            ur_validation_layer::urPlatformGetBackendOption) {
+        dditable->Platform.pfnGetBackendOption =
+            tracing::urPlatformGetBackendOption;
+    }
+    if (dditable->Context.pfnCreate == ur_tracing_layer::urContextCreate &&
+        tracingTable.Context.pfnCreate ==
+            ur_validation_layer::urContextCreate) {
+        dditable->Context.pfnCreate = tracing::urContextCreate;
+    }
+    if (dditable->Context.pfnRetain == ur_tracing_layer::urContextRetain &&
+        tracingTable.Context.pfnRetain ==
+            ur_validation_layer::urContextRetain) {
+        dditable->Context.pfnRetain = tracing::urContextRetain;
+    }
+    if (dditable->Context.pfnRelease == ur_tracing_layer::urContextRelease &&
+        tracingTable.Context.pfnRelease ==
+            ur_validation_layer::urContextRelease) {
+        dditable->Context.pfnRelease = tracing::urContextRelease;
+    }
+    if (dditable->Context.pfnGetInfo == ur_tracing_layer::urContextGetInfo &&
+        tracingTable.Context.pfnGetInfo ==
+            ur_validation_layer::urContextGetInfo) {
+        dditable->Context.pfnGetInfo = tracing::urContextGetInfo;
+    }
+    if (dditable->Context.pfnGetNativeHandle ==
+            ur_tracing_layer::urContextGetNativeHandle &&
+        tracingTable.Context.pfnGetNativeHandle ==
+            ur_validation_layer::urContextGetNativeHandle) {
+        dditable->Context.pfnGetNativeHandle =
+            tracing::urContextGetNativeHandle;
+    }
+    if (dditable->Context.pfnCreateWithNativeHandle ==
+            ur_tracing_layer::urContextCreateWithNativeHandle &&
+        tracingTable.Context.pfnCreateWithNativeHandle ==
+            ur_validation_layer::urContextCreateWithNativeHandle) {
+        dditable->Context.pfnCreateWithNativeHandle =
+            tracing::urContextCreateWithNativeHandle;
+    }
+    if (dditable->Context.pfnSetExtendedDeleter ==
+            ur_tracing_layer::urContextSetExtendedDeleter &&
+        tracingTable.Context.pfnSetExtendedDeleter ==
+            ur_validation_layer::urContextSetExtendedDeleter) {
+        dditable->Context.pfnSetExtendedDeleter =
+            tracing::urContextSetExtendedDeleter;
+    }
+    if (dditable->Event.pfnGetInfo == ur_tracing_layer::urEventGetInfo &&
+        tracingTable.Event.pfnGetInfo == ur_validation_layer::urEventGetInfo) {
+        dditable->Event.pfnGetInfo = tracing::urEventGetInfo;
+    }
+    if (dditable->Event.pfnGetProfilingInfo ==
+            ur_tracing_layer::urEventGetProfilingInfo &&
+        tracingTable.Event.pfnGetProfilingInfo ==
+            ur_validation_layer::urEventGetProfilingInfo) {
+        dditable->Event.pfnGetProfilingInfo = tracing::urEventGetProfilingInfo;
+    }
+    if (dditable->Event.pfnWait == ur_tracing_layer::urEventWait &&
+        tracingTable.Event.pfnWait == ur_validation_layer::urEventWait) {
+        dditable->Event.pfnWait = tracing::urEventWait;
+    }
+    if (dditable->Event.pfnRetain == ur_tracing_layer::urEventRetain &&
+        tracingTable.Event.pfnRetain == ur_validation_layer::urEventRetain) {
+        dditable->Event.pfnRetain = tracing::urEventRetain;
+    }
+    if (dditable->Event.pfnRelease == ur_tracing_layer::urEventRelease &&
+        tracingTable.Event.pfnRelease == ur_validation_layer::urEventRelease) {
+        dditable->Event.pfnRelease = tracing::urEventRelease;
+    }
+    if (dditable->Event.pfnGetNativeHandle ==
+            ur_tracing_layer::urEventGetNativeHandle &&
+        tracingTable.Event.pfnGetNativeHandle ==
+            ur_validation_layer::urEventGetNativeHandle) {
+        dditable->Event.pfnGetNativeHandle = tracing::urEventGetNativeHandle;
+    }
+    if (dditable->Event.pfnCreateWithNativeHandle ==
+            ur_tracing_layer::urEventCreateWithNativeHandle &&
+        tracingTable.Event.pfnCreateWithNativeHandle ==
+            ur_validation_layer::urEventCreateWithNativeHandle) {
+        dditable->Event.pfnCreateWithNativeHandle =
+            tracing::urEventCreateWithNativeHandle;
+    }
+    if (dditable->Event.pfnSetCallback ==
+            ur_tracing_layer::urEventSetCallback &&
+        tracingTable.Event.pfnSetCallback ==
+            ur_validation_layer::urEventSetCallback) {
+        dditable->Event.pfnSetCallback = tracing::urEventSetCallback;
+    }
+    if (dditable->EventExp.pfnWaitAnyExp ==
+            ur_tracing_layer::urEventWaitAnyExp &&
+        tracingTable.EventExp.pfnWaitAnyExp ==
+            ur_validation_layer::urEventWaitAnyExp) {
+        dditable->EventExp.pfnWaitAnyExp = tracing::urEventWaitAnyExp;
+    }
+    if (dditable->EventExp.pfnGetExecutionStatusExp ==
+            ur_tracing_layer::urEventGetExecutionStatusExp &&
+        tracingTable.EventExp.pfnGetExecutionStatusExp ==
+            ur_validation_layer::urEventGetExecutionStatusExp) {
+        dditable->EventExp.pfnGetExecutionStatusExp =
+            tracing::urEventGetExecutionStatusExp;
+    }
+    if (dditable->QueueExp.pfnReserveTimestampMarkersExp ==
+            ur_tracing_layer::urQueueReserveTimestampMarkersExp &&
+        tracingTable.QueueExp.pfnReserveTimestampMarkersExp ==
+            ur_validation_layer::urQueueReserveTimestampMarkersExp) {
+        dditable->QueueExp.pfnReserveTimestampMarkersExp =
+            tracing::urQueueReserveTimestampMarkersExp;
+    }
+    if (dditable->EnqueueExp.pfnTimestampMarkerExp ==
+            ur_tracing_layer::urEnqueueTimestampMarkerExp &&
+        tracingTable.EnqueueExp.pfnTimestampMarkerExp ==
+            ur_validation_layer::urEnqueueTimestampMarkerExp) {
+        dditable->EnqueueExp.pfnTimestampMarkerExp =
+            tracing::urEnqueueTimestampMarkerExp;
+    }
+    if (dditable->QueueExp.pfnReadTimestampMarkersExp ==
+            ur_tracing_layer::urQueueReadTimestampMarkersExp &&
+        tracingTable.QueueExp.pfnReadTimestampMarkersExp ==
+            ur_validation_layer::urQueueReadTimestampMarkersExp) {
+        dditable->QueueExp.pfnReadTimestampMarkersExp =
+            tracing::urQueueReadTimestampMarkersExp;
+    }
+    if (dditable->Program.pfnCreateWithIL ==
+            ur_tracing_layer::urProgramCreateWithIL &&
+        tracingTable.Program.pfnCreateWithIL ==
+            ur_validation_layer::urProgramCreateWithIL) {
+        dditable->Program.pfnCreateWithIL = tracing::urProgramCreateWithIL;
+    }
+    if (dditable->Program.pfnCreateWithBinary ==
+            ur_tracing_layer::urProgramCreateWithBinary &&
+        tracingTable.Program.pfnCreateWithBinary ==
+            ur_validation_layer::urProgramCreateWithBinary) {
+        dditable->Program.pfnCreateWithBinary =
+            tracing::urProgramCreateWithBinary;
+    }
+    if (dditable->Program.pfnBuild == ur_tracing_layer::urProgramBuild &&
+        tracingTable.Program.pfnBuild == ur_validation_layer::urProgramBuild) {
+        dditable->Program.pfnBuild = tracing::urProgramBuild;
+    }
+    if (dditable->Program.pfnCompile == ur_tracing_layer::urProgramCompile &&
+        tracingTable.Program.pfnCompile ==
+            ur_validation_layer::urProgramCompile) {
+        dditable->Program.pfnCompile = tracing::urProgramCompile;
+    }
+    if (dditable->Program.pfnLink == ur_tracing_layer::urProgramLink &&
+        tracingTable.Program.pfnLink == ur_validation_layer::urProgramLink) {
+        dditable->Program.pfnLink = tracing::urProgramLink;
+    }
+    if (dditable->Program.pfnRetain == ur_tracing_layer::urProgramRetain &&
+        tracingTable.Program.pfnRetain ==
+            ur_validation_layer::urProgramRetain) {
+        dditable->Program.pfnRetain = tracing::urProgramRetain;
+    }
+    if (dditable->Program.pfnRelease == ur_tracing_layer::urProgramRelease &&
+        tracingTable.Program.pfnRelease ==
+            ur_validation_layer::urProgramRelease) {
+        dditable->Program.pfnRelease = tracing::urProgramRelease;
+    }
+    if (dditable->Program.pfnGetFunctionPointer ==
+            ur_tracing_layer::urProgramGetFunctionPointer &&
+        tracingTable.Program.pfnGetFunctionPointer ==
+            ur_validation_layer::urProgramGetFunctionPointer) {
+        dditable->Program.pfnGetFunctionPointer =
+            tracing::urProgramGetFunctionPointer;
+    }
+    if (dditable->Program.pfnGetGlobalVariablePointer ==
+            ur_tracing_layer::urProgramGetGlobalVariablePointer &&
+        tracingTable.Program.pfnGetGlobalVariablePointer ==
+            ur_validation_layer::urProgramGetGlobalVariablePointer) {
+        dditable->Program.pfnGetGlobalVariablePointer =
+            tracing::urProgramGetGlobalVariablePointer;
+    }
+    if (dditable->Program.pfnGetInfo == ur_tracing_layer::urProgramGetInfo &&
+        tracingTable.Program.pfnGetInfo ==
+            ur_validation_layer::urProgramGetInfo) {
+        dditable->Program.pfnGetInfo = tracing::urProgramGetInfo;
+    }
+    if (dditable->Program.pfnGetBuildInfo ==
+            ur_tracing_layer::urProgramGetBuildInfo &&
+        tracingTable.Program.pfnGetBuildInfo ==
+            ur_validation_layer::urProgramGetBuildInfo) {
+        dditable->Program.pfnGetBuildInfo = tracing::urProgramGetBuildInfo;
+    }
+    if (dditable->Program.pfnSetSpecializationConstants ==
+            ur_tracing_layer::urProgramSetSpecializationConstants &&
+        tracingTable.Program.pfnSetSpecializationConstants ==
+            ur_validation_layer::urProgramSetSpecializationConstants) {
+        dditable->Program.pfnSetSpecializationConstants =
+            tracing::urProgramSetSpecializationConstants;
+    }
+    if (dditable->Program.pfnGetNativeHandle ==
+            ur_tracing_layer::urProgramGetNativeHandle &&
+        tracingTable.Program.pfnGetNativeHandle ==
+            ur_validation_layer::urProgramGetNativeHandle) {
+        dditable->Program.pfnGetNativeHandle =
+            tracing::urProgramGetNativeHandle;
+    }
+    if (dditable->Program.pfnCreateWithNativeHandle ==
+            ur_tracing_layer::urProgramCreateWithNativeHandle &&
+        tracingTable.Program.pfnCreateWithNativeHandle ==
+            ur_validation_layer::urProgramCreateWithNativeHandle) {
+        dditable->Program.pfnCreateWithNativeHandle =
+            tracing::urProgramCreateWithNativeHandle;
+    }
+    if (dditable->ProgramExp.pfnBuildExp ==
+            ur_tracing_layer::urProgramBuildExp &&
+        tracingTable.ProgramExp.pfnBuildExp ==
+            ur_validation_layer::urProgramBuildExp) {
+        dditable->ProgramExp.pfnBuildExp = tracing::urProgramBuildExp;
+    }
+    if (dditable->ProgramExp.pfnCompileExp ==
+            ur_tracing_layer::urProgramCompileExp &&
+        tracingTable.ProgramExp.pfnCompileExp ==
+            ur_validation_layer::urProgramCompileExp) {
+        dditable->ProgramExp.pfnCompileExp = tracing::urProgramCompileExp;
+    }
+    if (dditable->ProgramExp.pfnLinkExp == ur_tracing_layer::urProgramLinkExp &&
+        tracingTable.ProgramExp.pfnLinkExp ==
+            ur_validation_layer::urProgramLinkExp) {
+        dditable->ProgramExp.pfnLinkExp = tracing::urProgramLinkExp;
+    }
+    if (dditable->Kernel.pfnCreate == ur_tracing_layer::urKernelCreate &&
+        tracingTable.Kernel.pfnCreate == ur_validation_layer::urKernelCreate) {
+        dditable->Kernel.pfnCreate = tracing::urKernelCreate;
+    }
+    if (dditable->Kernel.pfnGetInfo == ur_tracing_layer::urKernelGetInfo &&
+        tracingTable.Kernel.pfnGetInfo ==
+            ur_validation_layer::urKernelGetInfo) {
+        dditable->Kernel.pfnGetInfo = tracing::urKernelGetInfo;
+    }
+    if (dditable->Kernel.pfnGetGroupInfo ==
+            ur_tracing_layer::urKernelGetGroupInfo &&
+        tracingTable.Kernel.pfnGetGroupInfo ==
+            ur_validation_layer::urKernelGetGroupInfo) {
+        dditable->Kernel.pfnGetGroupInfo = tracing::urKernelGetGroupInfo;
+    }
+    if (dditable->Kernel.pfnGetSubGroupInfo ==
+            ur_tracing_layer::urKernelGetSubGroupInfo &&
+        tracingTable.Kernel.pfnGetSubGroupInfo ==
+            ur_validation_layer::urKernelGetSubGroupInfo) {
+        dditable->Kernel.pfnGetSubGroupInfo = tracing::urKernelGetSubGroupInfo;
+    }
+    if (dditable->Kernel.pfnRetain == ur_tracing_layer::urKernelRetain &&
+        tracingTable.Kernel.pfnRetain == ur_validation_layer::urKernelRetain) {
+        dditable->Kernel.pfnRetain = tracing::urKernelRetain;
+    }
+    if (dditable->Kernel.pfnRelease == ur_tracing_layer::urKernelRelease &&
+        tracingTable.Kernel.pfnRelease ==
+            ur_validation_layer::urKernelRelease) {
+        dditable->Kernel.pfnRelease = tracing::urKernelRelease;
+    }
+    if (dditable->Kernel.pfnGetNativeHandle ==
+            ur_tracing_layer::urKernelGetNativeHandle &&
+        tracingTable.Kernel.pfnGetNativeHandle ==
+            ur_validation_layer::urKernelGetNativeHandle) {
+        dditable->Kernel.pfnGetNativeHandle = tracing::urKernelGetNativeHandle;
+    }
+    if (dditable->Kernel.pfnCreateWithNativeHandle ==
+            ur_tracing_layer::urKernelCreateWithNativeHandle &&
+        tracingTable.Kernel.pfnCreateWithNativeHandle ==
+            ur_validation_layer::urKernelCreateWithNativeHandle) {
+        dditable->Kernel.pfnCreateWithNativeHandle =
+            tracing::urKernelCreateWithNativeHandle;
+    }
+    if (dditable->Kernel.pfnGetSuggestedLocalWorkSize ==
+            ur_tracing_layer::urKernelGetSuggestedLocalWorkSize &&
+        tracingTable.Kernel.pfnGetSuggestedLocalWorkSize ==
+            ur_validation_layer::urKernelGetSuggestedLocalWorkSize) {
+        dditable->Kernel.pfnGetSuggestedLocalWorkSize =
+            tracing::urKernelGetSuggestedLocalWorkSize;
+    }
+    if (dditable->Kernel.pfnSetArgValue ==
+            ur_tracing_layer::urKernelSetArgValue &&
+        tracingTable.Kernel.pfnSetArgValue ==
+            ur_validation_layer::urKernelSetArgValue) {
+        dditable->Kernel.pfnSetArgValue = tracing::urKernelSetArgValue;
+    }
+    if (dditable->Kernel.pfnSetArgLocal ==
+            ur_tracing_layer::urKernelSetArgLocal &&
+        tracingTable.Kernel.pfnSetArgLocal ==
+            ur_validation_layer::urKernelSetArgLocal) {
+        dditable->Kernel.pfnSetArgLocal = tracing::urKernelSetArgLocal;
+    }
+    if (dditable->Kernel.pfnSetArgPointer ==
+            ur_tracing_layer::urKernelSetArgPointer &&
+        tracingTable.Kernel.pfnSetArgPointer ==
+            ur_validation_layer::urKernelSetArgPointer) {
+        dditable->Kernel.pfnSetArgPointer = tracing::urKernelSetArgPointer;
+    }
+    if (dditable->Kernel.pfnSetExecInfo ==
+            ur_tracing_layer::urKernelSetExecInfo &&
+        tracingTable.Kernel.pfnSetExecInfo ==
+            ur_validation_layer::urKernelSetExecInfo) {
+        dditable->Kernel.pfnSetExecInfo = tracing::urKernelSetExecInfo;
+    }
+    if (dditable->Kernel.pfnSetArgSampler ==
+            ur_tracing_layer::urKernelSetArgSampler &&
+        tracingTable.Kernel.pfnSetArgSampler ==
+            ur_validation_layer::urKernelSetArgSampler) {
+        dditable->Kernel.pfnSetArgSampler = tracing::urKernelSetArgSampler;
+    }
+    if (dditable->Kernel.pfnSetArgMemObj ==
+            ur_tracing_layer::urKernelSetArgMemObj &&
+        tracingTable.Kernel.pfnSetArgMemObj ==
+            ur_validation_layer::urKernelSetArgMemObj) {
+        dditable->Kernel.pfnSetArgMemObj = tracing::urKernelSetArgMemObj;
+    }
+    if (dditable->Kernel.pfnSetSpecializationConstants ==
+            ur_tracing_layer::urKernelSetSpecializationConstants &&
+        tracingTable.Kernel.pfnSetSpecializationConstants ==
+            ur_validation_layer::urKernelSetSpecializationConstants) {
+        dditable->Kernel.pfnSetSpecializationConstants =
+            tracing::urKernelSetSpecializationConstants;
+    }
+    if (dditable->KernelExp.pfnSuggestMaxCooperativeGroupCountExp ==
+            ur_tracing_layer::urKernelSuggestMaxCooperativeGroupCountExp &&
+        tracingTable.KernelExp.pfnSuggestMaxCooperativeGroupCountExp ==
+            ur_validation_layer::urKernelSuggestMaxCooperativeGroupCountExp) {
+        dditable->KernelExp.pfnSuggestMaxCooperativeGroupCountExp =
+            tracing::urKernelSuggestMaxCooperativeGroupCountExp;
+    }
+    if (dditable->KernelExp.pfnSetArgsExp ==
+            ur_tracing_layer::urKernelSetArgsExp &&
+        tracingTable.KernelExp.pfnSetArgsExp ==
+            ur_validation_layer::urKernelSetArgsExp) {
+        dditable->KernelExp.pfnSetArgsExp = tracing::urKernelSetArgsExp;
+    }
+    if (dditable->Queue.pfnGetInfo == ur_tracing_layer::urQueueGetInfo &&
+        tracingTable.Queue.pfnGetInfo == ur_validation_layer::urQueueGetInfo) {
+        dditable->Queue.pfnGetInfo = tracing::urQueueGetInfo;
+    }
+    if (dditable->Queue.pfnCreate == ur_tracing_layer::urQueueCreate &&
+        tracingTable.Queue.pfnCreate == ur_validation_layer::urQueueCreate) {
+        dditable->Queue.pfnCreate = tracing::urQueueCreate;
+    }
+    if (dditable->Queue.pfnRetain == ur_tracing_layer::urQueueRetain &&
+        tracingTable.Queue.pfnRetain == ur_validation_layer::urQueueRetain) {
+        dditable->Queue.pfnRetain = tracing::urQueueRetain;
+    }
+    if (dditable->Queue.pfnRelease == ur_tracing_layer::urQueueRelease &&
+        tracingTable.Queue.pfnRelease == ur_validation_layer::urQueueRelease) {
+        dditable->Queue.pfnRelease = tracing::urQueueRelease;
+    }
+    if (dditable->Queue.pfnGetNativeHandle ==
+            ur_tracing_layer::urQueueGetNativeHandle &&
+        tracingTable.Queue.pfnGetNativeHandle ==
+            ur_validation_layer::urQueueGetNativeHandle) {
+        dditable->Queue.pfnGetNativeHandle = tracing::urQueueGetNativeHandle;
+    }
+    if (dditable->Queue.pfnCreateWithNativeHandle ==
+            ur_tracing_layer::urQueueCreateWithNativeHandle &&
+        tracingTable.Queue.pfnCreateWithNativeHandle ==
+            ur_validation_layer::urQueueCreateWithNativeHandle) {
+        dditable->Queue.pfnCreateWithNativeHandle =
+            tracing::urQueueCreateWithNativeHandle;
+    }
+    if (dditable->Queue.pfnFinish == ur_tracing_layer::urQueueFinish &&
+        tracingTable.Queue.pfnFinish == ur_validation_layer::urQueueFinish) {
+        dditable->Queue.pfnFinish = tracing::urQueueFinish;
+    }
+    if (dditable->Queue.pfnFlush == ur_tracing_layer::urQueueFlush &&
+        tracingTable.Queue.pfnFlush == ur_validation_layer::urQueueFlush) {
+        dditable->Queue.pfnFlush = tracing::urQueueFlush;
+    }
+    if (dditable->Sampler.pfnCreate == ur_tracing_layer::urSamplerCreate &&
+        tracingTable.Sampler.pfnCreate ==
+            ur_validation_layer::urSamplerCreate) {
+        dditable->Sampler.pfnCreate = tracing::urSamplerCreate;
+    }
+    if (dditable->Sampler.pfnRetain == ur_tracing_layer::urSamplerRetain &&
+        tracingTable.Sampler.pfnRetain ==
+            ur_validation_layer::urSamplerRetain) {
+        dditable->Sampler.pfnRetain = tracing::urSamplerRetain;
+    }
+    if (dditable->Sampler.pfnRelease == ur_tracing_layer::urSamplerRelease &&
+        tracingTable.Sampler.pfnRelease ==
+            ur_validation_layer::urSamplerRelease) {
+        dditable->Sampler.pfnRelease = tracing::urSamplerRelease;
+    }
+    if (dditable->Sampler.pfnGetInfo == ur_tracing_layer::urSamplerGetInfo &&
+        tracingTable.Sampler.pfnGetInfo ==
+            ur_validation_layer::urSamplerGetInfo) {
+        dditable->Sampler.pfnGetInfo = tracing::urSamplerGetInfo;
+    }
+    if (dditable->Sampler.pfnGetNativeHandle ==
+            ur_tracing_layer::urSamplerGetNativeHandle &&
+        tracingTable.Sampler.pfnGetNativeHandle ==
+            ur_validation_layer::urSamplerGetNativeHandle) {
+        dditable->Sampler.pfnGetNativeHandle =
+            tracing::urSamplerGetNativeHandle;
+    }
+    if (dditable->Sampler.pfnCreateWithNativeHandle ==
+            ur_tracing_layer::urSamplerCreateWithNativeHandle &&
+        tracingTable.Sampler.pfnCreateWithNativeHandle ==
+            ur_validation_layer::urSamplerCreateWithNativeHandle) {
+        dditable->Sampler.pfnCreateWithNativeHandle =
+            tracing::urSamplerCreateWithNativeHandle;
+    }
+    if (dditable->Mem.pfnImageCreate == ur_tracing_layer::urMemImageCreate &&
+        tracingTable.Mem.pfnImageCreate ==
+            ur_validation_layer::urMemImageCreate) {
+        dditable->Mem.pfnImageCreate = tracing::urMemImageCreate;
+    }
+    if (dditable->Mem.pfnBufferCreate == ur_tracing_layer::urMemBufferCreate &&
+        tracingTable.Mem.pfnBufferCreate ==
+            ur_validation_layer::urMemBufferCreate) {
+        dditable->Mem.pfnBufferCreate = tracing::urMemBufferCreate;
+    }
+    if (dditable->Mem.pfnRetain == ur_tracing_layer::urMemRetain &&
+        tracingTable.Mem.pfnRetain == ur_validation_layer::urMemRetain) {
+        dditable->Mem.pfnRetain = tracing::urMemRetain;
+    }
+    if (dditable->Mem.pfnRelease == ur_tracing_layer::urMemRelease &&
+        tracingTable.Mem.pfnRelease == ur_validation_layer::urMemRelease) {
+        dditable->Mem.pfnRelease = tracing::urMemRelease;
+    }
+    if (dditable->Mem.pfnBufferPartition ==
+            ur_tracing_layer::urMemBufferPartition &&
+        tracingTable.Mem.pfnBufferPartition ==
+            ur_validation_layer::urMemBufferPartition) {
+        dditable->Mem.pfnBufferPartition = tracing::urMemBufferPartition;
+    }
+    if (dditable->Mem.pfnGetNativeHandle ==
+            ur_tracing_layer::urMemGetNativeHandle &&
+        tracingTable.Mem.pfnGetNativeHandle ==
+            ur_validation_layer::urMemGetNativeHandle) {
+        dditable->Mem.pfnGetNativeHandle = tracing::urMemGetNativeHandle;
+    }
+    if (dditable->Mem.pfnBufferCreateWithNativeHandle ==
+            ur_tracing_layer::urMemBufferCreateWithNativeHandle &&
+        tracingTable.Mem.pfnBufferCreateWithNativeHandle ==
+            ur_validation_layer::urMemBufferCreateWithNativeHandle) {
+        dditable->Mem.pfnBufferCreateWithNativeHandle =
+            tracing::urMemBufferCreateWithNativeHandle;
+    }
+    if (dditable->Mem.pfnImageCreateWithNativeHandle ==
+            ur_tracing_layer::urMemImageCreateWithNativeHandle &&
+        tracingTable.Mem.pfnImageCreateWithNativeHandle ==
+            ur_validation_layer::urMemImageCreateWithNativeHandle) {
+        dditable->Mem.pfnImageCreateWithNativeHandle =
+            tracing::urMemImageCreateWithNativeHandle;
+    }
+    if (dditable->Mem.pfnGetInfo == ur_tracing_layer::urMemGetInfo &&
+        tracingTable.Mem.pfnGetInfo == ur_validation_layer::urMemGetInfo) {
+        dditable->Mem.pfnGetInfo = tracing::urMemGetInfo;
+    }
+    if (dditable->Mem.pfnImageGetInfo == ur_tracing_layer::urMemImageGetInfo &&
+        tracingTable.Mem.pfnImageGetInfo ==
+            ur_validation_layer::urMemImageGetInfo) {
+        dditable->Mem.pfnImageGetInfo = tracing::urMemImageGetInfo;
+    }
+    if (dditable->PhysicalMem.pfnCreate ==
+            ur_tracing_layer::urPhysicalMemCreate &&
+        tracingTable.PhysicalMem.pfnCreate ==
+            ur_validation_layer::urPhysicalMemCreate) {
+        dditable->PhysicalMem.pfnCreate = tracing::urPhysicalMemCreate;
+    }
+    if (dditable->PhysicalMem.pfnRetain ==
+            ur_tracing_layer::urPhysicalMemRetain &&
+        tracingTable.PhysicalMem.pfnRetain ==
+            ur_validation_layer::urPhysicalMemRetain) {
+        dditable->PhysicalMem.pfnRetain = tracing::urPhysicalMemRetain;
+    }
+    if (dditable->PhysicalMem.pfnRelease ==
+            ur_tracing_layer::urPhysicalMemRelease &&
+        tracingTable.PhysicalMem.pfnRelease ==
+            ur_validation_layer::urPhysicalMemRelease) {
+        dditable->PhysicalMem.pfnRelease = tracing::urPhysicalMemRelease;
+    }
+    if (dditable->Global.pfnAdapterGet == ur_tracing_layer::urAdapterGet &&
+        tracingTable.Global.pfnAdapterGet ==
+            ur_validation_layer::urAdapterGet) {
+        dditable->Global.pfnAdapterGet = tracing::urAdapterGet;
+    }
+    if (dditable->Global.pfnAdapterRelease ==
+            ur_tracing_layer::urAdapterRelease &&
+        tracingTable.Global.pfnAdapterRelease ==
+            ur_validation_layer::urAdapterRelease) {
+        dditable->Global.pfnAdapterRelease = tracing::urAdapterRelease;
+    }
+    if (dditable->Global.pfnAdapterRetain ==
+            ur_tracing_layer::urAdapterRetain &&
+        tracingTable.Global.pfnAdapterRetain ==
+            ur_validation_layer::urAdapterRetain) {
+        dditable->Global.pfnAdapterRetain = tracing::urAdapterRetain;
+    }
+    if (dditable->Global.pfnAdapterGetLastError ==
+            ur_tracing_layer::urAdapterGetLastError &&
+        tracingTable.Global.pfnAdapterGetLastError ==
+            ur_validation_layer::urAdapterGetLastError) {
+        dditable->Global.pfnAdapterGetLastError =
+            tracing::urAdapterGetLastError;
+    }
+    if (dditable->Global.pfnAdapterGetInfo ==
+            ur_tracing_layer::urAdapterGetInfo &&
+        tracingTable.Global.pfnAdapterGetInfo ==
+            ur_validation_layer::urAdapterGetInfo) {
+        dditable->Global.pfnAdapterGetInfo = tracing::urAdapterGetInfo;
+    }
+    if (dditable->Enqueue.pfnKernelLaunch ==
+            ur_tracing_layer::urEnqueueKernelLaunch &&
+        tracingTable.Enqueue.pfnKernelLaunch ==
+            ur_validation_layer::urEnqueueKernelLaunch) {
+        dditable->Enqueue.pfnKernelLaunch = tracing::urEnqueueKernelLaunch;
+    }
+    if (dditable->Enqueue.pfnEventsWait ==
+            ur_tracing_layer::urEnqueueEventsWait &&
+        tracingTable.Enqueue.pfnEventsWait ==
+            ur_validation_layer::urEnqueueEventsWait) {
+        dditable->Enqueue.pfnEventsWait = tracing::urEnqueueEventsWait;
+    }
+    if (dditable->Enqueue.pfnEventsWaitWithBarrier ==
+            ur_tracing_layer::urEnqueueEventsWaitWithBarrier &&
+        tracingTable.Enqueue.pfnEventsWaitWithBarrier ==
+            ur_validation_layer::urEnqueueEventsWaitWithBarrier) {
+        dditable->Enqueue.pfnEventsWaitWithBarrier =
+            tracing::urEnqueueEventsWaitWithBarrier;
+    }
+    if (dditable->Enqueue.pfnMemBufferRead ==
+            ur_tracing_layer::urEnqueueMemBufferRead &&
+        tracingTable.Enqueue.pfnMemBufferRead ==
+            ur_validation_layer::urEnqueueMemBufferRead) {
+        dditable->Enqueue.pfnMemBufferRead = tracing::urEnqueueMemBufferRead;
+    }
+    if (dditable->Enqueue.pfnMemBufferWrite ==
+            ur_tracing_layer::urEnqueueMemBufferWrite &&
+        tracingTable.Enqueue.pfnMemBufferWrite ==
+            ur_validation_layer::urEnqueueMemBufferWrite) {
+        dditable->Enqueue.pfnMemBufferWrite = tracing::urEnqueueMemBufferWrite;
+    }
+    if (dditable->Enqueue.pfnMemBufferReadRect ==
+            ur_tracing_layer::urEnqueueMemBufferReadRect &&
+        tracingTable.Enqueue.pfnMemBufferReadRect ==
+            ur_validation_layer::urEnqueueMemBufferReadRect) {
+        dditable->Enqueue.pfnMemBufferReadRect =
+            tracing::urEnqueueMemBufferReadRect;
+    }
+    if (dditable->Enqueue.pfnMemBufferWriteRect ==
+            ur_tracing_layer::urEnqueueMemBufferWriteRect &&
+        tracingTable.Enqueue.pfnMemBufferWriteRect ==
+            ur_validation_layer::urEnqueueMemBufferWriteRect) {
+        dditable->Enqueue.pfnMemBufferWriteRect =
+            tracing::urEnqueueMemBufferWriteRect;
+    }
+    if (dditable->Enqueue.pfnMemBufferCopy ==
+            ur_tracing_layer::urEnqueueMemBufferCopy &&
+        tracingTable.Enqueue.pfnMemBufferCopy ==
+            ur_validation_layer::urEnqueueMemBufferCopy) {
+        dditable->Enqueue.pfnMemBufferCopy = tracing::urEnqueueMemBufferCopy;
+    }
+    if (dditable->Enqueue.pfnMemBufferCopyRect ==
+            ur_tracing_layer::urEnqueueMemBufferCopyRect &&
+        tracingTable.Enqueue.pfnMemBufferCopyRect ==
+            ur_validation_layer::urEnqueueMemBufferCopyRect) {
+        dditable->Enqueue.pfnMemBufferCopyRect =
+            tracing::urEnqueueMemBufferCopyRect;
+    }
+    if (dditable->Enqueue.pfnMemBufferFill ==
+            ur_tracing_layer::urEnqueueMemBufferFill &&
+        tracingTable.Enqueue.pfnMemBufferFill ==
+            ur_validation_layer::urEnqueueMemBufferFill) {
+        dditable->Enqueue.pfnMemBufferFill = tracing::urEnqueueMemBufferFill;
+    }
+    if (dditable->Enqueue.pfnMemImageRead ==
+            ur_tracing_layer::urEnqueueMemImageRead &&
+        tracingTable.Enqueue.pfnMemImageRead ==
+            ur_validation_layer::urEnqueueMemImageRead) {
+        dditable->Enqueue.pfnMemImageRead = tracing::urEnqueueMemImageRead;
+    }
+    if (dditable->Enqueue.pfnMemImageWrite ==
+            ur_tracing_layer::urEnqueueMemImageWrite &&
+        tracingTable.Enqueue.pfnMemImageWrite ==
+            ur_validation_layer::urEnqueueMemImageWrite) {
+        dditable->Enqueue.pfnMemImageWrite = tracing::urEnqueueMemImageWrite;
+    }
+    if (dditable->Enqueue.pfnMemImageCopy ==
+            ur_tracing_layer::urEnqueueMemImageCopy &&
+        tracingTable.Enqueue.pfnMemImageCopy ==
+            ur_validation_layer::urEnqueueMemImageCopy) {
+        dditable->Enqueue.pfnMemImageCopy = tracing::urEnqueueMemImageCopy;
+    }
+    if (dditable->Enqueue.pfnMemBufferMap ==
+            ur_tracing_layer::urEnqueueMemBufferMap &&
+        tracingTable.Enqueue.pfnMemBufferMap ==
+            ur_validation_layer::urEnqueueMemBufferMap) {
+        dditable->Enqueue.pfnMemBufferMap = tracing::urEnqueueMemBufferMap;
+    }
+    if (dditable->Enqueue.pfnMemUnmap == ur_tracing_layer::urEnqueueMemUnmap &&
+        tracingTable.Enqueue.pfnMemUnmap ==
+            ur_validation_layer::urEnqueueMemUnmap) {
+        dditable->Enqueue.pfnMemUnmap = tracing::urEnqueueMemUnmap;
+    }
+    if (dditable->Enqueue.pfnUSMFill == ur_tracing_layer::urEnqueueUSMFill &&
+        tracingTable.Enqueue.pfnUSMFill ==
+            ur_validation_layer::urEnqueueUSMFill) {
+        dditable->Enqueue.pfnUSMFill = tracing::urEnqueueUSMFill;
+    }
+    if (dditable->Enqueue.pfnUSMMemcpy ==
+            ur_tracing_layer::urEnqueueUSMMemcpy &&
+        tracingTable.Enqueue.pfnUSMMemcpy ==
+            ur_validation_layer::urEnqueueUSMMemcpy) {
+        dditable->Enqueue.pfnUSMMemcpy = tracing::urEnqueueUSMMemcpy;
+    }
+    if (dditable->Enqueue.pfnUSMPrefetch ==
+            ur_tracing_layer::urEnqueueUSMPrefetch &&
+        tracingTable.Enqueue.pfnUSMPrefetch ==
+            ur_validation_layer::urEnqueueUSMPrefetch) {
+        dditable->Enqueue.pfnUSMPrefetch = tracing::urEnqueueUSMPrefetch;
+    }
+    if (dditable->Enqueue.pfnUSMAdvise ==
+            ur_tracing_layer::urEnqueueUSMAdvise &&
+        tracingTable.Enqueue.pfnUSMAdvise ==
+            ur_validation_layer::urEnqueueUSMAdvise) {
+        dditable->Enqueue.pfnUSMAdvise = tracing::urEnqueueUSMAdvise;
+    }
+    if (dditable->Enqueue.pfnUSMFill2D ==
+            ur_tracing_layer::urEnqueueUSMFill2D &&
+        tracingTable.Enqueue.pfnUSMFill2D ==
+            ur_validation_layer::urEnqueueUSMFill2D) {
+        dditable->Enqueue.pfnUSMFill2D = tracing::urEnqueueUSMFill2D;
+    }
+    if (dditable->Enqueue.pfnUSMMemcpy2D ==
+            ur_tracing_layer::urEnqueueUSMMemcpy2D &&
+        tracingTable.Enqueue.pfnUSMMemcpy2D ==
+            ur_validation_layer::urEnqueueUSMMemcpy2D) {
+        dditable->Enqueue.pfnUSMMemcpy2D = tracing::urEnqueueUSMMemcpy2D;
+    }
+    if (dditable->Enqueue.pfnDeviceGlobalVariableWrite ==
+            ur_tracing_layer::urEnqueueDeviceGlobalVariableWrite &&
+        tracingTable.Enqueue.pfnDeviceGlobalVariableWrite ==
+            ur_validation_layer::urEnqueueDeviceGlobalVariableWrite) {
+        dditable->Enqueue.pfnDeviceGlobalVariableWrite =
+            tracing::urEnqueueDeviceGlobalVariableWrite;
+    }
+    if (dditable->Enqueue.pfnDeviceGlobalVariableRead ==
+            ur_tracing_layer::urEnqueueDeviceGlobalVariableRead &&
+        tracingTable.Enqueue.pfnDeviceGlobalVariableRead ==
+            ur_validation_layer::urEnqueueDeviceGlobalVariableRead) {
+        dditable->Enqueue.pfnDeviceGlobalVariableRead =
+            tracing::urEnqueueDeviceGlobalVariableRead;
+    }
+    if (dditable->Enqueue.pfnReadHostPipe ==
+            ur_tracing_layer::urEnqueueReadHostPipe &&
+        tracingTable.Enqueue.pfnReadHostPipe ==
+            ur_validation_layer::urEnqueueReadHostPipe) {
+        dditable->Enqueue.pfnReadHostPipe = tracing::urEnqueueReadHostPipe;
+    }
+    if (dditable->Enqueue.pfnWriteHostPipe ==
+            ur_tracing_layer::urEnqueueWriteHostPipe &&
+        tracingTable.Enqueue.pfnWriteHostPipe ==
+            ur_validation_layer::urEnqueueWriteHostPipe) {
+        dditable->Enqueue.pfnWriteHostPipe = tracing::urEnqueueWriteHostPipe;
+    }
+    if (dditable->EnqueueExp.pfnKernelLaunchCustomExp ==
+            ur_tracing_layer::urEnqueueKernelLaunchCustomExp &&
+        tracingTable.EnqueueExp.pfnKernelLaunchCustomExp ==
+            ur_validation_layer::urEnqueueKernelLaunchCustomExp) {
+        dditable->EnqueueExp.pfnKernelLaunchCustomExp =
+            tracing::urEnqueueKernelLaunchCustomExp;
+    }
+    if (dditable->EnqueueExp.pfnCooperativeKernelLaunchExp ==
+            ur_tracing_layer::urEnqueueCooperativeKernelLaunchExp &&
+        tracingTable.EnqueueExp.pfnCooperativeKernelLaunchExp ==
+            ur_validation_layer::urEnqueueCooperativeKernelLaunchExp) {
+        dditable->EnqueueExp.pfnCooperativeKernelLaunchExp =
+            tracing::urEnqueueCooperativeKernelLaunchExp;
+    }
+    if (dditable->EnqueueExp.pfnMemBufferCopyRectBatchExp ==
+            ur_tracing_layer::urEnqueueMemBufferCopyRectBatchExp &&
+        tracingTable.EnqueueExp.pfnMemBufferCopyRectBatchExp ==
+            ur_validation_layer::urEnqueueMemBufferCopyRectBatchExp) {
+        dditable->EnqueueExp.pfnMemBufferCopyRectBatchExp =
+            tracing::urEnqueueMemBufferCopyRectBatchExp;
+    }
+    if (dditable->EnqueueExp.pfnKernelLaunchBatchExp ==
+            ur_tracing_layer::urEnqueueKernelLaunchBatchExp &&
+        tracingTable.EnqueueExp.pfnKernelLaunchBatchExp ==
+            ur_validation_layer::urEnqueueKernelLaunchBatchExp) {
+        dditable->EnqueueExp.pfnKernelLaunchBatchExp =
+            tracing::urEnqueueKernelLaunchBatchExp;
+    }
+    if (dditable->EnqueueExp.pfnTimestampRecordingExp ==
+            ur_tracing_layer::urEnqueueTimestampRecordingExp &&
+        tracingTable.EnqueueExp.pfnTimestampRecordingExp ==
+            ur_validation_layer::urEnqueueTimestampRecordingExp) {
+        dditable->EnqueueExp.pfnTimestampRecordingExp =
+            tracing::urEnqueueTimestampRecordingExp;
+    }
+    if (dditable->EnqueueExp.pfnUSMDeviceAllocExp ==
+            ur_tracing_layer::urEnqueueUSMDeviceAllocExp &&
+        tracingTable.EnqueueExp.pfnUSMDeviceAllocExp ==
+            ur_validation_layer::urEnqueueUSMDeviceAllocExp) {
+        dditable->EnqueueExp.pfnUSMDeviceAllocExp =
+            tracing::urEnqueueUSMDeviceAllocExp;
+    }
+    if (dditable->EnqueueExp.pfnUSMFreeExp ==
+            ur_tracing_layer::urEnqueueUSMFreeExp &&
+        tracingTable.EnqueueExp.pfnUSMFreeExp ==
+            ur_validation_layer::urEnqueueUSMFreeExp) {
+        dditable->EnqueueExp.pfnUSMFreeExp = tracing::urEnqueueUSMFreeExp;
+    }
+    if (dditable->EnqueueExp.pfnNativeCommandExp ==
+            ur_tracing_layer::urEnqueueNativeCommandExp &&
+        tracingTable.EnqueueExp.pfnNativeCommandExp ==
+            ur_validation_layer::urEnqueueNativeCommandExp) {
+        dditable->EnqueueExp.pfnNativeCommandExp =
+            tracing::urEnqueueNativeCommandExp;
+    }
+    if (dditable->BindlessImagesExp.pfnUnsampledImageHandleDestroyExp ==
+            ur_tracing_layer::urBindlessImagesUnsampledImageHandleDestroyExp &&
+        tracingTable.BindlessImagesExp.pfnUnsampledImageHandleDestroyExp ==
+            ur_validation_layer::urBindlessImagesUnsampledImageHandleDestroyExp) {
+        dditable->BindlessImagesExp.pfnUnsampledImageHandleDestroyExp =
+            tracing::urBindlessImagesUnsampledImageHandleDestroyExp;
+    }
+    if (dditable->BindlessImagesExp.pfnSampledImageHandleDestroyExp ==
+            ur_tracing_layer::urBindlessImagesSampledImageHandleDestroyExp &&
+        tracingTable.BindlessImagesExp.pfnSampledImageHandleDestroyExp ==
+            ur_validation_layer::urBindlessImagesSampledImageHandleDestroyExp) {
+        dditable->BindlessImagesExp.pfnSampledImageHandleDestroyExp =
+            tracing::urBindlessImagesSampledImageHandleDestroyExp;
+    }
+    if (dditable->BindlessImagesExp.pfnImageAllocateExp ==
+            ur_tracing_layer::urBindlessImagesImageAllocateExp &&
+        tracingTable.BindlessImagesExp.pfnImageAllocateExp ==
+            ur_validation_layer::urBindlessImagesImageAllocateExp) {
+        dditable->BindlessImagesExp.pfnImageAllocateExp =
+            tracing::urBindlessImagesImageAllocateExp;
+    }
+    if (dditable->BindlessImagesExp.pfnImageFreeExp ==
+            ur_tracing_layer::urBindlessImagesImageFreeExp &&
+        tracingTable.BindlessImagesExp.pfnImageFreeExp ==
+            ur_validation_layer::urBindlessImagesImageFreeExp) {
+        dditable->BindlessImagesExp.pfnImageFreeExp =
+            tracing::urBindlessImagesImageFreeExp;
+    }
+    if (dditable->BindlessImagesExp.pfnUnsampledImageCreateExp ==
+            ur_tracing_layer::urBindlessImagesUnsampledImageCreateExp &&
+        tracingTable.BindlessImagesExp.pfnUnsampledImageCreateExp ==
+            ur_validation_layer::urBindlessImagesUnsampledImageCreateExp) {
+        dditable->BindlessImagesExp.pfnUnsampledImageCreateExp =
+            tracing::urBindlessImagesUnsampledImageCreateExp;
+    }
+    if (dditable->BindlessImagesExp.pfnSampledImageCreateExp ==
+            ur_tracing_layer::urBindlessImagesSampledImageCreateExp &&
+        tracingTable.BindlessImagesExp.pfnSampledImageCreateExp ==
+            ur_validation_layer::urBindlessImagesSampledImageCreateExp) {
+        dditable->BindlessImagesExp.pfnSampledImageCreateExp =
+            tracing::urBindlessImagesSampledImageCreateExp;
+    }
+    if (dditable->BindlessImagesExp.pfnImageCopyExp ==
+            ur_tracing_layer::urBindlessImagesImageCopyExp &&
+        tracingTable.BindlessImagesExp.pfnImageCopyExp ==
+            ur_validation_layer::urBindlessImagesImageCopyExp) {
+        dditable->BindlessImagesExp.pfnImageCopyExp =
+            tracing::urBindlessImagesImageCopyExp;
+    }
+    if (dditable->BindlessImagesExp.pfnImageGetInfoExp ==
+            ur_tracing_layer::urBindlessImagesImageGetInfoExp &&
+        tracingTable.BindlessImagesExp.pfnImageGetInfoExp ==
+            ur_validation_layer::urBindlessImagesImageGetInfoExp) {
+        dditable->BindlessImagesExp.pfnImageGetInfoExp =
+            tracing::urBindlessImagesImageGetInfoExp;
+    }
+    if (dditable->BindlessImagesExp.pfnMipmapGetLevelExp ==
+            ur_tracing_layer::urBindlessImagesMipmapGetLevelExp &&
+        tracingTable.BindlessImagesExp.pfnMipmapGetLevelExp ==
+            ur_validation_layer::urBindlessImagesMipmapGetLevelExp) {
+        dditable->BindlessImagesExp.pfnMipmapGetLevelExp =
+            tracing::urBindlessImagesMipmapGetLevelExp;
+    }
+    if (dditable->BindlessImagesExp.pfnMipmapFreeExp ==
+            ur_tracing_layer::urBindlessImagesMipmapFreeExp &&
+        tracingTable.BindlessImagesExp.pfnMipmapFreeExp ==
+            ur_validation_layer::urBindlessImagesMipmapFreeExp) {
+        dditable->BindlessImagesExp.pfnMipmapFreeExp =
+            tracing::urBindlessImagesMipmapFreeExp;
+    }
+    if (dditable->BindlessImagesExp.pfnImportExternalMemoryExp ==
+            ur_tracing_layer::urBindlessImagesImportExternalMemoryExp &&
+        tracingTable.BindlessImagesExp.pfnImportExternalMemoryExp ==
+            ur_validation_layer::urBindlessImagesImportExternalMemoryExp) {
+        dditable->BindlessImagesExp.pfnImportExternalMemoryExp =
+            tracing::urBindlessImagesImportExternalMemoryExp;
+    }
+    if (dditable->BindlessImagesExp.pfnMapExternalArrayExp ==
+            ur_tracing_layer::urBindlessImagesMapExternalArrayExp &&
+        tracingTable.BindlessImagesExp.pfnMapExternalArrayExp ==
+            ur_validation_layer::urBindlessImagesMapExternalArrayExp) {
+        dditable->BindlessImagesExp.pfnMapExternalArrayExp =
+            tracing::urBindlessImagesMapExternalArrayExp;
+    }
+    if (dditable->BindlessImagesExp.pfnMapExternalLinearMemoryExp ==
+            ur_tracing_layer::urBindlessImagesMapExternalLinearMemoryExp &&
+        tracingTable.BindlessImagesExp.pfnMapExternalLinearMemoryExp ==
+            ur_validation_layer::urBindlessImagesMapExternalLinearMemoryExp) {
+        dditable->BindlessImagesExp.pfnMapExternalLinearMemoryExp =
+            tracing::urBindlessImagesMapExternalLinearMemoryExp;
+    }
+    if (dditable->BindlessImagesExp.pfnReleaseExternalMemoryExp ==
+            ur_tracing_layer::urBindlessImagesReleaseExternalMemoryExp &&
+        tracingTable.BindlessImagesExp.pfnReleaseExternalMemoryExp ==
+            ur_validation_layer::urBindlessImagesReleaseExternalMemoryExp) {
+        dditable->BindlessImagesExp.pfnReleaseExternalMemoryExp =
+            tracing::urBindlessImagesReleaseExternalMemoryExp;
+    }
+    if (dditable->BindlessImagesExp.pfnImportExternalSemaphoreExp ==
+            ur_tracing_layer::urBindlessImagesImportExternalSemaphoreExp &&
+        tracingTable.BindlessImagesExp.pfnImportExternalSemaphoreExp ==
+            ur_validation_layer::urBindlessImagesImportExternalSemaphoreExp) {
+        dditable->BindlessImagesExp.pfnImportExternalSemaphoreExp =
+            tracing::urBindlessImagesImportExternalSemaphoreExp;
+    }
+    if (dditable->BindlessImagesExp.pfnReleaseExternalSemaphoreExp ==
+            ur_tracing_layer::urBindlessImagesReleaseExternalSemaphoreExp &&
+        tracingTable.BindlessImagesExp.pfnReleaseExternalSemaphoreExp ==
+            ur_validation_layer::urBindlessImagesReleaseExternalSemaphoreExp) {
+        dditable->BindlessImagesExp.pfnReleaseExternalSemaphoreExp =
+            tracing::urBindlessImagesReleaseExternalSemaphoreExp;
+    }
+    if (dditable->BindlessImagesExp.pfnWaitExternalSemaphoreExp ==
+            ur_tracing_layer::urBindlessImagesWaitExternalSemaphoreExp &&
+        tracingTable.BindlessImagesExp.pfnWaitExternalSemaphoreExp ==
+            ur_validation_layer::urBindlessImagesWaitExternalSemaphoreExp) {
+        dditable->BindlessImagesExp.pfnWaitExternalSemaphoreExp =
+            tracing::urBindlessImagesWaitExternalSemaphoreExp;
+    }
+    if (dditable->BindlessImagesExp.pfnSignalExternalSemaphoreExp ==
+            ur_tracing_layer::urBindlessImagesSignalExternalSemaphoreExp &&
+        tracingTable.BindlessImagesExp.pfnSignalExternalSemaphoreExp ==
+            ur_validation_layer::urBindlessImagesSignalExternalSemaphoreExp) {
+        dditable->BindlessImagesExp.pfnSignalExternalSemaphoreExp =
+            tracing::urBindlessImagesSignalExternalSemaphoreExp;
+    }
+    if (dditable->USM.pfnHostAlloc == ur_tracing_layer::urUSMHostAlloc &&
+        tracingTable.USM.pfnHostAlloc == ur_validation_layer::urUSMHostAlloc) {
+        dditable->USM.pfnHostAlloc = tracing::urUSMHostAlloc;
+    }
+    if (dditable->USM.pfnDeviceAlloc == ur_tracing_layer::urUSMDeviceAlloc &&
+        tracingTable.USM.pfnDeviceAlloc ==
+            ur_validation_layer::urUSMDeviceAlloc) {
+        dditable->USM.pfnDeviceAlloc = tracing::urUSMDeviceAlloc;
+    }
+    if (dditable->USM.pfnSharedAlloc == ur_tracing_layer::urUSMSharedAlloc &&
+        tracingTable.USM.pfnSharedAlloc ==
+            ur_validation_layer::urUSMSharedAlloc) {
+        dditable->USM.pfnSharedAlloc = tracing::urUSMSharedAlloc;
+    }
+    if (dditable->USM.pfnFree == ur_tracing_layer::urUSMFree &&
+        tracingTable.USM.pfnFree == ur_validation_layer::urUSMFree) {
+        dditable->USM.pfnFree = tracing::urUSMFree;
+    }
+    if (dditable->USM.pfnGetMemAllocInfo ==
+            ur_tracing_layer::urUSMGetMemAllocInfo &&
+        tracingTable.USM.pfnGetMemAllocInfo ==
+            ur_validation_layer::urUSMGetMemAllocInfo) {
+        dditable->USM.pfnGetMemAllocInfo = tracing::urUSMGetMemAllocInfo;
+    }
+    if (dditable->USM.pfnPoolCreate == ur_tracing_layer::urUSMPoolCreate &&
+        tracingTable.USM.pfnPoolCreate ==
+            ur_validation_layer::urUSMPoolCreate) {
+        dditable->USM.pfnPoolCreate = tracing::urUSMPoolCreate;
+    }
+    if (dditable->USM.pfnPoolRetain == ur_tracing_layer::urUSMPoolRetain &&
+        tracingTable.USM.pfnPoolRetain ==
+            ur_validation_layer::urUSMPoolRetain) {
+        dditable->USM.pfnPoolRetain = tracing::urUSMPoolRetain;
+    }
+    if (dditable->USM.pfnPoolRelease == ur_tracing_layer::urUSMPoolRelease &&
+        tracingTable.USM.pfnPoolRelease ==
+            ur_validation_layer::urUSMPoolRelease) {
+        dditable->USM.pfnPoolRelease = tracing::urUSMPoolRelease;
+    }
+    if (dditable->USM.pfnPoolGetInfo == ur_tracing_layer::urUSMPoolGetInfo &&
+        tracingTable.USM.pfnPoolGetInfo ==
+            ur_validation_layer::urUSMPoolGetInfo) {
+        dditable->USM.pfnPoolGetInfo = tracing::urUSMPoolGetInfo;
+    }
+    if (dditable->USMExp.pfnPitchedAllocExp ==
+            ur_tracing_layer::urUSMPitchedAllocExp &&
+        tracingTable.USMExp.pfnPitchedAllocExp ==
+            ur_validation_layer::urUSMPitchedAllocExp) {
+        dditable->USMExp.pfnPitchedAllocExp = tracing::urUSMPitchedAllocExp;
+    }
+    if (dditable->USMExp.pfnImportExp == ur_tracing_layer::urUSMImportExp &&
+        tracingTable.USMExp.pfnImportExp ==
+            ur_validation_layer::urUSMImportExp) {
+        dditable->USMExp.pfnImportExp = tracing::urUSMImportExp;
+    }
+    if (dditable->USMExp.pfnReleaseExp == ur_tracing_layer::urUSMReleaseExp &&
+        tracingTable.USMExp.pfnReleaseExp ==
+            ur_validation_layer::urUSMReleaseExp) {
+        dditable->USMExp.pfnReleaseExp = tracing::urUSMReleaseExp;
+    }
+    if (dditable->USMExp.pfnPoolTrimExp == ur_tracing_layer::urUSMPoolTrimExp &&
+        tracingTable.USMExp.pfnPoolTrimExp ==
+            ur_validation_layer::urUSMPoolTrimExp) {
+        dditable->USMExp.pfnPoolTrimExp = tracing::urUSMPoolTrimExp;
+    }
+    if (dditable->CommandBufferExp.pfnCreateExp ==
+            ur_tracing_layer::urCommandBufferCreateExp &&
+        tracingTable.CommandBufferExp.pfnCreateExp ==
+            ur_validation_layer::urCommandBufferCreateExp) {
+        dditable->CommandBufferExp.pfnCreateExp =
+            tracing::urCommandBufferCreateExp;
+    }
+    if (dditable->CommandBufferExp.pfnRetainExp ==
+            ur_tracing_layer::urCommandBufferRetainExp &&
+        tracingTable.CommandBufferExp.pfnRetainExp ==
+            ur_validation_layer::urCommandBufferRetainExp) {
+        dditable->CommandBufferExp.pfnRetainExp =
+            tracing::urCommandBufferRetainExp;
+    }
+    if (dditable->CommandBufferExp.pfnReleaseExp ==
+            ur_tracing_layer::urCommandBufferReleaseExp &&
+        tracingTable.CommandBufferExp.pfnReleaseExp ==
+            ur_validation_layer::urCommandBufferReleaseExp) {
+        dditable->CommandBufferExp.pfnReleaseExp =
+            tracing::urCommandBufferReleaseExp;
+    }
+    if (dditable->CommandBufferExp.pfnFinalizeExp ==
+            ur_tracing_layer::urCommandBufferFinalizeExp &&
+        tracingTable.CommandBufferExp.pfnFinalizeExp ==
+            ur_validation_layer::urCommandBufferFinalizeExp) {
+        dditable->CommandBufferExp.pfnFinalizeExp =
+            tracing::urCommandBufferFinalizeExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendKernelLaunchExp ==
+            ur_tracing_layer::urCommandBufferAppendKernelLaunchExp &&
+        tracingTable.CommandBufferExp.pfnAppendKernelLaunchExp ==
+            ur_validation_layer::urCommandBufferAppendKernelLaunchExp) {
+        dditable->CommandBufferExp.pfnAppendKernelLaunchExp =
+            tracing::urCommandBufferAppendKernelLaunchExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendUSMMemcpyExp ==
+            ur_tracing_layer::urCommandBufferAppendUSMMemcpyExp &&
+        tracingTable.CommandBufferExp.pfnAppendUSMMemcpyExp ==
+            ur_validation_layer::urCommandBufferAppendUSMMemcpyExp) {
+        dditable->CommandBufferExp.pfnAppendUSMMemcpyExp =
+            tracing::urCommandBufferAppendUSMMemcpyExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendUSMFillExp ==
+            ur_tracing_layer::urCommandBufferAppendUSMFillExp &&
+        tracingTable.CommandBufferExp.pfnAppendUSMFillExp ==
+            ur_validation_layer::urCommandBufferAppendUSMFillExp) {
+        dditable->CommandBufferExp.pfnAppendUSMFillExp =
+            tracing::urCommandBufferAppendUSMFillExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendMemBufferCopyExp ==
+            ur_tracing_layer::urCommandBufferAppendMemBufferCopyExp &&
+        tracingTable.CommandBufferExp.pfnAppendMemBufferCopyExp ==
+            ur_validation_layer::urCommandBufferAppendMemBufferCopyExp) {
+        dditable->CommandBufferExp.pfnAppendMemBufferCopyExp =
+            tracing::urCommandBufferAppendMemBufferCopyExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendMemBufferWriteExp ==
+            ur_tracing_layer::urCommandBufferAppendMemBufferWriteExp &&
+        tracingTable.CommandBufferExp.pfnAppendMemBufferWriteExp ==
+            ur_validation_layer::urCommandBufferAppendMemBufferWriteExp) {
+        dditable->CommandBufferExp.pfnAppendMemBufferWriteExp =
+            tracing::urCommandBufferAppendMemBufferWriteExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendMemBufferReadExp ==
+            ur_tracing_layer::urCommandBufferAppendMemBufferReadExp &&
+        tracingTable.CommandBufferExp.pfnAppendMemBufferReadExp ==
+            ur_validation_layer::urCommandBufferAppendMemBufferReadExp) {
+        dditable->CommandBufferExp.pfnAppendMemBufferReadExp =
+            tracing::urCommandBufferAppendMemBufferReadExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendMemBufferCopyRectExp ==
+            ur_tracing_layer::urCommandBufferAppendMemBufferCopyRectExp &&
+        tracingTable.CommandBufferExp.pfnAppendMemBufferCopyRectExp ==
+            ur_validation_layer::urCommandBufferAppendMemBufferCopyRectExp) {
+        dditable->CommandBufferExp.pfnAppendMemBufferCopyRectExp =
+            tracing::urCommandBufferAppendMemBufferCopyRectExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendMemBufferWriteRectExp ==
+            ur_tracing_layer::urCommandBufferAppendMemBufferWriteRectExp &&
+        tracingTable.CommandBufferExp.pfnAppendMemBufferWriteRectExp ==
+            ur_validation_layer::urCommandBufferAppendMemBufferWriteRectExp) {
+        dditable->CommandBufferExp.pfnAppendMemBufferWriteRectExp =
+            tracing::urCommandBufferAppendMemBufferWriteRectExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendMemBufferReadRectExp ==
+            ur_tracing_layer::urCommandBufferAppendMemBufferReadRectExp &&
+        tracingTable.CommandBufferExp.pfnAppendMemBufferReadRectExp ==
+            ur_validation_layer::urCommandBufferAppendMemBufferReadRectExp) {
+        dditable->CommandBufferExp.pfnAppendMemBufferReadRectExp =
+            tracing::urCommandBufferAppendMemBufferReadRectExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendMemBufferFillExp ==
+            ur_tracing_layer::urCommandBufferAppendMemBufferFillExp &&
+        tracingTable.CommandBufferExp.pfnAppendMemBufferFillExp ==
+            ur_validation_layer::urCommandBufferAppendMemBufferFillExp) {
+        dditable->CommandBufferExp.pfnAppendMemBufferFillExp =
+            tracing::urCommandBufferAppendMemBufferFillExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendUSMPrefetchExp ==
+            ur_tracing_layer::urCommandBufferAppendUSMPrefetchExp &&
+        tracingTable.CommandBufferExp.pfnAppendUSMPrefetchExp ==
+            ur_validation_layer::urCommandBufferAppendUSMPrefetchExp) {
+        dditable->CommandBufferExp.pfnAppendUSMPrefetchExp =
+            tracing::urCommandBufferAppendUSMPrefetchExp;
+    }
+    if (dditable->CommandBufferExp.pfnAppendUSMAdviseExp ==
+            ur_tracing_layer::urCommandBufferAppendUSMAdviseExp &&
+        tracingTable.CommandBufferExp.pfnAppendUSMAdviseExp ==
+            ur_validation_layer::urCommandBufferAppendUSMAdviseExp) {
+        dditable->CommandBufferExp.pfnAppendUSMAdviseExp =
+            tracing::urCommandBufferAppendUSMAdviseExp;
+    }
+    if (dditable->CommandBufferExp.pfnEnqueueExp ==
+            ur_tracing_layer::urCommandBufferEnqueueExp &&
+        tracingTable.CommandBufferExp.pfnEnqueueExp ==
+            ur_validation_layer::urCommandBufferEnqueueExp) {
+        dditable->CommandBufferExp.pfnEnqueueExp =
+            tracing::urCommandBufferEnqueueExp;
+    }
+    if (dditable->CommandBufferExp.pfnRetainCommandExp ==
+            ur_tracing_layer::urCommandBufferRetainCommandExp &&
+        tracingTable.CommandBufferExp.pfnRetainCommandExp ==
+            ur_validation_layer::urCommandBufferRetainCommandExp) {
+        dditable->CommandBufferExp.pfnRetainCommandExp =
+            tracing::urCommandBufferRetainCommandExp;
+    }
+    if (dditable->CommandBufferExp.pfnReleaseCommandExp ==
+            ur_tracing_layer::urCommandBufferReleaseCommandExp &&
+        tracingTable.CommandBufferExp.pfnReleaseCommandExp ==
+            ur_validation_layer::urCommandBufferReleaseCommandExp) {
+        dditable->CommandBufferExp.pfnReleaseCommandExp =
+            tracing::urCommandBufferReleaseCommandExp;
+    }
+    if (dditable->CommandBufferExp.pfnUpdateKernelLaunchExp ==
+            ur_tracing_layer::urCommandBufferUpdateKernelLaunchExp &&
+        tracingTable.CommandBufferExp.pfnUpdateKernelLaunchExp ==
+            ur_validation_layer::urCommandBufferUpdateKernelLaunchExp) {
+        dditable->CommandBufferExp.pfnUpdateKernelLaunchExp =
+            tracing::urCommandBufferUpdateKernelLaunchExp;
+    }
+    if (dditable->CommandBufferExp.pfnGetInfoExp ==
+            ur_tracing_layer::urCommandBufferGetInfoExp &&
+        tracingTable.CommandBufferExp.pfnGetInfoExp ==
+            ur_validation_layer::urCommandBufferGetInfoExp) {
+        dditable->CommandBufferExp.pfnGetInfoExp =
+            tracing::urCommandBufferGetInfoExp;
+    }
+    if (dditable->CommandBufferExp.pfnCommandGetInfoExp ==
+            ur_tracing_layer::urCommandBufferCommandGetInfoExp &&
+        tracingTable.CommandBufferExp.pfnCommandGetInfoExp ==
+            ur_validation_layer::urCommandBufferCommandGetInfoExp) {
+        dditable->CommandBufferExp.pfnCommandGetInfoExp =
+            tracing::urCommandBufferCommandGetInfoExp;
+    }
+    if (dditable->UsmP2PExp.pfnEnablePeerAccessExp ==
+            ur_tracing_layer::urUsmP2PEnablePeerAccessExp &&
+        tracingTable.UsmP2PExp.pfnEnablePeerAccessExp ==
+            ur_validation_layer::urUsmP2PEnablePeerAccessExp) {
+        dditable->UsmP2PExp.pfnEnablePeerAccessExp =
+            tracing::urUsmP2PEnablePeerAccessExp;
+    }
+    if (dditable->UsmP2PExp.pfnDisablePeerAccessExp ==
+            ur_tracing_layer::urUsmP2PDisablePeerAccessExp &&
+        tracingTable.UsmP2PExp.pfnDisablePeerAccessExp ==
+            ur_validation_layer::urUsmP2PDisablePeerAccessExp) {
+        dditable->UsmP2PExp.pfnDisablePeerAccessExp =
+            tracing::urUsmP2PDisablePeerAccessExp;
+    }
+    if (dditable->UsmP2PExp.pfnPeerAccessGetInfoExp ==
+            ur_tracing_layer::urUsmP2PPeerAccessGetInfoExp &&
+        tracingTable.UsmP2PExp.pfnPeerAccessGetInfoExp ==
+            ur_validation_layer::urUsmP2PPeerAccessGetInfoExp) {
+        dditable->UsmP2PExp.pfnPeerAccessGetInfoExp =
+            tracing::urUsmP2PPeerAccessGetInfoExp;
+    }
+    if (dditable->VirtualMem.pfnGranularityGetInfo ==
+            ur_tracing_layer::urVirtualMemGranularityGetInfo &&
+        tracingTable.VirtualMem.pfnGranularityGetInfo ==
+            ur_validation_layer::urVirtualMemGranularityGetInfo) {
+        dditable->VirtualMem.pfnGranularityGetInfo =
+            tracing::urVirtualMemGranularityGetInfo;
+    }
+    if (dditable->VirtualMem.pfnReserve ==
+            ur_tracing_layer::urVirtualMemReserve &&
+        tracingTable.VirtualMem.pfnReserve ==
+            ur_validation_layer::urVirtualMemReserve) {
+        dditable->VirtualMem.pfnReserve = tracing::urVirtualMemReserve;
+    }
+    if (dditable->VirtualMem.pfnFree == ur_tracing_layer::urVirtualMemFree &&
+        tracingTable.VirtualMem.pfnFree ==
+            ur_validation_layer::urVirtualMemFree) {
+        dditable->VirtualMem.pfnFree = tracing::urVirtualMemFree;
+    }
+    if (dditable->VirtualMem.pfnMap == ur_tracing_layer::urVirtualMemMap &&
+        tracingTable.VirtualMem.pfnMap ==
+            ur_validation_layer::urVirtualMemMap) {
+        dditable->VirtualMem.pfnMap = tracing::urVirtualMemMap;
+    }
+    if (dditable->VirtualMem.pfnUnmap == ur_tracing_layer::urVirtualMemUnmap &&
+        tracingTable.VirtualMem.pfnUnmap ==
+            ur_validation_layer::urVirtualMemUnmap) {
+        dditable->VirtualMem.pfnUnmap = tracing::urVirtualMemUnmap;
+    }
+    if (dditable->VirtualMem.pfnSetAccess ==
+            ur_tracing_layer::urVirtualMemSetAccess &&
+        tracingTable.VirtualMem.pfnSetAccess ==
+            ur_validation_layer::urVirtualMemSetAccess) {
+        dditable->VirtualMem.pfnSetAccess = tracing::urVirtualMemSetAccess;
+    }
+    if (dditable->VirtualMem.pfnGetInfo ==
+            ur_tracing_layer::urVirtualMemGetInfo &&
+        tracingTable.VirtualMem.pfnGetInfo ==
+            ur_validation_layer::urVirtualMemGetInfo) {
+        dditable->VirtualMem.pfnGetInfo = tracing::urVirtualMemGetInfo;
+    }
+    if (dditable->Device.pfnGet == ur_tracing_layer::urDeviceGet &&
+        tracingTable.Device.pfnGet == ur_validation_layer::urDeviceGet) {
+        dditable->Device.pfnGet = tracing::urDeviceGet;
+    }
+    if (dditable->Device.pfnGetInfo == ur_tracing_layer::urDeviceGetInfo &&
+        tracingTable.Device.pfnGetInfo ==
+            ur_validation_layer::urDeviceGetInfo) {
+        dditable->Device.pfnGetInfo = tracing::urDeviceGetInfo;
+    }
+    if (dditable->Device.pfnRetain == ur_tracing_layer::urDeviceRetain &&
+        tracingTable.Device.pfnRetain == ur_validation_layer::urDeviceRetain) {
+        dditable->Device.pfnRetain = tracing::urDeviceRetain;
+    }
+    if (dditable->Device.pfnRelease == ur_tracing_layer::urDeviceRelease &&
+        tracingTable.Device.pfnRelease ==
+            ur_validation_layer::urDeviceRelease) {
+        dditable->Device.pfnRelease = tracing::urDeviceRelease;
+    }
+    if (dditable->Device.pfnPartition == ur_tracing_layer::urDevicePartition &&
+        tracingTable.Device.pfnPartition ==
+            ur_validation_layer::urDevicePartition) {
+        dditable->Device.pfnPartition = tracing::urDevicePartition;
+    }
+    if (dditable->Device.pfnSelectBinary ==
+            ur_tracing_layer::urDeviceSelectBinary &&
+        tracingTable.Device.pfnSelectBinary ==
+            ur_validation_layer::urDeviceSelectBinary) {
+        dditable->Device.pfnSelectBinary = tracing::urDeviceSelectBinary;
+    }
+    if (dditable->Device.pfnGetNativeHandle ==
+            ur_tracing_layer::urDeviceGetNativeHandle &&
+        tracingTable.Device.pfnGetNativeHandle ==
+            ur_validation_layer::urDeviceGetNativeHandle) {
+        dditable->Device.pfnGetNativeHandle = tracing::urDeviceGetNativeHandle;
+    }
+    if (dditable->Device.pfnCreateWithNativeHandle ==
+            ur_tracing_layer::urDeviceCreateWithNativeHandle &&
+        tracingTable.Device.pfnCreateWithNativeHandle ==
+            ur_validation_layer::urDeviceCreateWithNativeHandle) {
+        dditable->Device.pfnCreateWithNativeHandle =
+            tracing::urDeviceCreateWithNativeHandle;
+    }
+    if (dditable->Device.pfnGetGlobalTimestamps ==
+            ur_tracing_layer::urDeviceGetGlobalTimestamps &&
+        tracingTable.Device.pfnGetGlobalTimestamps ==
+            ur_validation_layer::urDeviceGetGlobalTimestamps) {
+        dditable->Device.pfnGetGlobalTimestamps =
+            tracing::urDeviceGetGlobalTimestamps;
+    }
+}
+} // namespace ur_fused_layer
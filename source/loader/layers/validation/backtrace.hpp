@@ -7,12 +7,64 @@
 
 #include "ur_validation_layer.hpp"
 
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
 #define MAX_BACKTRACE_FRAMES 64
 
 namespace ur_validation_layer {
 
 using BacktraceLine = std::string;
-std::vector<BacktraceLine> getCurrentBacktrace();
+// The program counters of the frames of a backtrace, innermost first
+using BacktraceFrames = std::vector<uintptr_t>;
+
+// Only unwinds the stack, the frames are symbolized when they are reported
+BacktraceFrames captureBacktrace();
+
+// Symbolizes the frames of each of the backtraces, sharing the work which is
+// common to all of them
+std::vector<std::vector<BacktraceLine>>
+symbolizeBacktraces(const std::vector<const BacktraceFrames *> &backtraces);
+
+// Interns captured backtraces, so that the handles recorded from the same call
+// site share a single copy of its frames. The backtraces are kept until the
+// table is destroyed, there are as many as there are distinct call sites.
+class BacktraceTable {
+  public:
+    using Backtrace = std::shared_ptr<const BacktraceFrames>;
+
+    Backtrace intern(BacktraceFrames frames) {
+        if (frames.empty()) {
+            return nullptr;
+        }
+        auto backtrace = std::make_shared<const BacktraceFrames>(
+            std::move(frames));
+
+        std::scoped_lock<std::mutex> lock(mutex);
+        return *backtraces.insert(std::move(backtrace)).first;
+    }
+
+  private:
+    struct Hash {
+        size_t operator()(const Backtrace &backtrace) const {
+            size_t seed = backtrace->size();
+            for (auto pc : *backtrace) {
+                seed ^= std::hash<uintptr_t>{}(pc) + 0x9e3779b9 + (seed << 6) +
+                        (seed >> 2);
+            }
+            return seed;
+        }
+    };
+    struct Equal {
+        bool operator()(const Backtrace &lhs, const Backtrace &rhs) const {
+            return *lhs == *rhs;
+        }
+    };
+
+    std::mutex mutex;
+    std::unordered_set<Backtrace, Hash, Equal> backtraces;
+};
 
 } // namespace ur_validation_layer
 
@@ -72,21 +72,60 @@ int backtrace_cb(void *data, uintptr_t pc, const char *filename, int lineno,
     return 0;
 }
 
-std::vector<BacktraceLine> getCurrentBacktrace() {
-    backtrace_state *state = backtrace_create_state(NULL, 0, NULL, NULL);
-    if (state == NULL) {
-        return std::vector<std::string>(1, "Failed to acquire a backtrace");
+namespace {
+
+backtrace_state *getBacktraceState() {
+    // libbacktrace can't free a state, and creating one reads the debug
+    // information again, so a single one is shared by all the threads
+    static backtrace_state *state = backtrace_create_state(NULL, 1, NULL, NULL);
+    return state;
+}
+
+int backtrace_simple_cb(void *data, uintptr_t pc) {
+    BacktraceFrames *frames = reinterpret_cast<BacktraceFrames *>(data);
+    try {
+        frames->push_back(pc);
+    } catch (std::bad_alloc &) {
+        return 1;
     }
 
-    std::vector<BacktraceLine> backtrace;
-    backtrace_full(state, 0, backtrace_cb, NULL, &backtrace);
-    if (backtrace.empty()) {
-        return std::vector<std::string>(1, "Failed to acquire a backtrace");
+    return frames->size() >= MAX_BACKTRACE_FRAMES;
+}
+
+} // namespace
+
+BacktraceFrames captureBacktrace() {
+    backtrace_state *state = getBacktraceState();
+    if (state == NULL) {
+        return BacktraceFrames();
     }
 
-    filter_after_occurence(backtrace, "ur_libapi.cpp");
+    BacktraceFrames frames;
+    backtrace_simple(state, 0, backtrace_simple_cb, NULL, &frames);
+
+    return frames;
+}
+
+std::vector<std::vector<BacktraceLine>>
+symbolizeBacktraces(const std::vector<const BacktraceFrames *> &backtraces) {
+    backtrace_state *state = getBacktraceState();
+
+    std::vector<std::vector<BacktraceLine>> symbolized;
+    for (auto frames : backtraces) {
+        std::vector<BacktraceLine> backtrace;
+        for (size_t i = 0; state != NULL && i < frames->size(); i++) {
+            backtrace_pcinfo(state, (*frames)[i], backtrace_cb, NULL,
+                             &backtrace);
+        }
+        if (backtrace.empty()) {
+            backtrace.push_back("Failed to acquire a backtrace");
+        } else {
+            filter_after_occurence(backtrace, "ur_libapi.cpp");
+        }
+        symbolized.push_back(std::move(backtrace));
+    }
 
-    return backtrace;
+    return symbolized;
 }
 
 } // namespace ur_validation_layer
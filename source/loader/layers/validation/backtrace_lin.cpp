@@ -14,10 +14,31 @@
 
 namespace ur_validation_layer {
 
-std::vector<BacktraceLine> getCurrentBacktrace() {
+BacktraceFrames captureBacktrace() {
     void *backtraceFrames[MAX_BACKTRACE_FRAMES];
     int frameCount = backtrace(backtraceFrames, MAX_BACKTRACE_FRAMES);
-    char **backtraceStr = backtrace_symbols(backtraceFrames, frameCount);
+
+    BacktraceFrames frames;
+    try {
+        for (int i = 0; i < frameCount; i++) {
+            frames.push_back(reinterpret_cast<uintptr_t>(backtraceFrames[i]));
+        }
+    } catch (std::bad_alloc &) {
+        return BacktraceFrames();
+    }
+
+    return frames;
+}
+
+namespace {
+
+std::vector<BacktraceLine> symbolizeBacktrace(const BacktraceFrames &frames) {
+    std::vector<void *> backtraceFrames;
+    for (auto pc : frames) {
+        backtraceFrames.push_back(reinterpret_cast<void *>(pc));
+    }
+    char **backtraceStr = backtrace_symbols(
+        backtraceFrames.data(), static_cast<int>(backtraceFrames.size()));
 
     if (backtraceStr == nullptr) {
         return std::vector<BacktraceLine>(1, "Failed to acquire a backtrace");
@@ -25,7 +46,7 @@ std::vector<BacktraceLine> getCurrentBacktrace() {
 
     std::vector<BacktraceLine> backtrace;
     try {
-        for (int i = 0; i < frameCount; i++) {
+        for (size_t i = 0; i < backtraceFrames.size(); i++) {
             backtrace.emplace_back(backtraceStr[i]);
         }
     } catch (std::bad_alloc &) {
@@ -38,4 +59,15 @@ std::vector<BacktraceLine> getCurrentBacktrace() {
     return backtrace;
 }
 
+} // namespace
+
+std::vector<std::vector<BacktraceLine>>
+symbolizeBacktraces(const std::vector<const BacktraceFrames *> &backtraces) {
+    std::vector<std::vector<BacktraceLine>> symbolized;
+    for (auto frames : backtraces) {
+        symbolized.push_back(symbolizeBacktrace(*frames));
+    }
+    return symbolized;
+}
+
 } // namespace ur_validation_layer
@@ -16,42 +16,57 @@
 
 namespace ur_validation_layer {
 
-std::vector<BacktraceLine> getCurrentBacktrace() {
-    HANDLE process = GetCurrentProcess();
-    SymInitialize(process, nullptr, true);
-
+BacktraceFrames captureBacktrace() {
     PVOID frames[MAX_BACKTRACE_FRAMES];
     WORD frameCount =
         CaptureStackBackTrace(0, MAX_BACKTRACE_FRAMES, frames, NULL);
 
-    if (frameCount == 0) {
-        SymCleanup(process);
-        return std::vector<BacktraceLine>(1, "Failed to acquire a backtrace");
+    BacktraceFrames backtrace;
+    try {
+        for (int i = 0; i < frameCount; i++) {
+            backtrace.push_back(reinterpret_cast<uintptr_t>(frames[i]));
+        }
+    } catch (std::bad_alloc &) {
+        return BacktraceFrames();
     }
 
+    return backtrace;
+}
+
+std::vector<std::vector<BacktraceLine>>
+symbolizeBacktraces(const std::vector<const BacktraceFrames *> &backtraces) {
+    // Loading the symbols is the slow part, so it is only done once for all
+    // the backtraces
+    HANDLE process = GetCurrentProcess();
+    SymInitialize(process, nullptr, true);
+
     DWORD displacement = 0;
     IMAGEHLP_LINE64 line;
     line.SizeOfStruct = sizeof(IMAGEHLP_LINE64);
 
-    std::vector<BacktraceLine> backtrace;
-    try {
-        for (int i = 0; i < frameCount; i++) {
-            if (SymGetLineFromAddr64(process, (DWORD64)frames[i], &displacement,
-                                     &line)) {
-                backtrace.push_back(std::string(line.FileName) + ":" +
-                                    std::to_string(line.LineNumber));
-            } else {
-                backtrace.push_back("????????");
+    std::vector<std::vector<BacktraceLine>> symbolized;
+    for (auto frames : backtraces) {
+        std::vector<BacktraceLine> backtrace;
+        try {
+            for (auto pc : *frames) {
+                if (SymGetLineFromAddr64(process, (DWORD64)pc, &displacement,
+                                         &line)) {
+                    backtrace.push_back(std::string(line.FileName) + ":" +
+                                        std::to_string(line.LineNumber));
+                } else {
+                    backtrace.push_back("????????");
+                }
             }
+        } catch (std::bad_alloc &) {
+            backtrace = std::vector<BacktraceLine>(
+                1, "Failed to acquire a backtrace");
         }
-    } catch (std::bad_alloc &) {
-        SymCleanup(process);
-        return std::vector<BacktraceLine>(1, "Failed to acquire a backtrace");
+        symbolized.push_back(std::move(backtrace));
     }
 
     SymCleanup(process);
 
-    return backtrace;
+    return symbolized;
 }
 
 } // namespace ur_validation_layer
@@ -0,0 +1,169 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#ifndef UR_HANDLE_REGISTRY_H
+#define UR_HANDLE_REGISTRY_H 1
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <typeinfo>
+
+namespace ur_validation_layer {
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Lock-free table of the handles known to the validation layer.
+///
+/// Every handle owns a slot for as long as the table exists. A slot holds the
+/// handle's type and a state word made of a generation counter, bumped each
+/// time the handle is released, and a live bit. Lookups never take a lock,
+/// so checking whether a handle is alive costs a hash and a few atomic loads.
+///
+/// Slots are never freed: addresses of released objects are usually reused
+/// for new objects of the same kind, which then take over the slot. Once
+/// the table is full new handles are simply not tracked, and callers fall
+/// back to their slower bookkeeping for them.
+class HandleRegistry {
+  public:
+    enum class State {
+        UNKNOWN,  ///< not tracked by the registry
+        LIVE,     ///< registered with the queried type
+        RELEASED, ///< released, or registered with a different type
+    };
+
+    explicit HandleRegistry(size_t capacity = defaultCapacity)
+        : mask(roundUpPow2(capacity) - 1), slots(new Slot[mask + 1]) {}
+
+    /// Marks handle as live. Returns false if the table is full. Must not race
+    /// with release() of the same handle, which the API forbids anyway.
+    bool registerHandle(void *handle, const std::type_info &type) {
+        Slot *slot = handle ? findSlot(handle, true) : nullptr;
+        if (!slot) {
+            return false;
+        }
+        slot->type.store(&type, std::memory_order_relaxed);
+        uint64_t state = slot->state.load(std::memory_order_relaxed);
+        slot->state.store(state | liveBit, std::memory_order_release);
+        return true;
+    }
+
+    /// Marks handle as released and starts a new generation for its slot.
+    void release(void *handle) {
+        Slot *slot = handle ? findSlot(handle, false) : nullptr;
+        if (slot) {
+            uint64_t state = slot->state.load(std::memory_order_relaxed);
+            slot->state.store((state & ~liveBit) + generationStep,
+                              std::memory_order_release);
+        }
+    }
+
+    /// Releases every tracked handle.
+    void releaseAll() {
+        for (size_t i = 0; i <= mask; ++i) {
+            uint64_t state = slots[i].state.load(std::memory_order_relaxed);
+            if (state & liveBit) {
+                slots[i].state.store((state & ~liveBit) + generationStep,
+                                     std::memory_order_release);
+            }
+        }
+    }
+
+    State lookup(void *handle, const std::type_info &type) const {
+        const Slot *slot = handle ? findSlot(handle) : nullptr;
+        if (!slot) {
+            return State::UNKNOWN;
+        }
+        if (!(slot->state.load(std::memory_order_acquire) & liveBit)) {
+            return State::RELEASED;
+        }
+        const std::type_info *registered =
+            slot->type.load(std::memory_order_relaxed);
+        return *registered == type ? State::LIVE : State::RELEASED;
+    }
+
+    /// Whether handle was tracked and has been released since.
+    bool isReleased(void *handle) const {
+        const Slot *slot = handle ? findSlot(handle) : nullptr;
+        return slot && !(slot->state.load(std::memory_order_acquire) & liveBit);
+    }
+
+    /// Number of times handle has been released, 0 if it is not tracked.
+    uint64_t getGeneration(void *handle) const {
+        const Slot *slot = handle ? findSlot(handle) : nullptr;
+        return slot ? slot->state.load(std::memory_order_relaxed) /
+                          generationStep
+                    : 0;
+    }
+
+  private:
+    static constexpr size_t defaultCapacity = 1 << 16;
+    static constexpr size_t maxProbes = 32;
+    static constexpr uint64_t liveBit = 1;
+    static constexpr uint64_t generationStep = 2;
+
+    struct Slot {
+        std::atomic<uintptr_t> key = 0;
+        std::atomic<uint64_t> state = 0;
+        std::atomic<const std::type_info *> type = nullptr;
+    };
+
+    static size_t roundUpPow2(size_t value) {
+        size_t pow2 = 1;
+        while (pow2 < value) {
+            pow2 <<= 1;
+        }
+        return pow2;
+    }
+
+    size_t hash(uintptr_t key) const {
+        uint64_t bits = static_cast<uint64_t>(key >> 4);
+        bits *= 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(bits >> 32) & mask;
+    }
+
+    const Slot *findSlot(void *handle) const {
+        uintptr_t key = reinterpret_cast<uintptr_t>(handle);
+        size_t index = hash(key);
+        for (size_t probe = 0; probe < maxProbes; ++probe) {
+            const Slot &slot = slots[(index + probe) & mask];
+            uintptr_t slotKey = slot.key.load(std::memory_order_acquire);
+            if (slotKey == key) {
+                return &slot;
+            }
+            if (slotKey == 0) {
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    Slot *findSlot(void *handle, bool insert) {
+        uintptr_t key = reinterpret_cast<uintptr_t>(handle);
+        size_t index = hash(key);
+        for (size_t probe = 0; probe < maxProbes; ++probe) {
+            Slot &slot = slots[(index + probe) & mask];
+            uintptr_t slotKey = slot.key.load(std::memory_order_acquire);
+            if (slotKey == 0 && insert &&
+                slot.key.compare_exchange_strong(slotKey, key,
+                                                 std::memory_order_acq_rel)) {
+                return &slot;
+            }
+            if (slotKey == key) {
+                return &slot;
+            }
+            if (slotKey == 0) {
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    const size_t mask;
+    std::unique_ptr<Slot[]> slots;
+};
+
+} // namespace ur_validation_layer
+
+#endif /* UR_HANDLE_REGISTRY_H */
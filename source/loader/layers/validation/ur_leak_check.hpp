@@ -6,8 +6,11 @@
 #define UR_LEAK_CHECK_H 1
 
 #include "backtrace.hpp"
+#include "ur_handle_registry.hpp"
 #include "ur_validation_layer.hpp"
 
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <typeindex>
 #include <unordered_map>
@@ -22,11 +25,12 @@ struct RefCountContext {
     struct RefRuntimeInfo {
         int64_t refCount;
         std::type_index type;
-        std::vector<BacktraceLine> backtrace;
+        BacktraceTable::Backtrace backtrace;
 
         RefRuntimeInfo(int64_t refCount, std::type_index type,
-                       std::vector<BacktraceLine> backtrace)
-            : refCount(refCount), type(type), backtrace(backtrace) {}
+                       BacktraceTable::Backtrace backtrace)
+            : refCount(refCount), type(type), backtrace(std::move(backtrace)) {
+        }
     };
 
     enum RefCountUpdateType {
@@ -36,24 +40,82 @@ struct RefCountContext {
         REFCOUNT_DECREASE,
     };
 
-    std::mutex mutex;
-    std::unordered_map<void *, struct RefRuntimeInfo> counts;
-    int64_t adapterCount = 0;
+    // Handles are spread over independently locked shards so that threads
+    // working on different objects don't serialize on a single mutex.
+    static constexpr size_t numShards = 64;
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_map<void *, struct RefRuntimeInfo> counts;
+    };
+
+    std::array<Shard, numShards> shards;
+    std::atomic<int64_t> adapterCount = 0;
+
+    // A backtrace is captured for one in every backtraceEvery handles that
+    // are recorded for the first time, 0 disables capturing.
+    std::atomic<size_t> backtraceEvery = 1;
+    std::atomic<size_t> recordedHandles = 0;
+    BacktraceTable backtraces;
+
+    // Lets lifetime validation check handles without taking a shard lock.
+    // registryComplete is cleared once the registry runs out of slots, from
+    // then on handles it doesn't know about may still be in the shards.
+    std::unique_ptr<HandleRegistry> registry;
+    std::atomic<bool> registryComplete = true;
+
+    Shard &getShard(void *ptr) {
+        // Handles are usually heap allocations, drop the alignment bits and
+        // mix the rest so that neighbouring objects land in different shards.
+        uint64_t bits = reinterpret_cast<uintptr_t>(ptr) >> 4;
+        bits *= 0x9E3779B97F4A7C15ull;
+        return shards[(bits >> 32) % numShards];
+    }
+
+    bool shouldCaptureBacktrace() {
+        size_t every = backtraceEvery.load(std::memory_order_relaxed);
+        if (every == 0) {
+            return false;
+        }
+        return recordedHandles.fetch_add(1, std::memory_order_relaxed) %
+                   every ==
+               0;
+    }
+
+    void registerHandle(void *ptr, const std::type_info &type) {
+        if (registry && !registry->registerHandle(ptr, type)) {
+            registryComplete = false;
+        }
+    }
 
     template <typename T>
     void updateRefCount(T handle, enum RefCountUpdateType type,
                         bool isAdapterHandle = false) {
-        std::unique_lock<std::mutex> ulock(mutex);
-
         void *ptr = static_cast<void *>(handle);
+        Shard &shard = getShard(ptr);
+
+        std::unique_lock<std::mutex> ulock(shard.mutex);
+        auto &counts = shard.counts;
         auto it = counts.find(ptr);
 
+        BacktraceTable::Backtrace backtrace;
+        if (it == counts.end() && type != REFCOUNT_INCREASE &&
+            shouldCaptureBacktrace()) {
+            // Don't block the other handles of this shard while unwinding,
+            // the backtrace is only symbolized if the handle is reported.
+            ulock.unlock();
+            backtrace = backtraces.intern(captureBacktrace());
+            ulock.lock();
+            it = counts.find(ptr);
+        }
+
         switch (type) {
         case REFCOUNT_CREATE_OR_INCREASE:
             if (it == counts.end()) {
                 std::tie(it, std::ignore) = counts.emplace(
                     ptr, RefRuntimeInfo{1, std::type_index(typeid(handle)),
-                                        getCurrentBacktrace()});
+                                        std::move(backtrace)});
+                registerHandle(ptr, typeid(handle));
                 if (isAdapterHandle) {
                     adapterCount++;
                 }
@@ -65,7 +127,8 @@ struct RefCountContext {
             if (it == counts.end()) {
                 std::tie(it, std::ignore) = counts.emplace(
                     ptr, RefRuntimeInfo{1, std::type_index(typeid(handle)),
-                                        getCurrentBacktrace()});
+                                        std::move(backtrace)});
+                registerHandle(ptr, typeid(handle));
             } else {
                 getContext()->logger.error("Handle {} already exists", ptr);
                 return;
@@ -84,7 +147,7 @@ struct RefCountContext {
             if (it == counts.end()) {
                 std::tie(it, std::ignore) = counts.emplace(
                     ptr, RefRuntimeInfo{-1, std::type_index(typeid(handle)),
-                                        getCurrentBacktrace()});
+                                        std::move(backtrace)});
             } else {
                 it->second.refCount--;
             }
@@ -104,12 +167,15 @@ struct RefCountContext {
 
         if (it->second.refCount == 0) {
             counts.erase(ptr);
+            if (registry) {
+                registry->release(ptr);
+            }
         }
+        ulock.unlock();
 
         // No more active adapters, so any references still held are leaked
         if (adapterCount == 0) {
-            logInvalidReferences();
-            counts.clear();
+            logInvalidReferences(true);
         }
     }
 
@@ -134,31 +200,99 @@ struct RefCountContext {
     }
 
     template <typename T> bool isReferenceValid(T handle) {
-        std::unique_lock<std::mutex> lock(mutex);
-        auto it = counts.find(static_cast<void *>(handle));
-        if (it == counts.end() || it->second.refCount < 1) {
+        void *ptr = static_cast<void *>(handle);
+        if (registry) {
+            switch (registry->lookup(ptr, typeid(handle))) {
+            case HandleRegistry::State::LIVE:
+                return true;
+            case HandleRegistry::State::RELEASED:
+                return false;
+            case HandleRegistry::State::UNKNOWN:
+                if (registryComplete.load(std::memory_order_relaxed)) {
+                    return false;
+                }
+                break;
+            }
+        }
+
+        Shard &shard = getShard(ptr);
+
+        std::unique_lock<std::mutex> lock(shard.mutex);
+        auto it = shard.counts.find(ptr);
+        if (it == shard.counts.end() || it->second.refCount < 1) {
             return false;
         }
 
         return (it->second.type == std::type_index(typeid(handle)));
     }
 
-    void logInvalidReferences() {
-        for (auto &[ptr, refRuntimeInfo] : counts) {
-            getContext()->logger.error("Retained {} reference(s) to handle {}",
-                                       refRuntimeInfo.refCount, ptr);
-            getContext()->logger.error(
-                "Handle {} was recorded for first time here:", ptr);
-            for (size_t i = 0; i < refRuntimeInfo.backtrace.size(); i++) {
-                getContext()->logger.error("#{} {}", i,
-                                           refRuntimeInfo.backtrace[i].c_str());
+    /// Track handles in a HandleRegistry for lock-free lifetime checks. Must
+    /// be called before any handle is recorded.
+    void enableHandleRegistry() {
+        if (!registry) {
+            registry = std::make_unique<HandleRegistry>();
+        }
+    }
+
+    /// Capture a backtrace for one in every `every` recorded handles, 0
+    /// disables backtraces altogether.
+    void setBacktraceSampling(size_t every) { backtraceEvery = every; }
+
+    void logInvalidReferences(bool clear = false) {
+        for (auto &shard : shards) {
+            std::unique_lock<std::mutex> lock(shard.mutex);
+
+            // The handles recorded from the same call site share a backtrace,
+            // symbolize each of them once for all their handles
+            std::unordered_map<const BacktraceFrames *, size_t> indices;
+            std::vector<const BacktraceFrames *> frames;
+            for (auto &[ptr, refRuntimeInfo] : shard.counts) {
+                auto *backtrace = refRuntimeInfo.backtrace.get();
+                if (backtrace && indices.emplace(backtrace, frames.size())
+                                     .second) {
+                    frames.push_back(backtrace);
+                }
             }
+            std::vector<std::vector<BacktraceLine>> symbolized;
+            if (!frames.empty()) {
+                symbolized = symbolizeBacktraces(frames);
+            }
+
+            for (auto &[ptr, refRuntimeInfo] : shard.counts) {
+                getContext()->logger.error(
+                    "Retained {} reference(s) to handle {}",
+                    refRuntimeInfo.refCount, ptr);
+                if (!refRuntimeInfo.backtrace) {
+                    getContext()->logger.error(
+                        "Handle {} was recorded without a backtrace", ptr);
+                    continue;
+                }
+                getContext()->logger.error(
+                    "Handle {} was recorded for first time here:", ptr);
+                auto &backtrace =
+                    symbolized[indices[refRuntimeInfo.backtrace.get()]];
+                for (size_t i = 0; i < backtrace.size(); i++) {
+                    getContext()->logger.error("#{} {}", i,
+                                               backtrace[i].c_str());
+                }
+            }
+            if (clear) {
+                shard.counts.clear();
+            }
+        }
+        if (clear && registry) {
+            registry->releaseAll();
         }
     }
 
     void logInvalidReference(void *ptr) {
         getContext()->logger.error("There are no valid references to handle {}",
                                    ptr);
+        if (registry && registry->isReleased(ptr)) {
+            getContext()->logger.error(
+                "Handle {} was used after being released (generation {})", ptr,
+                registry->getGeneration(ptr));
+        }
     }
 };
 
@@ -65,7 +65,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -91,7 +91,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -124,7 +124,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -169,7 +169,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -181,7 +181,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_ADAPTER_INFO_REFERENCE_COUNT < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -226,11 +228,13 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == phAdapters) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NumEntries == 0 && phPlatforms != NULL) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -263,7 +267,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -275,7 +279,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_PLATFORM_INFO_BACKEND < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -303,7 +309,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -332,7 +338,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -366,7 +372,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -404,7 +410,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -447,7 +453,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hPlatform) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -455,7 +461,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
         if (NumEntries > 0 && phDevices == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_DEVICE_TYPE_VPU < DeviceType) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -501,7 +509,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -513,7 +521,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -546,7 +556,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -573,7 +583,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -609,7 +619,7 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -654,7 +664,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -666,7 +676,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
         if (NULL == pSelectedBinary) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NumBinaries == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -697,7 +709,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -736,7 +748,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -779,7 +791,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -813,7 +825,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == phDevices) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
@@ -821,7 +833,9 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
         if (NULL == phContext) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NULL != pProperties && UR_CONTEXT_FLAGS_MASK & pProperties->flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -849,7 +863,7 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -876,7 +890,7 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -914,7 +928,7 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -926,7 +940,9 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_CONTEXT_INFO_ATOMIC_FENCE_SCOPE_CAPABILITIES < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -961,7 +977,7 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1004,7 +1020,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hAdapter) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1046,7 +1062,7 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1083,7 +1099,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1099,7 +1115,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
         if (NULL == phMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_MEM_FLAGS_MASK & flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -1169,7 +1187,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1177,7 +1195,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
         if (NULL == phBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_MEM_FLAGS_MASK & flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -1232,7 +1252,7 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1259,7 +1279,7 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1292,7 +1312,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1304,7 +1324,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         if (NULL == phMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_MEM_FLAGS_MASK & flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -1345,7 +1367,7 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1388,7 +1410,7 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1434,7 +1456,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1490,7 +1512,7 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hMemory) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1502,7 +1524,9 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_MEM_INFO_CONTEXT < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -1545,7 +1569,7 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hMemory) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1557,7 +1581,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_IMAGE_INFO_DEPTH < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -1592,7 +1618,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1604,7 +1630,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
         if (NULL == phSampler) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_SAMPLER_ADDRESSING_MODE_MIRRORED_REPEAT <
             pDesc->addressingMode) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -1641,7 +1669,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hSampler) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1668,7 +1696,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hSampler) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1702,7 +1730,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hSampler) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1714,7 +1742,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_SAMPLER_INFO_FILTER_MODE < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -1749,7 +1779,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hSampler) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1787,7 +1817,7 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1830,7 +1860,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1838,7 +1868,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         if (NULL == ppMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NULL != pUSMDesc && UR_USM_ADVICE_FLAGS_MASK & pUSMDesc->hints) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -1887,7 +1919,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1899,7 +1931,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         if (NULL == ppMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NULL != pUSMDesc && UR_USM_ADVICE_FLAGS_MASK & pUSMDesc->hints) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -1954,7 +1988,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -1966,7 +2000,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         if (NULL == ppMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NULL != pUSMDesc && UR_USM_ADVICE_FLAGS_MASK & pUSMDesc->hints) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -2014,7 +2050,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2055,7 +2091,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2063,7 +2099,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         if (NULL == pMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_USM_ALLOC_INFO_POOL < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -2095,7 +2133,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2107,7 +2145,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
         if (NULL == ppPool) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_USM_POOL_FLAGS_MASK & pPoolDesc->flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -2138,7 +2178,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == pPool) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2164,7 +2204,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == pPool) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2197,7 +2237,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hPool) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2209,8 +2249,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
-        if (UR_USM_POOL_INFO_CONTEXT < propName) {
+    if (getContext()->enableParameterValidation) {
+        if (UR_USM_POOL_INFO_FRAGMENTATION < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
 
@@ -2256,7 +2298,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2268,7 +2310,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_VIRTUAL_MEM_GRANULARITY_INFO_RECOMMENDED < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -2314,7 +2358,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2348,7 +2392,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2388,7 +2432,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2400,7 +2444,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
         if (NULL == pStart) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_VIRTUAL_MEM_ACCESS_FLAGS_MASK & flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -2436,7 +2482,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2472,7 +2518,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2480,7 +2526,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
         if (NULL == pStart) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_VIRTUAL_MEM_ACCESS_FLAGS_MASK & flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -2520,7 +2568,7 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2528,7 +2576,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         if (NULL == pStart) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_VIRTUAL_MEM_INFO_ACCESS_MODE < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -2564,7 +2614,7 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2576,7 +2626,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
         if (NULL == phPhysicalMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NULL != pProperties &&
             UR_PHYSICAL_MEM_FLAGS_MASK & pProperties->flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -2615,7 +2667,7 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hPhysicalMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2642,7 +2694,7 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hPhysicalMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2674,7 +2726,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2691,7 +2743,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
             NULL == pProperties->pMetadatas) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NULL != pProperties && NULL != pProperties->pMetadatas &&
             pProperties->count == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
@@ -2737,7 +2791,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2758,7 +2812,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
             NULL == pProperties->pMetadatas) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NULL != pProperties && NULL != pProperties->pMetadatas &&
             pProperties->count == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
@@ -2799,7 +2855,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2839,7 +2895,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2885,7 +2941,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2897,7 +2953,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         if (NULL == phProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (count == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -2926,7 +2984,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2953,7 +3011,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -2989,7 +3047,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3045,7 +3103,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3102,7 +3160,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3114,7 +3172,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_PROGRAM_INFO_KERNEL_NAMES < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -3159,7 +3219,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3167,7 +3227,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_PROGRAM_BUILD_INFO_BINARY_TYPE < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -3205,7 +3267,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3213,7 +3275,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         if (NULL == pSpecConstants) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (count == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -3244,7 +3308,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3282,7 +3346,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3321,7 +3385,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3367,7 +3431,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3404,7 +3468,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3444,7 +3508,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3456,7 +3520,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_KERNEL_INFO_NUM_REGS < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -3498,7 +3564,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3506,7 +3572,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_KERNEL_GROUP_INFO_COMPILE_MAX_LINEAR_WORK_GROUP_SIZE <
             propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -3551,7 +3619,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3559,7 +3627,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_KERNEL_SUB_GROUP_INFO_SUB_GROUP_SIZE_INTEL < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -3592,7 +3662,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3619,7 +3689,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3651,7 +3721,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3686,7 +3756,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3694,7 +3764,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         if (NULL == pPropValue) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_KERNEL_EXEC_INFO_CACHE_CONFIG < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -3726,7 +3798,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3767,11 +3839,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NULL != pProperties &&
             UR_MEM_FLAGS_MASK & pProperties->memoryAccess) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -3809,7 +3883,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3817,7 +3891,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         if (NULL == pSpecConstants) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (count == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -3848,7 +3924,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3888,7 +3964,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -3944,7 +4020,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4002,7 +4078,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4014,8 +4090,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
-        if (UR_QUEUE_INFO_EMPTY < propName) {
+    if (getContext()->enableParameterValidation) {
+        if (UR_QUEUE_INFO_CREATED_EVENT_COUNT < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
 
@@ -4051,7 +4129,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4063,7 +4141,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
         if (NULL == phQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NULL != pProperties && UR_QUEUE_FLAGS_MASK & pProperties->flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -4112,7 +4192,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4139,7 +4219,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4169,7 +4249,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4208,7 +4288,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4249,7 +4329,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4276,7 +4356,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4309,7 +4389,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4321,7 +4401,9 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_EVENT_INFO_REFERENCE_COUNT < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -4363,11 +4445,13 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_PROFILING_INFO_COMMAND_COMPLETE < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -4402,11 +4486,13 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == phEventWaitList) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (numEvents == 0) {
             return UR_RESULT_ERROR_INVALID_VALUE;
         }
@@ -4428,7 +4514,7 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4454,7 +4540,7 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4482,7 +4568,7 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4520,7 +4606,7 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4560,7 +4646,7 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4568,7 +4654,9 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         if (NULL == pfnNotify) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_EXECUTION_INFO_QUEUED < execStatus) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -4626,7 +4714,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4642,7 +4730,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         if (NULL == pGlobalWorkSize) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -4698,11 +4788,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -4753,11 +4845,13 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -4812,7 +4906,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4824,7 +4918,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         if (NULL == pDst) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -4894,7 +4990,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4906,7 +5002,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         if (NULL == pSrc) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -4987,7 +5085,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -4999,7 +5097,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         if (NULL == pDst) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -5124,7 +5224,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5136,7 +5236,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         if (NULL == pSrc) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -5246,7 +5348,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5258,7 +5360,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         if (NULL == hBufferDst) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -5349,7 +5453,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5361,7 +5465,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         if (NULL == hBufferDst) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -5478,7 +5584,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5490,7 +5596,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         if (NULL == pPattern) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -5583,7 +5691,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5595,7 +5703,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         if (NULL == pDst) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -5673,7 +5783,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5685,7 +5795,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         if (NULL == pSrc) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -5764,7 +5876,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5776,7 +5888,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         if (NULL == hImageDst) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -5862,7 +5976,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5874,7 +5988,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         if (NULL == ppRetMap) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_MAP_FLAGS_MASK & mapFlags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -5943,7 +6059,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -5955,7 +6071,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         if (NULL == pMappedPtr) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -6018,7 +6136,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6030,7 +6148,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         if (NULL == pPattern) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (patternSize == 0 || size == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -6105,7 +6225,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6117,7 +6237,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         if (NULL == pSrc) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (size == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -6189,7 +6311,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6197,7 +6319,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         if (NULL == pMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_USM_MIGRATION_FLAGS_MASK & flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -6260,7 +6384,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6268,7 +6392,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         if (NULL == pMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_USM_ADVICE_FLAGS_MASK & advice) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -6328,7 +6454,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6340,7 +6466,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         if (NULL == pPattern) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pitch == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -6441,7 +6569,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6453,7 +6581,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         if (NULL == pSrc) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (srcPitch == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -6547,7 +6677,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6563,7 +6693,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         if (NULL == pSrc) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -6628,7 +6760,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6644,7 +6776,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         if (NULL == pDst) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -6712,7 +6846,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6728,7 +6862,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         if (NULL == pDst) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -6796,7 +6932,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6812,7 +6948,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         if (NULL == pSrc) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -6871,7 +7009,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6887,7 +7025,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         if (NULL == pResultPitch) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NULL != pUSMDesc && UR_USM_ADVICE_FLAGS_MASK & pUSMDesc->hints) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -6941,7 +7081,7 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -6984,7 +7124,7 @@ urBindlessImagesSampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7028,7 +7168,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7048,7 +7188,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
         if (NULL == phImageMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pImageDesc->type) {
             return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
         }
@@ -7085,7 +7227,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7130,7 +7272,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7150,7 +7292,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
         if (NULL == phImage) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pImageDesc->type) {
             return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
         }
@@ -7193,7 +7337,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7217,7 +7361,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         if (NULL == phImage) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pImageDesc->type) {
             return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
         }
@@ -7280,7 +7426,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7312,7 +7458,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         if (NULL == pCopyRegion) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_EXP_IMAGE_COPY_FLAGS_MASK & imageCopyFlags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -7366,7 +7514,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7374,7 +7522,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_IMAGE_INFO_DEPTH < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -7409,7 +7559,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7454,7 +7604,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7499,7 +7649,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7515,7 +7665,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         if (NULL == phExternalMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_EXP_EXTERNAL_MEM_TYPE_WIN32_NT_DX12_RESOURCE < memHandleType) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -7558,7 +7710,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7582,7 +7734,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         if (NULL == phImageMem) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pImageDesc->type) {
             return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
         }
@@ -7623,7 +7777,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7672,7 +7826,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7722,7 +7876,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7738,7 +7892,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         if (NULL == phExternalSemaphore) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_EXP_EXTERNAL_SEMAPHORE_TYPE_WIN32_NT_DX12_FENCE <
             semHandleType) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -7778,7 +7934,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7838,7 +7994,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7846,7 +8002,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         if (NULL == hSemaphore) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList != NULL && numEventsInWaitList > 0) {
             for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
                 if (phEventWaitList[i] == NULL) {
@@ -7899,7 +8057,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7907,7 +8065,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         if (NULL == hSemaphore) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList != NULL && numEventsInWaitList > 0) {
             for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
                 if (phEventWaitList[i] == NULL) {
@@ -7945,7 +8105,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -7987,7 +8147,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8011,7 +8171,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8035,7 +8195,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8087,7 +8247,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8103,7 +8263,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         if (NULL == pGlobalWorkSize) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phKernelAlternatives == NULL && numKernelAlternatives > 0) {
             return UR_RESULT_ERROR_INVALID_VALUE;
         }
@@ -8157,7 +8319,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8169,7 +8331,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         if (NULL == pSrc) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (size == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -8215,7 +8379,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8227,7 +8391,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         if (NULL == pPattern) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (patternSize == 0 || size == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -8281,7 +8447,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8293,7 +8459,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         if (NULL == hDstMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
         }
@@ -8345,7 +8513,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8357,7 +8525,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         if (NULL == pSrc) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
         }
@@ -8403,7 +8573,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8415,7 +8585,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         if (NULL == pDst) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
         }
@@ -8469,7 +8641,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8481,7 +8653,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         if (NULL == hDstMem) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
         }
@@ -8548,7 +8722,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8560,7 +8734,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         if (NULL == pSrc) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
         }
@@ -8619,7 +8795,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8631,7 +8807,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         if (NULL == pDst) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
         }
@@ -8680,7 +8858,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8692,7 +8870,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         if (NULL == pPattern) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pSyncPointWaitList == NULL && numSyncPointsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP;
         }
@@ -8737,7 +8917,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8745,7 +8925,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         if (NULL == pMemory) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_USM_MIGRATION_FLAGS_MASK & flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -8793,7 +8975,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8801,7 +8983,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         if (NULL == pMemory) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_USM_ADVICE_FLAGS_MASK & advice) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -8849,7 +9033,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8857,7 +9041,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -8899,7 +9085,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8923,7 +9109,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8949,7 +9135,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -8957,7 +9143,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         if (NULL == pUpdateKernelLaunch) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (pUpdateKernelLaunch->newWorkDim < 1 ||
             pUpdateKernelLaunch->newWorkDim > 3) {
             return UR_RESULT_ERROR_INVALID_WORK_DIMENSION;
@@ -8992,7 +9180,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommandBuffer) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9004,7 +9192,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_EXP_COMMAND_BUFFER_INFO_REFERENCE_COUNT < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -9042,7 +9232,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hCommand) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9054,7 +9244,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (UR_EXP_COMMAND_BUFFER_COMMAND_INFO_REFERENCE_COUNT < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
@@ -9108,7 +9300,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9124,7 +9316,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         if (NULL == pGlobalWorkSize) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -9179,7 +9373,7 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hKernel) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9230,7 +9424,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9238,7 +9432,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
         if (NULL == phEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList == NULL && numEventsInWaitList > 0) {
             return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
@@ -9304,7 +9500,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9320,7 +9516,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         if (NULL == launchPropList) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (phEventWaitList != NULL && numEventsInWaitList > 0) {
             for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
                 if (phEventWaitList[i] == NULL) {
@@ -9364,7 +9562,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9401,7 +9599,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9446,7 +9644,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9462,7 +9660,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
         if (NULL == phProgram) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (count == 0) {
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
@@ -9492,7 +9692,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9524,7 +9724,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9558,7 +9758,7 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == commandDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9597,7 +9797,7 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == commandDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9647,7 +9847,7 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == commandDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9663,8 +9863,10 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
         if (pPropValue == NULL && pPropSizeRet == NULL) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
-        if (UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED < propName) {
+    if (getContext()->enableParameterValidation) {
+        if (UR_EXP_PEER_INFO_UR_PEER_COPY_INTERMEDIATE_DEVICE < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
 
@@ -9690,6 +9892,41 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMPoolTrimExp
+__urdlllocal ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM pool to trim, NULL trims every pool of hContext
+    size_t minBytesToKeep ///< [in] number of cached bytes each pool may keep
+) {
+    auto pfnPoolTrimExp = getContext()->urDdiTable.USMExp.pfnPoolTrimExp;
+
+    if (nullptr == pfnPoolTrimExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hPool)) {
+        getContext()->refCountContext->logInvalidReference(hPool);
+    }
+
+    ur_result_t result = pfnPoolTrimExp(hContext, hPool, minBytesToKeep);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urEnqueueNativeCommandExp
 __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
@@ -9722,7 +9959,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (getContext()->enableParameterValidation) {
+    if (getContext()->enableHandleValidation) {
         if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -9730,7 +9967,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
         if (NULL == pfnNativeEnqueue) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
+    }
 
+    if (getContext()->enableParameterValidation) {
         if (NULL != pProperties &&
             UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAGS_MASK & pProperties->flags) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -9758,70 +9997,627 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Exported function for filling application's Global table
-///        with current process' addresses
-///
-/// @returns
-///     - ::UR_RESULT_SUCCESS
-///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
-UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
-    ur_api_version_t version, ///< [in] API version requested
-    ur_global_dditable_t
-        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+/// @brief Intercept function for urEnqueueUSMDeviceAllocExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the allocation.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    void **ppMem, ///< [out] pointer to USM device memory object
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Global;
+    auto pfnUSMDeviceAllocExp =
+        getContext()->urDdiTable.EnqueueExp.pfnUSMDeviceAllocExp;
 
-    if (nullptr == pDdiTable) {
-        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    if (nullptr == pfnUSMDeviceAllocExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
-        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
     }
 
-    ur_result_t result = UR_RESULT_SUCCESS;
+    if (getContext()->enableParameterValidation) {
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_USM_SIZE;
+        }
 
-    dditable.pfnAdapterGet = pDdiTable->pfnAdapterGet;
-    pDdiTable->pfnAdapterGet = ur_validation_layer::urAdapterGet;
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
 
-    dditable.pfnAdapterRelease = pDdiTable->pfnAdapterRelease;
-    pDdiTable->pfnAdapterRelease = ur_validation_layer::urAdapterRelease;
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
 
-    dditable.pfnAdapterRetain = pDdiTable->pfnAdapterRetain;
-    pDdiTable->pfnAdapterRetain = ur_validation_layer::urAdapterRetain;
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
 
-    dditable.pfnAdapterGetLastError = pDdiTable->pfnAdapterGetLastError;
-    pDdiTable->pfnAdapterGetLastError =
-        ur_validation_layer::urAdapterGetLastError;
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
 
-    dditable.pfnAdapterGetInfo = pDdiTable->pfnAdapterGetInfo;
-    pDdiTable->pfnAdapterGetInfo = ur_validation_layer::urAdapterGetInfo;
+    ur_result_t result = pfnUSMDeviceAllocExp(
+        hQueue, size, numEventsInWaitList, phEventWaitList, ppMem, phEvent);
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Exported function for filling application's BindlessImagesExp table
-///        with current process' addresses
-///
-/// @returns
-///     - ::UR_RESULT_SUCCESS
-///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
-UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
-    ur_api_version_t version, ///< [in] API version requested
-    ur_bindless_images_exp_dditable_t
-        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+/// @brief Intercept function for urEnqueueUSMFreeExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    void *
+        pMem, ///< [in] pointer to USM memory object allocated with
+              ///< ::urEnqueueUSMDeviceAllocExp
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the free.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
 ) {
-    auto &dditable =
-        ur_validation_layer::getContext()->urDdiTable.BindlessImagesExp;
+    auto pfnUSMFreeExp = getContext()->urDdiTable.EnqueueExp.pfnUSMFreeExp;
 
-    if (nullptr == pDdiTable) {
-        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    if (nullptr == pfnUSMFreeExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnUSMFreeExp(hQueue, pMem, numEventsInWaitList,
+                                       phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferCopyRectBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_mem_handle_t hBufferSrc, ///< [in] handle of the source buffer object
+    ur_mem_handle_t hBufferDst, ///< [in] handle of the dest buffer object
+    uint32_t numRegions, ///< [in] number of rectangular regions to copy
+    const ur_rect_offset_t *
+        pSrcOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the source
+                     ///< buffer
+    const ur_rect_offset_t *
+        pDstOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the
+                     ///< destination buffer
+    const ur_rect_region_t *
+        pRegions, ///< [in][range(0, numRegions)] 3D rectangular region descriptors: width,
+                  ///< height, depth
+    size_t
+        srcRowPitch, ///< [in] length of each row in bytes in the source buffer object
+    size_t
+        srcSlicePitch, ///< [in] length of each 2D slice in bytes in the source buffer object
+    size_t
+        dstRowPitch, ///< [in] length of each row in bytes in the destination buffer object
+    size_t
+        dstSlicePitch, ///< [in] length of each 2D slice in bytes in the destination buffer object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    auto pfnMemBufferCopyRectBatchExp =
+        getContext()->urDdiTable.EnqueueExp.pfnMemBufferCopyRectBatchExp;
+
+    if (nullptr == pfnMemBufferCopyRectBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBufferSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hBufferDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pSrcOrigins) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pDstOrigins) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pRegions) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (numRegions == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBufferSrc)) {
+        getContext()->refCountContext->logInvalidReference(hBufferSrc);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hBufferDst)) {
+        getContext()->refCountContext->logInvalidReference(hBufferDst);
+    }
+
+    ur_result_t result = pfnMemBufferCopyRectBatchExp(
+        hQueue, hBufferSrc, hBufferDst, numRegions, pSrcOrigins, pDstOrigins,
+        pRegions, srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueKernelLaunchBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t numLaunches,     ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_desc_t *
+        pLaunches, ///< [in][range(0, numLaunches)] pointer to a list of kernel launch
+                   ///< descriptors
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernels execute.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the completion
+                ///< of all the launches.
+) {
+    auto pfnKernelLaunchBatchExp =
+        getContext()->urDdiTable.EnqueueExp.pfnKernelLaunchBatchExp;
+
+    if (nullptr == pfnKernelLaunchBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pLaunches) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (numLaunches == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnKernelLaunchBatchExp(
+        hQueue, numLaunches, pLaunches, numEventsInWaitList, phEventWaitList,
+        phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelSetArgsExp
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments
+    const ur_exp_kernel_arg_properties_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to a list of kernel arguments
+) {
+    auto pfnSetArgsExp = getContext()->urDdiTable.KernelExp.pfnSetArgsExp;
+
+    if (nullptr == pfnSetArgsExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pArgs) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (numArgs == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    ur_result_t result = pfnSetArgsExp(hKernel, numArgs, pArgs);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventWaitAnyExp
+__urdlllocal ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+    uint32_t *
+        pEventIndex ///< [out] index in phEventWaitList of an event which is complete
+) {
+    auto pfnWaitAnyExp = getContext()->urDdiTable.EventExp.pfnWaitAnyExp;
+
+    if (nullptr == pfnWaitAnyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == phEventWaitList) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pEventIndex) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (numEvents == 0) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+    }
+
+    ur_result_t result = pfnWaitAnyExp(numEvents, phEventWaitList, pEventIndex);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventGetExecutionStatusExp
+__urdlllocal ur_result_t UR_APICALL urEventGetExecutionStatusExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEvents, ///< [in][range(0, numEvents)] pointer to a list of events to query
+    ur_event_status_t *
+        pStatuses ///< [out][range(0, numEvents)] execution status of each of the events of
+                  ///< phEvents
+) {
+    auto pfnGetExecutionStatusExp = getContext()->urDdiTable.EventExp.pfnGetExecutionStatusExp;
+
+    if (nullptr == pfnGetExecutionStatusExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == phEvents) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pStatuses) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (numEvents == 0) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+    }
+
+    ur_result_t result = pfnGetExecutionStatusExp(numEvents, phEvents, pStatuses);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueReserveTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReserveTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t
+        capacity ///< [in] number of slots of the ring, the number of markers which can be
+    ///< enqueued before the first one is overwritten
+) {
+    auto pfnReserveTimestampMarkersExp =
+        getContext()->urDdiTable.QueueExp.pfnReserveTimestampMarkersExp;
+
+    if (nullptr == pfnReserveTimestampMarkersExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (capacity == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnReserveTimestampMarkersExp(hQueue, capacity);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueTimestampMarkerExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the timestamp is written.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    uint64_t *pMarker ///< [out][optional] number of the marker
+) {
+    auto pfnTimestampMarkerExp =
+        getContext()->urDdiTable.EnqueueExp.pfnTimestampMarkerExp;
+
+    if (nullptr == pfnTimestampMarkerExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnTimestampMarkerExp(hQueue, numEventsInWaitList,
+                                               phEventWaitList, pMarker);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueReadTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReadTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint64_t firstMarker,     ///< [in] number of the first marker to read
+    uint32_t count,           ///< [in] number of markers to read
+    uint64_t *
+        pTimestamps ///< [out][range(0, count)] timestamps in nanoseconds of the markers
+) {
+    auto pfnReadTimestampMarkersExp =
+        getContext()->urDdiTable.QueueExp.pfnReadTimestampMarkersExp;
+
+    if (nullptr == pfnReadTimestampMarkersExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableHandleValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pTimestamps) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (count == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result =
+        pfnReadTimestampMarkersExp(hQueue, firstMarker, count, pTimestamps);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Global table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_global_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Global;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnAdapterGet = pDdiTable->pfnAdapterGet;
+    pDdiTable->pfnAdapterGet = ur_validation_layer::urAdapterGet;
+
+    dditable.pfnAdapterRelease = pDdiTable->pfnAdapterRelease;
+    pDdiTable->pfnAdapterRelease = ur_validation_layer::urAdapterRelease;
+
+    dditable.pfnAdapterRetain = pDdiTable->pfnAdapterRetain;
+    pDdiTable->pfnAdapterRetain = ur_validation_layer::urAdapterRetain;
+
+    dditable.pfnAdapterGetLastError = pDdiTable->pfnAdapterGetLastError;
+    pDdiTable->pfnAdapterGetLastError =
+        ur_validation_layer::urAdapterGetLastError;
+
+    dditable.pfnAdapterGetInfo = pDdiTable->pfnAdapterGetInfo;
+    pDdiTable->pfnAdapterGetInfo = ur_validation_layer::urAdapterGetInfo;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's BindlessImagesExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_bindless_images_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable =
+        ur_validation_layer::getContext()->urDdiTable.BindlessImagesExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
     if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
@@ -10247,6 +11043,26 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
     pDdiTable->pfnNativeCommandExp =
         ur_validation_layer::urEnqueueNativeCommandExp;
 
+    dditable.pfnUSMDeviceAllocExp = pDdiTable->pfnUSMDeviceAllocExp;
+    pDdiTable->pfnUSMDeviceAllocExp =
+        ur_validation_layer::urEnqueueUSMDeviceAllocExp;
+
+    dditable.pfnUSMFreeExp = pDdiTable->pfnUSMFreeExp;
+    pDdiTable->pfnUSMFreeExp = ur_validation_layer::urEnqueueUSMFreeExp;
+
+    dditable.pfnMemBufferCopyRectBatchExp =
+        pDdiTable->pfnMemBufferCopyRectBatchExp;
+    pDdiTable->pfnMemBufferCopyRectBatchExp =
+        ur_validation_layer::urEnqueueMemBufferCopyRectBatchExp;
+
+    dditable.pfnKernelLaunchBatchExp = pDdiTable->pfnKernelLaunchBatchExp;
+    pDdiTable->pfnKernelLaunchBatchExp =
+        ur_validation_layer::urEnqueueKernelLaunchBatchExp;
+
+    dditable.pfnTimestampMarkerExp = pDdiTable->pfnTimestampMarkerExp;
+    pDdiTable->pfnTimestampMarkerExp =
+        ur_validation_layer::urEnqueueTimestampMarkerExp;
+
     return result;
 }
 
@@ -10307,6 +11123,44 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EventExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_event_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable = ur_validation_layer::getContext()->urDdiTable.EventExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnWaitAnyExp = pDdiTable->pfnWaitAnyExp;
+    pDdiTable->pfnWaitAnyExp = ur_validation_layer::urEventWaitAnyExp;
+
+    dditable.pfnGetExecutionStatusExp = pDdiTable->pfnGetExecutionStatusExp;
+    pDdiTable->pfnGetExecutionStatusExp =
+        ur_validation_layer::urEventGetExecutionStatusExp;
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Kernel table
 ///        with current process' addresses
@@ -10426,6 +11280,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
     pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
         ur_validation_layer::urKernelSuggestMaxCooperativeGroupCountExp;
 
+    dditable.pfnSetArgsExp = pDdiTable->pfnSetArgsExp;
+    pDdiTable->pfnSetArgsExp = ur_validation_layer::urKernelSetArgsExp;
+
     return result;
 }
 
@@ -10763,6 +11620,46 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's QueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto &dditable = ur_validation_layer::getContext()->urDdiTable.QueueExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnReserveTimestampMarkersExp =
+        pDdiTable->pfnReserveTimestampMarkersExp;
+    pDdiTable->pfnReserveTimestampMarkersExp =
+        ur_validation_layer::urQueueReserveTimestampMarkersExp;
+
+    dditable.pfnReadTimestampMarkersExp = pDdiTable->pfnReadTimestampMarkersExp;
+    pDdiTable->pfnReadTimestampMarkersExp =
+        ur_validation_layer::urQueueReadTimestampMarkersExp;
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Sampler table
 ///        with current process' addresses
@@ -10909,6 +11806,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
     dditable.pfnReleaseExp = pDdiTable->pfnReleaseExp;
     pDdiTable->pfnReleaseExp = ur_validation_layer::urUSMReleaseExp;
 
+    dditable.pfnPoolTrimExp = pDdiTable->pfnPoolTrimExp;
+    pDdiTable->pfnPoolTrimExp = ur_validation_layer::urUSMPoolTrimExp;
+
     return result;
 }
 
@@ -11075,6 +11975,7 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
     ur_result_t result = UR_RESULT_SUCCESS;
 
     if (enabledLayerNames.count(nameFullValidation)) {
+        enableHandleValidation = true;
         enableParameterValidation = true;
         enableBoundsChecking = true;
         enableLeakChecking = true;
@@ -11083,7 +11984,12 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
         if (enabledLayerNames.count(nameBoundsChecking)) {
             enableBoundsChecking = true;
         }
+        if (enabledLayerNames.count(nameHandleValidation)) {
+            enableHandleValidation = true;
+        }
         if (enabledLayerNames.count(nameParameterValidation)) {
+            // Null handle and pointer checks are part of parameter validation.
+            enableHandleValidation = true;
             enableParameterValidation = true;
         }
         if (enabledLayerNames.count(nameLeakChecking)) {
@@ -11096,11 +12002,13 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
         }
     }
 
-    if (!enableParameterValidation && !enableLeakChecking &&
-        !enableLifetimeValidation) {
+    if (!enableHandleValidation && !enableParameterValidation &&
+        !enableLeakChecking && !enableLifetimeValidation) {
         return result;
     }
 
+    configure();
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_validation_layer::urGetGlobalProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Global);
@@ -11136,6 +12044,11 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
             UR_API_VERSION_CURRENT, &dditable->Event);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_validation_layer::urGetEventExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->EventExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_validation_layer::urGetKernelProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Kernel);
@@ -11176,6 +12089,11 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
             UR_API_VERSION_CURRENT, &dditable->Queue);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_validation_layer::urGetQueueExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->QueueExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_validation_layer::urGetSamplerProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Sampler);
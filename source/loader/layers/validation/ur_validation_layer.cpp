@@ -13,6 +13,7 @@
 #include "ur_leak_check.hpp"
 
 #include <cassert>
+#include <stdexcept>
 
 namespace ur_validation_layer {
 context_t *getContext() { return context_t::get_direct(); }
@@ -25,6 +26,48 @@ context_t::context_t()
 ///////////////////////////////////////////////////////////////////////////////
 context_t::~context_t() {}
 
+///////////////////////////////////////////////////////////////////////////////
+void context_t::configure() {
+    refCountContext->setBacktraceSampling(1);
+    if (enableLifetimeValidation) {
+        refCountContext->enableHandleRegistry();
+    }
+
+    std::optional<EnvVarMap> options;
+    try {
+        options = getenv_to_map("UR_LAYER_VALIDATION_OPTIONS");
+    } catch (const std::invalid_argument &e) {
+        logger.error("unable to parse UR_LAYER_VALIDATION_OPTIONS: {}",
+                     e.what());
+        return;
+    }
+    if (!options) {
+        return;
+    }
+
+    for (auto &[key, values] : *options) {
+        if (key == "backtrace" && values.size() == 1) {
+            // all, none, or N to capture one in every N handles
+            auto &value = values.front();
+            if (value == "all") {
+                refCountContext->setBacktraceSampling(1);
+            } else if (value == "none") {
+                refCountContext->setBacktraceSampling(0);
+            } else {
+                try {
+                    refCountContext->setBacktraceSampling(std::stoul(value));
+                } catch (const std::exception &) {
+                    logger.error("invalid backtrace value {}", value);
+                }
+            }
+        } else {
+            logger.warning("unknown or malformed UR_LAYER_VALIDATION_OPTIONS "
+                           "option {}",
+                           key);
+        }
+    }
+}
+
 // Some adapters don't support all the queries yet, we should be lenient and
 // just not attempt to validate in those cases to preserve functionality.
 #define RETURN_ON_FAILURE(result)                                              \
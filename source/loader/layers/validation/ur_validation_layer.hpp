@@ -23,6 +23,7 @@ struct RefCountContext;
 class __urdlllocal context_t : public proxy_layer_context_t,
                                public AtomicSingleton<context_t> {
   public:
+    bool enableHandleValidation = false;
     bool enableParameterValidation = false;
     bool enableBoundsChecking = false;
     bool enableLeakChecking = false;
@@ -35,19 +36,25 @@ class __urdlllocal context_t : public proxy_layer_context_t,
     ~context_t();
 
     static std::vector<std::string> getNames() {
-        return {nameFullValidation, nameParameterValidation, nameLeakChecking,
-                nameBoundsChecking, nameLifetimeValidation};
+        return {nameFullValidation, nameHandleValidation,
+                nameParameterValidation, nameLeakChecking, nameBoundsChecking,
+                nameLifetimeValidation};
     }
     ur_result_t init(ur_dditable_t *dditable,
                      const std::set<std::string> &enabledLayerNames,
                      codeloc_data codelocData) override;
     ur_result_t tearDown() override;
 
+    /// Applies the options in UR_LAYER_VALIDATION_OPTIONS.
+    void configure();
+
     std::unique_ptr<RefCountContext> refCountContext;
 
   private:
     inline static const std::string nameFullValidation =
         "UR_LAYER_FULL_VALIDATION";
+    inline static const std::string nameHandleValidation =
+        "UR_LAYER_HANDLE_VALIDATION";
     inline static const std::string nameParameterValidation =
         "UR_LAYER_PARAMETER_VALIDATION";
     inline static const std::string nameBoundsChecking =
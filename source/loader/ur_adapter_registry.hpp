@@ -27,17 +27,17 @@ class AdapterRegistry {
         try {
             forceLoadedAdaptersOpt = getenv_to_vec("UR_ADAPTERS_FORCE_LOAD");
         } catch (const std::invalid_argument &e) {
-            logger::error(e.what());
+            UR_LOG(ERR, "{}", e.what());
         }
 
         if (forceLoadedAdaptersOpt.has_value()) {
             for (const auto &s : forceLoadedAdaptersOpt.value()) {
                 auto path = fs::path(s);
                 if (path.filename().extension() == STATIC_LIBRARY_EXTENSION) {
-                    logger::warning(
-                        "UR_ADAPTERS_FORCE_LOAD contains a path to a static"
-                        "library {}, it will be skipped",
-                        s);
+                    UR_LOG(WARN,
+                           "UR_ADAPTERS_FORCE_LOAD contains a path to a static"
+                           "library {}, it will be skipped",
+                           s);
                     continue;
                 }
 
@@ -45,7 +45,7 @@ class AdapterRegistry {
                 try {
                     exists = fs::exists(path);
                 } catch (std::exception &e) {
-                    logger::error(e.what());
+                    UR_LOG(ERR, "{}", e.what());
                 }
 
                 if (exists) {
@@ -53,10 +53,10 @@ class AdapterRegistry {
                     adaptersLoadPaths.emplace_back(
                         std::vector{std::move(path)});
                 } else {
-                    logger::warning(
-                        "Detected nonexistent path {} in environment "
-                        "variable UR_ADAPTERS_FORCE_LOAD",
-                        s);
+                    UR_LOG(WARN,
+                           "Detected nonexistent path {} in environment "
+                           "variable UR_ADAPTERS_FORCE_LOAD",
+                           s);
                 }
             }
         } else {
@@ -133,6 +133,40 @@ class AdapterRegistry {
         MAKE_LIBRARY_NAME("ur_adapter_native_cpu", "0"),
     };
 
+    static bool isStaticAdapter([[maybe_unused]] const char *adapterName) {
+#ifdef UR_STATIC_ADAPTER_LEVEL_ZERO
+        if (strcmp(adapterName,
+                   MAKE_LIBRARY_NAME("ur_adapter_level_zero", "0")) == 0) {
+            return true;
+        }
+#endif
+#ifdef UR_STATIC_ADAPTER_CUDA
+        if (strcmp(adapterName,
+                   MAKE_LIBRARY_NAME("ur_adapter_cuda", "0")) == 0) {
+            return true;
+        }
+#endif
+#ifdef UR_STATIC_ADAPTER_HIP
+        if (strcmp(adapterName,
+                   MAKE_LIBRARY_NAME("ur_adapter_hip", "0")) == 0) {
+            return true;
+        }
+#endif
+#ifdef UR_STATIC_ADAPTER_OPENCL
+        if (strcmp(adapterName,
+                   MAKE_LIBRARY_NAME("ur_adapter_opencl", "0")) == 0) {
+            return true;
+        }
+#endif
+#ifdef UR_STATIC_ADAPTER_NATIVE_CPU
+        if (strcmp(adapterName,
+                   MAKE_LIBRARY_NAME("ur_adapter_native_cpu", "0")) == 0) {
+            return true;
+        }
+#endif
+        return false;
+    }
+
     static constexpr const char *mockAdapterName =
         MAKE_LIBRARY_NAME("ur_adapter_mock", "0");
 
@@ -141,7 +175,7 @@ class AdapterRegistry {
         try {
             pathStringsOpt = getenv_to_vec("UR_ADAPTERS_SEARCH_PATH");
         } catch (const std::invalid_argument &e) {
-            logger::error(e.what());
+            UR_LOG(ERR, "{}", e.what());
             return std::nullopt;
         }
 
@@ -152,10 +186,10 @@ class AdapterRegistry {
                 if (fs::exists(path)) {
                     paths.emplace_back(path);
                 } else {
-                    logger::warning(
-                        "Detected nonexistent path {} in environmental "
-                        "variable UR_ADAPTERS_SEARCH_PATH",
-                        s);
+                    UR_LOG(WARN,
+                           "Detected nonexistent path {} in environmental "
+                           "variable UR_ADAPTERS_SEARCH_PATH",
+                           s);
                 }
             }
         }
@@ -163,27 +197,33 @@ class AdapterRegistry {
         return paths.empty() ? std::nullopt : std::optional(paths);
     }
 
-    ur_result_t readPreFilterODS(std::string platformBackendName) {
-        // TODO: Refactor this to the common code such that both the prefilter and urDeviceGetSelected use the same functionality.
-        bool acceptLibrary = true;
+    // Parses ONEAPI_DEVICE_SELECTOR for the pre-filter. This is done once,
+    // before any adapter library is considered, and the result is matched
+    // against every known adapter name. A malformed selector yields
+    // std::nullopt, in which case no adapter is filtered out.
+    std::optional<EnvVarMap> parsePreFilterODS() {
         std::optional<EnvVarMap> odsEnvMap;
         try {
             odsEnvMap = getenv_to_map("ONEAPI_DEVICE_SELECTOR", false);
 
         } catch (...) {
             // If the selector is malformed, then we ignore selector and return success.
-            logger::error("ERROR: missing backend, format of filter = "
-                          "'[!]backend:filterStrings'");
-            return UR_RESULT_SUCCESS;
+            UR_LOG(ERR, "ERROR: missing backend, format of filter = "
+                        "'[!]backend:filterStrings'");
+            return std::nullopt;
         }
-        logger::debug(
-            "getenv_to_map parsed env var and {} a map",
-            (odsEnvMap.has_value() ? "produced" : "failed to produce"));
+        UR_LOG(DEBUG, "getenv_to_map parsed env var and {} a map",
+               (odsEnvMap.has_value() ? "produced" : "failed to produce"));
 
         // if the ODS env var is not set at all, then pretend it was set to the default
-        using EnvVarMap = std::map<std::string, std::vector<std::string>>;
-        EnvVarMap mapODS =
-            odsEnvMap.has_value() ? odsEnvMap.value() : EnvVarMap{{"*", {"*"}}};
+        return odsEnvMap.has_value() ? odsEnvMap.value()
+                                     : EnvVarMap{{"*", {"*"}}};
+    }
+
+    ur_result_t readPreFilterODS(std::string platformBackendName,
+                                 const EnvVarMap &mapODS) {
+        // TODO: Refactor this to the common code such that both the prefilter and urDeviceGetSelected use the same functionality.
+        bool acceptLibrary = true;
         for (auto &termPair : mapODS) {
             std::string backend = termPair.first;
             // TODO: Figure out how to process all ODS errors rather than returning
@@ -191,25 +231,25 @@ class AdapterRegistry {
             if (backend.empty()) {
                 // FIXME: never true because getenv_to_map rejects this case
                 // malformed term: missing backend -- output ERROR, then continue
-                logger::error("ERROR: missing backend, format of filter = "
-                              "'[!]backend:filterStrings'");
+                UR_LOG(ERR, "ERROR: missing backend, format of filter = "
+                            "'[!]backend:filterStrings'");
                 continue;
             }
-            logger::debug("ONEAPI_DEVICE_SELECTOR Pre-Filter with backend '{}' "
-                          "and platform library name '{}'",
-                          backend, platformBackendName);
+            UR_LOG(DEBUG,
+                   "ONEAPI_DEVICE_SELECTOR Pre-Filter with backend '{}' "
+                   "and platform library name '{}'",
+                   backend, platformBackendName);
             enum FilterType {
                 AcceptFilter,
                 DiscardFilter,
             } termType =
                 (backend.front() != '!') ? AcceptFilter : DiscardFilter;
-            logger::debug(
-                "termType is {}",
-                (termType != AcceptFilter ? "DiscardFilter" : "AcceptFilter"));
+            UR_LOG(DEBUG, "termType is {}",
+                   termType != AcceptFilter ? "DiscardFilter" : "AcceptFilter");
             if (termType != AcceptFilter) {
-                logger::debug("DEBUG: backend was '{}'", backend);
+                UR_LOG(DEBUG, "DEBUG: backend was '{}'", backend);
                 backend.erase(backend.cbegin());
-                logger::debug("DEBUG: backend now '{}'", backend);
+                UR_LOG(DEBUG, "DEBUG: backend now '{}'", backend);
             }
 
             // Verify that the backend string is valid, otherwise ignore the backend.
@@ -217,10 +257,12 @@ class AdapterRegistry {
                 (strcmp(backend.c_str(), "level_zero") != 0) &&
                 (strcmp(backend.c_str(), "opencl") != 0) &&
                 (strcmp(backend.c_str(), "cuda") != 0) &&
-                (strcmp(backend.c_str(), "hip") != 0)) {
-                logger::debug("ONEAPI_DEVICE_SELECTOR Pre-Filter with illegal "
-                              "backend '{}' ",
-                              backend);
+                (strcmp(backend.c_str(), "hip") != 0) &&
+                (strcmp(backend.c_str(), "native_cpu") != 0)) {
+                UR_LOG(DEBUG,
+                       "ONEAPI_DEVICE_SELECTOR Pre-Filter with illegal "
+                       "backend '{}' ",
+                       backend);
                 continue;
             }
 
@@ -236,10 +278,10 @@ class AdapterRegistry {
             bool backendFound = nameFound != std::string::npos;
             if (termType == AcceptFilter) {
                 if (backend.front() != '*' && !backendFound) {
-                    logger::debug(
-                        "The ONEAPI_DEVICE_SELECTOR backend name '{}' was not "
-                        "found in the platform library name '{}'",
-                        backend, platformBackendName);
+                    UR_LOG(DEBUG,
+                           "The ONEAPI_DEVICE_SELECTOR backend name '{}' was "
+                           "not found in the platform library name '{}'",
+                           backend, platformBackendName);
                     acceptLibrary = false;
                     continue;
                 } else if (backend.front() == '*' || backendFound) {
@@ -248,10 +290,11 @@ class AdapterRegistry {
             } else {
                 if (backendFound || backend.front() == '*') {
                     acceptLibrary = false;
-                    logger::debug(
-                        "The ONEAPI_DEVICE_SELECTOR backend name for discard "
-                        "'{}' was found in the platform library name '{}'",
-                        backend, platformBackendName);
+                    UR_LOG(DEBUG,
+                           "The ONEAPI_DEVICE_SELECTOR backend name for "
+                           "discard '{}' was found in the platform library "
+                           "name '{}'",
+                           backend, platformBackendName);
                     continue;
                 }
             }
@@ -270,13 +313,20 @@ class AdapterRegistry {
 #else
         bool loaderPreFilter = getenv_tobool("UR_LOADER_PRELOAD_FILTER", true);
 #endif
+        auto mapODS = loaderPreFilter ? parsePreFilterODS() : std::nullopt;
         for (const auto &adapterName : knownAdapterNames) {
+            if (isStaticAdapter(adapterName)) {
+                // already embedded in the loader, never dlopen a second copy
+                continue;
+            }
 
-            if (loaderPreFilter) {
-                if (readPreFilterODS(adapterName) != UR_RESULT_SUCCESS) {
-                    logger::debug("The adapter '{}' was removed based on the "
-                                  "pre-filter from ONEAPI_DEVICE_SELECTOR.",
-                                  adapterName);
+            if (mapODS.has_value()) {
+                if (readPreFilterODS(adapterName, mapODS.value()) !=
+                    UR_RESULT_SUCCESS) {
+                    UR_LOG(DEBUG,
+                           "The adapter '{}' was removed based on the "
+                           "pre-filter from ONEAPI_DEVICE_SELECTOR.",
+                           adapterName);
                     continue;
                 }
             }
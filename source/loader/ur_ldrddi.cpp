@@ -11,6 +11,7 @@
  */
 #include "ur_lib_loader.hpp"
 #include "ur_loader.hpp"
+#include "ur_small_vector.hpp"
 
 namespace ur_loader {
 ///////////////////////////////////////////////////////////////////////////////
@@ -32,27 +33,17 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
 
     [[maybe_unused]] auto context = getContext();
 
-    size_t adapterIndex = 0;
     if (nullptr != phAdapters && NumEntries != 0) {
-        for (auto &platform : context->platforms) {
-            if (platform.initStatus != UR_RESULT_SUCCESS) {
-                continue;
-            }
-            platform.dditable.ur.Global.pfnAdapterGet(
-                1, &phAdapters[adapterIndex], nullptr);
-            try {
-                phAdapters[adapterIndex] =
-                    reinterpret_cast<ur_adapter_handle_t>(
-                        context->factories.ur_adapter_factory.getInstance(
-                            phAdapters[adapterIndex], &platform.dditable));
-            } catch (std::bad_alloc &) {
-                result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
-                break;
-            }
-            adapterIndex++;
-            if (adapterIndex == NumEntries) {
-                break;
+        try {
+            std::vector<platform_t *> adapterPlatforms;
+            context->adapterGet(NumEntries, phAdapters, adapterPlatforms);
+            for (size_t i = 0; i < adapterPlatforms.size(); ++i) {
+                phAdapters[i] = reinterpret_cast<ur_adapter_handle_t>(
+                    context->factories.ur_adapter_factory.getInstance(
+                        phAdapters[i], &adapterPlatforms[i]->dditable));
             }
+        } catch (std::bad_alloc &) {
+            result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
         }
     }
 
@@ -203,6 +194,15 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
     [[maybe_unused]] auto context = getContext();
     uint32_t total_platform_handle_count = 0;
 
+    // query the platform count of every adapter up front, concurrently
+    std::vector<std::pair<ur_result_t, uint32_t>> library_platform_counts;
+    try {
+        library_platform_counts =
+            context->platformGetCounts(phAdapters, NumAdapters);
+    } catch (std::bad_alloc &) {
+        return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
     for (uint32_t adapter_index = 0; adapter_index < NumAdapters;
          adapter_index++) {
         // extract adapter's function pointer table
@@ -216,9 +216,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
 
         uint32_t library_platform_handle_count = 0;
 
-        result = dditable->ur.Platform.pfnGet(&phAdapters[adapter_index], 1, 0,
-                                              nullptr,
-                                              &library_platform_handle_count);
+        std::tie(result, library_platform_handle_count) =
+            library_platform_counts[adapter_index];
         if (UR_RESULT_SUCCESS != result) {
             break;
         }
@@ -861,7 +860,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     }
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(DeviceCount);
+    auto phDevicesLocal = small_vector_t<ur_device_handle_t>(DeviceCount);
     for (size_t i = 0; i < DeviceCount; ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
@@ -1072,7 +1071,7 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     hAdapter = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->handle;
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = small_vector_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
@@ -2702,7 +2701,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
     hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
 
     // convert loader handles to platform handles
-    auto phProgramsLocal = std::vector<ur_program_handle_t>(count);
+    auto phProgramsLocal = small_vector_t<ur_program_handle_t>(count);
     for (size_t i = 0; i < count; ++i) {
         phProgramsLocal[i] =
             reinterpret_cast<ur_program_object_t *>(phPrograms[i])->handle;
@@ -4144,7 +4143,7 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
     }
 
     // convert loader handles to platform handles
-    auto phEventWaitListLocal = std::vector<ur_event_handle_t>(numEvents);
+    auto phEventWaitListLocal = small_vector_t<ur_event_handle_t>(numEvents);
     for (size_t i = 0; i < numEvents; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4362,7 +4361,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4424,7 +4423,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4485,7 +4484,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4553,7 +4552,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4624,7 +4623,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4705,7 +4704,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4790,7 +4789,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4864,7 +4863,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -4946,7 +4945,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5016,7 +5015,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5090,7 +5089,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5165,7 +5164,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5244,7 +5243,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5315,7 +5314,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5381,7 +5380,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5448,7 +5447,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5514,7 +5513,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5578,7 +5577,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5698,7 +5697,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5770,7 +5769,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5843,7 +5842,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5916,7 +5915,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -5992,7 +5991,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -6068,7 +6067,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -6413,7 +6412,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -6853,7 +6852,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -6927,7 +6926,7 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -7151,7 +7150,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
 
     // convert loader handles to platform handles
     auto phKernelAlternativesLocal =
-        std::vector<ur_kernel_handle_t>(numKernelAlternatives);
+        small_vector_t<ur_kernel_handle_t>(numKernelAlternatives);
     for (size_t i = 0; i < numKernelAlternatives; ++i) {
         phKernelAlternativesLocal[i] =
             reinterpret_cast<ur_kernel_object_t *>(phKernelAlternatives[i])
@@ -7772,7 +7771,7 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -8056,7 +8055,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -8161,7 +8160,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -8270,7 +8269,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
     hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = small_vector_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
@@ -8308,7 +8307,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
     hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = small_vector_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
@@ -8354,14 +8353,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
     hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
 
     // convert loader handles to platform handles
-    auto phDevicesLocal = std::vector<ur_device_handle_t>(numDevices);
+    auto phDevicesLocal = small_vector_t<ur_device_handle_t>(numDevices);
     for (size_t i = 0; i < numDevices; ++i) {
         phDevicesLocal[i] =
             reinterpret_cast<ur_device_object_t *>(phDevices[i])->handle;
     }
 
     // convert loader handles to platform handles
-    auto phProgramsLocal = std::vector<ur_program_handle_t>(count);
+    auto phProgramsLocal = small_vector_t<ur_program_handle_t>(count);
     for (size_t i = 0; i < count; ++i) {
         phProgramsLocal[i] =
             reinterpret_cast<ur_program_object_t *>(phPrograms[i])->handle;
@@ -8548,6 +8547,38 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMPoolTrimExp
+__urdlllocal ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM pool to trim, NULL trims every pool of hContext
+    size_t minBytesToKeep ///< [in] number of cached bytes each pool may keep
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto pfnPoolTrimExp = dditable->ur.USMExp.pfnPoolTrimExp;
+    if (nullptr == pfnPoolTrimExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+
+    // convert loader handle to platform handle
+    hPool = (hPool) ? reinterpret_cast<ur_usm_pool_object_t *>(hPool)->handle
+                    : nullptr;
+
+    // forward to device-platform
+    result = pfnPoolTrimExp(hContext, hPool, minBytesToKeep);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urEnqueueNativeCommandExp
 __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
@@ -8588,7 +8619,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
     // convert loader handles to platform handles
-    auto phMemListLocal = std::vector<ur_mem_handle_t>(numMemsInMemList);
+    auto phMemListLocal = small_vector_t<ur_mem_handle_t>(numMemsInMemList);
     for (size_t i = 0; i < numMemsInMemList; ++i) {
         phMemListLocal[i] =
             reinterpret_cast<ur_mem_object_t *>(phMemList[i])->handle;
@@ -8596,7 +8627,7 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
 
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
-        std::vector<ur_event_handle_t>(numEventsInWaitList);
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
     for (size_t i = 0; i < numEventsInWaitList; ++i) {
         phEventWaitListLocal[i] =
             reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
@@ -8626,6 +8657,503 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMDeviceAllocExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the allocation.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    void **ppMem, ///< [out] pointer to USM device memory object
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnUSMDeviceAllocExp = dditable->ur.EnqueueExp.pfnUSMDeviceAllocExp;
+    if (nullptr == pfnUSMDeviceAllocExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnUSMDeviceAllocExp(hQueue, size, numEventsInWaitList,
+                                  phEventWaitListLocal.data(), ppMem, phEvent);
+
+    // In the event of ERROR_ADAPTER_SPECIFIC we should still attempt to wrap any output handles below.
+    if (UR_RESULT_SUCCESS != result &&
+        UR_RESULT_ERROR_ADAPTER_SPECIFIC != result) {
+        return result;
+    }
+    try {
+        // convert platform handle to loader handle
+        if (nullptr != phEvent) {
+            *phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(*phEvent,
+                                                                dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMFreeExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    void *
+        pMem, ///< [in] pointer to USM memory object allocated with
+              ///< ::urEnqueueUSMDeviceAllocExp
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the free.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnUSMFreeExp = dditable->ur.EnqueueExp.pfnUSMFreeExp;
+    if (nullptr == pfnUSMFreeExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnUSMFreeExp(hQueue, pMem, numEventsInWaitList,
+                           phEventWaitListLocal.data(), phEvent);
+
+    // In the event of ERROR_ADAPTER_SPECIFIC we should still attempt to wrap any output handles below.
+    if (UR_RESULT_SUCCESS != result &&
+        UR_RESULT_ERROR_ADAPTER_SPECIFIC != result) {
+        return result;
+    }
+    try {
+        // convert platform handle to loader handle
+        if (nullptr != phEvent) {
+            *phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(*phEvent,
+                                                                dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueMemBufferCopyRectBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_mem_handle_t hBufferSrc, ///< [in] handle of the source buffer object
+    ur_mem_handle_t hBufferDst, ///< [in] handle of the dest buffer object
+    uint32_t numRegions, ///< [in] number of rectangular regions to copy
+    const ur_rect_offset_t *
+        pSrcOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the source
+                     ///< buffer
+    const ur_rect_offset_t *
+        pDstOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the
+                     ///< destination buffer
+    const ur_rect_region_t *
+        pRegions, ///< [in][range(0, numRegions)] 3D rectangular region descriptors: width,
+                  ///< height, depth
+    size_t
+        srcRowPitch, ///< [in] length of each row in bytes in the source buffer object
+    size_t
+        srcSlicePitch, ///< [in] length of each 2D slice in bytes in the source buffer object
+    size_t
+        dstRowPitch, ///< [in] length of each row in bytes in the destination buffer object
+    size_t
+        dstSlicePitch, ///< [in] length of each 2D slice in bytes in the destination buffer object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnMemBufferCopyRectBatchExp =
+        dditable->ur.EnqueueExp.pfnMemBufferCopyRectBatchExp;
+    if (nullptr == pfnMemBufferCopyRectBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // convert loader handle to platform handle
+    hBufferSrc = reinterpret_cast<ur_mem_object_t *>(hBufferSrc)->handle;
+
+    // convert loader handle to platform handle
+    hBufferDst = reinterpret_cast<ur_mem_object_t *>(hBufferDst)->handle;
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnMemBufferCopyRectBatchExp(
+        hQueue, hBufferSrc, hBufferDst, numRegions, pSrcOrigins, pDstOrigins,
+        pRegions, srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitListLocal.data(), phEvent);
+
+    // In the event of ERROR_ADAPTER_SPECIFIC we should still attempt to wrap any output handles below.
+    if (UR_RESULT_SUCCESS != result &&
+        UR_RESULT_ERROR_ADAPTER_SPECIFIC != result) {
+        return result;
+    }
+    try {
+        // convert platform handle to loader handle
+        if (nullptr != phEvent) {
+            *phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(*phEvent,
+                                                                dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueKernelLaunchBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t numLaunches,     ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_desc_t *
+        pLaunches, ///< [in][range(0, numLaunches)] pointer to a list of kernel launch
+                   ///< descriptors
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernels execute.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the completion
+                ///< of all the launches.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnKernelLaunchBatchExp =
+        dditable->ur.EnqueueExp.pfnKernelLaunchBatchExp;
+    if (nullptr == pfnKernelLaunchBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // Deep copy pLaunches to convert the kernel handles
+    std::vector<ur_exp_kernel_launch_desc_t> pLaunchesLocal(
+        pLaunches, pLaunches + numLaunches);
+    for (auto &Launch : pLaunchesLocal) {
+        Launch.hKernel =
+            reinterpret_cast<ur_kernel_object_t *>(Launch.hKernel)->handle;
+    }
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnKernelLaunchBatchExp(hQueue, numLaunches, pLaunchesLocal.data(),
+                                     numEventsInWaitList,
+                                     phEventWaitListLocal.data(), phEvent);
+
+    // In the event of ERROR_ADAPTER_SPECIFIC we should still attempt to wrap any output handles below.
+    if (UR_RESULT_SUCCESS != result &&
+        UR_RESULT_ERROR_ADAPTER_SPECIFIC != result) {
+        return result;
+    }
+    try {
+        // convert platform handle to loader handle
+        if (nullptr != phEvent) {
+            *phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(*phEvent,
+                                                                dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelSetArgsExp
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments
+    const ur_exp_kernel_arg_properties_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to a list of kernel arguments
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto pfnSetArgsExp = dditable->ur.KernelExp.pfnSetArgsExp;
+    if (nullptr == pfnSetArgsExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+
+    // Deep copy pArgs to convert the memory object and sampler handles
+    std::vector<ur_exp_kernel_arg_properties_t> pArgsLocal(pArgs,
+                                                           pArgs + numArgs);
+    for (auto &Arg : pArgsLocal) {
+        if (Arg.type == UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ &&
+            Arg.value.memObjTuple.hMem) {
+            Arg.value.memObjTuple.hMem =
+                reinterpret_cast<ur_mem_object_t *>(Arg.value.memObjTuple.hMem)
+                    ->handle;
+        } else if (Arg.type == UR_EXP_KERNEL_ARG_TYPE_SAMPLER) {
+            Arg.value.sampler =
+                reinterpret_cast<ur_sampler_object_t *>(Arg.value.sampler)
+                    ->handle;
+        }
+    }
+
+    // forward to device-platform
+    result = pfnSetArgsExp(hKernel, numArgs, pArgsLocal.data());
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventWaitAnyExp
+__urdlllocal ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+    uint32_t *
+        pEventIndex ///< [out] index in phEventWaitList of an event which is complete
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_event_object_t *>(*phEventWaitList)->dditable;
+    auto pfnWaitAnyExp = dditable->ur.EventExp.pfnWaitAnyExp;
+    if (nullptr == pfnWaitAnyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal = small_vector_t<ur_event_handle_t>(numEvents);
+    for (size_t i = 0; i < numEvents; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnWaitAnyExp(numEvents, phEventWaitListLocal.data(), pEventIndex);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventGetExecutionStatusExp
+__urdlllocal ur_result_t UR_APICALL urEventGetExecutionStatusExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEvents, ///< [in][range(0, numEvents)] pointer to a list of events to query
+    ur_event_status_t *
+        pStatuses ///< [out][range(0, numEvents)] execution status of each of the events of
+                  ///< phEvents
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_event_object_t *>(*phEvents)->dditable;
+    auto pfnGetExecutionStatusExp = dditable->ur.EventExp.pfnGetExecutionStatusExp;
+    if (nullptr == pfnGetExecutionStatusExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handles to platform handles
+    auto phEventsLocal = small_vector_t<ur_event_handle_t>(numEvents);
+    for (size_t i = 0; i < numEvents; ++i) {
+        phEventsLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEvents[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnGetExecutionStatusExp(numEvents, phEventsLocal.data(), pStatuses);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueReserveTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReserveTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t
+        capacity ///< [in] number of slots of the ring, the number of markers which can be
+    ///< enqueued before the first one is overwritten
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnReserveTimestampMarkersExp =
+        dditable->ur.QueueExp.pfnReserveTimestampMarkersExp;
+    if (nullptr == pfnReserveTimestampMarkersExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // forward to device-platform
+    result = pfnReserveTimestampMarkersExp(hQueue, capacity);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueReadTimestampMarkersExp
+__urdlllocal ur_result_t UR_APICALL urQueueReadTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint64_t firstMarker,     ///< [in] number of the first marker to read
+    uint32_t count,           ///< [in] number of markers to read
+    uint64_t *
+        pTimestamps ///< [out][range(0, count)] timestamps in nanoseconds of the markers
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnReadTimestampMarkersExp =
+        dditable->ur.QueueExp.pfnReadTimestampMarkersExp;
+    if (nullptr == pfnReadTimestampMarkersExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // forward to device-platform
+    result = pfnReadTimestampMarkersExp(hQueue, firstMarker, count,
+                                        pTimestamps);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueTimestampMarkerExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the timestamp is written.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    uint64_t *pMarker ///< [out][optional] number of the marker
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnTimestampMarkerExp = dditable->ur.EnqueueExp.pfnTimestampMarkerExp;
+    if (nullptr == pfnTimestampMarkerExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        small_vector_t<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnTimestampMarkerExp(hQueue, numEventsInWaitList,
+                                   phEventWaitListLocal.data(), pMarker);
+
+    return result;
+}
+
 } // namespace ur_loader
 
 #if defined(__cplusplus)
@@ -8676,8 +9204,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnAdapterGet = ur_loader::urAdapterGet;
             pDdiTable->pfnAdapterRelease = ur_loader::urAdapterRelease;
@@ -8742,8 +9269,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnUnsampledImageHandleDestroyExp =
                 ur_loader::urBindlessImagesUnsampledImageHandleDestroyExp;
@@ -8839,8 +9365,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreateExp = ur_loader::urCommandBufferCreateExp;
             pDdiTable->pfnRetainExp = ur_loader::urCommandBufferRetainExp;
@@ -8935,8 +9460,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetContextProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate = ur_loader::urContextCreate;
             pDdiTable->pfnRetain = ur_loader::urContextRetain;
@@ -9001,8 +9525,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnKernelLaunch = ur_loader::urEnqueueKernelLaunch;
             pDdiTable->pfnEventsWait = ur_loader::urEnqueueEventsWait;
@@ -9090,8 +9613,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnKernelLaunchCustomExp =
                 ur_loader::urEnqueueKernelLaunchCustomExp;
@@ -9101,6 +9623,15 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
                 ur_loader::urEnqueueTimestampRecordingExp;
             pDdiTable->pfnNativeCommandExp =
                 ur_loader::urEnqueueNativeCommandExp;
+            pDdiTable->pfnUSMDeviceAllocExp =
+                ur_loader::urEnqueueUSMDeviceAllocExp;
+            pDdiTable->pfnUSMFreeExp = ur_loader::urEnqueueUSMFreeExp;
+            pDdiTable->pfnMemBufferCopyRectBatchExp =
+                ur_loader::urEnqueueMemBufferCopyRectBatchExp;
+            pDdiTable->pfnKernelLaunchBatchExp =
+                ur_loader::urEnqueueKernelLaunchBatchExp;
+            pDdiTable->pfnTimestampMarkerExp =
+                ur_loader::urEnqueueTimestampMarkerExp;
         } else {
             // return pointers directly to platform's DDIs
             *pDdiTable = ur_loader::getContext()
@@ -9156,8 +9687,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetInfo = ur_loader::urEventGetInfo;
             pDdiTable->pfnGetProfilingInfo = ur_loader::urEventGetProfilingInfo;
@@ -9178,6 +9708,65 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EventExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_event_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (ur_loader::getContext()->version < version) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // Load the device-platform DDI tables
+    for (auto &platform : ur_loader::getContext()->platforms) {
+        // statically linked adapter inside of the loader
+        if (platform.handle == nullptr) {
+            continue;
+        }
+
+        if (platform.initStatus != UR_RESULT_SUCCESS) {
+            continue;
+        }
+        auto getTable = reinterpret_cast<ur_pfnGetEventExpProcAddrTable_t>(
+            ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
+                                                 "urGetEventExpProcAddrTable"));
+        if (!getTable) {
+            continue;
+        }
+        platform.initStatus = getTable(version, &platform.dditable.ur.EventExp);
+    }
+
+    if (UR_RESULT_SUCCESS == result) {
+        if (ur_loader::getContext()->intercept_enabled) {
+            // return pointers to loader's DDIs
+            pDdiTable->pfnWaitAnyExp = ur_loader::urEventWaitAnyExp;
+            pDdiTable->pfnGetExecutionStatusExp =
+                ur_loader::urEventGetExecutionStatusExp;
+        } else {
+            // return pointers directly to platform's DDIs
+            *pDdiTable =
+                ur_loader::getContext()->platforms.front().dditable.ur.EventExp;
+        }
+    }
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Kernel table
 ///        with current process' addresses
@@ -9222,8 +9811,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate = ur_loader::urKernelCreate;
             pDdiTable->pfnGetInfo = ur_loader::urKernelGetInfo;
@@ -9299,11 +9887,11 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
                 ur_loader::urKernelSuggestMaxCooperativeGroupCountExp;
+            pDdiTable->pfnSetArgsExp = ur_loader::urKernelSetArgsExp;
         } else {
             // return pointers directly to platform's DDIs
             *pDdiTable = ur_loader::getContext()
@@ -9359,8 +9947,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetMemProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnImageCreate = ur_loader::urMemImageCreate;
             pDdiTable->pfnBufferCreate = ur_loader::urMemBufferCreate;
@@ -9429,8 +10016,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPhysicalMemProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate = ur_loader::urPhysicalMemCreate;
             pDdiTable->pfnRetain = ur_loader::urPhysicalMemRetain;
@@ -9490,8 +10076,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnGet = ur_loader::urPlatformGet;
             pDdiTable->pfnGetInfo = ur_loader::urPlatformGetInfo;
@@ -9556,8 +10141,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreateWithIL = ur_loader::urProgramCreateWithIL;
             pDdiTable->pfnCreateWithBinary =
@@ -9633,8 +10217,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnBuildExp = ur_loader::urProgramBuildExp;
             pDdiTable->pfnCompileExp = ur_loader::urProgramCompileExp;
@@ -9694,8 +10277,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetInfo = ur_loader::urQueueGetInfo;
             pDdiTable->pfnCreate = ur_loader::urQueueCreate;
@@ -9716,6 +10298,66 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's QueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (ur_loader::getContext()->version < version) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // Load the device-platform DDI tables
+    for (auto &platform : ur_loader::getContext()->platforms) {
+        // statically linked adapter inside of the loader
+        if (platform.handle == nullptr) {
+            continue;
+        }
+
+        if (platform.initStatus != UR_RESULT_SUCCESS) {
+            continue;
+        }
+        auto getTable = reinterpret_cast<ur_pfnGetQueueExpProcAddrTable_t>(
+            ur_loader::LibLoader::getFunctionPtr(platform.handle.get(),
+                                                 "urGetQueueExpProcAddrTable"));
+        if (!getTable) {
+            continue;
+        }
+        platform.initStatus = getTable(version, &platform.dditable.ur.QueueExp);
+    }
+
+    if (UR_RESULT_SUCCESS == result) {
+        if (ur_loader::getContext()->intercept_enabled) {
+            // return pointers to loader's DDIs
+            pDdiTable->pfnReserveTimestampMarkersExp =
+                ur_loader::urQueueReserveTimestampMarkersExp;
+            pDdiTable->pfnReadTimestampMarkersExp =
+                ur_loader::urQueueReadTimestampMarkersExp;
+        } else {
+            // return pointers directly to platform's DDIs
+            *pDdiTable =
+                ur_loader::getContext()->platforms.front().dditable.ur.QueueExp;
+        }
+    }
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Sampler table
 ///        with current process' addresses
@@ -9760,8 +10402,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetSamplerProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate = ur_loader::urSamplerCreate;
             pDdiTable->pfnRetain = ur_loader::urSamplerRetain;
@@ -9824,8 +10465,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnHostAlloc = ur_loader::urUSMHostAlloc;
             pDdiTable->pfnDeviceAlloc = ur_loader::urUSMDeviceAlloc;
@@ -9890,12 +10530,12 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnPitchedAllocExp = ur_loader::urUSMPitchedAllocExp;
             pDdiTable->pfnImportExp = ur_loader::urUSMImportExp;
             pDdiTable->pfnReleaseExp = ur_loader::urUSMReleaseExp;
+            pDdiTable->pfnPoolTrimExp = ur_loader::urUSMPoolTrimExp;
         } else {
             // return pointers directly to platform's DDIs
             *pDdiTable =
@@ -9951,8 +10591,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUsmP2PExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnEnablePeerAccessExp =
                 ur_loader::urUsmP2PEnablePeerAccessExp;
@@ -10016,8 +10655,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetVirtualMemProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnGranularityGetInfo =
                 ur_loader::urVirtualMemGranularityGetInfo;
@@ -10082,8 +10720,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetDeviceProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnGet = ur_loader::urDeviceGet;
             pDdiTable->pfnGetInfo = ur_loader::urDeviceGetInfo;
@@ -23,8 +23,10 @@
 #include "ur_lib.hpp"
 #include "ur_loader.hpp"
 
+#include <array>
 #include <cstring> // for std::memcpy
-#include <regex>
+#include <memory>
+#include <numeric>
 #include <stdlib.h>
 
 namespace ur_lib {
@@ -53,6 +55,15 @@ void context_t::initLayers() {
     for (auto &[layer, _] : layers) {
         layer->init(&urDdiTable, enabledLayerNames, codelocData);
     }
+
+#if UR_ENABLE_TRACING
+    // The functions which go through the tracing and then the validation
+    // layer call the fused ones instead, with a single indirect call
+    ur_fused_layer::fuse(&urDdiTable);
+#if UR_ENABLE_SANITIZER
+    ur_fused_layer::fuse(&ur_sanitizer_layer::getContext()->urDdiTable);
+#endif
+#endif
 }
 
 void context_t::tearDownLayers() const {
@@ -75,12 +86,15 @@ __urdlllocal ur_result_t context_t::Init(
     ur_result_t result;
     const char *logger_name = "loader";
     logger::init(logger_name);
-    logger::debug("Logger {} initialized successfully!", logger_name);
+    UR_LOG(DEBUG, "Logger {} initialized successfully!", logger_name);
 
+    auto &startupProfile = ur_loader::getContext()->startupProfile;
     result = ur_loader::getContext()->init();
 
     if (UR_RESULT_SUCCESS == result) {
+        auto start = ur_loader::startup_profile_t::clock::now();
         result = ddiInit();
+        startupProfile.record("ddi init", start);
     }
 
     if (hLoaderConfig) {
@@ -88,8 +102,23 @@ __urdlllocal ur_result_t context_t::Init(
         enabledLayerNames.merge(hLoaderConfig->getEnabledLayerNames());
     }
 
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
     if (!enabledLayerNames.empty()) {
+        UR_LOG(WARN, "The layers are bypassed, the loader was built with "
+                     "UR_STATIC_DISPATCH");
+    }
+#endif
+
+    if (!enabledLayerNames.empty()) {
+        auto start = ur_loader::startup_profile_t::clock::now();
         initLayers();
+        startupProfile.record("layer init", start);
+    }
+
+    // In passthrough mode the adapters' urAdapterGet and urPlatformGet are
+    // called directly, so there is nothing more the loader could time.
+    if (!ur_loader::getContext()->intercept_enabled) {
+        startupProfile.report();
     }
 
     return result;
@@ -208,13 +237,19 @@ ur_result_t UR_APICALL urLoaderInit(ur_device_init_flags_t device_flags,
 ur_result_t urLoaderTearDown() {
     int ret = ur_lib::context_t::release([](context_t *context) {
         context->tearDownLayers();
-        ur_loader::context_t::forceDelete();
+        // report whatever was recorded if platforms were never enumerated
+        ur_loader::getContext()->startupProfile.report();
+        // Unloading the adapters runs their destructors, and the objects
+        // they leave to the OS in fast teardown may still refer to their code
+        if (!fast_teardown_enabled()) {
+            ur_loader::context_t::forceDelete();
+        }
         delete context;
     });
 
     ur_result_t result =
         ret == 0 ? UR_RESULT_SUCCESS : UR_RESULT_ERROR_UNINITIALIZED;
-    logger::info("---> urLoaderTearDown() -> {}", result);
+    UR_LOG(INFO, "---> urLoaderTearDown() -> {}", result);
     return result;
 }
 
@@ -320,10 +355,9 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
     // discard term, for that backend.
     // (If we wished to preserve the ordering of terms, we could replace `std::map`
     // with `std::queue<std::pair<key_type_t, value_type_t>>` or something similar.)
-    auto maybeEnvVarMap = getenv_to_map("ONEAPI_DEVICE_SELECTOR", false);
-    logger::debug(
-        "getenv_to_map parsed env var and {} a map",
-        (maybeEnvVarMap.has_value() ? "produced" : "failed to produce"));
+    auto maybeEnvVarMap = ur_loader::getContext()->deviceSelector.get();
+    UR_LOG(DEBUG, "getenv_to_map parsed env var and {} a map",
+           (maybeEnvVarMap.has_value() ? "produced" : "failed to produce"));
 
     // if the ODS env var is not set at all, then pretend it was set to the default
     using EnvVarMap = std::map<std::string, std::vector<std::string>>;
@@ -341,34 +375,10 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
     //           sub = "*|int"
     //        subsub = "*|int"
 
-    // validation regex for filterString (not used in this code)
-    std::regex validation_pattern(
-        "^("
-        "\\*" // C++ escape for \, regex escape for literal '*'
-        "|"
-        "cpu" // ensure case-insenitive, when using
-        "|"
-        "gpu" // ensure case-insenitive, when using
-        "|"
-        "fpga" // ensure case-insenitive, when using
-        "|"
-        "[[:digit:]]+" // '<num>'
-        "|"
-        "[[:digit:]]+\\.[[:digit:]]+" // '<num>.<num>'
-        "|"
-        "[[:digit:]]+\\.\\*" // '<num>.*.*'
-        "|"
-        "\\*\\.\\*" // C++ and regex escapes, literal '*.*'
-        "|"
-        "[[:digit:]]+\\.[[:digit:]]+\\.[[:digit:]]+" // '<num>.<num>.<num>'
-        "|"
-        "[[:digit:]]+\\.[[:digit:]]+\\.\\*" // '<num>.<num>.*'
-        "|"
-        "[[:digit:]]+\\.\\*\\.\\*" // '<num>.*.*'
-        "|"
-        "\\*\\.\\*\\.\\*" // C++ and regex escapes, literal '*.*.*'
-        ")$",
-        std::regex_constants::icase);
+    // The filterString grammar above is validated piecewise while the terms
+    // are converted below, rather than with a regex: constructing a
+    // std::regex costs milliseconds, which is far more than the rest of this
+    // function.
 
     ur_platform_backend_t platformBackend;
     if (UR_RESULT_SUCCESS !=
@@ -395,7 +405,7 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
                 return "hip";
                 break;
             case UR_PLATFORM_BACKEND_NATIVE_CPU:
-                return "*"; // the only ODS string that matches
+                return "native_cpu";
                 break;
             case UR_PLATFORM_BACKEND_FORCE_UINT32:
                 return ""; // no ODS string matches this
@@ -457,23 +467,22 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
         if (backend.empty()) {
             // FIXME: never true because getenv_to_map rejects this case
             // malformed term: missing backend -- output ERROR, then continue
-            logger::error("ERROR: missing backend, format of filter = "
-                          "'[!]backend:filterStrings'");
+            UR_LOG(ERR, "ERROR: missing backend, format of filter = "
+                        "'[!]backend:filterStrings'");
             continue;
         }
         enum FilterType {
             AcceptFilter,
             DiscardFilter,
         } termType = (backend.front() != '!') ? AcceptFilter : DiscardFilter;
-        logger::debug(
-            "termType is {}",
-            (termType != AcceptFilter ? "DiscardFilter" : "AcceptFilter"));
+        UR_LOG(DEBUG, "termType is {}",
+               (termType != AcceptFilter ? "DiscardFilter" : "AcceptFilter"));
         auto &deviceList =
             (termType != AcceptFilter) ? discardDeviceList : acceptDeviceList;
         if (termType != AcceptFilter) {
-            logger::debug("DEBUG: backend was '{}'", backend);
+            UR_LOG(DEBUG, "DEBUG: backend was '{}'", backend);
             backend.erase(backend.cbegin());
-            logger::debug("DEBUG: backend now '{}'", backend);
+            UR_LOG(DEBUG, "DEBUG: backend now '{}'", backend);
         }
         // Note the hPlatform -> platformBackend -> platformBackendName conversion above
         // guarantees minimal sanity for the comparison with backend from the ODS string
@@ -487,13 +496,13 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
                                    std::tolower(static_cast<unsigned char>(b));
                         })) {
             // irrelevant term for current request: different backend -- silently ignore
-            logger::error("unrecognised backend '{}'", backend);
+            UR_LOG(ERR, "unrecognised backend '{}'", backend);
             return UR_RESULT_ERROR_INVALID_VALUE;
         }
         if (termPair.second.size() == 0) {
             // malformed term: missing filterStrings -- output ERROR
-            logger::error("missing filterStrings, format of filter = "
-                          "'[!]backend:filterStrings'");
+            UR_LOG(ERR, "missing filterStrings, format of filter = "
+                        "'[!]backend:filterStrings'");
             return UR_RESULT_ERROR_INVALID_VALUE;
         }
         if (std::find_if(termPair.second.cbegin(), termPair.second.cend(),
@@ -501,9 +510,8 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
             termPair.second.cend()) {
             // FIXME: never true because getenv_to_map rejects this case
             // malformed term: missing filterString -- output warning, then continue
-            logger::warning(
-                "WARNING: empty filterString, format of filterStrings "
-                "= 'filterString[,filterString[,...]]'");
+            UR_LOG(WARN, "WARNING: empty filterString, format of filterStrings "
+                         "= 'filterString[,filterString[,...]]'");
             continue;
         }
         if (std::find_if(termPair.second.cbegin(), termPair.second.cend(),
@@ -511,8 +519,8 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
                              return std::count(s.cbegin(), s.cend(), '.') > 2;
                          }) != termPair.second.cend()) {
             // malformed term: too many dots in filterString
-            logger::error("too many dots in filterString, format of "
-                          "filterString = 'root[.sub[.subsub]]'");
+            UR_LOG(ERR, "too many dots in filterString, format of "
+                        "filterString = 'root[.sub[.subsub]]'");
             return UR_RESULT_ERROR_INVALID_VALUE;
         }
         if (std::find_if(
@@ -532,11 +540,11 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
                     return false; // no BAD things, so must be okay
                 }) != termPair.second.cend()) {
             // malformed term: star dot no-star in filterString
-            logger::error("invalid wildcard in filterString, '*.' => '*.*'");
+            UR_LOG(ERR, "invalid wildcard in filterString, '*.' => '*.*'");
             return UR_RESULT_ERROR_INVALID_VALUE;
         }
 
-        // TODO -- use regex validation_pattern to catch all other syntax errors in the ODS string
+        // TODO -- catch all other syntax errors in the ODS string
 
         for (auto &filterString : termPair.second) {
             std::string::size_type locationDot1 = filterString.find('.');
@@ -592,10 +600,10 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
                                               DeviceIdTypeALL, 0, 0, nullptr});
     }
 
-    logger::debug("DEBUG: size of acceptDeviceList = {}",
-                  acceptDeviceList.size());
-    logger::debug("DEBUG: size of discardDeviceList = {}",
-                  discardDeviceList.size());
+    UR_LOG(DEBUG, "DEBUG: size of acceptDeviceList = {}",
+           acceptDeviceList.size());
+    UR_LOG(DEBUG, "DEBUG: size of discardDeviceList = {}",
+           discardDeviceList.size());
 
     std::vector<DeviceSpec> rootDevices;
     std::vector<DeviceSpec> subDevices;
@@ -726,47 +734,54 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
             // if this is a subsubdevice filter, then it must be '*.*.*'
             matches = (filter.hwType == device.hwType) ||
                       (filter.hwType == DeviceHardwareType::UR_DEVICE_TYPE_ALL);
-            logger::debug(
-                "DEBUG: In ApplyFilter, if block case 1, matches = {}",
-                matches);
+            UR_LOG(DEBUG,
+                   "DEBUG: In ApplyFilter, if block case 1, matches = {}",
+                   matches);
         } else if (filter.rootId != device.rootId) {
             // root part in filter is a number but does not match the number in the root part of device
             matches = false;
-            logger::debug("DEBUG: In ApplyFilter, if block case 2, matches = ",
-                          matches);
+            UR_LOG(DEBUG,
+                   "DEBUG: In ApplyFilter, if block case 2, matches = {}",
+                   matches);
         } else if (filter.level == DevicePartLevel::ROOT) {
             // this is a root device filter with a number that matches
             matches = true;
-            logger::debug("DEBUG: In ApplyFilter, if block case 3, matches = ",
-                          matches);
+            UR_LOG(DEBUG,
+                   "DEBUG: In ApplyFilter, if block case 3, matches = {}",
+                   matches);
         } else if (filter.subId == DeviceIdTypeALL) {
             // sub type of star always matches (when root part matches, which we already know here)
             // if this is a subdevice filter, then it must be 'matches.*'
             // if this is a subsubdevice filter, then it must be 'matches.*.*'
             matches = true;
-            logger::debug("DEBUG: In ApplyFilter, if block case 4, matches = ",
-                          matches);
+            UR_LOG(DEBUG,
+                   "DEBUG: In ApplyFilter, if block case 4, matches = {}",
+                   matches);
         } else if (filter.subId != device.subId) {
             // sub part in filter is a number but does not match the number in the sub part of device
             matches = false;
-            logger::debug("DEBUG: In ApplyFilter, if block case 5, matches = ",
-                          matches);
+            UR_LOG(DEBUG,
+                   "DEBUG: In ApplyFilter, if block case 5, matches = {}",
+                   matches);
         } else if (filter.level == DevicePartLevel::SUB) {
             // this is a sub device number filter, numbers match in both parts
             matches = true;
-            logger::debug("DEBUG: In ApplyFilter, if block case 6, matches = ",
-                          matches);
+            UR_LOG(DEBUG,
+                   "DEBUG: In ApplyFilter, if block case 6, matches = {}",
+                   matches);
         } else if (filter.subsubId == DeviceIdTypeALL) {
             // subsub type of star always matches (when other parts match, which we already know here)
             // this is a subsub device filter, it must be 'matches.matches.*'
             matches = true;
-            logger::debug("DEBUG: In ApplyFilter, if block case 7, matches = ",
-                          matches);
+            UR_LOG(DEBUG,
+                   "DEBUG: In ApplyFilter, if block case 7, matches = {}",
+                   matches);
         } else {
             // this is a subsub device filter, numbers in all three parts match
             matches = (filter.subsubId == device.subsubId);
-            logger::debug("DEBUG: In ApplyFilter, if block case 8, matches = ",
-                          matches);
+            UR_LOG(DEBUG,
+                   "DEBUG: In ApplyFilter, if block case 8, matches = {}",
+                   matches);
         }
         return matches;
     };
@@ -834,10 +849,10 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
                                 subSubDevices.end());
         }
         if (numAlreadySelected == selectedDevices.size()) {
-            logger::warning("WARNING: an accept term was ignored because it "
-                            "does not select any additional devices"
-                            "selectedDevices.size() = {}",
-                            selectedDevices.size());
+            UR_LOG(WARN, "WARNING: an accept term was ignored because it "
+                         "does not select any additional devices"
+                         "selectedDevices.size() = {}",
+                         selectedDevices.size());
         }
     }
 
@@ -857,4 +872,347 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
 
     return UR_RESULT_SUCCESS;
 }
+
+namespace {
+size_t roundUpToGranularity(size_t size, size_t granularity) {
+    return (size + granularity - 1) / granularity * granularity;
+}
+
+// Maps one new physical memory object over [alloc.size, size) of the range
+ur_result_t growGrowableAlloc(void *pMem, growable_alloc_t &alloc,
+                              size_t size) {
+    size_t chunkSize = size - alloc.size;
+    ur_physical_mem_handle_t hPhysicalMem = nullptr;
+    ur_result_t result = urPhysicalMemCreate(alloc.hContext, alloc.hDevice,
+                                             chunkSize, nullptr, &hPhysicalMem);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    void *pStart = static_cast<char *>(pMem) + alloc.size;
+    result = urVirtualMemMap(alloc.hContext, pStart, chunkSize, hPhysicalMem,
+                             0, UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+    if (result != UR_RESULT_SUCCESS) {
+        urPhysicalMemRelease(hPhysicalMem);
+        return result;
+    }
+    alloc.chunks.emplace_back(hPhysicalMem, chunkSize);
+    alloc.size = size;
+    return UR_RESULT_SUCCESS;
+}
+
+// Unmaps and releases the physical memory objects mapped wholly past size
+ur_result_t shrinkGrowableAlloc(void *pMem, growable_alloc_t &alloc,
+                                size_t size) {
+    while (!alloc.chunks.empty() &&
+           alloc.size - alloc.chunks.back().second >= size) {
+        auto [hPhysicalMem, chunkSize] = alloc.chunks.back();
+        void *pStart = static_cast<char *>(pMem) + alloc.size - chunkSize;
+        ur_result_t result =
+            urVirtualMemUnmap(alloc.hContext, pStart, chunkSize);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+        urPhysicalMemRelease(hPhysicalMem);
+        alloc.chunks.pop_back();
+        alloc.size -= chunkSize;
+    }
+    return UR_RESULT_SUCCESS;
+}
+} // namespace
+
+ur_result_t urUSMGrowableAllocExp(ur_context_handle_t hContext,
+                                  ur_device_handle_t hDevice, size_t maxSize,
+                                  size_t size, void **ppMem) {
+    if (!hContext || !hDevice) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (!ppMem) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (maxSize == 0 || size > maxSize) {
+        return UR_RESULT_ERROR_INVALID_SIZE;
+    }
+
+    // The recommended granularity rather than the minimum one, so that the
+    // device can use its large pages
+    growable_alloc_t alloc = {hContext, hDevice, maxSize, 0, {}};
+    ur_result_t result = urVirtualMemGranularityGetInfo(
+        hContext, hDevice, UR_VIRTUAL_MEM_GRANULARITY_INFO_RECOMMENDED,
+        sizeof(alloc.granularity), &alloc.granularity, nullptr);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+    if (alloc.granularity == 0) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    size_t reservedSize = roundUpToGranularity(maxSize, alloc.granularity);
+
+    void *pMem = nullptr;
+    result = urVirtualMemReserve(hContext, nullptr, reservedSize, &pMem);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+    if (size > 0) {
+        result = growGrowableAlloc(
+            pMem, alloc, roundUpToGranularity(size, alloc.granularity));
+        if (result != UR_RESULT_SUCCESS) {
+            urVirtualMemFree(hContext, pMem, reservedSize);
+            return result;
+        }
+    }
+
+    auto ctx = getContext();
+    std::lock_guard<std::mutex> lock(ctx->growableAllocsMutex);
+    ctx->growableAllocs.emplace(pMem, std::move(alloc));
+    *ppMem = pMem;
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urUSMGrowableResizeExp(ur_context_handle_t hContext, void *pMem,
+                                   size_t size) {
+    if (!hContext) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (!pMem) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    auto ctx = getContext();
+    std::lock_guard<std::mutex> lock(ctx->growableAllocsMutex);
+    auto it = ctx->growableAllocs.find(pMem);
+    if (it == ctx->growableAllocs.end() || it->second.hContext != hContext) {
+        return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    growable_alloc_t &alloc = it->second;
+    if (size > alloc.maxSize) {
+        return UR_RESULT_ERROR_INVALID_SIZE;
+    }
+
+    size = roundUpToGranularity(size, alloc.granularity);
+    if (size > alloc.size) {
+        return growGrowableAlloc(pMem, alloc, size);
+    }
+    return shrinkGrowableAlloc(pMem, alloc, size);
+}
+
+ur_result_t urUSMGrowableFreeExp(ur_context_handle_t hContext, void *pMem) {
+    if (!hContext) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (!pMem) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    auto ctx = getContext();
+    std::lock_guard<std::mutex> lock(ctx->growableAllocsMutex);
+    auto it = ctx->growableAllocs.find(pMem);
+    if (it == ctx->growableAllocs.end() || it->second.hContext != hContext) {
+        return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    growable_alloc_t &alloc = it->second;
+    ur_result_t result = shrinkGrowableAlloc(pMem, alloc, 0);
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+    result = urVirtualMemFree(
+        hContext, pMem, roundUpToGranularity(alloc.maxSize, alloc.granularity));
+    ctx->growableAllocs.erase(it);
+    return result;
+}
+
+namespace {
+// The entries of UR_QUEUE_INFO_COMMAND_COUNTS, one per command class
+using command_counts_t = std::array<uint64_t, 4>;
+
+// The number of commands submitted to the queue of member since it was last
+// found empty
+uint64_t queueGroupLoad(ur_exp_queue_group_handle_t_::member_t &member) {
+    uint64_t count = member.selections;
+    if (member.hasCommandCounts) {
+        command_counts_t counts = {};
+        if (urQueueGetInfo(member.hQueue, UR_QUEUE_INFO_COMMAND_COUNTS,
+                           sizeof(counts), counts.data(),
+                           nullptr) == UR_RESULT_SUCCESS) {
+            count = std::accumulate(counts.begin(), counts.end(), uint64_t{0});
+        } else {
+            // Counting the selections from now on
+            member.hasCommandCounts = false;
+            member.idleCount = 0;
+        }
+    }
+
+    ur_bool_t empty = false;
+    if (urQueueGetInfo(member.hQueue, UR_QUEUE_INFO_EMPTY, sizeof(empty),
+                       &empty, nullptr) == UR_RESULT_SUCCESS &&
+        empty) {
+        member.idleCount = count;
+    }
+    return count - member.idleCount;
+}
+} // namespace
+
+ur_result_t urQueueGroupCreateExp(uint32_t numQueues,
+                                  const ur_queue_handle_t *phQueues,
+                                  ur_exp_queue_group_handle_t *phQueueGroup) {
+    if (!phQueues || !phQueueGroup) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (numQueues == 0) {
+        return UR_RESULT_ERROR_INVALID_SIZE;
+    }
+
+    auto group = std::make_unique<ur_exp_queue_group_handle_t_>();
+    ur_context_handle_t hGroupContext = nullptr;
+    for (uint32_t i = 0; i < numQueues; i++) {
+        if (!phQueues[i]) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+        ur_context_handle_t hContext = nullptr;
+        ur_result_t result =
+            urQueueGetInfo(phQueues[i], UR_QUEUE_INFO_CONTEXT,
+                           sizeof(hContext), &hContext, nullptr);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+        if (i == 0) {
+            hGroupContext = hContext;
+        } else if (hContext != hGroupContext) {
+            return UR_RESULT_ERROR_INVALID_QUEUE;
+        }
+
+        size_t countsSize = 0;
+        bool hasCommandCounts =
+            urQueueGetInfo(phQueues[i], UR_QUEUE_INFO_COMMAND_COUNTS, 0,
+                           nullptr, &countsSize) == UR_RESULT_SUCCESS &&
+            countsSize == sizeof(command_counts_t);
+        group->members.push_back({phQueues[i], hasCommandCounts});
+    }
+
+    for (auto &member : group->members) {
+        urQueueRetain(member.hQueue);
+    }
+    *phQueueGroup = group.release();
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urQueueGroupRetainExp(ur_exp_queue_group_handle_t hQueueGroup) {
+    if (!hQueueGroup) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    hQueueGroup->incrementReferenceCount();
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urQueueGroupReleaseExp(ur_exp_queue_group_handle_t hQueueGroup) {
+    if (!hQueueGroup) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (hQueueGroup->decrementReferenceCount() != 0) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+    for (auto &member : hQueueGroup->members) {
+        ur_result_t releaseResult = urQueueRelease(member.hQueue);
+        if (releaseResult != UR_RESULT_SUCCESS) {
+            result = releaseResult;
+        }
+    }
+    delete hQueueGroup;
+    return result;
+}
+
+ur_result_t urQueueGroupGetQueueExp(ur_exp_queue_group_handle_t hQueueGroup,
+                                    ur_queue_handle_t *phQueue) {
+    if (!hQueueGroup) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (!phQueue) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    std::lock_guard<std::mutex> lock(hQueueGroup->mutex);
+    auto &members = hQueueGroup->members;
+    // Starting at the member after the last one selected, so that the idle
+    // ones take turns
+    size_t best = hQueueGroup->nextMember;
+    uint64_t bestLoad = UINT64_MAX;
+    for (size_t i = 0; i < members.size(); i++) {
+        size_t member = (hQueueGroup->nextMember + i) % members.size();
+        uint64_t load = queueGroupLoad(members[member]);
+        if (load < bestLoad) {
+            best = member;
+            bestLoad = load;
+        }
+        if (load == 0) {
+            break;
+        }
+    }
+
+    hQueueGroup->nextMember = (best + 1) % members.size();
+    members[best].selections++;
+    *phQueue = members[best].hQueue;
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urQueueGroupFinishExp(ur_exp_queue_group_handle_t hQueueGroup) {
+    if (!hQueueGroup) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+    for (auto &member : hQueueGroup->members) {
+        ur_result_t finishResult = urQueueFinish(member.hQueue);
+        if (finishResult != UR_RESULT_SUCCESS) {
+            result = finishResult;
+        }
+    }
+    return result;
+}
+
+ur_result_t urQueueGroupBarrierExp(ur_exp_queue_group_handle_t hQueueGroup,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent) {
+    if (!hQueueGroup) {
+        return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if ((phEventWaitList == nullptr) != (numEventsInWaitList == 0)) {
+        return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+    }
+
+    auto &members = hQueueGroup->members;
+    if (members.size() == 1) {
+        return urEnqueueEventsWaitWithBarrier(members[0].hQueue,
+                                              numEventsInWaitList,
+                                              phEventWaitList, phEvent);
+    }
+
+    // A barrier on each queue for the commands enqueued to it, then on each
+    // queue a barrier waiting for all of them
+    std::vector<ur_event_handle_t> barriers;
+    barriers.reserve(members.size());
+    ur_result_t result = UR_RESULT_SUCCESS;
+    for (auto &member : members) {
+        ur_event_handle_t hEvent = nullptr;
+        result = urEnqueueEventsWaitWithBarrier(
+            member.hQueue, numEventsInWaitList, phEventWaitList, &hEvent);
+        if (result != UR_RESULT_SUCCESS) {
+            break;
+        }
+        barriers.push_back(hEvent);
+    }
+    // The first queue last, so that phEvent is only returned on success
+    for (size_t i = members.size(); result == UR_RESULT_SUCCESS && i-- > 0;) {
+        result = urEnqueueEventsWaitWithBarrier(
+            members[i].hQueue, static_cast<uint32_t>(barriers.size()),
+            barriers.data(), i == 0 ? phEvent : nullptr);
+    }
+
+    for (ur_event_handle_t hEvent : barriers) {
+        urEventRelease(hEvent);
+    }
+    return result;
+}
 } // namespace ur_lib
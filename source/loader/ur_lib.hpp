@@ -22,6 +22,7 @@
 #include "validation/ur_validation_layer.hpp"
 #if UR_ENABLE_TRACING
 #include "tracing/ur_tracing_layer.hpp"
+#include "ur_fused_layer.hpp"
 #endif
 #if UR_ENABLE_SANITIZER
 #include "sanitizer/ur_sanitizer_layer.hpp"
@@ -30,6 +31,7 @@
 #include <atomic>
 #include <mutex>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 struct ur_loader_config_handle_t_ {
@@ -51,7 +53,48 @@ struct ur_loader_config_handle_t_ {
     bool enableMock = false;
 };
 
+struct ur_exp_queue_group_handle_t_ {
+    struct member_t {
+        ur_queue_handle_t hQueue;
+        // Whether the adapter answers UR_QUEUE_INFO_COMMAND_COUNTS for the
+        // queue, otherwise the selections of the queue count its commands
+        bool hasCommandCounts;
+        // The times urQueueGroupGetQueueExp returned the queue
+        uint64_t selections = 0;
+        // The count of the commands of the queue when last found empty
+        uint64_t idleCount = 0;
+    };
+
+    std::vector<member_t> members;
+    std::mutex mutex;
+    // The member the round robin order of urQueueGroupGetQueueExp starts at
+    size_t nextMember = 0;
+    std::atomic_uint32_t refCount = 1;
+
+    uint32_t incrementReferenceCount() {
+        return refCount.fetch_add(1, std::memory_order_acq_rel) + 1;
+    }
+    uint32_t decrementReferenceCount() {
+        return refCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+    }
+};
+
 namespace ur_lib {
+///////////////////////////////////////////////////////////////////////////////
+/// A virtual address range of which the first size bytes are mapped to
+/// physical memory, one physical memory object per resize which grew it
+struct growable_alloc_t {
+    ur_context_handle_t hContext;
+    ur_device_handle_t hDevice;
+    // As requested, the reserved range is rounded up to granularity
+    size_t maxSize;
+    size_t granularity;
+    // The physical memory objects mapped one after the other from the start
+    // of the range, and their sizes
+    std::vector<std::pair<ur_physical_mem_handle_t, size_t>> chunks;
+    size_t size = 0;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 class __urdlllocal context_t : public AtomicSingleton<context_t> {
   public:
@@ -109,6 +152,9 @@ class __urdlllocal context_t : public AtomicSingleton<context_t> {
 
     codeloc_data codelocData;
 
+    std::mutex growableAllocsMutex;
+    std::unordered_map<void *, growable_alloc_t> growableAllocs;
+
     void parseEnvEnabledLayers();
     void initLayers();
     void tearDownLayers() const;
@@ -141,5 +187,25 @@ ur_result_t urDeviceGetSelected(ur_platform_handle_t hPlatform,
                                 uint32_t NumEntries,
                                 ur_device_handle_t *phDevices,
                                 uint32_t *pNumDevices);
+
+ur_result_t urUSMGrowableAllocExp(ur_context_handle_t hContext,
+                                  ur_device_handle_t hDevice, size_t maxSize,
+                                  size_t size, void **ppMem);
+ur_result_t urUSMGrowableResizeExp(ur_context_handle_t hContext, void *pMem,
+                                   size_t size);
+ur_result_t urUSMGrowableFreeExp(ur_context_handle_t hContext, void *pMem);
+
+ur_result_t urQueueGroupCreateExp(uint32_t numQueues,
+                                  const ur_queue_handle_t *phQueues,
+                                  ur_exp_queue_group_handle_t *phQueueGroup);
+ur_result_t urQueueGroupRetainExp(ur_exp_queue_group_handle_t hQueueGroup);
+ur_result_t urQueueGroupReleaseExp(ur_exp_queue_group_handle_t hQueueGroup);
+ur_result_t urQueueGroupGetQueueExp(ur_exp_queue_group_handle_t hQueueGroup,
+                                    ur_queue_handle_t *phQueue);
+ur_result_t urQueueGroupFinishExp(ur_exp_queue_group_handle_t hQueueGroup);
+ur_result_t urQueueGroupBarrierExp(ur_exp_queue_group_handle_t hQueueGroup,
+                                   uint32_t numEventsInWaitList,
+                                   const ur_event_handle_t *phEventWaitList,
+                                   ur_event_handle_t *phEvent);
 } // namespace ur_lib
 #endif /* UR_LOADER_LIB_H */
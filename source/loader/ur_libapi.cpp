@@ -12,6 +12,10 @@
  *
  */
 #include "ur_lib.hpp"
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+// The entry points call the static adapter directly, see UR_STATIC_DISPATCH
+#include "adapters/level_zero/ur_interface_loader.hpp"
+#endif
 
 extern "C" {
 
@@ -306,12 +310,16 @@ ur_result_t UR_APICALL urAdapterGet(
     uint32_t *
         pNumAdapters ///< [out][optional] returns the total number of adapters available.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urAdapterGet(NumEntries, phAdapters, pNumAdapters);
+#else
     auto pfnAdapterGet = ur_lib::getContext()->urDdiTable.Global.pfnAdapterGet;
     if (nullptr == pfnAdapterGet) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnAdapterGet(NumEntries, phAdapters, pNumAdapters);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -335,6 +343,9 @@ ur_result_t UR_APICALL urAdapterGet(
 ur_result_t UR_APICALL urAdapterRelease(
     ur_adapter_handle_t hAdapter ///< [in][release] Adapter handle to release
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urAdapterRelease(hAdapter);
+#else
     auto pfnAdapterRelease =
         ur_lib::getContext()->urDdiTable.Global.pfnAdapterRelease;
     if (nullptr == pfnAdapterRelease) {
@@ -342,6 +353,7 @@ ur_result_t UR_APICALL urAdapterRelease(
     }
 
     return pfnAdapterRelease(hAdapter);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -362,6 +374,9 @@ ur_result_t UR_APICALL urAdapterRelease(
 ur_result_t UR_APICALL urAdapterRetain(
     ur_adapter_handle_t hAdapter ///< [in][retain] Adapter handle to retain
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urAdapterRetain(hAdapter);
+#else
     auto pfnAdapterRetain =
         ur_lib::getContext()->urDdiTable.Global.pfnAdapterRetain;
     if (nullptr == pfnAdapterRetain) {
@@ -369,6 +384,7 @@ ur_result_t UR_APICALL urAdapterRetain(
     }
 
     return pfnAdapterRetain(hAdapter);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -425,6 +441,9 @@ ur_result_t UR_APICALL urAdapterGetLastError(
         pError ///< [out] pointer to an integer where the adapter specific error code will
                ///< be stored.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urAdapterGetLastError(hAdapter, ppMessage, pError);
+#else
     auto pfnAdapterGetLastError =
         ur_lib::getContext()->urDdiTable.Global.pfnAdapterGetLastError;
     if (nullptr == pfnAdapterGetLastError) {
@@ -432,6 +451,7 @@ ur_result_t UR_APICALL urAdapterGetLastError(
     }
 
     return pfnAdapterGetLastError(hAdapter, ppMessage, pError);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -475,6 +495,10 @@ ur_result_t UR_APICALL urAdapterGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual number of bytes being queried by pPropValue.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urAdapterGetInfo(hAdapter, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+#else
     auto pfnAdapterGetInfo =
         ur_lib::getContext()->urDdiTable.Global.pfnAdapterGetInfo;
     if (nullptr == pfnAdapterGetInfo) {
@@ -483,6 +507,7 @@ ur_result_t UR_APICALL urAdapterGetInfo(
 
     return pfnAdapterGetInfo(hAdapter, propName, propSize, pPropValue,
                              pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -525,6 +550,10 @@ ur_result_t UR_APICALL urPlatformGet(
     uint32_t *
         pNumPlatforms ///< [out][optional] returns the total number of platforms available.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urPlatformGet(phAdapters, NumAdapters, NumEntries,
+                                         phPlatforms, pNumPlatforms);
+#else
     auto pfnGet = ur_lib::getContext()->urDdiTable.Platform.pfnGet;
     if (nullptr == pfnGet) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -532,6 +561,7 @@ ur_result_t UR_APICALL urPlatformGet(
 
     return pfnGet(phAdapters, NumAdapters, NumEntries, phPlatforms,
                   pNumPlatforms);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -580,12 +610,17 @@ ur_result_t UR_APICALL urPlatformGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual number of bytes being queried by pPlatformInfo.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urPlatformGetInfo(hPlatform, propName, propSize,
+                                             pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Platform.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hPlatform, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -610,6 +645,9 @@ ur_result_t UR_APICALL urPlatformGetApiVersion(
     ur_platform_handle_t hPlatform, ///< [in] handle of the platform
     ur_api_version_t *pVersion      ///< [out] api version
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urPlatformGetApiVersion(hPlatform, pVersion);
+#else
     auto pfnGetApiVersion =
         ur_lib::getContext()->urDdiTable.Platform.pfnGetApiVersion;
     if (nullptr == pfnGetApiVersion) {
@@ -617,6 +655,7 @@ ur_result_t UR_APICALL urPlatformGetApiVersion(
     }
 
     return pfnGetApiVersion(hPlatform, pVersion);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -649,6 +688,10 @@ ur_result_t UR_APICALL urPlatformGetNativeHandle(
     ur_native_handle_t *
         phNativePlatform ///< [out] a pointer to the native handle of the platform.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urPlatformGetNativeHandle(hPlatform,
+                                                     phNativePlatform);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Platform.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -656,6 +699,7 @@ ur_result_t UR_APICALL urPlatformGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hPlatform, phNativePlatform);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -690,6 +734,12 @@ ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
     ur_platform_handle_t *
         phPlatform ///< [out] pointer to the handle of the platform object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urPlatformCreateWithNativeHandle(hNativePlatform,
+                                                            hAdapter,
+                                                            pProperties,
+                                                            phPlatform);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Platform.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -698,6 +748,7 @@ ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativePlatform, hAdapter, pProperties,
                                      phPlatform);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -735,6 +786,11 @@ ur_result_t UR_APICALL urPlatformGetBackendOption(
         ppPlatformOption ///< [out] returns the correct platform specific compiler option based on
                          ///< the frontend option.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urPlatformGetBackendOption(hPlatform,
+                                                      pFrontendOption,
+                                                      ppPlatformOption);
+#else
     auto pfnGetBackendOption =
         ur_lib::getContext()->urDdiTable.Platform.pfnGetBackendOption;
     if (nullptr == pfnGetBackendOption) {
@@ -742,6 +798,7 @@ ur_result_t UR_APICALL urPlatformGetBackendOption(
     }
 
     return pfnGetBackendOption(hPlatform, pFrontendOption, ppPlatformOption);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -793,12 +850,17 @@ ur_result_t UR_APICALL urDeviceGet(
     uint32_t *pNumDevices ///< [out][optional] pointer to the number of devices.
     ///< pNumDevices will be updated with the total number of devices available.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urDeviceGet(hPlatform, DeviceType, NumEntries,
+                                       phDevices, pNumDevices);
+#else
     auto pfnGet = ur_lib::getContext()->urDdiTable.Device.pfnGet;
     if (nullptr == pfnGet) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGet(hPlatform, DeviceType, NumEntries, phDevices, pNumDevices);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -894,12 +956,17 @@ ur_result_t UR_APICALL urDeviceGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urDeviceGetInfo(hDevice, propName, propSize,
+                                           pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Device.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hDevice, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -934,12 +1001,16 @@ ur_result_t UR_APICALL urDeviceRetain(
     ur_device_handle_t
         hDevice ///< [in][retain] handle of the device to get a reference of.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urDeviceRetain(hDevice);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Device.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -971,12 +1042,16 @@ ur_result_t UR_APICALL urDeviceRelease(
     ur_device_handle_t
         hDevice ///< [in][release] handle of the device to release.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urDeviceRelease(hDevice);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Device.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1022,6 +1097,10 @@ ur_result_t UR_APICALL urDevicePartition(
         pNumDevicesRet ///< [out][optional] pointer to the number of sub-devices the device can be
     ///< partitioned into according to the partitioning property.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urDevicePartition(hDevice, pProperties, NumDevices,
+                                             phSubDevices, pNumDevicesRet);
+#else
     auto pfnPartition = ur_lib::getContext()->urDdiTable.Device.pfnPartition;
     if (nullptr == pfnPartition) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -1029,6 +1108,7 @@ ur_result_t UR_APICALL urDevicePartition(
 
     return pfnPartition(hDevice, pProperties, NumDevices, phSubDevices,
                         pNumDevicesRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1071,6 +1151,10 @@ ur_result_t UR_APICALL urDeviceSelectBinary(
         pSelectedBinary ///< [out] the index of the selected binary in the input array of binaries.
     ///< If a suitable binary was not found the function returns ::UR_RESULT_ERROR_INVALID_BINARY.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urDeviceSelectBinary(hDevice, pBinaries, NumBinaries,
+                                                pSelectedBinary);
+#else
     auto pfnSelectBinary =
         ur_lib::getContext()->urDdiTable.Device.pfnSelectBinary;
     if (nullptr == pfnSelectBinary) {
@@ -1078,6 +1162,7 @@ ur_result_t UR_APICALL urDeviceSelectBinary(
     }
 
     return pfnSelectBinary(hDevice, pBinaries, NumBinaries, pSelectedBinary);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1110,6 +1195,9 @@ ur_result_t UR_APICALL urDeviceGetNativeHandle(
     ur_native_handle_t
         *phNativeDevice ///< [out] a pointer to the native handle of the device.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urDeviceGetNativeHandle(hDevice, phNativeDevice);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Device.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -1117,6 +1205,7 @@ ur_result_t UR_APICALL urDeviceGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hDevice, phNativeDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1151,6 +1240,11 @@ ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
     ur_device_handle_t
         *phDevice ///< [out] pointer to the handle of the device object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urDeviceCreateWithNativeHandle(hNativeDevice,
+                                                          hAdapter, pProperties,
+                                                          phDevice);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Device.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -1159,6 +1253,7 @@ ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeDevice, hAdapter, pProperties,
                                      phDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1191,6 +1286,11 @@ ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
         pHostTimestamp ///< [out][optional] pointer to the Host's global timestamp that
                        ///< correlates with the Device's global timestamp value
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urDeviceGetGlobalTimestamps(hDevice,
+                                                       pDeviceTimestamp,
+                                                       pHostTimestamp);
+#else
     auto pfnGetGlobalTimestamps =
         ur_lib::getContext()->urDdiTable.Device.pfnGetGlobalTimestamps;
     if (nullptr == pfnGetGlobalTimestamps) {
@@ -1198,6 +1298,7 @@ ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     }
 
     return pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp, pHostTimestamp);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1241,12 +1342,17 @@ ur_result_t UR_APICALL urContextCreate(
     ur_context_handle_t
         *phContext ///< [out] pointer to handle of context object created
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urContextCreate(DeviceCount, phDevices, pProperties,
+                                           phContext);
+#else
     auto pfnCreate = ur_lib::getContext()->urDdiTable.Context.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCreate(DeviceCount, phDevices, pProperties, phContext);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1277,12 +1383,16 @@ ur_result_t UR_APICALL urContextRetain(
     ur_context_handle_t
         hContext ///< [in][retain] handle of the context to get a reference of.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urContextRetain(hContext);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Context.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hContext);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1310,12 +1420,16 @@ ur_result_t UR_APICALL urContextRelease(
     ur_context_handle_t
         hContext ///< [in][release] handle of the context to release.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urContextRelease(hContext);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Context.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hContext);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1366,12 +1480,17 @@ ur_result_t UR_APICALL urContextGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urContextGetInfo(hContext, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Context.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hContext, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1404,6 +1523,9 @@ ur_result_t UR_APICALL urContextGetNativeHandle(
     ur_native_handle_t *
         phNativeContext ///< [out] a pointer to the native handle of the context.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urContextGetNativeHandle(hContext, phNativeContext);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Context.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -1411,6 +1533,7 @@ ur_result_t UR_APICALL urContextGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hContext, phNativeContext);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1449,6 +1572,13 @@ ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     ur_context_handle_t *
         phContext ///< [out] pointer to the handle of the context object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urContextCreateWithNativeHandle(hNativeContext,
+                                                           hAdapter, numDevices,
+                                                           phDevices,
+                                                           pProperties,
+                                                           phContext);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Context.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -1457,6 +1587,7 @@ ur_result_t UR_APICALL urContextCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeContext, hAdapter, numDevices,
                                      phDevices, pProperties, phContext);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1490,6 +1621,10 @@ ur_result_t UR_APICALL urContextSetExtendedDeleter(
     void *
         pUserData ///< [in][out][optional] pointer to data to be passed to callback.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urContextSetExtendedDeleter(hContext, pfnDeleter,
+                                                       pUserData);
+#else
     auto pfnSetExtendedDeleter =
         ur_lib::getContext()->urDdiTable.Context.pfnSetExtendedDeleter;
     if (nullptr == pfnSetExtendedDeleter) {
@@ -1497,6 +1632,7 @@ ur_result_t UR_APICALL urContextSetExtendedDeleter(
     }
 
     return pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1562,6 +1698,10 @@ ur_result_t UR_APICALL urMemImageCreate(
     void *pHost,           ///< [in][optional] pointer to the buffer data
     ur_mem_handle_t *phMem ///< [out] pointer to handle of image object created
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urMemImageCreate(hContext, flags, pImageFormat,
+                                            pImageDesc, pHost, phMem);
+#else
     auto pfnImageCreate = ur_lib::getContext()->urDdiTable.Mem.pfnImageCreate;
     if (nullptr == pfnImageCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -1569,6 +1709,7 @@ ur_result_t UR_APICALL urMemImageCreate(
 
     return pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost,
                           phMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1614,12 +1755,17 @@ ur_result_t UR_APICALL urMemBufferCreate(
     ur_mem_handle_t
         *phBuffer ///< [out] pointer to handle of the memory buffer created
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urMemBufferCreate(hContext, flags, size, pProperties,
+                                             phBuffer);
+#else
     auto pfnBufferCreate = ur_lib::getContext()->urDdiTable.Mem.pfnBufferCreate;
     if (nullptr == pfnBufferCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1650,12 +1796,16 @@ ur_result_t UR_APICALL urMemRetain(
     ur_mem_handle_t
         hMem ///< [in][retain] handle of the memory object to get access
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urMemRetain(hMem);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Mem.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1681,12 +1831,16 @@ ur_result_t UR_APICALL urMemRelease(
     ur_mem_handle_t
         hMem ///< [in][release] handle of the memory object to release
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urMemRelease(hMem);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Mem.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1730,6 +1884,11 @@ ur_result_t UR_APICALL urMemBufferPartition(
     ur_mem_handle_t
         *phMem ///< [out] pointer to the handle of sub buffer created
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urMemBufferPartition(hBuffer, flags,
+                                                bufferCreateType, pRegion,
+                                                phMem);
+#else
     auto pfnBufferPartition =
         ur_lib::getContext()->urDdiTable.Mem.pfnBufferPartition;
     if (nullptr == pfnBufferPartition) {
@@ -1737,6 +1896,7 @@ ur_result_t UR_APICALL urMemBufferPartition(
     }
 
     return pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion, phMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1775,6 +1935,9 @@ ur_result_t UR_APICALL urMemGetNativeHandle(
     ur_native_handle_t
         *phNativeMem ///< [out] a pointer to the native handle of the mem.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urMemGetNativeHandle(hMem, hDevice, phNativeMem);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Mem.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -1782,6 +1945,7 @@ ur_result_t UR_APICALL urMemGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hMem, hDevice, phNativeMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1814,6 +1978,12 @@ ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
     ur_mem_handle_t
         *phMem ///< [out] pointer to handle of buffer memory object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urMemBufferCreateWithNativeHandle(hNativeMem,
+                                                             hContext,
+                                                             pProperties,
+                                                             phMem);
+#else
     auto pfnBufferCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Mem.pfnBufferCreateWithNativeHandle;
     if (nullptr == pfnBufferCreateWithNativeHandle) {
@@ -1822,6 +1992,7 @@ ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
 
     return pfnBufferCreateWithNativeHandle(hNativeMem, hContext, pProperties,
                                            phMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1859,6 +2030,13 @@ ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
     ur_mem_handle_t
         *phMem ///< [out] pointer to handle of image memory object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urMemImageCreateWithNativeHandle(hNativeMem,
+                                                            hContext,
+                                                            pImageFormat,
+                                                            pImageDesc,
+                                                            pProperties, phMem);
+#else
     auto pfnImageCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Mem.pfnImageCreateWithNativeHandle;
     if (nullptr == pfnImageCreateWithNativeHandle) {
@@ -1867,6 +2045,7 @@ ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
 
     return pfnImageCreateWithNativeHandle(hNativeMem, hContext, pImageFormat,
                                           pImageDesc, pProperties, phMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1916,12 +2095,17 @@ ur_result_t UR_APICALL urMemGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urMemGetInfo(hMemory, propName, propSize, pPropValue,
+                                        pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Mem.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hMemory, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1970,6 +2154,10 @@ ur_result_t UR_APICALL urMemImageGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urMemImageGetInfo(hMemory, propName, propSize,
+                                             pPropValue, pPropSizeRet);
+#else
     auto pfnImageGetInfo = ur_lib::getContext()->urDdiTable.Mem.pfnImageGetInfo;
     if (nullptr == pfnImageGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -1977,6 +2165,7 @@ ur_result_t UR_APICALL urMemImageGetInfo(
 
     return pfnImageGetInfo(hMemory, propName, propSize, pPropValue,
                            pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2018,12 +2207,16 @@ ur_result_t UR_APICALL urSamplerCreate(
     ur_sampler_handle_t
         *phSampler ///< [out] pointer to handle of sampler object created
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urSamplerCreate(hContext, pDesc, phSampler);
+#else
     auto pfnCreate = ur_lib::getContext()->urDdiTable.Sampler.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCreate(hContext, pDesc, phSampler);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2050,12 +2243,16 @@ ur_result_t UR_APICALL urSamplerRetain(
     ur_sampler_handle_t
         hSampler ///< [in][retain] handle of the sampler object to get access
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urSamplerRetain(hSampler);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Sampler.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hSampler);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2082,12 +2279,16 @@ ur_result_t UR_APICALL urSamplerRelease(
     ur_sampler_handle_t
         hSampler ///< [in][release] handle of the sampler object to release
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urSamplerRelease(hSampler);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Sampler.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hSampler);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2130,12 +2331,17 @@ ur_result_t UR_APICALL urSamplerGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] size in bytes returned in sampler property value
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urSamplerGetInfo(hSampler, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Sampler.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hSampler, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2168,6 +2374,9 @@ ur_result_t UR_APICALL urSamplerGetNativeHandle(
     ur_native_handle_t *
         phNativeSampler ///< [out] a pointer to the native handle of the sampler.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urSamplerGetNativeHandle(hSampler, phNativeSampler);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Sampler.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -2175,6 +2384,7 @@ ur_result_t UR_APICALL urSamplerGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hSampler, phNativeSampler);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2208,6 +2418,12 @@ ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
     ur_sampler_handle_t *
         phSampler ///< [out] pointer to the handle of the sampler object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urSamplerCreateWithNativeHandle(hNativeSampler,
+                                                           hContext,
+                                                           pProperties,
+                                                           phSampler);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Sampler.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -2216,6 +2432,7 @@ ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeSampler, hContext, pProperties,
                                      phSampler);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2267,12 +2484,17 @@ ur_result_t UR_APICALL urUSMHostAlloc(
         size, ///< [in] minimum size in bytes of the USM memory object to be allocated
     void **ppMem ///< [out] pointer to USM host memory object
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMHostAlloc(hContext, pUSMDesc, pool, size,
+                                          ppMem);
+#else
     auto pfnHostAlloc = ur_lib::getContext()->urDdiTable.USM.pfnHostAlloc;
     if (nullptr == pfnHostAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2326,12 +2548,17 @@ ur_result_t UR_APICALL urUSMDeviceAlloc(
         size, ///< [in] minimum size in bytes of the USM memory object to be allocated
     void **ppMem ///< [out] pointer to USM device memory object
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMDeviceAlloc(hContext, hDevice, pUSMDesc, pool,
+                                            size, ppMem);
+#else
     auto pfnDeviceAlloc = ur_lib::getContext()->urDdiTable.USM.pfnDeviceAlloc;
     if (nullptr == pfnDeviceAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2386,12 +2613,17 @@ ur_result_t UR_APICALL urUSMSharedAlloc(
         size, ///< [in] minimum size in bytes of the USM memory object to be allocated
     void **ppMem ///< [out] pointer to USM shared memory object
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMSharedAlloc(hContext, hDevice, pUSMDesc, pool,
+                                            size, ppMem);
+#else
     auto pfnSharedAlloc = ur_lib::getContext()->urDdiTable.USM.pfnSharedAlloc;
     if (nullptr == pfnSharedAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2414,12 +2646,16 @@ ur_result_t UR_APICALL urUSMFree(
     ur_context_handle_t hContext, ///< [in] handle of the context object
     void *pMem                    ///< [in] pointer to USM memory object
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMFree(hContext, pMem);
+#else
     auto pfnFree = ur_lib::getContext()->urDdiTable.USM.pfnFree;
     if (nullptr == pfnFree) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnFree(hContext, pMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2455,6 +2691,11 @@ ur_result_t UR_APICALL urUSMGetMemAllocInfo(
     size_t *
         pPropSizeRet ///< [out][optional] bytes returned in USM allocation property
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMGetMemAllocInfo(hContext, pMem, propName,
+                                                propSize, pPropValue,
+                                                pPropSizeRet);
+#else
     auto pfnGetMemAllocInfo =
         ur_lib::getContext()->urDdiTable.USM.pfnGetMemAllocInfo;
     if (nullptr == pfnGetMemAllocInfo) {
@@ -2463,6 +2704,7 @@ ur_result_t UR_APICALL urUSMGetMemAllocInfo(
 
     return pfnGetMemAllocInfo(hContext, pMem, propName, propSize, pPropValue,
                               pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2496,12 +2738,16 @@ ur_result_t UR_APICALL urUSMPoolCreate(
                    ///< ::ur_usm_pool_limits_desc_t
     ur_usm_pool_handle_t *ppPool ///< [out] pointer to USM memory pool
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMPoolCreate(hContext, pPoolDesc, ppPool);
+#else
     auto pfnPoolCreate = ur_lib::getContext()->urDdiTable.USM.pfnPoolCreate;
     if (nullptr == pfnPoolCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnPoolCreate(hContext, pPoolDesc, ppPool);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2519,12 +2765,16 @@ ur_result_t UR_APICALL urUSMPoolCreate(
 ur_result_t UR_APICALL urUSMPoolRetain(
     ur_usm_pool_handle_t pPool ///< [in][retain] pointer to USM memory pool
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMPoolRetain(pPool);
+#else
     auto pfnPoolRetain = ur_lib::getContext()->urDdiTable.USM.pfnPoolRetain;
     if (nullptr == pfnPoolRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnPoolRetain(pPool);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2549,12 +2799,16 @@ ur_result_t UR_APICALL urUSMPoolRetain(
 ur_result_t UR_APICALL urUSMPoolRelease(
     ur_usm_pool_handle_t pPool ///< [in][release] pointer to USM memory pool
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMPoolRelease(pPool);
+#else
     auto pfnPoolRelease = ur_lib::getContext()->urDdiTable.USM.pfnPoolRelease;
     if (nullptr == pfnPoolRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnPoolRelease(pPool);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2570,7 +2824,7 @@ ur_result_t UR_APICALL urUSMPoolRelease(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hPool`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_USM_POOL_INFO_CONTEXT < propName`
+///         + `::UR_USM_POOL_INFO_FRAGMENTATION < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -2591,12 +2845,17 @@ ur_result_t UR_APICALL urUSMPoolGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] size in bytes returned in pool property value
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMPoolGetInfo(hPool, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+#else
     auto pfnPoolGetInfo = ur_lib::getContext()->urDdiTable.USM.pfnPoolGetInfo;
     if (nullptr == pfnPoolGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnPoolGetInfo(hPool, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2643,6 +2902,12 @@ ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName."
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urVirtualMemGranularityGetInfo(hContext, hDevice,
+                                                          propName, propSize,
+                                                          pPropValue,
+                                                          pPropSizeRet);
+#else
     auto pfnGranularityGetInfo =
         ur_lib::getContext()->urDdiTable.VirtualMem.pfnGranularityGetInfo;
     if (nullptr == pfnGranularityGetInfo) {
@@ -2651,6 +2916,7 @@ ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
 
     return pfnGranularityGetInfo(hContext, hDevice, propName, propSize,
                                  pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2679,12 +2945,16 @@ ur_result_t UR_APICALL urVirtualMemReserve(
         ppStart ///< [out] pointer to the returned address at the start of reserved virtual
                 ///< memory range.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urVirtualMemReserve(hContext, pStart, size, ppStart);
+#else
     auto pfnReserve = ur_lib::getContext()->urDdiTable.VirtualMem.pfnReserve;
     if (nullptr == pfnReserve) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnReserve(hContext, pStart, size, ppStart);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2707,12 +2977,16 @@ ur_result_t UR_APICALL urVirtualMemFree(
         pStart, ///< [in] pointer to the start of the virtual memory range to free.
     size_t size ///< [in] size in bytes of the virtual memory range to free.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urVirtualMemFree(hContext, pStart, size);
+#else
     auto pfnFree = ur_lib::getContext()->urDdiTable.VirtualMem.pfnFree;
     if (nullptr == pfnFree) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnFree(hContext, pStart, size);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2744,12 +3018,17 @@ ur_result_t UR_APICALL urVirtualMemMap(
     ur_virtual_mem_access_flags_t
         flags ///< [in] access flags for the physical memory mapping.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urVirtualMemMap(hContext, pStart, size, hPhysicalMem,
+                                           offset, flags);
+#else
     auto pfnMap = ur_lib::getContext()->urDdiTable.VirtualMem.pfnMap;
     if (nullptr == pfnMap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnMap(hContext, pStart, size, hPhysicalMem, offset, flags);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2776,12 +3055,16 @@ ur_result_t UR_APICALL urVirtualMemUnmap(
         pStart, ///< [in] pointer to the start of the mapped virtual memory range
     size_t size ///< [in] size in bytes of the virtual memory range.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urVirtualMemUnmap(hContext, pStart, size);
+#else
     auto pfnUnmap = ur_lib::getContext()->urDdiTable.VirtualMem.pfnUnmap;
     if (nullptr == pfnUnmap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnUnmap(hContext, pStart, size);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2808,6 +3091,9 @@ ur_result_t UR_APICALL urVirtualMemSetAccess(
     ur_virtual_mem_access_flags_t
         flags ///< [in] access flags to set for the mapped virtual memory range.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urVirtualMemSetAccess(hContext, pStart, size, flags);
+#else
     auto pfnSetAccess =
         ur_lib::getContext()->urDdiTable.VirtualMem.pfnSetAccess;
     if (nullptr == pfnSetAccess) {
@@ -2815,6 +3101,7 @@ ur_result_t UR_APICALL urVirtualMemSetAccess(
     }
 
     return pfnSetAccess(hContext, pStart, size, flags);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2849,6 +3136,11 @@ ur_result_t UR_APICALL urVirtualMemGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName."
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urVirtualMemGetInfo(hContext, pStart, size, propName,
+                                               propSize, pPropValue,
+                                               pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.VirtualMem.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -2856,6 +3148,7 @@ ur_result_t UR_APICALL urVirtualMemGetInfo(
 
     return pfnGetInfo(hContext, pStart, size, propName, propSize, pPropValue,
                       pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2888,12 +3181,17 @@ ur_result_t UR_APICALL urPhysicalMemCreate(
     ur_physical_mem_handle_t *
         phPhysicalMem ///< [out] pointer to handle of physical memory object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urPhysicalMemCreate(hContext, hDevice, size,
+                                               pProperties, phPhysicalMem);
+#else
     auto pfnCreate = ur_lib::getContext()->urDdiTable.PhysicalMem.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCreate(hContext, hDevice, size, pProperties, phPhysicalMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2912,12 +3210,16 @@ ur_result_t UR_APICALL urPhysicalMemRetain(
     ur_physical_mem_handle_t
         hPhysicalMem ///< [in][retain] handle of the physical memory object to retain.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urPhysicalMemRetain(hPhysicalMem);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.PhysicalMem.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hPhysicalMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2936,12 +3238,16 @@ ur_result_t UR_APICALL urPhysicalMemRelease(
     ur_physical_mem_handle_t
         hPhysicalMem ///< [in][release] handle of the physical memory object to release.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urPhysicalMemRelease(hPhysicalMem);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.PhysicalMem.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hPhysicalMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2953,6 +3259,8 @@ ur_result_t UR_APICALL urPhysicalMemRelease(
 ///     - The application may call this function from simultaneous threads.
 ///     - The adapter may (but is not required to) perform validation of the
 ///       provided module during this call.
+///     - The memory pointed to by `pIL` must remain valid until the program is
+///       released, the adapter may use it without copying it.
 ///
 /// @remarks
 ///   _Analogues_
@@ -2985,6 +3293,10 @@ ur_result_t UR_APICALL urProgramCreateWithIL(
     ur_program_handle_t
         *phProgram ///< [out] pointer to handle of program object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramCreateWithIL(hContext, pIL, length,
+                                                 pProperties, phProgram);
+#else
     auto pfnCreateWithIL =
         ur_lib::getContext()->urDdiTable.Program.pfnCreateWithIL;
     if (nullptr == pfnCreateWithIL) {
@@ -2992,6 +3304,7 @@ ur_result_t UR_APICALL urProgramCreateWithIL(
     }
 
     return pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3008,6 +3321,8 @@ ur_result_t UR_APICALL urProgramCreateWithIL(
 ///       context.
 ///     - The adapter may (but is not required to) perform validation of the
 ///       provided module during this call.
+///     - The memory pointed to by `pBinary` must remain valid until the program
+///       is released, the adapter may use it without copying it.
 ///
 /// @remarks
 ///   _Analogues_
@@ -3040,6 +3355,11 @@ ur_result_t UR_APICALL urProgramCreateWithBinary(
     ur_program_handle_t
         *phProgram ///< [out] pointer to handle of Program object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramCreateWithBinary(hContext, hDevice, size,
+                                                     pBinary, pProperties,
+                                                     phProgram);
+#else
     auto pfnCreateWithBinary =
         ur_lib::getContext()->urDdiTable.Program.pfnCreateWithBinary;
     if (nullptr == pfnCreateWithBinary) {
@@ -3048,6 +3368,7 @@ ur_result_t UR_APICALL urProgramCreateWithBinary(
 
     return pfnCreateWithBinary(hContext, hDevice, size, pBinary, pProperties,
                                phProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3084,12 +3405,16 @@ ur_result_t UR_APICALL urProgramBuild(
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramBuild(hContext, hProgram, pOptions);
+#else
     auto pfnBuild = ur_lib::getContext()->urDdiTable.Program.pfnBuild;
     if (nullptr == pfnBuild) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnBuild(hContext, hProgram, pOptions);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3126,12 +3451,16 @@ ur_result_t UR_APICALL urProgramCompile(
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramCompile(hContext, hProgram, pOptions);
+#else
     auto pfnCompile = ur_lib::getContext()->urDdiTable.Program.pfnCompile;
     if (nullptr == pfnCompile) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCompile(hContext, hProgram, pOptions);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3184,12 +3513,17 @@ ur_result_t UR_APICALL urProgramLink(
     if (nullptr != phProgram) {
         *phProgram = nullptr;
     }
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramLink(hContext, count, phPrograms, pOptions,
+                                         phProgram);
+#else
     auto pfnLink = ur_lib::getContext()->urDdiTable.Program.pfnLink;
     if (nullptr == pfnLink) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnLink(hContext, count, phPrograms, pOptions, phProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3218,12 +3552,16 @@ ur_result_t UR_APICALL urProgramRetain(
     ur_program_handle_t
         hProgram ///< [in][retain] handle for the Program to retain
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramRetain(hProgram);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Program.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3252,12 +3590,16 @@ ur_result_t UR_APICALL urProgramRelease(
     ur_program_handle_t
         hProgram ///< [in][release] handle for the Program to release
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramRelease(hProgram);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Program.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3305,6 +3647,11 @@ ur_result_t UR_APICALL urProgramGetFunctionPointer(
     void **
         ppFunctionPointer ///< [out] Returns the pointer to the function if it is found in the program.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramGetFunctionPointer(hDevice, hProgram,
+                                                       pFunctionName,
+                                                       ppFunctionPointer);
+#else
     auto pfnGetFunctionPointer =
         ur_lib::getContext()->urDdiTable.Program.pfnGetFunctionPointer;
     if (nullptr == pfnGetFunctionPointer) {
@@ -3313,6 +3660,7 @@ ur_result_t UR_APICALL urProgramGetFunctionPointer(
 
     return pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
                                  ppFunctionPointer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3356,6 +3704,11 @@ ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
     void **
         ppGlobalVariablePointerRet ///< [out] Returns the pointer to the global variable if it is found in the program.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramGetGlobalVariablePointer(
+        hDevice, hProgram, pGlobalVariableName, pGlobalVariableSizeRet,
+        ppGlobalVariablePointerRet);
+#else
     auto pfnGetGlobalVariablePointer =
         ur_lib::getContext()->urDdiTable.Program.pfnGetGlobalVariablePointer;
     if (nullptr == pfnGetGlobalVariablePointer) {
@@ -3365,6 +3718,7 @@ ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
     return pfnGetGlobalVariablePointer(hDevice, hProgram, pGlobalVariableName,
                                        pGlobalVariableSizeRet,
                                        ppGlobalVariablePointerRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3410,12 +3764,17 @@ ur_result_t UR_APICALL urProgramGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramGetInfo(hProgram, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Program.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hProgram, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3453,6 +3812,11 @@ ur_result_t UR_APICALL urProgramGetBuildInfo(
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramGetBuildInfo(hProgram, hDevice, propName,
+                                                 propSize, pPropValue,
+                                                 pPropSizeRet);
+#else
     auto pfnGetBuildInfo =
         ur_lib::getContext()->urDdiTable.Program.pfnGetBuildInfo;
     if (nullptr == pfnGetBuildInfo) {
@@ -3461,6 +3825,7 @@ ur_result_t UR_APICALL urProgramGetBuildInfo(
 
     return pfnGetBuildInfo(hProgram, hDevice, propName, propSize, pPropValue,
                            pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3495,6 +3860,10 @@ ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         pSpecConstants ///< [in][range(0, count)] array of specialization constant value
                        ///< descriptions
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramSetSpecializationConstants(hProgram, count,
+                                                               pSpecConstants);
+#else
     auto pfnSetSpecializationConstants =
         ur_lib::getContext()->urDdiTable.Program.pfnSetSpecializationConstants;
     if (nullptr == pfnSetSpecializationConstants) {
@@ -3502,6 +3871,7 @@ ur_result_t UR_APICALL urProgramSetSpecializationConstants(
     }
 
     return pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3534,6 +3904,9 @@ ur_result_t UR_APICALL urProgramGetNativeHandle(
     ur_native_handle_t *
         phNativeProgram ///< [out] a pointer to the native handle of the program.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramGetNativeHandle(hProgram, phNativeProgram);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Program.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -3541,6 +3914,7 @@ ur_result_t UR_APICALL urProgramGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hProgram, phNativeProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3574,6 +3948,12 @@ ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
     ur_program_handle_t *
         phProgram ///< [out] pointer to the handle of the program object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramCreateWithNativeHandle(hNativeProgram,
+                                                           hContext,
+                                                           pProperties,
+                                                           phProgram);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Program.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -3582,6 +3962,7 @@ ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeProgram, hContext, pProperties,
                                      phProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3611,12 +3992,16 @@ ur_result_t UR_APICALL urKernelCreate(
     ur_kernel_handle_t
         *phKernel ///< [out] pointer to handle of kernel object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelCreate(hProgram, pKernelName, phKernel);
+#else
     auto pfnCreate = ur_lib::getContext()->urDdiTable.Kernel.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCreate(hProgram, pKernelName, phKernel);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3650,6 +4035,10 @@ ur_result_t UR_APICALL urKernelSetArgValue(
         *pArgValue ///< [in] argument value represented as matching arg type.
     ///< The data pointed to will be copied and therefore can be reused on return.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelSetArgValue(hKernel, argIndex, argSize,
+                                               pProperties, pArgValue);
+#else
     auto pfnSetArgValue =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetArgValue;
     if (nullptr == pfnSetArgValue) {
@@ -3657,6 +4046,7 @@ ur_result_t UR_APICALL urKernelSetArgValue(
     }
 
     return pfnSetArgValue(hKernel, argIndex, argSize, pProperties, pArgValue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3686,6 +4076,10 @@ ur_result_t UR_APICALL urKernelSetArgLocal(
     const ur_kernel_arg_local_properties_t
         *pProperties ///< [in][optional] pointer to local buffer properties.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelSetArgLocal(hKernel, argIndex, argSize,
+                                               pProperties);
+#else
     auto pfnSetArgLocal =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetArgLocal;
     if (nullptr == pfnSetArgLocal) {
@@ -3693,6 +4087,7 @@ ur_result_t UR_APICALL urKernelSetArgLocal(
     }
 
     return pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3739,12 +4134,17 @@ ur_result_t UR_APICALL urKernelGetInfo(
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelGetInfo(hKernel, propName, propSize,
+                                           pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Kernel.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hKernel, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3779,6 +4179,11 @@ ur_result_t UR_APICALL urKernelGetGroupInfo(
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelGetGroupInfo(hKernel, hDevice, propName,
+                                                propSize, pPropValue,
+                                                pPropSizeRet);
+#else
     auto pfnGetGroupInfo =
         ur_lib::getContext()->urDdiTable.Kernel.pfnGetGroupInfo;
     if (nullptr == pfnGetGroupInfo) {
@@ -3787,6 +4192,7 @@ ur_result_t UR_APICALL urKernelGetGroupInfo(
 
     return pfnGetGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
                            pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3817,6 +4223,11 @@ ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelGetSubGroupInfo(hKernel, hDevice, propName,
+                                                   propSize, pPropValue,
+                                                   pPropSizeRet);
+#else
     auto pfnGetSubGroupInfo =
         ur_lib::getContext()->urDdiTable.Kernel.pfnGetSubGroupInfo;
     if (nullptr == pfnGetSubGroupInfo) {
@@ -3825,6 +4236,7 @@ ur_result_t UR_APICALL urKernelGetSubGroupInfo(
 
     return pfnGetSubGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
                               pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3852,12 +4264,16 @@ ur_result_t UR_APICALL urKernelGetSubGroupInfo(
 ur_result_t UR_APICALL urKernelRetain(
     ur_kernel_handle_t hKernel ///< [in][retain] handle for the Kernel to retain
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelRetain(hKernel);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Kernel.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hKernel);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3886,12 +4302,16 @@ ur_result_t UR_APICALL urKernelRelease(
     ur_kernel_handle_t
         hKernel ///< [in][release] handle for the Kernel to release
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelRelease(hKernel);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Kernel.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hKernel);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3926,6 +4346,10 @@ ur_result_t UR_APICALL urKernelSetArgPointer(
         pArgValue ///< [in][optional] Pointer obtained by USM allocation or virtual memory
     ///< mapping operation. If null then argument value is considered null.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelSetArgPointer(hKernel, argIndex, pProperties,
+                                                 pArgValue);
+#else
     auto pfnSetArgPointer =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetArgPointer;
     if (nullptr == pfnSetArgPointer) {
@@ -3933,6 +4357,7 @@ ur_result_t UR_APICALL urKernelSetArgPointer(
     }
 
     return pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3970,6 +4395,10 @@ ur_result_t UR_APICALL urKernelSetExecInfo(
         pPropValue ///< [in][typename(propName, propSize)] pointer to memory location holding
                    ///< the property value.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelSetExecInfo(hKernel, propName, propSize,
+                                               pProperties, pPropValue);
+#else
     auto pfnSetExecInfo =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetExecInfo;
     if (nullptr == pfnSetExecInfo) {
@@ -3977,6 +4406,7 @@ ur_result_t UR_APICALL urKernelSetExecInfo(
     }
 
     return pfnSetExecInfo(hKernel, propName, propSize, pProperties, pPropValue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4005,6 +4435,10 @@ ur_result_t UR_APICALL urKernelSetArgSampler(
         *pProperties, ///< [in][optional] pointer to sampler properties.
     ur_sampler_handle_t hArgValue ///< [in] handle of Sampler object.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelSetArgSampler(hKernel, argIndex, pProperties,
+                                                 hArgValue);
+#else
     auto pfnSetArgSampler =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetArgSampler;
     if (nullptr == pfnSetArgSampler) {
@@ -4012,6 +4446,7 @@ ur_result_t UR_APICALL urKernelSetArgSampler(
     }
 
     return pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4041,6 +4476,10 @@ ur_result_t UR_APICALL urKernelSetArgMemObj(
         *pProperties, ///< [in][optional] pointer to Memory object properties.
     ur_mem_handle_t hArgValue ///< [in][optional] handle of Memory object.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelSetArgMemObj(hKernel, argIndex, pProperties,
+                                                hArgValue);
+#else
     auto pfnSetArgMemObj =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetArgMemObj;
     if (nullptr == pfnSetArgMemObj) {
@@ -4048,6 +4487,7 @@ ur_result_t UR_APICALL urKernelSetArgMemObj(
     }
 
     return pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4088,6 +4528,10 @@ ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     const ur_specialization_constant_info_t *
         pSpecConstants ///< [in] array of specialization constant value descriptions
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelSetSpecializationConstants(hKernel, count,
+                                                              pSpecConstants);
+#else
     auto pfnSetSpecializationConstants =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetSpecializationConstants;
     if (nullptr == pfnSetSpecializationConstants) {
@@ -4095,6 +4539,7 @@ ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     }
 
     return pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4127,6 +4572,9 @@ ur_result_t UR_APICALL urKernelGetNativeHandle(
     ur_native_handle_t
         *phNativeKernel ///< [out] a pointer to the native handle of the kernel.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelGetNativeHandle(hKernel, phNativeKernel);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Kernel.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -4134,6 +4582,7 @@ ur_result_t UR_APICALL urKernelGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hKernel, phNativeKernel);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4172,6 +4621,12 @@ ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
     ur_kernel_handle_t
         *phKernel ///< [out] pointer to the handle of the kernel object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelCreateWithNativeHandle(hNativeKernel,
+                                                          hContext, hProgram,
+                                                          pProperties,
+                                                          phKernel);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Kernel.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -4180,6 +4635,7 @@ ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeKernel, hContext, hProgram,
                                      pProperties, phKernel);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4223,6 +4679,11 @@ ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         pSuggestedLocalWorkSize ///< [out] pointer to an array of numWorkDim unsigned values that specify
     ///< suggested local work size that will contain the result of the query
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelGetSuggestedLocalWorkSize(
+        hKernel, hQueue, numWorkDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pSuggestedLocalWorkSize);
+#else
     auto pfnGetSuggestedLocalWorkSize =
         ur_lib::getContext()->urDdiTable.Kernel.pfnGetSuggestedLocalWorkSize;
     if (nullptr == pfnGetSuggestedLocalWorkSize) {
@@ -4232,6 +4693,7 @@ ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
     return pfnGetSuggestedLocalWorkSize(hKernel, hQueue, numWorkDim,
                                         pGlobalWorkOffset, pGlobalWorkSize,
                                         pSuggestedLocalWorkSize);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4251,7 +4713,7 @@ ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hQueue`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_QUEUE_INFO_EMPTY < propName`
+///         + `::UR_QUEUE_INFO_CREATED_EVENT_COUNT < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -4274,12 +4736,17 @@ ur_result_t UR_APICALL urQueueGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] size in bytes returned in queue property value
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urQueueGetInfo(hQueue, propName, propSize,
+                                          pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Queue.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4321,12 +4788,17 @@ ur_result_t UR_APICALL urQueueCreate(
     ur_queue_handle_t
         *phQueue ///< [out] pointer to handle of queue object created
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urQueueCreate(hContext, hDevice, pProperties,
+                                         phQueue);
+#else
     auto pfnCreate = ur_lib::getContext()->urDdiTable.Queue.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCreate(hContext, hDevice, pProperties, phQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4357,12 +4829,16 @@ ur_result_t UR_APICALL urQueueRetain(
     ur_queue_handle_t
         hQueue ///< [in][retain] handle of the queue object to get access
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urQueueRetain(hQueue);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Queue.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4395,12 +4871,16 @@ ur_result_t UR_APICALL urQueueRelease(
     ur_queue_handle_t
         hQueue ///< [in][release] handle of the queue object to release
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urQueueRelease(hQueue);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Queue.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4435,6 +4915,9 @@ ur_result_t UR_APICALL urQueueGetNativeHandle(
     ur_native_handle_t
         *phNativeQueue ///< [out] a pointer to the native handle of the queue.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urQueueGetNativeHandle(hQueue, pDesc, phNativeQueue);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Queue.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -4442,6 +4925,7 @@ ur_result_t UR_APICALL urQueueGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hQueue, pDesc, phNativeQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4476,6 +4960,11 @@ ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
     ur_queue_handle_t
         *phQueue ///< [out] pointer to the handle of the queue object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urQueueCreateWithNativeHandle(hNativeQueue, hContext,
+                                                         hDevice, pProperties,
+                                                         phQueue);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Queue.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -4484,6 +4973,7 @@ ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeQueue, hContext, hDevice,
                                      pProperties, phQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4515,12 +5005,16 @@ ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
 ur_result_t UR_APICALL urQueueFinish(
     ur_queue_handle_t hQueue ///< [in] handle of the queue to be finished.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urQueueFinish(hQueue);
+#else
     auto pfnFinish = ur_lib::getContext()->urDdiTable.Queue.pfnFinish;
     if (nullptr == pfnFinish) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnFinish(hQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4551,12 +5045,16 @@ ur_result_t UR_APICALL urQueueFinish(
 ur_result_t UR_APICALL urQueueFlush(
     ur_queue_handle_t hQueue ///< [in] handle of the queue to be flushed.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urQueueFlush(hQueue);
+#else
     auto pfnFlush = ur_lib::getContext()->urDdiTable.Queue.pfnFlush;
     if (nullptr == pfnFlush) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnFlush(hQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4597,12 +5095,17 @@ ur_result_t UR_APICALL urEventGetInfo(
                     ///< property
     size_t *pPropSizeRet ///< [out][optional] bytes returned in event property
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEventGetInfo(hEvent, propName, propSize,
+                                          pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Event.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4643,6 +5146,10 @@ ur_result_t UR_APICALL urEventGetProfilingInfo(
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes returned in
                      ///< propValue
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEventGetProfilingInfo(hEvent, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+#else
     auto pfnGetProfilingInfo =
         ur_lib::getContext()->urDdiTable.Event.pfnGetProfilingInfo;
     if (nullptr == pfnGetProfilingInfo) {
@@ -4651,6 +5158,7 @@ ur_result_t UR_APICALL urEventGetProfilingInfo(
 
     return pfnGetProfilingInfo(hEvent, propName, propSize, pPropValue,
                                pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4683,12 +5191,16 @@ ur_result_t UR_APICALL urEventWait(
         phEventWaitList ///< [in][range(0, numEvents)] pointer to a list of events to wait for
                         ///< completion
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEventWait(numEvents, phEventWaitList);
+#else
     auto pfnWait = ur_lib::getContext()->urDdiTable.Event.pfnWait;
     if (nullptr == pfnWait) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnWait(numEvents, phEventWaitList);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4714,12 +5226,16 @@ ur_result_t UR_APICALL urEventWait(
 ur_result_t UR_APICALL urEventRetain(
     ur_event_handle_t hEvent ///< [in][retain] handle of the event object
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEventRetain(hEvent);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Event.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4745,12 +5261,16 @@ ur_result_t UR_APICALL urEventRetain(
 ur_result_t UR_APICALL urEventRelease(
     ur_event_handle_t hEvent ///< [in][release] handle of the event object
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEventRelease(hEvent);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Event.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4783,6 +5303,9 @@ ur_result_t UR_APICALL urEventGetNativeHandle(
     ur_native_handle_t
         *phNativeEvent ///< [out] a pointer to the native handle of the event.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEventGetNativeHandle(hEvent, phNativeEvent);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Event.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -4790,6 +5313,7 @@ ur_result_t UR_APICALL urEventGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hEvent, phNativeEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4823,6 +5347,10 @@ ur_result_t UR_APICALL urEventCreateWithNativeHandle(
     ur_event_handle_t
         *phEvent ///< [out] pointer to the handle of the event object created.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEventCreateWithNativeHandle(hNativeEvent, hContext,
+                                                         pProperties, phEvent);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Event.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -4831,6 +5359,7 @@ ur_result_t UR_APICALL urEventCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeEvent, hContext, pProperties,
                                      phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4869,12 +5398,17 @@ ur_result_t UR_APICALL urEventSetCallback(
     void *
         pUserData ///< [in][out][optional] pointer to data to be passed to callback.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEventSetCallback(hEvent, execStatus, pfnNotify,
+                                              pUserData);
+#else
     auto pfnSetCallback = ur_lib::getContext()->urDdiTable.Event.pfnSetCallback;
     if (nullptr == pfnSetCallback) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4941,6 +5475,14 @@ ur_result_t UR_APICALL urEnqueueKernelLaunch(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueKernelLaunch(hQueue, hKernel, workDim,
+                                                 pGlobalWorkOffset,
+                                                 pGlobalWorkSize,
+                                                 pLocalWorkSize,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+#else
     auto pfnKernelLaunch =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnKernelLaunch;
     if (nullptr == pfnKernelLaunch) {
@@ -4950,6 +5492,7 @@ ur_result_t UR_APICALL urEnqueueKernelLaunch(
     return pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
                            pGlobalWorkSize, pLocalWorkSize, numEventsInWaitList,
                            phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4998,12 +5541,17 @@ ur_result_t UR_APICALL urEnqueueEventsWait(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueEventsWait(hQueue, numEventsInWaitList,
+                                               phEventWaitList, phEvent);
+#else
     auto pfnEventsWait = ur_lib::getContext()->urDdiTable.Enqueue.pfnEventsWait;
     if (nullptr == pfnEventsWait) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5054,6 +5602,12 @@ ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueEventsWaitWithBarrier(hQueue,
+                                                          numEventsInWaitList,
+                                                          phEventWaitList,
+                                                          phEvent);
+#else
     auto pfnEventsWaitWithBarrier =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnEventsWaitWithBarrier;
     if (nullptr == pfnEventsWaitWithBarrier) {
@@ -5062,20 +5616,22 @@ ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
 
     return pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
                                     phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Enqueue a command to read from a buffer object to host memory
+///////////////
+/// @brief Enqueue a command to allocate USM device memory
 ///
 /// @details
-///     - Input parameter blockingRead indicates if the read is blocking or
-///       non-blocking.
-///
-/// @remarks
-///   _Analogues_
-///     - **clEnqueueReadBuffer**
+///     - Allocates device memory for the device of hQueue, in the order of the
+///       commands of hQueue.
+///     - The memory may be used by the commands enqueued to hQueue after this
+///       one, and by commands which wait for phEvent.
+///     - The memory must be freed with ::urEnqueueUSMFreeExp.
+///     - Memory freed by earlier ::urEnqueueUSMFreeExp commands may be reused
+///       without synchronizing with the host.
 ///
 /// @returns
 ///     - ::UR_RESULT_SUCCESS
@@ -5084,62 +5640,64 @@ ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
 ///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hQueue`
-///         + `NULL == hBuffer`
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///         + `NULL == pDst`
+///         + `NULL == ppMem`
 ///     - ::UR_RESULT_ERROR_INVALID_QUEUE
 ///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_USM_SIZE
+///         + `size == 0`
+///         + `size` is greater than ::UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE.
 ///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
 ///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
 ///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
 ///         + If event objects in phEventWaitList are not valid events.
-///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
-///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
-///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
-///     - ::UR_RESULT_ERROR_INVALID_SIZE
-///         + If `offset + size` results in an out-of-bounds access.
 ///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
-ur_result_t UR_APICALL urEnqueueMemBufferRead(
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter or the device doesn't support stream ordered allocations.
+ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
     ur_queue_handle_t hQueue, ///< [in] handle of the queue object
-    ur_mem_handle_t
-        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
-    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
-    size_t offset,     ///< [in] offset in bytes in the buffer object
-    size_t size,       ///< [in] size in bytes of data being read
-    void *pDst, ///< [in] pointer to host memory where data is to be read into
+    size_t
+        size, ///< [in] minimum size in bytes of the USM memory object to be allocated
     uint32_t numEventsInWaitList, ///< [in] size of the event wait list
     const ur_event_handle_t *
         phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
-    ///< events that must be complete before this command can be executed.
-    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
-    ///< command does not wait on any event to complete.
+    ///< events that must be complete before the allocation.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    void **ppMem, ///< [out] pointer to USM device memory object
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
-                ///< command instance.
+    ///< command instance.
     ) try {
-    auto pfnMemBufferRead =
-        ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferRead;
-    if (nullptr == pfnMemBufferRead) {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueUSMDeviceAllocExp(hQueue, size,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, ppMem,
+                                                      phEvent);
+#else
+    auto pfnUSMDeviceAllocExp =
+        ur_lib::getContext()->urDdiTable.EnqueueExp.pfnUSMDeviceAllocExp;
+    if (nullptr == pfnUSMDeviceAllocExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size, pDst,
-                            numEventsInWaitList, phEventWaitList, phEvent);
+    return pfnUSMDeviceAllocExp(hQueue, size, numEventsInWaitList,
+                                phEventWaitList, ppMem, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Enqueue a command to write into a buffer object from host memory
+///////////////
+/// @brief Enqueue a command to free USM memory allocated with
+///        ::urEnqueueUSMDeviceAllocExp
 ///
 /// @details
-///     - Input parameter blockingWrite indicates if the write is blocking or
-///       non-blocking.
-///
-/// @remarks
-///   _Analogues_
-///     - **clEnqueueWriteBuffer**
+///     - Frees the memory once the commands enqueued to hQueue before this one,
+///       and the commands phEventWaitList refers to, are complete.
+///     - The memory may be reused by the allocations enqueued after this
+///       command without synchronizing with the host.
 ///
 /// @returns
 ///     - ::UR_RESULT_SUCCESS
@@ -5148,67 +5706,62 @@ ur_result_t UR_APICALL urEnqueueMemBufferRead(
 ///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hQueue`
-///         + `NULL == hBuffer`
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///         + `NULL == pSrc`
+///         + `NULL == pMem`
 ///     - ::UR_RESULT_ERROR_INVALID_QUEUE
 ///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
 ///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
 ///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
 ///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
 ///         + If event objects in phEventWaitList are not valid events.
-///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
-///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
-///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
-///     - ::UR_RESULT_ERROR_INVALID_SIZE
-///         + If `offset + size` results in an out-of-bounds access.
 ///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
-ur_result_t UR_APICALL urEnqueueMemBufferWrite(
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter or the device doesn't support stream ordered allocations.
+ur_result_t UR_APICALL urEnqueueUSMFreeExp(
     ur_queue_handle_t hQueue, ///< [in] handle of the queue object
-    ur_mem_handle_t
-        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
-    bool
-        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
-    size_t offset,     ///< [in] offset in bytes in the buffer object
-    size_t size,       ///< [in] size in bytes of data being written
-    const void
-        *pSrc, ///< [in] pointer to host memory where data is to be written from
+    void *
+        pMem, ///< [in] pointer to USM memory object allocated with
+              ///< ::urEnqueueUSMDeviceAllocExp
     uint32_t numEventsInWaitList, ///< [in] size of the event wait list
     const ur_event_handle_t *
         phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
-    ///< events that must be complete before this command can be executed.
-    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
-    ///< command does not wait on any event to complete.
+    ///< events that must be complete before the free.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
     ur_event_handle_t *
         phEvent ///< [out][optional] return an event object that identifies this particular
-                ///< command instance.
+    ///< command instance.
     ) try {
-    auto pfnMemBufferWrite =
-        ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferWrite;
-    if (nullptr == pfnMemBufferWrite) {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueUSMFreeExp(hQueue, pMem,
+                                               numEventsInWaitList,
+                                               phEventWaitList, phEvent);
+#else
+    auto pfnUSMFreeExp =
+        ur_lib::getContext()->urDdiTable.EnqueueExp.pfnUSMFreeExp;
+    if (nullptr == pfnUSMFreeExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size, pSrc,
-                             numEventsInWaitList, phEventWaitList, phEvent);
+    return pfnUSMFreeExp(hQueue, pMem, numEventsInWaitList, phEventWaitList,
+                         phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Enqueue a command to read a 2D or 3D rectangular region from a buffer
-///        object to host memory
+///////////////
+/// @brief Enqueue a command to copy many rectangular regions between two
+///        buffer objects
 ///
 /// @details
-///     - Input parameter blockingRead indicates if the read is blocking or
-///       non-blocking.
-///     - The buffer and host 2D or 3D rectangular regions can have different
-///       shapes.
-///
-/// @remarks
-///   _Analogues_
-///     - **clEnqueueReadBufferRect**
+///     - Copies every region pRegions[i] from pSrcOrigins[i] in hBufferSrc to
+///       pDstOrigins[i] in hBufferDst, as a single command.
+///     - All the regions share the row and slice pitches of each buffer.
+///     - The regions of hBufferDst must not overlap each other, nor the
+///       regions of hBufferSrc if both are the same buffer.
 ///
 /// @returns
 ///     - ::UR_RESULT_SUCCESS
@@ -5217,9 +5770,12 @@ ur_result_t UR_APICALL urEnqueueMemBufferWrite(
 ///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hQueue`
-///         + `NULL == hBuffer`
+///         + `NULL == hBufferSrc`
+///         + `NULL == hBufferDst`
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///         + `NULL == pDst`
+///         + `NULL == pSrcOrigins`
+///         + `NULL == pDstOrigins`
+///         + `NULL == pRegions`
 ///     - ::UR_RESULT_ERROR_INVALID_QUEUE
 ///     - ::UR_RESULT_ERROR_INVALID_EVENT
 ///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
@@ -5230,36 +5786,37 @@ ur_result_t UR_APICALL urEnqueueMemBufferWrite(
 ///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
 ///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
-///         + `region.width == 0 || region.height == 0 || region.width == 0`
-///         + `bufferRowPitch != 0 && bufferRowPitch < region.width`
-///         + `hostRowPitch != 0 && hostRowPitch < region.width`
-///         + `bufferSlicePitch != 0 && bufferSlicePitch < region.height * (bufferRowPitch != 0 ? bufferRowPitch : region.width)`
-///         + `bufferSlicePitch != 0 && bufferSlicePitch % (bufferRowPitch != 0 ? bufferRowPitch : region.width) != 0`
-///         + `hostSlicePitch != 0 && hostSlicePitch < region.height * (hostRowPitch != 0 ? hostRowPitch : region.width)`
-///         + `hostSlicePitch != 0 && hostSlicePitch % (hostRowPitch != 0 ? hostRowPitch : region.width) != 0`
-///         + If the combination of `bufferOrigin`, `region`, `bufferRowPitch`, and `bufferSlicePitch` results in an out-of-bounds access.
+///         + `numRegions == 0`
+///         + If the width, height or depth of a region is 0.
+///         + If a pitch is smaller than a region allows, as for
+///           ::urEnqueueMemBufferCopyRect.
+///         + If a region results in an out-of-bounds access.
 ///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
-ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
-    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
-    ur_mem_handle_t
-        hBuffer, ///< [in][bounds(bufferOrigin, region)] handle of the buffer object
-    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
-    ur_rect_offset_t bufferOrigin, ///< [in] 3D offset in the buffer
-    ur_rect_offset_t hostOrigin,   ///< [in] 3D offset in the host region
-    ur_rect_region_t
-        region, ///< [in] 3D rectangular region descriptor: width, height, depth
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support batched rectangular copies.
+ur_result_t UR_APICALL urEnqueueMemBufferCopyRectBatchExp(
+    ur_queue_handle_t hQueue,   ///< [in] handle of the queue object
+    ur_mem_handle_t hBufferSrc, ///< [in] handle of the source buffer object
+    ur_mem_handle_t hBufferDst, ///< [in] handle of the dest buffer object
+    uint32_t numRegions, ///< [in] number of rectangular regions to copy
+    const ur_rect_offset_t *
+        pSrcOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the source
+                     ///< buffer
+    const ur_rect_offset_t *
+        pDstOrigins, ///< [in][range(0, numRegions)] 3D offsets of the regions in the
+                     ///< destination buffer
+    const ur_rect_region_t *
+        pRegions, ///< [in][range(0, numRegions)] 3D rectangular region descriptors: width,
+                  ///< height, depth
     size_t
-        bufferRowPitch, ///< [in] length of each row in bytes in the buffer object
+        srcRowPitch, ///< [in] length of each row in bytes in the source buffer object
     size_t
-        bufferSlicePitch, ///< [in] length of each 2D slice in bytes in the buffer object being read
+        srcSlicePitch, ///< [in] length of each 2D slice in bytes in the source buffer object
     size_t
-        hostRowPitch, ///< [in] length of each row in bytes in the host memory region pointed by
-                      ///< dst
+        dstRowPitch, ///< [in] length of each row in bytes in the destination buffer object
     size_t
-        hostSlicePitch, ///< [in] length of each 2D slice in bytes in the host memory region
-                        ///< pointed by dst
-    void *pDst, ///< [in] pointer to host memory where data is to be read into
+        dstSlicePitch, ///< [in] length of each 2D slice in bytes in the destination buffer object
     uint32_t numEventsInWaitList, ///< [in] size of the event wait list
     const ur_event_handle_t *
         phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
@@ -5270,33 +5827,37 @@ ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
-    auto pfnMemBufferReadRect =
-        ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferReadRect;
-    if (nullptr == pfnMemBufferReadRect) {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemBufferCopyRectBatchExp(
+        hQueue, hBufferSrc, hBufferDst, numRegions, pSrcOrigins, pDstOrigins,
+        pRegions, srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numEventsInWaitList, phEventWaitList, phEvent);
+#else
+    auto pfnMemBufferCopyRectBatchExp =
+        ur_lib::getContext()->urDdiTable.EnqueueExp.pfnMemBufferCopyRectBatchExp;
+    if (nullptr == pfnMemBufferCopyRectBatchExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferReadRect(
-        hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
-        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+    return pfnMemBufferCopyRectBatchExp(
+        hQueue, hBufferSrc, hBufferDst, numRegions, pSrcOrigins, pDstOrigins,
+        pRegions, srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
         numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Enqueue a command to write a 2D or 3D rectangular region in a buffer
-///        object from host memory
+/// @brief Enqueue many kernel launches in a single call
 ///
 /// @details
-///     - Input parameter blockingWrite indicates if the write is blocking or
-///       non-blocking.
-///     - The buffer and host 2D or 3D rectangular regions can have different
-///       shapes.
-///
-/// @remarks
-///   _Analogues_
-///     - **clEnqueueWriteBufferRect**
+///     - Enqueues the launch of every kernel of pLaunches, in order, as if
+///       each were enqueued with ::urEnqueueKernelLaunch.
+///     - Each launch uses the arguments set on its kernel when this function
+///       is called, a kernel may appear more than once.
+///     - Every launch waits on phEventWaitList, and phEvent completes once all
+///       the launches have.
 ///
 /// @returns
 ///     - ::UR_RESULT_SUCCESS
@@ -5305,10 +5866,12 @@ ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
 ///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hQueue`
-///         + `NULL == hBuffer`
+///         + If the hKernel of a launch is NULL.
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///         + `NULL == pSrc`
+///         + `NULL == pLaunches`
+///         + If the pGlobalWorkSize of a launch is NULL.
 ///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL
 ///     - ::UR_RESULT_ERROR_INVALID_EVENT
 ///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
 ///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
@@ -5316,71 +5879,61 @@ ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
 ///         + If event objects in phEventWaitList are not valid events.
 ///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
 ///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
-///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
-///         + `region.width == 0 || region.height == 0 || region.width == 0`
-///         + `bufferRowPitch != 0 && bufferRowPitch < region.width`
-///         + `hostRowPitch != 0 && hostRowPitch < region.width`
-///         + `bufferSlicePitch != 0 && bufferSlicePitch < region.height * (bufferRowPitch != 0 ? bufferRowPitch : region.width)`
-///         + `bufferSlicePitch != 0 && bufferSlicePitch % (bufferRowPitch != 0 ? bufferRowPitch : region.width) != 0`
-///         + `hostSlicePitch != 0 && hostSlicePitch < region.height * (hostRowPitch != 0 ? hostRowPitch : region.width)`
-///         + `hostSlicePitch != 0 && hostSlicePitch % (hostRowPitch != 0 ? hostRowPitch : region.width) != 0`
-///         + If the combination of `bufferOrigin`, `region`, `bufferRowPitch`, and `bufferSlicePitch` results in an out-of-bounds access.
+///         + `numLaunches == 0`
+///     - ::UR_RESULT_ERROR_INVALID_WORK_DIMENSION
+///         + If the workDim of a launch is not between 1 and 3.
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGS
+///         + If a kernel has arguments which are not set.
 ///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
-ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
+ur_result_t UR_APICALL urEnqueueKernelLaunchBatchExp(
     ur_queue_handle_t hQueue, ///< [in] handle of the queue object
-    ur_mem_handle_t
-        hBuffer, ///< [in][bounds(bufferOrigin, region)] handle of the buffer object
-    bool
-        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
-    ur_rect_offset_t bufferOrigin, ///< [in] 3D offset in the buffer
-    ur_rect_offset_t hostOrigin,   ///< [in] 3D offset in the host region
-    ur_rect_region_t
-        region, ///< [in] 3D rectangular region descriptor: width, height, depth
-    size_t
-        bufferRowPitch, ///< [in] length of each row in bytes in the buffer object
-    size_t
-        bufferSlicePitch, ///< [in] length of each 2D slice in bytes in the buffer object being
-                          ///< written
-    size_t
-        hostRowPitch, ///< [in] length of each row in bytes in the host memory region pointed by
-                      ///< src
-    size_t
-        hostSlicePitch, ///< [in] length of each 2D slice in bytes in the host memory region
-                        ///< pointed by src
-    void
-        *pSrc, ///< [in] pointer to host memory where data is to be written from
+    uint32_t numLaunches,     ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_desc_t *
+        pLaunches, ///< [in][range(0, numLaunches)] pointer to a list of kernel launch
+                   ///< descriptors
     uint32_t numEventsInWaitList, ///< [in] size of the event wait list
     const ur_event_handle_t *
-        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] points to a list of
-    ///< events that must be complete before this command can be executed.
-    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
-    ///< command does not wait on any event to complete.
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernels execute.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
     ur_event_handle_t *
-        phEvent ///< [out][optional] return an event object that identifies this particular
-                ///< command instance.
+        phEvent ///< [out][optional] return an event object that identifies the completion
+                ///< of all the launches.
     ) try {
-    auto pfnMemBufferWriteRect =
-        ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferWriteRect;
-    if (nullptr == pfnMemBufferWriteRect) {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueKernelLaunchBatchExp(hQueue, numLaunches,
+                                                         pLaunches,
+                                                         numEventsInWaitList,
+                                                         phEventWaitList,
+                                                         phEvent);
+#else
+    auto pfnKernelLaunchBatchExp =
+        ur_lib::getContext()->urDdiTable.EnqueueExp.pfnKernelLaunchBatchExp;
+    if (nullptr == pfnKernelLaunchBatchExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferWriteRect(
-        hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
-        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
-        numEventsInWaitList, phEventWaitList, phEvent);
+    return pfnKernelLaunchBatchExp(hQueue, numLaunches, pLaunches,
+                                   numEventsInWaitList, phEventWaitList,
+                                   phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Enqueue a command to copy from a buffer object to another
+/// @brief Set many kernel arguments in a single call
 ///
-/// @remarks
-///   _Analogues_
-///     - **clEnqueueCopyBuffer**
+/// @details
+///     - Sets every argument of pArgs, in order, as if each were set with the
+///       function for its type.
+///     - An argument which appears more than once takes the last of its
+///       values.
+///     - Stops at the first argument which cannot be set, the arguments
+///       before it are set.
 ///
 /// @returns
 ///     - ::UR_RESULT_SUCCESS
@@ -5388,73 +5941,905 @@ ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
 ///     - ::UR_RESULT_ERROR_DEVICE_LOST
 ///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
-///         + `NULL == hQueue`
-///         + `NULL == hBufferSrc`
-///         + `NULL == hBufferDst`
-///     - ::UR_RESULT_ERROR_INVALID_QUEUE
-///     - ::UR_RESULT_ERROR_INVALID_EVENT
-///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
-///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
-///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
-///         + If event objects in phEventWaitList are not valid events.
-///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
-///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
-///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///         + `NULL == hKernel`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pArgs`
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
-///         + If `srcOffset + size` results in an out-of-bounds access.
-///         + If `dstOffset + size` results in an out-of-bounds access.
+///         + `numArgs == 0`
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + If the type of an argument is not a ::ur_exp_kernel_arg_type_t.
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_SAMPLER
 ///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
-ur_result_t UR_APICALL urEnqueueMemBufferCopy(
-    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
-    ur_mem_handle_t
-        hBufferSrc, ///< [in][bounds(srcOffset, size)] handle of the src buffer object
-    ur_mem_handle_t
-        hBufferDst, ///< [in][bounds(dstOffset, size)] handle of the dest buffer object
-    size_t srcOffset, ///< [in] offset into hBufferSrc to begin copying from
-    size_t dstOffset, ///< [in] offset info hBufferDst to begin copying into
-    size_t size,      ///< [in] size in bytes of data being copied
-    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
-    const ur_event_handle_t *
-        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
-    ///< events that must be complete before this command can be executed.
-    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
-    ///< command does not wait on any event to complete.
-    ur_event_handle_t *
-        phEvent ///< [out][optional] return an event object that identifies this particular
-                ///< command instance.
+ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments
+    const ur_exp_kernel_arg_properties_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to a list of kernel arguments
     ) try {
-    auto pfnMemBufferCopy =
-        ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferCopy;
-    if (nullptr == pfnMemBufferCopy) {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelSetArgsExp(hKernel, numArgs, pArgs);
+#else
+    auto pfnSetArgsExp =
+        ur_lib::getContext()->urDdiTable.KernelExp.pfnSetArgsExp;
+    if (nullptr == pfnSetArgsExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    return pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset,
-                            dstOffset, size, numEventsInWaitList,
-                            phEventWaitList, phEvent);
+    return pfnSetArgsExp(hKernel, numArgs, pArgs);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Enqueue a command to copy a 2D or 3D rectangular region from one
-///        buffer object to another
+/// @brief Wait for any of a list of events to finish
 ///
-/// @remarks
-///   _Analogues_
-///     - **clEnqueueCopyBufferRect**
+/// @details
+///     - Blocks until at least one of the events of phEventWaitList is
+///       complete, and returns the index of one which is.
+///     - Unlike ::urEventWait, it does not wait for the other events.
 ///
 /// @returns
 ///     - ::UR_RESULT_SUCCESS
 ///     - ::UR_RESULT_ERROR_UNINITIALIZED
 ///     - ::UR_RESULT_ERROR_DEVICE_LOST
 ///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
-///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
-///         + `NULL == hQueue`
-///         + `NULL == hBufferSrc`
-///         + `NULL == hBufferDst`
-///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phEventWaitList`
+///         + `NULL == pEventIndex`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + `numEvents == 0`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+    uint32_t *
+        pEventIndex ///< [out] index in phEventWaitList of an event which is complete
+    ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEventWaitAnyExp(numEvents, phEventWaitList,
+                                             pEventIndex);
+#else
+    auto pfnWaitAnyExp =
+        ur_lib::getContext()->urDdiTable.EventExp.pfnWaitAnyExp;
+    if (nullptr == pfnWaitAnyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnWaitAnyExp(numEvents, phEventWaitList, pEventIndex);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Query the execution status of a list of events
+///
+/// @details
+///     - Returns for each event of phEvents the status ::urEventGetInfo
+///       returns for ::UR_EVENT_INFO_COMMAND_EXECUTION_STATUS, without
+///       blocking.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phEvents`
+///         + `NULL == pStatuses`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + `numEvents == 0`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEventGetExecutionStatusExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEvents, ///< [in][range(0, numEvents)] pointer to a list of events to query
+    ur_event_status_t *
+        pStatuses ///< [out][range(0, numEvents)] execution status of each of the events of
+                  ///< phEvents
+    ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEventGetExecutionStatusExp(numEvents, phEvents,
+                                                        pStatuses);
+#else
+    auto pfnGetExecutionStatusExp =
+        ur_lib::getContext()->urDdiTable.EventExp.pfnGetExecutionStatusExp;
+    if (nullptr == pfnGetExecutionStatusExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnGetExecutionStatusExp(numEvents, phEvents, pStatuses);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Create a group of queues which the work of the application is
+///        balanced across
+///
+/// @details
+///     - The queues must belong to the same context, the group retains them
+///       until it is released.
+///     - Implemented by the loader over the queue APIs, it is supported by
+///       every adapter.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phQueues`
+///         + `NULL == phQueueGroup`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numQueues == 0`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + If any of the queues of phQueues is NULL.
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///         + If the queues don't all belong to the same context.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+ur_result_t UR_APICALL urQueueGroupCreateExp(
+    uint32_t numQueues, ///< [in] number of queues of the group
+    const ur_queue_handle_t *
+        phQueues, ///< [in][range(0, numQueues)] pointer to the list of the queues of the
+                  ///< group
+    ur_exp_queue_group_handle_t *
+        phQueueGroup ///< [out] pointer to handle of queue group object created
+    ) try {
+    return ur_lib::urQueueGroupCreateExp(numQueues, phQueues, phQueueGroup);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get a reference to a queue group object
+///
+/// @details
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueueGroup`
+ur_result_t UR_APICALL urQueueGroupRetainExp(
+    ur_exp_queue_group_handle_t
+        hQueueGroup ///< [in][retain] handle of the queue group object to retain
+    ) try {
+    return ur_lib::urQueueGroupRetainExp(hQueueGroup);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Release a queue group object
+///
+/// @details
+///     - Decrements the reference count of the group, releasing its queues
+///       and destroying it once it becomes zero.
+///     - The commands enqueued to the queues of the group are not waited for.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueueGroup`
+ur_result_t UR_APICALL urQueueGroupReleaseExp(
+    ur_exp_queue_group_handle_t
+        hQueueGroup ///< [in][release] handle of the queue group object to release
+    ) try {
+    return ur_lib::urQueueGroupReleaseExp(hQueueGroup);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Select the least loaded queue of a group to enqueue the next
+///        command to
+///
+/// @details
+///     - The load of a queue is the number of commands submitted to it since
+///       it was last found empty, as counted by
+///       ::UR_QUEUE_INFO_COMMAND_COUNTS, or the number of times the group
+///       selected it if the adapter doesn't count them.
+///     - Ties are broken in round robin order, so that groups of idle queues
+///       are all used.
+///     - The queue returned is not retained, it is valid as long as the group
+///       is.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueueGroup`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phQueue`
+ur_result_t UR_APICALL urQueueGroupGetQueueExp(
+    ur_exp_queue_group_handle_t
+        hQueueGroup, ///< [in] handle of the queue group object
+    ur_queue_handle_t *
+        phQueue ///< [out] pointer to the handle of the queue of the group the next command
+                ///< should be enqueued to
+    ) try {
+    return ur_lib::urQueueGroupGetQueueExp(hQueueGroup, phQueue);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Wait for the commands enqueued to all the queues of a group to
+///        complete
+///
+/// @details
+///     - Calls ::urQueueFinish on each queue of the group.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueueGroup`
+ur_result_t UR_APICALL urQueueGroupFinishExp(
+    ur_exp_queue_group_handle_t
+        hQueueGroup ///< [in] handle of the queue group object
+    ) try {
+    return ur_lib::urQueueGroupFinishExp(hQueueGroup);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a barrier across all the queues of a group
+///
+/// @details
+///     - The commands enqueued to any queue of the group after the barrier do
+///       not start before the commands enqueued to all of them before it, and
+///       the events of phEventWaitList, have completed.
+///     - Enqueues a barrier on each queue, then a barrier waiting for all of
+///       them on each queue, phEvent being the event of the one of the first
+///       queue.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueueGroup`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urQueueGroupBarrierExp(
+    ur_exp_queue_group_handle_t
+        hQueueGroup,              ///< [in] handle of the queue group object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the barrier.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that no wait
+    ///< event.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the barrier
+                ///< across the queues of the group.
+    ) try {
+    return ur_lib::urQueueGroupBarrierExp(
+        hQueueGroup, numEventsInWaitList, phEventWaitList, phEvent);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Reserve the ring of slots of the timestamp markers of a queue
+///
+/// @details
+///     - Allocates the device-writable ring of `capacity` slots the markers of
+///       ::urEnqueueTimestampMarkerExp write their timestamps to.
+///     - The ring is released along with the queue.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `capacity == 0`
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + If the ring of `hQueue` is already reserved.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter of `hQueue` does not support timestamp markers.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urQueueReserveTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint32_t
+        capacity ///< [in] number of slots of the ring, the number of markers which can be
+    ///< enqueued before the first one is overwritten
+    ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urQueueReserveTimestampMarkersExp(hQueue, capacity);
+#else
+    auto pfnReserveTimestampMarkersExp =
+        ur_lib::getContext()->urDdiTable.QueueExp.pfnReserveTimestampMarkersExp;
+    if (nullptr == pfnReserveTimestampMarkersExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnReserveTimestampMarkersExp(hQueue, capacity);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command writing the device timestamp to the next slot of
+///        the ring of the queue
+///
+/// @details
+///     - Unlike ::urEnqueueTimestampRecordingExp, no event is created for the
+///       marker, the timestamp being read back with
+///       ::urQueueReadTimestampMarkersExp.
+///     - Marker N of `hQueue`, numbered from 0, is written to slot N modulo
+///       the capacity of the ring.
+///     - The timestamp is in nanoseconds, in the time domain of the
+///       `UR_PROFILING_INFO_COMMAND_END` of ::urEnqueueTimestampRecordingExp.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + If the ring of `hQueue` is not reserved.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEnqueueTimestampMarkerExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the timestamp is written.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    uint64_t *pMarker ///< [out][optional] number of the marker
+    ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueTimestampMarkerExp(
+        hQueue, numEventsInWaitList, phEventWaitList, pMarker);
+#else
+    auto pfnTimestampMarkerExp =
+        ur_lib::getContext()->urDdiTable.EnqueueExp.pfnTimestampMarkerExp;
+    if (nullptr == pfnTimestampMarkerExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnTimestampMarkerExp(hQueue, numEventsInWaitList, phEventWaitList,
+                                 pMarker);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Read back the timestamps of a range of markers of a queue
+///
+/// @details
+///     - Blocks until the markers [firstMarker, firstMarker + count) are
+///       written, and copies their timestamps to pTimestamps.
+///     - A marker can be read until capacity more markers are enqueued to
+///       `hQueue`.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pTimestamps`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `count == 0`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If markers of the range are not enqueued yet, or were overwritten
+///           by later markers.
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + If the ring of `hQueue` is not reserved.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urQueueReadTimestampMarkersExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    uint64_t firstMarker,     ///< [in] number of the first marker to read
+    uint32_t count,           ///< [in] number of markers to read
+    uint64_t *
+        pTimestamps ///< [out][range(0, count)] timestamps in nanoseconds of the markers
+    ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urQueueReadTimestampMarkersExp(hQueue, firstMarker,
+                                                          count, pTimestamps);
+#else
+    auto pfnReadTimestampMarkersExp =
+        ur_lib::getContext()->urDdiTable.QueueExp.pfnReadTimestampMarkersExp;
+    if (nullptr == pfnReadTimestampMarkersExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnReadTimestampMarkersExp(hQueue, firstMarker, count, pTimestamps);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command to read from a buffer object to host memory
+///
+/// @details
+///     - Input parameter blockingRead indicates if the read is blocking or
+///       non-blocking.
+///
+/// @remarks
+///   _Analogues_
+///     - **clEnqueueReadBuffer**
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hBuffer`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pDst`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + If `offset + size` results in an out-of-bounds access.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEnqueueMemBufferRead(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
+    size_t offset,     ///< [in] offset in bytes in the buffer object
+    size_t size,       ///< [in] size in bytes of data being read
+    void *pDst, ///< [in] pointer to host memory where data is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+    ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemBufferRead(hQueue, hBuffer, blockingRead,
+                                                  offset, size, pDst,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+#else
+    auto pfnMemBufferRead =
+        ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferRead;
+    if (nullptr == pfnMemBufferRead) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size, pDst,
+                            numEventsInWaitList, phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command to write into a buffer object from host memory
+///
+/// @details
+///     - Input parameter blockingWrite indicates if the write is blocking or
+///       non-blocking.
+///
+/// @remarks
+///   _Analogues_
+///     - **clEnqueueWriteBuffer**
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hBuffer`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pSrc`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + If `offset + size` results in an out-of-bounds access.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEnqueueMemBufferWrite(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(offset, size)] handle of the buffer object
+    bool
+        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
+    size_t offset,     ///< [in] offset in bytes in the buffer object
+    size_t size,       ///< [in] size in bytes of data being written
+    const void
+        *pSrc, ///< [in] pointer to host memory where data is to be written from
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+    ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemBufferWrite(hQueue, hBuffer,
+                                                   blockingWrite, offset, size,
+                                                   pSrc, numEventsInWaitList,
+                                                   phEventWaitList, phEvent);
+#else
+    auto pfnMemBufferWrite =
+        ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferWrite;
+    if (nullptr == pfnMemBufferWrite) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size, pSrc,
+                             numEventsInWaitList, phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command to read a 2D or 3D rectangular region from a buffer
+///        object to host memory
+///
+/// @details
+///     - Input parameter blockingRead indicates if the read is blocking or
+///       non-blocking.
+///     - The buffer and host 2D or 3D rectangular regions can have different
+///       shapes.
+///
+/// @remarks
+///   _Analogues_
+///     - **clEnqueueReadBufferRect**
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hBuffer`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pDst`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `region.width == 0 || region.height == 0 || region.width == 0`
+///         + `bufferRowPitch != 0 && bufferRowPitch < region.width`
+///         + `hostRowPitch != 0 && hostRowPitch < region.width`
+///         + `bufferSlicePitch != 0 && bufferSlicePitch < region.height * (bufferRowPitch != 0 ? bufferRowPitch : region.width)`
+///         + `bufferSlicePitch != 0 && bufferSlicePitch % (bufferRowPitch != 0 ? bufferRowPitch : region.width) != 0`
+///         + `hostSlicePitch != 0 && hostSlicePitch < region.height * (hostRowPitch != 0 ? hostRowPitch : region.width)`
+///         + `hostSlicePitch != 0 && hostSlicePitch % (hostRowPitch != 0 ? hostRowPitch : region.width) != 0`
+///         + If the combination of `bufferOrigin`, `region`, `bufferRowPitch`, and `bufferSlicePitch` results in an out-of-bounds access.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(bufferOrigin, region)] handle of the buffer object
+    bool blockingRead, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t bufferOrigin, ///< [in] 3D offset in the buffer
+    ur_rect_offset_t hostOrigin,   ///< [in] 3D offset in the host region
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth
+    size_t
+        bufferRowPitch, ///< [in] length of each row in bytes in the buffer object
+    size_t
+        bufferSlicePitch, ///< [in] length of each 2D slice in bytes in the buffer object being read
+    size_t
+        hostRowPitch, ///< [in] length of each row in bytes in the host memory region pointed by
+                      ///< dst
+    size_t
+        hostSlicePitch, ///< [in] length of each 2D slice in bytes in the host memory region
+                        ///< pointed by dst
+    void *pDst, ///< [in] pointer to host memory where data is to be read into
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+    ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemBufferReadRect(hQueue, hBuffer,
+                                                      blockingRead,
+                                                      bufferOrigin, hostOrigin,
+                                                      region, bufferRowPitch,
+                                                      bufferSlicePitch,
+                                                      hostRowPitch,
+                                                      hostSlicePitch, pDst,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, phEvent);
+#else
+    auto pfnMemBufferReadRect =
+        ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferReadRect;
+    if (nullptr == pfnMemBufferReadRect) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnMemBufferReadRect(
+        hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+        numEventsInWaitList, phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command to write a 2D or 3D rectangular region in a buffer
+///        object from host memory
+///
+/// @details
+///     - Input parameter blockingWrite indicates if the write is blocking or
+///       non-blocking.
+///     - The buffer and host 2D or 3D rectangular regions can have different
+///       shapes.
+///
+/// @remarks
+///   _Analogues_
+///     - **clEnqueueWriteBufferRect**
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hBuffer`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pSrc`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `region.width == 0 || region.height == 0 || region.width == 0`
+///         + `bufferRowPitch != 0 && bufferRowPitch < region.width`
+///         + `hostRowPitch != 0 && hostRowPitch < region.width`
+///         + `bufferSlicePitch != 0 && bufferSlicePitch < region.height * (bufferRowPitch != 0 ? bufferRowPitch : region.width)`
+///         + `bufferSlicePitch != 0 && bufferSlicePitch % (bufferRowPitch != 0 ? bufferRowPitch : region.width) != 0`
+///         + `hostSlicePitch != 0 && hostSlicePitch < region.height * (hostRowPitch != 0 ? hostRowPitch : region.width)`
+///         + `hostSlicePitch != 0 && hostSlicePitch % (hostRowPitch != 0 ? hostRowPitch : region.width) != 0`
+///         + If the combination of `bufferOrigin`, `region`, `bufferRowPitch`, and `bufferSlicePitch` results in an out-of-bounds access.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBuffer, ///< [in][bounds(bufferOrigin, region)] handle of the buffer object
+    bool
+        blockingWrite, ///< [in] indicates blocking (true), non-blocking (false)
+    ur_rect_offset_t bufferOrigin, ///< [in] 3D offset in the buffer
+    ur_rect_offset_t hostOrigin,   ///< [in] 3D offset in the host region
+    ur_rect_region_t
+        region, ///< [in] 3D rectangular region descriptor: width, height, depth
+    size_t
+        bufferRowPitch, ///< [in] length of each row in bytes in the buffer object
+    size_t
+        bufferSlicePitch, ///< [in] length of each 2D slice in bytes in the buffer object being
+                          ///< written
+    size_t
+        hostRowPitch, ///< [in] length of each row in bytes in the host memory region pointed by
+                      ///< src
+    size_t
+        hostSlicePitch, ///< [in] length of each 2D slice in bytes in the host memory region
+                        ///< pointed by src
+    void
+        *pSrc, ///< [in] pointer to host memory where data is to be written from
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] points to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+    ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemBufferWriteRect(hQueue, hBuffer,
+                                                       blockingWrite,
+                                                       bufferOrigin, hostOrigin,
+                                                       region, bufferRowPitch,
+                                                       bufferSlicePitch,
+                                                       hostRowPitch,
+                                                       hostSlicePitch, pSrc,
+                                                       numEventsInWaitList,
+                                                       phEventWaitList,
+                                                       phEvent);
+#else
+    auto pfnMemBufferWriteRect =
+        ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferWriteRect;
+    if (nullptr == pfnMemBufferWriteRect) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnMemBufferWriteRect(
+        hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
+        numEventsInWaitList, phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command to copy from a buffer object to another
+///
+/// @remarks
+///   _Analogues_
+///     - **clEnqueueCopyBuffer**
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hBufferSrc`
+///         + `NULL == hBufferDst`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + If `srcOffset + size` results in an out-of-bounds access.
+///         + If `dstOffset + size` results in an out-of-bounds access.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEnqueueMemBufferCopy(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_mem_handle_t
+        hBufferSrc, ///< [in][bounds(srcOffset, size)] handle of the src buffer object
+    ur_mem_handle_t
+        hBufferDst, ///< [in][bounds(dstOffset, size)] handle of the dest buffer object
+    size_t srcOffset, ///< [in] offset into hBufferSrc to begin copying from
+    size_t dstOffset, ///< [in] offset info hBufferDst to begin copying into
+    size_t size,      ///< [in] size in bytes of data being copied
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+    ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemBufferCopy(hQueue, hBufferSrc,
+                                                  hBufferDst, srcOffset,
+                                                  dstOffset, size,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+#else
+    auto pfnMemBufferCopy =
+        ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferCopy;
+    if (nullptr == pfnMemBufferCopy) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset,
+                            dstOffset, size, numEventsInWaitList,
+                            phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command to copy a 2D or 3D rectangular region from one
+///        buffer object to another
+///
+/// @remarks
+///   _Analogues_
+///     - **clEnqueueCopyBufferRect**
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hBufferSrc`
+///         + `NULL == hBufferDst`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
 ///     - ::UR_RESULT_ERROR_INVALID_EVENT
 ///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
 ///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
@@ -5503,6 +6888,17 @@ ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemBufferCopyRect(hQueue, hBufferSrc,
+                                                      hBufferDst, srcOrigin,
+                                                      dstOrigin, region,
+                                                      srcRowPitch,
+                                                      srcSlicePitch,
+                                                      dstRowPitch,
+                                                      dstSlicePitch,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, phEvent);
+#else
     auto pfnMemBufferCopyRect =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferCopyRect;
     if (nullptr == pfnMemBufferCopyRect) {
@@ -5513,6 +6909,7 @@ ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
                                 dstOrigin, region, srcRowPitch, srcSlicePitch,
                                 dstRowPitch, dstSlicePitch, numEventsInWaitList,
                                 phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5571,6 +6968,12 @@ ur_result_t UR_APICALL urEnqueueMemBufferFill(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemBufferFill(hQueue, hBuffer, pPattern,
+                                                  patternSize, offset, size,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+#else
     auto pfnMemBufferFill =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferFill;
     if (nullptr == pfnMemBufferFill) {
@@ -5580,6 +6983,7 @@ ur_result_t UR_APICALL urEnqueueMemBufferFill(
     return pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset,
                             size, numEventsInWaitList, phEventWaitList,
                             phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5642,6 +7046,13 @@ ur_result_t UR_APICALL urEnqueueMemImageRead(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemImageRead(hQueue, hImage, blockingRead,
+                                                 origin, region, rowPitch,
+                                                 slicePitch, pDst,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+#else
     auto pfnMemImageRead =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemImageRead;
     if (nullptr == pfnMemImageRead) {
@@ -5651,6 +7062,7 @@ ur_result_t UR_APICALL urEnqueueMemImageRead(
     return pfnMemImageRead(hQueue, hImage, blockingRead, origin, region,
                            rowPitch, slicePitch, pDst, numEventsInWaitList,
                            phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5714,6 +7126,13 @@ ur_result_t UR_APICALL urEnqueueMemImageWrite(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemImageWrite(hQueue, hImage, blockingWrite,
+                                                  origin, region, rowPitch,
+                                                  slicePitch, pSrc,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+#else
     auto pfnMemImageWrite =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemImageWrite;
     if (nullptr == pfnMemImageWrite) {
@@ -5723,6 +7142,7 @@ ur_result_t UR_APICALL urEnqueueMemImageWrite(
     return pfnMemImageWrite(hQueue, hImage, blockingWrite, origin, region,
                             rowPitch, slicePitch, pSrc, numEventsInWaitList,
                             phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5781,6 +7201,12 @@ ur_result_t UR_APICALL urEnqueueMemImageCopy(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemImageCopy(hQueue, hImageSrc, hImageDst,
+                                                 srcOrigin, dstOrigin, region,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+#else
     auto pfnMemImageCopy =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemImageCopy;
     if (nullptr == pfnMemImageCopy) {
@@ -5790,6 +7216,7 @@ ur_result_t UR_APICALL urEnqueueMemImageCopy(
     return pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin, dstOrigin,
                            region, numEventsInWaitList, phEventWaitList,
                            phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5854,6 +7281,13 @@ ur_result_t UR_APICALL urEnqueueMemBufferMap(
     void **ppRetMap ///< [out] return mapped pointer.  TODO: move it before
                     ///< numEventsInWaitList?
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemBufferMap(hQueue, hBuffer, blockingMap,
+                                                 mapFlags, offset, size,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent,
+                                                 ppRetMap);
+#else
     auto pfnMemBufferMap =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferMap;
     if (nullptr == pfnMemBufferMap) {
@@ -5863,6 +7297,7 @@ ur_result_t UR_APICALL urEnqueueMemBufferMap(
     return pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags, offset, size,
                            numEventsInWaitList, phEventWaitList, phEvent,
                            ppRetMap);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5911,6 +7346,11 @@ ur_result_t UR_APICALL urEnqueueMemUnmap(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueMemUnmap(hQueue, hMem, pMappedPtr,
+                                             numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+#else
     auto pfnMemUnmap = ur_lib::getContext()->urDdiTable.Enqueue.pfnMemUnmap;
     if (nullptr == pfnMemUnmap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -5918,6 +7358,7 @@ ur_result_t UR_APICALL urEnqueueMemUnmap(
 
     return pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
                        phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5971,6 +7412,11 @@ ur_result_t UR_APICALL urEnqueueUSMFill(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueUSMFill(hQueue, pMem, patternSize, pPattern,
+                                            size, numEventsInWaitList,
+                                            phEventWaitList, phEvent);
+#else
     auto pfnUSMFill = ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMFill;
     if (nullptr == pfnUSMFill) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -5978,6 +7424,7 @@ ur_result_t UR_APICALL urEnqueueUSMFill(
 
     return pfnUSMFill(hQueue, pMem, patternSize, pPattern, size,
                       numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6027,6 +7474,11 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueUSMMemcpy(hQueue, blocking, pDst, pSrc,
+                                              size, numEventsInWaitList,
+                                              phEventWaitList, phEvent);
+#else
     auto pfnUSMMemcpy = ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMMemcpy;
     if (nullptr == pfnUSMMemcpy) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -6034,6 +7486,7 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy(
 
     return pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size, numEventsInWaitList,
                         phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6087,6 +7540,11 @@ ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueUSMPrefetch(hQueue, pMem, size, flags,
+                                                numEventsInWaitList,
+                                                phEventWaitList, phEvent);
+#else
     auto pfnUSMPrefetch =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMPrefetch;
     if (nullptr == pfnUSMPrefetch) {
@@ -6095,6 +7553,7 @@ ur_result_t UR_APICALL urEnqueueUSMPrefetch(
 
     return pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
                           phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6136,12 +7595,17 @@ ur_result_t UR_APICALL urEnqueueUSMAdvise(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueUSMAdvise(hQueue, pMem, size, advice,
+                                              phEvent);
+#else
     auto pfnUSMAdvise = ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMAdvise;
     if (nullptr == pfnUSMAdvise) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6204,6 +7668,12 @@ ur_result_t UR_APICALL urEnqueueUSMFill2D(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueUSMFill2D(hQueue, pMem, pitch, patternSize,
+                                              pPattern, width, height,
+                                              numEventsInWaitList,
+                                              phEventWaitList, phEvent);
+#else
     auto pfnUSMFill2D = ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMFill2D;
     if (nullptr == pfnUSMFill2D) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -6211,6 +7681,7 @@ ur_result_t UR_APICALL urEnqueueUSMFill2D(
 
     return pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width,
                         height, numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6270,6 +7741,12 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueUSMMemcpy2D(hQueue, blocking, pDst,
+                                                dstPitch, pSrc, srcPitch, width,
+                                                height, numEventsInWaitList,
+                                                phEventWaitList, phEvent);
+#else
     auto pfnUSMMemcpy2D =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMMemcpy2D;
     if (nullptr == pfnUSMMemcpy2D) {
@@ -6279,6 +7756,7 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     return pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch,
                           width, height, numEventsInWaitList, phEventWaitList,
                           phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6325,6 +7803,11 @@ ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueDeviceGlobalVariableWrite(
+        hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
+        numEventsInWaitList, phEventWaitList, phEvent);
+#else
     auto pfnDeviceGlobalVariableWrite =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnDeviceGlobalVariableWrite;
     if (nullptr == pfnDeviceGlobalVariableWrite) {
@@ -6334,6 +7817,7 @@ ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     return pfnDeviceGlobalVariableWrite(
         hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
         numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6380,6 +7864,11 @@ ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueDeviceGlobalVariableRead(
+        hQueue, hProgram, name, blockingRead, count, offset, pDst,
+        numEventsInWaitList, phEventWaitList, phEvent);
+#else
     auto pfnDeviceGlobalVariableRead =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnDeviceGlobalVariableRead;
     if (nullptr == pfnDeviceGlobalVariableRead) {
@@ -6389,6 +7878,7 @@ ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     return pfnDeviceGlobalVariableRead(hQueue, hProgram, name, blockingRead,
                                        count, offset, pDst, numEventsInWaitList,
                                        phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6438,6 +7928,12 @@ ur_result_t UR_APICALL urEnqueueReadHostPipe(
                 ///< command
     ///< and can be used to query or queue a wait for this command to complete.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueReadHostPipe(hQueue, hProgram, pipe_symbol,
+                                                 blocking, pDst, size,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+#else
     auto pfnReadHostPipe =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnReadHostPipe;
     if (nullptr == pfnReadHostPipe) {
@@ -6446,6 +7942,7 @@ ur_result_t UR_APICALL urEnqueueReadHostPipe(
 
     return pfnReadHostPipe(hQueue, hProgram, pipe_symbol, blocking, pDst, size,
                            numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6495,6 +7992,12 @@ ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         phEvent ///< [out][optional] returns an event object that identifies this write command
     ///< and can be used to query or queue a wait for this command to complete.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueWriteHostPipe(hQueue, hProgram, pipe_symbol,
+                                                  blocking, pSrc, size,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+#else
     auto pfnWriteHostPipe =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnWriteHostPipe;
     if (nullptr == pfnWriteHostPipe) {
@@ -6503,6 +8006,7 @@ ur_result_t UR_APICALL urEnqueueWriteHostPipe(
 
     return pfnWriteHostPipe(hQueue, hProgram, pipe_symbol, blocking, pSrc, size,
                             numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6565,6 +8069,12 @@ ur_result_t UR_APICALL urUSMPitchedAllocExp(
     void **ppMem,         ///< [out] pointer to USM shared memory object
     size_t *pResultPitch  ///< [out] pitch of the allocation
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMPitchedAllocExp(hContext, hDevice, pUSMDesc,
+                                                pool, widthInBytes, height,
+                                                elementSizeBytes, ppMem,
+                                                pResultPitch);
+#else
     auto pfnPitchedAllocExp =
         ur_lib::getContext()->urDdiTable.USMExp.pfnPitchedAllocExp;
     if (nullptr == pfnPitchedAllocExp) {
@@ -6573,6 +8083,7 @@ ur_result_t UR_APICALL urUSMPitchedAllocExp(
 
     return pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool, widthInBytes,
                               height, elementSizeBytes, ppMem, pResultPitch);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6600,6 +8111,10 @@ ur_result_t UR_APICALL urBindlessImagesUnsampledImageHandleDestroyExp(
     ur_exp_image_native_handle_t
         hImage ///< [in][release] pointer to handle of image object to destroy
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesUnsampledImageHandleDestroyExp(
+        hContext, hDevice, hImage);
+#else
     auto pfnUnsampledImageHandleDestroyExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnUnsampledImageHandleDestroyExp;
@@ -6608,6 +8123,7 @@ ur_result_t UR_APICALL urBindlessImagesUnsampledImageHandleDestroyExp(
     }
 
     return pfnUnsampledImageHandleDestroyExp(hContext, hDevice, hImage);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6635,6 +8151,10 @@ ur_result_t UR_APICALL urBindlessImagesSampledImageHandleDestroyExp(
     ur_exp_image_native_handle_t
         hImage ///< [in][release] pointer to handle of image object to destroy
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesSampledImageHandleDestroyExp(
+        hContext, hDevice, hImage);
+#else
     auto pfnSampledImageHandleDestroyExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnSampledImageHandleDestroyExp;
@@ -6643,6 +8163,7 @@ ur_result_t UR_APICALL urBindlessImagesSampledImageHandleDestroyExp(
     }
 
     return pfnSampledImageHandleDestroyExp(hContext, hDevice, hImage);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6682,6 +8203,12 @@ ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
     ur_exp_image_mem_native_handle_t
         *phImageMem ///< [out] pointer to handle of image memory allocated
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesImageAllocateExp(hContext, hDevice,
+                                                            pImageFormat,
+                                                            pImageDesc,
+                                                            phImageMem);
+#else
     auto pfnImageAllocateExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnImageAllocateExp;
     if (nullptr == pfnImageAllocateExp) {
@@ -6690,6 +8217,7 @@ ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
 
     return pfnImageAllocateExp(hContext, hDevice, pImageFormat, pImageDesc,
                                phImageMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6717,6 +8245,10 @@ ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
     ur_exp_image_mem_native_handle_t
         hImageMem ///< [in][release] handle of image memory to be freed
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesImageFreeExp(hContext, hDevice,
+                                                        hImageMem);
+#else
     auto pfnImageFreeExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnImageFreeExp;
     if (nullptr == pfnImageFreeExp) {
@@ -6724,6 +8256,7 @@ ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
     }
 
     return pfnImageFreeExp(hContext, hDevice, hImageMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6765,6 +8298,14 @@ ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
     ur_exp_image_native_handle_t
         *phImage ///< [out] pointer to handle of image object created
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesUnsampledImageCreateExp(hContext,
+                                                                   hDevice,
+                                                                   hImageMem,
+                                                                   pImageFormat,
+                                                                   pImageDesc,
+                                                                   phImage);
+#else
     auto pfnUnsampledImageCreateExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnUnsampledImageCreateExp;
@@ -6774,6 +8315,7 @@ ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
 
     return pfnUnsampledImageCreateExp(hContext, hDevice, hImageMem,
                                       pImageFormat, pImageDesc, phImage);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6818,6 +8360,15 @@ ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
     ur_exp_image_native_handle_t
         *phImage ///< [out] pointer to handle of image object created
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesSampledImageCreateExp(hContext,
+                                                                 hDevice,
+                                                                 hImageMem,
+                                                                 pImageFormat,
+                                                                 pImageDesc,
+                                                                 hSampler,
+                                                                 phImage);
+#else
     auto pfnSampledImageCreateExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnSampledImageCreateExp;
@@ -6827,6 +8378,7 @@ ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
 
     return pfnSampledImageCreateExp(hContext, hDevice, hImageMem, pImageFormat,
                                     pImageDesc, hSampler, phImage);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6891,6 +8443,18 @@ ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesImageCopyExp(hQueue, pSrc, pDst,
+                                                        pSrcImageDesc,
+                                                        pDstImageDesc,
+                                                        pSrcImageFormat,
+                                                        pDstImageFormat,
+                                                        pCopyRegion,
+                                                        imageCopyFlags,
+                                                        numEventsInWaitList,
+                                                        phEventWaitList,
+                                                        phEvent);
+#else
     auto pfnImageCopyExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnImageCopyExp;
     if (nullptr == pfnImageCopyExp) {
@@ -6901,6 +8465,7 @@ ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
                            pSrcImageFormat, pDstImageFormat, pCopyRegion,
                            imageCopyFlags, numEventsInWaitList, phEventWaitList,
                            phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6934,6 +8499,11 @@ ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
     void *pPropValue,         ///< [out][optional] returned query value
     size_t *pPropSizeRet      ///< [out][optional] returned query value size
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesImageGetInfoExp(hContext, hImageMem,
+                                                           propName, pPropValue,
+                                                           pPropSizeRet);
+#else
     auto pfnImageGetInfoExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnImageGetInfoExp;
     if (nullptr == pfnImageGetInfoExp) {
@@ -6942,6 +8512,7 @@ ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
 
     return pfnImageGetInfoExp(hContext, hImageMem, propName, pPropValue,
                               pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6974,6 +8545,12 @@ ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
     ur_exp_image_mem_native_handle_t
         *phImageMem ///< [out] returning memory handle to the individual image
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesMipmapGetLevelExp(hContext, hDevice,
+                                                             hImageMem,
+                                                             mipmapLevel,
+                                                             phImageMem);
+#else
     auto pfnMipmapGetLevelExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnMipmapGetLevelExp;
     if (nullptr == pfnMipmapGetLevelExp) {
@@ -6982,6 +8559,7 @@ ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
 
     return pfnMipmapGetLevelExp(hContext, hDevice, hImageMem, mipmapLevel,
                                 phImageMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7009,6 +8587,10 @@ ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
     ur_exp_image_mem_native_handle_t
         hMem ///< [in][release] handle of image memory to be freed
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesMipmapFreeExp(hContext, hDevice,
+                                                         hMem);
+#else
     auto pfnMipmapFreeExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnMipmapFreeExp;
     if (nullptr == pfnMipmapFreeExp) {
@@ -7016,6 +8598,7 @@ ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
     }
 
     return pfnMipmapFreeExp(hContext, hDevice, hMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7054,6 +8637,11 @@ ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
     ur_exp_external_mem_handle_t
         *phExternalMem ///< [out] external memory handle to the external memory
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesImportExternalMemoryExp(
+        hContext, hDevice, size, memHandleType, pExternalMemDesc,
+        phExternalMem);
+#else
     auto pfnImportExternalMemoryExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnImportExternalMemoryExp;
@@ -7063,6 +8651,7 @@ ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
 
     return pfnImportExternalMemoryExp(hContext, hDevice, size, memHandleType,
                                       pExternalMemDesc, phExternalMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7101,6 +8690,14 @@ ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
     ur_exp_image_mem_native_handle_t *
         phImageMem ///< [out] image memory handle to the externally allocated memory
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesMapExternalArrayExp(hContext,
+                                                               hDevice,
+                                                               pImageFormat,
+                                                               pImageDesc,
+                                                               hExternalMem,
+                                                               phImageMem);
+#else
     auto pfnMapExternalArrayExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnMapExternalArrayExp;
@@ -7110,6 +8707,7 @@ ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
 
     return pfnMapExternalArrayExp(hContext, hDevice, pImageFormat, pImageDesc,
                                   hExternalMem, phImageMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7143,6 +8741,10 @@ ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         hExternalMem, ///< [in] external memory handle to the external memory
     void **ppRetMem   ///< [out] pointer of the externally allocated memory
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesMapExternalLinearMemoryExp(
+        hContext, hDevice, offset, size, hExternalMem, ppRetMem);
+#else
     auto pfnMapExternalLinearMemoryExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnMapExternalLinearMemoryExp;
@@ -7152,6 +8754,7 @@ ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
 
     return pfnMapExternalLinearMemoryExp(hContext, hDevice, offset, size,
                                          hExternalMem, ppRetMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7180,6 +8783,10 @@ ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
     ur_exp_external_mem_handle_t
         hExternalMem ///< [in][release] handle of external memory to be destroyed
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesReleaseExternalMemoryExp(
+        hContext, hDevice, hExternalMem);
+#else
     auto pfnReleaseExternalMemoryExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnReleaseExternalMemoryExp;
@@ -7188,6 +8795,7 @@ ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
     }
 
     return pfnReleaseExternalMemoryExp(hContext, hDevice, hExternalMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7224,6 +8832,11 @@ ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
     ur_exp_external_semaphore_handle_t *
         phExternalSemaphore ///< [out] external semaphore handle to the external semaphore
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesImportExternalSemaphoreExp(
+        hContext, hDevice, semHandleType, pExternalSemaphoreDesc,
+        phExternalSemaphore);
+#else
     auto pfnImportExternalSemaphoreExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnImportExternalSemaphoreExp;
@@ -7234,6 +8847,7 @@ ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
     return pfnImportExternalSemaphoreExp(hContext, hDevice, semHandleType,
                                          pExternalSemaphoreDesc,
                                          phExternalSemaphore);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7262,6 +8876,10 @@ ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
     ur_exp_external_semaphore_handle_t
         hExternalSemaphore ///< [in][release] handle of external semaphore to be destroyed
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesReleaseExternalSemaphoreExp(
+        hContext, hDevice, hExternalSemaphore);
+#else
     auto pfnReleaseExternalSemaphoreExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnReleaseExternalSemaphoreExp;
@@ -7271,6 +8889,7 @@ ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
 
     return pfnReleaseExternalSemaphoreExp(hContext, hDevice,
                                           hExternalSemaphore);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7313,6 +8932,11 @@ ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesWaitExternalSemaphoreExp(
+        hQueue, hSemaphore, hasWaitValue, waitValue, numEventsInWaitList,
+        phEventWaitList, phEvent);
+#else
     auto pfnWaitExternalSemaphoreExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnWaitExternalSemaphoreExp;
@@ -7323,6 +8947,7 @@ ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
     return pfnWaitExternalSemaphoreExp(hQueue, hSemaphore, hasWaitValue,
                                        waitValue, numEventsInWaitList,
                                        phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7366,6 +8991,11 @@ ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urBindlessImagesSignalExternalSemaphoreExp(
+        hQueue, hSemaphore, hasSignalValue, signalValue, numEventsInWaitList,
+        phEventWaitList, phEvent);
+#else
     auto pfnSignalExternalSemaphoreExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnSignalExternalSemaphoreExp;
@@ -7376,6 +9006,7 @@ ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
     return pfnSignalExternalSemaphoreExp(hQueue, hSemaphore, hasSignalValue,
                                          signalValue, numEventsInWaitList,
                                          phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7410,6 +9041,11 @@ ur_result_t UR_APICALL urCommandBufferCreateExp(
     ur_exp_command_buffer_handle_t
         *phCommandBuffer ///< [out] Pointer to command-Buffer handle.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferCreateExp(hContext, hDevice,
+                                                    pCommandBufferDesc,
+                                                    phCommandBuffer);
+#else
     auto pfnCreateExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnCreateExp;
     if (nullptr == pfnCreateExp) {
@@ -7417,6 +9053,7 @@ ur_result_t UR_APICALL urCommandBufferCreateExp(
     }
 
     return pfnCreateExp(hContext, hDevice, pCommandBufferDesc, phCommandBuffer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7438,6 +9075,9 @@ ur_result_t UR_APICALL urCommandBufferRetainExp(
     ur_exp_command_buffer_handle_t
         hCommandBuffer ///< [in][retain] Handle of the command-buffer object.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferRetainExp(hCommandBuffer);
+#else
     auto pfnRetainExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnRetainExp;
     if (nullptr == pfnRetainExp) {
@@ -7445,6 +9085,7 @@ ur_result_t UR_APICALL urCommandBufferRetainExp(
     }
 
     return pfnRetainExp(hCommandBuffer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7467,6 +9108,9 @@ ur_result_t UR_APICALL urCommandBufferReleaseExp(
     ur_exp_command_buffer_handle_t
         hCommandBuffer ///< [in][release] Handle of the command-buffer object.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferReleaseExp(hCommandBuffer);
+#else
     auto pfnReleaseExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnReleaseExp;
     if (nullptr == pfnReleaseExp) {
@@ -7474,6 +9118,7 @@ ur_result_t UR_APICALL urCommandBufferReleaseExp(
     }
 
     return pfnReleaseExp(hCommandBuffer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7496,6 +9141,9 @@ ur_result_t UR_APICALL urCommandBufferFinalizeExp(
     ur_exp_command_buffer_handle_t
         hCommandBuffer ///< [in] Handle of the command-buffer object.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferFinalizeExp(hCommandBuffer);
+#else
     auto pfnFinalizeExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnFinalizeExp;
     if (nullptr == pfnFinalizeExp) {
@@ -7503,6 +9151,7 @@ ur_result_t UR_APICALL urCommandBufferFinalizeExp(
     }
 
     return pfnFinalizeExp(hCommandBuffer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7567,6 +9216,12 @@ ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendKernelLaunchExp(
+        hCommandBuffer, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numKernelAlternatives, phKernelAlternatives,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, phCommand);
+#else
     auto pfnAppendKernelLaunchExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendKernelLaunchExp;
@@ -7578,6 +9233,7 @@ ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         hCommandBuffer, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
         pLocalWorkSize, numKernelAlternatives, phKernelAlternatives,
         numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7620,6 +9276,11 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendUSMMemcpyExp(
+        hCommandBuffer, pDst, pSrc, size, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+#else
     auto pfnAppendUSMMemcpyExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnAppendUSMMemcpyExp;
     if (nullptr == pfnAppendUSMMemcpyExp) {
@@ -7629,6 +9290,7 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
     return pfnAppendUSMMemcpyExp(hCommandBuffer, pDst, pSrc, size,
                                  numSyncPointsInWaitList, pSyncPointWaitList,
                                  pSyncPoint);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7675,6 +9337,11 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] sync point associated with this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendUSMFillExp(
+        hCommandBuffer, pMemory, pPattern, patternSize, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+#else
     auto pfnAppendUSMFillExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnAppendUSMFillExp;
     if (nullptr == pfnAppendUSMFillExp) {
@@ -7684,6 +9351,7 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
     return pfnAppendUSMFillExp(hCommandBuffer, pMemory, pPattern, patternSize,
                                size, numSyncPointsInWaitList,
                                pSyncPointWaitList, pSyncPoint);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7724,6 +9392,11 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendMemBufferCopyExp(
+        hCommandBuffer, hSrcMem, hDstMem, srcOffset, dstOffset, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+#else
     auto pfnAppendMemBufferCopyExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferCopyExp;
@@ -7734,6 +9407,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
     return pfnAppendMemBufferCopyExp(
         hCommandBuffer, hSrcMem, hDstMem, srcOffset, dstOffset, size,
         numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7775,6 +9449,11 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendMemBufferWriteExp(
+        hCommandBuffer, hBuffer, offset, size, pSrc, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+#else
     auto pfnAppendMemBufferWriteExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferWriteExp;
@@ -7785,6 +9464,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
     return pfnAppendMemBufferWriteExp(hCommandBuffer, hBuffer, offset, size,
                                       pSrc, numSyncPointsInWaitList,
                                       pSyncPointWaitList, pSyncPoint);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7825,6 +9505,11 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendMemBufferReadExp(
+        hCommandBuffer, hBuffer, offset, size, pDst, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+#else
     auto pfnAppendMemBufferReadExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferReadExp;
@@ -7835,6 +9520,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
     return pfnAppendMemBufferReadExp(hCommandBuffer, hBuffer, offset, size,
                                      pDst, numSyncPointsInWaitList,
                                      pSyncPointWaitList, pSyncPoint);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7882,6 +9568,12 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendMemBufferCopyRectExp(
+        hCommandBuffer, hSrcMem, hDstMem, srcOrigin, dstOrigin, region,
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+#else
     auto pfnAppendMemBufferCopyRectExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferCopyRectExp;
@@ -7893,6 +9585,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         hCommandBuffer, hSrcMem, hDstMem, srcOrigin, dstOrigin, region,
         srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
         numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7947,6 +9640,12 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendMemBufferWriteRectExp(
+        hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+#else
     auto pfnAppendMemBufferWriteRectExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferWriteRectExp;
@@ -7958,6 +9657,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
         bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
         numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8010,6 +9710,12 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] Sync point associated with this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendMemBufferReadRectExp(
+        hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+#else
     auto pfnAppendMemBufferReadRectExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferReadRectExp;
@@ -8021,6 +9727,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
         bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
         numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8065,6 +9772,11 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] sync point associated with this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendMemBufferFillExp(
+        hCommandBuffer, hBuffer, pPattern, patternSize, offset, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+#else
     auto pfnAppendMemBufferFillExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferFillExp;
@@ -8075,6 +9787,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
     return pfnAppendMemBufferFillExp(
         hCommandBuffer, hBuffer, pPattern, patternSize, offset, size,
         numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8123,6 +9836,11 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] sync point associated with this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendUSMPrefetchExp(
+        hCommandBuffer, pMemory, size, flags, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+#else
     auto pfnAppendUSMPrefetchExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendUSMPrefetchExp;
@@ -8133,6 +9851,7 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
     return pfnAppendUSMPrefetchExp(hCommandBuffer, pMemory, size, flags,
                                    numSyncPointsInWaitList, pSyncPointWaitList,
                                    pSyncPoint);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8181,6 +9900,11 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
     ur_exp_command_buffer_sync_point_t *
         pSyncPoint ///< [out][optional] sync point associated with this command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferAppendUSMAdviseExp(
+        hCommandBuffer, pMemory, size, advice, numSyncPointsInWaitList,
+        pSyncPointWaitList, pSyncPoint);
+#else
     auto pfnAppendUSMAdviseExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnAppendUSMAdviseExp;
     if (nullptr == pfnAppendUSMAdviseExp) {
@@ -8190,6 +9914,7 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
     return pfnAppendUSMAdviseExp(hCommandBuffer, pMemory, size, advice,
                                  numSyncPointsInWaitList, pSyncPointWaitList,
                                  pSyncPoint);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8228,6 +9953,11 @@ ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command-buffer execution instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferEnqueueExp(hCommandBuffer, hQueue,
+                                                     numEventsInWaitList,
+                                                     phEventWaitList, phEvent);
+#else
     auto pfnEnqueueExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnEnqueueExp;
     if (nullptr == pfnEnqueueExp) {
@@ -8236,6 +9966,7 @@ ur_result_t UR_APICALL urCommandBufferEnqueueExp(
 
     return pfnEnqueueExp(hCommandBuffer, hQueue, numEventsInWaitList,
                          phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8257,6 +9988,9 @@ ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
     ur_exp_command_buffer_command_handle_t
         hCommand ///< [in][retain] Handle of the command-buffer command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferRetainCommandExp(hCommand);
+#else
     auto pfnRetainCommandExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnRetainCommandExp;
     if (nullptr == pfnRetainCommandExp) {
@@ -8264,6 +9998,7 @@ ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
     }
 
     return pfnRetainCommandExp(hCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8286,6 +10021,9 @@ ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
     ur_exp_command_buffer_command_handle_t
         hCommand ///< [in][release] Handle of the command-buffer command.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferReleaseCommandExp(hCommand);
+#else
     auto pfnReleaseCommandExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnReleaseCommandExp;
     if (nullptr == pfnReleaseCommandExp) {
@@ -8293,6 +10031,7 @@ ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
     }
 
     return pfnReleaseCommandExp(hCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8335,6 +10074,10 @@ ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
     const ur_exp_command_buffer_update_kernel_launch_desc_t *
         pUpdateKernelLaunch ///< [in] Struct defining how the kernel command is to be updated.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferUpdateKernelLaunchExp(
+        hCommand, pUpdateKernelLaunch);
+#else
     auto pfnUpdateKernelLaunchExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnUpdateKernelLaunchExp;
@@ -8343,6 +10086,7 @@ ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
     }
 
     return pfnUpdateKernelLaunchExp(hCommand, pUpdateKernelLaunch);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8383,6 +10127,11 @@ ur_result_t UR_APICALL urCommandBufferGetInfoExp(
     size_t *
         pPropSizeRet ///< [out][optional] bytes returned in command-buffer property
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferGetInfoExp(hCommandBuffer, propName,
+                                                     propSize, pPropValue,
+                                                     pPropSizeRet);
+#else
     auto pfnGetInfoExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnGetInfoExp;
     if (nullptr == pfnGetInfoExp) {
@@ -8391,6 +10140,7 @@ ur_result_t UR_APICALL urCommandBufferGetInfoExp(
 
     return pfnGetInfoExp(hCommandBuffer, propName, propSize, pPropValue,
                          pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8431,6 +10181,12 @@ ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
     size_t *
         pPropSizeRet ///< [out][optional] bytes returned in command-buffer command property
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urCommandBufferCommandGetInfoExp(hCommand, propName,
+                                                            propSize,
+                                                            pPropValue,
+                                                            pPropSizeRet);
+#else
     auto pfnCommandGetInfoExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnCommandGetInfoExp;
     if (nullptr == pfnCommandGetInfoExp) {
@@ -8439,6 +10195,7 @@ ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
 
     return pfnCommandGetInfoExp(hCommand, propName, propSize, pPropValue,
                                 pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8498,6 +10255,11 @@ ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueCooperativeKernelLaunchExp(
+        hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+#else
     auto pfnCooperativeKernelLaunchExp =
         ur_lib::getContext()
             ->urDdiTable.EnqueueExp.pfnCooperativeKernelLaunchExp;
@@ -8508,6 +10270,7 @@ ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
     return pfnCooperativeKernelLaunchExp(
         hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
         pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8535,6 +10298,10 @@ ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     ///< that will be used when the kernel is launched
     uint32_t *pGroupCountRet ///< [out] pointer to maximum number of groups
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urKernelSuggestMaxCooperativeGroupCountExp(
+        hKernel, localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
+#else
     auto pfnSuggestMaxCooperativeGroupCountExp =
         ur_lib::getContext()
             ->urDdiTable.KernelExp.pfnSuggestMaxCooperativeGroupCountExp;
@@ -8544,6 +10311,7 @@ ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
 
     return pfnSuggestMaxCooperativeGroupCountExp(
         hKernel, localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8584,6 +10352,12 @@ ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     ///< Querying `UR_PROFILING_INFO_COMMAND_START` or `UR_PROFILING_INFO_COMMAND_END`
     ///< reports the timestamp recorded when the command is executed on the device.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueTimestampRecordingExp(hQueue, blocking,
+                                                          numEventsInWaitList,
+                                                          phEventWaitList,
+                                                          phEvent);
+#else
     auto pfnTimestampRecordingExp =
         ur_lib::getContext()->urDdiTable.EnqueueExp.pfnTimestampRecordingExp;
     if (nullptr == pfnTimestampRecordingExp) {
@@ -8592,6 +10366,7 @@ ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
 
     return pfnTimestampRecordingExp(hQueue, blocking, numEventsInWaitList,
                                     phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8671,6 +10446,12 @@ ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< kernel execution instance.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueKernelLaunchCustomExp(
+        hQueue, hKernel, workDim, pGlobalWorkSize, pLocalWorkSize,
+        numPropsInLaunchPropList, launchPropList, numEventsInWaitList,
+        phEventWaitList, phEvent);
+#else
     auto pfnKernelLaunchCustomExp =
         ur_lib::getContext()->urDdiTable.EnqueueExp.pfnKernelLaunchCustomExp;
     if (nullptr == pfnKernelLaunchCustomExp) {
@@ -8681,6 +10462,7 @@ ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
                                     pLocalWorkSize, numPropsInLaunchPropList,
                                     launchPropList, numEventsInWaitList,
                                     phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8720,12 +10502,17 @@ ur_result_t UR_APICALL urProgramBuildExp(
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramBuildExp(hProgram, numDevices, phDevices,
+                                             pOptions);
+#else
     auto pfnBuildExp = ur_lib::getContext()->urDdiTable.ProgramExp.pfnBuildExp;
     if (nullptr == pfnBuildExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnBuildExp(hProgram, numDevices, phDevices, pOptions);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8765,6 +10552,10 @@ ur_result_t UR_APICALL urProgramCompileExp(
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramCompileExp(hProgram, numDevices, phDevices,
+                                               pOptions);
+#else
     auto pfnCompileExp =
         ur_lib::getContext()->urDdiTable.ProgramExp.pfnCompileExp;
     if (nullptr == pfnCompileExp) {
@@ -8772,6 +10563,7 @@ ur_result_t UR_APICALL urProgramCompileExp(
     }
 
     return pfnCompileExp(hProgram, numDevices, phDevices, pOptions);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8828,6 +10620,11 @@ ur_result_t UR_APICALL urProgramLinkExp(
     if (nullptr != phProgram) {
         *phProgram = nullptr;
     }
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urProgramLinkExp(hContext, numDevices, phDevices,
+                                            count, phPrograms, pOptions,
+                                            phProgram);
+#else
     auto pfnLinkExp = ur_lib::getContext()->urDdiTable.ProgramExp.pfnLinkExp;
     if (nullptr == pfnLinkExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -8835,6 +10632,7 @@ ur_result_t UR_APICALL urProgramLinkExp(
 
     return pfnLinkExp(hContext, numDevices, phDevices, count, phPrograms,
                       pOptions, phProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8861,12 +10659,16 @@ ur_result_t UR_APICALL urUSMImportExp(
     void *pMem,                   ///< [in] pointer to host memory object
     size_t size ///< [in] size in bytes of the host memory object to be imported
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMImportExp(hContext, pMem, size);
+#else
     auto pfnImportExp = ur_lib::getContext()->urDdiTable.USMExp.pfnImportExp;
     if (nullptr == pfnImportExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnImportExp(hContext, pMem, size);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8891,12 +10693,16 @@ ur_result_t UR_APICALL urUSMReleaseExp(
     ur_context_handle_t hContext, ///< [in] handle of the context object
     void *pMem                    ///< [in] pointer to host memory object
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMReleaseExp(hContext, pMem);
+#else
     auto pfnReleaseExp = ur_lib::getContext()->urDdiTable.USMExp.pfnReleaseExp;
     if (nullptr == pfnReleaseExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnReleaseExp(hContext, pMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8941,6 +10747,10 @@ ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
         commandDevice,            ///< [in] handle of the command device object
     ur_device_handle_t peerDevice ///< [in] handle of the peer device object
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUsmP2PEnablePeerAccessExp(commandDevice,
+                                                       peerDevice);
+#else
     auto pfnEnablePeerAccessExp =
         ur_lib::getContext()->urDdiTable.UsmP2PExp.pfnEnablePeerAccessExp;
     if (nullptr == pfnEnablePeerAccessExp) {
@@ -8948,6 +10758,7 @@ ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
     }
 
     return pfnEnablePeerAccessExp(commandDevice, peerDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8993,6 +10804,10 @@ ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
         commandDevice,            ///< [in] handle of the command device object
     ur_device_handle_t peerDevice ///< [in] handle of the peer device object
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUsmP2PDisablePeerAccessExp(commandDevice,
+                                                        peerDevice);
+#else
     auto pfnDisablePeerAccessExp =
         ur_lib::getContext()->urDdiTable.UsmP2PExp.pfnDisablePeerAccessExp;
     if (nullptr == pfnDisablePeerAccessExp) {
@@ -9000,6 +10815,7 @@ ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
     }
 
     return pfnDisablePeerAccessExp(commandDevice, peerDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -9010,6 +10826,9 @@ ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
 /// @details
 ///     - Queries the peer access capabilities from the command device to the
 ///       peer device according to the query `propName`.
+///     - The link queries describe the topology between the devices, and the
+///       copy route queries give the path the adapter finds best for copies of
+///       device memory between them, so that callers can route their copies.
 ///
 /// @remarks
 ///   _Analogues_
@@ -9024,7 +10843,7 @@ ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
 ///         + `NULL == commandDevice`
 ///         + `NULL == peerDevice`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED < propName`
+///         + `::UR_EXP_PEER_INFO_UR_PEER_COPY_INTERMEDIATE_DEVICE < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -9051,6 +10870,12 @@ ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUsmP2PPeerAccessGetInfoExp(commandDevice,
+                                                        peerDevice, propName,
+                                                        propSize, pPropValue,
+                                                        pPropSizeRet);
+#else
     auto pfnPeerAccessGetInfoExp =
         ur_lib::getContext()->urDdiTable.UsmP2PExp.pfnPeerAccessGetInfoExp;
     if (nullptr == pfnPeerAccessGetInfoExp) {
@@ -9059,6 +10884,169 @@ ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
 
     return pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName,
                                    propSize, pPropValue, pPropSizeRet);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Release the memory cached by USM pools back to the device
+///
+/// @details
+///     - Returns the free memory cached by hPool, or by every pool of hContext
+///       if hPool is NULL, to the driver.
+///     - Memory backing live allocations is never released.
+///     - Pools may keep up to minBytesToKeep bytes of cached memory each so
+///       that subsequent allocations don't have to go to the driver.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support trimming USM pools.
+ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM pool to trim, NULL trims every pool of hContext
+    size_t minBytesToKeep ///< [in] number of cached bytes each pool may keep
+    ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urUSMPoolTrimExp(hContext, hPool, minBytesToKeep);
+#else
+    auto pfnPoolTrimExp =
+        ur_lib::getContext()->urDdiTable.USMExp.pfnPoolTrimExp;
+    if (nullptr == pfnPoolTrimExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnPoolTrimExp(hContext, hPool, minBytesToKeep);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Allocate device memory which can grow without changing its address
+///
+/// @details
+///     - Reserves maxSize bytes of virtual address space in hContext, and
+///       backs the first size bytes of it with physical memory of hDevice.
+///     - The allocation is resized with ::urUSMGrowableResizeExp and freed
+///       with ::urUSMGrowableFreeExp, not with ::urUSMFree.
+///     - Implemented by the loader over the virtual memory APIs, it is
+///       supported by every adapter which supports them.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///         + `NULL == hDevice`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == ppMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_DEVICE
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `maxSize == 0`
+///         + `size > maxSize`
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support virtual memory.
+ur_result_t UR_APICALL urUSMGrowableAllocExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device object the physical memory is allocated on
+    size_t
+        maxSize, ///< [in] size in bytes of the virtual address range to reserve, the
+    ///< allocation can grow up to it
+    size_t
+        size, ///< [in] size in bytes of the allocation to back with physical memory
+    void **ppMem ///< [out] pointer to the start of the allocation
+    ) try {
+    return ur_lib::urUSMGrowableAllocExp(hContext, hDevice, maxSize, size,
+                                         ppMem);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Change the size of the memory backing a growable allocation
+///
+/// @details
+///     - Growing maps physical memory after the end of the allocation, the
+///       address and the contents of the allocation are kept.
+///     - Sizes are rounded up to the recommended granularity of the virtual
+///       memory, shrinking releases the physical memory mapped wholly past
+///       size.
+///     - The application must ensure no command accessing the resized range
+///       is in flight.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If pMem isn't a growable allocation of hContext.
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + If size is larger than the maxSize the allocation was made with.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urUSMGrowableResizeExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *
+        pMem, ///< [in] pointer to the start of the allocation returned by
+    ///< ::urUSMGrowableAllocExp
+    size_t size ///< [in] new size in bytes of the allocation
+    ) try {
+    return ur_lib::urUSMGrowableResizeExp(hContext, pMem, size);
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Free a growable allocation
+///
+/// @details
+///     - Unmaps and releases the physical memory of the allocation and frees
+///       its virtual address range.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If pMem isn't a growable allocation of hContext.
+ur_result_t UR_APICALL urUSMGrowableFreeExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *
+        pMem ///< [in] pointer to the start of the allocation returned by
+    ///< ::urUSMGrowableAllocExp
+    ) try {
+    return ur_lib::urUSMGrowableFreeExp(hContext, pMem);
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -9101,6 +11089,13 @@ ur_result_t UR_APICALL urEnqueueNativeCommandExp(
         phEvent ///< [out][optional] return an event object that identifies the work that has
     ///< been enqueued in nativeEnqueueFunc.
     ) try {
+#ifdef UR_STATIC_DISPATCH_LEVEL_ZERO
+    return ur::level_zero::urEnqueueNativeCommandExp(hQueue, pfnNativeEnqueue,
+                                                     data, numMemsInMemList,
+                                                     phMemList, pProperties,
+                                                     numEventsInWaitList,
+                                                     phEventWaitList, phEvent);
+#else
     auto pfnNativeCommandExp =
         ur_lib::getContext()->urDdiTable.EnqueueExp.pfnNativeCommandExp;
     if (nullptr == pfnNativeCommandExp) {
@@ -9110,6 +11105,7 @@ ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     return pfnNativeCommandExp(hQueue, pfnNativeEnqueue, data, numMemsInMemList,
                                phMemList, pProperties, numEventsInWaitList,
                                phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -11,11 +11,53 @@
 #ifdef UR_STATIC_ADAPTER_LEVEL_ZERO
 #include "adapters/level_zero/ur_interface_loader.hpp"
 #endif
+#ifdef UR_STATIC_ADAPTER_CUDA
+#include "adapters/cuda/ur_interface_loader.hpp"
+#endif
+#ifdef UR_STATIC_ADAPTER_HIP
+#include "adapters/hip/ur_interface_loader.hpp"
+#endif
+#ifdef UR_STATIC_ADAPTER_OPENCL
+#include "adapters/opencl/ur_interface_loader.hpp"
+#endif
+#ifdef UR_STATIC_ADAPTER_NATIVE_CPU
+#include "adapters/native_cpu/ur_interface_loader.hpp"
+#endif
+
+#include <chrono>
+#include <future>
 
 namespace ur_loader {
 ///////////////////////////////////////////////////////////////////////////////
 context_t *getContext() { return context_t::get_direct(); }
 
+namespace {
+/// An adapter linked into the loader itself, which is initialized by filling
+/// its DDI tables directly rather than through dlopen and dlsym.
+struct static_adapter_t {
+    const char *name;
+    ur_result_t (*getDdiTables)(ur_dditable_t *);
+};
+
+const std::vector<static_adapter_t> staticAdapters = {
+#ifdef UR_STATIC_ADAPTER_LEVEL_ZERO
+    {"level_zero", ur::level_zero::urAdapterGetDdiTables},
+#endif
+#ifdef UR_STATIC_ADAPTER_CUDA
+    {"cuda", ur::cuda::urAdapterGetDdiTables},
+#endif
+#ifdef UR_STATIC_ADAPTER_HIP
+    {"hip", ur::hip::urAdapterGetDdiTables},
+#endif
+#ifdef UR_STATIC_ADAPTER_OPENCL
+    {"opencl", ur::opencl::urAdapterGetDdiTables},
+#endif
+#ifdef UR_STATIC_ADAPTER_NATIVE_CPU
+    {"native_cpu", ur::native_cpu::urAdapterGetDdiTables},
+#endif
+};
+} // namespace
+
 ur_result_t context_t::init() {
 #ifdef _WIN32
     // Suppress system errors.
@@ -29,20 +71,33 @@ ur_result_t context_t::init() {
     UINT SavedMode = SetErrorMode(SEM_FAILCRITICALERRORS);
 #endif
 
-#ifdef UR_STATIC_ADAPTER_LEVEL_ZERO
     // If the adapters were force loaded, it means the user wants to use
     // a specific adapter library. Don't load any static adapters.
     if (!adapter_registry.adaptersForceLoaded()) {
-        auto &level_zero = platforms.emplace_back(nullptr);
-        ur::level_zero::urAdapterGetDdiTables(&level_zero.dditable.ur);
+        for (const auto &adapter : staticAdapters) {
+            auto start = startup_profile_t::clock::now();
+            auto &platform = platforms.emplace_back(nullptr);
+            platform.name = adapter.name;
+            platform.initStatus = adapter.getDdiTables(&platform.dditable.ur);
+            startupProfile.record(std::string("init ") + adapter.name, start);
+            UR_LOG(INFO, "initialized static adapter {} with status {}",
+                   adapter.name, platform.initStatus);
+        }
     }
-#endif
 
     for (const auto &adapterPaths : adapter_registry) {
         for (const auto &path : adapterPaths) {
+            auto start = std::chrono::steady_clock::now();
             auto handle = LibLoader::loadAdapterLibrary(path.string().c_str());
             if (handle) {
-                platforms.emplace_back(std::move(handle));
+                auto elapsed = std::chrono::steady_clock::now() - start;
+                UR_LOG(INFO, "adapter library {} loaded in {}us", path.string(),
+                       std::chrono::duration_cast<std::chrono::microseconds>(
+                           elapsed)
+                           .count());
+                auto &platform = platforms.emplace_back(std::move(handle));
+                platform.name = path.filename().string();
+                startupProfile.record("dlopen " + platform.name, start);
                 break;
             }
         }
@@ -54,11 +109,101 @@ ur_result_t context_t::init() {
 
     forceIntercept = getenv_tobool("UR_ENABLE_LOADER_INTERCEPT");
 
-    if (forceIntercept || platforms.size() > 1) {
+    // With exactly one adapter there is nothing to multiplex, so the loader
+    // hands out the adapter's DDI tables (and thus raw adapter handles)
+    // directly instead of wrapping every handle in an object_t.
+    if (forceIntercept || platforms.size() != 1) {
         intercept_enabled = true;
     }
+    UR_LOG(DEBUG, "loader intercept {}: {} adapter(s) loaded",
+           intercept_enabled ? "enabled" : "disabled (passthrough)",
+           platforms.size());
 
     return UR_RESULT_SUCCESS;
 }
 
+void context_t::adapterGet(uint32_t NumEntries, ur_adapter_handle_t *phAdapters,
+                           std::vector<platform_t *> &adapterPlatforms) {
+    adapterPlatforms.clear();
+    for (auto &platform : platforms) {
+        if (adapterPlatforms.size() == NumEntries) {
+            break;
+        }
+        if (platform.initStatus == UR_RESULT_SUCCESS) {
+            adapterPlatforms.push_back(&platform);
+        }
+    }
+
+    auto getAdapter = [this](platform_t *platform,
+                             ur_adapter_handle_t *phAdapter) {
+        auto start = std::chrono::steady_clock::now();
+        platform->dditable.ur.Global.pfnAdapterGet(1, phAdapter, nullptr);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        UR_LOG(INFO, "urAdapterGet of adapter {} took {}us", platform->name,
+               std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+                   .count());
+        startupProfile.record("urAdapterGet " + platform->name, start);
+    };
+
+    // Each adapter initializes its native driver on the first urAdapterGet,
+    // which dominates cold start when several runtimes are installed. The
+    // drivers are independent, so let them initialize side by side and keep
+    // the results in platform order.
+    std::vector<std::future<void>> pending;
+    for (size_t i = 1; i < adapterPlatforms.size(); ++i) {
+        try {
+            pending.emplace_back(std::async(std::launch::async, getAdapter,
+                                            adapterPlatforms[i],
+                                            &phAdapters[i]));
+        } catch (std::system_error &) {
+            // no thread available, initialize this adapter in-line
+            getAdapter(adapterPlatforms[i], &phAdapters[i]);
+        }
+    }
+
+    if (!adapterPlatforms.empty()) {
+        getAdapter(adapterPlatforms[0], &phAdapters[0]);
+    }
+    for (auto &future : pending) {
+        future.wait();
+    }
+}
+
+std::vector<std::pair<ur_result_t, uint32_t>>
+context_t::platformGetCounts(ur_adapter_handle_t *phAdapters,
+                             uint32_t NumAdapters) {
+    auto start = startup_profile_t::clock::now();
+    std::vector<std::pair<ur_result_t, uint32_t>> counts(
+        NumAdapters, {UR_RESULT_SUCCESS, 0});
+
+    auto getCount = [&](uint32_t i) {
+        auto dditable =
+            reinterpret_cast<ur_adapter_object_t *>(phAdapters[i])->dditable;
+        counts[i].first = dditable->ur.Platform.pfnGet(
+            &phAdapters[i], 1, 0, nullptr, &counts[i].second);
+    };
+
+    std::vector<std::future<void>> pending;
+    for (uint32_t i = 1; i < NumAdapters; ++i) {
+        try {
+            pending.emplace_back(std::async(std::launch::async, getCount, i));
+        } catch (std::system_error &) {
+            getCount(i);
+        }
+    }
+
+    if (NumAdapters > 0) {
+        getCount(0);
+    }
+    for (auto &future : pending) {
+        future.wait();
+    }
+
+    // the first platform enumeration concludes the startup sequence
+    startupProfile.record("urPlatformGet", start);
+    startupProfile.report();
+
+    return counts;
+}
+
 } // namespace ur_loader
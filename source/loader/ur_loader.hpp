@@ -15,6 +15,7 @@
 #include "ur_adapter_registry.hpp"
 #include "ur_ldrddi.hpp"
 #include "ur_lib_loader.hpp"
+#include "ur_startup_profile.hpp"
 
 namespace ur_loader {
 
@@ -23,6 +24,7 @@ struct platform_t {
         : handle(std::move(handle)) {}
 
     std::unique_ptr<HMODULE, LibLoader::lib_dtor> handle;
+    std::string name; ///< library file name, or static adapter name
     ur_result_t initStatus = UR_RESULT_SUCCESS;
     dditable_t dditable = {};
 };
@@ -33,15 +35,37 @@ class context_t : public AtomicSingleton<context_t> {
   public:
     ur_api_version_t version = UR_API_VERSION_CURRENT;
 
+    startup_profile_t startupProfile;
+
     platform_vector_t platforms;
-    AdapterRegistry adapter_registry;
+    AdapterRegistry adapter_registry = startupProfile.measure(
+        "adapter search", [] { return AdapterRegistry(); });
 
     bool forceIntercept = false;
 
     ur_result_t init();
+
+    /// Retrieves the native handles of the first NumEntries successfully
+    /// initialized adapters, in platform order, along with the platforms they
+    /// belong to. The adapters' urAdapterGet (where driver initialization
+    /// happens) are called concurrently.
+    void adapterGet(uint32_t NumEntries, ur_adapter_handle_t *phAdapters,
+                    std::vector<platform_t *> &adapterPlatforms);
+
+    /// Queries the number of platforms each of the given loader adapter
+    /// handles exposes. Adapters commonly initialize their driver on the first
+    /// urPlatformGet, so the adapters are queried concurrently.
+    std::vector<std::pair<ur_result_t, uint32_t>>
+    platformGetCounts(ur_adapter_handle_t *phAdapters, uint32_t NumAdapters);
+    /// true unless exactly one adapter is loaded, in which case its DDI
+    /// tables are returned directly from the urGet*ProcAddrTable entry points
     bool intercept_enabled = false;
 
     struct handle_factories factories;
+
+    /// ONEAPI_DEVICE_SELECTOR, parsed once for all urDeviceGetSelected calls
+    /// rather than once per platform
+    env_var_map_cache_t deviceSelector{"ONEAPI_DEVICE_SELECTOR", false};
 };
 
 context_t *getContext();
@@ -1062,6 +1062,23 @@ urPrintExpLaunchProperty(const struct ur_exp_launch_property_t params,
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t urPrintExpUsmHostPoolFlags(enum ur_exp_usm_host_pool_flag_t value,
+                                       char *buffer, const size_t buff_size,
+                                       size_t *out_size) {
+    std::stringstream ss;
+    ss << value;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t
+urPrintExpUsmHostPoolDesc(const struct ur_exp_usm_host_pool_desc_t params,
+                          char *buffer, const size_t buff_size,
+                          size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t urPrintExpPeerInfo(enum ur_exp_peer_info_t value, char *buffer,
                                const size_t buff_size, size_t *out_size) {
     std::stringstream ss;
@@ -1069,6 +1086,22 @@ ur_result_t urPrintExpPeerInfo(enum ur_exp_peer_info_t value, char *buffer,
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t urPrintExpPeerLinkType(enum ur_exp_peer_link_type_t value,
+                                   char *buffer, const size_t buff_size,
+                                   size_t *out_size) {
+    std::stringstream ss;
+    ss << value;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintExpPeerCopyRoute(enum ur_exp_peer_copy_route_t value,
+                                    char *buffer, const size_t buff_size,
+                                    size_t *out_size) {
+    std::stringstream ss;
+    ss << value;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t urPrintExpEnqueueNativeCommandFlags(
     enum ur_exp_enqueue_native_command_flag_t value, char *buffer,
     const size_t buff_size, size_t *out_size) {
@@ -1085,6 +1118,39 @@ ur_result_t urPrintExpEnqueueNativeCommandProperties(
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t
+urPrintExpKernelLaunchDesc(const struct ur_exp_kernel_launch_desc_t params,
+                           char *buffer, const size_t buff_size,
+                           size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintExpKernelArgType(enum ur_exp_kernel_arg_type_t value,
+                                    char *buffer, const size_t buff_size,
+                                    size_t *out_size) {
+    std::stringstream ss;
+    ss << value;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintExpKernelArgMemObjTuple(
+    const struct ur_exp_kernel_arg_mem_obj_tuple_t params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintExpKernelArgProperties(
+    const struct ur_exp_kernel_arg_properties_t params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t
 urPrintAdapterGetParams(const struct ur_adapter_get_params_t *params,
                         char *buffer, const size_t buff_size,
@@ -1754,6 +1820,46 @@ ur_result_t urPrintEnqueueNativeCommandExpParams(
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t urPrintEnqueueUsmDeviceAllocExpParams(
+    const struct ur_enqueue_usm_device_alloc_exp_params_t *params,
+    char *buffer, const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintEnqueueUsmFreeExpParams(
+    const struct ur_enqueue_usm_free_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintEnqueueMemBufferCopyRectBatchExpParams(
+    const struct ur_enqueue_mem_buffer_copy_rect_batch_exp_params_t *params,
+    char *buffer, const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintEnqueueKernelLaunchBatchExpParams(
+    const struct ur_enqueue_kernel_launch_batch_exp_params_t *params,
+    char *buffer, const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintEnqueueTimestampMarkerExpParams(
+    const struct ur_enqueue_timestamp_marker_exp_params_t *params,
+    char *buffer, const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t
 urPrintEventGetInfoParams(const struct ur_event_get_info_params_t *params,
                           char *buffer, const size_t buff_size,
@@ -1821,6 +1927,22 @@ ur_result_t urPrintEventSetCallbackParams(
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t urPrintEventWaitAnyExpParams(
+    const struct ur_event_wait_any_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintEventGetExecutionStatusExpParams(
+    const struct ur_event_get_execution_status_exp_params_t *params,
+    char *buffer, const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t
 urPrintKernelCreateParams(const struct ur_kernel_create_params_t *params,
                           char *buffer, const size_t buff_size,
@@ -1962,6 +2084,14 @@ ur_result_t urPrintKernelSuggestMaxCooperativeGroupCountExpParams(
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t urPrintKernelSetArgsExpParams(
+    const struct ur_kernel_set_args_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t
 urPrintLoaderInitParams(const struct ur_loader_init_params_t *params,
                         char *buffer, const size_t buff_size,
@@ -2408,6 +2538,70 @@ urPrintQueueFlushParams(const struct ur_queue_flush_params_t *params,
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t urPrintQueueGroupCreateExpParams(
+    const struct ur_queue_group_create_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintQueueGroupRetainExpParams(
+    const struct ur_queue_group_retain_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintQueueGroupReleaseExpParams(
+    const struct ur_queue_group_release_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintQueueGroupGetQueueExpParams(
+    const struct ur_queue_group_get_queue_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintQueueGroupFinishExpParams(
+    const struct ur_queue_group_finish_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintQueueGroupBarrierExpParams(
+    const struct ur_queue_group_barrier_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintQueueReserveTimestampMarkersExpParams(
+    const struct ur_queue_reserve_timestamp_markers_exp_params_t *params,
+    char *buffer, const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintQueueReadTimestampMarkersExpParams(
+    const struct ur_queue_read_timestamp_markers_exp_params_t *params,
+    char *buffer, const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t
 urPrintSamplerCreateParams(const struct ur_sampler_create_params_t *params,
                            char *buffer, const size_t buff_size,
@@ -2565,6 +2759,39 @@ urPrintUsmReleaseExpParams(const struct ur_usm_release_exp_params_t *params,
     return str_copy(&ss, buffer, buff_size, out_size);
 }
 
+ur_result_t
+urPrintUsmPoolTrimExpParams(const struct ur_usm_pool_trim_exp_params_t *params,
+                            char *buffer, const size_t buff_size,
+                            size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintUsmGrowableAllocExpParams(
+    const struct ur_usm_growable_alloc_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintUsmGrowableResizeExpParams(
+    const struct ur_usm_growable_resize_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
+ur_result_t urPrintUsmGrowableFreeExpParams(
+    const struct ur_usm_growable_free_exp_params_t *params, char *buffer,
+    const size_t buff_size, size_t *out_size) {
+    std::stringstream ss;
+    ss << params;
+    return str_copy(&ss, buffer, buff_size, out_size);
+}
+
 ur_result_t urPrintUsmP2pEnablePeerAccessExpParams(
     const struct ur_usm_p2p_enable_peer_access_exp_params_t *params,
     char *buffer, const size_t buff_size, size_t *out_size) {
@@ -0,0 +1,140 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_startup_profile.hpp
+ *
+ */
+
+#ifndef UR_STARTUP_PROFILE_HPP
+#define UR_STARTUP_PROFILE_HPP 1
+
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "logger/ur_logger.hpp"
+#include "ur_util.hpp"
+
+namespace ur_loader {
+
+///////////////////////////////////////////////////////////////////////////////
+/// Opt-in record of how long each loader startup phase takes: adapter
+/// search, adapter dlopen, urAdapterGet, layer initialization and the first
+/// platform enumeration.
+///
+/// Enabled by UR_LOADER_STARTUP_PROFILE, the phases are printed through the
+/// loader logger once the first platform enumeration completes. If
+/// UR_LOADER_STARTUP_PROFILE_FILE is also set, they are written to that path
+/// as JSON as well.
+class startup_profile_t {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    startup_profile_t()
+        : enabled(getenv_tobool("UR_LOADER_STARTUP_PROFILE")),
+          created(clock::now()) {
+        if (enabled) {
+            if (auto path = ur_getenv("UR_LOADER_STARTUP_PROFILE_FILE")) {
+                jsonPath = *path;
+            }
+        }
+    }
+
+    bool isEnabled() const noexcept { return enabled; }
+
+    /// Records a phase which started at start and has just finished.
+    void record(std::string phase, clock::time_point start) {
+        if (!enabled) {
+            return;
+        }
+        auto end = clock::now();
+        std::lock_guard<std::mutex> lock(mut);
+        if (!reported) {
+            phases.push_back({std::move(phase), start - created, end - start});
+        }
+    }
+
+    /// Runs f as the named phase and returns its result.
+    template <typename F> auto measure(std::string phase, F &&f) {
+        auto start = clock::now();
+        auto result = f();
+        record(std::move(phase), start);
+        return result;
+    }
+
+    /// Prints the recorded phases, only the first call has an effect.
+    void report() {
+        if (!enabled) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mut);
+        if (reported) {
+            return;
+        }
+        reported = true;
+
+        auto us = [](clock::duration d) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(d)
+                .count();
+        };
+
+        for (auto &phase : phases) {
+            logger::always("startup profile: {} started at +{}us, took {}us",
+                           phase.name, us(phase.offset), us(phase.duration));
+        }
+
+        if (jsonPath.empty()) {
+            return;
+        }
+        std::ofstream out(jsonPath);
+        if (!out) {
+            UR_LOG(ERR, "unable to write startup profile to {}", jsonPath);
+            return;
+        }
+        out << "{\"phases\":[";
+        for (size_t i = 0; i < phases.size(); ++i) {
+            auto &phase = phases[i];
+            out << (i ? "," : "") << "{\"name\":\"" << escape(phase.name)
+                << "\",\"start_us\":" << us(phase.offset)
+                << ",\"duration_us\":" << us(phase.duration) << "}";
+        }
+        out << "]}\n";
+    }
+
+  private:
+    struct phase_t {
+        std::string name;
+        clock::duration offset;
+        clock::duration duration;
+    };
+
+    static std::string escape(const std::string &str) {
+        std::string escaped;
+        for (char c : str) {
+            if (c == '"' || c == '\\') {
+                escaped += '\\';
+            }
+            escaped += c;
+        }
+        return escaped;
+    }
+
+    const bool enabled;
+    const clock::time_point created;
+    std::string jsonPath;
+
+    std::mutex mut;
+    std::vector<phase_t> phases;
+    bool reported = false;
+};
+
+} // namespace ur_loader
+
+#endif /* UR_STARTUP_PROFILE_HPP */
@@ -14,12 +14,14 @@
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <initializer_list>
 #include <iostream>
 #include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -319,6 +321,79 @@ protected:
   size_t *param_value_size_ret;
 };
 
+// Caches the results of the getInfo queries of an object whose properties
+// don't change, e.g. a device, so that only the first query of a property
+// reaches the driver. The properties listed as uncached still go to query
+// on every call.
+template <typename InfoT> class UrInfoCache {
+public:
+  UrInfoCache(std::initializer_list<InfoT> Uncached) : Uncached(Uncached) {}
+
+  // Serves the property like UrReturnHelper, getting it the first time with
+  // Query(PropSize, PropValue, PropSizeRet), the getInfo of the object.
+  // Unsupported properties are cached too, as they are often probed.
+  template <typename F>
+  ur_result_t get(InfoT PropName, size_t PropSize, void *PropValue,
+                  size_t *PropSizeRet, F &&Query) {
+    for (InfoT Prop : Uncached) {
+      if (Prop == PropName) {
+        return Query(PropSize, PropValue, PropSizeRet);
+      }
+    }
+    {
+      std::shared_lock<std::shared_mutex> Lock(Mutex);
+      auto It = Entries.find(PropName);
+      if (It != Entries.end()) {
+        return serve(It->second, PropSize, PropValue, PropSizeRet);
+      }
+    }
+
+    entry_t Entry;
+    size_t Size = 0;
+    Entry.Result = Query(0, nullptr, &Size);
+    if (Entry.Result == UR_RESULT_SUCCESS) {
+      Entry.Value.resize(Size);
+      Entry.Result = Query(Size, Entry.Value.data(), nullptr);
+    }
+    if (Entry.Result != UR_RESULT_SUCCESS &&
+        Entry.Result != UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION) {
+      return Entry.Result;
+    }
+
+    std::unique_lock<std::shared_mutex> Lock(Mutex);
+    auto &Cached = Entries.emplace(PropName, std::move(Entry)).first->second;
+    return serve(Cached, PropSize, PropValue, PropSizeRet);
+  }
+
+private:
+  struct entry_t {
+    ur_result_t Result;
+    std::vector<uint8_t> Value;
+  };
+
+  static ur_result_t serve(const entry_t &Entry, size_t PropSize,
+                           void *PropValue, size_t *PropSizeRet) {
+    if (Entry.Result != UR_RESULT_SUCCESS) {
+      return Entry.Result;
+    }
+    return ur::getInfoArray(Entry.Value.size(), PropSize, PropValue,
+                            PropSizeRet, Entry.Value.data());
+  }
+
+  const std::vector<InfoT> Uncached;
+  std::shared_mutex Mutex;
+  std::unordered_map<InfoT, entry_t> Entries;
+};
+
+// The cache of the device properties, the free memory, the reference count
+// and the availability of the device are queried every time
+struct UrDeviceInfoCache : UrInfoCache<ur_device_info_t> {
+  UrDeviceInfoCache()
+      : UrInfoCache({UR_DEVICE_INFO_GLOBAL_MEM_FREE,
+                     UR_DEVICE_INFO_REFERENCE_COUNT,
+                     UR_DEVICE_INFO_AVAILABLE}) {}
+};
+
 template <typename T> class Result {
 public:
   Result(ur_result_t err) : value_or_err(err) {}
@@ -32,3 +32,24 @@ TEST_P(urLevelZeroProgramLinkTest, InvalidLinkOptionsPrintedInLog) {
 
     ASSERT_SUCCESS(urProgramRelease(linked_program));
 }
+
+// Links the same program again once the first linked program is released,
+// which may reuse or load its module from the module cache
+TEST_P(urLevelZeroProgramLinkTest, RelinkSameProgram) {
+    ASSERT_SUCCESS(urProgramCompile(context, program, nullptr));
+    auto kernel_name =
+        uur::KernelsEnvironment::instance->GetEntryPointNames(program_name)[0];
+
+    for (int i = 0; i < 2; i++) {
+        ur_program_handle_t linked_program = nullptr;
+        ASSERT_SUCCESS(
+            urProgramLink(context, 1, &program, nullptr, &linked_program));
+        ur_kernel_handle_t kernel = nullptr;
+        EXPECT_SUCCESS(
+            urKernelCreate(linked_program, kernel_name.data(), &kernel));
+        if (kernel) {
+            EXPECT_SUCCESS(urKernelRelease(kernel));
+        }
+        ASSERT_SUCCESS(urProgramRelease(linked_program));
+    }
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "adaptive_wait.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+
+using namespace std::chrono_literals;
+
+static constexpr v2::adaptive_wait_t::config_t testConfig = {20us, 100us};
+
+// Completes once queried numQueries times, counting the blocking calls
+struct fake_sync {
+    int numQueries;
+    int numBlocking = 0;
+
+    ze_result_t operator()(uint64_t timeout) {
+        if (timeout == UINT64_MAX) {
+            numBlocking++;
+            return ZE_RESULT_SUCCESS;
+        }
+        return --numQueries > 0 ? ZE_RESULT_NOT_READY : ZE_RESULT_SUCCESS;
+    }
+};
+
+TEST(AdaptiveWaitTest, ShortWaitsDontBlock) {
+    v2::adaptive_wait_t policy(testConfig);
+
+    for (int i = 0; i < 16; i++) {
+        fake_sync sync{2};
+        ASSERT_EQ(policy.wait(std::ref(sync)), ZE_RESULT_SUCCESS);
+        ASSERT_EQ(sync.numBlocking, 0);
+    }
+    ASSERT_LT(policy.getEstimate(), testConfig.maxSpin);
+    ASSERT_GT(policy.getSpinBudget().count(), 0);
+}
+
+TEST(AdaptiveWaitTest, LongWaitsBlockRightAway) {
+    v2::adaptive_wait_t policy(testConfig);
+
+    // The work completes in the driver, after the budgets
+    auto longSync = [](uint64_t timeout) {
+        if (timeout != UINT64_MAX) {
+            return ZE_RESULT_NOT_READY;
+        }
+        std::this_thread::sleep_for(1ms);
+        return ZE_RESULT_SUCCESS;
+    };
+    for (int i = 0; i < 32; i++) {
+        ASSERT_EQ(policy.wait(longSync), ZE_RESULT_SUCCESS);
+    }
+    ASSERT_GT(policy.getEstimate(), testConfig.maxSpin + testConfig.maxYield);
+    ASSERT_EQ(policy.getSpinBudget().count(), 0);
+    ASSERT_EQ(policy.getYieldBudget().count(), 0);
+
+    // Once blocking, short waits bring the budgets back
+    for (int i = 0; i < 64; i++) {
+        fake_sync sync{1};
+        ASSERT_EQ(policy.wait(std::ref(sync)), ZE_RESULT_SUCCESS);
+    }
+    ASSERT_GT(policy.getSpinBudget().count(), 0);
+}
+
+TEST(AdaptiveWaitTest, ZeroBudgetsAlwaysBlock) {
+    v2::adaptive_wait_t policy({0us, 0us});
+
+    fake_sync sync{2};
+    ASSERT_EQ(policy.wait(std::ref(sync)), ZE_RESULT_SUCCESS);
+    ASSERT_EQ(sync.numBlocking, 1);
+}
+
+TEST(AdaptiveWaitTest, ErrorsArePassedThrough) {
+    v2::adaptive_wait_t policy(testConfig);
+
+    auto failingSync = [](uint64_t) { return ZE_RESULT_ERROR_DEVICE_LOST; };
+    ASSERT_EQ(policy.wait(failingSync), ZE_RESULT_ERROR_DEVICE_LOST);
+}
@@ -248,3 +248,57 @@ TEST_P(CommandListCacheTest, CommandListsCacheIsThreadSafe) {
     ASSERT_LE(context->commandListCache.getNumImmediateCommandLists(),
               NumThreads * 2);
 }
+
+TEST_P(CommandListCacheTest, CacheIsBoundedAndEvictsLeastRecentlyUsed) {
+    static constexpr size_t MaxNumCommandLists = 2;
+    v2::command_list_cache_t cache(context->getZeHandle(), MaxNumCommandLists);
+
+    bool IsInOrder = false;
+    ze_command_queue_mode_t Mode = ZE_COMMAND_QUEUE_MODE_DEFAULT;
+    ze_command_queue_priority_t Priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
+
+    // Fill the cache of this thread first, the rest go to the shared cache
+    static constexpr size_t NumLists =
+        v2::command_list_cache_t::FrontCacheSize + MaxNumCommandLists + 3;
+    {
+        std::vector<v2::raii::cache_borrowed_command_list_t> CmdLists;
+        for (size_t I = 0; I < NumLists; ++I) {
+            CmdLists.emplace_back(cache.getImmediateCommandList(
+                device->ZeDevice, IsInOrder, 0, Mode, Priority));
+        }
+    }
+
+    ASSERT_EQ(cache.getNumImmediateCommandLists(),
+              v2::command_list_cache_t::FrontCacheSize + MaxNumCommandLists);
+
+    auto Stats = cache.getStats();
+    ASSERT_EQ(Stats.Misses, NumLists);
+    ASSERT_EQ(Stats.Evictions, 3);
+
+    // The cached command lists are reused
+    auto CmdList = cache.getImmediateCommandList(device->ZeDevice, IsInOrder,
+                                                 0, Mode, Priority);
+    ASSERT_EQ(cache.getStats().FrontHits, 1);
+}
+
+TEST_P(CommandListCacheTest, PrewarmedCommandListsAreReused) {
+    v2::command_list_cache_t cache(context->getZeHandle());
+
+    bool IsInOrder = true;
+    ze_command_queue_mode_t Mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    ze_command_queue_priority_t Priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
+
+    cache.prewarmImmediateCommandLists(device->ZeDevice, IsInOrder, 0, Mode,
+                                       Priority, 2);
+    ASSERT_EQ(cache.getNumImmediateCommandLists(), 2);
+
+    auto First = cache.getImmediateCommandList(device->ZeDevice, IsInOrder,
+                                               0, Mode, Priority);
+    auto Second = cache.getImmediateCommandList(device->ZeDevice, IsInOrder,
+                                                0, Mode, Priority);
+    ASSERT_EQ(cache.getNumImmediateCommandLists(), 0);
+
+    auto Stats = cache.getStats();
+    ASSERT_EQ(Stats.Hits, 2);
+    ASSERT_EQ(Stats.Misses, 0);
+}
@@ -20,6 +20,7 @@
 #include <gtest/gtest.h>
 #include <map>
 #include <string>
+#include <thread>
 #include <unordered_set>
 
 using namespace v2;
@@ -184,6 +185,42 @@ TEST_P(EventPoolTest, Threaded) {
     }
 }
 
+TEST_P(EventPoolTest, ThreadedSharedPool) {
+    auto pool = cache->borrow(device->Id.value());
+    std::vector<std::thread> threads;
+    std::vector<std::vector<ur_event_handle_t>> allocated(10);
+
+    for (int th = 0; th < 10; ++th) {
+        threads.emplace_back([&, th] {
+            for (int iters = 0; iters < 100; ++iters) {
+                for (int i = 0; i < 10; ++i) {
+                    allocated[th].push_back(pool->allocate());
+                }
+                for (int i = 0; i < 5; ++i) {
+                    urEventRelease(allocated[th].back());
+                    allocated[th].pop_back();
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // No event was handed out twice
+    std::unordered_set<ur_event_handle_t> unique;
+    for (auto &events : allocated) {
+        for (auto e : events) {
+            ASSERT_TRUE(unique.insert(e).second);
+        }
+    }
+    for (auto &events : allocated) {
+        for (auto e : events) {
+            urEventRelease(e);
+        }
+    }
+}
+
 TEST_P(EventPoolTest, ProviderNormalUseMostFreePool) {
     auto pool = cache->borrow(device->Id.value());
     std::list<ur_event_handle_t> events;
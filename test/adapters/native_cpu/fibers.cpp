@@ -0,0 +1,125 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fibers.hpp"
+#include "threadpool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using namespace native_cpu;
+
+#ifdef NATIVECPU_HAS_FIBERS
+TEST(Fibers, BarriersWaitForTheWholeGroup) {
+    constexpr size_t NumItems = 64;
+    constexpr size_t NumPhases = 4;
+    std::vector<size_t> Local(NumItems, 0);
+    bool Mismatch = false;
+
+    // Each work item writes its slot, then reads its neighbour's once
+    // everyone went through the barrier
+    auto Item = [&](size_t Index) {
+        for (size_t Phase = 1; Phase <= NumPhases; ++Phase) {
+            Local[Index] = Phase;
+            fiber_group_t::current().barrier();
+            if (Local[(Index + 1) % NumItems] != Phase) {
+                Mismatch = true;
+            }
+            fiber_group_t::current().barrier();
+        }
+    };
+    fiber_group_t::current().run(NumItems, Item);
+
+    ASSERT_FALSE(Mismatch);
+}
+
+TEST(Fibers, RunsItemsWithoutBarriers) {
+    std::vector<int> Runs(100, 0);
+    auto Item = [&](size_t Index) { Runs[Index]++; };
+    // The stacks of the first run are reused by the second
+    fiber_group_t::current().run(Runs.size(), Item);
+    fiber_group_t::current().run(Runs.size(), Item);
+
+    for (int Count : Runs) {
+        ASSERT_EQ(Count, 2);
+    }
+}
+
+TEST(Fibers, StacksFitLargePrivateArrays) {
+    constexpr size_t NumItems = 32;
+    std::vector<size_t> Sums(NumItems);
+    // Most of the default stack, written on both sides of a barrier
+    auto Item = [&](size_t Index) {
+        volatile uint8_t Private[48 * 1024];
+        for (size_t I = 0; I < sizeof(Private); ++I) {
+            Private[I] = static_cast<uint8_t>(Index + I);
+        }
+        fiber_group_t::current().barrier();
+        size_t Sum = 0;
+        for (size_t I = 0; I < sizeof(Private); I += 4096) {
+            Sum += Private[I];
+        }
+        Sums[Index] = Sum;
+    };
+    fiber_group_t::current().run(NumItems, Item);
+
+    for (size_t Index = 0; Index < NumItems; ++Index) {
+        ASSERT_EQ(Sums[Index], 12 * static_cast<uint8_t>(Index));
+    }
+}
+
+TEST(Fibers, RethrowsExceptions) {
+    std::atomic<size_t> Finished{0};
+    auto Item = [&](size_t Index) {
+        fiber_group_t::current().barrier();
+        if (Index == 3) {
+            throw std::runtime_error("failed");
+        }
+        Finished++;
+    };
+
+    ASSERT_THROW(fiber_group_t::current().run(8, Item), std::runtime_error);
+    ASSERT_EQ(Finished.load(), 7u);
+}
+
+TEST(Fibers, GroupsRunOnEveryWorker) {
+    threadpool_t tp(4);
+    constexpr size_t NumGroups = 256;
+    constexpr size_t NumItems = 16;
+    std::vector<std::vector<size_t>> Sums(NumGroups,
+                                          std::vector<size_t>(NumItems));
+    std::atomic<bool> Mismatch{false};
+
+    task_group_t Tasks(tp);
+    for (size_t Group = 0; Group < NumGroups; ++Group) {
+        Tasks.schedule([&, Group](size_t) {
+            // A reduction through the group's shared memory
+            std::vector<size_t> Shared(NumItems);
+            auto Item = [&](size_t Index) {
+                Shared[Index] = Group + Index;
+                fiber_group_t::current().barrier();
+                size_t Sum = 0;
+                for (size_t Value : Shared) {
+                    Sum += Value;
+                }
+                Sums[Group][Index] = Sum;
+            };
+            fiber_group_t::current().run(NumItems, Item);
+        });
+    }
+    Tasks.wait();
+
+    for (size_t Group = 0; Group < NumGroups; ++Group) {
+        size_t Expected = Group * NumItems + NumItems * (NumItems - 1) / 2;
+        for (size_t Sum : Sums[Group]) {
+            ASSERT_EQ(Sum, Expected);
+        }
+    }
+}
+#endif
@@ -0,0 +1,63 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "memops.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace native_cpu;
+
+struct MemOpsTest : testing::TestWithParam<bool> {};
+
+TEST(MemOps, CopiesUnalignedRanges) {
+    std::vector<uint8_t> Src(4096 + 64);
+    for (size_t I = 0; I < Src.size(); ++I) {
+        Src[I] = static_cast<uint8_t>(I * 7);
+    }
+    for (size_t Offset : {0, 1, 5, 15}) {
+        for (size_t Size : {0, 3, 100, 255, 256, 1000, 4096}) {
+            std::vector<uint8_t> Dst(Src.size(), 0);
+            memops::copy(Dst.data() + Offset, Src.data() + 3, Size);
+            for (size_t I = 0; I < Dst.size(); ++I) {
+                bool Inside = I >= Offset && I < Offset + Size;
+                ASSERT_EQ(Dst[I], Inside ? Src[I - Offset + 3] : 0)
+                    << "offset " << Offset << " size " << Size;
+            }
+        }
+    }
+}
+
+TEST_P(MemOpsTest, FillsPatternsOfEverySize) {
+    bool NonTemporal = GetParam();
+    for (size_t PatternSize = 1; PatternSize <= 33; ++PatternSize) {
+        std::vector<uint8_t> Pattern(PatternSize);
+        for (size_t I = 0; I < PatternSize; ++I) {
+            Pattern[I] = static_cast<uint8_t>(I + 1);
+        }
+        for (size_t Offset : {0, 3}) {
+            for (size_t Size : {PatternSize, PatternSize * 100 + 1,
+                                PatternSize * 1000}) {
+                std::vector<uint8_t> Out(Size + 32, 0);
+                memops::fill(Out.data() + Offset, Size, Pattern.data(),
+                             PatternSize, NonTemporal);
+                for (size_t I = 0; I < Out.size(); ++I) {
+                    bool Inside = I >= Offset && I < Offset + Size;
+                    ASSERT_EQ(Out[I],
+                              Inside ? Pattern[(I - Offset) % PatternSize] : 0)
+                        << "pattern " << PatternSize << " offset " << Offset
+                        << " size " << Size;
+                }
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(, MemOpsTest, testing::Bool(),
+                         [](const testing::TestParamInfo<bool> &Info) {
+                             return Info.param ? "NonTemporal" : "Cached";
+                         });
@@ -0,0 +1,234 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "threadpool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace native_cpu;
+
+TEST(ThreadPool, RunsAllTasks) {
+    threadpool_t tp(4);
+    constexpr size_t NumTasks = 10000;
+    std::vector<std::atomic<int>> Runs(NumTasks);
+
+    task_group_t Tasks(tp);
+    for (size_t I = 0; I < NumTasks; ++I) {
+        Tasks.schedule([&Runs, I](size_t) { Runs[I]++; });
+    }
+    Tasks.wait();
+
+    for (auto &Count : Runs) {
+        ASSERT_EQ(Count.load(), 1);
+    }
+}
+
+TEST(ThreadPool, ThreadIdsAreInRange) {
+    threadpool_t tp(8);
+    std::vector<std::atomic<int>> Busy(tp.num_threads());
+    std::atomic<bool> Overlap{false};
+    std::atomic<bool> OutOfRange{false};
+
+    task_group_t Tasks(tp);
+    for (size_t I = 0; I < 1000; ++I) {
+        Tasks.schedule([&](size_t ThreadId) {
+            if (ThreadId >= Busy.size()) {
+                OutOfRange = true;
+                return;
+            }
+            // Per thread state, e.g. local memory, is indexed by the ID, so
+            // no two tasks may run with the same ID at once
+            if (Busy[ThreadId]++ != 0) {
+                Overlap = true;
+            }
+            Busy[ThreadId]--;
+        });
+    }
+    Tasks.wait();
+
+    ASSERT_FALSE(OutOfRange);
+    ASSERT_FALSE(Overlap);
+}
+
+TEST(ThreadPool, TasksScheduledFromTasks) {
+    threadpool_t tp(4);
+    constexpr size_t NumTasks = 64;
+    std::atomic<size_t> Runs{0};
+
+    // The nested tasks go to the deque of the worker and are stolen by the
+    // other workers
+    task_group_t Outer(tp);
+    task_group_t Inner(tp);
+    std::atomic<bool> Scheduled{false};
+    Outer.schedule([&](size_t) {
+        for (size_t I = 0; I < NumTasks; ++I) {
+            Inner.schedule([&Runs](size_t) { Runs++; });
+        }
+        Scheduled = true;
+    });
+    Outer.wait();
+    ASSERT_TRUE(Scheduled);
+    Inner.wait();
+
+    ASSERT_EQ(Runs.load(), NumTasks);
+}
+
+TEST(ThreadPool, RethrowsExceptions) {
+    threadpool_t tp(2);
+    task_group_t Tasks(tp);
+    Tasks.schedule([](size_t) {});
+    Tasks.schedule([](size_t) { throw std::runtime_error("failed"); });
+
+    ASSERT_THROW(Tasks.wait(), std::runtime_error);
+}
+
+TEST(ThreadPool, NotifiesWhenDone) {
+    threadpool_t tp(4);
+    constexpr size_t NumTasks = 1000;
+    std::atomic<size_t> Runs{0};
+    completion_latch Done;
+    Done.add(1);
+
+    // The group is destroyed by the callback, on the thread running the last
+    // task
+    auto *Tasks = new task_group_t(tp);
+    for (size_t I = 0; I < NumTasks; ++I) {
+        Tasks->schedule([&Runs](size_t) { Runs++; });
+    }
+    Tasks->notify([Tasks, &Done] {
+        delete Tasks;
+        Done.count_down();
+    });
+    Done.wait();
+
+    ASSERT_EQ(Runs.load(), NumTasks);
+}
+
+TEST(ThreadPool, NotifiesWithoutTasks) {
+    threadpool_t tp(1);
+    bool Notified = false;
+    task_group_t Tasks(tp);
+    Tasks.notify([&Notified] { Notified = true; });
+
+    ASSERT_TRUE(Notified);
+}
+
+TEST(ThreadPool, ReusesLatchCallbacks) {
+    threadpool_t tp(4);
+    // Like a command buffer submitted twice, the second batch is started from
+    // the callback of the first one
+    std::atomic<size_t> Runs{0};
+    std::vector<std::unique_ptr<detail::task_t>> Tasks;
+    for (size_t I = 0; I < 100; ++I) {
+        Tasks.push_back(std::make_unique<detail::callable_task_t<
+                            std::function<void(size_t)>>>(
+            [&Runs](size_t) { Runs++; }));
+    }
+    completion_latch Batch;
+    completion_latch Done;
+    Done.add(1);
+    std::function<void(size_t)> Start = [&](size_t Remaining) {
+        Batch.add(1);
+        Batch.on_done([&, Remaining] {
+            if (Remaining > 1) {
+                Start(Remaining - 1);
+            } else {
+                Done.count_down();
+            }
+        });
+        for (auto &Task : Tasks) {
+            Task->m_latch = &Batch;
+            Batch.add(1);
+            tp.schedule_task(Task.get());
+        }
+        Batch.count_down();
+    };
+    Start(3);
+    Done.wait();
+
+    ASSERT_EQ(Runs.load(), 3 * Tasks.size());
+}
+
+TEST(ThreadPool, WaitsAfterIdle) {
+    threadpool_t tp(2);
+    // Let the workers go to sleep on the futex before scheduling
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::atomic<int> Runs{0};
+    task_group_t Tasks(tp);
+    Tasks.schedule([&Runs](size_t) { Runs++; });
+    Tasks.wait();
+
+    ASSERT_EQ(Runs.load(), 1);
+}
+
+TEST(ThreadPool, ParsesCpuLists) {
+    ASSERT_EQ(detail::parse_cpu_list("0-3,8\n"),
+              (std::vector<unsigned>{0, 1, 2, 3, 8}));
+    ASSERT_EQ(detail::parse_cpu_list("5"), (std::vector<unsigned>{5}));
+    ASSERT_TRUE(detail::parse_cpu_list("3-1").empty());
+    ASSERT_TRUE(detail::parse_cpu_list("compact").empty());
+}
+
+TEST(ThreadPool, PlacesWorkers) {
+    detail::cpu_topology_t Topology{{{0, 1}, {2, 3}}};
+    auto Cpus = [](const std::vector<detail::placement_t> &Placements) {
+        std::vector<std::pair<unsigned, size_t>> Result;
+        for (auto &Placement : Placements) {
+            Result.emplace_back(Placement.cpu.value_or(UINT_MAX),
+                                Placement.node);
+        }
+        return Result;
+    };
+    using Expected = std::vector<std::pair<unsigned, size_t>>;
+
+    detail::affinity_t Affinity;
+    ASSERT_EQ(Cpus(detail::place_workers(2, Affinity, Topology)),
+              (Expected{{UINT_MAX, 0}, {UINT_MAX, 0}}));
+
+    Affinity.policy = detail::affinity_t::policy_t::compact;
+    ASSERT_EQ(Cpus(detail::place_workers(5, Affinity, Topology)),
+              (Expected{{0, 0}, {1, 0}, {2, 1}, {3, 1}, {0, 0}}));
+
+    Affinity.policy = detail::affinity_t::policy_t::scatter;
+    ASSERT_EQ(Cpus(detail::place_workers(4, Affinity, Topology)),
+              (Expected{{0, 0}, {2, 1}, {1, 0}, {3, 1}}));
+
+    Affinity.policy = detail::affinity_t::policy_t::cpu_list;
+    Affinity.cpus = {3, 0};
+    ASSERT_EQ(Cpus(detail::place_workers(3, Affinity, Topology)),
+              (Expected{{3, 1}, {0, 0}, {3, 1}}));
+}
+
+TEST(ThreadPool, RunsTasksOfEachNode) {
+    detail::affinity_t Affinity;
+    Affinity.policy = detail::affinity_t::policy_t::scatter;
+    threadpool_t tp(4, Affinity);
+    ASSERT_GE(tp.num_nodes(), 1u);
+    ASSERT_LE(tp.num_nodes(), 4u);
+
+    // The tasks of a node may run on the other nodes once it's busy, but
+    // they all have to run
+    std::atomic<size_t> Runs{0};
+    task_group_t Tasks(tp);
+    for (size_t I = 0; I < 1000; ++I) {
+        size_t Node = I % (tp.num_nodes() + 1);
+        Tasks.schedule([&Runs](size_t) { Runs++; },
+                       Node == tp.num_nodes() ? any_node : Node);
+    }
+    Tasks.wait();
+
+    ASSERT_EQ(Runs.load(), 1000u);
+}
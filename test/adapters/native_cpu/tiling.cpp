@@ -0,0 +1,159 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "tiling.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <vector>
+
+using namespace native_cpu;
+using range_t = tiling_t::range_t;
+
+TEST(Tiling, ForcedTileSizeIsClamped) {
+    auto Tiling = tiling_t::make({10, 4, 1}, {16, 16, 1}, 4, 1 << 20,
+                                 range_t{3, 8, 0});
+    ASSERT_EQ(Tiling.tileSize, (range_t{3, 4, 1}));
+    ASSERT_EQ(Tiling.numTiles, (range_t{4, 1, 1}));
+}
+
+TEST(Tiling, AutomaticTilesFitTheCache) {
+    constexpr size_t CacheBytes = 512 * 1024;
+    range_t LocalSize = {16, 16, 1};
+    auto Tiling = tiling_t::make({256, 256, 1}, LocalSize, 4, CacheBytes);
+
+    size_t Items = 1;
+    for (unsigned Dim = 0; Dim < 3; ++Dim) {
+        Items *= Tiling.tileSize[Dim] * LocalSize[Dim];
+    }
+    ASSERT_LE(Items * 32, CacheBytes);
+    // Square work groups give square tiles
+    ASSERT_EQ(Tiling.tileSize[0], Tiling.tileSize[1]);
+    ASSERT_GT(Tiling.tileSize[0], 1u);
+}
+
+TEST(Tiling, KeepsEnoughTilesForTheThreads) {
+    auto Tiling = tiling_t::make({8, 8, 1}, {1, 1, 1}, 8, 1 << 30);
+    ASSERT_GE(Tiling.count(), 32u);
+}
+
+TEST(Tiling, CoversEveryWorkGroupOnce) {
+    range_t NumWG = {10, 7, 3};
+    auto Tiling = tiling_t::make(NumWG, {1, 1, 1}, 1, 1 << 20,
+                                 range_t{3, 2, 2});
+
+    auto Order = Tiling.order();
+    ASSERT_EQ(Order.size(), Tiling.count());
+    std::multiset<range_t> Groups;
+    for (size_t Tile : Order) {
+        auto Origin = Tiling.origin(Tile);
+        for (size_t G2 = Origin[2];
+             G2 < std::min(Origin[2] + Tiling.tileSize[2], NumWG[2]); ++G2) {
+            for (size_t G1 = Origin[1];
+                 G1 < std::min(Origin[1] + Tiling.tileSize[1], NumWG[1]);
+                 ++G1) {
+                for (size_t G0 = Origin[0];
+                     G0 < std::min(Origin[0] + Tiling.tileSize[0], NumWG[0]);
+                     ++G0) {
+                    Groups.insert({G0, G1, G2});
+                }
+            }
+        }
+    }
+    ASSERT_EQ(Groups.size(), NumWG[0] * NumWG[1] * NumWG[2]);
+    ASSERT_EQ(std::set<range_t>(Groups.begin(), Groups.end()).size(),
+              Groups.size());
+}
+
+TEST(Tiling, OrderIsSpaceFilling) {
+    auto Tiling = tiling_t::make({8, 8, 1}, {1, 1, 1}, 1, 1 << 20,
+                                 range_t{1, 1, 1});
+    auto Order = Tiling.order();
+    // The first four tiles are a 2x2 block, the first sixteen a 4x4 one
+    ASSERT_EQ(std::vector<size_t>(Order.begin(), Order.begin() + 4),
+              (std::vector<size_t>{0, 1, 8, 9}));
+    for (size_t I = 0; I < 16; ++I) {
+        ASSERT_LT(Tiling.origin(Order[I])[0], 4u);
+        ASSERT_LT(Tiling.origin(Order[I])[1], 4u);
+    }
+}
+
+namespace {
+// Runs RunGroup over a NumWG0 x NumWG1 range of work groups on the pool,
+// either one task per row of work groups, like the split of dimensions 1
+// and 2 of a launch, or one task per tile in Morton order.
+void runGrid(threadpool_t &tp, size_t NumWG0, size_t NumWG1, range_t LocalSize,
+             bool Tiled, const std::function<void(size_t, size_t)> &RunGroup) {
+    task_group_t Tasks(tp);
+    if (Tiled) {
+        auto Tiling = tiling_t::make({NumWG0, NumWG1, 1}, LocalSize,
+                                     tp.num_threads(),
+                                     tiling_t::per_core_cache_size());
+        for (size_t Tile : Tiling.order()) {
+            Tasks.schedule([&RunGroup, Tiling, Tile, NumWG0,
+                            NumWG1](size_t) {
+                auto Origin = Tiling.origin(Tile);
+                for (size_t G1 = Origin[1];
+                     G1 < std::min(Origin[1] + Tiling.tileSize[1], NumWG1);
+                     ++G1) {
+                    for (size_t G0 = Origin[0];
+                         G0 <
+                         std::min(Origin[0] + Tiling.tileSize[0], NumWG0);
+                         ++G0) {
+                        RunGroup(G0, G1);
+                    }
+                }
+            });
+        }
+    } else {
+        for (size_t G1 = 0; G1 < NumWG1; ++G1) {
+            Tasks.schedule([&RunGroup, G1, NumWG0](size_t) {
+                for (size_t G0 = 0; G0 < NumWG0; ++G0) {
+                    RunGroup(G0, G1);
+                }
+            });
+        }
+    }
+    Tasks.wait();
+}
+} // namespace
+
+// A matrix multiplication, written as a kernel with 8x8 work groups, gives
+// the same result whether its work groups run in tiles or in rows.
+TEST(Tiling, TiledLaunchMatchesUntiled) {
+    constexpr size_t N = 64;
+    constexpr size_t WG = 8;
+    std::vector<float> A(N * N);
+    std::vector<float> B(N * N);
+    for (size_t I = 0; I < N * N; ++I) {
+        A[I] = float(I % 7);
+        B[I] = float(I % 5);
+    }
+    auto matmul = [&](std::vector<float> &C) {
+        return [&](size_t G0, size_t G1) {
+            for (size_t Row = G1 * WG; Row < (G1 + 1) * WG; ++Row) {
+                for (size_t Col = G0 * WG; Col < (G0 + 1) * WG; ++Col) {
+                    float Sum = 0;
+                    for (size_t K = 0; K < N; ++K) {
+                        Sum += A[Row * N + K] * B[K * N + Col];
+                    }
+                    C[Row * N + Col] += Sum;
+                }
+            }
+        };
+    };
+
+    threadpool_t tp(4);
+    std::vector<float> Rows(N * N);
+    std::vector<float> Tiles(N * N);
+    runGrid(tp, N / WG, N / WG, {WG, WG, 1}, false, matmul(Rows));
+    runGrid(tp, N / WG, N / WG, {WG, WG, 1}, true, matmul(Tiles));
+    // C is accumulated into, so a work group run twice or not at all shows
+    ASSERT_EQ(Tiles, Rows);
+    ASSERT_NE(Rows[N * N - 1], 0.0f);
+}
@@ -0,0 +1,244 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// The options and the setup shared by the benchmarks: the loader, with the
+// mock adapter or the adapters and the layers, the device, its context, and
+// the program of the kernel benchmarks.
+
+#ifndef UR_BENCH_HPP
+#define UR_BENCH_HPP 1
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <ur_api.h>
+#include <ur_print.hpp>
+
+#define UR_CHECK(ACTION)                                                       \
+    if (auto error = ACTION) {                                                 \
+        std::cerr << "error: " #ACTION " failed: " << error << "\n";           \
+        std::exit(1);                                                          \
+    }                                                                          \
+    (void)0
+
+namespace ur_bench {
+
+// The usage of the options parsed by environment_t::parseArg
+inline constexpr const char *options_usage = R"(
+  --mock                measure against the mock adapter, i.e. the cost of
+                        the loader and of the enabled layers only
+  --layer NAME          enable the layer NAME, may be repeated
+  --program FILE        SPIR-V or native binary of the program of the kernel
+                        benchmarks, which are skipped without it unless
+                        --mock is given
+  --kernel NAME         kernel of --program, its first argument must be a
+                        pointer to global memory
+  --list-layers         print the semi-colon separated list of the
+                        available layers and exit
+)";
+
+struct environment_t {
+    bool mock = false;
+    std::vector<std::string> layers;
+    std::string program_path;
+    std::string kernel_name;
+
+    ur_loader_config_handle_t loader_config = nullptr;
+    ur_adapter_handle_t adapter = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+    ur_program_handle_t program = nullptr;
+
+    // Called as each step of init completes, with the entry point of the
+    // step, for the benchmarks of the startup
+    std::function<void(const char *step)> on_step;
+
+    environment_t() { UR_CHECK(urLoaderConfigCreate(&loader_config)); }
+
+    ~environment_t() {
+        if (program) {
+            urProgramRelease(program);
+        }
+        if (context) {
+            urContextRelease(context);
+        }
+        if (device) {
+            urDeviceRelease(device);
+        }
+        if (adapter) {
+            urAdapterRelease(adapter);
+        }
+        urLoaderConfigRelease(loader_config);
+        urLoaderTearDown();
+    }
+
+    // Parses argv[argi] if it's one of options_usage, and its value, if any,
+    // in which case argi is moved to the value
+    bool parseArg(int argc, const char **argv, int &argi) {
+        std::string_view arg{argv[argi]};
+        bool has_value = argi + 1 < argc;
+        if (arg == "--mock") {
+            mock = true;
+        } else if (arg == "--layer" && has_value) {
+            layers.emplace_back(argv[++argi]);
+        } else if (arg == "--program" && has_value) {
+            program_path = argv[++argi];
+        } else if (arg == "--kernel" && has_value) {
+            kernel_name = argv[++argi];
+        } else if (arg == "--list-layers") {
+            listLayers();
+            std::exit(0);
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    // Loads the adapters and sets up the device of the benchmarks
+    void init() {
+        if (program_path.empty() != kernel_name.empty()) {
+            std::fprintf(stderr,
+                         "error: --program and --kernel go together\n");
+            std::exit(1);
+        }
+        if (mock) {
+            UR_CHECK(urLoaderConfigSetMockingEnabled(loader_config, true));
+        }
+        for (auto &layer : layers) {
+            UR_CHECK(urLoaderConfigEnableLayer(loader_config, layer.c_str()));
+        }
+        UR_CHECK(urLoaderInit(0, loader_config));
+        step("urLoaderInit");
+
+        // The first device of the first adapter with one
+        uint32_t num_adapters = 0;
+        UR_CHECK(urAdapterGet(0, nullptr, &num_adapters));
+        std::vector<ur_adapter_handle_t> adapters(num_adapters);
+        UR_CHECK(urAdapterGet(num_adapters, adapters.data(), nullptr));
+        for (auto candidate : adapters) {
+            if (!device) {
+                findDevice(candidate);
+            }
+            if (adapter != candidate) {
+                UR_CHECK(urAdapterRelease(candidate));
+            }
+        }
+        if (!device) {
+            std::fprintf(stderr, "error: no device found\n");
+            std::exit(1);
+        }
+
+        UR_CHECK(urContextCreate(1, &device, nullptr, &context));
+        step("urContextCreate");
+        if (mock) {
+            // The mock adapter takes any program
+            const uint8_t il[] = {0x03, 0x02, 0x23, 0x07};
+            UR_CHECK(urProgramCreateWithIL(context, il, sizeof(il), nullptr,
+                                           &program));
+            UR_CHECK(urProgramBuild(context, program, nullptr));
+            kernel_name = "ur_bench";
+        } else if (!program_path.empty()) {
+            createProgram();
+        }
+        if (program) {
+            step("urProgramBuild");
+        }
+    }
+
+    // A new kernel of the program, nullptr without one
+    ur_kernel_handle_t createKernel() {
+        ur_kernel_handle_t kernel = nullptr;
+        if (program) {
+            UR_CHECK(urKernelCreate(program, kernel_name.c_str(), &kernel));
+        }
+        return kernel;
+    }
+
+  private:
+    void step(const char *name) {
+        if (on_step) {
+            on_step(name);
+        }
+    }
+
+    void listLayers() {
+        size_t size = 0;
+        UR_CHECK(urLoaderConfigGetInfo(loader_config,
+                                       UR_LOADER_CONFIG_INFO_AVAILABLE_LAYERS,
+                                       0, nullptr, &size));
+        std::string available(size, '\0');
+        UR_CHECK(urLoaderConfigGetInfo(loader_config,
+                                       UR_LOADER_CONFIG_INFO_AVAILABLE_LAYERS,
+                                       size, available.data(), nullptr));
+        std::printf("%s\n", available.c_str());
+    }
+
+    void findDevice(ur_adapter_handle_t candidate) {
+        uint32_t num_platforms = 0;
+        UR_CHECK(urPlatformGet(&candidate, 1, 0, nullptr, &num_platforms));
+        std::vector<ur_platform_handle_t> platforms(num_platforms);
+        UR_CHECK(urPlatformGet(&candidate, 1, num_platforms, platforms.data(),
+                               nullptr));
+        step("urPlatformGet");
+        for (auto candidate_platform : platforms) {
+            uint32_t num_devices = 0;
+            UR_CHECK(urDeviceGetSelected(candidate_platform,
+                                         UR_DEVICE_TYPE_ALL, 0, nullptr,
+                                         &num_devices));
+            if (num_devices == 0) {
+                continue;
+            }
+            std::vector<ur_device_handle_t> devices(num_devices);
+            UR_CHECK(urDeviceGetSelected(candidate_platform,
+                                         UR_DEVICE_TYPE_ALL, num_devices,
+                                         devices.data(), nullptr));
+            step("urDeviceGet");
+            adapter = candidate;
+            device = devices[0];
+            for (size_t i = 1; i < devices.size(); i++) {
+                UR_CHECK(urDeviceRelease(devices[i]));
+            }
+            return;
+        }
+    }
+
+    void createProgram() {
+        std::ifstream file(program_path, std::ios::binary);
+        if (!file) {
+            std::fprintf(stderr, "error: cannot read %s\n",
+                         program_path.c_str());
+            std::exit(1);
+        }
+        std::vector<uint8_t> bytes{std::istreambuf_iterator<char>(file),
+                                   std::istreambuf_iterator<char>()};
+
+        // SPIR-V modules start with the magic number 0x07230203
+        const uint8_t spirv_magic[] = {0x03, 0x02, 0x23, 0x07};
+        if (bytes.size() >= sizeof(spirv_magic) &&
+            std::equal(std::begin(spirv_magic), std::end(spirv_magic),
+                       bytes.begin())) {
+            UR_CHECK(urProgramCreateWithIL(context, bytes.data(),
+                                           bytes.size(), nullptr, &program));
+        } else {
+            UR_CHECK(urProgramCreateWithBinary(context, device, bytes.size(),
+                                               bytes.data(), nullptr,
+                                               &program));
+        }
+        UR_CHECK(urProgramBuild(context, program, nullptr));
+    }
+};
+
+} // namespace ur_bench
+
+#endif // UR_BENCH_HPP
@@ -0,0 +1,447 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the cost of the command-buffers of urCommandBuffer*Exp, of
+// recording, finalizing, replaying and updating them, against the cost of
+// enqueuing the same work eagerly, and prints it as JSON for
+// scripts/benchmarks. Where replays overtake the eager enqueues is where the
+// graphs of a runtime pay off.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ur_bench.hpp"
+
+namespace ur_command_buffer_bench {
+using clock = std::chrono::steady_clock;
+
+// The nodes of a DAG come in layers of this width, each node depending on
+// all the nodes of the layer before
+constexpr size_t dag_width = 4;
+
+struct graph_t {
+    bool dag;
+    size_t nodes;
+
+    std::string label() const {
+        return std::string(dag ? "dag " : "linear ") + std::to_string(nodes) +
+               (nodes == 1 ? " node" : " nodes");
+    }
+};
+
+struct measurement_t {
+    graph_t graph;
+    // In nanoseconds, of all the nodes
+    double record;
+    double finalize;
+    // Of a urCommandBufferEnqueueExp of an idle queue, in nanoseconds
+    double replay_p50;
+    double replay_p99;
+    // Of back to back replays, and of the eager enqueues of their work
+    double replays_per_second;
+    double eager_per_second;
+    // Of urCommandBufferUpdateKernelLaunchExp, in nanoseconds, 0 when the
+    // commands can't be updated
+    double update_per_node;
+};
+
+double nanoseconds(clock::duration time) {
+    return std::chrono::duration<double, std::nano>(time).count();
+}
+
+struct app {
+    ur_bench::environment_t env;
+    std::vector<size_t> node_counts = {1, 16, 256};
+    size_t replays = 1000;
+
+    ur_queue_handle_t queue = nullptr;
+    ur_queue_handle_t ooo_queue = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    void *device_ptrs[2] = {nullptr, nullptr};
+    bool updatable = false;
+
+    app(int argc, const char **argv) {
+        parseArgs(argc, argv);
+        env.init();
+        checkSupport();
+        UR_CHECK(urQueueCreate(env.context, env.device, nullptr, &queue));
+        ur_queue_properties_t properties{
+            UR_STRUCTURE_TYPE_QUEUE_PROPERTIES, nullptr,
+            UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE};
+        UR_CHECK(urQueueCreate(env.context, env.device, &properties,
+                               &ooo_queue));
+        for (auto &ptr : device_ptrs) {
+            UR_CHECK(urUSMDeviceAlloc(env.context, env.device, nullptr,
+                                      nullptr, sizeof(uint32_t), &ptr));
+        }
+        kernel = env.createKernel();
+        if (kernel) {
+            UR_CHECK(urKernelSetArgPointer(kernel, 0, nullptr,
+                                           device_ptrs[0]));
+        }
+        updatable = updatable && kernel;
+    }
+
+    ~app() {
+        if (kernel) {
+            urKernelRelease(kernel);
+        }
+        for (auto ptr : device_ptrs) {
+            if (ptr) {
+                urUSMFree(env.context, ptr);
+            }
+        }
+        for (auto q : {queue, ooo_queue}) {
+            if (q) {
+                urQueueRelease(q);
+            }
+        }
+    }
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage = R"(usage: %s [-h] [--mock] [--layer NAME]
+          [--nodes N,...] [--replays N] [--program FILE --kernel NAME]
+          [--list-layers]
+
+This tool measures the time to record linear and DAG command-buffers of N
+nodes and to finalize them, the latency of their replays and the throughput
+of back to back replays, against that of enqueuing the same nodes eagerly,
+and the cost of updating the kernel arguments of their nodes. The nodes are
+kernel launches, or 4 byte USM fills without a kernel, which can't be
+updated. It prints the results as JSON.
+
+options:
+  -h, --help            show this help message and exit
+  --nodes N,...         comma separated numbers of nodes of the
+                        command-buffers, 1,16,256 by default
+  --replays N           number of replays of each command-buffer, 1000 by
+                        default%s)";
+        for (int argi = 1; argi < argc; argi++) {
+            std::string_view arg{argv[argi]};
+            bool has_value = argi + 1 < argc;
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0], ur_bench::options_usage);
+                std::exit(0);
+            } else if (arg == "--nodes" && has_value) {
+                node_counts = parseList(argv[++argi]);
+            } else if (arg == "--replays" && has_value) {
+                replays = std::strtoull(argv[++argi], nullptr, 10);
+            } else if (!env.parseArg(argc, argv, argi)) {
+                std::fprintf(stderr, "error: invalid argument: %s\n",
+                             argv[argi]);
+                std::fprintf(stderr, usage, argv[0], ur_bench::options_usage);
+                std::exit(1);
+            }
+        }
+        if (node_counts.empty() || replays == 0) {
+            std::fprintf(stderr, "error: --nodes and --replays can't be 0\n");
+            std::exit(1);
+        }
+    }
+
+    static std::vector<size_t> parseList(const char *list) {
+        std::vector<size_t> values;
+        for (const char *it = list; *it;) {
+            char *end = nullptr;
+            size_t value = std::strtoull(it, &end, 10);
+            if (end == it || value == 0) {
+                return {};
+            }
+            values.push_back(value);
+            it = *end == ',' ? end + 1 : end;
+        }
+        return values;
+    }
+
+    void checkSupport() {
+        // The mock adapter supports everything, but doesn't report it
+        if (env.mock) {
+            updatable = true;
+            return;
+        }
+        ur_bool_t supported = false;
+        UR_CHECK(urDeviceGetInfo(env.device,
+                                 UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP,
+                                 sizeof(supported), &supported, nullptr));
+        if (!supported) {
+            std::fprintf(stderr, "error: the device doesn't support "
+                                 "command-buffers\n");
+            std::exit(1);
+        }
+        ur_device_command_buffer_update_capability_flags_t capabilities = 0;
+        UR_CHECK(urDeviceGetInfo(
+            env.device, UR_DEVICE_INFO_COMMAND_BUFFER_UPDATE_CAPABILITIES_EXP,
+            sizeof(capabilities), &capabilities, nullptr));
+        updatable =
+            capabilities &
+            UR_DEVICE_COMMAND_BUFFER_UPDATE_CAPABILITY_FLAG_KERNEL_ARGUMENTS;
+    }
+
+    // The nodes of the layer before node i of the graph
+    static std::pair<size_t, size_t> dependencies(const graph_t &graph,
+                                                  size_t i) {
+        if (!graph.dag) {
+            return {0, 0};
+        }
+        size_t layer = i / dag_width;
+        if (layer == 0) {
+            return {0, 0};
+        }
+        size_t first = (layer - 1) * dag_width;
+        return {first, first + dag_width};
+    }
+
+    ur_exp_command_buffer_handle_t
+    record(const graph_t &graph, bool can_update,
+           std::vector<ur_exp_command_buffer_command_handle_t> &commands) {
+        ur_exp_command_buffer_desc_t desc{
+            UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_DESC, nullptr, can_update,
+            !graph.dag, false};
+        ur_exp_command_buffer_handle_t command_buffer = nullptr;
+        UR_CHECK(urCommandBufferCreateExp(env.context, env.device, &desc,
+                                          &command_buffer));
+        std::vector<ur_exp_command_buffer_sync_point_t> sync_points(
+            graph.nodes);
+        const size_t offset = 0;
+        const size_t size = 1;
+        const uint32_t pattern = 0;
+        for (size_t i = 0; i < graph.nodes; i++) {
+            auto [first, last] = dependencies(graph, i);
+            auto num_waits = static_cast<uint32_t>(last - first);
+            auto *waits = num_waits ? &sync_points[first] : nullptr;
+            if (kernel) {
+                ur_exp_command_buffer_command_handle_t command = nullptr;
+                UR_CHECK(urCommandBufferAppendKernelLaunchExp(
+                    command_buffer, kernel, 1, &offset, &size, nullptr, 0,
+                    nullptr, num_waits, waits, &sync_points[i],
+                    can_update ? &command : nullptr));
+                if (command) {
+                    commands.push_back(command);
+                }
+            } else {
+                UR_CHECK(urCommandBufferAppendUSMFillExp(
+                    command_buffer, device_ptrs[0], &pattern, sizeof(pattern),
+                    sizeof(pattern), num_waits, waits, &sync_points[i]));
+            }
+        }
+        return command_buffer;
+    }
+
+    // The nodes of the graph enqueued one by one, with events for the
+    // dependencies of a DAG
+    void enqueueEagerly(const graph_t &graph) {
+        auto q = graph.dag ? ooo_queue : queue;
+        std::vector<ur_event_handle_t> events(graph.dag ? graph.nodes : 0);
+        const size_t offset = 0;
+        const size_t size = 1;
+        const uint32_t pattern = 0;
+        for (size_t i = 0; i < graph.nodes; i++) {
+            auto [first, last] = dependencies(graph, i);
+            auto num_waits = static_cast<uint32_t>(last - first);
+            auto *waits = num_waits ? &events[first] : nullptr;
+            auto *event = graph.dag ? &events[i] : nullptr;
+            if (kernel) {
+                UR_CHECK(urEnqueueKernelLaunch(q, kernel, 1, &offset, &size,
+                                               nullptr, num_waits, waits,
+                                               event));
+            } else {
+                UR_CHECK(urEnqueueUSMFill(q, device_ptrs[0], sizeof(pattern),
+                                          &pattern, sizeof(pattern),
+                                          num_waits, waits, event));
+            }
+        }
+        for (auto event : events) {
+            UR_CHECK(urEventRelease(event));
+        }
+    }
+
+    measurement_t measure(const graph_t &graph) {
+        measurement_t m{graph, 0, 0, 0, 0, 0, 0, 0};
+        auto q = graph.dag ? ooo_queue : queue;
+
+        std::vector<ur_exp_command_buffer_command_handle_t> commands;
+        auto start = clock::now();
+        auto command_buffer = record(graph, false, commands);
+        m.record = nanoseconds(clock::now() - start);
+        start = clock::now();
+        UR_CHECK(urCommandBufferFinalizeExp(command_buffer));
+        m.finalize = nanoseconds(clock::now() - start);
+
+        // Warms up the first submission of the command-buffer
+        UR_CHECK(urCommandBufferEnqueueExp(command_buffer, q, 0, nullptr,
+                                           nullptr));
+        UR_CHECK(urQueueFinish(q));
+
+        std::vector<double> latencies;
+        for (size_t i = 0; i < replays; i++) {
+            start = clock::now();
+            UR_CHECK(urCommandBufferEnqueueExp(command_buffer, q, 0, nullptr,
+                                               nullptr));
+            latencies.push_back(nanoseconds(clock::now() - start));
+            UR_CHECK(urQueueFinish(q));
+        }
+        std::sort(latencies.begin(), latencies.end());
+        m.replay_p50 = latencies[latencies.size() / 2];
+        m.replay_p99 = latencies[static_cast<size_t>(
+            0.99 * static_cast<double>(latencies.size() - 1))];
+
+        start = clock::now();
+        for (size_t i = 0; i < replays; i++) {
+            UR_CHECK(urCommandBufferEnqueueExp(command_buffer, q, 0, nullptr,
+                                               nullptr));
+        }
+        UR_CHECK(urQueueFinish(q));
+        m.replays_per_second = static_cast<double>(replays) /
+                               std::chrono::duration<double>(clock::now() -
+                                                             start)
+                                   .count();
+        UR_CHECK(urCommandBufferReleaseExp(command_buffer));
+
+        enqueueEagerly(graph);
+        UR_CHECK(urQueueFinish(q));
+        start = clock::now();
+        for (size_t i = 0; i < replays; i++) {
+            enqueueEagerly(graph);
+        }
+        UR_CHECK(urQueueFinish(q));
+        m.eager_per_second = static_cast<double>(replays) /
+                             std::chrono::duration<double>(clock::now() -
+                                                           start)
+                                 .count();
+
+        if (updatable) {
+            m.update_per_node = measureUpdate(graph);
+        }
+        return m;
+    }
+
+    // The mean cost of updating the pointer argument of a node, alternating
+    // between two allocations so that each update changes it
+    double measureUpdate(const graph_t &graph) {
+        std::vector<ur_exp_command_buffer_command_handle_t> commands;
+        auto command_buffer = record(graph, true, commands);
+        UR_CHECK(urCommandBufferFinalizeExp(command_buffer));
+
+        const size_t rounds = std::max<size_t>(1, replays / graph.nodes);
+        clock::duration time{};
+        for (size_t round = 0; round < rounds; round++) {
+            ur_exp_command_buffer_update_pointer_arg_desc_t pointer_arg{
+                UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_UPDATE_POINTER_ARG_DESC,
+                nullptr, 0, nullptr, &device_ptrs[(round + 1) % 2]};
+            ur_exp_command_buffer_update_kernel_launch_desc_t update{
+                UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_DESC,
+                nullptr,
+                nullptr,
+                0,
+                1,
+                0,
+                1,
+                nullptr,
+                &pointer_arg,
+                nullptr,
+                nullptr,
+                nullptr,
+                nullptr};
+            auto start = clock::now();
+            for (auto command : commands) {
+                UR_CHECK(urCommandBufferUpdateKernelLaunchExp(command,
+                                                              &update));
+            }
+            time += clock::now() - start;
+        }
+
+        for (auto command : commands) {
+            UR_CHECK(urCommandBufferReleaseCommandExp(command));
+        }
+        UR_CHECK(urCommandBufferReleaseExp(command_buffer));
+        // The mock adapter doesn't return the handles of the commands
+        if (commands.empty()) {
+            return 0.0;
+        }
+        return nanoseconds(time) /
+               static_cast<double>(rounds * commands.size());
+    }
+
+    void run() {
+        if (!updatable) {
+            std::fprintf(stderr, "info: skipping the updates, which need "
+                                 "--kernel and the support of the device\n");
+        }
+        std::vector<measurement_t> measurements;
+        for (bool dag : {false, true}) {
+            for (size_t nodes : node_counts) {
+                measurements.push_back(measure({dag, nodes}));
+            }
+        }
+
+        std::printf("{\n");
+        std::printf("  \"mock\": %s,\n", env.mock ? "true" : "false");
+        std::printf("  \"layers\": [");
+        for (size_t i = 0; i < env.layers.size(); i++) {
+            std::printf("%s\"%s\"", i ? ", " : "", env.layers[i].c_str());
+        }
+        std::printf("],\n");
+        std::printf("  \"node\": \"%s\",\n",
+                    kernel ? "kernel launch" : "USM fill");
+        std::printf("  \"replays\": %zu,\n", replays);
+
+        std::printf("  \"graphs\": [");
+        for (size_t i = 0; i < measurements.size(); i++) {
+            auto &m = measurements[i];
+            std::printf("%s\n    {\"shape\": \"%s\", \"nodes\": %zu, "
+                        "\"record_ns\": %.0f, \"finalize_ns\": %.0f, "
+                        "\"replay_p50_ns\": %.0f, \"replay_p99_ns\": %.0f, "
+                        "\"replays_per_second\": %.1f, "
+                        "\"eager_per_second\": %.1f, "
+                        "\"update_per_node_ns\": %.1f}",
+                        i ? "," : "", m.graph.dag ? "dag" : "linear",
+                        m.graph.nodes, m.record, m.finalize, m.replay_p50,
+                        m.replay_p99, m.replays_per_second,
+                        m.eager_per_second, m.update_per_node);
+        }
+        std::printf("\n  ],\n");
+
+        // The same as results of scripts/benchmarks
+        std::printf("  \"results\": [");
+        const char *separator = "";
+        auto result = [&](const measurement_t &m, const char *label,
+                          double value, const char *unit,
+                          bool lower_is_better) {
+            std::string graph = m.graph.label();
+            std::printf("%s\n    {\"label\": \"%s %s\", \"value\": %.1f, "
+                        "\"unit\": \"%s\", \"lower_is_better\": %s}",
+                        separator, graph.c_str(), label, value, unit,
+                        lower_is_better ? "true" : "false");
+            separator = ",";
+        };
+        for (auto &m : measurements) {
+            result(m, "record", m.record, "ns", true);
+            result(m, "finalize", m.finalize, "ns", true);
+            result(m, "replay latency", m.replay_p50, "ns", true);
+            result(m, "replay throughput", m.replays_per_second, "replays/s",
+                   false);
+            result(m, "eager throughput", m.eager_per_second, "replays/s",
+                   false);
+            if (updatable) {
+                result(m, "update per node", m.update_per_node, "ns", true);
+            }
+        }
+        std::printf("\n  ]\n}\n");
+    }
+};
+} // namespace ur_command_buffer_bench
+
+int main(int argc, const char **argv) {
+    ur_command_buffer_bench::app app{argc, argv};
+    app.run();
+    return 0;
+}
@@ -0,0 +1,284 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the cost per call of the UR entry points a runtime calls the most,
+// against the mock adapter, for the cost of the loader and the layers, or
+// against the adapters, and prints it as JSON for scripts/benchmarks. It also
+// measures the handle table of the loader, singleton_factory_t, on its own.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "ur_bench.hpp"
+#include "ur_singleton.hpp"
+
+namespace ur_microbench {
+using clock = std::chrono::steady_clock;
+
+// Each benchmark is run in batches, the result is the median of the means
+// of the batches, which the outliers of a few of them don't move.
+constexpr size_t batches = 5;
+
+struct app;
+
+struct fake_handle_t_;
+using fake_handle_t = fake_handle_t_ *;
+
+// Stands for the objects the loader wraps the adapter handles in
+struct fake_object_t {
+    fake_object_t(fake_handle_t handle) : handle(handle) {}
+    fake_handle_t handle;
+};
+
+// Runs count calls of the measured entry point, and returns the time they
+// took. Any setup or cleanup around them is left out of the time.
+using bench_fn = clock::duration (app::*)(size_t count);
+
+struct bench_t {
+    const char *label;
+    bool needs_kernel;
+    bench_fn run;
+};
+
+struct app {
+    ur_bench::environment_t env;
+    size_t iterations = 10000;
+
+    ur_queue_handle_t queue = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    void *device_ptr = nullptr;
+
+    singleton_factory_t<fake_object_t, fake_handle_t> factory;
+
+    app(int argc, const char **argv) {
+        parseArgs(argc, argv);
+        env.init();
+        UR_CHECK(urQueueCreate(env.context, env.device, nullptr, &queue));
+        UR_CHECK(urUSMDeviceAlloc(env.context, env.device, nullptr, nullptr,
+                                  sizeof(uint32_t), &device_ptr));
+        kernel = env.createKernel();
+    }
+
+    ~app() {
+        if (kernel) {
+            urKernelRelease(kernel);
+        }
+        if (device_ptr) {
+            urUSMFree(env.context, device_ptr);
+        }
+        if (queue) {
+            urQueueRelease(queue);
+        }
+    }
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage = R"(usage: %s [-h] [--mock] [--layer NAME]
+          [--iterations N] [--program FILE --kernel NAME] [--list-layers]
+
+This tool measures the cost per call of urEnqueueKernelLaunch, the
+urKernelSetArg* entry points, urEventRelease, urUSMDeviceAlloc, urUSMFree
+and urQueueFinish, and of the handle table of the loader, and prints it in
+nanoseconds as JSON.
+
+options:
+  -h, --help            show this help message and exit
+  --iterations N        number of calls measured for each entry point,
+                        10000 by default%s)";
+        for (int argi = 1; argi < argc; argi++) {
+            std::string_view arg{argv[argi]};
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0], ur_bench::options_usage);
+                std::exit(0);
+            } else if (arg == "--iterations" && argi + 1 < argc) {
+                iterations = std::strtoull(argv[++argi], nullptr, 10);
+            } else if (!env.parseArg(argc, argv, argi)) {
+                std::fprintf(stderr, "error: invalid argument: %s\n",
+                             argv[argi]);
+                std::fprintf(stderr, usage, argv[0], ur_bench::options_usage);
+                std::exit(1);
+            }
+        }
+        if (iterations < batches) {
+            std::fprintf(stderr, "error: --iterations must be at least %zu\n",
+                         batches);
+            std::exit(1);
+        }
+    }
+
+    clock::duration setArgValue(size_t count) {
+        auto start = clock::now();
+        for (size_t i = 0; i < count; i++) {
+            UR_CHECK(urKernelSetArgValue(kernel, 0, sizeof(device_ptr),
+                                         nullptr, &device_ptr));
+        }
+        return clock::now() - start;
+    }
+
+    clock::duration setArgPointer(size_t count) {
+        auto start = clock::now();
+        for (size_t i = 0; i < count; i++) {
+            UR_CHECK(urKernelSetArgPointer(kernel, 0, nullptr, device_ptr));
+        }
+        return clock::now() - start;
+    }
+
+    // Without events, as a runtime submits most of the launches
+    clock::duration kernelLaunch(size_t count) {
+        UR_CHECK(urKernelSetArgPointer(kernel, 0, nullptr, device_ptr));
+        const size_t offset = 0;
+        const size_t size = 1;
+        auto start = clock::now();
+        for (size_t i = 0; i < count; i++) {
+            UR_CHECK(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size,
+                                           nullptr, 0, nullptr, nullptr));
+        }
+        auto time = clock::now() - start;
+        UR_CHECK(urQueueFinish(queue));
+        return time;
+    }
+
+    // Of the events of completed commands
+    clock::duration eventRelease(size_t count) {
+        std::vector<ur_event_handle_t> events(count);
+        for (auto &event : events) {
+            UR_CHECK(urEnqueueEventsWait(queue, 0, nullptr, &event));
+        }
+        UR_CHECK(urQueueFinish(queue));
+        auto start = clock::now();
+        for (auto event : events) {
+            UR_CHECK(urEventRelease(event));
+        }
+        return clock::now() - start;
+    }
+
+    clock::duration usmDeviceAlloc(size_t count) {
+        std::vector<void *> ptrs(count);
+        auto start = clock::now();
+        for (auto &ptr : ptrs) {
+            UR_CHECK(urUSMDeviceAlloc(env.context, env.device, nullptr,
+                                      nullptr, 64, &ptr));
+        }
+        auto time = clock::now() - start;
+        for (auto ptr : ptrs) {
+            UR_CHECK(urUSMFree(env.context, ptr));
+        }
+        return time;
+    }
+
+    clock::duration usmFree(size_t count) {
+        std::vector<void *> ptrs(count);
+        for (auto &ptr : ptrs) {
+            UR_CHECK(urUSMDeviceAlloc(env.context, env.device, nullptr,
+                                      nullptr, 64, &ptr));
+        }
+        auto start = clock::now();
+        for (auto ptr : ptrs) {
+            UR_CHECK(urUSMFree(env.context, ptr));
+        }
+        return clock::now() - start;
+    }
+
+    // Of an idle queue, the cost of the call itself
+    clock::duration queueFinish(size_t count) {
+        UR_CHECK(urQueueFinish(queue));
+        auto start = clock::now();
+        for (size_t i = 0; i < count; i++) {
+            UR_CHECK(urQueueFinish(queue));
+        }
+        return clock::now() - start;
+    }
+
+    // Of a round of getInstance, getInstance and release of a handle, with a
+    // thread per core doing its share of the count rounds at the same time,
+    // on handles that mimic adapter handles, which are aligned heap pointers
+    clock::duration singletonFactory(size_t count) {
+        size_t num_threads =
+            std::max<size_t>(4, std::thread::hardware_concurrency());
+        std::vector<std::thread> threads;
+        auto start = clock::now();
+        for (size_t t = 0; t < num_threads; t++) {
+            threads.emplace_back([this, t, num_threads, count] {
+                for (size_t i = t; i < count; i += num_threads) {
+                    auto handle = reinterpret_cast<fake_handle_t>((i + 1) * 64);
+                    factory.getInstance(handle);
+                    factory.getInstance(handle);
+                    factory.release(handle);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        return clock::now() - start;
+    }
+
+    // The median of the mean time per call of the batches, in nanoseconds
+    double measure(bench_fn run) {
+        size_t batch = iterations / batches;
+        // Warms up the caches and the lazy initialization of the adapter
+        (this->*run)(batch);
+
+        std::vector<double> means;
+        for (size_t i = 0; i < batches; i++) {
+            auto time = (this->*run)(batch);
+            means.push_back(
+                std::chrono::duration<double, std::nano>(time).count() /
+                static_cast<double>(batch));
+        }
+        std::sort(means.begin(), means.end());
+        return means[means.size() / 2];
+    }
+
+    void run() {
+        std::printf("{\n");
+        std::printf("  \"mock\": %s,\n", env.mock ? "true" : "false");
+        std::printf("  \"layers\": [");
+        for (size_t i = 0; i < env.layers.size(); i++) {
+            std::printf("%s\"%s\"", i ? ", " : "", env.layers[i].c_str());
+        }
+        std::printf("],\n");
+        std::printf("  \"iterations\": %zu,\n", iterations);
+        std::printf("  \"results\": [");
+
+        static const bench_t benchmarks[] = {
+            {"urKernelSetArgValue", true, &app::setArgValue},
+            {"urKernelSetArgPointer", true, &app::setArgPointer},
+            {"urEnqueueKernelLaunch", true, &app::kernelLaunch},
+            {"urEventRelease", false, &app::eventRelease},
+            {"urUSMDeviceAlloc", false, &app::usmDeviceAlloc},
+            {"urUSMFree", false, &app::usmFree},
+            {"urQueueFinish", false, &app::queueFinish},
+            {"singleton_factory_t", false, &app::singletonFactory},
+        };
+        bool first = true;
+        for (auto &bench : benchmarks) {
+            if (bench.needs_kernel && !kernel) {
+                std::fprintf(stderr, "info: skipping %s without --kernel\n",
+                             bench.label);
+                continue;
+            }
+            double value = measure(bench.run);
+            std::printf("%s\n    {\"label\": \"%s\", \"value\": %.3f, "
+                        "\"unit\": \"ns\", \"lower_is_better\": true}",
+                        first ? "" : ",", bench.label, value);
+            std::fflush(stdout);
+            first = false;
+        }
+        std::printf("\n  ]\n}\n");
+    }
+};
+} // namespace ur_microbench
+
+int main(int argc, const char **argv) {
+    ur_microbench::app app{argc, argv};
+    app.run();
+    return 0;
+}
@@ -0,0 +1,263 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the cost per call of the entry points the sanitizer layer
+// intercepts the most, for runs with and without --layer UR_LAYER_ASAN,
+// whose difference is its overhead, and prints it as JSON for
+// scripts/benchmarks. The allocations measure the poisoning of the redzones,
+// the frees the quarantine and the clearing of the shadow memory, and the
+// launches their preparation, with the validation of the pointer arguments.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ur_bench.hpp"
+
+namespace ur_sanitizer_bench {
+using clock = std::chrono::steady_clock;
+
+// Each benchmark is run in batches, the result is the median of the means
+// of the batches, as in ur_microbench
+constexpr size_t batches = 5;
+
+// The sizes of the allocations, from the small ones whose redzones are
+// larger than them to the large ones whose shadow is the largest
+constexpr size_t alloc_sizes[] = {64, 4096, 1 << 20};
+
+struct app {
+    ur_bench::environment_t env;
+    size_t iterations = 10000;
+    uint32_t kernel_args = 1;
+
+    ur_queue_handle_t queue = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    std::vector<void *> args;
+
+    app(int argc, const char **argv) {
+        parseArgs(argc, argv);
+        env.init();
+        UR_CHECK(urQueueCreate(env.context, env.device, nullptr, &queue));
+        kernel = env.createKernel();
+        args.resize(kernel_args);
+        for (auto &ptr : args) {
+            UR_CHECK(urUSMDeviceAlloc(env.context, env.device, nullptr,
+                                      nullptr, sizeof(uint32_t), &ptr));
+        }
+    }
+
+    ~app() {
+        if (kernel) {
+            urKernelRelease(kernel);
+        }
+        for (auto ptr : args) {
+            if (ptr) {
+                urUSMFree(env.context, ptr);
+            }
+        }
+        if (queue) {
+            urQueueRelease(queue);
+        }
+    }
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage = R"(usage: %s [-h] [--mock] [--layer NAME]
+          [--iterations N] [--program FILE --kernel NAME [--kernel-args N]]
+          [--list-layers]
+
+This tool measures the cost per call of urUSMDeviceAlloc and urUSMFree of
+allocations of 64B, 4KB and 1MB, of urKernelSetArgPointer, and of
+urEnqueueKernelLaunch with 1 up to N pointer arguments, back to back and
+waiting for each launch. Run with and without --layer UR_LAYER_ASAN, the
+difference is the overhead of the sanitizer layer, with the quarantine size
+of UR_LAYER_ASAN_OPTIONS=quarantine_size_mb:N. With UR_LAYER_ASAN, the
+program of --program must be built with the device sanitizer. It prints the
+results in nanoseconds as JSON.
+
+options:
+  -h, --help            show this help message and exit
+  --iterations N        number of calls measured for each benchmark, 10000
+                        by default
+  --kernel-args N       number of pointer arguments of the --kernel, the
+                        launches set 1 up to N of them to allocations and
+                        the others to null, 1 by default%s)";
+        for (int argi = 1; argi < argc; argi++) {
+            std::string_view arg{argv[argi]};
+            bool has_value = argi + 1 < argc;
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0], ur_bench::options_usage);
+                std::exit(0);
+            } else if (arg == "--iterations" && has_value) {
+                iterations = std::strtoull(argv[++argi], nullptr, 10);
+            } else if (arg == "--kernel-args" && has_value) {
+                kernel_args = static_cast<uint32_t>(
+                    std::strtoul(argv[++argi], nullptr, 10));
+            } else if (!env.parseArg(argc, argv, argi)) {
+                std::fprintf(stderr, "error: invalid argument: %s\n",
+                             argv[argi]);
+                std::fprintf(stderr, usage, argv[0], ur_bench::options_usage);
+                std::exit(1);
+            }
+        }
+        if (iterations < batches) {
+            std::fprintf(stderr, "error: --iterations must be at least %zu\n",
+                         batches);
+            std::exit(1);
+        }
+        if (kernel_args == 0) {
+            std::fprintf(stderr, "error: --kernel-args can't be 0\n");
+            std::exit(1);
+        }
+    }
+
+    // Allocates count allocations of size, at most 64MB of them at a time,
+    // the time of the allocations when alloc, or of their frees otherwise
+    clock::duration allocFree(size_t count, size_t size, bool alloc) {
+        const size_t max_live = std::max<size_t>(1, (64 << 20) / size);
+        std::vector<void *> ptrs;
+        clock::duration alloc_time{};
+        clock::duration free_time{};
+        for (size_t done = 0; done < count; done += ptrs.size()) {
+            ptrs.resize(std::min(max_live, count - done));
+            auto start = clock::now();
+            for (auto &ptr : ptrs) {
+                UR_CHECK(urUSMDeviceAlloc(env.context, env.device, nullptr,
+                                          nullptr, size, &ptr));
+            }
+            alloc_time += clock::now() - start;
+            start = clock::now();
+            for (auto ptr : ptrs) {
+                UR_CHECK(urUSMFree(env.context, ptr));
+            }
+            free_time += clock::now() - start;
+        }
+        return alloc ? alloc_time : free_time;
+    }
+
+    clock::duration setArgPointer(size_t count) {
+        auto start = clock::now();
+        for (size_t i = 0; i < count; i++) {
+            UR_CHECK(urKernelSetArgPointer(kernel, 0, nullptr, args[0]));
+        }
+        return clock::now() - start;
+    }
+
+    // The first used of the pointer arguments point to allocations, the
+    // others are null, which the sanitizer doesn't validate
+    void setArgs(uint32_t used) {
+        for (uint32_t i = 0; i < kernel_args; i++) {
+            UR_CHECK(urKernelSetArgPointer(kernel, i, nullptr,
+                                           i < used ? args[i] : nullptr));
+        }
+    }
+
+    clock::duration launch(size_t count, uint32_t used, bool wait) {
+        setArgs(used);
+        const size_t offset = 0;
+        const size_t size = 1;
+        auto start = clock::now();
+        for (size_t i = 0; i < count; i++) {
+            UR_CHECK(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size,
+                                           nullptr, 0, nullptr, nullptr));
+            if (wait) {
+                UR_CHECK(urQueueFinish(queue));
+            }
+        }
+        auto time = clock::now() - start;
+        UR_CHECK(urQueueFinish(queue));
+        return time;
+    }
+
+    // The median of the mean time per call of the batches, in nanoseconds
+    double measure(const std::function<clock::duration(size_t)> &run) {
+        size_t batch = iterations / batches;
+        // Warms up the caches and the lazy initialization of the adapter
+        // and of the layers
+        run(batch);
+
+        std::vector<double> means;
+        for (size_t i = 0; i < batches; i++) {
+            means.push_back(
+                std::chrono::duration<double, std::nano>(run(batch)).count() /
+                static_cast<double>(batch));
+        }
+        std::sort(means.begin(), means.end());
+        return means[means.size() / 2];
+    }
+
+    void run() {
+        std::printf("{\n");
+        std::printf("  \"mock\": %s,\n", env.mock ? "true" : "false");
+        std::printf("  \"layers\": [");
+        for (size_t i = 0; i < env.layers.size(); i++) {
+            std::printf("%s\"%s\"", i ? ", " : "", env.layers[i].c_str());
+        }
+        std::printf("],\n");
+        std::printf("  \"iterations\": %zu,\n", iterations);
+        std::printf("  \"results\": [");
+
+        const char *separator = "";
+        auto result = [&](const std::string &label,
+                          const std::function<clock::duration(size_t)> &run) {
+            double value = measure(run);
+            std::printf("%s\n    {\"label\": \"%s\", \"value\": %.3f, "
+                        "\"unit\": \"ns\", \"lower_is_better\": true}",
+                        separator, label.c_str(), value);
+            std::fflush(stdout);
+            separator = ",";
+        };
+
+        for (size_t size : alloc_sizes) {
+            std::string bytes = std::to_string(size) + "B";
+            result("urUSMDeviceAlloc " + bytes, [&, size](size_t count) {
+                return allocFree(count, size, true);
+            });
+            result("urUSMFree " + bytes, [&, size](size_t count) {
+                return allocFree(count, size, false);
+            });
+        }
+
+        if (!kernel) {
+            std::fprintf(stderr, "info: skipping the kernel benchmarks "
+                                 "without --kernel\n");
+            std::printf("\n  ]\n}\n");
+            return;
+        }
+        result("urKernelSetArgPointer",
+               [&](size_t count) { return setArgPointer(count); });
+        // The powers of 2 up to N, and N
+        std::vector<uint32_t> counts;
+        for (uint32_t used = 1; used < kernel_args; used *= 2) {
+            counts.push_back(used);
+        }
+        counts.push_back(kernel_args);
+        for (uint32_t used : counts) {
+            std::string pointers =
+                std::to_string(used) + (used == 1 ? " pointer" : " pointers");
+            result("urEnqueueKernelLaunch " + pointers,
+                   [&, used](size_t count) {
+                       return launch(count, used, false);
+                   });
+            result("urEnqueueKernelLaunch and wait " + pointers,
+                   [&, used](size_t count) {
+                       return launch(count, used, true);
+                   });
+        }
+        std::printf("\n  ]\n}\n");
+    }
+};
+} // namespace ur_sanitizer_bench
+
+int main(int argc, const char **argv) {
+    ur_sanitizer_bench::app app{argc, argv};
+    app.run();
+    return 0;
+}
@@ -0,0 +1,398 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the time from the start of a process to the completion of each
+// step of the startup of a runtime: urLoaderInit, the first urPlatformGet
+// and urDeviceGet, urContextCreate, the first program build with a cold and
+// a warm program cache, and the completion of the first kernel. Each sample
+// is a new process, which runs this tool again with --sample, so that no
+// sample finds the state of another. The results are printed as JSON for
+// scripts/benchmarks, with the breakdown of the loader startup of
+// UR_LOADER_STARTUP_PROFILE.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ur_bench.hpp"
+#include "ur_filesystem_resolved.hpp"
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+namespace ur_startup_bench {
+using clock = std::chrono::steady_clock;
+
+// The lines of the samples start with it, the adapters and the layers may
+// print to stdout too
+constexpr std::string_view line_prefix = "ur_startup_bench ";
+
+// The steps of the startup, in order
+const char *const steps[] = {"main",           "urLoaderInit",
+                             "urPlatformGet",  "urDeviceGet",
+                             "urContextCreate", "urProgramBuild",
+                             "first kernel"};
+
+int64_t sinceEpoch(clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               time.time_since_epoch())
+        .count();
+}
+
+void setEnv(const char *name, const std::string &value) {
+#ifdef _WIN32
+    _putenv_s(name, value.c_str());
+#else
+    setenv(name, value.c_str(), 1);
+#endif
+}
+
+// The steps of one process, microseconds from its start to their
+// completion, and the phases of the loader startup profile
+struct sample_t {
+    std::map<std::string, double> steps;
+    std::map<std::string, double> loader_phases;
+};
+
+// Runs in the process of a sample
+struct sample_app {
+    ur_bench::environment_t env;
+    clock::time_point spawned;
+    std::string profile_path;
+    std::vector<std::pair<std::string, double>> steps;
+
+    sample_app(clock::time_point spawned, clock::time_point entered,
+               std::string cache_dir, std::string profile_path)
+        : spawned(spawned), profile_path(std::move(profile_path)) {
+        steps.emplace_back(
+            "main", std::chrono::duration<double, std::micro>(entered - spawned)
+                        .count());
+        if (!cache_dir.empty()) {
+            setEnv("UR_PROGRAM_CACHE_DIR", cache_dir);
+        }
+        setEnv("UR_LOADER_STARTUP_PROFILE", "1");
+        setEnv("UR_LOADER_STARTUP_PROFILE_FILE", this->profile_path);
+        env.on_step = [this](const char *name) { step(name); };
+    }
+
+    void step(const char *name) {
+        // Only the first of each, e.g. of the first adapter
+        for (auto &[seen, us] : steps) {
+            if (seen == name) {
+                return;
+            }
+        }
+        steps.emplace_back(
+            name,
+            std::chrono::duration<double, std::micro>(clock::now() - spawned)
+                .count());
+    }
+
+    void run() {
+        env.init();
+        if (auto kernel = env.createKernel()) {
+            ur_queue_handle_t queue = nullptr;
+            void *ptr = nullptr;
+            UR_CHECK(urQueueCreate(env.context, env.device, nullptr, &queue));
+            UR_CHECK(urUSMDeviceAlloc(env.context, env.device, nullptr,
+                                      nullptr, sizeof(uint32_t), &ptr));
+            UR_CHECK(urKernelSetArgPointer(kernel, 0, nullptr, ptr));
+            const size_t offset = 0;
+            const size_t size = 1;
+            UR_CHECK(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size,
+                                           nullptr, 0, nullptr, nullptr));
+            UR_CHECK(urQueueFinish(queue));
+            step("first kernel");
+            UR_CHECK(urUSMFree(env.context, ptr));
+            UR_CHECK(urKernelRelease(kernel));
+            UR_CHECK(urQueueRelease(queue));
+        }
+
+        for (auto &[name, us] : steps) {
+            std::printf("%.*sstep %.1f %s\n",
+                        static_cast<int>(line_prefix.size()),
+                        line_prefix.data(), us, name.c_str());
+        }
+        printLoaderPhases();
+    }
+
+    // The JSON of the startup profile has one phase per object:
+    // {"name":"...","start_us":N,"duration_us":N}
+    void printLoaderPhases() {
+        std::ifstream file(profile_path);
+        std::string json{std::istreambuf_iterator<char>(file),
+                         std::istreambuf_iterator<char>()};
+        const std::string name_key = "{\"name\":\"";
+        const std::string duration_key = "\"duration_us\":";
+        for (size_t pos = json.find(name_key); pos != std::string::npos;
+             pos = json.find(name_key, pos)) {
+            pos += name_key.size();
+            size_t end = json.find('"', pos);
+            size_t duration = json.find(duration_key, end);
+            if (end == std::string::npos || duration == std::string::npos) {
+                break;
+            }
+            std::string name = json.substr(pos, end - pos);
+            long long us = std::atoll(json.c_str() + duration +
+                                      duration_key.size());
+            std::printf("%.*sloader %lld %s\n",
+                        static_cast<int>(line_prefix.size()),
+                        line_prefix.data(), us, name.c_str());
+        }
+    }
+};
+
+double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    size_t middle = values.size() / 2;
+    return values.size() % 2 ? values[middle]
+                             : (values[middle - 1] + values[middle]) / 2;
+}
+
+// Runs the samples and reports them
+struct app {
+    std::string self;
+    // The options of ur_bench::environment_t, passed on to the samples
+    ur_bench::environment_t env;
+    std::vector<std::string> env_args;
+    size_t samples = 10;
+    filesystem::path work_dir;
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage = R"(usage: %s [-h] [--mock] [--layer NAME]
+          [--samples N] [--program FILE --kernel NAME] [--list-layers]
+
+This tool measures the time from the start of a process to the completion
+of urLoaderInit, the first urPlatformGet and urDeviceGet, urContextCreate,
+the first program build and the first kernel, with a cold program cache,
+empty for each sample, and with a warm one, and the loader startup phases of
+UR_LOADER_STARTUP_PROFILE. Each sample is a new process. The program steps
+need --program and --kernel, unless --mock is given. It prints the medians
+in microseconds as JSON.
+
+options:
+  -h, --help            show this help message and exit
+  --samples N           number of processes run with each cache, 10 by
+                        default%s)";
+        self = argv[0];
+        for (int argi = 1; argi < argc; argi++) {
+            std::string_view arg{argv[argi]};
+            int first = argi;
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0], ur_bench::options_usage);
+                std::exit(0);
+            } else if (arg == "--samples" && argi + 1 < argc) {
+                samples = std::strtoull(argv[++argi], nullptr, 10);
+            } else if (env.parseArg(argc, argv, argi)) {
+                for (int i = first; i <= argi; i++) {
+                    env_args.push_back(argv[i]);
+                }
+            } else {
+                std::fprintf(stderr, "error: invalid argument: %s\n",
+                             argv[argi]);
+                std::fprintf(stderr, usage, argv[0], ur_bench::options_usage);
+                std::exit(1);
+            }
+        }
+        if (samples == 0) {
+            std::fprintf(stderr, "error: --samples can't be 0\n");
+            std::exit(1);
+        }
+        if (env.program_path.empty() != env.kernel_name.empty()) {
+            std::fprintf(stderr, "error: --program and --kernel go together\n");
+            std::exit(1);
+        }
+    }
+
+    static std::string quote(const std::string &arg) {
+        return "\"" + arg + "\"";
+    }
+
+    sample_t runSample(const filesystem::path &cache_dir) {
+        auto profile = work_dir / "profile.json";
+        std::string args = " " + quote(cache_dir.string()) + " " +
+                           quote(profile.string());
+        for (auto &arg : env_args) {
+            args += " " + quote(arg);
+        }
+        // The time starts before the shell, whose start is part of the
+        // start of a process. The clock is the same in all the processes.
+        std::string command = quote(self) + " --sample " +
+                              std::to_string(sinceEpoch(clock::now())) + args;
+#ifdef _WIN32
+        // cmd.exe strips the outer quotes of a command starting with one
+        command = quote(command);
+#endif
+        FILE *pipe = popen(command.c_str(), "r");
+        if (!pipe) {
+            std::fprintf(stderr, "error: cannot run %s\n", self.c_str());
+            std::exit(1);
+        }
+        std::string output;
+        char buffer[4096];
+        while (size_t read = std::fread(buffer, 1, sizeof(buffer), pipe)) {
+            output.append(buffer, read);
+        }
+        if (pclose(pipe) != 0) {
+            std::fprintf(stderr, "error: a sample failed: %s\n",
+                         command.c_str());
+            std::exit(1);
+        }
+
+        sample_t sample;
+        std::stringstream lines{output};
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (line.compare(0, line_prefix.size(), line_prefix) != 0) {
+                continue;
+            }
+            std::stringstream fields{line.substr(line_prefix.size())};
+            std::string kind;
+            double value = 0;
+            std::string name;
+            fields >> kind >> value >> std::ws;
+            std::getline(fields, name);
+            (kind == "step" ? sample.steps : sample.loader_phases)[name] =
+                value;
+        }
+        return sample;
+    }
+
+    std::vector<sample_t> runSamples(bool cold) {
+        std::vector<sample_t> results;
+        auto warm_dir = work_dir / "warm";
+        if (!cold) {
+            // Fills the cache
+            filesystem::create_directories(warm_dir);
+            runSample(warm_dir);
+        }
+        for (size_t i = 0; i < samples; i++) {
+            auto dir = cold ? work_dir / ("cold" + std::to_string(i))
+                            : warm_dir;
+            filesystem::create_directories(dir);
+            results.push_back(runSample(dir));
+        }
+        return results;
+    }
+
+    void run() {
+        work_dir = filesystem::temp_directory_path() /
+                   ("ur_startup_bench-" +
+                    std::to_string(sinceEpoch(clock::now())));
+        filesystem::create_directories(work_dir);
+        auto cold = runSamples(true);
+        auto warm = runSamples(false);
+        std::error_code ignored;
+        filesystem::remove_all(work_dir, ignored);
+
+        std::printf("{\n");
+        std::printf("  \"mock\": %s,\n", env.mock ? "true" : "false");
+        std::printf("  \"layers\": [");
+        for (size_t i = 0; i < env.layers.size(); i++) {
+            std::printf("%s\"%s\"", i ? ", " : "", env.layers[i].c_str());
+        }
+        std::printf("],\n");
+        std::printf("  \"samples\": %zu,\n", samples);
+
+        const char *separator = "";
+        auto medians = [&](const std::vector<sample_t> &runs, bool loader,
+                           const char *cache) {
+            std::map<std::string, std::vector<double>> values;
+            for (auto &sample : runs) {
+                for (auto &[name, us] :
+                     loader ? sample.loader_phases : sample.steps) {
+                    values[name].push_back(us);
+                }
+            }
+            std::vector<std::pair<std::string, double>> result;
+            auto add = [&](const std::string &name) {
+                auto it = values.find(name);
+                if (it != values.end()) {
+                    result.emplace_back(std::string(cache) + " " + name,
+                                        median(it->second));
+                    values.erase(it);
+                }
+            };
+            if (!loader) {
+                for (auto step : steps) {
+                    add(step);
+                }
+            }
+            while (!values.empty()) {
+                add(values.begin()->first);
+            }
+            return result;
+        };
+
+        // The steps, from the start of the process to their completion
+        std::printf("  \"steps\": [");
+        std::vector<std::pair<std::string, double>> results;
+        for (auto [runs, cache] : {std::pair{&cold, "cold"},
+                                   std::pair{&warm, "warm"}}) {
+            for (auto &[label, us] : medians(*runs, false, cache)) {
+                std::printf("%s\n    {\"label\": \"%s\", \"us\": %.1f}",
+                            separator, label.c_str(), us);
+                separator = ",";
+                results.emplace_back(label, us);
+            }
+        }
+        std::printf("\n  ],\n");
+
+        // The duration of each phase of the loader startup
+        separator = "";
+        std::printf("  \"loader_phases\": [");
+        for (auto [runs, cache] : {std::pair{&cold, "cold"},
+                                   std::pair{&warm, "warm"}}) {
+            for (auto &[label, us] : medians(*runs, true, cache)) {
+                std::printf("%s\n    {\"label\": \"%s\", \"us\": %.1f}",
+                            separator, label.c_str(), us);
+                separator = ",";
+            }
+        }
+        std::printf("\n  ],\n");
+
+        // The same as results of scripts/benchmarks
+        separator = "";
+        std::printf("  \"results\": [");
+        for (auto &[label, us] : results) {
+            std::printf("%s\n    {\"label\": \"%s\", \"value\": %.1f, "
+                        "\"unit\": \"us\", \"lower_is_better\": true}",
+                        separator, label.c_str(), us);
+            separator = ",";
+        }
+        std::printf("\n  ]\n}\n");
+    }
+};
+} // namespace ur_startup_bench
+
+int main(int argc, const char **argv) {
+    using namespace ur_startup_bench;
+    auto entered = clock::now();
+    if (argc >= 5 && std::string_view{argv[1]} == "--sample") {
+        auto spawned = clock::time_point{
+            std::chrono::nanoseconds{std::strtoll(argv[2], nullptr, 10)}};
+        sample_app sample{spawned, entered, argv[3], argv[4]};
+        for (int argi = 5; argi < argc; argi++) {
+            sample.env.parseArg(argc, argv, argi);
+        }
+        sample.run();
+        return 0;
+    }
+    app app;
+    app.parseArgs(argc, argv);
+    app.run();
+    return 0;
+}
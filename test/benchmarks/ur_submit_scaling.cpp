@@ -0,0 +1,305 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures how the throughput and the latency of submissions scale with the
+// number of host threads submitting, to one shared queue or each to its own,
+// and prints them as JSON for scripts/benchmarks. Submissions which don't
+// scale point at the locks they contend on.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "ur_bench.hpp"
+
+namespace ur_submit_scaling {
+using clock = std::chrono::steady_clock;
+
+struct config_t {
+    size_t threads;
+    bool shared_queue;
+    bool out_of_order;
+    bool events;
+
+    std::string label() const {
+        return std::to_string(threads) +
+               (threads == 1 ? " thread, " : " threads, ") +
+               (shared_queue ? "shared queue, " : "own queues, ") +
+               (out_of_order ? "out-of-order, " : "in-order, ") +
+               (events ? "events" : "discard events");
+    }
+};
+
+struct measurement_t {
+    double ops_per_second;
+    // Of a submission, in nanoseconds
+    double p50;
+    double p99;
+    double p999;
+    double max;
+};
+
+struct app {
+    ur_bench::environment_t env;
+    std::vector<size_t> thread_counts = {1, 2, 4, 8};
+    size_t ops = 10000;
+
+    void *device_ptr = nullptr;
+
+    app(int argc, const char **argv) {
+        parseArgs(argc, argv);
+        env.init();
+        UR_CHECK(urUSMDeviceAlloc(env.context, env.device, nullptr, nullptr,
+                                  sizeof(uint32_t), &device_ptr));
+    }
+
+    ~app() {
+        if (device_ptr) {
+            urUSMFree(env.context, device_ptr);
+        }
+    }
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage = R"(usage: %s [-h] [--mock] [--layer NAME]
+          [--threads N,...] [--ops N] [--program FILE --kernel NAME]
+          [--list-layers]
+
+This tool measures the throughput and the latency of the submissions of N
+host threads, to one shared queue or each to its own, in-order or
+out-of-order, with events or discarding them. It submits kernel launches,
+or 4 byte urEnqueueUSMFill without a kernel, and prints the results as
+JSON.
+
+options:
+  -h, --help            show this help message and exit
+  --threads N,...       comma separated numbers of threads, 1,2,4,8 by
+                        default
+  --ops N               number of submissions of each thread, 10000 by
+                        default%s)";
+        for (int argi = 1; argi < argc; argi++) {
+            std::string_view arg{argv[argi]};
+            bool has_value = argi + 1 < argc;
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0], ur_bench::options_usage);
+                std::exit(0);
+            } else if (arg == "--threads" && has_value) {
+                thread_counts = parseList(argv[++argi]);
+            } else if (arg == "--ops" && has_value) {
+                ops = std::strtoull(argv[++argi], nullptr, 10);
+            } else if (!env.parseArg(argc, argv, argi)) {
+                std::fprintf(stderr, "error: invalid argument: %s\n",
+                             argv[argi]);
+                std::fprintf(stderr, usage, argv[0], ur_bench::options_usage);
+                std::exit(1);
+            }
+        }
+        if (thread_counts.empty() || ops == 0) {
+            std::fprintf(stderr, "error: --threads and --ops can't be 0\n");
+            std::exit(1);
+        }
+    }
+
+    static std::vector<size_t> parseList(const char *list) {
+        std::vector<size_t> values;
+        for (const char *it = list; *it;) {
+            char *end = nullptr;
+            size_t value = std::strtoull(it, &end, 10);
+            if (end == it || value == 0) {
+                return {};
+            }
+            values.push_back(value);
+            it = *end == ',' ? end + 1 : end;
+        }
+        return values;
+    }
+
+    // One submission, and the release of its event, if any
+    void submit(ur_queue_handle_t queue, ur_kernel_handle_t kernel,
+                bool events) {
+        ur_event_handle_t event = nullptr;
+        ur_event_handle_t *phEvent = events ? &event : nullptr;
+        if (kernel) {
+            const size_t offset = 0;
+            const size_t size = 1;
+            UR_CHECK(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size,
+                                           nullptr, 0, nullptr, phEvent));
+        } else {
+            const uint32_t pattern = 0;
+            UR_CHECK(urEnqueueUSMFill(queue, device_ptr, sizeof(pattern),
+                                      &pattern, sizeof(pattern), 0, nullptr,
+                                      phEvent));
+        }
+        if (event) {
+            UR_CHECK(urEventRelease(event));
+        }
+    }
+
+    measurement_t measure(const config_t &config) {
+        ur_queue_flags_t flags = 0;
+        if (config.out_of_order) {
+            flags |= UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE;
+        }
+        if (!config.events) {
+            flags |= UR_QUEUE_FLAG_DISCARD_EVENTS;
+        }
+        ur_queue_properties_t properties{UR_STRUCTURE_TYPE_QUEUE_PROPERTIES,
+                                         nullptr, flags};
+        std::vector<ur_queue_handle_t> queues(
+            config.shared_queue ? 1 : config.threads);
+        for (auto &queue : queues) {
+            UR_CHECK(urQueueCreate(env.context, env.device, &properties,
+                                   &queue));
+        }
+        // Each thread has its own kernel, a runtime doesn't share the
+        // arguments of a kernel between threads
+        std::vector<ur_kernel_handle_t> kernels(config.threads);
+        for (auto &kernel : kernels) {
+            kernel = env.createKernel();
+            if (kernel) {
+                UR_CHECK(urKernelSetArgPointer(kernel, 0, nullptr,
+                                               device_ptr));
+            }
+        }
+
+        // The threads warm up, then start submitting together
+        std::atomic<size_t> ready = 0;
+        std::atomic<bool> go = false;
+        std::vector<std::vector<uint64_t>> latencies(config.threads);
+        std::vector<clock::time_point> ends(config.threads);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < config.threads; t++) {
+            threads.emplace_back([&, t] {
+                auto queue = queues[config.shared_queue ? 0 : t];
+                auto kernel = kernels[t];
+                for (size_t i = 0; i < std::min<size_t>(ops, 100); i++) {
+                    submit(queue, kernel, config.events);
+                }
+                auto &thread_latencies = latencies[t];
+                thread_latencies.reserve(ops);
+
+                ready++;
+                while (!go) {
+                    std::this_thread::yield();
+                }
+                for (size_t i = 0; i < ops; i++) {
+                    auto before = clock::now();
+                    submit(queue, kernel, config.events);
+                    thread_latencies.push_back(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            clock::now() - before)
+                            .count());
+                }
+                ends[t] = clock::now();
+            });
+        }
+        while (ready != config.threads) {
+            std::this_thread::yield();
+        }
+        auto start = clock::now();
+        go = true;
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto end = *std::max_element(ends.begin(), ends.end());
+
+        for (auto queue : queues) {
+            UR_CHECK(urQueueFinish(queue));
+            UR_CHECK(urQueueRelease(queue));
+        }
+        for (auto kernel : kernels) {
+            if (kernel) {
+                UR_CHECK(urKernelRelease(kernel));
+            }
+        }
+
+        std::vector<uint64_t> all;
+        for (auto &thread_latencies : latencies) {
+            all.insert(all.end(), thread_latencies.begin(),
+                       thread_latencies.end());
+        }
+        std::sort(all.begin(), all.end());
+        auto percentile = [&](double p) {
+            size_t index = static_cast<size_t>(p * (all.size() - 1));
+            return static_cast<double>(all[index]);
+        };
+        double seconds = std::chrono::duration<double>(end - start).count();
+        return {static_cast<double>(all.size()) / seconds, percentile(0.5),
+                percentile(0.99), percentile(0.999),
+                static_cast<double>(all.back())};
+    }
+
+    void run() {
+        std::vector<std::pair<config_t, measurement_t>> measurements;
+        for (size_t threads : thread_counts) {
+            for (bool shared_queue : {true, false}) {
+                for (bool out_of_order : {false, true}) {
+                    for (bool events : {true, false}) {
+                        config_t config{threads, shared_queue, out_of_order,
+                                        events};
+                        measurements.emplace_back(config, measure(config));
+                    }
+                }
+            }
+        }
+
+        std::printf("{\n");
+        std::printf("  \"mock\": %s,\n", env.mock ? "true" : "false");
+        std::printf("  \"layers\": [");
+        for (size_t i = 0; i < env.layers.size(); i++) {
+            std::printf("%s\"%s\"", i ? ", " : "", env.layers[i].c_str());
+        }
+        std::printf("],\n");
+        std::printf("  \"operation\": \"%s\",\n",
+                    env.program ? "urEnqueueKernelLaunch"
+                                : "urEnqueueUSMFill");
+        std::printf("  \"ops\": %zu,\n", ops);
+
+        std::printf("  \"configs\": [");
+        for (size_t i = 0; i < measurements.size(); i++) {
+            auto &[config, m] = measurements[i];
+            std::printf("%s\n    {\"threads\": %zu, \"shared_queue\": %s, "
+                        "\"out_of_order\": %s, \"events\": %s, "
+                        "\"ops_per_second\": %.1f, \"p50_ns\": %.0f, "
+                        "\"p99_ns\": %.0f, \"p999_ns\": %.0f, "
+                        "\"max_ns\": %.0f}",
+                        i ? "," : "", config.threads,
+                        config.shared_queue ? "true" : "false",
+                        config.out_of_order ? "true" : "false",
+                        config.events ? "true" : "false", m.ops_per_second,
+                        m.p50, m.p99, m.p999, m.max);
+        }
+        std::printf("\n  ],\n");
+
+        // The same as results of scripts/benchmarks
+        std::printf("  \"results\": [");
+        for (size_t i = 0; i < measurements.size(); i++) {
+            auto &[config, m] = measurements[i];
+            std::string label = config.label();
+            std::printf("%s\n    {\"label\": \"%s throughput\", "
+                        "\"value\": %.1f, \"unit\": \"ops/s\", "
+                        "\"lower_is_better\": false},",
+                        i ? "," : "", label.c_str(), m.ops_per_second);
+            std::printf("\n    {\"label\": \"%s p99 latency\", "
+                        "\"value\": %.0f, \"unit\": \"ns\", "
+                        "\"lower_is_better\": true}",
+                        label.c_str(), m.p99);
+        }
+        std::printf("\n  ]\n}\n");
+    }
+};
+} // namespace ur_submit_scaling
+
+int main(int argc, const char **argv) {
+    ur_submit_scaling::app app{argc, argv};
+    app.run();
+    return 0;
+}
@@ -0,0 +1,532 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Replays the submissions of a binary trace of the tracing layer, recorded
+// with urtrace --binary-output, against the mock adapter or a device, with
+// the timing of the recording or as fast as possible, and prints the cost of
+// the replayed calls as JSON for scripts/benchmarks. The submission patterns
+// of an application can then be measured without it or its hardware.
+//
+// Only the raw values of the first binary::MAX_ARGS arguments of each call
+// are recorded, and none of its outputs, so the replay reconstructs the
+// calls from their handles: each queue and kernel of the trace is replaced
+// by one of the replay, created before it starts, the enqueues reuse the
+// recorded work dimensions and blocking flags, and the other arguments are
+// the smallest valid ones. The calls which can't be reconstructed, such as
+// the allocations, are counted as skipped.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ur_bench.hpp"
+#include "ur_tracing_binary.hpp"
+
+namespace ur_trace_replay {
+using clock = std::chrono::steady_clock;
+namespace binary = ur_tracing_layer::binary;
+
+// A call of the trace which is replayed, at its offset from the first call
+struct call_t {
+    ur_function_t function;
+    uint64_t offset_ns;
+    uint64_t args[binary::MAX_ARGS];
+};
+
+struct function_stats_t {
+    size_t calls = 0;
+    // Of the replayed calls, and of the recorded ones which ended
+    uint64_t replay_ns = 0;
+    uint64_t recorded_ns = 0;
+    size_t recorded_ends = 0;
+};
+
+struct replay_t {
+    std::map<ur_function_t, function_stats_t> functions;
+    uint64_t wall_ns = 0;
+    // How late the calls started after their recorded offset, with
+    // --timing original
+    std::vector<uint64_t> lateness_ns;
+};
+
+const char *functionName(ur_function_t function) {
+    switch (function) {
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH:
+        return "urEnqueueKernelLaunch";
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT:
+        return "urEnqueueEventsWait";
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER:
+        return "urEnqueueEventsWaitWithBarrier";
+    case UR_FUNCTION_ENQUEUE_USM_FILL:
+        return "urEnqueueUSMFill";
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY:
+        return "urEnqueueUSMMemcpy";
+    case UR_FUNCTION_QUEUE_FLUSH:
+        return "urQueueFlush";
+    case UR_FUNCTION_QUEUE_FINISH:
+        return "urQueueFinish";
+    case UR_FUNCTION_EVENT_WAIT:
+        return "urEventWait";
+    default:
+        return nullptr;
+    }
+}
+
+// Sleeps until shortly before time, which sleeps past by tens of
+// microseconds, and spins for the rest
+void waitUntil(clock::time_point time) {
+    std::this_thread::sleep_until(time - std::chrono::microseconds(200));
+    while (clock::now() < time) {
+        std::this_thread::yield();
+    }
+}
+
+// The calls of the functions above whose first argument is their queue
+bool hasQueue(ur_function_t function) {
+    return function != UR_FUNCTION_EVENT_WAIT;
+}
+
+struct app {
+    ur_bench::environment_t env;
+    std::string trace_path;
+    bool original_timing = false;
+    size_t repeat = 3;
+
+    // The calls of each recorded thread, and the number of the skipped ones
+    std::map<uint32_t, std::vector<call_t>> threads;
+    std::map<std::string, size_t> skipped;
+    size_t dropped = 0;
+    std::map<ur_function_t, function_stats_t> recorded;
+    uint64_t recorded_ns = 0;
+
+    // The replacements of the recorded queues and kernels
+    std::unordered_map<uint64_t, ur_queue_handle_t> queues;
+    std::unordered_map<uint64_t, ur_kernel_handle_t> kernels;
+    void *device_ptr = nullptr;
+    void *host_ptr = nullptr;
+
+    app(int argc, const char **argv) {
+        parseArgs(argc, argv);
+        readTrace();
+        env.init();
+        UR_CHECK(urUSMDeviceAlloc(env.context, env.device, nullptr, nullptr,
+                                  sizeof(uint32_t), &device_ptr));
+        UR_CHECK(urUSMHostAlloc(env.context, nullptr, nullptr,
+                                sizeof(uint32_t), &host_ptr));
+        createHandles();
+    }
+
+    ~app() {
+        for (auto &[recorded_kernel, kernel] : kernels) {
+            if (kernel) {
+                urKernelRelease(kernel);
+            }
+        }
+        for (auto &[recorded_queue, queue] : queues) {
+            urQueueRelease(queue);
+        }
+        if (host_ptr) {
+            urUSMFree(env.context, host_ptr);
+        }
+        if (device_ptr) {
+            urUSMFree(env.context, device_ptr);
+        }
+    }
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage = R"(usage: %s [-h] [--mock] [--layer NAME]
+          [--timing original|fast] [--repeat N]
+          [--program FILE --kernel NAME] [--list-layers] TRACE
+
+This tool replays the submissions of TRACE, a binary trace recorded with
+urtrace --binary-output, from as many threads as it was recorded from, and
+prints the mean cost of the replayed calls of each function, next to their
+recorded one, and the duration of the replay as JSON. The recorded queues
+and kernels are replaced by new ones, launches of the --kernel, or 4 byte
+urEnqueueUSMFill without one, and the enqueues are replayed without events.
+
+options:
+  -h, --help            show this help message and exit
+  --timing original|fast
+                        replay the calls at their recorded offsets from the
+                        first call, and measure how late they start, or
+                        back to back, fast by default
+  --repeat N            number of replays of the trace, the first of which
+                        warms up and isn't measured, 3 by default%s)";
+        for (int argi = 1; argi < argc; argi++) {
+            std::string_view arg{argv[argi]};
+            bool has_value = argi + 1 < argc;
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0], ur_bench::options_usage);
+                std::exit(0);
+            } else if (arg == "--timing" && has_value &&
+                       (std::string_view{argv[argi + 1]} == "original" ||
+                        std::string_view{argv[argi + 1]} == "fast")) {
+                original_timing =
+                    std::string_view{argv[++argi]} == "original";
+            } else if (arg == "--repeat" && has_value) {
+                repeat = std::strtoull(argv[++argi], nullptr, 10);
+            } else if (env.parseArg(argc, argv, argi)) {
+                continue;
+            } else if (arg[0] != '-' && trace_path.empty()) {
+                trace_path = argv[argi];
+            } else {
+                std::fprintf(stderr, "error: invalid argument: %s\n",
+                             argv[argi]);
+                std::fprintf(stderr, usage, argv[0], ur_bench::options_usage);
+                std::exit(1);
+            }
+        }
+        if (trace_path.empty() || repeat < 2) {
+            std::fprintf(stderr, "error: TRACE is required and --repeat "
+                                 "must be at least 2\n");
+            std::exit(1);
+        }
+    }
+
+    void readTrace() {
+        FILE *file = std::fopen(trace_path.c_str(), "rb");
+        if (!file) {
+            std::fprintf(stderr, "error: cannot read %s\n",
+                         trace_path.c_str());
+            std::exit(1);
+        }
+        binary::file_header_t header{};
+        if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+            std::memcmp(header.magic, binary::FILE_MAGIC,
+                        sizeof(header.magic)) ||
+            header.version != binary::FILE_VERSION ||
+            header.recordSize != sizeof(binary::record_t)) {
+            std::fprintf(stderr, "error: %s is not a supported binary UR "
+                                 "trace\n",
+                         trace_path.c_str());
+            std::fclose(file);
+            std::exit(1);
+        }
+
+        std::unordered_map<uint32_t, std::string> names;
+        std::vector<binary::record_t> records;
+        binary::record_t record;
+        while (std::fread(&record, sizeof(record), 1, file) == 1) {
+            if (record.kind == binary::RECORD_NAME) {
+                std::string name(record.args[0], '\0');
+                if (std::fread(name.data(), 1, name.size(), file) !=
+                    name.size()) {
+                    break;
+                }
+                names[record.functionId] = std::move(name);
+            } else {
+                records.push_back(record);
+            }
+        }
+        std::fclose(file);
+
+        // The drain thread of the tracing layer writes the buffers of the
+        // threads one after another
+        std::stable_sort(records.begin(), records.end(),
+                         [](const auto &a, const auto &b) {
+                             return a.timestamp < b.timestamp;
+                         });
+
+        std::unordered_map<uint64_t, uint64_t> begins;
+        uint64_t first = 0;
+        uint64_t last = 0;
+        for (auto &rec : records) {
+            auto function = static_cast<ur_function_t>(rec.functionId);
+            if (rec.kind == binary::RECORD_DROPPED) {
+                dropped += rec.args[0];
+                continue;
+            }
+            if (!functionName(function)) {
+                if (rec.kind == binary::RECORD_BEGIN) {
+                    auto it = names.find(rec.functionId);
+                    skipped[it != names.end()
+                                ? it->second
+                                : std::to_string(rec.functionId)]++;
+                }
+                continue;
+            }
+            if (rec.kind == binary::RECORD_BEGIN) {
+                if (begins.empty() && threads.empty()) {
+                    first = rec.timestamp;
+                }
+                call_t call{function, rec.timestamp - first, {}};
+                std::copy(std::begin(rec.args), std::end(rec.args),
+                          std::begin(call.args));
+                threads[rec.threadIndex].push_back(call);
+                begins[rec.instance] = rec.timestamp;
+                recorded[function].calls++;
+            } else if (rec.kind == binary::RECORD_END) {
+                auto it = begins.find(rec.instance);
+                if (it != begins.end()) {
+                    auto &stats = recorded[function];
+                    stats.recorded_ns += rec.timestamp - it->second;
+                    stats.recorded_ends++;
+                    last = std::max(last, rec.timestamp);
+                    begins.erase(it);
+                }
+            }
+        }
+        recorded_ns = last > first ? last - first : 0;
+        if (threads.empty()) {
+            std::fprintf(stderr, "error: %s has no calls which can be "
+                                 "replayed\n",
+                         trace_path.c_str());
+            std::exit(1);
+        }
+        if (dropped) {
+            std::fprintf(stderr, "warning: %zu records were dropped while "
+                                 "recording %s\n",
+                         dropped, trace_path.c_str());
+        }
+    }
+
+    void createHandles() {
+        for (auto &[index, calls] : threads) {
+            for (auto &call : calls) {
+                if (hasQueue(call.function) && !queues.count(call.args[0])) {
+                    UR_CHECK(urQueueCreate(env.context, env.device, nullptr,
+                                           &queues[call.args[0]]));
+                }
+                if (call.function == UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH &&
+                    !kernels.count(call.args[1])) {
+                    auto kernel = env.createKernel();
+                    if (kernel) {
+                        UR_CHECK(urKernelSetArgPointer(kernel, 0, nullptr,
+                                                       device_ptr));
+                    }
+                    kernels[call.args[1]] = kernel;
+                }
+            }
+        }
+    }
+
+    // Replays call, urEventWait waits for the queues the thread submitted
+    // to, as the events it waited for aren't known
+    void replay(const call_t &call, std::set<ur_queue_handle_t> &pending) {
+        ur_queue_handle_t queue =
+            hasQueue(call.function) ? queues.at(call.args[0]) : nullptr;
+        const uint32_t pattern = 0;
+        switch (call.function) {
+        case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH: {
+            auto kernel = kernels.at(call.args[1]);
+            if (!kernel) {
+                UR_CHECK(urEnqueueUSMFill(queue, device_ptr, sizeof(pattern),
+                                          &pattern, sizeof(pattern), 0,
+                                          nullptr, nullptr));
+                break;
+            }
+            uint32_t work_dim = static_cast<uint32_t>(
+                std::clamp<uint64_t>(call.args[2], 1, 3));
+            const size_t offset[3] = {0, 0, 0};
+            const size_t size[3] = {1, 1, 1};
+            UR_CHECK(urEnqueueKernelLaunch(queue, kernel, work_dim, offset,
+                                           size, nullptr, 0, nullptr,
+                                           nullptr));
+        } break;
+        case UR_FUNCTION_ENQUEUE_EVENTS_WAIT:
+            UR_CHECK(urEnqueueEventsWait(queue, 0, nullptr, nullptr));
+            break;
+        case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER:
+            UR_CHECK(
+                urEnqueueEventsWaitWithBarrier(queue, 0, nullptr, nullptr));
+            break;
+        case UR_FUNCTION_ENQUEUE_USM_FILL:
+            UR_CHECK(urEnqueueUSMFill(queue, device_ptr, sizeof(pattern),
+                                      &pattern, sizeof(pattern), 0, nullptr,
+                                      nullptr));
+            break;
+        case UR_FUNCTION_ENQUEUE_USM_MEMCPY:
+            // The second argument is the blocking flag
+            UR_CHECK(urEnqueueUSMMemcpy(queue, call.args[1] != 0, host_ptr,
+                                        device_ptr, sizeof(uint32_t), 0,
+                                        nullptr, nullptr));
+            break;
+        case UR_FUNCTION_QUEUE_FLUSH:
+            UR_CHECK(urQueueFlush(queue));
+            break;
+        case UR_FUNCTION_QUEUE_FINISH:
+            UR_CHECK(urQueueFinish(queue));
+            pending.erase(queue);
+            break;
+        case UR_FUNCTION_EVENT_WAIT:
+            for (auto pending_queue : pending) {
+                UR_CHECK(urQueueFinish(pending_queue));
+            }
+            pending.clear();
+            break;
+        default:
+            break;
+        }
+        if (queue && call.function != UR_FUNCTION_QUEUE_FINISH &&
+            call.function != UR_FUNCTION_QUEUE_FLUSH) {
+            pending.insert(queue);
+        }
+    }
+
+    replay_t replayAll() {
+        // Each recorded thread is replayed by its own, from the same start
+        std::vector<replay_t> results(threads.size());
+        std::vector<std::thread> replayers;
+        auto start = clock::now() + std::chrono::milliseconds(10);
+        size_t t = 0;
+        for (auto &[index, calls] : threads) {
+            replayers.emplace_back([&, t, &calls = calls] {
+                auto &result = results[t];
+                std::set<ur_queue_handle_t> pending;
+                waitUntil(start);
+                for (auto &call : calls) {
+                    auto scheduled =
+                        start + std::chrono::nanoseconds(call.offset_ns);
+                    if (original_timing) {
+                        waitUntil(scheduled);
+                    }
+                    auto before = clock::now();
+                    replay(call, pending);
+                    auto after = clock::now();
+                    auto &stats = result.functions[call.function];
+                    stats.calls++;
+                    stats.replay_ns +=
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            after - before)
+                            .count();
+                    if (original_timing) {
+                        result.lateness_ns.push_back(
+                            std::chrono::duration_cast<
+                                std::chrono::nanoseconds>(before - scheduled)
+                                .count());
+                    }
+                }
+                for (auto queue : pending) {
+                    UR_CHECK(urQueueFinish(queue));
+                }
+            });
+            t++;
+        }
+        for (auto &replayer : replayers) {
+            replayer.join();
+        }
+        auto end = clock::now();
+
+        replay_t total;
+        total.wall_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                .count();
+        for (auto &result : results) {
+            for (auto &[function, stats] : result.functions) {
+                auto &sum = total.functions[function];
+                sum.calls += stats.calls;
+                sum.replay_ns += stats.replay_ns;
+            }
+            total.lateness_ns.insert(total.lateness_ns.end(),
+                                     result.lateness_ns.begin(),
+                                     result.lateness_ns.end());
+        }
+        return total;
+    }
+
+    void run() {
+        // The first replay warms up the caches and the lazy initialization
+        // of the adapter and of the layers, the others are summed
+        replayAll();
+        replay_t measured;
+        for (size_t i = 1; i < repeat; i++) {
+            auto replay = replayAll();
+            measured.wall_ns += replay.wall_ns;
+            for (auto &[function, stats] : replay.functions) {
+                auto &sum = measured.functions[function];
+                sum.calls += stats.calls;
+                sum.replay_ns += stats.replay_ns;
+            }
+            measured.lateness_ns.insert(measured.lateness_ns.end(),
+                                        replay.lateness_ns.begin(),
+                                        replay.lateness_ns.end());
+        }
+        const double replays = static_cast<double>(repeat - 1);
+
+        std::printf("{\n");
+        std::printf("  \"mock\": %s,\n", env.mock ? "true" : "false");
+        std::printf("  \"layers\": [");
+        for (size_t i = 0; i < env.layers.size(); i++) {
+            std::printf("%s\"%s\"", i ? ", " : "", env.layers[i].c_str());
+        }
+        std::printf("],\n");
+        std::printf("  \"timing\": \"%s\",\n",
+                    original_timing ? "original" : "fast");
+        std::printf("  \"threads\": %zu,\n", threads.size());
+        std::printf("  \"queues\": %zu,\n", queues.size());
+        std::printf("  \"dropped\": %zu,\n", dropped);
+        std::printf("  \"skipped\": {");
+        const char *separator = "";
+        for (auto &[name, count] : skipped) {
+            std::printf("%s\"%s\": %zu", separator, name.c_str(), count);
+            separator = ", ";
+        }
+        std::printf("},\n");
+
+        std::printf("  \"functions\": [");
+        separator = "";
+        for (auto &[function, stats] : measured.functions) {
+            auto &rec = recorded[function];
+            double recorded_mean =
+                rec.recorded_ends ? static_cast<double>(rec.recorded_ns) /
+                                        static_cast<double>(rec.recorded_ends)
+                                  : 0.0;
+            std::printf("%s\n    {\"name\": \"%s\", \"calls\": %zu, "
+                        "\"replay_ns\": %.1f, \"recorded_ns\": %.1f}",
+                        separator, functionName(function), rec.calls,
+                        static_cast<double>(stats.replay_ns) /
+                            static_cast<double>(stats.calls),
+                        recorded_mean);
+            separator = ",";
+        }
+        std::printf("\n  ],\n");
+
+        // The same as results of scripts/benchmarks
+        std::printf("  \"results\": [");
+        separator = "";
+        for (auto &[function, stats] : measured.functions) {
+            std::printf("%s\n    {\"label\": \"%s\", \"value\": %.1f, "
+                        "\"unit\": \"ns\", \"lower_is_better\": true}",
+                        separator, functionName(function),
+                        static_cast<double>(stats.replay_ns) /
+                            static_cast<double>(stats.calls));
+            separator = ",";
+        }
+        std::printf(",\n    {\"label\": \"replay\", \"value\": %.3f, "
+                    "\"unit\": \"ms\", \"lower_is_better\": true}",
+                    static_cast<double>(measured.wall_ns) / replays / 1e6);
+        std::printf(",\n    {\"label\": \"recorded\", \"value\": %.3f, "
+                    "\"unit\": \"ms\", \"lower_is_better\": true}",
+                    static_cast<double>(recorded_ns) / 1e6);
+        if (original_timing) {
+            auto &lateness = measured.lateness_ns;
+            std::sort(lateness.begin(), lateness.end());
+            size_t index =
+                static_cast<size_t>(0.99 * (lateness.size() - 1));
+            std::printf(",\n    {\"label\": \"p99 lateness\", \"value\": "
+                        "%.0f, \"unit\": \"ns\", \"lower_is_better\": true}",
+                        static_cast<double>(lateness[index]));
+        }
+        std::printf("\n  ]\n}\n");
+    }
+};
+} // namespace ur_trace_replay
+
+int main(int argc, const char **argv) {
+    ur_trace_replay::app app{argc, argv};
+    app.run();
+    return 0;
+}
@@ -0,0 +1,571 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Replays traces of USM allocations and frees against urUSMDeviceAlloc,
+// urUSMSharedAlloc and urUSMHostAlloc, and prints the latency percentiles of
+// the calls, the peak footprint and the fragmentation of the pool as JSON for
+// scripts/benchmarks. The traces are generated from the allocation patterns
+// of ML and graph workloads, or loaded from a file, the same on any adapter.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ur_bench.hpp"
+
+namespace ur_usm_alloc_replay {
+using clock = std::chrono::steady_clock;
+
+// A trace is a text file with one operation per line:
+//   a <id> <size>    allocates size bytes, named id until it's freed
+//   f <id>           frees the allocation id
+// Empty lines and lines starting with # are ignored. The allocations still
+// live at the end of the trace are freed after it, outside of the results.
+struct op_t {
+    bool alloc;
+    uint64_t id;
+    size_t size;
+};
+
+using trace_t = std::vector<op_t>;
+
+// Generates the traces from the raw output of the engine, which unlike the
+// standard distributions gives the same trace with any standard library
+struct generator_t {
+    uint64_t state;
+
+    // splitmix64
+    uint64_t next() {
+        uint64_t z = (state += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t below(uint64_t bound) { return next() % bound; }
+
+    // Sizes spread evenly over the powers of two between 2^lo and 2^hi
+    size_t logUniform(unsigned lo, unsigned hi) {
+        unsigned exponent = lo + static_cast<unsigned>(below(hi - lo + 1));
+        size_t base = size_t{1} << exponent;
+        return base + below(base);
+    }
+};
+
+// The steps of a training loop: the weights are allocated once, each step
+// allocates the activations of the layers in order and frees them in
+// reverse, with the gradients and the workspaces of the kernels in between
+trace_t generateMl(size_t ops, uint64_t seed) {
+    generator_t gen{seed};
+    trace_t trace;
+    uint64_t id = 0;
+    const size_t layers = 24;
+    for (size_t i = 0; i < layers; i++) {
+        trace.push_back({true, id++, gen.logUniform(16, 24)});
+    }
+    std::vector<size_t> activations(layers);
+    for (auto &size : activations) {
+        // Tensors are padded to the alignment of the vector units
+        size = (gen.logUniform(12, 26) + 255) & ~size_t{255};
+    }
+    while (trace.size() < ops) {
+        uint64_t first = id;
+        for (size_t i = 0; i < layers; i++) {
+            trace.push_back({true, id++, activations[i]});
+            uint64_t workspace = id++;
+            trace.push_back({true, workspace, gen.logUniform(10, 20)});
+            trace.push_back({false, workspace, 0});
+        }
+        for (size_t i = layers; i-- > 0;) {
+            uint64_t gradient = id++;
+            trace.push_back({true, gradient, activations[i]});
+            trace.push_back({false, first + 2 * i, 0});
+            trace.push_back({false, gradient, 0});
+        }
+    }
+    return trace;
+}
+
+// The iterations of a traversal: the frontier of each is a few small
+// arrays of a size which varies with the iteration, freed the iteration
+// after, and from time to time the graph is compacted into a larger array
+trace_t generateGraph(size_t ops, uint64_t seed) {
+    generator_t gen{seed};
+    trace_t trace;
+    uint64_t id = 0;
+    uint64_t graph = id++;
+    trace.push_back({true, graph, gen.logUniform(22, 26)});
+    std::vector<uint64_t> previous;
+    while (trace.size() < ops) {
+        std::vector<uint64_t> frontier;
+        size_t arrays = 2 + gen.below(6);
+        for (size_t i = 0; i < arrays; i++) {
+            frontier.push_back(id);
+            trace.push_back({true, id++, gen.logUniform(4, 14)});
+        }
+        for (auto freed : previous) {
+            trace.push_back({false, freed, 0});
+        }
+        previous = std::move(frontier);
+        if (gen.below(32) == 0) {
+            trace.push_back({false, graph, 0});
+            graph = id++;
+            trace.push_back({true, graph, gen.logUniform(22, 26)});
+        }
+    }
+    return trace;
+}
+
+// Allocations and frees interleaved at random, of sizes between 64 bytes
+// and 1MB, with up to 1024 live allocations
+trace_t generateRandom(size_t ops, uint64_t seed) {
+    generator_t gen{seed};
+    trace_t trace;
+    uint64_t id = 0;
+    std::vector<uint64_t> live;
+    while (trace.size() < ops) {
+        bool alloc = live.empty() || (live.size() < 1024 && gen.below(2));
+        if (alloc) {
+            live.push_back(id);
+            trace.push_back({true, id++, gen.logUniform(6, 19)});
+        } else {
+            size_t index = gen.below(live.size());
+            trace.push_back({false, live[index], 0});
+            live[index] = live.back();
+            live.pop_back();
+        }
+    }
+    return trace;
+}
+
+// Of the calls, in nanoseconds
+struct latencies_t {
+    double p50;
+    double p99;
+    double max;
+};
+
+struct measurement_t {
+    ur_usm_type_t type;
+    latencies_t alloc;
+    latencies_t free;
+    size_t peak_requested;
+    // Of the pool, when its statistics are available
+    bool pool_stats;
+    size_t peak_footprint;
+    double fragmentation;
+};
+
+const char *typeName(ur_usm_type_t type) {
+    switch (type) {
+    case UR_USM_TYPE_DEVICE:
+        return "device";
+    case UR_USM_TYPE_SHARED:
+        return "shared";
+    default:
+        return "host";
+    }
+}
+
+struct app {
+    ur_bench::environment_t env;
+    std::string trace_name = "ml";
+    size_t ops = 100000;
+    uint64_t seed = 0;
+    size_t repeat = 3;
+    std::string dump_path;
+    std::vector<ur_usm_type_t> types = {UR_USM_TYPE_DEVICE, UR_USM_TYPE_SHARED,
+                                        UR_USM_TYPE_HOST};
+    bool use_pool = false;
+    size_t max_poolable_size = 0;
+    size_t slab_min_size = 0;
+    bool limits = false;
+
+    trace_t trace;
+
+    app(int argc, const char **argv) {
+        parseArgs(argc, argv);
+        loadTrace();
+        if (!dump_path.empty()) {
+            dumpTrace();
+            std::exit(0);
+        }
+        env.init();
+    }
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage = R"(usage: %s [-h] [--mock] [--layer NAME]
+          [--trace ml|graph|random|FILE] [--ops N] [--seed N] [--repeat N]
+          [--types device,shared,host] [--pool [--max-poolable-size N]
+          [--slab-min-size N]] [--dump-trace FILE] [--list-layers]
+
+This tool replays a trace of USM allocations and frees, and measures the
+latency of each urUSM*Alloc and urUSMFree. It prints their percentiles, the
+peak of the bytes requested and, with --pool, the peak footprint and the
+fragmentation of the pool as JSON.
+
+options:
+  -h, --help            show this help message and exit
+  --trace NAME          generated trace, ml or graph for their allocation
+                        patterns or random for random interleavings of
+                        allocations and frees, or a trace file with a line
+                        "a <id> <size>" for each allocation and "f <id>"
+                        for each free, ml by default
+  --ops N               number of operations of the generated traces,
+                        100000 by default
+  --seed N              seed of the generated traces, 0 by default
+  --repeat N            number of replays of the trace, the first of which
+                        only warms up the allocator, 3 by default
+  --types TYPE,...      comma separated types of the allocations, all of
+                        device, shared and host by default
+  --pool                allocate from a pool of urUSMPoolCreate rather than
+                        from the default allocator of the adapter
+  --max-poolable-size N maxPoolableSize limit of the pool
+  --slab-min-size N     minDriverAllocSize limit of the pool
+  --dump-trace FILE     write the trace to FILE and exit, to replay it on
+                        other adapters or machines%s)";
+        auto invalid = [&](const char *arg) {
+            std::fprintf(stderr, "error: invalid argument: %s\n", arg);
+            std::fprintf(stderr, usage, argv[0], ur_bench::options_usage);
+            std::exit(1);
+        };
+        for (int argi = 1; argi < argc; argi++) {
+            std::string_view arg{argv[argi]};
+            bool has_value = argi + 1 < argc;
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0], ur_bench::options_usage);
+                std::exit(0);
+            } else if (arg == "--trace" && has_value) {
+                trace_name = argv[++argi];
+            } else if (arg == "--ops" && has_value) {
+                ops = std::strtoull(argv[++argi], nullptr, 10);
+            } else if (arg == "--seed" && has_value) {
+                seed = std::strtoull(argv[++argi], nullptr, 10);
+            } else if (arg == "--repeat" && has_value) {
+                repeat = std::strtoull(argv[++argi], nullptr, 10);
+            } else if (arg == "--types" && has_value) {
+                if (!parseTypes(argv[++argi])) {
+                    invalid(argv[argi]);
+                }
+            } else if (arg == "--pool") {
+                use_pool = true;
+            } else if (arg == "--max-poolable-size" && has_value) {
+                max_poolable_size = std::strtoull(argv[++argi], nullptr, 10);
+                limits = true;
+            } else if (arg == "--slab-min-size" && has_value) {
+                slab_min_size = std::strtoull(argv[++argi], nullptr, 10);
+                limits = true;
+            } else if (arg == "--dump-trace" && has_value) {
+                dump_path = argv[++argi];
+            } else if (!env.parseArg(argc, argv, argi)) {
+                invalid(argv[argi]);
+            }
+        }
+        if (ops == 0 || repeat < 2) {
+            std::fprintf(stderr, "error: --ops can't be 0 and --repeat must "
+                                 "be at least 2\n");
+            std::exit(1);
+        }
+        if (limits && !use_pool) {
+            std::fprintf(stderr, "error: the limits of the pool need --pool\n");
+            std::exit(1);
+        }
+    }
+
+    bool parseTypes(const char *list) {
+        types.clear();
+        std::stringstream stream{list};
+        std::string name;
+        while (std::getline(stream, name, ',')) {
+            if (name == "device") {
+                types.push_back(UR_USM_TYPE_DEVICE);
+            } else if (name == "shared") {
+                types.push_back(UR_USM_TYPE_SHARED);
+            } else if (name == "host") {
+                types.push_back(UR_USM_TYPE_HOST);
+            } else {
+                return false;
+            }
+        }
+        return !types.empty();
+    }
+
+    void loadTrace() {
+        if (trace_name == "ml") {
+            trace = generateMl(ops, seed);
+            return;
+        } else if (trace_name == "graph") {
+            trace = generateGraph(ops, seed);
+            return;
+        } else if (trace_name == "random") {
+            trace = generateRandom(ops, seed);
+            return;
+        }
+
+        std::ifstream file(trace_name);
+        if (!file) {
+            std::fprintf(stderr, "error: cannot read %s\n", trace_name.c_str());
+            std::exit(1);
+        }
+        std::unordered_map<uint64_t, size_t> live;
+        std::string line;
+        for (size_t number = 1; std::getline(file, line); number++) {
+            std::stringstream stream{line};
+            std::string kind;
+            if (!(stream >> kind) || kind[0] == '#') {
+                continue;
+            }
+            op_t op{kind == "a", 0, 0};
+            bool valid = (kind == "a" || kind == "f") && (stream >> op.id);
+            if (valid && op.alloc) {
+                valid = (stream >> op.size) && op.size > 0 &&
+                        live.emplace(op.id, op.size).second;
+            } else if (valid) {
+                valid = live.erase(op.id) == 1;
+            }
+            if (!valid) {
+                std::fprintf(stderr, "error: %s:%zu: invalid operation: %s\n",
+                             trace_name.c_str(), number, line.c_str());
+                std::exit(1);
+            }
+            trace.push_back(op);
+        }
+        if (trace.empty()) {
+            std::fprintf(stderr, "error: %s is empty\n", trace_name.c_str());
+            std::exit(1);
+        }
+    }
+
+    void dumpTrace() {
+        std::ofstream file(dump_path);
+        file << "# " << trace_name << " trace, " << trace.size()
+             << " operations\n";
+        for (auto &op : trace) {
+            if (op.alloc) {
+                file << "a " << op.id << " " << op.size << "\n";
+            } else {
+                file << "f " << op.id << "\n";
+            }
+        }
+        if (!file) {
+            std::fprintf(stderr, "error: cannot write %s\n", dump_path.c_str());
+            std::exit(1);
+        }
+    }
+
+    ur_result_t allocate(ur_usm_type_t type, ur_usm_pool_handle_t pool,
+                         size_t size, void **ptr) {
+        switch (type) {
+        case UR_USM_TYPE_DEVICE:
+            return urUSMDeviceAlloc(env.context, env.device, nullptr, pool,
+                                    size, ptr);
+        case UR_USM_TYPE_SHARED:
+            return urUSMSharedAlloc(env.context, env.device, nullptr, pool,
+                                    size, ptr);
+        default:
+            return urUSMHostAlloc(env.context, nullptr, pool, size, ptr);
+        }
+    }
+
+    ur_usm_pool_handle_t createPool() {
+        ur_usm_pool_limits_desc_t limits_desc{
+            UR_STRUCTURE_TYPE_USM_POOL_LIMITS_DESC, nullptr,
+            max_poolable_size, slab_min_size};
+        ur_usm_pool_desc_t desc{UR_STRUCTURE_TYPE_USM_POOL_DESC,
+                                limits ? &limits_desc : nullptr, 0};
+        ur_usm_pool_handle_t pool = nullptr;
+        UR_CHECK(urUSMPoolCreate(env.context, &desc, &pool));
+        return pool;
+    }
+
+    // The bytes used by the live allocations of the pool and the bytes it
+    // holds besides, false when the adapter doesn't track them
+    static bool poolSizes(ur_usm_pool_handle_t pool, size_t &used,
+                          size_t &cached) {
+        used = 0;
+        cached = 0;
+        return urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_USED_SIZE,
+                                sizeof(used), &used,
+                                nullptr) == UR_RESULT_SUCCESS &&
+               urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_CACHED_SIZE,
+                                sizeof(cached), &cached,
+                                nullptr) == UR_RESULT_SUCCESS;
+    }
+
+    static latencies_t percentiles(std::vector<uint64_t> &samples) {
+        if (samples.empty()) {
+            return {0, 0, 0};
+        }
+        std::sort(samples.begin(), samples.end());
+        auto percentile = [&](double p) {
+            size_t index = static_cast<size_t>(p * (samples.size() - 1));
+            return static_cast<double>(samples[index]);
+        };
+        return {percentile(0.5), percentile(0.99),
+                static_cast<double>(samples.back())};
+    }
+
+    // False when the device doesn't support the allocations of type
+    bool measure(ur_usm_type_t type, measurement_t &m) {
+        ur_usm_pool_handle_t pool = use_pool ? createPool() : nullptr;
+        void *probe = nullptr;
+        if (allocate(type, pool, 64, &probe) != UR_RESULT_SUCCESS) {
+            if (pool) {
+                UR_CHECK(urUSMPoolRelease(pool));
+            }
+            return false;
+        }
+        UR_CHECK(urUSMFree(env.context, probe));
+
+        m = {type, {}, {}, 0, pool != nullptr, 0, 0.0};
+        std::vector<uint64_t> alloc_latencies;
+        std::vector<uint64_t> free_latencies;
+        std::unordered_map<uint64_t, std::pair<void *, size_t>> live;
+        size_t requested = 0;
+        for (size_t replay = 0; replay < repeat; replay++) {
+            // The first replay warms up the allocator
+            bool measured = replay > 0;
+            for (auto &op : trace) {
+                uint64_t ns = 0;
+                if (op.alloc) {
+                    void *ptr = nullptr;
+                    auto before = clock::now();
+                    UR_CHECK(allocate(type, pool, op.size, &ptr));
+                    ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             clock::now() - before)
+                             .count();
+                    live[op.id] = {ptr, op.size};
+                    requested += op.size;
+                    m.peak_requested = std::max(m.peak_requested, requested);
+                    if (measured) {
+                        alloc_latencies.push_back(ns);
+                    }
+                } else {
+                    auto it = live.find(op.id);
+                    auto before = clock::now();
+                    UR_CHECK(urUSMFree(env.context, it->second.first));
+                    ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             clock::now() - before)
+                             .count();
+                    requested -= it->second.second;
+                    live.erase(it);
+                    if (measured) {
+                        free_latencies.push_back(ns);
+                    }
+                }
+
+                size_t used = 0;
+                size_t cached = 0;
+                if (m.pool_stats) {
+                    m.pool_stats = poolSizes(pool, used, cached);
+                }
+                if (m.pool_stats && used + cached > m.peak_footprint) {
+                    m.peak_footprint = used + cached;
+                    m.fragmentation = static_cast<double>(cached) /
+                                      static_cast<double>(used + cached);
+                }
+            }
+            for (auto &[id, allocation] : live) {
+                UR_CHECK(urUSMFree(env.context, allocation.first));
+            }
+            live.clear();
+            requested = 0;
+        }
+        if (pool) {
+            UR_CHECK(urUSMPoolRelease(pool));
+        }
+        // Adapters without the statistics of the pool report it empty
+        m.pool_stats = m.pool_stats && m.peak_footprint > 0;
+        m.alloc = percentiles(alloc_latencies);
+        m.free = percentiles(free_latencies);
+        return true;
+    }
+
+    void run() {
+        std::vector<measurement_t> measurements;
+        for (auto type : types) {
+            measurement_t m;
+            if (!measure(type, m)) {
+                std::fprintf(stderr, "info: skipping unsupported %s USM\n",
+                             typeName(type));
+                continue;
+            }
+            measurements.push_back(m);
+        }
+
+        std::printf("{\n");
+        std::printf("  \"mock\": %s,\n", env.mock ? "true" : "false");
+        std::printf("  \"layers\": [");
+        for (size_t i = 0; i < env.layers.size(); i++) {
+            std::printf("%s\"%s\"", i ? ", " : "", env.layers[i].c_str());
+        }
+        std::printf("],\n");
+        std::printf("  \"trace\": \"%s\",\n", trace_name.c_str());
+        std::printf("  \"ops\": %zu,\n", trace.size());
+        std::printf("  \"pool\": %s,\n", use_pool ? "true" : "false");
+
+        std::printf("  \"types\": [");
+        for (size_t i = 0; i < measurements.size(); i++) {
+            auto &m = measurements[i];
+            std::printf("%s\n    {\"type\": \"%s\", \"alloc_p50_ns\": %.0f, "
+                        "\"alloc_p99_ns\": %.0f, \"alloc_max_ns\": %.0f, "
+                        "\"free_p50_ns\": %.0f, \"free_p99_ns\": %.0f, "
+                        "\"free_max_ns\": %.0f, "
+                        "\"peak_requested_bytes\": %zu",
+                        i ? "," : "", typeName(m.type), m.alloc.p50,
+                        m.alloc.p99, m.alloc.max, m.free.p50, m.free.p99,
+                        m.free.max, m.peak_requested);
+            if (m.pool_stats) {
+                std::printf(", \"peak_footprint_bytes\": %zu, "
+                            "\"fragmentation\": %.4f",
+                            m.peak_footprint, m.fragmentation);
+            }
+            std::printf("}");
+        }
+        std::printf("\n  ],\n");
+
+        // The same as results of scripts/benchmarks
+        std::printf("  \"results\": [");
+        const char *separator = "";
+        auto result = [&](const measurement_t &m, const char *label,
+                          double value, const char *unit, const char *format) {
+            std::printf("%s\n    {\"label\": \"%s %s\", \"value\": ", separator,
+                        typeName(m.type), label);
+            std::printf(format, value);
+            std::printf(", \"unit\": \"%s\", \"lower_is_better\": true}",
+                        unit);
+            separator = ",";
+        };
+        for (auto &m : measurements) {
+            result(m, "alloc p50 latency", m.alloc.p50, "ns", "%.0f");
+            result(m, "alloc p99 latency", m.alloc.p99, "ns", "%.0f");
+            result(m, "free p50 latency", m.free.p50, "ns", "%.0f");
+            result(m, "free p99 latency", m.free.p99, "ns", "%.0f");
+            if (m.pool_stats) {
+                result(m, "peak footprint",
+                       static_cast<double>(m.peak_footprint), "bytes",
+                       "%.0f");
+                result(m, "fragmentation at peak", m.fragmentation, "ratio",
+                       "%.4f");
+            }
+        }
+        std::printf("\n  ]\n}\n");
+    }
+};
+} // namespace ur_usm_alloc_replay
+
+int main(int argc, const char **argv) {
+    ur_usm_alloc_replay::app app{argc, argv};
+    app.run();
+    return 0;
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+struct urEnqueueKernelLaunchBatchExpTest : uur::urKernelExecutionTest {
+    void SetUp() override {
+        program_name = "fill";
+        UUR_RETURN_ON_FATAL_FAILURE(urKernelExecutionTest::SetUp());
+        launches[0] = {kernel, 1, &global_offset, &global_size, nullptr};
+        launches[1] = {kernel, 1, &global_offset, &global_size, nullptr};
+    }
+
+    uint32_t val = 42;
+    size_t global_size = 32;
+    size_t global_offset = 0;
+    ur_exp_kernel_launch_desc_t launches[2] = {};
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEnqueueKernelLaunchBatchExpTest);
+
+TEST_P(urEnqueueKernelLaunchBatchExpTest, Success) {
+    ur_mem_handle_t buffer = nullptr;
+    AddBuffer1DArg(sizeof(val) * global_size, &buffer);
+    AddPodArg(val);
+
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueKernelLaunchBatchExp(queue, 2, launches, 0, nullptr, &event));
+    ASSERT_NE(event, nullptr);
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    ValidateBuffer(buffer, sizeof(val) * global_size, val);
+    ASSERT_SUCCESS(urEventRelease(event));
+}
+
+TEST_P(urEnqueueKernelLaunchBatchExpTest, SuccessWithoutEvent) {
+    ur_mem_handle_t buffer = nullptr;
+    AddBuffer1DArg(sizeof(val) * global_size, &buffer);
+    AddPodArg(val);
+
+    ASSERT_SUCCESS(
+        urEnqueueKernelLaunchBatchExp(queue, 2, launches, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    ValidateBuffer(buffer, sizeof(val) * global_size, val);
+}
+
+TEST_P(urEnqueueKernelLaunchBatchExpTest, InvalidNullHandleQueue) {
+    ASSERT_EQ_RESULT(urEnqueueKernelLaunchBatchExp(nullptr, 2, launches, 0,
+                                                   nullptr, nullptr),
+                     UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+}
+
+TEST_P(urEnqueueKernelLaunchBatchExpTest, InvalidNullPointerLaunches) {
+    ASSERT_EQ_RESULT(
+        urEnqueueKernelLaunchBatchExp(queue, 2, nullptr, 0, nullptr, nullptr),
+        UR_RESULT_ERROR_INVALID_NULL_POINTER);
+}
+
+TEST_P(urEnqueueKernelLaunchBatchExpTest, InvalidSizeNumLaunches) {
+    ASSERT_EQ_RESULT(
+        urEnqueueKernelLaunchBatchExp(queue, 0, launches, 0, nullptr, nullptr),
+        UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST_P(urEnqueueKernelLaunchBatchExpTest, InvalidNullPtrEventWaitList) {
+    ASSERT_EQ_RESULT(
+        urEnqueueKernelLaunchBatchExp(queue, 2, launches, 1, nullptr, nullptr),
+        UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+
+    ur_event_handle_t validEvent;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &validEvent));
+
+    ASSERT_EQ_RESULT(urEnqueueKernelLaunchBatchExp(queue, 2, launches, 0,
+                                                   &validEvent, nullptr),
+                     UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+
+    ur_event_handle_t inv_evt = nullptr;
+    ASSERT_EQ_RESULT(urEnqueueKernelLaunchBatchExp(queue, 2, launches, 1,
+                                                   &inv_evt, nullptr),
+                     UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+    ASSERT_SUCCESS(urEventRelease(validEvent));
+}
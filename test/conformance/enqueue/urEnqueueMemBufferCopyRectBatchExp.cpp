@@ -0,0 +1,125 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <numeric>
+#include <uur/fixtures.h>
+
+struct urEnqueueMemBufferCopyRectBatchExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueTest::SetUp());
+        ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, size,
+                                         nullptr, &src_buffer));
+        ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, size,
+                                         nullptr, &dst_buffer));
+    }
+
+    void TearDown() override {
+        if (src_buffer) {
+            EXPECT_SUCCESS(urMemRelease(src_buffer));
+        }
+        if (dst_buffer) {
+            EXPECT_SUCCESS(urMemRelease(dst_buffer));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueTest::TearDown());
+    }
+
+    // 16x16 bytes buffers
+    static constexpr size_t pitch = 16;
+    static constexpr size_t size = pitch * pitch;
+    ur_mem_handle_t src_buffer = nullptr;
+    ur_mem_handle_t dst_buffer = nullptr;
+    ur_rect_offset_t src_origins[2] = {{0, 0, 0}, {8, 4, 0}};
+    ur_rect_offset_t dst_origins[2] = {{12, 0, 0}, {0, 12, 0}};
+    ur_rect_region_t regions[2] = {{4, 4, 1}, {4, 4, 1}};
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEnqueueMemBufferCopyRectBatchExpTest);
+
+TEST_P(urEnqueueMemBufferCopyRectBatchExpTest, Success) {
+    std::vector<uint8_t> input(size);
+    std::iota(input.begin(), input.end(), uint8_t{0});
+    std::vector<uint8_t> output(size, 0);
+    ASSERT_SUCCESS(urEnqueueMemBufferWrite(queue, src_buffer, false, 0, size,
+                                           input.data(), 0, nullptr,
+                                           nullptr));
+    ASSERT_SUCCESS(urEnqueueMemBufferWrite(queue, dst_buffer, false, 0, size,
+                                           output.data(), 0, nullptr,
+                                           nullptr));
+
+    ur_event_handle_t event = nullptr;
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(urEnqueueMemBufferCopyRectBatchExp(
+        queue, src_buffer, dst_buffer, 2, src_origins, dst_origins, regions,
+        pitch, size, pitch, size, 0, nullptr, &event));
+    ASSERT_NE(event, nullptr);
+    ASSERT_SUCCESS(urEnqueueMemBufferRead(queue, dst_buffer, true, 0, size,
+                                          output.data(), 1, &event, nullptr));
+    ASSERT_SUCCESS(urEventRelease(event));
+
+    std::vector<uint8_t> expected(size, 0);
+    for (size_t r = 0; r < 2; r++) {
+        for (size_t y = 0; y < regions[r].height; y++) {
+            for (size_t x = 0; x < regions[r].width; x++) {
+                expected[(dst_origins[r].y + y) * pitch + dst_origins[r].x +
+                         x] = input[(src_origins[r].y + y) * pitch +
+                                    src_origins[r].x + x];
+            }
+        }
+    }
+    ASSERT_EQ(expected, output);
+}
+
+TEST_P(urEnqueueMemBufferCopyRectBatchExpTest, InvalidNullHandleQueue) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urEnqueueMemBufferCopyRectBatchExp(
+                         nullptr, src_buffer, dst_buffer, 2, src_origins,
+                         dst_origins, regions, pitch, size, pitch, size, 0,
+                         nullptr, nullptr));
+}
+
+TEST_P(urEnqueueMemBufferCopyRectBatchExpTest, InvalidNullHandleBuffer) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urEnqueueMemBufferCopyRectBatchExp(
+                         queue, nullptr, dst_buffer, 2, src_origins,
+                         dst_origins, regions, pitch, size, pitch, size, 0,
+                         nullptr, nullptr));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urEnqueueMemBufferCopyRectBatchExp(
+                         queue, src_buffer, nullptr, 2, src_origins,
+                         dst_origins, regions, pitch, size, pitch, size, 0,
+                         nullptr, nullptr));
+}
+
+TEST_P(urEnqueueMemBufferCopyRectBatchExpTest, InvalidNullPointer) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEnqueueMemBufferCopyRectBatchExp(
+                         queue, src_buffer, dst_buffer, 2, nullptr,
+                         dst_origins, regions, pitch, size, pitch, size, 0,
+                         nullptr, nullptr));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEnqueueMemBufferCopyRectBatchExp(
+                         queue, src_buffer, dst_buffer, 2, src_origins,
+                         nullptr, regions, pitch, size, pitch, size, 0,
+                         nullptr, nullptr));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEnqueueMemBufferCopyRectBatchExp(
+                         queue, src_buffer, dst_buffer, 2, src_origins,
+                         dst_origins, nullptr, pitch, size, pitch, size, 0,
+                         nullptr, nullptr));
+}
+
+TEST_P(urEnqueueMemBufferCopyRectBatchExpTest, InvalidSize) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_SIZE,
+                     urEnqueueMemBufferCopyRectBatchExp(
+                         queue, src_buffer, dst_buffer, 0, src_origins,
+                         dst_origins, regions, pitch, size, pitch, size, 0,
+                         nullptr, nullptr));
+}
+
+TEST_P(urEnqueueMemBufferCopyRectBatchExpTest, InvalidEventWaitList) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST,
+                     urEnqueueMemBufferCopyRectBatchExp(
+                         queue, src_buffer, dst_buffer, 2, src_origins,
+                         dst_origins, regions, pitch, size, pitch, size, 1,
+                         nullptr, nullptr));
+}
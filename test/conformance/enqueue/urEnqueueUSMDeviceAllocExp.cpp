@@ -0,0 +1,72 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+using urEnqueueUSMDeviceAllocExpTest = uur::urQueueTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEnqueueUSMDeviceAllocExpTest);
+
+TEST_P(urEnqueueUSMDeviceAllocExpTest, Success) {
+    void *ptr = nullptr;
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(
+        urEnqueueUSMDeviceAllocExp(queue, 4096, 0, nullptr, &ptr, nullptr));
+    ASSERT_NE(ptr, nullptr);
+
+    uint8_t pattern = 0x42;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, ptr, sizeof(pattern), &pattern,
+                                    4096, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urEnqueueUSMFreeExp(queue, ptr, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+}
+
+TEST_P(urEnqueueUSMDeviceAllocExpTest, SuccessWithEvents) {
+    void *ptr = nullptr;
+    ur_event_handle_t alloc_event = nullptr;
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(urEnqueueUSMDeviceAllocExp(
+        queue, 4096, 0, nullptr, &ptr, &alloc_event));
+    ASSERT_NE(alloc_event, nullptr);
+
+    ur_event_handle_t free_event = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueUSMFreeExp(queue, ptr, 1, &alloc_event, &free_event));
+    ASSERT_NE(free_event, nullptr);
+    ASSERT_SUCCESS(urEventWait(1, &free_event));
+
+    ASSERT_SUCCESS(urEventRelease(alloc_event));
+    ASSERT_SUCCESS(urEventRelease(free_event));
+}
+
+TEST_P(urEnqueueUSMDeviceAllocExpTest, InvalidNullHandleQueue) {
+    void *ptr = nullptr;
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+        urEnqueueUSMDeviceAllocExp(nullptr, 4096, 0, nullptr, &ptr, nullptr));
+}
+
+TEST_P(urEnqueueUSMDeviceAllocExpTest, InvalidNullPointerMem) {
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_NULL_POINTER,
+        urEnqueueUSMDeviceAllocExp(queue, 4096, 0, nullptr, nullptr, nullptr));
+}
+
+TEST_P(urEnqueueUSMDeviceAllocExpTest, InvalidUSMSize) {
+    void *ptr = nullptr;
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_USM_SIZE,
+        urEnqueueUSMDeviceAllocExp(queue, 0, 0, nullptr, &ptr, nullptr));
+}
+
+TEST_P(urEnqueueUSMDeviceAllocExpTest, InvalidEventWaitList) {
+    void *ptr = nullptr;
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST,
+        urEnqueueUSMDeviceAllocExp(queue, 4096, 1, nullptr, &ptr, nullptr));
+}
+
+TEST_P(urEnqueueUSMDeviceAllocExpTest, InvalidNullPointerFree) {
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_NULL_POINTER,
+        urEnqueueUSMFreeExp(queue, nullptr, 0, nullptr, nullptr));
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+struct urEventGetExecutionStatusExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueTest::SetUp());
+        ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, size,
+                                         nullptr, &buffer));
+        input.assign(count, 42);
+        for (auto &event : events) {
+            ASSERT_SUCCESS(urEnqueueMemBufferWrite(queue, buffer, false, 0,
+                                                   size, input.data(), 0,
+                                                   nullptr, &event));
+        }
+        EXPECT_SUCCESS(urQueueFlush(queue));
+    }
+
+    void TearDown() override {
+        for (auto event : events) {
+            if (event) {
+                EXPECT_SUCCESS(urEventRelease(event));
+            }
+        }
+        if (buffer) {
+            EXPECT_SUCCESS(urMemRelease(buffer));
+        }
+        urQueueTest::TearDown();
+    }
+
+    const size_t count = 1024;
+    const size_t size = sizeof(uint32_t) * count;
+    ur_mem_handle_t buffer = nullptr;
+    std::array<ur_event_handle_t, 3> events = {};
+    std::vector<uint32_t> input;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEventGetExecutionStatusExpTest);
+
+TEST_P(urEventGetExecutionStatusExpTest, Success) {
+    std::array<ur_event_status_t, 3> statuses = {};
+    ASSERT_SUCCESS(urEventGetExecutionStatusExp(
+        static_cast<uint32_t>(events.size()), events.data(), statuses.data()));
+
+    // The writes may still be in flight, so any non-error status is valid
+    for (auto status : statuses) {
+        ASSERT_NE(status, UR_EVENT_STATUS_ERROR);
+    }
+
+    ASSERT_SUCCESS(
+        urEventWait(static_cast<uint32_t>(events.size()), events.data()));
+    ASSERT_SUCCESS(urEventGetExecutionStatusExp(
+        static_cast<uint32_t>(events.size()), events.data(), statuses.data()));
+    for (size_t i = 0; i < events.size(); i++) {
+        ur_event_status_t status;
+        ASSERT_SUCCESS(urEventGetInfo(events[i],
+                                      UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                      sizeof(status), &status, nullptr));
+        ASSERT_EQ(status, UR_EVENT_STATUS_COMPLETE);
+        ASSERT_EQ(statuses[i], status);
+    }
+}
+
+TEST_P(urEventGetExecutionStatusExpTest, InvalidNullPointerEventList) {
+    ur_event_status_t status;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEventGetExecutionStatusExp(1, nullptr, &status));
+}
+
+TEST_P(urEventGetExecutionStatusExpTest, InvalidNullPointerStatuses) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEventGetExecutionStatusExp(1, events.data(), nullptr));
+}
+
+TEST_P(urEventGetExecutionStatusExpTest, ZeroSize) {
+    ur_event_status_t status;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_VALUE,
+                     urEventGetExecutionStatusExp(0, events.data(), &status));
+}
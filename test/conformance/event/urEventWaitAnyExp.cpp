@@ -0,0 +1,92 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+struct urEventWaitAnyExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueTest::SetUp());
+        ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, size,
+                                         nullptr, &buffer));
+        input.assign(count, 42);
+        for (auto &event : events) {
+            ASSERT_SUCCESS(urEnqueueMemBufferWrite(queue, buffer, false, 0,
+                                                   size, input.data(), 0,
+                                                   nullptr, &event));
+        }
+        EXPECT_SUCCESS(urQueueFlush(queue));
+    }
+
+    void TearDown() override {
+        for (auto event : events) {
+            if (event) {
+                EXPECT_SUCCESS(urEventRelease(event));
+            }
+        }
+        if (buffer) {
+            EXPECT_SUCCESS(urMemRelease(buffer));
+        }
+        urQueueTest::TearDown();
+    }
+
+    const size_t count = 1024;
+    const size_t size = sizeof(uint32_t) * count;
+    ur_mem_handle_t buffer = nullptr;
+    std::array<ur_event_handle_t, 3> events = {};
+    std::vector<uint32_t> input;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEventWaitAnyExpTest);
+
+TEST_P(urEventWaitAnyExpTest, Success) {
+    uint32_t index = UINT32_MAX;
+    ASSERT_SUCCESS(urEventWaitAnyExp(static_cast<uint32_t>(events.size()),
+                                     events.data(), &index));
+    ASSERT_LT(index, events.size());
+
+    ur_event_status_t status;
+    ASSERT_SUCCESS(urEventGetInfo(events[index],
+                                  UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                  sizeof(status), &status, nullptr));
+    ASSERT_EQ(status, UR_EVENT_STATUS_COMPLETE);
+
+    ASSERT_SUCCESS(
+        urEventWait(static_cast<uint32_t>(events.size()), events.data()));
+}
+
+TEST_P(urEventWaitAnyExpTest, SuccessSingleEvent) {
+    uint32_t index = UINT32_MAX;
+    ASSERT_SUCCESS(urEventWaitAnyExp(1, &events.back(), &index));
+    ASSERT_EQ(index, 0);
+
+    ASSERT_SUCCESS(
+        urEventWait(static_cast<uint32_t>(events.size()), events.data()));
+}
+
+TEST_P(urEventWaitAnyExpTest, SuccessCompletedEvents) {
+    ASSERT_SUCCESS(
+        urEventWait(static_cast<uint32_t>(events.size()), events.data()));
+
+    uint32_t index = UINT32_MAX;
+    ASSERT_SUCCESS(urEventWaitAnyExp(static_cast<uint32_t>(events.size()),
+                                     events.data(), &index));
+    ASSERT_LT(index, events.size());
+}
+
+TEST_P(urEventWaitAnyExpTest, InvalidNullPointerEventList) {
+    uint32_t index = 0;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEventWaitAnyExp(1, nullptr, &index));
+}
+
+TEST_P(urEventWaitAnyExpTest, InvalidNullPointerEventIndex) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEventWaitAnyExp(1, events.data(), nullptr));
+}
+
+TEST_P(urEventWaitAnyExpTest, ZeroSize) {
+    uint32_t index = 0;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_VALUE,
+                     urEventWaitAnyExp(0, events.data(), &index));
+}
@@ -58,3 +58,57 @@ TEST_F(urP2PTest, Success) {
     ASSERT_SUCCESS(urUsmP2PEnablePeerAccessExp(devices[0], devices[1]));
     ASSERT_SUCCESS(urUsmP2PDisablePeerAccessExp(devices[0], devices[1]));
 }
+
+TEST_F(urP2PTest, Topology) {
+    if (devices.size() < 2) {
+        GTEST_SKIP();
+    }
+
+    size_t returned_size;
+    ASSERT_SUCCESS(urDeviceGetInfo(devices[0], UR_DEVICE_INFO_EXTENSIONS, 0,
+                                   nullptr, &returned_size));
+    std::string extensions(returned_size, '\0');
+    ASSERT_SUCCESS(urDeviceGetInfo(devices[0], UR_DEVICE_INFO_EXTENSIONS,
+                                   returned_size, extensions.data(), nullptr));
+    if (extensions.find(UR_USM_P2P_EXTENSION_STRING_EXP) ==
+        std::string::npos) {
+        GTEST_SKIP() << "EXP usm p2p feature is not supported.";
+    }
+
+    ur_exp_peer_link_type_t link_type;
+    ASSERT_SUCCESS(urUsmP2PPeerAccessGetInfoExp(
+        devices[0], devices[1], UR_EXP_PEER_INFO_UR_PEER_LINK_TYPE,
+        sizeof(link_type), &link_type, nullptr));
+
+    uint32_t hop_count;
+    ASSERT_SUCCESS(urUsmP2PPeerAccessGetInfoExp(
+        devices[0], devices[1], UR_EXP_PEER_INFO_UR_PEER_HOP_COUNT,
+        sizeof(hop_count), &hop_count, nullptr));
+    ASSERT_EQ(link_type == UR_EXP_PEER_LINK_TYPE_NONE, hop_count == 0);
+
+    // the bandwidth may be unknown
+    uint64_t bandwidth;
+    ASSERT_SUCCESS(urUsmP2PPeerAccessGetInfoExp(
+        devices[0], devices[1], UR_EXP_PEER_INFO_UR_PEER_BANDWIDTH,
+        sizeof(bandwidth), &bandwidth, nullptr));
+
+    ur_exp_peer_copy_route_t route;
+    ASSERT_SUCCESS(urUsmP2PPeerAccessGetInfoExp(
+        devices[0], devices[1], UR_EXP_PEER_INFO_UR_PEER_COPY_ROUTE,
+        sizeof(route), &route, nullptr));
+    ur_device_handle_t intermediate;
+    ASSERT_SUCCESS(urUsmP2PPeerAccessGetInfoExp(
+        devices[0], devices[1],
+        UR_EXP_PEER_INFO_UR_PEER_COPY_INTERMEDIATE_DEVICE,
+        sizeof(intermediate), &intermediate, nullptr));
+    if (route == UR_EXP_PEER_COPY_ROUTE_DEVICE) {
+        ASSERT_NE(intermediate, nullptr);
+        ASSERT_NE(intermediate, devices[0]);
+        ASSERT_NE(intermediate, devices[1]);
+    } else {
+        ASSERT_EQ(intermediate, nullptr);
+    }
+    if (route == UR_EXP_PEER_COPY_ROUTE_DIRECT) {
+        ASSERT_NE(link_type, UR_EXP_PEER_LINK_TYPE_NONE);
+    }
+}
@@ -0,0 +1,88 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+struct urKernelSetArgsExpTest : uur::urKernelExecutionTest {
+    void SetUp() override {
+        program_name = "fill_usm";
+        UUR_RETURN_ON_FATAL_FAILURE(urKernelExecutionTest::SetUp());
+
+        ur_device_usm_access_capability_flags_t device_usm_flags = 0;
+        ASSERT_SUCCESS(
+            uur::GetDeviceUSMDeviceSupport(device, device_usm_flags));
+        if (!(device_usm_flags & UR_DEVICE_USM_ACCESS_CAPABILITY_FLAG_ACCESS)) {
+            GTEST_SKIP() << "Device USM is not supported.";
+        }
+        ASSERT_SUCCESS(urUSMDeviceAlloc(context, device, nullptr, nullptr,
+                                        allocation_size, &allocation));
+        ASSERT_NE(allocation, nullptr);
+
+        args[0].type = UR_EXP_KERNEL_ARG_TYPE_POINTER;
+        args[0].index = 0;
+        args[0].value.pointer = allocation;
+        args[1].type = UR_EXP_KERNEL_ARG_TYPE_VALUE;
+        args[1].index = 1;
+        args[1].size = sizeof(data);
+        args[1].value.value = &data;
+    }
+
+    void TearDown() override {
+        if (allocation) {
+            ASSERT_SUCCESS(urUSMFree(context, allocation));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(urKernelExecutionTest::TearDown());
+    }
+
+    void ValidateAllocation(uint32_t expected) {
+        std::vector<uint32_t> host_data(array_size);
+        ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, host_data.data(),
+                                          allocation, allocation_size, 0,
+                                          nullptr, nullptr));
+        for (size_t i = 0; i < array_size; i++) {
+            ASSERT_EQ(host_data[i], expected);
+        }
+    }
+
+    void *allocation = nullptr;
+    size_t array_size = 16;
+    size_t allocation_size = array_size * sizeof(uint32_t);
+    uint32_t data = 42;
+    ur_exp_kernel_arg_properties_t args[2] = {};
+};
+UUR_INSTANTIATE_KERNEL_TEST_SUITE_P(urKernelSetArgsExpTest);
+
+TEST_P(urKernelSetArgsExpTest, Success) {
+    ASSERT_SUCCESS(urKernelSetArgsExp(kernel, 2, args));
+    Launch1DRange(array_size);
+    ValidateAllocation(data);
+}
+
+TEST_P(urKernelSetArgsExpTest, SuccessReplaceArgument) {
+    ASSERT_SUCCESS(urKernelSetArgsExp(kernel, 2, args));
+
+    // Setting an argument again replaces its value
+    uint32_t new_data = 7;
+    ur_exp_kernel_arg_properties_t new_arg = args[1];
+    new_arg.value.value = &new_data;
+    ASSERT_SUCCESS(urKernelSetArgsExp(kernel, 1, &new_arg));
+    Launch1DRange(array_size);
+    ValidateAllocation(new_data);
+}
+
+TEST_P(urKernelSetArgsExpTest, InvalidNullHandleKernel) {
+    ASSERT_EQ_RESULT(urKernelSetArgsExp(nullptr, 2, args),
+                     UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+}
+
+TEST_P(urKernelSetArgsExpTest, InvalidNullPointerArgs) {
+    ASSERT_EQ_RESULT(urKernelSetArgsExp(kernel, 2, nullptr),
+                     UR_RESULT_ERROR_INVALID_NULL_POINTER);
+}
+
+TEST_P(urKernelSetArgsExpTest, InvalidSizeNumArgs) {
+    ASSERT_EQ_RESULT(urKernelSetArgsExp(kernel, 0, args),
+                     UR_RESULT_ERROR_INVALID_SIZE);
+}
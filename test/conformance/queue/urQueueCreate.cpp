@@ -34,7 +34,8 @@ UUR_TEST_SUITE_P(urQueueCreateWithParamTest,
                                  UR_QUEUE_FLAG_SUBMISSION_BATCHED,
                                  UR_QUEUE_FLAG_SUBMISSION_IMMEDIATE,
                                  UR_QUEUE_FLAG_USE_DEFAULT_STREAM,
-                                 UR_QUEUE_FLAG_SYNC_WITH_DEFAULT_STREAM),
+                                 UR_QUEUE_FLAG_SYNC_WITH_DEFAULT_STREAM,
+                                 UR_QUEUE_FLAG_LOAD_BALANCED),
                  uur::deviceTestWithParamPrinter<ur_queue_flag_t>);
 
 TEST_P(urQueueCreateWithParamTest, SuccessWithProperties) {
@@ -2,6 +2,7 @@
 // Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
 // See LICENSE.TXT
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <array>
 #include <map>
 #include <uur/fixtures.h>
 
@@ -13,6 +14,12 @@ std::unordered_map<ur_queue_info_t, size_t> queue_info_size_map = {
     {UR_QUEUE_INFO_REFERENCE_COUNT, sizeof(uint32_t)},
     {UR_QUEUE_INFO_SIZE, sizeof(uint32_t)},
     {UR_QUEUE_INFO_EMPTY, sizeof(ur_bool_t)},
+    {UR_QUEUE_INFO_COMMAND_COUNTS, 4 * sizeof(uint64_t)},
+    {UR_QUEUE_INFO_BYTES_COPIED, 4 * sizeof(uint64_t)},
+    {UR_QUEUE_INFO_BATCH_COUNT, sizeof(uint64_t)},
+    {UR_QUEUE_INFO_AVERAGE_BATCH_SIZE, sizeof(double)},
+    {UR_QUEUE_INFO_HOST_WAIT_TIME, sizeof(uint64_t)},
+    {UR_QUEUE_INFO_CREATED_EVENT_COUNT, sizeof(uint64_t)},
 };
 
 using urQueueGetInfoTestWithInfoParam =
@@ -22,7 +29,13 @@ UUR_TEST_SUITE_P(urQueueGetInfoTestWithInfoParam,
                  ::testing::Values(UR_QUEUE_INFO_CONTEXT, UR_QUEUE_INFO_DEVICE,
                                    UR_QUEUE_INFO_FLAGS,
                                    UR_QUEUE_INFO_REFERENCE_COUNT,
-                                   UR_QUEUE_INFO_EMPTY),
+                                   UR_QUEUE_INFO_EMPTY,
+                                   UR_QUEUE_INFO_COMMAND_COUNTS,
+                                   UR_QUEUE_INFO_BYTES_COPIED,
+                                   UR_QUEUE_INFO_BATCH_COUNT,
+                                   UR_QUEUE_INFO_AVERAGE_BATCH_SIZE,
+                                   UR_QUEUE_INFO_HOST_WAIT_TIME,
+                                   UR_QUEUE_INFO_CREATED_EVENT_COUNT),
                  uur::deviceTestWithParamPrinter<ur_queue_info_t>);
 
 TEST_P(urQueueGetInfoTestWithInfoParam, Success) {
@@ -131,6 +144,38 @@ TEST_P(urQueueGetInfoDeviceQueueTestWithInfoParam, Success) {
 using urQueueGetInfoTest = uur::urQueueTest;
 UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urQueueGetInfoTest);
 
+TEST_P(urQueueGetInfoTest, TelemetryCountsCommands) {
+    std::array<uint64_t, 4> counts_before{};
+    auto result =
+        urQueueGetInfo(queue, UR_QUEUE_INFO_COMMAND_COUNTS,
+                       sizeof(counts_before), counts_before.data(), nullptr);
+    if (result == UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION) {
+        GTEST_SKIP() << "Queue telemetry is not supported.";
+    }
+    ASSERT_SUCCESS(result);
+    uint64_t events_before = 0;
+    ASSERT_SUCCESS(urQueueGetInfo(queue, UR_QUEUE_INFO_CREATED_EVENT_COUNT,
+                                  sizeof(events_before), &events_before,
+                                  nullptr));
+
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &event));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    ASSERT_SUCCESS(urEventRelease(event));
+
+    std::array<uint64_t, 4> counts_after{};
+    ASSERT_SUCCESS(urQueueGetInfo(queue, UR_QUEUE_INFO_COMMAND_COUNTS,
+                                  sizeof(counts_after), counts_after.data(),
+                                  nullptr));
+    // The wait is neither a launch, a copy nor a fill
+    ASSERT_GT(counts_after[3], counts_before[3]);
+    uint64_t events_after = 0;
+    ASSERT_SUCCESS(urQueueGetInfo(queue, UR_QUEUE_INFO_CREATED_EVENT_COUNT,
+                                  sizeof(events_after), &events_after,
+                                  nullptr));
+    ASSERT_GT(events_after, events_before);
+}
+
 TEST_P(urQueueGetInfoTest, InvalidNullHandleQueue) {
     ur_context_handle_t context = nullptr;
     ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
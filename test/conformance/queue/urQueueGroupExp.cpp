@@ -0,0 +1,114 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "uur/fixtures.h"
+#include "uur/raii.h"
+
+#include <algorithm>
+
+struct urQueueGroupExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::SetUp());
+        ASSERT_SUCCESS(urQueueCreate(context, device, &queue_properties,
+                                     second_queue.ptr()));
+        queues = {queue, second_queue};
+        ASSERT_SUCCESS(
+            urQueueGroupCreateExp(2, queues.data(), &queue_group));
+        ASSERT_NE(queue_group, nullptr);
+    }
+
+    void TearDown() override {
+        if (queue_group) {
+            EXPECT_SUCCESS(urQueueGroupReleaseExp(queue_group));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::TearDown());
+    }
+
+    uur::raii::Queue second_queue = nullptr;
+    std::vector<ur_queue_handle_t> queues;
+    ur_exp_queue_group_handle_t queue_group = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urQueueGroupExpTest);
+
+TEST_P(urQueueGroupExpTest, SuccessGetQueue) {
+    ur_queue_handle_t first = nullptr;
+    ASSERT_SUCCESS(urQueueGroupGetQueueExp(queue_group, &first));
+    ASSERT_NE(std::find(queues.begin(), queues.end(), first), queues.end());
+
+    // The queues are idle, so they take turns
+    ur_queue_handle_t second = nullptr;
+    ASSERT_SUCCESS(urQueueGroupGetQueueExp(queue_group, &second));
+    ASSERT_NE(std::find(queues.begin(), queues.end(), second), queues.end());
+    ASSERT_NE(first, second);
+}
+
+TEST_P(urQueueGroupExpTest, SuccessRetain) {
+    ASSERT_SUCCESS(urQueueGroupRetainExp(queue_group));
+    EXPECT_SUCCESS(urQueueGroupReleaseExp(queue_group));
+}
+
+TEST_P(urQueueGroupExpTest, SuccessFinish) {
+    constexpr size_t buffer_size = 1024;
+    uur::raii::Mem buffer = nullptr;
+    ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE,
+                                     buffer_size, nullptr, buffer.ptr()));
+
+    ur_queue_handle_t member = nullptr;
+    ASSERT_SUCCESS(urQueueGroupGetQueueExp(queue_group, &member));
+    uur::raii::Event event = nullptr;
+    std::vector<uint8_t> data(buffer_size, 42);
+    ASSERT_SUCCESS(urEnqueueMemBufferWrite(member, buffer, false, 0,
+                                           buffer_size, data.data(), 0,
+                                           nullptr, event.ptr()));
+    ASSERT_SUCCESS(urQueueGroupFinishExp(queue_group));
+
+    ur_event_status_t exec_status;
+    ASSERT_SUCCESS(urEventGetInfo(event, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                  sizeof(exec_status), &exec_status, nullptr));
+    ASSERT_EQ(exec_status, UR_EXECUTION_INFO_COMPLETE);
+}
+
+TEST_P(urQueueGroupExpTest, SuccessBarrier) {
+    uur::raii::Event event = nullptr;
+    ASSERT_SUCCESS(
+        urQueueGroupBarrierExp(queue_group, 0, nullptr, event.ptr()));
+    ASSERT_NE(event, nullptr);
+    ASSERT_SUCCESS(urEventWait(1, event.ptr()));
+    ASSERT_SUCCESS(urQueueGroupBarrierExp(queue_group, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueGroupFinishExp(queue_group));
+}
+
+TEST_P(urQueueGroupExpTest, InvalidNullHandle) {
+    ur_queue_handle_t member = nullptr;
+    ASSERT_EQ_RESULT(urQueueGroupGetQueueExp(nullptr, &member),
+                     UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+    ASSERT_EQ_RESULT(urQueueGroupFinishExp(nullptr),
+                     UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+    ASSERT_EQ_RESULT(urQueueGroupBarrierExp(nullptr, 0, nullptr, nullptr),
+                     UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+    ur_queue_handle_t null_queue = nullptr;
+    ur_exp_queue_group_handle_t group = nullptr;
+    ASSERT_EQ_RESULT(urQueueGroupCreateExp(1, &null_queue, &group),
+                     UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+}
+
+TEST_P(urQueueGroupExpTest, InvalidNullPointer) {
+    ASSERT_EQ_RESULT(urQueueGroupGetQueueExp(queue_group, nullptr),
+                     UR_RESULT_ERROR_INVALID_NULL_POINTER);
+    ASSERT_EQ_RESULT(urQueueGroupCreateExp(2, queues.data(), nullptr),
+                     UR_RESULT_ERROR_INVALID_NULL_POINTER);
+}
+
+TEST_P(urQueueGroupExpTest, InvalidSize) {
+    ur_exp_queue_group_handle_t group = nullptr;
+    ASSERT_EQ_RESULT(urQueueGroupCreateExp(0, queues.data(), &group),
+                     UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST_P(urQueueGroupExpTest, InvalidEventWaitList) {
+    ASSERT_EQ_RESULT(urQueueGroupBarrierExp(queue_group, 1, nullptr, nullptr),
+                     UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+}
@@ -0,0 +1,108 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "uur/fixtures.h"
+#include "uur/raii.h"
+
+struct urQueueTimestampMarkersExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::SetUp());
+        UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(
+            urQueueReserveTimestampMarkersExp(queue, capacity));
+    }
+
+    static constexpr uint32_t capacity = 4;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urQueueTimestampMarkersExpTest);
+
+TEST_P(urQueueTimestampMarkersExpTest, Success) {
+    uint64_t first = 0;
+    uint64_t second = 0;
+    ASSERT_SUCCESS(urEnqueueTimestampMarkerExp(queue, 0, nullptr, &first));
+    ASSERT_SUCCESS(urEnqueueTimestampMarkerExp(queue, 0, nullptr, &second));
+    ASSERT_EQ(second, first + 1);
+
+    uint64_t timestamps[2] = {};
+    ASSERT_SUCCESS(urQueueReadTimestampMarkersExp(queue, first, 2, timestamps));
+    ASSERT_GT(timestamps[0], 0);
+    ASSERT_GE(timestamps[1], timestamps[0]);
+}
+
+TEST_P(urQueueTimestampMarkersExpTest, SuccessWaitList) {
+    uur::raii::Event event = nullptr;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, event.ptr()));
+
+    uint64_t marker = 0;
+    ASSERT_SUCCESS(urEnqueueTimestampMarkerExp(queue, 1, event.ptr(), &marker));
+    uint64_t timestamp = 0;
+    ASSERT_SUCCESS(
+        urQueueReadTimestampMarkersExp(queue, marker, 1, &timestamp));
+    ASSERT_GT(timestamp, 0);
+}
+
+TEST_P(urQueueTimestampMarkersExpTest, SuccessAfterFinish) {
+    ASSERT_SUCCESS(urEnqueueTimestampMarkerExp(queue, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    uint64_t timestamp = 0;
+    ASSERT_SUCCESS(urQueueReadTimestampMarkersExp(queue, 0, 1, &timestamp));
+    ASSERT_GT(timestamp, 0);
+}
+
+TEST_P(urQueueTimestampMarkersExpTest, OverwrittenMarkers) {
+    for (uint32_t i = 0; i < capacity + 2; i++) {
+        ASSERT_SUCCESS(urEnqueueTimestampMarkerExp(queue, 0, nullptr, nullptr));
+    }
+
+    // the markers 0 and 1 were overwritten by capacity and capacity + 1
+    uint64_t timestamps[capacity] = {};
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_VALUE,
+                     urQueueReadTimestampMarkersExp(queue, 0, 1, timestamps));
+    ASSERT_SUCCESS(
+        urQueueReadTimestampMarkersExp(queue, 2, capacity, timestamps));
+}
+
+TEST_P(urQueueTimestampMarkersExpTest, InvalidValueNotEnqueued) {
+    uint64_t timestamp = 0;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_VALUE,
+                     urQueueReadTimestampMarkersExp(queue, 0, 1, &timestamp));
+}
+
+TEST_P(urQueueTimestampMarkersExpTest, InvalidOperationReservedTwice) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_OPERATION,
+                     urQueueReserveTimestampMarkersExp(queue, capacity));
+}
+
+TEST_P(urQueueTimestampMarkersExpTest, InvalidNullHandleQueue) {
+    uint64_t timestamp = 0;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urQueueReserveTimestampMarkersExp(nullptr, capacity));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urEnqueueTimestampMarkerExp(nullptr, 0, nullptr, nullptr));
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+        urQueueReadTimestampMarkersExp(nullptr, 0, 1, &timestamp));
+}
+
+TEST_P(urQueueTimestampMarkersExpTest, InvalidNullPointerTimestamps) {
+    ASSERT_SUCCESS(urEnqueueTimestampMarkerExp(queue, 0, nullptr, nullptr));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urQueueReadTimestampMarkersExp(queue, 0, 1, nullptr));
+}
+
+TEST_P(urQueueTimestampMarkersExpTest, InvalidSize) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_SIZE,
+                     urQueueReserveTimestampMarkersExp(queue, 0));
+
+    uint64_t timestamp = 0;
+    ASSERT_SUCCESS(urEnqueueTimestampMarkerExp(queue, 0, nullptr, nullptr));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_SIZE,
+                     urQueueReadTimestampMarkersExp(queue, 0, 0, &timestamp));
+}
+
+TEST_P(urQueueTimestampMarkersExpTest, InvalidEventWaitList) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST,
+                     urEnqueueTimestampMarkerExp(queue, 1, nullptr, nullptr));
+}
@@ -53,3 +53,36 @@ TEST_P(urUSMPoolCreateTest, InvalidEnumerationFlags) {
     ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_ENUMERATION,
                      urUSMPoolCreate(context, &pool_desc, &pool));
 }
+
+TEST_P(urUSMPoolCreateTest, SuccessWithHostPoolDesc) {
+    ur_exp_usm_host_pool_desc_t host_pool_desc{
+        UR_STRUCTURE_TYPE_EXP_USM_HOST_POOL_DESC, nullptr, 0,
+        UR_EXP_USM_HOST_POOL_FLAG_NUMA_LOCAL};
+    ur_usm_pool_desc_t pool_desc{UR_STRUCTURE_TYPE_USM_POOL_DESC,
+                                 &host_pool_desc, 0};
+    ur_usm_pool_handle_t pool = nullptr;
+    auto result = urUSMPoolCreate(context, &pool_desc, &pool);
+    if (result == UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
+        GTEST_SKIP() << "Placing the host memory of pools is not supported";
+    }
+    ASSERT_SUCCESS(result);
+    ASSERT_NE(pool, nullptr);
+
+    int *ptr = nullptr;
+    ASSERT_SUCCESS(urUSMHostAlloc(context, nullptr, pool, sizeof(int),
+                                  reinterpret_cast<void **>(&ptr)));
+    ASSERT_NE(ptr, nullptr);
+    *ptr = 42;
+    EXPECT_SUCCESS(urUSMFree(context, ptr));
+    EXPECT_SUCCESS(urUSMPoolRelease(pool));
+}
+
+TEST_P(urUSMPoolCreateTest, InvalidValueHostPoolPageSize) {
+    ur_exp_usm_host_pool_desc_t host_pool_desc{
+        UR_STRUCTURE_TYPE_EXP_USM_HOST_POOL_DESC, nullptr, 3, 0};
+    ur_usm_pool_desc_t pool_desc{UR_STRUCTURE_TYPE_USM_POOL_DESC,
+                                 &host_pool_desc, 0};
+    ur_usm_pool_handle_t pool = nullptr;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_VALUE,
+                     urUSMPoolCreate(context, &pool_desc, &pool));
+}
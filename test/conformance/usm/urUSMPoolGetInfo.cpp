@@ -81,3 +81,68 @@ TEST_P(urUSMPoolGetInfoTest, InvalidNullPointerPropSizeRet) {
         UR_RESULT_ERROR_INVALID_NULL_POINTER,
         urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_CONTEXT, 0, nullptr, nullptr));
 }
+
+TEST_P(urUSMPoolGetInfoTest, UsageStats) {
+    size_t size = 0;
+    auto result = urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_BUCKET_MISSES, 0,
+                                   nullptr, &size);
+    if (result == UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION) {
+        GTEST_SKIP() << "pool usage stats are not supported";
+    }
+    ASSERT_SUCCESS(result);
+    ASSERT_NE(size, 0);
+    ASSERT_EQ(size % sizeof(uint64_t), 0);
+
+    // The used sizes may only be counted on request, they are costly
+    size_t used_before = 0;
+    result = urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_USED_SIZE,
+                              sizeof(used_before), &used_before, nullptr);
+    bool sizes_supported = result != UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    if (sizes_supported) {
+        ASSERT_SUCCESS(result);
+    }
+
+    const size_t allocation_size = 4096;
+    void *ptr = nullptr;
+    ASSERT_SUCCESS(urUSMDeviceAlloc(context, device, nullptr, pool,
+                                    allocation_size, &ptr));
+
+    size_t used = 0;
+    if (sizes_supported) {
+        ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_USED_SIZE,
+                                        sizeof(used), &used, nullptr));
+        ASSERT_EQ(used, used_before + allocation_size);
+    }
+
+    std::vector<uint64_t> misses(size / sizeof(uint64_t));
+    ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_BUCKET_MISSES, size,
+                                    misses.data(), nullptr));
+    std::vector<uint64_t> hits(size / sizeof(uint64_t));
+    ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_BUCKET_HITS, size,
+                                    hits.data(), nullptr));
+    uint64_t allocations = 0;
+    for (size_t i = 0; i < hits.size(); ++i) {
+        allocations += hits[i] + misses[i];
+    }
+    ASSERT_GE(allocations, 1);
+
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+    if (!sizes_supported) {
+        return;
+    }
+
+    size_t peak = 0;
+    ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_PEAK_USED_SIZE,
+                                    sizeof(peak), &peak, nullptr));
+    ASSERT_GE(peak, allocation_size);
+    ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_USED_SIZE,
+                                    sizeof(used), &used, nullptr));
+    ASSERT_EQ(used, used_before);
+
+    double fragmentation = -1.0;
+    ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_FRAGMENTATION,
+                                    sizeof(fragmentation), &fragmentation,
+                                    nullptr));
+    ASSERT_GE(fragmentation, 0.0);
+    ASSERT_LE(fragmentation, 1.0);
+}
@@ -0,0 +1,53 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "ur_api.h"
+#include <uur/fixtures.h>
+
+using urUSMPoolTrimExpTest = uur::urUSMPoolTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urUSMPoolTrimExpTest);
+
+TEST_P(urUSMPoolTrimExpTest, Success) {
+    void *ptr = nullptr;
+    ASSERT_SUCCESS(
+        urUSMDeviceAlloc(context, device, nullptr, pool, 4096, &ptr));
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(urUSMPoolTrimExp(context, pool, 0));
+}
+
+TEST_P(urUSMPoolTrimExpTest, SuccessAllPools) {
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(urUSMPoolTrimExp(context, nullptr, 0));
+}
+
+TEST_P(urUSMPoolTrimExpTest, SuccessLiveAllocation) {
+    void *ptr = nullptr;
+    ASSERT_SUCCESS(
+        urUSMDeviceAlloc(context, device, nullptr, pool, 4096, &ptr));
+
+    auto result = urUSMPoolTrimExp(context, pool, 0);
+    if (result == UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
+        ASSERT_SUCCESS(urUSMFree(context, ptr));
+        GTEST_SKIP();
+    }
+    ASSERT_SUCCESS(result);
+
+    ur_usm_pool_handle_t ptr_pool = nullptr;
+    ASSERT_SUCCESS(urUSMGetMemAllocInfo(context, ptr, UR_USM_ALLOC_INFO_POOL,
+                                        sizeof(ptr_pool), &ptr_pool,
+                                        nullptr));
+    ASSERT_EQ(ptr_pool, pool);
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+
+    // The pool is still usable after being trimmed
+    ASSERT_SUCCESS(
+        urUSMDeviceAlloc(context, device, nullptr, pool, 4096, &ptr));
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+}
+
+TEST_P(urUSMPoolTrimExpTest, InvalidNullHandleContext) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urUSMPoolTrimExp(nullptr, pool, 0));
+}
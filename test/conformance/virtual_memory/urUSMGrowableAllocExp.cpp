@@ -0,0 +1,83 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <uur/fixtures.h>
+
+using urUSMGrowableAllocExpTest = uur::urVirtualMemGranularityTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urUSMGrowableAllocExpTest);
+
+TEST_P(urUSMGrowableAllocExpTest, Success) {
+    void *ptr = nullptr;
+    ASSERT_SUCCESS(urUSMGrowableAllocExp(context, device, 64 * granularity,
+                                         granularity, &ptr));
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_SUCCESS(urUSMGrowableFreeExp(context, ptr));
+}
+
+TEST_P(urUSMGrowableAllocExpTest, SuccessNoInitialSize) {
+    void *ptr = nullptr;
+    ASSERT_SUCCESS(
+        urUSMGrowableAllocExp(context, device, 64 * granularity, 0, &ptr));
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_SUCCESS(urUSMGrowableFreeExp(context, ptr));
+}
+
+TEST_P(urUSMGrowableAllocExpTest, SuccessResize) {
+    void *ptr = nullptr;
+    ASSERT_SUCCESS(urUSMGrowableAllocExp(context, device, 64 * granularity,
+                                         granularity, &ptr));
+    ASSERT_NE(ptr, nullptr);
+
+    EXPECT_SUCCESS(urUSMGrowableResizeExp(context, ptr, 8 * granularity));
+    EXPECT_SUCCESS(urUSMGrowableResizeExp(context, ptr, 64 * granularity));
+    EXPECT_SUCCESS(urUSMGrowableResizeExp(context, ptr, 2 * granularity));
+    EXPECT_SUCCESS(urUSMGrowableResizeExp(context, ptr, 0));
+    EXPECT_SUCCESS(urUSMGrowableFreeExp(context, ptr));
+}
+
+TEST_P(urUSMGrowableAllocExpTest, InvalidNullHandleContext) {
+    void *ptr = nullptr;
+    ASSERT_EQ_RESULT(
+        urUSMGrowableAllocExp(nullptr, device, granularity, 0, &ptr),
+        UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+}
+
+TEST_P(urUSMGrowableAllocExpTest, InvalidNullHandleDevice) {
+    void *ptr = nullptr;
+    ASSERT_EQ_RESULT(
+        urUSMGrowableAllocExp(context, nullptr, granularity, 0, &ptr),
+        UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+}
+
+TEST_P(urUSMGrowableAllocExpTest, InvalidNullPointer) {
+    ASSERT_EQ_RESULT(
+        urUSMGrowableAllocExp(context, device, granularity, 0, nullptr),
+        UR_RESULT_ERROR_INVALID_NULL_POINTER);
+}
+
+TEST_P(urUSMGrowableAllocExpTest, InvalidSize) {
+    void *ptr = nullptr;
+    ASSERT_EQ_RESULT(urUSMGrowableAllocExp(context, device, 0, 0, &ptr),
+                     UR_RESULT_ERROR_INVALID_SIZE);
+    ASSERT_EQ_RESULT(urUSMGrowableAllocExp(context, device, granularity,
+                                           2 * granularity, &ptr),
+                     UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST_P(urUSMGrowableAllocExpTest, InvalidSizeResize) {
+    void *ptr = nullptr;
+    ASSERT_SUCCESS(
+        urUSMGrowableAllocExp(context, device, granularity, 0, &ptr));
+    ASSERT_EQ_RESULT(urUSMGrowableResizeExp(context, ptr, 2 * granularity),
+                     UR_RESULT_ERROR_INVALID_SIZE);
+    EXPECT_SUCCESS(urUSMGrowableFreeExp(context, ptr));
+}
+
+TEST_P(urUSMGrowableAllocExpTest, InvalidValue) {
+    int value = 0;
+    ASSERT_EQ_RESULT(urUSMGrowableResizeExp(context, &value, granularity),
+                     UR_RESULT_ERROR_INVALID_VALUE);
+    ASSERT_EQ_RESULT(urUSMGrowableFreeExp(context, &value),
+                     UR_RESULT_ERROR_INVALID_VALUE);
+}
@@ -0,0 +1,150 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include "ur_api.h"
+#include "ur_util.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace fuzz {
+
+constexpr const char *api_call_names[] = {
+    "ur_platform_get",
+    "ur_device_get",
+    "ur_device_release",
+    "ur_context_create",
+    "ur_context_release",
+    "ur_usm_pool_create_host",
+    "ur_usm_pool_create_device",
+    "ur_usm_pool_release_host",
+    "ur_usm_pool_release_device",
+    "ur_usm_host_alloc_pool",
+    "ur_usm_host_alloc_no_pool",
+    "ur_usm_device_alloc_pool",
+    "ur_usm_device_alloc_no_pool",
+    "ur_usm_free_host_pool",
+    "ur_usm_free_host_no_pool",
+    "ur_usm_free_device_pool",
+    "ur_usm_free_device_no_pool",
+    "ur_program_create_with_il",
+};
+constexpr size_t num_api_calls = FuzzerAPICall::kMaxValue + 1;
+static_assert(std::size(api_call_names) == num_api_calls);
+
+// Times the API calls of the inputs, to catch the calls of the loader and the
+// layers whose cost grows with the handles they track. An input is reported
+// as a crash, which libFuzzer saves as an artifact, when:
+// - a call takes more than UR_FUZZ_CALL_BUDGET_US microseconds,
+// - the median cost of the last quarter of the calls of a kind is more than
+//   UR_FUZZ_MAX_GROWTH times the median cost of the first quarter, as with a
+//   handle table or a leak check walking all the handles on each call.
+// Both are disabled when unset. Once enabled, the costs of the calls also
+// feed the counters given to the oracle, libFuzzer extra counters, so that
+// the inputs reaching slower calls are kept in the corpus.
+class PerfOracle {
+  public:
+    // counters holds 2 * num_api_calls counters
+    PerfOracle(uint8_t *counters) : counters(counters) {
+        budget_ns =
+            getenv_to_unsigned("UR_FUZZ_CALL_BUDGET_US").value_or(0) * 1000;
+        if (const char *growth = std::getenv("UR_FUZZ_MAX_GROWTH")) {
+            max_growth = std::strtod(growth, nullptr);
+        }
+    }
+
+    bool enabled() const { return budget_ns || max_growth > 0; }
+
+    // Runs the API call of kind call, returning what fn() returns
+    template <typename F> int run(int call, F &&fn) {
+        if (!enabled()) {
+            return fn();
+        }
+        auto start = clock::now();
+        int ret = fn();
+        uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          clock::now() - start)
+                          .count();
+        costs[call].push_back(ns);
+        bump(counters[call], ns / 1000);
+        if (budget_ns && ns > budget_ns) {
+            report(call, "took " + std::to_string(ns / 1000) +
+                             " us, over the budget of " +
+                             std::to_string(budget_ns / 1000) + " us");
+        }
+        return ret;
+    }
+
+    // Checks the growth of the costs of the calls of the input, once it is
+    // done, and forgets them for the next input
+    void finish() {
+        for (size_t call = 0; call < num_api_calls; call++) {
+            auto &call_costs = costs[call];
+            if (call_costs.size() >= min_growth_calls) {
+                size_t quarter = call_costs.size() / 4;
+                uint64_t first = median(call_costs.begin(), quarter);
+                uint64_t last = median(call_costs.end() - quarter, quarter);
+                double growth = double(last) / std::max<uint64_t>(first, 1);
+                bump(counters[num_api_calls + call], uint64_t(growth));
+                if (max_growth > 0 && growth > max_growth &&
+                    last >= min_growth_ns) {
+                    report(call, "cost grew from " + std::to_string(first) +
+                                     " ns to " + std::to_string(last) +
+                                     " ns over " +
+                                     std::to_string(call_costs.size()) +
+                                     " calls");
+                }
+            }
+            call_costs.clear();
+        }
+    }
+
+  private:
+    using clock = std::chrono::steady_clock;
+
+    // Fewer calls of a kind are too noisy to tell their growth
+    static constexpr size_t min_growth_calls = 32;
+    // Cheaper calls are dominated by the timer and the fuzzer itself
+    static constexpr uint64_t min_growth_ns = 1000;
+
+    template <typename It> static uint64_t median(It begin, size_t count) {
+        std::vector<uint64_t> values(begin, begin + count);
+        std::nth_element(values.begin(), values.begin() + count / 2,
+                         values.end());
+        return values[count / 2];
+    }
+
+    // Raises counter to the bit width of value, the buckets of libFuzzer
+    // telling apart the orders of magnitude of the costs
+    static void bump(uint8_t &counter, uint64_t value) {
+        uint8_t width = 0;
+        for (; value; value >>= 1) {
+            width++;
+        }
+        counter = std::max(counter, width);
+    }
+
+    [[noreturn]] static void report(int call, const std::string &what) {
+        std::fprintf(stderr, "==ur-fuzz-perf== %s: %s\n",
+                     api_call_names[call], what.c_str());
+        std::abort();
+    }
+
+    uint8_t *counters;
+    uint64_t budget_ns = 0;
+    double max_growth = 0;
+    // The costs of the calls of the input by kind, in nanoseconds
+    std::array<std::vector<uint64_t>, num_api_calls> costs;
+};
+
+} // namespace fuzz
@@ -10,6 +10,7 @@ in the corpus directory for reaching better coverage of tests.
 */
 
 #include "kernel_entry_points.h"
+#include "perf_oracle.hpp"
 #include "ur_api.h"
 #include "utils.hpp"
 #include <cassert>
@@ -422,6 +423,15 @@ static struct UrLoader {
     LoaderConfig config;
 } UrLoader;
 
+// The counters of the performance oracle, which libFuzzer clears before each
+// input and keeps the inputs raising them as it does for coverage
+#ifdef __linux__
+__attribute__((used, section("__libfuzzer_extra_counters")))
+#endif
+static uint8_t perf_counters[2 * num_api_calls];
+
+static PerfOracle perf_oracle(perf_counters);
+
 extern "C" int LLVMFuzzerTestOneInput(uint8_t *data, size_t size) {
     int next_api_call;
     auto data_provider = std::make_unique<FuzzedDataProvider>(data, size);
@@ -462,8 +472,16 @@ extern "C" int LLVMFuzzerTestOneInput(uint8_t *data, size_t size) {
         return -1;
     }
 
+    // Checks the growth of the costs of the calls however the input ends,
+    // before its handles are released
+    struct PerfInput {
+        ~PerfInput() { perf_oracle.finish(); }
+    } perf_input;
+
     while ((next_api_call = test_state.get_next_api_call()) != -1) {
-        ret = api_wrappers[next_api_call](test_state);
+        ret = perf_oracle.run(next_api_call, [&] {
+            return api_wrappers[next_api_call](test_state);
+        });
         if (ret) {
             return -1;
         }
@@ -3,6 +3,8 @@
 // See LICENSE.TXT
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#pragma once
+
 #include <fstream>
 #include <fuzzer/FuzzedDataProvider.h>
 #include <iostream>
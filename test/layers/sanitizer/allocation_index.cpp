@@ -0,0 +1,88 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file allocation_index.cpp
+ *
+ */
+
+#include "asan_allocation_index.hpp"
+
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+
+using namespace ur_sanitizer_layer;
+
+TEST(AllocationIndex, FindContainingAllocation) {
+    AllocationIndex<int> Index;
+    Index.insert(0x1000, 0x1040, 1);
+    // Crosses a page boundary
+    Index.insert(0x1fc0, 0x2040, 2);
+    // Spans many pages
+    Index.insert(0x100000, 0x900000, 3);
+
+    EXPECT_EQ(Index.find(0xfff), nullptr);
+    EXPECT_EQ(*Index.find(0x1000), 1);
+    EXPECT_EQ(*Index.find(0x103f), 1);
+    EXPECT_EQ(Index.find(0x1040), nullptr);
+    EXPECT_EQ(*Index.find(0x1fc0), 2);
+    EXPECT_EQ(*Index.find(0x2000), 2);
+    EXPECT_EQ(Index.find(0x2040), nullptr);
+    EXPECT_EQ(*Index.find(0x100000), 3);
+    EXPECT_EQ(*Index.find(0x8fffff), 3);
+    EXPECT_EQ(Index.find(0x900000), nullptr);
+    EXPECT_EQ(Index.size(), 3);
+
+    EXPECT_TRUE(Index.erase(0x1fc0, 0x2040));
+    EXPECT_FALSE(Index.erase(0x1fc0, 0x2040));
+    EXPECT_EQ(Index.find(0x2000), nullptr);
+    EXPECT_EQ(*Index.find(0x1000), 1);
+    EXPECT_EQ(Index.size(), 2);
+
+    Index.clear();
+    EXPECT_EQ(Index.find(0x1000), nullptr);
+    EXPECT_EQ(Index.size(), 0);
+}
+
+// Random lookups, in and between the allocations, give the same results as
+// the std::map based search the sanitizer used before
+TEST(AllocationIndex, MatchesMapSearch) {
+    constexpr size_t NumAllocations = 10000;
+    constexpr size_t NumLookups = 100000;
+
+    std::mt19937_64 Rng(42);
+    AllocationIndex<size_t> Index;
+    // Begin to end and index of the allocations
+    std::map<uintptr_t, std::pair<uintptr_t, size_t>> Map;
+    uintptr_t First = 0xff0000000000ULL;
+    uintptr_t Next = First;
+    for (size_t I = 0; I < NumAllocations; ++I) {
+        // Mostly small allocations, with the occasional large one
+        size_t Size = (Rng() % 16 == 0) ? (1 << 20) + Rng() % (1 << 20)
+                                        : 64 + Rng() % 4096;
+        Size = (Size + 63) & ~size_t(63);
+        Index.insert(Next, Next + Size, I);
+        Map.emplace(Next, std::make_pair(Next + Size, I));
+        Next += Size + 64 * (Rng() % 4);
+    }
+
+    for (size_t I = 0; I < NumLookups; ++I) {
+        uintptr_t Address = First + Rng() % (Next - First);
+        auto It = Map.upper_bound(Address);
+        const size_t *Expected = nullptr;
+        if (It != Map.begin() && Address < std::prev(It)->second.first) {
+            Expected = &std::prev(It)->second.second;
+        }
+
+        auto *Value = Index.find(Address);
+        ASSERT_EQ(Value == nullptr, Expected == nullptr) << std::hex << Address;
+        if (Value) {
+            ASSERT_EQ(*Value, *Expected) << std::hex << Address;
+        }
+    }
+}
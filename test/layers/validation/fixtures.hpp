@@ -16,8 +16,7 @@ struct urTest : ::testing::Test {
 
     void SetUp() override {
         ASSERT_EQ(urLoaderConfigCreate(&loader_config), UR_RESULT_SUCCESS);
-        ASSERT_EQ(urLoaderConfigEnableLayer(loader_config,
-                                            "UR_LAYER_FULL_VALIDATION"),
+        ASSERT_EQ(urLoaderConfigEnableLayer(loader_config, layer_name),
                   UR_RESULT_SUCCESS);
         ur_device_init_flags_t device_flags = 0;
         ASSERT_EQ(urLoaderInit(device_flags, loader_config), UR_RESULT_SUCCESS);
@@ -31,6 +30,7 @@ struct urTest : ::testing::Test {
     }
 
     ur_loader_config_handle_t loader_config = nullptr;
+    const char *layer_name = "UR_LAYER_FULL_VALIDATION";
 };
 
 struct valAdaptersTest : urTest {
@@ -0,0 +1,30 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fixtures.hpp"
+
+// Only the cheapest validation level is enabled, which rejects null handles
+// and pointers but leaves all other checks to the adapter.
+struct valHandlesTest : valPlatformTest {
+    valHandlesTest() { layer_name = "UR_LAYER_HANDLE_VALIDATION"; }
+};
+
+TEST_F(valHandlesTest, testNullHandleRejected) {
+    ur_api_version_t api_version = {};
+    ASSERT_EQ(urPlatformGetApiVersion(nullptr, &api_version),
+              UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+}
+
+TEST_F(valHandlesTest, testNullPointerRejected) {
+    ASSERT_EQ(urPlatformGetApiVersion(platform, nullptr),
+              UR_RESULT_ERROR_INVALID_NULL_POINTER);
+}
+
+TEST_F(valHandlesTest, testEnumerationNotValidated) {
+    uint32_t value = 0;
+    ASSERT_NE(urPlatformGetInfo(platform, UR_PLATFORM_INFO_FORCE_UINT32,
+                                sizeof(value), &value, nullptr),
+              UR_RESULT_ERROR_INVALID_ENUMERATION);
+}
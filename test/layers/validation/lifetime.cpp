@@ -25,3 +25,14 @@ TEST_F(valAdapterTest, testUrAdapterHandleTypeMismatchExpectFail) {
     ur_device_info_t info_type = UR_DEVICE_INFO_BACKEND_RUNTIME_VERSION;
     urDeviceGetInfo(device, info_type, 0, nullptr, &size);
 }
+
+TEST_F(valDeviceTest, testUrContextUseAfterReleaseExpectFail) {
+    ur_context_handle_t context = nullptr;
+    ASSERT_EQ(urContextCreate(1, &device, nullptr, &context),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urContextRelease(context), UR_RESULT_SUCCESS);
+
+    uint32_t refCount = 0;
+    urContextGetInfo(context, UR_CONTEXT_INFO_REFERENCE_COUNT,
+                     sizeof(refCount), &refCount, nullptr);
+}
@@ -137,4 +137,27 @@ TEST_F(adapterPreFilterTest, testPrefilterWithNotAllFilter) {
     EXPECT_FALSE(cudaExists);
 }
 
+TEST_F(adapterPreFilterTest, testPrefilterAcceptFilterNativeCpu) {
+    SetUp("native_cpu:*");
+    auto nativeCpuExists =
+        std::any_of(registry->cbegin(), registry->cend(), hasNativeCpuLibName);
+    EXPECT_TRUE(nativeCpuExists);
+    auto levelZeroExists =
+        std::any_of(registry->cbegin(), registry->cend(), haslevelzeroLibName);
+    EXPECT_FALSE(levelZeroExists);
+    auto cudaExists =
+        std::any_of(registry->cbegin(), registry->cend(), hasCudaLibName);
+    EXPECT_FALSE(cudaExists);
+}
+
+TEST_F(adapterPreFilterTest, testPrefilterDiscardFilterNativeCpu) {
+    SetUp("!native_cpu:*");
+    auto nativeCpuExists =
+        std::any_of(registry->cbegin(), registry->cend(), hasNativeCpuLibName);
+    EXPECT_FALSE(nativeCpuExists);
+    auto levelZeroExists =
+        std::any_of(registry->cbegin(), registry->cend(), haslevelzeroLibName);
+    EXPECT_TRUE(levelZeroExists);
+}
+
 #endif
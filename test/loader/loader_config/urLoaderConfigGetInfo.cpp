@@ -108,6 +108,7 @@ bool isLayerStringValid(std::string &layersString,
 
 TEST_F(urLoaderConfigGetInfoTest, ValidLayersList) {
     std::vector<std::string> layerNames{
+        "UR_LAYER_HANDLE_VALIDATION",
         "UR_LAYER_PARAMETER_VALIDATION",
         "UR_LAYER_BOUNDS_CHECKING",
         "UR_LAYER_LEAK_CHECKING",
@@ -0,0 +1,183 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file simulator.cpp
+ *
+ * Run with UR_MOCK_LATENCY=urQueueFlush:20000000 and
+ * UR_MOCK_DEVICE=concurrency:2;urEnqueueKernelLaunch:50000000, see
+ * CMakeLists.txt.
+ *
+ */
+
+#include "uur/raii.h"
+#include <gtest/gtest.h>
+#include <ur_api.h>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+using clock_type = std::chrono::steady_clock;
+
+constexpr auto flushLatency = 20ms;
+constexpr auto kernelDuration = 50ms;
+constexpr uint64_t kernelNs =
+    std::chrono::nanoseconds(kernelDuration).count();
+
+struct MockSimulator : ::testing::Test {
+    void SetUp() override {
+        ASSERT_EQ(urLoaderConfigCreate(loader_config.ptr()),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urLoaderConfigSetMockingEnabled(loader_config, true),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urLoaderInit(0, loader_config), UR_RESULT_SUCCESS);
+
+        ASSERT_EQ(urAdapterGet(1, adapter.ptr(), nullptr), UR_RESULT_SUCCESS);
+        ur_platform_handle_t platform = nullptr;
+        ASSERT_EQ(urPlatformGet(adapter.ptr(), 1, 1, &platform, nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, device.ptr(),
+                              nullptr),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urContextCreate(1, device.ptr(), nullptr, context.ptr()),
+                  UR_RESULT_SUCCESS);
+
+        // The mock adapter takes any program
+        const uint8_t il[] = {0x03, 0x02, 0x23, 0x07};
+        ASSERT_EQ(urProgramCreateWithIL(context, il, sizeof(il), nullptr,
+                                        program.ptr()),
+                  UR_RESULT_SUCCESS);
+        ASSERT_EQ(urKernelCreate(program, "kernel", kernel.ptr()),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void createQueue(ur_queue_flags_t flags, uur::raii::Queue &queue) {
+        ur_queue_properties_t properties{UR_STRUCTURE_TYPE_QUEUE_PROPERTIES,
+                                         nullptr, flags};
+        ASSERT_EQ(urQueueCreate(context, device, &properties, queue.ptr()),
+                  UR_RESULT_SUCCESS);
+    }
+
+    void launch(ur_queue_handle_t queue, uur::raii::Event &event) {
+        const size_t offset = 0;
+        const size_t size = 1;
+        ASSERT_EQ(urEnqueueKernelLaunch(queue, kernel, 1, &offset, &size,
+                                        nullptr, 0, nullptr, event.ptr()),
+                  UR_RESULT_SUCCESS);
+    }
+
+    ur_event_status_t status(ur_event_handle_t event) {
+        ur_event_status_t value = UR_EVENT_STATUS_FORCE_UINT32;
+        EXPECT_EQ(urEventGetInfo(event, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                 sizeof(value), &value, nullptr),
+                  UR_RESULT_SUCCESS);
+        return value;
+    }
+
+    uint64_t profilingInfo(ur_event_handle_t event, ur_profiling_info_t info) {
+        uint64_t value = 0;
+        EXPECT_EQ(urEventGetProfilingInfo(event, info, sizeof(value), &value,
+                                          nullptr),
+                  UR_RESULT_SUCCESS);
+        return value;
+    }
+
+    uur::raii::LoaderConfig loader_config;
+    uur::raii::Adapter adapter;
+    uur::raii::Device device;
+    uur::raii::Context context;
+    uur::raii::Program program;
+    uur::raii::Kernel kernel;
+};
+
+TEST_F(MockSimulator, Latency) {
+    uur::raii::Queue queue;
+    createQueue(0, queue);
+
+    auto start = clock_type::now();
+    ASSERT_EQ(urQueueFlush(queue), UR_RESULT_SUCCESS);
+    ASSERT_GE(clock_type::now() - start, flushLatency);
+}
+
+TEST_F(MockSimulator, EventCompletesAfterDuration) {
+    uur::raii::Queue queue;
+    createQueue(0, queue);
+
+    auto start = clock_type::now();
+    uur::raii::Event event;
+    launch(queue, event);
+    ASSERT_NE(status(event), UR_EVENT_STATUS_COMPLETE);
+    ASSERT_EQ(urEventGetProfilingInfo(event, UR_PROFILING_INFO_COMMAND_END,
+                                      sizeof(uint64_t), nullptr, nullptr),
+              UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE);
+
+    ASSERT_EQ(urEventWait(1, event.ptr()), UR_RESULT_SUCCESS);
+    ASSERT_GE(clock_type::now() - start, kernelDuration);
+    ASSERT_EQ(status(event), UR_EVENT_STATUS_COMPLETE);
+    ASSERT_EQ(profilingInfo(event, UR_PROFILING_INFO_COMMAND_END) -
+                  profilingInfo(event, UR_PROFILING_INFO_COMMAND_START),
+              kernelNs);
+}
+
+TEST_F(MockSimulator, InOrderQueueSerializes) {
+    uur::raii::Queue queue;
+    createQueue(0, queue);
+
+    auto start = clock_type::now();
+    uur::raii::Event first;
+    uur::raii::Event second;
+    launch(queue, first);
+    launch(queue, second);
+    ASSERT_EQ(profilingInfo(second, UR_PROFILING_INFO_COMMAND_START),
+              profilingInfo(first, UR_PROFILING_INFO_COMMAND_START) + kernelNs);
+
+    ASSERT_EQ(urQueueFinish(queue), UR_RESULT_SUCCESS);
+    ASSERT_GE(clock_type::now() - start, 2 * kernelDuration);
+    ASSERT_EQ(status(second), UR_EVENT_STATUS_COMPLETE);
+}
+
+TEST_F(MockSimulator, OutOfOrderQueueUsesConcurrency) {
+    uur::raii::Queue queue;
+    createQueue(UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE, queue);
+
+    // The device executes two commands at once, the third waits for one of
+    // them
+    uur::raii::Event first;
+    uur::raii::Event second;
+    uur::raii::Event third;
+    launch(queue, first);
+    launch(queue, second);
+    launch(queue, third);
+    auto firstEnd =
+        profilingInfo(first, UR_PROFILING_INFO_COMMAND_START) + kernelNs;
+    ASSERT_LT(profilingInfo(second, UR_PROFILING_INFO_COMMAND_START),
+              firstEnd);
+    ASSERT_GE(profilingInfo(third, UR_PROFILING_INFO_COMMAND_START),
+              firstEnd);
+
+    ASSERT_EQ(urQueueFinish(queue), UR_RESULT_SUCCESS);
+    ASSERT_EQ(status(third), UR_EVENT_STATUS_COMPLETE);
+}
+
+TEST_F(MockSimulator, WaitListOrdersQueues) {
+    uur::raii::Queue producer;
+    uur::raii::Queue consumer;
+    createQueue(0, producer);
+    createQueue(0, consumer);
+
+    uur::raii::Event produced;
+    launch(producer, produced);
+    uur::raii::Event barrier;
+    ASSERT_EQ(urEnqueueEventsWaitWithBarrier(consumer, 1, produced.ptr(),
+                                             barrier.ptr()),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(profilingInfo(barrier, UR_PROFILING_INFO_COMMAND_START),
+              profilingInfo(produced, UR_PROFILING_INFO_COMMAND_START) +
+                  kernelNs);
+    ASSERT_EQ(urEventWait(1, barrier.ptr()), UR_RESULT_SUCCESS);
+    ASSERT_EQ(status(produced), UR_EVENT_STATUS_COMPLETE);
+}
@@ -87,6 +87,17 @@ class UniquePtrLoggerWithFilesinkFail : public LoggerWithFileSinkFail {
     }
 };
 
+class LoggerWithFlightRecorder : public LoggerCommonSetup {
+  protected:
+    const filesystem::path file_path = "ur_test_flight.bin";
+    std::unique_ptr<logger::Logger> logger;
+
+    void TearDown() override {
+        logger.reset();
+        ASSERT_TRUE(filesystem::remove(file_path));
+    }
+};
+
 class DefaultLoggerWithFileSink : public UniquePtrLoggerWithFilesink {
   protected:
     void SetUp() override {
@@ -8,6 +8,7 @@
 #include <thread>
 
 #include "fixtures.hpp"
+#include "logger/ur_flight_recorder.hpp"
 #include "logger/ur_logger_details.hpp"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -30,6 +31,11 @@ TEST_F(DefaultLoggerWithFileSink, ThreeParams) {
     test_msg << test_msg_prefix << "[ERROR]: Test 42: 3.8\n";
 }
 
+TEST_F(DefaultLoggerWithFileSink, CheckedFormatMacro) {
+    UR_LOG_L(*logger, ERR, "{{}} {}: {}", "Test", 42);
+    test_msg << test_msg_prefix << "[ERROR]: {} Test: 42\n";
+}
+
 TEST_F(DefaultLoggerWithFileSink, DoubleBraces) {
     logger->error("{{}} {}: {}", "Test", 42);
     test_msg << test_msg_prefix << "[ERROR]: {} Test: 42\n";
@@ -113,6 +119,173 @@ TEST_F(UniquePtrLoggerWithFilesink, NestedFilePath) {
     test_msg << test_msg_prefix << "[WARNING]: Test message: success\n";
 }
 
+TEST_F(UniquePtrLoggerWithFilesink, AsyncSinkBlock) {
+    logger = std::make_unique<logger::Logger>(
+        logger::Level::WARN,
+        std::make_unique<logger::AsyncSink>(
+            logger_name,
+            std::make_unique<logger::FileSink>(logger_name, file_path),
+            logger::AsyncPolicy::BLOCK, 4));
+
+    for (int i = 0; i < 100; ++i) {
+        logger->warning("Test message: {}", i);
+        test_msg << test_msg_prefix << "[WARNING]: Test message: " << i
+                 << "\n";
+    }
+}
+
+TEST_F(UniquePtrLoggerWithFilesink, AsyncSinkWritesFlushLevelImmediately) {
+    logger = std::make_unique<logger::Logger>(
+        logger::Level::WARN,
+        std::make_unique<logger::AsyncSink>(
+            logger_name,
+            std::make_unique<logger::FileSink>(logger_name, file_path),
+            logger::AsyncPolicy::DROP, 1));
+
+    logger->error("Test message: {}", "success");
+    test_msg << test_msg_prefix << "[ERROR]: Test message: success\n";
+
+    auto test_log = std::ifstream(file_path);
+    std::stringstream printed_msg;
+    printed_msg << test_log.rdbuf();
+    ASSERT_EQ(printed_msg.str(), test_msg.str());
+}
+
+TEST_F(UniquePtrLoggerWithFilesink, AsyncSinkDeferredFormat) {
+    logger = std::make_unique<logger::Logger>(
+        logger::Level::WARN,
+        std::make_unique<logger::AsyncSink>(
+            logger_name,
+            std::make_unique<logger::FileSink>(logger_name, file_path),
+            logger::AsyncPolicy::BLOCK));
+
+    // The arguments are formatted after the caller's buffer was overwritten
+    char buffer[] = "success";
+    const char *null_str = nullptr;
+    logger->warning("Test message: {} {} {}", buffer, 42, null_str);
+    buffer[0] = 'X';
+    logger->warning("Test message: {}", std::string(buffer));
+    test_msg << test_msg_prefix << "[WARNING]: Test message: success 42 "
+             << "(null)\n"
+             << test_msg_prefix << "[WARNING]: Test message: Xuccess\n";
+}
+
+TEST_F(LoggerWithFlightRecorder, KeepsLastRecords) {
+    logger = std::make_unique<logger::Logger>(
+        logger::Level::INFO,
+        std::make_unique<logger::FlightRecorderSink>(logger_name, file_path,
+                                                     4));
+    for (int i = 0; i < 10; ++i) {
+        logger->info("Test message: {}", i);
+    }
+    logger->debug("This should not be recorded");
+
+    // The ring can be decoded while the sink is still alive, like after a
+    // crash of the process
+    auto records = logger::flight::read_file(file_path);
+    ASSERT_EQ(records.size(), 4);
+    for (int i = 0; i < 4; ++i) {
+        std::stringstream expected;
+        expected << test_msg_prefix << "[INFO]: Test message: " << i + 6
+                 << "\n";
+        ASSERT_EQ(records[i].sequence, i + 7);
+        ASSERT_EQ(records[i].level, static_cast<uint8_t>(logger::Level::INFO));
+        ASSERT_FALSE(records[i].truncated);
+        ASSERT_EQ(records[i].text, expected.str());
+    }
+}
+
+TEST_F(LoggerWithFlightRecorder, TruncatesLongMessages) {
+    logger = std::make_unique<logger::Logger>(
+        logger::Level::INFO,
+        std::make_unique<logger::FlightRecorderSink>(logger_name, file_path));
+    logger->error("{}", std::string(1000, 'x'));
+    logger.reset();
+
+    auto records = logger::flight::read_file(file_path);
+    ASSERT_EQ(records.size(), 1);
+    ASSERT_TRUE(records[0].truncated);
+    ASSERT_EQ(records[0].text.size(), logger::flight::text_size);
+}
+
+TEST_F(LoggerWithFlightRecorder, Multithreaded) {
+    constexpr int thread_count = 8;
+    constexpr int message_count = 1000;
+    logger = std::make_unique<logger::Logger>(
+        logger::Level::INFO,
+        std::make_unique<logger::FlightRecorderSink>(
+            logger_name, file_path, thread_count * message_count));
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < message_count; ++j) {
+                logger->info("Test message: {}", j);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    logger.reset();
+
+    auto records = logger::flight::read_file(file_path);
+    ASSERT_EQ(records.size(), thread_count * message_count);
+    for (size_t i = 0; i < records.size(); ++i) {
+        ASSERT_EQ(records[i].sequence, i + 1);
+    }
+}
+
+TEST_F(DefaultLoggerWithFileSink, RateLimitSuppressesRepeatedMessages) {
+    logger->setRateLimit(2, std::chrono::hours(1));
+    for (int i = 0; i < 5; ++i) {
+        logger->error("Repeated message: {}", i);
+    }
+    logger->error("Another message");
+    logger.reset();
+
+    test_msg << test_msg_prefix << "[ERROR]: Repeated message: 0\n"
+             << test_msg_prefix << "[ERROR]: Repeated message: 1\n"
+             << test_msg_prefix << "[ERROR]: Another message\n"
+             << test_msg_prefix
+             << "[WARNING]: 3 messages like \"Repeated message: {}\" were "
+                "suppressed\n";
+}
+
+TEST_F(DefaultLoggerWithFileSink, RateLimitReportsInNextInterval) {
+    logger->setRateLimit(1, std::chrono::milliseconds(50));
+    for (int i = 0; i < 4; ++i) {
+        if (i == 3) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(60));
+        }
+        logger->warning("Repeated message: {}", i);
+    }
+
+    test_msg << test_msg_prefix << "[WARNING]: Repeated message: 0\n"
+             << test_msg_prefix
+             << "[WARNING]: 2 messages like \"Repeated message: {}\" were "
+                "suppressed\n"
+             << test_msg_prefix << "[WARNING]: Repeated message: 3\n";
+}
+
+TEST(RateLimiter, InvalidValues) {
+    ASSERT_THROW(logger::rate_limiter_from_values({}), std::invalid_argument);
+    ASSERT_THROW(logger::rate_limiter_from_values({"many"}),
+                 std::invalid_argument);
+    ASSERT_THROW(logger::rate_limiter_from_values({"10", "0"}),
+                 std::invalid_argument);
+    ASSERT_NE(logger::rate_limiter_from_values({"10", "500"}), nullptr);
+}
+
+TEST(FormatString, CountPlaceholders) {
+    static_assert(logger::details::count_placeholders("") == 0);
+    static_assert(logger::details::count_placeholders("{} {}") == 2);
+    static_assert(logger::details::count_placeholders("{{}} {}: {}") == 2);
+    static_assert(logger::details::count_placeholders("{{ {}:}} {}}}") == 2);
+    static_assert(logger::details::count_placeholders("{ {}") == -1);
+    static_assert(logger::details::count_placeholders("}") == -1);
+}
+
 TEST_F(UniquePtrLoggerWithFilesinkFail, NullSink) {
     logger = std::make_unique<logger::Logger>(logger::Level::INFO, nullptr);
     logger->info("This should not be printed: {}", 42);
@@ -168,6 +341,33 @@ TEST_P(FileSinkLoggerMultipleThreads, Multithreaded) {
     }
 }
 
+TEST_P(FileSinkLoggerMultipleThreads, AsyncMultithreaded) {
+    std::vector<std::thread> threads;
+    auto local_logger = logger::Logger(
+        logger::Level::WARN,
+        std::make_unique<logger::AsyncSink>(
+            logger_name,
+            std::make_unique<logger::FileSink>(logger_name, file_path, true),
+            logger::AsyncPolicy::BLOCK, 16, true));
+    constexpr int message_count = 50;
+
+    for (int i = 0; i < thread_count; i++) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < message_count; ++j) {
+                local_logger.warn("Test message: {}", "it's a success");
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < thread_count * message_count; ++i) {
+        test_msg << "Test message: it's a success\n";
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 INSTANTIATE_TEST_SUITE_P(
     ThreadCount, CommonLoggerWithMultipleThreads,
@@ -0,0 +1,168 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "ur_binary_cache.hpp"
+
+static constexpr std::array<char, 8> testMagic = {'U', 'R', 'T', 'E',
+                                                  'S', 'T', '0', '1'};
+
+class BinaryCacheTest : public ::testing::Test {
+  protected:
+    filesystem::path dir;
+
+    void SetUp() override {
+        dir = filesystem::temp_directory_path() /
+              ("ur_binary_cache_test_" + std::to_string(std::rand()));
+        ASSERT_EQ(setenv("UR_TEST_BINARY_CACHE_DIR", dir.string().c_str(), 1),
+                  0);
+    }
+
+    void TearDown() override {
+        unsetenv("UR_TEST_BINARY_CACHE_DIR");
+        unsetenv("UR_PROGRAM_CACHE_DIR");
+        unsetenv("UR_PROGRAM_CACHE_MAX_SIZE_MB");
+        std::error_code error;
+        filesystem::remove_all(dir, error);
+    }
+};
+
+TEST_F(BinaryCacheTest, DisabledWithoutDirectory) {
+    unsetenv("UR_TEST_BINARY_CACHE_DIR");
+    ur::binary_cache_t cache("test", "UR_TEST_BINARY_CACHE_DIR", testMagic);
+    ASSERT_FALSE(cache.enabled());
+
+    const char data[] = "binary";
+    cache.store("key", data, sizeof(data));
+    ur::cached_binary_t binary;
+    ASSERT_FALSE(cache.load("key", binary));
+}
+
+TEST_F(BinaryCacheTest, StoreAndLoad) {
+    ur::binary_cache_t cache("test", "UR_TEST_BINARY_CACHE_DIR", testMagic);
+    ASSERT_TRUE(cache.enabled());
+
+    ur::cached_binary_t binary;
+    ASSERT_FALSE(cache.load("key", binary));
+
+    const char data[] = "binary";
+    cache.store("key", data, sizeof(data));
+    ASSERT_TRUE(cache.load("key", binary));
+    ASSERT_EQ(binary.size(), sizeof(data));
+    ASSERT_EQ(std::memcmp(binary.data(), data, sizeof(data)), 0);
+
+    // Only the entry is left in the directory
+    size_t numFiles = 0;
+    for ([[maybe_unused]] auto &entry : filesystem::directory_iterator(dir)) {
+        numFiles++;
+    }
+    ASSERT_EQ(numFiles, 1);
+}
+
+TEST_F(BinaryCacheTest, LoadedBinaryOutlivesEntry) {
+    ur::binary_cache_t cache("test", "UR_TEST_BINARY_CACHE_DIR", testMagic);
+    const char data[] = "binary";
+    cache.store("key", data, sizeof(data));
+
+    ur::cached_binary_t binary;
+    ASSERT_TRUE(cache.load("key", binary));
+    ASSERT_TRUE(filesystem::remove(dir / "key"));
+    ASSERT_EQ(binary.size(), sizeof(data));
+    ASSERT_EQ(std::memcmp(binary.data(), data, sizeof(data)), 0);
+}
+
+TEST_F(BinaryCacheTest, IgnoresEntriesOfOtherFormats) {
+    const char data[] = "binary";
+    ur::binary_cache_t other("test", "UR_TEST_BINARY_CACHE_DIR",
+                             {'U', 'R', 'T', 'E', 'S', 'T', '0', '2'});
+    other.store("key", data, sizeof(data));
+
+    ur::binary_cache_t cache("test", "UR_TEST_BINARY_CACHE_DIR", testMagic);
+    ur::cached_binary_t binary;
+    ASSERT_FALSE(cache.load("key", binary));
+}
+
+TEST_F(BinaryCacheTest, IgnoresTruncatedEntries) {
+    ur::binary_cache_t cache("test", "UR_TEST_BINARY_CACHE_DIR", testMagic);
+    const char data[] = "binary";
+    cache.store("key", data, sizeof(data));
+    filesystem::resize_file(dir / "key",
+                            filesystem::file_size(dir / "key") - 1);
+
+    ur::cached_binary_t binary;
+    ASSERT_FALSE(cache.load("key", binary));
+}
+
+TEST_F(BinaryCacheTest, RemovesCorruptedEntries) {
+    ur::binary_cache_t cache("test", "UR_TEST_BINARY_CACHE_DIR", testMagic);
+    const char data[] = "binary";
+    cache.store("key", data, sizeof(data));
+    {
+        std::fstream file(dir / "key",
+                          std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-1, std::ios::end);
+        file.put('x');
+    }
+
+    ur::cached_binary_t binary;
+    ASSERT_FALSE(cache.load("key", binary));
+    ASSERT_FALSE(filesystem::exists(dir / "key"));
+    ASSERT_EQ(cache.stats().Misses, 1);
+}
+
+TEST_F(BinaryCacheTest, SharedDirectory) {
+    unsetenv("UR_TEST_BINARY_CACHE_DIR");
+    ASSERT_EQ(setenv("UR_PROGRAM_CACHE_DIR", dir.string().c_str(), 1), 0);
+    ur::binary_cache_t cache("test", "UR_TEST_BINARY_CACHE_DIR", testMagic);
+    ASSERT_TRUE(cache.enabled());
+
+    const char data[] = "binary";
+    cache.store("key", data, sizeof(data));
+    ASSERT_TRUE(filesystem::exists(dir / "test" / "key"));
+    ur::cached_binary_t binary;
+    ASSERT_TRUE(cache.load("key", binary));
+
+    auto stats = cache.stats();
+    ASSERT_EQ(stats.Hits, 1);
+    ASSERT_EQ(stats.Stores, 1);
+}
+
+TEST_F(BinaryCacheTest, EvictsLeastRecentlyUsedEntries) {
+    ASSERT_EQ(setenv("UR_PROGRAM_CACHE_MAX_SIZE_MB", "1", 1), 0);
+    ur::binary_cache_t cache("test", "UR_TEST_BINARY_CACHE_DIR", testMagic);
+    std::vector<uint8_t> data(400 * 1024);
+
+    cache.store("a", data.data(), data.size());
+    cache.store("b", data.data(), data.size());
+    auto now = filesystem::file_time_type::clock::now();
+    filesystem::last_write_time(dir / "a", now - std::chrono::hours(2));
+    filesystem::last_write_time(dir / "b", now - std::chrono::hours(1));
+
+    // Loading a makes b the least recently used entry
+    ur::cached_binary_t binary;
+    ASSERT_TRUE(cache.load("a", binary));
+    cache.store("c", data.data(), data.size());
+
+    ASSERT_TRUE(filesystem::exists(dir / "a"));
+    ASSERT_FALSE(filesystem::exists(dir / "b"));
+    ASSERT_TRUE(filesystem::exists(dir / "c"));
+    ASSERT_EQ(cache.stats().Evictions, 1);
+}
+
+TEST(BinaryHashTest, FieldsAreSeparated) {
+    ur::binary_hash_t a, b;
+    a.addField(std::string("ab"));
+    a.addField(std::string("c"));
+    b.addField(std::string("a"));
+    b.addField(std::string("bc"));
+    ASSERT_NE(a.str(), b.str());
+    ASSERT_EQ(a.str().size(), 32);
+}
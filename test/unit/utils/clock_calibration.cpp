@@ -0,0 +1,115 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "ur_clock_calibration.hpp"
+
+using namespace std::chrono_literals;
+
+namespace {
+uint64_t steadyNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// A device clock running twice as fast as the host one, with an offset
+struct fake_clocks_t {
+    ur_result_t operator()(ur::clock_calibration_t::sample_t &sample) {
+        calls++;
+        sample.host = steadyNow();
+        sample.device = 2 * sample.host + offset;
+        return UR_RESULT_SUCCESS;
+    }
+    uint64_t offset = 1000000;
+    int calls = 0;
+};
+} // namespace
+
+TEST(clockCalibration, disabledByDefault) {
+    ur::clock_calibration_t calibration;
+    EXPECT_FALSE(calibration.enabled());
+    EXPECT_TRUE(ur::clock_calibration_t(1ms).enabled());
+}
+
+TEST(clockCalibration, samplesOncePerPeriod) {
+    ur::clock_calibration_t calibration(1h);
+    fake_clocks_t clocks;
+    uint64_t device = 0, host = 0;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(calibration.getTimestamps(&device, &host, clocks),
+                  UR_RESULT_SUCCESS);
+    }
+    EXPECT_EQ(clocks.calls, 1);
+    EXPECT_EQ(calibration.sampleCount(), 1);
+}
+
+TEST(clockCalibration, fitsDrift) {
+    ur::clock_calibration_t calibration(5ms);
+    fake_clocks_t clocks;
+    uint64_t device = 0, host = 0;
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQ(calibration.getTimestamps(&device, &host, clocks),
+                  UR_RESULT_SUCCESS);
+        std::this_thread::sleep_for(6ms);
+    }
+    EXPECT_EQ(clocks.calls, 4);
+
+    ASSERT_EQ(calibration.getTimestamps(&device, &host, clocks),
+              UR_RESULT_SUCCESS);
+    uint64_t expected = 2 * host + clocks.offset;
+    uint64_t error = device > expected ? device - expected : expected - device;
+    // within a few percent of the 20ms between the samples
+    EXPECT_LT(error, 2000000u);
+}
+
+TEST(clockCalibration, neverDecreases) {
+    ur::clock_calibration_t calibration(1ms);
+    fake_clocks_t clocks;
+    uint64_t previous_device = 0, previous_host = 0;
+    for (int i = 0; i < 1000; i++) {
+        uint64_t device = 0, host = 0;
+        ASSERT_EQ(calibration.getTimestamps(&device, &host, clocks),
+                  UR_RESULT_SUCCESS);
+        EXPECT_GE(device, previous_device);
+        EXPECT_GE(host, previous_host);
+        previous_device = device;
+        previous_host = host;
+    }
+}
+
+TEST(clockCalibration, resetsWhenClockGoesBackwards) {
+    ur::clock_calibration_t calibration(1ms);
+    fake_clocks_t clocks;
+    uint64_t device = 0;
+    ASSERT_EQ(calibration.getTimestamps(&device, nullptr, clocks),
+              UR_RESULT_SUCCESS);
+    std::this_thread::sleep_for(2ms);
+    // the device counter wrapped
+    clocks.offset = 0;
+    auto wrapped = [&](ur::clock_calibration_t::sample_t &sample) {
+        clocks(sample);
+        sample.device = 1000;
+        return UR_RESULT_SUCCESS;
+    };
+    uint64_t after_wrap = 0;
+    ASSERT_EQ(calibration.getTimestamps(&after_wrap, nullptr, wrapped),
+              UR_RESULT_SUCCESS);
+    EXPECT_LT(after_wrap, device);
+}
+
+TEST(clockCalibration, returnsSampleError) {
+    ur::clock_calibration_t calibration(1ms);
+    uint64_t device = 0;
+    auto failing = [](ur::clock_calibration_t::sample_t &) {
+        return UR_RESULT_ERROR_DEVICE_LOST;
+    };
+    EXPECT_EQ(calibration.getTimestamps(&device, nullptr, failing),
+              UR_RESULT_ERROR_DEVICE_LOST);
+    EXPECT_EQ(calibration.sampleCount(), 0);
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_deferred_frees.hpp"
+
+#include <set>
+
+struct deferredFrees : ::testing::Test {
+    ur::deferred_frees_t<int> frees;
+    std::set<int> done;
+    std::vector<int> retired;
+    std::vector<void *> freed;
+
+    ur_result_t reclaim() {
+        return frees.reclaim(
+            [&](int marker) { return done.count(marker) != 0; },
+            [&](int marker) { retired.push_back(marker); },
+            [&](void *ptr) {
+                freed.push_back(ptr);
+                return UR_RESULT_SUCCESS;
+            });
+    }
+
+    int a = 0;
+    int b = 0;
+};
+
+TEST_F(deferredFrees, waitsForAllMarkers) {
+    frees.defer(&a, {1, 2});
+    EXPECT_EQ(reclaim(), UR_RESULT_SUCCESS);
+    EXPECT_TRUE(freed.empty());
+
+    done.insert(2);
+    reclaim();
+    EXPECT_TRUE(freed.empty());
+    EXPECT_EQ(retired, std::vector<int>{2});
+
+    done.insert(1);
+    reclaim();
+    EXPECT_EQ(freed, std::vector<void *>{&a});
+    EXPECT_EQ(retired, (std::vector<int>{2, 1}));
+
+    // nothing is freed twice
+    reclaim();
+    EXPECT_EQ(freed.size(), 1);
+}
+
+TEST_F(deferredFrees, independentFrees) {
+    frees.defer(&a, {1});
+    frees.defer(&b, {2});
+    done.insert(2);
+    reclaim();
+    EXPECT_EQ(freed, std::vector<void *>{&b});
+
+    done.insert(1);
+    reclaim();
+    EXPECT_EQ(freed, (std::vector<void *>{&b, &a}));
+}
+
+TEST_F(deferredFrees, noMarkers) {
+    frees.defer(&a, {});
+    reclaim();
+    EXPECT_EQ(freed, std::vector<void *>{&a});
+    EXPECT_TRUE(retired.empty());
+}
+
+TEST_F(deferredFrees, freeError) {
+    frees.defer(&a, {});
+    frees.defer(&b, {});
+    auto result = frees.reclaim([](int) { return true; }, [](int) {},
+                                [&](void *ptr) {
+                                    freed.push_back(ptr);
+                                    return ptr == &a
+                                               ? UR_RESULT_ERROR_INVALID_VALUE
+                                               : UR_RESULT_SUCCESS;
+                                });
+    EXPECT_EQ(result, UR_RESULT_ERROR_INVALID_VALUE);
+    EXPECT_EQ(freed.size(), 2);
+}
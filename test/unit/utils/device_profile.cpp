@@ -0,0 +1,151 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "ur_device_profile.hpp"
+
+class DeviceProfileTest : public ::testing::Test {
+  protected:
+    filesystem::path dir;
+
+    void SetUp() override {
+        dir = filesystem::temp_directory_path() /
+              ("ur_device_profile_test_" + std::to_string(std::rand()));
+        ASSERT_EQ(setenv("UR_DEVICE_PROFILE_DIR", dir.string().c_str(), 1),
+                  0);
+    }
+
+    void TearDown() override {
+        unsetenv("UR_DEVICE_PROFILE_DIR");
+        std::error_code error;
+        filesystem::remove_all(dir, error);
+    }
+};
+
+static ur::device_profile_t makeProfile() {
+    ur::device_profile_t profile;
+    profile.LaunchLatencyUs = 10;
+    profile.HostToDeviceGBps = 20;
+    profile.DeviceToHostGBps = 16;
+    profile.DeviceToDeviceGBps = 400;
+    profile.FillGBps = 500;
+    profile.HostCopyGBps = 8;
+    profile.AllocLatencyUs = 50;
+    return profile;
+}
+
+TEST(DeviceProfile, SerializeAndParse) {
+    auto profile = makeProfile();
+    auto parsed = ur::device_profile_t::parse(profile.serialize());
+    ASSERT_TRUE(parsed.has_value());
+    ASSERT_EQ(parsed->LaunchLatencyUs, profile.LaunchLatencyUs);
+    ASSERT_EQ(parsed->HostToDeviceGBps, profile.HostToDeviceGBps);
+    ASSERT_EQ(parsed->DeviceToHostGBps, profile.DeviceToHostGBps);
+    ASSERT_EQ(parsed->DeviceToDeviceGBps, profile.DeviceToDeviceGBps);
+    ASSERT_EQ(parsed->FillGBps, profile.FillGBps);
+    ASSERT_EQ(parsed->HostCopyGBps, profile.HostCopyGBps);
+    ASSERT_EQ(parsed->AllocLatencyUs, profile.AllocLatencyUs);
+}
+
+TEST(DeviceProfile, ParseSkipsCommentsAndUnknownKeys) {
+    auto parsed = ur::device_profile_t::parse(
+        "# comment\n\nlaunch_latency_us 5\nnew_key 3\n");
+    ASSERT_TRUE(parsed.has_value());
+    ASSERT_EQ(parsed->LaunchLatencyUs, 5);
+    ASSERT_EQ(parsed->HostToDeviceGBps, 0);
+}
+
+TEST(DeviceProfile, ParseRejectsMalformedLines) {
+    ASSERT_FALSE(ur::device_profile_t::parse("launch_latency_us\n"));
+    ASSERT_FALSE(ur::device_profile_t::parse("launch_latency_us fast\n"));
+    ASSERT_FALSE(ur::device_profile_t::parse("launch_latency_us -1\n"));
+}
+
+TEST(DeviceProfile, Thresholds) {
+    auto profile = makeProfile();
+    // 10us at 8 GB/s
+    ASSERT_EQ(profile.hostCopyThreshold(), 80000u);
+    // 64 * 10us at 20 GB/s
+    ASSERT_EQ(profile.splitTransferThreshold(), 12800000u);
+
+    ur::device_profile_t unknown;
+    ASSERT_EQ(unknown.hostCopyThreshold(), 0u);
+    ASSERT_EQ(unknown.splitTransferThreshold(), 0u);
+}
+
+TEST(DeviceProfile, Name) {
+    ASSERT_EQ(ur::deviceProfileName(UR_ADAPTER_BACKEND_LEVEL_ZERO, 0x8086,
+                                    0x56c0, "1.3.29735"),
+              "level_zero_8086_56c0_1.3.29735.profile");
+    ASSERT_EQ(ur::deviceProfileName(UR_ADAPTER_BACKEND_CUDA, 0x10de, 0x2330,
+                                    "12.2 /x"),
+              "cuda_10de_2330_12.2__x.profile");
+}
+
+static ur_result_t getInfo(int, ur_device_info_t prop, size_t size,
+                           void *value, size_t *sizeRet) {
+    static const char version[] = "1.2";
+    switch (prop) {
+    case UR_DEVICE_INFO_VENDOR_ID:
+        *static_cast<uint32_t *>(value) = 0x8086;
+        return UR_RESULT_SUCCESS;
+    case UR_DEVICE_INFO_DEVICE_ID:
+        *static_cast<uint32_t *>(value) = 0x1234;
+        return UR_RESULT_SUCCESS;
+    case UR_DEVICE_INFO_DRIVER_VERSION:
+        if (sizeRet) {
+            *sizeRet = sizeof(version);
+        }
+        if (value) {
+            std::memcpy(value, version, std::min(size, sizeof(version)));
+        }
+        return UR_RESULT_SUCCESS;
+    default:
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+}
+
+TEST(DeviceProfile, NameFromDeviceInfo) {
+    ASSERT_EQ(ur::deviceProfileName(UR_ADAPTER_BACKEND_HIP, 0, getInfo),
+              "hip_8086_1234_1.2.profile");
+}
+
+TEST_F(DeviceProfileTest, DisabledWithoutDirectory) {
+    unsetenv("UR_DEVICE_PROFILE_DIR");
+    ASSERT_FALSE(ur::storeDeviceProfile("name.profile", makeProfile()));
+    ASSERT_FALSE(ur::loadDeviceProfile("name.profile"));
+    ASSERT_FALSE(
+        ur::loadDeviceProfile(UR_ADAPTER_BACKEND_HIP, 0, getInfo).has_value());
+}
+
+TEST_F(DeviceProfileTest, StoreAndLoad) {
+    ASSERT_FALSE(
+        ur::loadDeviceProfile(UR_ADAPTER_BACKEND_HIP, 0, getInfo).has_value());
+
+    auto name = ur::deviceProfileName(UR_ADAPTER_BACKEND_HIP, 0, getInfo);
+    ASSERT_TRUE(ur::storeDeviceProfile(name, makeProfile()));
+    auto loaded = ur::loadDeviceProfile(UR_ADAPTER_BACKEND_HIP, 0, getInfo);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_EQ(loaded->HostToDeviceGBps, 20);
+
+    // Storing again replaces the profile
+    auto profile = makeProfile();
+    profile.HostToDeviceGBps = 24;
+    ASSERT_TRUE(ur::storeDeviceProfile(name, profile));
+    loaded = ur::loadDeviceProfile(name);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_EQ(loaded->HostToDeviceGBps, 24);
+}
+
+TEST_F(DeviceProfileTest, MalformedProfileIsIgnored) {
+    filesystem::create_directories(dir);
+    std::ofstream(dir / "bad.profile") << "launch_latency_us\n";
+    ASSERT_FALSE(ur::loadDeviceProfile("bad.profile"));
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "umf_pools/disjoint_pool_config_parser.hpp"
+
+using usm::DisjointPoolMemType;
+
+TEST(disjointPoolConfigParser, threadCachesDisabledByDefault) {
+    auto AllConfigs = usm::parseDisjointPoolConfig("", 0);
+    for (auto &ThreadCache : AllConfigs.ThreadCaches) {
+        EXPECT_EQ(ThreadCache.Capacity, 0);
+        EXPECT_EQ(ThreadCache.MaxSize, 64 * 1024);
+    }
+}
+
+TEST(disjointPoolConfigParser, threadCacheOfEveryMemType) {
+    auto AllConfigs = usm::parseDisjointPoolConfig("1;32M;1M,4,64K,16,8K", 0);
+    for (auto &ThreadCache : AllConfigs.ThreadCaches) {
+        EXPECT_EQ(ThreadCache.Capacity, 16);
+        EXPECT_EQ(ThreadCache.MaxSize, 8 * 1024);
+    }
+}
+
+TEST(disjointPoolConfigParser, threadCacheOfOneMemType) {
+    auto AllConfigs =
+        usm::parseDisjointPoolConfig("1;32M;device:1M,4,64K,32,4K", 0);
+    auto &Device = AllConfigs.ThreadCaches[DisjointPoolMemType::Device];
+    EXPECT_EQ(Device.Capacity, 32);
+    EXPECT_EQ(Device.MaxSize, 4 * 1024);
+
+    auto &Host = AllConfigs.ThreadCaches[DisjointPoolMemType::Host];
+    EXPECT_EQ(Host.Capacity, 0);
+    EXPECT_EQ(Host.MaxSize, 64 * 1024);
+}
+
+TEST(disjointPoolConfigParser, threadCacheMaxSizeIsOptional) {
+    auto AllConfigs = usm::parseDisjointPoolConfig("1;32M;host:1M,4,64K,8", 0);
+    auto &Host = AllConfigs.ThreadCaches[DisjointPoolMemType::Host];
+    EXPECT_EQ(Host.Capacity, 8);
+    EXPECT_EQ(Host.MaxSize, 64 * 1024);
+}
@@ -0,0 +1,199 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ur_event_callbacks.hpp"
+
+namespace {
+// The events are indices into their statuses and reference counts
+struct events_t {
+    events_t(size_t count) : statuses(count), references(count) {
+        for (auto &status : statuses) {
+            status = UR_EVENT_STATUS_QUEUED;
+        }
+    }
+
+    ur_event_handle_t get(size_t index) {
+        return reinterpret_cast<ur_event_handle_t>(index + 1);
+    }
+    size_t index(ur_event_handle_t event) {
+        return reinterpret_cast<size_t>(event) - 1;
+    }
+
+    std::vector<std::atomic<ur_event_status_t>> statuses;
+    std::vector<std::atomic<int>> references;
+};
+
+struct called_t {
+    std::mutex mutex;
+    std::vector<std::pair<ur_event_handle_t, ur_execution_info_t>> calls;
+    std::atomic<size_t> count = 0;
+};
+
+void notify(ur_event_handle_t event, ur_execution_info_t status,
+            void *user_data) {
+    auto &called = *static_cast<called_t *>(user_data);
+    std::lock_guard<std::mutex> lock(called.mutex);
+    called.calls.push_back({event, status});
+    called.count++;
+}
+
+template <class F> bool waitFor(F &&condition) {
+    auto end = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > end) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+} // namespace
+
+struct eventCallbacks : ::testing::Test {
+    bool released() {
+        for (auto &references : events.references) {
+            if (references != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    events_t events{1000};
+    called_t called;
+    ur::event_callback_dispatcher_t dispatcher{
+        [this](ur_event_handle_t event) {
+            return events.statuses[events.index(event)].load();
+        },
+        [this](ur_event_handle_t event) {
+            events.references[events.index(event)]++;
+        },
+        [this](ur_event_handle_t event) {
+            events.references[events.index(event)]--;
+        }};
+};
+
+TEST_F(eventCallbacks, runsOnCompletion) {
+    dispatcher.add(events.get(0), UR_EXECUTION_INFO_COMPLETE, notify, &called);
+    EXPECT_EQ(events.references[0], 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(called.count, 0u);
+
+    events.statuses[0] = UR_EVENT_STATUS_COMPLETE;
+    ASSERT_TRUE(waitFor([&] { return called.count == 1; }));
+    EXPECT_EQ(called.calls[0].first, events.get(0));
+    EXPECT_EQ(called.calls[0].second, UR_EXECUTION_INFO_COMPLETE);
+    ASSERT_TRUE(waitFor([&] { return released(); }));
+}
+
+TEST_F(eventCallbacks, runsRightAwayIfReached) {
+    events.statuses[0] = UR_EVENT_STATUS_COMPLETE;
+    dispatcher.add(events.get(0), UR_EXECUTION_INFO_COMPLETE, notify, &called);
+    EXPECT_EQ(called.count, 1u);
+    EXPECT_EQ(events.references[0], 0);
+}
+
+TEST_F(eventCallbacks, earlierStatuses) {
+    events.statuses[0] = UR_EVENT_STATUS_SUBMITTED;
+    dispatcher.add(events.get(0), UR_EXECUTION_INFO_SUBMITTED, notify,
+                   &called);
+    EXPECT_EQ(called.count, 1u);
+    dispatcher.add(events.get(0), UR_EXECUTION_INFO_RUNNING, notify, &called);
+    dispatcher.add(events.get(0), UR_EXECUTION_INFO_COMPLETE, notify, &called);
+
+    // Completing runs the callbacks of the statuses before too
+    events.statuses[0] = UR_EVENT_STATUS_COMPLETE;
+    ASSERT_TRUE(waitFor([&] { return called.count == 3; }));
+    std::lock_guard<std::mutex> lock(called.mutex);
+    EXPECT_EQ(called.calls[1].second, UR_EXECUTION_INFO_RUNNING);
+    EXPECT_EQ(called.calls[2].second, UR_EXECUTION_INFO_COMPLETE);
+}
+
+TEST_F(eventCallbacks, manyPending) {
+    for (size_t i = 0; i < events.statuses.size(); i++) {
+        dispatcher.add(events.get(i), UR_EXECUTION_INFO_COMPLETE, notify,
+                       &called);
+    }
+    // Completes the odd events first, their callbacks run while the others
+    // are still pending
+    for (size_t i = 1; i < events.statuses.size(); i += 2) {
+        events.statuses[i] = UR_EVENT_STATUS_COMPLETE;
+    }
+    ASSERT_TRUE(
+        waitFor([&] { return called.count == events.statuses.size() / 2; }));
+    {
+        std::lock_guard<std::mutex> lock(called.mutex);
+        for (auto &call : called.calls) {
+            EXPECT_EQ(events.index(call.first) % 2, 1u);
+        }
+    }
+    for (size_t i = 0; i < events.statuses.size(); i += 2) {
+        events.statuses[i] = UR_EVENT_STATUS_COMPLETE;
+    }
+    ASSERT_TRUE(
+        waitFor([&] { return called.count == events.statuses.size(); }));
+    ASSERT_TRUE(waitFor([&] { return released(); }));
+}
+
+TEST_F(eventCallbacks, flushRunsWaited) {
+    for (size_t i = 0; i < 100; i++) {
+        dispatcher.add(events.get(i), UR_EXECUTION_INFO_COMPLETE, notify,
+                       &called);
+    }
+    ur_event_handle_t waited[] = {events.get(10), events.get(20)};
+    events.statuses[10] = UR_EVENT_STATUS_COMPLETE;
+    events.statuses[20] = UR_EVENT_STATUS_COMPLETE;
+    dispatcher.flush(2, waited);
+    // Without waiting for the thread of the dispatcher
+    EXPECT_EQ(called.count, 2u);
+    EXPECT_EQ(events.references[10], 0);
+    EXPECT_EQ(events.references[20], 0);
+
+    // The others are still pending
+    events.statuses[30] = UR_EVENT_STATUS_COMPLETE;
+    ASSERT_TRUE(waitFor([&] { return called.count == 3; }));
+}
+
+struct chain_t {
+    ur::event_callback_dispatcher_t *dispatcher;
+    ur_event_handle_t next;
+    called_t *called;
+};
+
+TEST_F(eventCallbacks, addFromCallback) {
+    chain_t chain{&dispatcher, events.get(1), &called};
+    dispatcher.add(
+        events.get(0), UR_EXECUTION_INFO_COMPLETE,
+        [](ur_event_handle_t, ur_execution_info_t, void *user_data) {
+            auto &chain = *static_cast<chain_t *>(user_data);
+            chain.dispatcher->add(chain.next, UR_EXECUTION_INFO_COMPLETE,
+                                  notify, chain.called);
+            chain.dispatcher->flush(1, &chain.next);
+        },
+        &chain);
+    events.statuses[0] = UR_EVENT_STATUS_COMPLETE;
+    ASSERT_TRUE(waitFor([&] { return events.references[1] == 1; }));
+    events.statuses[1] = UR_EVENT_STATUS_COMPLETE;
+    ASSERT_TRUE(waitFor([&] { return called.count == 1; }));
+    EXPECT_EQ(called.calls[0].first, events.get(1));
+}
+
+TEST_F(eventCallbacks, dropsPendingOnDestruction) {
+    {
+        ur::event_callback_dispatcher_t local{
+            [](ur_event_handle_t) { return UR_EVENT_STATUS_QUEUED; },
+            [](ur_event_handle_t) {}, [](ur_event_handle_t) {}};
+        local.add(events.get(0), UR_EXECUTION_INFO_COMPLETE, notify, &called);
+    }
+    EXPECT_EQ(called.count, 0u);
+}
@@ -138,6 +138,40 @@ TEST(GetenvToMap, EmptyEnvVar) {
     ASSERT_FALSE(map.has_value());
 }
 
+TEST(EnvVarMapCache, MatchesGetenvToMap) {
+    env_var_map_cache_t cache("UR_TEST_ENV_VAR", false);
+
+    // ONEAPI_DEVICE_SELECTOR-like values, read twice each to also go through
+    // the cached path
+    for (const char *value :
+         {"level_zero:0", "level_zero:0", "*:*", "!opencl:*;cuda:1.*,gpu",
+          "!opencl:*;cuda:1.*,gpu", "level_zero:0"}) {
+        int ret = setenv("UR_TEST_ENV_VAR", value, 1);
+        ASSERT_EQ(ret, 0);
+        ASSERT_EQ(cache.get(), getenv_to_map("UR_TEST_ENV_VAR", false));
+    }
+
+    int ret = unsetenv("UR_TEST_ENV_VAR");
+    ASSERT_EQ(ret, 0);
+    ASSERT_FALSE(cache.get().has_value());
+}
+
+TEST(EnvVarMapCache, WrongValueIsNotCached) {
+    env_var_map_cache_t cache("UR_TEST_ENV_VAR", false);
+
+    int ret = setenv("UR_TEST_ENV_VAR", "level_zero:0;level_zero:1", 1);
+    ASSERT_EQ(ret, 0);
+    ASSERT_THROW(cache.get(), std::invalid_argument);
+    ASSERT_THROW(cache.get(), std::invalid_argument);
+
+    ret = setenv("UR_TEST_ENV_VAR", "level_zero:1", 1);
+    ASSERT_EQ(ret, 0);
+    ASSERT_EQ(cache.get(), getenv_to_map("UR_TEST_ENV_VAR", false));
+
+    ret = unsetenv("UR_TEST_ENV_VAR");
+    ASSERT_EQ(ret, 0);
+}
+
 // ////////////////////////////////////////////////////////////////////////////////////
 // // Negative tests
 
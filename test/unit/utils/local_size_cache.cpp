@@ -0,0 +1,53 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_local_size_cache.hpp"
+
+TEST(localSizeCache, findInserted) {
+    ur::local_size_cache_t cache;
+    const size_t global[3] = {1024, 64, 2};
+    const size_t local[3] = {256, 4, 1};
+    size_t found[3] = {};
+    EXPECT_FALSE(cache.find(3, 0, global, found));
+    cache.insert(3, 0, global, local);
+    ASSERT_TRUE(cache.find(3, 0, global, found));
+    EXPECT_EQ(found[0], 256);
+    EXPECT_EQ(found[1], 4);
+    EXPECT_EQ(found[2], 1);
+}
+
+TEST(localSizeCache, keyedByLaunch) {
+    ur::local_size_cache_t cache;
+    const size_t global[3] = {1024, 64, 2};
+    const size_t local[3] = {256, 1, 1};
+    size_t found[3] = {};
+    cache.insert(1, 128, global, local);
+    // another local memory size or global size needs another guess
+    EXPECT_FALSE(cache.find(1, 256, global, found));
+    const size_t other_global[1] = {1000};
+    EXPECT_FALSE(cache.find(1, 128, other_global, found));
+    // the dimensions past the work dimensions are ignored
+    const size_t global_1d[3] = {1024, 7, 7};
+    EXPECT_TRUE(cache.find(1, 128, global_1d, found));
+    EXPECT_FALSE(cache.find(2, 128, global, found));
+}
+
+TEST(localSizeCache, evictsOldest) {
+    ur::local_size_cache_t cache;
+    const size_t local[3] = {32, 1, 1};
+    size_t found[3] = {};
+    for (size_t i = 0; i <= ur::local_size_cache_t::max_entries; i++) {
+        const size_t global[1] = {32 * (i + 1)};
+        cache.insert(1, 0, global, local);
+    }
+    const size_t first[1] = {32};
+    EXPECT_FALSE(cache.find(1, 0, first, found));
+    for (size_t i = 1; i <= ur::local_size_cache_t::max_entries; i++) {
+        const size_t global[1] = {32 * (i + 1)};
+        EXPECT_TRUE(cache.find(1, 0, global, found));
+    }
+}
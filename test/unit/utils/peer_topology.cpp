@@ -0,0 +1,110 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "ur_peer_topology.hpp"
+
+namespace {
+ur_device_handle_t fakeDevice(uintptr_t id) {
+    return reinterpret_cast<ur_device_handle_t>(id);
+}
+
+// Four devices: 1 and 2 are linked over PCIe, 3 has fabric links to both,
+// and 4 isn't linked to any
+struct fake_topology_t {
+    ur_result_t operator()(ur_device_handle_t src, ur_device_handle_t dst,
+                           ur::peer_link_t &link) {
+        queries++;
+        auto a = reinterpret_cast<uintptr_t>(src);
+        auto b = reinterpret_cast<uintptr_t>(dst);
+        if (a == 4 || b == 4) {
+            return UR_RESULT_SUCCESS;
+        }
+        if (a == 3 || b == 3) {
+            link = {UR_EXP_PEER_LINK_TYPE_FABRIC, fabric_bandwidth, 1};
+        } else {
+            link = {UR_EXP_PEER_LINK_TYPE_PCIE, 16000, 1};
+        }
+        return UR_RESULT_SUCCESS;
+    }
+    uint64_t fabric_bandwidth = 100000;
+    int queries = 0;
+};
+
+const std::vector<ur_device_handle_t> devices = {
+    fakeDevice(1), fakeDevice(2), fakeDevice(3), fakeDevice(4)};
+} // namespace
+
+TEST(peerTopology, cachesLinks) {
+    ur::peer_topology_t topology;
+    fake_topology_t fake;
+    ur::peer_link_t link;
+    ASSERT_EQ(topology.getLink(fakeDevice(1), fakeDevice(3), link, fake),
+              UR_RESULT_SUCCESS);
+    EXPECT_EQ(link.type, UR_EXP_PEER_LINK_TYPE_FABRIC);
+    ASSERT_EQ(topology.getLink(fakeDevice(1), fakeDevice(3), link, fake),
+              UR_RESULT_SUCCESS);
+    EXPECT_EQ(fake.queries, 1);
+
+    topology.invalidate(fakeDevice(3));
+    ASSERT_EQ(topology.getLink(fakeDevice(1), fakeDevice(3), link, fake),
+              UR_RESULT_SUCCESS);
+    EXPECT_EQ(fake.queries, 2);
+}
+
+TEST(peerTopology, stagesThroughFasterDevice) {
+    ur::peer_topology_t topology;
+    fake_topology_t fake;
+    ur::peer_route_t route;
+    ASSERT_EQ(topology.getRoute(fakeDevice(1), fakeDevice(2), devices, route,
+                                fake),
+              UR_RESULT_SUCCESS);
+    EXPECT_EQ(route.route, UR_EXP_PEER_COPY_ROUTE_DEVICE);
+    EXPECT_EQ(route.intermediate, fakeDevice(3));
+}
+
+TEST(peerTopology, prefersDirectLink) {
+    ur::peer_topology_t topology;
+    fake_topology_t fake;
+    // staging through 3 isn't twice as fast
+    fake.fabric_bandwidth = 30000;
+    ur::peer_route_t route;
+    ASSERT_EQ(topology.getRoute(fakeDevice(1), fakeDevice(2), devices, route,
+                                fake),
+              UR_RESULT_SUCCESS);
+    EXPECT_EQ(route.route, UR_EXP_PEER_COPY_ROUTE_DIRECT);
+    EXPECT_EQ(route.intermediate, nullptr);
+
+    ASSERT_EQ(topology.getRoute(fakeDevice(1), fakeDevice(3), devices, route,
+                                fake),
+              UR_RESULT_SUCCESS);
+    EXPECT_EQ(route.route, UR_EXP_PEER_COPY_ROUTE_DIRECT);
+}
+
+TEST(peerTopology, stagesThroughHostWithoutLinks) {
+    ur::peer_topology_t topology;
+    fake_topology_t fake;
+    ur::peer_route_t route;
+    ASSERT_EQ(topology.getRoute(fakeDevice(1), fakeDevice(4), devices, route,
+                                fake),
+              UR_RESULT_SUCCESS);
+    EXPECT_EQ(route.route, UR_EXP_PEER_COPY_ROUTE_HOST);
+    EXPECT_EQ(route.intermediate, nullptr);
+}
+
+TEST(peerTopology, returnsQueryError) {
+    ur::peer_topology_t topology;
+    ur::peer_route_t route;
+    auto failing = [](ur_device_handle_t, ur_device_handle_t,
+                      ur::peer_link_t &) {
+        return UR_RESULT_ERROR_DEVICE_LOST;
+    };
+    EXPECT_EQ(topology.getRoute(fakeDevice(1), fakeDevice(2), devices, route,
+                                failing),
+              UR_RESULT_ERROR_DEVICE_LOST);
+}
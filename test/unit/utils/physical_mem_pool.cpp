@@ -0,0 +1,61 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_physical_mem_pool.hpp"
+
+using pool_t = ur::physical_mem_pool_t<int, int>;
+
+TEST(physicalMemPool, acquireReleased) {
+    pool_t pool(1024);
+    EXPECT_FALSE(pool.acquire(0, 64));
+    ASSERT_TRUE(pool.release(0, 64, 42));
+    auto handle = pool.acquire(0, 64);
+    ASSERT_TRUE(handle);
+    EXPECT_EQ(*handle, 42);
+    EXPECT_FALSE(pool.acquire(0, 64));
+}
+
+TEST(physicalMemPool, keyedByDeviceAndSize) {
+    pool_t pool(1024);
+    ASSERT_TRUE(pool.release(0, 64, 42));
+    EXPECT_FALSE(pool.acquire(1, 64));
+    EXPECT_FALSE(pool.acquire(0, 128));
+    EXPECT_TRUE(pool.acquire(0, 64));
+}
+
+TEST(physicalMemPool, full) {
+    pool_t pool(128);
+    EXPECT_TRUE(pool.release(0, 64, 1));
+    EXPECT_TRUE(pool.release(0, 64, 2));
+    EXPECT_FALSE(pool.release(0, 64, 3));
+    // acquiring makes room again
+    EXPECT_TRUE(pool.acquire(0, 64));
+    EXPECT_TRUE(pool.release(0, 64, 3));
+}
+
+TEST(physicalMemPool, trim) {
+    pool_t pool(1024);
+    pool.release(0, 64, 1);
+    pool.release(0, 64, 2);
+    pool.release(1, 128, 3);
+
+    std::vector<std::pair<int, int>> freed;
+    auto free_fn = [&](int device, int handle) {
+        freed.emplace_back(device, handle);
+    };
+    EXPECT_EQ(pool.trim(256, free_fn), 0);
+    EXPECT_TRUE(freed.empty());
+
+    // at most 128 bytes are kept
+    size_t released = pool.trim(128, free_fn);
+    EXPECT_GE(released, 128);
+
+    EXPECT_EQ(pool.trim(0, free_fn) + released, 256);
+    EXPECT_EQ(freed.size(), 3);
+    EXPECT_FALSE(pool.acquire(0, 64));
+    EXPECT_FALSE(pool.acquire(1, 128));
+}
@@ -0,0 +1,245 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "umf_helpers.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+/// Allocations made from and returned to the test pool
+struct pool_counters_t {
+    std::atomic<size_t> Mallocs = 0;
+    std::atomic<size_t> Frees = 0;
+};
+
+/// The test pool doesn't allocate from its provider, but UMF requires one
+struct null_provider_t {
+    umf_result_t initialize() { return UMF_RESULT_SUCCESS; }
+    umf_result_t alloc(size_t, size_t, void **) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+    umf_result_t free(void *, size_t) { return UMF_RESULT_ERROR_NOT_SUPPORTED; }
+    void get_last_native_error(const char **, int32_t *) {}
+    umf_result_t get_recommended_page_size(size_t, size_t *) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+    umf_result_t get_min_page_size(void *, size_t *) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+    umf_result_t purge_lazy(void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+    umf_result_t purge_force(void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+    umf_result_t allocation_merge(void *, void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+    umf_result_t allocation_split(void *, size_t, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+    const char *get_name() { return "null"; }
+};
+
+struct counting_pool_t {
+    umf_result_t initialize(umf_memory_provider_handle_t,
+                            pool_counters_t *Counters) {
+        this->Counters = Counters;
+        return UMF_RESULT_SUCCESS;
+    }
+    void *malloc(size_t Size) { return aligned_malloc(Size, 0); }
+    void *calloc(size_t, size_t) { return nullptr; }
+    void *realloc(void *, size_t) { return nullptr; }
+    void *aligned_malloc(size_t Size, size_t Align) {
+        Counters->Mallocs++;
+        return std::aligned_alloc(std::max<size_t>(Align, 64),
+                                  (Size + 63) / 64 * 64);
+    }
+    size_t malloc_usable_size(void *) { return 0; }
+    umf_result_t free(void *Ptr) {
+        Counters->Frees++;
+        std::free(Ptr);
+        return UMF_RESULT_SUCCESS;
+    }
+    umf_result_t get_last_allocation_error() { return UMF_RESULT_SUCCESS; }
+
+    pool_counters_t *Counters = nullptr;
+};
+} // namespace
+
+struct poolCache : ::testing::Test {
+    void SetUp() override {
+        auto [ProviderRet, Provider] =
+            umf::memoryProviderMakeUnique<null_provider_t>();
+        ASSERT_EQ(ProviderRet, UMF_RESULT_SUCCESS);
+        auto [PoolRet, NewPool] = umf::poolMakeUnique<counting_pool_t>(
+            std::move(Provider), &Counters);
+        ASSERT_EQ(PoolRet, UMF_RESULT_SUCCESS);
+        Pool = umf::poolAddThreadCache(std::move(NewPool), Capacity, MaxSize);
+        ASSERT_NE(umf::findPoolCache(Pool.get()), nullptr);
+    }
+
+    void *malloc(size_t Size) {
+        return umf::cachedAlignedMalloc(Pool.get(), Size, 0);
+    }
+
+    umf_result_t free(void *Ptr) { return umf::cachedFree(Pool.get(), Ptr); }
+
+    static constexpr size_t Capacity = 2;
+    static constexpr size_t MaxSize = 1024;
+
+    pool_counters_t Counters;
+    umf::pool_unique_handle_t Pool{nullptr, nullptr};
+};
+
+TEST_F(poolCache, reusesFreedAllocation) {
+    void *Ptr = malloc(100);
+    ASSERT_NE(Ptr, nullptr);
+    ASSERT_EQ(free(Ptr), UMF_RESULT_SUCCESS);
+    EXPECT_EQ(Counters.Frees, 0);
+
+    // Any size of the same size class is served from the magazine
+    EXPECT_EQ(malloc(128), Ptr);
+    EXPECT_EQ(Counters.Mallocs, 1);
+    ASSERT_EQ(free(Ptr), UMF_RESULT_SUCCESS);
+}
+
+TEST_F(poolCache, doesNotCacheLargeAllocations) {
+    void *Ptr = malloc(MaxSize + 1);
+    ASSERT_NE(Ptr, nullptr);
+    ASSERT_EQ(free(Ptr), UMF_RESULT_SUCCESS);
+    EXPECT_EQ(Counters.Frees, 1);
+}
+
+TEST_F(poolCache, returnsOlderHalfOfFullMagazine) {
+    void *Ptrs[] = {malloc(64), malloc(64), malloc(64)};
+    for (void *Ptr : Ptrs) {
+        ASSERT_EQ(free(Ptr), UMF_RESULT_SUCCESS);
+    }
+    EXPECT_EQ(Counters.Frees, 1);
+
+    // The newest allocations are still cached
+    EXPECT_EQ(malloc(64), Ptrs[2]);
+    EXPECT_EQ(Counters.Mallocs, 3);
+}
+
+TEST_F(poolCache, cachesAllocationFreedByAnotherThread) {
+    void *Ptr = nullptr;
+    std::thread([&] { Ptr = malloc(256); }).join();
+    ASSERT_NE(Ptr, nullptr);
+
+    ASSERT_EQ(free(Ptr), UMF_RESULT_SUCCESS);
+    EXPECT_EQ(Counters.Frees, 0);
+    EXPECT_EQ(malloc(256), Ptr);
+    EXPECT_EQ(Counters.Mallocs, 1);
+}
+
+TEST_F(poolCache, returnsCachedAllocationsOnThreadExit) {
+    std::thread([&] { ASSERT_EQ(free(malloc(64)), UMF_RESULT_SUCCESS); })
+        .join();
+    EXPECT_EQ(Counters.Frees, 1);
+}
+
+TEST_F(poolCache, trimKeepsNewestAllocations) {
+    void *First = malloc(128);
+    void *Second = malloc(128);
+    ASSERT_EQ(free(First), UMF_RESULT_SUCCESS);
+    ASSERT_EQ(free(Second), UMF_RESULT_SUCCESS);
+
+    EXPECT_EQ(umf::poolTrim(Pool.get(), 128), 128);
+    EXPECT_EQ(Counters.Frees, 1);
+    EXPECT_EQ(malloc(128), Second);
+
+    EXPECT_EQ(umf::poolTrim(Pool.get(), 0), 0);
+    ASSERT_EQ(free(Second), UMF_RESULT_SUCCESS);
+    EXPECT_EQ(umf::poolTrim(Pool.get(), 0), 128);
+    EXPECT_EQ(Counters.Frees, 2);
+}
+
+TEST_F(poolCache, returnsCachedAllocationsOnDestruction) {
+    ASSERT_EQ(free(malloc(64)), UMF_RESULT_SUCCESS);
+    ASSERT_EQ(free(malloc(512)), UMF_RESULT_SUCCESS);
+    EXPECT_EQ(Counters.Frees, 0);
+
+    Pool.reset();
+    EXPECT_EQ(Counters.Frees, 2);
+}
+
+struct poolStats : ::testing::TestWithParam<bool> {
+    void SetUp() override {
+        auto [ProviderRet, Provider] =
+            umf::memoryProviderMakeUnique<null_provider_t>();
+        ASSERT_EQ(ProviderRet, UMF_RESULT_SUCCESS);
+        auto [PoolRet, NewPool] = umf::poolMakeUnique<counting_pool_t>(
+            std::move(Provider), &Counters);
+        ASSERT_EQ(PoolRet, UMF_RESULT_SUCCESS);
+        Pool = umf::poolAddStats(std::move(NewPool), GetParam());
+        ASSERT_NE(umf::findPoolStats(Pool.get()), nullptr);
+    }
+
+    umf::pool_stats_t::snapshot_t snapshot() {
+        return umf::findPoolStats(Pool.get())->snapshot();
+    }
+
+    pool_counters_t Counters;
+    umf::pool_unique_handle_t Pool{nullptr, nullptr};
+};
+
+/// Answers the queries of poolStatsInfo without writing anything
+struct discard_return_t {
+    template <typename T> ur_result_t operator()(const T &) {
+        return UR_RESULT_SUCCESS;
+    }
+    template <typename T> ur_result_t operator()(const T *, size_t) {
+        return UR_RESULT_SUCCESS;
+    }
+};
+
+TEST_P(poolStats, countsAllocationsPerBucket) {
+    void *Small = umf::cachedAlignedMalloc(Pool.get(), 100, 0);
+    void *Large = umf::cachedAlignedMalloc(Pool.get(), 3000, 0);
+    ASSERT_EQ(umf::cachedFree(Pool.get(), Small), UMF_RESULT_SUCCESS);
+
+    // The test pool never allocates from its provider, so every allocation
+    // is a hit
+    auto Stats = snapshot();
+    EXPECT_EQ(Stats.Hits[umf::detail::cacheSizeClass(100)], 1);
+    EXPECT_EQ(Stats.Hits[umf::detail::cacheSizeClass(3000)], 1);
+    for (uint64_t Misses : Stats.Misses) {
+        EXPECT_EQ(Misses, 0);
+    }
+    ASSERT_EQ(umf::cachedFree(Pool.get(), Large), UMF_RESULT_SUCCESS);
+}
+
+TEST_P(poolStats, countsUsedSizesOnlyWhenTracked) {
+    bool TrackSizes = GetParam();
+    void *Small = umf::cachedAlignedMalloc(Pool.get(), 100, 0);
+    void *Large = umf::cachedAlignedMalloc(Pool.get(), 3000, 0);
+    ASSERT_EQ(umf::cachedFree(Pool.get(), Small), UMF_RESULT_SUCCESS);
+
+    auto Stats = snapshot();
+    EXPECT_EQ(Stats.TracksSizes, TrackSizes);
+    EXPECT_EQ(Stats.UsedSize, TrackSizes ? 3000 : 0);
+    EXPECT_EQ(Stats.PeakUsedSize, TrackSizes ? 3100 : 0);
+
+    discard_return_t ReturnValue;
+    EXPECT_EQ(umf::poolStatsInfo(Stats, UR_USM_POOL_INFO_USED_SIZE,
+                                 ReturnValue),
+              TrackSizes ? UR_RESULT_SUCCESS
+                         : UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION);
+    EXPECT_EQ(umf::poolStatsInfo(Stats, UR_USM_POOL_INFO_BUCKET_HITS,
+                                 ReturnValue),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(umf::cachedFree(Pool.get(), Large), UMF_RESULT_SUCCESS);
+}
+
+INSTANTIATE_TEST_SUITE_P(, poolStats, ::testing::Bool(),
+                         [](const ::testing::TestParamInfo<bool> &Info) {
+                             return Info.param ? "TrackSizes" : "Counters";
+                         });
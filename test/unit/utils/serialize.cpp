@@ -0,0 +1,101 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <vector>
+
+#include "ur_serialize.hpp"
+
+struct SerializeBufferCreate : ::testing::Test {
+    void SetUp() override {
+        params.phContext = &hContext;
+        params.pflags = &flags;
+        params.psize = &size;
+        params.ppProperties = &pProperties;
+        params.pphBuffer = &phBuffer;
+    }
+
+    std::vector<char> serialize() {
+        std::vector<char> buffer(ur::extras::getSerializedFunctionParamsSize(
+            UR_FUNCTION_MEM_BUFFER_CREATE));
+        EXPECT_EQ(ur::extras::serializeFunctionParams(
+                      UR_FUNCTION_MEM_BUFFER_CREATE, &params, buffer.data(),
+                      buffer.size()),
+                  UR_RESULT_SUCCESS);
+        return buffer;
+    }
+
+    std::string print(const std::vector<char> &buffer) {
+        std::ostringstream os;
+        EXPECT_EQ(ur::extras::printSerializedFunctionParams(
+                      os, UR_FUNCTION_MEM_BUFFER_CREATE, buffer.data(),
+                      buffer.size()),
+                  UR_RESULT_SUCCESS);
+        return os.str();
+    }
+
+    ur_context_handle_t hContext =
+        reinterpret_cast<ur_context_handle_t>(0x1234);
+    ur_mem_flags_t flags = UR_MEM_FLAG_READ_WRITE;
+    size_t size = 64;
+    const ur_buffer_properties_t *pProperties = nullptr;
+    ur_mem_handle_t *phBuffer = nullptr;
+    ur_mem_buffer_create_params_t params;
+};
+
+TEST_F(SerializeBufferCreate, MatchesTextPrinter) {
+    std::ostringstream expected;
+    ur::extras::printFunctionParams(expected, UR_FUNCTION_MEM_BUFFER_CREATE,
+                                    &params);
+
+    EXPECT_EQ(print(serialize()), expected.str());
+}
+
+TEST_F(SerializeBufferCreate, CopiesTheArguments) {
+    auto buffer = serialize();
+    auto before = print(buffer);
+    size = 128;
+    flags = UR_MEM_FLAG_READ_ONLY;
+
+    EXPECT_EQ(print(buffer), before);
+}
+
+TEST_F(SerializeBufferCreate, PrintsPointersAsAddresses) {
+    ur_mem_handle_t hBuffer = reinterpret_cast<ur_mem_handle_t>(0x5678);
+    phBuffer = &hBuffer;
+    std::ostringstream address;
+    address << static_cast<const void *>(phBuffer);
+
+    auto output = print(serialize());
+    EXPECT_NE(output.find(".phBuffer = " + address.str()), std::string::npos);
+    EXPECT_EQ(output.find("0x5678"), std::string::npos);
+}
+
+TEST_F(SerializeBufferCreate, RequiresTheSize) {
+    std::vector<char> buffer(ur::extras::getSerializedFunctionParamsSize(
+                                 UR_FUNCTION_MEM_BUFFER_CREATE) -
+                             1);
+    EXPECT_EQ(ur::extras::serializeFunctionParams(
+                  UR_FUNCTION_MEM_BUFFER_CREATE, &params, buffer.data(),
+                  buffer.size()),
+              UR_RESULT_ERROR_INVALID_SIZE);
+
+    std::ostringstream os;
+    EXPECT_EQ(ur::extras::printSerializedFunctionParams(
+                  os, UR_FUNCTION_MEM_BUFFER_CREATE, buffer.data(),
+                  buffer.size()),
+              UR_RESULT_ERROR_INVALID_SIZE);
+}
+
+TEST(Serialize, UnknownFunction) {
+    char buffer[64] = {};
+    ur_function_t function = UR_FUNCTION_FORCE_UINT32;
+    EXPECT_EQ(ur::extras::getSerializedFunctionParamsSize(function), 0u);
+    EXPECT_EQ(ur::extras::serializeFunctionParams(function, buffer, buffer,
+                                                  sizeof(buffer)),
+              UR_RESULT_ERROR_INVALID_ENUMERATION);
+}
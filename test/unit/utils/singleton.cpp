@@ -0,0 +1,152 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ur_singleton.hpp"
+
+namespace {
+struct fake_handle_t_;
+using fake_handle_t = fake_handle_t_ *;
+
+struct fake_object_t {
+    fake_object_t(fake_handle_t handle, int value)
+        : handle(handle), value(value) {}
+
+    fake_handle_t handle;
+    int value;
+};
+
+using fake_factory_t = singleton_factory_t<fake_object_t, fake_handle_t>;
+
+fake_handle_t makeHandle(uintptr_t i) {
+    // mimic adapter handles, which are aligned heap pointers
+    return reinterpret_cast<fake_handle_t>((i + 1) * 64);
+}
+
+/// exposes the map nodes of the shards
+struct inspected_factory_t : fake_factory_t {
+    const void *nodeOf(fake_handle_t handle) {
+        auto key = getKey(handle);
+        return &*getShard(key).map.find(key);
+    }
+    size_t freeNodes(fake_handle_t handle) {
+        return getShard(getKey(handle)).free_nodes.size();
+    }
+};
+} // namespace
+
+TEST(singletonFactory, sameKeyReturnsSameInstance) {
+    fake_factory_t factory;
+    auto first = factory.getInstance(makeHandle(0), 1);
+    auto second = factory.getInstance(makeHandle(0), 2);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first->value, 1);
+
+    auto other = factory.getInstance(makeHandle(1), 3);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(other->value, 3);
+}
+
+TEST(singletonFactory, nullKeyIsRejected) {
+    fake_factory_t factory;
+    EXPECT_EQ(factory.getInstance(fake_handle_t{nullptr}, 0), nullptr);
+}
+
+TEST(singletonFactory, releaseDropsInstance) {
+    fake_factory_t factory;
+    factory.getInstance(makeHandle(0), 1);
+    factory.release(makeHandle(0));
+    EXPECT_EQ(factory.getInstance(makeHandle(0), 2)->value, 2);
+
+    factory.clear();
+    EXPECT_EQ(factory.getInstance(makeHandle(0), 3)->value, 3);
+}
+
+TEST(singletonFactory, instancesAreDestroyed) {
+    struct counted_t {
+        counted_t(fake_handle_t, int *live) : live(live) { (*live)++; }
+        ~counted_t() { (*live)--; }
+        int *live;
+    };
+
+    int live = 0;
+    {
+        singleton_factory_t<counted_t, fake_handle_t> factory;
+        // more instances than fit in a single arena slab
+        for (uintptr_t i = 0; i < 1000; ++i) {
+            factory.getInstance(makeHandle(i), &live);
+        }
+        EXPECT_EQ(live, 1000);
+
+        for (uintptr_t i = 0; i < 500; ++i) {
+            factory.release(makeHandle(i));
+        }
+        EXPECT_EQ(live, 500);
+
+        // released slots are recycled
+        for (uintptr_t i = 0; i < 500; ++i) {
+            factory.getInstance(makeHandle(i), &live);
+        }
+        EXPECT_EQ(live, 1000);
+    }
+    EXPECT_EQ(live, 0);
+}
+
+TEST(singletonFactory, releasedNodesAreReused) {
+    inspected_factory_t factory;
+    auto handle = makeHandle(0);
+    factory.getInstance(handle, 1);
+    const void *node = factory.nodeOf(handle);
+
+    factory.release(handle);
+    EXPECT_EQ(factory.freeNodes(handle), 1);
+    // would likely take the node's memory had it been freed
+    auto other = std::make_unique<std::pair<const size_t, fake_object_t *>>(
+        0, nullptr);
+
+    factory.getInstance(handle, 2);
+    EXPECT_EQ(factory.freeNodes(handle), 0);
+    EXPECT_EQ(factory.nodeOf(handle), node);
+}
+
+// Creates, looks up and releases handles from many threads at once, every
+// thread must observe its own objects. ur_microbench measures the cost of the
+// calls.
+TEST(singletonFactory, concurrentCreateGetRelease) {
+    constexpr size_t handlesPerThread = 4096;
+    const size_t numThreads =
+        std::max<size_t>(4, std::thread::hardware_concurrency());
+
+    fake_factory_t factory;
+    std::atomic<size_t> failures = 0;
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t] {
+            for (size_t i = 0; i < handlesPerThread; ++i) {
+                auto handle = makeHandle(t * handlesPerThread + i);
+                auto created = factory.getInstance(handle, int(t));
+                auto found = factory.getInstance(handle, -1);
+                if (created != found || found->value != int(t)) {
+                    failures++;
+                }
+                factory.release(handle);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0);
+}
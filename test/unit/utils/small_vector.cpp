@@ -0,0 +1,43 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numeric>
+
+#include "ur_small_vector.hpp"
+
+TEST(smallVector, inlineStorage) {
+    small_vector_t<int, 4> vec(3);
+    ASSERT_EQ(vec.size(), 3);
+    std::iota(vec.begin(), vec.end(), 0);
+    EXPECT_EQ(vec[0], 0);
+    EXPECT_EQ(vec[2], 2);
+    // the data lives inside the object itself
+    auto addr = reinterpret_cast<uintptr_t>(vec.data());
+    auto self = reinterpret_cast<uintptr_t>(&vec);
+    EXPECT_GE(addr, self);
+    EXPECT_LT(addr, self + sizeof(vec));
+}
+
+TEST(smallVector, heapStorage) {
+    small_vector_t<int, 4> vec(100);
+    ASSERT_EQ(vec.size(), 100);
+    std::iota(vec.begin(), vec.end(), 0);
+    EXPECT_EQ(std::accumulate(vec.begin(), vec.end(), 0), 4950);
+    auto addr = reinterpret_cast<uintptr_t>(vec.data());
+    auto self = reinterpret_cast<uintptr_t>(&vec);
+    EXPECT_TRUE(addr < self || addr >= self + sizeof(vec));
+}
+
+TEST(smallVector, empty) {
+    small_vector_t<void *> vec(0);
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.begin(), vec.end());
+    // translated empty handle lists must reach the adapters as nullptr
+    EXPECT_EQ(vec.data(), nullptr);
+    const auto &cvec = vec;
+    EXPECT_EQ(cvec.data(), nullptr);
+}
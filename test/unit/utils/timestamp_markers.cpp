@@ -0,0 +1,60 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_timestamp_markers.hpp"
+
+TEST(timestampMarkers, numbersMarkersOverTheRing) {
+    ur::timestamp_markers_t markers(4);
+    for (uint64_t i = 0; i < 10; i++) {
+        EXPECT_EQ(markers.push(), i);
+        EXPECT_EQ(markers.slot(i), i % 4);
+    }
+    EXPECT_EQ(markers.enqueued(), 10);
+}
+
+TEST(timestampMarkers, checksEnqueuedRange) {
+    ur::timestamp_markers_t markers(4);
+    EXPECT_EQ(markers.checkRange(0, 1), UR_RESULT_ERROR_INVALID_VALUE);
+
+    markers.push();
+    markers.push();
+    EXPECT_EQ(markers.checkRange(0, 2), UR_RESULT_SUCCESS);
+    EXPECT_EQ(markers.checkRange(1, 1), UR_RESULT_SUCCESS);
+    EXPECT_EQ(markers.checkRange(1, 2), UR_RESULT_ERROR_INVALID_VALUE);
+    EXPECT_EQ(markers.checkRange(3, 0), UR_RESULT_ERROR_INVALID_VALUE);
+    EXPECT_EQ(markers.checkRange(UINT64_MAX, 2),
+              UR_RESULT_ERROR_INVALID_VALUE);
+}
+
+TEST(timestampMarkers, overwrittenMarkersAreNotReadable) {
+    ur::timestamp_markers_t markers(4);
+    for (int i = 0; i < 6; i++) {
+        markers.push();
+    }
+    // markers 0 and 1 were overwritten by 4 and 5
+    EXPECT_EQ(markers.checkRange(0, 1), UR_RESULT_ERROR_INVALID_VALUE);
+    EXPECT_EQ(markers.checkRange(1, 4), UR_RESULT_ERROR_INVALID_VALUE);
+    EXPECT_EQ(markers.checkRange(2, 4), UR_RESULT_SUCCESS);
+    EXPECT_EQ(markers.checkRange(5, 1), UR_RESULT_SUCCESS);
+}
+
+TEST(timestampMarkers, tracksWrittenMarkers) {
+    ur::timestamp_markers_t markers(8);
+    markers.push();
+    markers.push();
+    EXPECT_TRUE(markers.written(0));
+    EXPECT_FALSE(markers.written(1));
+
+    markers.markWritten(markers.enqueued());
+    EXPECT_TRUE(markers.written(2));
+    markers.push();
+    EXPECT_FALSE(markers.written(3));
+
+    // an older wait doesn't move it back
+    markers.markWritten(1);
+    EXPECT_TRUE(markers.written(2));
+}
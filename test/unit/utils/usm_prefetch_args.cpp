@@ -0,0 +1,76 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "ur_usm_prefetch_args.hpp"
+
+namespace {
+using prefetches_t = std::vector<std::pair<const void *, size_t>>;
+
+prefetches_t prefetches(const ur::usm_prefetch_args_t &args) {
+    prefetches_t result;
+    auto status = args.forEachAllocation([&](const void *base, size_t size) {
+        result.emplace_back(base, size);
+        return UR_RESULT_SUCCESS;
+    });
+    EXPECT_EQ(status, UR_RESULT_SUCCESS);
+    return result;
+}
+
+char allocations[2][64];
+} // namespace
+
+TEST(UsmPrefetchArgs, Empty) {
+    ur::usm_prefetch_args_t args;
+    ASSERT_TRUE(args.empty());
+    args.clear(0);
+    ASSERT_TRUE(args.empty());
+    ASSERT_TRUE(prefetches(args).empty());
+}
+
+TEST(UsmPrefetchArgs, PrefetchesEachAllocationOnce) {
+    ur::usm_prefetch_args_t args;
+    args.set(0, allocations[0], 64);
+    args.set(1, allocations[1], 64);
+    args.set(2, allocations[0], 64);
+    ASSERT_FALSE(args.empty());
+    ASSERT_EQ(prefetches(args),
+              (prefetches_t{{allocations[0], 64}, {allocations[1], 64}}));
+}
+
+TEST(UsmPrefetchArgs, SettingAnArgumentReplacesIt) {
+    ur::usm_prefetch_args_t args;
+    args.set(0, allocations[0], 64);
+    args.set(0, allocations[1], 64);
+    ASSERT_EQ(prefetches(args), (prefetches_t{{allocations[1], 64}}));
+
+    args.clear(0);
+    ASSERT_TRUE(args.empty());
+}
+
+TEST(UsmPrefetchArgs, ClearingKeepsOtherArgumentsAllocation) {
+    ur::usm_prefetch_args_t args;
+    args.set(0, allocations[0], 64);
+    args.set(1, allocations[0], 64);
+    args.clear(0);
+    ASSERT_EQ(prefetches(args), (prefetches_t{{allocations[0], 64}}));
+}
+
+TEST(UsmPrefetchArgs, StopsAtTheFirstError) {
+    ur::usm_prefetch_args_t args;
+    args.set(0, allocations[0], 64);
+    args.set(1, allocations[1], 64);
+    size_t calls = 0;
+    auto status = args.forEachAllocation([&](const void *, size_t) {
+        calls++;
+        return UR_RESULT_ERROR_INVALID_VALUE;
+    });
+    ASSERT_EQ(status, UR_RESULT_ERROR_INVALID_VALUE);
+    ASSERT_EQ(calls, 1u);
+}
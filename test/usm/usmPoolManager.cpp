@@ -7,6 +7,9 @@
 
 #include <uur/fixtures.h>
 
+#include <atomic>
+#include <thread>
+
 struct urUsmPoolDescriptorTest
     : public uur::urMultiDeviceContextTest,
       ::testing::WithParamInterface<ur_usm_pool_handle_t> {};
@@ -115,4 +118,56 @@ TEST_P(urUsmPoolManagerTest, poolManagerGetNonexistant) {
     }
 }
 
+TEST_P(urUsmPoolManagerTest, poolManagerGetCustomDescriptor) {
+    auto [ret, manager] = usm::pool_manager<usm::pool_descriptor>::create();
+    ASSERT_EQ(ret, UR_RESULT_SUCCESS);
+
+    for (auto &desc : poolDescriptors) {
+        ret = manager.addPool(desc, createMockPoolHandle());
+        ASSERT_EQ(ret, UR_RESULT_SUCCESS);
+    }
+
+    // A shared read-only descriptor with a different pool handle has no pool,
+    // even though there is one for the same device and type
+    auto desc = poolDescriptors.back();
+    ASSERT_TRUE(manager.getPool(desc).has_value());
+    desc.poolHandle = reinterpret_cast<ur_usm_pool_handle_t>(0x1);
+    ASSERT_FALSE(manager.getPool(desc).has_value());
+}
+
+// Lookups don't take a lock, threads looking up pools at the same time get
+// the pool of each descriptor.
+TEST_P(urUsmPoolManagerTest, poolManagerGetPoolConcurrently) {
+    constexpr size_t NumThreads = 4;
+    constexpr size_t NumLookups = 10000;
+
+    auto [ret, manager] = usm::pool_manager<usm::pool_descriptor>::create();
+    ASSERT_EQ(ret, UR_RESULT_SUCCESS);
+    std::vector<umf_memory_pool_handle_t> expectedPools;
+    for (auto &desc : poolDescriptors) {
+        auto poolUnique = createMockPoolHandle();
+        expectedPools.push_back(poolUnique.get());
+        ret = manager.addPool(desc, std::move(poolUnique));
+        ASSERT_EQ(ret, UR_RESULT_SUCCESS);
+    }
+
+    std::atomic<size_t> found = 0;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < NumThreads; t++) {
+        threads.emplace_back([&, t]() {
+            size_t localFound = 0;
+            for (size_t i = 0; i < NumLookups; i++) {
+                size_t index = (i + t) % poolDescriptors.size();
+                auto pool = manager.getPool(poolDescriptors[index]);
+                localFound += pool.value_or(nullptr) == expectedPools[index];
+            }
+            found += localFound;
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(found, NumThreads * NumLookups);
+}
+
 UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urUsmPoolManagerTest);
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file decoder.cpp
+ *
+ * This file contains the decoder for ring files written by the flight recorder
+ * logger sink (UR_LOG_*="output:flight,<file>"). It prints the recorded
+ * messages oldest first, also when the process that wrote them crashed.
+ */
+
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+#include "logger/ur_flight_recorder.hpp"
+
+static void usage(const char *prog) {
+    std::cerr << "usage: " << prog << " [--no-timestamps] <flight file>\n";
+}
+
+int main(int argc, const char **argv) {
+    bool timestamps = true;
+    const char *path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--no-timestamps") {
+            timestamps = false;
+        } else if (arg == "-h" || arg == "--help") {
+            usage(argv[0]);
+            return 0;
+        } else if (arg[0] == '-' || path) {
+            usage(argv[0]);
+            return 1;
+        } else {
+            path = argv[i];
+        }
+    }
+    if (!path) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<logger::flight::decoded_record_t> records;
+    try {
+        records = logger::flight::read_file(path);
+    } catch (const std::invalid_argument &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
+    for (auto &record : records) {
+        if (timestamps) {
+            std::cout << "[" << record.timestamp / 1000000000 << "."
+                      << std::setw(9) << std::setfill('0')
+                      << record.timestamp % 1000000000 << "] ";
+        }
+        std::cout << "[" << std::hex << record.thread << std::dec << "] "
+                  << record.text;
+        if (record.truncated) {
+            std::cout << "...";
+        }
+        if (record.text.empty() || record.text.back() != '\n') {
+            std::cout << "\n";
+        }
+    }
+
+    return 0;
+}
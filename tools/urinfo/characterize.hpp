@@ -0,0 +1,177 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <chrono>
+#include <cstring>
+#include <ur_api.h>
+#include <ur_device_profile.hpp>
+#include <vector>
+
+namespace urinfo {
+// Measures the values of the profile of a device for --characterize, the
+// values which can't be measured, e.g. without USM, are left at 0
+class characterizer_t {
+  public:
+    characterizer_t(ur_device_handle_t device) : device(device) {}
+
+    ~characterizer_t() {
+        if (queue) {
+            urQueueRelease(queue);
+        }
+        if (context) {
+            urContextRelease(context);
+        }
+    }
+
+    ur::device_profile_t run() {
+        ur::device_profile_t profile;
+        if (urContextCreate(1, &device, nullptr, &context) ||
+            urQueueCreate(context, device, nullptr, &queue)) {
+            return profile;
+        }
+        profile.LaunchLatencyUs = launchLatencyUs();
+        profile.HostCopyGBps = hostCopyGBps();
+
+        void *host = nullptr;
+        void *dev = nullptr;
+        void *dev2 = nullptr;
+        if (urUSMHostAlloc(context, nullptr, nullptr, transferSize, &host) ==
+                UR_RESULT_SUCCESS &&
+            urUSMDeviceAlloc(context, device, nullptr, nullptr, transferSize,
+                             &dev) == UR_RESULT_SUCCESS &&
+            urUSMDeviceAlloc(context, device, nullptr, nullptr, transferSize,
+                             &dev2) == UR_RESULT_SUCCESS) {
+            std::memset(host, 1, transferSize);
+            profile.FillGBps = fillGBps(dev);
+            profile.HostToDeviceGBps = copyGBps(dev, host);
+            profile.DeviceToHostGBps = copyGBps(host, dev);
+            profile.DeviceToDeviceGBps = copyGBps(dev2, dev);
+            profile.AllocLatencyUs = allocLatencyUs();
+        }
+        for (void *ptr : {host, dev, dev2}) {
+            if (ptr) {
+                urUSMFree(context, ptr);
+            }
+        }
+        return profile;
+    }
+
+  private:
+    // Large enough for the bandwidth to dominate the submissions
+    static constexpr size_t transferSize = 64 * 1024 * 1024;
+    static constexpr int latencyIterations = 100;
+    static constexpr int transferIterations = 8;
+
+    using clock = std::chrono::steady_clock;
+
+    static double elapsedUs(clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(clock::now() - start)
+            .count();
+    }
+
+    // The GB/s of transferring transferSize bytes in each iteration, 1 GB/s
+    // being 1000 bytes per microsecond
+    static double gbps(double us, int iterations) {
+        return us > 0 ? transferSize * double(iterations) / us / 1000 : 0;
+    }
+
+    // The commands come without kernels, the latency of a submission is
+    // measured with an event wait, which the adapters submit like any other
+    // command
+    double launchLatencyUs() {
+        double total = 0;
+        // The first iteration warms the queue up
+        for (int i = 0; i <= latencyIterations; i++) {
+            ur_event_handle_t event = nullptr;
+            auto start = clock::now();
+            if (urEnqueueEventsWait(queue, 0, nullptr, &event) ||
+                urEventWait(1, &event)) {
+                if (event) {
+                    urEventRelease(event);
+                }
+                return 0;
+            }
+            double us = elapsedUs(start);
+            urEventRelease(event);
+            if (i) {
+                total += us;
+            }
+        }
+        return total / latencyIterations;
+    }
+
+    double hostCopyGBps() {
+        std::vector<char> src(transferSize, 1);
+        std::vector<char> dst(transferSize);
+        std::memcpy(dst.data(), src.data(), transferSize);
+        auto start = clock::now();
+        for (int i = 0; i < transferIterations; i++) {
+            std::memcpy(dst.data(), src.data(), transferSize);
+        }
+        return gbps(elapsedUs(start), transferIterations);
+    }
+
+    double copyGBps(void *dst, const void *src) {
+        if (urEnqueueUSMMemcpy(queue, true, dst, src, transferSize, 0, nullptr,
+                               nullptr)) {
+            return 0;
+        }
+        auto start = clock::now();
+        for (int i = 0; i < transferIterations; i++) {
+            if (urEnqueueUSMMemcpy(queue, false, dst, src, transferSize, 0,
+                                   nullptr, nullptr)) {
+                return 0;
+            }
+        }
+        if (urQueueFinish(queue)) {
+            return 0;
+        }
+        return gbps(elapsedUs(start), transferIterations);
+    }
+
+    double fillGBps(void *dst) {
+        const uint32_t pattern = 0;
+        auto fill = [&]() {
+            return urEnqueueUSMFill(queue, dst, sizeof(pattern), &pattern,
+                                    transferSize, 0, nullptr, nullptr);
+        };
+        if (fill() || urQueueFinish(queue)) {
+            return 0;
+        }
+        auto start = clock::now();
+        for (int i = 0; i < transferIterations; i++) {
+            if (fill()) {
+                return 0;
+            }
+        }
+        if (urQueueFinish(queue)) {
+            return 0;
+        }
+        return gbps(elapsedUs(start), transferIterations);
+    }
+
+    // Of an allocation smaller than the chunks of the pools of the adapters,
+    // as the allocations of the applications usually are
+    double allocLatencyUs() {
+        constexpr size_t allocSize = 4096;
+        auto start = clock::now();
+        for (int i = 0; i < latencyIterations; i++) {
+            void *ptr = nullptr;
+            if (urUSMDeviceAlloc(context, device, nullptr, nullptr, allocSize,
+                                 &ptr) ||
+                urUSMFree(context, ptr)) {
+                return 0;
+            }
+        }
+        return elapsedUs(start) / latencyIterations;
+    }
+
+    ur_device_handle_t device;
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+};
+} // namespace urinfo
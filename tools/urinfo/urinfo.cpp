@@ -4,24 +4,44 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include "urinfo.hpp"
+#include "characterize.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 namespace urinfo {
+// The infos of a device, queried by one of the jobs
+struct device_infos_t {
+    std::string type;
+    std::string name;
+    std::string version;
+    std::string driverVersion;
+    // The output of printDeviceInfos, with --verbose
+    std::string infos;
+};
+
 struct app {
     bool verbose = false;
     bool linear_ids = true;
     bool ignore_device_selector = false;
+    bool json = false;
+    bool characterize = false;
+    // The number of devices queried at once, 0 for all of them
+    size_t jobs = 0;
     ur_loader_config_handle_t loaderConfig = nullptr;
     std::vector<ur_adapter_handle_t> adapters;
     std::unordered_map<ur_adapter_handle_t, std::vector<ur_platform_handle_t>>
         adapterPlatformsMap;
     std::unordered_map<ur_platform_handle_t, std::vector<ur_device_handle_t>>
         platformDevicesMap;
+    std::unordered_map<ur_device_handle_t, device_infos_t> deviceInfosMap;
 
     app(int argc, const char **argv) {
         parseArgs(argc, argv);
@@ -40,10 +60,12 @@ struct app {
                                            "UR_LAYER_FULL_VALIDATION"));
         UR_CHECK(urLoaderInit(0, loaderConfig));
         enumerateDevices();
+        queryDevices();
     }
 
     void parseArgs(int argc, const char **argv) {
-        static const char *usage = R"(usage: %s [-h] [-v] [-V]
+        static const char *usage =
+            R"(usage: %s [-h] [-v] [-V] [--json] [-j N] [--characterize]
 
 This tool enumerates Unified Runtime layers, adapters, platforms, and
 devices which are currently visible in the local execution environment.
@@ -56,6 +78,13 @@ options:
   --ignore-device-selector
                         do not use ONEAPI_DEVICE_SELECTOR to filter list of
                         devices
+  --json                print the devices, and their infos with --verbose,
+                        as JSON
+  -j N, --jobs N        number of devices queried at once, all of them by
+                        default, 1 queries them one after the other
+  --characterize        measure the latencies and bandwidths of the devices
+                        and write their profiles to UR_DEVICE_PROFILE_DIR,
+                        which the adapters load to tune their thresholds
 )";
         for (int argi = 1; argi < argc; argi++) {
             std::string_view arg{argv[argi]};
@@ -71,6 +100,12 @@ options:
                 linear_ids = false;
             } else if (arg == "--ignore-device-selector") {
                 ignore_device_selector = true;
+            } else if (arg == "--json") {
+                json = true;
+            } else if (arg == "--characterize") {
+                characterize = true;
+            } else if ((arg == "-j" || arg == "--jobs") && argi + 1 < argc) {
+                jobs = std::strtoull(argv[++argi], nullptr, 10);
             } else {
                 std::fprintf(stderr, "error: invalid argument: %s\n",
                              argv[argi]);
@@ -125,6 +160,52 @@ options:
         }
     }
 
+    void queryDevice(ur_device_handle_t device, device_infos_t &infos) {
+        infos.type = urinfo::getDeviceType(device);
+        infos.name = urinfo::getDeviceName(device);
+        infos.version = urinfo::getDeviceVersion(device);
+        infos.driverVersion = urinfo::getDeviceDriverVersion(device);
+        if (verbose) {
+            std::stringstream stream;
+            printer_t printer{stream, json,
+                              json ? "                " : "      "};
+            urinfo::printDeviceInfos(printer, device);
+            infos.infos = stream.str();
+        }
+    }
+
+    // Queries the devices with the jobs, as most of the time with many
+    // devices is spent waiting for their drivers, the output is printed in
+    // the order of the devices afterwards
+    void queryDevices() {
+        std::vector<ur_device_handle_t> devices;
+        for (auto &[platform, platformDevices] : platformDevicesMap) {
+            for (auto device : platformDevices) {
+                devices.push_back(device);
+                deviceInfosMap[device];
+            }
+        }
+        size_t numThreads =
+            jobs ? std::min(jobs, devices.size()) : devices.size();
+        std::atomic<size_t> next = 0;
+        auto query = [&]() {
+            for (size_t i = next++; i < devices.size(); i = next++) {
+                queryDevice(devices[i], deviceInfosMap.at(devices[i]));
+            }
+        };
+        if (numThreads <= 1) {
+            query();
+            return;
+        }
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < numThreads; i++) {
+            threads.emplace_back(query);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+
     void printSummary() {
         for (size_t adapterIndex = 0; adapterIndex < adapters.size();
              adapterIndex++) {
@@ -138,8 +219,8 @@ options:
                 auto &devices = platformDevicesMap[platform];
                 for (size_t deviceIndex = 0; deviceIndex < devices.size();
                      deviceIndex++) {
-                    auto device = devices[deviceIndex];
-                    auto device_type = urinfo::getDeviceType(device);
+                    auto &infos = deviceInfosMap.at(devices[deviceIndex]);
+                    auto &device_type = infos.type;
 
                     if (linear_ids) {
                         std::cout << "[" << adapter_backend << ":"
@@ -155,10 +236,8 @@ options:
                     }
 
                     std::cout << " " << urinfo::getPlatformName(platform)
-                              << ", " << urinfo::getDeviceName(device) << " "
-                              << urinfo::getDeviceVersion(device) << " "
-                              << "[" << urinfo::getDeviceDriverVersion(device)
-                              << "]\n";
+                              << ", " << infos.name << " " << infos.version
+                              << " [" << infos.driverVersion << "]\n";
 
                     adapter_device_id++;
                 }
@@ -170,7 +249,8 @@ options:
         std::cout << "\n"
                   << "[loader]:"
                   << "\n";
-        urinfo::printLoaderConfigInfos(loaderConfig);
+        printer_t loaderPrinter{std::cout, false, "  "};
+        urinfo::printLoaderConfigInfos(loaderPrinter, loaderConfig);
 
         for (size_t adapterIndex = 0; adapterIndex < adapters.size();
              adapterIndex++) {
@@ -178,7 +258,8 @@ options:
             std::cout << "\n"
                       << "[adapter(" << adapterIndex << ")]:"
                       << "\n";
-            urinfo::printAdapterInfos(adapter);
+            printer_t adapterPrinter{std::cout, false, "  "};
+            urinfo::printAdapterInfos(adapterPrinter, adapter);
 
             size_t numPlatforms = adapterPlatformsMap[adapter].size();
             for (size_t platformIndex = 0; platformIndex < numPlatforms;
@@ -188,7 +269,8 @@ options:
                           << "[adapter(" << adapterIndex << "),"
                           << "platform(" << platformIndex << ")]:"
                           << "\n";
-                urinfo::printPlatformInfos(platform);
+                printer_t platformPrinter{std::cout, false, "    "};
+                urinfo::printPlatformInfos(platformPrinter, platform);
 
                 size_t numDevices = platformDevicesMap[platform].size();
                 for (size_t deviceI = 0; deviceI < numDevices; deviceI++) {
@@ -198,10 +280,135 @@ options:
                               << "platform(" << platformIndex << "),"
                               << "device(" << deviceI << ")]:"
                               << "\n";
-                    urinfo::printDeviceInfos(device);
+                    std::cout << deviceInfosMap.at(device).infos;
+                }
+            }
+        }
+    }
+
+    // The members of an object, at the indent of printer, an object of the
+    // infos of the printer of its members when verbose
+    void printJsonInfos(printer_t &printer, const std::string &infos) {
+        if (verbose) {
+            printer.print("infos",
+                          "{" + infos + "\n" + std::string(printer.prefix) +
+                              "}",
+                          true);
+        }
+    }
+
+    void printJson() {
+        std::cout << "{";
+        printer_t printer{std::cout, true, "  "};
+        if (verbose) {
+            std::stringstream stream;
+            printer_t loaderPrinter{stream, true, "    "};
+            urinfo::printLoaderConfigInfos(loaderPrinter, loaderConfig);
+            printer.print("loader", "{" + stream.str() + "\n  }", true);
+        }
+        std::stringstream adaptersStream;
+        for (size_t adapterIndex = 0; adapterIndex < adapters.size();
+             adapterIndex++) {
+            auto adapter = adapters[adapterIndex];
+            adaptersStream << (adapterIndex ? "," : "") << "\n    {";
+            printer_t adapterPrinter{adaptersStream, true, "      "};
+            adapterPrinter.print("backend", urinfo::getAdapterBackend(adapter));
+            std::stringstream adapterInfos;
+            if (verbose) {
+                printer_t infosPrinter{adapterInfos, true, "        "};
+                urinfo::printAdapterInfos(infosPrinter, adapter);
+            }
+            printJsonInfos(adapterPrinter, adapterInfos.str());
+
+            std::stringstream platformsStream;
+            auto &platforms = adapterPlatformsMap[adapter];
+            for (size_t platformIndex = 0; platformIndex < platforms.size();
+                 platformIndex++) {
+                auto platform = platforms[platformIndex];
+                platformsStream << (platformIndex ? "," : "")
+                                << "\n        {";
+                printer_t platformPrinter{platformsStream, true,
+                                          "          "};
+                platformPrinter.print("name",
+                                      urinfo::getPlatformName(platform));
+                std::stringstream platformInfos;
+                if (verbose) {
+                    printer_t infosPrinter{platformInfos, true,
+                                           "            "};
+                    urinfo::printPlatformInfos(infosPrinter, platform);
                 }
+                printJsonInfos(platformPrinter, platformInfos.str());
+
+                std::stringstream devicesStream;
+                auto &devices = platformDevicesMap[platform];
+                for (size_t deviceIndex = 0; deviceIndex < devices.size();
+                     deviceIndex++) {
+                    auto &infos = deviceInfosMap.at(devices[deviceIndex]);
+                    devicesStream << (deviceIndex ? "," : "")
+                                  << "\n            {";
+                    printer_t devicePrinter{devicesStream, true,
+                                            "              "};
+                    devicePrinter.print("type", infos.type);
+                    devicePrinter.print("name", infos.name);
+                    devicePrinter.print("version", infos.version);
+                    devicePrinter.print("driver_version", infos.driverVersion);
+                    printJsonInfos(devicePrinter, infos.infos);
+                    devicesStream << "\n            }";
+                }
+                platformPrinter.print("devices",
+                                      "[" + devicesStream.str() +
+                                          "\n          ]",
+                                      true);
+                platformsStream << "\n        }";
             }
+            adapterPrinter.print("platforms",
+                                 "[" + platformsStream.str() + "\n      ]",
+                                 true);
+            adaptersStream << "\n    }";
         }
+        printer.print("adapters", "[" + adaptersStream.str() + "\n  ]", true);
+        std::cout << "\n}\n";
+    }
+
+    // Measures the devices one after the other, so that they don't share the
+    // bandwidth of the host, and writes their profiles
+    int characterizeDevices() {
+        auto dir = ur::deviceProfileDir();
+        if (!dir) {
+            std::fprintf(stderr, "error: --characterize needs the "
+                                 "UR_DEVICE_PROFILE_DIR environment "
+                                 "variable\n");
+            return 1;
+        }
+        for (auto adapter : adapters) {
+            ur_adapter_backend_t backend;
+            UR_CHECK(urAdapterGetInfo(adapter, UR_ADAPTER_INFO_BACKEND,
+                                      sizeof(backend), &backend, nullptr));
+            for (auto platform : adapterPlatformsMap[adapter]) {
+                for (auto device : platformDevicesMap[platform]) {
+                    auto &infos = deviceInfosMap.at(device);
+                    auto name =
+                        ur::deviceProfileName(backend, device, urDeviceGetInfo);
+                    if (name.empty()) {
+                        std::fprintf(stderr,
+                                     "warning: can't query the IDs of %s\n",
+                                     infos.name.c_str());
+                        continue;
+                    }
+                    auto profile = characterizer_t{device}.run();
+                    std::cout << "[" << infos.name << "]\n"
+                              << profile.serialize();
+                    if (!ur::storeDeviceProfile(name, profile)) {
+                        std::fprintf(stderr, "error: can't write %s\n",
+                                     (*dir / name).string().c_str());
+                        return 1;
+                    }
+                    std::cout << "written to " << (*dir / name).string()
+                              << "\n\n";
+                }
+            }
+        }
+        return 0;
     }
 
     ~app() {
@@ -213,6 +420,13 @@ options:
 
 int main(int argc, const char **argv) {
     auto app = urinfo::app{argc, argv};
+    if (app.characterize) {
+        return app.characterizeDevices();
+    }
+    if (app.json) {
+        app.printJson();
+        return 0;
+    }
     app.printSummary();
     if (app.verbose) {
         app.printDetail();
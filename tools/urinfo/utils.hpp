@@ -8,11 +8,13 @@
 #include "ur_api.h"
 #include "ur_print.hpp"
 #include <algorithm>
+#include <cstdio>
 #include <cstdlib>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -23,14 +25,85 @@
     }                                                                          \
     (void)0
 
-#define UR_CHECK_WEAK(ACTION)                                                  \
+#define UR_CHECK_WEAK(PRINTER, NAME, ACTION)                                   \
     if (auto error = ACTION) {                                                 \
-        std::cout << error << "\n";                                            \
+        PRINTER.error(NAME, error);                                            \
         return;                                                                \
     }                                                                          \
     (void)0
 
 namespace urinfo {
+inline std::string jsonString(std::string_view value) {
+    std::string str = "\"";
+    for (char c : value) {
+        switch (c) {
+        case '"':
+            str += "\\\"";
+            break;
+        case '\\':
+            str += "\\\\";
+            break;
+        case '\n':
+            str += "\\n";
+            break;
+        case '\t':
+            str += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                str += escaped;
+            } else {
+                str += c;
+            }
+        }
+    }
+    return str + "\"";
+}
+
+// Prints the infos of an object as "NAME: value" lines after the prefix, or
+// as the members of a JSON object at the indent of the prefix
+struct printer_t {
+    std::ostream &os;
+    bool json = false;
+    std::string_view prefix;
+    bool first = true;
+
+    // Values which are JSON already, numbers, booleans and arrays of them,
+    // are raw, the others are printed as JSON strings
+    void print(std::string_view name, std::string_view value,
+               bool raw = false) {
+        if (!json) {
+            os << prefix << name << ": " << value << "\n";
+            return;
+        }
+        os << (first ? "" : ",") << "\n"
+           << prefix << jsonString(name) << ": "
+           << (raw ? std::string(value) : jsonString(value));
+        first = false;
+    }
+
+    void error(std::string_view name, ur_result_t result) {
+        std::stringstream stream;
+        stream << result;
+        if (json) {
+            print(name, "{\"error\": " + jsonString(stream.str()) + "}", true);
+        } else {
+            print(name, stream.str());
+        }
+    }
+};
+
+// Prints value, raw in JSON if it's a number
+template <class T>
+inline void printValue(printer_t &printer, std::string_view name,
+                       const T &value) {
+    std::stringstream stream;
+    stream << value;
+    printer.print(name, stream.str(), std::is_arithmetic_v<T>);
+}
+
 inline std::string stripPrefix(std::string_view value,
                                std::string_view prefix) {
     if (std::equal(prefix.begin(), prefix.end(), value.begin(),
@@ -121,27 +194,30 @@ inline std::string getLoaderConfigInfoName(ur_loader_config_info_t info) {
 }
 
 template <class T>
-inline void printLoaderConfigInfo(ur_loader_config_handle_t loaderConfig,
+inline void printLoaderConfigInfo(printer_t &printer,
+                                  ur_loader_config_handle_t loaderConfig,
                                   ur_loader_config_info_t info) {
-    std::cout << getLoaderConfigInfoName(info) << ": ";
     T value;
     UR_CHECK(urLoaderConfigGetInfo(
         loaderConfig, info, sizeof(ur_adapter_backend_t), &value, nullptr));
-    std::cout << value << "\n";
+    printValue(printer, getLoaderConfigInfoName(info), value);
 }
 
 template <>
 inline void
-printLoaderConfigInfo<char[]>(ur_loader_config_handle_t loaderConfig,
+printLoaderConfigInfo<char[]>(printer_t &printer,
+                              ur_loader_config_handle_t loaderConfig,
                               ur_loader_config_info_t info) {
-    std::cout << getLoaderConfigInfoName(info) << ": ";
+    auto name = getLoaderConfigInfoName(info);
     size_t size = 0;
-    UR_CHECK_WEAK(urLoaderConfigGetInfo(loaderConfig, info, 0, nullptr, &size));
+    UR_CHECK_WEAK(printer, name,
+                  urLoaderConfigGetInfo(loaderConfig, info, 0, nullptr, &size));
     std::string str(size, '\0');
     UR_CHECK_WEAK(
+        printer, name,
         urLoaderConfigGetInfo(loaderConfig, info, size, str.data(), nullptr));
     str.pop_back(); // std::string does not need a terminating NULL, remove it here
-    std::cout << str << "\n";
+    printer.print(name, str);
 }
 
 inline std::string getAdapterInfoName(ur_adapter_info_t info) {
@@ -151,13 +227,12 @@ inline std::string getAdapterInfoName(ur_adapter_info_t info) {
 }
 
 template <class T>
-inline void printAdapterInfo(ur_adapter_handle_t adapter,
+inline void printAdapterInfo(printer_t &printer, ur_adapter_handle_t adapter,
                              ur_adapter_info_t info) {
-    std::cout << getAdapterInfoName(info) << ": ";
     T value;
     UR_CHECK(urAdapterGetInfo(adapter, info, sizeof(ur_adapter_backend_t),
                               &value, nullptr));
-    std::cout << value << "\n";
+    printValue(printer, getAdapterInfoName(info), value);
 }
 
 inline std::string getPlatformInfoName(ur_platform_info_t info) {
@@ -167,25 +242,29 @@ inline std::string getPlatformInfoName(ur_platform_info_t info) {
 }
 
 template <class T>
-inline void printPlatformInfo(ur_platform_handle_t platform,
+inline void printPlatformInfo(printer_t &printer, ur_platform_handle_t platform,
                               ur_platform_info_t info) {
-    std::cout << getPlatformInfoName(info) << ": ";
+    auto name = getPlatformInfoName(info);
     T value;
     UR_CHECK_WEAK(
+        printer, name,
         urPlatformGetInfo(platform, info, sizeof(T), &value, nullptr));
-    std::cout << value << "\n";
+    printValue(printer, name, value);
 }
 
 template <>
-inline void printPlatformInfo<char[]>(ur_platform_handle_t platform,
+inline void printPlatformInfo<char[]>(printer_t &printer,
+                                      ur_platform_handle_t platform,
                                       ur_platform_info_t info) {
-    std::cout << getPlatformInfoName(info) << ": ";
+    auto name = getPlatformInfoName(info);
     size_t size = 0;
-    UR_CHECK_WEAK(urPlatformGetInfo(platform, info, 0, nullptr, &size));
+    UR_CHECK_WEAK(printer, name,
+                  urPlatformGetInfo(platform, info, 0, nullptr, &size));
     std::string str(size, '\0');
-    UR_CHECK_WEAK(urPlatformGetInfo(platform, info, size, str.data(), nullptr));
+    UR_CHECK_WEAK(printer, name,
+                  urPlatformGetInfo(platform, info, size, str.data(), nullptr));
     str.pop_back(); // std::string does not need a terminating NULL, remove it here
-    std::cout << str << "\n";
+    printer.print(name, str);
 }
 
 inline std::string getDeviceInfoName(ur_device_info_t info) {
@@ -196,67 +275,92 @@ inline std::string getDeviceInfoName(ur_device_info_t info) {
 
 template <class T>
 inline std::enable_if_t<!std::is_array_v<T>>
-printDeviceInfo(ur_device_handle_t device, ur_device_info_t info) {
-    std::cout << getDeviceInfoName(info) << ": ";
+printDeviceInfo(printer_t &printer, ur_device_handle_t device,
+                ur_device_info_t info) {
+    auto name = getDeviceInfoName(info);
     T value;
-    UR_CHECK_WEAK(urDeviceGetInfo(device, info, sizeof(T), &value, nullptr));
-    std::cout << value << "\n";
+    UR_CHECK_WEAK(printer, name,
+                  urDeviceGetInfo(device, info, sizeof(T), &value, nullptr));
+    printValue(printer, name, value);
 }
 
 template <>
-inline void printDeviceInfo<ur_bool_t>(ur_device_handle_t device,
+inline void printDeviceInfo<ur_bool_t>(printer_t &printer,
+                                       ur_device_handle_t device,
                                        ur_device_info_t info) {
-    std::cout << getDeviceInfoName(info) << ": ";
+    auto name = getDeviceInfoName(info);
     ur_bool_t value;
     UR_CHECK_WEAK(
+        printer, name,
         urDeviceGetInfo(device, info, sizeof(ur_bool_t), &value, nullptr));
-    std::string result = value ? "true" : "false";
-    std::cout << result << "\n";
+    printer.print(name, value ? "true" : "false", true);
 }
 
 template <class T>
 inline std::enable_if_t<std::is_array_v<T>>
-printDeviceInfo(ur_device_handle_t device, ur_device_info_t info) {
-    std::cout << getDeviceInfoName(info) << ": ";
+printDeviceInfo(printer_t &printer, ur_device_handle_t device,
+                ur_device_info_t info) {
+    auto name = getDeviceInfoName(info);
     using value_t = std::remove_reference_t<decltype(std::declval<T>()[0])>;
     size_t size;
-    UR_CHECK_WEAK(urDeviceGetInfo(device, info, 0, nullptr, &size));
+    UR_CHECK_WEAK(printer, name,
+                  urDeviceGetInfo(device, info, 0, nullptr, &size));
     std::vector<value_t> values(size / sizeof(value_t));
-    UR_CHECK_WEAK(urDeviceGetInfo(device, info, size, values.data(), nullptr));
-    std::cout << "{ ";
+    UR_CHECK_WEAK(
+        printer, name,
+        urDeviceGetInfo(device, info, size, values.data(), nullptr));
+    std::stringstream stream;
+    stream << (printer.json ? "[" : "{ ");
     for (size_t i = 0; i < values.size(); i++) {
         if (i > 0) {
-            std::cout << ", ";
+            stream << ", ";
+        }
+        if (printer.json && !std::is_arithmetic_v<value_t>) {
+            std::stringstream value;
+            value << values[i];
+            stream << jsonString(value.str());
+        } else {
+            stream << values[i];
         }
-        std::cout << values[i];
     }
-    std::cout << " }\n";
+    stream << (printer.json ? "]" : " }");
+    printer.print(name, stream.str(), true);
 }
 
 template <>
-inline void printDeviceInfo<char[]>(ur_device_handle_t device,
+inline void printDeviceInfo<char[]>(printer_t &printer,
+                                    ur_device_handle_t device,
                                     ur_device_info_t info) {
-    std::cout << getDeviceInfoName(info) << ": ";
+    auto name = getDeviceInfoName(info);
     size_t size = 0;
-    UR_CHECK_WEAK(urDeviceGetInfo(device, info, 0, nullptr, &size));
+    UR_CHECK_WEAK(printer, name,
+                  urDeviceGetInfo(device, info, 0, nullptr, &size));
     std::string str(size, 0);
-    UR_CHECK_WEAK(urDeviceGetInfo(device, info, size, str.data(), nullptr));
+    UR_CHECK_WEAK(printer, name,
+                  urDeviceGetInfo(device, info, size, str.data(), nullptr));
     str.pop_back(); // std::string does not need a terminating NULL, remove it here
-    std::cout << str << "\n";
+    printer.print(name, str);
 }
 
-inline void printDeviceUUID(ur_device_handle_t device, ur_device_info_t info) {
-    std::cout << getDeviceInfoName(info) << ": ";
+inline void printDeviceUUID(printer_t &printer, ur_device_handle_t device,
+                            ur_device_info_t info) {
+    auto name = getDeviceInfoName(info);
     size_t size;
-    UR_CHECK_WEAK(urDeviceGetInfo(device, info, 0, nullptr, &size));
+    UR_CHECK_WEAK(printer, name,
+                  urDeviceGetInfo(device, info, 0, nullptr, &size));
     std::vector<uint8_t> values(size / sizeof(uint8_t));
-    UR_CHECK_WEAK(urDeviceGetInfo(device, info, size, values.data(), nullptr));
+    UR_CHECK_WEAK(
+        printer, name,
+        urDeviceGetInfo(device, info, size, values.data(), nullptr));
+    std::string uuid;
     for (size_t i = 0; i < values.size(); i++) {
         if (i == 4 || i == 6 || i == 8 || i == 10) {
-            std::printf("-");
+            uuid += "-";
         }
-        std::printf("%.2x", (uint32_t)values[i]);
+        char hex[3];
+        std::snprintf(hex, sizeof(hex), "%.2x", (uint32_t)values[i]);
+        uuid += hex;
     }
-    std::printf("\n");
+    printer.print(name, uuid);
 }
 } // namespace urinfo
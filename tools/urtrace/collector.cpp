@@ -12,8 +12,12 @@
  * execution time.
  */
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
+#include <iomanip>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -24,6 +28,7 @@
 #include <string>
 #include <string_view>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "logger/ur_logger.hpp"
@@ -96,10 +101,13 @@ std::string time_to_str(std::chrono::nanoseconds dur, enum time_unit unit) {
 enum output_format {
     OUTPUT_HUMAN_READABLE,
     OUTPUT_JSON,
+    OUTPUT_TIMELINE,
+    OUTPUT_TOP,
     MAX_OUTPUT_FORMAT,
 };
 
-const char *output_format_str[MAX_OUTPUT_FORMAT] = {"human readable", "json"};
+const char *output_format_str[MAX_OUTPUT_FORMAT] = {"human readable", "json",
+                                                    "timeline", "top"};
 
 /*
  * Since this is a library that gets loaded alongside the traced program, it
@@ -113,6 +121,9 @@ const char *output_format_str[MAX_OUTPUT_FORMAT] = {"human readable", "json"};
  * - "time_unit:<auto,ns, ...>"
  * - "filter:<regex>"
  * - "json"
+ * - "timeline"
+ * - "top"
+ * - "top_interval:<ms>"
  */
 static class cli_args {
     std::optional<std::string>
@@ -137,12 +148,17 @@ static class cli_args {
         filter = std::nullopt;
         filter_str = std::nullopt;
         output_format = OUTPUT_HUMAN_READABLE;
+        top_interval = std::chrono::milliseconds(1000);
         if (auto args = getenv_to_map(ARGS_ENV, false)) {
             for (auto [arg_name, arg_values] : *args) {
                 if (arg_name == "print_begin") {
                     print_begin = true;
                 } else if (arg_name == "json") {
                     output_format = OUTPUT_JSON;
+                } else if (arg_name == "timeline") {
+                    output_format = OUTPUT_TIMELINE;
+                } else if (arg_name == "top") {
+                    output_format = OUTPUT_TOP;
                 } else if (arg_name == "profiling") {
                     profiling = true;
                 } else if (arg_name == "no_args") {
@@ -155,6 +171,14 @@ static class cli_args {
                             break;
                         }
                     }
+                } else if (auto interval = arg_with_value(
+                               "top_interval", arg_name, arg_values)) {
+                    try {
+                        top_interval = std::chrono::milliseconds(
+                            std::max(1ull, std::stoull(*interval)));
+                    } catch (const std::exception &) {
+                        out.warn("invalid top interval {}", *interval);
+                    }
                 } else if (auto filter_str =
                                arg_with_value("filter", arg_name, arg_values)) {
                     try {
@@ -180,6 +204,7 @@ static class cli_args {
     bool profiling;
     bool no_args;
     enum output_format output_format;
+    std::chrono::milliseconds top_interval;
     std::optional<std::string>
         filter_str; //the filter_str is kept primarily for printing.
     std::optional<std::regex> filter;
@@ -197,6 +222,9 @@ class TraceWriter {
     virtual void end(uint64_t id, const char *fname, std::string args,
                      Timepoint tp, Timepoint start_tp,
                      const ur_result_t *resultp) = 0;
+    /// Called with the unformatted params of every traced call.
+    virtual void params(uint16_t, ur_function_t, const char *, const void *,
+                        const ur_result_t *) {}
 };
 
 class HumanReadable : public TraceWriter {
@@ -270,12 +298,510 @@ class JsonWriter : public TraceWriter {
     }
 };
 
+struct enqueued_command {
+    ur_queue_handle_t queue;
+    ur_event_handle_t event;
+};
+
+template <typename T>
+std::optional<enqueued_command> get_command(const void *args) {
+    auto params = static_cast<const T *>(args);
+    if (*params->pphEvent == nullptr || **params->pphEvent == nullptr) {
+        return std::nullopt;
+    }
+    return enqueued_command{*params->phQueue, **params->pphEvent};
+}
+
+/// Returns the queue and output event of a successful enqueue call.
+std::optional<enqueued_command> get_enqueued_command(ur_function_t function,
+                                                     const void *args) {
+    switch (function) {
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH:
+        return get_command<ur_enqueue_kernel_launch_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT:
+        return get_command<ur_enqueue_events_wait_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER:
+        return get_command<ur_enqueue_events_wait_with_barrier_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ:
+        return get_command<ur_enqueue_mem_buffer_read_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE:
+        return get_command<ur_enqueue_mem_buffer_write_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT:
+        return get_command<ur_enqueue_mem_buffer_read_rect_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT:
+        return get_command<ur_enqueue_mem_buffer_write_rect_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY:
+        return get_command<ur_enqueue_mem_buffer_copy_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT:
+        return get_command<ur_enqueue_mem_buffer_copy_rect_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL:
+        return get_command<ur_enqueue_mem_buffer_fill_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ:
+        return get_command<ur_enqueue_mem_image_read_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE:
+        return get_command<ur_enqueue_mem_image_write_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY:
+        return get_command<ur_enqueue_mem_image_copy_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP:
+        return get_command<ur_enqueue_mem_buffer_map_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_MEM_UNMAP:
+        return get_command<ur_enqueue_mem_unmap_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_USM_FILL:
+        return get_command<ur_enqueue_usm_fill_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY:
+        return get_command<ur_enqueue_usm_memcpy_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_USM_PREFETCH:
+        return get_command<ur_enqueue_usm_prefetch_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_USM_ADVISE:
+        return get_command<ur_enqueue_usm_advise_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_USM_FILL_2D:
+        return get_command<ur_enqueue_usm_fill_2d_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D:
+        return get_command<ur_enqueue_usm_memcpy_2d_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE:
+        return get_command<
+            ur_enqueue_device_global_variable_write_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ:
+        return get_command<
+            ur_enqueue_device_global_variable_read_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_READ_HOST_PIPE:
+        return get_command<ur_enqueue_read_host_pipe_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE:
+        return get_command<ur_enqueue_write_host_pipe_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP:
+        return get_command<ur_enqueue_kernel_launch_custom_exp_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP:
+        return get_command<
+            ur_enqueue_cooperative_kernel_launch_exp_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP:
+        return get_command<ur_enqueue_timestamp_recording_exp_params_t>(args);
+    case UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP:
+        return get_command<ur_enqueue_native_command_exp_params_t>(args);
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP:
+        return get_command<ur_bindless_images_image_copy_exp_params_t>(args);
+    case UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP:
+        return get_command<
+            ur_bindless_images_wait_external_semaphore_exp_params_t>(args);
+    case UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP:
+        return get_command<
+            ur_bindless_images_signal_external_semaphore_exp_params_t>(args);
+    case UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP:
+        return get_command<ur_command_buffer_enqueue_exp_params_t>(args);
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Formats nanoseconds as fractional microseconds, the unit of the Trace Event
+/// Format, without losing precision.
+static std::string ns_to_us_str(int64_t ns) {
+    std::ostringstream ostr;
+    if (ns < 0) {
+        ostr << "-";
+        ns = -ns;
+    }
+    ostr << ns / 1000 << "." << std::setw(3) << std::setfill('0') << ns % 1000;
+    return ostr.str();
+}
+
+/// Set on threads which are calling into UR on behalf of the collector, so
+/// that those calls aren't traced themselves.
+static thread_local bool collector_call = false;
+
+struct collector_call_guard {
+    collector_call_guard() { collector_call = true; }
+    ~collector_call_guard() { collector_call = false; }
+};
+
+/*
+ * Writes the same host call events as JsonWriter, and additionally shows each
+ * enqueued command on a track of its queue, at the device start and end time
+ * reported by urEventGetProfilingInfo. Events returned by enqueue calls are
+ * retained and queried in batches by a background thread, so that the traced
+ * thread never waits for the device. Commands submitted to queues without
+ * profiling enabled are skipped.
+ */
+class TimelineWriter : public JsonWriter {
+  public:
+    ~TimelineWriter() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_one();
+        if (flusher.joinable()) {
+            flusher.join();
+        }
+        if (!pending.empty()) {
+            out.debug("{} enqueued commands did not complete before the "
+                      "trace finished",
+                      pending.size());
+        }
+    }
+
+    void prologue() override {
+        JsonWriter::prologue();
+        flusher = std::thread([this] { flush_loop(); });
+    }
+
+    void params(uint16_t trace_type, ur_function_t function,
+                const char *fname, const void *args,
+                const ur_result_t *resultp) override {
+        // Adapters are gone once their last reference is released, so this
+        // is the last chance to query the events of their queues.
+        if (trace_type == TRACE_FN_BEGIN &&
+            function == UR_FUNCTION_ADAPTER_RELEASE) {
+            std::lock_guard<std::mutex> lock(mutex);
+            flush();
+            return;
+        }
+        if (trace_type != TRACE_FN_END || *resultp != UR_RESULT_SUCCESS) {
+            return;
+        }
+        auto command = get_enqueued_command(function, args);
+        if (!command) {
+            return;
+        }
+
+        collector_call_guard guard;
+        if (urEventRetain(command->event) != UR_RESULT_SUCCESS) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back({*command, fname});
+    }
+
+  private:
+    static constexpr auto flush_interval = std::chrono::milliseconds(50);
+
+    struct pending_command {
+        enqueued_command command;
+        const char *fname;
+    };
+
+    struct queue_track {
+        // Difference between the device clock of the queue and
+        // Clock::time_since_epoch, in nanoseconds.
+        int64_t clock_offset = 0;
+        bool profiling = true;
+    };
+
+    /// Returns nullptr when the commands of the queue can't be shown.
+    queue_track *get_track(ur_queue_handle_t queue) {
+        auto [it, inserted] = tracks.try_emplace(queue);
+        if (!inserted) {
+            return it->second.profiling ? &it->second : nullptr;
+        }
+
+        ur_queue_flags_t flags = 0;
+        ur_device_handle_t device = nullptr;
+        uint64_t device_time = 0;
+        auto before = Clock::now();
+        if (urQueueGetInfo(queue, UR_QUEUE_INFO_FLAGS, sizeof(flags), &flags,
+                           nullptr) != UR_RESULT_SUCCESS ||
+            !(flags & UR_QUEUE_FLAG_PROFILING_ENABLE) ||
+            urQueueGetInfo(queue, UR_QUEUE_INFO_DEVICE, sizeof(device),
+                           &device, nullptr) != UR_RESULT_SUCCESS ||
+            urDeviceGetGlobalTimestamps(device, &device_time, nullptr) !=
+                UR_RESULT_SUCCESS) {
+            out.debug("queue {} doesn't have profiling enabled, its commands "
+                      "will not be shown",
+                      static_cast<void *>(queue));
+            it->second.profiling = false;
+            return nullptr;
+        }
+        auto after = Clock::now();
+        auto host_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             (before + (after - before) / 2).time_since_epoch())
+                             .count();
+        it->second.clock_offset =
+            static_cast<int64_t>(host_time) - static_cast<int64_t>(device_time);
+
+        out.info("{{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": {}, "
+                 "\"tid\": {}, \"args\": {{\"name\": \"queue {}\"}}}},",
+                 ur_getpid(), reinterpret_cast<uintptr_t>(queue),
+                 static_cast<void *>(queue));
+        return &it->second;
+    }
+
+    /// Reports completed commands and keeps the rest pending. Must be called
+    /// with mutex held.
+    void flush() {
+        collector_call_guard guard;
+        std::vector<pending_command> incomplete;
+        for (auto &p : pending) {
+            ur_event_status_t status = UR_EVENT_STATUS_QUEUED;
+            bool queried =
+                urEventGetInfo(p.command.event,
+                               UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                               sizeof(status), &status,
+                               nullptr) == UR_RESULT_SUCCESS;
+            if (queried && status != UR_EVENT_STATUS_COMPLETE) {
+                incomplete.push_back(p);
+                continue;
+            }
+
+            uint64_t start = 0;
+            uint64_t end = 0;
+            auto *track = queried ? get_track(p.command.queue) : nullptr;
+            if (track &&
+                urEventGetProfilingInfo(p.command.event,
+                                        UR_PROFILING_INFO_COMMAND_START,
+                                        sizeof(start), &start,
+                                        nullptr) == UR_RESULT_SUCCESS &&
+                urEventGetProfilingInfo(
+                    p.command.event, UR_PROFILING_INFO_COMMAND_END,
+                    sizeof(end), &end, nullptr) == UR_RESULT_SUCCESS) {
+                out.info("{{\"cat\": \"UR device\", \"ph\": \"X\", \"pid\": "
+                         "{}, \"tid\": {}, \"ts\": {}, \"dur\": {}, "
+                         "\"name\": \"{}\"}},",
+                         ur_getpid(),
+                         reinterpret_cast<uintptr_t>(p.command.queue),
+                         ns_to_us_str(static_cast<int64_t>(start) +
+                                      track->clock_offset),
+                         ns_to_us_str(static_cast<int64_t>(end - start)),
+                         p.fname);
+            }
+            urEventRelease(p.command.event);
+        }
+        pending = std::move(incomplete);
+    }
+
+    void flush_loop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopping) {
+            cv.wait_for(lock, flush_interval, [this] { return stopping; });
+            if (!stopping) {
+                flush();
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stopping = false;
+    std::thread flusher;
+    std::vector<pending_command> pending;
+    std::unordered_map<ur_queue_handle_t, queue_track> tracks;
+};
+
+/*
+ * Prints, every top_interval, the call rate, mean and p99 host latency, and
+ * the error rate of each function called during the interval, instead of
+ * the calls themselves. The traced threads only update counters of their
+ * own, which a background thread collects and resets, so the overhead of a
+ * call doesn't depend on the call rate or on the output.
+ */
+class TopWriter : public TraceWriter {
+  public:
+    ~TopWriter() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_one();
+        if (reporter.joinable()) {
+            reporter.join();
+        }
+        // The calls since the last report
+        report();
+    }
+
+    void prologue() override {
+        last_report = Clock::now();
+        reporter = std::thread([this] { report_loop(); });
+    }
+
+    void begin(uint64_t, const char *, std::string) override {}
+
+    void end(uint64_t, const char *fname, std::string, Timepoint tp,
+             Timepoint start_tp, const ur_result_t *resultp) override {
+        auto &stats = get_thread_stats();
+        auto ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(tp - start_tp)
+                .count();
+        std::lock_guard<std::mutex> lock(stats.mutex);
+        stats.functions[fname].add(static_cast<uint64_t>(ns),
+                                   *resultp != UR_RESULT_SUCCESS);
+    }
+
+  private:
+    /// The calls of a function during an interval, with their latencies in
+    /// buckets of a quarter of a power of two nanoseconds, so that the
+    /// percentiles are within 25% with a fixed size.
+    struct function_stats {
+        static constexpr size_t num_buckets = 4 * 63;
+
+        void add(uint64_t ns, bool error) {
+            calls++;
+            errors += error;
+            total_ns += ns;
+            buckets[bucket(ns)]++;
+        }
+
+        void merge(const function_stats &other) {
+            calls += other.calls;
+            errors += other.errors;
+            total_ns += other.total_ns;
+            for (size_t i = 0; i < num_buckets; ++i) {
+                buckets[i] += other.buckets[i];
+            }
+        }
+
+        /// The middle of the bucket of the given fraction of the calls
+        std::chrono::nanoseconds percentile(double fraction) const {
+            uint64_t rank = static_cast<uint64_t>(fraction * calls);
+            uint64_t count = 0;
+            for (size_t i = 0; i < num_buckets; ++i) {
+                count += buckets[i];
+                if (count > rank) {
+                    return std::chrono::nanoseconds(middle(i));
+                }
+            }
+            return std::chrono::nanoseconds(0);
+        }
+
+        static size_t bucket(uint64_t ns) {
+            if (ns < 4) {
+                return ns;
+            }
+            unsigned msb = 0;
+            for (unsigned shift = 32; shift; shift /= 2) {
+                if (ns >> (msb + shift)) {
+                    msb += shift;
+                }
+            }
+            return 4 * (msb - 1) + ((ns >> (msb - 2)) & 3);
+        }
+
+        static uint64_t middle(size_t bucket) {
+            if (bucket < 4) {
+                return bucket;
+            }
+            unsigned shift = bucket / 4 - 1;
+            uint64_t lower = (4 + bucket % 4) << shift;
+            return lower + ((uint64_t(1) << shift) >> 1);
+        }
+
+        uint64_t calls = 0;
+        uint64_t errors = 0;
+        uint64_t total_ns = 0;
+        std::array<uint64_t, num_buckets> buckets{};
+    };
+
+    struct thread_stats {
+        std::mutex mutex;
+        // Keyed by the names of the tracing layer, which are literals
+        std::unordered_map<const char *, function_stats> functions;
+    };
+
+    thread_stats &get_thread_stats() {
+        // Kept by the writer after the thread exits, until it's reported
+        thread_local std::shared_ptr<thread_stats> stats = [this] {
+            auto stats = std::make_shared<thread_stats>();
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.push_back(stats);
+            return stats;
+        }();
+        return *stats;
+    }
+
+    void report() {
+        std::unordered_map<std::string_view, function_stats> totals;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto &stats : threads) {
+                std::lock_guard<std::mutex> thread_lock(stats->mutex);
+                for (auto &[fname, function] : stats->functions) {
+                    if (function.calls) {
+                        totals[fname].merge(function);
+                        function = function_stats{};
+                    }
+                }
+            }
+            // The threads which exited are reported for the last time
+            threads.erase(std::remove_if(threads.begin(), threads.end(),
+                                         [](const auto &stats) {
+                                             return stats.use_count() == 1;
+                                         }),
+                          threads.end());
+        }
+
+        auto now = Clock::now();
+        std::chrono::duration<double> interval = now - last_report;
+        last_report = now;
+
+        std::vector<std::pair<std::string_view, function_stats *>> rows;
+        uint64_t calls = 0;
+        uint64_t errors = 0;
+        for (auto &[fname, function] : totals) {
+            rows.emplace_back(fname, &function);
+            calls += function.calls;
+            errors += function.errors;
+        }
+        std::sort(rows.begin(), rows.end(), [](const auto &a, const auto &b) {
+            return a.second->calls != b.second->calls
+                       ? a.second->calls > b.second->calls
+                       : a.first < b.first;
+        });
+
+        out.info("top: {} calls, {} errors in {}s", calls, errors,
+                 interval.count());
+        std::ostringstream header;
+        header << std::left << std::setw(40) << "function" << std::right
+               << std::setw(10) << "calls" << std::setw(12) << "calls/s"
+               << std::setw(12) << "mean" << std::setw(12) << "p99"
+               << std::setw(10) << "errors";
+        out.info("{}", header.str());
+        for (auto &[fname, function] : rows) {
+            auto mean = std::chrono::nanoseconds(function->total_ns /
+                                                 function->calls);
+            std::ostringstream row;
+            row << std::left << std::setw(40) << fname << std::right
+                << std::setw(10) << function->calls << std::setw(12)
+                << std::fixed << std::setprecision(1)
+                << function->calls / interval.count() << std::setw(12)
+                << std::defaultfloat
+                << time_to_str(mean, cli_args.time_unit) << std::setw(12)
+                << time_to_str(function->percentile(0.99),
+                               cli_args.time_unit)
+                << std::setw(9) << std::fixed << std::setprecision(1)
+                << 100.0 * function->errors / function->calls << "%";
+            out.info("{}", row.str());
+        }
+    }
+
+    void report_loop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopping) {
+            cv.wait_for(lock, cli_args.top_interval,
+                        [this] { return stopping; });
+            if (!stopping) {
+                lock.unlock();
+                report();
+                lock.lock();
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stopping = false;
+    std::thread reporter;
+    Timepoint last_report = Clock::now();
+    std::vector<std::shared_ptr<thread_stats>> threads;
+};
+
 std::unique_ptr<TraceWriter> create_writer() {
     switch (cli_args.output_format) {
     case OUTPUT_HUMAN_READABLE:
         return std::make_unique<HumanReadable>();
     case OUTPUT_JSON:
         return std::make_unique<JsonWriter>();
+    case OUTPUT_TIMELINE:
+        return std::make_unique<TimelineWriter>();
+    case OUTPUT_TOP:
+        return std::make_unique<TopWriter>();
     default:
         ur::unreachable();
     }
@@ -319,6 +845,14 @@ XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
     auto time_for_end = Clock::now();
     auto *args = static_cast<const xpti::function_with_args_t *>(user_data);
 
+    if (collector_call) {
+        return;
+    }
+
+    writer()->params(trace_type, (enum ur_function_t)args->function_id,
+                     args->function_name, args->args_data,
+                     static_cast<const ur_result_t *>(args->ret_data));
+
     if (auto regex = cli_args.filter) {
         if (!std::regex_match(args->function_name, *regex)) {
             out.debug("function {} does not match regex filter, skipping...",
@@ -328,7 +862,8 @@ XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
     }
 
     std::ostringstream args_str;
-    if (cli_args.no_args) {
+    // The top output doesn't show the arguments
+    if (cli_args.no_args || cli_args.output_format == OUTPUT_TOP) {
         args_str << "...";
     } else {
         ur::extras::printFunctionParams(
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file decoder.cpp
+ *
+ * This file contains the offline decoder for binary traces written by the
+ * tracing layer (UR_LAYER_TRACING_OPTIONS=binary_output:<file>). It prints the
+ * recorded calls in the same human readable format as the UR collector.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ur_api.h"
+#include "ur_print.hpp"
+#include "ur_tracing_binary.hpp"
+
+using namespace ur_tracing_layer;
+
+static void usage(const char *prog) {
+    std::cerr << "usage: " << prog
+              << " [--print-begin] [--profiling] [--no-args] <trace file>\n";
+}
+
+static std::string time_to_str(std::chrono::nanoseconds dur) {
+    std::ostringstream ostr;
+    if (dur.count() < 1000) {
+        ostr << dur.count() << "ns";
+    } else if (dur.count() < 1000 * 1000) {
+        ostr << std::chrono::duration<double, std::micro>(dur).count() << "us";
+    } else if (dur.count() < 1000 * 1000 * 1000) {
+        ostr << std::chrono::duration<double, std::milli>(dur).count() << "ms";
+    } else {
+        ostr << std::chrono::duration<double>(dur).count() << "s";
+    }
+    return ostr.str();
+}
+
+static std::string args_to_str(const binary::record_t &begin) {
+    std::ostringstream ostr;
+    size_t recorded = std::min<size_t>(begin.numArgs, binary::MAX_ARGS);
+    for (size_t i = 0; i < recorded; ++i) {
+        if (i) {
+            ostr << ", ";
+        }
+        ostr << "0x" << std::hex << begin.args[i];
+    }
+    if (begin.numArgs > recorded) {
+        ostr << ", ...";
+    }
+    return ostr.str();
+}
+
+int main(int argc, const char **argv) {
+    bool print_begin = false;
+    bool profiling = false;
+    bool no_args = false;
+    const char *path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--print-begin") {
+            print_begin = true;
+        } else if (arg == "--profiling") {
+            profiling = true;
+        } else if (arg == "--no-args") {
+            no_args = true;
+        } else if (arg == "-h" || arg == "--help") {
+            usage(argv[0]);
+            return 0;
+        } else if (arg[0] == '-' || path) {
+            usage(argv[0]);
+            return 1;
+        } else {
+            path = argv[i];
+        }
+    }
+    if (!path) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        std::cerr << "unable to open " << path << "\n";
+        return 1;
+    }
+
+    binary::file_header_t header{};
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.magic, binary::FILE_MAGIC, sizeof(header.magic)) ||
+        header.version != binary::FILE_VERSION ||
+        header.recordSize != sizeof(binary::record_t)) {
+        std::cerr << path << " is not a supported binary UR trace\n";
+        fclose(file);
+        return 1;
+    }
+
+    std::unordered_map<uint32_t, std::string> names;
+    std::vector<binary::record_t> records;
+    binary::record_t record;
+    while (fread(&record, sizeof(record), 1, file) == 1) {
+        if (record.kind == binary::RECORD_NAME) {
+            std::string name(record.args[0], '\0');
+            if (fread(name.data(), 1, name.size(), file) != name.size()) {
+                break;
+            }
+            names[record.functionId] = std::move(name);
+        } else {
+            records.push_back(record);
+        }
+    }
+    fclose(file);
+
+    // The drain thread writes thread buffers one after another, restore the
+    // order in which the calls were made.
+    std::stable_sort(records.begin(), records.end(),
+                     [](const auto &a, const auto &b) {
+                         return a.timestamp < b.timestamp;
+                     });
+
+    auto name_of = [&](uint32_t id) {
+        auto it = names.find(id);
+        if (it != names.end()) {
+            return it->second;
+        }
+        std::ostringstream ostr;
+        ostr << static_cast<ur_function_t>(id);
+        return ostr.str();
+    };
+
+    std::map<uint64_t, binary::record_t> pending;
+    for (auto &rec : records) {
+        switch (rec.kind) {
+        case binary::RECORD_BEGIN: {
+            pending[rec.instance] = rec;
+            if (print_begin) {
+                std::cout << "begin(" << rec.instance << ") - "
+                          << name_of(rec.functionId) << "("
+                          << (no_args ? "..." : args_to_str(rec)) << ");\n";
+            }
+        } break;
+        case binary::RECORD_END: {
+            auto it = pending.find(rec.instance);
+            if (print_begin) {
+                std::cout << "end(" << rec.instance << ") - ";
+            }
+            std::cout << name_of(rec.functionId) << "(";
+            if (it == pending.end() || no_args) {
+                std::cout << "...";
+            } else {
+                std::cout << args_to_str(it->second);
+            }
+            std::cout << ") -> " << static_cast<ur_result_t>(rec.result)
+                      << ";";
+            if (profiling && it != pending.end()) {
+                std::cout << " ("
+                          << time_to_str(std::chrono::nanoseconds(
+                                 rec.timestamp - it->second.timestamp))
+                          << ")";
+            }
+            std::cout << "\n";
+            if (it != pending.end()) {
+                pending.erase(it);
+            }
+        } break;
+        case binary::RECORD_DROPPED: {
+            std::cout << "<" << rec.args[0] << " records of thread "
+                      << rec.threadIndex << " dropped>\n";
+        } break;
+        default:
+            std::cerr << "skipping unknown record kind " << rec.kind << "\n";
+            break;
+        }
+    }
+
+    return 0;
+}
@@ -48,10 +48,17 @@ parser.add_argument("--profiling", help="Measure function execution time.", acti
 parser.add_argument("--filter", help="Only trace functions that match the provided regex filter.")
 parser.add_argument("--mock", help="Force the use of the mock adapter.", action="store_true")
 parser.add_argument("--adapter", help="Force the use of the provided adapter.", action="append", default=[])
-parser.add_argument("--json", help="Write output in a JSON Trace Event Format.", action="store_true")
+output_group = parser.add_mutually_exclusive_group()
+output_group.add_argument("--json", help="Write output in a JSON Trace Event Format.", action="store_true")
+output_group.add_argument("--timeline", help="Write output in a JSON Trace Event Format, with the device execution of enqueued commands on one track per queue. Only queues created with UR_QUEUE_FLAG_PROFILING_ENABLE are shown.", action="store_true")
+output_group.add_argument("--top", help="Print the call rate, mean and p99 latency, and error rate of each function periodically instead of every call.", action="store_true")
+parser.add_argument("--top-interval", type=int, default=1000, help="Milliseconds between the reports of --top.")
 group = parser.add_mutually_exclusive_group()
 group.add_argument("--file", help="Write trace output to a file with the given name instead of stderr.")
 group.add_argument("--stdout", help="Write trace output to stdout instead of stderr.", action="store_true")
+parser.add_argument("--binary-output", help="Write fixed-size binary records to the given file from the tracing layer instead of notifying the collector. Use ur_trace_decode to print them.")
+parser.add_argument("--sample-every", type=int, help="Only trace every Nth call of each function.")
+parser.add_argument("--sample-window", help="Only trace calls made during the first M milliseconds of every K seconds, given as M,K.")
 parser.add_argument("--no-args", help="Don't pretty print traced functions arguments.", action="store_true")
 parser.add_argument("--print-begin", help="Print on function begin.", action="store_true")
 parser.add_argument("--time-unit", choices=['ns', 'us', 'ms', 's', 'auto'], default='auto', help="Use a specific unit of time for profiling.")
@@ -78,6 +85,11 @@ if args.no_args:
     collector_args += "no_args;"
 if args.json:
     collector_args += "json;"
+if args.timeline:
+    collector_args += "timeline;"
+if args.top:
+    collector_args += "top;"
+    collector_args += "top_interval:" + str(args.top_interval) + ";"
 env['UR_COLLECTOR_ARGS'] = collector_args
 
 log_collector = ""
@@ -94,6 +106,18 @@ else:
     log_collector += "output:stderr"
 env['UR_LOG_COLLECTOR'] = log_collector
 
+tracing_options = ""
+if args.binary_output:
+    tracing_options += "binary_output:" + args.binary_output + ";"
+if args.filter:
+    tracing_options += "filter:" + args.filter + ";"
+if args.sample_every:
+    tracing_options += "sample_every:" + str(args.sample_every) + ";"
+if args.sample_window:
+    tracing_options += "sample_window:" + args.sample_window + ";"
+if tracing_options:
+    env['UR_LAYER_TRACING_OPTIONS'] = tracing_options
+
 env['XPTI_TRACE_ENABLE'] = "1"
 
 env['UR_ENABLE_LAYERS'] = "UR_LAYER_TRACING"